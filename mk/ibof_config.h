@@ -1,6 +1,7 @@
 #pragma once
 
 #undef IBOF_CONFIG_BDEV_FIO_PLUGIN
+#define IBOF_CONFIG_DUMP_SHARED_PTR 1
 #undef IBOF_CONFIG_FE_QOS
 #undef IBOF_CONFIG_GCOV
 #undef IBOF_CONFIG_LIBRARY_BUILD
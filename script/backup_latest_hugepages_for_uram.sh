@@ -10,6 +10,9 @@ DATA_POSTFIX=uram.data
 # PID: latest pid for poseidonos
 # Start page #: latest logical page number in hugepage for uram
 # Page count: # of hugepages to backup for uram
+#
+# Pages without data are left as holes in the backup file (conv=sparse),
+# and poseidonos skips them on restore.
 
 RED_COLOR="\033[1;31m"
 GREEN_COLOR="\033[0;32m"
@@ -41,7 +44,7 @@ do
 	if [ ! -f $FIRST_BIN_FILE_NAME ]; then
 		print_error ${uram_name}
 	else
-		sudo dd if="${FIRST_BIN_FILE_NAME}" of=${URAM_DATA_FILE} bs=2M count=1 status=none
+		sudo dd if="${FIRST_BIN_FILE_NAME}" of=${URAM_DATA_FILE} bs=2M count=1 conv=sparse status=none
 		if [ $? -ne 0 ]; then
 			print_error ${uram_name}
 			continue
@@ -57,7 +60,7 @@ do
 				IO_SUCCESS=0
 				break
 			fi
-			sudo dd if="${FILE_NAME}" of=${URAM_DATA_FILE} bs=2M count=1 seek=$FILE_OFFSET conv=nocreat,notrunc  status=none &
+			sudo dd if="${FILE_NAME}" of=${URAM_DATA_FILE} bs=2M count=1 seek=$FILE_OFFSET conv=nocreat,notrunc,sparse status=none &
 			FILE_OFFSET=$((FILE_OFFSET+1))
 		done
 		wait
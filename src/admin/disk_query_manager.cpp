@@ -46,9 +46,11 @@
 #include "src/array_mgmt/array_manager.h"
 #include "src/array_models/dto/device_set.h"
 #include "src/device/device_manager.h"
+#include "src/event_scheduler/event_scheduler.h"
 #include "src/include/pos_event_id.hpp"
 #include "src/io_scheduler/io_dispatcher.h"
 #include "src/logger/logger.h"
+#include "src/resource_checker/smart_sampler.h"
 namespace pos
 {
 GetLogPageContext::GetLogPageContext(void* data, uint16_t lid)
@@ -59,7 +61,8 @@ GetLogPageContext::GetLogPageContext(void* data, uint16_t lid)
 
 DiskQueryManager::DiskQueryManager(struct spdk_nvme_cmd* cmd, struct spdk_nvme_health_information_page* resultPage, pos_io* io,
     uint32_t originCore, CallbackSmartPtr callback, IArrayInfo* info, IDevInfo* devInfo,
-    IIODispatcher* dispatcher, IArrayDevMgr* arrayDevMgr, SmartLogMgr* smartLogMgr)
+    IIODispatcher* dispatcher, IArrayDevMgr* arrayDevMgr, SmartLogMgr* smartLogMgr,
+    SmartSampler* smartSampler)
 : cmd(cmd),
   resultPage(resultPage),
   io(io),
@@ -69,20 +72,27 @@ DiskQueryManager::DiskQueryManager(struct spdk_nvme_cmd* cmd, struct spdk_nvme_h
   devInfo(devInfo),
   dispatcher(dispatcher),
   arrayDevMgr(arrayDevMgr),
-  smartLogMgr(smartLogMgr)
+  smartLogMgr(smartLogMgr),
+  smartSampler(smartSampler)
 {
+    if (nullptr == this->smartSampler)
+    {
+        this->smartSampler = SmartSamplerSingleton::Instance();
+    }
 }
 
 bool
 DiskQueryManager::SendSmartCommandtoDisk(void)
 {
     vector<UblockSharedPtr> devices;
+    vector<string> deviceNames;
     DeviceSet<string> nameSet = arrayInfo->GetDevNames();
     for (string deviceName : nameSet.data)
     {
         DevName name(deviceName);
         UblockSharedPtr uBlock = devInfo->GetDev(name);
         devices.push_back(uBlock);
+        deviceNames.push_back(deviceName);
     }
 
     if (devices.size() == 0)
@@ -100,14 +110,24 @@ DiskQueryManager::SendSmartCommandtoDisk(void)
         addr.lba = INVALID_LBA;
         addr.arrayDev = get<0>(devtuple);
         struct spdk_nvme_health_information_page* payload = new struct spdk_nvme_health_information_page();
+        CallbackSmartPtr smartUpdateRequest(new SmartLogUpdateRequest(resultPage, payload, io, originCore));
+        smartUpdateRequest->SetCallee(callback);
+
+        // A sampled page is served from memory without an admin command to the device
+        if (smartSampler->IsEnabled() && smartSampler->GetHealthPage(deviceNames[i], *payload))
+        {
+            if (false == smartUpdateRequest->Execute())
+            {
+                EventSchedulerSingleton::Instance()->EnqueueEvent(smartUpdateRequest);
+            }
+            continue;
+        }
+
         uint16_t lid = SPDK_NVME_LOG_HEALTH_INFORMATION;
         GetLogPageContext* smartLogPageContext = new GetLogPageContext(payload, lid);
         UbioSmartPtr ubio(new Ubio((void*)smartLogPageContext, sizeof(struct spdk_nvme_health_information_page), arrayInfo->GetIndex()));
         ubio->dir = UbioDir::GetLogPage;
         ubio->SetPba(addr);
-
-        CallbackSmartPtr smartUpdateRequest(new SmartLogUpdateRequest(resultPage, payload, io, originCore));
-        smartUpdateRequest->SetCallee(callback);
         ubio->SetCallback(smartUpdateRequest);
         dispatcher->Submit(ubio);
     }
@@ -47,6 +47,7 @@ class IDevInfo;
 class IIODispatcher;
 class IArrayDevMgr;
 class SmartLogMgr;
+class SmartSampler;
 
 static const uint64_t INVALID_LBA = UINT64_MAX;
 class GetLogPageContext
@@ -62,7 +63,8 @@ class DiskQueryManager : public Event
 public:
     DiskQueryManager(struct spdk_nvme_cmd* cmd, struct spdk_nvme_health_information_page* resultPage, pos_io* io,
         uint32_t originCore, CallbackSmartPtr callback, IArrayInfo* info, IDevInfo* devInfo,
-        IIODispatcher* dispatcher, IArrayDevMgr* arrayDevMgr, SmartLogMgr* smartLogMgr);
+        IIODispatcher* dispatcher, IArrayDevMgr* arrayDevMgr, SmartLogMgr* smartLogMgr,
+        SmartSampler* smartSampler = nullptr);
     bool Execute(void);
     bool SendSmartCommandtoDisk(void);
     bool SendLogPagetoDisk(struct spdk_nvme_cmd* cmd);
@@ -78,5 +80,6 @@ private:
     IIODispatcher* dispatcher;
     IArrayDevMgr* arrayDevMgr;
     SmartLogMgr* smartLogMgr;
+    SmartSampler* smartSampler;
 };
 } // namespace pos
@@ -35,6 +35,7 @@
 #include <string>
 
 #include "src/array_mgmt/array_manager.h"
+#include "src/mapper/reversemap/reverse_map_footer.h"
 namespace pos
 {
 void
@@ -50,6 +51,7 @@ AllocatorAddressInfo::Init(IArrayInfo* iArrayInfo)
     blksPerSegment = blksPerStripe * udSize->stripesPerSegment;
     stripesPerSegment = udSize->stripesPerSegment;
     numUserAreaSegments = udSize->totalSegments;
+    footerBlksPerStripe = ReverseMapFooter::GetBlockCount(blksPerStripe);
     isUT = false;
 }
 
@@ -52,6 +52,8 @@ public:
     virtual uint32_t GetblksPerSegment(void) { return blksPerSegment; }
     virtual uint32_t GetstripesPerSegment(void) { return stripesPerSegment; }
     virtual uint32_t GetnumUserAreaSegments(void) { return numUserAreaSegments; }
+    // Blocks at the end of each stripe that keep its reverse map, never allocated
+    virtual uint32_t GetfooterBlksPerStripe(void) { return footerBlksPerStripe; }
 
     void SetblksPerStripe(uint32_t value) { blksPerStripe = value; }
     void SetchunksPerStripe(uint32_t value) { chunksPerStripe = value; }
@@ -60,6 +62,7 @@ public:
     void SetblksPerSegment(uint32_t value) { blksPerSegment = value; }
     void SetstripesPerSegment(uint32_t value) { stripesPerSegment = value; }
     void SetnumUserAreaSegments(uint32_t value) { numUserAreaSegments = value; }
+    void SetfooterBlksPerStripe(uint32_t value) { footerBlksPerStripe = value; }
     void SetUT(bool ut) { isUT = ut; }
     virtual bool IsUT(void) { return isUT; }
 
@@ -71,6 +74,7 @@ private:
     uint32_t blksPerSegment;
     uint32_t stripesPerSegment;
     uint32_t numUserAreaSegments;
+    uint32_t footerBlksPerStripe = 0;
     bool isUT;
 };
 
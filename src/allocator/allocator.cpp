@@ -74,6 +74,9 @@ Allocator::Allocator(IArrayInfo* info, IStateControl* iState)
 {
     _CreateSubmodules();
     _SetGCThreshold();
+    _SetGcVictimPolicy();
+    _SetFreeSegmentPolicy();
+    _SetGcHotColdSeparation();
     POS_TRACE_INFO(EID(ALLOCATOR_INFO), "Allocator in Array:{} was Created", arrayName);
 }
 
@@ -130,6 +133,12 @@ Allocator::PrepareVersionedSegmentCtx(IVersionedSegmentContext* vscSegCtx)
     contextManager->PrepareVersionedSegmentCtx(vscSegCtx);
 }
 
+void
+Allocator::StartSegmentTrim(void)
+{
+    contextManager->GetSegmentCtx()->StartSegmentTrim();
+}
+
 void
 Allocator::Dispose(void)
 {
@@ -568,6 +577,77 @@ Allocator::_SetGCThreshold(void)
     SetUrgentThreshold(urgentGcThreshold);
 }
 
+void
+Allocator::_SetGcVictimPolicy(void)
+{
+    std::string policyName = "greedy";
+    int ret = ConfigManagerSingleton::Instance()->GetValue("gc_threshold", "victim_policy",
+        static_cast<void*>(&policyName), ConfigType::CONFIG_TYPE_STRING);
+    if (ret != 0)
+    {
+        POS_TRACE_WARN(EID(GC_THRESHOLD_SETTING_NOT_FOUND),
+            "victim_policy is not configured, ret:{}, use greedy", ret);
+    }
+
+    GcVictimPolicy policy = GcVictimPolicy::GC_VICTIM_GREEDY;
+    if (policyName == "cost_benefit")
+    {
+        policy = GcVictimPolicy::GC_VICTIM_COST_BENEFIT;
+    }
+    POS_TRACE_INFO(EID(GC_THREHOLD_SETTING_PRINT), "victim_policy:{}", policyName);
+
+    SegmentCtx* segmentCtx = (contextManager != nullptr) ? contextManager->GetSegmentCtx() : nullptr;
+    if (segmentCtx != nullptr)
+    {
+        segmentCtx->SetGcVictimPolicy(policy);
+    }
+}
+
+void
+Allocator::_SetFreeSegmentPolicy(void)
+{
+    std::string policyName = "lowest_id";
+    int ret = ConfigManagerSingleton::Instance()->GetValue("gc_threshold", "free_segment_policy",
+        static_cast<void*>(&policyName), ConfigType::CONFIG_TYPE_STRING);
+    if (ret != 0)
+    {
+        POS_TRACE_WARN(EID(GC_THRESHOLD_SETTING_NOT_FOUND),
+            "free_segment_policy is not configured, ret:{}, use lowest_id", ret);
+    }
+
+    FreeSegmentPolicy policy = FreeSegmentPolicy::FREE_SEGMENT_LOWEST_ID;
+    if (policyName == "round_robin")
+    {
+        policy = FreeSegmentPolicy::FREE_SEGMENT_ROUND_ROBIN;
+    }
+    POS_TRACE_INFO(EID(GC_THREHOLD_SETTING_PRINT), "free_segment_policy:{}", policyName);
+
+    SegmentCtx* segmentCtx = (contextManager != nullptr) ? contextManager->GetSegmentCtx() : nullptr;
+    if (segmentCtx != nullptr)
+    {
+        segmentCtx->SetFreeSegmentPolicy(policy);
+    }
+}
+
+void
+Allocator::_SetGcHotColdSeparation(void)
+{
+    bool enable = false;
+    int ret = ConfigManagerSingleton::Instance()->GetValue("gc_threshold", "hot_cold_separation",
+        &enable, ConfigType::CONFIG_TYPE_BOOL);
+    if (ret != 0)
+    {
+        POS_TRACE_WARN(EID(GC_THRESHOLD_SETTING_NOT_FOUND),
+            "hot_cold_separation is not configured, ret:{}, disabled", ret);
+    }
+    POS_TRACE_INFO(EID(GC_THREHOLD_SETTING_PRINT), "hot_cold_separation:{}", enable);
+
+    if (stripeManager != nullptr)
+    {
+        stripeManager->SetHotColdSeparation(enable);
+    }
+}
+
 void
 Allocator::_DeleteSubmodules(void)
 {
@@ -91,11 +91,15 @@ public:
     virtual IContextReplayer* GetIContextReplayer(void);
     virtual ISegmentCtx* GetISegmentCtx(void);
     void PrepareVersionedSegmentCtx(IVersionedSegmentContext* vscSegCtx);
+    virtual void StartSegmentTrim(void);
 
 private:
     void _CreateSubmodules(void);
     void _DeleteSubmodules(void);
     void _SetGCThreshold(void);
+    void _SetGcVictimPolicy(void);
+    void _SetFreeSegmentPolicy(void);
+    void _SetGcHotColdSeparation(void);
     void _RegisterToAllocatorService(void);
     void _UnregisterFromAllocatorService(void);
 
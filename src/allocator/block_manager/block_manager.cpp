@@ -36,7 +36,9 @@
 
 #include "src/allocator/context_manager/allocator_ctx/allocator_ctx.h"
 #include "src/allocator/context_manager/block_allocation_status.h"
+#include "src/allocator/include/allocator_const.h"
 #include "src/allocator/stripe_manager/stripe_manager.h"
+#include "src/cpu_affinity/affinity_manager.h"
 #include "src/logger/logger.h"
 #include "src/telemetry/telemetry_client/telemetry_publisher.h"
 
@@ -48,7 +50,9 @@ BlockManager::BlockManager(TelemetryPublisher* tp_, AllocatorCtx* allocCtx_, Blo
   stripeManager(nullptr),
   allocStatus(allocStatus),
   arrayId(arrayId),
-  tp(tp_)
+  tp(tp_),
+  hostStripeCount(0),
+  gcStripeCount(0)
 {
     allocCtx = allocCtx_;
 }
@@ -67,7 +71,7 @@ BlockManager::Init(StripeManager* stripeManager_)
 }
 
 std::pair<VirtualBlks, StripeId>
-BlockManager::AllocateWriteBufferBlks(uint32_t volumeId, uint32_t numBlks)
+BlockManager::AllocateWriteBufferBlks(uint32_t volumeId, uint32_t numBlks, uint32_t originCore, WriteStreamType stream)
 {
     VirtualBlks allocatedBlks;
 
@@ -78,13 +82,34 @@ BlockManager::AllocateWriteBufferBlks(uint32_t volumeId, uint32_t numBlks)
         return {allocatedBlks, UNMAP_STRIPE};
     }
 
-    return _AllocateBlks(volumeId, numBlks);
+    AffinityManager* affinityManager = AffinityManagerSingleton::Instance();
+    ASTailArrayIdx asTailArrayIdx = GetActiveStripeTailIndex(volumeId, originCore,
+        affinityManager->GetNumaIdFromCoreId(originCore), affinityManager->GetNumaCount(), stream);
+    return _AllocateBlks(asTailArrayIdx, numBlks);
 }
 
 StripeSmartPtr
 BlockManager::AllocateGcDestStripe(uint32_t volumeId)
 {
-    return stripeManager->AllocateGcDestStripe(volumeId);
+    StripeSmartPtr stripe = stripeManager->AllocateGcDestStripe(volumeId);
+    if (stripe != nullptr)
+    {
+        gcStripeCount++;
+        _PublishWriteAmplification();
+    }
+    return stripe;
+}
+
+StripeSmartPtr
+BlockManager::AllocateGcColdDestStripe(uint32_t volumeId)
+{
+    StripeSmartPtr stripe = stripeManager->AllocateGcColdDestStripe(volumeId);
+    if (stripe != nullptr)
+    {
+        gcStripeCount++;
+        _PublishWriteAmplification();
+    }
+    return stripe;
 }
 
 void
@@ -152,6 +177,8 @@ BlockManager::_AllocateBlks(ASTailArrayIdx asTailArrayIdx, int numBlks)
         }
 
         allocatedUserStripe = allocatedStripes.second;
+        hostStripeCount++;
+        _PublishWriteAmplification();
     }
     else
     {
@@ -173,8 +200,8 @@ BlockManager::_AllocateBlocksFromActiveStripe(ASTailArrayIdx asTailArrayIdx, int
 
     if (_IsValidOffset(curVsa.offset + numBlks - 1) == false)
     {
-        allocatedBlks.numBlks = addrInfo->GetblksPerStripe() - curVsa.offset;
-        updatedTail.offset = addrInfo->GetblksPerStripe();
+        allocatedBlks.numBlks = _GetDataBlksPerStripe() - curVsa.offset;
+        updatedTail.offset = _GetDataBlksPerStripe();
     }
     else
     {
@@ -185,4 +212,29 @@ BlockManager::_AllocateBlocksFromActiveStripe(ASTailArrayIdx asTailArrayIdx, int
 
     return allocatedBlks;
 }
+
+void
+BlockManager::_PublishWriteAmplification(void)
+{
+    if (tp == nullptr)
+    {
+        return;
+    }
+
+    uint64_t host = hostStripeCount;
+    uint64_t gc = gcStripeCount;
+
+    POSMetricValue hostCount;
+    hostCount.gauge = host;
+    tp->PublishData(TEL30004_ALCT_HOST_STRIPE_CNT, hostCount, MT_GAUGE);
+
+    POSMetricValue gcCount;
+    gcCount.gauge = gc;
+    tp->PublishData(TEL30005_ALCT_GC_STRIPE_CNT, gcCount, MT_GAUGE);
+
+    // (host + gc) / host, scaled by 100
+    POSMetricValue waf;
+    waf.gauge = (host == 0) ? 0 : (host + gc) * 100 / host;
+    tp->PublishData(TEL30006_ALCT_WRITE_AMPLIFICATION, waf, MT_GAUGE);
+}
 } // namespace pos
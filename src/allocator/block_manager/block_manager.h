@@ -58,8 +58,9 @@ public:
     virtual ~BlockManager(void) = default;
     virtual void Init(StripeManager* stripeManager);
 
-    virtual std::pair<VirtualBlks, StripeId> AllocateWriteBufferBlks(uint32_t volumeId, uint32_t numBlks) override;
+    virtual std::pair<VirtualBlks, StripeId> AllocateWriteBufferBlks(uint32_t volumeId, uint32_t numBlks, uint32_t originCore, WriteStreamType stream) override;
     virtual StripeSmartPtr AllocateGcDestStripe(uint32_t volumeId);
+    virtual StripeSmartPtr AllocateGcColdDestStripe(uint32_t volumeId);
     virtual void ProhibitUserBlkAlloc(void) override;
     virtual void PermitUserBlkAlloc(void) override;
     virtual bool IsProhibitedUserBlkAlloc(void) override;
@@ -90,14 +91,19 @@ protected:
     std::pair<VirtualBlks, StripeId> _AllocateBlks(ASTailArrayIdx asTailArrayIdx, int numBlks);
     VirtualBlks _AllocateBlocksFromActiveStripe(ASTailArrayIdx asTailArrayIdx, int numBlks);
 
+    uint32_t _GetDataBlksPerStripe(void)
+    {
+        return addrInfo->GetblksPerStripe() - addrInfo->GetfooterBlksPerStripe();
+    }
     bool _IsStripeFull(VirtualBlkAddr addr)
     {
-        return addr.offset == addrInfo->GetblksPerStripe();
+        return addr.offset == _GetDataBlksPerStripe();
     }
     bool _IsValidOffset(uint64_t stripeOffset)
     {
-        return stripeOffset < addrInfo->GetblksPerStripe();
+        return stripeOffset < _GetDataBlksPerStripe();
     }
+    void _PublishWriteAmplification(void);
 
     // DOCs
     AllocatorAddressInfo* addrInfo;
@@ -109,6 +115,9 @@ protected:
 
     AllocatorCtx* allocCtx;
     TelemetryPublisher* tp;
+
+    std::atomic<uint64_t> hostStripeCount;
+    std::atomic<uint64_t> gcStripeCount;
 };
 
 } // namespace pos
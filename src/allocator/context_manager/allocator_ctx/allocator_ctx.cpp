@@ -46,7 +46,8 @@
 namespace pos
 {
 AllocatorCtx::AllocatorCtx(TelemetryPublisher* tp_, AllocatorCtxHeader* header, BitMapMutex* allocWbLsidBitmap_, AllocatorAddressInfo* info_)
-: ctxStoredVersion(0),
+: ctxHeader(),
+  ctxStoredVersion(0),
   ctxDirtyVersion(0),
   addrInfo(info_),
   tp(tp_),
@@ -62,6 +63,9 @@ AllocatorCtx::AllocatorCtx(TelemetryPublisher* tp_, AllocatorCtxHeader* header,
         ctxHeader.sig = header->sig;
         ctxHeader.numValidWbLsid = header->numValidWbLsid;
         ctxHeader.ctxVersion = header->ctxVersion;
+        ctxHeader.footerLayoutSig = header->footerLayoutSig;
+        ctxHeader.footerBlksPerStripe = header->footerBlksPerStripe;
+        _DisableFooterOfOldLayout();
     }
 
     allocWbLsidBitmap = allocWbLsidBitmap_;
@@ -92,8 +96,13 @@ AllocatorCtx::Init(void)
         activeStripeTail[asTailArrayIdx] = UNMAP_VSA;
     }
     currentSsdLsid = STRIPES_PER_SEGMENT - 1;
+    _RebuildFreeWbStripeQueue();
 
     ctxHeader.ctxVersion = 0;
+    // Stored with the context file created with the array, and overwritten
+    // by the stored one when the file is loaded
+    ctxHeader.footerLayoutSig = AllocatorCtxHeader::SIG_FOOTER_LAYOUT;
+    ctxHeader.footerBlksPerStripe = static_cast<uint16_t>(addrInfo->GetfooterBlksPerStripe());
     ctxStoredVersion = 0;
     ctxDirtyVersion = 0;
     initialized = true;
@@ -134,15 +143,36 @@ AllocatorCtx::GetCurrentSsdLsid(void)
     return currentSsdLsid;
 }
 
+uint32_t
+AllocatorCtx::GetFooterBlksPerStripe(void)
+{
+    return ctxHeader.footerBlksPerStripe;
+}
+
+void
+AllocatorCtx::_DisableFooterOfOldLayout(void)
+{
+    // Written before the footer layout was stored, so the array has no footer.
+    // The next flush stores the layout with the signature
+    if (ctxHeader.footerLayoutSig != AllocatorCtxHeader::SIG_FOOTER_LAYOUT)
+    {
+        POS_TRACE_INFO(EID(ALLOCATOR_INFO), "Allocator context without footer layout, footerBlksPerStripe:0");
+        ctxHeader.footerLayoutSig = AllocatorCtxHeader::SIG_FOOTER_LAYOUT;
+        ctxHeader.footerBlksPerStripe = 0;
+    }
+}
+
 void
 AllocatorCtx::AfterLoad(char* buf)
 {
     POS_TRACE_DEBUG(EID(ALLOCATOR_FILE_ERROR), "AllocatorCtx file loaded:{}", ctxHeader.ctxVersion);
     ctxStoredVersion = ctxHeader.ctxVersion;
     ctxDirtyVersion = ctxHeader.ctxVersion + 1;
+    _DisableFooterOfOldLayout();
 
     AllocatorCtxHeader* header = (AllocatorCtxHeader*)buf;
     allocWbLsidBitmap->SetNumBitsSet(header->numValidWbLsid);
+    _RebuildFreeWbStripeQueue();
 }
 
 void
@@ -248,7 +278,17 @@ AllocatorCtx::AllocWbStripe(StripeId stripeId)
 StripeId
 AllocatorCtx::AllocFreeWbStripe(void)
 {
-    StripeId stripe = allocWbLsidBitmap->SetNextZeroBit();
+    StripeId stripe = UNMAP_STRIPE;
+    while (freeWbLsidQueue.try_pop(stripe) == true)
+    {
+        // Stripes allocated by replay or by the scan below may still be queued
+        if (allocWbLsidBitmap->TrySetBit(stripe) == true)
+        {
+            return stripe;
+        }
+    }
+
+    stripe = allocWbLsidBitmap->SetNextZeroBit();
     if (allocWbLsidBitmap->IsValidBit(stripe) == false)
     {
         stripe = UNMAP_STRIPE;
@@ -260,6 +300,20 @@ void
 AllocatorCtx::ReleaseWbStripe(StripeId stripeId)
 {
     allocWbLsidBitmap->ClearBit(stripeId);
+    freeWbLsidQueue.push(stripeId);
+}
+
+void
+AllocatorCtx::_RebuildFreeWbStripeQueue(void)
+{
+    freeWbLsidQueue.clear();
+    for (StripeId stripeId = 0; stripeId < allocWbLsidBitmap->GetNumBits(); stripeId++)
+    {
+        if (allocWbLsidBitmap->IsSetBit(stripeId) == false)
+        {
+            freeWbLsidQueue.push(stripeId);
+        }
+    }
 }
 
 void
@@ -38,6 +38,7 @@
 #include "src/allocator/context_manager/i_allocator_file_io_client.h"
 #include "src/allocator/include/allocator_const.h"
 #include "src/lib/bitmap.h"
+#include "tbb/concurrent_queue.h"
 
 namespace pos
 {
@@ -69,6 +70,7 @@ public:
     virtual void SetCurrentSsdLsid(StripeId stripe);
     virtual StripeId GetCurrentSsdLsid(void);
     virtual void SetNextSsdLsid(SegmentId segId);
+    virtual uint32_t GetFooterBlksPerStripe(void);
 
     virtual void AllocWbStripe(StripeId stripeId);
     virtual StripeId AllocFreeWbStripe(void);
@@ -93,6 +95,9 @@ private:
     VirtualBlkAddr activeStripeTail[ACTIVE_STRIPE_TAIL_ARRAYLEN];
     std::mutex activeStripeTailLock[ACTIVE_STRIPE_TAIL_ARRAYLEN];
     BitMapMutex* allocWbLsidBitmap = nullptr;
+    // Free wb lsids handed out without scanning the bitmap. The bitmap stays
+    // the source of truth, an entry is only taken if its bit is still clear.
+    tbb::concurrent_queue<StripeId> freeWbLsidQueue;
 
     StripeId currentSsdLsid;
 
@@ -101,6 +106,9 @@ private:
 
     std::mutex allocCtxLock;
     bool initialized;
+
+    void _RebuildFreeWbStripeQueue(void);
+    void _DisableFooterOfOldLayout(void);
 };
 
 } // namespace pos
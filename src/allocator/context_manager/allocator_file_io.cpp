@@ -32,6 +32,8 @@
 
 #include "src/allocator/context_manager/allocator_file_io.h"
 
+#include <algorithm>
+
 #include "src/allocator/address/allocator_address_info.h"
 #include "src/include/pos_event_id.h"
 #include "src/logger/logger.h"
@@ -59,6 +61,7 @@ AllocatorFileIo::AllocatorFileIo(int owner, IAllocatorFileIoClient* client_, All
   fileSize(0),
   numFilesReading(0),
   numFilesFlushing(0),
+  flushedImage(nullptr),
   initialized(false),
   rocksDbEnabled(MetaFsServiceSingleton::Instance()->GetConfigManager()->IsRocksdbEnabled())
 {
@@ -151,6 +154,7 @@ AllocatorFileIo::Dispose(void)
     }
 
     sections.clear();
+    _InvalidateFlushedImage();
 
     initialized = false;
 }
@@ -258,6 +262,7 @@ AllocatorFileIo::_AfterLoad(char* buffer)
 
     _LoadSectionData(buffer);
     client->AfterLoad(buffer);
+    _UpdateFlushedImage(buffer);
 }
 
 int
@@ -273,53 +278,157 @@ AllocatorFileIo::Flush(FnAllocatorCtxIoCompletion clientCallback, int dstSection
             sections[dstSectionId].size);
     }
 
+    std::vector<std::pair<int, int>> ranges = _GetRangesToFlush(buf);
+
+    int numIos = ranges.size();
+    FlushRequest* flush = new FlushRequest(buf, numIos, clientCallback);
     numFilesFlushing++;
-    FnCompleteMetaFileIo callback = std::bind(&AllocatorFileIo::_FlushCompletedThenCB, this, std::placeholders::_1);
-    AsyncMetaFileIoCtx* request = new AllocatorIoCtx(clientCallback);
-    request->SetIoInfo(MetaFsIoOpcode::Write, 0, fileSize, buf);
-    request->SetFileInfo(file->GetFd(), file->GetIoDoneCheckFunc());
-    request->SetCallback(callback);
-
-    int ret = file->AsyncIO(request);
-    if (ret != EID(SUCCESS))
+
+    int ret = EID(SUCCESS);
+    for (int index = 0; index < numIos; index++)
     {
-        numFilesFlushing--;
-        POS_TRACE_ERROR(EID(FAILED_TO_ISSUE_ASYNC_METAIO),
-            "Failed to issue store:{}, fname:{}", ret, client->GetFilename());
-        POS_TRACE_ERROR(EID(FAILED_TO_ISSUE_ASYNC_METAIO), request->ToString());
+        FnCompleteMetaFileIo callback = std::bind(&AllocatorFileIo::_FlushCompletedThenCB, this, std::placeholders::_1, flush);
+        AsyncMetaFileIoCtx* request = new AllocatorIoCtx(clientCallback);
+        request->SetIoInfo(MetaFsIoOpcode::Write, ranges[index].first, ranges[index].second, buf + ranges[index].first);
+        request->SetFileInfo(file->GetFd(), file->GetIoDoneCheckFunc());
+        request->SetCallback(callback);
 
-        delete request;
-        delete[] buf;
+        ret = file->AsyncIO(request);
+        if (ret != EID(SUCCESS))
+        {
+            POS_TRACE_ERROR(EID(FAILED_TO_ISSUE_ASYNC_METAIO),
+                "Failed to issue store:{}, fname:{}", ret, client->GetFilename());
+            POS_TRACE_ERROR(EID(FAILED_TO_ISSUE_ASYNC_METAIO), request->ToString());
+            delete request;
+
+            // The file content is unknown now, write it as a whole next time
+            _InvalidateFlushedImage();
+            flush->issueFailed = true;
+            _CompleteFlushRequest(flush, numIos - index);
+            break;
+        }
     }
     return ret;
 }
 
 void
-AllocatorFileIo::_FlushCompletedThenCB(AsyncMetaFileIoCtx* ctx)
+AllocatorFileIo::_FlushCompletedThenCB(AsyncMetaFileIoCtx* ctx, FlushRequest* flush)
 {
-    char* buffer = ctx->GetBuffer();
+    if (ctx->GetError() != 0)
+    {
+        flush->ioFailed = true;
+    }
+    delete ctx;
 
-    CtxHeader* header = reinterpret_cast<CtxHeader*>(buffer);
-    assert(header->sig == client->GetSignature());
+    _CompleteFlushRequest(flush, 1);
+}
+
+void
+AllocatorFileIo::_CompleteFlushRequest(FlushRequest* flush, int numIos)
+{
+    if (flush->remainingIos.fetch_sub(numIos) - numIos > 0)
+    {
+        return;
+    }
+
+    char* buffer = flush->buffer;
+    if (flush->ioFailed == true)
+    {
+        _InvalidateFlushedImage();
+    }
 
-    _AfterFlush(ctx);
-    POS_TRACE_DEBUG(EID(ALLOCATOR_META_ARCHIVE_STORE_COMPLETED),
-        "sig:{}, version:{}", header->sig, header->ctxVersion);
+    if (flush->issueFailed == true)
+    {
+        numFilesFlushing--;
+    }
+    else
+    {
+        CtxHeader* header = reinterpret_cast<CtxHeader*>(buffer);
+        assert(header->sig == client->GetSignature());
 
-    AllocatorIoCtx* ioContext = reinterpret_cast<AllocatorIoCtx*>(ctx);
-    (ioContext->GetAllocatorClientCallback())();
+        _AfterFlush(buffer);
+        POS_TRACE_DEBUG(EID(ALLOCATOR_META_ARCHIVE_STORE_COMPLETED),
+            "sig:{}, version:{}", header->sig, header->ctxVersion);
+
+        (flush->clientCallback)();
+    }
 
     delete[] buffer;
-    delete ctx;
+    delete flush;
 }
 
 void
-AllocatorFileIo::_AfterFlush(AsyncMetaFileIoCtx* ctx)
+AllocatorFileIo::_AfterFlush(char* buffer)
 {
     int result = numFilesFlushing.fetch_sub(1) - 1;
     assert(result >= 0);
 
-    client->FinalizeIo(ctx->GetBuffer());
+    client->FinalizeIo(buffer);
+}
+
+std::vector<std::pair<int, int>>
+AllocatorFileIo::_GetRangesToFlush(char* buf)
+{
+    std::vector<std::pair<int, int>> ranges;
+    std::lock_guard<std::mutex> lock(flushedImageLock);
+
+    // rocksdb stores each write as its own key, so the file is always written as a whole
+    if ((flushedImage == nullptr) || (rocksDbEnabled == true))
+    {
+        ranges.push_back({0, fileSize});
+    }
+    else
+    {
+        for (int offset = 0; offset < fileSize; offset += FLUSH_UNIT_SIZE)
+        {
+            int size = std::min(static_cast<int>(FLUSH_UNIT_SIZE), fileSize - offset);
+            // The first unit holds the header and its version, it is always written
+            bool isDirty = (offset == 0) || (memcmp(buf + offset, flushedImage + offset, size) != 0);
+            if (isDirty == false)
+            {
+                continue;
+            }
+
+            if ((ranges.size() != 0) && (ranges.back().first + ranges.back().second == offset))
+            {
+                ranges.back().second += size;
+            }
+            else
+            {
+                ranges.push_back({offset, size});
+            }
+        }
+    }
+
+    if (flushedImage == nullptr)
+    {
+        flushedImage = new char[fileSize];
+    }
+    memcpy(flushedImage, buf, fileSize);
+
+    return ranges;
+}
+
+void
+AllocatorFileIo::_UpdateFlushedImage(char* buf)
+{
+    std::lock_guard<std::mutex> lock(flushedImageLock);
+    if (flushedImage == nullptr)
+    {
+        flushedImage = new char[fileSize];
+    }
+    memcpy(flushedImage, buf, fileSize);
+}
+
+void
+AllocatorFileIo::_InvalidateFlushedImage(void)
+{
+    std::lock_guard<std::mutex> lock(flushedImageLock);
+    if (flushedImage != nullptr)
+    {
+        delete[] flushedImage;
+        flushedImage = nullptr;
+    }
 }
 
 void
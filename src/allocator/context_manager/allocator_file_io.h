@@ -32,8 +32,10 @@
 
 #pragma once
 
-#include <vector>
 #include <atomic>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 #include "src/allocator/context_manager/i_allocator_file_io_client.h"
 #include "src/meta_file_intf/meta_file_intf.h"
@@ -80,16 +82,35 @@ private:
         int offset;
     };
 
+    // One checkpoint of the context, written by one or more async ios
+    class FlushRequest
+    {
+    public:
+        FlushRequest(char* bufferIn, int numIos, FnAllocatorCtxIoCompletion callback)
+        : buffer(bufferIn), remainingIos(numIos), ioFailed(false), issueFailed(false), clientCallback(callback)
+        {
+        }
+        char* buffer;
+        std::atomic<int> remainingIos;
+        std::atomic<bool> ioFailed;
+        std::atomic<bool> issueFailed;
+        FnAllocatorCtxIoCompletion clientCallback;
+    };
+
     void _AfterLoad(char* buffer);
-    void _AfterFlush(AsyncMetaFileIoCtx* ctx);
+    void _AfterFlush(char* buffer);
 
     void _UpdateSectionInfo(void);
     void _CreateFile(void);
 
     void _LoadCompletedThenCB(AsyncMetaFileIoCtx* ctx);
-    void _FlushCompletedThenCB(AsyncMetaFileIoCtx* ctx);
+    void _FlushCompletedThenCB(AsyncMetaFileIoCtx* ctx, FlushRequest* flush);
+    void _CompleteFlushRequest(FlushRequest* flush, int numIos);
 
     void _PrepareBuffer(char* buf);
+    std::vector<std::pair<int, int>> _GetRangesToFlush(char* buf);
+    void _UpdateFlushedImage(char* buf);
+    void _InvalidateFlushedImage(void);
 
     void _LoadSectionData(char* buf);
 
@@ -108,10 +129,16 @@ private:
     std::atomic<int> numFilesReading;
     std::atomic<int> numFilesFlushing;
 
+    // Image of the file as written by the last flush. Only the units that
+    // differ from it are written again, nullptr forces a full write.
+    char* flushedImage;
+    std::mutex flushedImageLock;
+
     bool initialized;
     bool rocksDbEnabled;
 
     const int INVALID_SECTION_ID = -1;
+    static const int FLUSH_UNIT_SIZE = 4096;
 };
 
 } // namespace pos
@@ -75,6 +75,8 @@ ContextIoManager::Init(void)
 {
     int ret = 0;
     POS_TRACE_INFO(EID(ALLOCATOR_META_ASYNCLOAD), "start to init and load allocator files");
+    // The files are independent of each other, so all loads and initial
+    // flushes are issued first and then waited for together
     for (int owner = 0; owner < NUM_FILES; owner++)
     {
         fileIo[owner]->Init();
@@ -87,7 +89,6 @@ ContextIoManager::Init(void)
             ret = fileIo[owner]->Flush(completion, dstSectionId);
             if (ret == EID(SUCCESS))
             {
-                WaitPendingIo(IOTYPE_ALL);
                 POS_TRACE_INFO(EID(ALLOCATOR_META_ASYNCLOAD),
                     "initial flush allocator file:{}", owner);
             }
@@ -103,7 +104,6 @@ ContextIoManager::Init(void)
             POS_TRACE_INFO(EID(ALLOCATOR_META_ASYNCLOAD),
                 "succeeded to open alocator file:{}", owner);
             ret = EID(SUCCESS);
-            WaitPendingIo(IOTYPE_READ);
         }
         else
         {
@@ -113,6 +113,9 @@ ContextIoManager::Init(void)
         }
     }
 
+    // Wait also on failure, as the ios already issued use the file ios' buffers
+    WaitPendingIo(IOTYPE_ALL);
+
     return ret;
 }
 
@@ -115,6 +115,21 @@ ContextManager::Init(void)
     segmentCtx->Init();
     rebuildCtx->Init();
     ret = ioManager->Init();
+    if (ret != EID(SUCCESS))
+    {
+        return ret;
+    }
+
+    // The footer blocks are part of the stripe layout, so an array is never
+    // mounted with a layout other than the one it was created with
+    uint32_t storedFooterBlks = allocatorCtx->GetFooterBlksPerStripe();
+    if (storedFooterBlks != addrInfo->GetfooterBlksPerStripe())
+    {
+        POS_TRACE_ERROR(EID(ALLOCATOR_REVMAP_FOOTER_MISMATCH),
+            "arrayId:{}, footerBlksPerStripe:{}, configured:{}",
+            arrayId, storedFooterBlks, addrInfo->GetfooterBlksPerStripe());
+        return EID(ALLOCATOR_REVMAP_FOOTER_MISMATCH);
+    }
 
     return ret;
 }
@@ -253,6 +268,22 @@ ContextManager::GetRebuildTargetSegmentCount(void)
     return segmentCtx->GetRebuildTargetSegmentCount();
 }
 
+uint32_t
+ContextManager::GetRebuildTargetStripeCount(SegmentId segmentId)
+{
+    return segmentCtx->GetNumStripesToRebuild(segmentId);
+}
+
+void
+ContextManager::PrioritizeRebuildTarget(StripeId lsid)
+{
+    if (IsUnMapStripe(lsid))
+    {
+        return;
+    }
+    segmentCtx->PrioritizeRebuildTarget(lsid / addrInfo->GetstripesPerSegment());
+}
+
 void
 ContextManager::PrepareVersionedSegmentCtx(IVersionedSegmentContext* versionedSegCtx_)
 {
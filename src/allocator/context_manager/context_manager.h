@@ -82,6 +82,8 @@ public:
     virtual bool NeedRebuildAgain(void);
     virtual int StopRebuilding(void);
     virtual uint32_t GetRebuildTargetSegmentCount(void);
+    virtual uint32_t GetRebuildTargetStripeCount(SegmentId segmentId);
+    virtual void PrioritizeRebuildTarget(StripeId lsid);
     virtual int MakeRebuildTargetSegmentList(void);
     virtual std::set<SegmentId> GetNvramSegmentList(void);
     virtual int GetGcThreshold(GcMode mode);
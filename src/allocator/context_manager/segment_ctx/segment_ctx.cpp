@@ -32,11 +32,15 @@
 
 #include "src/allocator/context_manager/segment_ctx/segment_ctx.h"
 
+#include <algorithm>
 #include <mutex>
+#include <vector>
 
 #include "src/allocator/address/allocator_address_info.h"
 #include "src/include/meta_const.h"
 #include "src/include/pos_event_id.h"
+#include "src/io/frontend_io/read_cache.h"
+#include "src/io/frontend_io/read_cache_service.h"
 #include "src/logger/logger.h"
 #include "src/telemetry/telemetry_client/telemetry_publisher.h"
 #include "src/qos/qos_manager.h"
@@ -54,6 +58,11 @@ SegmentCtx::SegmentCtx(TelemetryPublisher* tp_, SegmentCtxHeader* header, Segmen
   ctxStoredVersion(0),
   rebuildList(rebuildSegmentList),
   rebuildingSegment(UNMAP_SEGMENT),
+  victimIndex(nullptr),
+  victimPolicy(GcVictimPolicy::GC_VICTIM_GREEDY),
+  freeSegmentPolicy(FreeSegmentPolicy::FREE_SEGMENT_LOWEST_ID),
+  nextFreeSegmentHint(0),
+  trimmer(nullptr),
   initialized(false),
   addrInfo(addrInfo_),
   rebuildCtx(rebuildCtx_),
@@ -91,6 +100,18 @@ SegmentCtx::SegmentCtx(TelemetryPublisher* tp_, RebuildCtx* rebuildCtx_,
 SegmentCtx::~SegmentCtx(void)
 {
     Dispose();
+
+    if (victimIndex != nullptr)
+    {
+        delete victimIndex;
+        victimIndex = nullptr;
+    }
+
+    if (trimmer != nullptr)
+    {
+        delete trimmer;
+        trimmer = nullptr;
+    }
 }
 
 // Only for UT
@@ -106,6 +127,13 @@ SegmentCtx::SetRebuildList(SegmentList* list)
     rebuildList = list;
 }
 
+// Only for UT
+void
+SegmentCtx::SetSegmentTrimmer(SegmentTrimmer* trimmer_)
+{
+    trimmer = trimmer_;
+}
+
 void
 SegmentCtx::Init(void)
 {
@@ -121,6 +149,12 @@ SegmentCtx::Init(void)
     uint32_t numSegments = addrInfo->GetnumUserAreaSegments();
     segmentInfos = new SegmentInfo[numSegments];
 
+    allocatedStripeCount.reset(new std::atomic<uint32_t>[numSegments]);
+    for (uint32_t segId = 0; segId < numSegments; segId++)
+    {
+        allocatedStripeCount[segId] = UNKNOWN_ALLOCATED_STRIPE_COUNT;
+    }
+
     for (int state = SegmentState::START; state < SegmentState::NUM_STATES; state++)
     {
         if (segmentList[state] == nullptr)
@@ -134,6 +168,16 @@ SegmentCtx::Init(void)
         rebuildList = new SegmentList();
     }
 
+    if (victimIndex == nullptr)
+    {
+        victimIndex = new VictimSegmentIndex(numSegments, addrInfo->GetblksPerSegment());
+    }
+
+    if (trimmer == nullptr)
+    {
+        trimmer = SegmentTrimmer::Create(arrayId, addrInfo);
+    }
+
     _RebuildSegmentList();
 
     initialized = true;
@@ -147,11 +191,18 @@ SegmentCtx::Dispose(void)
         return;
     }
 
+    if (trimmer != nullptr)
+    {
+        // Pending segments are freed right away, as the lists are gone after this
+        trimmer->Stop();
+    }
+
     if (segmentInfos != nullptr)
     {
         delete[] segmentInfos;
         segmentInfos = nullptr;
     }
+    allocatedStripeCount.reset();
 
     for (int state = SegmentState::FREE; state < SegmentState::NUM_STATES; state++)
     {
@@ -168,6 +219,12 @@ SegmentCtx::Dispose(void)
         rebuildList = nullptr;
     }
 
+    if (victimIndex != nullptr)
+    {
+        delete victimIndex;
+        victimIndex = nullptr;
+    }
+
     initialized = false;
 }
 
@@ -216,6 +273,11 @@ SegmentCtx::_IncreaseValidBlockCount(SegmentId segId, uint32_t cnt)
             "segment_id:{} increase_count:{} total_valid_block_count:{}", segId, cnt, increasedValue);
         assert(false);
     }
+
+    if (victimIndex != nullptr)
+    {
+        victimIndex->Update(segId, increasedValue);
+    }
 }
 
 bool
@@ -249,6 +311,18 @@ SegmentCtx::_DecreaseValidBlockCount(SegmentId segId, uint32_t cnt, bool allowVi
         _SegmentFreed(segId);
     }
 
+    if (victimIndex != nullptr)
+    {
+        if (segmentFreed == true)
+        {
+            victimIndex->Remove(segId);
+        }
+        else
+        {
+            victimIndex->Update(segId, segmentInfos[segId].GetValidBlockCount());
+        }
+    }
+
     return segmentFreed;
 }
 
@@ -271,6 +345,11 @@ SegmentCtx::_IncreaseOccupiedStripeCount(SegmentId segId)
     uint32_t occupiedStripeCount = segmentInfos[segId].IncreaseOccupiedStripeCount();
     bool segmentFreed = false;
 
+    if (victimIndex != nullptr)
+    {
+        victimIndex->AdvanceEpoch();
+    }
+
     if (occupiedStripeCount == addrInfo->GetstripesPerSegment())
     {
         // Only 1 thread reaches here
@@ -285,6 +364,10 @@ SegmentCtx::_IncreaseOccupiedStripeCount(SegmentId segId)
         else
         {
             segmentList[SegmentState::SSD]->AddToList(segId);
+            if (victimIndex != nullptr)
+            {
+                victimIndex->Add(segId, segmentInfos[segId].GetValidBlockCount());
+            }
         }
     }
 
@@ -315,10 +398,13 @@ SegmentCtx::_RebuildSegmentList(void)
         segmentList[state]->Reset();
     }
 
+    // Gather the members of each list in one scan and hand them over in bulk,
+    // instead of taking the list lock and searching the set per segment
+    std::vector<SegmentId> members[SegmentState::NUM_STATES];
     for (uint32_t segId = 0; segId < addrInfo->GetnumUserAreaSegments(); ++segId)
     {
         SegmentState state = segmentInfos[segId].GetState();
-        segmentList[state]->AddToList(segId);
+        members[state].push_back(segId);
 
         if (state != SegmentState::FREE)
         {
@@ -326,6 +412,32 @@ SegmentCtx::_RebuildSegmentList(void)
                 "array_id: {}, segment_id:{}, state:{}, valid_block_count: {}, occupied_stripe_count: {}", arrayId, segId, state, segmentInfos[segId].GetValidBlockCount(), segmentInfos[segId].GetOccupiedStripeCount());
         }
     }
+
+    for (int state = SegmentState::START; state < SegmentState::NUM_STATES; ++state)
+    {
+        segmentList[state]->AddSegments(members[state]);
+    }
+
+    _RebuildVictimIndex();
+}
+
+void
+SegmentCtx::_RebuildVictimIndex(void)
+{
+    if (victimIndex == nullptr)
+    {
+        return;
+    }
+
+    victimIndex->Reset();
+    for (uint32_t segId = 0; segId < addrInfo->GetnumUserAreaSegments(); ++segId)
+    {
+        uint32_t cnt = segmentInfos[segId].GetValidBlockCountIfSsdState();
+        if (cnt != UINT32_MAX)
+        {
+            victimIndex->Add(segId, cnt);
+        }
+    }
 }
 
 void
@@ -429,9 +541,14 @@ SegmentCtx::AllocateFreeSegment(void)
 {
     while (true)
     {
-        SegmentId segId = segmentList[SegmentState::FREE]->PopSegment();
+        SegmentId segId = _PopFreeSegment();
         if (segId == UNMAP_SEGMENT)
         {
+            if (trimmer != nullptr)
+            {
+                // Do not let the segments wait for a full batch while we run out of them
+                trimmer->Flush();
+            }
             POS_TRACE_DEBUG(EID(ALLOCATOR_ALLOCATE_FAILURE_NO_FREE_SEGMENT),
                 "segment_id:{}, free_segment_count:{}, array_id:{}", segId, GetNumOfFreeSegmentWoLock(), arrayId);
             break;
@@ -440,10 +557,15 @@ SegmentCtx::AllocateFreeSegment(void)
         {
             segmentInfos[segId].MoveToNvramState();
             segmentList[SegmentState::NVRAM]->AddToList(segId);
+            if (allocatedStripeCount != nullptr)
+            {
+                allocatedStripeCount[segId] = 0;
+            }
 
             int numFreeSegment = _OnNumFreeSegmentChanged();
             POS_TRACE_DEBUG(EID(ALLOCATOR_FREE_SEGMENT_ALLOCATION_SUCCESS),
                 "segment_id:{}, free_segment_count:{}, array_id:{}", segId, numFreeSegment, arrayId);
+            _TrimAheadIfNeeded();
 
             return segId;
         }
@@ -452,6 +574,24 @@ SegmentCtx::AllocateFreeSegment(void)
     return UNMAP_SEGMENT;
 }
 
+SegmentId
+SegmentCtx::_PopFreeSegment(void)
+{
+    if (freeSegmentPolicy == FreeSegmentPolicy::FREE_SEGMENT_ROUND_ROBIN)
+    {
+        // Walk the segment space instead of reusing the just freed (and trimmed)
+        // low segments over and over, so that every segment is written as often
+        SegmentId segId = segmentList[SegmentState::FREE]->PopSegmentFrom(nextFreeSegmentHint);
+        if (segId != UNMAP_SEGMENT)
+        {
+            nextFreeSegmentHint = segId + 1;
+        }
+        return segId;
+    }
+
+    return segmentList[SegmentState::FREE]->PopSegment();
+}
+
 uint64_t
 SegmentCtx::GetNumOfFreeSegment(void)
 {
@@ -473,9 +613,17 @@ SegmentCtx::GetAllocatedSegmentCount(void)
 SegmentId
 SegmentCtx::AllocateGCVictimSegment(void)
 {
+    if (victimIndex == nullptr)
+    {
+        // segment infos injected without Init(), e.g. UT
+        victimIndex = new VictimSegmentIndex(addrInfo->GetnumUserAreaSegments(), addrInfo->GetblksPerSegment());
+        _RebuildVictimIndex();
+    }
+
     SegmentId victimSegmentId = UNMAP_SEGMENT;
     while ((victimSegmentId = _FindMostInvalidSSDSegment()) != UNMAP_SEGMENT)
     {
+        victimIndex->Remove(victimSegmentId);
         bool successToSetVictim = _SetVictimSegment(victimSegmentId);
         if (successToSetVictim == true) break;
     }
@@ -483,25 +631,59 @@ SegmentCtx::AllocateGCVictimSegment(void)
     return victimSegmentId;
 }
 
+void
+SegmentCtx::SetGcVictimPolicy(GcVictimPolicy policy)
+{
+    victimPolicy = policy;
+}
+
+void
+SegmentCtx::SetFreeSegmentPolicy(FreeSegmentPolicy policy)
+{
+    freeSegmentPolicy = policy;
+}
+
 SegmentId
-SegmentCtx::_FindMostInvalidSSDSegment(void)
+SegmentCtx::FindUnsealedNvramSegment(SegmentId excludedSegment, SegmentId otherExcludedSegment)
 {
-    uint32_t numUserAreaSegments = addrInfo->GetnumUserAreaSegments();
-    SegmentId victimSegment = UNMAP_SEGMENT;
-    uint32_t minValidCount = addrInfo->GetblksPerSegment();
-    for (SegmentId segId = 0; segId < numUserAreaSegments; ++segId)
+    uint32_t stripesPerSegment = addrInfo->GetstripesPerSegment();
+    for (SegmentId segId = 0; segId < addrInfo->GetnumUserAreaSegments(); ++segId)
     {
-        uint32_t cnt = segmentInfos[segId].GetValidBlockCountIfSsdState();
-        if (cnt < minValidCount)
+        if (segId == excludedSegment || segId == otherExcludedSegment || segId == rebuildingSegment)
         {
-            victimSegment = segId;
-            minValidCount = cnt;
+            continue;
+        }
+        if (segmentInfos[segId].GetState() == SegmentState::NVRAM &&
+            segmentInfos[segId].GetOccupiedStripeCount() < stripesPerSegment)
+        {
+            return segId;
         }
     }
+    return UNMAP_SEGMENT;
+}
+
+uint64_t
+SegmentCtx::GetSegmentAge(SegmentId segId)
+{
+    if (victimIndex == nullptr)
+    {
+        return 0;
+    }
+    uint64_t epoch = victimIndex->GetEpoch();
+    uint64_t lastModified = victimIndex->GetLastModifiedEpoch(segId);
+    return (epoch > lastModified) ? (epoch - lastModified) : 0;
+}
+
+SegmentId
+SegmentCtx::_FindMostInvalidSSDSegment(void)
+{
+    SegmentId victimSegment = victimIndex->Pick(victimPolicy, segmentInfos);
 
     POS_TRACE_DEBUG(EID(ALLOCATE_GC_VICTIM),
-        "victim_segment:{}, min_valid_count:{}",
-        victimSegment, minValidCount);
+        "victim_segment:{}, valid_count:{}, victim_policy:{}",
+        victimSegment,
+        (victimSegment != UNMAP_SEGMENT) ? segmentInfos[victimSegment].GetValidBlockCount() : 0,
+        victimPolicy);
 
     return victimSegment;
 }
@@ -571,6 +753,26 @@ SegmentCtx::_SegmentFreed(SegmentId segmentId)
         return;
     }
 
+    if (trimmer != nullptr && true == trimmer->Enqueue(segmentId))
+    {
+        // The segment joins the free list when its trim completes
+        _TrimAheadIfNeeded();
+        return;
+    }
+
+    _SegmentTrimmed(segmentId);
+}
+
+void
+SegmentCtx::_SegmentTrimmed(SegmentId segmentId)
+{
+    ReadCache* readCache = ReadCacheServiceSingleton::Instance()->GetReadCache(arrayId);
+    if (readCache != nullptr)
+    {
+        // Blocks cached from the segment's previous life must not be hit
+        // once it gets written again
+        readCache->InvalidateSegment(segmentId);
+    }
     segmentList[SegmentState::FREE]->AddToList(segmentId);
 
     int numOfFreeSegments = _OnNumFreeSegmentChanged();
@@ -579,12 +781,35 @@ SegmentCtx::_SegmentFreed(SegmentId segmentId)
         "segment_id:{}, free_segment_count:{}, array_id:{}", segmentId, numOfFreeSegments, arrayId);
 }
 
+void
+SegmentCtx::_TrimAheadIfNeeded(void)
+{
+    // Keep trimmed segments ready before the free list is drained, rather
+    // than letting an allocation wait for a whole batch to be deallocated
+    if (trimmer != nullptr && trimmer->NeedsTrimAhead(GetNumOfFreeSegmentWoLock()))
+    {
+        trimmer->Flush();
+    }
+}
+
+void
+SegmentCtx::StartSegmentTrim(void)
+{
+    // Called after journal replay, which may free a segment and then replay
+    // stripes already written into it again
+    if (trimmer != nullptr)
+    {
+        trimmer->Start([this](SegmentId segId) { _SegmentTrimmed(segId); });
+    }
+}
+
 int
 SegmentCtx::_OnNumFreeSegmentChanged(void)
 {
     int numOfFreeSegments = GetNumOfFreeSegment();
 
     QosManagerSingleton::Instance()->SetGcFreeSegment(numOfFreeSegments, arrayId);
+    QosManagerSingleton::Instance()->SetGcUrgentThreshold(gcCtx->GetUrgentThreshold(), arrayId);
 
     gcCtx->UpdateCurrentGcMode(numOfFreeSegments);
 
@@ -592,6 +817,14 @@ SegmentCtx::_OnNumFreeSegmentChanged(void)
     v.gauge = numOfFreeSegments;
     tp->PublishData(TEL30000_ALCT_FREE_SEG_CNT, v, MT_GAUGE);
 
+    if (trimmer != nullptr)
+    {
+        // Freed segments not in the free list yet, as they wait for trim
+        POSMetricValue pending;
+        pending.gauge = trimmer->GetNumPendingSegments();
+        tp->PublishData(TEL30007_ALCT_TRIM_PENDING_SEG_CNT, pending, MT_GAUGE);
+    }
+
     return numOfFreeSegments;
 }
 
@@ -632,6 +865,55 @@ SegmentCtx::ResetSegmentsStates(void)
     _OnNumFreeSegmentChanged();
 }
 
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Record that a stripe of a segment has been handed out. Stripes
+ *           are handed out of a segment in ascending order.
+ */
+/* --------------------------------------------------------------------------*/
+void
+SegmentCtx::SetStripeAllocated(StripeId lsid)
+{
+    if (allocatedStripeCount == nullptr)
+    {
+        return;
+    }
+
+    uint32_t stripesPerSegment = addrInfo->GetstripesPerSegment();
+    SegmentId segId = lsid / stripesPerSegment;
+    uint32_t count = lsid % stripesPerSegment + 1;
+    std::atomic<uint32_t>& allocated = allocatedStripeCount[segId];
+    uint32_t current = allocated.load();
+    while (current != UNKNOWN_ALLOCATED_STRIPE_COUNT && current < count &&
+        false == allocated.compare_exchange_weak(current, count))
+    {
+    }
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Get the number of leading stripes of a rebuild target segment
+ *           which may hold data. The stripes after them have never been
+ *           handed out, and those handed out later are written with the
+ *           rebuilding device in place, so they need no rebuild.
+ *
+ * @Param    segId: a rebuild target segment
+ * @return   stripesPerSegment if the segment's allocation is not known
+ */
+/* --------------------------------------------------------------------------*/
+uint32_t
+SegmentCtx::GetNumStripesToRebuild(SegmentId segId)
+{
+    uint32_t stripesPerSegment = addrInfo->GetstripesPerSegment();
+    if (allocatedStripeCount == nullptr)
+    {
+        return stripesPerSegment;
+    }
+
+    uint32_t allocated = allocatedStripeCount[segId];
+    return std::min(allocated, stripesPerSegment);
+}
+
 SegmentId
 SegmentCtx::GetRebuildTargetSegment(void)
 {
@@ -639,7 +921,11 @@ SegmentCtx::GetRebuildTargetSegment(void)
 
     while (true)
     {
-        segmentId = rebuildList->PopSegment();
+        segmentId = _PopPrioritizedRebuildTarget();
+        if (segmentId == UNMAP_SEGMENT)
+        {
+            segmentId = rebuildList->PopSegment();
+        }
         if (segmentId == UNMAP_SEGMENT)
         {
             segmentId = UINT32_MAX;
@@ -665,6 +951,51 @@ SegmentCtx::GetRebuildTargetSegment(void)
     return segmentId;
 }
 
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Let a rebuild target segment be rebuilt ahead of the others,
+ *           as reads on it have to recover the data until it is rebuilt
+ */
+/* --------------------------------------------------------------------------*/
+void
+SegmentCtx::PrioritizeRebuildTarget(SegmentId segId)
+{
+    if (rebuildList == nullptr || rebuildList->Contains(segId) == false)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(prioritizedRebuildLock);
+    if (prioritizedRebuildTargets.size() >= MAX_PRIORITIZED_REBUILD_TARGETS)
+    {
+        return;
+    }
+    auto it = std::find(prioritizedRebuildTargets.begin(), prioritizedRebuildTargets.end(), segId);
+    if (it == prioritizedRebuildTargets.end())
+    {
+        prioritizedRebuildTargets.push_back(segId);
+        POS_TRACE_DEBUG(EID(ALLOCATOR_MAKE_REBUILD_TARGET_START),
+            "rebuild target is prioritized, segment_id:{}", segId);
+    }
+}
+
+SegmentId
+SegmentCtx::_PopPrioritizedRebuildTarget(void)
+{
+    std::lock_guard<std::mutex> lock(prioritizedRebuildLock);
+    while (prioritizedRebuildTargets.empty() == false)
+    {
+        SegmentId segId = prioritizedRebuildTargets.front();
+        prioritizedRebuildTargets.pop_front();
+        // It may have been rebuilt or dropped from the list meanwhile
+        if (rebuildList->RemoveFromList(segId) == true)
+        {
+            return segId;
+        }
+    }
+    return UNMAP_SEGMENT;
+}
+
 int
 SegmentCtx::_FlushRebuildSegmentList(void)
 {
@@ -32,6 +32,9 @@
 
 #pragma once
 
+#include <atomic>
+#include <deque>
+#include <memory>
 #include <set>
 #include <string>
 
@@ -41,6 +44,8 @@
 #include "src/allocator/context_manager/gc_ctx/gc_ctx.h"
 #include "src/allocator/context_manager/segment_ctx/segment_info.h"
 #include "src/allocator/context_manager/segment_ctx/segment_list.h"
+#include "src/allocator/context_manager/segment_ctx/segment_trimmer.h"
+#include "src/allocator/context_manager/segment_ctx/victim_segment_index.h"
 #include "src/allocator/i_segment_ctx.h"
 #include "src/allocator/include/allocator_const.h"
 #include "src/include/address_type.h"
@@ -64,6 +69,7 @@ public:
     // Only for UT
     void SetSegmentList(SegmentState state, SegmentList* list);
     void SetRebuildList(SegmentList* list);
+    void SetSegmentTrimmer(SegmentTrimmer* trimmer_);
 
     virtual void Init(void);
     virtual void Dispose(void);
@@ -86,6 +92,8 @@ public:
     virtual SegmentState GetSegmentState(SegmentId segId);
     virtual void ResetSegmentsStates(void);
 
+    virtual void StartSegmentTrim(void);
+
     virtual void AllocateSegment(SegmentId segId);
     virtual SegmentId AllocateFreeSegment(void);
 
@@ -94,6 +102,12 @@ public:
     virtual int GetAllocatedSegmentCount(void);
 
     virtual SegmentId AllocateGCVictimSegment(void);
+    virtual void SetGcVictimPolicy(GcVictimPolicy policy);
+    virtual void SetFreeSegmentPolicy(FreeSegmentPolicy policy);
+    virtual SegmentId FindUnsealedNvramSegment(SegmentId excludedSegment,
+        SegmentId otherExcludedSegment = UNMAP_SEGMENT);
+    // Stripes occupied in the array since the valid count of the segment last changed
+    virtual uint64_t GetSegmentAge(SegmentId segId);
 
     virtual SegmentId GetRebuildTargetSegment(void);
     virtual int SetRebuildCompleted(SegmentId segId);
@@ -103,6 +117,9 @@ public:
     virtual uint32_t GetVictimSegmentCount(void);
     virtual int StopRebuilding(void);
     virtual uint32_t GetRebuildTargetSegmentCount(void);
+    virtual void SetStripeAllocated(StripeId lsid);
+    virtual uint32_t GetNumStripesToRebuild(SegmentId segId);
+    virtual void PrioritizeRebuildTarget(SegmentId segId);
     virtual std::set<SegmentId> GetRebuildSegmentList(void);
     virtual bool LoadRebuildList(void);
 
@@ -127,11 +144,15 @@ private:
     void _GetUsedSegmentList(std::set<SegmentId>& segmentList);
     SegmentId _FindMostInvalidSSDSegment(void);
     void _SegmentFreed(SegmentId segId);
+    void _SegmentTrimmed(SegmentId segId);
+    void _TrimAheadIfNeeded(void);
 
     void _RebuildSegmentList(void);
+    void _RebuildVictimIndex(void);
     void _BuildRebuildSegmentList(void);
     void _ResetSegmentIdInRebuilding(void);
     int _FlushRebuildSegmentList(void);
+    SegmentId _PopPrioritizedRebuildTarget(void);
     bool _SetVictimSegment(SegmentId victimSegment);
     void _BuildRebuildSegmentListFromTheList(SegmentState state);
     void _UpdateTelemetryOnVictimSegmentAllocation(SegmentId victimSegment);
@@ -141,6 +162,7 @@ private:
     bool _IncreaseOccupiedStripeCount(SegmentId segId);
 
     int _OnNumFreeSegmentChanged(void);
+    SegmentId _PopFreeSegment(void);
 
     SegmentCtxHeader ctxHeader;
     std::atomic<uint64_t> ctxDirtyVersion;
@@ -151,6 +173,21 @@ private:
     SegmentList* segmentList[SegmentState::NUM_STATES];
     SegmentList* rebuildList;
     SegmentId rebuildingSegment;
+    // Rebuild targets hit by degraded reads, to be rebuilt first
+    std::deque<SegmentId> prioritizedRebuildTargets;
+    std::mutex prioritizedRebuildLock;
+    static const uint32_t MAX_PRIORITIZED_REBUILD_TARGETS = 64;
+
+    VictimSegmentIndex* victimIndex;
+    GcVictimPolicy victimPolicy;
+    FreeSegmentPolicy freeSegmentPolicy;
+    SegmentId nextFreeSegmentHint;
+    SegmentTrimmer* trimmer;
+
+    // Stripes handed out of each segment since it was allocated, kept in
+    // memory only. Unknown for the segments found at load time.
+    std::unique_ptr<std::atomic<uint32_t>[]> allocatedStripeCount;
+    static const uint32_t UNKNOWN_ALLOCATED_STRIPE_COUNT = UINT32_MAX;
 
     bool initialized;
 
@@ -33,7 +33,9 @@
 #include "segment_info.h"
 
 #include <cassert>
+#include <cstdlib>
 #include <memory.h>
+#include <new>
 
 #include "src/include/pos_event_id.h"
 #include "src/logger/logger.h"
@@ -57,6 +59,35 @@ SegmentInfo::~SegmentInfo(void)
 {
 }
 
+void*
+SegmentInfo::operator new(size_t size)
+{
+    void* ptr = nullptr;
+    if (posix_memalign(&ptr, SEGMENT_INFO_ALIGNMENT, size) != 0)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void*
+SegmentInfo::operator new[](size_t size)
+{
+    return SegmentInfo::operator new(size);
+}
+
+void
+SegmentInfo::operator delete(void* ptr)
+{
+    free(ptr);
+}
+
+void
+SegmentInfo::operator delete[](void* ptr)
+{
+    free(ptr);
+}
+
 uint32_t
 SegmentInfo::GetValidBlockCount(void)
 {
@@ -79,11 +110,23 @@ SegmentInfo::IncreaseValidBlockCount(uint32_t inc)
 std::pair<bool, SegmentState>
 SegmentInfo::DecreaseValidBlockCount(uint32_t dec, bool allowVictimSegRelease)
 {
-    std::lock_guard<std::mutex> lock(seglock);
     int32_t decreased = validBlockCount.fetch_sub(dec) - dec;
+    if (decreased > 0)
+    {
+        // Only the invalidation that empties the segment may change its state,
+        // every other one stays off the segment lock
+        return {false, state.load()};
+    }
 
+    std::lock_guard<std::mutex> lock(seglock);
     if (decreased == 0)
     {
+        if (validBlockCount != 0)
+        {
+            // Refilled before we got the lock, it is not empty anymore
+            return {false, state};
+        }
+
         if (true == allowVictimSegRelease)
         {
             if (state == SegmentState::VICTIM || state == SegmentState::SSD)
@@ -165,7 +208,7 @@ SegmentInfo::MoveToNvramState(void)
     {
         POS_TRACE_ERROR(EID(UNKNOWN_ALLOCATOR_ERROR),
             "Failed to move to NVRAM state. Segment state {} valid count {} occupied stripe count {}",
-            state, validBlockCount, occupiedStripeCount);
+            state.load(), validBlockCount.load(), occupiedStripeCount.load());
         assert(false);
     }
 
@@ -197,7 +240,7 @@ SegmentInfo::MoveToVictimState(void)
     if (state != SegmentState::SSD)
     {
         POS_TRACE_ERROR(EID(UNKNOWN_ALLOCATOR_ERROR),
-            "Cannot move to victim state as it's not SSD state, state: {}", state);
+            "Cannot move to victim state as it's not SSD state, state: {}", state.load());
         return false;
     }
     else
@@ -33,6 +33,7 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
 #include <mutex>
 #include <utility>
 
@@ -51,13 +52,23 @@ enum SegmentState : int
     NUM_STATES,
 };
 
-class SegmentInfo
+const size_t SEGMENT_INFO_ALIGNMENT = 64;
+
+// Each segment info owns a whole cache line, so valid count updates of
+// neighbouring segments from different reactors do not false share.
+class alignas(SEGMENT_INFO_ALIGNMENT) SegmentInfo
 {
 public:
     SegmentInfo(void);
     SegmentInfo(uint32_t blkCount, uint32_t stripeCount, SegmentState segmentState);
     ~SegmentInfo(void);
 
+    // Segment infos are allocated in arrays, keep them cache line aligned
+    static void* operator new(size_t size);
+    static void* operator new[](size_t size);
+    static void operator delete(void* ptr);
+    static void operator delete[](void* ptr);
+
     virtual uint32_t GetValidBlockCount(void);
     virtual void SetValidBlockCount(int cnt);
     virtual uint32_t IncreaseValidBlockCount(uint32_t inc);
@@ -83,7 +94,11 @@ private:
     std::atomic<uint32_t> occupiedStripeCount;
 
     std::mutex seglock;
-    SegmentState state;
+    // Written under seglock, read without it on the invalidation fast path
+    std::atomic<SegmentState> state;
 };
 
+// SegmentInfo arrays are stored as-is in the segment context file
+static_assert(sizeof(SegmentInfo) == SEGMENT_INFO_ALIGNMENT, "SegmentInfo must fill exactly one cache line");
+
 } // namespace pos
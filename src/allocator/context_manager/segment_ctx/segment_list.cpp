@@ -69,6 +69,33 @@ SegmentList::PopSegment(void)
     return ret;
 }
 
+SegmentId
+SegmentList::PopSegmentFrom(SegmentId startSegId)
+{
+    std::lock_guard<std::mutex> lock(m);
+    SegmentId ret;
+
+    if (segments.empty() == true)
+    {
+        ret = UNMAP_SEGMENT;
+    }
+    else
+    {
+        // The first segment at or after startSegId, wrapping around to the lowest one
+        auto it = segments.lower_bound(startSegId);
+        if (it == segments.end())
+        {
+            it = segments.begin();
+        }
+        ret = *it;
+
+        segments.erase(it);
+        numSegments = segments.size();
+    }
+
+    return ret;
+}
+
 void
 SegmentList::AddToList(SegmentId segId)
 {
@@ -77,6 +104,18 @@ SegmentList::AddToList(SegmentId segId)
     numSegments = segments.size();
 }
 
+void
+SegmentList::AddSegments(const std::vector<SegmentId>& segIds)
+{
+    std::lock_guard<std::mutex> lock(m);
+    // With ids in ascending order, inserting at the end hint takes amortized constant time
+    for (SegmentId segId : segIds)
+    {
+        segments.insert(segments.end(), segId);
+    }
+    numSegments = segments.size();
+}
+
 bool
 SegmentList::RemoveFromList(SegmentId segId)
 {
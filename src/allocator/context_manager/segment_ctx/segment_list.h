@@ -34,6 +34,7 @@
 
 #include <mutex>
 #include <set>
+#include <vector>
 
 #include "src/include/address_type.h"
 
@@ -47,7 +48,9 @@ public:
 
     virtual void Reset(void);
     virtual SegmentId PopSegment(void);
+    virtual SegmentId PopSegmentFrom(SegmentId startSegId);
     virtual void AddToList(SegmentId segId);
+    virtual void AddSegments(const std::vector<SegmentId>& segIds);
     virtual bool RemoveFromList(SegmentId segId);
 
     virtual uint32_t GetNumSegments(void);
@@ -0,0 +1,355 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/allocator/context_manager/segment_ctx/segment_trimmer.h"
+
+#include <unistd.h>
+
+#include <list>
+
+#include "src/allocator/address/allocator_address_info.h"
+#include "src/array/service/array_service_layer.h"
+#include "src/device/i_io_dispatcher.h"
+#include "src/include/array_config.h"
+#include "src/include/backend_event.h"
+#include "src/include/i_array_device.h"
+#include "src/include/partition_type.h"
+#include "src/include/pos_event_id.h"
+#include "src/io_scheduler/io_dispatcher.h"
+#include "src/logger/logger.h"
+#include "src/master_context/config_manager.h"
+
+namespace pos
+{
+SegmentTrimCompletion::SegmentTrimCompletion(SegmentTrimmer* trimmer,
+    std::shared_ptr<SegmentTrimRun> trimRun)
+: Callback(false, CallbackType_SegmentTrimCompletion),
+  trimmer(trimmer),
+  trimRun(trimRun)
+{
+}
+
+SegmentTrimCompletion::~SegmentTrimCompletion(void)
+{
+}
+
+bool
+SegmentTrimCompletion::_DoSpecificJob(void)
+{
+    if (_GetErrorCount() > 0)
+    {
+        trimRun->failed = true;
+    }
+
+    if (trimRun->remaining.fetch_sub(1) == 1)
+    {
+        trimmer->CompleteRun(trimRun->run, trimRun->failed);
+    }
+    return true;
+}
+
+SegmentTrimmer::SegmentTrimmer(int arrayId, AllocatorAddressInfo* addrInfo, uint32_t batchSize,
+    IIOTranslator* translator, IIODispatcher* ioDispatcher, uint32_t readyTarget)
+: arrayId(arrayId),
+  addrInfo(addrInfo),
+  batchSize(batchSize),
+  readyTarget(readyTarget),
+  translator(translator),
+  ioDispatcher(ioDispatcher),
+  doneHandler(nullptr),
+  started(false),
+  numRunsInFlight(0)
+{
+}
+
+SegmentTrimmer::~SegmentTrimmer(void)
+{
+    Stop();
+}
+
+void
+SegmentTrimmer::Start(SegmentTrimDoneHandler handler)
+{
+    doneHandler = handler;
+    started = true;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Stop trimming. The segments which have not been submitted yet
+ *           are handed back without deallocation, and the runs in flight
+ *           are waited for, as their completion touches the handler's owner.
+ */
+/* --------------------------------------------------------------------------*/
+void
+SegmentTrimmer::Stop(void)
+{
+    if (false == started.exchange(false))
+    {
+        return;
+    }
+
+    std::set<SegmentId> segments;
+    {
+        std::lock_guard<std::mutex> lock(pendingLock);
+        segments.swap(pendingSegments);
+    }
+    for (SegmentId segId : segments)
+    {
+        doneHandler(segId);
+    }
+
+    while (numRunsInFlight > 0)
+    {
+        usleep(1);
+    }
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Queue a freed segment for deallocation. The batch is submitted
+ *           when it reaches batchSize.
+ *
+ * @Param    segId: a segment which has just become free
+ * @return   false if the trimmer is stopped, then the caller shall free the
+ *           segment by itself
+ */
+/* --------------------------------------------------------------------------*/
+bool
+SegmentTrimmer::Enqueue(SegmentId segId)
+{
+    if (false == started)
+    {
+        return false;
+    }
+
+    bool batchFull = false;
+    {
+        std::lock_guard<std::mutex> lock(pendingLock);
+        pendingSegments.insert(segId);
+        batchFull = (pendingSegments.size() >= batchSize);
+    }
+
+    if (batchFull)
+    {
+        Flush();
+    }
+    return true;
+}
+
+void
+SegmentTrimmer::Flush(void)
+{
+    // Counted as a run in flight until submission ends, so that Stop() waits for it
+    numRunsInFlight++;
+    std::set<SegmentId> segments;
+    {
+        std::lock_guard<std::mutex> lock(pendingLock);
+        segments.swap(pendingSegments);
+    }
+
+    for (SegmentRun run : MergeSegments(segments, _GetMaxRunLength()))
+    {
+        _SubmitRun(run);
+    }
+    numRunsInFlight--;
+}
+
+uint32_t
+SegmentTrimmer::GetNumPendingSegments(void)
+{
+    std::lock_guard<std::mutex> lock(pendingLock);
+    return pendingSegments.size();
+}
+
+uint32_t
+SegmentTrimmer::GetNumRunsInFlight(void)
+{
+    return numRunsInFlight;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Tell whether pending segments shall be trimmed now instead of
+ *           waiting for a full batch
+ *
+ * @Param    numReadySegments: the number of trimmed segments in the free list
+ * @return   true if the ready segments are below readyTarget and some
+ *           segments are waiting for trim
+ */
+/* --------------------------------------------------------------------------*/
+bool
+SegmentTrimmer::NeedsTrimAhead(uint32_t numReadySegments)
+{
+    if (false == started || numReadySegments >= readyTarget)
+    {
+        return false;
+    }
+    return (GetNumPendingSegments() > 0);
+}
+
+void
+SegmentTrimmer::CompleteRun(SegmentRun run, bool failed)
+{
+    if (failed)
+    {
+        POS_TRACE_WARN(EID(ALLOCATOR_SEGMENT_TRIM_FAILED),
+            "array_id:{}, start_segment_id:{}, segment_count:{}",
+            arrayId, run.first, run.second);
+    }
+
+    for (uint32_t index = 0; index < run.second; index++)
+    {
+        doneHandler(run.first + index);
+    }
+    numRunsInFlight--;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Merge segments into runs of consecutive segment ids, since a run
+ *           takes a single contiguous lba range on every device
+ *
+ * @Param    segments: segment ids in ascending order
+ * @Param    maxRunLength: the longest run which one deallocate can cover
+ * @return   runs in ascending order of their first segment
+ */
+/* --------------------------------------------------------------------------*/
+std::vector<SegmentRun>
+SegmentTrimmer::MergeSegments(const std::set<SegmentId>& segments, uint32_t maxRunLength)
+{
+    std::vector<SegmentRun> runs;
+    for (SegmentId segId : segments)
+    {
+        if (runs.empty() == false &&
+            runs.back().first + runs.back().second == segId &&
+            runs.back().second < maxRunLength)
+        {
+            runs.back().second++;
+        }
+        else
+        {
+            runs.push_back(SegmentRun(segId, 1));
+        }
+    }
+    return runs;
+}
+
+void
+SegmentTrimmer::_SubmitRun(SegmentRun run)
+{
+    numRunsInFlight++;
+
+    std::list<PhysicalEntry> ranges;
+    StripeId startStripe = run.first * addrInfo->GetstripesPerSegment();
+    uint32_t stripeCnt = run.second * addrInfo->GetstripesPerSegment();
+    int ret = translator->GetPhysicalRanges(arrayId, PartitionType::USER_DATA,
+        ranges, startStripe, stripeCnt);
+
+    std::list<PhysicalEntry> targets;
+    if (ret == 0)
+    {
+        for (PhysicalEntry& range : ranges)
+        {
+            if (range.addr.arrayDev->GetState() != ArrayDeviceState::FAULT)
+            {
+                targets.push_back(range);
+            }
+        }
+    }
+
+    if (targets.empty())
+    {
+        CompleteRun(run, (ret != 0));
+        return;
+    }
+
+    std::shared_ptr<SegmentTrimRun> trimRun = std::make_shared<SegmentTrimRun>();
+    trimRun->run = run;
+    trimRun->remaining = targets.size();
+    trimRun->failed = false;
+
+    for (PhysicalEntry& target : targets)
+    {
+        UbioSmartPtr ubio(new Ubio(dummyBuffer,
+            target.blkCnt * Ubio::UNITS_PER_BLOCK, arrayId));
+        ubio->dir = UbioDir::Deallocate;
+        ubio->SetPba(target.addr);
+        ubio->SetUblock(target.addr.arrayDev->GetUblock());
+        ubio->SetEventType(BackendEvent_GC);
+        CallbackSmartPtr callback(new SegmentTrimCompletion(this, trimRun));
+        ubio->SetCallback(callback);
+        ioDispatcher->Submit(ubio);
+    }
+}
+
+uint32_t
+SegmentTrimmer::_GetMaxRunLength(void)
+{
+    // Ubio keeps its size in bytes within 32 bits, so one deallocate covers up to 4GB of a device
+    uint64_t blksPerChunk = addrInfo->GetblksPerStripe() / addrInfo->GetchunksPerStripe();
+    uint64_t bytesPerSegment = blksPerChunk * addrInfo->GetstripesPerSegment() * BLOCK_SIZE;
+    uint64_t maxRunLength = UINT32_MAX / bytesPerSegment;
+    return (maxRunLength == 0) ? 1 : maxRunLength;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Create the trimmer from performance.segment_trim_batch_size
+ *           and performance.segment_trim_ready_target
+ *
+ * @return   nullptr if segment trim is disabled (batch size is 0 or not configured)
+ */
+/* --------------------------------------------------------------------------*/
+SegmentTrimmer*
+SegmentTrimmer::Create(int arrayId, AllocatorAddressInfo* addrInfo)
+{
+    uint32_t batchSize = 0;
+    int ret = ConfigManagerSingleton::Instance()->GetValue("performance",
+        "segment_trim_batch_size", &batchSize, CONFIG_TYPE_UINT32);
+    if (ret != EID(SUCCESS) || 0 == batchSize)
+    {
+        return nullptr;
+    }
+
+    uint32_t readyTarget = 0;
+    ConfigManagerSingleton::Instance()->GetValue("performance",
+        "segment_trim_ready_target", &readyTarget, CONFIG_TYPE_UINT32);
+
+    POS_TRACE_INFO(EID(ALLOCATOR_SEGMENT_TRIM_ENABLED),
+        "Segment trim is enabled, array_id:{}, batch_size:{}, ready_target:{}",
+        arrayId, batchSize, readyTarget);
+    return new SegmentTrimmer(arrayId, addrInfo, batchSize,
+        ArrayService::Instance()->Getter()->GetTranslator(), IODispatcherSingleton::Instance(),
+        readyTarget);
+}
+} // namespace pos
@@ -0,0 +1,127 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "src/bio/ubio.h"
+#include "src/event_scheduler/callback.h"
+#include "src/include/address_type.h"
+
+namespace pos
+{
+class AllocatorAddressInfo;
+class IIODispatcher;
+class IIOTranslator;
+class SegmentTrimmer;
+
+// A run of consecutive segments: first segment id and number of segments
+using SegmentRun = std::pair<SegmentId, uint32_t>;
+using SegmentTrimDoneHandler = std::function<void(SegmentId)>;
+
+struct SegmentTrimRun
+{
+    SegmentRun run;
+    std::atomic<uint32_t> remaining;
+    std::atomic<bool> failed;
+};
+
+class SegmentTrimCompletion : public Callback
+{
+public:
+    SegmentTrimCompletion(SegmentTrimmer* trimmer, std::shared_ptr<SegmentTrimRun> trimRun);
+    ~SegmentTrimCompletion(void) override;
+
+private:
+    bool _DoSpecificJob(void) override;
+
+    SegmentTrimmer* trimmer;
+    std::shared_ptr<SegmentTrimRun> trimRun;
+};
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Gather freed segments and deallocate them on the ssds in batches.
+ *           A segment goes back to the free list only after its deallocation
+ *           has completed, so that a reused segment is never trimmed.
+ *           When readyTarget is set, a partial batch is submitted ahead of
+ *           demand while the free list holds fewer segments than that.
+ */
+/* --------------------------------------------------------------------------*/
+class SegmentTrimmer
+{
+public:
+    SegmentTrimmer(int arrayId, AllocatorAddressInfo* addrInfo, uint32_t batchSize,
+        IIOTranslator* translator, IIODispatcher* ioDispatcher, uint32_t readyTarget = 0);
+    virtual ~SegmentTrimmer(void);
+
+    virtual void Start(SegmentTrimDoneHandler handler);
+    virtual void Stop(void);
+    virtual bool Enqueue(SegmentId segId);
+    virtual void Flush(void);
+    virtual uint32_t GetNumPendingSegments(void);
+    virtual uint32_t GetNumRunsInFlight(void);
+    virtual bool NeedsTrimAhead(uint32_t numReadySegments);
+    void CompleteRun(SegmentRun run, bool failed);
+
+    static std::vector<SegmentRun> MergeSegments(const std::set<SegmentId>& segments,
+        uint32_t maxRunLength);
+    static SegmentTrimmer* Create(int arrayId, AllocatorAddressInfo* addrInfo);
+
+private:
+    void _SubmitRun(SegmentRun run);
+    uint32_t _GetMaxRunLength(void);
+
+    int arrayId;
+    AllocatorAddressInfo* addrInfo;
+    uint32_t batchSize;
+    uint32_t readyTarget;
+    IIOTranslator* translator;
+    IIODispatcher* ioDispatcher;
+    SegmentTrimDoneHandler doneHandler;
+
+    std::mutex pendingLock;
+    std::set<SegmentId> pendingSegments;
+    std::atomic<bool> started;
+    std::atomic<uint32_t> numRunsInFlight;
+    // Deallocate carries no data, but ubio needs a buffer to be built
+    uint8_t dummyBuffer[Ubio::BYTES_PER_UNIT];
+};
+} // namespace pos
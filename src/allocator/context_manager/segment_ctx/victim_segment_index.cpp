@@ -0,0 +1,364 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/allocator/context_manager/segment_ctx/victim_segment_index.h"
+
+#include "src/allocator/context_manager/segment_ctx/segment_info.h"
+
+namespace pos
+{
+VictimSegmentIndex::VictimSegmentIndex(uint32_t numSegments_, uint32_t blksPerSegment_)
+: numSegments(numSegments_),
+  blksPerSegment(blksPerSegment_),
+  epoch(0),
+  numIndexed(0)
+{
+    bucketWidth = (blksPerSegment + NUM_BUCKETS) / NUM_BUCKETS;
+    bucketOf = new std::atomic<uint32_t>[numSegments];
+    next = new SegmentId[numSegments];
+    prev = new SegmentId[numSegments];
+    lastModifiedEpoch = new std::atomic<uint64_t>[numSegments];
+    for (SegmentId segId = 0; segId < numSegments; segId++)
+    {
+        bucketOf[segId] = NOT_INDEXED;
+        next[segId] = UNMAP_SEGMENT;
+        prev[segId] = UNMAP_SEGMENT;
+        lastModifiedEpoch[segId] = 0;
+    }
+    for (uint32_t bucket = 0; bucket < NUM_BUCKETS; bucket++)
+    {
+        head[bucket] = UNMAP_SEGMENT;
+    }
+    for (uint32_t word = 0; word < NUM_BITMAP_WORDS; word++)
+    {
+        nonEmpty[word] = 0;
+    }
+}
+
+VictimSegmentIndex::~VictimSegmentIndex(void)
+{
+    delete[] bucketOf;
+    delete[] next;
+    delete[] prev;
+    delete[] lastModifiedEpoch;
+}
+
+void
+VictimSegmentIndex::Add(SegmentId segId, uint32_t validCount)
+{
+    if (segId >= numSegments)
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(indexLock);
+    if (bucketOf[segId] != NOT_INDEXED)
+    {
+        _Unlink(segId);
+    }
+    _Link(segId, _GetBucket(validCount));
+    lastModifiedEpoch[segId].store(epoch.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+void
+VictimSegmentIndex::Update(SegmentId segId, uint32_t validCount)
+{
+    if (segId >= numSegments)
+    {
+        return;
+    }
+    lastModifiedEpoch[segId].store(epoch.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+    uint32_t bucket = _GetBucket(validCount);
+    uint32_t current = bucketOf[segId].load(std::memory_order_relaxed);
+    if (current == NOT_INDEXED || current == bucket)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(indexLock);
+    if (bucketOf[segId] != NOT_INDEXED && bucketOf[segId] != bucket)
+    {
+        _Unlink(segId);
+        _Link(segId, bucket);
+    }
+}
+
+void
+VictimSegmentIndex::Remove(SegmentId segId)
+{
+    if (segId >= numSegments || bucketOf[segId].load(std::memory_order_relaxed) == NOT_INDEXED)
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(indexLock);
+    if (bucketOf[segId] != NOT_INDEXED)
+    {
+        _Unlink(segId);
+    }
+}
+
+void
+VictimSegmentIndex::Reset(void)
+{
+    std::lock_guard<std::mutex> lock(indexLock);
+    for (SegmentId segId = 0; segId < numSegments; segId++)
+    {
+        bucketOf[segId] = NOT_INDEXED;
+        next[segId] = UNMAP_SEGMENT;
+        prev[segId] = UNMAP_SEGMENT;
+    }
+    for (uint32_t bucket = 0; bucket < NUM_BUCKETS; bucket++)
+    {
+        head[bucket] = UNMAP_SEGMENT;
+    }
+    for (uint32_t word = 0; word < NUM_BITMAP_WORDS; word++)
+    {
+        nonEmpty[word] = 0;
+    }
+    numIndexed = 0;
+}
+
+SegmentId
+VictimSegmentIndex::Pick(GcVictimPolicy policy, SegmentInfo* segmentInfos)
+{
+    std::lock_guard<std::mutex> lock(indexLock);
+    if (policy == GcVictimPolicy::GC_VICTIM_COST_BENEFIT)
+    {
+        return _PickCostBenefit(segmentInfos);
+    }
+    return _PickGreedy(segmentInfos);
+}
+
+uint32_t
+VictimSegmentIndex::GetNumIndexedSegments(void)
+{
+    std::lock_guard<std::mutex> lock(indexLock);
+    return numIndexed;
+}
+
+void
+VictimSegmentIndex::AdvanceEpoch(void)
+{
+    epoch.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t
+VictimSegmentIndex::GetEpoch(void)
+{
+    return epoch.load(std::memory_order_relaxed);
+}
+
+uint64_t
+VictimSegmentIndex::GetLastModifiedEpoch(SegmentId segId)
+{
+    if (segId >= numSegments)
+    {
+        return 0;
+    }
+    return lastModifiedEpoch[segId].load(std::memory_order_relaxed);
+}
+
+uint32_t
+VictimSegmentIndex::_GetBucket(uint32_t validCount)
+{
+    uint32_t bucket = validCount / bucketWidth;
+    return (bucket < NUM_BUCKETS) ? bucket : (NUM_BUCKETS - 1);
+}
+
+void
+VictimSegmentIndex::_Link(SegmentId segId, uint32_t bucket)
+{
+    // This method should be executed with indexLock acquired
+    next[segId] = head[bucket];
+    prev[segId] = UNMAP_SEGMENT;
+    if (head[bucket] != UNMAP_SEGMENT)
+    {
+        prev[head[bucket]] = segId;
+    }
+    head[bucket] = segId;
+    bucketOf[segId] = bucket;
+    nonEmpty[bucket / BITS_PER_WORD] |= (1ULL << (bucket % BITS_PER_WORD));
+    numIndexed++;
+}
+
+void
+VictimSegmentIndex::_Unlink(SegmentId segId)
+{
+    // This method should be executed with indexLock acquired
+    uint32_t bucket = bucketOf[segId];
+    if (prev[segId] != UNMAP_SEGMENT)
+    {
+        next[prev[segId]] = next[segId];
+    }
+    else
+    {
+        head[bucket] = next[segId];
+    }
+    if (next[segId] != UNMAP_SEGMENT)
+    {
+        prev[next[segId]] = prev[segId];
+    }
+    if (head[bucket] == UNMAP_SEGMENT)
+    {
+        nonEmpty[bucket / BITS_PER_WORD] &= ~(1ULL << (bucket % BITS_PER_WORD));
+    }
+    next[segId] = UNMAP_SEGMENT;
+    prev[segId] = UNMAP_SEGMENT;
+    bucketOf[segId] = NOT_INDEXED;
+    numIndexed--;
+}
+
+int
+VictimSegmentIndex::_FindLowestBucket(uint32_t fromBucket)
+{
+    for (uint32_t word = fromBucket / BITS_PER_WORD; word < NUM_BITMAP_WORDS; word++)
+    {
+        uint64_t bits = nonEmpty[word];
+        if (word == fromBucket / BITS_PER_WORD)
+        {
+            bits &= (~0ULL << (fromBucket % BITS_PER_WORD));
+        }
+        if (bits != 0)
+        {
+            return word * BITS_PER_WORD + __builtin_ctzll(bits);
+        }
+    }
+    return -1;
+}
+
+bool
+VictimSegmentIndex::_Validate(SegmentId segId, SegmentInfo* segmentInfos, uint32_t& validCount)
+{
+    // Drop segments which left SSD state, re-bucket the ones whose count moved
+    validCount = segmentInfos[segId].GetValidBlockCountIfSsdState();
+    if (validCount == UINT32_MAX)
+    {
+        _Unlink(segId);
+        return false;
+    }
+    uint32_t bucket = _GetBucket(validCount);
+    if (bucket != bucketOf[segId])
+    {
+        _Unlink(segId);
+        _Link(segId, bucket);
+        return false;
+    }
+    return true;
+}
+
+SegmentId
+VictimSegmentIndex::_PickGreedy(SegmentInfo* segmentInfos)
+{
+    bool movedToLowerBucket = true;
+    while (movedToLowerBucket == true)
+    {
+        movedToLowerBucket = false;
+        int bucket = _FindLowestBucket(0);
+        while (bucket >= 0)
+        {
+            SegmentId victim = UNMAP_SEGMENT;
+            uint32_t minValidCount = blksPerSegment;
+            SegmentId segId = head[bucket];
+            while (segId != UNMAP_SEGMENT)
+            {
+                SegmentId nextSegId = next[segId];
+                uint32_t validCount = 0;
+                if (_Validate(segId, segmentInfos, validCount) == true)
+                {
+                    if (validCount < minValidCount)
+                    {
+                        victim = segId;
+                        minValidCount = validCount;
+                    }
+                }
+                else if (bucketOf[segId] < static_cast<uint32_t>(bucket))
+                {
+                    movedToLowerBucket = true;
+                }
+                segId = nextSegId;
+            }
+            if (movedToLowerBucket == true)
+            {
+                break;
+            }
+            if (victim != UNMAP_SEGMENT)
+            {
+                return victim;
+            }
+            bucket = _FindLowestBucket(bucket + 1);
+        }
+    }
+    return UNMAP_SEGMENT;
+}
+
+SegmentId
+VictimSegmentIndex::_PickCostBenefit(SegmentInfo* segmentInfos)
+{
+    // benefit / cost = (1 - u) * age / 2u, evaluated over the least utilized candidates
+    // age is the write epochs elapsed since the segment was last sealed or invalidated,
+    // so segments still being overwritten (hot) are left to invalidate themselves
+    SegmentId victim = UNMAP_SEGMENT;
+    double bestScore = -1.0;
+    uint32_t evaluated = 0;
+    uint64_t now = epoch.load(std::memory_order_relaxed);
+    int bucket = _FindLowestBucket(0);
+    while (bucket >= 0 && evaluated < COST_BENEFIT_CANDIDATES)
+    {
+        SegmentId segId = head[bucket];
+        while (segId != UNMAP_SEGMENT && evaluated < COST_BENEFIT_CANDIDATES)
+        {
+            SegmentId nextSegId = next[segId];
+            uint32_t validCount = 0;
+            if (_Validate(segId, segmentInfos, validCount) == true && validCount < blksPerSegment)
+            {
+                if (validCount == 0)
+                {
+                    return segId;
+                }
+                evaluated++;
+                uint64_t modified = lastModifiedEpoch[segId].load(std::memory_order_relaxed);
+                double age = static_cast<double>((now > modified) ? (now - modified) : 0) + 1.0;
+                double score = age * (blksPerSegment - validCount) / (2.0 * validCount);
+                if (score > bestScore)
+                {
+                    bestScore = score;
+                    victim = segId;
+                }
+            }
+            segId = nextSegId;
+        }
+        bucket = _FindLowestBucket(bucket + 1);
+    }
+    return victim;
+}
+
+} // namespace pos
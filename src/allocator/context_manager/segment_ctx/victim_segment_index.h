@@ -0,0 +1,100 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+#include "src/allocator/include/allocator_const.h"
+#include "src/include/address_type.h"
+
+namespace pos
+{
+class SegmentInfo;
+
+// Index of SSD segments bucketed by valid block count.
+// Buckets only move when a count crosses a bucket boundary, so the
+// per-invalidation cost is a single load in the common case.
+// Entries are validated against SegmentInfo when picked and stale ones
+// are dropped or re-bucketed lazily.
+// The epoch is a write clock advanced per occupied stripe; each segment
+// remembers the epoch of its last seal or invalidation.
+class VictimSegmentIndex
+{
+public:
+    VictimSegmentIndex(uint32_t numSegments, uint32_t blksPerSegment);
+    virtual ~VictimSegmentIndex(void);
+
+    virtual void Add(SegmentId segId, uint32_t validCount);
+    virtual void Update(SegmentId segId, uint32_t validCount);
+    virtual void Remove(SegmentId segId);
+    virtual void Reset(void);
+    virtual SegmentId Pick(GcVictimPolicy policy, SegmentInfo* segmentInfos);
+    virtual uint32_t GetNumIndexedSegments(void);
+    virtual void AdvanceEpoch(void);
+    virtual uint64_t GetEpoch(void);
+    virtual uint64_t GetLastModifiedEpoch(SegmentId segId);
+
+    static const uint32_t NUM_BUCKETS = 256;
+    static const uint32_t COST_BENEFIT_CANDIDATES = 64;
+
+private:
+    static const uint32_t NOT_INDEXED = UINT32_MAX;
+    static const uint32_t BITS_PER_WORD = 64;
+    static const uint32_t NUM_BITMAP_WORDS = NUM_BUCKETS / BITS_PER_WORD;
+
+    uint32_t _GetBucket(uint32_t validCount);
+    void _Link(SegmentId segId, uint32_t bucket);
+    void _Unlink(SegmentId segId);
+    int _FindLowestBucket(uint32_t fromBucket);
+    bool _Validate(SegmentId segId, SegmentInfo* segmentInfos, uint32_t& validCount);
+    SegmentId _PickGreedy(SegmentInfo* segmentInfos);
+    SegmentId _PickCostBenefit(SegmentInfo* segmentInfos);
+
+    const uint32_t numSegments;
+    const uint32_t blksPerSegment;
+    uint32_t bucketWidth;
+
+    std::atomic<uint32_t>* bucketOf;
+    SegmentId* next;
+    SegmentId* prev;
+    std::atomic<uint64_t>* lastModifiedEpoch;
+    SegmentId head[NUM_BUCKETS];
+    uint64_t nonEmpty[NUM_BITMAP_WORDS];
+    std::atomic<uint64_t> epoch;
+    uint32_t numIndexed;
+
+    std::mutex indexLock;
+};
+
+} // namespace pos
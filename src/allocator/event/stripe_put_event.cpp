@@ -53,6 +53,7 @@ StripePutEvent::StripePutEvent(StripeSmartPtr stripe, StripeId prevLsid, int arr
 {
     iWBStripeAllocator = AllocatorServiceSingleton::Instance()->GetIWBStripeAllocator(arrayId);
     SetEventType(BackendEvent_Flush);
+    SetArrayId(arrayId);
 }
 
 bool
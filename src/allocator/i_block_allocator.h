@@ -34,6 +34,7 @@
 
 #include <utility>
 
+#include "src/allocator/include/allocator_const.h"
 #include "src/include/address_type.h"
 #include "src/include/smart_ptr_type.h"
 
@@ -42,8 +43,9 @@ namespace pos
 class IBlockAllocator
 {
 public:
-    virtual std::pair<VirtualBlks, StripeId> AllocateWriteBufferBlks(uint32_t volumeId, uint32_t numBlks) = 0;
+    virtual std::pair<VirtualBlks, StripeId> AllocateWriteBufferBlks(uint32_t volumeId, uint32_t numBlks, uint32_t originCore, WriteStreamType stream) = 0;
     virtual StripeSmartPtr AllocateGcDestStripe(uint32_t volumeId) = 0;
+    virtual StripeSmartPtr AllocateGcColdDestStripe(uint32_t volumeId) = 0;
 
     virtual void ProhibitUserBlkAlloc(void) = 0;
     virtual void PermitUserBlkAlloc(void) = 0;
@@ -55,6 +55,8 @@ public:
     virtual int StopRebuilding(void) = 0;
     virtual bool NeedRebuildAgain(void) = 0;
     virtual uint32_t GetRebuildTargetSegmentCount(void) = 0;
+    virtual uint32_t GetRebuildTargetStripeCount(SegmentId segmentId) = 0;
+    virtual void PrioritizeRebuildTarget(StripeId lsid) = 0;
     virtual int GetGcThreshold(GcMode mode) = 0;
 
     virtual SegmentCtx* GetSegmentCtx(void) = 0;
@@ -46,6 +46,8 @@ public:
 
     virtual StripeSmartPtr GetStripe(StripeId wbLsid) = 0;
 
+    virtual bool IsWbStripeQuotaExceeded(uint32_t volumeId) = 0;
+
     virtual bool ReferLsidCnt(StripeAddr& lsa) = 0;
     virtual void DereferLsidCnt(StripeAddr& lsa, uint32_t blockCount) = 0;
 
@@ -32,6 +32,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <set>
 #include <string>
@@ -44,7 +45,65 @@ namespace pos
 using ASTailArrayIdx = uint32_t;
 using RTSegmentIter = std::set<SegmentId>::iterator;
 
-const int ACTIVE_STRIPE_TAIL_ARRAYLEN = MAX_VOLUME_COUNT;
+// Each volume owns several active stripes so that reactors writing to the same
+// volume do not serialize on one tail. Tail k of a volume lives at
+// (volumeId + k * MAX_VOLUME_COUNT) and is picked by the io's origin core.
+// The tails are split into one group per NUMA node, so reactors of different
+// sockets never fill the same stripe. When the host writes are classified, the
+// last tail of a group takes the sequential writes and the others the random
+// ones, so that the two do not share stripes and segments.
+const int ACTIVE_STRIPE_TAIL_COUNT_PER_VOLUME = 4;
+const int ACTIVE_STRIPE_TAIL_ARRAYLEN = MAX_VOLUME_COUNT * ACTIVE_STRIPE_TAIL_COUNT_PER_VOLUME;
+
+enum WriteStreamType
+{
+    WRITE_STREAM_MIXED,
+    WRITE_STREAM_RANDOM,
+    WRITE_STREAM_SEQUENTIAL
+};
+
+inline uint32_t
+GetActiveStripeTailGroupCount(uint32_t numaCount)
+{
+    return std::min<uint32_t>(std::max<uint32_t>(numaCount, 1), ACTIVE_STRIPE_TAIL_COUNT_PER_VOLUME);
+}
+
+inline ASTailArrayIdx
+GetActiveStripeTailIndex(uint32_t volumeId, uint32_t core, uint32_t numa = 0, uint32_t numaCount = 1,
+    WriteStreamType stream = WRITE_STREAM_MIXED)
+{
+    uint32_t groupCount = GetActiveStripeTailGroupCount(numaCount);
+    uint32_t tailsPerGroup = ACTIVE_STRIPE_TAIL_COUNT_PER_VOLUME / groupCount;
+    uint32_t tail = (numa % groupCount) * tailsPerGroup;
+    if (WRITE_STREAM_MIXED == stream || tailsPerGroup < 2)
+    {
+        tail += core % tailsPerGroup;
+    }
+    else if (WRITE_STREAM_SEQUENTIAL == stream)
+    {
+        tail += tailsPerGroup - 1;
+    }
+    else
+    {
+        tail += core % (tailsPerGroup - 1);
+    }
+    return volumeId + tail * MAX_VOLUME_COUNT;
+}
+
+inline uint32_t
+GetNumaOfActiveStripeTail(ASTailArrayIdx asTailArrayIdx, uint32_t numaCount)
+{
+    uint32_t groupCount = GetActiveStripeTailGroupCount(numaCount);
+    uint32_t tailsPerGroup = ACTIVE_STRIPE_TAIL_COUNT_PER_VOLUME / groupCount;
+    uint32_t tail = asTailArrayIdx / MAX_VOLUME_COUNT;
+    return std::min(tail / tailsPerGroup, groupCount - 1);
+}
+
+inline uint32_t
+GetVolumeIdOfActiveStripeTail(ASTailArrayIdx asTailArrayIdx)
+{
+    return asTailArrayIdx % MAX_VOLUME_COUNT;
+}
 
 enum FileOwner
 {
@@ -102,6 +161,13 @@ class AllocatorCtxHeader : public CtxHeader
 {
 public:
     uint32_t numValidWbLsid;
+    // Reverse map footer blocks of each stripe, fixed when the array is created.
+    // They fill what used to be tail padding, so a context written before them
+    // holds arbitrary bytes here; the count is valid only next to the signature
+    uint16_t footerLayoutSig;
+    uint16_t footerBlksPerStripe;
+
+    static const uint16_t SIG_FOOTER_LAYOUT = 0xF0F0;
 };
 
 class SegmentCtxHeader : public CtxHeader
@@ -123,4 +189,16 @@ enum GcMode
     MODE_URGENT_GC,
 };
 
+enum GcVictimPolicy
+{
+    GC_VICTIM_GREEDY = 0,
+    GC_VICTIM_COST_BENEFIT,
+};
+
+enum FreeSegmentPolicy
+{
+    FREE_SEGMENT_LOWEST_ID = 0,
+    FREE_SEGMENT_ROUND_ROBIN,
+};
+
 } // namespace pos
@@ -32,6 +32,8 @@
 
 #include "src/allocator/stripe_manager/stripe.h"
 
+#include <sched.h>
+
 #include <string>
 
 #include "src/array_mgmt/array_manager.h"
@@ -53,10 +55,10 @@ Stripe::Stripe(IReverseMap* revMapMan, uint32_t numBlksPerStripe)
   revMapPack(nullptr),
   finished(true),
   remaining(0),
-  referenceCount(0),
   totalBlksPerUserStripe(numBlksPerStripe), // for UT
   iReverseMap(revMapMan),
-  activeFlush(false)
+  activeFlush(false),
+  directWritten(false)
 {
     flushIo = nullptr;
 }
@@ -104,36 +106,66 @@ Stripe::Assign(StripeId vsid_, StripeId wbLsid_, StripeId userLsid_, uint32_t vo
     remaining.store(totalBlksPerUserStripe, memory_order_release);
     finished = false;
     activeFlush = false;
+    directWritten = false;
+    numa = INVALID_NUMA;
 
     // wbLsid of GC stripe would be UNMAP_STRIPE
     revMapPack = iReverseMap->AllocReverseMapPack(vsid, wbLsid);
 }
 
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Tell whether no reader refers the stripe anymore
+ *           It is asked only after the stripe map points to the user area,
+ *           so that no reference is added while the shards are summed up and
+ *           a sum of 0 cannot miss a reference
+ */
+/* --------------------------------------------------------------------------*/
 bool
 Stripe::IsOkToFree(void)
 {
-    bool isOkToFree = (0 == referenceCount);
-    return isOkToFree;
+    int64_t count = GetReferenceCount();
+    if (unlikely(count < 0))
+    {
+        POS_EVENT_ID eventId =
+            EID(ALLOCATOR_WRONG_STRIPE_REFERENCE_COUNT);
+        POS_TRACE_ERROR((int)eventId, "Wrong stripe reference count:{}", count);
+        return true;
+    }
+    return (0 == count);
 }
 
-void
-Stripe::Derefer(uint32_t blockCount)
+int64_t
+Stripe::GetReferenceCount(void)
 {
-    if (unlikely(blockCount > referenceCount))
+    int64_t count = 0;
+    for (uint32_t shard = 0; shard < NUM_REFERENCE_SHARDS; shard++)
     {
-        POS_EVENT_ID eventId =
-            EID(ALLOCATOR_WRONG_STRIPE_REFERENCE_COUNT);
-        POS_TRACE_ERROR((int)eventId, "Wrong stripe reference count");
-        referenceCount = 0;
-        return;
+        count += referenceCount[shard].count.load(std::memory_order_acquire);
     }
-    referenceCount -= blockCount;
+    return count;
+}
+
+void
+Stripe::Derefer(uint32_t blockCount)
+{
+    // The read may complete on a core other than the one it referred on,
+    // so a shard alone can go negative. Only the sum is meaningful.
+    _GetReferenceShard().count.fetch_sub(blockCount, std::memory_order_release);
 }
 
 void
 Stripe::Refer(void)
 {
-    referenceCount++;
+    _GetReferenceShard().count.fetch_add(1, std::memory_order_relaxed);
+}
+
+StripeReferenceShard&
+Stripe::_GetReferenceShard(void)
+{
+    int cpu = sched_getcpu();
+    uint32_t shard = (cpu < 0) ? 0 : (static_cast<uint32_t>(cpu) % NUM_REFERENCE_SHARDS);
+    return referenceCount[shard];
 }
 
 StripeId
@@ -179,6 +211,13 @@ Stripe::UpdateReverseMapEntry(uint32_t offset, BlkAddr rba, uint32_t volumeId)
     revMapPack->SetReverseMapEntry(offset, rba, volumeId);
 }
 
+void
+Stripe::UpdateReverseMapChecksum(uint32_t offset, uint32_t checksum)
+{
+    assert(revMapPack != nullptr);
+    revMapPack->SetReverseMapChecksum(offset, checksum);
+}
+
 std::tuple<BlkAddr, uint32_t>
 Stripe::GetReverseMapEntry(uint32_t offset)
 {
@@ -255,4 +294,28 @@ Stripe::SetActiveFlushTarget(void)
     activeFlush = true;
 }
 
+bool
+Stripe::IsDirectWritten(void)
+{
+    return directWritten;
+}
+
+void
+Stripe::SetDirectWritten(void)
+{
+    directWritten = true;
+}
+
+void
+Stripe::SetNumaId(uint32_t numaId)
+{
+    numa = numaId;
+}
+
+uint32_t
+Stripe::GetNumaId(void)
+{
+    return numa;
+}
+
 } // namespace pos
@@ -40,12 +40,24 @@
 
 #include "src/allocator/address/allocator_address_info.h"
 #include "src/bio/flush_io.h"
+#include "src/include/core_const.h"
 
 namespace pos
 {
 class IReverseMap;
 class ReverseMapPack;
 
+// Readers referring a write buffer stripe count on the shard of their core,
+// so that the reads hitting one stripe from many reactors do not bounce a
+// single cache line. A shard takes a whole cache line for itself.
+const size_t STRIPE_REFERENCE_SHARD_SIZE = 64;
+
+struct StripeReferenceShard
+{
+    std::atomic<int64_t> count{0};
+    char padding[STRIPE_REFERENCE_SHARD_SIZE - sizeof(std::atomic<int64_t>)];
+};
+
 class Stripe
 {
 public:
@@ -63,6 +75,7 @@ public:
     ReverseMapPack* GetRevMapPack(void);
     virtual void UpdateReverseMapEntry(uint32_t offset, BlkAddr rba, uint32_t volumeId);
     virtual std::tuple<BlkAddr, uint32_t> GetReverseMapEntry(uint32_t offset);
+    virtual void UpdateReverseMapChecksum(uint32_t offset, uint32_t checksum);
     virtual int Flush(EventSmartPtr callback);
 
     virtual void UpdateVictimVsa(uint32_t offset, VirtualBlkAddr vsa);
@@ -77,12 +90,20 @@ public:
     virtual void Refer(void);
     virtual void Derefer(uint32_t blockCount);
     virtual bool IsOkToFree(void);
+    int64_t GetReferenceCount(void);
 
     virtual void UpdateFlushIo(FlushIoSmartPtr flushIo);
 
     virtual bool IsActiveFlushTarget(void);
     virtual void SetActiveFlushTarget(void);
 
+    virtual bool IsDirectWritten(void);
+    virtual void SetDirectWritten(void);
+
+    // NUMA node of the reactors filling the stripe, where it is flushed from
+    void SetNumaId(uint32_t numaId);
+    uint32_t GetNumaId(void);
+
 protected: // for UT
     uint32_t volumeId;
     StripeId vsid; // SSD LSID, Actually User Area LSID
@@ -92,7 +113,8 @@ protected: // for UT
 
     std::atomic<bool> finished;
     std::atomic<uint32_t> remaining; // #empty block(s) left, on this stripe
-    std::atomic<uint32_t> referenceCount;
+    static const uint32_t NUM_REFERENCE_SHARDS = 8;
+    StripeReferenceShard referenceCount[NUM_REFERENCE_SHARDS];
     std::vector<VirtualBlkAddr> oldVsaList;
     uint32_t totalBlksPerUserStripe;
 
@@ -100,6 +122,11 @@ protected: // for UT
     std::mutex flushIoUpdate;
     IReverseMap* iReverseMap;
     std::atomic<bool> activeFlush;
+    std::atomic<bool> directWritten;
+    uint32_t numa = INVALID_NUMA;
+
+private:
+    StripeReferenceShard& _GetReferenceShard(void);
 };
 
 } // namespace pos
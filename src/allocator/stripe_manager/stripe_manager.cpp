@@ -34,8 +34,10 @@
 
 #include "src/allocator/address/allocator_address_info.h"
 #include "src/allocator/context_manager/context_manager.h"
+#include "src/allocator/context_manager/segment_ctx/segment_ctx.h"
 #include "src/allocator/i_wbstripe_allocator.h"
 #include "src/allocator/stripe_manager/stripe.h"
+#include "src/cpu_affinity/affinity_manager.h"
 #include "src/include/branch_prediction.h"
 #include "src/include/pos_event_id.h"
 #include "src/logger/logger.h"
@@ -57,7 +59,10 @@ StripeManager::StripeManager(ContextManager* ctxMgr, IReverseMap* iReverseMap_,
   addrInfo(addrInfo_),
   arrayId(arrayId_),
   reverseMap(iReverseMap_),
-  stripeMap(stripeMap_)
+  stripeMap(stripeMap_),
+  hotColdSeparation(false),
+  currentGcSsdLsid(UNMAP_STRIPE),
+  currentColdSsdLsid(UNMAP_STRIPE)
 {
 }
 
@@ -90,7 +95,8 @@ StripeManager::AllocateGcDestStripe(uint32_t volumeId)
         return nullptr;
     }
 
-    StripeId arrayLsid = _AllocateSsdStripe();
+    StripeId arrayLsid = (hotColdSeparation == true) ?
+        _AllocateGcSsdStripe(currentGcSsdLsid, currentColdSsdLsid) : _AllocateSsdStripe();
     if (IsUnMapStripe(arrayLsid))
     {
         POS_TRACE_ERROR(EID(ALLOCATOR_CANNOT_ALLOCATE_STRIPE), "failed to allocate gc stripe!");
@@ -103,6 +109,26 @@ StripeManager::AllocateGcDestStripe(uint32_t volumeId)
     return stripe;
 }
 
+StripeSmartPtr
+StripeManager::AllocateGcColdDestStripe(uint32_t volumeId)
+{
+    if (allocStatus->IsBlockAllocationProhibited(volumeId))
+    {
+        return nullptr;
+    }
+
+    StripeId arrayLsid = _AllocateGcSsdStripe(currentColdSsdLsid, currentGcSsdLsid);
+    if (IsUnMapStripe(arrayLsid))
+    {
+        POS_TRACE_ERROR(EID(ALLOCATOR_CANNOT_ALLOCATE_STRIPE), "failed to allocate gc cold stripe!");
+        return nullptr;
+    }
+
+    StripeSmartPtr stripe = _AllocateStripe(arrayLsid, UNMAP_STRIPE, volumeId);
+
+    return stripe;
+}
+
 StripeId
 StripeManager::_AllocateSsdStripe(void)
 {
@@ -114,6 +140,81 @@ StripeManager::_AllocateSsdStripe(void)
         ssdLsid = _AllocateSegmentAndStripe();
     }
     allocCtx->SetCurrentSsdLsid(ssdLsid);
+    _RecordStripeAllocated(ssdLsid);
+    return ssdLsid;
+}
+
+void
+StripeManager::SetHotColdSeparation(bool enable)
+{
+    std::lock_guard<std::mutex> lock(allocCtx->GetCtxLock());
+    hotColdSeparation = enable;
+}
+
+StripeId
+StripeManager::_AllocateGcSsdStripe(StripeId& currentLsid, StripeId otherGcLsid)
+{
+    std::lock_guard<std::mutex> lock(allocCtx->GetCtxLock());
+    StripeId ssdLsid = UNMAP_STRIPE;
+
+    if (currentLsid == UNMAP_STRIPE)
+    {
+        ssdLsid = _FindGcSsdStripeToResume(otherGcLsid);
+    }
+    else if (false == _IsLastStripesWithinSegment(currentLsid + 1))
+    {
+        ssdLsid = currentLsid + 1;
+    }
+
+    if (ssdLsid == UNMAP_STRIPE)
+    {
+        ssdLsid = _AllocateSegmentAndStripe();
+    }
+    currentLsid = ssdLsid;
+    _RecordStripeAllocated(ssdLsid);
+    return ssdLsid;
+}
+
+void
+StripeManager::_RecordStripeAllocated(StripeId ssdLsid)
+{
+    if (IsUnMapStripe(ssdLsid))
+    {
+        return;
+    }
+
+    SegmentCtx* segmentCtx = contextManager->GetSegmentCtx();
+    if (segmentCtx != nullptr)
+    {
+        segmentCtx->SetStripeAllocated(ssdLsid);
+    }
+}
+
+StripeId
+StripeManager::_FindGcSsdStripeToResume(StripeId otherGcLsid)
+{
+    // The gc open segments are not persisted. After reload, continue on an unsealed
+    // nvram segment which is neither the host's nor the other gc stream's open
+    // segment, so it can still be sealed
+    SegmentCtx* segmentCtx = contextManager->GetSegmentCtx();
+    if (segmentCtx == nullptr)
+    {
+        return UNMAP_STRIPE;
+    }
+
+    uint32_t stripesPerSegment = addrInfo->GetstripesPerSegment();
+    StripeId hostLsid = allocCtx->GetCurrentSsdLsid();
+    SegmentId hostSegment = IsUnMapStripe(hostLsid) ? UNMAP_SEGMENT : hostLsid / stripesPerSegment;
+    SegmentId otherGcSegment = IsUnMapStripe(otherGcLsid) ? UNMAP_SEGMENT : otherGcLsid / stripesPerSegment;
+    SegmentId segId = segmentCtx->FindUnsealedNvramSegment(hostSegment, otherGcSegment);
+    if (segId == UNMAP_SEGMENT)
+    {
+        return UNMAP_STRIPE;
+    }
+
+    StripeId ssdLsid = segId * stripesPerSegment + segmentCtx->GetOccupiedStripeCount(segId);
+    POS_TRACE_INFO(EID(ALLOCATOR_INFO), "gc destination resumes from segment_id:{}, lsid:{}, array_id:{}",
+        segId, ssdLsid, arrayId);
     return ssdLsid;
 }
 
@@ -134,7 +235,8 @@ StripeManager::_AllocateSegmentAndStripe(void)
 StripeSmartPtr
 StripeManager::_AllocateStripe(StripeId vsid, StripeId wbLsid, uint32_t volumeId)
 {
-    StripeSmartPtr stripe = StripeSmartPtr(new Stripe(reverseMap, addrInfo->GetblksPerStripe()));
+    StripeSmartPtr stripe = StripeSmartPtr(new Stripe(reverseMap,
+        addrInfo->GetblksPerStripe() - addrInfo->GetfooterBlksPerStripe()));
     StripeId userLsid = VsidToUserLsid(vsid);
     stripe->Assign(vsid, wbLsid, userLsid, volumeId);
 
@@ -159,12 +261,21 @@ StripeManager::_AllocateUserSsdStripe(int volumeId)
         }
     }
     allocCtx->SetCurrentSsdLsid(ssdLsid);
+    _RecordStripeAllocated(ssdLsid);
     return ssdLsid;
 }
 
 std::pair<StripeId, StripeId>
-StripeManager::AllocateStripesForUser(uint32_t volumeId)
+StripeManager::AllocateStripesForUser(ASTailArrayIdx asTailArrayIdx)
 {
+    uint32_t volumeId = GetVolumeIdOfActiveStripeTail(asTailArrayIdx);
+    if (wbStripeManager->IsWbStripeQuotaExceeded(volumeId))
+    {
+        // Let the volume wait for its own stripes to be flushed, rather than
+        // taking the last free ones from the other volumes
+        return {UNMAP_STRIPE, UNMAP_STRIPE};
+    }
+
     StripeId wbLsid = _AllocateWbStripe();
     if (unlikely(wbLsid == UNMAP_STRIPE))
     {
@@ -182,16 +293,17 @@ StripeManager::AllocateStripesForUser(uint32_t volumeId)
 
     StripeId newVsid = userLsid;
     StripeSmartPtr stripe = _AllocateStripe(newVsid, wbLsid, volumeId);
+    stripe->SetNumaId(GetNumaOfActiveStripeTail(asTailArrayIdx,
+        AffinityManagerSingleton::Instance()->GetNumaCount()));
     wbStripeManager->AssignStripe(stripe);
 
     stripeMap->SetLSA(newVsid, wbLsid, IN_WRITE_BUFFER_AREA);
 
-    // Temporally no lock required, as AllocateBlks and this function cannot be executed in parallel
-    // TODO(jk.man.kim): add or move lock to wbuf tail manager
+    // No lock required here, the caller already holds the lock of this active stripe tail
     VirtualBlkAddr curVsa = {
         .stripeId = newVsid,
         .offset = 0};
-    allocCtx->SetActiveStripeTail(volumeId, curVsa);
+    allocCtx->SetActiveStripeTail(asTailArrayIdx, curVsa);
 
     return {wbLsid, userLsid};
 }
@@ -30,6 +30,7 @@
  *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include "src/allocator/include/allocator_const.h"
 #include "src/mapper/i_reversemap.h"
 #include "src/mapper/i_stripemap.h"
 #include "src/include/smart_ptr_type.h"
@@ -52,14 +53,19 @@ public:
 
     virtual void Init(IWBStripeAllocator* wbStripeManager);
 
-    virtual std::pair<StripeId, StripeId> AllocateStripesForUser(uint32_t volumeId);
+    virtual std::pair<StripeId, StripeId> AllocateStripesForUser(ASTailArrayIdx asTailArrayIdx);
     virtual StripeSmartPtr AllocateGcDestStripe(uint32_t volumeId);
+    virtual StripeSmartPtr AllocateGcColdDestStripe(uint32_t volumeId);
+    virtual void SetHotColdSeparation(bool enable);
 
 protected:
     bool _IsLastStripesWithinSegment(StripeId stripeId);
 
 private:
     StripeId _AllocateSsdStripe(void);
+    StripeId _AllocateGcSsdStripe(StripeId& currentLsid, StripeId otherGcLsid);
+    StripeId _FindGcSsdStripeToResume(StripeId otherGcLsid);
+    void _RecordStripeAllocated(StripeId ssdLsid);
     StripeId _AllocateSegmentAndStripe(void);
     StripeId _AllocateWbStripe(void);
     void _RollBackWbStripeIdAllocation(StripeId wbLsid = UINT32_MAX);
@@ -76,6 +82,14 @@ private:
 
     IReverseMap* reverseMap;
     IStripeMap* stripeMap;
+
+    // GC destination stripes come from their own open segment when enabled,
+    // so copied (cold) data is not mixed with host (hot) writes
+    bool hotColdSeparation;
+    StripeId currentGcSsdLsid;
+    // Data GC classifies as cold always goes to its own open segment, apart
+    // from both host writes and the other GC copies
+    StripeId currentColdSsdLsid;
 };
 
 } // namespace pos
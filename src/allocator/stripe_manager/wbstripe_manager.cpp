@@ -32,6 +32,7 @@
 
 #include "src/allocator/stripe_manager/wbstripe_manager.h"
 
+#include <algorithm>
 #include <vector>
 
 #include "src/allocator/context_manager/allocator_ctx/allocator_ctx.h"
@@ -47,6 +48,7 @@
 #include "src/io/backend_io/flush_submission.h"
 #include "src/logger/logger.h"
 #include "src/mapper_service/mapper_service.h"
+#include "src/master_context/config_manager.h"
 #include "src/qos/qos_manager.h"
 #include "src/resource_manager/buffer_pool.h"
 
@@ -70,6 +72,10 @@ WBStripeManager::WBStripeManager(TelemetryPublisher* tp_, int numVolumes_, IReve
     numVolumes = numVolumes_;
     iReverseMap = iReverseMap_;
     eventScheduler = eventSchedulerArg;
+    for (uint32_t volumeId = 0; volumeId < MAX_VOLUME_COUNT; volumeId++)
+    {
+        wbStripeCountPerVolume[volumeId] = 0;
+    }
 }
 
 WBStripeManager::WBStripeManager(TelemetryPublisher* tp_, AllocatorAddressInfo* info, AllocatorCtx* allocCtx_, std::string arrayName, int arrayId)
@@ -116,6 +122,56 @@ WBStripeManager::Init(void)
     }
 
     wbStripeArray.resize(totalNvmStripes, nullptr);
+    _SetWbStripeQuota(totalNvmStripes);
+}
+
+void
+WBStripeManager::_SetWbStripeQuota(uint32_t totalNvmStripes)
+{
+    uint32_t quotaPercent = 0;
+    int ret = ConfigManagerSingleton::Instance()->GetValue("performance",
+        "write_buffer_volume_quota_percent", &quotaPercent, CONFIG_TYPE_UINT32);
+    if (ret != EID(SUCCESS) || quotaPercent == 0 || quotaPercent >= 100)
+    {
+        wbStripeQuotaPerVolume = 0;
+        return;
+    }
+
+    wbStripeQuotaPerVolume = std::max(1U, totalNvmStripes * quotaPercent / 100);
+    POS_TRACE_INFO(EID(ALLOCATOR_INFO),
+        "write buffer stripe quota per volume:{}, total:{}, array_id:{}",
+        wbStripeQuotaPerVolume, totalNvmStripes, arrayId);
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Tell whether a volume shall not take another write buffer stripe
+ *           A volume over its quota may still borrow idle stripes, as long as
+ *           a quota's worth of stripes stays free for the other volumes
+ */
+/* --------------------------------------------------------------------------*/
+bool
+WBStripeManager::IsWbStripeQuotaExceeded(uint32_t volumeId)
+{
+    if (wbStripeQuotaPerVolume == 0 || volumeId >= MAX_VOLUME_COUNT)
+    {
+        return false;
+    }
+    if (wbStripeCountPerVolume[volumeId] < wbStripeQuotaPerVolume)
+    {
+        return false;
+    }
+
+    uint64_t allocated = allocCtx->GetAllocatedWbStripeCount();
+    uint64_t total = allocCtx->GetNumTotalWbStripe();
+    uint64_t numFree = (total > allocated) ? (total - allocated) : 0;
+    return numFree < wbStripeQuotaPerVolume;
+}
+
+uint32_t
+WBStripeManager::GetWbStripeCount(uint32_t volumeId)
+{
+    return (volumeId < MAX_VOLUME_COUNT) ? wbStripeCountPerVolume[volumeId].load() : 0;
 }
 
 void
@@ -146,6 +202,16 @@ WBStripeManager::_GetStripe(StripeAddr& lsa)
     return wbStripeArray[lsa.stripeId];
 }
 
+Stripe*
+WBStripeManager::_GetStripeWoCopy(StripeAddr& lsa)
+{
+    if (iStripeMap->IsInUserDataArea(lsa))
+    {
+        return nullptr;
+    }
+    return wbStripeArray[lsa.stripeId].get();
+}
+
 void
 WBStripeManager::FreeWBStripeId(StripeId wblsid)
 {
@@ -154,6 +220,11 @@ WBStripeManager::FreeWBStripeId(StripeId wblsid)
     QosManagerSingleton::Instance()->DecreaseUsedStripeCnt(arrayName);
 
     assert(wbStripeArray[wblsid] != nullptr);
+    uint32_t volumeId = wbStripeArray[wblsid]->GetVolumeId();
+    if (volumeId < MAX_VOLUME_COUNT)
+    {
+        wbStripeCountPerVolume[volumeId]--;
+    }
     wbStripeArray[wblsid] = nullptr;
 }
 
@@ -163,13 +234,16 @@ WBStripeManager::FlushAllPendingStripesInVolume(int volumeId, FlushIoSmartPtr fl
     // TODO (meta) remove volume manager check and remove updating flushIo
     if (volumeManager->GetVolumeMountStatus(volumeId) == Mounted)
     {
-        StripeSmartPtr activeStripe = _FinishActiveStripe(volumeId);
-        if (activeStripe != nullptr)
+        for (int index = volumeId; index < ACTIVE_STRIPE_TAIL_ARRAYLEN; index += MAX_VOLUME_COUNT)
         {
-            POS_TRACE_INFO(EID(PICKUP_ACTIVE_STRIPE),
-                "Picked Active Stripe: volumeId:{}  wbLsid:{}  vsid:{}  remaining:{}",
-                volumeId, activeStripe->GetWbLsid(), activeStripe->GetVsid(),
-                activeStripe->GetBlksRemaining());
+            StripeSmartPtr activeStripe = _FinishActiveStripe(index);
+            if (activeStripe != nullptr)
+            {
+                POS_TRACE_INFO(EID(PICKUP_ACTIVE_STRIPE),
+                    "Picked Active Stripe: volumeId:{}  index:{}  wbLsid:{}  vsid:{}  remaining:{}",
+                    volumeId, index, activeStripe->GetWbLsid(), activeStripe->GetVsid(),
+                    activeStripe->GetBlksRemaining());
+            }
         }
 
         for (auto it = wbStripeArray.begin(); it != wbStripeArray.end(); ++it)
@@ -190,10 +264,14 @@ WBStripeManager::FlushAllPendingStripesInVolume(int volumeId, FlushIoSmartPtr fl
     return 0;
 }
 
+// The stripe is borrowed without copying its smart pointer: a referring
+// reader holds the stripe map, which still points to the write buffer,
+// and a dereferring one holds a reference itself, so the stripe is not
+// released underneath either of them
 bool
 WBStripeManager::ReferLsidCnt(StripeAddr& lsa)
 {
-    StripeSmartPtr stripe = _GetStripe(lsa);
+    Stripe* stripe = _GetStripeWoCopy(lsa);
     if (nullptr == stripe)
     {
         return false;
@@ -206,7 +284,7 @@ WBStripeManager::ReferLsidCnt(StripeAddr& lsa)
 void
 WBStripeManager::DereferLsidCnt(StripeAddr& lsa, uint32_t blockCount)
 {
-    StripeSmartPtr stripe = _GetStripe(lsa);
+    Stripe* stripe = _GetStripeWoCopy(lsa);
     if (nullptr == stripe)
     {
         return;
@@ -220,7 +298,7 @@ WBStripeManager::FlushAllWbStripes(void)
     // Complete active stripes and trigger flush
     for (uint32_t volumeId = 0; volumeId < numVolumes; ++volumeId)
     {
-        _FinishActiveStripe(volumeId);
+        _FinishActiveStripesOfVolume(volumeId);
     }
 
     // Wait for all write buffer stripes to be flushed
@@ -238,7 +316,7 @@ WBStripeManager::FlushAllWbStripes(void)
 int
 WBStripeManager::FlushAllPendingStripesInVolume(int volumeId)
 {
-    _FinishActiveStripe(volumeId);
+    _FinishActiveStripesOfVolume(volumeId);
 
     // Wait for all write buffer stripes with volume id to be flushed
     for (auto it = wbStripeArray.begin(); it != wbStripeArray.end(); ++it)
@@ -286,7 +364,8 @@ WBStripeManager::_WaitForStripeFlushComplete(StripeSmartPtr stripe)
 int
 WBStripeManager::ReconstructActiveStripe(uint32_t volumeId, StripeId wbLsid, VirtualBlkAddr tailVsa, std::map<uint64_t, BlkAddr> revMapInfos)
 {
-    StripeSmartPtr stripe = StripeSmartPtr(new Stripe(iReverseMap, addrInfo->GetblksPerStripe()));
+    StripeSmartPtr stripe = StripeSmartPtr(new Stripe(iReverseMap,
+        addrInfo->GetblksPerStripe() - addrInfo->GetfooterBlksPerStripe()));
     StripeId vsid = tailVsa.stripeId;
     StripeId userLsid = VsidToUserLsid(vsid);
     stripe->Assign(vsid, wbLsid, userLsid, volumeId);
@@ -349,6 +428,12 @@ WBStripeManager::AssignStripe(StripeSmartPtr stripe)
     StripeId wbLsid = stripe->GetWbLsid();
     assert(wbStripeArray[wbLsid] == nullptr);
     wbStripeArray[wbLsid] = stripe;
+
+    uint32_t volumeId = stripe->GetVolumeId();
+    if (volumeId < MAX_VOLUME_COUNT)
+    {
+        wbStripeCountPerVolume[volumeId]++;
+    }
 }
 
 StripeSmartPtr
@@ -405,6 +490,15 @@ WBStripeManager::_ReconstructAS(StripeSmartPtr stripe, uint64_t blockCount)
     return EID(SUCCESS);
 }
 
+void
+WBStripeManager::_FinishActiveStripesOfVolume(uint32_t volumeId)
+{
+    for (ASTailArrayIdx index = volumeId; index < ACTIVE_STRIPE_TAIL_ARRAYLEN; index += MAX_VOLUME_COUNT)
+    {
+        _FinishActiveStripe(index);
+    }
+}
+
 StripeSmartPtr
 WBStripeManager::_FinishActiveStripe(ASTailArrayIdx index)
 {
@@ -457,23 +551,24 @@ VirtualBlks
 WBStripeManager::_GetRemainingBlocks(VirtualBlkAddr tail)
 {
     VirtualBlks remainingBlks;
+    uint32_t dataBlksPerStripe = addrInfo->GetblksPerStripe() - addrInfo->GetfooterBlksPerStripe();
 
     if (UNMAP_OFFSET == tail.offset)
     {
         remainingBlks.startVsa = UNMAP_VSA;
         remainingBlks.numBlks = 0;
     }
-    else if (tail.offset > addrInfo->GetblksPerStripe())
+    else if (tail.offset > dataBlksPerStripe)
     {
         POS_TRACE_ERROR(EID(WRONG_BLOCK_COUNT),
-            "offsetInTail:{} > blksPerStirpe:{}", tail.offset, addrInfo->GetblksPerStripe());
+            "offsetInTail:{} > blksPerStirpe:{}", tail.offset, dataBlksPerStripe);
 
         remainingBlks.startVsa = UNMAP_VSA;
         remainingBlks.numBlks = 0;
     }
     else
     {
-        remainingBlks.numBlks = addrInfo->GetblksPerStripe() - tail.offset;
+        remainingBlks.numBlks = dataBlksPerStripe - tail.offset;
         if (remainingBlks.numBlks == 0)
         {
             remainingBlks.startVsa = UNMAP_VSA;
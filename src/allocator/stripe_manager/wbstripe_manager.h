@@ -32,6 +32,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <map>
 #include <set>
 #include <string>
@@ -70,6 +71,8 @@ public:
     virtual void AssignStripe(StripeSmartPtr stripe) override;
     virtual StripeSmartPtr GetStripe(StripeId wbLsid) override;
     virtual void FreeWBStripeId(StripeId lsid) override;
+    virtual bool IsWbStripeQuotaExceeded(uint32_t volumeId) override;
+    virtual uint32_t GetWbStripeCount(uint32_t volumeId);
 
     virtual bool ReferLsidCnt(StripeAddr& lsa) override;
     virtual void DereferLsidCnt(StripeAddr& lsa, uint32_t blockCount) override;
@@ -86,7 +89,9 @@ public:
 
 protected:
     StripeSmartPtr _GetStripe(StripeAddr& lsidEntry);
+    Stripe* _GetStripeWoCopy(StripeAddr& lsidEntry);
 
+    void _FinishActiveStripesOfVolume(uint32_t volumeId);
     StripeSmartPtr _FinishActiveStripe(ASTailArrayIdx index);
     bool _FillBlocksToStripe(StripeSmartPtr stripe, StripeId wbLsid, BlkOffset startOffset, uint32_t numBlks);
     VirtualBlks _AllocateRemainingBlocks(ASTailArrayIdx index);
@@ -96,6 +101,7 @@ protected:
     int _ReconstructAS(StripeSmartPtr stripe, uint64_t blockCount);
     void _WaitForStripeFlushComplete(StripeSmartPtr stripe);
     void _LoadStripe(StripeAddr from, StripeAddr to);
+    void _SetWbStripeQuota(uint32_t totalNvmStripes);
 
     std::vector<StripeSmartPtr> wbStripeArray;
     BufferPool* stripeBufferPool;
@@ -113,6 +119,11 @@ protected:
     MemoryManager* memoryManager;
     StripeLoadStatus* stripeLoadStatus;
     EventScheduler* eventScheduler;
+
+    // Write buffer stripes held by each volume, and how many a volume may
+    // hold while the free ones are scarce (0: no quota)
+    std::atomic<uint32_t> wbStripeCountPerVolume[MAX_VOLUME_COUNT];
+    uint32_t wbStripeQuotaPerVolume = 0;
 };
 
 } // namespace pos
@@ -91,6 +91,12 @@ ArrayDeviceManager::ImportByName(DeviceSet<string> nameSet)
             POS_TRACE_WARN(eventId, "devName: {}", devName);
             return eventId;
         }
+        if (uBlock->GetProperty().zoned == true)
+        {
+            int eventId = EID(ARRAY_ZONED_SSD_NOT_SUPPORTED);
+            POS_TRACE_WARN(eventId, "devName: {}", devName);
+            return eventId;
+        }
         ret = devs_->AddData((new ArrayDevice(uBlock, ArrayDeviceState::NORMAL, dataIndex)));
         if (ret != 0)
         {
@@ -108,6 +114,12 @@ ArrayDeviceManager::ImportByName(DeviceSet<string> nameSet)
             POS_TRACE_WARN(eventId, "devName: {}", devName);
             return eventId;
         }
+        if (uBlock->GetProperty().zoned == true)
+        {
+            int eventId = EID(ARRAY_ZONED_SSD_NOT_SUPPORTED);
+            POS_TRACE_WARN(eventId, "devName: {}", devName);
+            return eventId;
+        }
         ret = devs_->AddSpare(new ArrayDevice(uBlock));
         if (ret != 0)
         {
@@ -203,6 +215,13 @@ ArrayDeviceManager::AddSpare(string devName)
         return eid;
     }
 
+    if (spare->GetProperty().zoned == true)
+    {
+        int eid = EID(ARRAY_ZONED_SSD_NOT_SUPPORTED);
+        POS_TRACE_WARN(eid, "devName: {}", devName);
+        return eid;
+    }
+
     uint64_t baseCapa = _GetBaseCapacity(devs_->GetDevs().data);
     if (baseCapa > spare->GetSize())
     {
@@ -71,6 +71,8 @@ public:
 
     const FtSizeInfo* GetSizeInfo(void) { return &ftSize_; }
     virtual list<FtEntry> Translate(const LogicalEntry& le) = 0;
+    // A read may be served from any copy of a normal device
+    virtual list<FtEntry> TranslateForRead(const LogicalEntry& le, const vector<uint32_t>& abnormals) { return Translate(le); }
     virtual int MakeParity(list<FtWriteEntry>& ftl, const LogicalWriteEntry& src) = 0;
     virtual RaidState GetRaidState(const vector<ArrayDeviceState>& devs) = 0;
     virtual bool CheckNumofDevsToConfigure(uint32_t numofDevs) = 0;
@@ -78,6 +80,8 @@ public:
     virtual RecoverFunc GetRecoverFunc(vector<uint32_t> targets, vector<uint32_t> abnormals) { return nullptr; }
     virtual list<FtBlkAddr> GetRebuildGroup(FtBlkAddr fba, const vector<uint32_t>& abnormals) { return list<FtBlkAddr>(); }
     virtual vector<uint32_t> GetParityOffset(StripeId lsid) { return vector<uint32_t>(); }
+    // Count of stripes after which Translate() repeats the same chunk layout
+    virtual uint32_t GetLayoutRotation(void) { return 1; }
     virtual bool IsRecoverable(void) { return true; }
     virtual vector<pair<vector<uint32_t>, vector<uint32_t>>> GetRebuildGroupPairs(vector<uint32_t>& targetIndexs)
     {
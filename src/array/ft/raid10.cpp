@@ -63,6 +63,53 @@ Raid10::Translate(const LogicalEntry& le)
     return list<FtEntry> { fe };
 }
 
+list<FtEntry>
+Raid10::TranslateForRead(const LogicalEntry& le, const vector<uint32_t>& abnormals)
+{
+    list<FtEntry> feList = Translate(le);
+    FtEntry& fe = feList.front();
+    uint32_t firstIdx = fe.addr.offset / ftSize_.blksPerChunk;
+    uint32_t lastIdx = (fe.addr.offset + fe.blkCnt - 1) / ftSize_.blksPerChunk;
+    if (lastIdx >= mirrorDevCnt)
+    {
+        return feList;
+    }
+
+    // Alternate the copies chunk by chunk, so that both devices of a pair
+    // serve reads and a sequential read within a chunk stays on one device
+    bool readMirror = ((fe.addr.stripeId + firstIdx) % 2) == 1;
+    uint32_t mirrorFirstIdx = _GetMirrorIndex(firstIdx);
+    uint32_t mirrorLastIdx = _GetMirrorIndex(lastIdx);
+    if (readMirror == true && _HasAbnormal(mirrorFirstIdx, mirrorLastIdx, abnormals))
+    {
+        readMirror = false;
+    }
+    else if (readMirror == false && _HasAbnormal(firstIdx, lastIdx, abnormals) &&
+        _HasAbnormal(mirrorFirstIdx, mirrorLastIdx, abnormals) == false)
+    {
+        readMirror = true;
+    }
+
+    if (readMirror == true)
+    {
+        fe.addr.offset += ftSize_.backupBlkCnt;
+    }
+    return feList;
+}
+
+bool
+Raid10::_HasAbnormal(uint32_t firstIdx, uint32_t lastIdx, const vector<uint32_t>& abnormals)
+{
+    for (uint32_t idx : abnormals)
+    {
+        if (idx >= firstIdx && idx <= lastIdx)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 int
 Raid10::MakeParity(list<FtWriteEntry>& ftl, const LogicalWriteEntry& src)
 {
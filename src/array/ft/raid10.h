@@ -49,6 +49,7 @@ public:
     explicit Raid10(const PartitionPhysicalSize* pSize);
     virtual ~Raid10();
     virtual list<FtEntry> Translate(const LogicalEntry& le) override;
+    virtual list<FtEntry> TranslateForRead(const LogicalEntry& le, const vector<uint32_t>& abnormals) override;
     virtual int MakeParity(list<FtWriteEntry>& ftl, const LogicalWriteEntry& src) override;
     virtual list<FtBlkAddr> GetRebuildGroup(FtBlkAddr fba, const vector<uint32_t>& abnormals) override;
     RecoverFunc GetRecoverFunc(vector<uint32_t> targets, vector<uint32_t> abnormals) override;
@@ -60,6 +61,7 @@ public:
 private:
     void _RebuildData(void* dst, void* src, uint32_t size);
     uint32_t _GetMirrorIndex(uint32_t idx);
+    bool _HasAbnormal(uint32_t firstIdx, uint32_t lastIdx, const vector<uint32_t>& abnormals);
     void _BindRecoverFunc(void);
     uint32_t mirrorDevCnt = 0;
     RecoverFunc recoverFunc = nullptr;
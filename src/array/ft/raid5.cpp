@@ -31,6 +31,7 @@
  */
 
 #include "raid5.h"
+#include "src/array/ft/xor_engine.h"
 #include "src/include/array_config.h"
 #include "src/include/pos_event_id.h"
 #include "src/array_models/dto/partition_physical_size.h"
@@ -143,7 +144,7 @@ Raid5::MakeParity(list<FtWriteEntry>& ftl, const LogicalWriteEntry& src)
     fwe.addr.stripeId = src.addr.stripeId;
     fwe.addr.offset = (uint64_t)parityIndex * (uint64_t)ftSize_.blksPerChunk;
     fwe.blkCnt = ftSize_.blksPerChunk;
-    BufferEntry parity = _AllocChunk();
+    BufferEntry parity = _AllocChunk(_GetParityNuma(*(src.buffers)));
     _ComputeParityChunk(parity, *(src.buffers));
     fwe.buffers.push_back(parity);
     ftl.clear();
@@ -178,8 +179,8 @@ Raid5::GetRebuildGroupPairs(vector<uint32_t>& targetIndexs)
     return rgPair;
 }
 
-BufferEntry
-Raid5::_AllocChunk()
+uint32_t
+Raid5::_GetParityNuma(const list<BufferEntry>& src)
 {
     if (parityPools.size() == 0 && parityBufferCntPerNuma > 0)
     {
@@ -193,7 +194,24 @@ Raid5::_AllocChunk()
             POS_TRACE_ERROR(eventId, "required number of buffers:{}", parityBufferCntPerNuma);
         }
     }
+
     uint32_t numa = affinityManager->GetNumaIdFromCurrentThread();
+    if (src.empty() == false)
+    {
+        // parity sources are the write buffer stripe, so taking the parity from
+        // the pool of the same node keeps the flush within that socket
+        uint32_t bufferNuma = affinityManager->GetNumaIdFromAddress(src.front().GetBufferPtr());
+        if (bufferNuma < parityPools.size())
+        {
+            numa = bufferNuma;
+        }
+    }
+    return numa;
+}
+
+BufferEntry
+Raid5::_AllocChunk(uint32_t numa)
+{
     BufferPool* bufferPool = parityPools.at(numa);
     void* mem = bufferPool->TryGetBuffer();
 
@@ -209,51 +227,15 @@ void
 Raid5::_ComputeParityChunk(BufferEntry& dst, const list<BufferEntry>& src)
 {
     uint32_t memSize = ftSize_.blksPerChunk * ArrayConfig::BLOCK_SIZE_BYTE;
-    void* src1 = nullptr;
-    void* src2 = nullptr;
+    void* sources[src.size()];
+    uint32_t srcCnt = 0;
 
     for (const BufferEntry& buffer : src)
     {
-        if (nullptr == src1)
-        {
-            src1 = buffer.GetBufferPtr();
-            continue;
-        }
-
-        if (nullptr == src2)
-        {
-            src2 = buffer.GetBufferPtr();
-            _XorBlocks(dst.GetBufferPtr(), src1, src2, memSize);
-            continue;
-        }
-
-        _XorBlocks(dst.GetBufferPtr(), buffer.GetBufferPtr(), memSize);
+        sources[srcCnt++] = buffer.GetBufferPtr();
     }
-}
 
-void
-Raid5::_XorBlocks(void* dst, const void* src, uint32_t memSize)
-{
-    uint64_t* dstElement = (uint64_t*)dst;
-    uint64_t* srcElement = (uint64_t*)src;
-
-    for (uint32_t i = 0; i < memSize / sizeof(uint64_t); i++)
-    {
-        dstElement[i] ^= srcElement[i];
-    }
-}
-
-void
-Raid5::_XorBlocks(void* dst, void* src1, void* src2, uint32_t memSize)
-{
-    uint64_t* dstElement = (uint64_t*)dst;
-    uint64_t* srcElement1 = (uint64_t*)src1;
-    uint64_t* srcElement2 = (uint64_t*)src2;
-
-    for (uint32_t i = 0; i < memSize / sizeof(uint64_t); i++)
-    {
-        dstElement[i] = (srcElement1[i] ^ srcElement2[i]);
-    }
+    XorEngine::Compute(dst.GetBufferPtr(), sources, srcCnt, memSize);
 }
 
 vector<uint32_t>
@@ -262,6 +244,13 @@ Raid5::GetParityOffset(StripeId lsid)
     return vector<uint32_t>{ lsid % ftSize_.chunksPerStripe };
 }
 
+uint32_t
+Raid5::GetLayoutRotation(void)
+{
+    // The parity moves to the next chunk every stripe
+    return ftSize_.chunksPerStripe;
+}
+
 void
 Raid5::_BindRecoverFunc(void)
 {
@@ -272,12 +261,14 @@ Raid5::_BindRecoverFunc(void)
 void
 Raid5::_RebuildData(void* dst, void* src, uint32_t dstSize)
 {
-    using BlockData = char[dstSize];
-    memset(dst, 0, dstSize);
-    for (uint32_t i = 0; i < ftSize_.chunksPerStripe - 1; i++)
+    uint32_t srcCnt = ftSize_.chunksPerStripe - 1;
+    void* sources[srcCnt];
+    for (uint32_t i = 0; i < srcCnt; i++)
     {
-        _XorBlocks(dst, reinterpret_cast<BlockData*>(src) + i, dstSize);
+        sources[i] = static_cast<char*>(src) + (uint64_t)i * dstSize;
     }
+
+    XorEngine::Compute(dst, sources, srcCnt, dstSize);
 }
 
 bool
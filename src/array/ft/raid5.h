@@ -62,6 +62,7 @@ public:
     RecoverFunc GetRecoverFunc(vector<uint32_t> targets, vector<uint32_t> abnormals) override;
     virtual RaidState GetRaidState(const vector<ArrayDeviceState>& devs) override;
     vector<uint32_t> GetParityOffset(StripeId lsid) override;
+    uint32_t GetLayoutRotation(void) override;
     bool CheckNumofDevsToConfigure(uint32_t numofDevs) override;
     vector<pair<vector<uint32_t>, vector<uint32_t>>> GetRebuildGroupPairs(vector<uint32_t>& targetIndexs) override;
 
@@ -70,10 +71,9 @@ public:
 private:
     void _BindRecoverFunc(void);
     void _RebuildData(void* dst, void* src, uint32_t size);
-    BufferEntry _AllocChunk();
+    uint32_t _GetParityNuma(const list<BufferEntry>& src);
+    BufferEntry _AllocChunk(uint32_t numa);
     void _ComputeParityChunk(BufferEntry& dst, const list<BufferEntry>& src);
-    void _XorBlocks(void* dst, const void* src, uint32_t memSize);
-    void _XorBlocks(void* dst, void* src1, void* src2, uint32_t memSize);
     vector<BufferPool*> parityPools;
     AffinityManager* affinityManager = nullptr;
     MemoryManager* memoryManager = nullptr;
@@ -37,19 +37,39 @@
 #include "src/logger/logger.h"
 #include "src/resource_manager/buffer_pool.h"
 #include "src/helper/enumerable/query.h"
+#include "src/include/branch_prediction.h"
+#include "src/telemetry/telemetry_id.h"
 
 #include <string>
 #include <isa-l.h>
 #include <algorithm>
 namespace pos
 {
-Raid6::Raid6(const PartitionPhysicalSize* pSize, uint64_t bufferCntPerNuma)
-: Method(RaidTypeEnum::RAID6),
-  parityBufferCntPerNuma(bufferCntPerNuma)
+Raid6::Raid6(const PartitionPhysicalSize* pSize, uint64_t bufferCntPerNuma,
+    TelemetryMetricRegistry* registry)
+: Raid6(RaidTypeEnum::RAID6, 2, pSize, bufferCntPerNuma, registry)
 {
+}
+
+Raid6::Raid6(RaidTypeEnum type, uint32_t parityCount, const PartitionPhysicalSize* pSize,
+    uint64_t bufferCntPerNuma, TelemetryMetricRegistry* registry)
+: Method(type),
+  parityCnt(parityCount),
+  parityBufferCntPerNuma(bufferCntPerNuma),
+  metricRegistry(registry)
+{
+    if (metricRegistry != nullptr)
+    {
+        decodingTableHitHandle = metricRegistry->RegisterCounter(TEL60006_ARRAY_RAID6_DECODING_TABLE_HIT_CNT);
+        decodingTableMissHandle = metricRegistry->RegisterCounter(TEL60007_ARRAY_RAID6_DECODING_TABLE_MISS_CNT);
+    }
+    for (uint32_t i = 0; i < DECODING_TABLE_SLOT_CNT; i++)
+    {
+        decodingTables[i] = nullptr;
+    }
     ftSize_ = {
         .minWriteBlkCnt = 0,
-        .backupBlkCnt = pSize->blksPerChunk * 2,
+        .backupBlkCnt = pSize->blksPerChunk * parityCount,
         .blksPerChunk = pSize->blksPerChunk,
         .blksPerStripe = pSize->chunksPerStripe * pSize->blksPerChunk,
         .chunksPerStripe = pSize->chunksPerStripe};
@@ -76,8 +96,10 @@ Raid6::GetParityOffset(StripeId lsid)
 {
     vector<uint32_t> raid6ParityIndex;
 
-    raid6ParityIndex.push_back(chunkCnt - 2);
-    raid6ParityIndex.push_back(chunkCnt - 1);
+    for (uint32_t i = chunkCnt - parityCnt; i < chunkCnt; i++)
+    {
+        raid6ParityIndex.push_back(i);
+    }
 
     return raid6ParityIndex;
 }
@@ -88,39 +110,28 @@ Raid6::MakeParity(list<FtWriteEntry>& ftl, const LogicalWriteEntry& src)
     vector<uint32_t> parityOffset = GetParityOffset(src.addr.stripeId);
     assert(parityOffset.size() == parityCnt);
 
-    uint32_t pParityIndex = parityOffset.front();
-    uint32_t qParityIndex = parityOffset.back();
-
-    FtWriteEntry fwe_pParity;
-    FtWriteEntry fwe_qParity;
-
-    fwe_pParity.addr.stripeId = src.addr.stripeId;
-    fwe_pParity.addr.offset = (uint64_t)pParityIndex * (uint64_t)ftSize_.blksPerChunk;
-    fwe_pParity.blkCnt = ftSize_.blksPerChunk;
-
-    fwe_qParity.addr.stripeId = src.addr.stripeId;
-    fwe_qParity.addr.offset = (uint64_t)qParityIndex * (uint64_t)ftSize_.blksPerChunk;
-    fwe_qParity.blkCnt = ftSize_.blksPerChunk;
-
-    BufferEntry pParity = _AllocChunk();
-    BufferEntry qParity = _AllocChunk();
     list<BufferEntry> parities;
-
-    parities.push_back(pParity);
-    parities.push_back(qParity);
+    uint32_t numa = _GetParityNuma(*(src.buffers));
+    for (uint32_t i = 0; i < parityCnt; i++)
+    {
+        parities.push_back(_AllocChunk(numa));
+    }
 
     _ComputePQParities(parities, *(src.buffers));
     assert(parities.size() == parityCnt);
 
-    pParity = parities.front();
-    qParity = parities.back();
-
-    fwe_pParity.buffers.push_back(pParity);
-    fwe_qParity.buffers.push_back(qParity);
-
     ftl.clear();
-    ftl.push_back(fwe_pParity);
-    ftl.push_back(fwe_qParity);
+    auto parity = parities.begin();
+    for (uint32_t parityIndex : parityOffset)
+    {
+        FtWriteEntry fwe;
+        fwe.addr.stripeId = src.addr.stripeId;
+        fwe.addr.offset = (uint64_t)parityIndex * (uint64_t)ftSize_.blksPerChunk;
+        fwe.blkCnt = ftSize_.blksPerChunk;
+        fwe.buffers.push_back(*parity);
+        ftl.push_back(fwe);
+        parity++;
+    }
 
     return 0;
 }
@@ -148,7 +159,7 @@ Raid6::GetRebuildGroup(FtBlkAddr fba, const vector<uint32_t>& abnormals)
 vector<pair<vector<uint32_t>, vector<uint32_t>>>
 Raid6::GetRebuildGroupPairs(vector<uint32_t>& targetIndexs)
 {
-    assert(targetIndexs.size() <= 2);
+    assert(targetIndexs.size() <= parityCnt);
     vector<pair<vector<uint32_t>, vector<uint32_t>>> rgPair;
     vector<uint32_t> srcIdx;
     for (uint32_t i = 0; i < chunkCnt; i++)
@@ -168,13 +179,15 @@ Raid6::GetRaidState(const vector<ArrayDeviceState>& devs)
     auto&& abnormalDevs = Enumerable::Where(devs,
         [](auto d) { return d != ArrayDeviceState::NORMAL; });
 
-    POS_TRACE_INFO(EID(RAID_DEBUG_MSG), "GetRaidState from raid6, abnormal cnt:{} ", abnormalDevs.size());
+    POS_TRACE_INFO(EID(RAID_DEBUG_MSG), "GetRaidState from {}, abnormal cnt:{} ",
+        RaidType(raidType).ToString(), abnormalDevs.size());
     if (abnormalDevs.size() == 0)
     {
         return RaidState::NORMAL;
     }
-    else if (abnormalDevs.size() <= 2)
+    else if (abnormalDevs.size() <= parityCnt)
     {
+        PrepareDecodingTables();
         return RaidState::DEGRADED;
     }
     return RaidState::FAILURE;
@@ -187,8 +200,8 @@ Raid6::CheckNumofDevsToConfigure(uint32_t numofDevs)
     return numofDevs >= minRequiredNumofDevsforRAID6;
 }
 
-BufferEntry
-Raid6::_AllocChunk()
+uint32_t
+Raid6::_GetParityNuma(const list<BufferEntry>& src)
 {
     if (parityPools.size() == 0 && parityBufferCntPerNuma > 0)
     {
@@ -204,6 +217,22 @@ Raid6::_AllocChunk()
     }
 
     uint32_t numa = affinityManager->GetNumaIdFromCurrentThread();
+    if (src.empty() == false)
+    {
+        // parity sources are the write buffer stripe, so taking the parity from
+        // the pool of the same node keeps the flush within that socket
+        uint32_t bufferNuma = affinityManager->GetNumaIdFromAddress(src.front().GetBufferPtr());
+        if (bufferNuma < parityPools.size())
+        {
+            numa = bufferNuma;
+        }
+    }
+    return numa;
+}
+
+BufferEntry
+Raid6::_AllocChunk(uint32_t numa)
+{
     BufferPool* bufferPool = parityPools.at(numa);
     void* mem = bufferPool->TryGetBuffer();
 
@@ -247,26 +276,155 @@ Raid6::_ComputePQParities(list<BufferEntry>& dst, const list<BufferEntry>& src)
 }
 
 uint32_t
-Raid6::_MakeKeyforGFMap(vector<uint32_t>& excluded)
+Raid6::_MakeFailureMask(const vector<uint32_t>& excluded)
 {
-    uint32_t key;
-    // ascending sort
-    sort(excluded.begin(), excluded.end());
+    uint32_t mask = 0;
+    for (uint32_t index : excluded)
+    {
+        mask |= (1U << index);
+    }
+    return mask;
+}
 
-    if (excluded.size() == 1)
+uint32_t
+Raid6::_GetDecodingTableSlot(uint32_t failureMask)
+{
+    // slots [0, MAX_CHUNK_CNT) hold one-failure tables, the rest hold
+    // two-failure tables in the order of (first, second) with first < second
+    uint32_t first = __builtin_ctz(failureMask);
+    uint32_t rest = failureMask & (failureMask - 1);
+    if (rest == 0)
     {
-        key = excluded[0];
+        return first;
     }
-    else
+    uint32_t second = __builtin_ctz(rest);
+    const uint32_t n = ArrayConfig::MAX_CHUNK_CNT;
+    return n + first * n - first * (first + 1) / 2 + (second - first - 1);
+}
+
+unsigned char*
+Raid6::_GetDecodingTable(const vector<uint32_t>& excluded)
+{
+    uint32_t failureMask = _MakeFailureMask(excluded);
+    if (excluded.size() > 2)
     {
-        key = ArrayConfig::MAX_CHUNK_CNT * (excluded[0] + 1) + excluded[1];
+        return _GetWideDecodingTable(failureMask, excluded);
     }
 
-    return key;
+    uint32_t slot = _GetDecodingTableSlot(failureMask);
+    assert(slot < DECODING_TABLE_SLOT_CNT);
+
+    unsigned char* table = decodingTables[slot].load(memory_order_acquire);
+    if (likely(table != nullptr))
+    {
+        _CountDecodingTableHit();
+        return table;
+    }
+
+    _CountDecodingTableMiss();
+    return _InstallDecodingTable(slot, excluded);
+}
+
+unsigned char*
+Raid6::_GetWideDecodingTable(uint32_t failureMask, const vector<uint32_t>& excluded)
+{
+    // three or more failures have too many patterns to hold a slot each,
+    // so their tables are built on the first use only
+    lock_guard<mutex> lock(wideDecodingTableLock);
+    auto it = wideDecodingTables.find(failureMask);
+    if (it != wideDecodingTables.end())
+    {
+        _CountDecodingTableHit();
+        return it->second;
+    }
+
+    _CountDecodingTableMiss();
+    unsigned char* newTable = new unsigned char[dataCnt * parityCnt * galoisTableSize];
+    _MakeDecodingGFTable(excluded, newTable);
+    wideDecodingTables.emplace(failureMask, newTable);
+    return newTable;
 }
 
 void
-Raid6::_MakeDecodingGFTable(vector<uint32_t> excluded, unsigned char* rebuildGaloisTable)
+Raid6::_CountDecodingTableHit(void)
+{
+    decodingTableHitCnt.fetch_add(1, memory_order_relaxed);
+    if (metricRegistry != nullptr)
+    {
+        metricRegistry->Add(decodingTableHitHandle);
+    }
+}
+
+void
+Raid6::_CountDecodingTableMiss(void)
+{
+    decodingTableMissCnt.fetch_add(1, memory_order_relaxed);
+    if (metricRegistry != nullptr)
+    {
+        metricRegistry->Add(decodingTableMissHandle);
+    }
+}
+
+unsigned char*
+Raid6::_InstallDecodingTable(uint32_t slot, const vector<uint32_t>& excluded)
+{
+    unsigned char* newTable = new unsigned char[dataCnt * parityCnt * galoisTableSize];
+    _MakeDecodingGFTable(excluded, newTable);
+
+    unsigned char* expected = nullptr;
+    if (decodingTables[slot].compare_exchange_strong(expected, newTable,
+            memory_order_acq_rel, memory_order_acquire) == false)
+    {
+        // another thread has installed the same table first
+        delete[] newTable;
+        return expected;
+    }
+    return newTable;
+}
+
+void
+Raid6::PrepareDecodingTables(void)
+{
+    if (decodingTablesPrepared.exchange(true) == true)
+    {
+        return;
+    }
+
+    for (uint32_t first = 0; first < chunkCnt; first++)
+    {
+        vector<uint32_t> excluded{first};
+        uint32_t slot = _GetDecodingTableSlot(_MakeFailureMask(excluded));
+        if (decodingTables[slot].load(memory_order_acquire) == nullptr)
+        {
+            _InstallDecodingTable(slot, excluded);
+        }
+        for (uint32_t second = first + 1; second < chunkCnt; second++)
+        {
+            excluded = {first, second};
+            slot = _GetDecodingTableSlot(_MakeFailureMask(excluded));
+            if (decodingTables[slot].load(memory_order_acquire) == nullptr)
+            {
+                _InstallDecodingTable(slot, excluded);
+            }
+        }
+    }
+    POS_TRACE_INFO(EID(RAID_DEBUG_MSG), "decoding tables for all one and two failure patterns are prepared, chunkCnt:{}", chunkCnt);
+}
+
+uint64_t
+Raid6::GetDecodingTableHitCount(void)
+{
+    return decodingTableHitCnt.load(memory_order_relaxed);
+}
+
+uint64_t
+Raid6::GetDecodingTableMissCount(void)
+{
+    return decodingTableMissCnt.load(memory_order_relaxed);
+}
+
+void
+Raid6::_MakeDecodingGFTable(const vector<uint32_t>& excluded, unsigned char* rebuildGaloisTable)
 {
     uint32_t destCnt = excluded.size();
     unsigned char* tempMatrix = new unsigned char[chunkCnt * dataCnt];
@@ -334,7 +492,7 @@ Raid6::_MakeDecodingGFTable(vector<uint32_t> excluded, unsigned char* rebuildGal
 }
 
 void
-Raid6::_RebuildData(void* dst, void* src, uint32_t dstSize, vector<uint32_t> targets, vector<uint32_t> abnormals)
+Raid6::_RebuildData(void* dst, void* src, uint32_t dstSize, const vector<uint32_t>& targets, const vector<uint32_t>& abnormals)
 {
     vector<uint32_t> excluded;
     {
@@ -345,6 +503,8 @@ Raid6::_RebuildData(void* dst, void* src, uint32_t dstSize, vector<uint32_t> tar
         excluded = Enumerable::Distinct(merged,
             [](auto p) { return p; });
         assert(excluded.size() != 0);
+        // decoding tables and output buffers are both ordered by device index
+        sort(excluded.begin(), excluded.end());
     }
 
     uint32_t destCnt = excluded.size();
@@ -382,34 +542,7 @@ Raid6::_RebuildData(void* dst, void* src, uint32_t dstSize, vector<uint32_t> tar
         }
     }
 
-    // Make key for Galois field table caching during rebuild
-    uint32_t key = _MakeKeyforGFMap(excluded);
-    unsigned char* rebuildGaloisTable = nullptr;
-    auto iter = galoisTableMap.find(key);
-    if (iter != galoisTableMap.end())
-    {
-        // Use Galois field table in Map for caching
-        rebuildGaloisTable = iter->second;
-    }
-    else
-    {
-        unique_lock<mutex> lock(rebuildMutex);
-        auto iter = galoisTableMap.find(key);
-        if (iter == galoisTableMap.end())
-        {
-            // Make Galois field table with given device indices and insert to Map
-            rebuildGaloisTable = new unsigned char[dataCnt * parityCnt * galoisTableSize];
-            _MakeDecodingGFTable(excluded, rebuildGaloisTable);
-            POS_TRACE_WARN(EID(RAID_DEBUG_MSG), "a new galois table is inserted, key:{}", key);
-            galoisTableMap.insert(make_pair(key, rebuildGaloisTable));
-        }
-        else
-        {
-            // Use Galois field table in Map if the key exist within multi-thread environments
-            rebuildGaloisTable = iter->second;
-        }
-    }
-
+    unsigned char* rebuildGaloisTable = _GetDecodingTable(excluded);
     ec_encode_data(dstSize, dataCnt, destCnt, rebuildGaloisTable, rebuildInput, rebuildOutp);
 
     for (auto mem : tmpAlloc)
@@ -469,9 +602,13 @@ Raid6::~Raid6()
     delete[] encodeMatrix;
     delete[] galoisTable;
 
-    for (auto iter = galoisTableMap.begin(); iter != galoisTableMap.end(); iter++)
+    for (uint32_t i = 0; i < DECODING_TABLE_SLOT_CNT; i++)
+    {
+        delete[] decodingTables[i].load();
+    }
+    for (auto& table : wideDecodingTables)
     {
-        delete[](iter->second);
+        delete[] table.second;
     }
 }
 
@@ -36,12 +36,15 @@
 
 #include "method.h"
 #include "src/cpu_affinity/affinity_manager.h"
+#include "src/include/array_config.h"
 #include "src/resource_manager/memory_manager.h"
+#include "src/telemetry/telemetry_client/telemetry_metric_registry.h"
 
+#include <atomic>
 #include <list>
-#include <vector>
 #include <map>
 #include <mutex>
+#include <vector>
 
 namespace pos
 {
@@ -51,7 +54,8 @@ class BufferPool;
 class Raid6 : public Method
 {
 public:
-    explicit Raid6(const PartitionPhysicalSize* pSize, uint64_t bufferCntPerNuma);
+    explicit Raid6(const PartitionPhysicalSize* pSize, uint64_t bufferCntPerNuma,
+        TelemetryMetricRegistry* registry = TelemetryMetricRegistrySingleton::Instance());
     virtual ~Raid6();
     virtual bool AllocParityPools(uint64_t parityBufferCntPerNuma,
         AffinityManager* affMgr = AffinityManagerSingleton::Instance(),
@@ -65,16 +69,32 @@ public:
     virtual RaidState GetRaidState(const vector<ArrayDeviceState>& devs) override;
     vector<uint32_t> GetParityOffset(StripeId lsid) override;
     bool CheckNumofDevsToConfigure(uint32_t numofDevs) override;
+    virtual void PrepareDecodingTables(void);
+    uint64_t GetDecodingTableHitCount(void);
+    uint64_t GetDecodingTableMissCount(void);
     // This function is for unit testing only
     virtual int GetParityPoolSize();
 
+protected:
+    Raid6(RaidTypeEnum type, uint32_t parityCount, const PartitionPhysicalSize* pSize,
+        uint64_t bufferCntPerNuma, TelemetryMetricRegistry* registry);
+
+    uint32_t parityCnt = 2;
+
 private:
-    void _RebuildData(void* dst, void* src, uint32_t dstSize, vector<uint32_t> targets, vector<uint32_t> abnormals);
-    BufferEntry _AllocChunk();
+    void _RebuildData(void* dst, void* src, uint32_t dstSize, const vector<uint32_t>& targets, const vector<uint32_t>& abnormals);
+    uint32_t _GetParityNuma(const list<BufferEntry>& src);
+    BufferEntry _AllocChunk(uint32_t numa);
     void _ComputePQParities(list<BufferEntry>& dst, const list<BufferEntry>& src);
     void _MakeEncodingGFTable();
-    void _MakeDecodingGFTable(vector<uint32_t> excluded, unsigned char* g_tbls_rebuild);
-    uint32_t _MakeKeyforGFMap(vector<uint32_t>& excluded);
+    void _MakeDecodingGFTable(const vector<uint32_t>& excluded, unsigned char* g_tbls_rebuild);
+    uint32_t _MakeFailureMask(const vector<uint32_t>& excluded);
+    uint32_t _GetDecodingTableSlot(uint32_t failureMask);
+    unsigned char* _GetDecodingTable(const vector<uint32_t>& excluded);
+    unsigned char* _InstallDecodingTable(uint32_t slot, const vector<uint32_t>& excluded);
+    unsigned char* _GetWideDecodingTable(uint32_t failureMask, const vector<uint32_t>& excluded);
+    void _CountDecodingTableHit(void);
+    void _CountDecodingTableMiss(void);
 
     vector<BufferPool*> parityPools;
     AffinityManager* affinityManager = nullptr;
@@ -84,13 +104,23 @@ private:
     uint32_t chunkSize = 0;
     uint32_t chunkCnt = 0;
     uint32_t dataCnt = 0;
-    uint32_t parityCnt = 2;
     uint32_t galoisTableSize = 32;
     unsigned char* encodeMatrix = nullptr;
     unsigned char* galoisTable = nullptr;
 
-    mutex rebuildMutex;
-    map<uint32_t, unsigned char*> galoisTableMap;
+    // one slot per one-failure and two-failure pattern of MAX_CHUNK_CNT devices
+    static const uint32_t DECODING_TABLE_SLOT_CNT = ArrayConfig::MAX_CHUNK_CNT +
+        ArrayConfig::MAX_CHUNK_CNT * (ArrayConfig::MAX_CHUNK_CNT - 1) / 2;
+    atomic<unsigned char*> decodingTables[DECODING_TABLE_SLOT_CNT];
+    // tables for three or more failures, keyed by failure mask
+    map<uint32_t, unsigned char*> wideDecodingTables;
+    mutex wideDecodingTableLock;
+    atomic<bool> decodingTablesPrepared{false};
+    atomic<uint64_t> decodingTableHitCnt{0};
+    atomic<uint64_t> decodingTableMissCnt{0};
+    TelemetryMetricRegistry* metricRegistry = nullptr;
+    MetricHandle decodingTableHitHandle = TelemetryMetricRegistry::INVALID_METRIC_HANDLE;
+    MetricHandle decodingTableMissHandle = TelemetryMetricRegistry::INVALID_METRIC_HANDLE;
 };
 
 } // namespace pos
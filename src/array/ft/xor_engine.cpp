@@ -0,0 +1,125 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/array/ft/xor_engine.h"
+
+#include <isa-l.h>
+#include <string.h>
+
+namespace pos
+{
+void
+XorEngine::Compute(void* dst, void* const* srcs, uint32_t srcCnt, uint32_t size)
+{
+    if (srcCnt == 0)
+    {
+        memset(dst, 0, size);
+        return;
+    }
+
+    if (srcCnt == 1)
+    {
+        if (dst != srcs[0])
+        {
+            memcpy(dst, srcs[0], size);
+        }
+        return;
+    }
+
+    if (IsAccelerable(dst, srcs, srcCnt, size))
+    {
+        // xor_gen() takes sources followed by the destination in one array
+        void* vectors[srcCnt + 1];
+        for (uint32_t i = 0; i < srcCnt; i++)
+        {
+            vectors[i] = srcs[i];
+        }
+        vectors[srcCnt] = dst;
+        if (xor_gen(srcCnt + 1, size, vectors) == 0)
+        {
+            return;
+        }
+    }
+
+    ComputeScalar(dst, srcs, srcCnt, size);
+}
+
+void
+XorEngine::ComputeScalar(void* dst, void* const* srcs, uint32_t srcCnt, uint32_t size)
+{
+    uint64_t* dstElement = static_cast<uint64_t*>(dst);
+    uint32_t elementCnt = size / sizeof(uint64_t);
+
+    for (uint32_t i = 0; i < elementCnt; i++)
+    {
+        uint64_t value = 0;
+        for (uint32_t s = 0; s < srcCnt; s++)
+        {
+            value ^= static_cast<const uint64_t*>(srcs[s])[i];
+        }
+        dstElement[i] = value;
+    }
+
+    uint8_t* dstTail = static_cast<uint8_t*>(dst);
+    for (uint32_t i = elementCnt * sizeof(uint64_t); i < size; i++)
+    {
+        uint8_t value = 0;
+        for (uint32_t s = 0; s < srcCnt; s++)
+        {
+            value ^= static_cast<const uint8_t*>(srcs[s])[i];
+        }
+        dstTail[i] = value;
+    }
+}
+
+bool
+XorEngine::IsAccelerable(void* dst, void* const* srcs, uint32_t srcCnt, uint32_t size)
+{
+    if (size == 0 || size % ALIGNMENT != 0)
+    {
+        return false;
+    }
+    if (reinterpret_cast<uintptr_t>(dst) % ALIGNMENT != 0)
+    {
+        return false;
+    }
+    for (uint32_t i = 0; i < srcCnt; i++)
+    {
+        if (reinterpret_cast<uintptr_t>(srcs[i]) % ALIGNMENT != 0 || srcs[i] == dst)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace pos
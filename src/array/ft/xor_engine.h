@@ -0,0 +1,57 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace pos
+{
+// Multi-source XOR used by XOR-based fault tolerance methods (e.g. RAID5).
+// All sources are folded into the destination in a single pass, so the
+// destination is written exactly once regardless of the stripe width.
+// ISA-L's xor_gen() is used whenever the buffers satisfy its alignment
+// requirement; ISA-L dispatches to SSE/AVX2/AVX-512 kernels at runtime
+// according to the CPU features. Otherwise a portable 64-bit loop is used.
+class XorEngine
+{
+public:
+    static const uint32_t ALIGNMENT = 32;
+
+    // dst = srcs[0] ^ srcs[1] ^ ... ^ srcs[srcCnt - 1]
+    static void Compute(void* dst, void* const* srcs, uint32_t srcCnt, uint32_t size);
+    // Reference implementation of Compute(), kept for fallback and benchmark
+    static void ComputeScalar(void* dst, void* const* srcs, uint32_t srcCnt, uint32_t size);
+    static bool IsAccelerable(void* dst, void* const* srcs, uint32_t srcCnt, uint32_t size);
+};
+
+} // namespace pos
@@ -149,6 +149,19 @@ NvmPartition::IsByteAccessSupported(void)
     return true;
 }
 
+int
+NvmPartition::GetPhysicalRanges(list<PhysicalEntry>& pel, StripeId startStripe, uint32_t stripeCnt)
+{
+    pel.clear();
+    return 0;
+}
+
+int
+NvmPartition::TranslateForRead(list<PhysicalEntry>& pel, const LogicalEntry& le)
+{
+    return Translate(pel, le);
+}
+
 int
 NvmPartition::_SetPhysicalAddress(uint64_t startLba, uint32_t blksPerChunk)
 {
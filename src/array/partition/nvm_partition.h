@@ -54,6 +54,8 @@ public:
     int ByteTranslate(PhysicalByteAddr& dst, const LogicalByteAddr& src);
     int ByteConvert(list<PhysicalByteWriteEntry>& dst, const LogicalByteWriteEntry& src);
     bool IsByteAccessSupported(void) override;
+    int GetPhysicalRanges(list<PhysicalEntry>& pel, StripeId startStripe, uint32_t stripeCnt) override;
+    int TranslateForRead(list<PhysicalEntry>& pel, const LogicalEntry& le) override;
 
 private:
     int _SetPhysicalAddress(uint64_t startLba, uint32_t blksPerChunk);
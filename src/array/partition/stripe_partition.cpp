@@ -31,6 +31,7 @@
  */
 
 #include <cassert>
+#include <algorithm>
 #include <iostream>
 #include <memory>
 
@@ -47,6 +48,7 @@
 #include "src/array/ft/raid0.h"
 #include "src/array/ft/raid_none.h"
 #include "src/array/ft/raid6.h"
+#include "src/array/ft/erasure_code.h"
 #include "src/helper/calc/calc.h"
 
 namespace pos
@@ -89,6 +91,7 @@ StripePartition::Create(uint64_t startLba, uint32_t segCnt, uint64_t totalNvmBlk
         return ret;
     }
     _SetLogicalAddress();
+    _SetChunkLayout();
     return 0;
 }
 
@@ -126,6 +129,68 @@ StripePartition::Translate(list<PhysicalEntry>& pel, const LogicalEntry& le)
     return 0;
 }
 
+int
+StripePartition::TranslateForRead(list<PhysicalEntry>& pel, const LogicalEntry& le)
+{
+    if (raidType != RaidTypeEnum::RAID10)
+    {
+        // Only a mirror has another copy to read from
+        return Translate(pel, le);
+    }
+    if (false == _IsValidEntry(le.addr.stripeId, le.addr.offset, le.blkCnt))
+    {
+        int error = EID(ADDRESS_TRANSLATION_INVALID_LBA);
+        POS_TRACE_ERROR(error, "{} partition detects invalid address during translate for read. raidtype:{}, stripeId:{}, offset:{}, totalStripes:{}, totalBlksPerStripe:{}",
+            PARTITION_TYPE_STR[type], RaidType(raidType).ToString(), le.addr.stripeId, le.addr.offset, logicalSize.totalStripes, logicalSize.blksPerStripe);
+        return error;
+    }
+
+    list<FtEntry> feList = method->TranslateForRead(le, _GetAbnormalDeviceIndex());
+    pel = _F2PTranslate(feList);
+
+    return 0;
+}
+
+// Reads within a stripe are translated by looking up the device of each chunk
+// in the layout made at creation. A mirror picks its copy by the device state,
+// so it takes the usual translation.
+int
+StripePartition::TranslateForReadInPlace(PhysicalEntryArray& pea, const LogicalEntry& le)
+{
+    if (raidType == RaidTypeEnum::RAID10 || chunkLayout.empty())
+    {
+        return ITranslator::TranslateForReadInPlace(pea, le);
+    }
+    if (false == _IsValidEntry(le.addr.stripeId, le.addr.offset, le.blkCnt))
+    {
+        int error = EID(ADDRESS_TRANSLATION_INVALID_LBA);
+        POS_TRACE_ERROR(error, "{} partition detects invalid address during translate for read. raidtype:{}, stripeId:{}, offset:{}, totalStripes:{}, totalBlksPerStripe:{}",
+            PARTITION_TYPE_STR[type], RaidType(raidType).ToString(), le.addr.stripeId, le.addr.offset, logicalSize.totalStripes, logicalSize.blksPerStripe);
+        return error;
+    }
+
+    const uint32_t chunkSize = physicalSize.blksPerChunk;
+    const uint32_t* layout = &chunkLayout[(le.addr.stripeId % layoutRotation) * logicalSize.chunksPerStripe];
+    const uint64_t stripeLba = physicalSize.startLba + ((uint64_t)le.addr.stripeId * chunkSize * ArrayConfig::SECTORS_PER_BLOCK);
+    BlkOffset offset = le.addr.offset;
+    uint32_t remaining = le.blkCnt;
+    pea.count = 0;
+    while (remaining > 0)
+    {
+        uint32_t offsetInChunk = offset % chunkSize;
+        uint32_t blkCnt = std::min(remaining, chunkSize - offsetInChunk);
+        PhysicalEntry& pe = pea.entries[pea.count++];
+        pe.addr = {
+            .lba = stripeLba + (uint64_t)offsetInChunk * ArrayConfig::SECTORS_PER_BLOCK,
+            .arrayDev = devs[layout[offset / chunkSize]]};
+        pe.blkCnt = blkCnt;
+        offset += blkCnt;
+        remaining -= blkCnt;
+    }
+
+    return 0;
+}
+
 int
 StripePartition::GetParityList(list<PhysicalWriteEntry>& parityList, const LogicalWriteEntry& src)
 {
@@ -194,6 +259,33 @@ StripePartition::_SetLogicalAddress(void)
         .totalSegments = physicalSize.totalSegments};
 }
 
+// The chunk of each data chunk is found by translating its first block once
+// for every stripe until the layout repeats
+void
+StripePartition::_SetChunkLayout(void)
+{
+    layoutRotation = method->GetLayoutRotation();
+    if (layoutRotation == 0 || logicalSize.chunksPerStripe > PhysicalEntryArray::MAX_ENTRY_COUNT)
+    {
+        chunkLayout.clear();
+        return;
+    }
+
+    const uint32_t chunkSize = logicalSize.blksPerChunk;
+    chunkLayout.resize((uint64_t)layoutRotation * logicalSize.chunksPerStripe);
+    for (StripeId stripeId = 0; stripeId < layoutRotation; stripeId++)
+    {
+        for (uint32_t chunk = 0; chunk < logicalSize.chunksPerStripe; chunk++)
+        {
+            LogicalEntry le = {
+                .addr = {.stripeId = stripeId, .offset = (BlkOffset)chunk * chunkSize},
+                .blkCnt = 1};
+            FtEntry fe = method->Translate(le).front();
+            chunkLayout[stripeId * logicalSize.chunksPerStripe + chunk] = fe.addr.offset / chunkSize;
+        }
+    }
+}
+
 int
 StripePartition::_SetMethod(uint64_t totalNvmBlks)
 {
@@ -232,6 +324,16 @@ StripePartition::_SetMethod(uint64_t totalNvmBlks)
         Raid6* raid6 = new Raid6(&physicalSize, reqBuffersPerNuma);
         method = raid6;
     }
+    else if (raidType == RaidTypeEnum::EC3 || raidType == RaidTypeEnum::EC4)
+    {
+        uint64_t blksPerStripe = static_cast<uint64_t>(physicalSize.blksPerChunk) * physicalSize.chunksPerStripe;
+        uint64_t totalNvmStripes = totalNvmBlks / blksPerStripe;
+        uint64_t maxGcStripes = 2048;
+        uint64_t parityCnt = ErasureCode::GetParityCount(raidType);
+        uint64_t reqBuffersPerNuma = (totalNvmStripes + maxGcStripes) * parityCnt;
+        ErasureCode* erasureCode = new ErasureCode(raidType, &physicalSize, reqBuffersPerNuma);
+        method = erasureCode;
+    }
     else if (raidType == RaidTypeEnum::NONE)
     {
         RaidNone* raidNone = new RaidNone(&physicalSize);
@@ -450,6 +552,8 @@ StripePartition::GetRecoverMethod(UbioSmartPtr ubio, RecoverMethod& out)
             FtBlkAddr fba = _Pba2Fba(originPba);
             out.srcAddr = _GetRebuildGroup(fba, abnormals);
             out.recoverFunc = method->GetRecoverFunc(vector<uint32_t>{(uint32_t)devIdx}, abnormals);
+            out.partitionType = type;
+            out.stripeId = fba.stripeId;
             return EID(SUCCESS);
         }
         else
@@ -466,6 +570,41 @@ StripePartition::GetRecoverMethod(UbioSmartPtr ubio, RecoverMethod& out)
     }
 }
 
+int
+StripePartition::GetParityRecoverMethod(StripeId stripeId, RecoverMethod& out)
+{
+    if (false == _IsValidEntry(stripeId, 0, 1))
+    {
+        return EID(RECOVER_INVALID_LBA);
+    }
+
+    vector<uint32_t> parityIdx = method->GetParityOffset(stripeId);
+    sort(parityIdx.begin(), parityIdx.end());
+    out.srcAddr.clear();
+    out.dstAddr.clear();
+    for (uint32_t i = 0; i < devs.size(); i++)
+    {
+        FtBlkAddr fba = {.stripeId = stripeId,
+            .offset = (uint64_t)i * physicalSize.blksPerChunk};
+        if (find(parityIdx.begin(), parityIdx.end(), i) == parityIdx.end())
+        {
+            out.srcAddr.push_back(_Fba2Pba(fba));
+        }
+        else
+        {
+            out.dstAddr.push_back(_Fba2Pba(fba));
+        }
+    }
+    if (parityIdx.empty() == false)
+    {
+        // Every parity chunk is treated as lost so that it is recomputed from the data chunks
+        out.recoverFunc = method->GetRecoverFunc(parityIdx, vector<uint32_t>());
+    }
+    out.partitionType = type;
+    out.stripeId = stripeId;
+    return EID(SUCCESS);
+}
+
 unique_ptr<RebuildContext>
 StripePartition::GetRebuildCtx(const vector<IArrayDevice*>& fault)
 {
@@ -524,6 +663,34 @@ StripePartition::IsByteAccessSupported(void)
     return false;
 }
 
+int
+StripePartition::GetPhysicalRanges(list<PhysicalEntry>& pel, StripeId startStripe, uint32_t stripeCnt)
+{
+    if (stripeCnt == 0 || false == _IsValidEntry(startStripe + stripeCnt - 1, 0, 1))
+    {
+        int error = EID(ADDRESS_TRANSLATION_INVALID_LBA);
+        POS_TRACE_ERROR(error, "{} partition detects invalid stripe range. startStripe:{}, stripeCnt:{}, totalStripes:{}",
+            PARTITION_TYPE_STR[type], startStripe, stripeCnt, logicalSize.totalStripes);
+        return error;
+    }
+
+    // Every stripe occupies the same lba range on all devices regardless of its parity location,
+    // so a run of consecutive stripes maps to one contiguous range per device
+    const uint32_t chunkSize = physicalSize.blksPerChunk;
+    const uint64_t startLba = physicalSize.startLba +
+        ((uint64_t)startStripe * chunkSize * ArrayConfig::SECTORS_PER_BLOCK);
+    for (ArrayDevice* dev : devs)
+    {
+        PhysicalEntry physicalEntry;
+        physicalEntry.addr = {
+            .lba = startLba,
+            .arrayDev = dev };
+        physicalEntry.blkCnt = chunkSize * stripeCnt;
+        pel.push_back(physicalEntry);
+    }
+    return 0;
+}
+
 RaidState
 StripePartition::GetRaidState(void)
 {
@@ -61,12 +61,16 @@ public:
     virtual int Create(uint64_t startLba, uint32_t segCnt, uint64_t totalNvmBlks);
     void RegisterService(IPartitionServices* svc) override;
     int Translate(list<PhysicalEntry>& pel, const LogicalEntry& le) override;
+    int TranslateForRead(list<PhysicalEntry>& pel, const LogicalEntry& le) override;
+    int TranslateForReadInPlace(PhysicalEntryArray& pea, const LogicalEntry& le) override;
     int GetParityList(list<PhysicalWriteEntry>& parity, const LogicalWriteEntry& src) override;
     int ByteTranslate(PhysicalByteAddr& dst, const LogicalByteAddr& src) override;
     int ByteConvert(list<PhysicalByteWriteEntry> &dst, const LogicalByteWriteEntry &src) override;
     bool IsByteAccessSupported(void) override;
+    int GetPhysicalRanges(list<PhysicalEntry>& pel, StripeId startStripe, uint32_t stripeCnt) override;
     RaidState GetRaidState(void) override;
     int GetRecoverMethod(UbioSmartPtr ubio, RecoverMethod& out) override;
+    int GetParityRecoverMethod(StripeId stripeId, RecoverMethod& out) override;
     unique_ptr<RebuildContext> GetRebuildCtx(const vector<IArrayDevice*>& fault) override;
     unique_ptr<RebuildContext> GetQuickRebuildCtx(const QuickRebuildPair& rebuildPair) override;
     Method* GetMethod(void) { return method; }
@@ -88,10 +92,14 @@ private:
         list<BufferEntry>& src, uint32_t start, uint32_t remain);
     int _SetPhysicalAddress(uint64_t startLba, uint32_t segCnt);
     void _SetLogicalAddress(void);
+    void _SetChunkLayout(void);
     int _SetMethod(uint64_t totalNvmBlks);
     list<PhysicalBlkAddr> _GetRebuildGroup(FtBlkAddr fba, const vector<uint32_t>& abnormals);
     RaidTypeEnum raidType;
     Method* method = nullptr;
+    // device index of each data chunk, for every stripe of a layout rotation
+    vector<uint32_t> chunkLayout;
+    uint32_t layoutRotation = 1;
     vector<uint32_t> _GetAbnormalDeviceIndex(void);
 };
 
@@ -47,5 +47,7 @@ class IIORecover
 {
 public:
     virtual int GetRecoverMethod(unsigned int arrayIndex, UbioSmartPtr ubio, RecoverMethod& out) = 0;
+    virtual int GetParityRecoverMethod(unsigned int arrayIndex, PartitionType part,
+        StripeId stripeId, RecoverMethod& out) = 0;
 };
 } // namespace pos
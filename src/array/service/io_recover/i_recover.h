@@ -48,5 +48,6 @@ public:
     }
 // LCOV_EXCL_END
     virtual int GetRecoverMethod(UbioSmartPtr ubio, RecoverMethod& out) = 0;
+    virtual int GetParityRecoverMethod(StripeId stripeId, RecoverMethod& out) = 0;
 };
 } // namespace pos
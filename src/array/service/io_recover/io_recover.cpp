@@ -105,4 +105,16 @@ IORecover::GetRecoverMethod(unsigned int arrayIndex, UbioSmartPtr ubio, RecoverM
     return ret;
 }
 
+int
+IORecover::GetParityRecoverMethod(unsigned int arrayIndex, PartitionType part,
+    StripeId stripeId, RecoverMethod& out)
+{
+    auto it = recoveries[arrayIndex].find(part);
+    if (it == recoveries[arrayIndex].end())
+    {
+        return EID(IO_RECOVER_NOT_FOUND);
+    }
+    return it->second->GetParityRecoverMethod(stripeId, out);
+}
+
 } // namespace pos
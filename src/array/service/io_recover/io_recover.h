@@ -53,6 +53,8 @@ public:
     IORecover(void);
     virtual ~IORecover(void);
     int GetRecoverMethod(unsigned int arrayIndex, UbioSmartPtr ubio, RecoverMethod& out) override;
+    int GetParityRecoverMethod(unsigned int arrayIndex, PartitionType part,
+        StripeId stripeId, RecoverMethod& out) override;
     bool Register(unsigned int arrayIndex, ArrayRecover recover);
     void Unregister(unsigned int arrayIndex);
 
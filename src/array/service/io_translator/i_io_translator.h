@@ -53,5 +53,22 @@ public:
         PhysicalByteAddr& dst, const LogicalByteAddr& src) = 0;
     virtual int ByteConvert(unsigned int arrayIndex, PartitionType part,
         list<PhysicalByteWriteEntry>& dst, const LogicalByteWriteEntry& src) = 0;
+    virtual int GetPhysicalRanges(unsigned int arrayIndex, PartitionType part,
+        list<PhysicalEntry>& pel, StripeId startStripe, uint32_t stripeCnt) = 0;
+    virtual int TranslateForRead(unsigned int arrayIndex, PartitionType part,
+        list<PhysicalEntry>& pel, const LogicalEntry& le) = 0;
+    // Same as TranslateForRead(), without allocating the entries
+    virtual int
+    TranslateForReadInPlace(unsigned int arrayIndex, PartitionType part,
+        PhysicalEntryArray& pea, const LogicalEntry& le)
+    {
+        list<PhysicalEntry> pel;
+        int ret = TranslateForRead(arrayIndex, part, pel, le);
+        if (ret == 0 && pea.Assign(pel) == false)
+        {
+            ret = -1;
+        }
+        return ret;
+    }
 };
 } // namespace pos
@@ -48,10 +48,25 @@ public:
     }
 // LCOV_EXCL_END
     virtual int Translate(list<PhysicalEntry>& pel, const LogicalEntry& le) = 0;
+    virtual int TranslateForRead(list<PhysicalEntry>& pel, const LogicalEntry& le) = 0;
+    // Same as TranslateForRead(), without allocating the entries
+    virtual int
+    TranslateForReadInPlace(PhysicalEntryArray& pea, const LogicalEntry& le)
+    {
+        list<PhysicalEntry> pel;
+        int ret = TranslateForRead(pel, le);
+        if (ret == 0 && pea.Assign(pel) == false)
+        {
+            ret = -1;
+        }
+        return ret;
+    }
     virtual int GetParityList(list<PhysicalWriteEntry>& parity, const LogicalWriteEntry& src) = 0;
     virtual int ByteTranslate(PhysicalByteAddr& dst, const LogicalByteAddr& src) = 0;
     virtual int ByteConvert(list<PhysicalByteWriteEntry>& dst,
         const LogicalByteWriteEntry& src) = 0;
     virtual bool IsByteAccessSupported(void) = 0;
+    virtual int GetPhysicalRanges(list<PhysicalEntry>& pel,
+        StripeId startStripe, uint32_t stripeCnt) = 0;
 };
 } // namespace pos
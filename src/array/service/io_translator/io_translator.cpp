@@ -38,6 +38,13 @@ namespace pos
 {
 IOTranslator::IOTranslator(void)
 {
+    for (int i = 0; i < ArrayMgmtPolicy::MAX_ARRAY_CNT; i++)
+    {
+        for (int part = 0; part < PartitionType::TYPE_COUNT; part++)
+        {
+            translatorTable[i][part] = nullptr;
+        }
+    }
 }
 
 IOTranslator::~IOTranslator(void)
@@ -68,6 +75,10 @@ IOTranslator::Register(unsigned int arrayIndex, ArrayTranslator trans)
             "IOTranslator::Register, array:{} size:{}",
             arrayIndex, trans.size());
         translators[arrayIndex] = trans;
+        for (auto translator : trans)
+        {
+            translatorTable[arrayIndex][translator.first] = translator.second;
+        }
         return true;
     }
     return false;
@@ -77,6 +88,10 @@ void
 IOTranslator::Unregister(unsigned int arrayIndex)
 {
     translators[arrayIndex].clear();
+    for (int part = 0; part < PartitionType::TYPE_COUNT; part++)
+    {
+        translatorTable[arrayIndex][part] = nullptr;
+    }
 }
 
 int
@@ -165,4 +180,52 @@ IOTranslator::ByteConvert(unsigned int arrayIndex, PartitionType part,
     return event;
 }
 
+int
+IOTranslator::GetPhysicalRanges(unsigned int arrayIndex, PartitionType part,
+    list<PhysicalEntry>& pel, StripeId startStripe, uint32_t stripeCnt)
+{
+    auto it = translators[arrayIndex].find(part);
+    if (it != translators[arrayIndex].end())
+    {
+        return it->second->GetPhysicalRanges(pel, startStripe, stripeCnt);
+    }
+
+    int event = EID(IO_TRANSLATOR_NOT_FOUND);
+    POS_TRACE_ERROR(event,
+        "IOTranslator::GetPhysicalRanges ERROR, array:{} part:{}", arrayIndex, part);
+    return event;
+}
+
+int
+IOTranslator::TranslateForRead(unsigned int arrayIndex, PartitionType part,
+    list<PhysicalEntry>& pel, const LogicalEntry& le)
+{
+    auto it = translators[arrayIndex].find(part);
+    if (it != translators[arrayIndex].end())
+    {
+        return it->second->TranslateForRead(pel, le);
+    }
+
+    int event = EID(IO_TRANSLATOR_NOT_FOUND);
+    POS_TRACE_ERROR(event,
+        "IOTranslator::TranslateForRead ERROR, array:{} part:{}", arrayIndex, part);
+    return event;
+}
+
+int
+IOTranslator::TranslateForReadInPlace(unsigned int arrayIndex, PartitionType part,
+    PhysicalEntryArray& pea, const LogicalEntry& le)
+{
+    ITranslator* translator = translatorTable[arrayIndex][part];
+    if (translator != nullptr)
+    {
+        return translator->TranslateForReadInPlace(pea, le);
+    }
+
+    int event = EID(IO_TRANSLATOR_NOT_FOUND);
+    POS_TRACE_ERROR(event,
+        "IOTranslator::TranslateForReadInPlace ERROR, array:{} part:{}", arrayIndex, part);
+    return event;
+}
+
 } // namespace pos
@@ -58,10 +58,18 @@ public:
         list<PhysicalWriteEntry>& parity, const LogicalWriteEntry& src) override;
     int ByteConvert(unsigned int arrayIndex, PartitionType part,
         list<PhysicalByteWriteEntry>& dst, const LogicalByteWriteEntry& src) override;
+    int GetPhysicalRanges(unsigned int arrayIndex, PartitionType part,
+        list<PhysicalEntry>& pel, StripeId startStripe, uint32_t stripeCnt) override;
+    int TranslateForRead(unsigned int arrayIndex, PartitionType part,
+        list<PhysicalEntry>& pel, const LogicalEntry& le) override;
+    int TranslateForReadInPlace(unsigned int arrayIndex, PartitionType part,
+        PhysicalEntryArray& pea, const LogicalEntry& le) override;
     bool Register(unsigned int arrayIndex, ArrayTranslator trans);
     void Unregister(unsigned int arrayIndex);
 
 private:
     ArrayTranslator translators[ArrayMgmtPolicy::MAX_ARRAY_CNT];
+    // the same translators indexed by partition, to find one without a map lookup
+    ITranslator* translatorTable[ArrayMgmtPolicy::MAX_ARRAY_CNT][PartitionType::TYPE_COUNT];
 };
 } // namespace pos
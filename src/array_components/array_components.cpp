@@ -35,6 +35,13 @@
 #include "src/array_components/array_mount_sequence.h"
 #include "src/include/array_mgmt_policy.h"
 #include "src/io/general_io/rba_state_manager.h"
+#include "src/io/general_io/write_amplification_monitor.h"
+#include "src/io/frontend_io/access_heatmap.h"
+#include "src/io/frontend_io/compression_estimator.h"
+#include "src/io/frontend_io/dedup_estimator.h"
+#include "src/io/frontend_io/partial_write_coalescer.h"
+#include "src/io/frontend_io/read_cache.h"
+#include "src/io/frontend_io/write_buffer_zero_copy.h"
 #include "src/logger/logger.h"
 #include "src/metafs/include/metafs_service.h"
 #include "src/metafs/metafs.h"
@@ -279,6 +286,7 @@ void
 ArrayComponents::_SetMountSequence(void)
 {
     mountSequence.push_back(array);
+    mountSequence.push_back(writeAmplificationMonitor);
     mountSequence.push_back(nvmf);
     mountSequence.push_back(metafs);
     mountSequence.push_back(volMgr);
@@ -288,6 +296,12 @@ ArrayComponents::_SetMountSequence(void)
     mountSequence.push_back(meta);
     mountSequence.push_back(rbaStateMgr);
     mountSequence.push_back(flowControl);
+    mountSequence.push_back(readCache);
+    mountSequence.push_back(partialWriteCoalescer);
+    mountSequence.push_back(writeBufferZeroCopy);
+    mountSequence.push_back(compressionEstimator);
+    mountSequence.push_back(dedupEstimator);
+    mountSequence.push_back(accessHeatmap);
     mountSequence.push_back(gc);
     mountSequence.push_back(smartLogMetaIo);
 
@@ -297,6 +311,17 @@ ArrayComponents::_SetMountSequence(void)
         POS_TRACE_WARN(EID(ARRAY_COMPO_DEBUG_MSG), "Memory leakage found for ArrayMountSequence for " + arrayName);
     }
     arrayMountSequence = new ArrayMountSequence(mountSequence, state, arrayName, volMgr, arrayRebuilder);
+
+    // The smart log file is loaded while volumes and maps are, and the
+    // services on top of the metadata come up together once it is mounted
+    arrayMountSequence->SetDependency(smartLogMetaIo, {metafs});
+    vector<IMountSequence*> metaServices = {flowControl, readCache, partialWriteCoalescer,
+        writeBufferZeroCopy, compressionEstimator, dedupEstimator, accessHeatmap};
+    for (IMountSequence* service : metaServices)
+    {
+        arrayMountSequence->SetDependency(service, {meta, rbaStateMgr});
+    }
+    arrayMountSequence->SetDependency(gc, metaServices);
 }
 
 void
@@ -311,6 +336,13 @@ ArrayComponents::_InstantiateMetaComponentsAndMountSequenceInOrder(bool isArrayL
         || meta != nullptr
         || rbaStateMgr != nullptr
         || flowControl != nullptr
+        || readCache != nullptr
+        || partialWriteCoalescer != nullptr
+        || writeBufferZeroCopy != nullptr
+        || compressionEstimator != nullptr
+        || dedupEstimator != nullptr
+        || accessHeatmap != nullptr
+        || writeAmplificationMonitor != nullptr
         || gc != nullptr
         || info != nullptr
         || smartLogMetaIo != nullptr
@@ -330,6 +362,13 @@ ArrayComponents::_InstantiateMetaComponentsAndMountSequenceInOrder(bool isArrayL
     meta = new Metadata(array, state);
     rbaStateMgr = new RBAStateManager(array->GetName(), array->GetIndex());
     flowControl = new FlowControl(array);
+    readCache = new ReadCache(array);
+    partialWriteCoalescer = new PartialWriteCoalescer(array);
+    writeBufferZeroCopy = new WriteBufferZeroCopy(array);
+    compressionEstimator = new CompressionEstimator(array);
+    dedupEstimator = new DedupEstimator(array);
+    accessHeatmap = new AccessHeatmap(array);
+    writeAmplificationMonitor = new WriteAmplificationMonitor(array);
     gc = new GarbageCollector(array, state);
     smartLogMetaIo = new SmartLogMetaIo(array->GetIndex(), SmartLogMgrSingleton::Instance());
     info = new ComponentsInfo(array, gc);
@@ -360,6 +399,55 @@ ArrayComponents::_DestructMetaComponentsInOrder(void)
         POS_TRACE_DEBUG(EID(ARRAY_COMPO_DEBUG_MSG), "FlowControl for {} has been deleted.", arrayName);
     }
 
+    if (writeAmplificationMonitor != nullptr)
+    {
+        delete writeAmplificationMonitor;
+        writeAmplificationMonitor = nullptr;
+        POS_TRACE_DEBUG(EID(ARRAY_COMPO_DEBUG_MSG), "WriteAmplificationMonitor for {} has been deleted.", arrayName);
+    }
+
+    if (accessHeatmap != nullptr)
+    {
+        delete accessHeatmap;
+        accessHeatmap = nullptr;
+        POS_TRACE_DEBUG(EID(ARRAY_COMPO_DEBUG_MSG), "AccessHeatmap for {} has been deleted.", arrayName);
+    }
+
+    if (dedupEstimator != nullptr)
+    {
+        delete dedupEstimator;
+        dedupEstimator = nullptr;
+        POS_TRACE_DEBUG(EID(ARRAY_COMPO_DEBUG_MSG), "DedupEstimator for {} has been deleted.", arrayName);
+    }
+
+    if (compressionEstimator != nullptr)
+    {
+        delete compressionEstimator;
+        compressionEstimator = nullptr;
+        POS_TRACE_DEBUG(EID(ARRAY_COMPO_DEBUG_MSG), "CompressionEstimator for {} has been deleted.", arrayName);
+    }
+
+    if (writeBufferZeroCopy != nullptr)
+    {
+        delete writeBufferZeroCopy;
+        writeBufferZeroCopy = nullptr;
+        POS_TRACE_DEBUG(EID(ARRAY_COMPO_DEBUG_MSG), "WriteBufferZeroCopy for {} has been deleted.", arrayName);
+    }
+
+    if (partialWriteCoalescer != nullptr)
+    {
+        delete partialWriteCoalescer;
+        partialWriteCoalescer = nullptr;
+        POS_TRACE_DEBUG(EID(ARRAY_COMPO_DEBUG_MSG), "PartialWriteCoalescer for {} has been deleted.", arrayName);
+    }
+
+    if (readCache != nullptr)
+    {
+        delete readCache;
+        readCache = nullptr;
+        POS_TRACE_DEBUG(EID(ARRAY_COMPO_DEBUG_MSG), "ReadCache for {} has been deleted.", arrayName);
+    }
+
     if (rbaStateMgr != nullptr)
     {
         delete rbaStateMgr;
@@ -58,6 +58,13 @@ class IArrayInfo;
 class IArrayRebuilder;
 class ArrayMountSequence;
 class RBAStateManager;
+class AccessHeatmap;
+class WriteAmplificationMonitor;
+class CompressionEstimator;
+class DedupEstimator;
+class PartialWriteCoalescer;
+class WriteBufferZeroCopy;
+class ReadCache;
 class Metadata;
 
 class ArrayComponents
@@ -112,6 +119,13 @@ private:
     StateManager* stateMgr = nullptr;
     Array* array = nullptr;
     FlowControl* flowControl = nullptr;
+    ReadCache* readCache = nullptr;
+    PartialWriteCoalescer* partialWriteCoalescer = nullptr;
+    WriteBufferZeroCopy* writeBufferZeroCopy = nullptr;
+    CompressionEstimator* compressionEstimator = nullptr;
+    DedupEstimator* dedupEstimator = nullptr;
+    AccessHeatmap* accessHeatmap = nullptr;
+    WriteAmplificationMonitor* writeAmplificationMonitor = nullptr;
     GarbageCollector* gc = nullptr;
     Metadata* meta = nullptr;
     VolumeManager* volMgr = nullptr;
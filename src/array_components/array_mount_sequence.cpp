@@ -32,6 +32,8 @@
 
 #include "array_mount_sequence.h"
 
+#include "src/array_components/mount_dependency_graph.h"
+#include "src/array_components/mount_phase_recorder.h"
 #include "src/array_models/interface/i_mount_sequence.h"
 #include "src/include/pos_event_id.h"
 #include "src/logger/logger.h"
@@ -85,7 +87,6 @@ int
 ArrayMountSequence::Mount(void)
 {
     POS_TRACE_DEBUG(EID(MOUNT_ARRAY_DEBUG_MSG), "Entering ArrayMountSequence.Mount for {}", arrayName);
-    auto it = sequence.begin();
     int ret = EID(SUCCESS);
 
     StateContext* currState = state->GetState();
@@ -102,6 +103,7 @@ ArrayMountSequence::Mount(void)
         return ret;
     }
 
+    MountDependencyGraph graph;
     state->Invoke(mountState);
     bool res = _WaitState(mountState);
     if (res == false)
@@ -111,54 +113,39 @@ ArrayMountSequence::Mount(void)
         goto error;
     }
 
-    // mount array
-    POS_TRACE_DEBUG(EID(MOUNT_ARRAY_DEBUG_MSG), "Initializing the first mount sequence for {}", arrayName);
-    ret = (*it)->Init();
-    if (ret != 0)
-    {
-        goto error;
-    }
-    POS_TRACE_DEBUG(EID(MOUNT_ARRAY_DEBUG_MSG), "Initialized the first mount sequence for {}", arrayName);
-
-    // mount meta, gc
-    it++;
-    for (; it != sequence.end(); ++it)
-    {
-        POS_TRACE_DEBUG(EID(MOUNT_ARRAY_DEBUG_MSG), "Initializing one of the remaining sequences for {}", arrayName);
-        ret = (*it)->Init();
-        if (ret != EID(SUCCESS))
-        {
-            break;
-        }
-        POS_TRACE_DEBUG(EID(MOUNT_ARRAY_DEBUG_MSG), "Initialized the sequence for {}", arrayName);
-    }
-
+    // mount array, and then meta, gc as their dependencies allow
+    MountPhaseRecorderSingleton::Instance()->Begin(arrayName);
+    _BuildMountGraph(graph);
+    ret = graph.Run();
     if (ret != EID(SUCCESS))
     {
         goto error;
     }
+    _LogCriticalPath(graph);
     state->Invoke(normalState);
     state->Remove(mountState);
     POS_TRACE_DEBUG(EID(MOUNT_ARRAY_DEBUG_MSG), "Returning from ArrayMountSequence.Mount for {}", arrayName);
     return ret;
 
 error:
-    while (true)
     {
-        if (it != sequence.end())
+        // Rolled back in the reverse order of the start, the failed one included
+        vector<int> started = graph.GetStartedSteps();
+        for (auto it = started.rbegin(); it != started.rend(); ++it)
         {
-            (*it)->Dispose();
-            if (it == sequence.begin())
-            {
-                break;
-            }
-            --it;
+            sequence[*it]->Dispose();
         }
     }
     state->Remove(mountState);
     return ret;
 }
 
+void
+ArrayMountSequence::SetDependency(IMountSequence* seq, vector<IMountSequence*> dependsOn)
+{
+    dependencies[seq] = dependsOn;
+}
+
 int
 ArrayMountSequence::Unmount(void)
 {
@@ -258,6 +245,55 @@ ArrayMountSequence::StateChanged(StateContext* prev, StateContext* next)
     }
 }
 
+int
+ArrayMountSequence::_InitSequence(IMountSequence* seq)
+{
+    MountPhaseTimer timer(arrayName, MountPhaseRecorder::GetPhaseName(typeid(*seq)));
+    return seq->Init();
+}
+
+void
+ArrayMountSequence::_BuildMountGraph(MountDependencyGraph& graph)
+{
+    map<IMountSequence*, int> stepOf;
+    for (size_t index = 0; index < sequence.size(); index++)
+    {
+        IMountSequence* seq = sequence[index];
+        vector<int> dependsOn;
+        auto it = dependencies.find(seq);
+        if (it != dependencies.end())
+        {
+            for (IMountSequence* dep : it->second)
+            {
+                auto step = stepOf.find(dep);
+                if (step != stepOf.end())
+                {
+                    dependsOn.push_back(step->second);
+                }
+            }
+        }
+        else if (index > 0)
+        {
+            dependsOn.push_back(index - 1);
+        }
+        stepOf[seq] = graph.AddStep(MountPhaseRecorder::GetPhaseName(typeid(*seq)),
+            [this, seq](void) { return _InitSequence(seq); }, dependsOn);
+    }
+}
+
+void
+ArrayMountSequence::_LogCriticalPath(MountDependencyGraph& graph)
+{
+    uint64_t elapsedUs = 0;
+    string path = "";
+    for (string& phase : graph.GetCriticalPath(elapsedUs))
+    {
+        path += (path.empty() ? "" : " -> ") + phase;
+    }
+    POS_TRACE_INFO(EID(MOUNT_ARRAY_DEBUG_MSG), "mount critical path, array_name:{}, path:{}, elapsed_us:{}",
+        arrayName, path, elapsedUs);
+}
+
 bool
 ArrayMountSequence::_WaitState(StateContext* goal)
 {
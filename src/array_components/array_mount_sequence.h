@@ -39,6 +39,7 @@
 
 #include <vector>
 #include <string>
+#include <map>
 #include <mutex>
 #include <condition_variable>
 
@@ -48,6 +49,7 @@ namespace pos
 {
 class IMountSequence;
 class IVolumeManager;
+class MountDependencyGraph;
 
 class ArrayMountSequence : public IStateObserver
 {
@@ -67,13 +69,20 @@ public:
     virtual int Unmount(void);
     virtual void Shutdown(void);
     virtual void StateChanged(StateContext* prev, StateContext* next) override;
+    // seq is initialized as soon as every sequence in dependsOn is.
+    // A sequence without one waits for the sequence before it
+    virtual void SetDependency(IMountSequence* seq, vector<IMountSequence*> dependsOn);
 
 private:
     bool _WaitState(StateContext* goal);
+    int _InitSequence(IMountSequence* seq);
+    void _BuildMountGraph(MountDependencyGraph& graph);
+    void _LogCriticalPath(MountDependencyGraph& graph);
     void _FlushMountSequence(void);
 
     IStateControl* state = nullptr;
     vector<IMountSequence*> sequence;
+    map<IMountSequence*, vector<IMountSequence*>> dependencies;
     StateContext* mountState = nullptr;
     StateContext* unmountState = nullptr;
     StateContext* normalState = nullptr;
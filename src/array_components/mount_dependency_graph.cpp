@@ -0,0 +1,200 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/array_components/mount_dependency_graph.h"
+
+#include <chrono>
+#include <thread>
+
+#include "src/include/pos_event_id.h"
+
+namespace pos
+{
+MountDependencyGraph::~MountDependencyGraph(void)
+{
+}
+
+int
+MountDependencyGraph::AddStep(const std::string& name, Step step, const std::vector<int>& dependsOn)
+{
+    Node node;
+    node.name = name;
+    node.step = step;
+    for (int dep : dependsOn)
+    {
+        if (0 <= dep && dep < static_cast<int>(nodes.size()))
+        {
+            node.dependsOn.push_back(dep);
+        }
+    }
+    nodes.push_back(node);
+    return nodes.size() - 1;
+}
+
+int
+MountDependencyGraph::Run(void)
+{
+    std::vector<std::thread> workers;
+    std::unique_lock<std::mutex> lock(nodeLock);
+    result = EID(SUCCESS);
+
+    while (true)
+    {
+        std::vector<int> readySteps;
+        if (result == EID(SUCCESS))
+        {
+            readySteps = _StartReadySteps();
+        }
+
+        if (readySteps.size() == 1 && numRunning == 1)
+        {
+            // Nothing to overlap with, so the step runs on this thread
+            lock.unlock();
+            _RunStep(readySteps.front());
+            lock.lock();
+            continue;
+        }
+        for (int index : readySteps)
+        {
+            workers.emplace_back(&MountDependencyGraph::_RunStep, this, index);
+        }
+
+        if (numRunning == 0)
+        {
+            break;
+        }
+        uint64_t completed = numCompleted;
+        stepDone.wait(lock, [&] { return numCompleted != completed; });
+    }
+    lock.unlock();
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+    return result;
+}
+
+std::vector<int>
+MountDependencyGraph::GetStartedSteps(void)
+{
+    std::lock_guard<std::mutex> lock(nodeLock);
+    return startedSteps;
+}
+
+std::vector<std::string>
+MountDependencyGraph::GetCriticalPath(uint64_t& elapsedUs)
+{
+    std::lock_guard<std::mutex> lock(nodeLock);
+    std::vector<uint64_t> pathUs(nodes.size(), 0);
+    std::vector<int> prev(nodes.size(), -1);
+    int last = -1;
+
+    // Dependencies always precede a step, so one pass in order is enough
+    for (int index = 0; index < static_cast<int>(nodes.size()); index++)
+    {
+        if (nodes[index].done == false)
+        {
+            continue;
+        }
+        for (int dep : nodes[index].dependsOn)
+        {
+            if (pathUs[dep] > pathUs[index])
+            {
+                pathUs[index] = pathUs[dep];
+                prev[index] = dep;
+            }
+        }
+        pathUs[index] += nodes[index].elapsedUs;
+        if (last < 0 || pathUs[index] > pathUs[last])
+        {
+            last = index;
+        }
+    }
+
+    std::vector<std::string> path;
+    elapsedUs = (last < 0) ? 0 : pathUs[last];
+    for (int index = last; index >= 0; index = prev[index])
+    {
+        path.insert(path.begin(), nodes[index].name);
+    }
+    return path;
+}
+
+std::vector<int>
+MountDependencyGraph::_StartReadySteps(void)
+{
+    std::vector<int> readySteps;
+    for (int index = 0; index < static_cast<int>(nodes.size()); index++)
+    {
+        Node& node = nodes[index];
+        if (node.started == true)
+        {
+            continue;
+        }
+        bool ready = true;
+        for (int dep : node.dependsOn)
+        {
+            ready = ready && nodes[dep].done;
+        }
+        if (ready == true)
+        {
+            node.started = true;
+            startedSteps.push_back(index);
+            numRunning++;
+            readySteps.push_back(index);
+        }
+    }
+    return readySteps;
+}
+
+void
+MountDependencyGraph::_RunStep(int index)
+{
+    auto start = std::chrono::steady_clock::now();
+    int ret = nodes[index].step();
+    uint64_t elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+
+    std::lock_guard<std::mutex> lock(nodeLock);
+    nodes[index].done = (ret == EID(SUCCESS));
+    nodes[index].elapsedUs = elapsedUs;
+    if (ret != EID(SUCCESS) && result == EID(SUCCESS))
+    {
+        result = ret;
+    }
+    numRunning--;
+    numCompleted++;
+    stepDone.notify_all();
+}
+
+} // namespace pos
@@ -0,0 +1,86 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace pos
+{
+// Runs the steps of a mount as a dependency graph. A step starts once every
+// step it depends on has succeeded, so the steps that do not depend on each
+// other run in parallel. After the first failure no more steps are started.
+class MountDependencyGraph
+{
+public:
+    using Step = std::function<int(void)>;
+
+    MountDependencyGraph(void) = default;
+    virtual ~MountDependencyGraph(void);
+
+    // A step may only depend on the steps added before it
+    virtual int AddStep(const std::string& name, Step step, const std::vector<int>& dependsOn);
+    virtual int Run(void);
+    // In the order they were started, including the one which failed
+    virtual std::vector<int> GetStartedSteps(void);
+    // The chain of steps which bounded the total time of the last run
+    virtual std::vector<std::string> GetCriticalPath(uint64_t& elapsedUs);
+
+private:
+    struct Node
+    {
+        std::string name;
+        Step step;
+        std::vector<int> dependsOn;
+        bool started = false;
+        bool done = false;
+        uint64_t elapsedUs = 0;
+    };
+
+    std::vector<int> _StartReadySteps(void);
+    void _RunStep(int index);
+
+    std::vector<Node> nodes;
+    std::vector<int> startedSteps;
+    int result = 0;
+    int numRunning = 0;
+    uint64_t numCompleted = 0;
+    std::mutex nodeLock;
+    std::condition_variable stepDone;
+};
+
+} // namespace pos
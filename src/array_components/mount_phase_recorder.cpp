@@ -0,0 +1,110 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/array_components/mount_phase_recorder.h"
+
+#include <cxxabi.h>
+
+#include <cstdlib>
+
+#include "src/include/pos_event_id.h"
+#include "src/logger/logger.h"
+#include "src/telemetry/telemetry_client/easy_telemetry_publisher.h"
+#include "src/telemetry/telemetry_id.h"
+
+namespace pos
+{
+MountPhaseRecorder::MountPhaseRecorder(EasyTelemetryPublisher* telemetryPublisher)
+: telemetryPublisher(telemetryPublisher)
+{
+    if (nullptr == this->telemetryPublisher)
+    {
+        this->telemetryPublisher = EasyTelemetryPublisherSingleton::Instance();
+    }
+}
+
+MountPhaseRecorder::~MountPhaseRecorder(void)
+{
+}
+
+void
+MountPhaseRecorder::Begin(const std::string& arrayName)
+{
+    std::lock_guard<std::mutex> lock(phaseLock);
+    phases[arrayName].clear();
+}
+
+void
+MountPhaseRecorder::Record(const std::string& arrayName, const std::string& phase, uint64_t elapsedUs)
+{
+    {
+        std::lock_guard<std::mutex> lock(phaseLock);
+        phases[arrayName].push_back({phase, elapsedUs});
+    }
+    POS_TRACE_INFO(EID(MOUNT_ARRAY_DEBUG_MSG), "mount phase done, array_name:{}, phase:{}, elapsed_us:{}",
+        arrayName, phase, elapsedUs);
+
+    VectorLabels labels;
+    labels.push_back({"array_name", arrayName});
+    labels.push_back({"phase", phase});
+    telemetryPublisher->UpdateGauge(TEL60011_ARRAY_MOUNT_PHASE_TIME_US, elapsedUs, labels);
+}
+
+MountPhaseList
+MountPhaseRecorder::GetPhases(const std::string& arrayName)
+{
+    std::lock_guard<std::mutex> lock(phaseLock);
+    auto it = phases.find(arrayName);
+    if (it == phases.end())
+    {
+        return MountPhaseList();
+    }
+    return it->second;
+}
+
+std::string
+MountPhaseRecorder::GetPhaseName(const std::type_info& type)
+{
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(type.name(), nullptr, nullptr, &status);
+    std::string name = (status == 0 && demangled != nullptr) ? demangled : type.name();
+    std::free(demangled);
+
+    const std::string NAMESPACE_PREFIX = "pos::";
+    if (name.compare(0, NAMESPACE_PREFIX.size(), NAMESPACE_PREFIX) == 0)
+    {
+        name = name.substr(NAMESPACE_PREFIX.size());
+    }
+    return name;
+}
+
+} // namespace pos
@@ -0,0 +1,101 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include "src/lib/singleton.h"
+
+namespace pos
+{
+class EasyTelemetryPublisher;
+
+using MountPhaseList = std::vector<std::pair<std::string, uint64_t>>;
+
+// Keeps how long each phase of the last mount of an array took, in the order
+// the phases ran. Phases are the mount sequences of the array and the steps of
+// the metadata mount (map load, allocator load, journal replay).
+class MountPhaseRecorder
+{
+public:
+    explicit MountPhaseRecorder(EasyTelemetryPublisher* telemetryPublisher = nullptr);
+    virtual ~MountPhaseRecorder(void);
+
+    virtual void Begin(const std::string& arrayName);
+    virtual void Record(const std::string& arrayName, const std::string& phase, uint64_t elapsedUs);
+    virtual MountPhaseList GetPhases(const std::string& arrayName);
+
+    static std::string GetPhaseName(const std::type_info& type);
+
+private:
+    std::map<std::string, MountPhaseList> phases;
+    std::mutex phaseLock;
+    EasyTelemetryPublisher* telemetryPublisher;
+};
+
+using MountPhaseRecorderSingleton = Singleton<MountPhaseRecorder>;
+
+// Records the time from its construction to its destruction as a mount phase
+class MountPhaseTimer
+{
+public:
+    MountPhaseTimer(const std::string& arrayName, const std::string& phase,
+        MountPhaseRecorder* recorder = MountPhaseRecorderSingleton::Instance())
+    : arrayName(arrayName),
+      phase(phase),
+      recorder(recorder),
+      start(std::chrono::steady_clock::now())
+    {
+    }
+    ~MountPhaseTimer(void)
+    {
+        uint64_t elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start).count();
+        recorder->Record(arrayName, phase, elapsedUs);
+    }
+
+private:
+    std::string arrayName;
+    std::string phase;
+    MountPhaseRecorder* recorder;
+    std::chrono::steady_clock::time_point start;
+};
+
+} // namespace pos
@@ -42,6 +42,7 @@ enum FlushState
     FLUSH__VSAMAP,
     FLUSH__STRIPEMAP_ALLOCATOR,
     FLUSH__META_FLUSH_IN_PROGRESS,
+    FLUSH__WRITE_SEQUENCE_SEALED,
 };
 
 } // namespace pos
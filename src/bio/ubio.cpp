@@ -34,8 +34,10 @@
 
 #include <air/Air.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <sstream>
 #include <string>
 
@@ -75,6 +77,12 @@ Ubio::Ubio(void* buffer, uint32_t unitCount, int arrayID)
     airlog("Ubio_Constructor", "internal", GetEventType(), 1);
 }
 
+Ubio::Ubio(const std::vector<struct iovec>& ioVectors, int arrayID)
+: Ubio(ioVectors.front().iov_base, _GetUnitCount(ioVectors), arrayID)
+{
+    this->ioVectors = ioVectors;
+}
+
 Ubio::Ubio(const Ubio& ubio)
 : dataBuffer(ubio.dataBuffer),
   callback(nullptr),
@@ -86,7 +94,8 @@ Ubio::Ubio(const Ubio& ubio)
   uBlock(nullptr),
   arrayDev(nullptr),
   arrayId(ubio.arrayId),
-  originCore(INVALID_CORE)
+  originCore(INVALID_CORE),
+  ioVectors(ubio.ioVectors)
 {
     dir = ubio.dir;
     SetAsyncMode();
@@ -223,15 +232,75 @@ Ubio::SetOriginCore(uint32_t inputOriginCore)
 void*
 Ubio::GetBuffer(uint32_t blockIndex, uint32_t sectorOffset) const
 {
-    return dataBuffer.GetAddress(blockIndex, sectorOffset);
+    if (likely(ioVectors.empty()))
+    {
+        return dataBuffer.GetAddress(blockIndex, sectorOffset);
+    }
+
+    uint64_t shiftSize = ChangeBlockToByte(blockIndex) +
+        ChangeSectorToByte(sectorOffset);
+    for (auto& ioVector : ioVectors)
+    {
+        if (shiftSize < ioVector.iov_len)
+        {
+            return static_cast<uint8_t*>(ioVector.iov_base) + shiftSize;
+        }
+        shiftSize -= ioVector.iov_len;
+    }
+
+    POS_TRACE_ERROR(EID(UBIO_REQUEST_OUT_RANGE),
+        "Requested buffer of vectored Ubio is out of range, blkIdx:{}, offset:{}",
+        blockIndex, sectorOffset);
+    return dataBuffer.GetBaseAddress();
 }
 
 void*
 Ubio::GetWholeBuffer(void) const
 {
+    if (unlikely(IsVectored()))
+    {
+        return ioVectors.front().iov_base;
+    }
     return dataBuffer.GetBaseAddress();
 }
 
+bool
+Ubio::IsVectored(void) const
+{
+    return (ioVectors.empty() == false);
+}
+
+const std::vector<struct iovec>&
+Ubio::GetIoVectors(void) const
+{
+    return ioVectors;
+}
+
+void
+Ubio::FillZero(void)
+{
+    if (unlikely(IsVectored()))
+    {
+        for (auto& ioVector : ioVectors)
+        {
+            memset(ioVector.iov_base, 0, ioVector.iov_len);
+        }
+        return;
+    }
+    memset(GetBuffer(), 0, GetSize());
+}
+
+uint32_t
+Ubio::_GetUnitCount(const std::vector<struct iovec>& ioVectors)
+{
+    uint64_t size = 0;
+    for (auto& ioVector : ioVectors)
+    {
+        size += ioVector.iov_len;
+    }
+    return size / BYTES_PER_UNIT;
+}
+
 uint64_t
 Ubio::GetSize(void)
 {
@@ -300,6 +369,42 @@ Ubio::_ReflectSplit(UbioSmartPtr newUbio, uint32_t sectors,
 
     newUbio->dataBuffer.Remove(remainingSize, !removalFromTail);
     dataBuffer.Remove(removalSize, removalFromTail);
+
+    if (unlikely(IsVectored()))
+    {
+        // Both parts keep pointing into the host buffers, each with the
+        // vectors that cover its own byte range
+        uint64_t newOffset = removalFromTail ? remainingSize : 0;
+        uint64_t keptOffset = removalFromTail ? 0 : removalSize;
+        newUbio->ioVectors = _SliceIoVectors(ioVectors, newOffset, removalSize);
+        ioVectors = _SliceIoVectors(ioVectors, keptOffset, remainingSize);
+    }
+}
+
+std::vector<struct iovec>
+Ubio::_SliceIoVectors(const std::vector<struct iovec>& ioVectors,
+    uint64_t offset, uint64_t size)
+{
+    std::vector<struct iovec> slice;
+    for (auto& ioVector : ioVectors)
+    {
+        if (0 == size)
+        {
+            break;
+        }
+        if (offset >= ioVector.iov_len)
+        {
+            offset -= ioVector.iov_len;
+            continue;
+        }
+
+        uint64_t length = std::min<uint64_t>(ioVector.iov_len - offset, size);
+        slice.push_back({.iov_base = static_cast<uint8_t*>(ioVector.iov_base) + offset,
+            .iov_len = length});
+        size -= length;
+        offset = 0;
+    }
+    return slice;
 }
 
 UBlockDevice*
@@ -308,6 +413,12 @@ Ubio::GetUBlock(void)
     return uBlock.get();
 }
 
+UblockSharedPtr
+Ubio::GetUBlockSharedPtr(void)
+{
+    return uBlock;
+}
+
 IArrayDevice*
 Ubio::GetArrayDev(void)
 {
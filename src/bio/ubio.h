@@ -66,7 +66,8 @@ enum class UbioDir
     Abort,
     NvmeCli,
     AdminPassTh,
-    GetLogPage
+    GetLogPage,
+    Copy
 };
 
 struct DeviceLba;
@@ -83,6 +84,8 @@ public:
     Ubio(void) = delete;
     Ubio(const Ubio& ubio);
     Ubio(void* buffer, uint32_t unitCount, int arrayID);
+    // Ubio of scattered buffers which is submitted to the device as a single command
+    Ubio(const std::vector<struct iovec>& ioVectors, int arrayID);
     virtual ~Ubio(void);
 
     static const uint32_t BYTES_PER_UNIT = SECTOR_SIZE;
@@ -95,6 +98,10 @@ public:
     void MarkDone(void);
     void* GetBuffer(uint32_t blockIndex = 0, uint32_t sectorOffset = 0) const;
     virtual void* GetWholeBuffer(void) const;
+    bool IsVectored(void) const;
+    const std::vector<struct iovec>& GetIoVectors(void) const;
+    // Zero-fills the whole data range, every scattered buffer included
+    void FillZero(void);
     virtual void WaitDone(void);
 
     virtual void Complete(IOErrorType error);
@@ -109,6 +116,7 @@ public:
     virtual void ClearCallback(void);
 
     virtual UBlockDevice* GetUBlock(void);
+    UblockSharedPtr GetUBlockSharedPtr(void);
     virtual IArrayDevice* GetArrayDev(void);
     uint64_t GetLba(void);
     const PhysicalBlkAddr GetPba(void);
@@ -159,7 +167,11 @@ private:
     int arrayId;
     std::string arrayName;
     uint32_t originCore;
+    std::vector<struct iovec> ioVectors;
 
+    static uint32_t _GetUnitCount(const std::vector<struct iovec>& ioVectors);
+    static std::vector<struct iovec> _SliceIoVectors(const std::vector<struct iovec>& ioVectors,
+        uint64_t offset, uint64_t size);
     bool CheckOriginUbioSet(void);
     void Advance(uint32_t sectors);
     void Retreat(uint32_t sectors);
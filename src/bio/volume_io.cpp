@@ -64,6 +64,7 @@ VolumeIo::VolumeIo(void* buffer, uint32_t unitCount, int arrayId, IVolumeInfoMan
   vsa(INVALID_VSA),
   sectorRba(INVALID_RBA),
   stripeId(UNMAP_STRIPE),
+  writeStream(WRITE_STREAM_MIXED),
   volumeManager(inputVolumeManager)
 {
     if (nullptr == volumeManager)
@@ -72,6 +73,20 @@ VolumeIo::VolumeIo(void* buffer, uint32_t unitCount, int arrayId, IVolumeInfoMan
     }
 }
 
+VolumeIo::VolumeIo(const std::vector<struct iovec>& ioVectors, int arrayId)
+: Ubio(ioVectors, arrayId),
+  volumeId(MAX_VOLUME_COUNT),
+  originCore(EventFrameworkApiSingleton::Instance()->GetCurrentReactor()),
+  lsidEntry(INVALID_LSID_ENTRY),
+  oldLsidEntry(INVALID_LSID_ENTRY),
+  vsa(INVALID_VSA),
+  sectorRba(INVALID_RBA),
+  stripeId(UNMAP_STRIPE),
+  writeStream(WRITE_STREAM_MIXED),
+  volumeManager(VolumeServiceSingleton::Instance()->GetVolumeManager(arrayId))
+{
+}
+
 VolumeIo::VolumeIo(const VolumeIo& volumeIo)
 : Ubio(volumeIo),
   volumeId(volumeIo.volumeId),
@@ -81,7 +96,9 @@ VolumeIo::VolumeIo(const VolumeIo& volumeIo)
   vsa(INVALID_VSA),
   sectorRba(volumeIo.sectorRba),
   stripeId(UNMAP_STRIPE),
-  volumeManager(volumeIo.volumeManager)
+  writeStream(volumeIo.writeStream),
+  volumeManager(volumeIo.volumeManager),
+  stageTrace(volumeIo.stageTrace)
 {
 }
 
@@ -107,6 +124,18 @@ VolumeIo::Split(uint32_t sectors, bool removalFromTail)
     return newVolumeIo;
 }
 
+void
+VolumeIo::SetStageTrace(IoStageTraceSmartPtr trace)
+{
+    stageTrace = trace;
+}
+
+IoStageTraceSmartPtr
+VolumeIo::GetStageTrace(void)
+{
+    return stageTrace;
+}
+
 VolumeIoSmartPtr
 VolumeIo::GetOriginVolumeIo(void)
 {
@@ -368,4 +397,16 @@ VolumeIo::GetUserLsid(void)
     return stripeId;
 }
 
+void
+VolumeIo::SetWriteStream(WriteStreamType stream)
+{
+    writeStream = stream;
+}
+
+WriteStreamType
+VolumeIo::GetWriteStream(void)
+{
+    return writeStream;
+}
+
 } // namespace pos
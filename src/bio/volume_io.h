@@ -37,8 +37,11 @@
 #include <vector>
 
 #include "src/volume/i_volume_info_manager.h"
+#include "src/allocator/include/allocator_const.h"
 #include "src/bio/ubio.h"
+#include "src/include/branch_prediction.h"
 #include "src/include/smart_ptr_type.h"
+#include "src/trace/io_stage_trace.h"
 
 struct pos_io;
 
@@ -73,6 +76,8 @@ public:
     VolumeIo(void) = delete;
     VolumeIo(void* buffer, uint32_t unitCount, int arrayId);
     VolumeIo(void* buffer, uint32_t unitCount, int arrayId, IVolumeInfoManager* volumeManager);
+    // VolumeIo of the scattered host buffers of one request
+    VolumeIo(const std::vector<struct iovec>& ioVectors, int arrayId);
     VolumeIo(const VolumeIo& volumeIo);
     ~VolumeIo(void) override;
 
@@ -92,6 +97,19 @@ public:
     virtual uint64_t GetSectorRba(void);
     void SetUserLsid(StripeId stripeId);
     virtual StripeId GetUserLsid(void);
+    void SetWriteStream(WriteStreamType stream);
+    WriteStreamType GetWriteStream(void);
+    void SetStageTrace(IoStageTraceSmartPtr trace);
+    IoStageTraceSmartPtr GetStageTrace(void);
+
+    inline void
+    MarkStage(IoStage stage)
+    {
+        if (unlikely(stageTrace != nullptr))
+        {
+            stageTrace->Mark(stage);
+        }
+    }
 
 private:
     static const StripeAddr INVALID_LSID_ENTRY;
@@ -105,7 +123,10 @@ private:
     VirtualBlkAddr vsa;
     uint64_t sectorRba;
     StripeId stripeId;
+    WriteStreamType writeStream;
     IVolumeInfoManager* volumeManager;
+    // only for the sampled I/Os, shared with the split VolumeIos
+    IoStageTraceSmartPtr stageTrace;
 
     bool _IsInvalidVolumeId(uint32_t inputVolumeId);
     virtual bool _IsInvalidLsidEntry(StripeAddr& inputLsidEntry);
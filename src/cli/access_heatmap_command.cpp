@@ -0,0 +1,123 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/cli/access_heatmap_command.h"
+
+#include "src/array_mgmt/array_manager.h"
+#include "src/cli/cli_event_code.h"
+#include "src/io/frontend_io/access_heatmap.h"
+#include "src/io/frontend_io/access_heatmap_service.h"
+#include "src/volume/volume_service.h"
+
+namespace pos_cli
+{
+AccessHeatmapCommand::AccessHeatmapCommand(void)
+{
+}
+
+// Exclude destructor of abstract class from function coverage report to avoid known issues in gcc/gcov
+// LCOV_EXCL_START
+AccessHeatmapCommand::~AccessHeatmapCommand(void)
+{
+}
+// LCOV_EXCL_STOP
+
+string
+AccessHeatmapCommand::Execute(json& doc, string rid)
+{
+    string arrayName = DEFAULT_ARRAY_NAME;
+    if (doc["param"].contains("array") == true)
+    {
+        arrayName = doc["param"]["array"].get<std::string>();
+    }
+
+    JsonFormat jFormat;
+    ComponentsInfo* info = ArrayMgr()->GetInfo(arrayName);
+    if (info == nullptr)
+    {
+        return jFormat.MakeResponse("ACCESSHEATMAP", rid, EID(ARRAY_MGR_NO_ARRAY_MATCHING_REQ_NAME),
+            "Array does not exist. array name: " + arrayName, GetPosInfo());
+    }
+
+    pos::AccessHeatmap* accessHeatmap =
+        pos::AccessHeatmapServiceSingleton::Instance()->GetAccessHeatmap(info->arrayInfo->GetIndex());
+    if (accessHeatmap == nullptr)
+    {
+        return jFormat.MakeResponse("ACCESSHEATMAP", rid, EID(ACCESS_HEATMAP_NOT_ENABLED),
+            "Access heatmap is not collected. array name: " + arrayName, GetPosInfo());
+    }
+
+    pos::IVolumeInfoManager* volMgr =
+        pos::VolumeServiceSingleton::Instance()->GetVolumeManager(arrayName);
+    uint64_t bucketSizeInMb = accessHeatmap->GetBucketSizeInMb();
+
+    JsonElement data("data");
+    data.SetAttribute(JsonAttribute("array", "\"" + arrayName + "\""));
+    data.SetAttribute(JsonAttribute("bucketSizeInMb", "\"" + to_string(bucketSizeInMb) + "\""));
+
+    JsonArray volumeList("volumeList");
+    for (uint32_t volumeId = 0; volumeId < MAX_VOLUME_COUNT; volumeId++)
+    {
+        std::vector<pos::AccessHeatmapBucket> hotBuckets = accessHeatmap->GetHotBuckets(volumeId);
+        if (hotBuckets.empty() == true)
+        {
+            continue;
+        }
+
+        JsonElement volumeElement("");
+        string volumeName = "";
+        if (volMgr != nullptr)
+        {
+            volMgr->GetVolumeName(volumeId, volumeName);
+        }
+        volumeElement.SetAttribute(JsonAttribute("id", static_cast<int>(volumeId)));
+        volumeElement.SetAttribute(JsonAttribute("name", "\"" + volumeName + "\""));
+
+        JsonArray bucketList("bucketList");
+        for (auto& hotBucket : hotBuckets)
+        {
+            JsonElement bucketElement("");
+            bucketElement.SetAttribute(JsonAttribute("offsetInMb",
+                "\"" + to_string(hotBucket.bucket * bucketSizeInMb) + "\""));
+            bucketElement.SetAttribute(JsonAttribute("read", "\"" + to_string(hotBucket.readCount) + "\""));
+            bucketElement.SetAttribute(JsonAttribute("write", "\"" + to_string(hotBucket.writeCount) + "\""));
+            bucketList.AddElement(bucketElement);
+        }
+        volumeElement.SetArray(bucketList);
+        volumeList.AddElement(volumeElement);
+    }
+    data.SetArray(volumeList);
+
+    return jFormat.MakeResponse("ACCESSHEATMAP", rid, SUCCESS,
+        "access heatmap of " + arrayName + " has been loaded successfully", data, GetPosInfo());
+}
+}; // namespace pos_cli
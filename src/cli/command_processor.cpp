@@ -3,6 +3,7 @@
 #include <spdk/nvme_spec.h>
 #include <sys/time.h>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -25,6 +26,7 @@
 #include "src/qos/qos_common.h"
 #include "src/qos/qos_manager.h"
 #include "src/resource_checker/smart_collector.h"
+#include "src/resource_checker/smart_sampler.h"
 #include "src/sys_info/space_info.h"
 #include "src/volume/volume_base.h"
 #include "src/volume/volume_manager.h"
@@ -1167,39 +1169,86 @@ CommandProcessor::ExecuteScanDeviceCommand(const ScanDeviceRequest* request, Sca
 grpc::Status
 CommandProcessor::ExecuteListDeviceCommand(const ListDeviceRequest* request, ListDeviceResponse* reply)
 {
-    reply->set_command(request->command());
-    reply->set_rid(request->rid());
+    vector<DeviceProperty> list =
+        DeviceManagerSingleton::Instance()->ListDevs();
+    size_t pos = 0;
+    if (false == _ParsePageToken(request->param().pagetoken(), pos))
+    {
+        reply->set_command(request->command());
+        reply->set_rid(request->rid());
+        _SetEventStatus(EID(CLI_LIST_INVALID_PAGE_TOKEN), reply->mutable_result()->mutable_status());
+        _SetPosInfo(reply->mutable_info());
+        return grpc::Status::OK;
+    }
+    _FillDevicePage(request, list, pos, request->param().pagesize(), reply);
+    return grpc::Status::OK;
+}
 
+grpc::Status
+CommandProcessor::ExecuteListDeviceStreamCommand(const ListDeviceRequest* request,
+    grpc::ServerWriter<ListDeviceResponse>* writer)
+{
+    // Every page is cut from the same copy of the device list
     vector<DeviceProperty> list =
         DeviceManagerSingleton::Instance()->ListDevs();
+    size_t pos = 0;
+    uint32_t pageSize = request->param().pagesize();
+    if (pageSize == 0)
+    {
+        pageSize = DEFAULT_LIST_PAGE_SIZE;
+    }
+
+    do
+    {
+        ListDeviceResponse reply;
+        _FillDevicePage(request, list, pos, pageSize, &reply);
+        if (false == writer->Write(reply))
+        {
+            return Status(StatusCode::CANCELLED, "the client stopped reading the device list");
+        }
+    } while (pos < list.size());
+
+    return grpc::Status::OK;
+}
+
+void
+CommandProcessor::_FillDevicePage(const ListDeviceRequest* request, const vector<DeviceProperty>& list,
+    size_t& pos, uint32_t pageSize, ListDeviceResponse* reply)
+{
+    reply->set_command(request->command());
+    reply->set_rid(request->rid());
 
     if (list.size() == 0)
     {
         POS_TRACE_INFO(EID(CLI_LIST_DEVICE_NO_DEVICE_FOUND), "");
         _SetEventStatus(EID(CLI_LIST_DEVICE_NO_DEVICE_FOUND), reply->mutable_result()->mutable_status());
         _SetPosInfo(reply->mutable_info());
-        return grpc::Status::OK;
+        return;
     }
 
-    for (size_t i = 0; i < list.size(); i++)
+    size_t end = (pageSize == 0) ? list.size() : std::min(list.size(), pos + pageSize);
+    for (; pos < end; pos++)
     {
         grpc_cli::Device* device =
             reply->mutable_result()->mutable_data()->add_devicelist();
-        device->set_name(list[i].name);
-        device->set_size(list[i].size);
-        device->set_modelnumber(list[i].mn);
-        device->set_serialnumber(list[i].sn);
-        device->set_type(list[i].GetType());
-        device->set_address(list[i].bdf);
-        device->set_class_(list[i].GetClass());
-
-        string numa = ((list[i].numa == UNKNOWN_NUMA_NODE) ? "UNKNOWN" : to_string(list[i].numa));
+        device->set_name(list[pos].name);
+        device->set_size(list[pos].size);
+        device->set_modelnumber(list[pos].mn);
+        device->set_serialnumber(list[pos].sn);
+        device->set_type(list[pos].GetType());
+        device->set_address(list[pos].bdf);
+        device->set_class_(list[pos].GetClass());
+
+        string numa = ((list[pos].numa == UNKNOWN_NUMA_NODE) ? "UNKNOWN" : to_string(list[pos].numa));
         device->set_numa(numa);
     }
+    if (pos < list.size())
+    {
+        reply->set_nextpagetoken(to_string(pos));
+    }
 
     _SetEventStatus(EID(SUCCESS), reply->mutable_result()->mutable_status());
     _SetPosInfo(reply->mutable_info());
-    return grpc::Status::OK;
 }
 
 grpc::Status
@@ -1230,8 +1279,12 @@ CommandProcessor::ExecuteGetSmartLogCommand(const GetSmartLogRequest* request, G
     }
 
     struct spdk_nvme_health_information_page payload = {};
-    SmartCollector* smartCollector = SmartCollectorSingleton::Instance();
-    SmartReturnType ret = smartCollector->CollectPerCtrl(&payload, ctrlr, SmartReqId::NVME_HEALTH_INFO);
+    SmartReturnType ret = SmartReturnType::SUCCESS;
+    if (false == SmartSamplerSingleton::Instance()->GetHealthPage(deviceName, payload))
+    {
+        SmartCollector* smartCollector = SmartCollectorSingleton::Instance();
+        ret = smartCollector->CollectPerCtrl(&payload, ctrlr, SmartReqId::NVME_HEALTH_INFO);
+    }
 
     if (ret != SmartReturnType::SUCCESS)
     {
@@ -1912,21 +1965,67 @@ CommandProcessor::ExecuteUnmountVolumeCommand(const UnmountVolumeRequest* reques
 
 grpc::Status CommandProcessor::ExecuteListVolumeCommand(const ListVolumeRequest* request, ListVolumeResponse* reply)
 {
-    string command = request->command();
-    string volumeName = "";
-    string arrayName = "";
+    IVolumeInfoManager* volMgr = nullptr;
+    int eventId = _GetVolumeManagerToList(request->param().array(), volMgr);
+    std::shared_ptr<const vector<int>> ids = std::make_shared<const vector<int>>();
+    if (volMgr != nullptr)
+    {
+        ids = volMgr->GetVolumeList()->GetIdSnapshot();
+    }
 
-    reply->set_command(command);
-    reply->set_rid(request->rid());
+    // The token is the id of the next volume, which stays valid however the
+    // list changes between the requests
+    size_t nextId = 0;
+    if (eventId == EID(SUCCESS) && false == _ParsePageToken(request->param().pagetoken(), nextId))
+    {
+        eventId = EID(CLI_LIST_INVALID_PAGE_TOKEN);
+    }
+    int startId = static_cast<int>(std::min<size_t>(nextId, MAX_VOLUME_COUNT));
+    size_t pos = std::lower_bound(ids->begin(), ids->end(), startId) - ids->begin();
+    _FillVolumePage(request, eventId, volMgr, *ids, pos, request->param().pagesize(), reply);
+    return grpc::Status::OK;
+}
 
-    arrayName = (request->param()).array();
+grpc::Status CommandProcessor::ExecuteListVolumeStreamCommand(const ListVolumeRequest* request,
+    grpc::ServerWriter<ListVolumeResponse>* writer)
+{
+    IVolumeInfoManager* volMgr = nullptr;
+    int eventId = _GetVolumeManagerToList(request->param().array(), volMgr);
+    // Every page is cut from the same id snapshot, so volumes created or
+    // deleted during the stream neither shift nor repeat the pages
+    std::shared_ptr<const vector<int>> ids = std::make_shared<const vector<int>>();
+    if (volMgr != nullptr)
+    {
+        ids = volMgr->GetVolumeList()->GetIdSnapshot();
+    }
+
+    size_t pos = 0;
+    uint32_t pageSize = request->param().pagesize();
+    if (pageSize == 0)
+    {
+        pageSize = DEFAULT_LIST_PAGE_SIZE;
+    }
+
+    do
+    {
+        ListVolumeResponse reply;
+        _FillVolumePage(request, eventId, volMgr, *ids, pos, pageSize, &reply);
+        if (false == writer->Write(reply))
+        {
+            return Status(StatusCode::CANCELLED, "the client stopped reading the volume list");
+        }
+    } while (eventId == EID(SUCCESS) && pos < ids->size());
+
+    return grpc::Status::OK;
+}
+
+int
+CommandProcessor::_GetVolumeManagerToList(const string& arrayName, IVolumeInfoManager*& volMgr)
+{
     ComponentsInfo* info = ArrayMgr()->GetInfo(arrayName);
     if (info == nullptr)
     {
-        int eventId = EID(LIST_VOL_ARRAY_NAME_DOES_NOT_EXIST);
-        _SetEventStatus(eventId, reply->mutable_result()->mutable_status());
-        _SetPosInfo(reply->mutable_info());
-        return grpc::Status::OK;
+        return EID(LIST_VOL_ARRAY_NAME_DOES_NOT_EXIST);
     }
     IArrayInfo* array = info->arrayInfo;
     ArrayStateType arrayState = array->GetState();
@@ -1934,61 +2033,82 @@ grpc::Status CommandProcessor::ExecuteListVolumeCommand(const ListVolumeRequest*
     {
         int eventId = EID(CLI_COMMAND_FAILURE_ARRAY_BROKEN);
         POS_TRACE_WARN(eventId, "arrayName: {}, arrayState: {}", arrayName, arrayState.ToString());
-        _SetEventStatus(eventId, reply->mutable_result()->mutable_status());
-        _SetPosInfo(reply->mutable_info());
-        return grpc::Status::OK;
+        return eventId;
     }
 
-
-    IVolumeInfoManager* volMgr = VolumeServiceSingleton::Instance()->GetVolumeManager(arrayName); 
-
-    int vol_cnt = 0;
-
+    volMgr = VolumeServiceSingleton::Instance()->GetVolumeManager(arrayName);
     if (volMgr == nullptr)
     {
         POS_TRACE_WARN(EID(VOL_NOT_FOUND), "The requested volume does not exist");
     }
-    else
+    return EID(SUCCESS);
+}
+
+void
+CommandProcessor::_FillVolumePage(const ListVolumeRequest* request, int eventId,
+    IVolumeInfoManager* volMgr, const vector<int>& ids, size_t& pos, uint32_t pageSize,
+    ListVolumeResponse* reply)
+{
+    reply->set_command(request->command());
+    reply->set_rid(request->rid());
+    if (eventId != EID(SUCCESS))
     {
-        vol_cnt = volMgr->GetVolumeCount();
+        _SetEventStatus(eventId, reply->mutable_result()->mutable_status());
+        _SetPosInfo(reply->mutable_info());
+        return;
     }
-    if (vol_cnt > 0)
+
+    size_t end = (pageSize == 0) ? ids.size() : std::min(ids.size(), pos + pageSize);
+    VolumeList* volList = (volMgr == nullptr) ? nullptr : volMgr->GetVolumeList();
+    for (; pos < end; pos++)
     {
-        VolumeList* volList = volMgr->GetVolumeList();
-        int idx = -1;
-        while (true)
+        int idx = ids[pos];
+        VolumeBase* vol = volList->GetVolume(idx);
+        if (nullptr == vol)
         {
-            VolumeBase* vol = volList->Next(idx);
-            if (nullptr == vol)
-            {
-                break;
-            }
-            grpc_cli::Volume* volume = reply->mutable_result()->mutable_data()->add_volumes();
-			volume->set_name(vol->GetVolumeName());
-			volume->set_index(idx);
-			volume->set_uuid(vol->GetUuid());
-			volume->set_total(vol->GetTotalSize());
-            
-            VolumeMountStatus volumeStatus = vol->GetVolumeMountStatus();
-            if (Mounted == volumeStatus)
-            {
-                volume->set_remain(vol->RemainingSize());
-            }
-            volume->set_status(volMgr->GetStatusStr(volumeStatus));
-            volume->set_maxiops(vol->GetMaxIOPS());
-            volume->set_miniops(vol->GetMinIOPS());
-            volume->set_maxbw(vol->GetMaxBW());
-            volume->set_minbw(vol->GetMinBW());
+            // Deleted after the snapshot was taken
+            continue;
         }
-        
-        _SetEventStatus(EID(SUCCESS), reply->mutable_result()->mutable_status());
-        _SetPosInfo(reply->mutable_info());
-        return grpc::Status::OK;
+        grpc_cli::Volume* volume = reply->mutable_result()->mutable_data()->add_volumes();
+        volume->set_name(vol->GetVolumeName());
+        volume->set_index(idx);
+        volume->set_uuid(vol->GetUuid());
+        volume->set_total(vol->GetTotalSize());
+
+        VolumeMountStatus volumeStatus = vol->GetVolumeMountStatus();
+        if (Mounted == volumeStatus)
+        {
+            volume->set_remain(vol->RemainingSize());
+        }
+        volume->set_status(volMgr->GetStatusStr(volumeStatus));
+        volume->set_maxiops(vol->GetMaxIOPS());
+        volume->set_miniops(vol->GetMinIOPS());
+        volume->set_maxbw(vol->GetMaxBW());
+        volume->set_minbw(vol->GetMinBW());
     }
+    if (pos < ids.size())
+    {
+        reply->set_nextpagetoken(to_string(ids[pos]));
+    }
+
     _SetEventStatus(EID(SUCCESS), reply->mutable_result()->mutable_status());
     _SetPosInfo(reply->mutable_info());
-    return grpc::Status::OK;
+}
 
+bool
+CommandProcessor::_ParsePageToken(const string& token, size_t& value)
+{
+    value = 0;
+    if (token.empty())
+    {
+        return true;
+    }
+    if (token.find_first_not_of("0123456789") != string::npos || token.size() > 9)
+    {
+        return false;
+    }
+    value = std::stoul(token);
+    return true;
 }
 
 grpc::Status CommandProcessor::ExecuteVolumeInfoCommand(const VolumeInfoRequest* request, VolumeInfoResponse* reply)
@@ -37,6 +37,7 @@
 #include "proto/generated/cpp/cli.grpc.pb.h"
 #include "proto/generated/cpp/cli.pb.h"
 #include <string>
+#include <vector>
 
 #define RESET_EVENT_WRR_DEFAULT_WEIGHT 20
 #define DEFAULT_ARRAY_STATUS "Unmounted"
@@ -46,6 +47,8 @@
 namespace pos
 {
 class IGCInfo;
+class IVolumeInfoManager;
+class DeviceProperty;
 } // namespace pos
 
 using google::protobuf::RepeatedPtrField;
@@ -211,6 +214,8 @@ public:
     grpc::Status ExecuteCreateDeviceCommand(const CreateDeviceRequest* request, CreateDeviceResponse* reply);
     grpc::Status ExecuteScanDeviceCommand(const ScanDeviceRequest* request, ScanDeviceResponse* reply);
     grpc::Status ExecuteListDeviceCommand(const ListDeviceRequest* request, ListDeviceResponse* reply);
+    grpc::Status ExecuteListDeviceStreamCommand(const ListDeviceRequest* request,
+        grpc::ServerWriter<ListDeviceResponse>* writer);
     grpc::Status ExecuteGetSmartLogCommand(const GetSmartLogRequest* request, GetSmartLogResponse* reply);
 
     // Subsystem Commands
@@ -228,6 +233,8 @@ public:
     grpc::Status ExecuteUnmountVolumeCommand(const UnmountVolumeRequest* request, UnmountVolumeResponse* reply);
     grpc::Status ExecuteSetVolumePropertyCommand(const SetVolumePropertyRequest* request, SetVolumePropertyResponse* reply);
     grpc::Status ExecuteListVolumeCommand(const ListVolumeRequest* request, ListVolumeResponse* reply);
+    grpc::Status ExecuteListVolumeStreamCommand(const ListVolumeRequest* request,
+        grpc::ServerWriter<ListVolumeResponse>* writer);
     grpc::Status ExecuteVolumeInfoCommand(const VolumeInfoRequest* request, VolumeInfoResponse* reply);
     grpc::Status ExecuteVolumeRenameCommand(const VolumeRenameRequest* request, VolumeRenameResponse* reply);
 
@@ -256,6 +263,15 @@ private:
     void _PrintUint128Hex(uint64_t* v, char* s, size_t n);
     void _PrintUint128Dec(uint64_t* v, char* s, size_t n);
     bool _IsValidIpAddress(const std::string &ipAddress);
+    bool _ParsePageToken(const std::string& token, size_t& value);
+    void _FillDevicePage(const ListDeviceRequest* request, const std::vector<pos::DeviceProperty>& list,
+        size_t& pos, uint32_t pageSize, ListDeviceResponse* reply);
+    int _GetVolumeManagerToList(const std::string& arrayName, pos::IVolumeInfoManager*& volMgr);
+    void _FillVolumePage(const ListVolumeRequest* request, int eventId, pos::IVolumeInfoManager* volMgr,
+        const std::vector<int>& ids, size_t& pos, uint32_t pageSize, ListVolumeResponse* reply);
+
+    // Page size of the streamed lists when the request leaves it out
+    static const uint32_t DEFAULT_LIST_PAGE_SIZE = 256;
     int _HandleInputVolumes(
         const std::string arrayName,
         const RepeatedPtrField<QosVolumeNameParam>& volumes,
@@ -0,0 +1,158 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/cli/create_qos_group_command.h"
+
+#include "src/array_mgmt/array_manager.h"
+#include "src/cli/cli_event_code.h"
+#include "src/network/nvmf_target.h"
+#include "src/qos/qos_manager.h"
+#include "src/volume/volume_base.h"
+#include "src/volume/volume_manager.h"
+
+namespace pos_cli
+{
+QosCreateGroupCommand::QosCreateGroupCommand(void)
+{
+}
+
+// Exclude destructor of abstract class from function coverage report to avoid known issues in gcc/gcov
+// LCOV_EXCL_START
+QosCreateGroupCommand::~QosCreateGroupCommand(void)
+{
+}
+// LCOV_EXCL_STOP
+
+string
+QosCreateGroupCommand::Execute(json& doc, string rid)
+{
+    JsonFormat jFormat;
+    if (false == QosManagerSingleton::Instance()->IsFeQosEnabled())
+    {
+        return jFormat.MakeResponse("CREATEQOSGROUP", rid, EID(QOS_CLI_FE_QOS_DISABLED), "Fe qos is disabled. So skipping QOS Settings.", GetPosInfo());
+    }
+    if (!doc["param"].contains("array") || !doc["param"].contains("name"))
+    {
+        return jFormat.MakeResponse("CREATEQOSGROUP", rid, static_cast<int>(EID(QOS_CLI_WRONG_MISSING_PARAMETER)), "array or name, Parameter Missing", GetPosInfo());
+    }
+    string arrayName = doc["param"]["array"].get<std::string>();
+    string groupName = doc["param"]["name"].get<std::string>();
+    if (groupName.empty())
+    {
+        return jFormat.MakeResponse("CREATEQOSGROUP", rid, static_cast<int>(EID(QOS_CLI_WRONG_MISSING_PARAMETER)), "Group Name Missing", GetPosInfo());
+    }
+    ComponentsInfo* info = ArrayMgr()->GetInfo(arrayName);
+    if (info == nullptr)
+    {
+        return jFormat.MakeResponse("CREATEQOSGROUP", rid, FAIL,
+             "failed to create a qos group", GetPosInfo());
+    }
+
+    std::vector<uint32_t> volumes;
+    std::vector<uint32_t> nqnIds;
+    if (false == _HandleInputVolumes(doc, arrayName, volumes) || false == _HandleInputSubsystems(doc, nqnIds))
+    {
+        return jFormat.MakeResponse("CREATEQOSGROUP", rid, static_cast<int>(EID(QOS_CLI_WRONG_MISSING_PARAMETER)), errorMsg, GetPosInfo());
+    }
+    if (volumes.empty() && nqnIds.empty())
+    {
+        return jFormat.MakeResponse("CREATEQOSGROUP", rid, static_cast<int>(EID(QOS_CLI_WRONG_MISSING_PARAMETER)), "vol or subsystem, Parameter Missing", GetPosInfo());
+    }
+
+    // maxbw in MB/s and maxiops in KIOPS as for volume policies, 0 is unlimited
+    uint64_t maxBw = 0;
+    uint64_t maxIops = 0;
+    if (doc["param"].contains("maxbw"))
+    {
+        maxBw = doc["param"]["maxbw"].get<uint64_t>() * M_KBYTES * M_KBYTES;
+    }
+    if (doc["param"].contains("maxiops"))
+    {
+        maxIops = doc["param"]["maxiops"].get<uint64_t>() * KIOPS;
+    }
+    uint32_t arrayId = info->arrayInfo->GetIndex();
+    int retVal = QosManagerSingleton::Instance()->CreateQosGroup(arrayId, groupName, volumes, nqnIds, maxBw, maxIops);
+    if (EID(SUCCESS) != retVal)
+    {
+        return jFormat.MakeResponse("CREATEQOSGROUP", rid, retVal, "failed to create a qos group", GetPosInfo());
+    }
+    return jFormat.MakeResponse("CREATEQOSGROUP", rid, SUCCESS, "Qos Group Create", GetPosInfo());
+}
+
+bool
+QosCreateGroupCommand::_HandleInputVolumes(json& doc, string& arrayName, std::vector<uint32_t>& volumes)
+{
+    if (!doc["param"].contains("vol"))
+    {
+        return true;
+    }
+    IVolumeInfoManager* volMgr = VolumeServiceSingleton::Instance()->GetVolumeManager(arrayName);
+    if (nullptr == volMgr)
+    {
+        errorMsg = "Invalid Array Name";
+        return false;
+    }
+    for (unsigned int i = 0; i < doc["param"]["vol"].size(); i++)
+    {
+        string volName = doc["param"]["vol"][i]["volumeName"];
+        if (EID(SUCCESS) != volMgr->CheckVolumeValidity(volName))
+        {
+            errorMsg = "Invalid Volume Name " + volName;
+            return false;
+        }
+        volumes.push_back(volMgr->GetVolumeID(volName));
+    }
+    return true;
+}
+
+bool
+QosCreateGroupCommand::_HandleInputSubsystems(json& doc, std::vector<uint32_t>& nqnIds)
+{
+    if (!doc["param"].contains("subsystem"))
+    {
+        return true;
+    }
+    NvmfTarget* nvmfTarget = NvmfTargetSingleton::Instance();
+    for (unsigned int i = 0; i < doc["param"]["subsystem"].size(); i++)
+    {
+        string subnqn = doc["param"]["subsystem"][i]["subnqn"];
+        int32_t nqnId = nvmfTarget->GetVolumeNqnId(subnqn);
+        if (nqnId < 0)
+        {
+            errorMsg = "Invalid Subsystem " + subnqn;
+            return false;
+        }
+        nqnIds.push_back(nqnId);
+    }
+    return true;
+}
+}; // namespace pos_cli
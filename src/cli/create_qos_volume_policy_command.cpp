@@ -129,6 +129,50 @@ QosCreateVolumePolicyCommand::Execute(json& doc, string rid)
         qos_vol_policy policy = QosManagerSingleton::Instance()->GetVolumePolicy(volume.second, arrayName);
         retVal = volMgr->UpdateQoSProperty(volume.first, policy.maxIops, policy.maxBw, policy.minIops, policy.minBw);
     }
+    if (retVal == SUCCESS && doc["param"].contains("maxreadlatency"))
+    {
+        // p99 read latency target in us, 0 clears the target
+        int64_t maxReadLatency = doc["param"]["maxreadlatency"].get<int64_t>();
+        ComponentsInfo* info = ArrayMgr()->GetInfo(arrayName);
+        if (maxReadLatency >= 0 && info != nullptr)
+        {
+            uint32_t arrayId = info->arrayInfo->GetIndex();
+            for (auto volume : validVolumes)
+            {
+                QosManagerSingleton::Instance()->SetVolumeReadLatencyTarget(arrayId, volume.second, maxReadLatency);
+            }
+        }
+    }
+    if (retVal == SUCCESS && (doc["param"].contains("burstpercent") || doc["param"].contains("burstduration")))
+    {
+        // burst limit in percent of the max limits, 100 disables burst credits
+        int64_t burstPercent = DEFAULT_BURST_PERCENT;
+        int64_t burstDuration = DEFAULT_BURST_DURATION_SEC;
+        if (doc["param"].contains("burstpercent"))
+        {
+            burstPercent = doc["param"]["burstpercent"].get<int64_t>();
+        }
+        if (doc["param"].contains("burstduration"))
+        {
+            burstDuration = doc["param"]["burstduration"].get<int64_t>();
+        }
+        if (burstPercent < DEFAULT_BURST_PERCENT || burstPercent > MAX_BURST_PERCENT ||
+            burstDuration <= 0 || burstDuration > MAX_BURST_DURATION_SEC)
+        {
+            errorMsg = "Invalid burst parameters, burstpercent: " + std::to_string(DEFAULT_BURST_PERCENT) + "~" + std::to_string(MAX_BURST_PERCENT) +
+                ", burstduration: 1~" + std::to_string(MAX_BURST_DURATION_SEC) + " sec";
+            return jFormat.MakeResponse("CREATEQOSVOLUMEPOLICY", rid, static_cast<int>(EID(QOS_CLI_WRONG_MISSING_PARAMETER)), errorMsg, GetPosInfo());
+        }
+        ComponentsInfo* info = ArrayMgr()->GetInfo(arrayName);
+        if (info != nullptr)
+        {
+            uint32_t arrayId = info->arrayInfo->GetIndex();
+            for (auto volume : validVolumes)
+            {
+                QosManagerSingleton::Instance()->SetVolumeBurst(volume.second, burstPercent, burstDuration, arrayId);
+            }
+        }
+    }
     if (retVal != SUCCESS)
     {
         errorMsg = "QoS update in Volume Manager failed";
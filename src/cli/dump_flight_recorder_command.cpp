@@ -0,0 +1,84 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/cli/dump_flight_recorder_command.h"
+
+#include "src/cli/cli_event_code.h"
+#include "src/trace/flight_recorder.h"
+
+namespace pos_cli
+{
+DumpFlightRecorderCommand::DumpFlightRecorderCommand(void)
+{
+}
+
+// Exclude destructor of abstract class from function coverage report to avoid known issues in gcc/gcov
+// LCOV_EXCL_START
+DumpFlightRecorderCommand::~DumpFlightRecorderCommand(void)
+{
+}
+// LCOV_EXCL_STOP
+
+string
+DumpFlightRecorderCommand::Execute(json& doc, string rid)
+{
+    JsonFormat jFormat;
+    pos::FlightRecorder* flightRecorder = pos::FlightRecorderSingleton::Instance();
+    string path = "";
+    if (doc.contains("param") == true && doc["param"].contains("path") == true)
+    {
+        path = doc["param"]["path"].get<std::string>();
+    }
+
+    bool success = false;
+    if (path.empty() == true)
+    {
+        path = flightRecorder->DumpToDefaultPath("cli");
+        success = (path.empty() == false);
+    }
+    else
+    {
+        success = (flightRecorder->Dump(path) >= 0);
+    }
+    if (success == false)
+    {
+        return jFormat.MakeResponse("DUMPFLIGHTRECORDER", rid, EID(FLIGHT_RECORDER_DUMP_FAILED),
+            "failed to dump the flight recorder", GetPosInfo());
+    }
+
+    JsonElement data("data");
+    data.SetAttribute(JsonAttribute("path", "\"" + path + "\""));
+    data.SetAttribute(JsonAttribute("enabled", flightRecorder->IsEnabled() ? "true" : "false"));
+    return jFormat.MakeResponse("DUMPFLIGHTRECORDER", rid, SUCCESS,
+        "flight recorder has been dumped to " + path, data, GetPosInfo());
+}
+}; // namespace pos_cli
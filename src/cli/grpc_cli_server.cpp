@@ -580,6 +580,15 @@ class PosCliServiceImpl final : public PosCli::Service
         return status;
     }
 
+    grpc::Status
+    ListDeviceStream(ServerContext* context, const ListDeviceRequest* request,
+        grpc::ServerWriter<ListDeviceResponse>* writer) override
+    {
+        // The pages are not logged one by one, as the list may be large
+        _LogCliRequest(request, request->command());
+        return pc->ExecuteListDeviceStreamCommand(request, writer);
+    }
+
     grpc::Status
     GetSmartLog(ServerContext* context, const GetSmartLogRequest* request,
         GetSmartLogResponse* reply) override
@@ -805,6 +814,13 @@ class PosCliServiceImpl final : public PosCli::Service
         return status;
     }
 
+    grpc::Status ListVolumeStream(ServerContext* context, const ListVolumeRequest* request,
+        grpc::ServerWriter<ListVolumeResponse>* writer) override
+    {
+        _LogCliRequest(request, request->command());
+        return pc->ExecuteListVolumeStreamCommand(request, writer);
+    }
+
     grpc::Status QosCreateVolumePolicy(ServerContext* context, const QosCreateVolumePolicyRequest* request, QosCreateVolumePolicyResponse* reply) override
     {
         _LogCliRequest(request, request->command());
@@ -0,0 +1,121 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/cli/list_qos_groups_command.h"
+
+#include <vector>
+
+#include "src/array_mgmt/array_manager.h"
+#include "src/cli/cli_event_code.h"
+#include "src/qos/qos_manager.h"
+#include "src/volume/volume_base.h"
+#include "src/volume/volume_manager.h"
+
+namespace pos_cli
+{
+QosListGroupsCommand::QosListGroupsCommand(void)
+{
+}
+
+// Exclude destructor of abstract class from function coverage report to avoid known issues in gcc/gcov
+// LCOV_EXCL_START
+QosListGroupsCommand::~QosListGroupsCommand(void)
+{
+}
+// LCOV_EXCL_STOP
+
+string
+QosListGroupsCommand::Execute(json& doc, string rid)
+{
+    JsonFormat jFormat;
+    string arrayName = "";
+    if (doc["param"].contains("array") == true)
+    {
+        arrayName = doc["param"]["array"].get<std::string>();
+    }
+    if (0 == arrayName.compare(""))
+    {
+        return jFormat.MakeResponse("LISTQOSGROUPS", rid, static_cast<int>(EID(QOS_CLI_WRONG_MISSING_PARAMETER)), "Array Name Missing", GetPosInfo());
+    }
+    ComponentsInfo* info = ArrayMgr()->GetInfo(arrayName);
+    if (info == nullptr)
+    {
+        return jFormat.MakeResponse("LISTQOSGROUPS", rid, FAIL,
+             "failed to list qos groups of array: " + arrayName, GetPosInfo());
+    }
+    IVolumeInfoManager* volMgr =
+        VolumeServiceSingleton::Instance()->GetVolumeManager(arrayName);
+
+    std::vector<qos_group_usage> groupUsage;
+    QosManagerSingleton::Instance()->GetQosGroupUsage(info->arrayInfo->GetIndex(), groupUsage);
+
+    JsonElement data("data");
+    JsonArray groups("qosGroups");
+    for (auto& usage : groupUsage)
+    {
+        JsonElement group("");
+        group.SetAttribute(JsonAttribute("name", "\"" + usage.name + "\""));
+        // limits in MB/s and KIOPS as they were given, usage of the last time slice per second
+        group.SetAttribute(JsonAttribute("maxbw", to_string(usage.maxBw / (M_KBYTES * M_KBYTES))));
+        group.SetAttribute(JsonAttribute("maxiops", to_string(usage.maxIops / KIOPS)));
+        group.SetAttribute(JsonAttribute("usedbw", to_string(usage.usedBw / (M_KBYTES * M_KBYTES))));
+        group.SetAttribute(JsonAttribute("usediops", to_string(usage.usedIops)));
+
+        JsonArray volumes("volumes");
+        for (auto volId : usage.volumes)
+        {
+            string volName = "";
+            if (nullptr != volMgr)
+            {
+                volMgr->GetVolumeName(volId, volName);
+            }
+            JsonElement volume("");
+            volume.SetAttribute(JsonAttribute("id", to_string(volId)));
+            volume.SetAttribute(JsonAttribute("name", "\"" + volName + "\""));
+            volumes.AddElement(volume);
+        }
+        group.SetArray(volumes);
+
+        JsonArray subsystems("subsystems");
+        for (auto nqnId : usage.subsystems)
+        {
+            JsonElement subsystem("");
+            subsystem.SetAttribute(JsonAttribute("id", to_string(nqnId)));
+            subsystems.AddElement(subsystem);
+        }
+        group.SetArray(subsystems);
+        groups.AddElement(group);
+    }
+    data.SetArray(groups);
+    return jFormat.MakeResponse("LISTQOSGROUPS", rid, SUCCESS, "List of Qos Groups in " + arrayName, data, GetPosInfo());
+}
+}; // namespace pos_cli
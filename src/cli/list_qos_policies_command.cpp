@@ -152,6 +152,8 @@ QosListPoliciesCommand::Execute(json& doc, string rid)
             volume.SetAttribute(JsonAttribute("maxiops", to_string(volPolicy.maxIops)));
             volume.SetAttribute(JsonAttribute("min_bw_guarantee", ((true == volPolicy.minBwGuarantee) ? "\"Yes\"" : "\"No\"")));
             volume.SetAttribute(JsonAttribute("min_iops_guarantee", ((true == volPolicy.minIopsGuarantee) ? "\"Yes\"" : "\"No\"")));
+            volume.SetAttribute(JsonAttribute("burst_credit_bw", to_string(QosManagerSingleton::Instance()->GetVolumeBurstCredit(*vol, false, arrayInfo->GetIndex()))));
+            volume.SetAttribute(JsonAttribute("burst_credit_iops", to_string(QosManagerSingleton::Instance()->GetVolumeBurstCredit(*vol, true, arrayInfo->GetIndex()))));
             volPolicies.AddElement(volume);
         }
         data.SetArray(volPolicies);
@@ -0,0 +1,109 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "src/cli/meta_file_placement_command.h"
+
+#include "src/array_mgmt/array_manager.h"
+#include "src/cli/cli_event_code.h"
+#include "src/metafs/include/metafs_service.h"
+#include "src/metafs/meta_file_placement.h"
+
+namespace pos_cli
+{
+MetaFilePlacementCommand::MetaFilePlacementCommand(void)
+{
+}
+
+// Exclude destructor of abstract class from function coverage report to avoid known issues in gcc/gcov
+// LCOV_EXCL_START
+MetaFilePlacementCommand::~MetaFilePlacementCommand(void)
+{
+}
+// LCOV_EXCL_STOP
+
+string
+MetaFilePlacementCommand::Execute(json& doc, string rid)
+{
+    string arrayName = DEFAULT_ARRAY_NAME;
+    if (doc["param"].contains("array") == true)
+    {
+        arrayName = doc["param"]["array"].get<std::string>();
+    }
+
+    JsonFormat jFormat;
+    ComponentsInfo* info = ArrayMgr()->GetInfo(arrayName);
+    if (info == nullptr)
+    {
+        return jFormat.MakeResponse("METAFILEPLACEMENT", rid, EID(ARRAY_MGR_NO_ARRAY_MATCHING_REQ_NAME),
+            "Array does not exist. array name: " + arrayName, GetPosInfo());
+    }
+
+    pos::MetaFs* metaFs = pos::MetaFsServiceSingleton::Instance()->GetMetaFs(arrayName);
+    if (metaFs == nullptr || metaFs->placement == nullptr)
+    {
+        return jFormat.MakeResponse("METAFILEPLACEMENT", rid, EID(MFS_META_FILE_PLACEMENT_NOT_ENABLED),
+            "I/Os of meta files are not counted. array name: " + arrayName, GetPosInfo());
+    }
+
+    const uint64_t KB = 1024;
+    pos::MetaFilePlacementAdvice advice = metaFs->placement->GetAdvice();
+
+    JsonElement data("data");
+    data.SetAttribute(JsonAttribute("array", "\"" + arrayName + "\""));
+    data.SetAttribute(JsonAttribute("autoPlacement",
+        metaFs->placement->IsAutoPlacementEnabled() ? "\"enabled\"" : "\"disabled\""));
+    data.SetAttribute(JsonAttribute("budgetInKb", "\"" + to_string(advice.budgetBytes / KB) + "\""));
+    data.SetAttribute(JsonAttribute("pinnedNvramInKb", "\"" + to_string(advice.pinnedNvramBytes / KB) + "\""));
+    data.SetAttribute(JsonAttribute("hotFileInKb", "\"" + to_string(advice.hotFileBytes / KB) + "\""));
+    data.SetAttribute(JsonAttribute("placedInKb", "\"" + to_string(advice.placedBytes / KB) + "\""));
+    data.SetAttribute(JsonAttribute("recommendedNvramInMb",
+        "\"" + to_string(advice.recommendedNvramBytes / (KB * KB)) + "\""));
+
+    JsonArray fileList("fileList");
+    for (auto& heat : advice.hotFiles)
+    {
+        JsonElement fileElement("");
+        fileElement.SetAttribute(JsonAttribute("name", "\"" + heat.fileName + "\""));
+        fileElement.SetAttribute(JsonAttribute("sizeInKb", "\"" + to_string(heat.fileSize / KB) + "\""));
+        fileElement.SetAttribute(JsonAttribute("iops", "\"" + to_string(heat.iops) + "\""));
+        fileElement.SetAttribute(JsonAttribute("volume",
+            (heat.volume == pos::MetaVolumeType::NvRamVolume) ? "\"NVRAM\"" : "\"SSD\""));
+        fileElement.SetAttribute(JsonAttribute("placed", heat.placedOnNvram ? "\"yes\"" : "\"no\""));
+        fileList.AddElement(fileElement);
+    }
+    data.SetArray(fileList);
+
+    return jFormat.MakeResponse("METAFILEPLACEMENT", rid, SUCCESS,
+        "meta file placement of " + arrayName + " has been loaded successfully", data, GetPosInfo());
+}
+}; // namespace pos_cli
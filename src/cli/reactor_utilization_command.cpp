@@ -0,0 +1,112 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/cli/reactor_utilization_command.h"
+
+#include <map>
+#include <vector>
+
+#include "src/cli/cli_event_code.h"
+#include "src/cpu_affinity/affinity_manager.h"
+
+namespace pos_cli
+{
+ReactorUtilizationCommand::ReactorUtilizationCommand(void)
+{
+}
+
+// Exclude destructor of abstract class from function coverage report to avoid known issues in gcc/gcov
+// LCOV_EXCL_START
+ReactorUtilizationCommand::~ReactorUtilizationCommand(void)
+{
+}
+// LCOV_EXCL_STOP
+
+string
+ReactorUtilizationCommand::Execute(json& doc, string rid)
+{
+    pos::ReactorCycleAccounting* cycleAccounting = pos::ReactorCycleAccountingSingleton::Instance();
+    std::map<uint32_t, pos::ReactorCycleBreakdown> intervals;
+    for (auto& interval : cycleAccounting->GetIntervalBreakdown())
+    {
+        intervals[interval.reactor] = interval;
+    }
+
+    JsonElement data("data");
+    data.SetAttribute(JsonAttribute("ticksHz", "\"" + to_string(cycleAccounting->GetTicksHz()) + "\""));
+
+    JsonArray reactorList("reactorList");
+    for (auto& total : cycleAccounting->GetBreakdown())
+    {
+        JsonElement reactorElement("");
+        bool isEventReactor = pos::AffinityManagerSingleton::Instance()->IsEventReactor(total.reactor);
+        reactorElement.SetAttribute(JsonAttribute("reactor", static_cast<int>(total.reactor)));
+        reactorElement.SetAttribute(JsonAttribute("role",
+            isEventReactor ? "\"event_reactor\"" : "\"reactor\""));
+
+        // the utilization of the last second, if not yet collected, of the whole run
+        pos::ReactorCycleBreakdown recent = total;
+        auto it = intervals.find(total.reactor);
+        if (it != intervals.end() && it->second.GetTotal() != 0)
+        {
+            recent = it->second;
+        }
+        uint64_t idle = recent.cycles[(int)pos::ReactorCycleType::Idle];
+        int busyPercent = static_cast<int>((recent.GetTotal() - idle) * 100 / recent.GetTotal());
+        reactorElement.SetAttribute(JsonAttribute("busyPercent", busyPercent));
+
+        JsonElement intervalCycles = _MakeCycles("intervalCycles", recent);
+        reactorElement.SetElement(intervalCycles);
+        JsonElement totalCycles = _MakeCycles("totalCycles", total);
+        reactorElement.SetElement(totalCycles);
+        reactorList.AddElement(reactorElement);
+    }
+    data.SetArray(reactorList);
+
+    JsonFormat jFormat;
+    return jFormat.MakeResponse("REACTORUTILIZATION", rid, SUCCESS,
+        "reactor utilization has been loaded successfully", data, GetPosInfo());
+}
+
+JsonElement
+ReactorUtilizationCommand::_MakeCycles(string name, const pos::ReactorCycleBreakdown& breakdown)
+{
+    JsonElement cycles(name);
+    for (int type = 0; type < (int)pos::ReactorCycleType::Count; type++)
+    {
+        cycles.SetAttribute(JsonAttribute(
+            pos::ReactorCycleAccounting::GetTypeName((pos::ReactorCycleType)type),
+            "\"" + to_string(breakdown.cycles[type]) + "\""));
+    }
+    return cycles;
+}
+}; // namespace pos_cli
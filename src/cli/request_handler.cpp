@@ -35,6 +35,7 @@
 #include <iostream>
 #include "src/logger/logger.h"
 
+#include "src/cli/access_heatmap_command.h"
 #include "src/cli/add_device_command.h"
 #include "src/cli/add_listener_command.h"
 #include "src/cli/apply_log_filter_command.h"
@@ -43,6 +44,7 @@
 #include "src/cli/create_array_command.h"
 #include "src/cli/autocreate_array_command.h"
 #include "src/cli/create_device_command.h"
+#include "src/cli/create_qos_group_command.h"
 #include "src/cli/create_qos_volume_policy_command.h"
 #include "src/cli/create_subsystem_command.h"
 #include "src/cli/create_transport_command.h"
@@ -50,20 +52,24 @@
 #include "src/cli/delete_array_command.h"
 #include "src/cli/delete_subsystem_command.h"
 #include "src/cli/delete_volume_command.h"
+#include "src/cli/dump_flight_recorder_command.h"
 #include "src/cli/stop_pos_command.h"
 #include "src/cli/get_pos_info_command.h"
 #include "src/cli/get_log_level_command.h"
 #include "src/cli/handle_wbt_command.h"
 #include "src/cli/list_array_command.h"
 #include "src/cli/list_device_command.h"
+#include "src/cli/list_qos_groups_command.h"
 #include "src/cli/list_qos_policies_command.h"
 #include "src/cli/list_subsystem_command.h"
 #include "src/cli/list_volume_command.h"
 #include "src/cli/volume_info_command.h"
 #include "src/cli/list_wbt_command.h"
 #include "src/cli/logger_info_command.h"
+#include "src/cli/meta_file_placement_command.h"
 #include "src/cli/mount_array_command.h"
 #include "src/cli/mount_volume_command.h"
+#include "src/cli/reactor_utilization_command.h"
 #include "src/cli/rebuild_perf_impact_command.h"
 #include "src/cli/remove_device_command.h"
 #include "src/cli/rename_volume_command.h"
@@ -128,12 +134,18 @@ RequestHandler::RequestHandler(void)
     cmdDictionary["LISTQOSPOLICIES"] = new QosListPoliciesCommand();
     cmdDictionary["CREATEQOSVOLUMEPOLICY"] = new QosCreateVolumePolicyCommand();
     cmdDictionary["RESETQOSVOLUMEPOLICY"] = new QosResetVolumePolicyCommand();
+    cmdDictionary["CREATEQOSGROUP"] = new QosCreateGroupCommand();
+    cmdDictionary["LISTQOSGROUPS"] = new QosListGroupsCommand();
     cmdDictionary["STARTTELEMETRY"] = new StartTelemetryCommand();
     cmdDictionary["STOPTELEMETRY"] = new StopTelemetryCommand();
     cmdDictionary["STOPREBUILDING"] = new StopRebuildingCommand();
     cmdDictionary["UPDATEEVENTWRRPOLICY"] = new UpdateEventWrrPolicyCommand();
     cmdDictionary["RESETEVENTWRRPOLICY"] = new ResetEventWrrPolicyCommand();
     cmdDictionary["GETSYSTEMPROPERTY"] = new GetSystemPropertyCommand();
+    cmdDictionary["REACTORUTILIZATION"] = new ReactorUtilizationCommand();
+    cmdDictionary["ACCESSHEATMAP"] = new AccessHeatmapCommand();
+    cmdDictionary["METAFILEPLACEMENT"] = new MetaFilePlacementCommand();
+    cmdDictionary["DUMPFLIGHTRECORDER"] = new DumpFlightRecorderCommand();
 }
 
 RequestHandler::~RequestHandler(void)
@@ -38,6 +38,7 @@
 #include "src/device/device_manager.h"
 #include "src/logger/logger.h"
 #include "src/resource_checker/smart_collector.h"
+#include "src/resource_checker/smart_sampler.h"
 
 namespace pos_cli
 {
@@ -104,8 +105,12 @@ SMARTLOGCommand::Execute(json& doc, string rid)
             return jFormat.MakeResponse("SMARTLOG", rid, BADREQUEST, "Can't get nvme ctrlr", GetPosInfo());
         }
 
-        SmartCollector* smartCollector = SmartCollectorSingleton::Instance();
-        SmartReturnType ret = smartCollector->CollectPerCtrl(&payload, ctrlr, SmartReqId::NVME_HEALTH_INFO);
+        SmartReturnType ret = SmartReturnType::SUCCESS;
+        if (false == SmartSamplerSingleton::Instance()->GetHealthPage(deviceName, payload))
+        {
+            SmartCollector* smartCollector = SmartCollectorSingleton::Instance();
+            ret = smartCollector->CollectPerCtrl(&payload, ctrlr, SmartReqId::NVME_HEALTH_INFO);
+        }
         switch (ret)
         {
             case SmartReturnType::SEND_ERR:
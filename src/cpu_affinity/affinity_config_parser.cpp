@@ -76,7 +76,8 @@ const AffinityConfigParser::ConfigKeyAndCoreTypes
 AffinityConfigParser::AffinityConfigParser(ConfigManager& configManager_)
 : selectedDescs(DEFAULT_CORE_DESCRIPTIONS),
   isStringDescripted(DEFAULT_IS_STRING_DESCRIPTED),
-  useEventReactor(false)
+  useEventReactor(false),
+  autoPlanned(false)
 {
     ConfigManager& configManager = configManager_;
     std::string module("affinity_manager");
@@ -120,10 +121,22 @@ AffinityConfigParser::AffinityConfigParser(ConfigManager& configManager_)
         POS_TRACE_INFO(static_cast<uint32_t>(eventId),
             "Event Reactor is not implemented yet, fallback to legacy code");
     }
+    // the qos control loop can run as a poller on a reactor instead
+    bool qosControlInPoller = false;
+    ret = configManager.GetValue("fe_qos", "control_in_poller", &qosControlInPoller,
+        CONFIG_TYPE_BOOL);
+    if (ret != EID(SUCCESS))
+    {
+        qosControlInPoller = false;
+    }
     std::vector<bool> mandatoryAffinityVector;
     for (auto& iter : CONFIG_KEY_AND_CORE_TYPES)
     {
         bool useAffinity = true;
+        if (qosControlInPoller == true && iter.type == CoreType::QOS)
+        {
+            useAffinity = false;
+        }
         if (useReactorConfig == true &&
             ((iter.type == CoreType::UDD_IO_WORKER)||
             (iter.type == CoreType::EVENT_SCHEDULER) ||
@@ -176,6 +189,11 @@ AffinityConfigParser::AffinityConfigParser(ConfigManager& configManager_)
     isStringDescripted = true;
     selectedDescs = parsedDescs;
 
+    // The core lists then only give the core count of each role
+    bool autoPlan = false;
+    ret = configManager.GetValue(module, "auto_plan", &autoPlan, CONFIG_TYPE_BOOL);
+    autoPlanned = (ret == EID(SUCCESS) && autoPlan == true);
+
     return;
 }
 
@@ -201,4 +219,10 @@ AffinityConfigParser::UseEventReactor(void)
     return useEventReactor;
 }
 
+bool
+AffinityConfigParser::IsAutoPlanned(void)
+{
+    return autoPlanned;
+}
+
 } // namespace pos
@@ -48,6 +48,7 @@ public:
     virtual const CoreDescriptionArray& GetDescriptions(void);
     virtual bool IsStringDescripted(void);
     virtual bool UseEventReactor(void);
+    virtual bool IsAutoPlanned(void);
 
 private:
     static const bool DEFAULT_IS_STRING_DESCRIPTED;
@@ -66,6 +67,7 @@ private:
     CoreDescriptionArray selectedDescs;
     bool isStringDescripted;
     bool useEventReactor;
+    bool autoPlanned;
 };
 
 } // namespace pos
@@ -33,10 +33,12 @@
 #include "src/cpu_affinity/affinity_manager.h"
 
 #include <numa.h>
+#include <numaif.h>
 #include <sched.h>
 
 #include <iomanip>
 
+#include "auto_planned_cpu_set_generator.h"
 #include "count_descripted_cpu_set_generator.h"
 #include "poverty_cpu_set_generator.h"
 #include "src/include/branch_prediction.h"
@@ -64,6 +66,7 @@ AffinityManager::AffinityManager(uint32_t totalCount, CpuSetArray& cpuSetArray)
   useStringForParsing(false),
   parser(nullptr)
 {
+    _CacheNumaOfCores();
 }
 
 AffinityManager::AffinityManager(AffinityConfigParser* parser_)
@@ -83,14 +86,18 @@ AffinityManager::AffinityManager(AffinityConfigParser* parser_)
     useStringForParsing = parser->IsStringDescripted();
 
     _SetNumaInformation(DESC_ARRAY);
+    _CacheNumaOfCores();
 
     try
     {
         if (useStringForParsing)
         {
-            StringDescriptedCpuSetGenerator cpuSetGenerator(
-                DESC_ARRAY, PROHIBIT_CORE_MASK_OVERLAPPED);
-            cpuSetArray = cpuSetGenerator.GetCpuSetArray();
+            if (false == parser->IsAutoPlanned() || false == _PlanCpuSet(DESC_ARRAY))
+            {
+                StringDescriptedCpuSetGenerator cpuSetGenerator(
+                    DESC_ARRAY, PROHIBIT_CORE_MASK_OVERLAPPED);
+                cpuSetArray = cpuSetGenerator.GetCpuSetArray();
+            }
         }
         else
         {
@@ -160,6 +167,35 @@ AffinityManager::_SetNumaInformation(const CoreDescriptionArray& descArray)
     }
 }
 
+bool
+AffinityManager::_PlanCpuSet(const CoreDescriptionArray& descArray)
+{
+    try
+    {
+        AffinityTopology topology = AffinityTopology::Detect();
+        AutoPlannedCpuSetGenerator cpuSetGenerator(descArray, topology);
+        cpuSetArray = cpuSetGenerator.GetCpuSetArray();
+        planRationale = cpuSetGenerator.GetRationale();
+    }
+    catch (const std::exception& e)
+    {
+        POS_TRACE_WARN(EID(AFTMGR_AUTO_PLAN_FAILED), "reason: {}", e.what());
+        return false;
+    }
+
+    for (auto& line : planRationale)
+    {
+        POS_TRACE_INFO(EID(AFTMGR_AUTO_PLANNED), "{}", line);
+    }
+    return true;
+}
+
+const std::vector<std::string>&
+AffinityManager::GetPlanRationale(void)
+{
+    return planRationale;
+}
+
 bool
 AffinityManager::_IsCoreSufficient(void)
 {
@@ -259,10 +295,36 @@ AffinityManager::GetNumaIdFromCurrentThread(void)
 uint32_t
 AffinityManager::GetNumaIdFromCoreId(uint32_t coreId)
 {
+    if (likely(coreId < numaOfCore.size()))
+    {
+        return numaOfCore[coreId];
+    }
     numaId = numa_node_of_cpu(coreId);
     return numaId;
 }
 
+void
+AffinityManager::_CacheNumaOfCores(void)
+{
+    numaOfCore.clear();
+    for (uint32_t core = 0; core < TOTAL_COUNT; core++)
+    {
+        int node = numa_node_of_cpu(core);
+        numaOfCore.push_back((node < 0) ? 0 : static_cast<uint32_t>(node));
+    }
+}
+
+uint32_t
+AffinityManager::GetNumaIdFromAddress(void* addr)
+{
+    int node = -1;
+    if (get_mempolicy(&node, nullptr, 0, addr, MPOL_F_NODE | MPOL_F_ADDR) != 0 || node < 0)
+    {
+        return GetNumaIdFromCurrentThread();
+    }
+    return static_cast<uint32_t>(node);
+}
+
 std::string
 AffinityManager::_GetCPUSetString(cpu_set_t cpuSet)
 {
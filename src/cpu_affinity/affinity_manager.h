@@ -33,6 +33,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "rte_config.h"
 #include "src/cpu_affinity/affinity_config_parser.h"
@@ -57,11 +58,13 @@ public:
     virtual uint32_t GetTotalCore(void);
     virtual uint32_t GetNumaIdFromCurrentThread(void);
     virtual uint32_t GetNumaIdFromCoreId(uint32_t coreId);
+    virtual uint32_t GetNumaIdFromAddress(void* addr);
     uint32_t GetCoreCount(CoreType type);
     virtual uint32_t GetNumaCount(void);
     virtual bool UseEventReactor();
     virtual bool IsEventReactor(uint32_t reactor);
     virtual bool IsIoReactor(uint32_t reactor);
+    const std::vector<std::string>& GetPlanRationale(void);
 
 private:
     static const uint32_t MAX_NUMA_COUNT = RTE_MAX_NUMA_NODES;
@@ -74,9 +77,14 @@ private:
     CpuSetArray cpuSetArray;
     bool useStringForParsing;
     AffinityConfigParser* parser;
+    std::vector<std::string> planRationale;
+    // Looked up once, as the write path asks for the node of the origin core of every io
+    std::vector<uint32_t> numaOfCore;
 
     void _SetNumaInformation(const CoreDescriptionArray& descArray);
+    void _CacheNumaOfCores(void);
     bool _IsCoreSufficient(void);
+    bool _PlanCpuSet(const CoreDescriptionArray& descArray);
     std::string _GetCPUSetString(cpu_set_t cpuSet);
     static thread_local uint32_t numaId;
 };
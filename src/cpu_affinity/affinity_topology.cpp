@@ -0,0 +1,183 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/cpu_affinity/affinity_topology.h"
+
+#include <dirent.h>
+#include <numa.h>
+
+#include <fstream>
+
+namespace pos
+{
+static const char* PCI_CLASS_NVME = "0x010802";
+static const char* PCI_CLASS_NETWORK_PREFIX = "0x02";
+static const char* NVDIMM_REGION_PREFIX = "region";
+
+AffinityTopology
+AffinityTopology::Detect(const std::string& sysfsRoot)
+{
+    AffinityTopology topology;
+    int cpuCount = numa_num_configured_cpus();
+    for (int cpu = 0; cpu < cpuCount; cpu++)
+    {
+        int numa = numa_node_of_cpu(cpu);
+        if (numa < 0)
+        {
+            continue;
+        }
+        uint32_t id = static_cast<uint32_t>(cpu);
+        topology.cpus.push_back(Cpu{id, static_cast<uint32_t>(numa),
+            _ReadPhysicalCore(sysfsRoot, id)});
+    }
+    _ScanPciDevices(sysfsRoot, topology);
+    _ScanNvramRegions(sysfsRoot, topology);
+    return topology;
+}
+
+uint32_t
+AffinityTopology::_ReadPhysicalCore(const std::string& sysfsRoot, uint32_t cpu)
+{
+    std::string line;
+    std::string path = sysfsRoot + "/devices/system/cpu/cpu" + std::to_string(cpu) +
+        "/topology/thread_siblings_list";
+    if (false == _ReadLine(path, line))
+    {
+        return cpu;
+    }
+    try
+    {
+        // "2,34" or "2-3", the first one is the lowest sibling
+        return std::stoul(line);
+    }
+    catch (const std::exception& e)
+    {
+        return cpu;
+    }
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Find NICs and NVMe SSDs by PCI class
+ *           Devices are looked up on the PCI bus rather than through their
+ *           kernel drivers, as SSDs are bound to a user space driver.
+ */
+/* --------------------------------------------------------------------------*/
+void
+AffinityTopology::_ScanPciDevices(const std::string& sysfsRoot, AffinityTopology& topology)
+{
+    std::string pciRoot = sysfsRoot + "/bus/pci/devices";
+    DIR* dir = opendir(pciRoot.c_str());
+    if (nullptr == dir)
+    {
+        return;
+    }
+
+    struct dirent* ent;
+    while ((ent = readdir(dir)) != nullptr)
+    {
+        std::string name(ent->d_name);
+        if (name.empty() || name[0] == '.')
+        {
+            continue;
+        }
+        std::string pciClass;
+        if (false == _ReadLine(pciRoot + "/" + name + "/class", pciClass))
+        {
+            continue;
+        }
+        if (pciClass == PCI_CLASS_NVME)
+        {
+            topology.ssdNumas.push_back(_ReadNuma(pciRoot + "/" + name + "/numa_node"));
+        }
+        else if (pciClass.find(PCI_CLASS_NETWORK_PREFIX) == 0)
+        {
+            topology.nicNumas.push_back(_ReadNuma(pciRoot + "/" + name + "/numa_node"));
+        }
+    }
+    closedir(dir);
+}
+
+void
+AffinityTopology::_ScanNvramRegions(const std::string& sysfsRoot, AffinityTopology& topology)
+{
+    std::string ndRoot = sysfsRoot + "/bus/nd/devices";
+    DIR* dir = opendir(ndRoot.c_str());
+    if (nullptr == dir)
+    {
+        return;
+    }
+
+    struct dirent* ent;
+    while ((ent = readdir(dir)) != nullptr)
+    {
+        std::string name(ent->d_name);
+        if (name.find(NVDIMM_REGION_PREFIX) == 0)
+        {
+            topology.nvramNumas.push_back(_ReadNuma(ndRoot + "/" + name + "/numa_node"));
+        }
+    }
+    closedir(dir);
+}
+
+bool
+AffinityTopology::_ReadLine(const std::string& path, std::string& line)
+{
+    std::ifstream file(path);
+    if (false == file.is_open())
+    {
+        return false;
+    }
+    return static_cast<bool>(std::getline(file, line));
+}
+
+uint32_t
+AffinityTopology::_ReadNuma(const std::string& path)
+{
+    std::string line;
+    if (false == _ReadLine(path, line))
+    {
+        return 0;
+    }
+    try
+    {
+        // a single node system reports -1
+        int numa = std::stoi(line);
+        return (numa < 0) ? 0 : static_cast<uint32_t>(numa);
+    }
+    catch (const std::exception& e)
+    {
+        return 0;
+    }
+}
+
+} // namespace pos
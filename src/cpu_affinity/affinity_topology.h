@@ -0,0 +1,73 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace pos
+{
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Hardware locality seen by the affinity planner
+ *           CPUs with their NUMA node and SMT siblings, and the NUMA nodes
+ *           of the NICs, NVMe SSDs and NVRAM found in sysfs.
+ */
+/* --------------------------------------------------------------------------*/
+struct AffinityTopology
+{
+    struct Cpu
+    {
+        uint32_t id;
+        uint32_t numa;
+        // lowest cpu id among the SMT siblings, shared by all of them
+        uint32_t physicalCore;
+    };
+
+    std::vector<Cpu> cpus;
+    std::vector<uint32_t> nicNumas;
+    std::vector<uint32_t> ssdNumas;
+    std::vector<uint32_t> nvramNumas;
+
+    static AffinityTopology Detect(const std::string& sysfsRoot = "/sys");
+
+private:
+    static uint32_t _ReadPhysicalCore(const std::string& sysfsRoot, uint32_t cpu);
+    static void _ScanPciDevices(const std::string& sysfsRoot, AffinityTopology& topology);
+    static void _ScanNvramRegions(const std::string& sysfsRoot, AffinityTopology& topology);
+    static bool _ReadLine(const std::string& path, std::string& line);
+    static uint32_t _ReadNuma(const std::string& path);
+};
+
+} // namespace pos
@@ -140,6 +140,16 @@ AffinityViewer::Numa::Print(void)
     {
         sockets[socketId].Print();
     }
+    const std::vector<std::string>& planRationale = affinityManager.GetPlanRationale();
+    if (false == planRationale.empty())
+    {
+        cout << "Planned by locality\n";
+        for (auto& line : planRationale)
+        {
+            cout << line << endl;
+        }
+        cout << "===============================\n";
+    }
     if (false == affinityManager.UseEventReactor())
     {
         uint32_t eventWorkerSocket = affinityManager.GetEventWorkerSocket();
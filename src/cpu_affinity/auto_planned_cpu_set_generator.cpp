@@ -0,0 +1,385 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/cpu_affinity/auto_planned_cpu_set_generator.h"
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+
+namespace pos
+{
+AutoPlannedCpuSetGenerator::AutoPlannedCpuSetGenerator(
+    const CoreDescriptionArray& coreDescriptions, const AffinityTopology& topology)
+: topology(topology)
+{
+    uint32_t count[static_cast<uint32_t>(CoreType::COUNT)] = {0, };
+    for (auto& desc : coreDescriptions)
+    {
+        count[static_cast<uint32_t>(desc.type)] = CountCores(desc.coreRange);
+    }
+
+    uint32_t firstNuma = topology.cpus.empty() ? 0 : topology.cpus.front().numa;
+    uint32_t nicNuma = _MostCommon(topology.nicNumas, firstNuma);
+    uint32_t ssdNuma = _MostCommon(topology.ssdNumas, nicNuma);
+    uint32_t nvramNuma = _MostCommon(topology.nvramNumas, ssdNuma);
+
+    std::string nicReason = topology.nicNumas.empty() ? "no NIC found" :
+        "NICs per numa " + _CountPerNuma(topology.nicNumas);
+    std::string ssdReason = topology.ssdNumas.empty() ? "no SSD found" :
+        "most SSDs, SSDs per numa " + _CountPerNuma(topology.ssdNumas);
+    std::string nvramReason = topology.nvramNumas.empty() ? "no NVRAM region found, next to SSDs" :
+        "NVRAM regions per numa " + _CountPerNuma(topology.nvramNumas);
+
+    // The most locality sensitive roles pick their cores first
+    _PlaceRole(CoreType::REACTOR, count[static_cast<uint32_t>(CoreType::REACTOR)],
+        nicNuma, nicReason);
+    _PlaceRole(CoreType::EVENT_REACTOR, count[static_cast<uint32_t>(CoreType::EVENT_REACTOR)],
+        nicNuma, nicReason);
+    _PlaceIoWorkers(count[static_cast<uint32_t>(CoreType::UDD_IO_WORKER)]);
+    _PlaceRole(CoreType::META_IO, count[static_cast<uint32_t>(CoreType::META_IO)],
+        nvramNuma, nvramReason);
+    _PlaceRole(CoreType::META_SCHEDULER, count[static_cast<uint32_t>(CoreType::META_SCHEDULER)],
+        nvramNuma, nvramReason);
+    _PlaceRole(CoreType::EVENT_SCHEDULER, count[static_cast<uint32_t>(CoreType::EVENT_SCHEDULER)],
+        ssdNuma, ssdReason);
+    _PlaceRole(CoreType::EVENT_WORKER, count[static_cast<uint32_t>(CoreType::EVENT_WORKER)],
+        ssdNuma, ssdReason);
+    _PlaceRole(CoreType::GENERAL_USAGE, count[static_cast<uint32_t>(CoreType::GENERAL_USAGE)],
+        nicNuma, "not polling");
+    _PlaceRole(CoreType::QOS, count[static_cast<uint32_t>(CoreType::QOS)],
+        nicNuma, "not polling");
+    _PlaceRole(CoreType::AIR, count[static_cast<uint32_t>(CoreType::AIR)],
+        nicNuma, "not polling");
+}
+
+AutoPlannedCpuSetGenerator::~AutoPlannedCpuSetGenerator(void)
+{
+}
+
+const std::vector<std::string>&
+AutoPlannedCpuSetGenerator::GetRationale(void)
+{
+    return rationale;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Number of cores in a core list ("3-5,8") or mask ("0x38")
+ */
+/* --------------------------------------------------------------------------*/
+uint32_t
+AutoPlannedCpuSetGenerator::CountCores(const std::string& coreRange)
+{
+    uint32_t count = 0;
+    if (coreRange.find("0x") == 0)
+    {
+        for (size_t index = 2; index < coreRange.size(); index++)
+        {
+            std::string digit(1, coreRange[index]);
+            count += __builtin_popcount(std::stoul(digit, nullptr, 16));
+        }
+        return count;
+    }
+
+    size_t offset = 0;
+    while (offset < coreRange.size())
+    {
+        size_t next = coreRange.find(',', offset);
+        std::string token = coreRange.substr(offset,
+            (next == std::string::npos) ? std::string::npos : next - offset);
+        size_t dash = token.find('-');
+        if (dash == std::string::npos)
+        {
+            count += token.empty() ? 0 : 1;
+        }
+        else
+        {
+            uint32_t from = std::stoul(token.substr(0, dash));
+            uint32_t to = std::stoul(token.substr(dash + 1));
+            count += (to >= from) ? (to - from + 1) : 0;
+        }
+        if (next == std::string::npos)
+        {
+            break;
+        }
+        offset = next + 1;
+    }
+    return count;
+}
+
+void
+AutoPlannedCpuSetGenerator::_PlaceRole(CoreType type, uint32_t count,
+    uint32_t preferredNuma, const std::string& reason)
+{
+    if (0 == count)
+    {
+        return;
+    }
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    std::set<uint32_t> spilledNumas;
+    for (uint32_t index = 0; index < count; index++)
+    {
+        uint32_t cpu, numa;
+        if (false == _TakeCpuAnywhere(preferredNuma, _IsPolling(type), cpu, numa))
+        {
+            throw std::runtime_error("not enough cores for " + _GetRoleName(type));
+        }
+        CPU_SET(cpu, &cpuSet);
+        if (numa != preferredNuma)
+        {
+            spilledNumas.insert(numa);
+        }
+    }
+    _SetCpuSet(type, cpuSet);
+
+    std::string line = _GetRoleName(type) + ": cpu " + _CpuList(cpuSet) +
+        " on numa " + std::to_string(preferredNuma) + " (" + reason + ")";
+    for (auto numa : spilledNumas)
+    {
+        line += ", spilled to numa " + std::to_string(numa);
+    }
+    rationale.push_back(line);
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Spread IO workers over the NUMA nodes in proportion to their SSDs
+ *           Each worker goes to the node with the most SSDs per worker
+ *           already placed there.
+ */
+/* --------------------------------------------------------------------------*/
+void
+AutoPlannedCpuSetGenerator::_PlaceIoWorkers(uint32_t count)
+{
+    if (0 == count)
+    {
+        return;
+    }
+    if (topology.ssdNumas.empty())
+    {
+        uint32_t firstNuma = topology.cpus.empty() ? 0 : topology.cpus.front().numa;
+        _PlaceRole(CoreType::UDD_IO_WORKER, count, firstNuma, "no SSD found");
+        return;
+    }
+
+    std::map<uint32_t, uint32_t> ssdCount;
+    for (auto numa : topology.ssdNumas)
+    {
+        ssdCount[numa]++;
+    }
+    std::map<uint32_t, uint32_t> workerCount;
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (uint32_t index = 0; index < count; index++)
+    {
+        uint32_t targetNuma = ssdCount.begin()->first;
+        double bestShare = -1;
+        for (auto& iter : ssdCount)
+        {
+            double share = static_cast<double>(iter.second) / (workerCount[iter.first] + 1);
+            if (share > bestShare)
+            {
+                bestShare = share;
+                targetNuma = iter.first;
+            }
+        }
+
+        uint32_t cpu, numa;
+        if (false == _TakeCpuAnywhere(targetNuma, true, cpu, numa))
+        {
+            throw std::runtime_error("not enough cores for " +
+                _GetRoleName(CoreType::UDD_IO_WORKER));
+        }
+        CPU_SET(cpu, &cpuSet);
+        workerCount[targetNuma]++;
+    }
+    _SetCpuSet(CoreType::UDD_IO_WORKER, cpuSet);
+
+    std::string line = _GetRoleName(CoreType::UDD_IO_WORKER) + ": cpu " + _CpuList(cpuSet) +
+        " (SSDs per numa " + _CountPerNuma(topology.ssdNumas) + ", workers per numa";
+    for (auto& iter : workerCount)
+    {
+        line += " " + std::to_string(iter.first) + ":" + std::to_string(iter.second);
+    }
+    rationale.push_back(line + ")");
+}
+
+bool
+AutoPlannedCpuSetGenerator::_TakeCpuAnywhere(uint32_t preferredNuma, bool polling,
+    uint32_t& cpu, uint32_t& numa)
+{
+    numa = preferredNuma;
+    if (_TakeCpu(preferredNuma, polling, cpu))
+    {
+        return true;
+    }
+
+    std::set<uint32_t> numas;
+    for (auto& iter : topology.cpus)
+    {
+        numas.insert(iter.numa);
+    }
+    for (auto other : numas)
+    {
+        if (other != preferredNuma && _TakeCpu(other, polling, cpu))
+        {
+            numa = other;
+            return true;
+        }
+    }
+    return false;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Take a free cpu of the numa node
+ *           A polling role needs a physical core nobody else runs on.
+ *           Other roles prefer cores without a poller and fall back to
+ *           the SMT sibling of one.
+ */
+/* --------------------------------------------------------------------------*/
+bool
+AutoPlannedCpuSetGenerator::_TakeCpu(uint32_t numa, bool polling, uint32_t& cpu)
+{
+    std::set<uint32_t> occupiedCores;
+    for (auto& iter : topology.cpus)
+    {
+        if (usedCpus.count(iter.id) != 0)
+        {
+            occupiedCores.insert(iter.physicalCore);
+        }
+    }
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        for (auto& iter : topology.cpus)
+        {
+            if (iter.numa != numa || usedCpus.count(iter.id) != 0)
+            {
+                continue;
+            }
+            bool coreFree = (occupiedCores.count(iter.physicalCore) == 0);
+            bool coreWithoutPoller = (polledCores.count(iter.physicalCore) == 0);
+            bool usable = polling ? coreFree : (0 == pass ? coreWithoutPoller : true);
+            if (usable)
+            {
+                cpu = iter.id;
+                usedCpus.insert(cpu);
+                if (polling)
+                {
+                    polledCores.insert(iter.physicalCore);
+                }
+                return true;
+            }
+        }
+        if (polling)
+        {
+            break;
+        }
+    }
+    return false;
+}
+
+bool
+AutoPlannedCpuSetGenerator::_IsPolling(CoreType type)
+{
+    return (type != CoreType::GENERAL_USAGE && type != CoreType::QOS &&
+        type != CoreType::AIR);
+}
+
+std::string
+AutoPlannedCpuSetGenerator::_GetRoleName(CoreType type)
+{
+    static const char* ROLE_NAMES[static_cast<uint32_t>(CoreType::COUNT)] =
+        {"reactor", "udd_io_worker", "event_scheduler", "event_worker",
+            "general_usage", "qos", "meta_scheduler", "meta_io", "air",
+            "event_reactor"};
+    return ROLE_NAMES[static_cast<uint32_t>(type)];
+}
+
+std::string
+AutoPlannedCpuSetGenerator::_CpuList(cpu_set_t& cpuSet)
+{
+    std::string list;
+    for (auto& iter : topology.cpus)
+    {
+        if (CPU_ISSET(iter.id, &cpuSet))
+        {
+            list += (list.empty() ? "" : ",") + std::to_string(iter.id);
+        }
+    }
+    return list;
+}
+
+uint32_t
+AutoPlannedCpuSetGenerator::_MostCommon(const std::vector<uint32_t>& numas, uint32_t fallback)
+{
+    std::map<uint32_t, uint32_t> count;
+    for (auto numa : numas)
+    {
+        count[numa]++;
+    }
+    uint32_t mostCommon = fallback;
+    uint32_t maxCount = 0;
+    for (auto& iter : count)
+    {
+        if (iter.second > maxCount)
+        {
+            maxCount = iter.second;
+            mostCommon = iter.first;
+        }
+    }
+    return mostCommon;
+}
+
+std::string
+AutoPlannedCpuSetGenerator::_CountPerNuma(const std::vector<uint32_t>& numas)
+{
+    std::map<uint32_t, uint32_t> count;
+    for (auto numa : numas)
+    {
+        count[numa]++;
+    }
+    std::string result;
+    for (auto& iter : count)
+    {
+        result += (result.empty() ? "" : " ") + std::to_string(iter.first) + ":" +
+            std::to_string(iter.second);
+    }
+    return result;
+}
+
+} // namespace pos
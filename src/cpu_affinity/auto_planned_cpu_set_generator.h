@@ -0,0 +1,83 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "src/cpu_affinity/affinity_topology.h"
+#include "src/cpu_affinity/cpu_set_generator.h"
+
+namespace pos
+{
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Place each role on cores by hardware locality
+ *           The core count of a role comes from its description, the cores
+ *           themselves are chosen from the topology: reactors next to the
+ *           NICs, IO workers next to their SSDs and meta IO next to NVRAM.
+ *           Polling roles get a physical core of their own.
+ */
+/* --------------------------------------------------------------------------*/
+class AutoPlannedCpuSetGenerator : public CpuSetGenerator
+{
+public:
+    AutoPlannedCpuSetGenerator(const CoreDescriptionArray& coreDescriptions,
+        const AffinityTopology& topology);
+    ~AutoPlannedCpuSetGenerator(void) override;
+
+    const std::vector<std::string>& GetRationale(void);
+
+    static uint32_t CountCores(const std::string& coreRange);
+
+private:
+    void _PlaceRole(CoreType type, uint32_t count, uint32_t preferredNuma,
+        const std::string& reason);
+    void _PlaceIoWorkers(uint32_t count);
+    bool _TakeCpu(uint32_t numa, bool polling, uint32_t& cpu);
+    bool _TakeCpuAnywhere(uint32_t preferredNuma, bool polling, uint32_t& cpu,
+        uint32_t& numa);
+    static bool _IsPolling(CoreType type);
+    static std::string _GetRoleName(CoreType type);
+    std::string _CpuList(cpu_set_t& cpuSet);
+    static uint32_t _MostCommon(const std::vector<uint32_t>& numas, uint32_t fallback);
+    static std::string _CountPerNuma(const std::vector<uint32_t>& numas);
+
+    const AffinityTopology& topology;
+    std::set<uint32_t> usedCpus;
+    std::set<uint32_t> polledCores;
+    std::vector<std::string> rationale;
+};
+
+} // namespace pos
@@ -42,7 +42,8 @@ const uint64_t
 DeviceContext::DeviceContext(SystemTimeoutChecker* timeoutChecker)
 : pendingIoCount(0),
   nextErrorCompletionStartIt(pendingErrorList.end()),
-  timeoutChecker(timeoutChecker)
+  timeoutChecker(timeoutChecker),
+  latencyTracker(nullptr)
 {
 }
 
@@ -54,6 +55,18 @@ DeviceContext::~DeviceContext(void)
     }
 }
 
+void
+DeviceContext::SetLatencyTracker(DeviceLatencyTracker* tracker)
+{
+    latencyTracker = tracker;
+}
+
+DeviceLatencyTracker*
+DeviceContext::GetLatencyTracker(void)
+{
+    return latencyTracker;
+}
+
 void
 DeviceContext::IncreasePendingIO(void)
 {
@@ -42,6 +42,7 @@
 
 namespace pos
 {
+class DeviceLatencyTracker;
 
 class DeviceContext
 {
@@ -59,6 +60,9 @@ public:
     virtual uint32_t GetPendingErrorCount(void);
     virtual IOContext* GetPendingError(void);
 
+    void SetLatencyTracker(DeviceLatencyTracker* tracker);
+    DeviceLatencyTracker* GetLatencyTracker(void);
+
 private:
     bool _CheckErrorReady(IOContext& ioCtx);
     void _ReadyAllRemainingErrors(void);
@@ -78,6 +82,7 @@ private:
     std::list<IOContext*> pendingErrorList;
     std::list<IOContext*>::iterator nextErrorCompletionStartIt;
     SystemTimeoutChecker* timeoutChecker;
+    DeviceLatencyTracker* latencyTracker;
 };
 } // namespace pos
 
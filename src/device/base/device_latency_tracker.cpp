@@ -0,0 +1,109 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/device/base/device_latency_tracker.h"
+
+#include <chrono>
+
+namespace pos
+{
+DeviceLatencyTracker::DeviceLatencyTracker(void)
+: DeviceLatencyTracker(GetOverallOfAllDevices())
+{
+}
+
+DeviceLatencyTracker::DeviceLatencyTracker(DeviceLatencyTracker* overall)
+: average(0),
+  sampleCount(0),
+  overall(overall)
+{
+}
+
+DeviceLatencyTracker::~DeviceLatencyTracker(void)
+{
+}
+
+void
+DeviceLatencyTracker::Record(uint64_t latencyNs)
+{
+    _Update(latencyNs);
+    if (nullptr != overall)
+    {
+        overall->Record(latencyNs);
+    }
+}
+
+uint64_t
+DeviceLatencyTracker::GetAverage(void)
+{
+    return average.load(std::memory_order_relaxed);
+}
+
+uint64_t
+DeviceLatencyTracker::GetSampleCount(void)
+{
+    return sampleCount.load(std::memory_order_relaxed);
+}
+
+DeviceLatencyTracker*
+DeviceLatencyTracker::GetOverall(void)
+{
+    return overall;
+}
+
+DeviceLatencyTracker*
+DeviceLatencyTracker::GetOverallOfAllDevices(void)
+{
+    static DeviceLatencyTracker overallOfAllDevices(nullptr);
+    return &overallOfAllDevices;
+}
+
+uint64_t
+DeviceLatencyTracker::GetCurrentTime(void)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void
+DeviceLatencyTracker::_Update(uint64_t latencyNs)
+{
+    uint64_t prevAverage = average.load(std::memory_order_relaxed);
+    uint64_t newAverage = latencyNs;
+    if (0 != sampleCount.fetch_add(1, std::memory_order_relaxed))
+    {
+        int64_t diff = static_cast<int64_t>(latencyNs) - static_cast<int64_t>(prevAverage);
+        newAverage = prevAverage + (diff >> EWMA_WEIGHT_SHIFT);
+    }
+    average.store(newAverage, std::memory_order_relaxed);
+}
+} // namespace pos
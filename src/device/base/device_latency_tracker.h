@@ -0,0 +1,74 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace pos
+{
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Exponentially weighted moving average of io completion latency
+ *           of a device. Every device also feeds the average over all devices,
+ *           which is the base to tell a slow device from a busy system.
+ *           Updates from several threads may overwrite each other, which only
+ *           drops a sample.
+ */
+/* --------------------------------------------------------------------------*/
+class DeviceLatencyTracker
+{
+public:
+    DeviceLatencyTracker(void);
+    explicit DeviceLatencyTracker(DeviceLatencyTracker* overall);
+    virtual ~DeviceLatencyTracker(void);
+
+    virtual void Record(uint64_t latencyNs);
+    virtual uint64_t GetAverage(void);
+    virtual uint64_t GetSampleCount(void);
+    virtual DeviceLatencyTracker* GetOverall(void);
+
+    static DeviceLatencyTracker* GetOverallOfAllDevices(void);
+    static uint64_t GetCurrentTime(void);
+
+    // weight of a new sample is 1 / 2^EWMA_WEIGHT_SHIFT
+    static const uint32_t EWMA_WEIGHT_SHIFT = 3;
+
+private:
+    void _Update(uint64_t latencyNs);
+
+    std::atomic<uint64_t> average;
+    std::atomic<uint64_t> sampleCount;
+    DeviceLatencyTracker* overall;
+};
+} // namespace pos
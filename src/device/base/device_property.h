@@ -65,6 +65,14 @@ public:
     std::string fr;
     std::string bdf;
     int numa;
+    // zoneSize is in bytes and valid only for a zoned namespace
+    bool zoned = false;
+    uint64_t zoneSize = 0;
+    // Limits of the nvme copy command, valid only if copySupported
+    bool copySupported = false;
+    uint32_t maxCopyRanges = 0;
+    uint32_t maxCopyRangeSectors = 0;
+    uint32_t maxCopySectors = 0;
 };
 
 } // namespace pos
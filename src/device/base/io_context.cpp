@@ -153,6 +153,16 @@ IOContext::GetBuffer(void)
     return ubio->GetBuffer();
 }
 
+const std::vector<struct iovec>*
+IOContext::GetIoVectors(void)
+{
+    if (ubio->IsVectored())
+    {
+        return &ubio->GetIoVectors();
+    }
+    return nullptr;
+}
+
 uint64_t
 IOContext::GetStartByteOffset(void)
 {
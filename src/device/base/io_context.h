@@ -32,9 +32,12 @@
 
 #pragma once
 
+#include <sys/uio.h>
+
 #include <list>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "src/bio/ubio.h"
 #include "src/dump/dump_shared_ptr.h"
@@ -64,6 +67,8 @@ public:
     virtual UbioDir GetOpcode(void);
 
     virtual void* GetBuffer(void);
+    // Returns nullptr when the buffer of the io is contiguous
+    virtual const std::vector<struct iovec>* GetIoVectors(void);
 
     virtual uint64_t GetStartByteOffset(void);
     virtual uint64_t GetByteCount(void);
@@ -120,7 +120,12 @@ UBlockDevice::~UBlockDevice(void)
 bool
 UBlockDevice::_RegisterThread(void)
 {
-    bool ret = _RegisterContextToCurrentCore(_AllocateDeviceContext());
+    DeviceContext* devCtx = _AllocateDeviceContext();
+    if (nullptr != devCtx)
+    {
+        devCtx->SetLatencyTracker(&latencyTracker);
+    }
+    bool ret = _RegisterContextToCurrentCore(devCtx);
     if (ret == false)
     {
         POS_EVENT_ID eventId = EID(DEVICE_THREAD_REGISTERED_FAILED);
@@ -188,6 +193,12 @@ UBlockDevice::WrapupOpenDeviceSpecific(void)
     return true;
 }
 
+DeviceLatencyTracker*
+UBlockDevice::GetLatencyTracker(void)
+{
+    return &latencyTracker;
+}
+
 bool
 UBlockDevice::_CloseDeviceDriver(DeviceContext* deviceContextToClose)
 {
@@ -302,6 +313,14 @@ UBlockDevice::SetDedicatedIOWorker(IOWorker* ioWorker)
     dedicatedIOWorker = ioWorker;
 }
 
+// Ubios which are already queued to the previous IOWorker are forwarded
+// by that IOWorker to the new one
+void
+UBlockDevice::ChangeDedicatedIOWorker(IOWorker* ioWorker)
+{
+    dedicatedIOWorker = ioWorker;
+}
+
 IOWorker*
 UBlockDevice::GetDedicatedIOWorker(void)
 {
@@ -41,6 +41,7 @@
 
 #include "device_property.h"
 #include "src/bio/ubio.h"
+#include "src/device/base/device_latency_tracker.h"
 
 namespace pos
 {
@@ -78,8 +79,10 @@ public:
     virtual void SubtractPendingErrorCount(uint32_t errorsToSubtract = 1);
 
     virtual void SetDedicatedIOWorker(IOWorker* ioWorker);
+    virtual void ChangeDedicatedIOWorker(IOWorker* ioWorker);
     virtual IOWorker* GetDedicatedIOWorker(void);
     virtual bool WrapupOpenDeviceSpecific(void);
+    virtual DeviceLatencyTracker* GetLatencyTracker(void);
 
 protected:
     virtual DeviceContext* _AllocateDeviceContext(void) = 0;
@@ -108,7 +111,8 @@ private:
     std::atomic<bool> completeErrorAsSuccess;
     std::atomic<uint32_t> deviceContextCount;
     std::atomic<uint32_t> detachedFunctionProcessing;
-    IOWorker* dedicatedIOWorker;
+    std::atomic<IOWorker*> dedicatedIOWorker;
+    DeviceLatencyTracker latencyTracker;
 };
 
 } // namespace pos
@@ -34,6 +34,7 @@
 
 #include "spdk/include/spdk/nvme_spec.h"
 #include "src/admin/disk_query_manager.h"
+#include "src/bio/copy_command.h"
 #include "src/bio/ubio.h"
 #include "src/include/pos_error_code.hpp"
 #include "src/logger/logger.h"
@@ -61,9 +62,10 @@ UnvmeCmd::RequestIO(UnvmeDeviceContext* deviceContext,
     spdk_nvme_cmd_cb callbackFunc, UnvmeIOContext* ioCtx)
 {
     struct spdk_nvme_ns* ns = deviceContext->ns;
-    struct spdk_nvme_qpair* ioqpair = deviceContext->ioQPair;
-
     UbioDir dir = ioCtx->GetOpcode();
+    struct spdk_nvme_qpair* ioqpair =
+        deviceContext->GetIoQPair(dir, ioCtx->GetEventType());
+
     uint64_t startLBA = ioCtx->GetStartSectorOffset();
     uint64_t sectorCount = ioCtx->GetSectorCount();
     void* data = ioCtx->GetBuffer();
@@ -74,6 +76,11 @@ UnvmeCmd::RequestIO(UnvmeDeviceContext* deviceContext,
     {
         case UbioDir::Read:
         {
+            if (ioCtx->GetIoVectors() != nullptr)
+            {
+                ret = _RequestVectoredIO(deviceContext, callbackFunc, ioCtx);
+                break;
+            }
             ret = spdkNvmeCaller->SpdkNvmeNsCmdRead(ns, ioqpair, data,
                 startLBA, sectorCount,
                 callbackFunc, static_cast<void*>(ioCtx), 0);
@@ -81,6 +88,17 @@ UnvmeCmd::RequestIO(UnvmeDeviceContext* deviceContext,
         }
         case UbioDir::Write:
         {
+            if (ioCtx->GetIoVectors() != nullptr)
+            {
+                ret = _RequestVectoredIO(deviceContext, callbackFunc, ioCtx);
+                break;
+            }
+            if (_IsPlacementTaggable(deviceContext, ioCtx))
+            {
+                ret = _RequestPlacementTaggedWrite(deviceContext,
+                    callbackFunc, ioCtx);
+                break;
+            }
             ret = spdkNvmeCaller->SpdkNvmeNsCmdWrite(ns, ioqpair, data,
                 startLBA, sectorCount,
                 callbackFunc, static_cast<void*>(ioCtx), 0);
@@ -98,6 +116,12 @@ UnvmeCmd::RequestIO(UnvmeDeviceContext* deviceContext,
                 callbackFunc, ioCtx);
             break;
         }
+        case UbioDir::Copy:
+        {
+            ret = _RequestCopy(deviceContext,
+                callbackFunc, ioCtx);
+            break;
+        }
         case UbioDir::Abort:
         {
             AbortContext* abortContext = static_cast<AbortContext*>(data);
@@ -177,6 +201,43 @@ UnvmeCmd::RequestIO(UnvmeDeviceContext* deviceContext,
     return ret;
 }
 
+// Scattered buffers are passed to spdk through the sgl callbacks, which get the io context
+// as their argument. Namespaces without sgl support take them as prp list, so that every
+// io vector except the first one should start at page boundary
+int
+UnvmeCmd::_RequestVectoredIO(UnvmeDeviceContext* deviceContext,
+    spdk_nvme_cmd_cb callbackFunc, UnvmeIOContext* ioCtx)
+{
+    struct spdk_nvme_ns* ns = deviceContext->ns;
+    UbioDir dir = ioCtx->GetOpcode();
+    struct spdk_nvme_qpair* ioqpair =
+        deviceContext->GetIoQPair(dir, ioCtx->GetEventType());
+    uint64_t startLBA = ioCtx->GetStartSectorOffset();
+    uint64_t sectorCount = ioCtx->GetSectorCount();
+
+    if (dir == UbioDir::Write)
+    {
+        return spdkNvmeCaller->SpdkNvmeNsCmdWritev(ns, ioqpair,
+            startLBA, sectorCount, callbackFunc, static_cast<void*>(ioCtx), 0,
+            &UnvmeCmd::_ResetSgl, &UnvmeCmd::_GetNextSge);
+    }
+    return spdkNvmeCaller->SpdkNvmeNsCmdReadv(ns, ioqpair,
+        startLBA, sectorCount, callbackFunc, static_cast<void*>(ioCtx), 0,
+        &UnvmeCmd::_ResetSgl, &UnvmeCmd::_GetNextSge);
+}
+
+void
+UnvmeCmd::_ResetSgl(void* ioContext, uint32_t sglOffset)
+{
+    static_cast<UnvmeIOContext*>(ioContext)->ResetSgl(sglOffset);
+}
+
+int
+UnvmeCmd::_GetNextSge(void* ioContext, void** address, uint32_t* length)
+{
+    return static_cast<UnvmeIOContext*>(ioContext)->GetNextSge(address, length);
+}
+
 int
 UnvmeCmd::_RequestWriteUncorrectable(UnvmeDeviceContext* deviceContext,
     spdk_nvme_cmd_cb callbackFunc, UnvmeIOContext* ioCtx)
@@ -206,6 +267,56 @@ UnvmeCmd::_RequestWriteUncorrectable(UnvmeDeviceContext* deviceContext,
     return returnValue;
 }
 
+// spdk does not split raw commands by the max transfer size of the namespace,
+// so that larger writes go untagged as well as the vectored ones
+bool
+UnvmeCmd::_IsPlacementTaggable(UnvmeDeviceContext* deviceContext,
+    UnvmeIOContext* ioCtx)
+{
+    if (UnvmePlacementDirective_None == deviceContext->placementDirective)
+    {
+        return false;
+    }
+    uint64_t maxXferSize =
+        spdkNvmeCaller->SpdkNvmeNsGetMaxIoXferSize(deviceContext->ns);
+    return (ioCtx->GetByteCount() <= maxXferSize);
+}
+
+int
+UnvmeCmd::_RequestPlacementTaggedWrite(UnvmeDeviceContext* deviceContext,
+    spdk_nvme_cmd_cb callbackFunc, UnvmeIOContext* ioCtx)
+{
+    uint64_t startingLBA = ioCtx->GetStartSectorOffset();
+    uint32_t NumberOfLogicalBlocks = ioCtx->GetSectorCount() - 1; // Zero-based
+    UnvmePlacementClass placementClass =
+        UnvmeDeviceContext::GetPlacementClass(ioCtx->GetEventType());
+
+    struct spdk_nvme_ctrlr* ctrlr =
+        spdkNvmeCaller->SpdkNvmeNsGetCtrlr(deviceContext->ns);
+    struct spdk_nvme_qpair* ioqpair =
+        deviceContext->GetIoQPair(UbioDir::Write, ioCtx->GetEventType());
+    uint32_t namespaceID = spdkNvmeCaller->SpdkNvmeNsGetId(deviceContext->ns);
+    struct spdk_nvme_cmd cmd;
+    {
+        memset(&cmd, 0, sizeof(cmd));
+        cmd.opc = SPDK_NVME_OPC_WRITE;
+        cmd.nsid = namespaceID;
+        cmd.cdw10 = startingLBA & 0xFFFFFFFF;
+        cmd.cdw11 = startingLBA >> 32;
+        cmd.cdw12 = NumberOfLogicalBlocks |
+            (deviceContext->placementDirective << PLACEMENT_DTYPE_SHIFT);
+        cmd.cdw13 = static_cast<uint32_t>(
+            deviceContext->placementHandle[placementClass]) << PLACEMENT_DSPEC_SHIFT;
+    }
+    // The method copies spdk_nvme_cmd(cmd) inside the API,
+    // so we don't need to allocate it for async io.
+    int returnValue = spdkNvmeCaller->SpdkNvmeCtrlrCmdIoRaw(
+        ctrlr, ioqpair, &cmd,
+        ioCtx->GetBuffer(), ioCtx->GetByteCount(), callbackFunc,
+        static_cast<void*>(ioCtx));
+    return returnValue;
+}
+
 int
 UnvmeCmd::_RequestDeallocate(UnvmeDeviceContext* deviceContext,
     spdk_nvme_cmd_cb callbackFunc, UnvmeIOContext* ioCtx)
@@ -244,6 +355,53 @@ UnvmeCmd::_RequestDeallocate(UnvmeDeviceContext* deviceContext,
     return returnValue;
 }
 
+// The source ranges are the payload of the command. The buffer of the ioCtx
+// is dma-able, so that the ranges are sent in place
+int
+UnvmeCmd::_RequestCopy(UnvmeDeviceContext* deviceContext,
+    spdk_nvme_cmd_cb callbackFunc, UnvmeIOContext* ioCtx)
+{
+    CopyCommand* copyCommand = static_cast<CopyCommand*>(ioCtx->GetBuffer());
+    if (copyCommand->rangeCount == 0 ||
+        copyCommand->rangeCount > CopyCommand::MAX_RANGES)
+    {
+        POS_TRACE_ERROR(EID(DEVICE_DEBUG_MSG),
+            "Invalid range count of copy : {} ", copyCommand->rangeCount);
+        return -EINVAL;
+    }
+    uint64_t startingLBA = ioCtx->GetStartSectorOffset();
+    uint32_t NumberOfRanges = copyCommand->rangeCount - 1; // Zero-based
+
+    struct spdk_nvme_ctrlr* ctrlr =
+        spdkNvmeCaller->SpdkNvmeNsGetCtrlr(deviceContext->ns);
+    struct spdk_nvme_qpair* ioqpair =
+        deviceContext->GetIoQPair(UbioDir::Copy, ioCtx->GetEventType());
+    uint32_t namespaceID = spdkNvmeCaller->SpdkNvmeNsGetId(deviceContext->ns);
+    struct spdk_nvme_cmd cmd;
+    {
+        memset(&cmd, 0, sizeof(cmd));
+        cmd.opc = COPY_OPCODE;
+        cmd.nsid = namespaceID;
+        cmd.cdw10 = startingLBA & 0xFFFFFFFF;
+        cmd.cdw11 = startingLBA >> 32;
+        cmd.cdw12 = NumberOfRanges; // Descriptor format 0 in bits 11:08
+        if (UnvmePlacementDirective_None != deviceContext->placementDirective)
+        {
+            UnvmePlacementClass placementClass =
+                UnvmeDeviceContext::GetPlacementClass(ioCtx->GetEventType());
+            cmd.cdw12 |= (deviceContext->placementDirective << PLACEMENT_DTYPE_SHIFT);
+            cmd.cdw13 = static_cast<uint32_t>(
+                deviceContext->placementHandle[placementClass]) << PLACEMENT_DSPEC_SHIFT;
+        }
+    }
+    int returnValue = spdkNvmeCaller->SpdkNvmeCtrlrCmdIoRaw(
+        ctrlr, ioqpair, &cmd,
+        copyCommand->ranges,
+        copyCommand->rangeCount * sizeof(CopySourceRange), callbackFunc,
+        static_cast<void*>(ioCtx));
+    return returnValue;
+}
+
 int
 UnvmeCmd::_RequestAdminPassThu(UnvmeDeviceContext* deviceContext,
     spdk_nvme_cmd_cb callbackFunc, UnvmeIOContext* ioCtx)
@@ -56,14 +56,32 @@ public:
         UnvmeIOContext* ioContext);
 
 private:
+    int _RequestVectoredIO(UnvmeDeviceContext* deviceContext,
+        spdk_nvme_cmd_cb callbackFunc,
+        UnvmeIOContext* ioContext);
+
+    static void _ResetSgl(void* ioContext, uint32_t sglOffset);
+    static int _GetNextSge(void* ioContext, void** address, uint32_t* length);
+
     int _RequestWriteUncorrectable(UnvmeDeviceContext* deviceContext,
         spdk_nvme_cmd_cb callbackFunc,
         UnvmeIOContext* ioContext);
 
+    bool _IsPlacementTaggable(UnvmeDeviceContext* deviceContext,
+        UnvmeIOContext* ioContext);
+
+    int _RequestPlacementTaggedWrite(UnvmeDeviceContext* deviceContext,
+        spdk_nvme_cmd_cb callbackFunc,
+        UnvmeIOContext* ioContext);
+
     int _RequestDeallocate(UnvmeDeviceContext* deviceContext,
         spdk_nvme_cmd_cb callbackFunc,
         UnvmeIOContext* ioCtx);
 
+    int _RequestCopy(UnvmeDeviceContext* deviceContext,
+        spdk_nvme_cmd_cb callbackFunc,
+        UnvmeIOContext* ioCtx);
+
     int _RequestAdminPassThu(UnvmeDeviceContext* deviceContext,
         spdk_nvme_cmd_cb callbackFunc,
         UnvmeIOContext* ioContext);
@@ -72,6 +90,12 @@ private:
         spdk_nvme_cmd_cb callbackFunc,
         UnvmeIOContext* ioContext);
 
+    // Directive type in bits 23:20 of cdw12, directive specific in bits 31:16 of cdw13
+    static const uint32_t PLACEMENT_DTYPE_SHIFT = 20;
+    static const uint32_t PLACEMENT_DSPEC_SHIFT = 16;
+    // Opcode of the copy command, which spdk_nvme_nvm_opcode may not have yet
+    static const uint8_t COPY_OPCODE = 0x19;
+
     SpdkNvmeCaller* spdkNvmeCaller;
 };
 } // namespace pos
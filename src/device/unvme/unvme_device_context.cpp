@@ -32,6 +32,8 @@
 
 #include "unvme_device_context.h"
 
+#include "src/bio/ubio.h"
+
 namespace pos
 {
 UnvmeDeviceContext::UnvmeDeviceContext(spdk_nvme_ns* ns)
@@ -59,4 +61,53 @@ UnvmeDeviceContext::IsAdminCommandPendingZero(void)
     return (adminCommandPending == 0);
 }
 
+UnvmeQpairClass
+UnvmeDeviceContext::GetQpairClass(UbioDir dir, BackendEvent eventType)
+{
+    if (BackendEvent_FrontendIO == eventType)
+    {
+        if (UbioDir::Read == dir)
+        {
+            return UnvmeQpairClass_FrontendRead;
+        }
+        if (UbioDir::Write == dir)
+        {
+            return UnvmeQpairClass_FrontendWrite;
+        }
+    }
+    return UnvmeQpairClass_Backend;
+}
+
+struct spdk_nvme_qpair*
+UnvmeDeviceContext::GetIoQPair(UbioDir dir, BackendEvent eventType)
+{
+    UnvmeQpairClass qpairClass = GetQpairClass(dir, eventType);
+    if (UnvmeQpairClass_Backend != qpairClass && nullptr != frontendQPair[qpairClass])
+    {
+        return frontendQPair[qpairClass];
+    }
+    return ioQPair;
+}
+
+// Host data is flushed from the write buffer, so that both frontend writes and
+// stripe flushes carry it. Gc and rebuild only move data which has already
+// outlived the host data around it
+UnvmePlacementClass
+UnvmeDeviceContext::GetPlacementClass(BackendEvent eventType)
+{
+    switch (eventType)
+    {
+        case BackendEvent_GC:
+        case BackendEvent_UserdataRebuild:
+            return UnvmePlacementClass_GcCold;
+        case BackendEvent_MetaIO:
+        case BackendEvent_FlushMap:
+            return UnvmePlacementClass_Metadata;
+        case BackendEvent_JournalIO:
+            return UnvmePlacementClass_Journal;
+        default:
+            return UnvmePlacementClass_HostHot;
+    }
+}
+
 } // namespace pos
@@ -34,10 +34,39 @@
 #define UNVME_DEVICE_CONTEXT_H_
 
 #include "src/device/base/device_context.h"
+#include "src/include/backend_event.h"
 #include "spdk/nvme.h"
 
 namespace pos
 {
+enum class UbioDir;
+
+enum UnvmeQpairClass
+{
+    UnvmeQpairClass_FrontendRead,
+    UnvmeQpairClass_FrontendWrite,
+    UnvmeQpairClass_Backend,
+    UnvmeQpairClass_Count,
+};
+
+// Writes are tagged by how long their data is expected to live
+enum UnvmePlacementClass
+{
+    UnvmePlacementClass_HostHot,
+    UnvmePlacementClass_GcCold,
+    UnvmePlacementClass_Metadata,
+    UnvmePlacementClass_Journal,
+    UnvmePlacementClass_Count,
+};
+
+// Values of the directive type field (DTYPE) of nvme write commands
+enum UnvmePlacementDirective
+{
+    UnvmePlacementDirective_None = 0,
+    UnvmePlacementDirective_Streams = 1,
+    UnvmePlacementDirective_Fdp = 2,
+};
+
 class UnvmeDeviceContext : public DeviceContext
 {
 public:
@@ -49,8 +78,17 @@ public:
 
     virtual bool IsAdminCommandPendingZero(void);
 
+    static UnvmeQpairClass GetQpairClass(UbioDir dir, BackendEvent eventType);
+    struct spdk_nvme_qpair* GetIoQPair(UbioDir dir, BackendEvent eventType);
+    static UnvmePlacementClass GetPlacementClass(BackendEvent eventType);
+
     struct spdk_nvme_ns* ns;
+    // ioQPair serves the backend and every class without its own qpair
     struct spdk_nvme_qpair* ioQPair;
+    struct spdk_nvme_qpair* frontendQPair[UnvmeQpairClass_Backend] = {nullptr, };
+    // Writes go untagged with UnvmePlacementDirective_None
+    uint32_t placementDirective = UnvmePlacementDirective_None;
+    uint16_t placementHandle[UnvmePlacementClass_Count] = {0, };
     uint32_t ioCompletionCount = 0;
     uint32_t adminCommandPending = 0;
 };
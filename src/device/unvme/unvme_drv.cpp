@@ -39,6 +39,7 @@
 
 #include "spdk/thread.h"
 #include "src/bio/ubio.h"
+#include "src/device/base/device_latency_tracker.h"
 #include "src/device/unvme/unvme_device_context.h"
 #include "src/device/unvme/unvme_io_context.h"
 #include "src/device/unvme/unvme_ssd.h"
@@ -195,6 +196,14 @@ AsyncIOComplete(void* ctx, const struct spdk_nvme_cpl* completion)
                 }
             }
 
+            DeviceLatencyTracker* latencyTracker = devCtx->GetLatencyTracker();
+            if (likely(nullptr != latencyTracker) &&
+                (UbioDir::Read == dir || UbioDir::Write == dir))
+            {
+                latencyTracker->Record(
+                    DeviceLatencyTracker::GetCurrentTime() - ioCtx->GetSubmitTime());
+            }
+
             devCtx->ioCompletionCount++;
             ioCtx->CompleteIo(IOErrorType::SUCCESS);
             delete ioCtx;
@@ -328,6 +337,10 @@ UnvmeDrv::_SubmitAsyncIOInternal(UnvmeDeviceContext* deviceContext,
     uint64_t ssdId {ioCtx->GetEncodedPCIeAddr()};
 
     ioCtx->ClearAsyncIOCompleted();
+    if (likely(nullptr != deviceContext->GetLatencyTracker()))
+    {
+        ioCtx->SetSubmitTime(DeviceLatencyTracker::GetCurrentTime());
+    }
     deviceContext->IncreasePendingIO();
     airlog("CNT_PendingIO", "ssd", ssdId, 1);
     airlog("SSD_Submit", "internal", ssdId, 1);
@@ -445,6 +458,15 @@ UnvmeDrv::_CompleteIOs(DeviceContext* deviceContext,
     // if admin command is failed to completion (including not-yet-processed)
     // Also try to complete io.
 
+    for (uint32_t qpairClass = 0; qpairClass < UnvmeQpairClass_Backend; qpairClass++)
+    {
+        if (nullptr != devCtx->frontendQPair[qpairClass])
+        {
+            spdkNvmeCaller->SpdkNvmeQpairProcessCompletions(
+                devCtx->frontendQPair[qpairClass], 0);
+        }
+    }
+
     returnCode =
         spdkNvmeCaller->SpdkNvmeQpairProcessCompletions(devCtx->ioQPair, 0);
 
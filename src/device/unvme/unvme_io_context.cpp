@@ -84,4 +84,49 @@ UnvmeIOContext::HasOutOfMemoryError(void)
     return outOfMemoryError;
 }
 
+void
+UnvmeIOContext::ResetSgl(uint32_t sglOffset)
+{
+    const std::vector<struct iovec>* ioVectors = GetIoVectors();
+
+    sgeIndex = 0;
+    sgeOffset = sglOffset;
+    while (ioVectors != nullptr && sgeIndex < ioVectors->size() &&
+        sgeOffset >= (*ioVectors)[sgeIndex].iov_len)
+    {
+        sgeOffset -= (*ioVectors)[sgeIndex].iov_len;
+        sgeIndex++;
+    }
+}
+
+int
+UnvmeIOContext::GetNextSge(void** address, uint32_t* length)
+{
+    const std::vector<struct iovec>* ioVectors = GetIoVectors();
+    if (ioVectors == nullptr || sgeIndex >= ioVectors->size())
+    {
+        return -1;
+    }
+
+    const struct iovec& ioVector = (*ioVectors)[sgeIndex];
+    *address = static_cast<uint8_t*>(ioVector.iov_base) + sgeOffset;
+    *length = ioVector.iov_len - sgeOffset;
+
+    sgeIndex++;
+    sgeOffset = 0;
+    return 0;
+}
+
+void
+UnvmeIOContext::SetSubmitTime(uint64_t timeNs)
+{
+    submitTime = timeNs;
+}
+
+uint64_t
+UnvmeIOContext::GetSubmitTime(void)
+{
+    return submitTime;
+}
+
 } // namespace pos
@@ -60,10 +60,20 @@ public:
     virtual void SetOutOfMemoryError(bool);
     virtual bool HasOutOfMemoryError(void);
 
+    // Iterates io vectors of the context for vectored nvme commands
+    virtual void ResetSgl(uint32_t sglOffset);
+    virtual int GetNextSge(void** address, uint32_t* length);
+
+    virtual void SetSubmitTime(uint64_t timeNs);
+    virtual uint64_t GetSubmitTime(void);
+
 private:
     UnvmeDeviceContext* devCtx;
     bool outOfMemoryError = false;
     bool frontEnd;
     bool adminCommand;
+    uint32_t sgeIndex = 0;
+    uint32_t sgeOffset = 0;
+    uint64_t submitTime = 0;
 };
 } // namespace pos
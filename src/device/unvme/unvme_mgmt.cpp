@@ -168,7 +168,7 @@ UnvmeMgmt::Open(DeviceContext* deviceContext)
                 struct spdk_nvme_ctrlr* ctrlr =
                     spdkCaller->SpdkNvmeNsGetCtrlr(devCtx->ns);
                 struct spdk_nvme_qpair* qpair =
-                    spdkCaller->SpdkNvmeCtrlrAllocIoQpair(ctrlr, NULL, 0);
+                    _AllocIoQPair(ctrlr, UnvmeQpairClass_Backend);
 
                 if (nullptr == qpair)
                 {
@@ -180,6 +180,11 @@ UnvmeMgmt::Open(DeviceContext* deviceContext)
                 {
                     devCtx->ioQPair = qpair;
                     openSuccessful = true;
+                    if (Nvme::IsQpairPerTrafficClassEnabled())
+                    {
+                        _AllocFrontendQPairs(devCtx, ctrlr);
+                    }
+                    _SetDataPlacement(devCtx, ctrlr);
                 }
             }
         }
@@ -196,27 +201,149 @@ UnvmeMgmt::Close(DeviceContext* deviceContext)
     {
         UnvmeDeviceContext* devCtx =
             static_cast<UnvmeDeviceContext*>(deviceContext);
-        if (nullptr != devCtx->ioQPair)
+        for (uint32_t qpairClass = 0; qpairClass < UnvmeQpairClass_Backend; qpairClass++)
         {
-            int retError = spdkCaller->SpdkNvmeCtrlrFreeIoQpair(devCtx->ioQPair);
-            if (0 != retError)
-            {
-                POS_EVENT_ID eventId = EID(UNVME_SSD_CLOSE_FAILED);
-                POS_TRACE_ERROR(static_cast<int>(eventId),
-                    "uNVMe Device close failed: namespace #{}",
-                    spdkCaller->SpdkNvmeNsGetId(devCtx->ns));
-                closeSuccessful = false;
-            }
-            else
-            {
-                devCtx->ioQPair = nullptr;
-            }
+            closeSuccessful &= _FreeIoQPair(devCtx, &devCtx->frontendQPair[qpairClass]);
         }
+        closeSuccessful &= _FreeIoQPair(devCtx, &devCtx->ioQPair);
     }
 
     return closeSuccessful;
 }
 
+bool
+UnvmeMgmt::_FreeIoQPair(UnvmeDeviceContext* devCtx, struct spdk_nvme_qpair** qpair)
+{
+    if (nullptr == *qpair)
+    {
+        return true;
+    }
+
+    int retError = spdkCaller->SpdkNvmeCtrlrFreeIoQpair(*qpair);
+    if (0 != retError)
+    {
+        POS_EVENT_ID eventId = EID(UNVME_SSD_CLOSE_FAILED);
+        POS_TRACE_ERROR(static_cast<int>(eventId),
+            "uNVMe Device close failed: namespace #{}",
+            spdkCaller->SpdkNvmeNsGetId(devCtx->ns));
+        return false;
+    }
+
+    *qpair = nullptr;
+    return true;
+}
+
+// Weighted round robin arbitration serves frontend reads first, then frontend
+// writes, then the backend, so that host reads are not queued behind large
+// flush, gc and rebuild writes. Without it, every qpair has the same priority
+// but the classes still do not share a submission queue.
+struct spdk_nvme_qpair*
+UnvmeMgmt::_AllocIoQPair(struct spdk_nvme_ctrlr* ctrlr, uint32_t qpairClass)
+{
+    if (false == Nvme::IsWrrArbitrationEnabled())
+    {
+        return spdkCaller->SpdkNvmeCtrlrAllocIoQpair(ctrlr, NULL, 0);
+    }
+
+    static const enum spdk_nvme_qprio QPRIO[UnvmeQpairClass_Count] = {
+        SPDK_NVME_QPRIO_HIGH, // UnvmeQpairClass_FrontendRead
+        SPDK_NVME_QPRIO_MEDIUM, // UnvmeQpairClass_FrontendWrite
+        SPDK_NVME_QPRIO_LOW // UnvmeQpairClass_Backend
+    };
+    struct spdk_nvme_io_qpair_opts opts;
+    spdkCaller->SpdkNvmeCtrlrGetDefaultIoQpairOpts(ctrlr, &opts, sizeof(opts));
+    opts.qprio = QPRIO[qpairClass];
+    return spdkCaller->SpdkNvmeCtrlrAllocIoQpair(ctrlr, &opts, sizeof(opts));
+}
+
+void
+UnvmeMgmt::_AllocFrontendQPairs(UnvmeDeviceContext* devCtx,
+    struct spdk_nvme_ctrlr* ctrlr)
+{
+    for (uint32_t qpairClass = 0; qpairClass < UnvmeQpairClass_Backend; qpairClass++)
+    {
+        if (nullptr != devCtx->frontendQPair[qpairClass])
+        {
+            continue;
+        }
+        // The device still works on its backend qpair only,
+        // if the controller runs out of io queues
+        devCtx->frontendQPair[qpairClass] = _AllocIoQPair(ctrlr, qpairClass);
+        if (nullptr == devCtx->frontendQPair[qpairClass])
+        {
+            POS_TRACE_WARN(EID(UNVME_SSD_OPEN_FAILED),
+                "Failed to allocate qpair for traffic class {}, namespace #{}",
+                qpairClass, spdkCaller->SpdkNvmeNsGetId(devCtx->ns));
+        }
+    }
+}
+
+// Writes are tagged by their placement class, so that a drive keeps host data,
+// gc copies, metadata and journal apart in its erase units. With FDP, a handle
+// is an index into the placement handle list of the namespace. With streams,
+// handle + 1 is the stream identifier, as stream 0 means no stream. Either
+// directive has to be set up on the drive in advance
+void
+UnvmeMgmt::_SetDataPlacement(UnvmeDeviceContext* devCtx,
+    struct spdk_nvme_ctrlr* ctrlr)
+{
+    std::string placement = "none";
+    Nvme::GetConfig("data_placement", &placement, CONFIG_TYPE_STRING);
+    if ("none" == placement)
+    {
+        return;
+    }
+
+    uint32_t directive = UnvmePlacementDirective_None;
+    if ("fdp" == placement)
+    {
+        directive = UnvmePlacementDirective_Fdp;
+    }
+    else if ("streams" == placement)
+    {
+        const struct spdk_nvme_ctrlr_data* cdata =
+            spdkCaller->SpdkNvmeCtrlrGetData(ctrlr);
+        if (nullptr != cdata && 0 != cdata->oacs.directives)
+        {
+            directive = UnvmePlacementDirective_Streams;
+        }
+    }
+    if (UnvmePlacementDirective_None == directive)
+    {
+        POS_TRACE_WARN(EID(UNVME_DATA_PLACEMENT_NOT_SUPPORTED),
+            "data_placement:{}, namespace #{}", placement,
+            spdkCaller->SpdkNvmeNsGetId(devCtx->ns));
+        return;
+    }
+
+    static const char* HANDLE_KEY[UnvmePlacementClass_Count] = {
+        "placement_handle_host", // UnvmePlacementClass_HostHot
+        "placement_handle_gc", // UnvmePlacementClass_GcCold
+        "placement_handle_meta", // UnvmePlacementClass_Metadata
+        "placement_handle_journal" // UnvmePlacementClass_Journal
+    };
+    for (uint32_t placementClass = 0; placementClass < UnvmePlacementClass_Count;
+         placementClass++)
+    {
+        uint32_t handle = placementClass;
+        Nvme::GetConfig(HANDLE_KEY[placementClass], &handle, CONFIG_TYPE_UINT32);
+        if (UnvmePlacementDirective_Streams == directive)
+        {
+            handle++;
+        }
+        devCtx->placementHandle[placementClass] = static_cast<uint16_t>(handle);
+    }
+    devCtx->placementDirective = directive;
+
+    POS_TRACE_INFO(EID(UNVME_DATA_PLACEMENT_ENABLED),
+        "data_placement:{}, namespace #{}, host:{}, gc:{}, meta:{}, journal:{}",
+        placement, spdkCaller->SpdkNvmeNsGetId(devCtx->ns),
+        devCtx->placementHandle[UnvmePlacementClass_HostHot],
+        devCtx->placementHandle[UnvmePlacementClass_GcCold],
+        devCtx->placementHandle[UnvmePlacementClass_Metadata],
+        devCtx->placementHandle[UnvmePlacementClass_Journal]);
+}
+
 int
 UnvmeMgmt::_CheckConstraints(const NsEntry* nsEntry)
 {
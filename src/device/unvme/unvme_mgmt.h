@@ -48,6 +48,7 @@ class Nvme;
 class NsEntry;
 class UnvmeDrv;
 class UBlockDevice;
+class UnvmeDeviceContext;
 
 class UnvmeMgmt
 {
@@ -62,6 +63,13 @@ public:
 
 private:
     int _CheckConstraints(const NsEntry* nsEntry);
+    struct spdk_nvme_qpair* _AllocIoQPair(struct spdk_nvme_ctrlr* ctrlr,
+        uint32_t qpairClass);
+    void _AllocFrontendQPairs(UnvmeDeviceContext* devCtx,
+        struct spdk_nvme_ctrlr* ctrlr);
+    bool _FreeIoQPair(UnvmeDeviceContext* devCtx, struct spdk_nvme_qpair** qpair);
+    void _SetDataPlacement(UnvmeDeviceContext* devCtx,
+        struct spdk_nvme_ctrlr* ctrlr);
 
     bool spdkInitDone;
     SpdkNvmeCaller* spdkCaller;
@@ -33,12 +33,14 @@
 #include "unvme_ssd.h"
 
 #include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <sstream>
 
 #include "src/include/branch_prediction.h"
 #include "src/include/pos_event_id.hpp"
 #include "src/logger/logger.h"
+#include "src/spdk_wrapper/nvme.hpp"
 #include "unvme_device_context.h"
 #include "unvme_drv.h"
 
@@ -96,6 +98,8 @@ UnvmeSsd::UnvmeSsd(
     }
 
     _ClassifyDevice(property);
+    _SetZoneProperty(property);
+    _SetCopyProperty(property);
 }
 
 // Exclude destructor of abstract class from function coverage report to avoid known issues in gcc/gcov
@@ -199,3 +203,68 @@ UnvmeSsd::_ClassifyDevice(DeviceProperty* property)
         }
     }
 }
+
+void
+UnvmeSsd::_SetZoneProperty(DeviceProperty* property)
+{
+    if (SPDK_NVME_CSI_ZNS != spdkNvmeCaller->SpdkNvmeNsGetCsi(ns))
+    {
+        return;
+    }
+
+    property->zoned = true;
+    property->zoneSize = spdkNvmeCaller->SpdkNvmeZnsNsGetZoneSize(ns);
+    POS_TRACE_INFO(EID(UNVME_ZONED_NAMESPACE_DETECTED),
+        "name:{}, sn:{}, zone_size:{}, zone_count:{}", property->name, property->sn,
+        property->zoneSize, spdkNvmeCaller->SpdkNvmeZnsNsGetNumZones(ns));
+}
+
+// The copy command is bit 8 of ONCS, and its limits (MSSRL, MCL, MSRC) are
+// at bytes 74 to 80 of the namespace data. They are read from the raw
+// structures, as older spdk releases do not name these fields
+void
+UnvmeSsd::_SetCopyProperty(DeviceProperty* property)
+{
+    bool enabled = false;
+    Nvme::GetConfig("simple_copy_enable", &enabled, CONFIG_TYPE_BOOL);
+    if (false == enabled)
+    {
+        return;
+    }
+
+    spdk_nvme_ctrlr* ctrlr = spdkNvmeCaller->SpdkNvmeNsGetCtrlr(ns);
+    const struct spdk_nvme_ctrlr_data* cdata =
+        spdkNvmeCaller->SpdkNvmeCtrlrGetData(ctrlr);
+    const struct spdk_nvme_ns_data* nsdata = spdkNvmeCaller->SpdkNvmeNsGetData(ns);
+    if (nullptr == cdata || nullptr == nsdata)
+    {
+        return;
+    }
+
+    const uint16_t ONCS_COPY = 1 << 8;
+    uint16_t oncs = 0;
+    memcpy(&oncs, &cdata->oncs, sizeof(oncs));
+    if (0 == (oncs & ONCS_COPY))
+    {
+        return;
+    }
+
+    const uint8_t* raw = reinterpret_cast<const uint8_t*>(nsdata);
+    uint16_t mssrl = 0;
+    uint32_t mcl = 0;
+    memcpy(&mssrl, raw + 74, sizeof(mssrl));
+    memcpy(&mcl, raw + 76, sizeof(mcl));
+    uint32_t msrc = static_cast<uint32_t>(raw[80]) + 1;
+    if (0 == mssrl || 0 == mcl)
+    {
+        return;
+    }
+
+    property->copySupported = true;
+    property->maxCopyRanges = msrc;
+    property->maxCopyRangeSectors = mssrl;
+    property->maxCopySectors = mcl;
+    POS_TRACE_INFO(EID(UNVME_SIMPLE_COPY_SUPPORTED),
+        "name:{}, sn:{}, max_ranges:{}, max_range_sectors:{}, max_sectors:{}",
+        property->name, property->sn, msrc, mssrl, mcl);
+}
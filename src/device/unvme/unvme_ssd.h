@@ -85,6 +85,8 @@ private:
         isSupportedExtendedSmart = true;
     }
     void _ClassifyDevice(DeviceProperty* property);
+    void _SetZoneProperty(DeviceProperty* property);
+    void _SetCopyProperty(DeviceProperty* property);
 
     UnvmeDrv* driver;
     spdk_nvme_ns* ns;
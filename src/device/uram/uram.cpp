@@ -69,8 +69,10 @@ uint32_t Uram::ioatReactorCountNuma1;
 Uram::Uram(std::string name,
     uint64_t size,
     UramDrv* driverToUse,
-    uint32_t numa)
+    uint32_t numa,
+    ConfigManager* configManager)
 : UBlockDevice(name, size, driverToUse),
+  copyOffloadThresholdBytes(DEFAULT_COPY_OFFLOAD_THRESHOLD_KB * SZ_1KB),
   baseByteAddress(nullptr)
 {
     property->type = DeviceType::NVRAM;
@@ -82,6 +84,7 @@ Uram::Uram(std::string name,
     reactorCount = AccelEngineApi::GetReactorCount();
     ioatReactorCountNuma0 = AccelEngineApi::GetIoatReactorCountPerNode(0);
     ioatReactorCountNuma1 = AccelEngineApi::GetIoatReactorCountPerNode(1);
+    _SetCopyOffloadThreshold(configManager);
 }
 
 // Exclude destructor of abstract class from function coverage report to avoid known issues in gcc/gcov
@@ -133,9 +136,24 @@ Uram::_RecoverBackup(void)
 
         uint64_t pageCountBackup = fileStat.st_size / bytesPerHugepage;
         uint32_t unitsPerHugepage = bytesPerHugepage / Ubio::BYTES_PER_UNIT;
+        uint64_t pageCountRestored = 0;
 
         for (uint64_t pageIndex = 0; pageIndex < pageCountBackup; pageIndex++)
         {
+            // Pages without data are left as holes by the backup script.
+            // Uram starts zero-filled, so only the pages holding data are restored.
+            off_t pageOffset = pageIndex * bytesPerHugepage;
+            off_t dataOffset = lseek(fd, pageOffset, SEEK_DATA);
+            if (dataOffset < 0)
+            {
+                break;
+            }
+            if (dataOffset >= pageOffset + bytesPerHugepage)
+            {
+                pageIndex = dataOffset / bytesPerHugepage - 1;
+                continue;
+            }
+
             UbioSmartPtr ubio(new Ubio(nullptr,
                 DivideUp(bytesPerHugepage, Ubio::BYTES_PER_UNIT), 0));
             ubio->dir = UbioDir::Write;
@@ -144,11 +162,15 @@ Uram::_RecoverBackup(void)
             CallbackSmartPtr callback(new UramRestoreCompletion(ubio));
             ubio->SetCallback(callback);
 
-            rc = read(fd, ubio->GetBuffer(), ubio->GetSize());
+            rc = pread(fd, ubio->GetBuffer(), ubio->GetSize(), pageOffset);
             if (bytesPerHugepage == rc)
             {
+                // Copies into uram are done by the accel engine on ioat reactors.
+                // Bound the pages in flight so that restore does not take up the whole hugepage pool.
+                UramRestoreCompletion::WaitPendingUbioBelow(MAX_PENDING_RESTORE_PAGES);
                 UramRestoreCompletion::IncreasePendingUbio();
-                IODispatcherSingleton::Instance()->Submit(ubio);   
+                IODispatcherSingleton::Instance()->Submit(ubio);
+                pageCountRestored++;
             }
             else
             {
@@ -159,6 +181,10 @@ Uram::_RecoverBackup(void)
                 throw std::make_pair(eventId, additionalMessage);
             }
         }
+
+        POS_TRACE_INFO(EID(URAM_RESTORE_DONE),
+            "name: {}, restored_pages: {}, skipped_pages: {}", property->name,
+            pageCountRestored, pageCountBackup - pageCountRestored);
     }
     catch (std::pair<POS_EVENT_ID, EventLevel> eventWithLevel)
     {
@@ -249,31 +275,81 @@ Uram::SubmitAsyncIO(UbioSmartPtr ubio)
 {
     UramDeviceContext* devCtx =
         static_cast<UramDeviceContext*>(_GetDeviceContext());
+    int core = 0;
     if (devCtx->bdev_desc == nullptr)
     {
-        int core = 0;
-        if (ioatReactorCountNuma1 == 0) // If running machine is VM or Ioat is not support.
-        {
-            core = AccelEngineApi::GetReactorByIndex(requestCount % reactorCount);
-        }
-        else
-        {
-            core = AccelEngineApi::GetIoatReactorByIndex(requestCount % ioatReactorCountNuma1 + ioatReactorCountNuma0);
-            if (unlikely(core < 0))
-            {
-                core = AccelEngineApi::GetIoatReactorByIndex(requestCount % reactorCount);
-            }
-        }
+        core = _GetReactor();
+    }
+    else if (_IsCopyOffloadTarget(ubio->GetSize(), AccelEngineApi::GetIoatReactorCount(),
+        AccelEngineApi::IsIoatReactorNow()))
+    {
+        core = AccelEngineApi::GetIoatReactorByIndex(requestCount % AccelEngineApi::GetIoatReactorCount());
+    }
+    else
+    {
+        return UBlockDevice::SubmitAsyncIO(ubio);
+    }
+
+    UbioSmartPtr* ubioArgument = new UbioSmartPtr(ubio);
+    EventFrameworkApiSingleton::Instance()->SendSpdkEvent(
+        core, _RequestAsyncIo, ubioArgument);
+
+    requestCount++;
+    return 1;
+}
 
-        UbioSmartPtr* ubioArgument = new UbioSmartPtr(ubio);
-        EventFrameworkApiSingleton::Instance()->SendSpdkEvent(
-            core, _RequestAsyncIo, ubioArgument);
+void
+Uram::_SetCopyOffloadThreshold(ConfigManager* configManager)
+{
+    uint64_t thresholdKb = DEFAULT_COPY_OFFLOAD_THRESHOLD_KB;
+    int ret = configManager->GetValue("ioat", "copy_offload_threshold_kb",
+        &thresholdKb, ConfigType::CONFIG_TYPE_UINT64);
+    if (ret == EID(SUCCESS))
+    {
+        copyOffloadThresholdBytes = thresholdKb * SZ_1KB;
+    }
+}
 
-        requestCount++;
-        return 1;
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Large copies into and out of uram are handed to the reactors
+ *           owning an ioat channel, where the malloc bdev copies them by dma.
+ *           The reactor the io came from does not spend its cycles on the
+ *           memcpy and goes on polling its queues, the io completes when the
+ *           copy does. A threshold of 0 keeps every io on its reactor.
+ */
+/* --------------------------------------------------------------------------*/
+bool
+Uram::_IsCopyOffloadTarget(uint64_t size, uint32_t ioatReactorCount, bool ioatReactorNow)
+{
+    if (copyOffloadThresholdBytes == 0 || size < copyOffloadThresholdBytes)
+    {
+        return false;
+    }
+    if (ioatReactorCount == 0)
+    {
+        return false;
     }
+    return (false == ioatReactorNow);
+}
 
-    return UBlockDevice::SubmitAsyncIO(ubio);
+int
+Uram::_GetReactor(void)
+{
+    int core = 0;
+    if (ioatReactorCountNuma1 == 0) // If running machine is VM or Ioat is not support.
+    {
+        core = AccelEngineApi::GetReactorByIndex(requestCount % reactorCount);
+    }
+    else
+    {
+        core = AccelEngineApi::GetIoatReactorByIndex(requestCount % ioatReactorCountNuma1 + ioatReactorCountNuma0);
+        if (unlikely(core < 0))
+        {
+            core = AccelEngineApi::GetIoatReactorByIndex(requestCount % reactorCount);
+        }
+    }
+    return core;
 }
 
 void
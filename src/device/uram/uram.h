@@ -36,6 +36,7 @@
 #include <string>
 
 #include "src/device/base/ublock_device.h"
+#include "src/master_context/config_manager.h"
 
 namespace pos
 {
@@ -49,22 +50,31 @@ public:
     explicit Uram(std::string name,
         uint64_t size,
         UramDrv* driverToUse,
-        uint32_t numa);
+        uint32_t numa,
+        ConfigManager* configManager = ConfigManagerSingleton::Instance());
     ~Uram(void) override;
     int SubmitAsyncIO(UbioSmartPtr ubio) override;
     void* GetByteAddress(void) override;
     bool WrapupOpenDeviceSpecific(void) override;
 
+protected:
+    bool _IsCopyOffloadTarget(uint64_t size, uint32_t ioatReactorCount, bool ioatReactorNow);
+
 private:
     static const uint32_t MAX_THREAD_COUNT = 128;
     static const int32_t MAX_NUMA_COUNT = 2;
+    static const uint32_t MAX_PENDING_RESTORE_PAGES = 64;
+    static const uint64_t DEFAULT_COPY_OFFLOAD_THRESHOLD_KB = 128;
     static uint32_t reactorCount;
     static uint32_t ioatReactorCountNuma0;
     static uint32_t ioatReactorCountNuma1;
     std::atomic<uint32_t> requestCount;
+    uint64_t copyOffloadThresholdBytes;
     DeviceContext* _AllocateDeviceContext(void) override;
     void _ReleaseDeviceContext(DeviceContext* deviceContextToRelease) override;
     void _InitByteAddress(void);
+    void _SetCopyOffloadThreshold(ConfigManager* configManager);
+    int _GetReactor(void);
     static void _RequestAsyncIo(void* arg1);
     bool _RecoverBackup(void);
     void *baseByteAddress;
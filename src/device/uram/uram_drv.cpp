@@ -337,19 +337,47 @@ UramDrv::_RequestIO(UramDeviceContext* devCtx,
     uint64_t offset = ioCtx->GetStartByteOffset();
     uint64_t sizeInBytes = ioCtx->GetByteCount();
     void* data = ioCtx->GetBuffer();
+    const std::vector<struct iovec>* ioVectors = ioCtx->GetIoVectors();
     int ret = EINVAL;
 
+    // The bdev layer takes the scattered buffers as they are
+    struct iovec* iov = nullptr;
+    int iovcnt = 0;
+    if (nullptr != ioVectors)
+    {
+        iov = const_cast<struct iovec*>(ioVectors->data());
+        iovcnt = static_cast<int>(ioVectors->size());
+    }
+
     switch (dir)
     {
         case UbioDir::Read:
-            ret = spdkBdevCaller->SpdkBdevRead(
-                desc, ioChannel, data, offset, sizeInBytes,
-                callbackFunc, static_cast<void*>(ioCtx));
+            if (nullptr != iov)
+            {
+                ret = spdkBdevCaller->SpdkBdevReadv(
+                    desc, ioChannel, iov, iovcnt, offset, sizeInBytes,
+                    callbackFunc, static_cast<void*>(ioCtx));
+            }
+            else
+            {
+                ret = spdkBdevCaller->SpdkBdevRead(
+                    desc, ioChannel, data, offset, sizeInBytes,
+                    callbackFunc, static_cast<void*>(ioCtx));
+            }
             break;
         case UbioDir::Write:
-            ret = spdkBdevCaller->SpdkBdevWrite(
-                desc, ioChannel, data, offset, sizeInBytes,
-                callbackFunc, static_cast<void*>(ioCtx));
+            if (nullptr != iov)
+            {
+                ret = spdkBdevCaller->SpdkBdevWritev(
+                    desc, ioChannel, iov, iovcnt, offset, sizeInBytes,
+                    callbackFunc, static_cast<void*>(ioCtx));
+            }
+            else
+            {
+                ret = spdkBdevCaller->SpdkBdevWrite(
+                    desc, ioChannel, data, offset, sizeInBytes,
+                    callbackFunc, static_cast<void*>(ioCtx));
+            }
             break;
         default:
             POS_TRACE_INFO(EID(DEVICE_INFO_MSG),
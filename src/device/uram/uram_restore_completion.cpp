@@ -56,7 +56,12 @@ void UramRestoreCompletion::IncreasePendingUbio(void)
 
 void UramRestoreCompletion::WaitPendingUbioZero(void)
 {
-    while (pendingUbio != 0)
+    WaitPendingUbioBelow(1);
+}
+
+void UramRestoreCompletion::WaitPendingUbioBelow(uint32_t count)
+{
+    while (pendingUbio >= count)
     {
         usleep(1);
     }
@@ -50,6 +50,8 @@ public:
 
     static void WaitPendingUbioZero(void);
 
+    static void WaitPendingUbioBelow(uint32_t count);
+
 private:
     bool _DoSpecificJob(void) override;
 
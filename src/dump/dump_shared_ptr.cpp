@@ -37,5 +37,6 @@ namespace pos
 {
 void* gDumpSharedModulePtr[static_cast<int>(DumpSharedPtrType::MAX_DUMP_PTR)];
 bool pos::DumpSharedModuleInstanceEnable::debugLevelEnable = false;
+uint32_t pos::DumpSharedModuleInstanceEnable::sampleRate = 1;
 
 } // namespace pos
@@ -75,6 +75,10 @@ public:
 private:
     static void* _New(std::size_t size);
     static void _Delete(void* ptr);
+    static bool _IsSampled(void);
+
+    static const uint64_t TRACKED = 1;
+    static thread_local uint32_t sampleCount;
 };
 
 class T;
@@ -90,10 +94,13 @@ public:
     int Delete(T t, bool lock_enable = true);
 };
 
+// Objects are tracked only with debug log level, and then one in sampleRate
+// of them per thread. Without IBOF_CONFIG_DUMP_SHARED_PTR, none is tracked
 class DumpSharedModuleInstanceEnable
 {
 public:
     static bool debugLevelEnable;
+    static uint32_t sampleRate;
 };
 
 template<typename T, int moduleNumber>
@@ -36,34 +36,70 @@
 #include <cstring>
 #include <string>
 
+#include "mk/ibof_config.h"
 #include "src/dump/dump_manager.h"
 #include "src/dump/dump_shared_ptr.h"
+#include "src/include/branch_prediction.h"
 #include "src/include/pos_event_id.h"
 #include "src/memory_checker/memory_checker.h"
+#include "src/memory_checker/object_pool.h"
 
 namespace pos
 {
 
 // Exclude destructor of abstract class from function coverage report to avoid known issues in gcc/gcov
 // LCOV_EXCL_START
+template<typename T, int moduleNumber>
+thread_local uint32_t DumpSharedPtr<T, moduleNumber>::sampleCount = 0;
+
 template<typename T, int moduleNumber>
 void*
 DumpSharedPtr<T, moduleNumber>::_New(std::size_t size)
 {
-    T ptr = static_cast<T>(MemoryChecker::New(size));
+    T ptr = static_cast<T>(ObjectPool::New(size));
 
-    DumpSharedModuleInstanceSingleton<T, moduleNumber>::Instance()->DumpInstance()->Add(ptr);
+#ifdef IBOF_CONFIG_DUMP_SHARED_PTR
+    if (unlikely(DumpSharedModuleInstanceEnable::debugLevelEnable) && _IsSampled())
+    {
+        DumpSharedModuleInstanceSingleton<T, moduleNumber>::Instance()->DumpInstance()->Add(ptr);
+        ObjectPool::SetTag(ptr, TRACKED);
+    }
+#endif
 
     return ptr;
 }
 
+// Only the objects tracked at allocation take the lock of the dump module
 template<typename T, int moduleNumber>
 void
 DumpSharedPtr<T, moduleNumber>::_Delete(void* ptr)
 {
-    DumpSharedModuleInstanceSingleton<T, moduleNumber>::Instance()->DumpInstance()->Delete((T)(ptr));
+#ifdef IBOF_CONFIG_DUMP_SHARED_PTR
+    if (nullptr != ptr && unlikely(TRACKED == ObjectPool::GetTag(ptr)))
+    {
+        DumpSharedModuleInstanceSingleton<T, moduleNumber>::Instance()->DumpInstance()->Delete((T)(ptr));
+    }
+#endif
+
+    ObjectPool::Delete(ptr);
+}
 
-    MemoryChecker::Delete(ptr);
+template<typename T, int moduleNumber>
+bool
+DumpSharedPtr<T, moduleNumber>::_IsSampled(void)
+{
+    uint32_t sampleRate = DumpSharedModuleInstanceEnable::sampleRate;
+    if (sampleRate <= 1)
+    {
+        return true;
+    }
+    sampleCount++;
+    if (sampleCount >= sampleRate)
+    {
+        sampleCount = 0;
+        return true;
+    }
+    return false;
 }
 
 template<typename T, int moduleNumber>
@@ -52,6 +52,11 @@ public:
     inline virtual EventSmartPtr PickWorkerEvent(EventWorker*);
     void CheckAndSetQueueOccupancy(BackendEvent eventId);
 
+protected:
+    std::atomic<int32_t> currentEventCount[BackendEvent_Count];
+    std::queue<EventSmartPtr> workerCommonQueue;
+    std::mutex workerQueueLock;
+
 private:
     int32_t _GetEventLimit(BackendEvent eventId);
     void _CheckAndSetAllowedLimit(void);
@@ -60,13 +65,10 @@ private:
     int32_t totalIOCount;
     uint32_t totalEventCount;
     std::atomic<int32_t> allowedEventCount[BackendEvent_Count];
-    std::atomic<int32_t> currentEventCount[BackendEvent_Count];
     std::atomic<uint32_t> cycleCount[BackendEvent_Count];
     std::atomic<int32_t> limit[BackendEvent_Count];
     SchedulerQueue* feEventQueue[FE_QUEUES];
     std::mutex frontendQueueLock[FE_QUEUES];
-    std::queue<EventSmartPtr> workerCommonQueue;
-    std::mutex workerQueueLock;
 };
 
 } // namespace pos
@@ -0,0 +1,319 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "backend_event_stealing_policy.h"
+
+#include <algorithm>
+
+#include "src/event_scheduler/event.h"
+#include "src/event_scheduler/event_worker.h"
+#include "src/include/branch_prediction.h"
+#include "src/qos/qos_common.h"
+
+namespace pos
+{
+BackendEventStealingPolicy::BackendEventStealingPolicy(
+    QosManager* qosManager,
+    std::vector<EventWorker*>* workerArray, uint32_t workerCount, uint32_t ioWorkerCount)
+: BackendEventRatioPolicy(qosManager, workerArray, workerCount, ioWorkerCount),
+  nextWorker(0),
+  overflowCount(0),
+  overflowPending(0)
+{
+    for (uint32_t workerId = 0; workerId < workerCount; workerId++)
+    {
+        workerContext.push_back(new WorkerContext);
+    }
+}
+
+BackendEventStealingPolicy::~BackendEventStealingPolicy(void)
+{
+    for (auto context : workerContext)
+    {
+        EventSmartPtr* box = nullptr;
+        while (nullptr != (box = context->deque.Pop()))
+        {
+            delete box;
+        }
+        delete context;
+    }
+    workerContext.clear();
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Build steal candidates for each worker
+ *           Peers on the same numa come first. With numa dedicated policy,
+ *           workers never steal across numa nodes.
+ */
+/* --------------------------------------------------------------------------*/
+void
+BackendEventStealingPolicy::Init(std::vector<uint32_t> iworkerIDPerNumaVector[RTE_MAX_NUMA_NODES],
+    std::vector<uint32_t> itotalWorkerIDVector, bool inumaDedicatedSchedulingPolicy)
+{
+    BackendEventRatioPolicy::Init(iworkerIDPerNumaVector, itotalWorkerIDVector, inumaDedicatedSchedulingPolicy);
+
+    for (uint32_t workerId = 0; workerId < workerContext.size(); workerId++)
+    {
+        std::vector<uint32_t>& victims = workerContext[workerId]->victims;
+        victims.clear();
+        uint32_t ownNuma = MAX_NUMA;
+        for (uint32_t numa = 0; numa < MAX_NUMA; numa++)
+        {
+            for (auto id : workerIDPerNumaVector[numa])
+            {
+                if (id == workerId)
+                {
+                    ownNuma = numa;
+                }
+            }
+        }
+        if (ownNuma < MAX_NUMA)
+        {
+            for (auto id : workerIDPerNumaVector[ownNuma])
+            {
+                if (id != workerId && id < workerContext.size())
+                {
+                    victims.push_back(id);
+                }
+            }
+        }
+        if (ownNuma < MAX_NUMA && numaDedicatedSchedulingPolicy)
+        {
+            continue;
+        }
+        for (uint32_t id = 0; id < workerContext.size(); id++)
+        {
+            bool sameNuma = (ownNuma < MAX_NUMA) &&
+                (std::find(workerIDPerNumaVector[ownNuma].begin(),
+                    workerIDPerNumaVector[ownNuma].end(), id) != workerIDPerNumaVector[ownNuma].end());
+            if (id != workerId && false == sameNuma)
+            {
+                victims.push_back(id);
+            }
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Hand admitted events to worker rings
+ *           DequeueEvents keeps the ratio budget of each BackendEvent,
+ *           so only events within the allowed count leave the scheduler.
+ *           Events that do not fit any ring fall back to the common queue.
+ */
+/* --------------------------------------------------------------------------*/
+int
+BackendEventStealingPolicy::Run(void)
+{
+    std::queue<EventSmartPtr> eventList = DequeueEvents();
+    if (unlikely(eventList.empty() || workerContext.empty()))
+    {
+        return QosReturnCode::FAILURE;
+    }
+    uint32_t contextCount = workerContext.size();
+    while (!eventList.empty())
+    {
+        EventSmartPtr event = eventList.front();
+        eventList.pop();
+        currentEventCount[event->GetEventType()]--;
+
+        bool pushed = false;
+        for (uint32_t tried = 0; tried < contextCount; tried++)
+        {
+            WorkerContext* context = workerContext[nextWorker];
+            nextWorker = (nextWorker + 1) % contextCount;
+            if (context->inbox.Push(event))
+            {
+                pushed = true;
+                break;
+            }
+        }
+        if (unlikely(false == pushed))
+        {
+            std::unique_lock<std::mutex> uniqueLock(workerQueueLock);
+            workerCommonQueue.push(event);
+            overflowPending++;
+            overflowCount++;
+        }
+    }
+    return QosReturnCode::SUCCESS;
+}
+
+EventSmartPtr
+BackendEventStealingPolicy::PickWorkerEvent(EventWorker* worker)
+{
+    uint32_t workerId = worker->GetId();
+    if (unlikely(workerId >= workerContext.size()))
+    {
+        return _PickOverflow();
+    }
+
+    WorkerContext* context = workerContext[workerId];
+    EventSmartPtr event = _PickLocal(context);
+    if (nullptr != event)
+    {
+        context->localPickCount++;
+        return event;
+    }
+    event = _Steal(context);
+    if (nullptr != event)
+    {
+        context->stealCount++;
+        return event;
+    }
+    return _PickOverflow();
+}
+
+uint64_t
+BackendEventStealingPolicy::GetLocalPickCount(void)
+{
+    uint64_t count = 0;
+    for (auto context : workerContext)
+    {
+        count += context->localPickCount;
+    }
+    return count;
+}
+
+uint64_t
+BackendEventStealingPolicy::GetStealCount(void)
+{
+    uint64_t count = 0;
+    for (auto context : workerContext)
+    {
+        count += context->stealCount;
+    }
+    return count;
+}
+
+uint64_t
+BackendEventStealingPolicy::GetOverflowCount(void)
+{
+    return overflowCount;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Pop own surplus first, then take the next event from the ring
+ *           Surplus in the ring is moved to the deque so that idle peers
+ *           can steal it while this worker is executing.
+ */
+/* --------------------------------------------------------------------------*/
+EventSmartPtr
+BackendEventStealingPolicy::_PickLocal(WorkerContext* context)
+{
+    EventSmartPtr* box = context->deque.Pop();
+    if (nullptr != box)
+    {
+        return _Unbox(box);
+    }
+
+    EventSmartPtr event = nullptr;
+    if (false == context->inbox.Pop(event))
+    {
+        return nullptr;
+    }
+
+    EventSmartPtr surplus = nullptr;
+    for (uint32_t count = 0; count < DRAIN_BATCH; count++)
+    {
+        // Only the owner pushes, so the deque cannot fill up after this check
+        if (context->deque.GetSize() >= context->deque.GetCapacity() ||
+            false == context->inbox.Pop(surplus))
+        {
+            break;
+        }
+        context->deque.Push(new EventSmartPtr(surplus));
+    }
+    return event;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Steal the oldest surplus event from the deepest peer
+ *           Steals follow the backlog that the ratio policy admitted,
+ *           so each BackendEvent keeps its share of the workers.
+ */
+/* --------------------------------------------------------------------------*/
+EventSmartPtr
+BackendEventStealingPolicy::_Steal(WorkerContext* context)
+{
+    WorkerContext* victim = nullptr;
+    uint32_t deepest = 0;
+    for (auto id : context->victims)
+    {
+        uint32_t depth = workerContext[id]->deque.GetSize();
+        if (depth > deepest)
+        {
+            deepest = depth;
+            victim = workerContext[id];
+        }
+    }
+    if (nullptr == victim)
+    {
+        return nullptr;
+    }
+
+    EventSmartPtr* box = victim->deque.Steal();
+    if (nullptr == box)
+    {
+        return nullptr;
+    }
+    return _Unbox(box);
+}
+
+EventSmartPtr
+BackendEventStealingPolicy::_PickOverflow(void)
+{
+    if (likely(overflowPending == 0))
+    {
+        return nullptr;
+    }
+    std::unique_lock<std::mutex> uniqueLock(workerQueueLock);
+    EventSmartPtr event = DequeueWorkerEvent();
+    if (nullptr != event)
+    {
+        overflowPending--;
+    }
+    return event;
+}
+
+EventSmartPtr
+BackendEventStealingPolicy::_Unbox(EventSmartPtr* box)
+{
+    EventSmartPtr event = std::move(*box);
+    delete box;
+    return event;
+}
+
+} // namespace pos
@@ -0,0 +1,99 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <queue>
+#include <vector>
+
+#include "src/event_scheduler/backend_event_ratio_policy.h"
+#include "src/lib/mpsc_ring.h"
+#include "src/lib/work_stealing_deque.h"
+
+namespace pos
+{
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Ratio policy without the worker common queue
+ *           Admitted events are handed to a bounded ring per worker,
+ *           idle workers steal the oldest surplus events from the busiest peer.
+ */
+/* --------------------------------------------------------------------------*/
+class BackendEventStealingPolicy : public BackendEventRatioPolicy
+{
+public:
+    BackendEventStealingPolicy(QosManager* qosManager, std::vector<EventWorker*>* workerArray, uint32_t workerCount, uint32_t ioWorkerCount = 1);
+    virtual ~BackendEventStealingPolicy(void);
+    void Init(std::vector<uint32_t> iworkerIDPerNumaVector[RTE_MAX_NUMA_NODES],
+        std::vector<uint32_t> itotalWorkerIDVector, bool inumaDedicatedSchedulingPolicy) override;
+    int Run(void) override;
+    EventSmartPtr PickWorkerEvent(EventWorker* worker) override;
+
+    uint64_t GetLocalPickCount(void);
+    uint64_t GetStealCount(void);
+    uint64_t GetOverflowCount(void);
+
+    static const uint32_t RING_DEPTH = 256;
+    static const uint32_t DEQUE_DEPTH = 256;
+    static const uint32_t DRAIN_BATCH = 32;
+
+private:
+    struct WorkerContext
+    {
+        WorkerContext(void)
+        : inbox(RING_DEPTH),
+          deque(DEQUE_DEPTH),
+          localPickCount(0),
+          stealCount(0)
+        {
+        }
+        MpscRing<EventSmartPtr> inbox;
+        WorkStealingDeque<EventSmartPtr> deque;
+        std::vector<uint32_t> victims;
+        std::atomic<uint64_t> localPickCount;
+        std::atomic<uint64_t> stealCount;
+    };
+
+    EventSmartPtr _PickLocal(WorkerContext* context);
+    EventSmartPtr _Steal(WorkerContext* context);
+    EventSmartPtr _PickOverflow(void);
+    static EventSmartPtr _Unbox(EventSmartPtr* box);
+
+    std::vector<WorkerContext*> workerContext;
+    uint32_t nextWorker;
+    std::atomic<uint64_t> overflowCount;
+    std::atomic<uint64_t> overflowPending;
+};
+
+} // namespace pos
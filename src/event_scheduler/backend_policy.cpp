@@ -83,6 +83,24 @@ BackendPolicy::Init(std::vector<uint32_t> iworkerIDPerNumaVector[RTE_MAX_NUMA_NO
     numaDedicatedSchedulingPolicy = inumaDedicatedSchedulingPolicy;
 }
 
+void
+BackendPolicy::SetArrayFairShare(bool enable, std::vector<uint32_t> arrayWeights)
+{
+    for (unsigned int event = 0; (BackendEvent)event < BackendEvent_Count; event++)
+    {
+        if (nullptr == eventQueue[event])
+        {
+            continue;
+        }
+        std::unique_lock<std::mutex> uniqueLock(queueLock[event]);
+        eventQueue[event]->SetArrayFairShare(enable);
+        for (uint32_t arrayId = 0; arrayId < arrayWeights.size(); arrayId++)
+        {
+            eventQueue[event]->SetArrayWeight(arrayId, arrayWeights[arrayId]);
+        }
+    }
+}
+
 bool
 BackendPolicy::_GetQueueOccupancy(BackendEvent eventId)
 {
@@ -57,7 +57,7 @@ public:
     BackendPolicy(QosManager* qosManagerArg,
         std::vector<EventWorker*>* workerArrayInput, uint32_t workerCount, uint32_t ioWorkerCount);
 
-    void Init(std::vector<uint32_t> iworkerIDPerNumaVector[RTE_MAX_NUMA_NODES],
+    virtual void Init(std::vector<uint32_t> iworkerIDPerNumaVector[RTE_MAX_NUMA_NODES],
         std::vector<uint32_t> itotalWorkerIDVector, bool inumaDedicatedSchedulingPolicy);
     virtual ~BackendPolicy();
     virtual void EnqueueEvent(EventSmartPtr input) = 0;
@@ -65,6 +65,7 @@ public:
     virtual int Run() = 0;
     virtual EventSmartPtr PickWorkerEvent(EventWorker*) = 0;
     virtual void CheckAndSetQueueOccupancy(BackendEvent eventId) = 0;
+    void SetArrayFairShare(bool enable, std::vector<uint32_t> arrayWeights);
 
     inline void IoEnqueued(BackendEvent type, uint64_t size)
     {
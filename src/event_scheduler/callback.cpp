@@ -206,6 +206,12 @@ Callback::InformError(IOErrorType inputIOErrorType)
     }
 }
 
+CallbackType
+Callback::GetCallbackType(void)
+{
+    return type;
+}
+
 void
 Callback::_InvokeCallee(void)
 {
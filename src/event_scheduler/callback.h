@@ -60,6 +60,7 @@ public:
     void SetWaitingCount(uint32_t inputWaitingCount);
     virtual void SetCallee(CallbackSmartPtr callee);
     void InformError(IOErrorType inputIOErrorType);
+    CallbackType GetCallbackType(void);
     static void SetTimeout(uint64_t timeout);
 
 protected:
@@ -76,6 +76,21 @@ enum CallbackType
     CallbackType_BackendLogWriteDone,
     CallbackType_StripePutEvent,
     CallbackType_FlushSubmission,
+    CallbackType_CoalescedIoCompletion,
+    CallbackType_SegmentTrimCompletion,
+    CallbackType_ReadCacheFillCompletion,
+    CallbackType_PartialBlockMergeCompletion,
+    CallbackType_FullStripeWriteCompletion,
+    CallbackType_RangeUnmapCompletion,
+    CallbackType_ParityWriteCompletion,
+    CallbackType_ReadAheadCompletion,
+    CallbackType_AioReadCompletion,
+    CallbackType_ChecksumVerifyCompletion,
+    CallbackType_ChecksumRepairCompletion,
+    CallbackType_GcCopyOffloadCompletion,
+    CallbackType_ContinuationCallback,
+    CallbackType_ReverseMapFooterLoadCompletion,
+    CallbackType_CoalescedWriteCompletion,
     Total_CallbackType_Cnt
 };
 }
\ No newline at end of file
@@ -0,0 +1,102 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2021 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <tuple>
+#include <utility>
+
+#include "src/event_scheduler/callback.h"
+#include "src/include/branch_prediction.h"
+
+namespace pos
+{
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Completion chain composed at compile time
+ *           Stages run inline, in order, right before the job of Base,
+ *           instead of each stage being a Callback linked by SetCallee.
+ *           A stage is a plain class with a non-virtual
+ *           "void Run(Callback& host, uint32_t errorCount)"; it reports
+ *           errors through host.InformError() so that they reach the callee
+ *           of Base as before.
+ *           Stages run only once even if Base asks to be retried.
+ */
+/* --------------------------------------------------------------------------*/
+template<typename Base, typename... Stages>
+class ComposedCallback final : public Base
+{
+public:
+    template<typename... Args>
+    explicit ComposedCallback(std::tuple<Stages...> stages, Args&&... args)
+    : Base(std::forward<Args>(args)...),
+      stages(std::move(stages)),
+      stagesDone(false)
+    {
+    }
+    ~ComposedCallback(void) override
+    {
+    }
+
+    template<std::size_t Index>
+    typename std::tuple_element<Index, std::tuple<Stages...>>::type&
+    GetStage(void)
+    {
+        return std::get<Index>(stages);
+    }
+
+private:
+    bool
+    _DoSpecificJob(void) override
+    {
+        if (likely(false == stagesDone))
+        {
+            _RunStages(std::index_sequence_for<Stages...>{});
+            stagesDone = true;
+        }
+        return Base::_DoSpecificJob();
+    }
+
+    template<std::size_t... Index>
+    void
+    _RunStages(std::index_sequence<Index...>)
+    {
+        uint32_t errorCount = this->_GetErrorCount();
+        int order[] = {0, (std::get<Index>(stages).Run(*this, errorCount), 0)...};
+        (void)order;
+    }
+
+    std::tuple<Stages...> stages;
+    bool stagesDone;
+};
+
+} // namespace pos
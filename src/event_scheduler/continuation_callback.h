@@ -0,0 +1,72 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <future>
+
+#include "src/event_scheduler/callback.h"
+
+namespace pos
+{
+// Runs on the event worker that completes the I/O, with the error count of the I/O
+using Continuation = std::function<void(uint32_t errorCount)>;
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Callback that runs a continuation instead of a dedicated
+ *           Callback class, so that a caller can chain the rest of its
+ *           work to an I/O without blocking a thread on it.
+ *           WithFuture() gives the completion as a std::future for
+ *           callers that have to wait, which sleep on it instead of
+ *           polling a flag.
+ */
+/* --------------------------------------------------------------------------*/
+class ContinuationCallback : public Callback
+{
+public:
+    explicit ContinuationCallback(Continuation continuation,
+        CallbackType type = CallbackType_ContinuationCallback);
+    ~ContinuationCallback(void) override;
+
+    static CallbackSmartPtr WithFuture(std::future<uint32_t>& future,
+        CallbackType type = CallbackType_ContinuationCallback);
+
+private:
+    bool _DoSpecificJob(void) override;
+
+    Continuation continuation;
+};
+
+} // namespace pos
@@ -42,6 +42,8 @@ namespace pos
 Event::Event(bool isFrontEndEvent, BackendEvent eventType, AffinityManager* affinityManagerArg)
 : frontEndEvent(isFrontEndEvent),
   event(eventType),
+  arrayId(UNKNOWN_ARRAY_ID),
+  enqueueTime(0),
   numa(INVALID_NUMA),
   affinityManager(affinityManagerArg)
 {
@@ -86,9 +88,39 @@ Event::GetNumaId(void)
     return 0;
 }
 
+void
+Event::SetNumaId(uint32_t numaId)
+{
+    numa = numaId;
+}
+
 void
 Event::SetEventType(BackendEvent eventType)
 {
     event = eventType;
 }
+
+void
+Event::SetArrayId(int arrayIdInput)
+{
+    arrayId = arrayIdInput;
+}
+
+int
+Event::GetArrayId(void)
+{
+    return arrayId;
+}
+
+void
+Event::SetEnqueueTime(uint64_t timeInNs)
+{
+    enqueueTime = timeInNs;
+}
+
+uint64_t
+Event::GetEnqueueTime(void)
+{
+    return enqueueTime;
+}
 } // namespace pos
@@ -56,13 +56,22 @@ public:
     void SetFrontEnd(bool state);
     virtual void SetEventType(BackendEvent event);
     uint32_t GetNumaId(void);
+    void SetNumaId(uint32_t numaId);
     virtual ~Event(void);
     virtual bool Execute(void) = 0;
     virtual bool IsFrontEnd(void);
+    void SetArrayId(int arrayId);
+    int GetArrayId(void);
+    void SetEnqueueTime(uint64_t timeInNs);
+    uint64_t GetEnqueueTime(void);
+
+    static const int UNKNOWN_ARRAY_ID = -1;
 
 private:
     bool frontEndEvent;
     BackendEvent event;
+    int arrayId;
+    uint64_t enqueueTime;
     uint32_t numa;
     AffinityManager* affinityManager;
 };
@@ -32,14 +32,17 @@
 
 #include "src/event_scheduler/event_scheduler.h"
 
+#include <sstream>
 #include <stdexcept>
 
 #include "src/cpu_affinity/affinity_manager.h"
 #include "src/device/i_io_dispatcher.h"
 #include "src/event_scheduler/backend_event_minimum_policy.h"
 #include "src/event_scheduler/backend_event_ratio_policy.h"
+#include "src/event_scheduler/backend_event_stealing_policy.h"
 #include "src/event_scheduler/event.h"
 #include "src/event_scheduler/event_queue.h"
+#include "src/event_scheduler/event_scheduler_statistics.h"
 #include "src/event_scheduler/event_worker.h"
 #include "src/event_scheduler/scheduler_queue.h"
 #include "src/event_scheduler/spdk_event_scheduler.h"
@@ -54,15 +57,23 @@ namespace pos
 {
 EventScheduler::EventScheduler(QosManager* qosManagerArg,
     ConfigManager* configManagerArg,
-    AffinityManager* affinityManagerArg)
+    AffinityManager* affinityManagerArg,
+    EventSchedulerStatistics* statisticsArg)
 : policy(nullptr),
   exit(false),
   workerCount(UINT32_MAX),
   schedulerThread(nullptr),
   numaDedicatedSchedulingPolicy(false),
+  workStealingSchedulingPolicy(false),
+  arrayFairShare(false),
   qosManager(qosManagerArg),
   configManager(configManagerArg),
-  affinityManager(affinityManagerArg)
+  affinityManager(affinityManagerArg),
+  statistics(statisticsArg),
+  elasticWorker(false),
+  minActiveWorkerCount(DEFAULT_MIN_ACTIVE_WORKER_COUNT),
+  wakeQueueDepthPerWorker(DEFAULT_WAKE_QUEUE_DEPTH_PER_WORKER),
+  activeWorkerCount(0)
 {
     CPU_ZERO(&schedulerCPUSet);
     bool enable = false;
@@ -77,6 +88,11 @@ EventScheduler::EventScheduler(QosManager* qosManagerArg,
         configManager = ConfigManagerSingleton::Instance();
     }
 
+    if (nullptr == statistics)
+    {
+        statistics = EventSchedulerStatisticsSingleton::Instance();
+    }
+
     // We fix the name of config as default
     int ret = configManager->GetValue("performance",
         "numa_dedicated", &enable, CONFIG_TYPE_BOOL);
@@ -85,6 +101,32 @@ EventScheduler::EventScheduler(QosManager* qosManagerArg,
         numaDedicatedSchedulingPolicy = enable;
     }
 
+    enable = false;
+    ret = configManager->GetValue("performance",
+        "work_stealing", &enable, CONFIG_TYPE_BOOL);
+    if (ret == EID(SUCCESS))
+    {
+        workStealingSchedulingPolicy = enable;
+    }
+
+    enable = false;
+    ret = configManager->GetValue("performance",
+        "array_fair_share_enable", &enable, CONFIG_TYPE_BOOL);
+    if (ret == EID(SUCCESS))
+    {
+        arrayFairShare = enable;
+    }
+
+    std::string weightList;
+    ret = configManager->GetValue("performance",
+        "array_fair_share_weights", &weightList, CONFIG_TYPE_STRING);
+    if (ret == EID(SUCCESS))
+    {
+        _LoadArrayWeights(weightList);
+    }
+
+    _LoadElasticWorkerConfig();
+
     if (nullptr == qosManager)
     {
         qosManager = QosManagerSingleton::Instance();
@@ -155,17 +197,166 @@ EventScheduler::Initialize(uint32_t workerCountInput,
         return;
     }
 
-    policy = new BackendEventRatioPolicy(qosManager, &workerArray, workerCountInput, affinityManager->GetCoreCount(CoreType::UDD_IO_WORKER));
+    uint32_t ioWorkerCount = affinityManager->GetCoreCount(CoreType::UDD_IO_WORKER);
+    if (workStealingSchedulingPolicy)
+    {
+        policy = new BackendEventStealingPolicy(qosManager, &workerArray, workerCountInput, ioWorkerCount);
+    }
+    else
+    {
+        policy = new BackendEventRatioPolicy(qosManager, &workerArray, workerCountInput, ioWorkerCount);
+    }
     policy->Init(workerIDPerNumaVector, totalWorkerIDVector, numaDedicatedSchedulingPolicy);
+    if (arrayFairShare)
+    {
+        policy->SetArrayFairShare(arrayFairShare, arrayWeights);
+        POS_TRACE_INFO(EID(EVTSCHDLR_ARRAY_FAIR_SHARE_ENABLED),
+            "array_count_with_weight: {}", arrayWeights.size());
+    }
 
+    if (elasticWorker && workStealingSchedulingPolicy)
+    {
+        elasticWorker = false;
+        POS_TRACE_WARN(EID(EVTSCHDLR_ELASTIC_WORKER_NOT_SUPPORTED),
+            "elastic event workers are not used with work stealing");
+    }
+    else if (elasticWorker)
+    {
+        POS_TRACE_INFO(EID(EVTSCHDLR_ELASTIC_WORKER_ENABLED),
+            "worker_count: {}, min_active_worker_count: {}, wake_queue_depth_per_worker: {}",
+            workerCount, minActiveWorkerCount, wakeQueueDepthPerWorker);
+    }
+    activeWorkerCount = workerCount;
+
+    statistics->SetWorkerCount(workerCount);
     for (unsigned int workerID = 0; workerID < workerCount; workerID++)
     {
         workerArray[workerID] =
-            new EventWorker(cpuSetVector.at(workerID), this, workerID);
+            new EventWorker(cpuSetVector.at(workerID), this, workerID, statistics);
     }
     schedulerThread = new std::thread(&EventScheduler::Run, this);
 }
 
+void
+EventScheduler::_LoadArrayWeights(std::string weightList)
+{
+    std::stringstream stream(weightList);
+    std::string token;
+    arrayWeights.clear();
+    while (std::getline(stream, token, ','))
+    {
+        uint32_t weight = SchedulerQueue::DEFAULT_ARRAY_WEIGHT;
+        try
+        {
+            weight = std::stoul(token);
+        }
+        catch (const std::exception& e)
+        {
+            POS_TRACE_WARN(EID(EVTSCHDLR_INVALID_ARRAY_WEIGHT),
+                "array_index: {}, weight: {}", arrayWeights.size(), token);
+        }
+        arrayWeights.push_back(weight);
+    }
+}
+
+void
+EventScheduler::_LoadElasticWorkerConfig(void)
+{
+    bool enable = false;
+    int ret = configManager->GetValue("performance",
+        "event_worker_elastic_enable", &enable, CONFIG_TYPE_BOOL);
+    if (ret != EID(SUCCESS) || false == enable)
+    {
+        return;
+    }
+    elasticWorker = true;
+
+    uint32_t value = 0;
+    ret = configManager->GetValue("performance",
+        "event_worker_min_active_count", &value, CONFIG_TYPE_UINT32);
+    if (ret == EID(SUCCESS) && 0 < value)
+    {
+        minActiveWorkerCount = value;
+    }
+
+    value = 0;
+    ret = configManager->GetValue("performance",
+        "event_worker_wake_queue_depth", &value, CONFIG_TYPE_UINT32);
+    if (ret == EID(SUCCESS) && 0 < value)
+    {
+        wakeQueueDepthPerWorker = value;
+    }
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Called by an EventWorker which found no event
+ *           A worker parks after a while of idle rounds, as long as
+ *           the minimum number of workers keeps polling.
+ *
+ * @Return   true if the worker has to park
+ */
+/* --------------------------------------------------------------------------*/
+bool
+EventScheduler::TryParkWorker(EventWorker* worker, uint32_t idleRounds)
+{
+    if (likely(false == elasticWorker || idleRounds < PARK_IDLE_ROUNDS))
+    {
+        return false;
+    }
+
+    uint32_t active = activeWorkerCount;
+    while (active > minActiveWorkerCount)
+    {
+        if (activeWorkerCount.compare_exchange_weak(active, active - 1))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t
+EventScheduler::GetActiveWorkerCount(void)
+{
+    return activeWorkerCount;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Wake a parked worker when the events waiting for workers
+ *           exceed what the polling workers are expected to hold
+ */
+/* --------------------------------------------------------------------------*/
+void
+EventScheduler::_WakeWorkersByQueueDepth(void)
+{
+    uint32_t active = activeWorkerCount;
+    if (active >= workerCount)
+    {
+        return;
+    }
+
+    int64_t queueDepth = 0;
+    for (uint32_t type = BackendEvent_Start; type < BackendEvent_Count; type++)
+    {
+        queueDepth += statistics->GetQueueDepth(static_cast<BackendEvent>(type));
+    }
+    if (queueDepth <= static_cast<int64_t>(active) * wakeQueueDepthPerWorker)
+    {
+        return;
+    }
+
+    for (auto worker : workerArray)
+    {
+        if (nullptr != worker && worker->Wakeup())
+        {
+            activeWorkerCount++;
+            return;
+        }
+    }
+}
+
 void
 EventScheduler::InjectIODispatcher(IIODispatcher* input)
 {
@@ -183,6 +374,7 @@ EventScheduler::EnqueueEvent(EventSmartPtr input)
 {
     if (!affinityManager->UseEventReactor())
     {
+        statistics->RecordEnqueue(input.get());
         policy->EnqueueEvent(input);
     }
     else
@@ -263,7 +455,12 @@ EventScheduler::Run(void)
         {
             ioDispatcher->ProcessQueues();
         }
-        if (QosReturnCode::FAILURE == policy->Run())
+        int ret = policy->Run();
+        if (elasticWorker)
+        {
+            _WakeWorkersByQueueDepth();
+        }
+        if (QosReturnCode::FAILURE == ret)
         {
             usleep(1);
         }
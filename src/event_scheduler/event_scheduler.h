@@ -39,6 +39,7 @@
 #include <cstdint>
 #include <mutex>
 #include <queue>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -52,6 +53,7 @@ class AffinityManager;
 class ConfigManager;
 class BackendPolicy;
 class EventQueue;
+class EventSchedulerStatistics;
 class EventWorker;
 class SchedulerQueue;
 class QosManager;
@@ -75,7 +77,8 @@ class EventScheduler
 public:
     EventScheduler(QosManager* qosManager = nullptr,
         ConfigManager* configManager = nullptr,
-        AffinityManager* affinityManager = nullptr);
+        AffinityManager* affinityManager = nullptr,
+        EventSchedulerStatistics* statistics = nullptr);
     virtual ~EventScheduler(void);
     void Initialize(uint32_t workerCountInput, cpu_set_t schedulerCPUInput,
         cpu_set_t eventCPUSetInput);
@@ -88,6 +91,8 @@ public:
     virtual void IoDequeued(BackendEvent type, uint64_t size);
     virtual EventSmartPtr PickWorkerEvent(EventWorker* worker);
     virtual void CheckAndSetQueueOccupancy(BackendEvent eventId);
+    virtual bool TryParkWorker(EventWorker* worker, uint32_t idleRounds);
+    uint32_t GetActiveWorkerCount(void);
     void Run(void);
     BackendPolicy* policy;
     void SetTerminate(bool value)
@@ -97,6 +102,9 @@ public:
 
 private:
     void _BuildCpuSet(cpu_set_t& cpuSet);
+    void _LoadArrayWeights(std::string weightList);
+    void _LoadElasticWorkerConfig(void);
+    void _WakeWorkersByQueueDepth(void);
     std::atomic<bool> exit;
     uint32_t workerCount;
     std::vector<EventWorker*> workerArray;
@@ -107,14 +115,25 @@ private:
     std::vector<uint32_t> workerIDPerNumaVector[MAX_NUMA];
     std::vector<uint32_t> totalWorkerIDVector;
     bool numaDedicatedSchedulingPolicy;
+    bool workStealingSchedulingPolicy;
+    bool arrayFairShare;
+    std::vector<uint32_t> arrayWeights;
     QosManager* qosManager;
     ConfigManager* configManager;
     AffinityManager* affinityManager;
     IIODispatcher* ioDispatcher;
+    EventSchedulerStatistics* statistics;
     std::atomic<bool> terminateStarted;
     static const uint32_t MAX_CORE = 128;
     uint32_t ioReactorCore[MAX_CORE];
     uint32_t ioReactorCount = 0;
+    bool elasticWorker;
+    uint32_t minActiveWorkerCount;
+    uint32_t wakeQueueDepthPerWorker;
+    std::atomic<uint32_t> activeWorkerCount;
+    static const uint32_t PARK_IDLE_ROUNDS = 10000;
+    static const uint32_t DEFAULT_MIN_ACTIVE_WORKER_COUNT = 1;
+    static const uint32_t DEFAULT_WAKE_QUEUE_DEPTH_PER_WORKER = 4;
 };
 
 using EventSchedulerSingleton = Singleton<EventScheduler>;
@@ -0,0 +1,224 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/event_scheduler/event_scheduler_statistics.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <functional>
+
+#include "src/telemetry/telemetry_client/easy_telemetry_publisher.h"
+#include "src/telemetry/telemetry_id.h"
+
+namespace pos
+{
+EventSchedulerStatistics::EventSchedulerStatistics(void)
+: lastFlushTime(GetTime()),
+  workerCount(0),
+  publisher(nullptr),
+  worker(nullptr),
+  isRunnable(false)
+{
+    for (uint32_t type = 0; type < BackendEvent_Count; type++)
+    {
+        queueDepth[type] = 0;
+    }
+    for (uint32_t workerId = 0; workerId < MAX_WORKER_COUNT; workerId++)
+    {
+        workers[workerId].busyTime = 0;
+        lastBusyTime[workerId] = 0;
+    }
+}
+
+EventSchedulerStatistics::~EventSchedulerStatistics(void)
+{
+    Dispose();
+}
+
+void
+EventSchedulerStatistics::Initialize(EasyTelemetryPublisher* tp)
+{
+    publisher = tp;
+    if (worker == nullptr)
+    {
+        isRunnable = true;
+        worker = new std::thread(std::bind(&EventSchedulerStatistics::_PeriodicFlush, this));
+    }
+}
+
+void
+EventSchedulerStatistics::Dispose(void)
+{
+    if (worker != nullptr)
+    {
+        isRunnable = false;
+        worker->join();
+        delete worker;
+        worker = nullptr;
+    }
+}
+
+void
+EventSchedulerStatistics::SetWorkerCount(uint32_t count)
+{
+    workerCount = std::min(count, static_cast<uint32_t>(MAX_WORKER_COUNT));
+}
+
+int64_t
+EventSchedulerStatistics::GetQueueDepth(BackendEvent type)
+{
+    if (type >= BackendEvent_Count)
+    {
+        return 0;
+    }
+    // an event may be picked before its enqueue has been counted
+    return std::max(queueDepth[type].load(std::memory_order_relaxed), static_cast<int64_t>(0));
+}
+
+uint64_t
+EventSchedulerStatistics::GetBusyTime(uint32_t workerId)
+{
+    if (workerId >= MAX_WORKER_COUNT)
+    {
+        return 0;
+    }
+    return workers[workerId].busyTime.load(std::memory_order_relaxed);
+}
+
+std::vector<uint64_t>
+EventSchedulerStatistics::CollectWaitTime(BackendEvent type)
+{
+    if (type >= BackendEvent_Count)
+    {
+        return std::vector<uint64_t>();
+    }
+    return waitTime[type].Collect();
+}
+
+void
+EventSchedulerStatistics::Flush(void)
+{
+    uint64_t now = GetTime();
+    uint64_t interval = now - lastFlushTime;
+    lastFlushTime = now;
+    _Publish(interval);
+}
+
+void
+EventSchedulerStatistics::_Publish(uint64_t intervalInNs)
+{
+    for (uint32_t type = 0; type < BackendEvent_Count; type++)
+    {
+        // collected even without a publisher, so that an interval starts at the previous flush
+        std::vector<uint64_t> counts = waitTime[type].CollectInterval();
+        if (publisher == nullptr)
+        {
+            continue;
+        }
+
+        VectorLabels labels;
+        labels.push_back({"event_type", GetEventTypeName(static_cast<BackendEvent>(type))});
+        publisher->UpdateGauge(TEL130030_EVENT_QUEUE_DEPTH,
+            GetQueueDepth(static_cast<BackendEvent>(type)), labels);
+        if (PerCoreHistogram::GetTotalCount(counts) == 0)
+        {
+            continue;
+        }
+        publisher->UpdateGauge(TEL130026_EVENT_WAIT_TIME_US_P50,
+            PerCoreHistogram::GetPercentile(counts, 0.5), labels);
+        publisher->UpdateGauge(TEL130027_EVENT_WAIT_TIME_US_P99,
+            PerCoreHistogram::GetPercentile(counts, 0.99), labels);
+        publisher->UpdateGauge(TEL130028_EVENT_WAIT_TIME_US_P999,
+            PerCoreHistogram::GetPercentile(counts, 0.999), labels);
+        publisher->UpdateGauge(TEL130029_EVENT_WAIT_TIME_US_MAX,
+            PerCoreHistogram::GetMax(counts), labels);
+    }
+
+    for (uint32_t workerId = 0; workerId < workerCount; workerId++)
+    {
+        uint64_t busyTime = GetBusyTime(workerId);
+        uint64_t busyInInterval = busyTime - lastBusyTime[workerId];
+        lastBusyTime[workerId] = busyTime;
+        if (publisher == nullptr || intervalInNs == 0)
+        {
+            continue;
+        }
+
+        VectorLabels labels;
+        labels.push_back({"worker_id", std::to_string(workerId)});
+        publisher->UpdateGauge(TEL130031_EVENT_WORKER_BUSY_PERCENT,
+            std::min(busyInInterval * 100 / intervalInNs, static_cast<uint64_t>(100)), labels);
+    }
+}
+
+void
+EventSchedulerStatistics::_PeriodicFlush(void)
+{
+    auto lastFlushed = std::chrono::steady_clock::now();
+    while (isRunnable)
+    {
+        auto now = std::chrono::steady_clock::now();
+        if (now - lastFlushed >= std::chrono::milliseconds(static_cast<uint32_t>(FLUSH_INTERVAL_IN_MS)))
+        {
+            lastFlushed = now;
+            Flush();
+        }
+        usleep(1000);
+    }
+}
+
+std::string
+EventSchedulerStatistics::GetEventTypeName(BackendEvent type)
+{
+    switch (type)
+    {
+        case BackendEvent_FrontendIO:
+            return "frontend_io";
+        case BackendEvent_Flush:
+            return "flush";
+        case BackendEvent_GC:
+            return "gc";
+        case BackendEvent_UserdataRebuild:
+            return "rebuild";
+        case BackendEvent_JournalIO:
+            return "journal_io";
+        case BackendEvent_MetaIO:
+            return "meta_io";
+        case BackendEvent_FlushMap:
+            return "flush_map";
+        default:
+            return "unknown";
+    }
+}
+
+} // namespace pos
@@ -0,0 +1,154 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "src/event_scheduler/event.h"
+#include "src/include/backend_event.h"
+#include "src/include/branch_prediction.h"
+#include "src/lib/singleton.h"
+#include "src/telemetry/telemetry_client/per_core_histogram.h"
+
+namespace pos
+{
+class EasyTelemetryPublisher;
+
+// Keeps, per BackendEvent, how long events wait from EnqueueEvent until an
+// EventWorker picks them and how many are waiting, and per EventWorker the
+// share of time spent executing events. Long waits with idle workers point
+// to the backend policy holding events back, long waits with busy workers
+// to a lack of workers.
+class EventSchedulerStatistics
+{
+public:
+    EventSchedulerStatistics(void);
+    virtual ~EventSchedulerStatistics(void);
+
+    virtual void Initialize(EasyTelemetryPublisher* tp);
+    virtual void Dispose(void);
+    virtual void SetWorkerCount(uint32_t count);
+
+    static inline uint64_t
+    GetTime(void)
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    inline void
+    RecordEnqueue(Event* event)
+    {
+        event->SetEnqueueTime(GetTime());
+        queueDepth[_GetIndex(event)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Returns the time of the pick, to be given to RecordExecution
+    inline uint64_t
+    RecordPick(Event* event)
+    {
+        uint64_t now = GetTime();
+        uint32_t index = _GetIndex(event);
+        uint64_t enqueueTime = event->GetEnqueueTime();
+        if (likely(enqueueTime != 0 && now >= enqueueTime))
+        {
+            queueDepth[index].fetch_sub(1, std::memory_order_relaxed);
+            waitTime[index].Record((now - enqueueTime) / 1000);
+        }
+        event->SetEnqueueTime(0);
+        return now;
+    }
+
+    inline void
+    RecordExecution(uint32_t workerId, uint64_t pickTime)
+    {
+        if (unlikely(workerId >= MAX_WORKER_COUNT))
+        {
+            return;
+        }
+        // only the worker itself writes its slot
+        uint64_t now = GetTime();
+        std::atomic<uint64_t>& busyTime = workers[workerId].busyTime;
+        busyTime.store(busyTime.load(std::memory_order_relaxed) + (now - pickTime),
+            std::memory_order_relaxed);
+    }
+
+    virtual int64_t GetQueueDepth(BackendEvent type);
+    virtual uint64_t GetBusyTime(uint32_t workerId);
+    virtual std::vector<uint64_t> CollectWaitTime(BackendEvent type);
+    // Publishes the statistics since the previous call
+    virtual void Flush(void);
+
+    static std::string GetEventTypeName(BackendEvent type);
+
+    static const uint32_t MAX_WORKER_COUNT = 128;
+
+private:
+    static inline uint32_t
+    _GetIndex(Event* event)
+    {
+        uint32_t type = static_cast<uint32_t>(event->GetEventType());
+        return (likely(type < BackendEvent_Count)) ? type : static_cast<uint32_t>(BackendEvent_Unknown);
+    }
+    void _Publish(uint64_t intervalInNs);
+    void _PeriodicFlush(void);
+
+    static const uint32_t FLUSH_INTERVAL_IN_MS = 1000;
+
+    // sized to a cache line so that workers do not share a written line
+    struct WorkerSlot
+    {
+        std::atomic<uint64_t> busyTime;
+        char padding[56];
+    };
+
+    PerCoreHistogram waitTime[BackendEvent_Count];
+    std::atomic<int64_t> queueDepth[BackendEvent_Count];
+    WorkerSlot workers[MAX_WORKER_COUNT];
+    uint64_t lastBusyTime[MAX_WORKER_COUNT];
+    uint64_t lastFlushTime;
+    std::atomic<uint32_t> workerCount;
+
+    EasyTelemetryPublisher* publisher;
+    std::thread* worker;
+    std::atomic<bool> isRunnable;
+};
+
+using EventSchedulerStatisticsSingleton = Singleton<EventSchedulerStatistics>;
+
+} // namespace pos
@@ -32,14 +32,17 @@
 
 #include "src/event_scheduler/event_worker.h"
 
+#include <sys/eventfd.h>
 #include <unistd.h>
 
+#include <cerrno>
 #include <iomanip>
 #include <thread>
 
 #include "src/event_scheduler/event.h"
 #include "src/event_scheduler/event_queue.h"
 #include "src/event_scheduler/event_scheduler.h"
+#include "src/event_scheduler/event_scheduler_statistics.h"
 #include "src/qos/qos_manager.h"
 #include "src/event_scheduler/backend_policy.h"
 
@@ -57,15 +60,23 @@ namespace pos
  */
 /* --------------------------------------------------------------------------*/
 EventWorker::EventWorker(cpu_set_t eventCPUPoolInput,
-    EventScheduler* eventSchedulerInput, uint32_t id)
+    EventScheduler* eventSchedulerInput, uint32_t id,
+    EventSchedulerStatistics* statistics)
 : eventQueue(new EventQueue),
   thread(nullptr),
   exit(false),
   eventCPUPool(eventCPUPoolInput),
   eventScheduler(eventSchedulerInput),
+  statistics(statistics),
   id(id),
-  running(false)
+  running(false),
+  parked(false),
+  wakeupFd(eventfd(0, EFD_CLOEXEC))
 {
+    if (nullptr == this->statistics)
+    {
+        this->statistics = EventSchedulerStatisticsSingleton::Instance();
+    }
     thread = new std::thread(&EventWorker::Run, this);
 }
 
@@ -77,9 +88,14 @@ EventWorker::EventWorker(cpu_set_t eventCPUPoolInput,
 EventWorker::~EventWorker(void)
 {
     exit = true;
+    Wakeup();
     thread->join();
     delete eventQueue;
     delete thread;
+    if (0 <= wakeupFd)
+    {
+        close(wakeupFd);
+    }
 }
 
 /* --------------------------------------------------------------------------*/
@@ -117,17 +133,30 @@ EventWorker::Run(void)
     pthread_setname_np(pthread_self(), name.str().c_str());
     sched_setaffinity(0, sizeof(eventCPUPool), &eventCPUPool);
 
+    uint32_t idleRounds = 0;
     while (exit == false)
     {
         EventSmartPtr event = eventScheduler->PickWorkerEvent(this);
         if (nullptr == event)
         {
-            usleep(1);
+            idleRounds++;
+            if (eventScheduler->TryParkWorker(this, idleRounds))
+            {
+                _Park();
+                idleRounds = 0;
+            }
+            else
+            {
+                usleep(1);
+            }
             continue;
         }
+        idleRounds = 0;
         running = true;
+        uint64_t pickTime = statistics->RecordPick(event.get());
         bool done = event->Execute();
         eventScheduler->CheckAndSetQueueOccupancy(event->GetEventType());
+        statistics->RecordExecution(id, pickTime);
         running = false;
         if (done == false)
         {
@@ -142,4 +171,65 @@ EventWorker::GetQueueSize(void)
     return eventQueue->GetQueueSize() + static_cast<uint32_t>(running);
 }
 
+uint32_t
+EventWorker::GetId(void)
+{
+    return id;
+}
+
+bool
+EventWorker::IsParked(void)
+{
+    return parked;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Let a parked worker poll again
+ *
+ * @Return   true if the worker was parked
+ */
+/* --------------------------------------------------------------------------*/
+bool
+EventWorker::Wakeup(void)
+{
+    if (parked.exchange(false) == false)
+    {
+        return false;
+    }
+    uint64_t count = 1;
+    if (write(wakeupFd, &count, sizeof(count)) != sizeof(count))
+    {
+        // the worker is still woken up by the next Wakeup()
+        parked = true;
+        return false;
+    }
+    return true;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Block on the eventfd instead of polling
+ *           A Wakeup() between setting parked and reading leaves the
+ *           counter set, so the read returns at once and no wakeup is lost.
+ */
+/* --------------------------------------------------------------------------*/
+void
+EventWorker::_Park(void)
+{
+    if (wakeupFd < 0)
+    {
+        return;
+    }
+    parked = true;
+    while (parked && exit == false)
+    {
+        uint64_t count;
+        if (read(wakeupFd, &count, sizeof(count)) < 0 && errno != EINTR)
+        {
+            parked = false;
+        }
+    }
+}
+
 } // namespace pos
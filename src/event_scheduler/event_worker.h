@@ -46,6 +46,7 @@ namespace pos
 {
 class EventQueue;
 class EventScheduler;
+class EventSchedulerStatistics;
 
 /* --------------------------------------------------------------------------*/
 /**
@@ -57,21 +58,30 @@ class EventWorker
 {
 public:
     EventWorker(cpu_set_t eventCPUPoolInput,
-        EventScheduler* eventSchedulerInput, uint32_t id);
+        EventScheduler* eventSchedulerInput, uint32_t id,
+        EventSchedulerStatistics* statistics = nullptr);
     ~EventWorker(void);
 
     void EnqueueEvent(EventSmartPtr Input);
     EventSmartPtr DequeueEvent();
     uint32_t GetQueueSize(void);
+    uint32_t GetId(void);
     void Run(void);
+    bool IsParked(void);
+    bool Wakeup(void);
 
 private:
+    void _Park(void);
+
     EventQueue* eventQueue;
     std::thread* thread;
     std::atomic<bool> exit;
     cpu_set_t eventCPUPool;
     EventScheduler* eventScheduler;
+    EventSchedulerStatistics* statistics;
     uint32_t id;
     std::atomic<bool> running;
+    std::atomic<bool> parked;
+    int wakeupFd;
 };
 } // namespace pos
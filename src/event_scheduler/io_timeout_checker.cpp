@@ -38,6 +38,7 @@
 #include "src/master_context/config_manager.h"
 #include "src/telemetry/telemetry_client/telemetry_publisher.h"
 #include "src/telemetry/telemetry_client/telemetry_client.h"
+#include "src/trace/flight_recorder.h"
 
 namespace pos
 {
@@ -49,9 +50,11 @@ currentIdx(0)
     for (int idx = 0; idx < CallbackType::Total_CallbackType_Cnt; idx++)
     {
         pendingIoCnt[idx].oldestIdx = 0;
-        for (uint32_t timeResolution = 0; timeResolution < CHECK_RESOLUTION_RANGE; timeResolution++)
+        pendingIoCnt[idx].stuckCnt = 0;
+        pendingIoCnt[idx].stuckOldestIdx = 0;
+        for (uint32_t slot = 0; slot < PENDING_IO_WHEEL_SIZE; slot++)
         {
-            pendingIoCnt[idx].pendingIoCnt[timeResolution] = 0;
+            pendingIoCnt[idx].baseCnt[slot] = 0;
         }
     }
     telemetryPublisher = new TelemetryPublisher("PublishPendingIo");
@@ -88,17 +91,28 @@ IoTimeoutChecker::MoveOldestIdx(CallbackType callbackType)
         return;
     }
 
-    uint32_t newPosition = pendingIoCnt[callbackType].oldestIdx;
-    while(pendingIoCnt[callbackType].pendingIoCnt[newPosition] == 0)
+    if (_GetStuckCnt(callbackType) > 0)
     {
-        if (newPosition == currentIdx)
+        pendingIoCnt[callbackType].oldestIdx = pendingIoCnt[callbackType].stuckOldestIdx;
+        return;
+    }
+
+    // Callbacks completing at PENDING_IO_STUCK_AGE are counted as stuck already,
+    // so the wheel is reliable only for younger ones
+    uint64_t current = currentIdx;
+    uint64_t newPosition = current;
+    for (uint32_t age = PENDING_IO_STUCK_AGE - 1; age > 0; age--)
+    {
+        uint64_t idx = (current + CHECK_RESOLUTION_RANGE - age) % CHECK_RESOLUTION_RANGE;
+        std::int64_t cnt = _GetPendingCnt(callbackType, idx % PENDING_IO_WHEEL_SIZE);
+        if (cnt > 0)
         {
+            newPosition = idx;
             break;
         }
-        newPosition++;
-        if (newPosition >= CHECK_RESOLUTION_RANGE)
+        else if (cnt < 0)
         {
-            newPosition = 0;
+            POS_TRACE_WARN(EID(INVALID_RANGE_OF_PENDING_IO_CHECKING), "Pending Callback Type : {} ", callbackType);
         }
     }
     pendingIoCnt[callbackType].oldestIdx = newPosition;
@@ -113,8 +127,26 @@ IoTimeoutChecker::MoveCurrentIdx(uint64_t pendingTime)
     }
 
     currentIdx = pendingTime;
+
+    // The next slot of the wheel is reused from the next tick. Whatever is still pending
+    // in it is moved to the stuck count, which callbacks completing late decrease instead.
+    // They switch to it a tick before this, so no late decrease reaches a reused slot.
+    uint32_t slot = (pendingTime + 1) % PENDING_IO_WHEEL_SIZE;
+    uint64_t slotIdx = (pendingTime + 1 + CHECK_RESOLUTION_RANGE - PENDING_IO_WHEEL_SIZE) % CHECK_RESOLUTION_RANGE;
     for (int idx = 0 ; idx < CallbackType::Total_CallbackType_Cnt; idx++)
     {
+        CallbackType callbackType = static_cast<CallbackType>(idx);
+        std::int64_t remaining = _GetPendingCnt(callbackType, slot);
+        if (remaining != 0)
+        {
+            if (_GetStuckCnt(callbackType) <= 0)
+            {
+                pendingIoCnt[idx].stuckOldestIdx = slotIdx;
+            }
+            pendingIoCnt[idx].baseCnt[slot] += remaining;
+            pendingIoCnt[idx].stuckCnt += remaining;
+        }
+
         if (currentIdx == pendingIoCnt[idx].oldestIdx)
         {
             POS_TRACE_WARN(EID(INVALID_RANGE_OF_PENDING_IO_CHECKING), "Invalid Range Type : {} ", idx);
@@ -123,30 +155,56 @@ IoTimeoutChecker::MoveCurrentIdx(uint64_t pendingTime)
 }
 
 void
-IoTimeoutChecker::IncreasePendingCnt(CallbackType callbackType, uint64_t pendingTime)
+IoTimeoutChecker::DecreasePendingCnt(CallbackType callbackType, uint64_t pendingTime)
 {
     if (false == initialize)
     {
         return;
     }
 
-    pendingIoCnt[callbackType].pendingIoCnt[pendingTime]++;
+    PendingIoShard* shard = shards.Get();
+    if (_GetAge(pendingTime, currentIdx.load(std::memory_order_relaxed)) >= PENDING_IO_STUCK_AGE)
+    {
+        shards.Add(shard, shard->stuckDoneCnt[callbackType], static_cast<std::int64_t>(1));
+    }
+    else
+    {
+        _Add(shard, callbackType, pendingTime % PENDING_IO_WHEEL_SIZE, -1);
+    }
 }
 
-void
-IoTimeoutChecker::DecreasePendingCnt(CallbackType callbackType, uint64_t pendingTime)
+std::int64_t
+IoTimeoutChecker::_SumPendingCnt(CallbackType callbackType, uint32_t slot)
 {
-    if (false == initialize)
+    std::int64_t sum = 0;
+    shards.ForEach([&](const PendingIoShard& shard)
     {
-        return;
-    }
+        sum += shard.pendingIoCnt[callbackType][slot].load(std::memory_order_relaxed);
+    });
+    return sum;
+}
 
-    pendingIoCnt[callbackType].pendingIoCnt[pendingTime]--;
+std::int64_t
+IoTimeoutChecker::_GetPendingCnt(CallbackType callbackType, uint32_t slot)
+{
+    return _SumPendingCnt(callbackType, slot) - pendingIoCnt[callbackType].baseCnt[slot];
+}
 
-    if (pendingIoCnt[callbackType].pendingIoCnt[pendingTime] < 0)
-    {        
-        POS_TRACE_WARN(EID(INVALID_RANGE_OF_PENDING_IO_CHECKING), "Pending Callback Type : {} ", callbackType);
-    }
+std::int64_t
+IoTimeoutChecker::_GetStuckCnt(CallbackType callbackType)
+{
+    std::int64_t done = 0;
+    shards.ForEach([&](const PendingIoShard& shard)
+    {
+        done += shard.stuckDoneCnt[callbackType].load(std::memory_order_relaxed);
+    });
+    return pendingIoCnt[callbackType].stuckCnt - done;
+}
+
+uint32_t
+IoTimeoutChecker::_GetAge(uint64_t from, uint64_t to)
+{
+    return (to + CHECK_RESOLUTION_RANGE - from) % CHECK_RESOLUTION_RANGE;
 }
 
 bool
@@ -174,6 +232,8 @@ IoTimeoutChecker::_CheckPeningOverTime(CallbackType callbackType)
     {
         POS_TRACE_WARN(EID(PENDING_IO_TIMEOUT), "Pending Callback Type : {} current Time Idx {}, oldest Time Idx {} ",
                                             callbackType, currentIdx, pendingIoCnt[callbackType].oldestIdx);
+        // keep what the array was doing before the I/O got stuck
+        FlightRecorderSingleton::Instance()->DumpOnTimeout();
         ret = true;
     }
 
@@ -219,27 +279,26 @@ IoTimeoutChecker::GetPendingIoCount(CallbackType callbackType, std::vector<int>
         return;
     }
 
-    POS_TRACE_INFO(EID(PENDING_IO_TIMEOUT), "currentIdx : {} oldestidx: {}", currentIdx, pendingIoCnt[callbackType].oldestIdx);
+    uint64_t current = currentIdx;
+    uint64_t oldest = pendingIoCnt[callbackType].oldestIdx;
+    POS_TRACE_INFO(EID(PENDING_IO_TIMEOUT), "currentIdx : {} oldestidx: {}", current, oldest);
 
-    if (currentIdx >= pendingIoCnt[callbackType].oldestIdx)
+    std::int64_t stuckCnt = _GetStuckCnt(callbackType);
+    if (stuckCnt > 0)
     {
-        for (uint32_t idx = pendingIoCnt[callbackType].oldestIdx ; idx < currentIdx; idx++)
-        {
-            pendingIoCntList.push_back(pendingIoCnt[callbackType].pendingIoCnt[idx]);
-        }
+        pendingIoCntList.push_back(stuckCnt);
     }
-    else
+
+    uint32_t oldestAge = _GetAge(oldest, current);
+    if (oldestAge >= PENDING_IO_STUCK_AGE)
     {
-        for (uint32_t idx = pendingIoCnt[callbackType].oldestIdx ; idx < CHECK_RESOLUTION_RANGE; idx++)
-        {
-            pendingIoCntList.push_back(pendingIoCnt[callbackType].pendingIoCnt[idx]);
-        }
-        for (uint32_t idx = 0 ; idx < currentIdx; idx++)
-        {
-            pendingIoCntList.push_back(pendingIoCnt[callbackType].pendingIoCnt[idx]);
-        }
+        oldestAge = PENDING_IO_STUCK_AGE - 1;
+    }
+    for (uint32_t age = oldestAge; age > 0; age--)
+    {
+        uint64_t idx = (current + CHECK_RESOLUTION_RANGE - age) % CHECK_RESOLUTION_RANGE;
+        pendingIoCntList.push_back(_GetPendingCnt(callbackType, idx % PENDING_IO_WHEEL_SIZE));
     }
-
 }
 
 } // namespace pos
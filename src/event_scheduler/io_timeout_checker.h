@@ -32,10 +32,12 @@
 
 #pragma once
 
+#include "src/lib/per_thread_shards.h"
 #include "src/lib/singleton.h"
 #include "src/event_scheduler/callback_type.h"
 #include "src/event_scheduler/publish_pending_io.h"
 
+#include <atomic>
 #include <vector>
 
 namespace pos
@@ -44,11 +46,27 @@ namespace pos
 const uint32_t CHECK_RESOLUTION_RANGE = 36000; // 1 hour
 const uint32_t TIMER_RESOLUTION_MS = 100;       // 100 ms
 const uint32_t CHECK_TIMEOUT_THRESHOLD = 30;    // 3s
+// Pending callbacks are counted in a timing wheel of this many ticks, which must divide
+// CHECK_RESOLUTION_RANGE. Callbacks pending longer than a turn of the wheel are counted as stuck.
+const uint32_t PENDING_IO_WHEEL_SIZE = 40;      // 4s
+const uint32_t PENDING_IO_STUCK_AGE = PENDING_IO_WHEEL_SIZE - 2;
+static_assert(CHECK_RESOLUTION_RANGE % PENDING_IO_WHEEL_SIZE == 0, "wheel must wrap with the rough time");
+static_assert(CHECK_TIMEOUT_THRESHOLD < PENDING_IO_STUCK_AGE, "timeouts must be found in the wheel");
 class TelemetryPublisher;
 
+// Counters of one thread in PerThreadShards. They are read by the checker thread without a lock.
+struct PendingIoShard
+{
+    std::atomic<std::int64_t> pendingIoCnt[CallbackType::Total_CallbackType_Cnt][PENDING_IO_WHEEL_SIZE];
+    std::atomic<std::int64_t> stuckDoneCnt[CallbackType::Total_CallbackType_Cnt];
+};
+
+// Per callback type state, owned by the checker thread
 struct PendingIo
 {
-    std::atomic<std::int64_t> pendingIoCnt[CHECK_RESOLUTION_RANGE];
+    std::int64_t baseCnt[PENDING_IO_WHEEL_SIZE];
+    std::int64_t stuckCnt;
+    std::uint64_t stuckOldestIdx;
     std::atomic<std::uint64_t> oldestIdx;
 };
 
@@ -60,7 +78,15 @@ public:
 
     void Initialize(void);
 
-    void IncreasePendingCnt(CallbackType callbackType, uint64_t pendingTime);
+    inline void
+    IncreasePendingCnt(CallbackType callbackType, uint64_t pendingTime)
+    {
+        if (false == initialize)
+        {
+            return;
+        }
+        _Add(shards.Get(), callbackType, pendingTime % PENDING_IO_WHEEL_SIZE, 1);
+    }
     void DecreasePendingCnt(CallbackType callbackType, uint64_t pendingTime);
 
     bool FindPendingIo(CallbackType callbackType);
@@ -71,15 +97,29 @@ public:
 
     uint64_t GetCurrentRoughTime(void);
 
+protected:
+    std::int64_t _GetPendingCnt(CallbackType callbackType, uint32_t slot);
+    std::int64_t _GetStuckCnt(CallbackType callbackType);
+
+    bool initialize;
+
 private:
 
     bool _CheckPeningOverTime(CallbackType callbackType);    
 
-    bool initialize;
+    inline void
+    _Add(PendingIoShard* shard, CallbackType callbackType, uint32_t slot, std::int64_t delta)
+    {
+        shards.Add(shard, shard->pendingIoCnt[callbackType][slot], delta);
+    }
+    std::int64_t _SumPendingCnt(CallbackType callbackType, uint32_t slot);
+    static uint32_t _GetAge(uint64_t from, uint64_t to);
+
     PublishPendingIo* publisher;
     std::atomic<std::uint64_t> currentIdx;
 
     PendingIo pendingIoCnt[CallbackType::Total_CallbackType_Cnt];
+    PerThreadShards<PendingIoShard> shards;
     TelemetryPublisher* telemetryPublisher;
 };
 
@@ -46,12 +46,19 @@ namespace pos
  */
 /* --------------------------------------------------------------------------*/
 SchedulerQueue::SchedulerQueue(QosManager* qosManager_)
-: qosManager(qosManager_)
+: currentSlot(0),
+  arrayFairShare(false),
+  qosManager(qosManager_)
 {
     if (nullptr == qosManager)
     {
         qosManager = QosManagerSingleton::Instance();
     }
+    for (uint32_t slot = 0; slot < SLOT_COUNT; slot++)
+    {
+        weight[slot] = DEFAULT_ARRAY_WEIGHT;
+        deficit[slot] = 0;
+    }
 }
 
 /* --------------------------------------------------------------------------*/
@@ -67,19 +74,38 @@ SchedulerQueue::~SchedulerQueue(void)
 /**
  * @Synopsis Pop oldest entry of queue
  *           Lock can be optimized with Boost library
+ *           Each slot may pop up to its weight in a row before the next
+ *           non-empty slot is served. Without array fair share, every event
+ *           stays in the shared slot and this is a plain FIFO.
  *
  * @Returns  If queue is empty, nullptr
- *           otherwise, oldest entry of queue
+ *           otherwise, oldest entry of the slot in turn
  */
 /* --------------------------------------------------------------------------*/
 EventSmartPtr
 SchedulerQueue::DequeueEvent(void)
 {
     EventSmartPtr event = nullptr;
-    if (false == queue.empty())
+    for (uint32_t visited = 0; visited < SLOT_COUNT; visited++)
     {
-        event = queue.front();
-        queue.pop();
+        std::queue<EventSmartPtr>& slotQueue = queue[currentSlot];
+        if (slotQueue.empty())
+        {
+            _MoveToNextSlot();
+            continue;
+        }
+        if (0 == deficit[currentSlot])
+        {
+            deficit[currentSlot] = weight[currentSlot];
+        }
+        event = slotQueue.front();
+        slotQueue.pop();
+        deficit[currentSlot]--;
+        if (0 == deficit[currentSlot] || slotQueue.empty())
+        {
+            _MoveToNextSlot();
+        }
+        break;
     }
     return event;
 }
@@ -101,7 +127,7 @@ SchedulerQueue::EnqueueEvent(EventSmartPtr input)
         return;
     }
 
-    queue.push(input);
+    queue[_GetSlot(input->GetArrayId())].push(input);
 
     if (false == input->IsFrontEnd())
     {
@@ -120,6 +146,71 @@ SchedulerQueue::EnqueueEvent(EventSmartPtr input)
 uint32_t
 SchedulerQueue::GetQueueSize(void)
 {
-    return queue.size();
+    uint32_t size = 0;
+    for (uint32_t slot = 0; slot < SLOT_COUNT; slot++)
+    {
+        size += queue[slot].size();
+    }
+    return size;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Enable or disable per array slots
+ *           Events already queued stay in their slot and are still dequeued
+ *
+ * @Param    enable
+ */
+/* --------------------------------------------------------------------------*/
+void
+SchedulerQueue::SetArrayFairShare(bool enable)
+{
+    arrayFairShare = enable;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Set how many events of the array can be popped in a row
+ *           Weight 0 is raised to 1 so that an array is never starved
+ *
+ * @Param    arrayId
+ * @Param    weight
+ */
+/* --------------------------------------------------------------------------*/
+void
+SchedulerQueue::SetArrayWeight(int arrayId, uint32_t weightInput)
+{
+    if (arrayId < 0 || arrayId >= ArrayMgmtPolicy::MAX_ARRAY_CNT)
+    {
+        return;
+    }
+    weight[arrayId] = (0 == weightInput) ? 1 : weightInput;
+}
+
+uint32_t
+SchedulerQueue::GetArrayWeight(int arrayId)
+{
+    if (arrayId < 0 || arrayId >= ArrayMgmtPolicy::MAX_ARRAY_CNT)
+    {
+        return weight[SHARED_SLOT];
+    }
+    return weight[arrayId];
+}
+
+uint32_t
+SchedulerQueue::_GetSlot(int arrayId)
+{
+    if (false == arrayFairShare || arrayId < 0 || arrayId >= ArrayMgmtPolicy::MAX_ARRAY_CNT)
+    {
+        return SHARED_SLOT;
+    }
+    return static_cast<uint32_t>(arrayId);
+}
+
+void
+SchedulerQueue::_MoveToNextSlot(void)
+{
+    deficit[currentSlot] = 0;
+    currentSlot = (currentSlot + 1) % SLOT_COUNT;
 }
 } // namespace pos
@@ -36,6 +36,7 @@
 #include <queue>
 
 #include "src/event_scheduler/event.h"
+#include "src/include/array_mgmt_policy.h"
 #include "src/include/smart_ptr_type.h"
 
 namespace pos
@@ -46,6 +47,9 @@ class QosManager;
 /* --------------------------------------------------------------------------*/
 /**
  * @Synopsis FIFO queue for event class with lock
+ *           When array fair share is enabled, events are kept per array and
+ *           dequeued by deficit round robin weighted with the array weight.
+ *           Events without array id share one extra slot.
  */
 /* --------------------------------------------------------------------------*/
 class SchedulerQueue
@@ -57,9 +61,23 @@ public:
     EventSmartPtr DequeueEvent(void);
     void EnqueueEvent(EventSmartPtr input);
     uint32_t GetQueueSize(void);
+    void SetArrayFairShare(bool enable);
+    void SetArrayWeight(int arrayId, uint32_t weight);
+    uint32_t GetArrayWeight(int arrayId);
+
+    static const uint32_t DEFAULT_ARRAY_WEIGHT = 1;
 
 private:
-    std::queue<EventSmartPtr> queue;
+    uint32_t _GetSlot(int arrayId);
+    void _MoveToNextSlot(void);
+
+    static const uint32_t SHARED_SLOT = ArrayMgmtPolicy::MAX_ARRAY_CNT;
+    static const uint32_t SLOT_COUNT = SHARED_SLOT + 1;
+    std::queue<EventSmartPtr> queue[SLOT_COUNT];
+    uint32_t weight[SLOT_COUNT];
+    uint32_t deficit[SLOT_COUNT];
+    uint32_t currentSlot;
+    bool arrayFairShare;
     QosManager* qosManager;
 };
 } // namespace pos
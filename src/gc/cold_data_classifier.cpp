@@ -0,0 +1,165 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/gc/cold_data_classifier.h"
+
+#include "src/allocator/context_manager/segment_ctx/segment_ctx.h"
+#include "src/allocator/i_context_manager.h"
+#include "src/allocator_service/allocator_service.h"
+#include "src/include/memory.h"
+#include "src/include/pos_event_id.h"
+#include "src/io/frontend_io/access_heatmap.h"
+#include "src/io/frontend_io/access_heatmap_service.h"
+#include "src/logger/logger.h"
+#include "src/master_context/config_manager.h"
+
+namespace pos
+{
+const uint32_t ColdDataClassifier::COLD_BLOCK_PERCENT;
+const uint32_t ColdDataClassifier::DEFAULT_MIN_AGE_IN_SEGMENTS;
+
+ColdDataClassifier::ColdDataClassifier(int arrayId, uint32_t stripesPerSegment)
+: ColdDataClassifier(arrayId, stripesPerSegment, ConfigManagerSingleton::Instance(), nullptr, nullptr)
+{
+}
+
+ColdDataClassifier::ColdDataClassifier(int arrayId, uint32_t stripesPerSegment,
+    ConfigManager* configManager, SegmentCtx* segmentCtx, AccessHeatmap* accessHeatmap)
+: arrayId(arrayId),
+  stripesPerSegment(stripesPerSegment),
+  enabled(false),
+  minAgeInStripes(static_cast<uint64_t>(DEFAULT_MIN_AGE_IN_SEGMENTS) * stripesPerSegment),
+  segmentCtx(segmentCtx),
+  accessHeatmap(accessHeatmap)
+{
+    if (configManager == nullptr || stripesPerSegment == 0)
+    {
+        return;
+    }
+
+    bool enable = false;
+    int ret = configManager->GetValue("gc_threshold", "cold_data_separation",
+        &enable, ConfigType::CONFIG_TYPE_BOOL);
+    if (ret != 0 || enable == false)
+    {
+        return;
+    }
+    enabled = true;
+
+    uint32_t minAgeInSegments = DEFAULT_MIN_AGE_IN_SEGMENTS;
+    ret = configManager->GetValue("gc_threshold", "cold_data_min_age_in_segments",
+        &minAgeInSegments, ConfigType::CONFIG_TYPE_UINT32);
+    if (ret == 0)
+    {
+        minAgeInStripes = static_cast<uint64_t>(minAgeInSegments) * stripesPerSegment;
+    }
+    POS_TRACE_INFO(EID(GC_THREHOLD_SETTING_PRINT),
+        "cold_data_separation:true, cold_data_min_age_in_segments:{}, array_id:{}",
+        minAgeInStripes / stripesPerSegment, arrayId);
+}
+
+bool
+ColdDataClassifier::IsEnabled(void)
+{
+    return enabled;
+}
+
+bool
+ColdDataClassifier::IsCold(uint32_t volumeId, const std::vector<BlkInfo>& blkInfos)
+{
+    if (enabled == false || _GetSegmentCtx() == nullptr)
+    {
+        return false;
+    }
+
+    uint32_t validCount = 0;
+    uint32_t coldCount = 0;
+    for (const BlkInfo& blkInfo : blkInfos)
+    {
+        if (blkInfo.volID == UINT32_MAX)
+        {
+            break;
+        }
+        validCount++;
+        if (_IsColdBlock(volumeId, blkInfo))
+        {
+            coldCount++;
+        }
+    }
+
+    return validCount != 0 && coldCount * 100 >= validCount * COLD_BLOCK_PERCENT;
+}
+
+bool
+ColdDataClassifier::_IsColdBlock(uint32_t volumeId, const BlkInfo& blkInfo)
+{
+    SegmentId segId = blkInfo.vsa.stripeId / stripesPerSegment;
+    if (segmentCtx->GetSegmentAge(segId) < minAgeInStripes)
+    {
+        return false;
+    }
+
+    AccessHeatmap* heatmap = _GetAccessHeatmap();
+    if (heatmap == nullptr || heatmap->IsEnabled() == false)
+    {
+        return true;
+    }
+    uint64_t bucket = heatmap->GetBucket(ChangeBlockToSector(blkInfo.rba));
+    return heatmap->GetEstimate(volumeId, bucket, true) == 0 &&
+        heatmap->GetEstimate(volumeId, bucket, false) == 0;
+}
+
+SegmentCtx*
+ColdDataClassifier::_GetSegmentCtx(void)
+{
+    if (segmentCtx == nullptr)
+    {
+        IContextManager* contextManager = AllocatorServiceSingleton::Instance()->GetIContextManager(arrayId);
+        if (contextManager != nullptr)
+        {
+            segmentCtx = contextManager->GetSegmentCtx();
+        }
+    }
+    return segmentCtx;
+}
+
+AccessHeatmap*
+ColdDataClassifier::_GetAccessHeatmap(void)
+{
+    if (accessHeatmap == nullptr)
+    {
+        accessHeatmap = AccessHeatmapServiceSingleton::Instance()->GetAccessHeatmap(arrayId);
+    }
+    return accessHeatmap;
+}
+
+} // namespace pos
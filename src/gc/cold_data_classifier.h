@@ -0,0 +1,78 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "src/gc/victim_stripe.h"
+
+namespace pos
+{
+class AccessHeatmap;
+class ConfigManager;
+class SegmentCtx;
+
+// Tells whether the blocks of a gc write buffer are cold, so that GC can place
+// them in their own segments apart from the data that is still being updated.
+// A block is cold when its victim segment has not changed for the configured
+// number of segments written, and its RBA bucket has no recent access in the
+// access heatmap (when the heatmap is enabled).
+class ColdDataClassifier
+{
+public:
+    ColdDataClassifier(int arrayId, uint32_t stripesPerSegment);
+    ColdDataClassifier(int arrayId, uint32_t stripesPerSegment, ConfigManager* configManager,
+        SegmentCtx* segmentCtx, AccessHeatmap* accessHeatmap);
+    virtual ~ColdDataClassifier(void) = default;
+
+    virtual bool IsEnabled(void);
+    virtual bool IsCold(uint32_t volumeId, const std::vector<BlkInfo>& blkInfos);
+
+    static const uint32_t COLD_BLOCK_PERCENT = 75;
+    static const uint32_t DEFAULT_MIN_AGE_IN_SEGMENTS = 4;
+
+private:
+    bool _IsColdBlock(uint32_t volumeId, const BlkInfo& blkInfo);
+    SegmentCtx* _GetSegmentCtx(void);
+    AccessHeatmap* _GetAccessHeatmap(void);
+
+    int arrayId;
+    uint32_t stripesPerSegment;
+    bool enabled;
+    uint64_t minAgeInStripes;
+    SegmentCtx* segmentCtx;
+    AccessHeatmap* accessHeatmap;
+};
+
+} // namespace pos
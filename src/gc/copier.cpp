@@ -34,6 +34,8 @@
 
 #include <air/Air.h>
 
+#include <algorithm>
+#include <chrono>
 #include <list>
 #include <memory>
 
@@ -44,12 +46,14 @@
 #include "src/allocator_service/allocator_service.h"
 #include "src/event_scheduler/event_scheduler.h"
 #include "src/gc/copier_read_completion.h"
+#include "src/gc/gc_copy_controller.h"
 #include "src/gc/reverse_map_load_completion.h"
 #include "src/gc/stripe_copy_submission.h"
 #include "src/include/backend_event.h"
 #include "src/io/general_io/io_submit_handler.h"
 #include "src/logger/logger.h"
 #include "src/metadata/segment_context_updater.h"
+#include "src/trace/flight_recorder.h"
 
 namespace pos
 {
@@ -62,6 +66,16 @@ Copier::Copier(SegmentId victimId, SegmentId targetId, GcStatus* gcStatus, IArra
 {
 }
 
+Copier::Copier(SegmentId victimId, SegmentId targetId, GcStatus* gcStatus, IArrayInfo* array,
+    GcStripeManager* sharedGcStripeManager)
+: Copier(victimId, targetId, gcStatus, array,
+      array->GetSizeInfo(PartitionType::USER_DATA), new CopierMeta(array, sharedGcStripeManager),
+      AllocatorServiceSingleton::Instance()->GetIBlockAllocator(array->GetName()),
+      AllocatorServiceSingleton::Instance()->GetIContextManager(array->GetName()),
+      nullptr, nullptr)
+{
+}
+
 Copier::Copier(SegmentId victimId, SegmentId targetId, GcStatus* gcStatus, IArrayInfo* array,
     const PartitionLogicalSize* udSize, CopierMeta* inputMeta,
     IBlockAllocator* inputIBlockAllocator,
@@ -83,6 +97,10 @@ Copier::Copier(SegmentId victimId, SegmentId targetId, GcStatus* gcStatus, IArra
     userDataMaxBlks = udSize->blksPerStripe * userDataMaxStripes;
     blocksPerChunk = udSize->blksPerChunk;
     SetEventType(BackendEvent_GC);
+    if (nullptr != array)
+    {
+        SetArrayId(array->GetIndex());
+    }
 }
 
 Copier::~Copier(void)
@@ -146,6 +164,7 @@ Copier::_Stop(void)
     }
 
     GcStripeManager* gcStripeManager = meta->GetGcStripeManager();
+    gcStripeManager->CloseCopyStripes();
     if (false == gcStripeManager->IsAllFinished())
     {
         return false;
@@ -183,6 +202,7 @@ Copier::_CompareThresholdState(void)
         uint32_t numFreeSegments = (uint32_t)segmentCtx->GetNumOfFreeSegment();
         uint32_t urgentThreshold = gcCtx->GetUrgentThreshold();
         uint32_t normalThreshold = gcCtx->GetNormalGcThreshold();
+        _UpdateCopyDepth(numFreeSegments, numFreeSegments <= urgentThreshold);
         if(victimCnt > gcBusyThreshold)
         {
             gcBusyRetryCnt++;
@@ -206,6 +226,8 @@ Copier::_CompareThresholdState(void)
 
         if (UNMAP_SEGMENT != victimId)
         {
+            FlightRecorderSingleton::Instance()->Record(FlightEventType::GcVictimStart, arrayId,
+                victimId, numFreeSegments);
             _InitVariables();
             _ChangeEventState(CopierStateType::COPIER_COPY_PREPARE_STATE);
 
@@ -241,14 +263,17 @@ Copier::_CopyPrepareState(void)
     {
         callee = stripeCopySubmissionPtr;
     }
-    callee->SetWaitingCount(userDataMaxStripes);
+    // Only the first readahead window is loaded here; stripe copiers load the rest ahead of themselves
+    uint32_t loadCount = std::min(userDataMaxStripes, CopierMeta::REVERSE_MAP_READAHEAD_COUNT);
+    callee->SetWaitingCount(loadCount);
+    meta->SetReverseMapReadahead(victimIndex, baseStripe, loadCount);
 
-    for (uint32_t index = 0; index < userDataMaxStripes; index++)
+    for (uint32_t index = 0; index < loadCount; index++)
     {
         CallbackSmartPtr callback;
         if (nullptr == reverseMapLoadCompletionPtr)
         {
-            callback = std::make_shared<ReverseMapLoadCompletion>();
+            callback = std::make_shared<ReverseMapLoadCompletion>(meta->GetVictimStripe(victimIndex, index));
         }
         else
         {
@@ -263,6 +288,8 @@ Copier::_CopyPrepareState(void)
 bool
 Copier::_CopyCompleteState(void)
 {
+    _PublishCopyDepth();
+
     bool ret = _IsSynchronized();
     if (false == ret)
     {
@@ -270,6 +297,11 @@ Copier::_CopyCompleteState(void)
     }
 
     POS_TRACE_DEBUG(EID(GC_COPY_COMPLETION), "victim_segment_id:{}", victimId);
+    // Device-side copies are not flushed by the force flush timer, so that
+    // no stripe of them stays open while GC waits for the next victim
+    meta->GetGcStripeManager()->CloseCopyStripes();
+    FlightRecorderSingleton::Instance()->Record(FlightEventType::GcVictimEnd, array->GetIndex(),
+        victimId, meta->GetDoneCopyBlks());
 
     uint32_t invalidBlkCnt = userDataMaxBlks - meta->GetDoneCopyBlks();
 
@@ -313,6 +345,34 @@ Copier::_IsAllVictimSegmentCopyDone(void)
     return ret;
 }
 
+void
+Copier::_UpdateCopyDepth(uint32_t numFreeSegments, bool isUrgent)
+{
+    GcCopyController* copyController = meta->GetCopyController();
+    if (nullptr == copyController)
+    {
+        return;
+    }
+
+    uint64_t nowUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    copyController->Update(numFreeSegments, isUrgent, nowUs);
+    _PublishCopyDepth();
+}
+
+void
+Copier::_PublishCopyDepth(void)
+{
+    GcCopyController* copyController = meta->GetCopyController();
+    if (nullptr == copyController)
+    {
+        return;
+    }
+
+    gcStatus->SetCopyDepth(copyController->GetTargetDepth(), copyController->GetCurrentDepth(),
+        copyController->GetReadBatch(), copyController->GetHostP99Us());
+}
+
 void
 Copier::_CleanUpVictimSegments(void)
 {
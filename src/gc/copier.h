@@ -62,6 +62,8 @@ class Copier : public Event
 {
 public:
     explicit Copier(SegmentId victimId, SegmentId targetId, GcStatus* gcStatus, IArrayInfo* array);
+    Copier(SegmentId victimId, SegmentId targetId, GcStatus* gcStatus, IArrayInfo* array,
+            GcStripeManager* sharedGcStripeManager);
     Copier(SegmentId victimId, SegmentId targetId, GcStatus* gcStatus, IArrayInfo* array,
             const PartitionLogicalSize* udSize, CopierMeta* inputMeta,
             IBlockAllocator* inputIBlockAllocator,
@@ -116,6 +118,11 @@ public:
     {
         return copybackState;
     }
+    virtual GcStripeManager*
+    GetGcStripeManager(void)
+    {
+        return meta->GetGcStripeManager();
+    }
 
 private:
     void _CompareThresholdState(void);
@@ -127,6 +134,8 @@ private:
     bool _IsSynchronized(void);
     bool _IsAllVictimSegmentCopyDone(void);
     void _CleanUpVictimSegments(void);
+    void _UpdateCopyDepth(uint32_t numFreeSegments, bool isUrgent);
+    void _PublishCopyDepth(void);
     void
     _ChangeEventState(CopierStateType state)
     {
@@ -32,38 +32,61 @@
 
 #include "src/gc/copier_meta.h"
 
+#include "src/gc/gc_copy_controller.h"
+#include "src/gc/reverse_map_load_completion.h"
 #include "src/include/meta_const.h"
 #include "src/logger/logger.h"
 #include "src/resource_manager/buffer_pool.h"
 #include "src/include/array_config.h"
 
+#include <algorithm>
+#include <memory>
 #include <string>
 
 namespace pos
 {
+const uint32_t CopierMeta::REVERSE_MAP_READAHEAD_COUNT;
+
 
 CopierMeta::CopierMeta(IArrayInfo* array)
 : CopierMeta(array, array->GetSizeInfo(PartitionType::USER_DATA),
     new BitMapMutex(GC_VICTIM_SEGMENT_COUNT), new GcStripeManager(array),
-    nullptr, nullptr)
+    nullptr, nullptr, MemoryManagerSingleton::Instance(), new GcCopyController())
 {
 }
 
+CopierMeta::CopierMeta(IArrayInfo* array, GcStripeManager* sharedGcStripeManager)
+: CopierMeta(array, array->GetSizeInfo(PartitionType::USER_DATA),
+    new BitMapMutex(GC_VICTIM_SEGMENT_COUNT), sharedGcStripeManager,
+    nullptr, nullptr, MemoryManagerSingleton::Instance(), new GcCopyController())
+{
+    // Destination stripes are shared with the other copiers of the array,
+    // and the copier that created them releases them
+    ownsGcStripeManager = false;
+}
+
 CopierMeta::CopierMeta(IArrayInfo* array, const PartitionLogicalSize* udSize,
                        BitMapMutex* inputInUseBitmap, GcStripeManager* inputGcStripeManager,
                        std::vector<std::vector<VictimStripe*>>* inputVictimStripes,
                        BufferPool* inputGcBufferPool,
-                       MemoryManager* memoryManager)
+                       MemoryManager* memoryManager,
+                       GcCopyController* inputCopyController)
 : inUseBitmap(inputInUseBitmap),
   gcStripeManager(inputGcStripeManager),
   arrayName(array->GetName()),
   arrayIndex(array->GetIndex()),
   victimStripes(inputVictimStripes),
   gcBufferPool(inputGcBufferPool),
-  memoryManager(memoryManager)
+  memoryManager(memoryManager),
+  copyController(inputCopyController)
 {
     stripesPerSegment = udSize->stripesPerSegment;
     blksPerStripe = udSize->blksPerStripe;
+    for (uint32_t index = 0; index < GC_VICTIM_SEGMENT_COUNT; index++)
+    {
+        readaheadBaseStripeId[index] = UNMAP_STRIPE;
+        readaheadOffset[index] = stripesPerSegment;
+    }
 
     if (nullptr == inputVictimStripes)
     {
@@ -99,7 +122,7 @@ CopierMeta::~CopierMeta(void)
         delete victimStripes;
     }
 
-    if (nullptr != gcStripeManager)
+    if (nullptr != gcStripeManager && true == ownsGcStripeManager)
     {
         delete gcStripeManager;
     }
@@ -107,6 +130,10 @@ CopierMeta::~CopierMeta(void)
     {
         delete inUseBitmap;
     }
+    if (nullptr != copyController)
+    {
+        delete copyController;
+    }
 }
 
 void
@@ -256,19 +283,54 @@ CopierMeta::GetVictimStripe(uint32_t victimSegmentIndex, uint32_t stripeOffset)
     return (*victimStripes)[victimSegmentIndex][stripeOffset];
 }
 
+void
+CopierMeta::SetReverseMapReadahead(uint32_t victimSegmentIndex, StripeId baseStripeId, uint32_t loadedCount)
+{
+    readaheadBaseStripeId[victimSegmentIndex] = baseStripeId;
+    readaheadOffset[victimSegmentIndex] = loadedCount;
+}
+
+void
+CopierMeta::LoadReverseMapAhead(uint32_t victimSegmentIndex, uint32_t endOffset)
+{
+    // Issue reverse map reads of the victim stripes in [readaheadOffset, endOffset) so that
+    // metadata of the next stripes is being read while the current ones are copied.
+    // Each offset is claimed by CAS, so concurrent stripe copiers never load a stripe twice.
+    endOffset = std::min(endOffset, stripesPerSegment);
+    uint32_t offset = readaheadOffset[victimSegmentIndex];
+    while (offset < endOffset)
+    {
+        if (readaheadOffset[victimSegmentIndex].compare_exchange_weak(offset, offset + 1))
+        {
+            VictimStripe* victimStripe = GetVictimStripe(victimSegmentIndex, offset);
+            CallbackSmartPtr callback = std::make_shared<ReverseMapLoadCompletion>(victimStripe);
+            victimStripe->Load(readaheadBaseStripeId[victimSegmentIndex] + offset, callback);
+            offset++;
+        }
+    }
+}
+
 GcStripeManager*
 CopierMeta::GetGcStripeManager(void)
 {
     return gcStripeManager;
 }
 
+GcCopyController*
+CopierMeta::GetCopyController(void)
+{
+    return copyController;
+}
+
 void
 CopierMeta::_CreateBufferPool(uint32_t chunkCnt, uint32_t chunkSize)
 {
     BufferInfo info = {
         .owner = typeid(this).name(),
         .size = chunkSize,
-        .count = chunkCnt * ArrayConfig::GC_BUFFER_COUNT * 2
+        .count = chunkCnt * ArrayConfig::GC_BUFFER_COUNT * 2,
+        // GC may not run for a long time after mount
+        .lazy = true
     };
     gcBufferPool = memoryManager->CreateBufferPool(info);
     assert(gcBufferPool != nullptr);
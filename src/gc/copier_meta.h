@@ -46,17 +46,20 @@
 namespace pos
 {
 class BufferPool;
+class GcCopyController;
 
 class CopierMeta
 {
 public:
     explicit CopierMeta(IArrayInfo* array);
+    CopierMeta(IArrayInfo* array, GcStripeManager* sharedGcStripeManager);
     CopierMeta(IArrayInfo* array, const PartitionLogicalSize* udSize,
                 BitMapMutex* inputInUseBitmap, GcStripeManager* inputGcStripeManager,
                 std::vector<std::vector<VictimStripe*>>* inputVictimStripes,
                 BufferPool* inputGcBufferPooll,
                 MemoryManager* memoryManager =
-                    MemoryManagerSingleton::Instance());
+                    MemoryManagerSingleton::Instance(),
+                GcCopyController* inputCopyController = nullptr);
 
 
     virtual ~CopierMeta(void);
@@ -80,13 +83,17 @@ public:
     virtual uint32_t GetStripePerSegment(void);
     virtual uint32_t GetBlksPerStripe(void);
     virtual VictimStripe* GetVictimStripe(uint32_t victimSegmentIndex, uint32_t stripeOffset);
+    virtual void SetReverseMapReadahead(uint32_t victimSegmentIndex, StripeId baseStripeId, uint32_t loadedCount);
+    virtual void LoadReverseMapAhead(uint32_t victimSegmentIndex, uint32_t endOffset);
 
     virtual GcStripeManager* GetGcStripeManager(void);
+    virtual GcCopyController* GetCopyController(void);
     virtual std::string GetArrayName(void);
     virtual unsigned int GetArrayIndex(void);
 
     static const uint32_t GC_CONCURRENT_COUNT = 16;
     static const uint32_t GC_VICTIM_SEGMENT_COUNT = 2;
+    static const uint32_t REVERSE_MAP_READAHEAD_COUNT = 64;
 private:
     void _CreateBufferPool(uint32_t chunkCnt, uint32_t chunkSize);
     void _CreateVictimStripes(IArrayInfo* array);
@@ -97,6 +104,7 @@ private:
 
     BitMapMutex* inUseBitmap;
     GcStripeManager* gcStripeManager;
+    bool ownsGcStripeManager = true;
 
     uint32_t stripesPerSegment;
     uint32_t blksPerStripe;
@@ -110,8 +118,11 @@ private:
     unsigned int arrayIndex;
 
     std::vector<std::vector<VictimStripe*>>* victimStripes;
+    StripeId readaheadBaseStripeId[GC_VICTIM_SEGMENT_COUNT];
+    std::atomic<uint32_t> readaheadOffset[GC_VICTIM_SEGMENT_COUNT];
     BufferPool* gcBufferPool = nullptr;
     MemoryManager* memoryManager;
+    GcCopyController* copyController = nullptr;
 };
 
 } // namespace pos
@@ -77,8 +77,7 @@ CopierReadCompletion::CopierReadCompletion(VictimStripe* victimStripe, uint32_t
   volumeManager(inputVolumeManager),
   eventScheduler(inputEventScheduler)
 {
-    list<BlkInfo> blkInfoList = victimStripe->GetBlkInfoList(listIndex);
-    blkCnt = blkInfoList.size();
+    blkCnt = victimStripe->GetBlkInfoList(listIndex).size();
 }
 
 CopierReadCompletion::~CopierReadCompletion(void)
@@ -89,7 +88,7 @@ bool
 CopierReadCompletion::_DoSpecificJob(void)
 {
     GcStripeManager* gcStripeManager = meta->GetGcStripeManager();
-    list<BlkInfo> blkInfoList = victimStripe->GetBlkInfoList(listIndex);
+    BlkInfoSpan blkInfoList = victimStripe->GetBlkInfoList(listIndex);
 
     uint32_t volId = blkInfoList.begin()->volID;
     assert(volId != UINT32_MAX);
@@ -116,9 +115,7 @@ CopierReadCompletion::_DoSpecificJob(void)
         std::vector<BlkInfo>* allocatedBlkInfoList = gcStripeManager->GetBlkInfoList(volId);
         for (uint32_t i = 0; i < numBlks; i++)
         {
-            list<BlkInfo>::iterator it = blkInfoList.begin();
-            std::advance(it, offset);
-            BlkInfo blkInfo = *it;
+            BlkInfo blkInfo = blkInfoList[offset];
             uint32_t vsaOffset = startOffset + i;
             gcStripeManager->SetBlkInfo(volId, vsaOffset, blkInfo);
             _MemCopyValidData(dataBuffer, vsaOffset, blkInfo);
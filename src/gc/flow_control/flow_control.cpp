@@ -38,6 +38,7 @@
 #include "src/gc/flow_control/token_distributer.h"
 #include "src/gc/flow_control/linear_distributer.h"
 #include "src/gc/flow_control/state_distributer.h"
+#include "src/gc/flow_control/model_distributer.h"
 #include "src/allocator/i_context_manager.h"
 #include "src/allocator_service/allocator_service.h"
 #include "src/array_models/interface/i_array_info.h"
@@ -45,6 +46,9 @@
 #include "src/array_models/dto/partition_logical_size.h"
 #include "assert.h"
 #include "src/allocator/context_manager/segment_ctx/segment_ctx.h"
+#include "src/telemetry/telemetry_client/easy_telemetry_publisher.h"
+#include "src/telemetry/telemetry_id.h"
+#include "src/trace/flight_recorder.h"
 
 namespace pos
 {
@@ -64,14 +68,24 @@ FlowControl::FlowControl(IArrayInfo* arrayInfo,
                         SystemTimeoutChecker* inputSystemTimeoutChecker,
                         FlowControlService* inputFlowControlService,
                         TokenDistributer* inputTokenDistributer,
-                        FlowControlConfiguration* inputFlowControlConfiguration)
+                        FlowControlConfiguration* inputFlowControlConfiguration,
+                        EasyTelemetryPublisher* inputTelemetryPublisher)
 : arrayInfo(arrayInfo),
   iContextManager(inputIContextManager),
   systemTimeoutChecker(inputSystemTimeoutChecker),
   flowControlService(inputFlowControlService),
   tokenDistributer(inputTokenDistributer),
-  flowControlConfiguration(inputFlowControlConfiguration)
+  flowControlConfiguration(inputFlowControlConfiguration),
+  telemetryPublisher(inputTelemetryPublisher)
 {
+    if (nullptr == telemetryPublisher)
+    {
+        telemetryPublisher = EasyTelemetryPublisherSingleton::Instance();
+    }
+    for (uint32_t i = 0; i < FlowControlType::MAX_FLOW_CONTROL_TYPE; i++)
+    {
+        rejectedCount[i] = 0;
+    }
 }
 
 FlowControl::~FlowControl(void)
@@ -124,6 +138,10 @@ FlowControl::Init(void)
         {
             tokenDistributer = new StateDistributer(arrayInfo, flowControlConfiguration);
         }
+        else if (FlowControlStrategy::MODEL == flowControlStrategy)
+        {
+            tokenDistributer = new ModelDistributer(arrayInfo, flowControlConfiguration);
+        }
     }
 
     InitDistributer();
@@ -132,6 +150,7 @@ FlowControl::Init(void)
     {
         bucket[i] = 0;
         previousBucket[i] = 0;
+        rejectedCount[i] = 0;
     }
 
     flowControlService->Register(arrayInfo->GetName(), this);
@@ -190,16 +209,16 @@ FlowControl::GetToken(FlowControlType type, int token)
                 refillTokenMutex.unlock();
                 if (false == ret)
                 {
-                    return 0;
+                    return _RejectToken(type, token);
                 }
                 if (0 >= bucket[type].load())
                 {
-                    return 0;
+                    return _RejectToken(type, token);
                 }
             }
             else
             {
-                return 0;
+                return _RejectToken(type, token);
             }
         }
     } while (!bucket[type].compare_exchange_weak(oldBucket, oldBucket - token));
@@ -207,6 +226,15 @@ FlowControl::GetToken(FlowControlType type, int token)
     return token;
 }
 
+int
+FlowControl::_RejectToken(FlowControlType type, int token)
+{
+    rejectedCount[type].fetch_add(1, std::memory_order_relaxed);
+    FlightRecorderSingleton::Instance()->Record(FlightEventType::FlowControlBlock,
+        arrayInfo->GetIndex(), static_cast<uint32_t>(type), token, freeSegments);
+    return 0;
+}
+
 void
 FlowControl::ReturnToken(FlowControlType type, int token)
 {
@@ -270,10 +298,30 @@ FlowControl::_RefillToken(FlowControlType type)
         userToken, gcToken, bucket[FlowControlType::USER], bucket[FlowControlType::GC], arrayId);
     bucket[FlowControlType::USER].fetch_add(userToken);
     bucket[FlowControlType::GC].fetch_add(gcToken);
+    _PublishToken(userToken, gcToken);
 
     return true;
 }
 
+void
+FlowControl::_PublishToken(uint32_t userToken, uint32_t gcToken)
+{
+    // refills happen once per distributed tokens, rejections are only counted in between
+    VectorLabels labels;
+    labels.push_back({"array_id", std::to_string(arrayInfo->GetIndex())});
+    telemetryPublisher->UpdateGauge(TEL90007_FLOW_CONTROL_USER_TOKEN, userToken, labels);
+    telemetryPublisher->UpdateGauge(TEL90008_FLOW_CONTROL_GC_TOKEN, gcToken, labels);
+
+    VectorLabels userLabels = labels;
+    userLabels.push_back({"type", "user"});
+    telemetryPublisher->UpdateGauge(TEL90009_FLOW_CONTROL_REJECTED_COUNT,
+        rejectedCount[FlowControlType::USER].load(std::memory_order_relaxed), userLabels);
+    VectorLabels gcLabels = labels;
+    gcLabels.push_back({"type", "gc"});
+    telemetryPublisher->UpdateGauge(TEL90009_FLOW_CONTROL_REJECTED_COUNT,
+        rejectedCount[FlowControlType::GC].load(std::memory_order_relaxed), gcLabels);
+}
+
 bool
 FlowControl::_TryForceResetToken(FlowControlType type)
 {
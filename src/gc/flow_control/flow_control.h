@@ -68,6 +68,7 @@ class FlowControlService;
 class IArrayInfo;
 class PartitionLogicalSize;
 class TokenDistributer;
+class EasyTelemetryPublisher;
 
 class FlowControl : public IMountSequence
 {
@@ -78,7 +79,8 @@ public:
                 SystemTimeoutChecker* inputSystemTimeoutChecker,
                 FlowControlService* inputFlowControlService,
                 TokenDistributer* inputTokenDistributer,
-                FlowControlConfiguration* inputFlowControlConfiguration);
+                FlowControlConfiguration* inputFlowControlConfiguration,
+                EasyTelemetryPublisher* inputTelemetryPublisher = nullptr);
     virtual ~FlowControl(void);
 
     virtual int Init(void) override;
@@ -96,13 +98,15 @@ private:
     bool _TryForceResetToken(FlowControlType type);
     std::tuple<uint32_t, uint32_t> _DistributeToken(void);
     void _ReadConfig(void);
+    int _RejectToken(FlowControlType type, int token);
+    void _PublishToken(uint32_t userToken, uint32_t gcToken);
 
     IArrayInfo* arrayInfo = nullptr;
 
     const uint64_t NANOS_PER_MSEC = 1000000ULL; // 1 sec
 
     const std::string FLOW_CONTROL_STRATEGY_NAME[(int)FlowControlStrategy::MAX_FLOW_CONTROL_STRATEGY] = {
-        "disable", "linear", "state"};
+        "disable", "linear", "state", "model"};
 
     FlowControlStrategy flowControlStrategy = FlowControlStrategy::LINEAR;
 
@@ -110,6 +114,7 @@ private:
 
     std::atomic<int> bucket[FlowControlType::MAX_FLOW_CONTROL_TYPE];
     std::atomic<int> previousBucket[FlowControlType::MAX_FLOW_CONTROL_TYPE];
+    std::atomic<uint64_t> rejectedCount[FlowControlType::MAX_FLOW_CONTROL_TYPE];
 
     uint32_t blksPerStripe = 0;
     uint32_t stripesPerSegment = 0;
@@ -135,5 +140,6 @@ private:
     FlowControlService* flowControlService = nullptr;
     TokenDistributer* tokenDistributer = nullptr;
     FlowControlConfiguration* flowControlConfiguration = nullptr;
+    EasyTelemetryPublisher* telemetryPublisher = nullptr;
 };
 } // namespace pos
@@ -95,7 +95,8 @@ FlowControlConfiguration::ReadConfig(void)
     totalToken = totalTokenInStripe * sizeInfo->blksPerStripe;
 
     flowControlStrategy = _ReadFlowControlStrategy();
-    if (FlowControlStrategy::LINEAR == flowControlStrategy)
+    if (FlowControlStrategy::LINEAR == flowControlStrategy ||
+        FlowControlStrategy::MODEL == flowControlStrategy)
     {
         return;
     }
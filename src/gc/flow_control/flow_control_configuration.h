@@ -44,6 +44,7 @@ enum FlowControlStrategy : uint32_t
     DISABLE = 0,
     LINEAR,
     STATE,
+    MODEL,
     MAX_FLOW_CONTROL_STRATEGY
 };
 
@@ -82,7 +83,7 @@ private:
 
     const uint64_t NANOS_PER_MSEC = 1000000ULL; // 1 sec
     const std::string FLOW_CONTROL_STRATEGY_NAME[(int)FlowControlStrategy::MAX_FLOW_CONTROL_STRATEGY] = {
-        "disable", "linear", "state"};
+        "disable", "linear", "state", "model"};
 
     const uint64_t DEFAULT_FORCE_RESET_TIMEOUT = 1000 * NANOS_PER_MSEC;
     const uint32_t DEFAULT_TOTAL_TOKEN_IN_STRIPE = 1024;
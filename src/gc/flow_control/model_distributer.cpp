@@ -0,0 +1,208 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/gc/flow_control/model_distributer.h"
+#include "src/allocator/i_context_manager.h"
+#include "src/array_models/interface/i_array_info.h"
+#include "src/array_models/dto/partition_logical_size.h"
+#include "src/allocator_service/allocator_service.h"
+#include "src/gc/flow_control/flow_control_configuration.h"
+
+namespace pos
+{
+
+ModelDistributer::ModelDistributer(IArrayInfo* iArrayInfo, FlowControlConfiguration* flowControlConfiguration)
+: ModelDistributer(iArrayInfo, flowControlConfiguration,
+                AllocatorServiceSingleton::Instance()->GetIContextManager(iArrayInfo->GetName()))
+{
+}
+
+ModelDistributer::ModelDistributer(IArrayInfo* iArrayInfo, FlowControlConfiguration* flowControlConfiguration,
+                                IContextManager* inputIContextManager)
+: TokenDistributer(iArrayInfo, flowControlConfiguration, inputIContextManager),
+  blksPerSegment(0),
+  totalToken(0),
+  gcThreshold(0),
+  gcUrgentThreshold(0),
+  hasWindow(false),
+  previousFreeSegments(0),
+  previousUserToken(0),
+  previousGcToken(0),
+  previousShare(0),
+  efficiency(INITIAL_EFFICIENCY),
+  integral(0),
+  previousError(0)
+{
+    Init();
+}
+
+ModelDistributer::~ModelDistributer(void)
+{
+}
+
+void
+ModelDistributer::Init(void)
+{
+    const PartitionLogicalSize* sizeInfo = iArrayInfo->GetSizeInfo(PartitionType::USER_DATA);
+    blksPerSegment = (uint64_t)sizeInfo->blksPerStripe * sizeInfo->stripesPerSegment;
+
+    totalToken = flowControlConfiguration->GetTotalToken();
+
+    gcThreshold = iContextManager->GetGcThreshold(GcMode::MODE_NORMAL_GC);
+    gcUrgentThreshold = iContextManager->GetGcThreshold(GcMode::MODE_URGENT_GC);
+
+    _Reset();
+}
+
+std::tuple<uint32_t, uint32_t>
+ModelDistributer::Distribute(uint32_t freeSegments)
+{
+    if (freeSegments > gcThreshold)
+    {
+        _Reset();
+        return std::make_tuple(totalToken, 0);
+    }
+
+    if (true == hasWindow)
+    {
+        _UpdateEfficiency(freeSegments);
+    }
+
+    double share = _GetUserShare(freeSegments);
+    uint32_t userToken = (uint32_t)(share * totalToken);
+    uint32_t gcToken = totalToken - userToken;
+
+    hasWindow = true;
+    previousFreeSegments = freeSegments;
+    previousUserToken = userToken;
+    previousGcToken = gcToken;
+    previousShare = share;
+
+    return std::make_tuple(userToken, gcToken);
+}
+
+void
+ModelDistributer::_Reset(void)
+{
+    hasWindow = false;
+    previousFreeSegments = 0;
+    previousUserToken = 0;
+    previousGcToken = 0;
+    previousShare = 0;
+    efficiency = INITIAL_EFFICIENCY;
+    integral = 0;
+    previousError = 0;
+}
+
+void
+ModelDistributer::_UpdateEfficiency(uint32_t freeSegments)
+{
+    // A refill happens once both buckets of the previous window are drained,
+    // so the free segment delta plus the consumed segments is what GC reclaimed
+    if (0 == previousGcToken)
+    {
+        return;
+    }
+    double consumed = (double)((uint64_t)previousUserToken + previousGcToken) / blksPerSegment;
+    double reclaimed = (double)freeSegments - (double)previousFreeSegments + consumed;
+    if (reclaimed < 0)
+    {
+        reclaimed = 0;
+    }
+
+    double sample = reclaimed * blksPerSegment / previousGcToken;
+    if (sample < 1.0)
+    {
+        sample = 1.0;
+    }
+    else if (sample > MAX_EFFICIENCY)
+    {
+        sample = MAX_EFFICIENCY;
+    }
+    efficiency = (1.0 - EFFICIENCY_WEIGHT) * efficiency + EFFICIENCY_WEIGHT * sample;
+}
+
+double
+ModelDistributer::_GetUserShare(uint32_t freeSegments)
+{
+    if (freeSegments <= gcUrgentThreshold)
+    {
+        integral = 0;
+        previousError = 0;
+        return 0;
+    }
+
+    // Every block GC copies frees (efficiency) blocks, so the host can
+    // sustainably take (efficiency - 1) of every (efficiency) blocks
+    double sustainableShare = (efficiency - 1.0) / efficiency;
+
+    // PID on the distance from the middle of the flow control range keeps
+    // the free segment count steady around it
+    double span = (gcThreshold > gcUrgentThreshold) ? (double)(gcThreshold - gcUrgentThreshold) : 1.0;
+    double setPoint = gcUrgentThreshold + span / 2;
+    double error = ((double)freeSegments - setPoint) / span;
+    integral += error;
+    if (integral > MAX_INTEGRAL)
+    {
+        integral = MAX_INTEGRAL;
+    }
+    else if (integral < -MAX_INTEGRAL)
+    {
+        integral = -MAX_INTEGRAL;
+    }
+    double derivative = (true == hasWindow) ? (error - previousError) : 0;
+    previousError = error;
+
+    double share = sustainableShare + KP * error + KI * integral + KD * derivative;
+    if (true == hasWindow)
+    {
+        if (share > previousShare + MAX_SHARE_STEP)
+        {
+            share = previousShare + MAX_SHARE_STEP;
+        }
+        else if (share < previousShare - MAX_SHARE_STEP)
+        {
+            share = previousShare - MAX_SHARE_STEP;
+        }
+    }
+    if (share < 0)
+    {
+        share = 0;
+    }
+    else if (share > 1.0 - MIN_GC_SHARE)
+    {
+        share = 1.0 - MIN_GC_SHARE;
+    }
+    return share;
+}
+
+}; // namespace pos
@@ -0,0 +1,80 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "src/gc/flow_control/token_distributer.h"
+#include <tuple>
+
+namespace pos
+{
+class ModelDistributer : public TokenDistributer
+{
+public:
+    ModelDistributer(IArrayInfo* iArrayInfo, FlowControlConfiguration* flowControlConfiguration);
+    ModelDistributer(IArrayInfo* iArrayInfo, FlowControlConfiguration* flowControlConfiguration, IContextManager* iContextManager);
+    ~ModelDistributer(void) override;
+    virtual void Init(void) override;
+    virtual std::tuple<uint32_t, uint32_t> Distribute(uint32_t freeSegments) override;
+
+private:
+    void _Reset(void);
+    void _UpdateEfficiency(uint32_t freeSegments);
+    double _GetUserShare(uint32_t freeSegments);
+
+    // Blocks reclaimed per block copied by GC before any sample is taken
+    const double INITIAL_EFFICIENCY = 2.0;
+    const double MAX_EFFICIENCY = 64.0;
+    const double EFFICIENCY_WEIGHT = 0.25;
+    const double KP = 0.5;
+    const double KI = 0.05;
+    const double KD = 0.2;
+    const double MAX_INTEGRAL = 4.0;
+    const double MIN_GC_SHARE = 0.1;
+    const double MAX_SHARE_STEP = 0.1;
+
+    uint64_t blksPerSegment;
+    uint32_t totalToken;
+    uint32_t gcThreshold;
+    uint32_t gcUrgentThreshold;
+
+    bool hasWindow;
+    uint32_t previousFreeSegments;
+    uint32_t previousUserToken;
+    uint32_t previousGcToken;
+    double previousShare;
+    double efficiency;
+    double integral;
+    double previousError;
+};
+
+}; // namespace pos
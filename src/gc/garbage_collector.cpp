@@ -41,9 +41,12 @@
 #include "src/logger/logger.h"
 #include "src/event_scheduler/event.h"
 #include "src/event_scheduler/event_scheduler.h"
+#include "src/master_context/config_manager.h"
 
 namespace pos
 {
+const uint32_t GarbageCollector::MAX_CONCURRENT_COPIER_COUNT;
+
 GarbageCollector::GarbageCollector(IArrayInfo* i, IStateControl* s)
 : GarbageCollector(i, s, nullptr, nullptr, EventSchedulerSingleton::Instance())
 {
@@ -51,15 +54,24 @@ GarbageCollector::GarbageCollector(IArrayInfo* i, IStateControl* s)
     {
         return std::make_shared<Copier>(UNMAP_SEGMENT, UNMAP_SEGMENT, gcStatus, array);
     };
+    this->helperCopierFactory = [](GcStatus* gcStatus, IArrayInfo* array, GcStripeManager* gcStripeManager)
+    {
+        return std::make_shared<Copier>(UNMAP_SEGMENT, UNMAP_SEGMENT, gcStatus, array, gcStripeManager);
+    };
+    copierCount = _ReadCopierCount();
 }
 
 GarbageCollector::GarbageCollector(IArrayInfo* i, IStateControl* s,
                                 CopierSmartPtr inputEvent,
                                 function<CopierSmartPtr(GcStatus*, IArrayInfo*, CopierSmartPtr)> copierFactory,
-                                EventScheduler* inputEventScheduler)
+                                EventScheduler* inputEventScheduler,
+                                uint32_t inputCopierCount,
+                                HelperCopierFactory inputHelperCopierFactory)
 : arrayInfo(i),
   state(s),
   gcStatus(),
+  copierCount(inputCopierCount),
+  helperCopierFactory(inputHelperCopierFactory),
   copierFactory(copierFactory),
   inputEvent(inputEvent),
   eventScheduler(inputEventScheduler)
@@ -97,7 +109,10 @@ void GarbageCollector::Pause(void)
 {
     if (nullptr != copierPtr)
     {
-        copierPtr->Pause();
+        for (auto& copier : _GetCopiers())
+        {
+            copier->Pause();
+        }
     }
     else
     {
@@ -109,7 +124,10 @@ void GarbageCollector::Resume(void)
 {
     if (nullptr != copierPtr)
     {
-        copierPtr->Resume();
+        for (auto& copier : _GetCopiers())
+        {
+            copier->Resume();
+        }
     }
     else
     {
@@ -122,7 +140,10 @@ bool GarbageCollector::IsPaused(void)
     bool ret = true;
     if (nullptr != copierPtr)
     {
-        ret = copierPtr->IsPaused();
+        for (auto& copier : _GetCopiers())
+        {
+            ret = ret && copier->IsPaused();
+        }
     }
     else
     {
@@ -187,7 +208,10 @@ GarbageCollector::DisableThresholdCheck(void)
         return -1;
     }
 
-    copierPtr->DisableThresholdCheck();
+    for (auto& copier : _GetCopiers())
+    {
+        copier->DisableThresholdCheck();
+    }
     POS_TRACE_INFO(EID(GC_THRESHOLD_CHECK_DISABLE), "threshold check is disabled");
     return 0;
 }
@@ -197,12 +221,19 @@ GarbageCollector::End(void)
 {
     if (true == isRunning)
     {
-        copierPtr->Stop();
+        std::vector<CopierSmartPtr> copiers = _GetCopiers();
+        for (auto& copier : copiers)
+        {
+            copier->Stop();
+        }
 
-        do
+        for (auto& copier : copiers)
         {
-            usleep(1);
-        } while (true == copierPtr->IsStopped());
+            do
+            {
+                usleep(1);
+            } while (true == copier->IsStopped());
+        }
         isRunning = false;
         _GCdone();
     }
@@ -222,14 +253,61 @@ GarbageCollector::_DoGC(void)
     }
     eventScheduler->EnqueueEvent(event);
     copierPtr = event;
+
+    for (uint32_t index = 1; index < copierCount && nullptr != helperCopierFactory; index++)
+    {
+        CopierSmartPtr helper = helperCopierFactory(&gcStatus, arrayInfo, copierPtr->GetGcStripeManager());
+        if (unlikely(helper == nullptr))
+        {
+            POS_TRACE_WARN(EID(GC_CANNOT_CREATE_COPIER),
+                "gc runs with {} copiers instead of {}", index, copierCount);
+            break;
+        }
+        eventScheduler->EnqueueEvent(helper);
+        helperCopiers.push_back(helper);
+    }
     return EID(SUCCESS);
 }
 
 void
 GarbageCollector::_GCdone(void)
 {
+    // Helpers are released before copierPtr, which owns the shared destination stripes
+    for (auto& helper : helperCopiers)
+    {
+        helper->ReadyToEnd();
+    }
+    helperCopiers.clear();
     copierPtr->ReadyToEnd();
     copierPtr = nullptr;
     POS_TRACE_INFO(EID(GC_DONE), "GC done");
 }
+
+std::vector<CopierSmartPtr>
+GarbageCollector::_GetCopiers(void)
+{
+    std::vector<CopierSmartPtr> copiers;
+    copiers.push_back(copierPtr);
+    copiers.insert(copiers.end(), helperCopiers.begin(), helperCopiers.end());
+    return copiers;
+}
+
+uint32_t
+GarbageCollector::_ReadCopierCount(void)
+{
+    uint32_t count = 1;
+    int ret = ConfigManagerSingleton::Instance()->GetValue("gc_threshold", "concurrent_copier_count",
+        &count, ConfigType::CONFIG_TYPE_UINT32);
+    if (ret != EID(SUCCESS) || 0 == count)
+    {
+        return 1;
+    }
+    if (count > MAX_CONCURRENT_COPIER_COUNT)
+    {
+        POS_TRACE_INFO(EID(GC_THREHOLD_SETTING_PRINT),
+            "concurrent_copier_count {} is limited to {}", count, MAX_CONCURRENT_COPIER_COUNT);
+        count = MAX_CONCURRENT_COPIER_COUNT;
+    }
+    return count;
+}
 } // namespace pos
@@ -48,7 +48,9 @@ namespace pos
 {
 class Copier;
 class EventScheduler;
+class GcStripeManager;
 using CopierSmartPtr = std::shared_ptr<Copier>;
+using HelperCopierFactory = function<CopierSmartPtr(GcStatus*, IArrayInfo*, GcStripeManager*)>;
 
 class GarbageCollector : public IGCControl, public IGCInfo,
                          public IMountSequence, public IStateObserver
@@ -58,7 +60,9 @@ public:
     GarbageCollector(IArrayInfo* i, IStateControl* s,
                     CopierSmartPtr inputEvent,
                     function<CopierSmartPtr(GcStatus*, IArrayInfo*, CopierSmartPtr)> CopierFactory,
-                    EventScheduler* inputEventScheduler);
+                    EventScheduler* inputEventScheduler,
+                    uint32_t inputCopierCount = 1,
+                    HelperCopierFactory inputHelperCopierFactory = nullptr);
     virtual ~GarbageCollector(void) {}
     virtual int Start(void) override;
     virtual void End(void) override;
@@ -79,16 +83,28 @@ public:
     virtual bool GetGcRunning(void) { return gcStatus.GetGcRunning(); }
     virtual struct timeval GetStartTime(void) { return gcStatus.GetStartTime(); }
     virtual struct timeval GetEndTime(void) { return gcStatus.GetEndTime(); }
+    virtual uint32_t GetCopyTargetDepth(void) { return gcStatus.GetCopyTargetDepth(); }
+    virtual uint32_t GetCopyCurrentDepth(void) { return gcStatus.GetCopyCurrentDepth(); }
+    virtual uint32_t GetCopyReadBatch(void) { return gcStatus.GetCopyReadBatch(); }
+    virtual uint64_t GetHostP99Us(void) { return gcStatus.GetHostP99Us(); }
+
+    static const uint32_t MAX_CONCURRENT_COPIER_COUNT = 8;
 
 private:
     int _DoGC(void);
     void _GCdone(void);
+    uint32_t _ReadCopierCount(void);
+    std::vector<CopierSmartPtr> _GetCopiers(void);
     bool isRunning = false;
 
     IArrayInfo* arrayInfo;
     IStateControl* state;
     GcStatus gcStatus;
     CopierSmartPtr copierPtr;
+    // Extra copiers work on their own victims and share copierPtr's destination stripes
+    std::vector<CopierSmartPtr> helperCopiers;
+    uint32_t copierCount;
+    HelperCopierFactory helperCopierFactory;
 
     function<CopierSmartPtr(GcStatus*, IArrayInfo*, CopierSmartPtr)> copierFactory = nullptr;
     CopierSmartPtr inputEvent;
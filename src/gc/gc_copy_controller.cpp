@@ -0,0 +1,170 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/gc/gc_copy_controller.h"
+
+#include <algorithm>
+
+#include "src/include/pos_event_id.h"
+#include "src/logger/logger.h"
+#include "src/master_context/config_manager.h"
+#include "src/qos/qos_manager.h"
+#include "src/telemetry/telemetry_client/per_core_histogram.h"
+
+namespace pos
+{
+const uint32_t GcCopyController::MIN_DEPTH;
+const uint32_t GcCopyController::DEFAULT_DEPTH;
+const uint32_t GcCopyController::MAX_DEPTH;
+const uint32_t GcCopyController::ADDITIVE_STEP;
+const uint32_t GcCopyController::READS_PER_DEPTH;
+const uint64_t GcCopyController::UPDATE_INTERVAL_US;
+const uint64_t GcCopyController::DEFAULT_LATENCY_TARGET_US;
+
+GcCopyController::GcCopyController(void)
+: GcCopyController(QosManagerSingleton::Instance(), ConfigManagerSingleton::Instance())
+{
+}
+
+GcCopyController::GcCopyController(QosManager* qosManager, ConfigManager* configManager)
+: qosManager(qosManager),
+  latencyTargetUs(DEFAULT_LATENCY_TARGET_US),
+  targetDepth(DEFAULT_DEPTH),
+  currentDepth(0),
+  hostP99Us(0),
+  freeSegmentSlope(0),
+  sampled(false),
+  lastUpdateUs(0),
+  lastFreeSegments(0)
+{
+    if (configManager != nullptr)
+    {
+        uint64_t target = DEFAULT_LATENCY_TARGET_US;
+        int ret = configManager->GetValue("gc_threshold", "host_latency_target_us",
+            &target, ConfigType::CONFIG_TYPE_UINT64);
+        if (ret == 0)
+        {
+            latencyTargetUs = target;
+        }
+    }
+}
+
+void
+GcCopyController::Update(uint32_t numFreeSegments, bool isUrgent, uint64_t nowUs)
+{
+    std::unique_lock<std::mutex> lock(updateLock, std::try_to_lock);
+    if (lock.owns_lock() == false)
+    {
+        return;
+    }
+    if (sampled == true && (nowUs - lastUpdateUs) < UPDATE_INTERVAL_US)
+    {
+        return;
+    }
+
+    std::vector<uint64_t> latency = (qosManager != nullptr) ? qosManager->CollectHostLatency() : lastLatency;
+    uint64_t p99 = PerCoreHistogram::GetPercentile(PerCoreHistogram::GetInterval(lastLatency, latency), 0.99);
+    int64_t slope = (sampled == true) ? (static_cast<int64_t>(numFreeSegments) - lastFreeSegments) : 0;
+
+    bool hostSuffering = (latencyTargetUs != 0 && p99 > latencyTargetUs);
+    uint32_t depth = targetDepth;
+    uint32_t prevDepth = depth;
+    if (isUrgent == true || (hostSuffering == false && slope < 0))
+    {
+        // falling behind, hosts are throttled by free segments anyway in urgent mode
+        depth = std::min(depth + ADDITIVE_STEP, MAX_DEPTH);
+    }
+    else if (hostSuffering == true)
+    {
+        depth = std::max(depth / 2, MIN_DEPTH);
+    }
+
+    targetDepth = depth;
+    hostP99Us = p99;
+    freeSegmentSlope = slope;
+
+    sampled = true;
+    lastUpdateUs = nowUs;
+    lastFreeSegments = numFreeSegments;
+    lastLatency = latency;
+
+    if (depth != prevDepth)
+    {
+        POS_TRACE_DEBUG(EID(GC_COPY_SUBMISSION),
+            "gc copy depth changed, prev:{}, target:{}, free_segment_slope:{}, host_p99_us:{}, urgent:{}",
+            prevDepth, depth, slope, p99, isUrgent);
+    }
+}
+
+void
+GcCopyController::CopyStarted(uint32_t count)
+{
+    currentDepth.fetch_add(count, std::memory_order_relaxed);
+}
+
+void
+GcCopyController::CopyFinished(void)
+{
+    currentDepth.fetch_sub(1, std::memory_order_relaxed);
+}
+
+uint32_t
+GcCopyController::GetTargetDepth(void)
+{
+    return targetDepth;
+}
+
+uint32_t
+GcCopyController::GetCurrentDepth(void)
+{
+    return currentDepth;
+}
+
+uint32_t
+GcCopyController::GetReadBatch(void)
+{
+    return targetDepth * READS_PER_DEPTH;
+}
+
+uint64_t
+GcCopyController::GetHostP99Us(void)
+{
+    return hostP99Us;
+}
+
+int64_t
+GcCopyController::GetFreeSegmentSlope(void)
+{
+    return freeSegmentSlope;
+}
+
+} // namespace pos
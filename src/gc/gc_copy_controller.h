@@ -0,0 +1,89 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace pos
+{
+class QosManager;
+class ConfigManager;
+
+// AIMD controller for the number of victim stripes copied concurrently.
+// Depth grows additively while gc falls behind (urgent mode or free segments
+// shrinking) and is halved when host p99 latency exceeds the target.
+class GcCopyController
+{
+public:
+    GcCopyController(void);
+    GcCopyController(QosManager* qosManager, ConfigManager* configManager);
+    virtual ~GcCopyController(void) = default;
+
+    virtual void Update(uint32_t numFreeSegments, bool isUrgent, uint64_t nowUs);
+    virtual void CopyStarted(uint32_t count);
+    virtual void CopyFinished(void);
+
+    virtual uint32_t GetTargetDepth(void);
+    virtual uint32_t GetCurrentDepth(void);
+    virtual uint32_t GetReadBatch(void);
+    virtual uint64_t GetHostP99Us(void);
+    virtual int64_t GetFreeSegmentSlope(void);
+
+    static const uint32_t MIN_DEPTH = 2;
+    static const uint32_t DEFAULT_DEPTH = 16;
+    static const uint32_t MAX_DEPTH = 64;
+    static const uint32_t ADDITIVE_STEP = 2;
+    static const uint32_t READS_PER_DEPTH = 4;
+    static const uint64_t UPDATE_INTERVAL_US = 100000;
+    static const uint64_t DEFAULT_LATENCY_TARGET_US = 5000;
+
+private:
+    QosManager* qosManager;
+    uint64_t latencyTargetUs;
+
+    std::atomic<uint32_t> targetDepth;
+    std::atomic<uint32_t> currentDepth;
+    std::atomic<uint64_t> hostP99Us;
+    std::atomic<int64_t> freeSegmentSlope;
+
+    std::mutex updateLock;
+    bool sampled;
+    uint64_t lastUpdateUs;
+    uint32_t lastFreeSegments;
+    std::vector<uint64_t> lastLatency;
+};
+
+} // namespace pos
@@ -0,0 +1,505 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/gc/gc_copy_offload.h"
+
+#include <string.h>
+
+#include <list>
+
+#include "src/allocator/i_block_allocator.h"
+#include "src/allocator_service/allocator_service.h"
+#include "src/array/service/array_service_layer.h"
+#include "src/array_models/interface/i_array_info.h"
+#include "src/bio/ubio.h"
+#include "src/device/base/ublock_device.h"
+#include "src/device/i_io_dispatcher.h"
+#include "src/event_scheduler/event_scheduler.h"
+#include "src/gc/copier_meta.h"
+#include "src/gc/flow_control/flow_control.h"
+#include "src/gc/flow_control/flow_control_service.h"
+#include "src/gc/gc_flush_completion.h"
+#include "src/gc/gc_stripe_manager.h"
+#include "src/gc/stripe_copier.h"
+#include "src/include/array_config.h"
+#include "src/include/backend_event.h"
+#include "src/include/i_array_device.h"
+#include "src/include/meta_const.h"
+#include "src/io/general_io/block_checksum.h"
+#include "src/io/general_io/write_amplification_monitor_service.h"
+#include "src/io_scheduler/io_dispatcher.h"
+#include "src/logger/logger.h"
+#include "src/mapper/i_reversemap.h"
+#include "src/mapper/reversemap/reverse_map.h"
+#include "src/mapper/reversemap/reverse_map_footer.h"
+#include "src/mapper_service/mapper_service.h"
+#include "src/master_context/config_manager.h"
+#include "src/volume/volume_service.h"
+
+namespace pos
+{
+GcCopyOffload::GcCopyOffload(IArrayInfo* iArrayInfo, GcStripeManager* gcStripeManager,
+    IBlockAllocator* iBlockAllocator, IIOTranslator* translator,
+    IIODispatcher* ioDispatcher, IVolumeIoManager* volumeManager,
+    FlowControl* flowControl, IReverseMap* iReverseMap)
+: iArrayInfo(iArrayInfo),
+  gcStripeManager(gcStripeManager),
+  iBlockAllocator(iBlockAllocator),
+  translator(translator),
+  ioDispatcher(ioDispatcher),
+  volumeManager(volumeManager),
+  flowControl(flowControl),
+  iReverseMap(iReverseMap),
+  arrayId(iArrayInfo->GetIndex()),
+  arrayName(iArrayInfo->GetName())
+{
+    const PartitionLogicalSize* udSize = iArrayInfo->GetSizeInfo(PartitionType::USER_DATA);
+    chunksPerStripe = udSize->chunksPerStripe;
+    blksPerStripe = udSize->blksPerStripe;
+}
+
+GcCopyOffload::~GcCopyOffload(void)
+{
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Create the offload from gc_threshold.copy_offload_enable
+ *
+ * @return   nullptr if the offload is disabled or the array has parity
+ */
+/* --------------------------------------------------------------------------*/
+GcCopyOffload*
+GcCopyOffload::Create(IArrayInfo* iArrayInfo, GcStripeManager* gcStripeManager,
+    ConfigManager* configManager)
+{
+    bool enabled = false;
+    int ret = configManager->GetValue("gc_threshold", "copy_offload_enable",
+        &enabled, ConfigType::CONFIG_TYPE_BOOL);
+    if (ret != EID(SUCCESS) || false == enabled)
+    {
+        return nullptr;
+    }
+
+    std::string raidType = iArrayInfo->GetDataRaidType();
+    if (raidType != "RAID0" && raidType != "NONE")
+    {
+        POS_TRACE_INFO(EID(GC_THREHOLD_SETTING_PRINT),
+            "copy_offload_enable is ignored for {}, array_id:{}", raidType, iArrayInfo->GetIndex());
+        return nullptr;
+    }
+
+    if (ReverseMapFooter::IsEnabled())
+    {
+        // Copied blocks never pass through the host, so the footer could not
+        // be written along with them
+        POS_TRACE_INFO(EID(GC_THREHOLD_SETTING_PRINT),
+            "copy_offload_enable is ignored with reverse_map_in_stripe_footer, array_id:{}", iArrayInfo->GetIndex());
+        return nullptr;
+    }
+
+    POS_TRACE_INFO(EID(GC_COPY_OFFLOAD_ENABLED),
+        "raid_type:{}, array_id:{}", raidType, iArrayInfo->GetIndex());
+    std::string arrayName = iArrayInfo->GetName();
+    return new GcCopyOffload(iArrayInfo, gcStripeManager,
+        AllocatorServiceSingleton::Instance()->GetIBlockAllocator(arrayName),
+        ArrayService::Instance()->Getter()->GetTranslator(),
+        IODispatcherSingleton::Instance(),
+        VolumeServiceSingleton::Instance()->GetVolumeManager(arrayName),
+        FlowControlServiceSingleton::Instance()->GetFlowControl(arrayName),
+        MapperServiceSingleton::Instance()->GetIReverseMap(arrayName));
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Fill the source ranges of a copy, merging the blocks of adjacent
+ *           lbas up to maxRangeSectors
+ *
+ * @return   the number of ranges, or 0 if the blocks need more than maxRanges
+ */
+/* --------------------------------------------------------------------------*/
+uint32_t
+GcCopyOffload::BuildRanges(CopyCommand* copyCommand, const std::vector<uint64_t>& srcLbas,
+    uint32_t sectorsPerBlock, uint32_t maxRangeSectors, uint32_t maxRanges)
+{
+    if (maxRanges > CopyCommand::MAX_RANGES)
+    {
+        maxRanges = CopyCommand::MAX_RANGES;
+    }
+    if (srcLbas.empty() || maxRangeSectors < sectorsPerBlock)
+    {
+        return 0;
+    }
+
+    uint32_t rangeCount = 0;
+    uint32_t rangeSectors = 0;
+    for (uint64_t lba : srcLbas)
+    {
+        if (rangeCount != 0)
+        {
+            CopySourceRange& last = copyCommand->ranges[rangeCount - 1];
+            if (last.startLba + rangeSectors == lba &&
+                rangeSectors + sectorsPerBlock <= maxRangeSectors)
+            {
+                rangeSectors += sectorsPerBlock;
+                last.sectorCount = rangeSectors - 1;
+                continue;
+            }
+        }
+        if (rangeCount == maxRanges)
+        {
+            return 0;
+        }
+        CopySourceRange& range = copyCommand->ranges[rangeCount++];
+        memset(&range, 0, sizeof(range));
+        range.startLba = lba;
+        range.sectorCount = sectorsPerBlock - 1;
+        rangeSectors = sectorsPerBlock;
+    }
+    copyCommand->rangeCount = rangeCount;
+    copyCommand->sectorCount = srcLbas.size() * sectorsPerBlock;
+    return rangeCount;
+}
+
+// The blocks of the list land next to each other in the same column of the
+// destination stripe. A list which does not fit the column closes the stripe,
+// leaving the rest of its columns as holes that the next GC of the segment
+// reclaims.
+bool
+GcCopyOffload::TryCopy(StripeId victimLsid, uint32_t listIndex, uint32_t copyIndex,
+    CopierMeta* meta)
+{
+    VictimStripe* victimStripe =
+        meta->GetVictimStripe(copyIndex, victimLsid % meta->GetStripePerSegment());
+    BlkInfoSpan blkInfoList = victimStripe->GetBlkInfoList(listIndex);
+    uint32_t volumeId = blkInfoList.begin()->volID;
+    uint32_t column = blkInfoList.begin()->vsa.offset / BLOCKS_IN_CHUNK;
+    for (BlkInfo& blkInfo : blkInfoList)
+    {
+        if (blkInfo.volID != volumeId)
+        {
+            return false;
+        }
+    }
+
+    PhysicalBlkAddr src;
+    uint32_t maxRangeSectors = 0;
+    uint32_t maxRanges = 0;
+    uint32_t maxSectors = 0;
+    if (false == _TranslateChunk(victimLsid, column, src) ||
+        false == _IsCopyable(src.arrayDev, maxRangeSectors, maxRanges, maxSectors))
+    {
+        return false;
+    }
+
+    std::vector<uint64_t> srcLbas;
+    for (BlkInfo& blkInfo : blkInfoList)
+    {
+        srcLbas.push_back(src.lba +
+            (blkInfo.vsa.offset % BLOCKS_IN_CHUNK) * ArrayConfig::SECTORS_PER_BLOCK);
+    }
+    UbioSmartPtr ubio(new Ubio(nullptr, Ubio::UNITS_PER_BLOCK, arrayId));
+    CopyCommand* copyCommand = static_cast<CopyCommand*>(ubio->GetBuffer());
+    if (0 == BuildRanges(copyCommand, srcLbas, ArrayConfig::SECTORS_PER_BLOCK,
+        maxRangeSectors, maxRanges) || copyCommand->sectorCount > maxSectors)
+    {
+        return false;
+    }
+
+    uint32_t blkCnt = blkInfoList.size();
+    std::shared_ptr<GcCopyStripe> copyStripe;
+    PhysicalBlkAddr dst;
+    uint32_t destOffset = 0;
+    {
+        std::unique_lock<std::mutex> lock(stripeLocks[volumeId]);
+        copyStripe = activeStripes[volumeId];
+        if (nullptr != copyStripe && copyStripe->columnTail[column] + blkCnt > BLOCKS_IN_CHUNK)
+        {
+            _Close(volumeId);
+            copyStripe = nullptr;
+        }
+        if (nullptr == copyStripe)
+        {
+            copyStripe = _Open(volumeId);
+            if (nullptr == copyStripe)
+            {
+                return false;
+            }
+        }
+        if (false == _TranslateChunk(copyStripe->stripe->GetUserLsid(), column, dst) ||
+            dst.arrayDev != src.arrayDev)
+        {
+            return false;
+        }
+
+        uint32_t columnTail = copyStripe->columnTail[column];
+        dst.lba += columnTail * ArrayConfig::SECTORS_PER_BLOCK;
+        destOffset = column * BLOCKS_IN_CHUNK + columnTail;
+        copyStripe->columnTail[column] += blkCnt;
+        copyStripe->pendingCount++;
+    }
+
+    StripeSmartPtr stripe = copyStripe->stripe;
+    bool checksumEnabled = BlockChecksum::IsEnabled();
+    for (uint32_t index = 0; index < blkCnt; index++)
+    {
+        BlkInfo& blkInfo = blkInfoList[index];
+        stripe->UpdateReverseMapEntry(destOffset + index, blkInfo.rba, volumeId);
+        stripe->UpdateVictimVsa(destOffset + index, blkInfo.vsa);
+        if (checksumEnabled)
+        {
+            // The data does not pass the host, so the checksum of the victim is carried over
+            uint32_t checksum = NO_REVMAP_CHECKSUM;
+            if (false == iReverseMap->GetBlockChecksum(blkInfo.vsa.stripeId, blkInfo.vsa.offset, checksum))
+            {
+                checksum = NO_REVMAP_CHECKSUM;
+            }
+            stripe->UpdateReverseMapChecksum(destOffset + index, checksum);
+        }
+    }
+
+    ubio->dir = UbioDir::Copy;
+    ubio->SetPba(dst);
+    ubio->SetUblock(dst.arrayDev->GetUblock());
+    ubio->SetEventType(BackendEvent_GC);
+    CallbackSmartPtr callback(new GcCopyOffloadCompletion(this, copyStripe, destOffset,
+        victimLsid, listIndex, copyIndex, meta, volumeManager));
+    callback->SetEventType(BackendEvent_GC);
+    ubio->SetCallback(callback);
+    ioDispatcher->Submit(ubio, false, false);
+    WriteAmplificationMonitorServiceSingleton::Instance()->Add(arrayId,
+        WriteSource::Gc, blkCnt * ArrayConfig::BLOCK_SIZE_BYTE);
+    return true;
+}
+
+void
+GcCopyOffload::CopyDone(std::shared_ptr<GcCopyStripe> copyStripe)
+{
+    bool flushRequired = false;
+    {
+        std::unique_lock<std::mutex> lock(stripeLocks[copyStripe->volumeId]);
+        copyStripe->pendingCount--;
+        flushRequired = (true == copyStripe->closing && 0 == copyStripe->pendingCount);
+    }
+    if (flushRequired)
+    {
+        _Flush(copyStripe);
+    }
+}
+
+void
+GcCopyOffload::CloseAll(void)
+{
+    for (uint32_t volumeId = 0; volumeId < MAX_VOLUME_COUNT; volumeId++)
+    {
+        std::unique_lock<std::mutex> lock(stripeLocks[volumeId]);
+        if (nullptr != activeStripes[volumeId])
+        {
+            _Close(volumeId);
+        }
+    }
+}
+
+bool
+GcCopyOffload::_TranslateChunk(StripeId lsid, uint32_t column, PhysicalBlkAddr& pba)
+{
+    std::list<PhysicalEntry> physicalEntries;
+    LogicalEntry logicalEntry = {
+        .addr = {
+            .stripeId = lsid,
+            .offset = column * BLOCKS_IN_CHUNK},
+        .blkCnt = BLOCKS_IN_CHUNK};
+    int ret = translator->Translate(arrayId, PartitionType::USER_DATA,
+        physicalEntries, logicalEntry);
+    if (ret != 0 || physicalEntries.size() != 1)
+    {
+        return false;
+    }
+    pba = physicalEntries.front().addr;
+    return true;
+}
+
+bool
+GcCopyOffload::_IsCopyable(IArrayDevice* arrayDev, uint32_t& maxRangeSectors,
+    uint32_t& maxRanges, uint32_t& maxSectors)
+{
+    if (nullptr == arrayDev || ArrayDeviceState::NORMAL != arrayDev->GetState() ||
+        nullptr == arrayDev->GetUblockPtr())
+    {
+        return false;
+    }
+    DeviceProperty property = arrayDev->GetUblockPtr()->GetProperty();
+    if (false == property.copySupported)
+    {
+        return false;
+    }
+    maxRangeSectors = property.maxCopyRangeSectors;
+    maxRanges = property.maxCopyRanges;
+    maxSectors = property.maxCopySectors;
+    return true;
+}
+
+// The pending io of the volume taken here is released by the map update of the
+// stripe, as for the stripes flushed from the gc write buffer
+std::shared_ptr<GcCopyStripe>
+GcCopyOffload::_Open(uint32_t volumeId)
+{
+    if (EID(SUCCESS) != volumeManager->IncreasePendingIOCountIfNotZero(volumeId, VolumeIoType::InternalIo))
+    {
+        return nullptr;
+    }
+    int token = flowControl->GetToken(FlowControlType::GC, blksPerStripe);
+    if (0 >= token)
+    {
+        volumeManager->DecreasePendingIOCount(volumeId, VolumeIoType::InternalIo);
+        return nullptr;
+    }
+    StripeSmartPtr stripe = iBlockAllocator->AllocateGcDestStripe(volumeId);
+    if (nullptr == stripe)
+    {
+        flowControl->ReturnToken(FlowControlType::GC, token);
+        volumeManager->DecreasePendingIOCount(volumeId, VolumeIoType::InternalIo);
+        return nullptr;
+    }
+
+    for (uint32_t offset = 0; offset < blksPerStripe; offset++)
+    {
+        stripe->UpdateReverseMapEntry(offset, INVALID_RBA, volumeId);
+    }
+    std::shared_ptr<GcCopyStripe> copyStripe = std::make_shared<GcCopyStripe>();
+    copyStripe->stripe = stripe;
+    copyStripe->volumeId = volumeId;
+    copyStripe->columnTail.assign(chunksPerStripe, 0);
+    copyStripe->pendingCount = 0;
+    copyStripe->closing = false;
+    activeStripes[volumeId] = copyStripe;
+    return copyStripe;
+}
+
+// Called with the stripe lock of the volume held
+void
+GcCopyOffload::_Close(uint32_t volumeId)
+{
+    std::shared_ptr<GcCopyStripe> copyStripe = activeStripes[volumeId];
+    activeStripes[volumeId] = nullptr;
+    copyStripe->closing = true;
+    if (0 == copyStripe->pendingCount)
+    {
+        _Flush(copyStripe);
+    }
+}
+
+// The data is already in place, so the stripe goes straight to the flush
+// completion, which writes its reverse map and updates the block map
+void
+GcCopyOffload::_Flush(std::shared_ptr<GcCopyStripe> copyStripe)
+{
+    gcStripeManager->CopyStripeRequested();
+    gcStripeManager->FlushSubmitted();
+    EventSmartPtr flushCompletion = std::make_shared<GcFlushCompletion>(copyStripe->stripe,
+        arrayName, gcStripeManager, nullptr);
+    EventSchedulerSingleton::Instance()->EnqueueEvent(flushCompletion);
+    POS_TRACE_DEBUG(EID(GC_STRIPE_FLUSH_SUBMISSION),
+        "arrayName:{}, stripeUserLsid:{}, copy_offload:true",
+        arrayName, copyStripe->stripe->GetUserLsid());
+}
+
+GcCopyOffloadCompletion::GcCopyOffloadCompletion(GcCopyOffload* copyOffload,
+    std::shared_ptr<GcCopyStripe> copyStripe, uint32_t destOffset, StripeId victimLsid,
+    uint32_t listIndex, uint32_t copyIndex, CopierMeta* meta, IVolumeIoManager* volumeManager)
+: Callback(false, CallbackType_GcCopyOffloadCompletion),
+  copyOffload(copyOffload),
+  copyStripe(copyStripe),
+  destOffset(destOffset),
+  victimLsid(victimLsid),
+  listIndex(listIndex),
+  copyIndex(copyIndex),
+  meta(meta),
+  volumeManager(volumeManager)
+{
+}
+
+GcCopyOffloadCompletion::~GcCopyOffloadCompletion(void)
+{
+}
+
+bool
+GcCopyOffloadCompletion::_DoSpecificJob(void)
+{
+    VictimStripe* victimStripe =
+        meta->GetVictimStripe(copyIndex, victimLsid % meta->GetStripePerSegment());
+    uint32_t blkCnt = victimStripe->GetBlkInfoList(listIndex).size();
+    if (_GetErrorCount() > 0)
+    {
+        // The blocks are read and written by the host instead, so that the
+        // victim segment can still be freed
+        if (false == _ReadVictimChunk())
+        {
+            return false;
+        }
+        for (uint32_t index = 0; index < blkCnt; index++)
+        {
+            copyStripe->stripe->UpdateReverseMapEntry(destOffset + index, INVALID_RBA,
+                copyStripe->volumeId);
+        }
+        POS_TRACE_WARN(EID(GC_COPY_OFFLOAD_FAILED),
+            "stripe_id:{}, list_index:{}, block_count:{}", victimLsid, listIndex, blkCnt);
+        copyOffload->CopyDone(copyStripe);
+        return true;
+    }
+
+    volumeManager->DecreasePendingIOCount(copyStripe->volumeId, VolumeIoType::InternalIo, blkCnt);
+    meta->SetDoneCopyBlks(blkCnt);
+    copyOffload->CopyDone(copyStripe);
+    return true;
+}
+
+bool
+GcCopyOffloadCompletion::_ReadVictimChunk(void)
+{
+    std::vector<void*> buffers;
+    meta->GetBuffers(1, &buffers);
+    if (buffers.empty())
+    {
+        return false;
+    }
+    VictimStripe* victimStripe =
+        meta->GetVictimStripe(copyIndex, victimLsid % meta->GetStripePerSegment());
+    uint32_t startOffset = victimStripe->GetBlkInfoList(listIndex).begin()->vsa.offset;
+    LogicalBlkAddr lsa = {victimLsid, (startOffset / BLOCKS_IN_CHUNK) * BLOCKS_IN_CHUNK};
+    EventSmartPtr copyEvent = std::make_shared<StripeCopier::CopyEvent>(buffers.front(),
+        lsa, listIndex, meta, victimLsid, copyIndex);
+    EventSchedulerSingleton::Instance()->EnqueueEvent(copyEvent);
+    return true;
+}
+
+} // namespace pos
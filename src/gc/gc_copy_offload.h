@@ -0,0 +1,145 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "src/allocator/stripe_manager/stripe.h"
+#include "src/bio/copy_command.h"
+#include "src/event_scheduler/callback.h"
+#include "src/gc/victim_stripe.h"
+#include "src/include/address_type.h"
+#include "src/include/pos_event_id.h"
+#include "src/volume/volume_base.h"
+
+namespace pos
+{
+class ConfigManager;
+class CopierMeta;
+class FlowControl;
+class GcStripeManager;
+class IArrayInfo;
+class IBlockAllocator;
+class IIODispatcher;
+class IIOTranslator;
+class IReverseMap;
+class IVolumeIoManager;
+
+// Destination stripe of device-side copies. A block keeps its column, so that
+// the copy stays within one ssd, and columnTail is the next free block of each
+// column. The stripe is flushed once it is closed and no copy is in flight.
+struct GcCopyStripe
+{
+    StripeSmartPtr stripe;
+    uint32_t volumeId;
+    std::vector<uint32_t> columnTail;
+    uint32_t pendingCount;
+    bool closing;
+};
+
+// Moves the valid blocks of a victim chunk with one nvme copy command instead
+// of reading them to memory and writing them back with the gc write buffer.
+// Only the layouts without parity are taken, as the parity of the destination
+// stripe would have to be computed from the data on the host. Whenever the
+// copy cannot be used, TryCopy returns false and GC takes the normal path.
+class GcCopyOffload
+{
+public:
+    GcCopyOffload(IArrayInfo* iArrayInfo, GcStripeManager* gcStripeManager,
+        IBlockAllocator* iBlockAllocator, IIOTranslator* translator,
+        IIODispatcher* ioDispatcher, IVolumeIoManager* volumeManager,
+        FlowControl* flowControl, IReverseMap* iReverseMap);
+    virtual ~GcCopyOffload(void);
+
+    static GcCopyOffload* Create(IArrayInfo* iArrayInfo, GcStripeManager* gcStripeManager,
+        ConfigManager* configManager);
+    static uint32_t BuildRanges(CopyCommand* copyCommand, const std::vector<uint64_t>& srcLbas,
+        uint32_t sectorsPerBlock, uint32_t maxRangeSectors, uint32_t maxRanges);
+
+    virtual bool TryCopy(StripeId victimLsid, uint32_t listIndex, uint32_t copyIndex,
+        CopierMeta* meta);
+    virtual void CopyDone(std::shared_ptr<GcCopyStripe> copyStripe);
+    virtual void CloseAll(void);
+
+private:
+    bool _TranslateChunk(StripeId lsid, uint32_t column, PhysicalBlkAddr& pba);
+    bool _IsCopyable(IArrayDevice* arrayDev, uint32_t& maxRangeSectors,
+        uint32_t& maxRanges, uint32_t& maxSectors);
+    std::shared_ptr<GcCopyStripe> _Open(uint32_t volumeId);
+    void _Close(uint32_t volumeId);
+    void _Flush(std::shared_ptr<GcCopyStripe> copyStripe);
+
+    IArrayInfo* iArrayInfo;
+    GcStripeManager* gcStripeManager;
+    IBlockAllocator* iBlockAllocator;
+    IIOTranslator* translator;
+    IIODispatcher* ioDispatcher;
+    IVolumeIoManager* volumeManager;
+    FlowControl* flowControl;
+    IReverseMap* iReverseMap;
+    uint32_t arrayId;
+    std::string arrayName;
+    uint32_t chunksPerStripe;
+    uint32_t blksPerStripe;
+
+    std::shared_ptr<GcCopyStripe> activeStripes[MAX_VOLUME_COUNT];
+    std::mutex stripeLocks[MAX_VOLUME_COUNT];
+};
+
+class GcCopyOffloadCompletion : public Callback
+{
+public:
+    GcCopyOffloadCompletion(GcCopyOffload* copyOffload, std::shared_ptr<GcCopyStripe> copyStripe,
+        uint32_t destOffset, StripeId victimLsid, uint32_t listIndex, uint32_t copyIndex,
+        CopierMeta* meta, IVolumeIoManager* volumeManager);
+    ~GcCopyOffloadCompletion(void) override;
+
+private:
+    bool _DoSpecificJob(void) override;
+    bool _ReadVictimChunk(void);
+
+    GcCopyOffload* copyOffload;
+    std::shared_ptr<GcCopyStripe> copyStripe;
+    uint32_t destOffset;
+    StripeId victimLsid;
+    uint32_t listIndex;
+    uint32_t copyIndex;
+    CopierMeta* meta;
+    IVolumeIoManager* volumeManager;
+};
+
+} // namespace pos
@@ -78,6 +78,11 @@ GcFlushCompletion::GcFlushCompletion(StripeSmartPtr stripe, string arrayName, Gc
   iArrayInfo(inputIArrayInfo),
   iVSAMap(iVSAMap)
 {
+    SetEventType(BackendEvent_GC);
+    if (nullptr != iArrayInfo)
+    {
+        SetArrayId(iArrayInfo->GetIndex());
+    }
 }
 
 GcFlushCompletion::~GcFlushCompletion(void)
@@ -48,12 +48,16 @@
 #include "src/gc/flow_control/flow_control_service.h"
 #include "src/gc/gc_flush_completion.h"
 #include "src/include/address_type.h"
+#include "src/include/array_config.h"
 #include "src/include/backend_event.h"
 #include "src/include/pos_event_id.hpp"
+#include "src/io/general_io/block_checksum.h"
 #include "src/io/general_io/rba_state_manager.h"
 #include "src/io/general_io/rba_state_service.h"
 #include "src/io/general_io/translator.h"
+#include "src/io/general_io/write_amplification_monitor_service.h"
 #include "src/logger/logger.h"
+#include "src/mapper/reversemap/reverse_map_footer.h"
 #include "src/volume/volume_service.h"
 
 namespace pos
@@ -87,6 +91,10 @@ GcFlushSubmission::GcFlushSubmission(std::string arrayName, std::vector<BlkInfo>
   isForceFlush(forceFlush)
 {
     SetEventType(BackendEvent_Flush);
+    if (nullptr != iArrayInfo)
+    {
+        SetArrayId(iArrayInfo->GetIndex());
+    }
 }
 
 GcFlushSubmission::~GcFlushSubmission(void)
@@ -131,6 +139,7 @@ GcFlushSubmission::Execute(void)
     }
 
     uint32_t validCnt = 0;
+    bool checksumEnabled = BlockChecksum::IsEnabled();
     for (uint32_t offset = 0; offset < blkInfoList->size(); offset++)
     {
         std::vector<BlkInfo>::iterator it = blkInfoList->begin();
@@ -143,6 +152,12 @@ GcFlushSubmission::Execute(void)
             break;
         }
         stripe->UpdateReverseMapEntry(offset, blkInfo.rba, volumeId);
+        if (checksumEnabled)
+        {
+            char* block = static_cast<char*>((*dataBuffer)[offset / BLOCKS_IN_CHUNK]) +
+                (offset % BLOCKS_IN_CHUNK) * BLOCK_SIZE;
+            stripe->UpdateReverseMapChecksum(offset, BlockChecksum::Compute(block));
+        }
         stripe->UpdateVictimVsa(offset, blkInfo.vsa);
         validCnt++;
     }
@@ -150,6 +165,17 @@ GcFlushSubmission::Execute(void)
     blkInfoList->clear();
     delete blkInfoList;
 
+    if (ReverseMapFooter::IsEnabled())
+    {
+        uint32_t blksPerStripe = iArrayInfo->GetSizeInfo(PartitionType::USER_DATA)->blksPerStripe;
+        ReverseMapFooter::Store(stripe->GetRevMapPack(), blksPerStripe,
+            [this](uint32_t offset)
+            {
+                return static_cast<char*>((*dataBuffer)[offset / BLOCKS_IN_CHUNK]) +
+                    (offset % BLOCKS_IN_CHUNK) * BLOCK_SIZE;
+            });
+    }
+
     std::list<BufferEntry> bufferList;
 
     uint64_t blocksInStripe = 0;
@@ -196,6 +222,11 @@ GcFlushSubmission::Execute(void)
     {
         gcStripeManager->FlushSubmitted();
     }
+    if (IOSubmitHandlerStatus::SUCCESS == errorReturned)
+    {
+        WriteAmplificationMonitorServiceSingleton::Instance()->Add(iArrayInfo->GetIndex(),
+            WriteSource::Gc, blocksInStripe * ArrayConfig::BLOCK_SIZE_BYTE);
+    }
 
     POS_TRACE_DEBUG(EID(GC_STRIPE_FLUSH_SUBMISSION),
         "arrayName:{}, validCnt:{}, stripeUserLsid:{}, result:{}",
@@ -210,6 +241,10 @@ GcFlushSubmission::Execute(void)
 StripeSmartPtr
 GcFlushSubmission::_AllocateStripe(uint32_t volumeId)
 {
+    if (gcStripeManager->IsColdData(volumeId, blkInfoList) == true)
+    {
+        return iBlockAllocator->AllocateGcColdDestStripe(volumeId);
+    }
     StripeSmartPtr stripe = iBlockAllocator->AllocateGcDestStripe(volumeId);
     return stripe;
 }
@@ -48,6 +48,8 @@
 #include "src/include/pos_event_id.hpp"
 #include "src/io/backend_io/flush_completion.h"
 #include "src/io/backend_io/stripe_map_update_request.h"
+#include "src/io/frontend_io/read_cache.h"
+#include "src/io/frontend_io/read_cache_service.h"
 #include "src/io/general_io/rba_state_manager.h"
 #include "src/io/general_io/rba_state_service.h"
 #include "src/logger/logger.h"
@@ -110,6 +112,7 @@ GcMapUpdateRequest::_BuildMeta(void)
     uint32_t volId;
     VirtualBlkAddr currentVsa;
     bool isValidData = false;
+    ReadCache* readCache = ReadCacheServiceSingleton::Instance()->GetReadCache(iArrayInfo->GetIndex());
 
     for (; currentStripeOffset < totalBlksPerUserStripe; currentStripeOffset++)
     {
@@ -132,6 +135,10 @@ GcMapUpdateRequest::_BuildMeta(void)
             {
                 _AddBlockMapUpdateLog(rba, writeVsa);
                 _RegisterInvalidateSegments(currentVsa);
+                if (readCache != nullptr)
+                {
+                    readCache->Invalidate(currentVsa);
+                }
             }
         }
     }
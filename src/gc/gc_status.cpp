@@ -55,8 +55,7 @@ CopyInfo::SetInfo(uint32_t invalidCnt, uint32_t copyDoneCnt)
 }
 
 GcStatus::GcStatus(void)
-: gcRunning(false),
-  currentCopyInfo(0)
+: gcRunning(false)
 {
     startTime = {
         0,
@@ -74,28 +73,60 @@ int
 GcStatus::SetCopyInfo(bool started, uint32_t victimSegment,
     uint32_t invalidCnt, uint32_t copyDoneCnt)
 {
+    std::lock_guard<std::mutex> lock(statusLock);
     if (false == started)
     {
         CopyInfo copyInfo(victimSegment);
-        currentCopyInfo = copyInfo;
+        currentCopyInfos.erase(victimSegment);
+        currentCopyInfos.emplace(victimSegment, copyInfo);
         gettimeofday(&startTime, NULL);
         gcRunning = true;
     }
     else
     {
-        currentCopyInfo.SetInfo(invalidCnt, copyDoneCnt);
+        auto it = currentCopyInfos.find(victimSegment);
+        CopyInfo copyInfo = (it != currentCopyInfos.end()) ? it->second : CopyInfo(victimSegment);
+        if (it != currentCopyInfos.end())
+        {
+            currentCopyInfos.erase(it);
+        }
+        copyInfo.SetInfo(invalidCnt, copyDoneCnt);
 
         if (logCount < copyInfoList.size())
         {
             copyInfoList.pop();
         }
-        copyInfoList.push(currentCopyInfo);
+        copyInfoList.push(copyInfo);
 
         gettimeofday(&endTime, NULL);
-        gcRunning = false;
+        gcRunning = (false == currentCopyInfos.empty());
     }
 
     return 0;
 }
 
+std::queue<CopyInfo>
+GcStatus::GetCopyInfoList(void)
+{
+    std::lock_guard<std::mutex> lock(statusLock);
+    return copyInfoList;
+}
+
+bool
+GcStatus::GetGcRunning(void)
+{
+    std::lock_guard<std::mutex> lock(statusLock);
+    return gcRunning;
+}
+
+void
+GcStatus::SetCopyDepth(uint32_t targetDepth, uint32_t currentDepth,
+    uint32_t readBatch, uint64_t hostP99Us_)
+{
+    copyTargetDepth = targetDepth;
+    copyCurrentDepth = currentDepth;
+    copyReadBatch = readBatch;
+    hostP99Us = hostP99Us_;
+}
+
 } // namespace pos
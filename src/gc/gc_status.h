@@ -35,6 +35,8 @@
 #include <sys/time.h>
 
 #include <cstdint>
+#include <map>
+#include <mutex>
 #include <queue>
 
 #include "src/lib/singleton.h"
@@ -94,16 +96,8 @@ public:
 
     int SetCopyInfo(bool started, uint32_t victimSegment,
         uint32_t invalidCnt, uint32_t copyDoneCnt);
-    std::queue<CopyInfo>
-    GetCopyInfoList(void)
-    {
-        return copyInfoList;
-    }
-    bool
-    GetGcRunning(void)
-    {
-        return gcRunning;
-    }
+    std::queue<CopyInfo> GetCopyInfoList(void);
+    bool GetGcRunning(void);
 
     struct timeval
     GetStartTime(void)
@@ -116,14 +110,44 @@ public:
         return endTime;
     }
 
+    void SetCopyDepth(uint32_t targetDepth, uint32_t currentDepth,
+        uint32_t readBatch, uint64_t hostP99Us);
+    uint32_t
+    GetCopyTargetDepth(void)
+    {
+        return copyTargetDepth;
+    }
+    uint32_t
+    GetCopyCurrentDepth(void)
+    {
+        return copyCurrentDepth;
+    }
+    uint32_t
+    GetCopyReadBatch(void)
+    {
+        return copyReadBatch;
+    }
+    uint64_t
+    GetHostP99Us(void)
+    {
+        return hostP99Us;
+    }
+
 private:
     bool gcRunning;
     uint32_t logCount = 30;
     std::queue<CopyInfo> copyInfoList;
-    CopyInfo currentCopyInfo;
+    // Copies in progress by victim segment, one per concurrent copier
+    std::map<uint32_t, CopyInfo> currentCopyInfos;
+    std::mutex statusLock;
 
     struct timeval startTime;
     struct timeval endTime;
+
+    uint32_t copyTargetDepth = 0;
+    uint32_t copyCurrentDepth = 0;
+    uint32_t copyReadBatch = 0;
+    uint64_t hostP99Us = 0;
 };
 
 } // namespace pos
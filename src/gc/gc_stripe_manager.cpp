@@ -39,12 +39,15 @@
 #include "src/allocator/i_block_allocator.h"
 #include "src/allocator/i_wbstripe_allocator.h"
 #include "src/allocator_service/allocator_service.h"
+#include "src/gc/cold_data_classifier.h"
+#include "src/gc/gc_copy_offload.h"
 #include "src/gc/gc_flush_submission.h"
 #include "src/include/branch_prediction.h"
 #include "src/include/meta_const.h"
 #include "src/include/array_config.h"
 #include "src/io/general_io/translator.h"
 #include "src/logger/logger.h"
+#include "src/mapper/reversemap/reverse_map_footer.h"
 #include "src/resource_manager/buffer_pool.h"
 #include "src/sys_event/volume_event_publisher.h"
 #include "src/event_scheduler/event_scheduler.h"
@@ -65,7 +68,9 @@ GcStripeManager::_SetBufferPool(void)
         .owner = typeid(this).name(),
         .size = CHUNK_SIZE,
         // Assign a buffer that is twice the size of the GC read buffer
-        .count = udSize->chunksPerStripe * ArrayConfig::GC_BUFFER_COUNT * 2};
+        .count = udSize->chunksPerStripe * ArrayConfig::GC_BUFFER_COUNT * 2,
+        // GC may not run for a long time after mount
+        .lazy = true};
 
     gcWriteBufferPool = memoryManager->CreateBufferPool(info);
     assert(gcWriteBufferPool != nullptr);
@@ -81,6 +86,12 @@ GcStripeManager::GcStripeManager(IArrayInfo* iArrayInfo,
 {
     _SetForceFlushInterval();
     udSize = iArrayInfo->GetSizeInfo(PartitionType::USER_DATA);
+    coldDataClassifier = new ColdDataClassifier(arrayId, (udSize != nullptr) ? udSize->stripesPerSegment : 0);
+    if (udSize != nullptr)
+    {
+        dataBlksPerStripe = udSize->blksPerStripe - ReverseMapFooter::GetBlockCount(udSize->blksPerStripe);
+        copyOffload = GcCopyOffload::Create(iArrayInfo, this, ConfigManagerSingleton::Instance());
+    }
 
     for (uint32_t volId = 0; volId < GC_VOLUME_COUNT; volId++)
     {
@@ -135,6 +146,8 @@ GcStripeManager::~GcStripeManager(void)
     {
         memoryManager->DeleteBufferPool(gcWriteBufferPool);
     }
+    delete coldDataClassifier;
+    delete copyOffload;
 
     volumeEventPublisher->RemoveSubscriber(this, arrayName, arrayId);
 }
@@ -232,7 +245,7 @@ GcStripeManager::AllocateWriteBufferBlks(uint32_t volumeId, uint32_t numBlks)
 
         _StartTimer(volumeId);
         _SetActiveStripeTail(volumeId, 0);
-        _SetActiveStripeRemaining(volumeId, udSize->blksPerStripe);
+        _SetActiveStripeRemaining(volumeId, dataBlksPerStripe);
         _CreateBlkInfoList(volumeId);
     }
 
@@ -322,6 +335,16 @@ GcStripeManager::GetBlkInfoList(uint32_t volumeId)
     return blkInfoList[volumeId];
 }
 
+bool
+GcStripeManager::IsColdData(uint32_t volumeId, std::vector<BlkInfo>* blkInfos)
+{
+    if (blkInfos == nullptr || coldDataClassifier->IsEnabled() == false)
+    {
+        return false;
+    }
+    return coldDataClassifier->IsCold(volumeId, *blkInfos);
+}
+
 bool
 GcStripeManager::DecreaseRemainingAndCheckIsFull(uint32_t volumeId, uint32_t cnt)
 {
@@ -443,6 +466,29 @@ GcStripeManager::UpdateMapCompleted(void)
     ++gcStripeCntMapUpdateCompleted;
 }
 
+// A stripe filled by device-side copies skips the write buffer, and is
+// counted here when it is handed over to the flush completion
+void
+GcStripeManager::CopyStripeRequested(void)
+{
+    ++gcStripeCntRequested;
+}
+
+GcCopyOffload*
+GcStripeManager::GetCopyOffload(void)
+{
+    return copyOffload;
+}
+
+void
+GcStripeManager::CloseCopyStripes(void)
+{
+    if (copyOffload != nullptr)
+    {
+        copyOffload->CloseAll();
+    }
+}
+
 uint32_t
 GcStripeManager::_DecreaseActiveStripeRemaining(uint32_t volumeId, uint32_t cnt)
 {
@@ -520,15 +566,15 @@ GcStripeManager::_AllocateBlks(uint32_t volumeId, uint32_t numBlks)
 
     GcAllocateBlks gcAllocateBlks;
     gcAllocateBlks.startOffset = _GetActiveStripeTail(volumeId);
-    if (udSize->blksPerStripe == gcAllocateBlks.startOffset)
+    if (dataBlksPerStripe == gcAllocateBlks.startOffset)
     {
         gcAllocateBlks.numBlks = 0;
         return gcAllocateBlks;
     }
 
-    if (udSize->blksPerStripe < gcAllocateBlks.startOffset + numBlks)
+    if (dataBlksPerStripe < gcAllocateBlks.startOffset + numBlks)
     {
-        gcAllocateBlks.numBlks = udSize->blksPerStripe - gcAllocateBlks.startOffset;
+        gcAllocateBlks.numBlks = dataBlksPerStripe - gcAllocateBlks.startOffset;
     }
     else
     {
@@ -53,6 +53,8 @@ class IBlockAllocator;
 class IWBStripeAllocator;
 class VolumeEventPublisher;
 class BufferPool;
+class ColdDataClassifier;
+class GcCopyOffload;
 
 using GcWriteBuffer = std::vector<void*>;
 struct GcAllocateBlks
@@ -92,6 +94,7 @@ public:
     virtual bool DecreaseRemainingAndCheckIsFull(uint32_t volumeId, uint32_t cnt);
     virtual void SetBlkInfo(uint32_t volumeId, uint32_t offset, BlkInfo blkInfo);
     virtual std::vector<BlkInfo>* GetBlkInfoList(uint32_t volumeId);
+    virtual bool IsColdData(uint32_t volumeId, std::vector<BlkInfo>* blkInfos);
     virtual void SetFlushed(uint32_t volumeId, bool force = false);
     virtual bool IsAllFinished(void);
     void CheckTimeout(void);
@@ -101,6 +104,9 @@ public:
     virtual void FlushCompleted(void);
     virtual void UpdateMapRequested(void);
     virtual void UpdateMapCompleted(void);
+    virtual void CopyStripeRequested(void);
+    virtual GcCopyOffload* GetCopyOffload(void);
+    virtual void CloseCopyStripes(void);
 
     static const uint32_t GC_VOLUME_COUNT = MAX_VOLUME_COUNT;
 
@@ -130,6 +136,7 @@ private:
     std::mutex gcWriteBufferLock[GC_VOLUME_COUNT];
     std::vector<BlkInfo>* blkInfoList[GC_VOLUME_COUNT];
     const PartitionLogicalSize* udSize;
+    uint32_t dataBlksPerStripe = 0;
 
     std::atomic<uint64_t> gcStripeCntRequested;
     std::atomic<uint64_t> gcStripeCntCompleted;
@@ -148,6 +155,8 @@ private:
     uint32_t bufAllocRetryCnt = 0;
     void _RegisterTelemetry(uint32_t arrayId);
     TelemetryPublisher* publisher = nullptr;
+    ColdDataClassifier* coldDataClassifier = nullptr;
+    GcCopyOffload* copyOffload = nullptr;
 };
 
 } // namespace pos
@@ -34,10 +34,18 @@
 
 #include <air/Air.h>
 
+#include "src/logger/logger.h"
+
 namespace pos
 {
 ReverseMapLoadCompletion::ReverseMapLoadCompletion(void)
-: Callback(false, CallbackType_ReverseMapLoadCompletion)
+: ReverseMapLoadCompletion(nullptr)
+{
+}
+
+ReverseMapLoadCompletion::ReverseMapLoadCompletion(VictimStripe* victimStripe)
+: Callback(false, CallbackType_ReverseMapLoadCompletion),
+  victimStripe(victimStripe)
 {
 }
 
@@ -50,6 +58,17 @@ ReverseMapLoadCompletion::_DoSpecificJob(void)
 {
     uint64_t objAddr = reinterpret_cast<uint64_t>(this);
     airlog("LAT_VictimLoad", "end", 0, objAddr);
+
+    if (nullptr != victimStripe)
+    {
+        if (_GetErrorCount() != 0)
+        {
+            // TODO(jg121.lim) : reverse map load error handling
+            POS_TRACE_ERROR(EID(GC_REVERSE_MAP_LOAD_ERROR), "readahead load failed");
+            assert(false);
+        }
+        victimStripe->SetReverseMapLoaded();
+    }
     return true;
 }
 
@@ -41,10 +41,13 @@ class ReverseMapLoadCompletion : public Callback
 {
 public:
     ReverseMapLoadCompletion(void);
+    explicit ReverseMapLoadCompletion(VictimStripe* victimStripe);
     virtual ~ReverseMapLoadCompletion(void) override;
 
 private:
     bool _DoSpecificJob(void) override;
+
+    VictimStripe* victimStripe;
 };
 
 } // namespace pos
@@ -32,11 +32,15 @@
 
 #include "src/gc/stripe_copier.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 
 #include "src/event_scheduler/event_scheduler.h"
 #include "src/gc/copier_read_completion.h"
+#include "src/gc/gc_copy_controller.h"
+#include "src/gc/gc_copy_offload.h"
+#include "src/gc/gc_stripe_manager.h"
 #include "src/include/backend_event.h"
 #include "src/include/meta_const.h"
 #include "src/io_submit_interface/i_io_submit_handler.h"
@@ -44,27 +48,33 @@
 
 namespace pos
 {
-StripeCopier::StripeCopier(StripeId victimStripeId, CopierMeta* meta, uint32_t copyIndex)
+StripeCopier::StripeCopier(StripeId victimStripeId, CopierMeta* meta, uint32_t copyIndex,
+    uint32_t concurrentCount)
 : StripeCopier(victimStripeId, meta, copyIndex,
       nullptr, nullptr,
-      EventSchedulerSingleton::Instance())
+      EventSchedulerSingleton::Instance(), concurrentCount)
 {
 }
 
 StripeCopier::StripeCopier(StripeId victimStripeId, CopierMeta* meta, uint32_t copyIndex,
     EventSmartPtr inputCopyEvent, EventSmartPtr inputStripeCopier,
-    EventScheduler* inputEventScheduler)
+    EventScheduler* inputEventScheduler, uint32_t concurrentCount)
 : victimStripeId(victimStripeId),
   meta(meta),
   loadedValidBlock(false),
   listIndex(0),
   stripeOffset(victimStripeId % STRIPES_PER_SEGMENT),
   copyIndex(copyIndex),
+  concurrentCount(concurrentCount),
   inputCopyEvent(inputCopyEvent),
   inputStripeCopier(inputStripeCopier),
   eventScheduler(inputEventScheduler)
 {
     SetEventType(BackendEvent_GC);
+    if (nullptr != meta)
+    {
+        SetArrayId(meta->GetArrayIndex());
+    }
 }
 
 StripeCopier::~StripeCopier(void)
@@ -76,6 +86,12 @@ StripeCopier::Execute(void)
 {
     if (false == loadedValidBlock)
     {
+        meta->LoadReverseMapAhead(copyIndex, stripeOffset + CopierMeta::REVERSE_MAP_READAHEAD_COUNT);
+        if (false == meta->GetVictimStripe(copyIndex, stripeOffset)->IsReverseMapLoaded())
+        {
+            return false;
+        }
+
         bool isLoaded = meta->GetVictimStripe(copyIndex, stripeOffset)->LoadValidBlock();
 
         if (false == isLoaded)
@@ -86,10 +102,17 @@ StripeCopier::Execute(void)
         loadedValidBlock = true;
     }
 
+    GcCopyController* copyController = meta->GetCopyController();
     uint32_t listSize = meta->GetVictimStripe(copyIndex, stripeOffset)->GetBlkInfoListSize();
-    if (0 != listSize)
+    _OffloadCopies(listSize);
+    if (listIndex < listSize)
     {
-        uint32_t count = listSize - listIndex;
+        uint32_t remaining = listSize - listIndex;
+        uint32_t count = remaining;
+        if (nullptr != copyController)
+        {
+            count = std::min(remaining, copyController->GetReadBatch());
+        }
         vector<void*> buffers;
         meta->GetBuffers(count, &buffers);
         uint32_t bufCount = buffers.size();
@@ -98,7 +121,7 @@ StripeCopier::Execute(void)
         {
             void* buffer = buffers.back();
             buffers.pop_back();
-            std::list<BlkInfo> blkInfoList = meta->GetVictimStripe(copyIndex, stripeOffset)->GetBlkInfoList(listIndex);
+            BlkInfoSpan blkInfoList = meta->GetVictimStripe(copyIndex, stripeOffset)->GetBlkInfoList(listIndex);
             LogicalBlkAddr lsa;
             auto startBlkInfo = blkInfoList.begin();
             uint32_t startOffset = startBlkInfo->vsa.offset;
@@ -119,13 +142,16 @@ StripeCopier::Execute(void)
             listIndex++;
         }
         meta->SetStartCopyBlks(requestCount);
-        if (count > bufCount)
+        if (remaining > bufCount)
         {
-            bufAllocRetryCnt++;
-            if (bufAllocRetryCnt % 100 == 0)
+            if (count > bufCount)
             {
-                POS_TRACE_DEBUG(EID(GC_GET_READ_BUFFER_FAILED), "stipe_id:{}, required_buf_count:{}, acquired_buf_count:{}, retry_count:{}",
-                    victimStripeId, count, bufCount, bufAllocRetryCnt);
+                bufAllocRetryCnt++;
+                if (bufAllocRetryCnt % 100 == 0)
+                {
+                    POS_TRACE_DEBUG(EID(GC_GET_READ_BUFFER_FAILED), "stipe_id:{}, required_buf_count:{}, acquired_buf_count:{}, retry_count:{}",
+                        victimStripeId, count, bufCount, bufAllocRetryCnt);
+                }
             }
             return false;
         }
@@ -133,13 +159,13 @@ StripeCopier::Execute(void)
     bufAllocRetryCnt = 0;
     meta->SetStartCopyStripes();
 
-    victimStripeId += CopierMeta::GC_CONCURRENT_COUNT;
-    if ((victimStripeId % meta->GetStripePerSegment() /*STRIPES_PER_SEGMENT*/) >= CopierMeta::GC_CONCURRENT_COUNT)
+    victimStripeId += concurrentCount;
+    if ((victimStripeId % meta->GetStripePerSegment() /*STRIPES_PER_SEGMENT*/) >= concurrentCount)
     {
         EventSmartPtr stripeCopier;
         if (nullptr == inputStripeCopier)
         {
-            stripeCopier = std::make_shared<StripeCopier>(victimStripeId, meta, copyIndex);
+            stripeCopier = std::make_shared<StripeCopier>(victimStripeId, meta, copyIndex, concurrentCount);
         }
         else
         {
@@ -147,9 +173,42 @@ StripeCopier::Execute(void)
         }
         eventScheduler->EnqueueEvent(stripeCopier);
     }
+    else if (nullptr != copyController)
+    {
+        copyController->CopyFinished();
+    }
     return true;
 }
 
+// Chunks are handed to the device-side copy until one cannot be, and the
+// rest of the stripe is read and written by the host
+void
+StripeCopier::_OffloadCopies(uint32_t listSize)
+{
+    GcStripeManager* gcStripeManager = meta->GetGcStripeManager();
+    if (nullptr == gcStripeManager)
+    {
+        return;
+    }
+    GcCopyOffload* copyOffload = gcStripeManager->GetCopyOffload();
+    if (nullptr == copyOffload)
+    {
+        return;
+    }
+    while (listIndex < listSize)
+    {
+        uint32_t blkCnt = meta->GetVictimStripe(copyIndex, stripeOffset)->GetBlkInfoList(listIndex).size();
+        if (false == copyOffload->TryCopy(victimStripeId, listIndex, copyIndex, meta))
+        {
+            break;
+        }
+        // The stripe is not started until SetStartCopyStripes, so the copy
+        // cannot be seen as done before it is counted here
+        meta->SetStartCopyBlks(blkCnt);
+        listIndex++;
+    }
+}
+
 StripeCopier::CopyEvent::CopyEvent(void* buffer,
     LogicalBlkAddr lsa,
     uint32_t listIndex,
@@ -47,14 +47,15 @@ class IIOSubmitHandler;
 class StripeCopier : public Event
 {
 public:
-    explicit StripeCopier(StripeId victimStripeId, CopierMeta* meta, uint32_t copyIndex);
+    explicit StripeCopier(StripeId victimStripeId, CopierMeta* meta, uint32_t copyIndex,
+                uint32_t concurrentCount = CopierMeta::GC_CONCURRENT_COUNT);
     StripeCopier(StripeId victimStripeId, CopierMeta* meta, uint32_t copyIndex,
                 EventSmartPtr inputCopyEvent, EventSmartPtr inputStripeCopier,
-                EventScheduler* inputEventScheduler);
+                EventScheduler* inputEventScheduler,
+                uint32_t concurrentCount = CopierMeta::GC_CONCURRENT_COUNT);
     virtual ~StripeCopier(void);
     virtual bool Execute(void);
 
-private:
     class CopyEvent : public Event
     {
     public:
@@ -88,6 +89,9 @@ private:
         IIOSubmitHandler* iIOSubmitHandler;
     };
 
+private:
+    void _OffloadCopies(uint32_t listSize);
+
     StripeId victimStripeId;
     CopierMeta* meta;
 
@@ -95,6 +99,7 @@ private:
     uint32_t listIndex;
     uint32_t stripeOffset;
     uint32_t copyIndex;
+    uint32_t concurrentCount;
 
     EventSmartPtr inputCopyEvent;
     EventSmartPtr inputStripeCopier;
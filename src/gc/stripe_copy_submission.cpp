@@ -32,10 +32,12 @@
 
 #include "src/gc/stripe_copy_submission.h"
 
+#include <algorithm>
 #include <list>
 #include <memory>
 
 #include "src/event_scheduler/event_scheduler.h"
+#include "src/gc/gc_copy_controller.h"
 #include "src/gc/stripe_copier.h"
 #include "src/include/backend_event.h"
 #include "src/logger/logger.h"
@@ -59,6 +61,10 @@ StripeCopySubmission::StripeCopySubmission(StripeId baseStripeId, CopierMeta* me
   eventScheduler(inputEventScheduler)
 {
     SetEventType(BackendEvent_GC);
+    if (nullptr != meta)
+    {
+        SetArrayId(meta->GetArrayIndex());
+    }
 }
 
 StripeCopySubmission::~StripeCopySubmission(void)
@@ -77,7 +83,8 @@ StripeCopySubmission::_DoSpecificJob(void)
     POS_TRACE_DEBUG(EID(GC_REVERSE_MAP_LOADED), "victim_segment:{}", copyIndex);
     if (isLoaded == false)
     {
-        for (uint32_t index = 0; index < meta->GetStripePerSegment(); index++)
+        uint32_t loadedCount = std::min(meta->GetStripePerSegment(), CopierMeta::REVERSE_MAP_READAHEAD_COUNT);
+        for (uint32_t index = 0; index < loadedCount; index++)
         {
             meta->GetVictimStripe(copyIndex, index)->LoadValidBlock();
         }
@@ -92,12 +99,22 @@ StripeCopySubmission::_DoSpecificJob(void)
         return false;
     }
 
+    uint32_t concurrentCount = CopierMeta::GC_CONCURRENT_COUNT;
+    GcCopyController* copyController = meta->GetCopyController();
+    if (nullptr != copyController)
+    {
+        concurrentCount = std::min(copyController->GetTargetDepth(), meta->GetStripePerSegment());
+        // a stripe copier may only run within the readahead window of loaded reverse maps
+        concurrentCount = std::min(concurrentCount, CopierMeta::REVERSE_MAP_READAHEAD_COUNT);
+        copyController->CopyStarted(concurrentCount);
+    }
+
     EventSmartPtr stripeCopier;
-    for (uint32_t index = 0; index < CopierMeta::GC_CONCURRENT_COUNT; index++)
+    for (uint32_t index = 0; index < concurrentCount; index++)
     {
         if (nullptr == inputEvent)
         {
-            stripeCopier = std::make_shared<StripeCopier>(baseStripeId + index, meta, copyIndex);
+            stripeCopier = std::make_shared<StripeCopier>(baseStripeId + index, meta, copyIndex, concurrentCount);
         }
         else
         {
@@ -107,7 +124,7 @@ StripeCopySubmission::_DoSpecificJob(void)
         eventScheduler->EnqueueEvent(stripeCopier);
     }
 
-    POS_TRACE_DEBUG(EID(GC_COPY_SUBMISSION), "victim_segment:{}", copyIndex);
+    POS_TRACE_DEBUG(EID(GC_COPY_SUBMISSION), "victim_segment:{}, concurrent_count:{}", copyIndex, concurrentCount);
     return true;
 }
 
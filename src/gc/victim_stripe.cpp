@@ -65,6 +65,7 @@ VictimStripe::VictimStripe(IArrayInfo* array,
   blockOffset(0),
   validBlockCnt(0),
   isLoaded(false),
+  revMapLoaded(false),
   array(array),
   iReverseMap(inputRevMap),
   iVSAMap(inputIVSAMap),
@@ -73,11 +74,14 @@ VictimStripe::VictimStripe(IArrayInfo* array,
   revMapPack(nullptr)
 {
     dataBlks = array->GetSizeInfo(PartitionType::USER_DATA)->blksPerStripe;
+    blkInfos.reserve(dataBlks);
+    blkInfoListEnds.reserve(dataBlks / BLOCKS_IN_CHUNK + 1);
 }
 
 VictimStripe::~VictimStripe(void)
 {
-    validBlkInfos.clear();
+    blkInfos.clear();
+    blkInfoListEnds.clear();
     if (nullptr != revMapPack)
     {
         delete revMapPack;
@@ -97,13 +101,14 @@ void
 VictimStripe::_InitValue(StripeId _lsid)
 {
     myLsid = _lsid;
-    validBlkInfos.clear();
-    blkInfoList.clear();
+    blkInfos.clear();
+    blkInfoListEnds.clear();
 
     chunkIndex = 0;
     blockOffset = 0;
     validBlockCnt = 0;
     isLoaded = false;
+    revMapLoaded = false;
 
     if (iReverseMap != nullptr)
     {
@@ -117,6 +122,16 @@ VictimStripe::_LoadReverseMap(CallbackSmartPtr callback)
     iReverseMap->Load(revMapPack, callback);
 }
 
+void
+VictimStripe::_CloseBlkInfoList(void)
+{
+    uint32_t start = blkInfoListEnds.empty() ? 0 : blkInfoListEnds.back();
+    if (blkInfos.size() > start)
+    {
+        blkInfoListEnds.push_back(blkInfos.size());
+    }
+}
+
 bool
 VictimStripe::LoadValidBlock(void)
 {
@@ -127,18 +142,14 @@ VictimStripe::LoadValidBlock(void)
 
     POS_TRACE_DEBUG(EID(GC_VALID_BLOCKS_LOADING),
         "stripe_id:{}, blockOffset:{}, valid_block_count:{}",
-        myLsid, blockOffset, validBlkInfos.size());
+        myLsid, blockOffset, blkInfoListEnds.size());
 
     for (; blockOffset < dataBlks; blockOffset++)
     {
         if (chunkIndex != blockOffset / BLOCKS_IN_CHUNK)
         {
             chunkIndex++;
-            if (false == blkInfoList.empty())
-            {
-                validBlkInfos.push_back(blkInfoList);
-                blkInfoList.clear();
-            }
+            _CloseBlkInfoList();
         }
 
         BlkInfo blkInfo;
@@ -186,16 +197,12 @@ VictimStripe::LoadValidBlock(void)
             }
 
             airlog("InternalIoPendingCnt", "user", blkInfo.volID, 1);
-            blkInfoList.push_back(blkInfo);
+            blkInfos.push_back(blkInfo);
             validBlockCnt++;
         }
     }
 
-    if (false == blkInfoList.empty())
-    {
-        validBlkInfos.push_back(blkInfoList);
-        blkInfoList.clear();
-    }
+    _CloseBlkInfoList();
     isLoaded = true;
     return true;
 }
@@ -32,8 +32,8 @@
 
 #pragma once
 
+#include <atomic>
 #include <vector>
-#include <list>
 
 #include "src/array_models/interface/i_array_info.h"
 #include "src/mapper/i_reversemap.h"
@@ -51,6 +51,37 @@ struct BlkInfo
     VirtualBlkAddr vsa;
 };
 
+// View over the valid blocks of one chunk, stored contiguously in VictimStripe
+struct BlkInfoSpan
+{
+    BlkInfo* first = nullptr;
+    uint32_t count = 0;
+
+    BlkInfo*
+    begin(void) const
+    {
+        return first;
+    };
+
+    BlkInfo*
+    end(void) const
+    {
+        return first + count;
+    };
+
+    uint32_t
+    size(void) const
+    {
+        return count;
+    };
+
+    BlkInfo&
+    operator[](uint32_t index) const
+    {
+        return first[index];
+    };
+};
+
 class ReverseMapPack;
 class IVSAMap;
 class IStripeMap;
@@ -69,16 +100,29 @@ public:
     virtual ~VictimStripe(void);
     virtual void Load(StripeId _lsid, CallbackSmartPtr callback);
 
-    virtual list<BlkInfo>&
+    virtual BlkInfoSpan
     GetBlkInfoList(uint32_t index)
     {
-        return validBlkInfos[index];
+        uint32_t start = (0 == index) ? 0 : blkInfoListEnds[index - 1];
+        return BlkInfoSpan{blkInfos.data() + start, blkInfoListEnds[index] - start};
     };
 
     virtual uint32_t
     GetBlkInfoListSize(void)
     {
-        return validBlkInfos.size();
+        return blkInfoListEnds.size();
+    };
+
+    virtual bool
+    IsReverseMapLoaded(void)
+    {
+        return revMapLoaded;
+    };
+
+    virtual void
+    SetReverseMapLoaded(void)
+    {
+        revMapLoaded = true;
     };
 
     virtual bool LoadValidBlock(void);
@@ -86,10 +130,14 @@ public:
 private:
     void _InitValue(StripeId _lsid);
     void _LoadReverseMap(CallbackSmartPtr callback);
+    void _CloseBlkInfoList(void);
 
     StripeId myLsid;
-    vector<list<BlkInfo>> validBlkInfos;
-    list<BlkInfo> blkInfoList;
+    // valid blocks of the whole stripe, grouped by chunk; blkInfoListEnds[i] is
+    // the end offset of chunk list i, so no allocation happens per block
+    vector<BlkInfo> blkInfos;
+    vector<uint32_t> blkInfoListEnds;
+    std::atomic<bool> revMapLoaded;
 
     uint32_t dataBlks;
     uint32_t chunkIndex;
@@ -197,7 +197,7 @@ SpdkRpcClient::SubsystemList(void)
 }
 
 pair<int, std::string>
-SpdkRpcClient::TransportCreate(std::string trtype, uint32_t bufCacheSize, uint32_t numSharedBuf, uint32_t ioUnitSize)
+SpdkRpcClient::TransportCreate(std::string trtype, uint32_t bufCacheSize, uint32_t numSharedBuf, uint32_t ioUnitSize, bool zcopy)
 {
     const int SUCCESS = 0;
     const string method = "nvmf_create_transport";
@@ -231,6 +231,11 @@ SpdkRpcClient::TransportCreate(std::string trtype, uint32_t bufCacheSize, uint32
     param["buf_cache_size"] = bufCacheSize;
     param["num_shared_buffers"] = numSharedBuf;
     param["io_unit_size"] = ioUnitSize;
+    if (zcopy)
+    {
+        // Lets the bdev hand out the buffers host data is received into
+        param["zcopy"] = true;
+    }
 
     try
     {
@@ -36,6 +36,7 @@
 #include <list>
 
 #include "src/array/ft/buffer_entry.h"
+#include "src/include/array_config.h"
 #include "src/include/smart_ptr_type.h"
 
 namespace pos
@@ -140,6 +141,36 @@ struct PhysicalEntry
     uint32_t blkCnt;
 };
 
+// Physical entries of a range within a stripe, kept in place so that the
+// translation on the read path does not allocate. A range gets at most one
+// entry per chunk of the stripe.
+struct PhysicalEntryArray
+{
+    static const uint32_t MAX_ENTRY_COUNT = ArrayConfig::MAX_CHUNK_CNT;
+
+    PhysicalEntry entries[MAX_ENTRY_COUNT];
+    uint32_t count = 0;
+
+    PhysicalEntry* begin(void) { return entries; }
+    PhysicalEntry* end(void) { return entries + count; }
+    PhysicalEntry& front(void) { return entries[0]; }
+
+    bool
+    Assign(const std::list<PhysicalEntry>& src)
+    {
+        count = 0;
+        if (src.size() > MAX_ENTRY_COUNT)
+        {
+            return false;
+        }
+        for (const PhysicalEntry& entry : src)
+        {
+            entries[count++] = entry;
+        }
+        return true;
+    }
+};
+
 struct PhysicalWriteEntry
 {
     PhysicalBlkAddr addr;
@@ -46,6 +46,8 @@ enum class RaidTypeEnum
     RAID5,
     RAID10,
     RAID6,
+    EC3,
+    EC4,
     TYPE_COUNT,
 };
 
@@ -83,6 +85,8 @@ private:
         "RAID5",
         "RAID10",
         "RAID6",
+        "EC3",
+        "EC4",
     };
 };
 
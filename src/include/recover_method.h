@@ -33,6 +33,7 @@
 #pragma once
 
 #include "src/include/address_type.h"
+#include "src/include/partition_type.h"
 #include "src/include/recover_func.h"
 
 #include <list>
@@ -45,6 +46,11 @@ struct RecoverMethod
 {
 public:
     list<PhysicalBlkAddr> srcAddr;
+    // Parity chunks recomputed from srcAddr, filled only for parity verification
+    list<PhysicalBlkAddr> dstAddr;
     RecoverFunc recoverFunc;
+    // Where the recovered block belongs
+    PartitionType partitionType = PartitionType::TYPE_COUNT;
+    StripeId stripeId = UNMAP_STRIPE;
 };
 } // namespace pos
@@ -48,6 +48,7 @@ FlushReadCompletion::FlushReadCompletion(StripeSmartPtr stripe, int arrayId, Eve
   eventScheduler(eventSchedulerArg)
 {
     SetEventType(BackendEvent_Flush);
+    SetArrayId(arrayId);
 }
 
 FlushReadCompletion::~FlushReadCompletion(void)
@@ -46,10 +46,15 @@
 #include "src/include/i_array_device.h"
 #include "src/include/meta_const.h"
 #include "src/include/pos_event_id.hpp"
+#include "src/event_scheduler/event_scheduler.h"
 #include "src/io/backend_io/flush_completion.h"
 #include "src/io/backend_io/flush_count.h"
 #include "src/io/backend_io/stripe_map_update_request.h"
+#include "src/io/frontend_io/partial_write_coalescer.h"
+#include "src/io/frontend_io/partial_write_coalescer_service.h"
+#include "src/io/general_io/write_amplification_monitor_service.h"
 #include "src/logger/logger.h"
+#include "src/mapper/reversemap/reverse_map_footer.h"
 
 namespace pos
 {
@@ -71,6 +76,12 @@ FlushSubmission::FlushSubmission(StripeSmartPtr inputStripe, IIOSubmitHandler* i
   isWTEnabled(isWTEnabled)
 {
     SetEventType(BackendEvent_Flush);
+    SetArrayId(arrayId);
+    if (stripe != nullptr && stripe->GetNumaId() != INVALID_NUMA)
+    {
+        // Flushed by the workers of the socket whose reactors filled the stripe
+        SetNumaId(stripe->GetNumaId());
+    }
 
     if (arrayInfo == nullptr)
     {
@@ -90,6 +101,28 @@ FlushSubmission::~FlushSubmission(void)
 bool
 FlushSubmission::_DoSpecificJob(void)
 {
+    PartialWriteCoalescer* partialWriteCoalescer =
+        PartialWriteCoalescerServiceSingleton::Instance()->GetPartialWriteCoalescer(arrayId);
+    if (nullptr != partialWriteCoalescer && nullptr != udSize
+        && false == partialWriteCoalescer->TryCompleteStripe(stripe, udSize->blksPerStripe))
+    {
+        // Blocks written in part need their old data before the stripe is flushed
+        return false;
+    }
+
+    if (stripe->IsDirectWritten())
+    {
+        // Data and parity are already on the ssds and the stripe map points there
+        FlushCountSingleton::Instance()->pendingFlush++;
+        airlog("Pending_Flush", "internal", arrayId, 1);
+        EventSmartPtr flushCompletion(new FlushCompletion(stripe, arrayId));
+        if (false == flushCompletion->Execute())
+        {
+            EventSchedulerSingleton::Instance()->EnqueueEvent(flushCompletion);
+        }
+        return true;
+    }
+
     StripeId logicalStripeId = stripe->GetUserLsid();
     uint64_t blocksInStripe = 0;
     bufferList.clear();
@@ -146,6 +179,17 @@ FlushSubmission::_DoSpecificJob(void)
         return false;
     }
 
+    bool footerEnabled = ReverseMapFooter::IsEnabled();
+    if (footerEnabled)
+    {
+        char* stripeBase = offset;
+        ReverseMapFooter::Store(stripe->GetRevMapPack(), udSize->blksPerStripe,
+            [stripeBase](uint32_t blockOffset)
+            {
+                return stripeBase + blockOffset * ArrayConfig::BLOCK_SIZE_BYTE;
+            });
+    }
+
     for (uint32_t chunkCnt = 0; chunkCnt < udSize->chunksPerStripe; chunkCnt++)
     {
         BufferEntry bufferEntry(offset, BLOCKS_IN_CHUNK);
@@ -166,12 +210,20 @@ FlushSubmission::_DoSpecificJob(void)
         "Flush Submission vsid : {} StartLSA.stripeId : {} blocksInStripe : {}",
         stripe->GetVsid(), startLSA.stripeId, blocksInStripe);
 
+    // Write-through stripes have their data on the ssds already, but not the
+    // footer, so they are written in full when the footer is enabled
+    bool parityOnly = isWTEnabled && (false == footerEnabled);
     IOSubmitHandlerStatus errorReturned = iIOSubmitHandler->SubmitAsyncIO(
         IODirection::WRITE,
         bufferList,
         startLSA, blocksInStripe,
         USER_DATA,
-        callback, arrayId, isWTEnabled);
+        callback, arrayId, parityOnly);
+    if (IOSubmitHandlerStatus::SUCCESS == errorReturned)
+    {
+        WriteAmplificationMonitorServiceSingleton::Instance()->Add(arrayId,
+            WriteSource::Flush, blocksInStripe * ArrayConfig::BLOCK_SIZE_BYTE);
+    }
 
     return (IOSubmitHandlerStatus::SUCCESS == errorReturned || IOSubmitHandlerStatus::FAIL_IN_SYSTEM_STOP == errorReturned);
 }
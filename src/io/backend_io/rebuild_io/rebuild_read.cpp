@@ -36,6 +36,8 @@
 
 #include "rebuild_read_complete_handler.h"
 #include "rebuild_read_intermediate_complete_handler.h"
+#include "src/allocator/i_context_manager.h"
+#include "src/allocator_service/allocator_service.h"
 #include "src/array/service/array_service_layer.h"
 #include "src/bio/ubio.h"
 #include "src/include/array_config.h"
@@ -65,6 +67,17 @@ RebuildRead::Recover(UbioSmartPtr ubio, BufferPool* bufferPool)
     {
         return ret;
     }
+    if (rm.partitionType == PartitionType::USER_DATA)
+    {
+        // Host keeps reading this stripe, so rebuild it ahead of the others
+        // rather than recovering it on every read
+        IContextManager* contextManager =
+            AllocatorServiceSingleton::Instance()->GetIContextManager(ubio->GetArrayId());
+        if (contextManager != nullptr)
+        {
+            contextManager->PrioritizeRebuildTarget(rm.stripeId);
+        }
+    }
 
     const uint32_t sectorSize = ArrayConfig::SECTOR_SIZE_BYTE;
     const uint32_t sectorsPerBlock = ArrayConfig::SECTORS_PER_BLOCK;
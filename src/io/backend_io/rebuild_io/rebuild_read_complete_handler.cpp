@@ -75,8 +75,20 @@ RebuildReadCompleteHandler::_DoSpecificJob(void)
     originalUbioAddress = originUbio->GetPba().lba;
     sectorOffset = GetSectorOffsetInBlock(originalUbioAddress);
 
-    memcpy(originUbio->GetBuffer(),
-        ptr + ChangeSectorToByte(sectorOffset), originUbio->GetSize());
+    if (originUbio->IsVectored())
+    {
+        uint8_t* source = ptr + ChangeSectorToByte(sectorOffset);
+        for (auto& ioVector : originUbio->GetIoVectors())
+        {
+            memcpy(ioVector.iov_base, source, ioVector.iov_len);
+            source += ioVector.iov_len;
+        }
+    }
+    else
+    {
+        memcpy(originUbio->GetBuffer(),
+            ptr + ChangeSectorToByte(sectorOffset), originUbio->GetSize());
+    }
 
     free(ptr);
 
@@ -69,6 +69,7 @@ StripeMapUpdateRequest::StripeMapUpdateRequest(StripeSmartPtr stripe, IStripeMap
 {
     arrayId = arrayIdInput;
     SetEventType(BackendEvent_Flush);
+    SetArrayId(arrayIdInput);
 }
 
 StripeMapUpdateRequest::~StripeMapUpdateRequest(void)
@@ -0,0 +1,384 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io/frontend_io/access_heatmap.h"
+
+#include <algorithm>
+#include <string>
+
+#include "src/include/memory.h"
+#include "src/include/pos_event_id.h"
+#include "src/io/frontend_io/access_heatmap_service.h"
+#include "src/logger/logger.h"
+#include "src/master_context/config_manager.h"
+#include "src/telemetry/telemetry_client/telemetry_client.h"
+#include "src/telemetry/telemetry_client/telemetry_publisher.h"
+#include "src/telemetry/telemetry_id.h"
+
+namespace pos
+{
+AccessHeatmap::AccessHeatmap(IArrayInfo* arrayInfo)
+: AccessHeatmap(arrayInfo, ConfigManagerSingleton::Instance(),
+      TelemetryClientSingleton::Instance(), nullptr)
+{
+}
+
+AccessHeatmap::AccessHeatmap(IArrayInfo* arrayInfo,
+    ConfigManager* configManager, TelemetryClient* telemetryClient,
+    TelemetryPublisher* publisher)
+: arrayInfo(arrayInfo),
+  configManager(configManager),
+  telemetryClient(telemetryClient),
+  publisher(publisher),
+  enabled(false),
+  sampleRate(1),
+  bucketSizeInMb(0),
+  bucketShift(0)
+{
+    for (uint32_t volumeId = 0; volumeId < MAX_VOLUME_COUNT; volumeId++)
+    {
+        volumes[volumeId].sketch = nullptr;
+        volumes[volumeId].sampledCount = 0;
+    }
+}
+
+AccessHeatmap::~AccessHeatmap(void)
+{
+    Dispose();
+    for (uint32_t volumeId = 0; volumeId < MAX_VOLUME_COUNT; volumeId++)
+    {
+        delete volumes[volumeId].sketch.load();
+        volumes[volumeId].sketch = nullptr;
+    }
+    if (nullptr != publisher)
+    {
+        delete publisher;
+        publisher = nullptr;
+    }
+}
+
+int
+AccessHeatmap::Init(void)
+{
+    bool heatmapEnabled = false;
+    int ret = configManager->GetValue("performance", "access_heatmap_enable",
+        &heatmapEnabled, CONFIG_TYPE_BOOL);
+    if (ret != EID(SUCCESS) || false == heatmapEnabled || true == enabled)
+    {
+        return EID(SUCCESS);
+    }
+
+    uint32_t rate = 0;
+    ret = configManager->GetValue("performance", "access_heatmap_sample_rate",
+        &rate, CONFIG_TYPE_UINT32);
+    sampleRate = (ret == EID(SUCCESS) && rate > 0) ? rate : 1;
+
+    // rounded down to a power of two so that the bucket is a shift of the rba
+    uint64_t sizeInMb = 0;
+    ret = configManager->GetValue("performance", "access_heatmap_bucket_size_in_mb",
+        &sizeInMb, CONFIG_TYPE_UINT64);
+    if (ret != EID(SUCCESS) || 0 == sizeInMb)
+    {
+        sizeInMb = 1024;
+    }
+    bucketShift = 0;
+    while ((2ULL << bucketShift) <= sizeInMb)
+    {
+        bucketShift++;
+    }
+    bucketSizeInMb = 1ULL << bucketShift;
+    bucketShift += 20 - SECTOR_SIZE_SHIFT;
+
+    if (nullptr == publisher)
+    {
+        publisher = new TelemetryPublisher("AccessHeatmap_" + arrayInfo->GetName());
+        publisher->AddDefaultLabel("array_name", arrayInfo->GetName());
+    }
+    if (nullptr != telemetryClient)
+    {
+        telemetryClient->RegisterPublisher(publisher);
+    }
+
+    enabled = true;
+    AccessHeatmapServiceSingleton::Instance()->Register(arrayInfo->GetIndex(), this);
+    POS_TRACE_INFO(EID(ACCESS_HEATMAP_ENABLED),
+        "Access heatmap is enabled, array_name:{}, bucket_size_in_mb:{}, sample_rate:{}",
+        arrayInfo->GetName(), bucketSizeInMb, sampleRate);
+    return EID(SUCCESS);
+}
+
+void
+AccessHeatmap::Dispose(void)
+{
+    if (false == enabled)
+    {
+        return;
+    }
+
+    enabled = false;
+    AccessHeatmapServiceSingleton::Instance()->Unregister(arrayInfo->GetIndex());
+    if (nullptr != telemetryClient)
+    {
+        telemetryClient->DeregisterPublisher(publisher->GetName());
+    }
+}
+
+void
+AccessHeatmap::Shutdown(void)
+{
+    Dispose();
+}
+
+void
+AccessHeatmap::Flush(void)
+{
+    // no-op for IMountSequence
+}
+
+bool
+AccessHeatmap::IsEnabled(void)
+{
+    return enabled;
+}
+
+uint64_t
+AccessHeatmap::GetBucketSizeInMb(void)
+{
+    return bucketSizeInMb;
+}
+
+uint64_t
+AccessHeatmap::GetBucket(uint64_t sectorRba)
+{
+    return sectorRba >> bucketShift;
+}
+
+void
+AccessHeatmap::Record(uint32_t volumeId, uint64_t sectorRba, bool isWrite)
+{
+    if (false == enabled || volumeId >= MAX_VOLUME_COUNT)
+    {
+        return;
+    }
+    static thread_local uint32_t count = 0;
+    if (++count < sampleRate)
+    {
+        return;
+    }
+    count = 0;
+
+    VolumeHeatmap& heatmap = volumes[volumeId];
+    Sketch* sketch = _GetSketch(volumeId);
+    uint64_t bucket = sectorRba >> bucketShift;
+    uint32_t direction = isWrite ? 1 : 0;
+    for (uint32_t row = 0; row < SKETCH_DEPTH; row++)
+    {
+        sketch->counters[direction][row][_Hash(bucket, row)].fetch_add(1, std::memory_order_relaxed);
+    }
+    _UpdateHotBuckets(heatmap, bucket,
+        _Estimate(sketch, 0, bucket) + _Estimate(sketch, 1, bucket));
+
+    uint64_t sampledCount = ++heatmap.sampledCount;
+    if (0 == (sampledCount % AGING_INTERVAL))
+    {
+        _Age(heatmap);
+    }
+    if (0 == (sampledCount % PUBLISH_INTERVAL))
+    {
+        _Publish(volumeId);
+    }
+}
+
+uint64_t
+AccessHeatmap::GetEstimate(uint32_t volumeId, uint64_t bucket, bool isWrite)
+{
+    if (volumeId >= MAX_VOLUME_COUNT)
+    {
+        return 0;
+    }
+    Sketch* sketch = volumes[volumeId].sketch.load();
+    if (nullptr == sketch)
+    {
+        return 0;
+    }
+    return static_cast<uint64_t>(_Estimate(sketch, isWrite ? 1 : 0, bucket)) * sampleRate;
+}
+
+std::vector<AccessHeatmapBucket>
+AccessHeatmap::GetHotBuckets(uint32_t volumeId)
+{
+    std::vector<AccessHeatmapBucket> result;
+    if (volumeId >= MAX_VOLUME_COUNT)
+    {
+        return result;
+    }
+
+    std::vector<HotBucket> hotBuckets;
+    {
+        std::lock_guard<std::mutex> lock(volumes[volumeId].hotBucketLock);
+        hotBuckets = volumes[volumeId].hotBuckets;
+    }
+    std::sort(hotBuckets.begin(), hotBuckets.end(),
+        [](const HotBucket& a, const HotBucket& b) { return a.count > b.count; });
+    for (auto& hotBucket : hotBuckets)
+    {
+        result.push_back({hotBucket.bucket,
+            GetEstimate(volumeId, hotBucket.bucket, false),
+            GetEstimate(volumeId, hotBucket.bucket, true)});
+    }
+    return result;
+}
+
+AccessHeatmap::Sketch*
+AccessHeatmap::_GetSketch(uint32_t volumeId)
+{
+    Sketch* sketch = volumes[volumeId].sketch.load();
+    if (nullptr != sketch)
+    {
+        return sketch;
+    }
+
+    // allocated on the first access, as most volume ids are never used
+    Sketch* created = new Sketch();
+    if (volumes[volumeId].sketch.compare_exchange_strong(sketch, created))
+    {
+        return created;
+    }
+    delete created;
+    return sketch;
+}
+
+uint32_t
+AccessHeatmap::_Estimate(Sketch* sketch, uint32_t direction, uint64_t bucket)
+{
+    uint32_t estimate = UINT32_MAX;
+    for (uint32_t row = 0; row < SKETCH_DEPTH; row++)
+    {
+        estimate = std::min(estimate,
+            sketch->counters[direction][row][_Hash(bucket, row)].load(std::memory_order_relaxed));
+    }
+    return estimate;
+}
+
+void
+AccessHeatmap::_UpdateHotBuckets(VolumeHeatmap& heatmap, uint64_t bucket, uint64_t count)
+{
+    // the sketch alone keeps counting while another reactor holds the list
+    std::unique_lock<std::mutex> lock(heatmap.hotBucketLock, std::try_to_lock);
+    if (false == lock.owns_lock())
+    {
+        return;
+    }
+
+    auto coldest = heatmap.hotBuckets.end();
+    for (auto it = heatmap.hotBuckets.begin(); it != heatmap.hotBuckets.end(); ++it)
+    {
+        if (it->bucket == bucket)
+        {
+            it->count = count;
+            return;
+        }
+        if (coldest == heatmap.hotBuckets.end() || it->count < coldest->count)
+        {
+            coldest = it;
+        }
+    }
+
+    if (heatmap.hotBuckets.size() < MAX_HOT_BUCKETS)
+    {
+        heatmap.hotBuckets.push_back({bucket, count});
+    }
+    else if (coldest->count < count)
+    {
+        *coldest = {bucket, count};
+    }
+}
+
+void
+AccessHeatmap::_Age(VolumeHeatmap& heatmap)
+{
+    Sketch* sketch = heatmap.sketch.load();
+    for (uint32_t direction = 0; direction < DIRECTION_COUNT; direction++)
+    {
+        for (uint32_t row = 0; row < SKETCH_DEPTH; row++)
+        {
+            for (uint32_t column = 0; column < SKETCH_WIDTH; column++)
+            {
+                // increments racing with this are lost, which a sketch tolerates
+                std::atomic<uint32_t>& counter = sketch->counters[direction][row][column];
+                counter.store(counter.load(std::memory_order_relaxed) / 2, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(heatmap.hotBucketLock);
+    for (auto& hotBucket : heatmap.hotBuckets)
+    {
+        hotBucket.count /= 2;
+    }
+}
+
+void
+AccessHeatmap::_Publish(uint32_t volumeId)
+{
+    for (auto& hotBucket : GetHotBuckets(volumeId))
+    {
+        std::string offset = std::to_string(hotBucket.bucket * bucketSizeInMb);
+
+        POSMetric readMetric(TEL50025_VOL_ACCESS_HEATMAP_READ, MT_GAUGE);
+        readMetric.SetGaugeValue(hotBucket.readCount);
+        readMetric.AddLabel("volume_id", std::to_string(volumeId));
+        readMetric.AddLabel("offset_in_mb", offset);
+        publisher->PublishMetric(readMetric);
+
+        POSMetric writeMetric(TEL50026_VOL_ACCESS_HEATMAP_WRITE, MT_GAUGE);
+        writeMetric.SetGaugeValue(hotBucket.writeCount);
+        writeMetric.AddLabel("volume_id", std::to_string(volumeId));
+        writeMetric.AddLabel("offset_in_mb", offset);
+        publisher->PublishMetric(writeMetric);
+    }
+}
+
+uint32_t
+AccessHeatmap::_Hash(uint64_t bucket, uint32_t row)
+{
+    // a different odd multiplier per row; the high bits pick the column
+    static const uint64_t MULTIPLIERS[SKETCH_DEPTH] = {
+        0x9E3779B97F4A7C15ULL, 0xC2B2AE3D27D4EB4FULL,
+        0x165667B19E3779F9ULL, 0xD6E8FEB86659FD93ULL};
+    uint64_t hash = (bucket + 1) * MULTIPLIERS[row];
+    hash ^= hash >> 29;
+    hash *= MULTIPLIERS[(row + 1) % SKETCH_DEPTH];
+    return static_cast<uint32_t>(hash >> (64 - SKETCH_WIDTH_BITS));
+}
+
+} // namespace pos
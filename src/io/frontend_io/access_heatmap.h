@@ -0,0 +1,128 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "src/array_models/interface/i_array_info.h"
+#include "src/array_models/interface/i_mount_sequence.h"
+#include "src/volume/volume_base.h"
+
+namespace pos
+{
+class ConfigManager;
+class TelemetryClient;
+class TelemetryPublisher;
+
+struct AccessHeatmapBucket
+{
+    uint64_t bucket;
+    uint64_t readCount;
+    uint64_t writeCount;
+};
+
+// Counts how often each RBA range (bucket) of a volume is read and written.
+// One of every sampleRate host I/Os is added to a count-min sketch per volume
+// and direction, and the buckets with the highest counts are kept as hot
+// buckets to publish. The counts are halved every AGING_INTERVAL sampled
+// accesses of a volume so that the heatmap follows the recent workload.
+class AccessHeatmap : public IMountSequence
+{
+public:
+    explicit AccessHeatmap(IArrayInfo* arrayInfo);
+    AccessHeatmap(IArrayInfo* arrayInfo, ConfigManager* configManager,
+        TelemetryClient* telemetryClient, TelemetryPublisher* publisher);
+    virtual ~AccessHeatmap(void);
+
+    int Init(void) override;
+    void Dispose(void) override;
+    void Shutdown(void) override;
+    void Flush(void) override;
+
+    virtual bool IsEnabled(void);
+    virtual void Record(uint32_t volumeId, uint64_t sectorRba, bool isWrite);
+    virtual uint64_t GetBucket(uint64_t sectorRba);
+    // Estimated count of host I/Os, scaled back by the sample rate
+    virtual uint64_t GetEstimate(uint32_t volumeId, uint64_t bucket, bool isWrite);
+    virtual std::vector<AccessHeatmapBucket> GetHotBuckets(uint32_t volumeId);
+    virtual uint64_t GetBucketSizeInMb(void);
+
+    static const uint32_t SKETCH_DEPTH = 4;
+    static const uint32_t SKETCH_WIDTH_BITS = 10;
+    static const uint32_t MAX_HOT_BUCKETS = 16;
+    static const uint32_t PUBLISH_INTERVAL = 4096;
+    static const uint32_t AGING_INTERVAL = 65536;
+
+private:
+    static const uint32_t SKETCH_WIDTH = 1U << SKETCH_WIDTH_BITS;
+    static const uint32_t DIRECTION_COUNT = 2;
+
+    struct Sketch
+    {
+        std::atomic<uint32_t> counters[DIRECTION_COUNT][SKETCH_DEPTH][SKETCH_WIDTH];
+    };
+    struct HotBucket
+    {
+        uint64_t bucket;
+        uint64_t count;
+    };
+    struct VolumeHeatmap
+    {
+        std::atomic<Sketch*> sketch;
+        std::atomic<uint64_t> sampledCount;
+        std::mutex hotBucketLock;
+        std::vector<HotBucket> hotBuckets;
+    };
+
+    Sketch* _GetSketch(uint32_t volumeId);
+    uint32_t _Estimate(Sketch* sketch, uint32_t direction, uint64_t bucket);
+    void _UpdateHotBuckets(VolumeHeatmap& heatmap, uint64_t bucket, uint64_t count);
+    void _Age(VolumeHeatmap& heatmap);
+    void _Publish(uint32_t volumeId);
+    static uint32_t _Hash(uint64_t bucket, uint32_t row);
+
+    IArrayInfo* arrayInfo;
+    ConfigManager* configManager;
+    TelemetryClient* telemetryClient;
+    TelemetryPublisher* publisher;
+    std::atomic<bool> enabled;
+    uint32_t sampleRate;
+    uint64_t bucketSizeInMb;
+    uint32_t bucketShift;
+    VolumeHeatmap volumes[MAX_VOLUME_COUNT];
+};
+
+} // namespace pos
@@ -0,0 +1,178 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io/frontend_io/admission_controller.h"
+
+#include "src/include/branch_prediction.h"
+#include "src/include/pos_event_id.h"
+#include "src/logger/logger.h"
+#include "src/master_context/config_manager.h"
+
+namespace pos
+{
+AdmissionController::AdmissionController(void)
+: AdmissionController(ConfigManagerSingleton::Instance())
+{
+}
+
+AdmissionController::AdmissionController(ConfigManager* configManager)
+: enabled(false),
+  maxOutstandingPerReactor(0),
+  maxOutstandingPerVolume(0),
+  rejectedCount(0)
+{
+    for (int arrayId = 0; arrayId < ArrayMgmtPolicy::MAX_ARRAY_CNT; arrayId++)
+    {
+        for (uint32_t volumeId = 0; volumeId < MAX_VOLUME_COUNT; volumeId++)
+        {
+            outstandingCount[arrayId][volumeId] = 0;
+        }
+    }
+
+    bool enable = false;
+    int ret = configManager->GetValue("performance", "admission_control_enable",
+        &enable, CONFIG_TYPE_BOOL);
+    if (ret != EID(SUCCESS) || false == enable)
+    {
+        return;
+    }
+
+    uint32_t value = 0;
+    ret = configManager->GetValue("performance", "admission_max_outstanding_io_per_reactor",
+        &value, CONFIG_TYPE_UINT32);
+    if (ret == EID(SUCCESS))
+    {
+        maxOutstandingPerReactor = value;
+    }
+    value = 0;
+    ret = configManager->GetValue("performance", "admission_max_outstanding_io_per_volume",
+        &value, CONFIG_TYPE_UINT32);
+    if (ret == EID(SUCCESS))
+    {
+        maxOutstandingPerVolume = value;
+    }
+
+    // 0 leaves a limit unbounded
+    enabled = (0 != maxOutstandingPerReactor || 0 != maxOutstandingPerVolume);
+    if (enabled)
+    {
+        POS_TRACE_INFO(EID(ADMISSION_CONTROL_ENABLED),
+            "max_outstanding_io_per_reactor: {}, max_outstanding_io_per_volume: {}",
+            maxOutstandingPerReactor, maxOutstandingPerVolume);
+    }
+}
+
+AdmissionController::~AdmissionController(void)
+{
+}
+
+bool
+AdmissionController::IsEnabled(void)
+{
+    return enabled;
+}
+
+bool
+AdmissionController::Admit(int arrayId, uint32_t volumeId, uint32_t reactorOutstandingCount)
+{
+    if (false == enabled || unlikely(false == _IsValid(arrayId, volumeId)))
+    {
+        return true;
+    }
+
+    bool admitted = (0 == maxOutstandingPerReactor
+        || reactorOutstandingCount < maxOutstandingPerReactor);
+    if (likely(admitted))
+    {
+        uint32_t prevCount = outstandingCount[arrayId][volumeId].fetch_add(1);
+        if (0 != maxOutstandingPerVolume && prevCount >= maxOutstandingPerVolume)
+        {
+            outstandingCount[arrayId][volumeId]--;
+            admitted = false;
+        }
+    }
+
+    if (unlikely(false == admitted))
+    {
+        uint64_t prevRejected = rejectedCount.fetch_add(1);
+        if (0 == prevRejected % REJECT_LOG_INTERVAL)
+        {
+            POS_TRACE_WARN(EID(ADMISSION_IO_REJECTED),
+                "array_id: {}, volume_id: {}, reactor_outstanding: {}, volume_outstanding: {}, rejected: {}",
+                arrayId, volumeId, reactorOutstandingCount,
+                outstandingCount[arrayId][volumeId].load(), prevRejected + 1);
+        }
+    }
+    return admitted;
+}
+
+void
+AdmissionController::Release(int arrayId, uint32_t volumeId)
+{
+    if (false == enabled || unlikely(false == _IsValid(arrayId, volumeId)))
+    {
+        return;
+    }
+
+    // I/Os that did not come through Admit (e.g. replicated ones) complete
+    // on the same path, so the count must not wrap below zero
+    std::atomic<uint32_t>& count = outstandingCount[arrayId][volumeId];
+    uint32_t current = count.load();
+    while (0 < current && false == count.compare_exchange_weak(current, current - 1))
+    {
+    }
+}
+
+uint32_t
+AdmissionController::GetOutstandingCount(int arrayId, uint32_t volumeId)
+{
+    if (false == _IsValid(arrayId, volumeId))
+    {
+        return 0;
+    }
+    return outstandingCount[arrayId][volumeId];
+}
+
+uint64_t
+AdmissionController::GetRejectedCount(void)
+{
+    return rejectedCount;
+}
+
+bool
+AdmissionController::_IsValid(int arrayId, uint32_t volumeId)
+{
+    return (0 <= arrayId && arrayId < ArrayMgmtPolicy::MAX_ARRAY_CNT
+        && volumeId < MAX_VOLUME_COUNT);
+}
+
+} // namespace pos
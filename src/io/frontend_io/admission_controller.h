@@ -0,0 +1,77 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "src/include/array_mgmt_policy.h"
+#include "src/lib/singleton.h"
+#include "src/volume/volume_base.h"
+
+namespace pos
+{
+class ConfigManager;
+
+// Bounds the host I/Os in flight on each reactor and on each volume. An I/O
+// over either limit is not submitted but completed at once with a retry
+// status, so the host backs off or fails over instead of timing out while
+// I/Os pile up behind a full write buffer.
+class AdmissionController
+{
+public:
+    AdmissionController(void);
+    explicit AdmissionController(ConfigManager* configManager);
+    virtual ~AdmissionController(void);
+
+    virtual bool IsEnabled(void);
+    virtual bool Admit(int arrayId, uint32_t volumeId, uint32_t reactorOutstandingCount);
+    virtual void Release(int arrayId, uint32_t volumeId);
+    uint32_t GetOutstandingCount(int arrayId, uint32_t volumeId);
+    uint64_t GetRejectedCount(void);
+
+    static const uint64_t REJECT_LOG_INTERVAL = 1024;
+
+private:
+    bool _IsValid(int arrayId, uint32_t volumeId);
+
+    bool enabled;
+    uint32_t maxOutstandingPerReactor;
+    uint32_t maxOutstandingPerVolume;
+    std::atomic<uint32_t> outstandingCount[ArrayMgmtPolicy::MAX_ARRAY_CNT][MAX_VOLUME_COUNT];
+    std::atomic<uint64_t> rejectedCount;
+};
+
+using AdmissionControllerSingleton = Singleton<AdmissionController>;
+
+} // namespace pos
@@ -36,6 +36,7 @@
 #include <string.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
@@ -53,14 +54,20 @@
 #include "src/event_scheduler/spdk_event_scheduler.h"
 #include "src/include/branch_prediction.h"
 #include "src/include/memory.h"
+#include "src/io/frontend_io/admission_controller.h"
 #include "src/io/frontend_io/flush_command_handler.h"
+#include "src/io/frontend_io/flush_command_manager.h"
+#include "src/io/frontend_io/range_unmap_handler.h"
 #include "src/io/frontend_io/read_submission.h"
 #include "src/io/frontend_io/write_submission.h"
 #include "src/io_scheduler/io_dispatcher.h"
 #include "src/logger/logger.h"
 #include "src/pos_replicator/posreplicator_manager.h"
+#include "src/qos/qos_manager.h"
 #include "src/spdk_wrapper/event_framework_api.h"
 #include "src/spdk_wrapper/spdk.h"
+#include "src/trace/flight_recorder.h"
+#include "src/trace/io_stage_tracer.h"
 #include "src/volume/volume_manager.h"
 #include "src/volume/volume_service.h"
 
@@ -87,13 +94,18 @@ AioCompletion::AioCompletion(FlushIoSmartPtr flushIo, pos_io& posIo, IOCtx& ioCo
 }
 
 AioCompletion::AioCompletion(FlushIoSmartPtr flushIo, pos_io& posIo,
-    IOCtx& ioContext, EventFrameworkApi* eventFrameworkApi)
+    IOCtx& ioContext, EventFrameworkApi* eventFrameworkApi,
+    CompletionBatcher* completionBatcher)
 : Callback(true, CallbackType_AioCompletion),
   flushIo(flushIo),
   volumeIo(nullptr),
   posIo(posIo),
   ioContext(ioContext),
-  eventFrameworkApi(eventFrameworkApi)
+  eventFrameworkApi(eventFrameworkApi),
+  completionBatcher(completionBatcher),
+  submitTime(std::chrono::steady_clock::now()),
+  writeSequenceTracked(false),
+  writeSequenceSlot(0)
 {
 }
 
@@ -102,15 +114,33 @@ AioCompletion::AioCompletion(VolumeIoSmartPtr volumeIo, pos_io& posIo, IOCtx& io
 {
 }
 
+AioCompletion::AioCompletion(VolumeIoSmartPtr volumeIo, pos_io& posIo, IOCtx& ioContext,
+    CallbackType type)
+: AioCompletion(volumeIo, posIo, ioContext, EventFrameworkApiSingleton::Instance(),
+    CompletionBatcherSingleton::Instance(), type)
+{
+}
+
 AioCompletion::AioCompletion(VolumeIoSmartPtr volumeIo, pos_io& posIo,
-    IOCtx& ioContext, EventFrameworkApi* eventFrameworkApi)
-: Callback(true, CallbackType_AioCompletion),
+    IOCtx& ioContext, EventFrameworkApi* eventFrameworkApi,
+    CompletionBatcher* completionBatcher, CallbackType type)
+: Callback(true, type),
   flushIo(nullptr),
   volumeIo(volumeIo),
   posIo(posIo),
   ioContext(ioContext),
-  eventFrameworkApi(eventFrameworkApi)
+  eventFrameworkApi(eventFrameworkApi),
+  completionBatcher(completionBatcher),
+  submitTime(std::chrono::steady_clock::now()),
+  writeSequenceTracked(false),
+  writeSequenceSlot(0)
 {
+    FlushCmdManager* flushCmdManager = FlushCmdManagerSingleton::Instance();
+    if (posIo.ioType == IO_TYPE::WRITE && flushCmdManager->IsNvramDurableFlushEnabled())
+    {
+        writeSequenceSlot = flushCmdManager->StartWrite(volumeIo->GetVolumeId());
+        writeSequenceTracked = true;
+    }
 }
 
 AioCompletion::~AioCompletion(void)
@@ -144,7 +174,8 @@ AioCompletion::_DoSpecificJob(void)
     }
     else
     {
-        bool success = SpdkEventScheduler::SendSpdkEvent(originCore,
+        // Completions heading to the same reactor share a single message
+        bool success = completionBatcher->Enqueue(originCore,
             shared_from_this());
         return success;
     }
@@ -156,6 +187,11 @@ AioCompletion::_SendUserCompletion(void)
     int dir = posIo.ioType;
     ioContext.cnt--;
     uint32_t volumeId = posIo.volume_id;
+    if (writeSequenceTracked)
+    {
+        // Reaching here means the write is logged, so flushes may pass it
+        FlushCmdManagerSingleton::Instance()->AckWrite(volumeIo->GetVolumeId(), writeSequenceSlot);
+    }
     if (posIo.complete_cb)
     {
         int status = POS_IO_STATUS_SUCCESS;
@@ -176,10 +212,27 @@ AioCompletion::_SendUserCompletion(void)
     }
     else
     {
+        uint64_t latencyUs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - submitTime).count();
+        FlightRecorderSingleton::Instance()->Record(FlightEventType::IoComplete, volumeIo->GetArrayId(),
+            volumeIo->GetVolumeId(), volumeIo->GetSectorRba(), latencyUs,
+            static_cast<uint8_t>(volumeIo->dir));
+        if (unlikely(volumeIo->GetStageTrace() != nullptr))
+        {
+            IoStageTracerSingleton::Instance()->Finish(volumeIo->GetStageTrace());
+        }
+        QosManagerSingleton::Instance()->RecordHostLatency(latencyUs);
+        if (dir == IO_TYPE::READ)
+        {
+            QosManagerSingleton::Instance()->RecordVolumeReadLatency(volumeIo->GetArrayId(),
+                volumeIo->GetVolumeId(), latencyUs);
+        }
+
         IVolumeIoManager* volumeManager = volumeService.GetVolumeManager(volumeIo->GetArrayId());
         if (likely(_GetMostCriticalError() != IOErrorType::VOLUME_UMOUNTED))
         {
             volumeManager->DecreasePendingIOCount(volumeIo->GetVolumeId(), static_cast<VolumeIoType>(dir));
+            AdmissionControllerSingleton::Instance()->Release(volumeIo->GetArrayId(), volumeIo->GetVolumeId());
             airlog("UserWritePendingCnt", "user", volumeIo->GetVolumeId(), -1);
             airlog("UserReadPendingCnt", "user", volumeIo->GetVolumeId(), -1);
         }
@@ -200,7 +253,24 @@ AIO::_CreateVolumeIo(pos_io& posIo)
     }
 
     int arrayId(posIo.array_id);
-    VolumeIoSmartPtr volumeIo(new VolumeIo(buffer, sectorSize, arrayId));
+    VolumeIoSmartPtr volumeIo;
+    if (posIo.iov != nullptr && 1 < posIo.iovcnt)
+    {
+        // The host buffers are used as they are, without a bounce copy
+        std::vector<struct iovec> ioVectors;
+        uint64_t remainingSize = posIo.length;
+        for (int index = 0; index < posIo.iovcnt && 0 < remainingSize; index++)
+        {
+            uint64_t length = std::min<uint64_t>(posIo.iov[index].iov_len, remainingSize);
+            ioVectors.push_back({.iov_base = posIo.iov[index].iov_base, .iov_len = length});
+            remainingSize -= length;
+        }
+        volumeIo = VolumeIoSmartPtr(new VolumeIo(ioVectors, arrayId));
+    }
+    else
+    {
+        volumeIo = VolumeIoSmartPtr(new VolumeIo(buffer, sectorSize, arrayId));
+    }
 
     switch (posIo.ioType)
     {
@@ -240,12 +310,28 @@ AIO::_IncreaseIoContextCnt(bool needPollingNecessary)
     }
 }
 
+uint32_t
+AIO::GetOutstandingIoCount(void)
+{
+    return (ioContext.cnt > 0) ? static_cast<uint32_t>(ioContext.cnt) : 0;
+}
+
 VolumeIoSmartPtr
 AIO::CreateVolumeIo(pos_io& posIo)
 {
     VolumeIoSmartPtr volumeIo = _CreateVolumeIo(posIo);
-    CallbackSmartPtr aioCompletion(new AioCompletion(volumeIo, posIo,
-        ioContext));
+    CallbackSmartPtr aioCompletion;
+    if (volumeIo->dir == UbioDir::Read)
+    {
+        aioCompletion = std::make_shared<AioReadCompletion>(
+            std::make_tuple(ReadCompletionStage()), volumeIo, posIo, ioContext,
+            CallbackType_AioReadCompletion);
+    }
+    else
+    {
+        aioCompletion = CallbackSmartPtr(new AioCompletion(volumeIo, posIo,
+            ioContext));
+    }
     volumeIo->SetCallback(aioCompletion);
 
     _IncreaseIoContextCnt(volumeIo->IsPollingNecessary());
@@ -303,16 +389,57 @@ AIO::SubmitFlush(pos_io& posIo)
     return;
 }
 
+void
+AIO::SubmitUnmap(pos_io& posIo)
+{
+    // Only the blocks wholly inside the range are deallocated, as the
+    // partial ones at its edges still hold data the host did not discard
+    BlkAddr startRba = DivideUp(posIo.offset, BLOCK_SIZE);
+    BlkAddr endRba = (posIo.offset + posIo.length) / BLOCK_SIZE;
+    if (endRba <= startRba)
+    {
+        posIo.complete_cb(&posIo, POS_IO_STATUS_SUCCESS);
+        return;
+    }
+    if (unlikely(endRba - startRba > UINT32_MAX))
+    {
+        POS_TRACE_ERROR(EID(SCHEDAPI_SUBMISSION_FAIL),
+            "Range to unmap is too large, volume_id:{}, offset:{}, length:{}",
+            posIo.volume_id, posIo.offset, posIo.length);
+        posIo.complete_cb(&posIo, POS_IO_STATUS_FAIL);
+        return;
+    }
+
+    IVolumeIoManager* volumeManager = VolumeServiceSingleton::Instance()->GetVolumeManager(posIo.array_id);
+    if (unlikely(EID(SUCCESS) != volumeManager->IncreasePendingIOCountIfNotZero(posIo.volume_id, VolumeIoType::UserWrite)))
+    {
+        posIo.complete_cb(&posIo, POS_IO_STATUS_FAIL);
+        return;
+    }
+    ioContext.cnt++;
+
+    uint32_t originCore = EventFrameworkApiSingleton::Instance()->GetCurrentReactor();
+    CallbackSmartPtr unmapCompletion(new UnmapCompletion(&posIo, ioContext, originCore));
+    EventSmartPtr event(new RangeUnmapHandler(posIo.array_id, posIo.volume_id, startRba,
+        static_cast<uint32_t>(endRba - startRba), unmapCompletion));
+    EventSchedulerSingleton::Instance()->EnqueueEvent(event);
+}
+
 void
 AIO::SubmitAsyncIO(VolumeIoSmartPtr volumeIo)
 {
     uint32_t core = volumeIo->GetOriginCore();
     uint32_t arr_vol_id = volumeIo->GetVolumeId() + (volumeIo->GetArrayId() << 8);
+    FlightRecorderSingleton::Instance()->Record(FlightEventType::IoSubmit, volumeIo->GetArrayId(),
+        volumeIo->GetVolumeId(), volumeIo->GetSectorRba(), volumeIo->GetSize(),
+        static_cast<uint8_t>(volumeIo->dir));
     switch (volumeIo->dir)
     {
         case UbioDir::Write:
         {
             airlog("PERF_ARR_VOL", "write", arr_vol_id, volumeIo->GetSize());
+            volumeIo->SetStageTrace(IoStageTracerSingleton::Instance()->Sample(volumeIo->GetArrayId(),
+                volumeIo->GetVolumeId(), volumeIo->GetSectorRba(), volumeIo->GetSize()));
             SpdkEventScheduler::ExecuteOrScheduleEvent(core,
                 std::make_shared<WriteSubmission>(volumeIo));
         }
@@ -336,13 +463,13 @@ AIO::SubmitAsyncIO(VolumeIoSmartPtr volumeIo)
     }
 }
 
-void
+int
 AIO::CompleteIOs(void)
 {
     uint32_t reactor_id = EventFrameworkApiSingleton::Instance()->GetCurrentReactor();
     int cnt = ioContext.cnt;
     airlog("CNT_AIO_CompleteIOs", "base", reactor_id, cnt);
-    IODispatcher::CompleteForThreadLocalDeviceList();
+    return IODispatcher::CompleteForThreadLocalDeviceList();
 }
 
 void
@@ -405,4 +532,38 @@ AdminCompletion::_DoSpecificJob(void)
     return true;
 }
 
+UnmapCompletion::UnmapCompletion(pos_io* posIo, IOCtx& ioContext, uint32_t originCore)
+: Callback(false, CallbackType_AioCompletion),
+  io(posIo),
+  ioContext(ioContext),
+  originCore(originCore)
+{
+}
+
+UnmapCompletion::~UnmapCompletion(void)
+{
+}
+
+bool
+UnmapCompletion::_DoSpecificJob(void)
+{
+    if (false == EventFrameworkApiSingleton::Instance()->IsSameReactorNow(originCore))
+    {
+        return SpdkEventScheduler::SendSpdkEvent(originCore, shared_from_this());
+    }
+
+    ioContext.cnt--;
+    IVolumeIoManager* volumeManager = VolumeServiceSingleton::Instance()->GetVolumeManager(io->array_id);
+    volumeManager->DecreasePendingIOCount(io->volume_id, VolumeIoType::UserWrite);
+
+    int status = POS_IO_STATUS_SUCCESS;
+    if (unlikely(_GetErrorCount() > 0))
+    {
+        status = POS_IO_STATUS_FAIL;
+    }
+    io->complete_cb(io, status);
+
+    return true;
+}
+
 } // namespace pos
@@ -32,6 +32,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <functional>
 
@@ -42,6 +43,9 @@
 #include "src/bio/flush_io.h"
 #include "src/bio/volume_io.h"
 #include "src/event_scheduler/callback.h"
+#include "src/event_scheduler/composed_callback.h"
+#include "src/io/frontend_io/completion_batcher.h"
+#include "src/io/frontend_io/read_completion.h"
 #include "src/spdk_wrapper/event_framework_api.h"
 #include "src/volume/volume_service.h"
 namespace pos
@@ -63,14 +67,20 @@ class AioCompletion : public Callback,
 {
 public:
     AioCompletion(FlushIoSmartPtr flushIo, pos_io& posIo, IOCtx& ioContext);
-    AioCompletion(FlushIoSmartPtr flushIo, pos_io& posIo, IOCtx& ioContext, EventFrameworkApi* eventFrameworkApi);
+    AioCompletion(FlushIoSmartPtr flushIo, pos_io& posIo, IOCtx& ioContext, EventFrameworkApi* eventFrameworkApi,
+        CompletionBatcher* completionBatcher = CompletionBatcherSingleton::Instance());
     AioCompletion(VolumeIoSmartPtr volumeIo, pos_io& posIo, IOCtx& ioContext);
-    AioCompletion(VolumeIoSmartPtr volumeIo, pos_io& posIo, IOCtx& ioContext, EventFrameworkApi* eventFrameworkApi);
+    AioCompletion(VolumeIoSmartPtr volumeIo, pos_io& posIo, IOCtx& ioContext, CallbackType type);
+    AioCompletion(VolumeIoSmartPtr volumeIo, pos_io& posIo, IOCtx& ioContext, EventFrameworkApi* eventFrameworkApi,
+        CompletionBatcher* completionBatcher = CompletionBatcherSingleton::Instance(),
+        CallbackType type = CallbackType_AioCompletion);
     ~AioCompletion(void) override;
 
+protected:
+    bool _DoSpecificJob(void) override;
+
 private:
     void _SendUserCompletion(void);
-    bool _DoSpecificJob(void) override;
 
     FlushIoSmartPtr flushIo;
     VolumeIoSmartPtr volumeIo;
@@ -78,18 +88,28 @@ private:
     IOCtx& ioContext;
     static VolumeService& volumeService;
     EventFrameworkApi* eventFrameworkApi;
+    CompletionBatcher* completionBatcher;
+    std::chrono::steady_clock::time_point submitTime;
+    bool writeSequenceTracked;
+    uint32_t writeSequenceSlot;
 };
 
+// User read completion with the release of the write buffer reference
+// fused in, so that a read hit completes through a single callback
+using AioReadCompletion = ComposedCallback<AioCompletion, ReadCompletionStage>;
+
 class AIO
 {
 public:
     AIO(void);
     virtual void SubmitAsyncIO(VolumeIoSmartPtr volIo);
     void SubmitFlush(pos_io& posIo);
-    void CompleteIOs(void);
+    void SubmitUnmap(pos_io& posIo);
+    int CompleteIOs(void);
     VolumeIoSmartPtr CreateVolumeIo(pos_io& posIo);
     virtual VolumeIoSmartPtr CreatePosReplicatorVolumeIo(pos_io& posIo, uint64_t lsn);
     void SubmitAsyncAdmin(pos_io& posIo, IArrayInfo* arrayInfo = nullptr);
+    static uint32_t GetOutstandingIoCount(void);
 
 private:
     static thread_local IOCtx ioContext;
@@ -105,6 +125,20 @@ public:
     AdminCompletion(pos_io* posIo, IOCtx& ioContext, uint32_t originCore);
     ~AdminCompletion(void) override;
 
+private:
+    bool _DoSpecificJob(void) override;
+    pos_io* io;
+    IOCtx& ioContext;
+    uint32_t originCore;
+};
+
+class UnmapCompletion : public Callback,
+                        public std::enable_shared_from_this<UnmapCompletion>
+{
+public:
+    UnmapCompletion(pos_io* posIo, IOCtx& ioContext, uint32_t originCore);
+    ~UnmapCompletion(void) override;
+
 private:
     bool _DoSpecificJob(void) override;
     pos_io* io;
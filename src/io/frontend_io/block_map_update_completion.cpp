@@ -81,6 +81,14 @@ BlockMapUpdateCompletion::_DoSpecificJob(void)
         callee = originCallback;
     }
 
+    if (likely(nullptr == writeCompletionEvent))
+    {
+        // The write completion has already run as an inline stage
+        SetCallee(callee);
+        volumeIo = nullptr;
+        return true;
+    }
+
     writeCompletionEvent->SetCallee(callee);
     bool wrapupSuccessful = writeCompletionEvent->Execute();
 
@@ -36,6 +36,8 @@
 
 #include "src/bio/volume_io.h"
 #include "src/event_scheduler/callback.h"
+#include "src/event_scheduler/composed_callback.h"
+#include "src/io/frontend_io/write_completion.h"
 
 namespace pos
 {
@@ -55,13 +57,18 @@ public:
         CallbackSmartPtr writeCompletionEvent);
     virtual ~BlockMapUpdateCompletion(void);
 
-private:
+protected:
     virtual bool _DoSpecificJob(void) override;
 
+private:
     VolumeIoSmartPtr volumeIo;
     CallbackSmartPtr originCallback;
     EventScheduler* eventScheduler;
     CallbackSmartPtr writeCompletionEvent;
 };
 
+// Map update completion with the write completion fused in; it has no
+// writeCompletionEvent and completes the user write as its own callee
+using BlockMapUpdateWriteCompletion = ComposedCallback<BlockMapUpdateCompletion, WriteCompletionStage>;
+
 } // namespace pos
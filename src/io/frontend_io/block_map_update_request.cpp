@@ -42,13 +42,18 @@
 #include "src/spdk_wrapper/event_framework_api.h"
 #include "src/meta_service/meta_service.h"
 #include "src/io/frontend_io/block_map_update_completion.h"
+#include "src/io/frontend_io/partial_write_coalescer.h"
+#include "src/io/frontend_io/partial_write_coalescer_service.h"
 
 #include <memory>
 
 namespace pos
 {
 BlockMapUpdateRequest::BlockMapUpdateRequest(VolumeIoSmartPtr volumeIo, CallbackSmartPtr originCallback)
-: BlockMapUpdateRequest(volumeIo, originCallback, std::make_shared<BlockMapUpdateCompletion>(volumeIo, originCallback),
+: BlockMapUpdateRequest(volumeIo, originCallback,
+    std::make_shared<BlockMapUpdateWriteCompletion>(std::make_tuple(WriteCompletionStage(volumeIo)),
+        volumeIo, originCallback, EventFrameworkApiSingleton::Instance()->IsReactorNow(),
+        EventSchedulerSingleton::Instance(), nullptr),
     MetaServiceSingleton::Instance()->GetMetaUpdater(volumeIo->GetArrayId()),
     EventSchedulerSingleton::Instance(), EventFrameworkApiSingleton::Instance()->IsReactorNow())
 {
@@ -83,10 +88,22 @@ BlockMapUpdateRequest::_DoSpecificJob(void)
                 "Write is failed at WriteCompleting state");
             throw eventId;
         }
+        if (false == uramWriteMarked)
+        {
+            uramWriteMarked = true;
+            volumeIo->MarkStage(IoStage::UramWritten);
+        }
         result = _UpdateMeta();
     }
     catch (...)
     {
+        PartialWriteCoalescer* partialWriteCoalescer =
+            PartialWriteCoalescerServiceSingleton::Instance()->GetPartialWriteCoalescer(volumeIo->GetArrayId());
+        if (nullptr != partialWriteCoalescer)
+        {
+            partialWriteCoalescer->CompleteWrite(volumeIo->GetVolumeId(),
+                ChangeSectorToBlock(volumeIo->GetSectorRba()), volumeIo->GetVsa(), false);
+        }
         CallbackSmartPtr callee;
         if (originCallback == nullptr)
         {
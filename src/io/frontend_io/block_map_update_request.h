@@ -66,6 +66,8 @@ private:
     IMetaUpdater* metaUpdater;
     EventScheduler* eventScheduler;
     ChangeLogger<int> changeLogger;
+    // a retried meta update is not the time of the URAM write
+    bool uramWriteMarked = false;
 };
 
 } // namespace pos
@@ -0,0 +1,141 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io/frontend_io/checksum_verify_completion.h"
+
+#include "src/event_scheduler/io_completer.h"
+#include "src/include/branch_prediction.h"
+#include "src/include/pos_event_id.h"
+#include "src/io/general_io/block_checksum.h"
+#include "src/logger/logger.h"
+
+namespace pos
+{
+ChecksumRepairCompletion::ChecksumRepairCompletion(VolumeIoSmartPtr volumeIo,
+    VirtualBlkAddr vsa, std::vector<uint32_t> checksums)
+: Callback(true, CallbackType_ChecksumRepairCompletion),
+  volumeIo(volumeIo),
+  vsa(vsa),
+  checksums(checksums),
+  armed(false)
+{
+}
+
+ChecksumRepairCompletion::~ChecksumRepairCompletion(void)
+{
+}
+
+void
+ChecksumRepairCompletion::Arm(void)
+{
+    armed = true;
+}
+
+uint32_t
+ChecksumRepairCompletion::CountMismatches(int eventId)
+{
+    uint32_t mismatchCount = 0;
+    for (uint32_t blockIndex = 0; blockIndex < checksums.size(); blockIndex++)
+    {
+        if (likely(BlockChecksum::Verify(volumeIo->GetBuffer(blockIndex), checksums[blockIndex])))
+        {
+            continue;
+        }
+        POS_TRACE_WARN(eventId,
+            "volume_id:{}, rba:{}, vsid:{}, offset:{}",
+            volumeIo->GetVolumeId(), ChangeSectorToBlock(volumeIo->GetSectorRba()) + blockIndex,
+            vsa.stripeId, vsa.offset + blockIndex);
+        mismatchCount++;
+    }
+    return mismatchCount;
+}
+
+bool
+ChecksumRepairCompletion::_DoSpecificJob(void)
+{
+    if (armed && 0 == _GetErrorCount() &&
+        CountMismatches(EID(BLOCK_CHECKSUM_REPAIR_FAILED)) > 0)
+    {
+        InformError(IOErrorType::DEVICE_ERROR);
+    }
+    volumeIo = nullptr;
+    return true;
+}
+
+ChecksumVerifyCompletion::ChecksumVerifyCompletion(VolumeIoSmartPtr volumeIo,
+    std::shared_ptr<ChecksumRepairCompletion> repair)
+: Callback(true, CallbackType_ChecksumVerifyCompletion),
+  volumeIo(volumeIo),
+  repair(repair)
+{
+}
+
+ChecksumVerifyCompletion::~ChecksumVerifyCompletion(void)
+{
+}
+
+bool
+ChecksumVerifyCompletion::_DoSpecificJob(void)
+{
+    // A failed read is already recovered or reported by the device error path
+    if (0 == _GetErrorCount() &&
+        repair->CountMismatches(EID(BLOCK_CHECKSUM_MISMATCH)) > 0)
+    {
+        _SubmitRepair();
+    }
+    volumeIo = nullptr;
+    repair = nullptr;
+    return true;
+}
+
+void
+ChecksumVerifyCompletion::_SubmitRepair(void)
+{
+    // The repair completion is executed by the ubio below rather than by this
+    // completion. Waiting for one more caller than it will ever get keeps the
+    // completion of this callback from running it as well, whichever of the
+    // two finishes first.
+    repair->Arm();
+    repair->SetWaitingCount(2);
+
+    UbioSmartPtr ubio(new Ubio(volumeIo->GetBuffer(),
+        ChangeByteToSector(volumeIo->GetSize()), volumeIo->GetArrayId()));
+    PhysicalBlkAddr pba = volumeIo->GetPba();
+    ubio->SetPba(pba);
+    ubio->SetEventType(volumeIo->GetEventType());
+    ubio->SetCallback(repair);
+
+    IoCompleter ioCompleter(ubio);
+    ioCompleter.CompleteUbio(IOErrorType::DEVICE_ERROR, true);
+}
+
+} // namespace pos
@@ -0,0 +1,84 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "src/bio/volume_io.h"
+#include "src/event_scheduler/callback.h"
+#include "src/include/address_type.h"
+
+namespace pos
+{
+// Runs after ChecksumVerifyCompletion. Once armed, it is completed by the
+// reconstructing read of the mismatched blocks and checks them again.
+class ChecksumRepairCompletion : public Callback
+{
+public:
+    ChecksumRepairCompletion(VolumeIoSmartPtr volumeIo, VirtualBlkAddr vsa,
+        std::vector<uint32_t> checksums);
+    ~ChecksumRepairCompletion(void) override;
+
+    void Arm(void);
+    uint32_t CountMismatches(int eventId);
+
+private:
+    bool _DoSpecificJob(void) override;
+
+    VolumeIoSmartPtr volumeIo;
+    VirtualBlkAddr vsa;
+    std::vector<uint32_t> checksums;
+    bool armed;
+};
+
+// Compares the blocks read from the user area with the checksums recorded in
+// their reverse map entries. On a mismatch the blocks are read again through
+// the same recovery path as a device error, which rebuilds them from the
+// other chunks of the stripe.
+class ChecksumVerifyCompletion : public Callback
+{
+public:
+    ChecksumVerifyCompletion(VolumeIoSmartPtr volumeIo,
+        std::shared_ptr<ChecksumRepairCompletion> repair);
+    ~ChecksumVerifyCompletion(void) override;
+
+private:
+    bool _DoSpecificJob(void) override;
+    void _SubmitRepair(void);
+
+    VolumeIoSmartPtr volumeIo;
+    std::shared_ptr<ChecksumRepairCompletion> repair;
+};
+
+} // namespace pos
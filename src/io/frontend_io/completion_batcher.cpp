@@ -0,0 +1,121 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io/frontend_io/completion_batcher.h"
+
+#include "src/event_scheduler/spdk_event_scheduler.h"
+#include "src/include/branch_prediction.h"
+#include "src/spdk_wrapper/event_framework_api.h"
+
+namespace pos
+{
+CompletionBatcher::CompletionBatcher(void)
+: CompletionBatcher(EventFrameworkApiSingleton::Instance())
+{
+}
+
+CompletionBatcher::CompletionBatcher(EventFrameworkApi* eventFrameworkApi)
+: eventFrameworkApi(eventFrameworkApi)
+{
+    for (uint32_t core = 0; core < MAX_REACTOR_COUNT; core++)
+    {
+        pendingCompletions[core].batcher = this;
+        pendingCompletions[core].core = core;
+        pendingCompletions[core].notified = false;
+    }
+}
+
+CompletionBatcher::~CompletionBatcher(void)
+{
+}
+
+bool
+CompletionBatcher::Enqueue(uint32_t core, EventSmartPtr completion)
+{
+    if (unlikely(core >= MAX_REACTOR_COUNT || nullptr == completion))
+    {
+        return false;
+    }
+
+    PendingCompletions& pending = pendingCompletions[core];
+    pending.queue.push(completion);
+    return _Notify(pending);
+}
+
+uint32_t
+CompletionBatcher::Drain(uint32_t core)
+{
+    PendingCompletions& pending = pendingCompletions[core];
+    // Cleared before popping, so a completion queued while draining either
+    // gets popped here or rings the reactor again
+    pending.notified = false;
+
+    uint32_t drainedCount = 0;
+    EventSmartPtr completion;
+    while (drainedCount < MAX_COMPLETIONS_PER_DRAIN && pending.queue.try_pop(completion))
+    {
+        SpdkEventScheduler::ExecuteOrScheduleEvent(core, completion);
+        drainedCount++;
+    }
+
+    // Yield to the other events of the reactor and continue on the next poll
+    if (drainedCount == MAX_COMPLETIONS_PER_DRAIN && false == pending.queue.empty())
+    {
+        _Notify(pending);
+    }
+    return drainedCount;
+}
+
+void
+CompletionBatcher::InvokeDrain(void* arg)
+{
+    PendingCompletions* pending = static_cast<PendingCompletions*>(arg);
+    pending->batcher->Drain(pending->core);
+}
+
+bool
+CompletionBatcher::_Notify(PendingCompletions& pending)
+{
+    if (pending.notified.exchange(true))
+    {
+        return true;
+    }
+
+    bool success = eventFrameworkApi->SendSpdkEvent(pending.core, InvokeDrain, &pending);
+    if (unlikely(false == success))
+    {
+        pending.notified = false;
+    }
+    return success;
+}
+
+} // namespace pos
@@ -0,0 +1,82 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include "src/include/smart_ptr_type.h"
+#include "src/lib/singleton.h"
+#include "tbb/concurrent_queue.h"
+
+namespace pos
+{
+class EventFrameworkApi;
+
+// Hands completions over to the reactors they belong to. Completions for
+// the same reactor are queued up and a single message drains all of them,
+// so a burst costs one hop instead of one per completion.
+class CompletionBatcher
+{
+public:
+    CompletionBatcher(void);
+    explicit CompletionBatcher(EventFrameworkApi* eventFrameworkApi);
+    virtual ~CompletionBatcher(void);
+
+    virtual bool Enqueue(uint32_t core, EventSmartPtr completion);
+    uint32_t Drain(uint32_t core);
+
+    static void InvokeDrain(void* arg);
+
+    static const uint32_t MAX_REACTOR_COUNT = 256;
+    static const uint32_t MAX_COMPLETIONS_PER_DRAIN = 128;
+
+private:
+    struct PendingCompletions
+    {
+        CompletionBatcher* batcher;
+        uint32_t core;
+        std::atomic<bool> notified;
+        tbb::concurrent_queue<EventSmartPtr> queue;
+    };
+
+    bool _Notify(PendingCompletions& pending);
+
+    EventFrameworkApi* eventFrameworkApi;
+    std::array<PendingCompletions, MAX_REACTOR_COUNT> pendingCompletions;
+};
+
+using CompletionBatcherSingleton = Singleton<CompletionBatcher>;
+
+} // namespace pos
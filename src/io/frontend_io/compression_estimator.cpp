@@ -0,0 +1,242 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io/frontend_io/compression_estimator.h"
+
+#include <string.h>
+
+#include <string>
+
+#include "src/include/memory.h"
+#include "src/include/pos_event_id.h"
+#include "src/io/frontend_io/compression_estimator_service.h"
+#include "src/logger/logger.h"
+#include "src/master_context/config_manager.h"
+#include "src/telemetry/telemetry_client/telemetry_client.h"
+#include "src/telemetry/telemetry_client/telemetry_publisher.h"
+#include "src/telemetry/telemetry_id.h"
+
+namespace pos
+{
+CompressionEstimator::CompressionEstimator(IArrayInfo* arrayInfo)
+: CompressionEstimator(arrayInfo, ConfigManagerSingleton::Instance(),
+      TelemetryClientSingleton::Instance(), nullptr)
+{
+}
+
+CompressionEstimator::CompressionEstimator(IArrayInfo* arrayInfo,
+    ConfigManager* configManager, TelemetryClient* telemetryClient,
+    TelemetryPublisher* publisher)
+: arrayInfo(arrayInfo),
+  configManager(configManager),
+  telemetryClient(telemetryClient),
+  publisher(publisher),
+  enabled(false)
+{
+    for (uint32_t volumeId = 0; volumeId < MAX_VOLUME_COUNT; volumeId++)
+    {
+        stats[volumeId].writeCount = 0;
+        stats[volumeId].sampledBytes = 0;
+        stats[volumeId].compressedBytes = 0;
+    }
+}
+
+CompressionEstimator::~CompressionEstimator(void)
+{
+    Dispose();
+    if (nullptr != publisher)
+    {
+        delete publisher;
+        publisher = nullptr;
+    }
+}
+
+int
+CompressionEstimator::Init(void)
+{
+    bool estimateEnabled = false;
+    int ret = configManager->GetValue("performance", "compression_estimate_enable",
+        &estimateEnabled, CONFIG_TYPE_BOOL);
+    if (ret != EID(SUCCESS) || false == estimateEnabled || true == enabled)
+    {
+        return EID(SUCCESS);
+    }
+
+    if (nullptr == publisher)
+    {
+        publisher = new TelemetryPublisher("CompressionEstimator_" + arrayInfo->GetName());
+        publisher->AddDefaultLabel("array_name", arrayInfo->GetName());
+    }
+    if (nullptr != telemetryClient)
+    {
+        telemetryClient->RegisterPublisher(publisher);
+    }
+
+    enabled = true;
+    CompressionEstimatorServiceSingleton::Instance()->Register(arrayInfo->GetIndex(), this);
+    POS_TRACE_INFO(EID(COMPRESSION_ESTIMATE_ENABLED),
+        "Compression estimate is enabled, array_name:{}", arrayInfo->GetName());
+    return EID(SUCCESS);
+}
+
+void
+CompressionEstimator::Dispose(void)
+{
+    if (false == enabled)
+    {
+        return;
+    }
+
+    enabled = false;
+    CompressionEstimatorServiceSingleton::Instance()->Unregister(arrayInfo->GetIndex());
+    if (nullptr != telemetryClient)
+    {
+        telemetryClient->DeregisterPublisher(publisher->GetName());
+    }
+}
+
+void
+CompressionEstimator::Shutdown(void)
+{
+    Dispose();
+}
+
+void
+CompressionEstimator::Flush(void)
+{
+    // no-op for IMountSequence
+}
+
+bool
+CompressionEstimator::IsEnabled(void)
+{
+    return enabled;
+}
+
+void
+CompressionEstimator::Sample(uint32_t volumeId, const void* buffer, uint64_t size)
+{
+    if (false == enabled || volumeId >= MAX_VOLUME_COUNT || size < BLOCK_SIZE)
+    {
+        return;
+    }
+
+    VolumeStats& volumeStats = stats[volumeId];
+    uint64_t writeCount = volumeStats.writeCount++;
+    if (0 != (writeCount % SAMPLE_INTERVAL))
+    {
+        return;
+    }
+
+    uint32_t compressedSize = EstimateCompressedSize(static_cast<const uint8_t*>(buffer), BLOCK_SIZE);
+    volumeStats.sampledBytes += BLOCK_SIZE;
+    volumeStats.compressedBytes += compressedSize;
+
+    uint64_t sampleCount = writeCount / SAMPLE_INTERVAL + 1;
+    if (0 == (sampleCount % PUBLISH_INTERVAL))
+    {
+        _Publish(volumeId);
+    }
+}
+
+uint64_t
+CompressionEstimator::GetRatioInPercent(uint32_t volumeId)
+{
+    if (volumeId >= MAX_VOLUME_COUNT)
+    {
+        return 0;
+    }
+
+    uint64_t compressedBytes = stats[volumeId].compressedBytes;
+    if (0 == compressedBytes)
+    {
+        return 0;
+    }
+    return stats[volumeId].sampledBytes * 100 / compressedBytes;
+}
+
+uint32_t
+CompressionEstimator::EstimateCompressedSize(const uint8_t* data, uint32_t size)
+{
+    // Close to the LZ4 fast parse: a sequence costs a token, an offset and
+    // its literals, and a match is taken wherever the hash finds one
+    uint16_t table[1 << HASH_BITS];
+    memset(table, 0, sizeof(table));
+
+    uint32_t estimated = 0;
+    uint32_t literals = 0;
+    uint32_t pos = 0;
+    while (pos + MIN_MATCH <= size)
+    {
+        uint32_t sequence;
+        memcpy(&sequence, data + pos, sizeof(sequence));
+        uint32_t hash = (sequence * 2654435761U) >> (32 - HASH_BITS);
+        uint32_t candidate = table[hash];
+        table[hash] = static_cast<uint16_t>(pos + 1);
+
+        if (0 != candidate && pos - (candidate - 1) <= MAX_OFFSET
+            && 0 == memcmp(data + candidate - 1, data + pos, MIN_MATCH))
+        {
+            uint32_t matchStart = candidate - 1;
+            uint32_t length = MIN_MATCH;
+            while (pos + length < size && data[matchStart + length] == data[pos + length])
+            {
+                length++;
+            }
+            estimated += literals + SEQUENCE_OVERHEAD + literals / 255 + length / 255;
+            literals = 0;
+            pos += length;
+            continue;
+        }
+        literals++;
+        pos++;
+    }
+    literals += size - pos;
+    estimated += literals + 1 + literals / 255;
+
+    if (estimated > size)
+    {
+        return size;
+    }
+    return estimated;
+}
+
+void
+CompressionEstimator::_Publish(uint32_t volumeId)
+{
+    POSMetric metric(TEL50023_VOL_VOLUME_COMPRESSION_RATIO, MT_GAUGE);
+    metric.SetGaugeValue(GetRatioInPercent(volumeId));
+    metric.AddLabel("volume_id", std::to_string(volumeId));
+    publisher->PublishMetric(metric);
+}
+
+} // namespace pos
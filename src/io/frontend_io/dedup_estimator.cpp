@@ -0,0 +1,215 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io/frontend_io/dedup_estimator.h"
+
+#include <string>
+
+#include "src/include/memory.h"
+#include "src/include/pos_event_id.h"
+#include "src/io/frontend_io/dedup_estimator_service.h"
+#include "src/logger/logger.h"
+#include "src/master_context/config_manager.h"
+#include "src/telemetry/telemetry_client/telemetry_client.h"
+#include "src/telemetry/telemetry_client/telemetry_publisher.h"
+#include "src/telemetry/telemetry_id.h"
+
+namespace pos
+{
+DedupEstimator::DedupEstimator(IArrayInfo* arrayInfo)
+: DedupEstimator(arrayInfo, ConfigManagerSingleton::Instance(),
+      TelemetryClientSingleton::Instance(), nullptr)
+{
+}
+
+DedupEstimator::DedupEstimator(IArrayInfo* arrayInfo,
+    ConfigManager* configManager, TelemetryClient* telemetryClient,
+    TelemetryPublisher* publisher)
+: arrayInfo(arrayInfo),
+  configManager(configManager),
+  telemetryClient(telemetryClient),
+  publisher(publisher),
+  enabled(false)
+{
+    for (uint32_t volumeId = 0; volumeId < MAX_VOLUME_COUNT; volumeId++)
+    {
+        stats[volumeId].sampledBlocks = 0;
+        stats[volumeId].duplicateBlocks = 0;
+    }
+}
+
+DedupEstimator::~DedupEstimator(void)
+{
+    Dispose();
+    if (nullptr != publisher)
+    {
+        delete publisher;
+        publisher = nullptr;
+    }
+}
+
+int
+DedupEstimator::Init(void)
+{
+    bool estimateEnabled = false;
+    int ret = configManager->GetValue("performance", "dedup_estimate_enable",
+        &estimateEnabled, CONFIG_TYPE_BOOL);
+    if (ret != EID(SUCCESS) || false == estimateEnabled || true == enabled)
+    {
+        return EID(SUCCESS);
+    }
+
+    // An all-zero entry stands for an empty slot; no real block is expected
+    // to fingerprint to all zero bits
+    index.assign(1U << INDEX_BITS, BlockFingerprint{0, 0});
+
+    if (nullptr == publisher)
+    {
+        publisher = new TelemetryPublisher("DedupEstimator_" + arrayInfo->GetName());
+        publisher->AddDefaultLabel("array_name", arrayInfo->GetName());
+    }
+    if (nullptr != telemetryClient)
+    {
+        telemetryClient->RegisterPublisher(publisher);
+    }
+
+    enabled = true;
+    DedupEstimatorServiceSingleton::Instance()->Register(arrayInfo->GetIndex(), this);
+    POS_TRACE_INFO(EID(DEDUP_ESTIMATE_ENABLED),
+        "Dedup estimate is enabled, array_name:{}", arrayInfo->GetName());
+    return EID(SUCCESS);
+}
+
+void
+DedupEstimator::Dispose(void)
+{
+    if (false == enabled)
+    {
+        return;
+    }
+
+    enabled = false;
+    DedupEstimatorServiceSingleton::Instance()->Unregister(arrayInfo->GetIndex());
+    if (nullptr != telemetryClient)
+    {
+        telemetryClient->DeregisterPublisher(publisher->GetName());
+    }
+}
+
+void
+DedupEstimator::Shutdown(void)
+{
+    Dispose();
+}
+
+void
+DedupEstimator::Flush(void)
+{
+    // no-op for IMountSequence
+}
+
+bool
+DedupEstimator::IsEnabled(void)
+{
+    return enabled;
+}
+
+void
+DedupEstimator::Sample(uint32_t volumeId, const void* buffer, uint64_t size)
+{
+    if (false == enabled || volumeId >= MAX_VOLUME_COUNT)
+    {
+        return;
+    }
+
+    const uint8_t* bytes = static_cast<const uint8_t*>(buffer);
+    const uint64_t sampleMask = (1ULL << SAMPLE_BITS) - 1;
+    VolumeStats& volumeStats = stats[volumeId];
+    for (uint64_t offset = 0; offset + BLOCK_SIZE <= size; offset += BLOCK_SIZE)
+    {
+        BlockFingerprint fingerprint = BlockFingerprint::Compute(bytes + offset, BLOCK_SIZE);
+        if (0 != (fingerprint.low & sampleMask))
+        {
+            continue;
+        }
+
+        if (_Lookup(fingerprint))
+        {
+            volumeStats.duplicateBlocks++;
+        }
+        uint64_t sampledBlocks = ++volumeStats.sampledBlocks;
+        if (0 == (sampledBlocks % PUBLISH_INTERVAL))
+        {
+            _Publish(volumeId);
+        }
+    }
+}
+
+uint64_t
+DedupEstimator::GetDuplicateRatioInPercent(uint32_t volumeId)
+{
+    if (volumeId >= MAX_VOLUME_COUNT)
+    {
+        return 0;
+    }
+
+    uint64_t sampledBlocks = stats[volumeId].sampledBlocks;
+    if (0 == sampledBlocks)
+    {
+        return 0;
+    }
+    return stats[volumeId].duplicateBlocks * 100 / sampledBlocks;
+}
+
+bool
+DedupEstimator::_Lookup(const BlockFingerprint& fingerprint)
+{
+    uint64_t slot = (fingerprint.low >> SAMPLE_BITS) & ((1ULL << INDEX_BITS) - 1);
+    std::lock_guard<std::mutex> lock(indexLock);
+    if (index[slot] == fingerprint)
+    {
+        return true;
+    }
+    index[slot] = fingerprint;
+    return false;
+}
+
+void
+DedupEstimator::_Publish(uint32_t volumeId)
+{
+    POSMetric metric(TEL50024_VOL_VOLUME_DUPLICATE_RATIO, MT_GAUGE);
+    metric.SetGaugeValue(GetDuplicateRatioInPercent(volumeId));
+    metric.AddLabel("volume_id", std::to_string(volumeId));
+    publisher->PublishMetric(metric);
+}
+
+} // namespace pos
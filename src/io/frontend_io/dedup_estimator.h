@@ -0,0 +1,97 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "src/array_models/interface/i_array_info.h"
+#include "src/array_models/interface/i_mount_sequence.h"
+#include "src/lib/block_fingerprint.h"
+#include "src/volume/volume_base.h"
+
+namespace pos
+{
+class ConfigManager;
+class TelemetryClient;
+class TelemetryPublisher;
+
+// Estimates how many written blocks are duplicates of blocks already written
+// to the array. Every block is fingerprinted, but only fingerprints whose low
+// bits are zero are kept, so that two copies of the same block are always
+// sampled together and the ratio stays unbiased. The kept fingerprints live
+// in a direct-mapped index that overwrites older entries.
+class DedupEstimator : public IMountSequence
+{
+public:
+    explicit DedupEstimator(IArrayInfo* arrayInfo);
+    DedupEstimator(IArrayInfo* arrayInfo, ConfigManager* configManager,
+        TelemetryClient* telemetryClient, TelemetryPublisher* publisher);
+    virtual ~DedupEstimator(void);
+
+    int Init(void) override;
+    void Dispose(void) override;
+    void Shutdown(void) override;
+    void Flush(void) override;
+
+    virtual bool IsEnabled(void);
+    virtual void Sample(uint32_t volumeId, const void* buffer, uint64_t size);
+    virtual uint64_t GetDuplicateRatioInPercent(uint32_t volumeId);
+
+    static const uint32_t SAMPLE_BITS = 4;
+    static const uint32_t INDEX_BITS = 16;
+    static const uint32_t PUBLISH_INTERVAL = 64;
+
+private:
+    struct VolumeStats
+    {
+        std::atomic<uint64_t> sampledBlocks;
+        std::atomic<uint64_t> duplicateBlocks;
+    };
+
+    bool _Lookup(const BlockFingerprint& fingerprint);
+    void _Publish(uint32_t volumeId);
+
+    IArrayInfo* arrayInfo;
+    ConfigManager* configManager;
+    TelemetryClient* telemetryClient;
+    TelemetryPublisher* publisher;
+    std::atomic<bool> enabled;
+    VolumeStats stats[MAX_VOLUME_COUNT];
+    std::vector<BlockFingerprint> index;
+    std::mutex indexLock;
+};
+
+} // namespace pos
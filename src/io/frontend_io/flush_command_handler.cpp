@@ -61,7 +61,8 @@ FlushCmdHandler::FlushCmdHandler(FlushIoSmartPtr flushIo, FlushCmdManager* flush
   iMapFlush(iMapFlush),
   flushIo(flushIo),
   volumeId(flushIo->GetVolumeId()),
-  stripeMapFlushIssued(false)
+  stripeMapFlushIssued(false),
+  sealedSequence(0)
 {
 }
 
@@ -79,6 +80,13 @@ FlushCmdHandler::Execute(void)
         return true;
     }
 
+    // Internal flushes keep destaging stripes and maps per threshold policy
+    if (flushCmdManager->IsNvramDurableFlushEnabled() == true &&
+        flushIo->IsInternalFlush() == false)
+    {
+        return _CompleteOnceWritesDurable();
+    }
+
     switch (flushIo->GetState())
     {
         case FLUSH__BLOCKING_ALLOCATION:
@@ -256,6 +264,33 @@ FlushCmdHandler::Execute(void)
     return true;
 }
 
+bool
+FlushCmdHandler::_CompleteOnceWritesDurable(void)
+{
+    if (flushIo->GetState() != FLUSH__WRITE_SEQUENCE_SEALED)
+    {
+        if (flushCmdManager->TrySealWriteSequence(volumeId, sealedSequence) == false)
+        {
+            return false;
+        }
+        flushIo->SetState(FLUSH__WRITE_SEQUENCE_SEALED);
+    }
+
+    // Writes are acknowledged only after their block map log is written
+    if (flushCmdManager->IsWriteSequenceDurable(volumeId, sealedSequence) == false)
+    {
+        return false;
+    }
+    flushCmdManager->ReleaseWriteSequence(volumeId);
+
+    IoCompleter ioCompleter(flushIo);
+    ioCompleter.CompleteUbio(IOErrorType::SUCCESS, true);
+
+    POS_TRACE_DEBUG(EID(FLUSH_CMD_ONGOING),
+        "Flush command on volume {} completed at write sequence {}", volumeId, sealedSequence);
+    return true;
+}
+
 MapFlushCompleteEvent::MapFlushCompleteEvent(int mapId, FlushIoSmartPtr flushIo)
 : mapId(mapId),
   flushIo(flushIo)
@@ -51,6 +51,8 @@ public:
     virtual bool Execute(void);
 
 private:
+    bool _CompleteOnceWritesDurable(void);
+
     FlushCmdManager* flushCmdManager;
     IWBStripeAllocator* iWBStripeAllocator;
     IBlockAllocator* iBlockAllocator;
@@ -59,6 +61,7 @@ private:
     FlushIoSmartPtr flushIo;
     int volumeId;
     bool stripeMapFlushIssued;
+    uint64_t sealedSequence;
 };
 
 class MapFlushCompleteEvent : public Event
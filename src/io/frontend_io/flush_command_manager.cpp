@@ -50,6 +50,12 @@ FlushCmdManager::FlushCmdManager(EventScheduler* eventSchedulerArg)
     for (int i = 0; i< MAX_VOLUME_COUNT; i++)
     {
         flushInProgress[i] = false;
+        writeSequence[i] = 0;
+        writeSequenceSealed[i] = false;
+        for (uint32_t slot = 0; slot < WRITE_SEQUENCE_SLOTS; slot++)
+        {
+            pendingWrites[i][slot] = 0;
+        }
     }
 }
 
@@ -164,4 +170,58 @@ FlushCmdManager::ResetFlushInProgress(uint32_t volId, bool isBackendFlush)
     }
 }
 
+bool
+FlushCmdManager::IsNvramDurableFlushEnabled(void)
+{
+    return config.IsNvramDurableFlushEnabled();
+}
+
+uint32_t
+FlushCmdManager::StartWrite(uint32_t volId)
+{
+    while (true)
+    {
+        uint64_t sequence = writeSequence[volId];
+        uint32_t slot = sequence % WRITE_SEQUENCE_SLOTS;
+        pendingWrites[volId][slot]++;
+
+        // A flush sealed the sequence in between; count in the new one instead
+        if (writeSequence[volId] == sequence)
+        {
+            return slot;
+        }
+        pendingWrites[volId][slot]--;
+    }
+}
+
+void
+FlushCmdManager::AckWrite(uint32_t volId, uint32_t slot)
+{
+    pendingWrites[volId][slot]--;
+}
+
+bool
+FlushCmdManager::TrySealWriteSequence(uint32_t volId, uint64_t& sealedSequence)
+{
+    // Only two slots alternate, so a sequence has to drain before the next seal
+    if (writeSequenceSealed[volId].exchange(true) == true)
+    {
+        return false;
+    }
+    sealedSequence = writeSequence[volId]++;
+    return true;
+}
+
+bool
+FlushCmdManager::IsWriteSequenceDurable(uint32_t volId, uint64_t sealedSequence)
+{
+    return (pendingWrites[volId][sealedSequence % WRITE_SEQUENCE_SLOTS] == 0);
+}
+
+void
+FlushCmdManager::ReleaseWriteSequence(uint32_t volId)
+{
+    writeSequenceSealed[volId] = false;
+}
+
 } // namespace pos
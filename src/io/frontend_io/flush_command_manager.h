@@ -32,6 +32,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <list>
 #include <mutex>
 
@@ -56,12 +57,27 @@ public:
     virtual bool TrySetFlushInProgress(uint32_t volId);
     virtual void ResetFlushInProgress(uint32_t volId, bool isBackendFlush);
 
+    // Per-volume write sequence used when acknowledged writes are already
+    // durable in the journal: a flush seals the current sequence and
+    // completes once every write started within it is acknowledged
+    virtual bool IsNvramDurableFlushEnabled(void);
+    virtual uint32_t StartWrite(uint32_t volId);
+    virtual void AckWrite(uint32_t volId, uint32_t slot);
+    virtual bool TrySealWriteSequence(uint32_t volId, uint64_t& sealedSequence);
+    virtual bool IsWriteSequenceDurable(uint32_t volId, uint64_t sealedSequence);
+    virtual void ReleaseWriteSequence(uint32_t volId);
+
 private:
+    static const uint32_t WRITE_SEQUENCE_SLOTS = 2;
+
     std::mutex metaFlushLock;
     std::mutex createAndExecFlushLock;
     std::atomic<bool> flushInProgress[MAX_VOLUME_COUNT];
     std::list<FlushIoSmartPtr> flushEvents;
     bool backendFlushInProgress[MAX_VOLUME_COUNT];
+    std::atomic<uint64_t> writeSequence[MAX_VOLUME_COUNT];
+    std::atomic<uint64_t> pendingWrites[MAX_VOLUME_COUNT][WRITE_SEQUENCE_SLOTS];
+    std::atomic<bool> writeSequenceSealed[MAX_VOLUME_COUNT];
     bool metaFlushInProgress;
     FlushConfiguration config;
     EventScheduler* eventScheduler;
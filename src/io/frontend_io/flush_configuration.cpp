@@ -47,6 +47,7 @@ FlushConfiguration::FlushConfiguration(ConfigManager* configManager)
 : enabled(false),
   internalFlushEnabled(false),
   internalFlushThreshold(100),
+  nvramDurableFlushEnabled(false),
   configManager(configManager)
 {
     bool flushEnableInConfig = _ReadFlushEnableFromConfig();
@@ -54,10 +55,23 @@ FlushConfiguration::FlushConfiguration(ConfigManager* configManager)
 
     if (journalEnableInConfig == true)
     {
-        enabled = false;
+        // Acknowledged writes are already logged in the journal, so a flush
+        // only has to wait for the writes issued before it to be acknowledged
+        nvramDurableFlushEnabled = _ReadNvramDurableFlushEnableFromConfig();
+        enabled = nvramDurableFlushEnabled;
 
-        POS_TRACE_INFO(EID(FLUSH_HANDLING_DISABLED),
-            "Flush command handling is disabled as journal is enabled");
+        if (enabled == true)
+        {
+            POS_TRACE_INFO(EID(FLUSH_HANDLING_ENABLED),
+                "Flush command completes once prior writes are journaled");
+            internalFlushThreshold = _ReadFlushInternalThresholdFromConfig();
+            internalFlushEnabled = _ReadInternalFlushEnableFromConfig();
+        }
+        else
+        {
+            POS_TRACE_INFO(EID(FLUSH_HANDLING_DISABLED),
+                "Flush command handling is disabled as journal is enabled");
+        }
     }
     else
     {
@@ -132,6 +146,20 @@ FlushConfiguration::_ReadFlushInternalThresholdFromConfig(void)
     return threshold;
 }
 
+bool
+FlushConfiguration::_ReadNvramDurableFlushEnableFromConfig(void)
+{
+    bool enabled;
+    int ret = configManager->GetValue("flush", "nvram_durable_flush_enable",
+        static_cast<void*>(&enabled), CONFIG_TYPE_BOOL);
+
+    if (ret != 0)
+    {
+        enabled = false;
+    }
+    return enabled;
+}
+
 bool
 FlushConfiguration::IsEnabled(void)
 {
@@ -150,4 +178,10 @@ FlushConfiguration::GetInternalFlushThreshold(void)
     return internalFlushThreshold;
 }
 
+bool
+FlushConfiguration::IsNvramDurableFlushEnabled(void)
+{
+    return nvramDurableFlushEnabled;
+}
+
 } // namespace pos
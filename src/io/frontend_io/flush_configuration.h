@@ -44,15 +44,18 @@ public:
     bool IsEnabled(void);
     bool IsInternalFlushEnabled(void);
     int GetInternalFlushThreshold(void);
+    bool IsNvramDurableFlushEnabled(void);
 
 private:
     bool _ReadFlushEnableFromConfig(void);
     bool _ReadJournalEnableFromConfig(void);
     bool _ReadInternalFlushEnableFromConfig(void);
     int _ReadFlushInternalThresholdFromConfig(void);
+    bool _ReadNvramDurableFlushEnableFromConfig(void);
     bool enabled;
     bool internalFlushEnabled;
     int internalFlushThreshold;
+    bool nvramDurableFlushEnabled;
     ConfigManager* configManager;
 };
 
@@ -0,0 +1,203 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io/frontend_io/full_stripe_write.h"
+
+#include "src/allocator/stripe_manager/stripe.h"
+#include "src/allocator_service/allocator_service.h"
+#include "src/array_mgmt/array_manager.h"
+#include "src/include/branch_prediction.h"
+#include "src/include/meta_const.h"
+#include "src/include/pos_event_id.h"
+#include "src/io/general_io/write_amplification_monitor_service.h"
+#include "src/logger/logger.h"
+#include "src/master_context/config_manager.h"
+#include "src/meta_service/meta_service.h"
+#include "src/spdk_wrapper/event_framework_api.h"
+
+namespace pos
+{
+static const PartitionLogicalSize*
+GetUserDataSize(int arrayId)
+{
+    ComponentsInfo* info = ArrayMgr()->GetInfo(arrayId);
+    if (nullptr == info || nullptr == info->arrayInfo)
+    {
+        return nullptr;
+    }
+    return info->arrayInfo->GetSizeInfo(PartitionType::USER_DATA);
+}
+
+FullStripeWrite::FullStripeWrite(VolumeIoSmartPtr volumeIo)
+: FullStripeWrite(volumeIo, IIOSubmitHandler::GetInstance(),
+      AllocatorServiceSingleton::Instance()->GetIWBStripeAllocator(volumeIo->GetArrayId()),
+      GetUserDataSize(volumeIo->GetArrayId()))
+{
+}
+
+FullStripeWrite::FullStripeWrite(VolumeIoSmartPtr volumeIo, IIOSubmitHandler* ioSubmitHandler,
+    IWBStripeAllocator* wbStripeAllocator, const PartitionLogicalSize* udSize)
+: volumeIo(volumeIo),
+  ioSubmitHandler(ioSubmitHandler),
+  wbStripeAllocator(wbStripeAllocator),
+  udSize(udSize)
+{
+}
+
+FullStripeWrite::~FullStripeWrite(void)
+{
+}
+
+bool
+FullStripeWrite::IsFullStripe(const VirtualBlks& vsaRange)
+{
+    if (nullptr == udSize)
+    {
+        return false;
+    }
+    return 0 == vsaRange.startVsa.offset && udSize->blksPerStripe == vsaRange.numBlks;
+}
+
+bool
+FullStripeWrite::Execute(void)
+{
+    StripeSmartPtr stripe = wbStripeAllocator->GetStripe(volumeIo->GetLsidEntry().stripeId);
+    if (unlikely(nullptr == stripe))
+    {
+        return false;
+    }
+
+    std::list<BufferEntry> bufferList;
+    char* buffer = static_cast<char*>(volumeIo->GetBuffer());
+    uint64_t blocksInStripe = 0;
+    for (uint32_t chunkIndex = 0; chunkIndex < udSize->chunksPerStripe; chunkIndex++)
+    {
+        BufferEntry bufferEntry(buffer, BLOCKS_IN_CHUNK);
+        bufferList.push_back(bufferEntry);
+        blocksInStripe += BLOCKS_IN_CHUNK;
+        buffer += BLOCKS_IN_CHUNK * BLOCK_SIZE;
+    }
+
+    LogicalBlkAddr startLsa = {
+        .stripeId = stripe->GetUserLsid(),
+        .offset = 0};
+    CallbackSmartPtr callback(new FullStripeWriteCompletion(volumeIo, stripe));
+    IOSubmitHandlerStatus status = ioSubmitHandler->SubmitAsyncIO(IODirection::WRITE,
+        bufferList, startLsa, blocksInStripe, USER_DATA, callback, volumeIo->GetArrayId());
+    if (IOSubmitHandlerStatus::SUCCESS == status)
+    {
+        // written in place of the flush, which skips direct written stripes
+        WriteAmplificationMonitorServiceSingleton::Instance()->Add(volumeIo->GetArrayId(),
+            WriteSource::Flush, blocksInStripe * BLOCK_SIZE);
+    }
+    return (IOSubmitHandlerStatus::SUCCESS == status || IOSubmitHandlerStatus::FAIL_IN_SYSTEM_STOP == status);
+}
+
+bool
+FullStripeWrite::IsEnabled(void)
+{
+    static bool enabled = LoadConfig(ConfigManagerSingleton::Instance());
+    return enabled;
+}
+
+bool
+FullStripeWrite::LoadConfig(ConfigManager* configManager)
+{
+    bool directWriteEnabled = false;
+    int ret = configManager->GetValue("performance", "full_stripe_direct_write_enable",
+        &directWriteEnabled, CONFIG_TYPE_BOOL);
+    if (ret != EID(SUCCESS) || false == directWriteEnabled)
+    {
+        return false;
+    }
+
+    // The stripe map is updated ahead of the block map, which the journal
+    // does not replay in that order
+    bool journalEnabled = false;
+    ret = configManager->GetValue("journal", "enable", &journalEnabled, CONFIG_TYPE_BOOL);
+    if (ret == EID(SUCCESS) && true == journalEnabled)
+    {
+        POS_TRACE_WARN(EID(FULL_STRIPE_DIRECT_WRITE_NOT_SUPPORTED),
+            "Full stripe direct write needs the journal to be disabled");
+        return false;
+    }
+
+    POS_TRACE_INFO(EID(FULL_STRIPE_DIRECT_WRITE_ENABLED), "Full stripe direct write is enabled");
+    return true;
+}
+
+FullStripeWriteCompletion::FullStripeWriteCompletion(VolumeIoSmartPtr volumeIo, StripeSmartPtr stripe)
+: FullStripeWriteCompletion(volumeIo, stripe,
+      MetaServiceSingleton::Instance()->GetMetaUpdater(volumeIo->GetArrayId()))
+{
+}
+
+FullStripeWriteCompletion::FullStripeWriteCompletion(VolumeIoSmartPtr volumeIo,
+    StripeSmartPtr stripe, IMetaUpdater* metaUpdater)
+: Callback(false, CallbackType_FullStripeWriteCompletion),
+  volumeIo(volumeIo),
+  stripe(stripe),
+  metaUpdater(metaUpdater)
+{
+}
+
+FullStripeWriteCompletion::~FullStripeWriteCompletion(void)
+{
+}
+
+bool
+FullStripeWriteCompletion::_DoSpecificJob(void)
+{
+    CallbackSmartPtr blockMapUpdateRequest = volumeIo->GetCallback();
+    if (unlikely(_GetErrorCount() > 0))
+    {
+        // The error goes on to the block map update request, which fails the write
+        volumeIo->ClearCallback();
+        SetCallee(blockMapUpdateRequest);
+        volumeIo = nullptr;
+        return true;
+    }
+
+    // The flush of this stripe finds this mark and skips copying the write buffer
+    stripe->SetDirectWritten();
+    int ret = metaUpdater->UpdateStripeMap(stripe, blockMapUpdateRequest);
+    if (unlikely(EID(SUCCESS) != ret))
+    {
+        return false;
+    }
+
+    volumeIo->ClearCallback();
+    volumeIo = nullptr;
+    return true;
+}
+
+} // namespace pos
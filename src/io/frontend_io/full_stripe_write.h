@@ -0,0 +1,91 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <list>
+
+#include "src/allocator/i_wbstripe_allocator.h"
+#include "src/array_models/interface/i_array_info.h"
+#include "src/bio/volume_io.h"
+#include "src/event_scheduler/callback.h"
+#include "src/include/address_type.h"
+#include "src/io_submit_interface/i_io_submit_handler.h"
+#include "src/meta_service/i_meta_updater.h"
+
+namespace pos
+{
+class ConfigManager;
+
+// Writes a volume io that was given a whole user stripe straight to the user
+// data area, parity included, so that its data never goes through the write
+// buffer. The volume io has to be set up for its stripe as for a normal write.
+class FullStripeWrite
+{
+public:
+    explicit FullStripeWrite(VolumeIoSmartPtr volumeIo);
+    FullStripeWrite(VolumeIoSmartPtr volumeIo, IIOSubmitHandler* ioSubmitHandler,
+        IWBStripeAllocator* wbStripeAllocator, const PartitionLogicalSize* udSize);
+    virtual ~FullStripeWrite(void);
+
+    virtual bool IsFullStripe(const VirtualBlks& vsaRange);
+    virtual bool Execute(void);
+
+    static bool IsEnabled(void);
+    static bool LoadConfig(ConfigManager* configManager);
+
+private:
+    VolumeIoSmartPtr volumeIo;
+    IIOSubmitHandler* ioSubmitHandler;
+    IWBStripeAllocator* wbStripeAllocator;
+    const PartitionLogicalSize* udSize;
+};
+
+// Points the stripe map at the user data area before the block map is
+// updated, so that reads of the new blocks never look into the write buffer
+class FullStripeWriteCompletion : public Callback
+{
+public:
+    FullStripeWriteCompletion(VolumeIoSmartPtr volumeIo, StripeSmartPtr stripe);
+    FullStripeWriteCompletion(VolumeIoSmartPtr volumeIo, StripeSmartPtr stripe,
+        IMetaUpdater* metaUpdater);
+    ~FullStripeWriteCompletion(void) override;
+
+private:
+    bool _DoSpecificJob(void) override;
+
+    VolumeIoSmartPtr volumeIo;
+    StripeSmartPtr stripe;
+    IMetaUpdater* metaUpdater;
+};
+
+} // namespace pos
@@ -0,0 +1,545 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io/frontend_io/partial_write_coalescer.h"
+
+#include <string.h>
+
+#include <list>
+#include <tuple>
+
+#include "src/allocator/i_context_manager.h"
+#include "src/allocator/stripe_manager/stripe.h"
+#include "src/allocator_service/allocator_service.h"
+#include "src/array/device/array_device.h"
+#include "src/array/service/array_service_layer.h"
+#include "src/array/service/io_translator/i_io_translator.h"
+#include "src/device/base/ublock_device.h"
+#include "src/device/i_io_dispatcher.h"
+#include "src/include/branch_prediction.h"
+#include "src/include/meta_const.h"
+#include "src/include/pos_event_id.h"
+#include "src/io/frontend_io/partial_write_coalescer_service.h"
+#include "src/io_scheduler/io_dispatcher.h"
+#include "src/logger/logger.h"
+#include "src/mapper/i_stripemap.h"
+#include "src/mapper_service/mapper_service.h"
+#include "src/master_context/config_manager.h"
+
+namespace pos
+{
+PartialBlockMergeCompletion::PartialBlockMergeCompletion(PartialWriteCoalescer* coalescer,
+    VolumeIoSmartPtr baseIo)
+: Callback(false, CallbackType_PartialBlockMergeCompletion),
+  coalescer(coalescer),
+  baseIo(baseIo)
+{
+}
+
+PartialBlockMergeCompletion::~PartialBlockMergeCompletion(void)
+{
+}
+
+bool
+PartialBlockMergeCompletion::_DoSpecificJob(void)
+{
+    coalescer->CompleteMerge(baseIo, 0 == _GetErrorCount());
+    baseIo = nullptr;
+    return true;
+}
+
+PartialWriteCoalescer::PartialWriteCoalescer(IArrayInfo* arrayInfo)
+: PartialWriteCoalescer(arrayInfo, ConfigManagerSingleton::Instance(),
+      nullptr, nullptr, nullptr, nullptr)
+{
+}
+
+PartialWriteCoalescer::PartialWriteCoalescer(IArrayInfo* arrayInfo,
+    ConfigManager* configManager, ISegmentCtx* segmentCtx, IStripeMap* stripeMap,
+    IIOTranslator* translator, IIODispatcher* ioDispatcher)
+: arrayInfo(arrayInfo),
+  configManager(configManager),
+  segmentCtx(segmentCtx),
+  stripeMap(stripeMap),
+  translator(translator),
+  ioDispatcher(ioDispatcher),
+  enabled(false),
+  pendingBlockCount(0)
+{
+}
+
+PartialWriteCoalescer::~PartialWriteCoalescer(void)
+{
+    Dispose();
+}
+
+int
+PartialWriteCoalescer::Init(void)
+{
+    bool coalescingEnabled = false;
+    int ret = configManager->GetValue("performance", "partial_write_coalescing_enable",
+        &coalescingEnabled, CONFIG_TYPE_BOOL);
+    if (ret != EID(SUCCESS) || false == coalescingEnabled || true == enabled)
+    {
+        return EID(SUCCESS);
+    }
+
+    // Neither the valid sector mask nor the base of a block is logged, so
+    // a block could not be completed when the journal is replayed
+    bool journalEnabled = false;
+    ret = configManager->GetValue("journal", "enable", &journalEnabled, CONFIG_TYPE_BOOL);
+    if (ret == EID(SUCCESS) && true == journalEnabled)
+    {
+        POS_TRACE_WARN(EID(PARTIAL_WRITE_COALESCING_NOT_SUPPORTED),
+            "Partial write coalescing needs the journal to be disabled, array_name:{}",
+            arrayInfo->GetName());
+        return EID(SUCCESS);
+    }
+
+    int arrayId = arrayInfo->GetIndex();
+    if (nullptr == segmentCtx)
+    {
+        segmentCtx = AllocatorServiceSingleton::Instance()->GetIContextManager(arrayId)->GetSegmentContextUpdaterPtr();
+    }
+    if (nullptr == stripeMap)
+    {
+        stripeMap = MapperServiceSingleton::Instance()->GetIStripeMap(arrayId);
+    }
+    if (nullptr == translator)
+    {
+        translator = ArrayService::Instance()->Getter()->GetTranslator();
+    }
+    if (nullptr == ioDispatcher)
+    {
+        ioDispatcher = IODispatcherSingleton::Instance();
+    }
+
+    // Missing sectors are merged into the write buffer in place
+    std::list<PhysicalEntry> entries;
+    LogicalEntry wbEntry = {.addr = {.stripeId = 0, .offset = 0}, .blkCnt = 1};
+    ret = translator->Translate(arrayId, WRITE_BUFFER, entries, wbEntry);
+    if (ret != EID(SUCCESS) || entries.empty() || nullptr == entries.front().addr.arrayDev
+        || nullptr == entries.front().addr.arrayDev->GetUblock()->GetByteAddress())
+    {
+        POS_TRACE_WARN(EID(PARTIAL_WRITE_COALESCING_NOT_SUPPORTED),
+            "Partial write coalescing needs a byte addressable write buffer, array_name:{}",
+            arrayInfo->GetName());
+        return EID(SUCCESS);
+    }
+
+    enabled = true;
+    PartialWriteCoalescerServiceSingleton::Instance()->Register(arrayId, this);
+    POS_TRACE_INFO(EID(PARTIAL_WRITE_COALESCING_ENABLED),
+        "Partial write coalescing is enabled, array_name:{}", arrayInfo->GetName());
+    return EID(SUCCESS);
+}
+
+void
+PartialWriteCoalescer::Dispose(void)
+{
+    if (false == enabled)
+    {
+        return;
+    }
+
+    enabled = false;
+    PartialWriteCoalescerServiceSingleton::Instance()->Unregister(arrayInfo->GetIndex());
+
+    std::lock_guard<std::mutex> lock(blockLock);
+    if (false == blocks.empty())
+    {
+        POS_TRACE_WARN(EID(PARTIAL_WRITE_COALESCING_NOT_SUPPORTED),
+            "Partial blocks are left incomplete, array_name:{}, count:{}",
+            arrayInfo->GetName(), blocks.size());
+    }
+    blocks.clear();
+    pendingBlockCount = 0;
+}
+
+void
+PartialWriteCoalescer::Shutdown(void)
+{
+    Dispose();
+}
+
+void
+PartialWriteCoalescer::Flush(void)
+{
+    // no-op for IMountSequence
+}
+
+bool
+PartialWriteCoalescer::IsEnabled(void)
+{
+    return enabled;
+}
+
+bool
+PartialWriteCoalescer::Claim(uint32_t volumeId, BlkAddr rba)
+{
+    if (0 == pendingBlockCount)
+    {
+        return true;
+    }
+
+    std::lock_guard<std::mutex> lock(blockLock);
+    auto it = blocks.find(BlockKey(volumeId, rba));
+    if (it == blocks.end())
+    {
+        return true;
+    }
+
+    PartialBlock& block = it->second;
+    if (BlockState::Merging == block.state)
+    {
+        return false;
+    }
+    block.state = BlockState::Writing;
+    return true;
+}
+
+void
+PartialWriteCoalescer::Unclaim(uint32_t volumeId, BlkAddr rba)
+{
+    if (0 == pendingBlockCount)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(blockLock);
+    auto it = blocks.find(BlockKey(volumeId, rba));
+    if (it != blocks.end() && BlockState::Writing == it->second.state)
+    {
+        it->second.state = BlockState::Pending;
+    }
+}
+
+PartialWriteResult
+PartialWriteCoalescer::Coalesce(uint32_t volumeId, BlkAddr rba,
+    VirtualBlkAddr oldVsa, StripeAddr oldLsidEntry, VirtualBlkAddr newVsa,
+    uint32_t sectorOffset, uint32_t sectorCount)
+{
+    if (false == enabled)
+    {
+        return PartialWriteResult::NotCoalesced;
+    }
+
+    uint32_t mask = ((1U << sectorCount) - 1) << sectorOffset;
+    BlockKey key(volumeId, rba);
+    {
+        std::lock_guard<std::mutex> lock(blockLock);
+        auto it = blocks.find(key);
+        if (it != blocks.end())
+        {
+            PartialBlock& block = it->second;
+            if (BlockState::Writing == block.state && block.vsa == oldVsa)
+            {
+                // The write copies the valid sectors of the old block
+                // forward as it reads the old block from the write buffer
+                block.prevVsa = block.vsa;
+                block.prevMask = block.validMask;
+                block.vsa = newVsa;
+                block.validMask |= mask;
+                return PartialWriteResult::Inherited;
+            }
+
+            // The block was overwritten since, so this entry only waits for
+            // its stripe to be flushed
+            if (BlockState::Writing == block.state)
+            {
+                block.state = BlockState::Pending;
+            }
+            return PartialWriteResult::NotCoalesced;
+        }
+
+        if (IsUnMapVsa(oldVsa) || IN_USER_AREA != oldLsidEntry.stripeLoc)
+        {
+            return PartialWriteResult::NotCoalesced;
+        }
+
+        PartialBlock block = {
+            .vsa = newVsa,
+            .baseVsa = oldVsa,
+            .validMask = mask,
+            .prevVsa = UNMAP_VSA,
+            .prevMask = 0,
+            .state = BlockState::Writing};
+        blocks.emplace(key, block);
+        pendingBlockCount++;
+    }
+
+    // The caller owns the rba, so nobody else invalidates the base now
+    segmentCtx->ValidateBlks(VirtualBlks{.startVsa = oldVsa, .numBlks = 1});
+    return PartialWriteResult::Deferred;
+}
+
+void
+PartialWriteCoalescer::CompleteWrite(uint32_t volumeId, BlkAddr rba, VirtualBlkAddr vsa, bool success)
+{
+    if (0 == pendingBlockCount)
+    {
+        return;
+    }
+
+    BlockKey key(volumeId, rba);
+    VirtualBlkAddr baseVsa;
+    {
+        std::lock_guard<std::mutex> lock(blockLock);
+        auto it = blocks.find(key);
+        if (it == blocks.end())
+        {
+            return;
+        }
+
+        PartialBlock& block = it->second;
+        if (BlockState::Writing != block.state || false == (block.vsa == vsa))
+        {
+            return;
+        }
+
+        if (success && FULL_MASK != block.validMask)
+        {
+            block.state = BlockState::Pending;
+            return;
+        }
+        if (false == success && false == IsUnMapVsa(block.prevVsa))
+        {
+            // The block map still points to the previous write
+            block.vsa = block.prevVsa;
+            block.validMask = block.prevMask;
+            block.state = BlockState::Pending;
+            return;
+        }
+
+        // Either every sector has been written or the first write failed
+        // and the block map still points to the base
+        baseVsa = block.baseVsa;
+        _Remove(key);
+    }
+    _ReleaseBase(baseVsa);
+}
+
+bool
+PartialWriteCoalescer::TryCompleteBlocks(uint32_t volumeId, BlkAddr startRba, uint32_t blockCount)
+{
+    if (0 == pendingBlockCount)
+    {
+        return true;
+    }
+
+    bool busy = false;
+    std::vector<std::pair<VolumeIoSmartPtr, VirtualBlkAddr>> merges;
+    {
+        std::lock_guard<std::mutex> lock(blockLock);
+        for (uint32_t blockIndex = 0; blockIndex < blockCount; blockIndex++)
+        {
+            auto it = blocks.find(BlockKey(volumeId, startRba + blockIndex));
+            if (it != blocks.end())
+            {
+                busy = true;
+                _StartMerge(it->first, it->second, merges);
+            }
+        }
+    }
+
+    for (auto& merge : merges)
+    {
+        _SubmitMerge(merge.first, merge.second);
+    }
+    return (false == busy);
+}
+
+bool
+PartialWriteCoalescer::TryCompleteStripe(StripeSmartPtr stripe, uint32_t blksPerStripe)
+{
+    if (0 == pendingBlockCount)
+    {
+        return true;
+    }
+
+    bool busy = false;
+    StripeId vsid = stripe->GetVsid();
+    std::vector<std::pair<VolumeIoSmartPtr, VirtualBlkAddr>> merges;
+    {
+        std::lock_guard<std::mutex> lock(blockLock);
+        for (uint32_t offset = 0; offset < blksPerStripe; offset++)
+        {
+            BlkAddr rba;
+            uint32_t volumeId;
+            std::tie(rba, volumeId) = stripe->GetReverseMapEntry(offset);
+            if (INVALID_RBA == rba)
+            {
+                continue;
+            }
+
+            auto it = blocks.find(BlockKey(volumeId, rba));
+            VirtualBlkAddr vsa = {.stripeId = vsid, .offset = offset};
+            if (it != blocks.end() && it->second.vsa == vsa)
+            {
+                busy = true;
+                _StartMerge(it->first, it->second, merges);
+            }
+        }
+    }
+
+    for (auto& merge : merges)
+    {
+        _SubmitMerge(merge.first, merge.second);
+    }
+    return (false == busy);
+}
+
+void
+PartialWriteCoalescer::CompleteMerge(VolumeIoSmartPtr baseIo, bool success)
+{
+    BlockKey key(baseIo->GetVolumeId(), ChangeSectorToBlock(baseIo->GetSectorRba()));
+    VirtualBlkAddr baseVsa;
+    {
+        std::lock_guard<std::mutex> lock(blockLock);
+        auto it = blocks.find(key);
+        if (it == blocks.end() || BlockState::Merging != it->second.state)
+        {
+            return;
+        }
+
+        PartialBlock& block = it->second;
+        char* dst = static_cast<char*>(_GetWriteBufferAddress(block.vsa));
+        if (unlikely(false == success || nullptr == dst))
+        {
+            // Retried at the next read of the block or flush of its stripe
+            POS_TRACE_WARN(EID(PARTIAL_BLOCK_MERGE_FAILED),
+                "volume_id:{}, rba:{}, base_stripe_id:{}, base_offset:{}",
+                key.first, key.second, block.baseVsa.stripeId, block.baseVsa.offset);
+            block.state = BlockState::Pending;
+            return;
+        }
+
+        for (uint32_t sector = 0; sector < SECTORS_PER_BLOCK; sector++)
+        {
+            if (0 == (block.validMask & (1U << sector)))
+            {
+                memcpy(dst + sector * SECTOR_SIZE, baseIo->GetBuffer(0, sector), SECTOR_SIZE);
+            }
+        }
+        baseVsa = block.baseVsa;
+        _Remove(key);
+    }
+    _ReleaseBase(baseVsa);
+}
+
+uint32_t
+PartialWriteCoalescer::GetPendingBlockCount(void)
+{
+    return pendingBlockCount;
+}
+
+void
+PartialWriteCoalescer::_StartMerge(const BlockKey& key, PartialBlock& block,
+    std::vector<std::pair<VolumeIoSmartPtr, VirtualBlkAddr>>& merges)
+{
+    if (BlockState::Pending != block.state)
+    {
+        return;
+    }
+
+    block.state = BlockState::Merging;
+    VolumeIoSmartPtr baseIo(new VolumeIo(nullptr, Ubio::UNITS_PER_BLOCK, arrayInfo->GetIndex()));
+    baseIo->dir = UbioDir::Read;
+    baseIo->SetVolumeId(key.first);
+    baseIo->SetSectorRba(ChangeBlockToSector(key.second));
+    baseIo->SetVsa(block.baseVsa);
+    merges.push_back(std::make_pair(baseIo, block.baseVsa));
+}
+
+void
+PartialWriteCoalescer::_SubmitMerge(VolumeIoSmartPtr baseIo, VirtualBlkAddr baseVsa)
+{
+    StripeAddr lsidEntry = stripeMap->GetLSA(baseVsa.stripeId);
+    LogicalEntry logicalEntry = {
+        .addr = {.stripeId = lsidEntry.stripeId, .offset = baseVsa.offset},
+        .blkCnt = 1};
+    std::list<PhysicalEntry> entries;
+    int ret = translator->Translate(arrayInfo->GetIndex(), USER_DATA, entries, logicalEntry);
+    if (unlikely(ret != EID(SUCCESS) || entries.empty()))
+    {
+        CompleteMerge(baseIo, false);
+        return;
+    }
+
+    baseIo->SetPba(entries.front().addr);
+    CallbackSmartPtr callback(new PartialBlockMergeCompletion(this, baseIo));
+    baseIo->SetCallback(callback);
+    ioDispatcher->Submit(baseIo);
+}
+
+void*
+PartialWriteCoalescer::_GetWriteBufferAddress(VirtualBlkAddr vsa)
+{
+    StripeAddr lsidEntry = stripeMap->GetLSA(vsa.stripeId);
+    if (IN_WRITE_BUFFER_AREA != lsidEntry.stripeLoc)
+    {
+        return nullptr;
+    }
+
+    LogicalEntry logicalEntry = {
+        .addr = {.stripeId = lsidEntry.stripeId, .offset = vsa.offset},
+        .blkCnt = 1};
+    std::list<PhysicalEntry> entries;
+    int ret = translator->Translate(arrayInfo->GetIndex(), WRITE_BUFFER, entries, logicalEntry);
+    if (ret != EID(SUCCESS) || entries.empty() || nullptr == entries.front().addr.arrayDev)
+    {
+        return nullptr;
+    }
+
+    PhysicalBlkAddr& pba = entries.front().addr;
+    char* base = static_cast<char*>(pba.arrayDev->GetUblock()->GetByteAddress());
+    if (nullptr == base)
+    {
+        return nullptr;
+    }
+    return base + pba.lba * SECTOR_SIZE;
+}
+
+void
+PartialWriteCoalescer::_ReleaseBase(VirtualBlkAddr baseVsa)
+{
+    segmentCtx->InvalidateBlks(VirtualBlks{.startVsa = baseVsa, .numBlks = 1}, false);
+}
+
+void
+PartialWriteCoalescer::_Remove(const BlockKey& key)
+{
+    blocks.erase(key);
+    pendingBlockCount--;
+}
+
+} // namespace pos
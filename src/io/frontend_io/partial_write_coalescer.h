@@ -0,0 +1,168 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "src/allocator/i_segment_ctx.h"
+#include "src/array_models/interface/i_array_info.h"
+#include "src/array_models/interface/i_mount_sequence.h"
+#include "src/bio/volume_io.h"
+#include "src/event_scheduler/callback.h"
+#include "src/include/address_type.h"
+#include "src/include/memory.h"
+#include "src/include/smart_ptr_type.h"
+
+namespace pos
+{
+class ConfigManager;
+class IIODispatcher;
+class IIOTranslator;
+class IStripeMap;
+class PartialWriteCoalescer;
+
+enum class PartialWriteResult
+{
+    NotCoalesced,
+    Deferred,
+    Inherited
+};
+
+class PartialBlockMergeCompletion : public Callback
+{
+public:
+    PartialBlockMergeCompletion(PartialWriteCoalescer* coalescer, VolumeIoSmartPtr baseIo);
+    ~PartialBlockMergeCompletion(void) override;
+
+private:
+    bool _DoSpecificJob(void) override;
+
+    PartialWriteCoalescer* coalescer;
+    VolumeIoSmartPtr baseIo;
+};
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Let a write of part of a block skip reading the old block.
+ *           Only the written sectors land in the write buffer, and the block
+ *           keeps a mask of its valid sectors and the VSA of the old block
+ *           (base). A later partial write to the block copies the valid
+ *           sectors forward to its own VSA as the write buffer is cheap to
+ *           read. The base is read only if the block is still incomplete
+ *           when its stripe is flushed or when a host read needs it.
+ *           The base stays validated until then so that GC cannot free it.
+ */
+/* --------------------------------------------------------------------------*/
+class PartialWriteCoalescer : public IMountSequence
+{
+public:
+    explicit PartialWriteCoalescer(IArrayInfo* arrayInfo);
+    PartialWriteCoalescer(IArrayInfo* arrayInfo, ConfigManager* configManager,
+        ISegmentCtx* segmentCtx, IStripeMap* stripeMap, IIOTranslator* translator,
+        IIODispatcher* ioDispatcher);
+    virtual ~PartialWriteCoalescer(void);
+
+    int Init(void) override;
+    void Dispose(void) override;
+    void Shutdown(void) override;
+    void Flush(void) override;
+
+    virtual bool IsEnabled(void);
+    virtual bool Claim(uint32_t volumeId, BlkAddr rba);
+    virtual void Unclaim(uint32_t volumeId, BlkAddr rba);
+    virtual PartialWriteResult Coalesce(uint32_t volumeId, BlkAddr rba,
+        VirtualBlkAddr oldVsa, StripeAddr oldLsidEntry, VirtualBlkAddr newVsa,
+        uint32_t sectorOffset, uint32_t sectorCount);
+    virtual void CompleteWrite(uint32_t volumeId, BlkAddr rba, VirtualBlkAddr vsa, bool success);
+    virtual bool TryCompleteBlocks(uint32_t volumeId, BlkAddr startRba, uint32_t blockCount);
+    virtual bool TryCompleteStripe(StripeSmartPtr stripe, uint32_t blksPerStripe);
+    void CompleteMerge(VolumeIoSmartPtr baseIo, bool success);
+    uint32_t GetPendingBlockCount(void);
+
+    static const uint32_t SECTORS_PER_BLOCK = BLOCK_SIZE / SECTOR_SIZE;
+    static const uint32_t FULL_MASK = (1U << SECTORS_PER_BLOCK) - 1;
+
+private:
+    enum class BlockState
+    {
+        Writing,
+        Pending,
+        Merging
+    };
+
+    struct PartialBlock
+    {
+        VirtualBlkAddr vsa;
+        VirtualBlkAddr baseVsa;
+        uint32_t validMask;
+        VirtualBlkAddr prevVsa;
+        uint32_t prevMask;
+        BlockState state;
+    };
+
+    using BlockKey = std::pair<uint32_t, BlkAddr>;
+    struct BlockKeyHash
+    {
+        size_t
+        operator()(const BlockKey& key) const
+        {
+            return std::hash<uint64_t>()((static_cast<uint64_t>(key.first) << 48) ^ key.second);
+        }
+    };
+
+    void _StartMerge(const BlockKey& key, PartialBlock& block,
+        std::vector<std::pair<VolumeIoSmartPtr, VirtualBlkAddr>>& merges);
+    void _SubmitMerge(VolumeIoSmartPtr baseIo, VirtualBlkAddr baseVsa);
+    void* _GetWriteBufferAddress(VirtualBlkAddr vsa);
+    void _ReleaseBase(VirtualBlkAddr baseVsa);
+    void _Remove(const BlockKey& key);
+
+    IArrayInfo* arrayInfo;
+    ConfigManager* configManager;
+    ISegmentCtx* segmentCtx;
+    IStripeMap* stripeMap;
+    IIOTranslator* translator;
+    IIODispatcher* ioDispatcher;
+    std::atomic<bool> enabled;
+    std::atomic<uint32_t> pendingBlockCount;
+    std::unordered_map<BlockKey, PartialBlock, BlockKeyHash> blocks;
+    std::mutex blockLock;
+};
+
+} // namespace pos
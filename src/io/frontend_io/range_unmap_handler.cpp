@@ -0,0 +1,113 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io/frontend_io/range_unmap_handler.h"
+
+#include "src/include/branch_prediction.h"
+#include "src/io/general_io/rba_state_manager.h"
+#include "src/io/general_io/rba_state_service.h"
+#include "src/meta_service/i_meta_updater.h"
+#include "src/meta_service/meta_service.h"
+
+namespace pos
+{
+RangeUnmapHandler::RangeUnmapHandler(int arrayId, int volId, BlkAddr startRba, uint32_t numBlks,
+    CallbackSmartPtr completion)
+: RangeUnmapHandler(arrayId, volId, startRba, numBlks, completion,
+      RBAStateServiceSingleton::Instance()->GetRBAStateManager(arrayId),
+      MetaServiceSingleton::Instance()->GetMetaUpdater(arrayId))
+{
+}
+
+RangeUnmapHandler::RangeUnmapHandler(int arrayId, int volId, BlkAddr startRba, uint32_t numBlks,
+    CallbackSmartPtr completion, RBAStateManager* rbaStateManager, IMetaUpdater* metaUpdater)
+: Event(false),
+  volId(volId),
+  startRba(startRba),
+  numBlks(numBlks),
+  completion(completion),
+  rbaStateManager(rbaStateManager),
+  metaUpdater(metaUpdater),
+  ownershipAcquired(false)
+{
+}
+
+RangeUnmapHandler::~RangeUnmapHandler(void)
+{
+}
+
+bool
+RangeUnmapHandler::Execute(void)
+{
+    if (ownershipAcquired == false)
+    {
+        ownershipAcquired = rbaStateManager->BulkAcquireOwnership(volId, startRba, numBlks);
+        if (ownershipAcquired == false)
+        {
+            return false;
+        }
+    }
+
+    CallbackSmartPtr rangeUnmapCompletion(
+        new RangeUnmapCompletion(volId, startRba, numBlks, rbaStateManager));
+    rangeUnmapCompletion->SetCallee(completion);
+
+    int result = metaUpdater->UnmapBlockRange(volId, startRba, numBlks, rangeUnmapCompletion);
+    if (unlikely(result != 0))
+    {
+        return false;
+    }
+    return true;
+}
+
+RangeUnmapCompletion::RangeUnmapCompletion(int volId, BlkAddr startRba, uint32_t numBlks,
+    RBAStateManager* rbaStateManager)
+: Callback(false, CallbackType_RangeUnmapCompletion),
+  volId(volId),
+  startRba(startRba),
+  numBlks(numBlks),
+  rbaStateManager(rbaStateManager)
+{
+}
+
+RangeUnmapCompletion::~RangeUnmapCompletion(void)
+{
+}
+
+bool
+RangeUnmapCompletion::_DoSpecificJob(void)
+{
+    rbaStateManager->BulkReleaseOwnership(volId, startRba, numBlks);
+    return true;
+}
+
+} // namespace pos
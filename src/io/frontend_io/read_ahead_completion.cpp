@@ -0,0 +1,76 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io/frontend_io/read_ahead_completion.h"
+
+#include "src/include/branch_prediction.h"
+#include "src/include/memory.h"
+#include "src/io/frontend_io/read_cache.h"
+
+namespace pos
+{
+ReadAheadCompletion::ReadAheadCompletion(ReadCache* readCache, VirtualBlkAddr startVsa,
+    uint32_t numBlks, uint32_t generation, uint32_t numa, void* buffer)
+: Callback(false, CallbackType_ReadAheadCompletion),
+  readCache(readCache),
+  startVsa(startVsa),
+  numBlks(numBlks),
+  generation(generation),
+  numa(numa),
+  buffer(buffer)
+{
+}
+
+ReadAheadCompletion::~ReadAheadCompletion(void)
+{
+    Memory<BLOCK_SIZE>::Free(buffer);
+    readCache->ReadAheadDone();
+}
+
+bool
+ReadAheadCompletion::_DoSpecificJob(void)
+{
+    if (likely(0 == _GetErrorCount() && readCache->IsEnabled()))
+    {
+        char* src = static_cast<char*>(buffer);
+        for (uint32_t index = 0; index < numBlks; index++)
+        {
+            VirtualBlkAddr vsa = {
+                .stripeId = startVsa.stripeId,
+                .offset = startVsa.offset + index};
+            readCache->InsertPrefetched(vsa, generation, src + index * BLOCK_SIZE, numa);
+        }
+    }
+    return true;
+}
+
+} // namespace pos
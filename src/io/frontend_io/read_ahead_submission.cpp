@@ -0,0 +1,139 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io/frontend_io/read_ahead_submission.h"
+
+#include <algorithm>
+#include <list>
+
+#include "src/array/ft/buffer_entry.h"
+#include "src/include/memory.h"
+#include "src/io/frontend_io/read_ahead_completion.h"
+#include "src/io/frontend_io/read_cache.h"
+#include "src/io/general_io/translator.h"
+#include "src/io_submit_interface/i_io_submit_handler.h"
+#include "src/volume/volume_service.h"
+
+namespace pos
+{
+ReadAheadSubmission::ReadAheadSubmission(ReadCache* readCache, ReadAheadRange range,
+    int arrayId, uint32_t numa)
+: ReadAheadSubmission(readCache, range, arrayId, numa, IIOSubmitHandler::GetInstance(),
+      VolumeServiceSingleton::Instance()->GetVolumeManager(arrayId))
+{
+}
+
+ReadAheadSubmission::ReadAheadSubmission(ReadCache* readCache, ReadAheadRange range,
+    int arrayId, uint32_t numa, IIOSubmitHandler* ioSubmitHandler, IVolumeInfoManager* volumeManager)
+: Event(false),
+  readCache(readCache),
+  range(range),
+  arrayId(arrayId),
+  numa(numa),
+  ioSubmitHandler(ioSubmitHandler),
+  volumeManager(volumeManager)
+{
+}
+
+ReadAheadSubmission::~ReadAheadSubmission(void)
+{
+}
+
+bool
+ReadAheadSubmission::Execute(void)
+{
+    uint64_t volumeSize = 0;
+    if (nullptr == volumeManager || 0 != volumeManager->GetVolumeSize(range.volumeId, volumeSize))
+    {
+        return true;
+    }
+
+    BlkAddr endRba = std::min(range.startRba + range.numBlks, volumeSize / BLOCK_SIZE);
+    BlkAddr rba = range.startRba;
+    while (rba < endRba && readCache->IsEnabled())
+    {
+        uint32_t numBlks = std::min((BlkAddr)BLOCKS_PER_TRANSLATION, endRba - rba);
+        try
+        {
+            Translator translator(range.volumeId, rba, numBlks, arrayId);
+            _SubmitExtents(translator, numBlks);
+        }
+        catch (...)
+        {
+            // Read ahead is only a hint, the stream reads the blocks itself
+            break;
+        }
+        rba += numBlks;
+    }
+    return true;
+}
+
+void
+ReadAheadSubmission::_SubmitExtents(Translator& translator, uint32_t numBlks)
+{
+    uint32_t blockIndex = 0;
+    uint32_t extentCount = translator.GetVsaExtentCount();
+    for (uint32_t extentIndex = 0; extentIndex < extentCount && blockIndex < numBlks; extentIndex++)
+    {
+        VirtualBlks extent = translator.GetVsaExtent(extentIndex);
+        uint32_t extentBlks = std::min(extent.numBlks, numBlks - blockIndex);
+        StripeAddr lsidEntry = translator.GetLsidEntry(blockIndex);
+        if (false == IsUnMapVsa(extent.startVsa) && IN_USER_AREA == lsidEntry.stripeLoc)
+        {
+            _Submit(extent.startVsa, lsidEntry.stripeId, extentBlks);
+        }
+        blockIndex += extentBlks;
+    }
+}
+
+void
+ReadAheadSubmission::_Submit(VirtualBlkAddr startVsa, StripeId userLsid, uint32_t numBlks)
+{
+    void* buffer = Memory<BLOCK_SIZE>::AllocFromSocket(numBlks, numa);
+    if (nullptr == buffer)
+    {
+        return;
+    }
+
+    readCache->ReadAheadStarted();
+    CallbackSmartPtr completion(new ReadAheadCompletion(readCache, startVsa, numBlks,
+        readCache->GetGeneration(startVsa), numa, buffer));
+    std::list<BufferEntry> bufferList;
+    bufferList.push_back(BufferEntry(buffer, numBlks));
+    LogicalBlkAddr startLsa = {
+        .stripeId = userLsid,
+        .offset = startVsa.offset};
+    ioSubmitHandler->SubmitAsyncIO(IODirection::READ, bufferList, startLsa, numBlks,
+        PartitionType::USER_DATA, completion, arrayId);
+}
+
+} // namespace pos
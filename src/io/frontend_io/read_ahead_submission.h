@@ -0,0 +1,75 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "src/event_scheduler/event.h"
+#include "src/include/address_type.h"
+#include "src/io/frontend_io/read_stream_detector.h"
+
+namespace pos
+{
+class IIOSubmitHandler;
+class IVolumeInfoManager;
+class ReadCache;
+class Translator;
+
+// Reads a window of blocks ahead of a sequential stream into the read cache.
+// Only the blocks already flushed to the user area are read; the blocks still
+// in a write buffer stripe and the unmapped ones are skipped.
+class ReadAheadSubmission : public Event
+{
+public:
+    ReadAheadSubmission(ReadCache* readCache, ReadAheadRange range, int arrayId, uint32_t numa);
+    ReadAheadSubmission(ReadCache* readCache, ReadAheadRange range, int arrayId, uint32_t numa,
+        IIOSubmitHandler* ioSubmitHandler, IVolumeInfoManager* volumeManager);
+    ~ReadAheadSubmission(void) override;
+    bool Execute(void) override;
+
+private:
+    void _SubmitExtents(Translator& translator, uint32_t numBlks);
+    void _Submit(VirtualBlkAddr startVsa, StripeId userLsid, uint32_t numBlks);
+
+    // A translator covers up to MAX_PROCESSABLE_BLOCK_COUNT blocks
+    static const uint32_t BLOCKS_PER_TRANSLATION = 32;
+
+    ReadCache* readCache;
+    ReadAheadRange range;
+    int arrayId;
+    uint32_t numa;
+    IIOSubmitHandler* ioSubmitHandler;
+    IVolumeInfoManager* volumeManager;
+};
+
+} // namespace pos
@@ -0,0 +1,354 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io/frontend_io/read_cache.h"
+
+#include "src/cpu_affinity/affinity_manager.h"
+#include "src/event_scheduler/event_scheduler.h"
+#include "src/include/memory.h"
+#include "src/include/pos_event_id.h"
+#include "src/io/frontend_io/read_ahead_submission.h"
+#include "src/io/frontend_io/read_cache_service.h"
+#include "src/io/frontend_io/read_stream_detector.h"
+#include "src/logger/logger.h"
+#include "src/master_context/config_manager.h"
+#include "src/resource_manager/buffer_pool.h"
+#include "src/resource_manager/memory_manager.h"
+
+namespace pos
+{
+ReadCache::ReadCache(IArrayInfo* arrayInfo)
+: ReadCache(arrayInfo, ConfigManagerSingleton::Instance(),
+      MemoryManagerSingleton::Instance(), AffinityManagerSingleton::Instance())
+{
+}
+
+ReadCache::ReadCache(IArrayInfo* arrayInfo, ConfigManager* configManager,
+    MemoryManager* memoryManager, AffinityManager* affinityManager)
+: arrayInfo(arrayInfo),
+  configManager(configManager),
+  memoryManager(memoryManager),
+  affinityManager(affinityManager),
+  enabled(false),
+  pendingReadAhead(0)
+{
+}
+
+ReadCache::~ReadCache(void)
+{
+    Dispose();
+}
+
+int
+ReadCache::Init(void)
+{
+    _LoadConfig();
+    if (0 == sizeInMb || true == enabled)
+    {
+        return EID(SUCCESS);
+    }
+
+    const PartitionLogicalSize* udSize = arrayInfo->GetSizeInfo(PartitionType::USER_DATA);
+    stripesPerSegment = udSize->stripesPerSegment;
+    totalSegments = udSize->totalSegments;
+    numaCount = affinityManager->GetNumaCount();
+    if (0 == numaCount)
+    {
+        numaCount = 1;
+    }
+
+    uint64_t framesPerNuma = sizeInMb * SZ_1MB / BLOCK_SIZE / numaCount;
+    if (framesPerNuma < SHARDS_PER_NUMA || false == _CreateShards(framesPerNuma))
+    {
+        POS_TRACE_WARN(EID(READ_CACHE_BUFFER_ALLOCATION_FAILED),
+            "Read cache runs disabled, array_name:{}, size_in_mb:{}",
+            arrayInfo->GetName(), sizeInMb);
+        _DeleteShards();
+        return EID(SUCCESS);
+    }
+
+    segmentGenerations = new std::atomic<uint32_t>[totalSegments]();
+    if (readAheadEnabled)
+    {
+        streamDetector = new ReadStreamDetector(READ_AHEAD_MIN_WINDOW_BLKS, READ_AHEAD_MAX_WINDOW_BLKS);
+    }
+    enabled = true;
+    ReadCacheServiceSingleton::Instance()->Register(arrayInfo->GetIndex(), this);
+
+    POS_TRACE_INFO(EID(READ_CACHE_ENABLED),
+        "Read cache is enabled, array_name:{}, size_in_mb:{}, numa_count:{}, admission:{}, read_ahead:{}",
+        arrayInfo->GetName(), sizeInMb, numaCount,
+        (admission == ReadCacheAdmission::TinyLfu) ? "tinylfu" : "lru", readAheadEnabled);
+    return EID(SUCCESS);
+}
+
+void
+ReadCache::Dispose(void)
+{
+    if (false == enabled)
+    {
+        return;
+    }
+
+    enabled = false;
+    ReadCacheServiceSingleton::Instance()->Unregister(arrayInfo->GetIndex());
+    if (nullptr != streamDetector)
+    {
+        delete streamDetector;
+        streamDetector = nullptr;
+    }
+    _DeleteShards();
+    delete[] segmentGenerations;
+    segmentGenerations = nullptr;
+}
+
+void
+ReadCache::Shutdown(void)
+{
+    Dispose();
+}
+
+void
+ReadCache::Flush(void)
+{
+    // no-op for IMountSequence
+}
+
+bool
+ReadCache::IsEnabled(void)
+{
+    return enabled;
+}
+
+uint32_t
+ReadCache::GetGeneration(const VirtualBlkAddr& vsa)
+{
+    SegmentId segmentId = vsa.stripeId / stripesPerSegment;
+    if (segmentId >= totalSegments)
+    {
+        return 0;
+    }
+    return segmentGenerations[segmentId].load(std::memory_order_acquire);
+}
+
+bool
+ReadCache::Lookup(const VirtualBlkAddr& vsa, void* dst)
+{
+    uint64_t key = _GetKey(vsa);
+    uint32_t numa = affinityManager->GetNumaIdFromCurrentThread() % numaCount;
+    return shards[_GetShardIndex(numa, key)]->Lookup(key, GetGeneration(vsa), dst);
+}
+
+void
+ReadCache::Insert(const VirtualBlkAddr& vsa, uint32_t generation, const void* src)
+{
+    uint64_t key = _GetKey(vsa);
+    uint32_t numa = affinityManager->GetNumaIdFromCurrentThread() % numaCount;
+    shards[_GetShardIndex(numa, key)]->Insert(key, generation, src);
+}
+
+void
+ReadCache::Invalidate(const VirtualBlkAddr& vsa)
+{
+    // Any node may have its own copy of the block
+    uint64_t key = _GetKey(vsa);
+    for (uint32_t numa = 0; numa < numaCount; numa++)
+    {
+        shards[_GetShardIndex(numa, key)]->Invalidate(key);
+    }
+}
+
+void
+ReadCache::InvalidateSegment(SegmentId segmentId)
+{
+    // Entries of the old generation are dropped lazily on lookup or evicted
+    if (segmentId < totalSegments)
+    {
+        segmentGenerations[segmentId].fetch_add(1, std::memory_order_acq_rel);
+    }
+}
+
+ReadCacheStats
+ReadCache::GetStats(void)
+{
+    ReadCacheStats total;
+    for (auto shard : shards)
+    {
+        ReadCacheStats stats = shard->GetStats();
+        total.hit += stats.hit;
+        total.miss += stats.miss;
+        total.insert += stats.insert;
+        total.reject += stats.reject;
+        total.evict += stats.evict;
+        total.invalidate += stats.invalidate;
+        total.prefetch += stats.prefetch;
+        total.prefetchHit += stats.prefetchHit;
+    }
+    return total;
+}
+
+void
+ReadCache::RecordRead(uint32_t volumeId, BlkAddr rba, bool hit)
+{
+    if (nullptr == streamDetector)
+    {
+        return;
+    }
+
+    ReadAheadRange range;
+    if (false == streamDetector->Record(volumeId, rba, hit, range))
+    {
+        return;
+    }
+    if (pendingReadAhead.load(std::memory_order_relaxed) >= MAX_PENDING_READ_AHEAD)
+    {
+        // The stream misses the window it skips, which shrinks the next one
+        return;
+    }
+
+    uint32_t numa = affinityManager->GetNumaIdFromCurrentThread() % numaCount;
+    EventSmartPtr readAhead(new ReadAheadSubmission(this, range, arrayInfo->GetIndex(), numa));
+    EventSchedulerSingleton::Instance()->EnqueueEvent(readAhead);
+}
+
+// The stream is read on the node it was detected on, so the blocks go there
+void
+ReadCache::InsertPrefetched(const VirtualBlkAddr& vsa, uint32_t generation, const void* src, uint32_t numa)
+{
+    uint64_t key = _GetKey(vsa);
+    shards[_GetShardIndex(numa % numaCount, key)]->Insert(key, generation, src, true);
+}
+
+void
+ReadCache::ReadAheadStarted(void)
+{
+    pendingReadAhead.fetch_add(1, std::memory_order_relaxed);
+}
+
+void
+ReadCache::ReadAheadDone(void)
+{
+    pendingReadAhead.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void
+ReadCache::_LoadConfig(void)
+{
+    uint64_t size = 0;
+    int ret = configManager->GetValue("performance", "read_cache_size_in_mb",
+        &size, CONFIG_TYPE_UINT64);
+    sizeInMb = (ret == EID(SUCCESS)) ? size : 0;
+
+    std::string policy;
+    ret = configManager->GetValue("performance", "read_cache_admission",
+        &policy, CONFIG_TYPE_STRING);
+    admission = (ret == EID(SUCCESS) && policy == "lru") ?
+        ReadCacheAdmission::Lru : ReadCacheAdmission::TinyLfu;
+
+    bool readAhead = false;
+    ret = configManager->GetValue("performance", "read_ahead_enable",
+        &readAhead, CONFIG_TYPE_BOOL);
+    readAheadEnabled = (ret == EID(SUCCESS)) && readAhead;
+}
+
+bool
+ReadCache::_CreateShards(uint64_t framesPerNuma)
+{
+    uint64_t framesPerShard = framesPerNuma / SHARDS_PER_NUMA;
+    bool tinyLfuEnabled = (admission == ReadCacheAdmission::TinyLfu);
+
+    // The frames of each node are populated in parallel
+    std::vector<BufferInfo> infos;
+    for (uint32_t numa = 0; numa < numaCount; numa++)
+    {
+        BufferInfo info = {
+            .owner = "ReadCache_" + arrayInfo->GetName(),
+            .size = BLOCK_SIZE,
+            .count = framesPerShard * SHARDS_PER_NUMA};
+        infos.push_back(info);
+    }
+    bufferPools = memoryManager->CreateBufferPoolsPerNuma(infos);
+    if (bufferPools.size() != numaCount)
+    {
+        return false;
+    }
+
+    for (BufferPool* pool : bufferPools)
+    {
+        for (uint32_t shardIndex = 0; shardIndex < SHARDS_PER_NUMA; shardIndex++)
+        {
+            std::vector<void*> frames;
+            if (false == pool->TryGetBuffers(framesPerShard, &frames, framesPerShard))
+            {
+                return false;
+            }
+            shards.push_back(new ReadCacheShard(frames, tinyLfuEnabled));
+        }
+    }
+    return true;
+}
+
+void
+ReadCache::_DeleteShards(void)
+{
+    size_t shardIndex = 0;
+    for (auto shard : shards)
+    {
+        std::vector<void*> frames = shard->ReleaseFrames();
+        bufferPools[shardIndex / SHARDS_PER_NUMA]->ReturnBuffers(&frames);
+        delete shard;
+        shardIndex++;
+    }
+    shards.clear();
+
+    for (auto pool : bufferPools)
+    {
+        memoryManager->DeleteBufferPool(pool);
+    }
+    bufferPools.clear();
+}
+
+uint32_t
+ReadCache::_GetShardIndex(uint32_t numa, uint64_t key)
+{
+    // Consecutive blocks of a stripe spread over the shards of the node
+    uint64_t hash = (key ^ (key >> 32)) * 0x9E3779B97F4A7C15ULL;
+    return numa * SHARDS_PER_NUMA + static_cast<uint32_t>(hash >> 60) % SHARDS_PER_NUMA;
+}
+
+uint64_t
+ReadCache::_GetKey(const VirtualBlkAddr& vsa)
+{
+    return (static_cast<uint64_t>(vsa.stripeId) << 32) | static_cast<uint32_t>(vsa.offset);
+}
+
+} // namespace pos
@@ -0,0 +1,123 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "src/array_models/interface/i_array_info.h"
+#include "src/array_models/interface/i_mount_sequence.h"
+#include "src/include/address_type.h"
+#include "src/io/frontend_io/read_cache_shard.h"
+
+namespace pos
+{
+class AffinityManager;
+class BufferPool;
+class ConfigManager;
+class MemoryManager;
+class ReadStreamDetector;
+
+enum class ReadCacheAdmission
+{
+    Lru,
+    TinyLfu
+};
+
+// DRAM cache of user data blocks of an array, keyed by VSA. Every NUMA node
+// keeps its own set of shards so that a hit is copied from local memory.
+// A block is cached only after it was read from the user area, and an
+// entry is dropped when GC moves the block or its segment is freed.
+// With read ahead enabled, the single block reads of a volume are tracked
+// for sequential streams, and the blocks ahead of a stream are read into the
+// cache in the background.
+class ReadCache : public IMountSequence
+{
+public:
+    explicit ReadCache(IArrayInfo* arrayInfo);
+    ReadCache(IArrayInfo* arrayInfo, ConfigManager* configManager,
+        MemoryManager* memoryManager, AffinityManager* affinityManager);
+    virtual ~ReadCache(void);
+
+    int Init(void) override;
+    void Dispose(void) override;
+    void Shutdown(void) override;
+    void Flush(void) override;
+
+    virtual bool IsEnabled(void);
+    virtual uint32_t GetGeneration(const VirtualBlkAddr& vsa);
+    virtual bool Lookup(const VirtualBlkAddr& vsa, void* dst);
+    virtual void Insert(const VirtualBlkAddr& vsa, uint32_t generation, const void* src);
+    virtual void Invalidate(const VirtualBlkAddr& vsa);
+    virtual void InvalidateSegment(SegmentId segmentId);
+    virtual ReadCacheStats GetStats(void);
+
+    virtual void RecordRead(uint32_t volumeId, BlkAddr rba, bool hit);
+    virtual void InsertPrefetched(const VirtualBlkAddr& vsa, uint32_t generation, const void* src, uint32_t numa);
+    virtual void ReadAheadStarted(void);
+    virtual void ReadAheadDone(void);
+
+    static const uint32_t SHARDS_PER_NUMA = 16;
+    static const uint32_t READ_AHEAD_MIN_WINDOW_BLKS = 32;
+    static const uint32_t READ_AHEAD_MAX_WINDOW_BLKS = 256;
+    static const uint32_t MAX_PENDING_READ_AHEAD = 64;
+
+private:
+    void _LoadConfig(void);
+    bool _CreateShards(uint64_t framesPerNuma);
+    void _DeleteShards(void);
+    uint32_t _GetShardIndex(uint32_t numa, uint64_t key);
+    static uint64_t _GetKey(const VirtualBlkAddr& vsa);
+
+    IArrayInfo* arrayInfo;
+    ConfigManager* configManager;
+    MemoryManager* memoryManager;
+    AffinityManager* affinityManager;
+
+    uint64_t sizeInMb = 0;
+    ReadCacheAdmission admission = ReadCacheAdmission::TinyLfu;
+    bool readAheadEnabled = false;
+    uint32_t numaCount = 0;
+    uint32_t stripesPerSegment = 0;
+    uint32_t totalSegments = 0;
+    std::atomic<bool> enabled;
+    std::atomic<uint32_t>* segmentGenerations = nullptr;
+    std::vector<BufferPool*> bufferPools;
+    std::vector<ReadCacheShard*> shards;
+    ReadStreamDetector* streamDetector = nullptr;
+    std::atomic<uint32_t> pendingReadAhead;
+};
+
+} // namespace pos
@@ -0,0 +1,317 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io/frontend_io/read_cache_shard.h"
+
+#include <string.h>
+
+#include "src/include/memory.h"
+
+namespace pos
+{
+ReadCacheFrequencySketch::ReadCacheFrequencySketch(uint32_t capacity)
+{
+    uint32_t width = 16;
+    while (width < capacity)
+    {
+        width <<= 1;
+    }
+    widthMask = width - 1;
+    sampleSize = static_cast<uint64_t>(width) * 10;
+    for (uint32_t row = 0; row < DEPTH; row++)
+    {
+        counters[row].resize(width, 0);
+    }
+}
+
+void
+ReadCacheFrequencySketch::Record(uint64_t key)
+{
+    for (uint32_t row = 0; row < DEPTH; row++)
+    {
+        uint8_t& counter = counters[row][_GetIndex(key, row)];
+        if (counter < MAX_COUNT)
+        {
+            counter++;
+        }
+    }
+
+    recordCount++;
+    if (recordCount >= sampleSize)
+    {
+        _Age();
+    }
+}
+
+uint32_t
+ReadCacheFrequencySketch::Estimate(uint64_t key)
+{
+    uint32_t estimate = MAX_COUNT;
+    for (uint32_t row = 0; row < DEPTH; row++)
+    {
+        uint32_t count = counters[row][_GetIndex(key, row)];
+        if (count < estimate)
+        {
+            estimate = count;
+        }
+    }
+    return estimate;
+}
+
+uint32_t
+ReadCacheFrequencySketch::_GetIndex(uint64_t key, uint32_t row)
+{
+    // splitmix64 finalizer, seeded differently for each row
+    uint64_t hash = key + (row + 1) * 0x9E3779B97F4A7C15ULL;
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+    hash = hash ^ (hash >> 31);
+    return static_cast<uint32_t>(hash) & widthMask;
+}
+
+void
+ReadCacheFrequencySketch::_Age(void)
+{
+    for (uint32_t row = 0; row < DEPTH; row++)
+    {
+        for (auto& counter : counters[row])
+        {
+            counter >>= 1;
+        }
+    }
+    recordCount = 0;
+}
+
+ReadCacheShard::ReadCacheShard(std::vector<void*> frames, bool tinyLfuEnabled)
+: freeFrames(frames),
+  totalFrames(frames.size()),
+  protectedCapacity(frames.size() * PROTECTED_PERCENT / 100),
+  tinyLfuEnabled(tinyLfuEnabled),
+  sketch(tinyLfuEnabled ? frames.size() : 0)
+{
+    index.reserve(totalFrames);
+}
+
+ReadCacheShard::~ReadCacheShard(void)
+{
+}
+
+bool
+ReadCacheShard::Lookup(uint64_t key, uint32_t generation, void* dst)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    if (tinyLfuEnabled)
+    {
+        sketch.Record(key);
+    }
+
+    auto it = index.find(key);
+    if (it == index.end())
+    {
+        stats.miss++;
+        return false;
+    }
+
+    EntryList::iterator entry = it->second;
+    if (entry->generation != generation)
+    {
+        // The segment was freed and reused since this block was cached
+        _Erase(entry);
+        stats.invalidate++;
+        stats.miss++;
+        return false;
+    }
+
+    memcpy(dst, entry->frame, BLOCK_SIZE);
+    if (entry->prefetched)
+    {
+        entry->prefetched = false;
+        probation.splice(probation.begin(), probation, entry);
+        stats.prefetchHit++;
+    }
+    else
+    {
+        _Promote(entry);
+    }
+    stats.hit++;
+    return true;
+}
+
+void
+ReadCacheShard::Insert(uint64_t key, uint32_t generation, const void* src, bool prefetched)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    if (0 == totalFrames)
+    {
+        return;
+    }
+
+    auto it = index.find(key);
+    if (it != index.end())
+    {
+        EntryList::iterator entry = it->second;
+        if (entry->generation != generation)
+        {
+            memcpy(entry->frame, src, BLOCK_SIZE);
+            entry->generation = generation;
+        }
+        return;
+    }
+
+    void* frame = nullptr;
+    if (false == freeFrames.empty())
+    {
+        frame = freeFrames.back();
+        freeFrames.pop_back();
+    }
+    else
+    {
+        if (tinyLfuEnabled && false == prefetched && false == _Admit(key))
+        {
+            stats.reject++;
+            return;
+        }
+        frame = _Evict();
+    }
+
+    memcpy(frame, src, BLOCK_SIZE);
+    probation.push_front(Entry{key, generation, false, prefetched, frame});
+    index.emplace(key, probation.begin());
+    stats.insert++;
+    if (prefetched)
+    {
+        stats.prefetch++;
+    }
+}
+
+void
+ReadCacheShard::Invalidate(uint64_t key)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    auto it = index.find(key);
+    if (it != index.end())
+    {
+        _Erase(it->second);
+        stats.invalidate++;
+    }
+}
+
+void
+ReadCacheShard::Clear(void)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    for (auto& entry : probation)
+    {
+        freeFrames.push_back(entry.frame);
+    }
+    for (auto& entry : protectedList)
+    {
+        freeFrames.push_back(entry.frame);
+    }
+    probation.clear();
+    protectedList.clear();
+    index.clear();
+}
+
+ReadCacheStats
+ReadCacheShard::GetStats(void)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return stats;
+}
+
+std::vector<void*>
+ReadCacheShard::ReleaseFrames(void)
+{
+    Clear();
+    std::lock_guard<std::mutex> guard(lock);
+    std::vector<void*> frames;
+    frames.swap(freeFrames);
+    totalFrames = 0;
+    protectedCapacity = 0;
+    return frames;
+}
+
+void
+ReadCacheShard::_Promote(EntryList::iterator entry)
+{
+    if (entry->isProtected)
+    {
+        protectedList.splice(protectedList.begin(), protectedList, entry);
+        return;
+    }
+
+    entry->isProtected = true;
+    protectedList.splice(protectedList.begin(), probation, entry);
+    while (protectedList.size() > protectedCapacity)
+    {
+        EntryList::iterator demoted = std::prev(protectedList.end());
+        demoted->isProtected = false;
+        probation.splice(probation.begin(), protectedList, demoted);
+    }
+}
+
+bool
+ReadCacheShard::_Admit(uint64_t key)
+{
+    const Entry& victim = probation.empty() ? protectedList.back() : probation.back();
+    return sketch.Estimate(key) > sketch.Estimate(victim.key);
+}
+
+void*
+ReadCacheShard::_Evict(void)
+{
+    EntryList& victimList = probation.empty() ? protectedList : probation;
+    Entry& victim = victimList.back();
+    void* frame = victim.frame;
+    index.erase(victim.key);
+    victimList.pop_back();
+    stats.evict++;
+    return frame;
+}
+
+void
+ReadCacheShard::_Erase(EntryList::iterator entry)
+{
+    freeFrames.push_back(entry->frame);
+    index.erase(entry->key);
+    if (entry->isProtected)
+    {
+        protectedList.erase(entry);
+    }
+    else
+    {
+        probation.erase(entry);
+    }
+}
+
+} // namespace pos
@@ -0,0 +1,128 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace pos
+{
+struct ReadCacheStats
+{
+    uint64_t hit = 0;
+    uint64_t miss = 0;
+    uint64_t insert = 0;
+    uint64_t reject = 0;
+    uint64_t evict = 0;
+    uint64_t invalidate = 0;
+    uint64_t prefetch = 0;
+    uint64_t prefetchHit = 0;
+};
+
+// Approximate access frequency of keys for TinyLFU admission. Counters are
+// 4-bit wide in spirit (saturate at MAX_COUNT) and are halved every
+// sampleSize records so that the sketch follows a changing working set.
+class ReadCacheFrequencySketch
+{
+public:
+    explicit ReadCacheFrequencySketch(uint32_t capacity);
+    void Record(uint64_t key);
+    uint32_t Estimate(uint64_t key);
+
+    static const uint32_t DEPTH = 4;
+    static const uint8_t MAX_COUNT = 15;
+
+private:
+    uint32_t _GetIndex(uint64_t key, uint32_t row);
+    void _Age(void);
+
+    std::vector<uint8_t> counters[DEPTH];
+    uint32_t widthMask;
+    uint64_t sampleSize;
+    uint64_t recordCount = 0;
+};
+
+// A segmented LRU over a fixed set of block-sized frames. New blocks enter
+// the probation segment and move to the protected segment when they are hit
+// again, so a scan of cold blocks cannot wash out the blocks read repeatedly.
+// Each entry carries the generation of its segment at fill time, and a
+// lookup with a newer generation drops the entry. A block read ahead skips
+// the admission, and its first hit only moves it to the front of probation,
+// so a sequential scan stays out of the protected segment.
+class ReadCacheShard
+{
+public:
+    ReadCacheShard(std::vector<void*> frames, bool tinyLfuEnabled);
+    virtual ~ReadCacheShard(void);
+    virtual bool Lookup(uint64_t key, uint32_t generation, void* dst);
+    virtual void Insert(uint64_t key, uint32_t generation, const void* src, bool prefetched = false);
+    virtual void Invalidate(uint64_t key);
+    virtual void Clear(void);
+    virtual ReadCacheStats GetStats(void);
+    std::vector<void*> ReleaseFrames(void);
+
+    static const uint32_t PROTECTED_PERCENT = 80;
+
+private:
+    struct Entry
+    {
+        uint64_t key;
+        uint32_t generation;
+        bool isProtected;
+        bool prefetched;
+        void* frame;
+    };
+    using EntryList = std::list<Entry>;
+
+    void _Promote(EntryList::iterator entry);
+    bool _Admit(uint64_t key);
+    void* _Evict(void);
+    void _Erase(EntryList::iterator entry);
+
+    std::vector<void*> freeFrames;
+    EntryList probation;
+    EntryList protectedList;
+    std::unordered_map<uint64_t, EntryList::iterator> index;
+    size_t totalFrames;
+    size_t protectedCapacity;
+    bool tinyLfuEnabled;
+    ReadCacheFrequencySketch sketch;
+    ReadCacheStats stats;
+    std::mutex lock;
+};
+
+} // namespace pos
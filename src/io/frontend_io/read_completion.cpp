@@ -42,36 +42,40 @@
 
 namespace pos
 {
-ReadCompletion::ReadCompletion(VolumeIoSmartPtr input)
-: ReadCompletion(input, AllocatorServiceSingleton::Instance())
+ReadCompletionStage::ReadCompletionStage(void)
+: ReadCompletionStage(AllocatorServiceSingleton::Instance())
 {
 }
 
-ReadCompletion::ReadCompletion(VolumeIoSmartPtr input, AllocatorService* allocatorService)
-: Callback(true, CallbackType_ReadCompletion),
-  volumeIo(input),
+ReadCompletionStage::ReadCompletionStage(AllocatorService* allocatorService)
+: volumeIo(nullptr),
   allocatorService(allocatorService)
 {
 }
 
-ReadCompletion::~ReadCompletion()
+void
+ReadCompletionStage::Arm(VolumeIoSmartPtr input)
 {
+    volumeIo = input;
 }
 
 bool
-ReadCompletion::_DoSpecificJob(void)
+ReadCompletionStage::IsArmed(void)
 {
-    try
+    return (nullptr != volumeIo);
+}
+
+void
+ReadCompletionStage::Run(Callback& host, uint32_t errorCount)
+{
+    if (nullptr == volumeIo)
     {
-        if (unlikely(nullptr == volumeIo))
-        {
-            POS_EVENT_ID eventId = EID(RDCMP_INVALID_UBIO);
-            POS_TRACE_ERROR(static_cast<int>(eventId),
-                "Ubio is null at ReadCompleteHandler");
-            throw eventId;
-        }
+        return;
+    }
 
-        if (unlikely(_GetErrorCount()))
+    try
+    {
+        if (unlikely(errorCount))
         {
             // After rebuild, if error is still left,
             // we need to just leave the error.
@@ -97,8 +101,38 @@ ReadCompletion::_DoSpecificJob(void)
     {
     }
     volumeIo = nullptr;
-    airlog("CompleteUserRead", "user", GetEventType(), 1);
+    airlog("CompleteUserRead", "user", host.GetEventType(), 1);
+}
+
+ReadCompletion::ReadCompletion(VolumeIoSmartPtr input)
+: ReadCompletion(input, AllocatorServiceSingleton::Instance())
+{
+}
+
+ReadCompletion::ReadCompletion(VolumeIoSmartPtr input, AllocatorService* allocatorService)
+: Callback(true, CallbackType_ReadCompletion),
+  stage(allocatorService)
+{
+    stage.Arm(input);
+}
+
+ReadCompletion::~ReadCompletion()
+{
+}
+
+bool
+ReadCompletion::_DoSpecificJob(void)
+{
+    if (unlikely(false == stage.IsArmed()))
+    {
+        POS_EVENT_ID eventId = EID(RDCMP_INVALID_UBIO);
+        POS_TRACE_ERROR(static_cast<int>(eventId),
+            "Ubio is null at ReadCompleteHandler");
+        airlog("CompleteUserRead", "user", GetEventType(), 1);
+        return true;
+    }
 
+    stage.Run(*this, _GetErrorCount());
     return true;
 }
 
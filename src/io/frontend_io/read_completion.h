@@ -41,6 +41,23 @@ namespace pos
 {
 class VolumeIo;
 
+// Releases the reference a read took on its write buffer stripe.
+// Runs inline as a stage of ComposedCallback, or inside ReadCompletion
+// when the stage cannot be fused with the completion of the user IO.
+class ReadCompletionStage
+{
+public:
+    ReadCompletionStage(void);
+    explicit ReadCompletionStage(AllocatorService* allocatorService);
+    void Arm(VolumeIoSmartPtr input);
+    bool IsArmed(void);
+    void Run(Callback& host, uint32_t errorCount);
+
+private:
+    VolumeIoSmartPtr volumeIo;
+    AllocatorService* allocatorService;
+};
+
 class ReadCompletion : public Callback
 {
 public:
@@ -51,7 +68,6 @@ public:
 private:
     bool _DoSpecificJob(void) override;
 
-    VolumeIoSmartPtr volumeIo;
-    AllocatorService* allocatorService;
+    ReadCompletionStage stage;
 };
 } // namespace pos
@@ -0,0 +1,149 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io/frontend_io/read_stream_detector.h"
+
+#include <algorithm>
+
+namespace pos
+{
+ReadStreamDetector::ReadStreamDetector(uint32_t minWindowBlks, uint32_t maxWindowBlks)
+: minWindowBlks(std::max(minWindowBlks, (uint32_t)1)),
+  maxWindowBlks(std::max(minWindowBlks, maxWindowBlks))
+{
+}
+
+bool
+ReadStreamDetector::Record(uint32_t volumeId, BlkAddr rba, bool hit, ReadAheadRange& range)
+{
+    if (volumeId >= MAX_VOLUME_COUNT)
+    {
+        return false;
+    }
+
+    VolumeStreams& volume = volumes[volumeId];
+    std::lock_guard<std::mutex> guard(volume.lock);
+    Stream* stream = _Find(volume, rba);
+    if (nullptr == stream)
+    {
+        stream = _Replace(volume);
+        *stream = Stream();
+        stream->nextRba = rba + 1;
+        stream->runLength = 1;
+        stream->window = minWindowBlks;
+        stream->lastUsed = ++volume.clock;
+        return false;
+    }
+
+    stream->nextRba = rba + 1;
+    stream->runLength++;
+    stream->lastUsed = ++volume.clock;
+    if (rba < stream->readAheadEnd)
+    {
+        hit ? stream->hit++ : stream->miss++;
+    }
+
+    if (stream->runLength < SEQUENTIAL_THRESHOLD)
+    {
+        return false;
+    }
+    if (stream->readAheadEnd > stream->nextRba + stream->window / 2)
+    {
+        return false;
+    }
+
+    _Resize(*stream);
+    BlkAddr start = std::max(stream->nextRba, stream->readAheadEnd);
+    BlkAddr end = stream->nextRba + stream->window;
+    if (end <= start)
+    {
+        return false;
+    }
+
+    range.volumeId = volumeId;
+    range.startRba = start;
+    range.numBlks = end - start;
+    stream->readAheadEnd = end;
+    return true;
+}
+
+ReadStreamDetector::Stream*
+ReadStreamDetector::_Find(VolumeStreams& volume, BlkAddr rba)
+{
+    for (Stream& stream : volume.table)
+    {
+        if (stream.runLength > 0 && stream.nextRba == rba)
+        {
+            return &stream;
+        }
+    }
+    return nullptr;
+}
+
+ReadStreamDetector::Stream*
+ReadStreamDetector::_Replace(VolumeStreams& volume)
+{
+    Stream* victim = &volume.table[0];
+    for (Stream& stream : volume.table)
+    {
+        if (stream.lastUsed < victim->lastUsed)
+        {
+            victim = &stream;
+        }
+    }
+    return victim;
+}
+
+// The hit rate of the blocks read ahead since the last window decides the next one
+void
+ReadStreamDetector::_Resize(Stream& stream)
+{
+    uint32_t total = stream.hit + stream.miss;
+    if (0 == total)
+    {
+        return;
+    }
+
+    uint32_t hitPercent = stream.hit * 100 / total;
+    if (hitPercent >= GROW_HIT_PERCENT)
+    {
+        stream.window = std::min(stream.window * 2, maxWindowBlks);
+    }
+    else if (hitPercent < SHRINK_HIT_PERCENT)
+    {
+        stream.window = std::max(stream.window / 2, minWindowBlks);
+    }
+    stream.hit = 0;
+    stream.miss = 0;
+}
+
+} // namespace pos
@@ -0,0 +1,96 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+
+#include "src/include/address_type.h"
+#include "src/volume/volume_base.h"
+
+namespace pos
+{
+struct ReadAheadRange
+{
+    uint32_t volumeId;
+    BlkAddr startRba;
+    uint32_t numBlks;
+};
+
+// Recognises sequential read streams from the tails of the recent reads of
+// each volume. Once a stream has read SEQUENTIAL_THRESHOLD blocks in a row,
+// the blocks ahead of it are read in windows, and the next window is asked
+// for when less than half of the current one is left. The window doubles while
+// the stream hits the blocks read ahead and halves when it misses them.
+class ReadStreamDetector
+{
+public:
+    ReadStreamDetector(uint32_t minWindowBlks, uint32_t maxWindowBlks);
+    virtual ~ReadStreamDetector(void) = default;
+
+    virtual bool Record(uint32_t volumeId, BlkAddr rba, bool hit, ReadAheadRange& range);
+
+    static const uint32_t STREAMS_PER_VOLUME = 4;
+    static const uint32_t SEQUENTIAL_THRESHOLD = 4;
+    static const uint32_t GROW_HIT_PERCENT = 90;
+    static const uint32_t SHRINK_HIT_PERCENT = 50;
+
+private:
+    struct Stream
+    {
+        BlkAddr nextRba = 0;
+        BlkAddr readAheadEnd = 0;
+        uint32_t runLength = 0;
+        uint32_t window = 0;
+        uint32_t hit = 0;
+        uint32_t miss = 0;
+        uint64_t lastUsed = 0;
+    };
+    struct VolumeStreams
+    {
+        std::array<Stream, STREAMS_PER_VOLUME> table;
+        uint64_t clock = 0;
+        std::mutex lock;
+    };
+
+    Stream* _Find(VolumeStreams& volume, BlkAddr rba);
+    Stream* _Replace(VolumeStreams& volume);
+    void _Resize(Stream& stream);
+
+    uint32_t minWindowBlks;
+    uint32_t maxWindowBlks;
+    std::array<VolumeStreams, MAX_VOLUME_COUNT> volumes;
+};
+
+} // namespace pos
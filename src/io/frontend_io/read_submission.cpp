@@ -33,10 +33,15 @@
 #include "src/io/frontend_io/read_submission.h"
 
 #include <air/Air.h>
+#include <algorithm>
+#include <string.h>
 #include <unistd.h>
+#include <vector>
 
 #include "spdk/event.h"
 #include "src/admin/smart_log_mgr.h"
+#include "src/allocator/i_wbstripe_allocator.h"
+#include "src/allocator_service/allocator_service.h"
 #include "src/array/array.h"
 #include "src/array/device/array_device.h"
 #include "src/bio/volume_io.h"
@@ -44,15 +49,29 @@
 #include "src/dump/dump_module.h"
 #include "src/dump/dump_module.hpp"
 #include "src/event_scheduler/callback.h"
+#include "src/event_scheduler/io_completer.h"
+#include "src/include/branch_prediction.h"
 #include "src/include/pos_event_id.hpp"
+#include "src/io/frontend_io/access_heatmap.h"
+#include "src/io/frontend_io/access_heatmap_service.h"
+#include "src/io/frontend_io/aio.h"
+#include "src/io/frontend_io/checksum_verify_completion.h"
+#include "src/io/frontend_io/read_cache_fill_completion.h"
+#include "src/io/frontend_io/partial_write_coalescer.h"
+#include "src/io/frontend_io/partial_write_coalescer_service.h"
+#include "src/io/frontend_io/read_cache_service.h"
+#include "src/io/frontend_io/zero_block_unmap.h"
+#include "src/io/general_io/block_checksum.h"
+#include "src/mapper_service/mapper_service.h"
 
 namespace pos
 {
-ReadSubmission::ReadSubmission(VolumeIoSmartPtr volumeIo, BlockAlignment* blockAlignment_, Merger* merger_, Translator* translator_)
+ReadSubmission::ReadSubmission(VolumeIoSmartPtr volumeIo, BlockAlignment* blockAlignment_, Merger* merger_, Translator* translator_, ReadCache* readCache_)
 : Event(true),
   blockAlignment(blockAlignment_),
   merger(merger_),
   translator(translator_),
+  readCache(readCache_),
   volumeIo(volumeIo)
 {
     if (nullptr == blockAlignment)
@@ -67,6 +86,16 @@ ReadSubmission::ReadSubmission(VolumeIoSmartPtr volumeIo, BlockAlignment* blockA
     {
         translator = new Translator{volumeIo->GetVolumeId(), blockAlignment->GetHeadBlock(), blockAlignment->GetBlockCount(), volumeIo->GetArrayId(), true};
     }
+    if (nullptr == readCache)
+    {
+        readCache = ReadCacheServiceSingleton::Instance()->GetReadCache(volumeIo->GetArrayId());
+    }
+    partialWriteCoalescer = PartialWriteCoalescerServiceSingleton::Instance()->GetPartialWriteCoalescer(volumeIo->GetArrayId());
+    AccessHeatmap* accessHeatmap = AccessHeatmapServiceSingleton::Instance()->GetAccessHeatmap(volumeIo->GetArrayId());
+    if (nullptr != accessHeatmap)
+    {
+        accessHeatmap->Record(volumeIo->GetVolumeId(), volumeIo->GetSectorRba(), false);
+    }
     airlog("RequestedUserRead", "user", GetEventType(), 1);
 }
 
@@ -92,6 +121,11 @@ ReadSubmission::~ReadSubmission()
 bool
 ReadSubmission::Execute(void)
 {
+    if (unlikely(false == _CompletePartialBlocks()))
+    {
+        return false;
+    }
+
     uint32_t volId = volumeIo->GetVolumeId();
     uint32_t arrayId = volumeIo->GetArrayId();
     SmartLogMgrSingleton::Instance()->IncreaseReadCmds(volId, arrayId);
@@ -99,19 +133,122 @@ ReadSubmission::Execute(void)
     bool isInSingleBlock = (blockAlignment->GetBlockCount() == 1);
     if (isInSingleBlock)
     {
+        bool hit = _ReadFromCache();
+        if (nullptr != readCache && readCache->IsEnabled())
+        {
+            readCache->RecordRead(volId, blockAlignment->GetHeadBlock(), hit);
+        }
+        if (hit || _ReadZeroBlock())
+        {
+            volumeIo = nullptr;
+            return true;
+        }
         _PrepareSingleBlock();
         _SendVolumeIo(volumeIo);
     }
     else
     {
         _PrepareMergedIo();
-        _ProcessMergedIo();
+        if (0 == merger->GetSplitCount())
+        {
+            IoCompleter ioCompleter(volumeIo);
+            ioCompleter.CompleteUbio(IOErrorType::SUCCESS, true);
+        }
+        else
+        {
+            _ProcessMergedIo();
+        }
     }
 
     volumeIo = nullptr;
     return true;
 }
 
+bool
+ReadSubmission::_CompletePartialBlocks(void)
+{
+    if (nullptr == partialWriteCoalescer || 0 == partialWriteCoalescer->GetPendingBlockCount())
+    {
+        return true;
+    }
+
+    if (nullptr == translator)
+    {
+        translator = new Translator{volumeIo->GetVolumeId(), blockAlignment->GetHeadBlock(), blockAlignment->GetBlockCount(), volumeIo->GetArrayId(), true};
+    }
+    if (partialWriteCoalescer->TryCompleteBlocks(volumeIo->GetVolumeId(),
+            blockAlignment->GetHeadBlock(), blockAlignment->GetBlockCount()))
+    {
+        return true;
+    }
+
+    // The blocks are translated again once their old data is merged
+    _ReleaseTranslator();
+    return false;
+}
+
+void
+ReadSubmission::_ReleaseTranslator(void)
+{
+    IWBStripeAllocator* iWBStripeAllocator =
+        AllocatorServiceSingleton::Instance()->GetIWBStripeAllocator(volumeIo->GetArrayId());
+    for (uint32_t blockIndex = 0; blockIndex < blockAlignment->GetBlockCount(); blockIndex++)
+    {
+        StripeAddr lsidEntry;
+        bool referenced;
+        std::tie(lsidEntry, referenced) = translator->GetLsidRefResult(blockIndex);
+        if (referenced)
+        {
+            iWBStripeAllocator->DereferLsidCnt(lsidEntry, 1);
+        }
+    }
+    delete translator;
+    translator = nullptr;
+}
+
+bool
+ReadSubmission::_IsCacheable(void)
+{
+    // Only whole blocks read from the user area are worth caching. A block
+    // still in a write buffer stripe is served from there. A block scattered
+    // over host buffers is read into them directly and is not cached.
+    if (nullptr == readCache || false == readCache->IsEnabled())
+    {
+        return false;
+    }
+    if (volumeIo->IsVectored())
+    {
+        return false;
+    }
+    if (blockAlignment->GetDataSize(0) != BLOCK_SIZE)
+    {
+        return false;
+    }
+    if (IsUnMapVsa(translator->GetVsa(0)))
+    {
+        return false;
+    }
+    bool referenced = std::get<1>(translator->GetLsidRefResult(0));
+    return (false == referenced);
+}
+
+bool
+ReadSubmission::_ReadFromCache(void)
+{
+    if (false == _IsCacheable())
+    {
+        return false;
+    }
+    if (false == readCache->Lookup(translator->GetVsa(0), volumeIo->GetBuffer()))
+    {
+        return false;
+    }
+
+    IoCompleter ioCompleter(volumeIo);
+    ioCompleter.CompleteUbioWithoutRecovery(IOErrorType::SUCCESS, true);
+    return true;
+}
+
 void
 ReadSubmission::_PrepareSingleBlock(void)
 {
@@ -124,20 +261,74 @@ ReadSubmission::_PrepareSingleBlock(void)
     if (referenced)
     {
         CallbackSmartPtr callee(volumeIo->GetCallback());
-        CallbackSmartPtr readCompletion(new ReadCompletion(volumeIo));
-        readCompletion->SetCallee(callee);
-        volumeIo->SetCallback(readCompletion);
         volumeIo->SetLsidEntry(lsidEntry);
+        if (likely(callee->GetCallbackType() == CallbackType_AioReadCompletion))
+        {
+            // The reference is released inline by the user completion
+            std::static_pointer_cast<AioReadCompletion>(callee)->GetStage<0>().Arm(volumeIo);
+        }
+        else
+        {
+            CallbackSmartPtr readCompletion(new ReadCompletion(volumeIo));
+            readCompletion->SetCallee(callee);
+            volumeIo->SetCallback(readCompletion);
+            callee->SetWaitingCount(1);
+        }
+    }
+    else if (_IsCacheable())
+    {
+        VirtualBlkAddr vsa = translator->GetVsa(0);
+        CallbackSmartPtr callee(volumeIo->GetCallback());
+        CallbackSmartPtr fillCompletion(new ReadCacheFillCompletion(volumeIo,
+            readCache, vsa, readCache->GetGeneration(vsa)));
+        fillCompletion->SetCallee(callee);
+        volumeIo->SetCallback(fillCompletion);
         callee->SetWaitingCount(1);
     }
+    if (false == referenced)
+    {
+        _ArmChecksumVerify(volumeIo, translator->GetVsa(0), lsidEntry);
+    }
+}
+
+bool
+ReadSubmission::_ReadZeroBlock(void)
+{
+    if (false == ZeroBlockUnmap::IsEnabled() || false == IsUnMapVsa(translator->GetVsa(0)))
+    {
+        return false;
+    }
+
+    volumeIo->FillZero();
+    IoCompleter ioCompleter(volumeIo);
+    ioCompleter.CompleteUbio(IOErrorType::SUCCESS, true);
+    return true;
 }
 
 void
 ReadSubmission::_PrepareMergedIo(void)
 {
     uint32_t blockCount = blockAlignment->GetBlockCount();
+    uint32_t blockIndex = 0;
+    uint32_t extentCount = translator->GetVsaExtentCount();
 
-    for (uint32_t blockIndex = 0; blockIndex < blockCount; blockIndex++)
+    for (uint32_t extentIndex = 0; extentIndex < extentCount; extentIndex++)
+    {
+        VirtualBlks extent = translator->GetVsaExtent(extentIndex);
+        uint32_t numBlks = std::min(extent.numBlks, blockCount - blockIndex);
+        if ((numBlks > 1) && (IsUnMapVsa(extent.startVsa) == false))
+        {
+            _MergeExtent(blockIndex, numBlks);
+            blockIndex += numBlks;
+            continue;
+        }
+        for (uint32_t offset = 0; offset < numBlks; offset++)
+        {
+            _MergeBlock(blockIndex++);
+        }
+    }
+
+    for (; blockIndex < blockCount; blockIndex++)
     {
         _MergeBlock(blockIndex);
     }
@@ -145,13 +336,45 @@ ReadSubmission::_PrepareMergedIo(void)
     merger->Cut();
 }
 
+void
+ReadSubmission::_MergeExtent(uint32_t startIndex, uint32_t numBlks)
+{
+    // The blocks of a mapped extent are contiguous in the stripe, so they are
+    // translated together and handed to the merger chunk by chunk
+    PhysicalEntryArray physicalEntries =
+        translator->GetPhysicalEntriesOfBlocks(startIndex, numBlks);
+
+    uint32_t blockIndex = startIndex;
+    for (auto& entry : physicalEntries)
+    {
+        PhysicalBlkAddr pba = entry.addr;
+        VirtualBlkAddr vsa = translator->GetVsa(blockIndex);
+        StripeAddr lsidEntry = translator->GetLsidEntry(blockIndex);
+        pba.lba = blockAlignment->AlignHeadLba(blockIndex, pba.lba);
+
+        uint32_t dataSize = 0;
+        for (uint32_t offset = 0; offset < entry.blkCnt; offset++)
+        {
+            dataSize += blockAlignment->GetDataSize(blockIndex + offset);
+        }
+        merger->Add(pba, vsa, lsidEntry, dataSize);
+        blockIndex += entry.blkCnt;
+    }
+}
+
 void
 ReadSubmission::_MergeBlock(uint32_t blockIndex)
 {
+    uint32_t dataSize = blockAlignment->GetDataSize(blockIndex);
+    if (IsUnMapVsa(translator->GetVsa(blockIndex)) && ZeroBlockUnmap::IsEnabled())
+    {
+        merger->AddZero(dataSize);
+        return;
+    }
+
     PhysicalBlkAddr pba = translator->GetPba(blockIndex);
     VirtualBlkAddr vsa = translator->GetVsa(blockIndex);
     StripeAddr lsidEntry = translator->GetLsidEntry(blockIndex);
-    uint32_t dataSize = blockAlignment->GetDataSize(blockIndex);
     pba.lba = blockAlignment->AlignHeadLba(blockIndex, pba.lba);
     merger->Add(pba, vsa, lsidEntry, dataSize);
 }
@@ -174,7 +397,51 @@ void
 ReadSubmission::_ProcessVolumeIo(uint32_t volumeIoIndex)
 {
     VolumeIoSmartPtr volumeIo = merger->GetSplit(volumeIoIndex);
+    _ArmChecksumVerify(volumeIo, volumeIo->GetVsa(), volumeIo->GetLsidEntry());
     _SendVolumeIo(volumeIo);
 }
 
+void
+ReadSubmission::_ArmChecksumVerify(VolumeIoSmartPtr targetIo, VirtualBlkAddr vsa, StripeAddr lsidEntry)
+{
+    // Only whole blocks read from the user area are verified, and only when
+    // the reverse map of their stripe is still cached. The verify completion
+    // runs first so that a corrupted block is never cached or returned.
+    if (likely(false == BlockChecksum::IsEnabled()))
+    {
+        return;
+    }
+    if (lsidEntry.loc != IN_USER_AREA || IsUnMapVsa(vsa) || targetIo->IsVectored())
+    {
+        return;
+    }
+    if ((targetIo->GetSectorRba() % SECTORS_PER_BLOCK != 0) ||
+        (targetIo->GetSize() % BLOCK_SIZE != 0))
+    {
+        return;
+    }
+
+    IReverseMap* reverseMap =
+        MapperServiceSingleton::Instance()->GetIReverseMap(targetIo->GetArrayId());
+    uint32_t blockCount = targetIo->GetSize() / BLOCK_SIZE;
+    std::vector<uint32_t> checksums(blockCount);
+    for (uint32_t blockIndex = 0; blockIndex < blockCount; blockIndex++)
+    {
+        if (false == reverseMap->GetBlockChecksum(vsa.stripeId,
+                vsa.offset + blockIndex, checksums[blockIndex]))
+        {
+            return;
+        }
+    }
+
+    CallbackSmartPtr callee(targetIo->GetCallback());
+    std::shared_ptr<ChecksumRepairCompletion> repair =
+        std::make_shared<ChecksumRepairCompletion>(targetIo, vsa, checksums);
+    repair->SetCallee(callee);
+    CallbackSmartPtr verify(new ChecksumVerifyCompletion(targetIo, repair));
+    verify->SetCallee(repair);
+    targetIo->SetCallback(verify);
+    callee->SetWaitingCount(1);
+}
+
 } // namespace pos
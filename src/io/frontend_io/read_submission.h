@@ -34,6 +34,7 @@
 
 #include "src/event_scheduler/event.h"
 #include "src/include/address_type.h"
+#include "src/io/frontend_io/read_cache.h"
 #include "src/io/frontend_io/read_completion_factory.h"
 #include "src/io/general_io/io_controller.h"
 #include "src/io/general_io/merger.h"
@@ -44,26 +45,37 @@ namespace pos
 {
 class EventArgument;
 class VolumeIo;
+class PartialWriteCoalescer;
 
 class ReadSubmission : public IOController, public Event
 {
 public:
     ReadSubmission(VolumeIoSmartPtr volumeIo, BlockAlignment* blockAlignment = nullptr,
-        Merger* merger = nullptr, Translator* translator = nullptr);
+        Merger* merger = nullptr, Translator* translator = nullptr,
+        ReadCache* readCache = nullptr);
     ~ReadSubmission(void) override;
     bool Execute(void) override;
 
 private:
+    bool _CompletePartialBlocks(void);
+    void _ReleaseTranslator(void);
+    bool _IsCacheable(void);
+    bool _ReadFromCache(void);
+    bool _ReadZeroBlock(void);
     void _PrepareSingleBlock(void);
     void _PrepareMergedIo(void);
     void _MergeBlock(uint32_t blocIndex);
+    void _MergeExtent(uint32_t startIndex, uint32_t numBlks);
     void _ProcessMergedIo(void);
     void _ProcessVolumeIo(uint32_t volumeIoIndex);
+    void _ArmChecksumVerify(VolumeIoSmartPtr targetIo, VirtualBlkAddr vsa, StripeAddr lsidEntry);
 
     ReadCompletionFactory readCompletionFactory;
     BlockAlignment* blockAlignment{nullptr};
     Merger* merger{nullptr};
     Translator* translator{nullptr};
+    ReadCache* readCache{nullptr};
+    PartialWriteCoalescer* partialWriteCoalescer{nullptr};
     VolumeIoSmartPtr volumeIo;
 };
 
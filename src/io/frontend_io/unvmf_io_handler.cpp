@@ -43,34 +43,72 @@
 #include "src/event_scheduler/io_completer.h"
 #include "src/include/branch_prediction.h"
 #include "src/include/pos_event_id.hpp"
+#include "src/io/frontend_io/admission_controller.h"
 #include "src/io/frontend_io/aio.h"
 #include "src/io/frontend_io/aio_submission_adapter.h"
+#include "src/io/frontend_io/write_buffer_zero_copy.h"
+#include "src/io/frontend_io/write_buffer_zero_copy_service.h"
+#include "src/io/frontend_io/write_coalescer.h"
 #include "src/logger/logger.h"
 #include "src/pos_replicator/posreplicator_manager.h"
 #include "src/qos/qos_manager.h"
 #include "src/spdk_wrapper/event_framework_api.h"
+#include "src/spdk_wrapper/reactor_cycle_accounting.h"
 #include "src/volume/volume_manager.h"
 
 using namespace pos;
 using namespace std;
 
+// Blocks are accessed through a single pointer by the io path, so a block
+// must not straddle two host buffers
+static bool
+IsSplitAtBlockBoundaries(const struct pos_io* io)
+{
+    uint64_t position = io->offset % BLOCK_SIZE;
+    for (int index = 0; index + 1 < io->iovcnt; index++)
+    {
+        position += io->iov[index].iov_len;
+        if (0 != (position % BLOCK_SIZE))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 void
 UNVMfCompleteHandler(void)
 {
     try
     {
+        ReactorCycleAccounting* cycleAccounting = ReactorCycleAccountingSingleton::Instance();
+        uint32_t currentReactor = EventFrameworkApiSingleton::Instance()->GetCurrentReactor();
+        uint64_t tick = cycleAccounting->GetTicks();
+        cycleAccounting->EnterPoller(currentReactor, tick);
+
+        // The writes coalesced during this poll cycle go down now
+        WriteCoalescerSingleton::Instance()->Flush();
+
         AIO aio;
-        aio.CompleteIOs();
+        int completions = aio.CompleteIOs();
+        uint64_t completedTick = cycleAccounting->GetTicks();
+        cycleAccounting->Add(currentReactor,
+            (completions > 0) ? ReactorCycleType::IoCompletion : ReactorCycleType::Idle,
+            completedTick - tick);
+
         bool ret1 = EventFrameworkApiSingleton::Instance()->CompleteEvents();
-        uint32_t currentReactor = EventFrameworkApiSingleton::Instance()->GetCurrentReactor();
         if (AffinityManagerSingleton::Instance()->IsEventReactor(currentReactor))
         {
             bool ret2 = EventFrameworkApiSingleton::Instance()->CompleteSingleQueueEvents();
             if (ret1 == true && ret2 == true)
             {
+                uint64_t sleepTick = cycleAccounting->GetTicks();
                 usleep(1);
+                cycleAccounting->Add(currentReactor, ReactorCycleType::Idle,
+                    cycleAccounting->GetTicks() - sleepTick);
             }
         }
+        cycleAccounting->ExitPoller(currentReactor, cycleAccounting->GetTicks());
     }
     catch (...)
     {
@@ -80,8 +118,8 @@ UNVMfCompleteHandler(void)
     }
 }
 
-int
-UNVMfSubmitHandler(struct pos_io* io)
+static int
+SubmitHostIo(struct pos_io* io)
 {
     try
     {
@@ -103,6 +141,7 @@ UNVMfSubmitHandler(struct pos_io* io)
             case IO_TYPE::READ:
             case IO_TYPE::WRITE:
             {
+#ifdef IBOF_CONFIG_REPLICATOR
                 if (unlikely(1 != io->iovcnt))
                 {
                     POS_EVENT_ID eventId = EID(SCHEDAPI_WRONG_BUFFER);
@@ -110,16 +149,35 @@ UNVMfSubmitHandler(struct pos_io* io)
                         "Single IO command should have a continuous buffer");
                     throw eventId;
                 }
+#else
+                if (unlikely(1 > io->iovcnt || false == IsSplitAtBlockBoundaries(io)))
+                {
+                    POS_EVENT_ID eventId = EID(SCHEDAPI_WRONG_BUFFER);
+                    POS_TRACE_ERROR(static_cast<int>(eventId),
+                        "Buffers of IO command should be split at block boundaries, iovcnt:{}",
+                        io->iovcnt);
+                    throw eventId;
+                }
+#endif
                 break;
             }
             case IO_TYPE::FLUSH:
             {
+                WriteCoalescerSingleton::Instance()->Flush();
                 AIO aio;
                 aio.SubmitFlush(*io);
                 airlog("UserFlushProcess", "user", io->ioType, 1);
                 return POS_IO_STATUS_SUCCESS;
             }
             break;
+            case IO_TYPE::UNMAP:
+            {
+                WriteCoalescerSingleton::Instance()->Flush();
+                AIO aio;
+                aio.SubmitUnmap(*io);
+                return POS_IO_STATUS_SUCCESS;
+            }
+            break;
             default:
             {
                 POS_EVENT_ID eventId = EID(BLKHDLR_WRONG_IO_DIRECTION);
@@ -129,12 +187,25 @@ UNVMfSubmitHandler(struct pos_io* io)
             }
         }
 
+        // Rejected before any resource is taken, the host retries it later
+        AdmissionController* admissionController = AdmissionControllerSingleton::Instance();
+        if (unlikely(false == admissionController->Admit(io->array_id, io->volume_id,
+            AIO::GetOutstandingIoCount())))
+        {
+            if (nullptr != io->complete_cb)
+            {
+                io->complete_cb(io, POS_IO_STATUS_RETRY);
+            }
+            return POS_IO_STATUS_SUCCESS;
+        }
+
         IVolumeIoManager* volumeManager = VolumeServiceSingleton::Instance()->GetVolumeManager(io->array_id);
 
         AIO aio;
         VolumeIoSmartPtr volumeIo = aio.CreateVolumeIo(*io);
         if (unlikely(EID(SUCCESS) != volumeManager->IncreasePendingIOCountIfNotZero(io->volume_id, static_cast<VolumeIoType>(io->ioType))))
         {
+            admissionController->Release(io->array_id, io->volume_id);
             IoCompleter ioCompleter(volumeIo);
             ioCompleter.CompleteUbioWithoutRecovery(IOErrorType::VOLUME_UMOUNTED, true);
             return POS_IO_STATUS_SUCCESS;
@@ -155,7 +226,7 @@ UNVMfSubmitHandler(struct pos_io* io)
         }
         else
         {
-            aio.SubmitAsyncIO(volumeIo);
+            WriteCoalescerSingleton::Instance()->Submit(volumeIo);
         }
 #endif
     }
@@ -174,3 +245,56 @@ UNVMfSubmitHandler(struct pos_io* io)
 
     return POS_IO_STATUS_SUCCESS;
 }
+
+int
+UNVMfSubmitHandler(struct pos_io* io)
+{
+    ReactorCycleAccounting* cycleAccounting = ReactorCycleAccountingSingleton::Instance();
+    uint64_t tick = cycleAccounting->GetTicks();
+    int ret = SubmitHostIo(io);
+    cycleAccounting->AddNested(EventFrameworkApiSingleton::Instance()->GetCurrentReactor(),
+        ReactorCycleType::HostSubmission, cycleAccounting->GetTicks() - tick);
+    return ret;
+}
+
+int
+UNVMfZcopyGetBufHandler(struct pos_io* io)
+{
+    try
+    {
+        WriteBufferZeroCopy* zeroCopy =
+            WriteBufferZeroCopyServiceSingleton::Instance()->GetWriteBufferZeroCopy(io->array_id);
+        if (nullptr == zeroCopy)
+        {
+            return POS_IO_STATUS_FAIL;
+        }
+        return zeroCopy->GetBuffer(*io);
+    }
+    catch (...)
+    {
+        POS_EVENT_ID eventId = EID(SCHEDAPI_SUBMISSION_FAIL);
+        POS_TRACE_ERROR(static_cast<int>(eventId),
+            "Fail to get write buffer for zero copy");
+    }
+    return POS_IO_STATUS_FAIL;
+}
+
+void
+UNVMfZcopyPutBufHandler(struct pos_io* io)
+{
+    try
+    {
+        WriteBufferZeroCopy* zeroCopy =
+            WriteBufferZeroCopyServiceSingleton::Instance()->GetWriteBufferZeroCopy(io->array_id);
+        if (nullptr != zeroCopy)
+        {
+            zeroCopy->PutBuffer(*io);
+        }
+    }
+    catch (...)
+    {
+        POS_EVENT_ID eventId = EID(SCHEDAPI_SUBMISSION_FAIL);
+        POS_TRACE_ERROR(static_cast<int>(eventId),
+            "Fail to put write buffer for zero copy");
+    }
+}
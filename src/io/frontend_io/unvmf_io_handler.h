@@ -38,5 +38,7 @@
 
 int UNVMfSubmitHandler(struct pos_io* io);
 void UNVMfCompleteHandler(void);
+int UNVMfZcopyGetBufHandler(struct pos_io* io);
+void UNVMfZcopyPutBufHandler(struct pos_io* io);
 
 // namespace pos
@@ -0,0 +1,435 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io/frontend_io/write_buffer_zero_copy.h"
+
+#include <list>
+#include <string>
+#include <utility>
+
+#include "spdk/pos.h"
+#include "src/allocator/i_block_allocator.h"
+#include "src/allocator/i_wbstripe_allocator.h"
+#include "src/allocator/stripe_manager/stripe.h"
+#include "src/allocator_service/allocator_service.h"
+#include "src/array/device/array_device.h"
+#include "src/array/service/array_service_layer.h"
+#include "src/array/service/io_translator/i_io_translator.h"
+#include "src/device/base/ublock_device.h"
+#include "src/gc/flow_control/flow_control.h"
+#include "src/gc/flow_control/flow_control_service.h"
+#include "src/include/branch_prediction.h"
+#include "src/include/memory.h"
+#include "src/include/pos_event_id.h"
+#include "src/io/backend_io/flush_submission.h"
+#include "src/io/frontend_io/write_buffer_zero_copy_service.h"
+#include "src/io/general_io/rba_state_manager.h"
+#include "src/io/general_io/rba_state_service.h"
+#include "src/logger/logger.h"
+#include "src/mapper/i_stripemap.h"
+#include "src/mapper_service/mapper_service.h"
+#include "src/master_context/config_manager.h"
+#include "src/spdk_wrapper/event_framework_api.h"
+#include "src/volume/i_volume_manager.h"
+#include "src/volume/volume_service.h"
+
+namespace pos
+{
+WriteBufferZeroCopy::WriteBufferZeroCopy(IArrayInfo* arrayInfo)
+: WriteBufferZeroCopy(arrayInfo, ConfigManagerSingleton::Instance(),
+      nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+      EventFrameworkApiSingleton::Instance())
+{
+}
+
+WriteBufferZeroCopy::WriteBufferZeroCopy(IArrayInfo* arrayInfo, ConfigManager* configManager,
+    IVolumeManager* volumeManager, RBAStateManager* rbaStateManager,
+    IBlockAllocator* blockAllocator, IWBStripeAllocator* wbStripeAllocator,
+    FlowControl* flowControl, IStripeMap* stripeMap, IIOTranslator* translator,
+    EventFrameworkApi* eventFrameworkApi)
+: arrayInfo(arrayInfo),
+  configManager(configManager),
+  volumeManager(volumeManager),
+  rbaStateManager(rbaStateManager),
+  blockAllocator(blockAllocator),
+  wbStripeAllocator(wbStripeAllocator),
+  flowControl(flowControl),
+  stripeMap(stripeMap),
+  translator(translator),
+  eventFrameworkApi(eventFrameworkApi),
+  enabled(false)
+{
+}
+
+WriteBufferZeroCopy::~WriteBufferZeroCopy(void)
+{
+    Dispose();
+}
+
+int
+WriteBufferZeroCopy::Init(void)
+{
+    bool zeroCopyEnabled = false;
+    int ret = configManager->GetValue("performance", "write_buffer_zero_copy_enable",
+        &zeroCopyEnabled, CONFIG_TYPE_BOOL);
+    if (ret != EID(SUCCESS) || false == zeroCopyEnabled || true == enabled)
+    {
+        return EID(SUCCESS);
+    }
+
+    int arrayId = arrayInfo->GetIndex();
+    if (nullptr == volumeManager)
+    {
+        volumeManager = VolumeServiceSingleton::Instance()->GetVolumeManager(arrayId);
+    }
+    if (nullptr == rbaStateManager)
+    {
+        rbaStateManager = RBAStateServiceSingleton::Instance()->GetRBAStateManager(arrayId);
+    }
+    if (nullptr == blockAllocator)
+    {
+        blockAllocator = AllocatorServiceSingleton::Instance()->GetIBlockAllocator(arrayId);
+    }
+    if (nullptr == wbStripeAllocator)
+    {
+        wbStripeAllocator = AllocatorServiceSingleton::Instance()->GetIWBStripeAllocator(arrayId);
+    }
+    if (nullptr == flowControl)
+    {
+        flowControl = FlowControlServiceSingleton::Instance()->GetFlowControl(arrayInfo->GetName());
+    }
+    if (nullptr == stripeMap)
+    {
+        stripeMap = MapperServiceSingleton::Instance()->GetIStripeMap(arrayId);
+    }
+    if (nullptr == translator)
+    {
+        translator = ArrayService::Instance()->Getter()->GetTranslator();
+    }
+
+    // The transport writes the host data to the write buffer by address
+    std::list<PhysicalEntry> entries;
+    LogicalEntry wbEntry = {.addr = {.stripeId = 0, .offset = 0}, .blkCnt = 1};
+    ret = translator->Translate(arrayId, WRITE_BUFFER, entries, wbEntry);
+    if (ret != EID(SUCCESS) || entries.empty() || nullptr == entries.front().addr.arrayDev
+        || nullptr == entries.front().addr.arrayDev->GetUblock()->GetByteAddress())
+    {
+        POS_TRACE_WARN(EID(WRITE_BUFFER_ZERO_COPY_NOT_SUPPORTED),
+            "Write buffer zero copy needs a byte addressable write buffer, array_name:{}",
+            arrayInfo->GetName());
+        return EID(SUCCESS);
+    }
+
+    enabled = true;
+    WriteBufferZeroCopyServiceSingleton::Instance()->Register(arrayId, this);
+    POS_TRACE_INFO(EID(WRITE_BUFFER_ZERO_COPY_ENABLED),
+        "Write buffer zero copy is enabled, array_name:{}", arrayInfo->GetName());
+    return EID(SUCCESS);
+}
+
+void
+WriteBufferZeroCopy::Dispose(void)
+{
+    if (false == enabled)
+    {
+        return;
+    }
+
+    enabled = false;
+    WriteBufferZeroCopyServiceSingleton::Instance()->Unregister(arrayInfo->GetIndex());
+
+    // A reservation is a pending write of its volume, so none is expected
+    // once the volumes are unmounted
+    std::lock_guard<std::mutex> lock(reservationLock);
+    if (false == reservations.empty())
+    {
+        POS_TRACE_WARN(EID(WRITE_BUFFER_ZERO_COPY_NOT_SUPPORTED),
+            "Write buffer reservations are left behind, array_name:{}, count:{}",
+            arrayInfo->GetName(), reservations.size());
+    }
+    reservations.clear();
+}
+
+void
+WriteBufferZeroCopy::Shutdown(void)
+{
+    Dispose();
+}
+
+void
+WriteBufferZeroCopy::Flush(void)
+{
+    // no-op for IMountSequence
+}
+
+bool
+WriteBufferZeroCopy::IsEnabled(void)
+{
+    return enabled;
+}
+
+int
+WriteBufferZeroCopy::GetBuffer(struct pos_io& io)
+{
+    if (false == enabled || WRITE != io.ioType || 0 == io.length || 0 >= io.iovcnt
+        || 0 != (io.offset % BLOCK_SIZE) || 0 != (io.length % BLOCK_SIZE)
+        || true == volumeManager->IsWriteThroughEnabled())
+    {
+        return POS_IO_STATUS_FAIL;
+    }
+
+    // The reservation counts as a pending write until it is taken over,
+    // so that the volume cannot be unmounted while the data is in flight
+    if (EID(SUCCESS) != volumeManager->IncreasePendingIOCountIfNotZero(io.volume_id,
+        VolumeIoType::UserWrite))
+    {
+        return POS_IO_STATUS_FAIL;
+    }
+
+    Reservation reservation;
+    reservation.volumeId = io.volume_id;
+    reservation.startRba = ChangeByteToBlock(io.offset);
+    reservation.blockCount = io.length / BLOCK_SIZE;
+    reservation.token = 0;
+    reservation.ownershipAcquired = false;
+    if (false == _Allocate(reservation) || false == _FillIoVectors(reservation, io))
+    {
+        _Release(reservation);
+        return POS_IO_STATUS_FAIL;
+    }
+
+    std::lock_guard<std::mutex> lock(reservationLock);
+    reservations.emplace(io.iov[0].iov_base, std::move(reservation));
+    return POS_IO_STATUS_SUCCESS;
+}
+
+void
+WriteBufferZeroCopy::PutBuffer(struct pos_io& io)
+{
+    if (0 >= io.iovcnt)
+    {
+        return;
+    }
+
+    Reservation reservation;
+    {
+        std::lock_guard<std::mutex> lock(reservationLock);
+        auto it = reservations.find(io.iov[0].iov_base);
+        if (it == reservations.end())
+        {
+            return;
+        }
+        reservation = std::move(it->second);
+        reservations.erase(it);
+    }
+    _Release(reservation);
+}
+
+bool
+WriteBufferZeroCopy::Take(uint32_t volumeId, BlkAddr startRba, uint32_t blockCount,
+    void* buffer, std::list<VirtualBlksInfo>& virtualBlks)
+{
+    Reservation reservation;
+    {
+        std::lock_guard<std::mutex> lock(reservationLock);
+        auto it = reservations.find(buffer);
+        if (it == reservations.end() || it->second.volumeId != volumeId
+            || it->second.startRba != startRba || it->second.blockCount != blockCount)
+        {
+            return false;
+        }
+        reservation = std::move(it->second);
+        reservations.erase(it);
+    }
+
+    // The volume io holds a pending count of its own from here on
+    virtualBlks.splice(virtualBlks.end(), reservation.virtualBlks);
+    volumeManager->DecreasePendingIOCount(volumeId, VolumeIoType::UserWrite);
+    return true;
+}
+
+uint32_t
+WriteBufferZeroCopy::GetReservationCount(void)
+{
+    std::lock_guard<std::mutex> lock(reservationLock);
+    return reservations.size();
+}
+
+bool
+WriteBufferZeroCopy::_Allocate(Reservation& reservation)
+{
+    if (true == blockAllocator->IsProhibitedUserBlkAlloc())
+    {
+        return false;
+    }
+    int token = flowControl->GetToken(FlowControlType::USER, reservation.blockCount);
+    if (0 >= token)
+    {
+        return false;
+    }
+    reservation.token = token;
+
+    reservation.ownershipAcquired = rbaStateManager->BulkAcquireOwnership(reservation.volumeId,
+        reservation.startRba, reservation.blockCount);
+    if (false == reservation.ownershipAcquired)
+    {
+        return false;
+    }
+
+    if (false == blockAllocator->TryRdLock(reservation.volumeId))
+    {
+        return false;
+    }
+    uint32_t remainBlockCount = reservation.blockCount;
+    uint32_t originCore = eventFrameworkApi->GetCurrentReactor();
+    while (remainBlockCount > 0)
+    {
+        // The write is not classified yet, so it takes the tails of its core as before
+        VirtualBlksInfo result = blockAllocator->AllocateWriteBufferBlks(reservation.volumeId,
+            remainBlockCount, originCore, WRITE_STREAM_MIXED);
+        if (IsUnMapVsa(result.first.startVsa))
+        {
+            break;
+        }
+        reservation.virtualBlks.push_back(result);
+        remainBlockCount -= result.first.numBlks;
+    }
+    if (false == blockAllocator->Unlock(reservation.volumeId))
+    {
+        POS_TRACE_DEBUG(EID(WRHDLR_FAIL_TO_UNLOCK), "volumeId:{}", reservation.volumeId);
+    }
+    return 0 == remainBlockCount;
+}
+
+bool
+WriteBufferZeroCopy::_FillIoVectors(Reservation& reservation, struct pos_io& io)
+{
+    int iovcnt = 0;
+    for (auto& info : reservation.virtualBlks)
+    {
+        char* address = static_cast<char*>(_GetWriteBufferAddress(info.first));
+        if (nullptr == address)
+        {
+            return false;
+        }
+        size_t length = info.first.numBlks * BLOCK_SIZE;
+        if (0 < iovcnt
+            && static_cast<char*>(io.iov[iovcnt - 1].iov_base) + io.iov[iovcnt - 1].iov_len == address)
+        {
+            io.iov[iovcnt - 1].iov_len += length;
+            continue;
+        }
+        if (iovcnt == io.iovcnt)
+        {
+            return false;
+        }
+        io.iov[iovcnt].iov_base = address;
+        io.iov[iovcnt].iov_len = length;
+        iovcnt++;
+    }
+    io.iovcnt = iovcnt;
+    return true;
+}
+
+void*
+WriteBufferZeroCopy::_GetWriteBufferAddress(const VirtualBlks& vsaRange)
+{
+    StripeAddr lsidEntry = stripeMap->GetLSA(vsaRange.startVsa.stripeId);
+    if (IN_WRITE_BUFFER_AREA != lsidEntry.stripeLoc)
+    {
+        return nullptr;
+    }
+
+    LogicalEntry logicalEntry = {
+        .addr = {.stripeId = lsidEntry.stripeId, .offset = vsaRange.startVsa.offset},
+        .blkCnt = vsaRange.numBlks};
+    std::list<PhysicalEntry> entries;
+    int ret = translator->Translate(arrayInfo->GetIndex(), WRITE_BUFFER, entries, logicalEntry);
+    if (ret != EID(SUCCESS) || 1 != entries.size() || nullptr == entries.front().addr.arrayDev)
+    {
+        return nullptr;
+    }
+
+    PhysicalBlkAddr& pba = entries.front().addr;
+    char* base = static_cast<char*>(pba.arrayDev->GetUblock()->GetByteAddress());
+    if (nullptr == base)
+    {
+        return nullptr;
+    }
+    return base + pba.lba * SECTOR_SIZE;
+}
+
+void
+WriteBufferZeroCopy::_Release(Reservation& reservation)
+{
+    for (auto& info : reservation.virtualBlks)
+    {
+        _ReleaseBlocks(info.first);
+    }
+    reservation.virtualBlks.clear();
+    if (true == reservation.ownershipAcquired)
+    {
+        rbaStateManager->BulkReleaseOwnership(reservation.volumeId, reservation.startRba,
+            reservation.blockCount);
+    }
+    if (0 < reservation.token)
+    {
+        flowControl->ReturnToken(FlowControlType::USER, reservation.token);
+    }
+    volumeManager->DecreasePendingIOCount(reservation.volumeId, VolumeIoType::UserWrite);
+}
+
+void
+WriteBufferZeroCopy::_ReleaseBlocks(const VirtualBlks& vsaRange)
+{
+    // The blocks are counted as written so that their stripe can still be
+    // flushed, they are never mapped and stay invalid
+    StripeAddr lsidEntry = stripeMap->GetLSA(vsaRange.startVsa.stripeId);
+    StripeSmartPtr stripe = wbStripeAllocator->GetStripe(lsidEntry.stripeId);
+    if (unlikely(nullptr == stripe))
+    {
+        POS_TRACE_ERROR(EID(WRWRAPUP_STRIPE_NOT_FOUND),
+            "Stripe #{} not found at releasing write buffer blocks", vsaRange.startVsa.stripeId);
+        return;
+    }
+    if (0 == stripe->DecreseBlksRemaining(vsaRange.numBlks))
+    {
+        EventSmartPtr event(new FlushSubmission(stripe, arrayInfo->GetIndex()));
+        if (unlikely(stripe->Flush(event) < 0))
+        {
+            POS_TRACE_ERROR(EID(WRWRAPUP_EVENT_ALLOC_FAILED),
+                "Flush Event allocation failed at releasing write buffer blocks");
+        }
+    }
+}
+
+} // namespace pos
@@ -0,0 +1,129 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "src/array_models/interface/i_array_info.h"
+#include "src/array_models/interface/i_mount_sequence.h"
+#include "src/include/address_type.h"
+
+struct pos_io;
+
+namespace pos
+{
+using VirtualBlksInfo = std::pair<VirtualBlks, StripeId>;
+class ConfigManager;
+class EventFrameworkApi;
+class FlowControl;
+class IBlockAllocator;
+class IIOTranslator;
+class IStripeMap;
+class IVolumeManager;
+class IWBStripeAllocator;
+class RBAStateManager;
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Let the transport receive the data of a host write straight into
+ *           the write buffer. Before the data is transferred, the blocks of
+ *           the write are allocated as WriteSubmission would allocate them,
+ *           with the flow control token and the RBA ownership taken, and
+ *           their write buffer addresses are handed out as the data buffers.
+ *           When the write is submitted, WriteSubmission takes the
+ *           reservation over and updates the block map without copying the
+ *           data. A write that is not submitted gives its blocks back to
+ *           their stripes as written, nothing refers to them.
+ */
+/* --------------------------------------------------------------------------*/
+class WriteBufferZeroCopy : public IMountSequence
+{
+public:
+    explicit WriteBufferZeroCopy(IArrayInfo* arrayInfo);
+    WriteBufferZeroCopy(IArrayInfo* arrayInfo, ConfigManager* configManager,
+        IVolumeManager* volumeManager, RBAStateManager* rbaStateManager,
+        IBlockAllocator* blockAllocator, IWBStripeAllocator* wbStripeAllocator,
+        FlowControl* flowControl, IStripeMap* stripeMap, IIOTranslator* translator,
+        EventFrameworkApi* eventFrameworkApi);
+    virtual ~WriteBufferZeroCopy(void);
+
+    int Init(void) override;
+    void Dispose(void) override;
+    void Shutdown(void) override;
+    void Flush(void) override;
+
+    virtual bool IsEnabled(void);
+    virtual int GetBuffer(struct pos_io& io);
+    virtual void PutBuffer(struct pos_io& io);
+    virtual bool Take(uint32_t volumeId, BlkAddr startRba, uint32_t blockCount,
+        void* buffer, std::list<VirtualBlksInfo>& virtualBlks);
+    uint32_t GetReservationCount(void);
+
+private:
+    struct Reservation
+    {
+        uint32_t volumeId;
+        BlkAddr startRba;
+        uint32_t blockCount;
+        int token;
+        bool ownershipAcquired;
+        std::list<VirtualBlksInfo> virtualBlks;
+    };
+
+    bool _Allocate(Reservation& reservation);
+    bool _FillIoVectors(Reservation& reservation, struct pos_io& io);
+    void* _GetWriteBufferAddress(const VirtualBlks& vsaRange);
+    void _Release(Reservation& reservation);
+    void _ReleaseBlocks(const VirtualBlks& vsaRange);
+
+    IArrayInfo* arrayInfo;
+    ConfigManager* configManager;
+    IVolumeManager* volumeManager;
+    RBAStateManager* rbaStateManager;
+    IBlockAllocator* blockAllocator;
+    IWBStripeAllocator* wbStripeAllocator;
+    FlowControl* flowControl;
+    IStripeMap* stripeMap;
+    IIOTranslator* translator;
+    EventFrameworkApi* eventFrameworkApi;
+    bool enabled;
+
+    std::mutex reservationLock;
+    std::unordered_map<void*, Reservation> reservations;
+};
+
+} // namespace pos
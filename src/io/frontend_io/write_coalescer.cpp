@@ -0,0 +1,294 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "src/io/frontend_io/write_coalescer.h"
+
+#include "src/event_scheduler/event_scheduler.h"
+#include "src/include/branch_prediction.h"
+#include "src/include/memory.h"
+#include "src/include/pos_event_id.h"
+#include "src/io/frontend_io/aio.h"
+#include "src/io/frontend_io/write_buffer_zero_copy.h"
+#include "src/io/frontend_io/write_buffer_zero_copy_service.h"
+#include "src/logger/logger.h"
+#include "src/master_context/config_manager.h"
+#include "src/spdk_wrapper/event_framework_api.h"
+
+namespace pos
+{
+CoalescedWriteCompletion::CoalescedWriteCompletion(std::vector<CallbackSmartPtr>& callbacks)
+: Callback(true, CallbackType_CoalescedWriteCompletion),
+  callbacks(callbacks)
+{
+}
+
+CoalescedWriteCompletion::~CoalescedWriteCompletion(void)
+{
+}
+
+bool
+CoalescedWriteCompletion::_DoSpecificJob(void)
+{
+    bool failed = (_GetErrorCount() > 0);
+    IOErrorType error = _GetMostCriticalError();
+    for (auto& callback : callbacks)
+    {
+        if (unlikely(failed))
+        {
+            callback->InformError(error);
+        }
+        if (unlikely(false == callback->Execute()))
+        {
+            EventSchedulerSingleton::Instance()->EnqueueEvent(callback);
+        }
+    }
+    callbacks.clear();
+    return true;
+}
+
+WriteCoalescer::WriteCoalescer(void)
+: WriteCoalescer(ConfigManagerSingleton::Instance(), EventFrameworkApiSingleton::Instance(), nullptr)
+{
+}
+
+WriteCoalescer::WriteCoalescer(ConfigManager* configManager, EventFrameworkApi* eventFrameworkApi, AIO* aio)
+: enabled(false),
+  maxSize(DEFAULT_MAX_SIZE_IN_KB * 1024),
+  eventFrameworkApi(eventFrameworkApi),
+  aio(aio),
+  aioOwned(false),
+  coalescedCount(0)
+{
+    if (nullptr == this->aio)
+    {
+        this->aio = new AIO();
+        aioOwned = true;
+    }
+
+    for (auto& run : pendingRuns)
+    {
+        run.arrayId = 0;
+        run.volumeId = 0;
+        run.endSectorRba = 0;
+        run.size = 0;
+    }
+
+    bool enable = false;
+    int ret = configManager->GetValue("performance", "write_coalescing_enable",
+        &enable, CONFIG_TYPE_BOOL);
+    if (ret != EID(SUCCESS) || false == enable)
+    {
+        return;
+    }
+
+    uint32_t maxSizeInKb = 0;
+    ret = configManager->GetValue("performance", "write_coalescing_max_size_in_kb",
+        &maxSizeInKb, CONFIG_TYPE_UINT32);
+    if (ret == EID(SUCCESS) && 0 != maxSizeInKb)
+    {
+        maxSize = static_cast<uint64_t>(maxSizeInKb) * 1024;
+    }
+
+    // A run has to hold at least two blocks to be worth holding back
+    enabled = (maxSize >= 2 * BLOCK_SIZE);
+    if (enabled)
+    {
+        POS_TRACE_INFO(EID(WRITE_COALESCING_ENABLED),
+            "write_coalescing_max_size_in_kb: {}", maxSize / 1024);
+    }
+}
+
+WriteCoalescer::~WriteCoalescer(void)
+{
+    if (aioOwned)
+    {
+        delete aio;
+    }
+}
+
+bool
+WriteCoalescer::IsEnabled(void)
+{
+    return enabled;
+}
+
+void
+WriteCoalescer::Submit(VolumeIoSmartPtr volumeIo)
+{
+    uint32_t reactor = eventFrameworkApi->GetCurrentReactor();
+    if (false == enabled || unlikely(reactor >= MAX_REACTOR_COUNT))
+    {
+        aio->SubmitAsyncIO(volumeIo);
+        return;
+    }
+
+    PendingRun& run = pendingRuns[reactor];
+    if (false == _IsMergeable(volumeIo))
+    {
+        // Writes of a volume still reach the write path in their arrival order
+        if (UbioDir::Write == volumeIo->dir && false == run.volumeIos.empty()
+            && run.arrayId == volumeIo->GetArrayId() && run.volumeId == volumeIo->GetVolumeId())
+        {
+            _Submit(run);
+        }
+        aio->SubmitAsyncIO(volumeIo);
+        return;
+    }
+
+    if (false == run.volumeIos.empty() && false == _Extends(run, volumeIo))
+    {
+        _Submit(run);
+    }
+
+    if (run.volumeIos.empty())
+    {
+        run.arrayId = volumeIo->GetArrayId();
+        run.volumeId = volumeIo->GetVolumeId();
+        run.endSectorRba = volumeIo->GetSectorRba();
+        run.size = 0;
+    }
+    run.volumeIos.push_back(volumeIo);
+    run.endSectorRba += ChangeByteToSector(volumeIo->GetSize());
+    run.size += volumeIo->GetSize();
+
+    if (run.size + BLOCK_SIZE > maxSize)
+    {
+        _Submit(run);
+    }
+}
+
+void
+WriteCoalescer::Flush(void)
+{
+    uint32_t reactor = eventFrameworkApi->GetCurrentReactor();
+    if (false == enabled || unlikely(reactor >= MAX_REACTOR_COUNT))
+    {
+        return;
+    }
+
+    PendingRun& run = pendingRuns[reactor];
+    if (false == run.volumeIos.empty())
+    {
+        _Submit(run);
+    }
+}
+
+uint64_t
+WriteCoalescer::GetCoalescedCount(void)
+{
+    return coalescedCount;
+}
+
+bool
+WriteCoalescer::_IsMergeable(VolumeIoSmartPtr volumeIo)
+{
+    if (UbioDir::Write != volumeIo->dir)
+    {
+        return false;
+    }
+
+    uint64_t size = volumeIo->GetSize();
+    if (0 != volumeIo->GetSectorRba() % ChangeByteToSector(BLOCK_SIZE)
+        || 0 == size || 0 != size % BLOCK_SIZE || size + BLOCK_SIZE > maxSize)
+    {
+        return false;
+    }
+
+    // The data of a zero copy write is already placed in its own write buffer blocks
+    WriteBufferZeroCopy* zeroCopy =
+        WriteBufferZeroCopyServiceSingleton::Instance()->GetWriteBufferZeroCopy(volumeIo->GetArrayId());
+    if (nullptr != zeroCopy && zeroCopy->IsEnabled())
+    {
+        return false;
+    }
+    return true;
+}
+
+bool
+WriteCoalescer::_Extends(PendingRun& run, VolumeIoSmartPtr volumeIo)
+{
+    return run.arrayId == volumeIo->GetArrayId()
+        && run.volumeId == volumeIo->GetVolumeId()
+        && run.endSectorRba == volumeIo->GetSectorRba()
+        && run.size + volumeIo->GetSize() <= maxSize;
+}
+
+void
+WriteCoalescer::_Submit(PendingRun& run)
+{
+    if (1 == run.volumeIos.size())
+    {
+        aio->SubmitAsyncIO(run.volumeIos.front());
+    }
+    else
+    {
+        coalescedCount += run.volumeIos.size();
+        aio->SubmitAsyncIO(_Merge(run));
+    }
+    run.volumeIos.clear();
+    run.size = 0;
+}
+
+VolumeIoSmartPtr
+WriteCoalescer::_Merge(PendingRun& run)
+{
+    std::vector<struct iovec> ioVectors;
+    std::vector<CallbackSmartPtr> callbacks;
+    for (auto& volumeIo : run.volumeIos)
+    {
+        if (volumeIo->IsVectored())
+        {
+            const std::vector<struct iovec>& vectors = volumeIo->GetIoVectors();
+            ioVectors.insert(ioVectors.end(), vectors.begin(), vectors.end());
+        }
+        else
+        {
+            ioVectors.push_back({.iov_base = volumeIo->GetWholeBuffer(), .iov_len = volumeIo->GetSize()});
+        }
+        // The host write is completed through its callback only, so it is
+        // not kept alive by its own completion
+        callbacks.push_back(volumeIo->GetCallback());
+        volumeIo->ClearCallback();
+    }
+
+    VolumeIoSmartPtr front = run.volumeIos.front();
+    VolumeIoSmartPtr merged(new VolumeIo(ioVectors, run.arrayId));
+    merged->dir = UbioDir::Write;
+    merged->SetVolumeId(run.volumeId);
+    merged->SetSectorRba(front->GetSectorRba());
+    merged->SetEventType(BackendEvent::BackendEvent_FrontendIO);
+    merged->SetCallback(std::make_shared<CoalescedWriteCompletion>(callbacks));
+    return merged;
+}
+
+} // namespace pos
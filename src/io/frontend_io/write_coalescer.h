@@ -0,0 +1,113 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "src/bio/volume_io.h"
+#include "src/event_scheduler/callback.h"
+#include "src/include/smart_ptr_type.h"
+#include "src/lib/singleton.h"
+
+namespace pos
+{
+class AIO;
+class ConfigManager;
+class EventFrameworkApi;
+
+// Completes every host write of a coalesced run with the result of the run
+class CoalescedWriteCompletion : public Callback
+{
+public:
+    explicit CoalescedWriteCompletion(std::vector<CallbackSmartPtr>& callbacks);
+    ~CoalescedWriteCompletion(void) override;
+
+private:
+    bool _DoSpecificJob(void) override;
+
+    std::vector<CallbackSmartPtr> callbacks;
+};
+
+// Merges the block aligned host writes that arrive on a reactor within one
+// poll cycle and continue each other on the same volume into a single
+// VolumeIo, so that the ownership, write buffer allocation, journal log and
+// map update of a run are paid once instead of once per write. A run is
+// submitted when a write that does not extend it arrives, when it reaches
+// the merge size, or at the end of the poll cycle at the latest.
+class WriteCoalescer
+{
+public:
+    WriteCoalescer(void);
+    WriteCoalescer(ConfigManager* configManager, EventFrameworkApi* eventFrameworkApi, AIO* aio);
+    virtual ~WriteCoalescer(void);
+
+    virtual bool IsEnabled(void);
+    virtual void Submit(VolumeIoSmartPtr volumeIo);
+    // Submits the run pending on the current reactor
+    virtual void Flush(void);
+    uint64_t GetCoalescedCount(void);
+
+    static const uint32_t MAX_REACTOR_COUNT = 256;
+    static const uint32_t DEFAULT_MAX_SIZE_IN_KB = 128;
+
+private:
+    struct PendingRun
+    {
+        int arrayId;
+        uint32_t volumeId;
+        uint64_t endSectorRba;
+        uint64_t size;
+        std::vector<VolumeIoSmartPtr> volumeIos;
+    };
+
+    bool _IsMergeable(VolumeIoSmartPtr volumeIo);
+    bool _Extends(PendingRun& run, VolumeIoSmartPtr volumeIo);
+    void _Submit(PendingRun& run);
+    VolumeIoSmartPtr _Merge(PendingRun& run);
+
+    bool enabled;
+    uint64_t maxSize;
+    EventFrameworkApi* eventFrameworkApi;
+    AIO* aio;
+    bool aioOwned;
+    std::array<PendingRun, MAX_REACTOR_COUNT> pendingRuns;
+    std::atomic<uint64_t> coalescedCount;
+};
+
+using WriteCoalescerSingleton = Singleton<WriteCoalescer>;
+
+} // namespace pos
@@ -44,6 +44,8 @@
 #include "src/io/backend_io/flush_completion.h"
 #include "src/io/backend_io/flush_submission.h"
 #include "src/io/backend_io/stripe_map_update_request.h"
+#include "src/io/frontend_io/partial_write_coalescer.h"
+#include "src/io/frontend_io/partial_write_coalescer_service.h"
 #include "src/io/frontend_io/write_for_parity.h"
 #include "src/io/general_io/rba_state_service.h"
 #include "src/logger/logger.h"
@@ -51,37 +53,38 @@
 
 namespace pos
 {
-WriteCompletion::WriteCompletion(VolumeIoSmartPtr input)
-: WriteCompletion(input,
+WriteCompletionStage::WriteCompletionStage(VolumeIoSmartPtr input)
+: WriteCompletionStage(input,
       AllocatorServiceSingleton::Instance()->GetIWBStripeAllocator(input.get()->GetArrayId()),
-      EventFrameworkApiSingleton::Instance()->IsReactorNow(),
       VolumeServiceSingleton::Instance()->GetVolumeManager(input.get()->GetArrayId()))
 {
 }
 
-WriteCompletion::WriteCompletion(VolumeIoSmartPtr input,
-    IWBStripeAllocator* iWBStripeAllocator, bool isReactorNow,
-    IVolumeInfoManager* iVolumeInfoManager)
-: Callback(isReactorNow, CallbackType_WriteCompletion),
-  volumeIo(input),
+WriteCompletionStage::WriteCompletionStage(VolumeIoSmartPtr input,
+    IWBStripeAllocator* iWBStripeAllocator, IVolumeInfoManager* iVolumeInfoManager)
+: volumeIo(input),
   iWBStripeAllocator(iWBStripeAllocator),
   volumeManager(iVolumeInfoManager)
 {
 }
 
-WriteCompletion::~WriteCompletion()
-{
-}
-
-bool
-WriteCompletion::_DoSpecificJob()
+void
+WriteCompletionStage::Run(Callback& host, uint32_t errorCount)
 {
     bool executionSuccessful = false;
+    volumeIo->MarkStage(IoStage::MapUpdated);
 
     uint32_t volumeId = volumeIo->GetVolumeId();
     BlkAddr startRba = ChangeSectorToBlock(volumeIo->GetSectorRba());
     uint32_t blockCount = DivideUp(volumeIo->GetSize(), BLOCK_SIZE);
 
+    PartialWriteCoalescer* partialWriteCoalescer =
+        PartialWriteCoalescerServiceSingleton::Instance()->GetPartialWriteCoalescer(volumeIo->GetArrayId());
+    if (nullptr != partialWriteCoalescer)
+    {
+        partialWriteCoalescer->CompleteWrite(volumeId, startRba, volumeIo->GetVsa(), true);
+    }
+
     RBAStateManager& rbaStateManager =
         *RBAStateServiceSingleton::Instance()->GetRBAStateManager(volumeIo->GetArrayId());
     rbaStateManager.BulkReleaseOwnership(volumeId, startRba, blockCount);
@@ -95,21 +98,45 @@ WriteCompletion::_DoSpecificJob()
 
     if (unlikely(false == executionSuccessful))
     {
-        // We inform the error to the Callee of this callback,
-        // and do not retry this callback.
-        InformError(IOErrorType::GENERIC_ERROR);
-        executionSuccessful = true;
+        // We inform the error to the Callee of the host callback,
+        // and do not retry the host callback.
+        host.InformError(IOErrorType::GENERIC_ERROR);
     }
 
     volumeIo = nullptr;
 
-    airlog("CompleteUserWrite", "user", GetEventType(), 1);
+    airlog("CompleteUserWrite", "user", host.GetEventType(), 1);
+}
 
-    return executionSuccessful;
+WriteCompletion::WriteCompletion(VolumeIoSmartPtr input)
+: WriteCompletion(input,
+      AllocatorServiceSingleton::Instance()->GetIWBStripeAllocator(input.get()->GetArrayId()),
+      EventFrameworkApiSingleton::Instance()->IsReactorNow(),
+      VolumeServiceSingleton::Instance()->GetVolumeManager(input.get()->GetArrayId()))
+{
+}
+
+WriteCompletion::WriteCompletion(VolumeIoSmartPtr input,
+    IWBStripeAllocator* iWBStripeAllocator, bool isReactorNow,
+    IVolumeInfoManager* iVolumeInfoManager)
+: Callback(isReactorNow, CallbackType_WriteCompletion),
+  stage(input, iWBStripeAllocator, iVolumeInfoManager)
+{
+}
+
+WriteCompletion::~WriteCompletion()
+{
+}
+
+bool
+WriteCompletion::_DoSpecificJob()
+{
+    stage.Run(*this, _GetErrorCount());
+    return true;
 }
 
 bool
-WriteCompletion::_UpdateStripe(StripeSmartPtr& stripeToFlush)
+WriteCompletionStage::_UpdateStripe(StripeSmartPtr& stripeToFlush)
 {
     bool stripeUpdateSuccessful = true;
     StripeAddr lsidEntry = volumeIo->GetLsidEntry();
@@ -139,7 +166,7 @@ WriteCompletion::_UpdateStripe(StripeSmartPtr& stripeToFlush)
 }
 
 bool
-WriteCompletion::_RequestFlush(StripeSmartPtr stripe)
+WriteCompletionStage::_RequestFlush(StripeSmartPtr stripe)
 {
     bool requestFlushSuccessful = true;
     bool parityOnly = volumeManager->IsWriteThroughEnabled();
@@ -41,6 +41,26 @@ namespace pos
 class VolumeIo;
 class IWBStripeAllocator;
 
+// Releases the RBA ownership of a write whose map is updated and hands
+// the stripe to flush once its last block is written.
+// Runs inline as a stage of ComposedCallback, or inside WriteCompletion.
+class WriteCompletionStage
+{
+public:
+    explicit WriteCompletionStage(VolumeIoSmartPtr inputVolumeIo);
+    WriteCompletionStage(VolumeIoSmartPtr inputVolumeIo,
+        IWBStripeAllocator* iWBStripeAllocator, IVolumeInfoManager* volumeManager);
+    void Run(Callback& host, uint32_t errorCount);
+
+private:
+    bool _UpdateStripe(StripeSmartPtr& stripeToFlush);
+    bool _RequestFlush(StripeSmartPtr stripe);
+
+    VolumeIoSmartPtr volumeIo;
+    IWBStripeAllocator* iWBStripeAllocator;
+    IVolumeInfoManager* volumeManager;
+};
+
 class WriteCompletion : public Callback
 {
 public:
@@ -50,12 +70,8 @@ public:
     ~WriteCompletion(void) override;
 
 private:
-    bool _UpdateStripe(StripeSmartPtr& stripeToFlush);
-    bool _RequestFlush(StripeSmartPtr stripe);
     bool _DoSpecificJob(void) override;
 
-    VolumeIoSmartPtr volumeIo;
-    IWBStripeAllocator* iWBStripeAllocator;
-    IVolumeInfoManager* volumeManager;
+    WriteCompletionStage stage;
 };
 } // namespace pos
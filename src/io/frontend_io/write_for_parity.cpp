@@ -58,6 +58,11 @@ WriteForParity::_DoSpecificJob(void)
         .byteSize =(uint32_t)ChangeBlockToByte(blockCount)
     };
 
+    if (volumeIo->IsVectored())
+    {
+        return _CopyIoVectors(blkAddr);
+    }
+
     IOSubmitHandlerStatus ioStatus =
         IIOSubmitHandler::GetInstance()->SubmitAsyncByteIO(
             IODirection::WRITE, volumeIo->GetBuffer(), byteAddr,
@@ -70,4 +75,30 @@ WriteForParity::_DoSpecificJob(void)
     return true;
 }
 
+bool
+WriteForParity::_CopyIoVectors(LogicalBlkAddr startBlkAddr)
+{
+    uint64_t position = 0;
+    for (auto& ioVector : volumeIo->GetIoVectors())
+    {
+        LogicalByteAddr byteAddr = {
+            .blkAddr = {
+                .stripeId = startBlkAddr.stripeId,
+                .offset = startBlkAddr.offset + position / BLOCK_SIZE},
+            .byteOffset = static_cast<uint32_t>(position % BLOCK_SIZE),
+            .byteSize = static_cast<uint32_t>(ioVector.iov_len)};
+
+        IOSubmitHandlerStatus ioStatus =
+            IIOSubmitHandler::GetInstance()->SubmitAsyncByteIO(
+                IODirection::WRITE, ioVector.iov_base, byteAddr,
+                PartitionType::WRITE_BUFFER, nullptr, volumeIo->GetArrayId());
+        if (IOSubmitHandlerStatus::SUCCESS != ioStatus)
+        {
+            return false;
+        }
+        position += ioVector.iov_len;
+    }
+    return true;
+}
+
 } // namespace pos
@@ -45,6 +45,7 @@ public:
 
 private:
     bool _DoSpecificJob(void) final;
+    bool _CopyIoVectors(LogicalBlkAddr startBlkAddr);
     VolumeIoSmartPtr volumeIo;
 };
 
@@ -0,0 +1,134 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io/frontend_io/write_stream_classifier.h"
+
+#include <algorithm>
+
+#include "src/include/memory.h"
+#include "src/include/pos_event_id.h"
+#include "src/logger/logger.h"
+#include "src/master_context/config_manager.h"
+
+namespace pos
+{
+WriteStreamClassifier::WriteStreamClassifier(void)
+: WriteStreamClassifier(ConfigManagerSingleton::Instance())
+{
+}
+
+WriteStreamClassifier::WriteStreamClassifier(ConfigManager* configManager)
+: enabled(false),
+  largeWriteBlks(DEFAULT_LARGE_WRITE_SIZE_IN_KB * 1024 / BLOCK_SIZE)
+{
+    bool enable = false;
+    int ret = configManager->GetValue("performance", "write_stream_separation_enable",
+        &enable, CONFIG_TYPE_BOOL);
+    if (ret != EID(SUCCESS) || false == enable)
+    {
+        return;
+    }
+
+    uint32_t largeWriteSizeInKb = 0;
+    ret = configManager->GetValue("performance", "write_stream_large_write_size_in_kb",
+        &largeWriteSizeInKb, CONFIG_TYPE_UINT32);
+    if (ret == EID(SUCCESS) && 0 != largeWriteSizeInKb)
+    {
+        largeWriteBlks = std::max<uint32_t>(largeWriteSizeInKb * 1024 / BLOCK_SIZE, 1);
+    }
+
+    enabled = true;
+    POS_TRACE_INFO(EID(WRITE_STREAM_SEPARATION_ENABLED),
+        "write_stream_large_write_size_in_kb: {}", largeWriteBlks * BLOCK_SIZE / 1024);
+}
+
+bool
+WriteStreamClassifier::IsEnabled(void)
+{
+    return enabled;
+}
+
+WriteStreamType
+WriteStreamClassifier::Classify(int arrayId, uint32_t volumeId, BlkAddr startRba, uint32_t numBlks)
+{
+    if (false == enabled || arrayId < 0 || arrayId >= ArrayMgmtPolicy::MAX_ARRAY_CNT
+        || volumeId >= MAX_VOLUME_COUNT)
+    {
+        return WRITE_STREAM_MIXED;
+    }
+
+    VolumeStreams& volume = volumes[arrayId][volumeId];
+    std::lock_guard<std::mutex> guard(volume.lock);
+    Stream* stream = _Find(volume, startRba);
+    bool continued = (nullptr != stream);
+    if (false == continued)
+    {
+        stream = _Replace(volume);
+    }
+    stream->nextRba = startRba + numBlks;
+    stream->lastUsed = ++volume.clock;
+
+    if (continued || numBlks >= largeWriteBlks)
+    {
+        return WRITE_STREAM_SEQUENTIAL;
+    }
+    return WRITE_STREAM_RANDOM;
+}
+
+WriteStreamClassifier::Stream*
+WriteStreamClassifier::_Find(VolumeStreams& volume, BlkAddr rba)
+{
+    for (Stream& stream : volume.table)
+    {
+        if (stream.lastUsed > 0 && stream.nextRba == rba)
+        {
+            return &stream;
+        }
+    }
+    return nullptr;
+}
+
+WriteStreamClassifier::Stream*
+WriteStreamClassifier::_Replace(VolumeStreams& volume)
+{
+    Stream* victim = &volume.table[0];
+    for (Stream& stream : volume.table)
+    {
+        if (stream.lastUsed < victim->lastUsed)
+        {
+            victim = &stream;
+        }
+    }
+    return victim;
+}
+
+} // namespace pos
@@ -0,0 +1,89 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+
+#include "src/allocator/include/allocator_const.h"
+#include "src/include/address_type.h"
+#include "src/include/array_mgmt_policy.h"
+#include "src/lib/singleton.h"
+#include "src/volume/volume_base.h"
+
+namespace pos
+{
+class ConfigManager;
+
+// Tells the sequential host writes of a volume from the small random ones, so
+// that the two fill separate active stripes. A write is sequential when it is
+// at least the large write size or when it continues one of the recent writes
+// of its volume.
+class WriteStreamClassifier
+{
+public:
+    WriteStreamClassifier(void);
+    explicit WriteStreamClassifier(ConfigManager* configManager);
+    virtual ~WriteStreamClassifier(void) = default;
+
+    virtual bool IsEnabled(void);
+    virtual WriteStreamType Classify(int arrayId, uint32_t volumeId, BlkAddr startRba, uint32_t numBlks);
+
+    static const uint32_t STREAMS_PER_VOLUME = 4;
+    static const uint32_t DEFAULT_LARGE_WRITE_SIZE_IN_KB = 128;
+
+private:
+    struct Stream
+    {
+        BlkAddr nextRba = 0;
+        uint64_t lastUsed = 0;
+    };
+    struct VolumeStreams
+    {
+        std::array<Stream, STREAMS_PER_VOLUME> table;
+        uint64_t clock = 0;
+        std::mutex lock;
+    };
+
+    Stream* _Find(VolumeStreams& volume, BlkAddr rba);
+    Stream* _Replace(VolumeStreams& volume);
+
+    bool enabled;
+    uint32_t largeWriteBlks;
+    std::array<std::array<VolumeStreams, MAX_VOLUME_COUNT>, ArrayMgmtPolicy::MAX_ARRAY_CNT> volumes;
+};
+
+using WriteStreamClassifierSingleton = Singleton<WriteStreamClassifier>;
+
+} // namespace pos
@@ -52,12 +52,27 @@
 #include "src/include/array_config.h"
 #include "src/include/branch_prediction.h"
 #include "src/include/meta_const.h"
+#include "src/io/frontend_io/access_heatmap.h"
+#include "src/io/frontend_io/access_heatmap_service.h"
 #include "src/io/frontend_io/aio.h"
 #include "src/io/frontend_io/block_map_update_request.h"
+#include "src/io/frontend_io/compression_estimator.h"
+#include "src/io/frontend_io/compression_estimator_service.h"
+#include "src/io/frontend_io/dedup_estimator.h"
+#include "src/io/frontend_io/dedup_estimator_service.h"
+#include "src/io/frontend_io/full_stripe_write.h"
+#include "src/io/frontend_io/partial_write_coalescer.h"
+#include "src/io/frontend_io/partial_write_coalescer_service.h"
 #include "src/io/frontend_io/read_completion_for_partial_write.h"
+#include "src/io/frontend_io/write_buffer_zero_copy.h"
+#include "src/io/frontend_io/write_buffer_zero_copy_service.h"
 #include "src/io/frontend_io/write_for_parity.h"
+#include "src/io/frontend_io/write_stream_classifier.h"
+#include "src/io/frontend_io/zero_block_unmap.h"
 #include "src/io/general_io/rba_state_service.h"
 #include "src/io/general_io/translator.h"
+#include "src/io/general_io/write_amplification_monitor_service.h"
+#include "src/lib/zero_block_detector.h"
 #include "src/logger/logger.h"
 #include "src/spdk_wrapper/event_framework_api.h"
 #include "src/state/state_manager.h"
@@ -90,7 +105,11 @@ WriteSubmission::WriteSubmission(VolumeIoSmartPtr volumeIo, RBAStateManager* inp
   rbaStateManager(inputRbaStateManager),
   iBlockAllocator(inputIBlockAllocator),
   flowControl(inputFlowControl),
-  volumeManager(inputVolumeManager)
+  volumeManager(inputVolumeManager),
+  partialWriteCoalescer(PartialWriteCoalescerServiceSingleton::Instance()->GetPartialWriteCoalescer(volumeIo->GetArrayId())),
+  writeBufferZeroCopy(WriteBufferZeroCopyServiceSingleton::Instance()->GetWriteBufferZeroCopy(volumeIo->GetArrayId())),
+  writeStream(WRITE_STREAM_MIXED),
+  dataPlaced(false)
 {
     airlog("RequestedUserWrite", "user", GetEventType(), 1);
     if (nullptr == volumeManager)
@@ -101,6 +120,31 @@ WriteSubmission::WriteSubmission(VolumeIoSmartPtr volumeIo, RBAStateManager* inp
     {
         flowControl = FlowControlServiceSingleton::Instance()->GetFlowControl(volumeManager->GetArrayName());
     }
+    CompressionEstimator* compressionEstimator =
+        CompressionEstimatorServiceSingleton::Instance()->GetCompressionEstimator(volumeIo->GetArrayId());
+    if (nullptr != compressionEstimator && false == volumeIo->IsVectored())
+    {
+        // The data is sampled before it is submitted, as the host may reuse
+        // the buffer once the write completes
+        compressionEstimator->Sample(volumeId, volumeIo->GetBuffer(), volumeIo->GetSize());
+    }
+    DedupEstimator* dedupEstimator =
+        DedupEstimatorServiceSingleton::Instance()->GetDedupEstimator(volumeIo->GetArrayId());
+    if (nullptr != dedupEstimator && false == volumeIo->IsVectored())
+    {
+        dedupEstimator->Sample(volumeId, volumeIo->GetBuffer(), volumeIo->GetSize());
+    }
+    AccessHeatmap* accessHeatmap =
+        AccessHeatmapServiceSingleton::Instance()->GetAccessHeatmap(volumeIo->GetArrayId());
+    if (nullptr != accessHeatmap)
+    {
+        accessHeatmap->Record(volumeId, volumeIo->GetSectorRba(), true);
+    }
+    // Classified once here, as Execute may be retried
+    writeStream = WriteStreamClassifierSingleton::Instance()->Classify(volumeIo->GetArrayId(),
+        volumeId, blockAlignment.GetHeadBlock(), blockCount);
+    WriteAmplificationMonitorServiceSingleton::Instance()->Add(volumeIo->GetArrayId(),
+        WriteSource::Host, volumeIo->GetSize());
 }
 
 WriteSubmission::~WriteSubmission(void)
@@ -112,6 +156,14 @@ WriteSubmission::Execute(void)
 {
     try
     {
+        if (_WritePlacedData())
+        {
+            uint32_t arrayId = volumeIo->GetArrayId();
+            SmartLogMgrSingleton::Instance()->IncreaseWriteBytes(blockCount, volumeId, arrayId);
+            SmartLogMgrSingleton::Instance()->IncreaseWriteCmds(volumeId, arrayId);
+            volumeIo = nullptr;
+            return true;
+        }
         if (iBlockAllocator->IsProhibitedUserBlkAlloc() == true)
         {
             return false;
@@ -133,9 +185,35 @@ WriteSubmission::Execute(void)
             }
             return false;
         }
+        volumeIo->MarkStage(IoStage::RbaLocked);
+        if (_UnmapZeroBlocks())
+        {
+            rbaStateManager->BulkReleaseOwnership(volumeId, startRba,
+                blockCount);
+            if (0 < token)
+            {
+                flowControl->ReturnToken(FlowControlType::USER, token);
+            }
+            uint32_t arrayId = volumeIo->GetArrayId();
+            SmartLogMgrSingleton::Instance()->IncreaseWriteBytes(blockCount, volumeId, arrayId);
+            SmartLogMgrSingleton::Instance()->IncreaseWriteCmds(volumeId, arrayId);
+            volumeIo = nullptr;
+            return true;
+        }
+        if (false == _ClaimPartialBlocks())
+        {
+            rbaStateManager->BulkReleaseOwnership(volumeId, startRba,
+                blockCount);
+            if (0 < token)
+            {
+                flowControl->ReturnToken(FlowControlType::USER, token);
+            }
+            return false;
+        }
         bool done = _ProcessOwnedWrite();
         if (unlikely(!done))
         {
+            _UnclaimPartialBlocks();
             rbaStateManager->BulkReleaseOwnership(volumeId, startRba,
                 blockCount);
             if (0 < token)
@@ -198,6 +276,37 @@ WriteSubmission::_PopTailVsa(void)
     return {tailVsa, stripeId};
 }
 
+bool
+WriteSubmission::_WritePlacedData(void)
+{
+    if (nullptr == writeBufferZeroCopy || blockAlignment.HasHead() || blockAlignment.HasTail())
+    {
+        return false;
+    }
+
+    // The token, the ownership and the write buffer blocks were all taken
+    // when the transport asked for the buffer the data was received into
+    if (false == writeBufferZeroCopy->Take(volumeId, blockAlignment.GetHeadBlock(), blockCount,
+        volumeIo->GetBuffer(), allocatedVirtualBlks))
+    {
+        return false;
+    }
+    allocatedBlockCount = blockCount;
+    dataPlaced = true;
+    volumeIo->MarkStage(IoStage::RbaLocked);
+    volumeIo->MarkStage(IoStage::BufferAllocated);
+
+    if (allocatedBlockCount == 1)
+    {
+        _WriteSingleBlock();
+    }
+    else
+    {
+        _WriteMultipleBlocks();
+    }
+    return true;
+}
+
 bool
 WriteSubmission::_ProcessOwnedWrite(void)
 {
@@ -207,6 +316,12 @@ WriteSubmission::_ProcessOwnedWrite(void)
     {
         return false;
     }
+    volumeIo->MarkStage(IoStage::BufferAllocated);
+
+    if (_WriteFullStripe())
+    {
+        return true;
+    }
 
     _PrepareBlockAlignment();
     if (processedBlockCount == 0 && allocatedBlockCount == 1)
@@ -221,9 +336,107 @@ WriteSubmission::_ProcessOwnedWrite(void)
     return true;
 }
 
+bool
+WriteSubmission::_WriteFullStripe(void)
+{
+    if (false == FullStripeWrite::IsEnabled() || blockAlignment.HasHead()
+        || blockAlignment.HasTail() || volumeIo->IsVectored()
+        || volumeManager->IsWriteThroughEnabled() || allocatedVirtualBlks.size() != 1)
+    {
+        return false;
+    }
+
+    FullStripeWrite fullStripeWrite(volumeIo);
+    VirtualBlksInfo& virtualBlksInfo = allocatedVirtualBlks.front();
+    if (false == fullStripeWrite.IsFullStripe(virtualBlksInfo.first))
+    {
+        return false;
+    }
+
+    _SetupVolumeIo(volumeIo, virtualBlksInfo, volumeIo->GetCallback());
+    if (false == fullStripeWrite.Execute())
+    {
+        // The volume io is set up for its write buffer blocks as well
+        _SendVolumeIo(volumeIo);
+    }
+    return true;
+}
+
+bool
+WriteSubmission::_UnmapZeroBlocks(void)
+{
+    if (false == ZeroBlockUnmap::IsEnabled() || blockAlignment.HasHead()
+        || blockAlignment.HasTail() || volumeIo->IsVectored())
+    {
+        return false;
+    }
+    if (false == ZeroBlockDetector::IsZero(volumeIo->GetBuffer(), volumeIo->GetSize()))
+    {
+        return false;
+    }
+
+    ZeroBlockUnmap zeroBlockUnmap(volumeIo);
+    if (false == zeroBlockUnmap.Execute())
+    {
+        return false;
+    }
+    IoCompleter ioCompleter(volumeIo);
+    ioCompleter.CompleteUbio(IOErrorType::SUCCESS, true);
+    return true;
+}
+
+bool
+WriteSubmission::_ClaimPartialBlocks(void)
+{
+    if (nullptr == partialWriteCoalescer || volumeManager->IsWriteThroughEnabled())
+    {
+        return true;
+    }
+
+    // A partial block being merged has to wait until its old data is in place
+    if (blockAlignment.HasHead()
+        && false == partialWriteCoalescer->Claim(volumeId, blockAlignment.GetHeadBlock()))
+    {
+        return false;
+    }
+    if (blockAlignment.HasTail()
+        && false == partialWriteCoalescer->Claim(volumeId, blockAlignment.GetTailBlock()))
+    {
+        _UnclaimPartialBlocks();
+        return false;
+    }
+    return true;
+}
+
+void
+WriteSubmission::_UnclaimPartialBlocks(void)
+{
+    if (nullptr == partialWriteCoalescer || volumeManager->IsWriteThroughEnabled())
+    {
+        return;
+    }
+
+    if (blockAlignment.HasHead())
+    {
+        partialWriteCoalescer->Unclaim(volumeId, blockAlignment.GetHeadBlock());
+    }
+    if (blockAlignment.HasTail())
+    {
+        partialWriteCoalescer->Unclaim(volumeId, blockAlignment.GetTailBlock());
+    }
+}
+
 void
 WriteSubmission::_SendVolumeIo(VolumeIoSmartPtr volumeIo)
 {
+    if (dataPlaced)
+    {
+        // The data is in its write buffer blocks already
+        IoCompleter ioCompleter(volumeIo);
+        ioCompleter.CompleteUbio(IOErrorType::SUCCESS, true);
+        return;
+    }
+
     bool isRead = (volumeIo->dir == UbioDir::Read);
     bool isWTEnabled = volumeManager->IsWriteThroughEnabled();
 
@@ -362,6 +575,18 @@ WriteSubmission::_ReadOldBlock(BlkAddr rba, VirtualBlkAddrInfo& vsaInfo, bool is
     CallbackSmartPtr callback(new BlockMapUpdateRequest(split));
     split->SetCallback(callback);
 
+    const bool isRead = true;
+    Translator oldDataTranslator(volumeId, rba, volumeIo->GetArrayId(), isRead);
+    StripeAddr oldLsidEntry = oldDataTranslator.GetLsidEntry(0);
+
+    processedBlockCount++;
+    if (_WriteWithoutOldBlock(rba, vsaInfo, split, oldDataTranslator,
+            alignmentOffset, alignmentSize))
+    {
+        splitVolumeIoQueue.push(split);
+        return;
+    }
+
     VolumeIoSmartPtr newVolumeIo(new VolumeIo(nullptr, Ubio::UNITS_PER_BLOCK, volumeIo->GetArrayId()));
 
     newVolumeIo->SetVolumeId(volumeId);
@@ -373,14 +598,8 @@ WriteSubmission::_ReadOldBlock(BlkAddr rba, VirtualBlkAddrInfo& vsaInfo, bool is
     uint64_t sectorRba = ChangeBlockToSector(rba);
     newVolumeIo->SetSectorRba(sectorRba);
     newVolumeIo->SetVsa(vsa);
-
-    const bool isRead = true;
-    Translator oldDataTranslator(volumeId, rba, volumeIo->GetArrayId(), isRead);
-    StripeAddr oldLsidEntry = oldDataTranslator.GetLsidEntry(0);
-
     newVolumeIo->SetOldLsidEntry(oldLsidEntry);
 
-    processedBlockCount++;
     if (oldDataTranslator.IsMapped())
     {
         newVolumeIo->dir = UbioDir::Read;
@@ -391,6 +610,35 @@ WriteSubmission::_ReadOldBlock(BlkAddr rba, VirtualBlkAddrInfo& vsaInfo, bool is
     splitVolumeIoQueue.push(newVolumeIo);
 }
 
+bool
+WriteSubmission::_WriteWithoutOldBlock(BlkAddr rba, VirtualBlkAddrInfo& vsaInfo,
+    VolumeIoSmartPtr split, Translator& oldDataTranslator,
+    uint32_t alignmentOffset, uint32_t alignmentSize)
+{
+    if (nullptr == partialWriteCoalescer || volumeManager->IsWriteThroughEnabled())
+    {
+        return false;
+    }
+
+    PartialWriteResult result = partialWriteCoalescer->Coalesce(volumeId, rba,
+        oldDataTranslator.GetVsa(0), oldDataTranslator.GetLsidEntry(0), vsaInfo.first,
+        ChangeByteToSector(alignmentOffset), ChangeByteToSector(alignmentSize));
+    if (PartialWriteResult::Deferred != result)
+    {
+        return false;
+    }
+
+    // Only the written sectors go to the new block, the rest stays in the base
+    Translator newDataTranslator(vsaInfo.first, volumeIo->GetArrayId(), vsaInfo.second);
+    PhysicalBlkAddr pba = newDataTranslator.GetPba();
+    pba.lba += ChangeByteToSector(alignmentOffset);
+    split->SetPba(pba);
+    StripeAddr lsidEntry = newDataTranslator.GetLsidEntry(0);
+    split->SetLsidEntry(lsidEntry);
+    split->SetUserLsid(vsaInfo.second);
+    return true;
+}
+
 void
 WriteSubmission::_AllocateFreeWriteBuffer(void)
 {
@@ -402,13 +650,16 @@ WriteSubmission::_AllocateFreeWriteBuffer(void)
         return;
     }
 
+    // The journal finds the active stripe of the blocks by the stream of the io
+    volumeIo->SetWriteStream(writeStream);
     while (remainBlockCount > 0)
     {
         VirtualBlks targetVsaRange;
 
         uint64_t key = reinterpret_cast<uint64_t>(this) + allocatedBlockCount;
         airlog("LAT_WrSb_AllocWriteBuf", "begin", 0, key);
-        auto result = iBlockAllocator->AllocateWriteBufferBlks(volumeId, remainBlockCount);
+        auto result = iBlockAllocator->AllocateWriteBufferBlks(volumeId, remainBlockCount,
+            volumeIo->GetOriginCore(), writeStream);
         targetVsaRange = result.first;
         airlog("LAT_WrSb_AllocWriteBuf", "end", 0, key);
 
@@ -56,6 +56,9 @@ class VolumeIo;
 class RBAStateManager;
 class IBlockAllocator;
 class FlowControl;
+class PartialWriteCoalescer;
+class Translator;
+class WriteBufferZeroCopy;
 
 class WriteSubmission : public IOController, public Event
 {
@@ -81,11 +84,23 @@ private:
     IBlockAllocator* iBlockAllocator;
     FlowControl* flowControl;
     IVolumeInfoManager* volumeManager;
+    PartialWriteCoalescer* partialWriteCoalescer;
+    WriteBufferZeroCopy* writeBufferZeroCopy;
+    WriteStreamType writeStream;
+    bool dataPlaced;
 
     void _SendVolumeIo(VolumeIoSmartPtr volumeIo);
+    bool _WritePlacedData(void);
     bool _ProcessOwnedWrite(void);
+    bool _WriteFullStripe(void);
+    bool _UnmapZeroBlocks(void);
+    bool _ClaimPartialBlocks(void);
+    void _UnclaimPartialBlocks(void);
     void _AllocateFreeWriteBuffer(void);
     void _ReadOldBlock(BlkAddr rba, VirtualBlkAddrInfo& vsaInfo, bool isTail);
+    bool _WriteWithoutOldBlock(BlkAddr rba, VirtualBlkAddrInfo& vsaInfo,
+        VolumeIoSmartPtr split, Translator& oldDataTranslator,
+        uint32_t alignmentOffset, uint32_t alignmentSize);
     void _AddVirtualBlks(VirtualBlksInfo& virtualBlks);
     VolumeIoSmartPtr _CreateVolumeIo(VirtualBlksInfo& virtualBlksInfo);
     void _PrepareSingleBlock(VirtualBlksInfo& virtualBlksInfo);
@@ -0,0 +1,134 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io/frontend_io/zero_block_unmap.h"
+
+#include "src/allocator/i_context_manager.h"
+#include "src/allocator_service/allocator_service.h"
+#include "src/include/branch_prediction.h"
+#include "src/include/pos_event_id.h"
+#include "src/io/general_io/vsa_range_maker.h"
+#include "src/logger/logger.h"
+#include "src/mapper_service/mapper_service.h"
+#include "src/master_context/config_manager.h"
+
+namespace pos
+{
+ZeroBlockUnmap::ZeroBlockUnmap(VolumeIoSmartPtr volumeIo)
+: ZeroBlockUnmap(volumeIo,
+      MapperServiceSingleton::Instance()->GetIVSAMap(volumeIo->GetArrayId()),
+      AllocatorServiceSingleton::Instance()->GetIContextManager(volumeIo->GetArrayId())->GetSegmentContextUpdaterPtr(),
+      new VsaRangeMaker(volumeIo->GetVolumeId(), ChangeSectorToBlock(volumeIo->GetSectorRba()),
+          DivideUp(volumeIo->GetSize(), BLOCK_SIZE), volumeIo->GetArrayId()))
+{
+}
+
+ZeroBlockUnmap::ZeroBlockUnmap(VolumeIoSmartPtr volumeIo, IVSAMap* vsaMap,
+    ISegmentCtx* segmentCtx, VsaRangeMaker* oldVsaRangeMaker)
+: volumeIo(volumeIo),
+  vsaMap(vsaMap),
+  segmentCtx(segmentCtx),
+  oldVsaRangeMaker(oldVsaRangeMaker)
+{
+}
+
+ZeroBlockUnmap::~ZeroBlockUnmap(void)
+{
+    if (oldVsaRangeMaker != nullptr)
+    {
+        delete oldVsaRangeMaker;
+        oldVsaRangeMaker = nullptr;
+    }
+}
+
+bool
+ZeroBlockUnmap::Execute(void)
+{
+    uint32_t volumeId = volumeIo->GetVolumeId();
+    BlkAddr rba = ChangeSectorToBlock(volumeIo->GetSectorRba());
+    VirtualBlks unmapRange = {
+        .startVsa = UNMAP_VSA,
+        .numBlks = DivideUp(volumeIo->GetSize(), BLOCK_SIZE)};
+    int ret = vsaMap->SetVSAs(volumeId, rba, unmapRange);
+    if (unlikely(ret < 0))
+    {
+        POS_TRACE_WARN(EID(ZERO_BLOCK_UNMAP_FAILED),
+            "Zero blocks are written instead, volume_id:{}, rba:{}, block_count:{}",
+            volumeId, rba, unmapRange.numBlks);
+        return false;
+    }
+
+    // The caller owns the rbas, so the old blocks are still the ones read
+    // before the map was changed
+    uint32_t vsaRangeCount = oldVsaRangeMaker->GetCount();
+    for (uint32_t vsaRangeIndex = 0; vsaRangeIndex < vsaRangeCount; vsaRangeIndex++)
+    {
+        bool allowVictimSegRelease = false;
+        segmentCtx->InvalidateBlks(oldVsaRangeMaker->GetVsaRange(vsaRangeIndex),
+            allowVictimSegRelease);
+    }
+    return true;
+}
+
+bool
+ZeroBlockUnmap::IsEnabled(void)
+{
+    static bool enabled = LoadConfig(ConfigManagerSingleton::Instance());
+    return enabled;
+}
+
+bool
+ZeroBlockUnmap::LoadConfig(ConfigManager* configManager)
+{
+    bool unmapEnabled = false;
+    int ret = configManager->GetValue("performance", "zero_block_unmap_enable",
+        &unmapEnabled, CONFIG_TYPE_BOOL);
+    if (ret != EID(SUCCESS) || false == unmapEnabled)
+    {
+        return false;
+    }
+
+    // Unmapping is not logged, so the journal would replay the old blocks
+    bool journalEnabled = false;
+    ret = configManager->GetValue("journal", "enable", &journalEnabled, CONFIG_TYPE_BOOL);
+    if (ret == EID(SUCCESS) && true == journalEnabled)
+    {
+        POS_TRACE_WARN(EID(ZERO_BLOCK_UNMAP_FAILED),
+            "Zero block unmap needs the journal to be disabled");
+        return false;
+    }
+
+    POS_TRACE_INFO(EID(ZERO_BLOCK_UNMAP_ENABLED), "Zero block unmap is enabled");
+    return true;
+}
+
+} // namespace pos
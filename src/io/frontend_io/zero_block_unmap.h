@@ -0,0 +1,68 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "src/allocator/i_segment_ctx.h"
+#include "src/bio/volume_io.h"
+#include "src/include/address_type.h"
+#include "src/mapper/i_vsamap.h"
+
+namespace pos
+{
+class ConfigManager;
+class VsaRangeMaker;
+
+// Maps the blocks of an all-zero write to UNMAP_VSA instead of writing them.
+// Their old blocks are invalidated as an overwrite would do, and reads of
+// unmapped blocks return zeros while this is enabled.
+class ZeroBlockUnmap
+{
+public:
+    explicit ZeroBlockUnmap(VolumeIoSmartPtr volumeIo);
+    ZeroBlockUnmap(VolumeIoSmartPtr volumeIo, IVSAMap* vsaMap,
+        ISegmentCtx* segmentCtx, VsaRangeMaker* oldVsaRangeMaker);
+    virtual ~ZeroBlockUnmap(void);
+
+    virtual bool Execute(void);
+
+    static bool IsEnabled(void);
+    static bool LoadConfig(ConfigManager* configManager);
+
+private:
+    VolumeIoSmartPtr volumeIo;
+    IVSAMap* vsaMap;
+    ISegmentCtx* segmentCtx;
+    VsaRangeMaker* oldVsaRangeMaker;
+};
+
+} // namespace pos
@@ -0,0 +1,87 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io/general_io/block_checksum.h"
+
+#include <isa-l.h>
+
+#include "src/include/memory.h"
+#include "src/include/pos_event_id.h"
+#include "src/logger/logger.h"
+#include "src/mapper/reversemap/reverse_map.h"
+#include "src/master_context/config_manager.h"
+
+namespace pos
+{
+uint32_t
+BlockChecksum::Compute(const void* block)
+{
+    uint32_t crc = crc32_iscsi(static_cast<unsigned char*>(const_cast<void*>(block)),
+        BLOCK_SIZE, 0xFFFFFFFF);
+    uint32_t checksum = crc & NO_REVMAP_CHECKSUM;
+    if (checksum == NO_REVMAP_CHECKSUM)
+    {
+        checksum--;
+    }
+    return checksum;
+}
+
+bool
+BlockChecksum::Verify(const void* block, uint32_t checksum)
+{
+    return Compute(block) == checksum;
+}
+
+bool
+BlockChecksum::IsEnabled(void)
+{
+    static bool enabled = LoadConfig(ConfigManagerSingleton::Instance());
+    return enabled;
+}
+
+bool
+BlockChecksum::LoadConfig(ConfigManager* configManager)
+{
+    bool enabled = false;
+    int ret = configManager->GetValue("performance", "block_checksum_enable",
+        &enabled, CONFIG_TYPE_BOOL);
+    if (ret != EID(SUCCESS) || false == enabled)
+    {
+        return false;
+    }
+
+    POS_TRACE_INFO(EID(BLOCK_CHECKSUM_ENABLED),
+        "Block checksums are computed on write and verified on read");
+    return true;
+}
+
+} // namespace pos
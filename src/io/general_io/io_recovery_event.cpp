@@ -39,6 +39,7 @@
 #include "src/include/backend_event.h"
 #include "src/include/branch_prediction.h"
 #include "src/io/backend_io/rebuild_io/rebuild_read.h"
+#include "src/io_scheduler/io_dispatcher.h"
 
 namespace pos
 {
@@ -77,7 +78,17 @@ IoRecoveryEvent::Execute(void)
             int ret = rebuildRead.Recover(ubio);
             if (unlikely(0 != ret))
             {
-                ioCompleter->CompleteUbioWithoutRecovery(errorType, true);
+                if (IOErrorType::SUCCESS == errorType)
+                {
+                    // Read from peers was requested for a slow but healthy device,
+                    // so the device itself can still serve the read
+                    ubio->SetRetry(false);
+                    IODispatcherSingleton::Instance()->Submit(ubio, false, false);
+                }
+                else
+                {
+                    ioCompleter->CompleteUbioWithoutRecovery(errorType, true);
+                }
             }
             break;
         }
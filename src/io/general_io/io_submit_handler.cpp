@@ -34,17 +34,24 @@
 
 #include <air/Air.h>
 
+#include <future>
 #include <list>
 #include <string>
+#include <vector>
 
+#include "src/array/service/array_service_layer.h"
+#include "src/array_mgmt/array_manager.h"
+#include "src/event_scheduler/continuation_callback.h"
 #include "src/include/branch_prediction.h"
 #include "src/include/pos_event_id.h"
 #include "src/io/general_io/io_submit_handler_count.h"
+#include "src/io/general_io/merged_io.h"
 #include "src/io/general_io/submit_async_byte_io.h"
 #include "src/io/general_io/submit_async_read.h"
 #include "src/io/general_io/submit_async_write.h"
-#include "src/io/general_io/sync_io_completion.h"
+#include "src/io_scheduler/io_dispatcher.h"
 #include "src/logger/logger.h"
+#include "src/state/state_manager.h"
 
 namespace pos
 {
@@ -63,10 +70,9 @@ IOSubmitHandler::SyncIO(
     LogicalBlkAddr& startLSA, uint64_t blockCount,
     PartitionType partitionToIO, int arrayId)
 {
-    std::atomic<bool> needToWait(true);
     uint32_t errorCount = 0;
-
-    CallbackSmartPtr callback(new SyncIoCompletion(needToWait, errorCount));
+    std::future<uint32_t> completion;
+    CallbackSmartPtr callback = ContinuationCallback::WithFuture(completion, CallbackType_SyncIoCompletion);
 
     IOSubmitHandlerStatus errorToReturn = SubmitAsyncIO(direction, bufferList,
         startLSA, blockCount, partitionToIO, callback, arrayId);
@@ -74,10 +80,8 @@ IOSubmitHandler::SyncIO(
     if (IOSubmitHandlerStatus::SUCCESS == errorToReturn ||
         IOSubmitHandlerStatus::FAIL_IN_SYSTEM_STOP == errorToReturn)
     {
-        while (needToWait)
-        {
-            usleep(1);
-        }
+        // The caller sleeps until the completion is delivered instead of polling for it
+        errorCount = completion.get();
     }
 
     if (errorCount > 0 && errorToReturn == IOSubmitHandlerStatus::SUCCESS)
@@ -135,6 +139,52 @@ IOSubmitHandler::SubmitAsyncIO(
     return errorToReturn;
 }
 
+// Reads of all the ranges are translated first and the ubios made from them
+// are dispatched together, so that each IOWorker queue takes its share once.
+// Writes need the parity and the stripe lock of each range, so they keep being
+// submitted range by range.
+IOSubmitHandlerStatus
+IOSubmitHandler::SubmitAsyncIOBatch(
+    IODirection direction,
+    std::vector<AsyncIORequest>& requests,
+    PartitionType partitionToIO,
+    int arrayId)
+{
+    if (IODirection::READ != direction)
+    {
+        return IIOSubmitHandler::SubmitAsyncIOBatch(direction, requests,
+            partitionToIO, arrayId);
+    }
+
+    IOSubmitHandlerStatus errorToReturn = IOSubmitHandlerStatus::SUCCESS;
+    IIOTranslator* translator = ArrayService::Instance()->Getter()->GetTranslator();
+    std::vector<UbioSmartPtr> ubios;
+    for (auto& request : requests)
+    {
+        MergedIO* mergedIO = new MergedIO(request.callback);
+        mergedIO->GatherInto(&ubios);
+        SubmitAsyncRead asyncRead(mergedIO, translator);
+        IOSubmitHandlerCountSingleton::Instance()->pendingRead++;
+        IOSubmitHandlerStatus status = asyncRead.Execute(request.bufferList,
+            request.startLSA, request.blockCount, partitionToIO,
+            request.callback, arrayId);
+        if (status != IOSubmitHandlerStatus::SUCCESS &&
+            errorToReturn == IOSubmitHandlerStatus::SUCCESS)
+        {
+            errorToReturn = status;
+        }
+    }
+
+    if (ubios.empty() == false && IODispatcherSingleton::Instance()->SubmitBatch(ubios) < 0)
+    {
+        if (_CheckAsyncBatchError(arrayId) == IOSubmitHandlerStatus::FAIL_IN_SYSTEM_STOP)
+        {
+            errorToReturn = IOSubmitHandlerStatus::FAIL_IN_SYSTEM_STOP;
+        }
+    }
+    return errorToReturn;
+}
+
 IOSubmitHandlerStatus
 IOSubmitHandler::SubmitAsyncByteIO(
     IODirection direction,
@@ -153,4 +203,21 @@ IOSubmitHandler::SubmitAsyncByteIO(
         buffer, startLSA, partitionToIO, callback, arrayId);
     return errorToReturn;
 }
+
+IOSubmitHandlerStatus
+IOSubmitHandler::_CheckAsyncBatchError(int arrayId)
+{
+    /*To do Remove after adding array Idx by Array*/
+    IArrayInfo* info = ArrayMgr()->GetInfo(arrayId)->arrayInfo;
+
+    IStateControl* stateControl = StateManagerSingleton::Instance()->GetStateControl(info->GetName());
+    if (stateControl->GetState()->ToStateType() == StateEnum::STOP)
+    {
+        POS_EVENT_ID eventId = EID(REF_COUNT_RAISE_FAIL);
+        POS_TRACE_ERROR(eventId, "When Io Submit, refcount raise fail");
+        return IOSubmitHandlerStatus::FAIL_IN_SYSTEM_STOP;
+    }
+
+    return IOSubmitHandlerStatus::SUCCESS;
+}
 } // namespace pos
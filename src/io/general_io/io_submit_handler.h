@@ -35,6 +35,7 @@
 #include <cstdint>
 #include <list>
 #include <string>
+#include <vector>
 
 #include "src/array/ft/buffer_entry.h"
 #include "src/include/address_type.h"
@@ -50,6 +51,8 @@ class IOSubmitHandler : public IIOSubmitHandler
 public:
     IOSubmitHandler(void);
     ~IOSubmitHandler(void);
+    using IIOSubmitHandler::SubmitAsyncIO;
+
     IOSubmitHandlerStatus SyncIO(IODirection direction,
         std::list<BufferEntry>& bufferList,
         LogicalBlkAddr& startLSA, uint64_t blockCount,
@@ -61,11 +64,18 @@ public:
         PartitionType partitionToIO,
         CallbackSmartPtr callback, int arrayId, bool parityOnly = false);
 
+    IOSubmitHandlerStatus SubmitAsyncIOBatch(IODirection direction,
+        std::vector<AsyncIORequest>& requests,
+        PartitionType partitionToIO, int arrayId) override;
+
     IOSubmitHandlerStatus SubmitAsyncByteIO(IODirection direction,
         void* buffer,
         LogicalByteAddr& startLSA,
         PartitionType partitionToIO,
         CallbackSmartPtr callback, int arrayId);
+
+private:
+    IOSubmitHandlerStatus _CheckAsyncBatchError(int arrayId);
 };
 
 } // namespace pos
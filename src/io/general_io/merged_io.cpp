@@ -34,6 +34,8 @@
 
 #include "src/array/ft/buffer_entry.h"
 #include "src/bio/ubio.h"
+#include "src/device/base/ublock_device.h"
+#include "src/include/i_array_device.h"
 #include "src/include/memory.h"
 #include "src/io/general_io/internal_read_completion.h"
 #include "src/io_scheduler/io_dispatcher.h"
@@ -48,10 +50,12 @@ namespace pos
 {
 MergedIO::MergedIO(CallbackSmartPtr callback, IODispatcher* inputIoDispatcher, StateType intputStateType)
 : bufferEntry(new BufferEntry(nullptr, 0)),
+  segmentedBlockCount(0),
   startPba({.lba = static_cast<uint64_t>(-1), .arrayDev = nullptr}),
   nextContiguousLba(UINT64_MAX),
   callback(callback),
-  stateType(intputStateType)
+  stateType(intputStateType),
+  gatheredUbios(nullptr)
 {
     if (inputIoDispatcher == nullptr)
     {
@@ -72,6 +76,8 @@ void
 MergedIO::Reset(void)
 {
     bufferEntry->Reset();
+    ioVectors.clear();
+    segmentedBlockCount = 0;
     startPba = {.lba = static_cast<uint64_t>(-1), .arrayDev = nullptr};
     nextContiguousLba = static_cast<uint64_t>(-1);
 }
@@ -85,9 +91,20 @@ MergedIO::AddContiguousBlock(void)
     nextContiguousLba += SECTORS_PER_BLOCK;
 }
 
+void
+MergedIO::AddContiguousSegment(void* newBuffer)
+{
+    _PushCurrentSegment();
+    bufferEntry->SetBuffer(newBuffer);
+    bufferEntry->SetBlkCnt(1);
+    nextContiguousLba += SECTORS_PER_BLOCK;
+}
+
 void
 MergedIO::SetNewStart(void* newBuffer, PhysicalBlkAddr& newPba)
 {
+    ioVectors.clear();
+    segmentedBlockCount = 0;
     bufferEntry->SetBuffer(newBuffer);
     bufferEntry->SetBlkCnt(1);
     startPba = newPba;
@@ -104,6 +121,31 @@ MergedIO::IsContiguous(PhysicalBlkAddr& targetPba)
     return isContiguous;
 }
 
+bool
+MergedIO::CanAddSegment(PhysicalBlkAddr& targetPba)
+{
+    if (IsContiguous(targetPba) == false || 0 == bufferEntry->GetBlkCnt())
+    {
+        return false;
+    }
+    if (ioVectors.size() + 1 >= MAX_SEGMENT_COUNT)
+    {
+        return false;
+    }
+
+    // Only the nvme driver can gather a scattered buffer into one command.
+    UBlockDevice* ublock = targetPba.arrayDev->GetUblockPtr();
+    return (ublock != nullptr && ublock->GetType() == DeviceType::SSD);
+}
+
+// The ubios made afterwards are kept in the given list for the caller to
+// submit them together, instead of being submitted one by one
+void
+MergedIO::GatherInto(std::vector<UbioSmartPtr>* ubios)
+{
+    gatheredUbios = ubios;
+}
+
 IOSubmitHandlerStatus
 MergedIO::Process(int arrayId)
 {
@@ -112,8 +154,20 @@ MergedIO::Process(int arrayId)
     if (0 < bufferEntry->GetBlkCnt())
     {
         uint32_t blockCount = bufferEntry->GetBlkCnt();
-        UbioSmartPtr ubio(new Ubio(bufferEntry->GetBufferPtr(),
-            blockCount * Ubio::UNITS_PER_BLOCK, arrayId));
+        UbioSmartPtr ubio;
+        if (ioVectors.empty())
+        {
+            ubio = UbioSmartPtr(new Ubio(bufferEntry->GetBufferPtr(),
+                blockCount * Ubio::UNITS_PER_BLOCK, arrayId));
+        }
+        else
+        {
+            std::vector<struct iovec> segments(ioVectors);
+            segments.push_back({.iov_base = bufferEntry->GetBufferPtr(),
+                .iov_len = blockCount * BLOCK_SIZE});
+            blockCount += segmentedBlockCount;
+            ubio = UbioSmartPtr(new Ubio(segments, arrayId));
+        }
         ubio->SetPba(startPba);
 
         CallbackSmartPtr event(new InternalReadCompletion(blockCount));
@@ -121,7 +175,11 @@ MergedIO::Process(int arrayId)
         event->SetCallee(callback);
         ubio->SetCallback(event);
         ubio->SetEventType(callback->GetEventType());
-        if (ioDispatcher->Submit(ubio) < 0)
+        if (nullptr != gatheredUbios)
+        {
+            gatheredUbios->push_back(ubio);
+        }
+        else if (ioDispatcher->Submit(ubio) < 0)
         {
             IOSubmitHandlerStatus status =
                 _CheckAsyncReadError(arrayId);
@@ -153,4 +211,15 @@ MergedIO::_CheckAsyncReadError(int arrayId)
     return IOSubmitHandlerStatus::SUCCESS;
 }
 
+void
+MergedIO::_PushCurrentSegment(void)
+{
+    uint32_t blockCount = bufferEntry->GetBlkCnt();
+    struct iovec segment = {
+        .iov_base = bufferEntry->GetBufferPtr(),
+        .iov_len = blockCount * BLOCK_SIZE};
+    ioVectors.push_back(segment);
+    segmentedBlockCount += blockCount;
+}
+
 } // namespace pos
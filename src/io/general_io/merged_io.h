@@ -32,12 +32,16 @@
 
 #pragma once
 
+#include <sys/uio.h>
+
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "src/event_scheduler/callback.h"
 #include "src/include/address_type.h"
 #include "src/include/pos_event_id.hpp"
+#include "src/include/smart_ptr_type.h"
 #include "src/io_submit_interface/io_submit_handler_status.h"
 #include "src/state/state_context.h"
 
@@ -55,17 +59,26 @@ public:
     void Reset(void);
     IOSubmitHandlerStatus Process(int arrayId);
     void AddContiguousBlock(void);
+    void AddContiguousSegment(void* newBuffer);
     void SetNewStart(void* newBuffer, PhysicalBlkAddr& newPba);
     bool IsContiguous(PhysicalBlkAddr& targetPba);
+    bool CanAddSegment(PhysicalBlkAddr& targetPba);
+    void GatherInto(std::vector<UbioSmartPtr>* ubios);
+
+    static const uint32_t MAX_SEGMENT_COUNT = 32;
 
 private:
     BufferEntry* bufferEntry;
+    std::vector<struct iovec> ioVectors;
+    uint32_t segmentedBlockCount;
     PhysicalBlkAddr startPba;
     uint64_t nextContiguousLba;
     CallbackSmartPtr callback;
     IODispatcher* ioDispatcher;
     StateType stateType;
+    std::vector<UbioSmartPtr>* gatheredUbios;
 
     IOSubmitHandlerStatus _CheckAsyncReadError(int arrayId);
+    void _PushCurrentSegment(void);
 };
 } // namespace pos
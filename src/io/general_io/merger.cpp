@@ -32,6 +32,8 @@
 
 #include "src/io/general_io/merger.h"
 
+#include <string.h>
+
 #include "src/event_scheduler/callback_factory.h"
 
 namespace pos
@@ -88,6 +90,15 @@ Merger::_IsMergable(PhysicalBlkAddr& pba, VirtualBlkAddr& vsa)
     return isSameDevice & isContiguous & isSameStripe;
 }
 
+void
+Merger::AddZero(uint32_t targetSize)
+{
+    // The data is filled here, so no split is made for it
+    Cut();
+    VolumeIoSmartPtr zeroPart = originalVolumeIo->Split(ChangeByteToSector(targetSize), false);
+    zeroPart->FillZero();
+}
+
 VolumeIoSmartPtr
 Merger::GetSplit(uint32_t index)
 {
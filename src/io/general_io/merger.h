@@ -49,6 +49,7 @@ public:
     }
     virtual void Add(PhysicalBlkAddr& pba, VirtualBlkAddr& vsa, StripeAddr& lsidEntry,
         uint32_t targetSize);
+    virtual void AddZero(uint32_t targetSize);
     virtual void Cut(void);
     virtual uint32_t GetSplitCount(void);
     virtual VolumeIoSmartPtr GetSplit(uint32_t index);
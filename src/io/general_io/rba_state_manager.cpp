@@ -102,6 +102,13 @@ RBAStateManager::DeleteRBAState(uint32_t volumeID)
     targetVolume.SetSize(0);
 }
 
+void
+RBAStateManager::GrowRBAState(uint32_t volumeID, uint64_t totalRBACount)
+{
+    RBAStatesInVolume& targetVolume = rbaStatesInArray[volumeID];
+    targetVolume.Grow(totalRBACount);
+}
+
 bool
 RBAStateManager::BulkAcquireOwnership(uint32_t volumeID,
     BlkAddr startRba,
@@ -196,31 +203,9 @@ RBAStateManager::_ReleaseOwnership(uint32_t volumeID, BlkAddr startRba,
     targetVolume.ReleaseOwnership(startRba, count);
 }
 
-RBAStateManager::RBAState::RBAState(void)
-: ownered(ATOMIC_FLAG_INIT)
-{
-}
-
-bool
-RBAStateManager::RBAState::AcquireOwnership(RBAOwnerType owner)
-{
-    bool acquired = (ownered.test_and_set(memory_order_relaxed) == false);
-    if (acquired == true)
-    {
-        this->owner = owner;
-    }
-    return acquired;
-}
-
-void
-RBAStateManager::RBAState::ReleaseOwnership(void)
-{
-    ownered.clear(memory_order_relaxed);
-    this->owner = RBAOwnerType::NoOwner;
-}
-
 RBAStateManager::RBAStatesInVolume::RBAStatesInVolume(void)
-: rbaStates(nullptr),
+: chunkTable(nullptr),
+  numChunks(0),
   size(0)
 {
 }
@@ -231,14 +216,21 @@ RBAStateManager::RBAStatesInVolume::AcquireOwnership(BlkAddr startRba, uint32_t
     BlkAddr endRba = startRba + cnt - 1;
     if (likely(_IsAccessibleRba(endRba)))
     {
-        BlkAddr targetRba = startRba;
-        for (; targetRba <= endRba; targetRba++)
+        uint64_t ownerBits = _GetOwnerPattern(owner);
+        uint64_t startWord = startRba / RBAS_PER_WORD;
+        uint64_t endWord = endRba / RBAS_PER_WORD;
+        for (uint64_t word = startWord; word <= endWord; word++)
         {
-            bool targetAcquired = rbaStates[targetRba].AcquireOwnership(owner);
+            uint32_t startSlot = (word == startWord) ? (startRba % RBAS_PER_WORD) : 0;
+            uint32_t endSlot = (word == endWord) ? (endRba % RBAS_PER_WORD) : (RBAS_PER_WORD - 1);
+            bool targetAcquired = _AcquireWord(word, _GetMask(startSlot, endSlot), ownerBits);
             if (targetAcquired == false)
             {
-                uint32_t acquiredCount = targetRba - startRba;
-                ReleaseOwnership(startRba, acquiredCount);
+                if (word != startWord)
+                {
+                    BlkAddr lastAcquiredRba = word * RBAS_PER_WORD - 1;
+                    _ReleaseWords(startRba, lastAcquiredRba);
+                }
                 return false;
             }
         }
@@ -253,31 +245,139 @@ RBAStateManager::RBAStatesInVolume::ReleaseOwnership(BlkAddr startRba, uint32_t
     BlkAddr endRba = startRba + cnt - 1;
     if (likely(_IsAccessibleRba(endRba)))
     {
-        for (BlkAddr targetRba = startRba; targetRba <= endRba; targetRba++)
+        _ReleaseWords(startRba, endRba);
+    }
+}
+
+bool
+RBAStateManager::RBAStatesInVolume::_AcquireWord(uint64_t wordIndex, uint64_t mask, uint64_t ownerBits)
+{
+    std::atomic<uint64_t>& word = _GetWord(wordIndex);
+    uint64_t expected = word.load(memory_order_relaxed);
+    do
+    {
+        if ((expected & mask) != 0)
         {
-            rbaStates[targetRba].ReleaseOwnership();
+            return false;
         }
+    } while (word.compare_exchange_weak(expected, expected | (ownerBits & mask),
+        memory_order_acquire, memory_order_relaxed) == false);
+    return true;
+}
+
+void
+RBAStateManager::RBAStatesInVolume::_ReleaseWords(BlkAddr startRba, BlkAddr endRba)
+{
+    uint64_t startWord = startRba / RBAS_PER_WORD;
+    uint64_t endWord = endRba / RBAS_PER_WORD;
+    for (uint64_t word = startWord; word <= endWord; word++)
+    {
+        uint32_t startSlot = (word == startWord) ? (startRba % RBAS_PER_WORD) : 0;
+        uint32_t endSlot = (word == endWord) ? (endRba % RBAS_PER_WORD) : (RBAS_PER_WORD - 1);
+        _GetWord(word).fetch_and(~_GetMask(startSlot, endSlot), memory_order_release);
     }
 }
 
+uint64_t
+RBAStateManager::RBAStatesInVolume::_GetMask(uint32_t startSlot, uint32_t endSlot)
+{
+    uint32_t lowBit = startSlot * BITS_PER_RBA;
+    uint32_t highBit = (endSlot + 1) * BITS_PER_RBA;
+    uint64_t upper = (highBit >= 64) ? UINT64_MAX : ((1ULL << highBit) - 1);
+    uint64_t lower = (1ULL << lowBit) - 1;
+    return upper & ~lower;
+}
+
+uint64_t
+RBAStateManager::RBAStatesInVolume::_GetOwnerPattern(RBAOwnerType owner)
+{
+    // replicate the 2-bit owner value over every slot of a word
+    uint64_t value = static_cast<uint64_t>(owner);
+    return value * 0x5555555555555555ULL;
+}
+
 void
 RBAStateManager::RBAStatesInVolume::SetSize(uint64_t newSize)
 {
     if (newSize == 0)
     {
-        if (rbaStates != nullptr)
+        _Free();
+    }
+    else if (size.load(memory_order_relaxed) == 0)
+    {
+        _Grow(newSize);
+    }
+}
+
+void
+RBAStateManager::RBAStatesInVolume::Grow(uint64_t newSize)
+{
+    if (newSize > size.load(memory_order_relaxed))
+    {
+        _Grow(newSize);
+    }
+}
+
+// The slots past the old size are still clear, as nothing could acquire them
+void
+RBAStateManager::RBAStatesInVolume::_Grow(uint64_t newSize)
+{
+    uint64_t wordCount = (newSize + RBAS_PER_WORD - 1) / RBAS_PER_WORD;
+    uint64_t newNumChunks = (wordCount + WORDS_PER_CHUNK - 1) / WORDS_PER_CHUNK;
+    if (newNumChunks > numChunks)
+    {
+        std::atomic<uint64_t>** oldTable = chunkTable.load(memory_order_relaxed);
+        std::atomic<uint64_t>** newTable = new std::atomic<uint64_t>*[newNumChunks];
+        for (uint64_t chunk = 0; chunk < numChunks; chunk++)
+        {
+            newTable[chunk] = oldTable[chunk];
+        }
+        for (uint64_t chunk = numChunks; chunk < newNumChunks; chunk++)
+        {
+            newTable[chunk] = new std::atomic<uint64_t>[WORDS_PER_CHUNK];
+            for (uint64_t word = 0; word < WORDS_PER_CHUNK; word++)
+            {
+                newTable[chunk][word].store(0, memory_order_relaxed);
+            }
+        }
+        chunkTable.store(newTable, memory_order_release);
+        if (oldTable != nullptr)
         {
-            delete[] rbaStates;
-            rbaStates = nullptr;
-            size = newSize;
+            retiredChunkTables.push_back(oldTable);
         }
+        numChunks = newNumChunks;
     }
-    else if (size == 0 && newSize > 0)
+    // published after the table, so a reader that sees the size also sees its words
+    size.store(newSize, memory_order_release);
+}
+
+void
+RBAStateManager::RBAStatesInVolume::_Free(void)
+{
+    std::atomic<uint64_t>** table = chunkTable.load(memory_order_relaxed);
+    size.store(0, memory_order_release);
+    if (table != nullptr)
     {
-        rbaStates = new RBAState[newSize];
-        size = newSize;
-        return;
+        for (uint64_t chunk = 0; chunk < numChunks; chunk++)
+        {
+            delete[] table[chunk];
+        }
+        delete[] table;
+        chunkTable.store(nullptr, memory_order_relaxed);
+    }
+    for (auto retired : retiredChunkTables)
+    {
+        delete[] retired;
     }
+    retiredChunkTables.clear();
+    numChunks = 0;
+}
+
+std::atomic<uint64_t>&
+RBAStateManager::RBAStatesInVolume::_GetWord(uint64_t wordIndex)
+{
+    std::atomic<uint64_t>** table = chunkTable.load(memory_order_acquire);
+    return table[wordIndex / WORDS_PER_CHUNK][wordIndex % WORDS_PER_CHUNK];
 }
 
 RBAOwnerType
@@ -285,7 +385,9 @@ RBAStateManager::RBAStatesInVolume::GetOwner(BlkAddr rba)
 {
     if (likely(_IsAccessibleRba(rba)))
     {
-        return rbaStates[rba].GetOwner();
+        uint64_t word = _GetWord(rba / RBAS_PER_WORD).load(memory_order_acquire);
+        uint32_t shift = (rba % RBAS_PER_WORD) * BITS_PER_RBA;
+        return static_cast<RBAOwnerType>((word >> shift) & 0x3);
     }
     return RBAOwnerType::NoOwner;
 }
@@ -293,7 +395,7 @@ RBAStateManager::RBAStatesInVolume::GetOwner(BlkAddr rba)
 bool
 RBAStateManager::RBAStatesInVolume::_IsAccessibleRba(BlkAddr endRba)
 {
-    return size > endRba;
+    return size.load(memory_order_acquire) > endRba;
 }
 
 int
@@ -341,4 +443,11 @@ RBAStateManager::VolumeDetached(vector<int> volList, VolumeArrayInfo* volArrayIn
     return EID(VOL_EVENT_OK);
 }
 
+int
+RBAStateManager::VolumeResized(VolumeEventBase* volEventBase, VolumeArrayInfo* volArrayInfo)
+{
+    GrowRBAState(volEventBase->volId, ChangeByteToBlock(volEventBase->volSizeByte));
+    return EID(VOL_EVENT_OK);
+}
+
 } // namespace pos
@@ -32,6 +32,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <bitset>
 #include <cstdint>
 #include <mutex>
@@ -71,6 +72,7 @@ public:
 
     virtual void CreateRBAState(uint32_t volumeID, uint64_t totalRBACount);
     virtual void DeleteRBAState(uint32_t volumeID);
+    virtual void GrowRBAState(uint32_t volumeID, uint64_t totalRBACount);
     virtual VolumeIo::RbaList::iterator AcquireOwnershipRbaList(uint32_t volumeId,
         const VolumeIo::RbaList& uniqueRbaList, VolumeIo::RbaList::iterator startIter,
         uint32_t& acquiredCnt);
@@ -90,21 +92,15 @@ public:
     int VolumeLoaded(VolumeEventBase* volEventBase, VolumeEventPerf* volEventPerf, VolumeArrayInfo* volArrayInfo) override;
     int VolumeUpdated(VolumeEventBase* volEventBase, VolumeEventPerf* volEventPerf, VolumeArrayInfo* volArrayInfo) override;
     int VolumeDetached(vector<int> volList, VolumeArrayInfo* volArrayInfo) override;
+    int VolumeResized(VolumeEventBase* volEventBase, VolumeArrayInfo* volArrayInfo) override;
 
 private:
-    class RBAState
-    {
-    public:
-        RBAState(void);
-        bool AcquireOwnership(RBAOwnerType owner);
-        void ReleaseOwnership(void);
-        RBAOwnerType GetOwner(void) { return owner; }
-
-    private:
-        std::atomic_flag ownered;
-        RBAOwnerType owner = RBAOwnerType::NoOwner;
-    };
-
+    // Owner of each RBA is packed into 2 bits (see RBAOwnerType) so that a
+    // 64-bit word covers RBAS_PER_WORD consecutive RBAs. A range is acquired
+    // word by word with a single CAS per word.
+    // The words are kept in fixed-size chunks that never move, so a volume
+    // grows under I/O by publishing a larger chunk table. The replaced tables
+    // are freed only with the volume, as a reader may still hold one.
     class RBAStatesInVolume
     {
     public:
@@ -113,11 +109,26 @@ private:
         void ReleaseOwnership(BlkAddr startRba, uint32_t cnt);
         RBAOwnerType GetOwner(BlkAddr rba);
         void SetSize(uint64_t newSize);
+        void Grow(uint64_t newSize);
+
+        static const uint32_t BITS_PER_RBA = 2;
+        static const uint32_t RBAS_PER_WORD = 64 / BITS_PER_RBA;
 
     private:
         bool _IsAccessibleRba(BlkAddr endRba);
-        RBAState* rbaStates;
-        uint64_t size;
+        std::atomic<uint64_t>& _GetWord(uint64_t wordIndex);
+        bool _AcquireWord(uint64_t wordIndex, uint64_t mask, uint64_t ownerBits);
+        void _ReleaseWords(BlkAddr startRba, BlkAddr endRba);
+        void _Grow(uint64_t newSize);
+        void _Free(void);
+        static uint64_t _GetMask(uint32_t startSlot, uint32_t endSlot);
+        static uint64_t _GetOwnerPattern(RBAOwnerType owner);
+
+        static const uint64_t WORDS_PER_CHUNK = 4096;
+        std::atomic<std::atomic<uint64_t>**> chunkTable;
+        uint64_t numChunks;
+        std::vector<std::atomic<uint64_t>**> retiredChunkTables;
+        std::atomic<uint64_t> size;
     };
     using RBAStatesInArray = std::array<RBAStatesInVolume, MAX_VOLUME_COUNT>;
 
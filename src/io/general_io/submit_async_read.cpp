@@ -116,38 +116,44 @@ SubmitAsyncRead::Execute(
 
         for (uint32_t bufferIndex = 0; bufferIndex < bufferCount; bufferIndex++)
         {
-            list<PhysicalEntry> physicalEntries;
+            PhysicalEntryArray physicalEntries;
             LogicalEntry logicalEntry = {
                 .addr = currentLSA,
                 .blkCnt = 1};
 
             // Ignore handling the return status.
-            translator->Translate(
+            translator->TranslateForReadInPlace(
                 arrayId, partitionToIO, physicalEntries, logicalEntry);
 
             PhysicalEntry physicalEntry = physicalEntries.front();
-            if (mergedIO->IsContiguous(physicalEntry.addr))
+            void* newBuffer = currentBufferEntry.GetBlock(bufferIndex);
+            if (0 < bufferIndex && mergedIO->IsContiguous(physicalEntry.addr))
             {
                 mergedIO->AddContiguousBlock();
             }
+            else if (0 == bufferIndex && mergedIO->CanAddSegment(physicalEntry.addr))
+            {
+                // The device range continues on the next buffer entry,
+                // so keep it in the same command as another segment.
+                mergedIO->AddContiguousSegment(newBuffer);
+            }
             else
             {
                 // Ignore handling the return status.
                 mergedIO->Process(arrayId);
 
-                void* newBuffer = currentBufferEntry.GetBlock(bufferIndex);
                 mergedIO->SetNewStart(newBuffer, physicalEntry.addr);
             }
 
             currentLSA.offset++;
         }
-        // Net status of the upper operations is gathered from here.
-        errorToReturn = mergedIO->Process(arrayId);
-        mergedIO->Reset();
 
         blockIndex += (bufferCount - 1);
         it++;
     }
+    // Net status of the upper operations is gathered from here.
+    errorToReturn = mergedIO->Process(arrayId);
+    mergedIO->Reset();
 
     if (errorToReturn != IOSubmitHandlerStatus::FAIL_IN_SYSTEM_STOP)
     {
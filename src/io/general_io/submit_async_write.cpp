@@ -38,12 +38,15 @@
 #include "src/bio/ubio.h"
 #include "src/event_scheduler/callback.h"
 #include "src/event_scheduler/event_scheduler.h"
+#include "src/include/array_config.h"
 #include "src/include/branch_prediction.h"
 #include "src/include/io_error_type.h"
 #include "src/include/pos_event_id.hpp"
 #include "src/io/general_io/array_unlocking.h"
 #include "src/io/general_io/internal_write_completion.h"
 #include "src/io/general_io/io_submit_handler_count.h"
+#include "src/io/general_io/parity_write_completion.h"
+#include "src/io/general_io/write_amplification_monitor_service.h"
 #include "src/logger/logger.h"
 #include "src/state/state_manager.h"
 /*To do Remove after adding array Idx by Array*/
@@ -102,6 +105,11 @@ SubmitAsyncWrite::Execute(
         ret = translator->Translate(
             arrayId, partitionToIO, physicalEntries, logicalEntry);
     }
+    if (ret == 0 && partitionToIO == PartitionType::USER_DATA && parityOnly == false && needTrim == false)
+    {
+        return _SubmitDataThenParity(bufferList, physicalEntries, logicalWriteEntry,
+            startLSA.stripeId, partitionToIO, callback, arrayId);
+    }
     std::list<PhysicalWriteEntry> parityPhysicalWriteEntries;
     int parityResult = translator->GetParityList(
         arrayId, partitionToIO, parityPhysicalWriteEntries, logicalWriteEntry);
@@ -204,6 +212,7 @@ SubmitAsyncWrite::Execute(
         }
     }
 
+    uint64_t parityBlkCnt = 0;
     for (PhysicalWriteEntry& physicalWriteEntry : parityPhysicalWriteEntries)
     {
         BufferEntry& buffer = physicalWriteEntry.buffers.front();
@@ -214,6 +223,12 @@ SubmitAsyncWrite::Execute(
             errorToReturn =
                 _CheckAsyncWriteError(arrayId);
         }
+        parityBlkCnt += physicalWriteEntry.blkCnt;
+    }
+    if (parityBlkCnt > 0)
+    {
+        WriteAmplificationMonitorServiceSingleton::Instance()->Add(arrayId,
+            WriteSource::Parity, parityBlkCnt * ArrayConfig::BLOCK_SIZE_BYTE);
     }
 
     if (errorToReturn != IOSubmitHandlerStatus::FAIL_IN_SYSTEM_STOP)
@@ -224,6 +239,75 @@ SubmitAsyncWrite::Execute(
     return errorToReturn;
 }
 
+// The data chunks need no parity, so they are on their way to the devices while
+// the parity is made. The parity writes are completed as a single caller of the
+// array unlocking, which is counted before the parity count is known.
+// User data takes no stripe lock, so there is nothing to unlock on failure
+IOSubmitHandlerStatus
+SubmitAsyncWrite::_SubmitDataThenParity(std::list<BufferEntry>& bufferList,
+    std::list<PhysicalEntry>& physicalEntries, LogicalWriteEntry& logicalWriteEntry,
+    StripeId stripeId, PartitionType partitionToIO, CallbackSmartPtr callback, int arrayId)
+{
+    IOSubmitHandlerStatus errorToReturn = IOSubmitHandlerStatus::SUCCESS;
+    bool needTrim = false;
+
+    std::set<IArrayDevice*> targetDevices;
+    callback->SetWaitingCount(1);
+    CallbackSmartPtr arrayUnlocking(
+        new ArrayUnlocking(targetDevices, stripeId, nullptr, arrayId));
+    arrayUnlocking->SetCallee(callback);
+    arrayUnlocking->SetWaitingCount(physicalEntries.size() + 1);
+    arrayUnlocking->SetEventType(callback->GetEventType());
+
+    CallbackSmartPtr parityCompletion(new ParityWriteCompletion(arrayId));
+    parityCompletion->SetCallee(arrayUnlocking);
+    parityCompletion->SetEventType(callback->GetEventType());
+
+    list<BufferEntry>::iterator iter = bufferList.begin();
+    for (PhysicalEntry& physicalEntry : physicalEntries)
+    {
+        BufferEntry& buffer = *iter;
+        UbioSmartPtr ubio = _SetupUbio(arrayId, needTrim, buffer, physicalEntry.addr, arrayUnlocking, callback);
+
+        if (ioDispatcher->Submit(ubio) < 0)
+        {
+            errorToReturn = _CheckAsyncWriteError(arrayId);
+        }
+        advance(iter, 1);
+    }
+
+    std::list<PhysicalWriteEntry> parityPhysicalWriteEntries;
+    int parityResult = translator->GetParityList(
+        arrayId, partitionToIO, parityPhysicalWriteEntries, logicalWriteEntry);
+    if (parityResult != 0 || parityPhysicalWriteEntries.empty())
+    {
+        if (parityResult != 0)
+        {
+            parityCompletion->InformError(IOErrorType::GENERIC_ERROR);
+        }
+        parityCompletion->Execute();
+        return errorToReturn;
+    }
+
+    parityCompletion->SetWaitingCount(parityPhysicalWriteEntries.size());
+    uint64_t parityBlkCnt = 0;
+    for (PhysicalWriteEntry& physicalWriteEntry : parityPhysicalWriteEntries)
+    {
+        BufferEntry& buffer = physicalWriteEntry.buffers.front();
+        UbioSmartPtr ubio = _SetupUbio(arrayId, needTrim, buffer, physicalWriteEntry.addr, parityCompletion, callback);
+
+        if (ioDispatcher->Submit(ubio) < 0)
+        {
+            errorToReturn = _CheckAsyncWriteError(arrayId);
+        }
+        parityBlkCnt += physicalWriteEntry.blkCnt;
+    }
+    WriteAmplificationMonitorServiceSingleton::Instance()->Add(arrayId,
+        WriteSource::Parity, parityBlkCnt * ArrayConfig::BLOCK_SIZE_BYTE);
+
+    return errorToReturn;
+}
+
 IOSubmitHandlerStatus
 SubmitAsyncWrite::_CheckAsyncWriteError(int arrayId)
 {
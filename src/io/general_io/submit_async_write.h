@@ -62,6 +62,9 @@ private:
     IIOTranslator* translator;
     IODispatcher* ioDispatcher;
 
+    IOSubmitHandlerStatus _SubmitDataThenParity(std::list<BufferEntry>& bufferList,
+        std::list<PhysicalEntry>& physicalEntries, LogicalWriteEntry& logicalWriteEntry,
+        StripeId stripeId, PartitionType partitionToIO, CallbackSmartPtr callback, int arrayId);
     IOSubmitHandlerStatus _CheckAsyncWriteError(int arrayId);
     UbioSmartPtr _SetupUbio(int arrayId, bool needTrim, BufferEntry& buffer,
         PhysicalBlkAddr addr, CallbackSmartPtr arrayUnlocking, CallbackSmartPtr callback);
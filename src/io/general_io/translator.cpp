@@ -61,6 +61,7 @@ Translator::Translator(uint32_t volumeId, BlkAddr startRba, uint32_t blockCount,
   iVolumeManager(iVolumeManager_),
   startRba(startRba),
   blockCount(blockCount),
+  numVsaExtents(0),
   lastVsa(UNMAP_VSA),
   lastLsidEntry{IN_USER_AREA, UNMAP_STRIPE},
   isRead(isRead),
@@ -102,7 +103,8 @@ Translator::Translator(uint32_t volumeId, BlkAddr startRba, uint32_t blockCount,
 
     if (likely(iVSAMap != nullptr))
     {
-        iVSAMap->GetVSAs(volumeId, startRba, blockCount, vsaArray);
+        iVSAMap->GetVsaExtents(volumeId, startRba, blockCount, vsaExtents, numVsaExtents);
+        _ExpandVsaExtents();
     }
 
     if (likely(iStripeMap != nullptr))
@@ -120,6 +122,7 @@ Translator::Translator(const VirtualBlkAddr& vsa, int arrayId, StripeId userLsid
 : iTranslator(ArrayService::Instance()->Getter()->GetTranslator()),
   startRba(0),
   blockCount(ONLY_ONE),
+  numVsaExtents(0),
   lastVsa(UNMAP_VSA),
   lastLsidEntry{IN_USER_AREA, UNMAP_STRIPE},
   isRead(false),
@@ -147,6 +150,8 @@ Translator::Translator(const VirtualBlkAddr& vsa, int arrayId, StripeId userLsid
     vsaArray.fill(UNMAP_VSA);
 
     vsaArray[0] = vsa;
+    vsaExtents[0] = {.startVsa = vsa, .numBlks = ONLY_ONE};
+    numVsaExtents = 1;
     if (likely(iStripeMap != nullptr))
     {
         lsidRefResults[0] = _GetLsidRefResult(startRba, vsaArray[0]);
@@ -172,6 +177,47 @@ Translator::GetVsa(uint32_t blockIndex)
     return vsaArray[blockIndex];
 }
 
+uint32_t
+Translator::GetVsaExtentCount(void)
+{
+    return numVsaExtents;
+}
+
+VirtualBlks
+Translator::GetVsaExtent(uint32_t extentIndex)
+{
+    if (unlikely(extentIndex >= numVsaExtents))
+    {
+        POS_EVENT_ID eventId = EID(TRSLTR_WRONG_ACCESS);
+        POS_TRACE_ERROR(static_cast<int>(eventId),
+            "Extent index exceeds extent count at Translator");
+        return {.startVsa = UNMAP_VSA, .numBlks = 0};
+    }
+
+    return vsaExtents[extentIndex];
+}
+
+void
+Translator::_ExpandVsaExtents(void)
+{
+    uint32_t blockIndex = 0;
+    for (uint32_t extentIndex = 0; extentIndex < numVsaExtents; extentIndex++)
+    {
+        VirtualBlks& extent = vsaExtents[extentIndex];
+        bool unmapped = IsUnMapVsa(extent.startVsa);
+        for (uint32_t offset = 0; (offset < extent.numBlks) && (blockIndex < blockCount); offset++)
+        {
+            if (unmapped)
+            {
+                vsaArray[blockIndex++] = UNMAP_VSA;
+                continue;
+            }
+            vsaArray[blockIndex++] = {.stripeId = extent.startVsa.stripeId,
+                .offset = extent.startVsa.offset + offset};
+        }
+    }
+}
+
 StripeAddr
 Translator::GetLsidEntry(uint32_t blockIndex)
 {
@@ -313,6 +359,42 @@ Translator::_GetLsa(uint32_t blockIndex)
     return lsa;
 }
 
+// Translates the blocks of one mapped VSA extent at once. The entries come back in
+// block order, one per chunk the extent spans
+PhysicalEntryArray
+Translator::GetPhysicalEntriesOfBlocks(uint32_t blockIndex, uint32_t numBlks)
+{
+    LogicalBlkAddr lsa = _GetLsa(blockIndex);
+    PartitionType partitionType = _GetPartitionType(blockIndex);
+
+    LogicalEntry logicalEntry = {.addr = lsa, .blkCnt = numBlks};
+    PhysicalEntryArray physicalEntries;
+
+    int ret = 0;
+    if (isRead)
+    {
+        ret = iTranslator->TranslateForReadInPlace(arrayId, partitionType, physicalEntries, logicalEntry);
+    }
+    else
+    {
+        list<PhysicalEntry> entryList;
+        ret = iTranslator->Translate(arrayId, partitionType, entryList, logicalEntry);
+        if (ret == 0 && physicalEntries.Assign(entryList) == false)
+        {
+            ret = -1;
+        }
+    }
+    if (unlikely(ret != 0))
+    {
+        POS_EVENT_ID eventId = EID(TRANSLATE_CONVERT_FAIL);
+        POS_TRACE_ERROR(static_cast<int>(eventId),
+            "Translate() or Convert() is failed");
+        throw eventId;
+    }
+
+    return physicalEntries;
+}
+
 list<PhysicalEntry>
 Translator::GetPhysicalEntries(void* mem, uint32_t blockCount)
 {
@@ -323,8 +405,7 @@ Translator::GetPhysicalEntries(void* mem, uint32_t blockCount)
     LogicalEntry logicalEntry = {.addr = lsa, .blkCnt = blockCount};
     list<PhysicalEntry> physicalEntries;
 
-    int ret = iTranslator->Translate(
-        arrayId, partitionType, physicalEntries, logicalEntry);
+    int ret = _Translate(partitionType, physicalEntries, logicalEntry);
     if (unlikely(ret != 0))
     {
         POS_EVENT_ID eventId = EID(TRANSLATE_CONVERT_FAIL);
@@ -335,6 +416,17 @@ Translator::GetPhysicalEntries(void* mem, uint32_t blockCount)
     return physicalEntries;
 }
 
+int
+Translator::_Translate(PartitionType partitionType, list<PhysicalEntry>& physicalEntries,
+    const LogicalEntry& logicalEntry)
+{
+    if (isRead)
+    {
+        return iTranslator->TranslateForRead(arrayId, partitionType, physicalEntries, logicalEntry);
+    }
+    return iTranslator->Translate(arrayId, partitionType, physicalEntries, logicalEntry);
+}
+
 PhysicalBlkAddr
 Translator::GetPba(void)
 {
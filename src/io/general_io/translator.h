@@ -65,6 +65,9 @@ public:
     virtual bool IsUnmapped(void);
     virtual bool IsMapped(void);
     virtual VirtualBlkAddr GetVsa(uint32_t blockIndex);
+    virtual uint32_t GetVsaExtentCount(void);
+    virtual VirtualBlks GetVsaExtent(uint32_t extentIndex);
+    virtual PhysicalEntryArray GetPhysicalEntriesOfBlocks(uint32_t blockIndex, uint32_t numBlks);
 
 private:
     static const uint32_t ONLY_ONE = 1;
@@ -77,6 +80,8 @@ private:
     BlkAddr startRba;
     uint32_t blockCount;
     VsaArray vsaArray;
+    VsaExtentArray vsaExtents;
+    uint32_t numVsaExtents;
     VirtualBlkAddr lastVsa;
     StripeAddr lastLsidEntry;
     std::array<LsidRefResult, MAX_PROCESSABLE_BLOCK_COUNT> lsidRefResults;
@@ -87,8 +92,11 @@ private:
     static thread_local int recentArrayId;
 
     LogicalBlkAddr _GetLsa(uint32_t blockIndex);
+    int _Translate(PartitionType partitionType, list<PhysicalEntry>& physicalEntries,
+        const LogicalEntry& logicalEntry);
     LsidRefResult _GetLsidRefResult(BlkAddr rba, VirtualBlkAddr& vsa);
     void _CheckSingleBlock(void);
+    void _ExpandVsaExtents(void);
     PartitionType _GetPartitionType(uint32_t blockIndex);
     int arrayId;
     StripeId userLsid;
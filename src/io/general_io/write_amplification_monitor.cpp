@@ -0,0 +1,235 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io/general_io/write_amplification_monitor.h"
+
+#include "src/include/array_mgmt_policy.h"
+#include "src/include/pos_event_id.h"
+#include "src/io/general_io/write_amplification_monitor_service.h"
+#include "src/logger/logger.h"
+#include "src/telemetry/telemetry_client/telemetry_client.h"
+#include "src/telemetry/telemetry_client/telemetry_publisher.h"
+#include "src/telemetry/telemetry_id.h"
+
+namespace pos
+{
+WriteAmplificationMonitor::WriteAmplificationMonitor(IArrayInfo* arrayInfo)
+: WriteAmplificationMonitor(arrayInfo, TelemetryClientSingleton::Instance(), nullptr)
+{
+}
+
+WriteAmplificationMonitor::WriteAmplificationMonitor(IArrayInfo* arrayInfo,
+    TelemetryClient* telemetryClient, TelemetryPublisher* publisher)
+: arrayInfo(arrayInfo),
+  telemetryClient(telemetryClient),
+  publisher(publisher),
+  enabled(false),
+  stripeCount(0)
+{
+    for (uint32_t source = 0; source < SOURCE_COUNT; source++)
+    {
+        bytes[source] = 0;
+    }
+}
+
+WriteAmplificationMonitor::~WriteAmplificationMonitor(void)
+{
+    Dispose();
+    if (nullptr != publisher)
+    {
+        delete publisher;
+        publisher = nullptr;
+    }
+}
+
+int
+WriteAmplificationMonitor::Init(void)
+{
+    if (true == enabled)
+    {
+        return EID(SUCCESS);
+    }
+
+    if (nullptr == publisher)
+    {
+        publisher = new TelemetryPublisher("WriteAmplification_" + arrayInfo->GetName());
+        publisher->AddDefaultLabel("array_name", arrayInfo->GetName());
+    }
+    if (nullptr != telemetryClient)
+    {
+        telemetryClient->RegisterPublisher(publisher);
+    }
+
+    enabled = true;
+    WriteAmplificationMonitorServiceSingleton::Instance()->Register(arrayInfo->GetIndex(), this);
+    return EID(SUCCESS);
+}
+
+void
+WriteAmplificationMonitor::Dispose(void)
+{
+    if (false == enabled)
+    {
+        return;
+    }
+
+    enabled = false;
+    WriteAmplificationMonitorServiceSingleton::Instance()->Unregister(arrayInfo->GetIndex());
+    if (nullptr != telemetryClient)
+    {
+        telemetryClient->DeregisterPublisher(publisher->GetName());
+    }
+}
+
+void
+WriteAmplificationMonitor::Shutdown(void)
+{
+    Dispose();
+}
+
+void
+WriteAmplificationMonitor::Flush(void)
+{
+    // no-op for IMountSequence
+}
+
+void
+WriteAmplificationMonitor::Add(WriteSource source, uint64_t writtenBytes)
+{
+    if (source == WriteSource::Host)
+    {
+        _AddHost(writtenBytes);
+        return;
+    }
+    if (source >= WriteSource::Count)
+    {
+        return;
+    }
+
+    bytes[static_cast<uint32_t>(source)].fetch_add(writtenBytes, std::memory_order_relaxed);
+    if (source == WriteSource::Flush || source == WriteSource::Gc)
+    {
+        // a stripe is flushed every few hundred host writes, which is often enough to publish
+        if (0 == (++stripeCount % PUBLISH_INTERVAL))
+        {
+            _Publish();
+        }
+    }
+}
+
+void
+WriteAmplificationMonitor::_AddHost(uint64_t writtenBytes)
+{
+    // every host write lands here; batching per thread keeps reactors off a shared cache line
+    static thread_local uint64_t pending[ArrayMgmtPolicy::MAX_ARRAY_CNT] = {0};
+    uint32_t arrayIndex = arrayInfo->GetIndex();
+    if (arrayIndex >= static_cast<uint32_t>(ArrayMgmtPolicy::MAX_ARRAY_CNT))
+    {
+        return;
+    }
+
+    pending[arrayIndex] += writtenBytes;
+    if (pending[arrayIndex] >= HOST_BATCH_BYTES)
+    {
+        bytes[static_cast<uint32_t>(WriteSource::Host)].fetch_add(pending[arrayIndex], std::memory_order_relaxed);
+        pending[arrayIndex] = 0;
+    }
+}
+
+uint64_t
+WriteAmplificationMonitor::GetBytes(WriteSource source)
+{
+    if (source >= WriteSource::Count)
+    {
+        return 0;
+    }
+    return bytes[static_cast<uint32_t>(source)].load(std::memory_order_relaxed);
+}
+
+uint64_t
+WriteAmplificationMonitor::GetWriteAmplificationX100(void)
+{
+    uint64_t hostBytes = GetBytes(WriteSource::Host);
+    if (0 == hostBytes)
+    {
+        return 0;
+    }
+    uint64_t ssdBytes = GetBytes(WriteSource::Flush) + GetBytes(WriteSource::Gc)
+        + GetBytes(WriteSource::Parity) + GetBytes(WriteSource::Meta);
+    return ssdBytes * 100 / hostBytes;
+}
+
+uint64_t
+WriteAmplificationMonitor::GetGcEfficiencyPercent(void)
+{
+    uint64_t flushBytes = GetBytes(WriteSource::Flush);
+    uint64_t userDataBytes = flushBytes + GetBytes(WriteSource::Gc);
+    if (0 == userDataBytes)
+    {
+        return 100;
+    }
+    return flushBytes * 100 / userDataBytes;
+}
+
+const char*
+WriteAmplificationMonitor::GetSourceName(WriteSource source)
+{
+    static const char* NAMES[SOURCE_COUNT] = {
+        "host", "flush", "gc", "parity", "journal", "meta"};
+    if (source >= WriteSource::Count)
+    {
+        return "unknown";
+    }
+    return NAMES[static_cast<uint32_t>(source)];
+}
+
+void
+WriteAmplificationMonitor::_Publish(void)
+{
+    for (uint32_t source = 0; source < SOURCE_COUNT; source++)
+    {
+        POSMetric metric(TEL60008_ARRAY_WRITTEN_BYTES, MT_COUNT);
+        metric.SetCountValue(bytes[source].load(std::memory_order_relaxed));
+        metric.AddLabel("source", GetSourceName(static_cast<WriteSource>(source)));
+        publisher->PublishMetric(metric);
+    }
+
+    POSMetric wafMetric(TEL60009_ARRAY_WRITE_AMPLIFICATION, MT_GAUGE);
+    wafMetric.SetGaugeValue(GetWriteAmplificationX100());
+    publisher->PublishMetric(wafMetric);
+
+    POSMetric gcEfficiencyMetric(TEL60010_ARRAY_GC_EFFICIENCY, MT_GAUGE);
+    gcEfficiencyMetric.SetGaugeValue(GetGcEfficiencyPercent());
+    publisher->PublishMetric(gcEfficiencyMetric);
+}
+
+} // namespace pos
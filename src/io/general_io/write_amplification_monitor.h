@@ -0,0 +1,101 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "src/array_models/interface/i_array_info.h"
+#include "src/array_models/interface/i_mount_sequence.h"
+
+namespace pos
+{
+class TelemetryClient;
+class TelemetryPublisher;
+
+enum class WriteSource
+{
+    Host,
+    Flush,
+    Gc,
+    Parity,
+    Journal,
+    Meta,
+    Count
+};
+
+// Counts the bytes an array writes for each reason, and derives the write
+// amplification (bytes written to the ssds per host byte) and the gc
+// efficiency (share of user data writes that carry new host data) from them.
+// Meta bytes are what metafs writes to the ssds, which already include the
+// journal when its file is on the ssds, so journal bytes are reported but not
+// added to the bytes written to the ssds.
+class WriteAmplificationMonitor : public IMountSequence
+{
+public:
+    explicit WriteAmplificationMonitor(IArrayInfo* arrayInfo);
+    WriteAmplificationMonitor(IArrayInfo* arrayInfo,
+        TelemetryClient* telemetryClient, TelemetryPublisher* publisher);
+    virtual ~WriteAmplificationMonitor(void);
+
+    int Init(void) override;
+    void Dispose(void) override;
+    void Shutdown(void) override;
+    void Flush(void) override;
+
+    virtual void Add(WriteSource source, uint64_t bytes);
+    virtual uint64_t GetBytes(WriteSource source);
+    virtual uint64_t GetWriteAmplificationX100(void);
+    virtual uint64_t GetGcEfficiencyPercent(void);
+
+    static const char* GetSourceName(WriteSource source);
+
+    // host bytes are summed per thread and added to the array once this much is written
+    static const uint64_t HOST_BATCH_BYTES = 1ULL << 20;
+    static const uint32_t PUBLISH_INTERVAL = 16;
+
+private:
+    static const uint32_t SOURCE_COUNT = static_cast<uint32_t>(WriteSource::Count);
+
+    void _AddHost(uint64_t bytes);
+    void _Publish(void);
+
+    IArrayInfo* arrayInfo;
+    TelemetryClient* telemetryClient;
+    TelemetryPublisher* publisher;
+    std::atomic<bool> enabled;
+    std::atomic<uint64_t> bytes[SOURCE_COUNT];
+    std::atomic<uint64_t> stripeCount;
+};
+
+} // namespace pos
@@ -0,0 +1,183 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io_scheduler/adaptive_poller.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+
+#include "src/telemetry/telemetry_client/easy_telemetry_publisher.h"
+#include "src/telemetry/telemetry_id.h"
+
+namespace pos
+{
+AdaptivePoller::AdaptivePoller(uint32_t maxSleepTimeUs, std::string name,
+    uint32_t idleRoundThreshold, EasyTelemetryPublisher* telemetryPublisher)
+: maxSleepTimeUs(maxSleepTimeUs),
+  name(name),
+  idleRoundThreshold(idleRoundThreshold),
+  telemetryPublisher(telemetryPublisher),
+  idleRoundCount(0),
+  sleepTimeUs(MIN_SLEEP_TIME_US),
+  totalSleepTimeUs(0),
+  unpublishedSleepTimeUs(0),
+  sleeping(false),
+  wakeupRequested(false)
+{
+    if (nullptr == telemetryPublisher)
+    {
+        this->telemetryPublisher = EasyTelemetryPublisherSingleton::Instance();
+    }
+    if (this->maxSleepTimeUs < MIN_SLEEP_TIME_US)
+    {
+        this->maxSleepTimeUs = MIN_SLEEP_TIME_US;
+    }
+}
+
+AdaptivePoller::~AdaptivePoller(void)
+{
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Called at the end of every polling round
+ *
+ * @Param    isIdle: nothing was submitted and nothing is outstanding in this round
+ */
+/* --------------------------------------------------------------------------*/
+void
+AdaptivePoller::Poll(bool isIdle)
+{
+    _UpdateSleepTime(isIdle);
+    _Sleep();
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Make the polling thread go back to tight polling right away.
+ *           Called by the submitter side, so that a new request does not wait
+ *           for the backed off sleep.
+ */
+/* --------------------------------------------------------------------------*/
+void
+AdaptivePoller::Wakeup(void)
+{
+    wakeupRequested = true;
+    if (sleeping)
+    {
+        std::unique_lock<std::mutex> lock(sleepLock);
+        sleepCondition.notify_one();
+    }
+}
+
+uint32_t
+AdaptivePoller::GetSleepTime(void)
+{
+    return sleepTimeUs;
+}
+
+uint64_t
+AdaptivePoller::GetTotalSleepTime(void)
+{
+    return totalSleepTimeUs;
+}
+
+void
+AdaptivePoller::_UpdateSleepTime(bool isIdle)
+{
+    uint32_t prevSleepTimeUs = sleepTimeUs;
+    if (false == isIdle || wakeupRequested.exchange(false))
+    {
+        idleRoundCount = 0;
+        sleepTimeUs = MIN_SLEEP_TIME_US;
+    }
+    else if (idleRoundCount < idleRoundThreshold)
+    {
+        idleRoundCount++;
+    }
+    else
+    {
+        sleepTimeUs = std::min(sleepTimeUs * 2, maxSleepTimeUs);
+    }
+
+    if (prevSleepTimeUs != MIN_SLEEP_TIME_US && sleepTimeUs == MIN_SLEEP_TIME_US)
+    {
+        _Publish();
+    }
+}
+
+void
+AdaptivePoller::_Sleep(void)
+{
+    if (sleepTimeUs <= MIN_SLEEP_TIME_US)
+    {
+        usleep(sleepTimeUs);
+        return;
+    }
+
+    // Wakeup() sets wakeupRequested before checking sleeping,
+    // so that either of them sees the other one and no wakeup is lost.
+    sleeping = true;
+    if (false == wakeupRequested)
+    {
+        std::unique_lock<std::mutex> lock(sleepLock);
+        sleepCondition.wait_for(lock, std::chrono::microseconds(sleepTimeUs),
+            [&] { return wakeupRequested.load(); });
+    }
+    sleeping = false;
+
+    totalSleepTimeUs += sleepTimeUs;
+    unpublishedSleepTimeUs += sleepTimeUs;
+    if (unpublishedSleepTimeUs >= PUBLISH_INTERVAL_US)
+    {
+        _Publish();
+    }
+}
+
+void
+AdaptivePoller::_Publish(void)
+{
+    if (nullptr == telemetryPublisher)
+    {
+        return;
+    }
+
+    VectorLabels labels = {{"thread_name", name}};
+    telemetryPublisher->IncreaseCounter(TEL130018_POLLER_SLEEP_TIME_US,
+        unpublishedSleepTimeUs, labels);
+    telemetryPublisher->UpdateGauge(TEL130019_POLLER_SLEEP_INTERVAL_US,
+        sleepTimeUs, labels);
+    unpublishedSleepTimeUs = 0;
+}
+} // namespace pos
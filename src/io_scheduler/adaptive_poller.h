@@ -0,0 +1,89 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace pos
+{
+class EasyTelemetryPublisher;
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Decide how long a polling thread sleeps between its rounds.
+ *           It backs off exponentially while idle rounds continue
+ *           and goes back to tight polling at the first busy round or wakeup.
+ */
+/* --------------------------------------------------------------------------*/
+class AdaptivePoller
+{
+public:
+    AdaptivePoller(uint32_t maxSleepTimeUs, std::string name,
+        uint32_t idleRoundThreshold = DEFAULT_IDLE_ROUND_THRESHOLD,
+        EasyTelemetryPublisher* telemetryPublisher = nullptr);
+    virtual ~AdaptivePoller(void);
+
+    virtual void Poll(bool isIdle);
+    virtual void Wakeup(void);
+    uint32_t GetSleepTime(void);
+    uint64_t GetTotalSleepTime(void);
+
+    static const uint32_t MIN_SLEEP_TIME_US = 1;
+    static const uint32_t DEFAULT_IDLE_ROUND_THRESHOLD = 1000;
+    static const uint64_t PUBLISH_INTERVAL_US = 100000;
+
+private:
+    void _UpdateSleepTime(bool isIdle);
+    void _Sleep(void);
+    void _Publish(void);
+
+    uint32_t maxSleepTimeUs;
+    std::string name;
+    uint32_t idleRoundThreshold;
+    EasyTelemetryPublisher* telemetryPublisher;
+
+    uint32_t idleRoundCount;
+    uint32_t sleepTimeUs;
+    uint64_t totalSleepTimeUs;
+    uint64_t unpublishedSleepTimeUs;
+
+    std::mutex sleepLock;
+    std::condition_variable sleepCondition;
+    std::atomic<bool> sleeping;
+    std::atomic<bool> wakeupRequested;
+};
+} // namespace pos
@@ -0,0 +1,70 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io_scheduler/coalesced_io_completion.h"
+
+#include "src/bio/ubio.h"
+#include "src/event_scheduler/io_completer.h"
+
+namespace pos
+{
+CoalescedIoCompletion::CoalescedIoCompletion(std::vector<UbioSmartPtr>& ubios)
+: Callback(false, CallbackType_CoalescedIoCompletion),
+  ubios(ubios)
+{
+}
+
+CoalescedIoCompletion::~CoalescedIoCompletion(void)
+{
+}
+
+bool
+CoalescedIoCompletion::_DoSpecificJob(void)
+{
+    // Error of the merged command is handed over to each ubio,
+    // so that the recovery is still done for each of them.
+    IOErrorType errorType = IOErrorType::SUCCESS;
+    if (0 < _GetErrorCount())
+    {
+        errorType = _GetMostCriticalError();
+    }
+
+    for (auto& ubio : ubios)
+    {
+        IoCompleter ioCompleter(ubio);
+        ioCompleter.CompleteUbio(errorType, true);
+    }
+    ubios.clear();
+
+    return true;
+}
+} // namespace pos
@@ -1,6 +1,6 @@
 /*
  *   BSD LICENSE
- *   Copyright (c) 2021 Samsung Electronics Corporation
+ *   Copyright (c) 2022 Samsung Electronics Corporation
  *   All rights reserved.
  *
  *   Redistribution and use in source and binary forms, with or without
@@ -32,21 +32,22 @@
 
 #pragma once
 
-#include <cstdint>
+#include <vector>
 
 #include "src/event_scheduler/callback.h"
 
 namespace pos
 {
-class SyncIoCompletion : public Callback
+// Completes every ubio which was coalesced into one device command
+class CoalescedIoCompletion : public Callback
 {
 public:
-    SyncIoCompletion(std::atomic<bool>& inputNeedToWait, uint32_t& inputerrorCount);
-    ~SyncIoCompletion(void) override;
+    explicit CoalescedIoCompletion(std::vector<UbioSmartPtr>& ubios);
+    ~CoalescedIoCompletion(void) override;
 
 private:
     bool _DoSpecificJob(void) override;
-    std::atomic<bool>& needToWait;
-    uint32_t& errorCount;
+
+    std::vector<UbioSmartPtr> ubios;
 };
 } // namespace pos
@@ -51,6 +51,16 @@ DispatcherPolicyI::~DispatcherPolicyI()
     eventScheduler = nullptr;
 }
 
+// Each ubio is admitted on its own unless the policy can take the group at once
+void
+DispatcherPolicyI::SubmitBatch(IOWorker* ioWorker, std::vector<UbioSmartPtr>& ubios)
+{
+    for (auto& ubio : ubios)
+    {
+        Submit(ioWorker, ubio);
+    }
+}
+
 DispatcherPolicyDirect::DispatcherPolicyDirect(IODispatcher* dispatcherInput, EventScheduler* schedulerInput)
 : DispatcherPolicyI(dispatcherInput, schedulerInput)
 {
@@ -66,6 +76,12 @@ DispatcherPolicyDirect::Submit(IOWorker* ioWorker, UbioSmartPtr ubio)
     ioWorker->EnqueueUbio(ubio);
 }
 
+void
+DispatcherPolicyDirect::SubmitBatch(IOWorker* ioWorker, std::vector<UbioSmartPtr>& ubios)
+{
+    ioWorker->EnqueueUbios(ubios);
+}
+
 void
 DispatcherPolicyDirect::Process(void)
 {
@@ -31,6 +31,8 @@
  */
 
 #pragma once
+#include <vector>
+
 #include "src/include/smart_ptr_type.h"
 
 namespace pos
@@ -45,6 +47,7 @@ public:
     DispatcherPolicyI(IODispatcher* dispatcherInput, EventScheduler* schedulerInput);
     virtual ~DispatcherPolicyI();
     virtual void Submit(IOWorker* ioWorker, UbioSmartPtr ubio) = 0;
+    virtual void SubmitBatch(IOWorker* ioWorker, std::vector<UbioSmartPtr>& ubios);
     virtual void Process(void) = 0;
 
 protected:
@@ -59,6 +62,7 @@ public:
     ~DispatcherPolicyDirect();
 
     virtual void Submit(IOWorker* ioWorker, UbioSmartPtr ubio) override;
+    virtual void SubmitBatch(IOWorker* ioWorker, std::vector<UbioSmartPtr>& ubios) override;
     virtual void Process(void) override;
 };
 
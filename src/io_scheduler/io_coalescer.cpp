@@ -0,0 +1,217 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io_scheduler/io_coalescer.h"
+
+#include <sys/uio.h>
+
+#include "src/device/base/ublock_device.h"
+#include "src/include/memory.h"
+#include "src/io_scheduler/coalesced_io_completion.h"
+#include "src/telemetry/telemetry_client/easy_telemetry_publisher.h"
+#include "src/telemetry/telemetry_id.h"
+
+namespace pos
+{
+IOCoalescer::IOCoalescer(uint32_t maxCoalescedSize,
+    EasyTelemetryPublisher* telemetryPublisher)
+: maxCoalescedSize(maxCoalescedSize),
+  telemetryPublisher(telemetryPublisher),
+  pendingSize(0),
+  nextLba(0),
+  coalescedUbioCount(0),
+  coalescedCommandCount(0),
+  publishedUbioCount(0),
+  publishedCommandCount(0)
+{
+    if (nullptr == telemetryPublisher)
+    {
+        this->telemetryPublisher = EasyTelemetryPublisherSingleton::Instance();
+    }
+}
+
+IOCoalescer::~IOCoalescer(void)
+{
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Keep the ubio to be merged with the pending ones
+ *
+ * @Param    ubio
+ * @return   false if the ubio cannot be merged with the pending ones.
+ *           Caller should flush the pending ones and try again.
+ */
+/* --------------------------------------------------------------------------*/
+bool
+IOCoalescer::Add(UbioSmartPtr ubio)
+{
+    if (false == _IsCoalescable(ubio))
+    {
+        return false;
+    }
+    if (false == pendingUbios.empty() && false == _IsAdjacent(ubio))
+    {
+        return false;
+    }
+
+    pendingUbios.push_back(ubio);
+    pendingSize += ubio->GetSize();
+    nextLba = ubio->GetLba() + ChangeByteToSector(ubio->GetSize());
+
+    return true;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Take out the pending ubios as a single ubio
+ *
+ * @return   nullptr if nothing is pending, the ubio itself if only one is pending.
+ */
+/* --------------------------------------------------------------------------*/
+UbioSmartPtr
+IOCoalescer::Flush(void)
+{
+    UbioSmartPtr ubio = nullptr;
+    if (1 == pendingUbios.size())
+    {
+        ubio = pendingUbios.front();
+    }
+    else if (1 < pendingUbios.size())
+    {
+        ubio = _CreateCoalescedUbio();
+    }
+
+    pendingUbios.clear();
+    pendingSize = 0;
+    return ubio;
+}
+
+uint64_t
+IOCoalescer::GetCoalescedUbioCount(void)
+{
+    return coalescedUbioCount;
+}
+
+uint64_t
+IOCoalescer::GetCoalescedCommandCount(void)
+{
+    return coalescedCommandCount;
+}
+
+bool
+IOCoalescer::_IsCoalescable(UbioSmartPtr ubio)
+{
+    if (ubio->dir != UbioDir::Read && ubio->dir != UbioDir::Write)
+    {
+        return false;
+    }
+    // Sync ubios are waited for by the caller and split ones are completed through their origin
+    if (ubio->IsSyncMode() || ubio->IsRetry() || ubio->IsVectored() ||
+        ubio->GetOriginUbio() != nullptr || ubio->GetCallback() == nullptr)
+    {
+        return false;
+    }
+
+    UBlockDevice* ublock = ubio->GetUBlock();
+    if (ublock == nullptr || ublock->GetType() != DeviceType::SSD)
+    {
+        return false;
+    }
+
+    // Every segment should be page aligned to be described by prp list
+    uint64_t address = reinterpret_cast<uint64_t>(ubio->GetWholeBuffer());
+    return (0 == GetByteOffsetInBlock(address) &&
+        0 == GetByteOffsetInBlock(ubio->GetSize()));
+}
+
+bool
+IOCoalescer::_IsAdjacent(UbioSmartPtr ubio)
+{
+    UbioSmartPtr last = pendingUbios.back();
+    bool isSameTarget = (ubio->GetUBlock() == last->GetUBlock()) &&
+        (ubio->dir == last->dir) && (ubio->GetEventType() == last->GetEventType());
+    bool isLbaAdjacent = (ubio->GetLba() == nextLba);
+    bool hasRoom = (pendingUbios.size() < MAX_SEGMENT_COUNT) &&
+        (pendingSize + ubio->GetSize() <= maxCoalescedSize);
+
+    return (isSameTarget && isLbaAdjacent && hasRoom);
+}
+
+UbioSmartPtr
+IOCoalescer::_CreateCoalescedUbio(void)
+{
+    UbioSmartPtr first = pendingUbios.front();
+    std::vector<struct iovec> ioVectors;
+    for (auto& ubio : pendingUbios)
+    {
+        ioVectors.push_back({.iov_base = ubio->GetWholeBuffer(),
+            .iov_len = ubio->GetSize()});
+    }
+
+    // Coalesced ubio has no array device, so that the recovery is not done for itself
+    // but for each original ubio at its completion.
+    UbioSmartPtr ubio(new Ubio(ioVectors, first->GetArrayId()));
+    ubio->dir = first->dir;
+    ubio->SetLba(first->GetLba());
+    ubio->SetUblock(first->GetUBlockSharedPtr());
+    ubio->SetEventType(first->GetEventType());
+    CallbackSmartPtr callback(new CoalescedIoCompletion(pendingUbios));
+    callback->SetEventType(first->GetEventType());
+    ubio->SetCallback(callback);
+
+    coalescedUbioCount += pendingUbios.size();
+    coalescedCommandCount++;
+    if (0 == coalescedCommandCount % PUBLISH_INTERVAL)
+    {
+        _Publish();
+    }
+
+    return ubio;
+}
+
+void
+IOCoalescer::_Publish(void)
+{
+    if (nullptr == telemetryPublisher)
+    {
+        return;
+    }
+
+    telemetryPublisher->IncreaseCounter(TEL130016_COUNT_OF_COALESCED_UBIO,
+        coalescedUbioCount - publishedUbioCount);
+    telemetryPublisher->IncreaseCounter(TEL130017_COUNT_OF_COALESCED_COMMAND,
+        coalescedCommandCount - publishedCommandCount);
+    publishedUbioCount = coalescedUbioCount;
+    publishedCommandCount = coalescedCommandCount;
+}
+} // namespace pos
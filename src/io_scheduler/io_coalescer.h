@@ -0,0 +1,81 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "src/bio/ubio.h"
+
+namespace pos
+{
+class EasyTelemetryPublisher;
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Merge lba-adjacent ubios of the same ssd into a single vectored
+ *           ubio, within one polling round of an IOWorker
+ */
+/* --------------------------------------------------------------------------*/
+class IOCoalescer
+{
+public:
+    explicit IOCoalescer(uint32_t maxCoalescedSize,
+        EasyTelemetryPublisher* telemetryPublisher = nullptr);
+    virtual ~IOCoalescer(void);
+
+    virtual bool Add(UbioSmartPtr ubio);
+    virtual UbioSmartPtr Flush(void);
+    uint64_t GetCoalescedUbioCount(void);
+    uint64_t GetCoalescedCommandCount(void);
+
+    static const uint32_t MAX_SEGMENT_COUNT = 32;
+    static const uint32_t PUBLISH_INTERVAL = 1024;
+
+private:
+    bool _IsCoalescable(UbioSmartPtr ubio);
+    bool _IsAdjacent(UbioSmartPtr ubio);
+    UbioSmartPtr _CreateCoalescedUbio(void);
+    void _Publish(void);
+
+    uint32_t maxCoalescedSize;
+    EasyTelemetryPublisher* telemetryPublisher;
+    std::vector<UbioSmartPtr> pendingUbios;
+    uint64_t pendingSize;
+    uint64_t nextLba;
+    uint64_t coalescedUbioCount;
+    uint64_t coalescedCommandCount;
+    uint64_t publishedUbioCount;
+    uint64_t publishedCommandCount;
+};
+} // namespace pos
@@ -46,6 +46,8 @@
 #include "src/io_scheduler/dispatcher_policy.h"
 #include "src/io_scheduler/io_dispatcher_submission.h"
 #include "src/io_scheduler/io_worker.h"
+#include "src/io_scheduler/io_worker_rebalancer.h"
+#include "src/io_scheduler/read_hedging_policy.h"
 #include "src/logger/logger.h"
 #include "src/spdk_wrapper/accel_engine_api.h"
 #include "src/spdk_wrapper/event_framework_api.h"
@@ -63,7 +65,9 @@ IODispatcher::IODispatcher(EventFrameworkApi* eventFrameworkApiArg,
 : ioWorkerCount(0),
   deviceAllocationTurn(0),
   eventScheduler(eventSchedulerArg),
-  dispPolicy(nullptr)
+  dispPolicy(nullptr),
+  readHedgingPolicy(nullptr),
+  ioWorkerRebalancer(nullptr)
 {
     pthread_rwlock_init(&ioWorkerMapLock, nullptr);
     eventFrameworkApi = eventFrameworkApiArg;
@@ -77,16 +81,20 @@ IODispatcher::IODispatcher(EventFrameworkApi* eventFrameworkApiArg,
     }
     eventScheduler->InjectIODispatcher(this);
     dispPolicy = new DispatcherPolicyQos(this, eventScheduler);
+    readHedgingPolicy = ReadHedgingPolicy::Create();
+    ioWorkerRebalancer = IOWorkerRebalancer::Create(this);
 }
 
 IODispatcher::~IODispatcher(void)
 {
+    delete ioWorkerRebalancer;
     IOWorkerMapIter it;
     for (it = ioWorkerMap.begin(); it != ioWorkerMap.end(); it++)
     {
         delete it->second;
     }
     delete dispPolicy;
+    delete readHedgingPolicy;
     eventScheduler->EjectIODispatcher();
 }
 
@@ -189,6 +197,11 @@ IODispatcher::AddDeviceForIOWorker(UblockSharedPtr dev, cpu_set_t cpuSet)
         IOWorker* ioWorker = it->second;
         dev->SetDedicatedIOWorker(ioWorker);
         ioWorker->AddDevice(dev);
+        DeviceLatencyTracker* tracker = dev->GetLatencyTracker();
+        if (DeviceType::SSD == dev->GetType() && nullptr != tracker)
+        {
+            ioWorkerDeviceMap[dev] = {cpuSet, tracker->GetSampleCount()};
+        }
     }
 
     pthread_rwlock_unlock(&ioWorkerMapLock);
@@ -204,15 +217,86 @@ IODispatcher::RemoveDeviceForIOWorker(UblockSharedPtr dev)
     {
         ioWorker->RemoveDevice(dev);
     }
+    ioWorkerDeviceMap.erase(dev);
 }
 
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Move at most one ssd from the busiest IOWorker to a less busy one,
+ *           by the io completion rate of ssds since the last call
+ *
+ * @Param    imbalancePercent: load of the busiest IOWorker to be lowered at least
+ */
+/* --------------------------------------------------------------------------*/
 void
+IODispatcher::RebalanceIOWorkers(uint32_t imbalancePercent)
+{
+    std::lock_guard<std::mutex> lock(deviceLock);
+    pthread_rwlock_rdlock(&ioWorkerMapLock);
+
+    std::vector<IOWorker*> workers;
+    std::vector<IOWorkerLoad> workerLoads;
+    std::unordered_map<IOWorker*, uint32_t> workerIndexes;
+    std::unordered_map<uint32_t, uint32_t> coreToWorkerIndex;
+    for (auto& worker : ioWorkerMap)
+    {
+        uint32_t logicalCore = worker.first;
+        int numa = AffinityManagerSingleton::Instance()->GetNumaIdFromCoreId(logicalCore);
+        coreToWorkerIndex[logicalCore] = workers.size();
+        workerIndexes[worker.second] = workers.size();
+        workers.push_back(worker.second);
+        workerLoads.push_back({numa, 0});
+    }
+
+    std::vector<UblockSharedPtr> devices;
+    std::vector<DeviceLoad> deviceLoads;
+    for (auto& entry : ioWorkerDeviceMap)
+    {
+        UblockSharedPtr dev = entry.first;
+        auto worker = workerIndexes.find(dev->GetDedicatedIOWorker());
+        if (worker == workerIndexes.end())
+        {
+            continue;
+        }
+
+        uint64_t completionCount = dev->GetLatencyTracker()->GetSampleCount();
+        DeviceLoad deviceLoad = {dev->GetNuma(),
+            completionCount - entry.second.lastCompletionCount, worker->second, {}};
+        entry.second.lastCompletionCount = completionCount;
+        uint32_t cpuCount = CPU_COUNT(&entry.second.cpuSet);
+        for (uint32_t index = 0; index < cpuCount; index++)
+        {
+            auto core = coreToWorkerIndex.find(_GetLogicalCore(entry.second.cpuSet, index));
+            if (core != coreToWorkerIndex.end())
+            {
+                deviceLoad.candidateWorkerIndexes.push_back(core->second);
+            }
+        }
+        devices.push_back(dev);
+        deviceLoads.push_back(deviceLoad);
+    }
+
+    uint32_t deviceIndex = 0;
+    uint32_t workerIndex = 0;
+    if (IOWorkerRebalancer::PickMigration(workerLoads, deviceLoads,
+        imbalancePercent, deviceIndex, workerIndex))
+    {
+        _MigrateDevice(devices[deviceIndex],
+            workers[deviceLoads[deviceIndex].workerIndex], workers[workerIndex]);
+    }
+
+    pthread_rwlock_unlock(&ioWorkerMapLock);
+}
+
+int
 IODispatcher::CompleteForThreadLocalDeviceList(void)
 {
+    int completions = 0;
     for (auto& iter : threadLocalDeviceList)
     {
-        iter->CompleteIOs();
+        completions += iter->CompleteIOs();
     }
+    return completions;
 }
 
 int
@@ -253,6 +337,11 @@ IODispatcher::Submit(UbioSmartPtr ubio, bool sync, bool ioRecoveryNeeded)
             _SubmitRecovery(ubio);
             return DEVICE_FAILED;
         }
+        if (readHedgingPolicy != nullptr && readHedgingPolicy->ShouldReadFromPeers(ubio))
+        {
+            _SubmitReadFromPeers(ubio);
+            return ret;
+        }
     }
 
     UBlockDevice* ublock = nullptr;
@@ -278,6 +367,42 @@ IODispatcher::Submit(UbioSmartPtr ubio, bool sync, bool ioRecoveryNeeded)
     return ret;
 }
 
+// Asynchronous submission of ubios which are translated together. The ubios to
+// recover or to read from peers take their own path as in Submit(), and the
+// rest are queued to the IOWorkers a group per worker.
+int
+IODispatcher::SubmitBatch(std::vector<UbioSmartPtr>& ubios)
+{
+    int ret = 0;
+    std::vector<UbioSmartPtr> ubiosToQueue;
+    ubiosToQueue.reserve(ubios.size());
+    for (auto& ubio : ubios)
+    {
+        if (ubio->NeedRecovery())
+        {
+            _SubmitRecovery(ubio);
+            ret = DEVICE_FAILED;
+            continue;
+        }
+        if (readHedgingPolicy != nullptr && readHedgingPolicy->ShouldReadFromPeers(ubio))
+        {
+            _SubmitReadFromPeers(ubio);
+            continue;
+        }
+        ubiosToQueue.push_back(ubio);
+    }
+
+    if (false == ubiosToQueue.empty())
+    {
+        int result = IODispatcherSubmissionSingleton::Instance()->SubmitIOBatch(ubiosToQueue, dispPolicy);
+        if (result < 0)
+        {
+            ret = result;
+        }
+    }
+    return ret;
+}
+
 void
 IODispatcher::ProcessQueues(void)
 {
@@ -376,6 +501,41 @@ IODispatcher::_SubmitRecovery(UbioSmartPtr ubio)
     eventScheduler->EnqueueEvent(failure);
 }
 
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Move the device without stopping io. The device is opened by the
+ *           new IOWorker first. Then new ubios go to the new IOWorker, and the
+ *           old IOWorker forwards the ones still in its queue. Finally, the old
+ *           IOWorker completes its outstanding ios and closes the device.
+ */
+/* --------------------------------------------------------------------------*/
+void
+IODispatcher::_MigrateDevice(UblockSharedPtr dev, IOWorker* from, IOWorker* to)
+{
+    if (false == to->MigrateDeviceIn(dev))
+    {
+        POS_TRACE_WARN(EID(IOWORKER_DEVICE_MIGRATION_FAILED),
+            "Failed to move {} from IOWorker{} to IOWorker{}",
+            dev->GetName(), from->GetWorkerId(), to->GetWorkerId());
+        return;
+    }
+    dev->ChangeDedicatedIOWorker(to);
+    from->RemoveDevice(dev);
+
+    POS_TRACE_INFO(EID(IOWORKER_DEVICE_MIGRATED),
+        "{} has been moved from IOWorker{} to IOWorker{}",
+        dev->GetName(), from->GetWorkerId(), to->GetWorkerId());
+}
+
+void
+IODispatcher::_SubmitReadFromPeers(UbioSmartPtr ubio)
+{
+    // No error is set, so that IoRecoveryEvent can tell a slow device
+    // from a failed one and fall back to the device itself
+    EventSmartPtr readFromPeers = recoveryEventFactory->Create(ubio);
+    eventScheduler->EnqueueEvent(readFromPeers);
+}
+
 void
 IODispatcher::_ProcessCurrentFrontend(void* ublockDevice)
 {
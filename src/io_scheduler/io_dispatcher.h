@@ -51,6 +51,8 @@ class EventFactory;
 class EventFrameworkApi;
 class EventScheduler;
 class DispatcherPolicyI;
+class ReadHedgingPolicy;
+class IOWorkerRebalancer;
 
 class IODispatcher : public IIODispatcher
 {
@@ -70,9 +72,11 @@ public:
     void AddDeviceForIOWorker(UblockSharedPtr dev, cpu_set_t cpuSet) override;
     void RemoveDeviceForIOWorker(UblockSharedPtr dev) override;
 
-    static void CompleteForThreadLocalDeviceList(void);
+    static int CompleteForThreadLocalDeviceList(void);
     int Submit(UbioSmartPtr ubio, bool sync = false, bool ioRecoveryNeeded = true) override;
+    virtual int SubmitBatch(std::vector<UbioSmartPtr>& ubios);
     void ProcessQueues(void) override;
+    void RebalanceIOWorkers(uint32_t imbalancePercent);
 
     static void RegisterRecoveryEventFactory(EventFactory* recoveryEventFactory);
     static void SetFrontendDone(bool value);
@@ -84,6 +88,8 @@ private:
     uint32_t _GetLogicalCore(cpu_set_t cpuSet, uint32_t index);
     void _CallForFrontend(UblockSharedPtr device);
     void _SubmitRecovery(UbioSmartPtr ubio);
+    void _SubmitReadFromPeers(UbioSmartPtr ubio);
+    void _MigrateDevice(UblockSharedPtr dev, IOWorker* from, IOWorker* to);
     static void _ProcessCurrentFrontend(void* ublockDevice);
     static void _AddDeviceToThreadLocalList(UblockSharedPtr device);
     static void _RemoveDeviceFromThreadLocalList(UblockSharedPtr device);
@@ -100,6 +106,17 @@ private:
     EventScheduler* eventScheduler;
     std::mutex deviceLock;
     DispatcherPolicyI* dispPolicy;
+    ReadHedgingPolicy* readHedgingPolicy;
+    IOWorkerRebalancer* ioWorkerRebalancer;
+
+    // ssds given to IOWorkers, with the cpus of IOWorkers they are allowed to
+    // and their io completion count at the last rebalancing
+    struct IOWorkerDevice
+    {
+        cpu_set_t cpuSet;
+        uint64_t lastCompletionCount;
+    };
+    std::unordered_map<UblockSharedPtr, IOWorkerDevice> ioWorkerDeviceMap;
 
     enum class DispatcherAction
     {
@@ -356,6 +356,57 @@ IODispatcherSubmission::SubmitIO(UBlockDevice* ublock,
     return ret;
 }
 
+// Ubios bound to IOWorkers are grouped per worker so that each worker queue
+// takes its share in one operation. Submissions through reactors are not
+// grouped since every ubio is sent as an event of its own.
+int
+IODispatcherSubmission::SubmitIOBatch(std::vector<UbioSmartPtr>& ubios,
+    DispatcherPolicyI* dispatcherPolicy)
+{
+    int ret = 0;
+    bool isReactor = EventFrameworkApiSingleton::Instance()->IsReactorNow();
+    if (isReactor || AffinityManagerSingleton::Instance()->UseEventReactor())
+    {
+        for (auto& ubio : ubios)
+        {
+            int result = SubmitIO(ubio->GetUBlock(), ubio, dispatcherPolicy);
+            if (result < 0)
+            {
+                ret = result;
+            }
+        }
+        return ret;
+    }
+
+    std::vector<std::pair<IOWorker*, std::vector<UbioSmartPtr>>> groups;
+    for (auto& ubio : ubios)
+    {
+        UBlockDevice* ublock = ubio->GetUBlock();
+        IOWorker* ioWorker = (nullptr == ublock) ? nullptr : ublock->GetDedicatedIOWorker();
+        if (unlikely(nullptr == ioWorker))
+        {
+            continue;
+        }
+        auto group = groups.begin();
+        while (group != groups.end() && group->first != ioWorker)
+        {
+            group++;
+        }
+        if (group == groups.end())
+        {
+            groups.emplace_back(ioWorker, std::vector<UbioSmartPtr>());
+            group = groups.end() - 1;
+        }
+        group->second.push_back(ubio);
+    }
+
+    for (auto& group : groups)
+    {
+        dispatcherPolicy->SubmitBatch(group.first, group.second);
+    }
+    return ret;
+}
+
 StateObserverForIO::StateObserverForIO(IStateControl* state)
 :state(state)
 {
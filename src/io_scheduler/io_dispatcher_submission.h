@@ -32,6 +32,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "src/include/backend_event.h"
 #include "src/state/interface/i_state_control.h"
 #include "src/state/interface/i_state_observer.h"
@@ -94,6 +96,7 @@ public:
     void SetReactorRatio(BackendEvent event, uint32_t ratio);
     void RefillRemaining(uint64_t scale);
     int SubmitIO(UBlockDevice* ublock, UbioSmartPtr ubio, DispatcherPolicyI* dispatcherPolicy);
+    int SubmitIOBatch(std::vector<UbioSmartPtr>& ubios, DispatcherPolicyI* dispatcherPolicy);
     void RebuildMode(void);
     void ChangeScheduleMode(bool enabled);
     void CheckAndSetBusyMode(void);
@@ -81,6 +81,22 @@ IOQueue::EnqueueUbio(UbioSmartPtr input)
     queue.push(input);
 }
 
+void
+IOQueue::EnqueueUbios(std::vector<UbioSmartPtr>& inputs)
+{
+    std::unique_lock<std::mutex> uniqueLock(queueLock);
+    for (auto& input : inputs)
+    {
+        if (nullptr == input)
+        {
+            POS_TRACE_WARN(EID(IOQ_ENQUEUE_NULL_UBIO),
+                "Enqueue null ubio");
+            continue;
+        }
+        queue.push(input);
+    }
+}
+
 int
 IOQueue::GetQueueSize(void)
 {
@@ -52,6 +52,7 @@ public:
 
     UbioSmartPtr DequeueUbio(void);
     void EnqueueUbio(UbioSmartPtr input);
+    void EnqueueUbios(std::vector<UbioSmartPtr>& inputs);
     int GetQueueSize(void);
 
 private:
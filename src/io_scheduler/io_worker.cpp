@@ -53,8 +53,11 @@
 #include "src/include/branch_prediction.h"
 #include "src/include/memory.h"
 #include "src/include/pos_event_id.hpp"
+#include "src/io_scheduler/adaptive_poller.h"
+#include "src/io_scheduler/io_coalescer.h"
 #include "src/io_scheduler/io_queue.h"
 #include "src/logger/logger.h"
+#include "src/master_context/config_manager.h"
 #include "src/qos/qos_common.h"
 #include "src/qos/qos_manager.h"
 
@@ -71,6 +74,8 @@ IOWorker::IOWorker(cpu_set_t cpuSetInput, uint32_t id,
     DeviceDetachTrigger* detachTriggerArg, QosManager* qosManagerArg, EventScheduler* eventSchedulerArg)
 : cpuSet(cpuSetInput),
   ioQueue(new IOQueue),
+  coalescer(_CreateCoalescer()),
+  poller(nullptr),
   currentOutstandingIOCount(0),
   exit(false),
   id(id),
@@ -91,6 +96,7 @@ IOWorker::IOWorker(cpu_set_t cpuSetInput, uint32_t id,
     {
         eventScheduler = EventSchedulerSingleton::Instance();
     }
+    poller = _CreatePoller();
     thread = new std::thread(&IOWorker::Run, this);
 }
 /* --------------------------------------------------------------------------*/
@@ -101,8 +107,14 @@ IOWorker::IOWorker(cpu_set_t cpuSetInput, uint32_t id,
 IOWorker::~IOWorker(void)
 {
     exit = true;
+    if (nullptr != poller)
+    {
+        poller->Wakeup();
+    }
     thread->join();
     delete ioQueue;
+    delete coalescer;
+    delete poller;
 
     if (true == productDetachTrigger)
     {
@@ -144,6 +156,37 @@ IOWorker::EnqueueUbio(UbioSmartPtr ubio)
     if (ubio != nullptr)
     {
         eventScheduler->IoEnqueued(ubio->GetEventType(), ubio->GetSize());
+        if (nullptr != poller)
+        {
+            poller->Wakeup();
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Queue a group of ubios for the devices of this IOWorker at once,
+ *           so that the queue is locked and the poller woken up only once
+ *
+ * @Param    ubios
+ */
+/* --------------------------------------------------------------------------*/
+void
+IOWorker::EnqueueUbios(std::vector<UbioSmartPtr>& ubios)
+{
+    ioQueue->EnqueueUbios(ubios);
+    bool enqueued = false;
+    for (auto& ubio : ubios)
+    {
+        if (ubio != nullptr)
+        {
+            eventScheduler->IoEnqueued(ubio->GetEventType(), ubio->GetSize());
+            enqueued = true;
+        }
+    }
+    if (enqueued && nullptr != poller)
+    {
+        poller->Wakeup();
     }
 }
 
@@ -168,6 +211,10 @@ IOWorker::AddDevice(UblockSharedPtr device)
         POS_EVENT_ID eventId = EID(IOWORKER_DEVICE_ADDED);
         POS_TRACE_INFO(eventId, "{} has been added to IOWorker{}",
             device->GetName(), id);
+        if (nullptr != poller)
+        {
+            poller->Wakeup();
+        }
         operationQueue.SubmitAndWait(INSERT, device);
     }
     else
@@ -207,11 +254,34 @@ IOWorker::AddDevices(std::vector<UblockSharedPtr>* inputList)
 uint32_t
 IOWorker::RemoveDevice(UblockSharedPtr device)
 {
+    if (nullptr != poller)
+    {
+        poller->Wakeup();
+    }
     operationQueue.SubmitAndWait(REMOVE, device);
 
     return deviceList.size();
 }
 
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis    Opens the given UBlockDevice, which is being moved from another
+ *              IOWorker, for this IOWorker. Unlike AddDevice, the device is not
+ *              detached on failure, as it still works on the other IOWorker.
+ * @Param       device: a UBlockDevice to move to this IOWorker
+ * @return      true if the device is opened for this IOWorker.
+ */
+/* --------------------------------------------------------------------------*/
+bool
+IOWorker::MigrateDeviceIn(UblockSharedPtr device)
+{
+    if (nullptr != poller)
+    {
+        poller->Wakeup();
+    }
+    return operationQueue.SubmitAndWait(MIGRATE_IN, device);
+}
+
 /* --------------------------------------------------------------------------*/
 /**
  * @Synopsis Big loop of IOWorker
@@ -233,16 +303,28 @@ IOWorker::Run(void)
     while (false == exit)
     {
         ubio = ioQueue->DequeueUbio();
+        bool isIdle = (nullptr == ubio);
         while (nullptr != ubio)
         {
-            _SubmitAsyncIO(ubio);
+            if (false == _ForwardToDedicatedIOWorker(ubio))
+            {
+                _CoalesceOrSubmitAsyncIO(ubio);
+            }
             _DoPeriodicJob();
             eventScheduler->IoDequeued(ubio->GetEventType(), ubio->GetSize());
             ubio = ioQueue->DequeueUbio();
         }
+        _SubmitCoalescedIO();
         _SubmitPendingIO();
         _DoPeriodicJob();
-        usleep(1);
+        if (nullptr == poller)
+        {
+            usleep(1);
+        }
+        else
+        {
+            poller->Poll(isIdle && 0 == currentOutstandingIOCount);
+        }
     }
 }
 
@@ -263,6 +345,125 @@ IOWorker::_SubmitAsyncIO(UbioSmartPtr ubio)
         &ioWorkerSubmissionNotifier, id, ubio);
 }
 
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Pass the ubio to the IOWorker which its device has been moved to,
+ *           after the ubio was queued to this IOWorker
+ *
+ * @Param    ubio
+ * @return   true if the ubio is forwarded
+ */
+/* --------------------------------------------------------------------------*/
+bool
+IOWorker::_ForwardToDedicatedIOWorker(UbioSmartPtr ubio)
+{
+    UBlockDevice* ublock = ubio->GetUBlock();
+    if (nullptr == ublock)
+    {
+        return false;
+    }
+    IOWorker* dedicatedIOWorker = ublock->GetDedicatedIOWorker();
+    if (likely(this == dedicatedIOWorker || nullptr == dedicatedIOWorker))
+    {
+        return false;
+    }
+    dedicatedIOWorker->EnqueueUbio(ubio);
+    return true;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Keep the ubio to be merged with the following lba-adjacent ones
+ *           dequeued in the same round. Submit at once if coalescing is off.
+ *
+ * @Param    ubio
+ */
+/* --------------------------------------------------------------------------*/
+void
+IOWorker::_CoalesceOrSubmitAsyncIO(UbioSmartPtr ubio)
+{
+    if (nullptr == coalescer)
+    {
+        _SubmitAsyncIO(ubio);
+        return;
+    }
+
+    if (coalescer->Add(ubio))
+    {
+        return;
+    }
+    _SubmitCoalescedIO();
+    if (false == coalescer->Add(ubio))
+    {
+        _SubmitAsyncIO(ubio);
+    }
+}
+
+void
+IOWorker::_SubmitCoalescedIO(void)
+{
+    if (nullptr == coalescer)
+    {
+        return;
+    }
+
+    UbioSmartPtr ubio = coalescer->Flush();
+    if (nullptr != ubio)
+    {
+        _SubmitAsyncIO(ubio);
+    }
+}
+
+IOCoalescer*
+IOWorker::_CreateCoalescer(void)
+{
+    ConfigManager* configManager = ConfigManagerSingleton::Instance();
+    bool enable = false;
+    int ret = configManager->GetValue("performance",
+        "io_coalescing_enable", &enable, CONFIG_TYPE_BOOL);
+    if (ret != EID(SUCCESS) || false == enable)
+    {
+        return nullptr;
+    }
+
+    uint32_t maxSizeInKb = DEFAULT_MAX_COALESCED_SIZE_IN_KB;
+    ret = configManager->GetValue("performance",
+        "io_coalescing_max_size_in_kb", &maxSizeInKb, CONFIG_TYPE_UINT32);
+    if (ret != EID(SUCCESS) || 0 == maxSizeInKb)
+    {
+        maxSizeInKb = DEFAULT_MAX_COALESCED_SIZE_IN_KB;
+    }
+
+    POS_TRACE_INFO(EID(IOWORKER_IO_COALESCING_ENABLED),
+        "IO coalescing is enabled for IOWorker{}, max size: {}KB", id, maxSizeInKb);
+    return new IOCoalescer(maxSizeInKb * 1024);
+}
+
+AdaptivePoller*
+IOWorker::_CreatePoller(void)
+{
+    ConfigManager* configManager = ConfigManagerSingleton::Instance();
+    bool enable = false;
+    int ret = configManager->GetValue("performance",
+        "adaptive_polling_enable", &enable, CONFIG_TYPE_BOOL);
+    if (ret != EID(SUCCESS) || false == enable)
+    {
+        return nullptr;
+    }
+
+    uint32_t maxSleepInUsec = DEFAULT_MAX_POLLING_SLEEP_IN_USEC;
+    ret = configManager->GetValue("performance",
+        "adaptive_polling_max_sleep_in_usec", &maxSleepInUsec, CONFIG_TYPE_UINT32);
+    if (ret != EID(SUCCESS) || 0 == maxSleepInUsec)
+    {
+        maxSleepInUsec = DEFAULT_MAX_POLLING_SLEEP_IN_USEC;
+    }
+
+    POS_TRACE_INFO(EID(IOWORKER_ADAPTIVE_POLLING_ENABLED),
+        "Adaptive polling is enabled for IOWorker{}, max sleep: {}us", id, maxSleepInUsec);
+    return new AdaptivePoller(maxSleepInUsec, "UDDIOWorker" + std::to_string(id));
+}
+
 void
 IOWorker::_SubmitPendingIO(void)
 {
@@ -342,6 +543,16 @@ IOWorker::_HandleDeviceOperation(void)
 
             break;
         }
+        case MIGRATE_IN:
+        {
+            deviceList.insert(device);
+            if (false == device->Open())
+            {
+                deviceList.erase(device);
+                operation->SetFailed();
+            }
+            break;
+        }
         case REMOVE:
         {
             deviceList.erase(device);
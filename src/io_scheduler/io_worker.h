@@ -45,6 +45,8 @@
 
 namespace pos
 {
+class AdaptivePoller;
+class IOCoalescer;
 class IOQueue;
 class Ubio;
 class UBlockDevice;
@@ -69,26 +71,38 @@ public:
     virtual void DecreaseCurrentOutstandingIoCount(int count);
 
     virtual void EnqueueUbio(UbioSmartPtr ubio);
+    virtual void EnqueueUbios(std::vector<UbioSmartPtr>& ubios);
     int GetQueueSize(void);
     uint32_t AddDevice(UblockSharedPtr device);
     uint32_t AddDevices(std::vector<UblockSharedPtr>* inputList);
     virtual uint32_t RemoveDevice(UblockSharedPtr device);
+    virtual bool MigrateDeviceIn(UblockSharedPtr device);
 
     void Run(void);
 
 private:
     void _SubmitAsyncIO(UbioSmartPtr ubio);
+    bool _ForwardToDedicatedIOWorker(UbioSmartPtr ubio);
+    void _CoalesceOrSubmitAsyncIO(UbioSmartPtr ubio);
+    void _SubmitCoalescedIO(void);
+    IOCoalescer* _CreateCoalescer(void);
+    AdaptivePoller* _CreatePoller(void);
     void _SubmitPendingIO(void);
     void _CompleteCommand(void);
     void _DoPeriodicJob(void);
     void _HandleDeviceOperation(void);
 
+    static const uint32_t DEFAULT_MAX_COALESCED_SIZE_IN_KB = 128;
+    static const uint32_t DEFAULT_MAX_POLLING_SLEEP_IN_USEC = 1000;
+
     using DeviceSet = std::unordered_set<UblockSharedPtr>;
     using DeviceSetIter = DeviceSet::iterator;
 
     IoWorkerDeviceOperationQueue operationQueue;
     cpu_set_t cpuSet;
     IOQueue* ioQueue;
+    IOCoalescer* coalescer;
+    AdaptivePoller* poller;
     std::thread* thread;
     uint32_t currentOutstandingIOCount;
 
@@ -41,7 +41,8 @@ IoWorkerDeviceOperation::IoWorkerDeviceOperation(
     UblockSharedPtr device)
 : command(type),
   device(device),
-  done(false)
+  done(false),
+  succeeded(true)
 {
 }
 
@@ -60,6 +61,19 @@ IoWorkerDeviceOperation::SetDone(void)
     done = true;
 }
 
+// Shall be called before SetDone(), which publishes the result to the waiter
+void
+IoWorkerDeviceOperation::SetFailed(void)
+{
+    succeeded = false;
+}
+
+bool
+IoWorkerDeviceOperation::IsSucceeded(void)
+{
+    return succeeded;
+}
+
 IoWorkerDeviceOperationType
 IoWorkerDeviceOperation::GetCommand(void)
 {
@@ -42,7 +42,8 @@ namespace pos
 enum IoWorkerDeviceOperationType
 {
     INSERT,
-    REMOVE
+    REMOVE,
+    MIGRATE_IN
 };
 
 class IoWorkerDeviceOperation
@@ -51,6 +52,8 @@ public:
     IoWorkerDeviceOperation(IoWorkerDeviceOperationType type, UblockSharedPtr device);
     void WaitDone(void);
     void SetDone(void);
+    void SetFailed(void);
+    bool IsSucceeded(void);
     UblockSharedPtr GetDevice(void);
     IoWorkerDeviceOperationType GetCommand(void);
 
@@ -58,6 +61,7 @@ private:
     IoWorkerDeviceOperationType command;
     UblockSharedPtr device;
     std::atomic<bool> done;
+    bool succeeded;
 };
 
 } // namespace pos
@@ -50,7 +50,7 @@ IoWorkerDeviceOperationQueue::Pop(void)
     return ret;
 }
 
-void
+bool
 IoWorkerDeviceOperationQueue::SubmitAndWait(IoWorkerDeviceOperationType type,
     UblockSharedPtr device)
 {
@@ -60,5 +60,6 @@ IoWorkerDeviceOperationQueue::SubmitAndWait(IoWorkerDeviceOperationType type,
         queue.push(&operation);
     }
     operation.WaitDone();
+    return operation.IsSucceeded();
 }
 
@@ -44,7 +44,7 @@ namespace pos
 class IoWorkerDeviceOperationQueue
 {
 public:
-    void SubmitAndWait(IoWorkerDeviceOperationType type, UblockSharedPtr device);
+    bool SubmitAndWait(IoWorkerDeviceOperationType type, UblockSharedPtr device);
     IoWorkerDeviceOperation* Pop(void);
 
 private:
@@ -0,0 +1,231 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io_scheduler/io_worker_rebalancer.h"
+
+#include <pthread.h>
+
+#include <algorithm>
+#include <chrono>
+
+#include "src/cpu_affinity/affinity_manager.h"
+#include "src/include/pos_event_id.hpp"
+#include "src/io_scheduler/io_dispatcher.h"
+#include "src/logger/logger.h"
+#include "src/master_context/config_manager.h"
+
+namespace pos
+{
+IOWorkerRebalancer::IOWorkerRebalancer(IODispatcher* ioDispatcher,
+    uint32_t intervalSec, uint32_t imbalancePercent)
+: ioDispatcher(ioDispatcher),
+  intervalSec(intervalSec),
+  imbalancePercent(imbalancePercent),
+  exit(false),
+  thread(nullptr)
+{
+    thread = new std::thread(&IOWorkerRebalancer::_Run, this);
+}
+
+IOWorkerRebalancer::~IOWorkerRebalancer(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(runLock);
+        exit = true;
+    }
+    exitCondition.notify_all();
+    thread->join();
+    delete thread;
+}
+
+void
+IOWorkerRebalancer::_Run(void)
+{
+    AffinityManagerSingleton::Instance()->SetGeneralAffinitySelf();
+    pthread_setname_np(pthread_self(), "IOWorkerBalance");
+
+    std::unique_lock<std::mutex> lock(runLock);
+    while (false == exit)
+    {
+        exitCondition.wait_for(lock, std::chrono::seconds(intervalSec),
+            [this] { return exit.load(); });
+        if (exit)
+        {
+            break;
+        }
+        lock.unlock();
+        ioDispatcher->RebalanceIOWorkers(imbalancePercent);
+        lock.lock();
+    }
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Pick a device to move away from the busiest IOWorker. Only one
+ *           device is moved at a time, and only if it lowers the load of the
+ *           busiest IOWorker by imbalancePercent, not to move devices back and
+ *           forth. IOWorkers on the numa node of the device are preferred, and
+ *           the others are considered only if none of them is allowed.
+ *
+ * @Param    workers: load of each IOWorker is summed up from devices
+ * @Param    devices
+ * @Param    imbalancePercent
+ * @Param    deviceIndex: [out] index of the device to move
+ * @Param    workerIndex: [out] index of the IOWorker to move the device to
+ * @return   true if there is a device to move
+ */
+/* --------------------------------------------------------------------------*/
+bool
+IOWorkerRebalancer::PickMigration(std::vector<IOWorkerLoad>& workers,
+    std::vector<DeviceLoad>& devices, uint32_t imbalancePercent,
+    uint32_t& deviceIndex, uint32_t& workerIndex)
+{
+    std::vector<uint32_t> deviceCount(workers.size(), 0);
+    for (auto& worker : workers)
+    {
+        worker.load = 0;
+    }
+    for (auto& device : devices)
+    {
+        workers[device.workerIndex].load += device.load;
+        deviceCount[device.workerIndex]++;
+    }
+
+    // moving the only device of an IOWorker just moves the load as a whole
+    bool found = false;
+    uint32_t sourceIndex = 0;
+    for (uint32_t index = 0; index < workers.size(); index++)
+    {
+        if (1 < deviceCount[index] &&
+            (false == found || workers[sourceIndex].load < workers[index].load))
+        {
+            sourceIndex = index;
+            found = true;
+        }
+    }
+    if (false == found || 0 == workers[sourceIndex].load)
+    {
+        return false;
+    }
+
+    uint64_t bestGain = 0;
+    for (uint32_t index = 0; index < devices.size(); index++)
+    {
+        DeviceLoad& device = devices[index];
+        if (device.workerIndex != sourceIndex)
+        {
+            continue;
+        }
+
+        uint32_t targetIndex = 0;
+        uint64_t gain = 0;
+        bool targetFound = _PickTarget(workers, device, sourceIndex, true, targetIndex, gain);
+        if (false == targetFound)
+        {
+            targetFound = _PickTarget(workers, device, sourceIndex, false, targetIndex, gain);
+        }
+        if (targetFound && bestGain < gain)
+        {
+            bestGain = gain;
+            deviceIndex = index;
+            workerIndex = targetIndex;
+        }
+    }
+
+    return bestGain * 100 > workers[sourceIndex].load * imbalancePercent;
+}
+
+bool
+IOWorkerRebalancer::_PickTarget(std::vector<IOWorkerLoad>& workers,
+    DeviceLoad& device, uint32_t sourceIndex, bool sameNumaOnly,
+    uint32_t& targetIndex, uint64_t& gain)
+{
+    bool found = false;
+    uint64_t sourceLoad = workers[sourceIndex].load;
+    for (uint32_t candidate : device.candidateWorkerIndexes)
+    {
+        if (candidate == sourceIndex)
+        {
+            continue;
+        }
+        if (sameNumaOnly && (UNKNOWN_NUMA == device.numa ||
+            workers[candidate].numa != device.numa))
+        {
+            continue;
+        }
+
+        found = true;
+        uint64_t targetLoad = workers[candidate].load + device.load;
+        uint64_t newMaxLoad = std::max(sourceLoad - device.load, targetLoad);
+        uint64_t candidateGain = (newMaxLoad < sourceLoad) ? sourceLoad - newMaxLoad : 0;
+        if (gain < candidateGain)
+        {
+            gain = candidateGain;
+            targetIndex = candidate;
+        }
+    }
+    return found;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Create the rebalancer from performance.io_worker_rebalance_interval_in_sec
+ *
+ * @return   nullptr if the rebalancer is disabled (interval is 0 or not configured)
+ */
+/* --------------------------------------------------------------------------*/
+IOWorkerRebalancer*
+IOWorkerRebalancer::Create(IODispatcher* ioDispatcher)
+{
+    ConfigManager* configManager = ConfigManagerSingleton::Instance();
+    uint32_t intervalSec = 0;
+    int ret = configManager->GetValue("performance",
+        "io_worker_rebalance_interval_in_sec", &intervalSec, CONFIG_TYPE_UINT32);
+    if (ret != EID(SUCCESS) || 0 == intervalSec)
+    {
+        return nullptr;
+    }
+
+    uint32_t imbalancePercent = DEFAULT_IMBALANCE_PERCENT;
+    ret = configManager->GetValue("performance",
+        "io_worker_rebalance_imbalance_percent", &imbalancePercent, CONFIG_TYPE_UINT32);
+    if (ret != EID(SUCCESS) || 0 == imbalancePercent || 100 < imbalancePercent)
+    {
+        imbalancePercent = DEFAULT_IMBALANCE_PERCENT;
+    }
+
+    POS_TRACE_INFO(EID(IOWORKER_REBALANCER_ENABLED),
+        "IOWorker rebalancer is enabled, interval: {}s, imbalance: {}%",
+        intervalSec, imbalancePercent);
+    return new IOWorkerRebalancer(ioDispatcher, intervalSec, imbalancePercent);
+}
+} // namespace pos
@@ -0,0 +1,98 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace pos
+{
+class IODispatcher;
+
+struct IOWorkerLoad
+{
+    int numa;
+    uint64_t load;
+};
+
+struct DeviceLoad
+{
+    int numa;
+    uint64_t load;
+    uint32_t workerIndex;
+    // IOWorkers which the device is allowed to be moved to
+    std::vector<uint32_t> candidateWorkerIndexes;
+};
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Move ssds between IOWorkers in the background, so that IOWorkers
+ *           left with several busy ssds after hot-remove or replacement share
+ *           them with the idle ones. Polling IOWorkers always keep their
+ *           cores busy, so the load is the io completion rate of the ssds.
+ */
+/* --------------------------------------------------------------------------*/
+class IOWorkerRebalancer
+{
+public:
+    IOWorkerRebalancer(IODispatcher* ioDispatcher, uint32_t intervalSec,
+        uint32_t imbalancePercent);
+    virtual ~IOWorkerRebalancer(void);
+
+    static bool PickMigration(std::vector<IOWorkerLoad>& workers,
+        std::vector<DeviceLoad>& devices, uint32_t imbalancePercent,
+        uint32_t& deviceIndex, uint32_t& workerIndex);
+    static IOWorkerRebalancer* Create(IODispatcher* ioDispatcher);
+
+    static const uint32_t DEFAULT_IMBALANCE_PERCENT = 20;
+    static const int UNKNOWN_NUMA = -1;
+
+private:
+    void _Run(void);
+    static bool _PickTarget(std::vector<IOWorkerLoad>& workers, DeviceLoad& device,
+        uint32_t sourceIndex, bool sameNumaOnly, uint32_t& targetIndex, uint64_t& gain);
+
+    IODispatcher* ioDispatcher;
+    uint32_t intervalSec;
+    uint32_t imbalancePercent;
+
+    std::atomic<bool> exit;
+    std::mutex runLock;
+    std::condition_variable exitCondition;
+    std::thread* thread;
+};
+} // namespace pos
@@ -0,0 +1,133 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io_scheduler/read_hedging_policy.h"
+
+#include "src/bio/ubio.h"
+#include "src/device/base/device_latency_tracker.h"
+#include "src/device/base/ublock_device.h"
+#include "src/include/pos_event_id.hpp"
+#include "src/logger/logger.h"
+#include "src/master_context/config_manager.h"
+
+namespace pos
+{
+ReadHedgingPolicy::ReadHedgingPolicy(uint64_t thresholdUs, uint32_t latencyRatio)
+: thresholdNs(thresholdUs * 1000),
+  latencyRatio(latencyRatio)
+{
+}
+
+ReadHedgingPolicy::~ReadHedgingPolicy(void)
+{
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis A read goes to the peers when the average latency of its device
+ *           exceeds both the threshold and latencyRatio times the average
+ *           over all devices. The latter keeps reads on their devices when
+ *           the whole system is just busy, as a rebuild read costs a read of
+ *           every peer.
+ *
+ * @Param    ubio: a read which is about to be submitted to a normal device
+ */
+/* --------------------------------------------------------------------------*/
+bool
+ReadHedgingPolicy::ShouldReadFromPeers(UbioSmartPtr ubio)
+{
+    // Retried ubios and splits of a rebuild read are already served by the peers
+    if (ubio->dir != UbioDir::Read || ubio->IsRetry() ||
+        ubio->GetOriginUbio() != nullptr || ubio->CheckRecoveryAllowed() == false)
+    {
+        return false;
+    }
+
+    UBlockDevice* ublock = ubio->GetUBlock();
+    if (ublock == nullptr)
+    {
+        return false;
+    }
+    DeviceLatencyTracker* tracker = ublock->GetLatencyTracker();
+    if (tracker == nullptr || tracker->GetSampleCount() < MIN_SAMPLE_COUNT)
+    {
+        return false;
+    }
+
+    uint64_t deviceLatency = tracker->GetAverage();
+    if (deviceLatency <= thresholdNs)
+    {
+        return false;
+    }
+
+    DeviceLatencyTracker* overall = tracker->GetOverall();
+    if (overall != nullptr && deviceLatency <= overall->GetAverage() * latencyRatio)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Create the policy from performance.read_hedge_threshold_in_usec
+ *
+ * @return   nullptr if read hedging is disabled (threshold is 0 or not configured)
+ */
+/* --------------------------------------------------------------------------*/
+ReadHedgingPolicy*
+ReadHedgingPolicy::Create(void)
+{
+    ConfigManager* configManager = ConfigManagerSingleton::Instance();
+    uint64_t thresholdUs = 0;
+    int ret = configManager->GetValue("performance",
+        "read_hedge_threshold_in_usec", &thresholdUs, CONFIG_TYPE_UINT64);
+    if (ret != EID(SUCCESS) || 0 == thresholdUs)
+    {
+        return nullptr;
+    }
+
+    uint32_t latencyRatio = DEFAULT_LATENCY_RATIO;
+    ret = configManager->GetValue("performance",
+        "read_hedge_latency_ratio", &latencyRatio, CONFIG_TYPE_UINT32);
+    if (ret != EID(SUCCESS) || 0 == latencyRatio)
+    {
+        latencyRatio = DEFAULT_LATENCY_RATIO;
+    }
+
+    POS_TRACE_INFO(EID(IODISPATCHER_READ_HEDGING_ENABLED),
+        "Read hedging is enabled, threshold: {}us, latency ratio: {}",
+        thresholdUs, latencyRatio);
+    return new ReadHedgingPolicy(thresholdUs, latencyRatio);
+}
+} // namespace pos
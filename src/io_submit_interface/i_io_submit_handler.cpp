@@ -31,6 +31,10 @@
  */
 
 #include "i_io_submit_handler.h"
+
+#include <memory>
+
+#include "src/event_scheduler/continuation_callback.h"
 #include "src/include/pos_event_id.hpp"
 #include "src/include/branch_prediction.h"
 #include "src/logger/logger.h"
@@ -60,6 +64,36 @@ IIOSubmitHandler::RegisterInstance(IIOSubmitHandler* ioSubmitHandlerModule)
     instance = ioSubmitHandlerModule;
 }
 
+IOSubmitHandlerStatus
+IIOSubmitHandler::SubmitAsyncIO(IODirection direction,
+    std::list<BufferEntry>& bufferList,
+    LogicalBlkAddr& startLSA, uint64_t blockCount,
+    PartitionType partitionToIO,
+    std::function<void(uint32_t errorCount)> then, int arrayId)
+{
+    CallbackSmartPtr callback = std::make_shared<ContinuationCallback>(then);
+    return SubmitAsyncIO(direction, bufferList, startLSA, blockCount,
+        partitionToIO, callback, arrayId);
+}
+
+IOSubmitHandlerStatus
+IIOSubmitHandler::SubmitAsyncIOBatch(IODirection direction,
+    std::vector<AsyncIORequest>& requests,
+    PartitionType partitionToIO, int arrayId)
+{
+    IOSubmitHandlerStatus errorToReturn = IOSubmitHandlerStatus::SUCCESS;
+    for (auto& request : requests)
+    {
+        IOSubmitHandlerStatus status = SubmitAsyncIO(direction, request.bufferList,
+            request.startLSA, request.blockCount, partitionToIO, request.callback, arrayId);
+        if (status != IOSubmitHandlerStatus::SUCCESS && errorToReturn == IOSubmitHandlerStatus::SUCCESS)
+        {
+            errorToReturn = status;
+        }
+    }
+    return errorToReturn;
+}
+
 IIOSubmitHandler*
 IIOSubmitHandler::GetInstance(void)
 {
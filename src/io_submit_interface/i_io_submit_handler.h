@@ -33,8 +33,10 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <list>
 #include <string>
+#include <vector>
 
 #include "src/array/ft/buffer_entry.h"
 #include "src/bio/ubio.h"
@@ -52,6 +54,15 @@ enum class IODirection
     TRIM,
 };
 
+// One range of a batch given to SubmitAsyncIOBatch(), completed through its own callback
+struct AsyncIORequest
+{
+    std::list<BufferEntry> bufferList;
+    LogicalBlkAddr startLSA;
+    uint64_t blockCount;
+    CallbackSmartPtr callback;
+};
+
 class IIOSubmitHandler
 {
 public:
@@ -76,6 +87,22 @@ public:
         PartitionType partitionToIO,
         CallbackSmartPtr callback, int arrayId, bool parityOnly = false) = 0;
 
+    // Submits the I/O and runs "then" with its error count once it completes,
+    // so that callers chain their work to it instead of waiting on it
+    IOSubmitHandlerStatus
+    SubmitAsyncIO(IODirection direction,
+        std::list<BufferEntry>& bufferList,
+        LogicalBlkAddr& startLSA, uint64_t blockCount,
+        PartitionType partitionToIO,
+        std::function<void(uint32_t errorCount)> then, int arrayId);
+
+    // Submits several ranges of a partition together. The status is SUCCESS
+    // when every range is submitted, or else that of the first range failed.
+    virtual IOSubmitHandlerStatus
+    SubmitAsyncIOBatch(IODirection direction,
+        std::vector<AsyncIORequest>& requests,
+        PartitionType partitionToIO, int arrayId);
+
     virtual IOSubmitHandlerStatus
     SubmitAsyncByteIO(IODirection direction,
         void* buffer,
@@ -38,6 +38,7 @@
 #include "src/event_scheduler/event_scheduler.h"
 #include "src/include/pos_event_id.h"
 #include "src/logger/logger.h"
+#include "src/trace/flight_recorder.h"
 
 namespace pos
 {
@@ -86,10 +87,13 @@ CheckpointHandler::Start(MapList pendingDirtyMaps, EventSmartPtr callback)
 
     checkpointCompletionCallback = callback;
     _SetStatus(STARTED);
+    FlightRecorderSingleton::Instance()->Record(FlightEventType::CheckpointStart, arrayId,
+        logGroupIdInProgress);
 
     assert(numMapsToFlush == 0);
 
-    numMapsToFlush = pendingDirtyMaps.size();
+    // dirty maps are flushed as a single batch that completes once
+    numMapsToFlush = (pendingDirtyMaps.empty() == true) ? 0 : 1;
     numMapsFlushed = 0;
 
     if (numMapsToFlush == numMapsFlushed)
@@ -99,19 +103,16 @@ CheckpointHandler::Start(MapList pendingDirtyMaps, EventSmartPtr callback)
     else
     {
         POS_TRACE_INFO(EID(JOURNAL_CHECKPOINT_FLUSH_METADATA),
-            "logGroupId:{}, numMapsToFlush:{}, arrayId:{}", logGroupIdInProgress, numMapsToFlush, arrayId);
+            "logGroupId:{}, numMapsToFlush:{}, arrayId:{}", logGroupIdInProgress, pendingDirtyMaps.size(), arrayId);
 
-        for (auto mapId : pendingDirtyMaps)
+        EventSmartPtr eventMapFlush(new CheckpointMetaFlushCompleted(this, MAP_BATCH_META_ID, logGroupIdInProgress));
+        ret = mapFlush->FlushDirtyMaps(pendingDirtyMaps, eventMapFlush);
+        if (ret != 0)
         {
-            EventSmartPtr eventMapFlush(new CheckpointMetaFlushCompleted(this, mapId, logGroupIdInProgress));
-            ret = mapFlush->FlushDirtyMpages(mapId, eventMapFlush);
-            if (ret != 0)
-            {
-                // TODO(Cheolho.kang): Add status that can additionally indicate checkpoint status
-                POS_TRACE_ERROR(EID(JOURNAL_CHECKPOINT_FAILED),
-                    "mapId:{}, arrayId:{}", mapId, arrayId);
-                return ret;
-            }
+            // TODO(Cheolho.kang): Add status that can additionally indicate checkpoint status
+            POS_TRACE_ERROR(EID(JOURNAL_CHECKPOINT_FAILED),
+                "numMaps:{}, arrayId:{}", pendingDirtyMaps.size(), arrayId);
+            return ret;
         }
     }
 
@@ -176,6 +177,8 @@ CheckpointHandler::_TryToComplete(void)
     {
         POS_TRACE_INFO(EID(JOURNAL_CHECKPOINT_COMPLETED),
             "logGroupId:{}, arrayId:{}", logGroupIdInProgress, arrayId);
+        FlightRecorderSingleton::Instance()->Record(FlightEventType::CheckpointEnd, arrayId,
+            logGroupIdInProgress);
 
         // check status to complete checkpoint only once
         _SetStatus(COMPLETED);
@@ -67,6 +67,7 @@ private:
     void _SetStatus(CheckpointStatus to);
 
     static const int ALLOCATOR_META_ID = 1000;
+    static const int MAP_BATCH_META_ID = 1001;
 
     IMapFlush* mapFlush;
     IContextManager* contextManager;
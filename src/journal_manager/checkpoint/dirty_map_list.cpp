@@ -33,58 +33,91 @@
 #include "dirty_map_list.h"
 
 #include "src/journal_manager/config/journal_configuration.h"
+#include "src/volume/volume_base.h"
 
 namespace pos
 {
 DirtyMapList::DirtyMapList(void)
+: dirtyMaps(MAX_VOLUME_COUNT + 1)
 {
-    dirtyMaps.clear();
 }
 
 void
 DirtyMapList::Add(const MapList& dirty)
 {
-    // TODO(cheolho.kang): Remove lock using bitmap
-    std::unique_lock<std::mutex> lock(dirtyListLock);
-
     for (auto mapId : dirty)
     {
-        dirtyMaps.emplace(mapId);
+        dirtyMaps.SetBit(_GetBitOffset(mapId));
     }
 }
 
 MapList
 DirtyMapList::GetList(void)
 {
-    return dirtyMaps;
+    MapList list;
+    for (uint64_t bitOffset = 0; bitOffset < dirtyMaps.GetNumBits(); bitOffset++)
+    {
+        if (dirtyMaps.IsSetBit(bitOffset) == true)
+        {
+            list.emplace(_GetMapId(bitOffset));
+        }
+    }
+    return list;
 }
 
 MapList
 DirtyMapList::PopDirtyList(void)
 {
-    std::unique_lock<std::mutex> lock(dirtyListLock);
-    MapList dirtyPageToReturn = dirtyMaps;
-    dirtyMaps.clear();
+    BitMap snapshot(dirtyMaps.GetNumBits());
+    snapshot.ResetBitmap();
+    dirtyMaps.MoveSetBitsTo(snapshot);
 
-    return dirtyPageToReturn;
+    return _ToList(snapshot);
 }
 
 void
 DirtyMapList::Reset(void)
 {
-    dirtyMaps.clear();
+    dirtyMaps.ResetBitmap();
 }
 
 void
 DirtyMapList::Delete(int volumeId)
 {
-    std::unique_lock<std::mutex> lock(dirtyListLock);
+    dirtyMaps.ClearBit(_GetBitOffset(volumeId));
+}
+
+uint64_t
+DirtyMapList::_GetBitOffset(uint32_t mapId)
+{
+    if (mapId == static_cast<uint32_t>(STRIPE_MAP_ID))
+    {
+        return MAX_VOLUME_COUNT;
+    }
+    return mapId;
+}
+
+uint32_t
+DirtyMapList::_GetMapId(uint64_t bitOffset)
+{
+    if (bitOffset == MAX_VOLUME_COUNT)
+    {
+        return static_cast<uint32_t>(STRIPE_MAP_ID);
+    }
+    return bitOffset;
+}
 
-    auto mapIt = dirtyMaps.find(volumeId);
-    if (mapIt != dirtyMaps.end())
+MapList
+DirtyMapList::_ToList(BitMap& bitmap)
+{
+    MapList list;
+    uint64_t bitOffset = 0;
+    while ((bitOffset = bitmap.FindFirstSet(bitOffset)) != bitmap.GetNumBits())
     {
-        dirtyMaps.erase(volumeId);
+        list.emplace(_GetMapId(bitOffset));
+        bitOffset++;
     }
+    return list;
 }
 
 } // namespace pos
@@ -32,8 +32,7 @@
 
 #pragma once
 
-#include <mutex>
-
+#include "src/lib/atomic_bitmap.h"
 #include "src/mapper/include/mpage_info.h"
 
 namespace pos
@@ -55,8 +54,12 @@ public:
     virtual void Delete(int volumeId);
 
 private:
-    std::mutex dirtyListLock;
-    MapList dirtyMaps;
+    uint64_t _GetBitOffset(uint32_t mapId);
+    uint32_t _GetMapId(uint64_t bitOffset);
+    MapList _ToList(BitMap& bitmap);
+
+    // one bit per volume map, and the last one for the stripe map
+    AtomicBitMap dirtyMaps;
 };
 
 } // namespace pos
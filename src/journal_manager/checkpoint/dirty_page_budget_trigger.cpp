@@ -0,0 +1,157 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/journal_manager/checkpoint/dirty_page_budget_trigger.h"
+
+#include "src/journal_manager/config/journal_configuration.h"
+#include "src/journal_manager/log_write/buffer_offset_allocator.h"
+#include "src/logger/logger.h"
+#include "src/mapper/i_map_flush.h"
+#include "src/qos/qos_manager.h"
+
+namespace pos
+{
+DirtyPageBudgetTrigger::DirtyPageBudgetTrigger(void)
+: config(nullptr),
+  mapFlush(nullptr),
+  bufferAllocator(nullptr),
+  qosManager(nullptr),
+  dirtyPageBudget(0),
+  targetReplayTimeInMsec(0),
+  numLogsFilled(0)
+{
+}
+
+void
+DirtyPageBudgetTrigger::Init(JournalConfiguration* journalConfiguration,
+    IMapFlush* mapFlushToUse, BufferOffsetAllocator* allocator, QosManager* qos)
+{
+    config = journalConfiguration;
+    mapFlush = mapFlushToUse;
+    bufferAllocator = allocator;
+    qosManager = qos;
+
+    dirtyPageBudget = config->GetCheckpointDirtyPageBudget();
+    targetReplayTimeInMsec = config->GetCheckpointTargetReplayTimeInMsec();
+    numLogsFilled = 0;
+}
+
+bool
+DirtyPageBudgetTrigger::IsEnabled(void)
+{
+    return (mapFlush != nullptr) && (dirtyPageBudget != 0 || targetReplayTimeInMsec != 0);
+}
+
+void
+DirtyPageBudgetTrigger::LogFilled(int logGroupId, const MapList& dirty)
+{
+    // Counting the dirty pages walks every mounted volume,
+    // so the budget is checked once in a while rather than for every log
+    uint64_t numFilled = numLogsFilled.fetch_add(1) + 1;
+    if (numFilled % NUM_LOGS_PER_CHECK != 0)
+    {
+        return;
+    }
+
+    if (_IsCheckpointNeeded() == true)
+    {
+        bufferAllocator->SealActiveLogGroup();
+    }
+}
+
+void
+DirtyPageBudgetTrigger::LogBufferReseted(int logGroupId)
+{
+}
+
+uint64_t
+DirtyPageBudgetTrigger::GetEstimatedReplayTimeInMsec(uint64_t numDirtyMpages)
+{
+    uint64_t numLogsToReplay = bufferAllocator->GetNumLogsAdded();
+    uint64_t replayTimeInUsec = numLogsToReplay * REPLAY_TIME_PER_LOG_IN_USEC
+        + numDirtyMpages * FLUSH_TIME_PER_MPAGE_IN_USEC;
+    return replayTimeInUsec / 1000;
+}
+
+bool
+DirtyPageBudgetTrigger::_IsCheckpointNeeded(void)
+{
+    uint64_t numDirtyMpages = mapFlush->GetNumDirtyMpages();
+    uint64_t replayTime = GetEstimatedReplayTimeInMsec(numDirtyMpages);
+
+    uint64_t overshoot = 0;
+    if (dirtyPageBudget != 0 && numDirtyMpages >= dirtyPageBudget)
+    {
+        overshoot = numDirtyMpages / dirtyPageBudget;
+    }
+    if (targetReplayTimeInMsec != 0 && replayTime >= targetReplayTimeInMsec)
+    {
+        uint64_t replayOvershoot = replayTime / targetReplayTimeInMsec;
+        if (replayOvershoot > overshoot)
+        {
+            overshoot = replayOvershoot;
+        }
+    }
+
+    if (overshoot == 0)
+    {
+        return false;
+    }
+
+    if (overshoot < MAX_THROTTLED_OVERSHOOT && _IsMapFlushThrottled() == true)
+    {
+        POS_TRACE_DEBUG(EID(JOURNAL_LOG_GROUP_SEALED),
+            "Early checkpoint is deferred by qos, numDirtyMpages:{}, replayTime:{} msec",
+            numDirtyMpages, replayTime);
+        return false;
+    }
+
+    POS_TRACE_DEBUG(EID(JOURNAL_LOG_GROUP_SEALED),
+        "Checkpoint budget exceeded, numDirtyMpages:{}, budget:{}, replayTime:{} msec, target:{} msec",
+        numDirtyMpages, dirtyPageBudget, replayTime, targetReplayTimeInMsec);
+    return true;
+}
+
+// QoS lowers the weight of the map flush below its default while the backend
+// events have to yield to the user io
+bool
+DirtyPageBudgetTrigger::_IsMapFlushThrottled(void)
+{
+    if (qosManager == nullptr)
+    {
+        return false;
+    }
+    int64_t weight = qosManager->GetEventWeightWRR(BackendEvent_FlushMap);
+    return weight < qosManager->GetDefaultEventWeightWRR(BackendEvent_FlushMap);
+}
+
+} // namespace pos
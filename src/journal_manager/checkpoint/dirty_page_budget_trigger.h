@@ -0,0 +1,88 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "src/journal_manager/log_buffer/buffer_write_done_notifier.h"
+
+namespace pos
+{
+class BufferOffsetAllocator;
+class IMapFlush;
+class JournalConfiguration;
+class QosManager;
+
+// Starts a checkpoint before the active log group fills up, when the dirty map
+// pages exceed the configured budget or the estimated replay time exceeds the
+// configured target. The checkpoint itself is the regular log group release:
+// the active log group is sealed early, so the map pages and segment context
+// are still flushed together and no map page is stored ahead of its segment info
+class DirtyPageBudgetTrigger : public LogBufferWriteDoneEvent
+{
+public:
+    DirtyPageBudgetTrigger(void);
+    virtual ~DirtyPageBudgetTrigger(void) = default;
+
+    virtual void Init(JournalConfiguration* config, IMapFlush* mapFlush,
+        BufferOffsetAllocator* bufferAllocator, QosManager* qosManager);
+    virtual bool IsEnabled(void);
+
+    virtual void LogFilled(int logGroupId, const MapList& dirty) override;
+    virtual void LogBufferReseted(int logGroupId) override;
+
+    uint64_t GetEstimatedReplayTimeInMsec(uint64_t numDirtyMpages);
+
+private:
+    bool _IsCheckpointNeeded(void);
+    bool _IsMapFlushThrottled(void);
+
+    JournalConfiguration* config;
+    IMapFlush* mapFlush;
+    BufferOffsetAllocator* bufferAllocator;
+    QosManager* qosManager;
+
+    uint64_t dirtyPageBudget;
+    uint64_t targetReplayTimeInMsec;
+    std::atomic<uint64_t> numLogsFilled;
+
+    static const uint64_t NUM_LOGS_PER_CHECK = 256;
+    // Rough costs to replay a log and to flush a map page at the end of replay
+    static const uint64_t REPLAY_TIME_PER_LOG_IN_USEC = 1;
+    static const uint64_t FLUSH_TIME_PER_MPAGE_IN_USEC = 20;
+    // Budget overshoot at which the trigger stops yielding to the user io
+    static const uint64_t MAX_THROTTLED_OVERSHOOT = 2;
+};
+
+} // namespace pos
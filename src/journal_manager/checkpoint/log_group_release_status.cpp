@@ -68,6 +68,17 @@ LogGroupReleaseStatus::SetReleasing(void)
     _PrintStatusChangedLog(from);
 }
 
+void
+LogGroupReleaseStatus::SetCheckpointed(void)
+{
+    assert(status == ReleaseStatus::RELEASING);
+
+    ReleaseStatus from = status;
+    status = ReleaseStatus::CHECKPOINTED;
+
+    _PrintStatusChangedLog(from);
+}
+
 void
 LogGroupReleaseStatus::Reset(void)
 {
@@ -104,10 +115,22 @@ LogGroupReleaseStatus::IsFull(void)
     return (status != ReleaseStatus::INIT);
 }
 
+bool
+LogGroupReleaseStatus::IsWaiting(void)
+{
+    return (status == ReleaseStatus::WAITING);
+}
+
 bool
 LogGroupReleaseStatus::IsReleasing(void)
 {
     return (status == ReleaseStatus::RELEASING);
 }
 
+bool
+LogGroupReleaseStatus::IsCheckpointed(void)
+{
+    return (status == ReleaseStatus::CHECKPOINTED);
+}
+
 } // namespace pos
@@ -41,7 +41,8 @@ enum class ReleaseStatus
 {
     INIT,
     WAITING,
-    RELEASING
+    RELEASING,
+    CHECKPOINTED
 };
 
 class LogGroupReleaseStatus
@@ -51,13 +52,16 @@ public:
 
     void SetWaiting(uint32_t seqNum);
     void SetReleasing(void);
+    void SetCheckpointed(void);
     void Reset(void);
 
     uint32_t GetSeqNum(void);
     int GetId(void);
 
     bool IsFull(void);
+    bool IsWaiting(void);
     bool IsReleasing(void);
+    bool IsCheckpointed(void);
 
 private:
     void _PrintStatusChangedLog(ReleaseStatus from);
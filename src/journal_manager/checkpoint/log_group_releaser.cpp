@@ -36,6 +36,7 @@
 #include "src/include/pos_event_id.h"
 #include "src/journal_manager/checkpoint/checkpoint_manager.h"
 #include "src/journal_manager/checkpoint/checkpoint_submission.h"
+#include "src/journal_manager/checkpoint/log_group_checkpoint_completed_event.h"
 #include "src/journal_manager/log_buffer/buffer_write_done_notifier.h"
 #include "src/journal_manager/log_buffer/journal_log_buffer.h"
 #include "src/journal_manager/log_buffer/log_group_footer_write_context.h"
@@ -52,6 +53,7 @@ LogGroupReleaser::LogGroupReleaser(void)
   releaseNotifier(nullptr),
   logBuffer(nullptr),
   nextLogGroupId(0),
+  resetInProgress(false),
   checkpointManager(nullptr),
   contextManager(nullptr),
   eventScheduler(nullptr)
@@ -86,6 +88,8 @@ void
 LogGroupReleaser::Reset(void)
 {
     nextLogGroupId = 0;
+    pendingResets.clear();
+    resetInProgress = false;
     for (auto group : logGroups)
     {
         group.Reset();
@@ -108,7 +112,7 @@ LogGroupReleaser::_FlushNextLogGroup(void)
 
     if (_IsFlushInProgress() == false)
     {
-        if (logGroups[nextLogGroupId].IsFull() == true)
+        if (logGroups[nextLogGroupId].IsWaiting() == true)
         {
             logGroups[nextLogGroupId].SetReleasing();
 
@@ -146,7 +150,8 @@ EventSmartPtr
 LogGroupReleaser::_CreateCheckpointSubmissionEvent(void)
 {
     // Checkpoint will be in this sequence:
-    // LogGroupFooterWriteEvent -> CheckpointSubmission -> ResetLogGroup -> LogGroupResetCompletion
+    // LogGroupFooterWriteEvent -> CheckpointSubmission -> LogGroupCheckpointCompletedEvent
+    // -> ResetLogGroup -> LogGroupResetCompletion
     // TODO (huijeong.kim) to use Callback class instead of Event
     LogGroupFooter footer;
     uint64_t footerOffset;
@@ -156,7 +161,8 @@ LogGroupReleaser::_CreateCheckpointSubmissionEvent(void)
 
     EventSmartPtr resetLogGroupCompletion(new LogGroupResetCompletedEvent(this, nextLogGroupId));
     EventSmartPtr resetLogGroup(new ResetLogGroup(logBuffer, nextLogGroupId, footer, footerOffset, resetLogGroupCompletion));
-    EventSmartPtr checkpointSubmission(new CheckpointSubmission(checkpointManager, resetLogGroup, nextLogGroupId));
+    EventSmartPtr checkpointCompleted(new LogGroupCheckpointCompletedEvent(this, nextLogGroupId, resetLogGroup));
+    EventSmartPtr checkpointSubmission(new CheckpointSubmission(checkpointManager, checkpointCompleted, nextLogGroupId));
 
     return checkpointSubmission;
 }
@@ -173,16 +179,58 @@ LogGroupReleaser::_CreateFlushingLogGroupFooter(LogGroupFooter& footer, uint64_t
     footerOffset = layout.footerStartOffset;
 }
 
+void
+LogGroupReleaser::LogGroupCheckpointCompleted(int logGroupId, EventSmartPtr resetEvent)
+{
+    {
+        std::unique_lock<std::mutex> lock(flushTriggerLock);
+        assert(logGroups[logGroupId].IsReleasing() == true);
+
+        // Checkpoints are still started one at a time in log group order;
+        // only the reset of this group overlaps with the next checkpoint
+        logGroups[logGroupId].SetCheckpointed();
+        nextLogGroupId = (logGroupId + 1) % config->GetNumLogGroups();
+
+        pendingResets.push_back(resetEvent);
+        _ResetNextLogGroup();
+    }
+
+    _FlushNextLogGroup();
+}
+
+void
+LogGroupReleaser::_ResetNextLogGroup(void)
+{
+    if ((resetInProgress == false) && (pendingResets.empty() == false))
+    {
+        resetInProgress = true;
+        eventScheduler->EnqueueEvent(pendingResets.front());
+        pendingResets.pop_front();
+    }
+}
+
 void
 LogGroupReleaser::LogGroupResetCompleted(int logGroupId)
 {
     POS_TRACE_INFO(EID(JOURNAL_RELEASE_LOG_GROUP_COMPLETED),
         "logGroupId:{}", logGroupId);
 
-    releaseNotifier->NotifyLogBufferReseted(logGroupId);
+    {
+        std::unique_lock<std::mutex> lock(flushTriggerLock);
+        if (logGroups[logGroupId].IsReleasing() == true)
+        {
+            // checkpoint completion was not notified separately
+            nextLogGroupId = (logGroupId + 1) % config->GetNumLogGroups();
+        }
+        else
+        {
+            resetInProgress = false;
+            _ResetNextLogGroup();
+        }
+        logGroups[logGroupId].Reset();
+    }
 
-    logGroups[nextLogGroupId].Reset();
-    nextLogGroupId = (nextLogGroupId + 1) % config->GetNumLogGroups();
+    releaseNotifier->NotifyLogBufferReseted(logGroupId);
 
     _FlushNextLogGroup();
 }
@@ -33,6 +33,7 @@
 #pragma once
 
 #include <atomic>
+#include <deque>
 #include <mutex>
 #include <vector>
 
@@ -70,6 +71,7 @@ public:
     virtual std::list<int> GetFullLogGroups(void) override;
     virtual CheckpointStatus GetStatus(void) override;
 
+    virtual void LogGroupCheckpointCompleted(int logGroupId, EventSmartPtr resetEvent);
     virtual void LogGroupResetCompleted(int logGroupId) override;
 
 protected:
@@ -78,6 +80,7 @@ protected:
 
     virtual void _FlushNextLogGroup(void);
     virtual void _TriggerCheckpoint(void);
+    void _ResetNextLogGroup(void);
 
     void _CreateFlushingLogGroupFooter(LogGroupFooter& footer, uint64_t& footerOffset);
 
@@ -91,6 +94,11 @@ protected:
     std::vector<LogGroupReleaseStatus> logGroups;
     int nextLogGroupId;
 
+    // Reset footers of checkpointed log groups, written one at a time in
+    // checkpoint order so that a newer group is never marked reseted first
+    std::deque<EventSmartPtr> pendingResets;
+    bool resetInProgress;
+
     CheckpointManager* checkpointManager;
 
     IContextManager* contextManager;
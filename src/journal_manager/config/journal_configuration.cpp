@@ -60,12 +60,22 @@ JournalConfiguration::JournalConfiguration(ConfigManager* configManager)
   rocksdbEnabled(false),
   metaVolumeToUse(),
   rocksdbPath(""),
+  rocksdbWriteBatchEnabled(false),
+  rocksdbSyncWriteEnabled(false),
+  rocksdbMemtableSize(0),
   vscEnabled(false),
+  numLogGroups(DEFAULT_NUMBER_OF_LOG_GROUPS),
+  numLogStreams(DEFAULT_NUMBER_OF_LOG_STREAMS),
   areReplayWbStripesInUserArea(false),
+  compactLogEnabled(false),
+  directNvramWriteEnabled(false),
   debugEnabled(false),
   intervalForMetric(0),
+  groupCommitWindowInUsec(0),
+  groupCommitMaxBatchSize(0),
+  checkpointDirtyPageBudget(0),
+  checkpointTargetReplayTimeInMsec(0),
   configManager(configManager),
-  numLogGroups(DEFAULT_NUMBER_OF_LOG_GROUPS),
   logBufferSize(UINT64_MAX)
 {
     _ReadConfiguration();
@@ -118,6 +128,18 @@ JournalConfiguration::IsVscEnabled(void)
     return vscEnabled;
 }
 
+bool
+JournalConfiguration::IsCompactLogEnabled(void)
+{
+    return compactLogEnabled;
+}
+
+bool
+JournalConfiguration::IsDirectNvramWriteEnabled(void)
+{
+    return directNvramWriteEnabled;
+}
+
 bool
 JournalConfiguration::IsDebugEnabled(void)
 {
@@ -130,6 +152,31 @@ JournalConfiguration::GetIntervalForMetric(void)
     return intervalForMetric;
 }
 
+uint64_t
+JournalConfiguration::GetGroupCommitWindowInUsec(void)
+{
+    return groupCommitWindowInUsec;
+}
+
+// Zero disables group commit, then every log is written by its own I/O
+uint64_t
+JournalConfiguration::GetGroupCommitMaxBatchSize(void)
+{
+    return groupCommitMaxBatchSize;
+}
+
+uint64_t
+JournalConfiguration::GetCheckpointDirtyPageBudget(void)
+{
+    return checkpointDirtyPageBudget;
+}
+
+uint64_t
+JournalConfiguration::GetCheckpointTargetReplayTimeInMsec(void)
+{
+    return checkpointTargetReplayTimeInMsec;
+}
+
 bool
 JournalConfiguration::AreReplayWbStripesInUserArea(void)
 {
@@ -147,12 +194,38 @@ JournalConfiguration::GetRocksdbPath(void)
 {
     return rocksdbPath;
 }
+
+bool
+JournalConfiguration::IsRocksdbWriteBatchEnabled(void)
+{
+    return rocksdbWriteBatchEnabled;
+}
+
+bool
+JournalConfiguration::IsRocksdbSyncWriteEnabled(void)
+{
+    return rocksdbSyncWriteEnabled;
+}
+
+uint64_t
+JournalConfiguration::GetRocksdbMemtableSize(void)
+{
+    return rocksdbMemtableSize;
+}
 int
 JournalConfiguration::GetNumLogGroups(void)
 {
     return numLogGroups;
 }
 
+// Log groups are split evenly among the streams; stream s owns the groups whose
+// id modulo the number of streams is s
+int
+JournalConfiguration::GetNumLogStreams(void)
+{
+    return numLogStreams;
+}
+
 uint64_t
 JournalConfiguration::GetLogBufferSize(void)
 {
@@ -201,11 +274,21 @@ JournalConfiguration::_ReadConfiguration(void)
         logBufferSizeInConfig = _ReadLogBufferSize();
         rocksdbEnabled = _IsRocksdbEnabled();
         intervalForMetric = _GetIntervalForMetric();
+        groupCommitWindowInUsec = _ReadGroupCommitWindow();
+        groupCommitMaxBatchSize = _ReadGroupCommitMaxBatchSize();
+        checkpointDirtyPageBudget = _ReadCheckpointDirtyPageBudget();
+        checkpointTargetReplayTimeInMsec = _ReadCheckpointTargetReplayTime();
         numLogGroups = _ReadNumLogGroup();
+        numLogStreams = _ReadNumLogStreams();
         vscEnabled = _IsVscEnabled();
+        compactLogEnabled = _IsCompactLogEnabled();
+        directNvramWriteEnabled = _IsDirectNvramWriteEnabled();
         if (rocksdbEnabled)
         {
             rocksdbPath = _GetRocksdbPath();
+            rocksdbWriteBatchEnabled = _IsRocksdbWriteBatchEnabled();
+            rocksdbSyncWriteEnabled = _IsRocksdbSyncWriteEnabled();
+            rocksdbMemtableSize = _ReadRocksdbMemtableSize();
         }
     }
     else
@@ -247,6 +330,36 @@ JournalConfiguration::_IsVscEnabled(void)
     return enabled;
 }
 
+bool
+JournalConfiguration::_IsCompactLogEnabled(void)
+{
+    bool enabled = false;
+    int ret = configManager->GetValue("journal", "enable_compact_log",
+        static_cast<void*>(&enabled), CONFIG_TYPE_BOOL);
+    if (ret != 0)
+    {
+        enabled = false;
+        POS_TRACE_INFO(static_cast<int>(EID(JOURNAL_CONFIGURATION)),
+            "Failed to read compact log enablement from config file");
+    }
+    return enabled;
+}
+
+bool
+JournalConfiguration::_IsDirectNvramWriteEnabled(void)
+{
+    bool enabled = false;
+    int ret = configManager->GetValue("journal", "enable_direct_nvram_write",
+        static_cast<void*>(&enabled), CONFIG_TYPE_BOOL);
+    if (ret != 0)
+    {
+        enabled = false;
+        POS_TRACE_INFO(static_cast<int>(EID(JOURNAL_CONFIGURATION)),
+            "Failed to read direct nvram write enablement from config file");
+    }
+    return enabled;
+}
+
 bool
 JournalConfiguration::_IsDebugEnabled(void)
 {
@@ -284,6 +397,74 @@ JournalConfiguration::_GetIntervalForMetric(void)
     return 0;
 }
 
+uint64_t
+JournalConfiguration::_ReadGroupCommitWindow(void)
+{
+    uint64_t window = 0;
+    int ret = configManager->GetValue("journal", "group_commit_window_in_usec",
+        static_cast<void*>(&window), ConfigType::CONFIG_TYPE_UINT64);
+
+    if (ret == 0)
+    {
+        POS_TRACE_INFO(static_cast<int>(EID(JOURNAL_CONFIGURATION)),
+            "Group commit window is {} usec", window);
+        return window;
+    }
+
+    return 0;
+}
+
+uint64_t
+JournalConfiguration::_ReadGroupCommitMaxBatchSize(void)
+{
+    uint64_t sizeInKb = 0;
+    int ret = configManager->GetValue("journal", "group_commit_max_batch_size_in_kb",
+        static_cast<void*>(&sizeInKb), ConfigType::CONFIG_TYPE_UINT64);
+
+    if (ret == 0)
+    {
+        POS_TRACE_INFO(static_cast<int>(EID(JOURNAL_CONFIGURATION)),
+            "Group commit max batch size is {} KB", sizeInKb);
+        return sizeInKb * 1024;
+    }
+
+    return 0;
+}
+
+uint64_t
+JournalConfiguration::_ReadCheckpointDirtyPageBudget(void)
+{
+    uint64_t budget = 0;
+    int ret = configManager->GetValue("journal", "checkpoint_dirty_page_budget",
+        static_cast<void*>(&budget), ConfigType::CONFIG_TYPE_UINT64);
+
+    if (ret == 0)
+    {
+        POS_TRACE_INFO(static_cast<int>(EID(JOURNAL_CONFIGURATION)),
+            "Checkpoint dirty page budget is {} pages", budget);
+        return budget;
+    }
+
+    return 0;
+}
+
+uint64_t
+JournalConfiguration::_ReadCheckpointTargetReplayTime(void)
+{
+    uint64_t replayTime = 0;
+    int ret = configManager->GetValue("journal", "checkpoint_target_replay_time_in_msec",
+        static_cast<void*>(&replayTime), ConfigType::CONFIG_TYPE_UINT64);
+
+    if (ret == 0)
+    {
+        POS_TRACE_INFO(static_cast<int>(EID(JOURNAL_CONFIGURATION)),
+            "Checkpoint target replay time is {} msec", replayTime);
+        return replayTime;
+    }
+
+    return 0;
+}
+
 uint64_t
 JournalConfiguration::_ReadLogBufferSize(void)
 {
@@ -321,6 +502,33 @@ JournalConfiguration::_ReadNumLogGroup(void)
     return count;
 }
 
+// Every stream needs at least two log groups, so that it can switch while the
+// other one is checkpointed
+uint64_t
+JournalConfiguration::_ReadNumLogStreams(void)
+{
+    uint64_t count = 0;
+    int ret = configManager->GetValue("journal", "number_of_log_streams",
+        static_cast<void*>(&count), ConfigType::CONFIG_TYPE_UINT64);
+
+    if (ret != 0)
+    {
+        return DEFAULT_NUMBER_OF_LOG_STREAMS;
+    }
+
+    if ((count == 0) || (numLogGroups % count != 0) || (static_cast<uint64_t>(numLogGroups) < count * 2))
+    {
+        POS_TRACE_WARN(static_cast<int>(EID(JOURNAL_CONFIGURATION)),
+            "{} log streams cannot share {} log groups, fall back to {} stream",
+            count, numLogGroups, DEFAULT_NUMBER_OF_LOG_STREAMS);
+        return DEFAULT_NUMBER_OF_LOG_STREAMS;
+    }
+
+    POS_TRACE_INFO(static_cast<int>(EID(JOURNAL_CONFIGURATION)),
+        "The number of log streams is {}", count);
+    return count;
+}
+
 bool
 JournalConfiguration::_IsRocksdbEnabled(void)
 {
@@ -368,6 +576,53 @@ JournalConfiguration::_GetRocksdbPath(void)
     return path;
 }
 
+bool
+JournalConfiguration::_IsRocksdbWriteBatchEnabled(void)
+{
+    bool enabled = false;
+    int ret = configManager->GetValue("meta_rocksdb", "journal_write_batch_enable",
+        static_cast<void*>(&enabled), ConfigType::CONFIG_TYPE_BOOL);
+    if (ret != 0)
+    {
+        enabled = false;
+        POS_TRACE_INFO(static_cast<int>(EID(JOURNAL_CONFIGURATION)),
+            "Failed to read rocksdb write batch enablement from config file");
+    }
+    return enabled;
+}
+
+bool
+JournalConfiguration::_IsRocksdbSyncWriteEnabled(void)
+{
+    bool enabled = false;
+    int ret = configManager->GetValue("meta_rocksdb", "journal_sync_write_enable",
+        static_cast<void*>(&enabled), ConfigType::CONFIG_TYPE_BOOL);
+    if (ret != 0)
+    {
+        enabled = false;
+        POS_TRACE_INFO(static_cast<int>(EID(JOURNAL_CONFIGURATION)),
+            "Failed to read rocksdb sync write enablement from config file");
+    }
+    return enabled;
+}
+
+uint64_t
+JournalConfiguration::_ReadRocksdbMemtableSize(void)
+{
+    uint64_t sizeInMb = 0;
+    int ret = configManager->GetValue("meta_rocksdb", "journal_memtable_size_in_mb",
+        static_cast<void*>(&sizeInMb), ConfigType::CONFIG_TYPE_UINT64);
+
+    if (ret == 0)
+    {
+        POS_TRACE_INFO(static_cast<int>(EID(JOURNAL_CONFIGURATION)),
+            "RocksDB journal memtable size is {} MB", sizeInMb);
+        return sizeInMb * 1024 * 1024;
+    }
+
+    return 0;
+}
+
 void
 JournalConfiguration::_ReadMetaFsConfiguration(MetaFsFileControlApi* metaFsCtrl)
 {
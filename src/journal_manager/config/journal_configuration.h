@@ -57,12 +57,22 @@ public:
     virtual bool IsEnabled(void);
     virtual bool IsDebugEnabled(void);
     virtual bool IsVscEnabled(void);
+    virtual bool IsCompactLogEnabled(void);
+    virtual bool IsDirectNvramWriteEnabled(void);
     virtual uint64_t GetIntervalForMetric(void);
+    virtual uint64_t GetGroupCommitWindowInUsec(void);
+    virtual uint64_t GetGroupCommitMaxBatchSize(void);
+    virtual uint64_t GetCheckpointDirtyPageBudget(void);
+    virtual uint64_t GetCheckpointTargetReplayTimeInMsec(void);
     virtual bool AreReplayWbStripesInUserArea(void);
     virtual bool IsRocksdbEnabled(void);
     virtual std::string GetRocksdbPath(void);
+    virtual bool IsRocksdbWriteBatchEnabled(void);
+    virtual bool IsRocksdbSyncWriteEnabled(void);
+    virtual uint64_t GetRocksdbMemtableSize(void);
 
     virtual int GetNumLogGroups(void);
+    virtual int GetNumLogStreams(void);
     virtual uint64_t GetLogBufferSize(void);
     virtual uint64_t GetLogGroupSize(void);
     virtual uint64_t GetMetaPageSize(void);
@@ -89,27 +99,47 @@ protected:
     bool rocksdbEnabled;
     MetaVolumeType metaVolumeToUse;
     std::string rocksdbPath;
+    bool rocksdbWriteBatchEnabled;
+    bool rocksdbSyncWriteEnabled;
+    uint64_t rocksdbMemtableSize;
     bool vscEnabled;
+    int numLogGroups;
+    int numLogStreams;
 
 private:
     void _ReadConfiguration(void);
     bool _IsJournalEnabled(void);
     bool _IsVscEnabled(void);
+    bool _IsCompactLogEnabled(void);
+    bool _IsDirectNvramWriteEnabled(void);
     bool _IsDebugEnabled(void);
     uint64_t _GetIntervalForMetric(void);
+    uint64_t _ReadGroupCommitWindow(void);
+    uint64_t _ReadGroupCommitMaxBatchSize(void);
+    uint64_t _ReadCheckpointDirtyPageBudget(void);
+    uint64_t _ReadCheckpointTargetReplayTime(void);
     uint64_t _ReadLogBufferSize(void);
     uint64_t _ReadNumLogGroup(void);
+    uint64_t _ReadNumLogStreams(void);
     bool _IsRocksdbEnabled(void);
     std::string _GetRocksdbPath(void);
+    bool _IsRocksdbWriteBatchEnabled(void);
+    bool _IsRocksdbSyncWriteEnabled(void);
+    uint64_t _ReadRocksdbMemtableSize(void);
 
     void _ReadMetaFsConfiguration(MetaFsFileControlApi* metaFsCtrl);
 
     bool areReplayWbStripesInUserArea;
+    bool compactLogEnabled;
+    bool directNvramWriteEnabled;
     bool debugEnabled;
     uint64_t intervalForMetric;
+    uint64_t groupCommitWindowInUsec;
+    uint64_t groupCommitMaxBatchSize;
+    uint64_t checkpointDirtyPageBudget;
+    uint64_t checkpointTargetReplayTimeInMsec;
 
     ConfigManager* configManager;
-    int numLogGroups;
     uint64_t logBufferSize;
 
     // TODO(cheolho.kang) Need to change for injecting mock
@@ -117,6 +147,7 @@ private:
 
     const uint64_t SIZE_MB = 1024 * 1024;
     const static uint64_t DEFAULT_NUMBER_OF_LOG_GROUPS = 2;
+    const static uint64_t DEFAULT_NUMBER_OF_LOG_STREAMS = 1;
 };
 
 } // namespace pos
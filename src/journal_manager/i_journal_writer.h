@@ -45,6 +45,7 @@ public:
     virtual int AddBlockMapUpdatedLog(VolumeIoSmartPtr volumeIo, EventSmartPtr callbackEvent) = 0;
     virtual int AddStripeMapUpdatedLog(StripeSmartPtr stripe, StripeAddr oldAddr, EventSmartPtr callbackEvent) = 0;
     virtual int AddGcStripeFlushedLog(GcStripeMapUpdateList mapUpdates, EventSmartPtr callbackEvent) = 0;
+    virtual int AddRangeUnmappedLog(int volId, BlkAddr startRba, uint64_t numBlks, EventSmartPtr callbackEvent) = 0;
 };
 
 } // namespace pos
@@ -42,6 +42,7 @@
 #include "src/include/pos_event_id.h"
 #include "src/journal_manager/checkpoint/checkpoint_manager.h"
 #include "src/journal_manager/checkpoint/dirty_map_manager.h"
+#include "src/journal_manager/checkpoint/dirty_page_budget_trigger.h"
 #include "src/journal_manager/checkpoint/log_group_releaser.h"
 #include "src/journal_manager/config/journal_configuration.h"
 #include "src/journal_manager/journal_writer.h"
@@ -59,6 +60,7 @@
 #include "src/journal_manager/replay/replay_handler.h"
 #include "src/journal_manager/status/journal_status_provider.h"
 #include "src/logger/logger.h"
+#include "src/qos/qos_manager.h"
 #include "src/rocksdb_log_buffer/rocksdb_log_buffer.h"
 #include "src/telemetry/telemetry_client/easy_telemetry_publisher.h"
 #include "src/telemetry/telemetry_client/telemetry_client.h"
@@ -81,6 +83,7 @@ JournalManager::JournalManager(void)
   checkpointManager(nullptr),
   versionedSegCtx(nullptr),
   dirtyMapManager(nullptr),
+  budgetTrigger(nullptr),
   logFilledNotifier(nullptr),
   sequenceController(nullptr),
   replayHandler(nullptr),
@@ -130,6 +133,7 @@ JournalManager::JournalManager(JournalConfiguration* configuration,
 
     checkpointManager = cpManager;
     dirtyMapManager = dirtyManager;
+    budgetTrigger = new DirtyPageBudgetTrigger();
     logFilledNotifier = logBufferWriteDoneNotifier;
     sequenceController = callbackSequenceController;
 
@@ -216,6 +220,7 @@ JournalManager::~JournalManager(void)
     delete sequenceController;
     delete logFilledNotifier;
     delete dirtyMapManager;
+    delete budgetTrigger;
 
     delete logGroupReleaser;
     delete bufferAllocator;
@@ -506,6 +511,12 @@ JournalManager::_InitModules(TelemetryClient* tc, IVSAMap* vsaMap, IStripeMap* s
     logFilledNotifier->Register(bufferAllocator);
     logFilledNotifier->Register(logWriteHandler);
 
+    budgetTrigger->Init(config, mapFlush, bufferAllocator, QosManagerSingleton::Instance());
+    if (budgetTrigger->IsEnabled() == true)
+    {
+        logFilledNotifier->Register(budgetTrigger);
+    }
+
     logGroupReleaser->Init(config, logFilledNotifier, logBuffer,
         checkpointManager, mapFlush, contextManager, eventScheduler);
 
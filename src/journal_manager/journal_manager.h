@@ -67,6 +67,7 @@ class JournalStatusProvider;
 
 class CheckpointManager;
 class DirtyMapManager;
+class DirtyPageBudgetTrigger;
 class LogBufferWriteDoneNotifier;
 class CallbackSequenceController;
 class BufferedSegmentContextManager;
@@ -180,6 +181,7 @@ protected:
     CheckpointManager* checkpointManager;
     IVersionedSegmentContext* versionedSegCtx;
     DirtyMapManager* dirtyMapManager;
+    DirtyPageBudgetTrigger* budgetTrigger;
     LogBufferWriteDoneNotifier* logFilledNotifier;
     CallbackSequenceController* sequenceController;
 
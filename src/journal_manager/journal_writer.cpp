@@ -160,6 +160,28 @@ JournalWriter::AddGcStripeFlushedLog(GcStripeMapUpdateList mapUpdates, EventSmar
     }
 }
 
+int
+JournalWriter::AddRangeUnmappedLog(int volId, BlkAddr startRba, uint64_t numBlks, EventSmartPtr callbackEvent)
+{
+    int result = _CanBeWritten();
+    if (result == 0)
+    {
+        LogWriteContext* logWriteContext =
+            logFactory->CreateRangeUnmappedLogWriteContext(volId, startRba, numBlks, callbackEvent);
+        result = logWriteHandler->AddLog(logWriteContext);
+        if (result != 0)
+        {
+            delete logWriteContext;
+        }
+
+        return result;
+    }
+    else
+    {
+        return result;
+    }
+}
+
 int
 JournalWriter::_AddGcLogs(GcStripeMapUpdateList mapUpdates, EventSmartPtr callbackEvent)
 {
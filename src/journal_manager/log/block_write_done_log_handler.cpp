@@ -96,4 +96,16 @@ BlockWriteDoneLogHandler::SetSeqNum(uint32_t num)
     dat.seqNum = num;
 }
 
+uint64_t
+BlockWriteDoneLogHandler::GetOrder(void)
+{
+    return logOrder;
+}
+
+void
+BlockWriteDoneLogHandler::SetOrder(uint64_t order)
+{
+    logOrder = order;
+}
+
 } // namespace pos
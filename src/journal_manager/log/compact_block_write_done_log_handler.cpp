@@ -0,0 +1,220 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/journal_manager/log/compact_block_write_done_log_handler.h"
+
+#include <cstring>
+
+namespace pos
+{
+CompactBlockWriteDoneLogHandler::CompactBlockWriteDoneLogHandler(int volId,
+    BlkAddr startRba, uint32_t numBlks, VirtualBlkAddr startVsa, int wbIndex,
+    StripeAddr stripeAddr)
+{
+    dat.type = LogType::BLOCK_WRITE_DONE;
+    dat.volId = volId;
+    dat.startRba = startRba;
+    dat.numBlks = numBlks;
+    dat.startVsa = startVsa;
+    dat.wbIndex = wbIndex;
+    dat.writeBufferStripeAddress = stripeAddr;
+
+    memset(data, 0, sizeof(data));
+    CompactBlockWriteDoneLog* header = reinterpret_cast<CompactBlockWriteDoneLog*>(data);
+    header->mark = LOG_VALID_MARK;
+    header->type = LogType::BLOCK_WRITE_DONE_COMPACT;
+
+    uint8_t* payload = reinterpret_cast<uint8_t*>(data + sizeof(CompactBlockWriteDoneLog));
+    uint32_t payloadSize = 0;
+    payloadSize += _EncodeVarint(payload + payloadSize, static_cast<uint32_t>(volId));
+    payloadSize += _EncodeVarint(payload + payloadSize, startRba);
+    payloadSize += _EncodeVarint(payload + payloadSize, numBlks);
+    payloadSize += _EncodeVarint(payload + payloadSize, startVsa.stripeId);
+    payloadSize += _EncodeVarint(payload + payloadSize, startVsa.offset);
+    payloadSize += _EncodeVarint(payload + payloadSize,
+        _ToZigzag(static_cast<int64_t>(wbIndex) - volId));
+    uint64_t stripeDelta = _ToZigzag(static_cast<int64_t>(stripeAddr.stripeId) - startVsa.stripeId);
+    payloadSize += _EncodeVarint(payload + payloadSize, (stripeDelta << 1) | stripeAddr.stripeLoc);
+    header->payloadSize = payloadSize;
+
+    size = sizeof(CompactBlockWriteDoneLog) + ((payloadSize + 3) & ~3U);
+}
+
+LogType
+CompactBlockWriteDoneLogHandler::GetType(void)
+{
+    return LogType::BLOCK_WRITE_DONE_COMPACT;
+}
+
+uint32_t
+CompactBlockWriteDoneLogHandler::GetSize(void)
+{
+    return size;
+}
+
+char*
+CompactBlockWriteDoneLogHandler::GetData(void)
+{
+    return data;
+}
+
+StripeId
+CompactBlockWriteDoneLogHandler::GetVsid(void)
+{
+    return dat.startVsa.stripeId;
+}
+
+uint32_t
+CompactBlockWriteDoneLogHandler::GetSeqNum(void)
+{
+    return dat.seqNum;
+}
+
+void
+CompactBlockWriteDoneLogHandler::SetSeqNum(uint32_t num)
+{
+    dat.seqNum = num;
+    reinterpret_cast<CompactBlockWriteDoneLog*>(data)->seqNum = num;
+}
+
+uint64_t
+CompactBlockWriteDoneLogHandler::GetOrder(void)
+{
+    return logOrder;
+}
+
+void
+CompactBlockWriteDoneLogHandler::SetOrder(uint64_t order)
+{
+    logOrder = order;
+}
+
+BlockWriteDoneLog
+CompactBlockWriteDoneLogHandler::GetBlockWriteDoneLog(void)
+{
+    return dat;
+}
+
+bool
+CompactBlockWriteDoneLogHandler::Decode(char* ptr, uint64_t maxSize, BlockWriteDoneLog& decoded)
+{
+    if (maxSize < sizeof(CompactBlockWriteDoneLog))
+    {
+        return false;
+    }
+
+    CompactBlockWriteDoneLog* header = reinterpret_cast<CompactBlockWriteDoneLog*>(ptr);
+    uint32_t payloadSize = header->payloadSize;
+    if (payloadSize > MAX_PAYLOAD_SIZE || sizeof(CompactBlockWriteDoneLog) + payloadSize > maxSize)
+    {
+        return false;
+    }
+
+    const uint8_t* payload = reinterpret_cast<const uint8_t*>(ptr + sizeof(CompactBlockWriteDoneLog));
+    uint64_t fields[7];
+    uint32_t pos = 0;
+    for (auto& field : fields)
+    {
+        if (_DecodeVarint(payload, payloadSize, pos, field) == false)
+        {
+            return false;
+        }
+    }
+    if (pos != payloadSize)
+    {
+        return false;
+    }
+
+    decoded = BlockWriteDoneLog();
+    decoded.mark = header->mark;
+    decoded.type = LogType::BLOCK_WRITE_DONE;
+    decoded.seqNum = header->seqNum;
+    decoded.volId = static_cast<int>(fields[0]);
+    decoded.startRba = fields[1];
+    decoded.numBlks = static_cast<uint32_t>(fields[2]);
+    decoded.startVsa.stripeId = static_cast<StripeId>(fields[3]);
+    decoded.startVsa.offset = fields[4];
+    decoded.wbIndex = static_cast<int>(decoded.volId + _FromZigzag(fields[5]));
+    decoded.writeBufferStripeAddress.stripeLoc = static_cast<StripeLoc>(fields[6] & 0x1);
+    decoded.writeBufferStripeAddress.stripeId =
+        static_cast<StripeId>(decoded.startVsa.stripeId + _FromZigzag(fields[6] >> 1));
+
+    return true;
+}
+
+uint32_t
+CompactBlockWriteDoneLogHandler::_EncodeVarint(uint8_t* buffer, uint64_t value)
+{
+    uint32_t numBytes = 0;
+    while (value >= 0x80)
+    {
+        buffer[numBytes++] = static_cast<uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+    buffer[numBytes++] = static_cast<uint8_t>(value);
+    return numBytes;
+}
+
+bool
+CompactBlockWriteDoneLogHandler::_DecodeVarint(const uint8_t* buffer, uint32_t size,
+    uint32_t& pos, uint64_t& value)
+{
+    value = 0;
+    for (uint32_t shift = 0; shift < 64; shift += 7)
+    {
+        if (pos >= size)
+        {
+            return false;
+        }
+        uint8_t byte = buffer[pos++];
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint64_t
+CompactBlockWriteDoneLogHandler::_ToZigzag(int64_t value)
+{
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+int64_t
+CompactBlockWriteDoneLogHandler::_FromZigzag(uint64_t value)
+{
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 0x1);
+}
+
+} // namespace pos
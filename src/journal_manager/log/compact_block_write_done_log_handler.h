@@ -0,0 +1,79 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "src/include/address_type.h"
+#include "src/journal_manager/log/log_handler.h"
+
+namespace pos
+{
+// Writes a block write done log in the compact format: the fields are
+// varint encoded, and the write buffer index and stripe id are stored as
+// deltas against the volume id and the vsid of the same record.
+// The log is decoded back to BlockWriteDoneLog by LogBufferParser on replay
+class CompactBlockWriteDoneLogHandler : public LogHandlerInterface
+{
+public:
+    CompactBlockWriteDoneLogHandler(int volId, BlkAddr startRba, uint32_t numBlks,
+        VirtualBlkAddr startVsa, int wbIndex, StripeAddr stripeAddr);
+    virtual ~CompactBlockWriteDoneLogHandler(void) = default;
+
+    virtual LogType GetType(void);
+    virtual uint32_t GetSize(void);
+    virtual char* GetData(void);
+    virtual StripeId GetVsid(void);
+
+    virtual uint32_t GetSeqNum(void);
+    virtual void SetSeqNum(uint32_t num);
+    virtual uint64_t GetOrder(void);
+    virtual void SetOrder(uint64_t order);
+
+    BlockWriteDoneLog GetBlockWriteDoneLog(void);
+
+    static bool Decode(char* ptr, uint64_t maxSize, BlockWriteDoneLog& decoded);
+
+    static const uint32_t MAX_PAYLOAD_SIZE = 52;
+
+private:
+    static uint32_t _EncodeVarint(uint8_t* buffer, uint64_t value);
+    static bool _DecodeVarint(const uint8_t* buffer, uint32_t size, uint32_t& pos, uint64_t& value);
+    static uint64_t _ToZigzag(int64_t value);
+    static int64_t _FromZigzag(uint64_t value);
+
+    BlockWriteDoneLog dat;
+    uint32_t size;
+    char data[sizeof(CompactBlockWriteDoneLog) + MAX_PAYLOAD_SIZE];
+    uint64_t logOrder = 0;
+};
+
+} // namespace pos
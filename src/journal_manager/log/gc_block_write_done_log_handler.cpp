@@ -148,6 +148,18 @@ GcBlockWriteDoneLogHandler::SetSeqNum(uint32_t num)
     logPtr->seqNum = num;
 }
 
+uint64_t
+GcBlockWriteDoneLogHandler::GetOrder(void)
+{
+    return logOrder;
+}
+
+void
+GcBlockWriteDoneLogHandler::SetOrder(uint64_t order)
+{
+    logOrder = order;
+}
+
 GcBlockWriteDoneLog*
 GcBlockWriteDoneLogHandler::GetGcBlockMapWriteDoneLog(void)
 {
@@ -56,6 +56,8 @@ public:
 
     virtual uint32_t GetSeqNum(void) override;
     virtual void SetSeqNum(uint32_t num) override;
+    virtual uint64_t GetOrder(void) override;
+    virtual void SetOrder(uint64_t order) override;
 
     GcBlockWriteDoneLog* GetGcBlockMapWriteDoneLog(void);
     GcBlockMapUpdate* GetMapList(void);
@@ -67,6 +69,7 @@ private:
     GcBlockMapUpdate* blockMapListPtr;
 
     void* dat = nullptr; // GcBlockWriteDoneLog + GcBlockMapUpdate * N
+    uint64_t logOrder = 0;
 };
 
 } // namespace pos
@@ -94,4 +94,16 @@ GcStripeFlushedLogHandler::SetSeqNum(uint32_t num)
     dat.seqNum = num;
 }
 
+uint64_t
+GcStripeFlushedLogHandler::GetOrder(void)
+{
+    return logOrder;
+}
+
+void
+GcStripeFlushedLogHandler::SetOrder(uint64_t order)
+{
+    logOrder = order;
+}
+
 } // namespace pos
@@ -36,8 +36,10 @@
 
 #include "src/include/pos_event_id.h"
 #include "src/journal_manager/log/block_write_done_log_handler.h"
+#include "src/journal_manager/log/compact_block_write_done_log_handler.h"
 #include "src/journal_manager/log/gc_block_write_done_log_handler.h"
 #include "src/journal_manager/log/gc_stripe_flushed_log_handler.h"
+#include "src/journal_manager/log/range_unmapped_log_handler.h"
 #include "src/journal_manager/log/stripe_map_updated_log_handler.h"
 #include "src/journal_manager/log/volume_deleted_log_handler.h"
 #include "src/logger/logger.h"
@@ -58,7 +60,7 @@ LogBufferParser::ValidMarkFinder::GetNextValidMarkOffset(uint64_t startOffset, u
     {
         char* ptr = (char*)(buffer + searchOffset);
         uint32_t mark = *(uint32_t*)ptr;
-        if (mark == LOG_VALID_MARK || mark == LOG_GROUP_FOOTER_VALID_MARK)
+        if (mark == LOG_VALID_MARK || mark == LOG_ORDER_VALID_MARK || mark == LOG_GROUP_FOOTER_VALID_MARK)
         {
             foundOffset = searchOffset;
             return true;
@@ -92,7 +94,7 @@ LogBufferParser::GetLogs(void* buffer, uint64_t bufferSize, LogList& logs)
 
         if (validMark == LOG_VALID_MARK)
         {
-            LogHandlerInterface* log = _GetLogHandler(dataPtr);
+            LogHandlerInterface* log = _GetLogHandler(dataPtr, bufferSize - foundOffset);
             if (log == nullptr)
             {
                 int event = static_cast<int>(EID(JOURNAL_INVALID_LOG_FOUND));
@@ -103,6 +105,27 @@ LogBufferParser::GetLogs(void* buffer, uint64_t bufferSize, LogList& logs)
             logs.AddLog(log);
             _LogFound(log);
         }
+        else if (validMark == LOG_ORDER_VALID_MARK)
+        {
+            // The log follows its order header, and is skipped with it
+            uint64_t logOffset = foundOffset + sizeof(LogOrderHeader);
+            if ((logOffset + sizeof(Log) <= bufferSize)
+                && (*(uint32_t*)((char*)buffer + logOffset) == LOG_VALID_MARK))
+            {
+                LogHandlerInterface* log = _GetLogHandler((char*)buffer + logOffset, bufferSize - logOffset);
+                if (log == nullptr)
+                {
+                    int event = static_cast<int>(EID(JOURNAL_INVALID_LOG_FOUND));
+                    POS_TRACE_ERROR(event, "Unknown type of log is found");
+                    return event * -1;
+                }
+
+                log->SetOrder(reinterpret_cast<LogOrderHeader*>(dataPtr)->order);
+                logs.AddLog(log);
+                _LogFound(log);
+                foundOffset = logOffset;
+            }
+        }
         else if (validMark == LOG_GROUP_FOOTER_VALID_MARK)
         {
             LogGroupFooter footer = *(LogGroupFooter*)(dataPtr);
@@ -137,7 +160,7 @@ LogBufferParser::GetLogs(void* buffer, uint64_t bufferSize, LogList& logs)
 }
 
 LogHandlerInterface*
-LogBufferParser::_GetLogHandler(char* ptr)
+LogBufferParser::_GetLogHandler(char* ptr, uint64_t maxSize)
 {
     Log* logPtr = reinterpret_cast<Log*>(ptr);
     LogHandlerInterface* foundLog = nullptr;
@@ -162,6 +185,19 @@ LogBufferParser::_GetLogHandler(char* ptr)
     {
         foundLog = new VolumeDeletedLogEntry(*reinterpret_cast<VolumeDeletedLog*>(ptr));
     }
+    else if (logPtr->type == LogType::RANGE_UNMAPPED)
+    {
+        foundLog = new RangeUnmappedLogHandler(*reinterpret_cast<RangeUnmappedLog*>(ptr));
+    }
+    else if (logPtr->type == LogType::BLOCK_WRITE_DONE_COMPACT)
+    {
+        // Compact logs are replayed the same way as the fixed size ones
+        BlockWriteDoneLog decoded;
+        if (CompactBlockWriteDoneLogHandler::Decode(ptr, maxSize, decoded) == true)
+        {
+            foundLog = new BlockWriteDoneLogHandler(decoded);
+        }
+    }
 
     return foundLog;
 }
@@ -219,9 +255,11 @@ LogBufferParser::PrintFoundLogTypes(void)
         int numStripeMapUpdatedLogs = it->second[(int)LogType::STRIPE_MAP_UPDATED];
         int numGcStripeFlushedLogs = it->second[(int)LogType::GC_STRIPE_FLUSHED];
         int numVolumeDeletedLogs = it->second[(int)LogType::VOLUME_DELETED];
+        int numRangeUnmappedLogs = it->second[(int)LogType::RANGE_UNMAPPED];
         POS_TRACE_INFO(EID(JOURNAL_REPLAY_STATUS),
-            "Logs found: SeqNum: {}, total: {}, block_map: {}, stripe_map: {}, gc_stripes: {}, volumes_deleted: {}",
-            it->first, numBlockMapUpdatedLogs + numStripeMapUpdatedLogs + numGcStripeFlushedLogs + numVolumeDeletedLogs, numBlockMapUpdatedLogs, numStripeMapUpdatedLogs, numGcStripeFlushedLogs, numVolumeDeletedLogs);
+            "Logs found: SeqNum: {}, total: {}, block_map: {}, stripe_map: {}, gc_stripes: {}, volumes_deleted: {}, ranges_unmapped: {}",
+            it->first, numBlockMapUpdatedLogs + numStripeMapUpdatedLogs + numGcStripeFlushedLogs + numVolumeDeletedLogs + numRangeUnmappedLogs,
+            numBlockMapUpdatedLogs, numStripeMapUpdatedLogs, numGcStripeFlushedLogs, numVolumeDeletedLogs, numRangeUnmappedLogs);
     }
 }
 
@@ -68,7 +68,7 @@ private:
     uint32_t _GetLatestSequenceNumber(void);
     void _GetNextSearchOffset(uint64_t& searchOffset, uint64_t foundOffset);
 
-    LogHandlerInterface* _GetLogHandler(char* ptr);
+    LogHandlerInterface* _GetLogHandler(char* ptr, uint64_t maxSize);
 
     std::map<uint32_t, std::vector<int>> logsFound;
 };
@@ -37,6 +37,7 @@
 namespace pos
 {
 static const uint32_t LOG_VALID_MARK = 0xCECECECE;
+static const uint32_t LOG_ORDER_VALID_MARK = 0xCDCDCDCD;
 
 enum class LogType
 {
@@ -45,6 +46,8 @@ enum class LogType
     GC_BLOCK_WRITE_DONE,
     GC_STRIPE_FLUSHED,
     VOLUME_DELETED,
+    BLOCK_WRITE_DONE_COMPACT,
+    RANGE_UNMAPPED,
     NUM_LOG_TYPE,
     COUNT
 };
@@ -57,6 +60,16 @@ struct Log
     uint32_t seqNum;
 };
 
+// Written in front of every log by the journals with several log streams. The
+// log groups of the streams are filled at the same time, so replay merges them
+// by the order. The logs without it are parsed as before
+struct LogOrderHeader
+{
+    int mark = LOG_ORDER_VALID_MARK;
+    uint32_t reserved = 0;
+    uint64_t order = 0;
+};
+
 struct BlockWriteDoneLog : Log
 {
     int volId;
@@ -68,6 +81,15 @@ struct BlockWriteDoneLog : Log
     uint8_t reserved[12] = {0, };
 };
 
+// Varint encoded form of BlockWriteDoneLog. Every record is self-contained,
+// because logs are completed out of order and any of them may be lost on a crash
+struct CompactBlockWriteDoneLog : Log
+{
+    uint8_t payloadSize;
+    uint8_t reserved[3] = {0, };
+    // Encoded fields should be appended, padded to 4 bytes
+};
+
 struct StripeMapUpdatedLog : Log
 {
     StripeId vsid;
@@ -98,6 +120,14 @@ struct VolumeDeletedLog : Log
     uint64_t allocatorContextVersion;
 };
 
+// A single record for a whole deallocated range, however many mpages it spans
+struct RangeUnmappedLog : Log
+{
+    int volId;
+    BlkAddr startRba;
+    uint64_t numBlks;
+};
+
 #pragma pack(pop)
 
 } // namespace pos
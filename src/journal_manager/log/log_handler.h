@@ -52,6 +52,8 @@ public:
 
     virtual uint32_t GetSeqNum(void) = 0;
     virtual void SetSeqNum(uint32_t num) = 0;
+    virtual uint64_t GetOrder(void) = 0;
+    virtual void SetOrder(uint64_t order) = 0;
 };
 
 } // namespace pos
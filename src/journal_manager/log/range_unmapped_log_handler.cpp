@@ -0,0 +1,107 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/journal_manager/log/range_unmapped_log_handler.h"
+
+namespace pos
+{
+RangeUnmappedLogHandler::RangeUnmappedLogHandler(int volId, BlkAddr startRba, uint64_t numBlks)
+{
+    dat.type = LogType::RANGE_UNMAPPED;
+    dat.volId = volId;
+    dat.startRba = startRba;
+    dat.numBlks = numBlks;
+}
+
+RangeUnmappedLogHandler::RangeUnmappedLogHandler(RangeUnmappedLog& log)
+{
+    dat = log;
+}
+
+bool
+RangeUnmappedLogHandler::operator==(const RangeUnmappedLogHandler log)
+{
+    return ((log.dat.volId == dat.volId) &&
+        (log.dat.startRba == dat.startRba) &&
+        (log.dat.numBlks == dat.numBlks));
+}
+
+LogType
+RangeUnmappedLogHandler::GetType(void)
+{
+    return dat.type;
+}
+
+uint32_t
+RangeUnmappedLogHandler::GetSize(void)
+{
+    return sizeof(RangeUnmappedLog);
+}
+
+char*
+RangeUnmappedLogHandler::GetData(void)
+{
+    return (char*)&dat;
+}
+
+StripeId
+RangeUnmappedLogHandler::GetVsid(void)
+{
+    // An unmapped range does not belong to any stripe
+    return UNMAP_STRIPE;
+}
+
+uint32_t
+RangeUnmappedLogHandler::GetSeqNum(void)
+{
+    return dat.seqNum;
+}
+
+void
+RangeUnmappedLogHandler::SetSeqNum(uint32_t num)
+{
+    dat.seqNum = num;
+}
+
+uint64_t
+RangeUnmappedLogHandler::GetOrder(void)
+{
+    return logOrder;
+}
+
+void
+RangeUnmappedLogHandler::SetOrder(uint64_t order)
+{
+    logOrder = order;
+}
+
+} // namespace pos
@@ -90,4 +90,16 @@ StripeMapUpdatedLogHandler::SetSeqNum(uint32_t num)
     dat.seqNum = num;
 }
 
+uint64_t
+StripeMapUpdatedLogHandler::GetOrder(void)
+{
+    return logOrder;
+}
+
+void
+StripeMapUpdatedLogHandler::SetOrder(uint64_t order)
+{
+    logOrder = order;
+}
+
 } // namespace pos
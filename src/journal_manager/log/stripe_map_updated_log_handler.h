@@ -54,8 +54,11 @@ public:
 
     virtual uint32_t GetSeqNum(void);
     virtual void SetSeqNum(uint32_t num);
+    virtual uint64_t GetOrder(void);
+    virtual void SetOrder(uint64_t order);
 
 private:
     StripeMapUpdatedLog dat;
+    uint64_t logOrder = 0;
 };
 } // namespace pos
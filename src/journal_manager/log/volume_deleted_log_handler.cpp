@@ -90,4 +90,16 @@ VolumeDeletedLogEntry::SetSeqNum(uint32_t num)
     dat.seqNum = num;
 }
 
+uint64_t
+VolumeDeletedLogEntry::GetOrder(void)
+{
+    return logOrder;
+}
+
+void
+VolumeDeletedLogEntry::SetOrder(uint64_t order)
+{
+    logOrder = order;
+}
+
 } // namespace pos
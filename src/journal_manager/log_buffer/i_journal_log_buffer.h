@@ -33,6 +33,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "src/include/smart_ptr_type.h"
 #include "src/journal_manager/config/journal_configuration.h"
@@ -62,7 +63,11 @@ public:
     virtual int Open(uint64_t& logBufferSize) = 0;
 
     virtual int WriteLog(LogWriteContext* context, uint64_t offset, FnCompleteMetaFileIo func) = 0;
+    // Writes logs allocated back to back from offset; func is called once per log
+    virtual int WriteLogs(std::vector<LogWriteContext*>& contexts, uint64_t offset, FnCompleteMetaFileIo func) = 0;
     virtual int ReadLogBuffer(int groupId, void* buffer) = 0;
+    // Reads size bytes from offset of a log group; func is called with the read context and owns it
+    virtual int ReadLogBufferChunk(int groupId, uint64_t offset, uint64_t size, void* buffer, FnCompleteMetaFileIo func) = 0;
 
     virtual int SyncResetAll(void) = 0;
     virtual int AsyncReset(int id, EventSmartPtr callbackEvent) = 0;
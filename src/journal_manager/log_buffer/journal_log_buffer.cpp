@@ -31,13 +31,18 @@
  */
 #include "src/journal_manager/log_buffer/journal_log_buffer.h"
 
+#include <atomic>
+#include <cstring>
+#include <deque>
 #include <memory>
 #include <string>
 
 #include "src/include/pos_event_id.h"
+#include "src/io/general_io/write_amplification_monitor_service.h"
 #include "src/journal_manager/log_buffer/log_buffer_io_context_factory.h"
 #include "src/journal_manager/log_buffer/log_group_reset_completed_event.h"
 #include "src/journal_manager/log_buffer/log_write_context.h"
+#include "src/journal_manager/log_buffer/log_write_io_context.h"
 #include "src/logger/logger.h"
 #include "src/meta_file_intf/rocksdb_metafs_intf.h"
 #include "src/metafs/config/metafs_config_manager.h"
@@ -52,6 +57,8 @@ JournalLogBuffer::JournalLogBuffer(void)
   numInitializedLogGroup(0),
   logBufferReadDone(0),
   logFile(nullptr),
+  directWriteRequested(false),
+  directWriteEnabled(false),
   initializedDataBuffer(nullptr),
   telemetryPublisher(nullptr),
   rocksDbEnabled(MetaFsServiceSingleton::Instance()->GetConfigManager()->IsRocksdbEnabled()),
@@ -105,6 +112,7 @@ JournalLogBuffer::Init(JournalConfiguration* journalConfiguration, LogBufferIoCo
         }
     }
     this->arrayId = arrayId;
+    directWriteRequested = config->IsDirectNvramWriteEnabled();
     return 0;
 }
 
@@ -171,6 +179,8 @@ JournalLogBuffer::Create(uint64_t logBufferSize)
         return ret;
     }
 
+    _PrepareDirectWrite();
+
     POS_TRACE_INFO(EID(JOURNAL_LOG_BUFFER_CREATED), "Log buffer is created");
     return ret;
 }
@@ -194,6 +204,7 @@ JournalLogBuffer::Open(uint64_t& logBufferSize)
     }
 
     logBufferSize = logFile->GetFileSize();
+    _PrepareDirectWrite();
 
     POS_TRACE_INFO(EID(JOURNAL_LOG_BUFFER_LOADED),
         "Journal log buffer is loaded");
@@ -251,6 +262,23 @@ JournalLogBuffer::ReadLogBuffer(int groupId, void* buffer)
     return ret;
 }
 
+int
+JournalLogBuffer::ReadLogBufferChunk(int groupId, uint64_t offset, uint64_t size, void* buffer, FnCompleteMetaFileIo func)
+{
+    AsyncMetaFileIoCtx* readRequest = new AsyncMetaFileIoCtx();
+    readRequest->SetIoInfo(MetaFsIoOpcode::Read, _GetFileOffset(groupId, offset), size, (char*)buffer);
+    readRequest->SetFileInfo(logFile->GetFd(), logFile->GetIoDoneCheckFunc());
+    readRequest->SetCallback(func);
+
+    int ret = logFile->AsyncIO(readRequest);
+    if (ret != 0)
+    {
+        POS_TRACE_ERROR(EID(JOURNAL_LOG_BUFFER_INTERNAL_IO_FAILED), readRequest->ToString());
+        delete readRequest;
+    }
+    return ret;
+}
+
 int
 JournalLogBuffer::WriteLog(LogWriteContext* context, uint64_t offset, FnCompleteMetaFileIo func)
 {
@@ -262,6 +290,23 @@ JournalLogBuffer::WriteLog(LogWriteContext* context, uint64_t offset, FnComplete
     ioContext->SetCallback(func);
 
     ioContext->stopwatch.StoreTimestamp(LogStage::Issue);
+    WriteAmplificationMonitorServiceSingleton::Instance()->Add(arrayId,
+        WriteSource::Journal, context->GetLogSize());
+
+    if (directWriteEnabled == true)
+    {
+        int ret = _CopyToNvram(ioContext);
+        if (ret == EID(SUCCESS))
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            _CompleteDirectWrite(ioContext);
+        }
+        else
+        {
+            delete ioContext;
+        }
+        return ret;
+    }
 
     int ret = logFile->AsyncIO(ioContext);
 
@@ -278,6 +323,170 @@ JournalLogBuffer::WriteLog(LogWriteContext* context, uint64_t offset, FnComplete
     return ret;
 }
 
+// Logs of one group commit are copied into a single buffer and written by one I/O.
+// Every log still completes through its own log write io context
+int
+JournalLogBuffer::WriteLogs(std::vector<LogWriteContext*>& contexts, uint64_t offset, FnCompleteMetaFileIo func)
+{
+    if (contexts.size() == 1)
+    {
+        return WriteLog(contexts[0], offset, func);
+    }
+
+    uint64_t totalSize = 0;
+    for (auto context : contexts)
+    {
+        totalSize += context->GetLogSize();
+    }
+    WriteAmplificationMonitorServiceSingleton::Instance()->Add(arrayId,
+        WriteSource::Journal, totalSize);
+
+    if (directWriteEnabled == true)
+    {
+        return _WriteLogsDirectly(contexts, offset, func);
+    }
+
+    char* buffer = new char[totalSize];
+    auto ioContexts = std::make_shared<std::vector<LogWriteIoContext*>>();
+    uint64_t logOffset = offset;
+    for (auto context : contexts)
+    {
+        memcpy(buffer + (logOffset - offset), context->GetBuffer(), context->GetLogSize());
+
+        LogWriteIoContext* ioContext = ioContextFactory->CreateMapUpdateLogWriteIoContext(context);
+        ioContext->SetIoInfo(MetaFsIoOpcode::Write, logOffset, context->GetLogSize(), context->GetBuffer());
+        ioContext->SetCallback(func);
+        ioContext->stopwatch.StoreTimestamp(LogStage::Issue);
+        ioContexts->push_back(ioContext);
+
+        logOffset += context->GetLogSize();
+    }
+
+    AsyncMetaFileIoCtx* batchContext = new AsyncMetaFileIoCtx();
+    batchContext->SetIoInfo(MetaFsIoOpcode::Write, offset, totalSize, buffer);
+    batchContext->SetFileInfo(logFile->GetFd(), logFile->GetIoDoneCheckFunc());
+    batchContext->SetCallback([ioContexts](AsyncMetaFileIoCtx* ctx)
+    {
+        for (auto ioContext : *ioContexts)
+        {
+            ioContext->error = ctx->GetError();
+            ioContext->GetCallback()(ioContext);
+        }
+        delete[] ctx->GetBuffer();
+        delete ctx;
+    });
+
+    int ret = logFile->AsyncIO(batchContext);
+    if (ret != 0)
+    {
+        POS_TRACE_ERROR(EID(JOURNAL_LOG_WRITE_FAILED),
+            "Failed to write {} journal logs at once", contexts.size());
+        POS_TRACE_ERROR(EID(JOURNAL_LOG_WRITE_FAILED), batchContext->ToString());
+
+        // logs are already handed over, so they are completed with the error
+        batchContext->error = -1 * EID(JOURNAL_LOG_WRITE_FAILED);
+        batchContext->GetCallback()(batchContext);
+        ret = -1 * EID(JOURNAL_LOG_WRITE_FAILED);
+    }
+
+    return ret;
+}
+
+// Logs of a log buffer on nvram can be stored by the cpu without going through metafs.
+// Only log writes take this path. Reads, resets and footers still go through metafs
+void
+JournalLogBuffer::_PrepareDirectWrite(void)
+{
+    directWriteEnabled = false;
+    if (directWriteRequested == false)
+    {
+        return;
+    }
+
+    if (logFile->GetDirectAccessAddress(0) == nullptr)
+    {
+        POS_TRACE_WARN(EID(JOURNAL_CONFIGURATION),
+            "Log buffer is not byte addressable, journal logs are written through metafs");
+        return;
+    }
+
+    directWriteEnabled = true;
+    POS_TRACE_INFO(EID(JOURNAL_LOG_BUFFER_INITIATED),
+        "Journal logs are written to nvram directly, array_id:{}", arrayId);
+}
+
+int
+JournalLogBuffer::_CopyToNvram(AsyncMetaFileIoCtx* ctx)
+{
+    char* destination = logFile->GetDirectAccessAddress(ctx->GetFileOffset());
+    if (destination == nullptr)
+    {
+        POS_TRACE_ERROR(EID(JOURNAL_LOG_WRITE_FAILED),
+            "Failed to write journal log to nvram directly, {}", ctx->ToString());
+        return -1 * EID(JOURNAL_LOG_WRITE_FAILED);
+    }
+
+    memcpy(destination, ctx->GetBuffer(), ctx->GetLength());
+    return EID(SUCCESS);
+}
+
+// Logs of one group commit are copied at once and made visible by a single fence
+int
+JournalLogBuffer::_WriteLogsDirectly(std::vector<LogWriteContext*>& contexts, uint64_t offset, FnCompleteMetaFileIo func)
+{
+    int ret = EID(SUCCESS);
+    std::vector<LogWriteIoContext*> ioContexts;
+    uint64_t logOffset = offset;
+    for (auto context : contexts)
+    {
+        LogWriteIoContext* ioContext = ioContextFactory->CreateMapUpdateLogWriteIoContext(context);
+        ioContext->SetIoInfo(MetaFsIoOpcode::Write, logOffset, context->GetLogSize(), context->GetBuffer());
+        ioContext->SetCallback(func);
+        ioContext->stopwatch.StoreTimestamp(LogStage::Issue);
+        ioContexts.push_back(ioContext);
+
+        if (ret == EID(SUCCESS))
+        {
+            ret = _CopyToNvram(ioContext);
+        }
+        logOffset += context->GetLogSize();
+    }
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // logs are already handed over, so they are completed with the error on failure
+    for (auto ioContext : ioContexts)
+    {
+        ioContext->error = ret;
+        _CompleteDirectWrite(ioContext);
+    }
+
+    return ret;
+}
+
+// Completion of a direct write can issue the next waiting log on the same thread.
+// Nested completions are queued and run by the outermost one to bound the stack depth
+void
+JournalLogBuffer::_CompleteDirectWrite(AsyncMetaFileIoCtx* ctx)
+{
+    thread_local std::deque<AsyncMetaFileIoCtx*> completions;
+    thread_local bool isCompleting = false;
+
+    completions.push_back(ctx);
+    if (isCompleting == true)
+    {
+        return;
+    }
+
+    isCompleting = true;
+    while (completions.empty() == false)
+    {
+        AsyncMetaFileIoCtx* next = completions.front();
+        completions.pop_front();
+        next->GetCallback()(next);
+    }
+    isCompleting = false;
+}
+
 int
 JournalLogBuffer::SyncResetAll(void)
 {
@@ -34,6 +34,7 @@
 
 #include <atomic>
 #include <string>
+#include <vector>
 
 #include "src/include/smart_ptr_type.h"
 #include "src/journal_manager/config/journal_configuration.h"
@@ -64,7 +65,9 @@ public:
     virtual int Open(uint64_t& logBufferSize) override;
 
     virtual int ReadLogBuffer(int groupId, void* buffer) override;
+    virtual int ReadLogBufferChunk(int groupId, uint64_t offset, uint64_t size, void* buffer, FnCompleteMetaFileIo func) override;
     virtual int WriteLog(LogWriteContext* context, uint64_t offset, FnCompleteMetaFileIo func) override;
+    virtual int WriteLogs(std::vector<LogWriteContext*>& contexts, uint64_t offset, FnCompleteMetaFileIo func) override;
 
     virtual int SyncResetAll(void) override;
     virtual int AsyncReset(int id, EventSmartPtr callbackEvent) override;
@@ -97,6 +100,11 @@ private:
     int _InternalIo(LogBufferIoContext* context);
     void _InternalIoDone(AsyncMetaFileIoCtx* context);
 
+    void _PrepareDirectWrite(void);
+    int _CopyToNvram(AsyncMetaFileIoCtx* ctx);
+    int _WriteLogsDirectly(std::vector<LogWriteContext*>& contexts, uint64_t offset, FnCompleteMetaFileIo func);
+    void _CompleteDirectWrite(AsyncMetaFileIoCtx* ctx);
+
     void _LoadBufferSize(void);
     void _LogBufferReadDone(AsyncMetaFileIoCtx* ctx);
 
@@ -112,6 +120,8 @@ private:
     std::atomic<int> numInitializedLogGroup;
     std::atomic<bool> logBufferReadDone;
     MetaFileIntf* logFile;
+    bool directWriteRequested;
+    bool directWriteEnabled;
 
     char* initializedDataBuffer;
 
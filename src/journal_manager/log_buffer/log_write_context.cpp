@@ -32,6 +32,8 @@
 
 #include "src/journal_manager/log_buffer/log_write_context.h"
 
+#include <cstring>
+
 #include "src/event_scheduler/meta_update_call_back.h"
 #include "src/journal_manager/log/log_handler.h"
 
@@ -39,7 +41,9 @@ namespace pos
 {
 LogWriteContext::LogWriteContext(void)
 : log(nullptr),
+  isOrdered(false),
   logGroupId(INVALID_GROUP_ID),
+  volumeId(0),
   callback(nullptr)
 {
 }
@@ -64,12 +68,28 @@ LogWriteContext::~LogWriteContext(void)
     delete log;
 }
 
+// Makes room for the order header, so it is set before the buffer is allocated
+void
+LogWriteContext::SetLogOrdered(void)
+{
+    isOrdered = true;
+}
+
 void
-LogWriteContext::SetLogAllocated(int id, uint64_t seqNum)
+LogWriteContext::SetLogAllocated(int id, uint64_t seqNum, uint64_t order)
 {
     this->logGroupId = id;
     this->log->SetSeqNum(seqNum);
 
+    if (isOrdered == true)
+    {
+        LogOrderHeader header;
+        header.order = order;
+        orderedLog.resize(sizeof(header) + log->GetSize());
+        memcpy(orderedLog.data(), &header, sizeof(header));
+        memcpy(orderedLog.data() + sizeof(header), log->GetData(), log->GetSize());
+    }
+
     MetaUpdateCallback* metaUpdateCb = dynamic_cast<MetaUpdateCallback*>(callback.get());
 
     if (nullptr != metaUpdateCb)
@@ -99,12 +119,20 @@ LogWriteContext::GetLogGroupId(void)
 uint64_t
 LogWriteContext::GetLogSize(void)
 {
+    if (isOrdered == true)
+    {
+        return sizeof(LogOrderHeader) + log->GetSize();
+    }
     return log->GetSize();
 }
 
 char*
 LogWriteContext::GetBuffer(void)
 {
+    if (isOrdered == true)
+    {
+        return orderedLog.data();
+    }
     return log->GetData();
 }
 
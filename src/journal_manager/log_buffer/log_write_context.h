@@ -32,9 +32,13 @@
 
 #pragma once
 
+#include <chrono>
+#include <vector>
+
 #include "src/include/smart_ptr_type.h"
 #include "src/mapper/include/mapper_const.h"
 #include "src/mapper/include/mpage_info.h"
+#include "src/trace/io_stage_trace.h"
 
 namespace pos
 {
@@ -48,7 +52,8 @@ public:
     LogWriteContext(LogHandlerInterface* inputLog, MapList inputMapList, EventSmartPtr callbackEvent);
     virtual ~LogWriteContext(void);
 
-    virtual void SetLogAllocated(int logGroupId, uint64_t sequenceNumber);
+    virtual void SetLogOrdered(void);
+    virtual void SetLogAllocated(int logGroupId, uint64_t sequenceNumber, uint64_t order = 0);
 
     virtual const MapList& GetDirtyMapList(void);
     virtual int GetLogGroupId(void);
@@ -59,12 +64,58 @@ public:
 
     virtual LogHandlerInterface* GetLog(void);
 
+    // For log write latency statistics
+    inline void
+    SetWaitingStarted(void)
+    {
+        waitingStartedAt = std::chrono::steady_clock::now();
+    }
+    inline std::chrono::steady_clock::time_point
+    GetWaitingStartedTime(void)
+    {
+        return waitingStartedAt;
+    }
+
+    // Selects the log stream of the log
+    inline void
+    SetVolumeId(int volId)
+    {
+        volumeId = volId;
+    }
+    inline int
+    GetVolumeId(void)
+    {
+        return volumeId;
+    }
+
+    // For the write stage trace of sampled host writes
+    inline void
+    SetStageTrace(IoStageTraceSmartPtr trace)
+    {
+        stageTrace = trace;
+    }
+    inline void
+    MarkStage(IoStage stage)
+    {
+        if (stageTrace != nullptr)
+        {
+            stageTrace->Mark(stage);
+        }
+    }
+
 private:
     LogHandlerInterface* log;
     MapList dirtyMap;
 
+    // The log is written behind its order header, see LogOrderHeader
+    bool isOrdered;
+    std::vector<char> orderedLog;
+
     int logGroupId;
+    int volumeId;
     EventSmartPtr callback;
+    std::chrono::steady_clock::time_point waitingStartedAt;
+    IoStageTraceSmartPtr stageTrace;
 
     static const uint32_t INVALID_GROUP_ID = UINT32_MAX;
 };
@@ -32,13 +32,17 @@
 
 #include "src/journal_manager/log_buffer/log_write_context_factory.h"
 
+#include "src/allocator/include/allocator_const.h"
 #include "src/allocator/stripe_manager/stripe.h"
 #include "src/bio/volume_io.h"
+#include "src/cpu_affinity/affinity_manager.h"
 #include "src/journal_manager/config/journal_configuration.h"
 #include "src/journal_manager/log/block_write_done_log_handler.h"
+#include "src/journal_manager/log/compact_block_write_done_log_handler.h"
 #include "src/journal_manager/log/gc_block_write_done_log_handler.h"
 #include "src/journal_manager/log/gc_map_update_list.h"
 #include "src/journal_manager/log/gc_stripe_flushed_log_handler.h"
+#include "src/journal_manager/log/range_unmapped_log_handler.h"
 #include "src/journal_manager/log/stripe_map_updated_log_handler.h"
 #include "src/journal_manager/log/volume_deleted_log_handler.h"
 #include "src/journal_manager/log_buffer/buffer_write_done_notifier.h"
@@ -65,16 +69,33 @@ LogWriteContextFactory::CreateBlockMapLogWriteContext(VolumeIoSmartPtr volumeIo,
     uint64_t numBlks = DivideUp(volumeIo->GetSize(), BLOCK_SIZE);
 
     VirtualBlkAddr startVsa = volumeIo->GetVsa();
-    int wbIndex = volumeIo->GetVolumeId();
+    // Must name the same tail as the block allocation of the io did
+    AffinityManager* affinityManager = AffinityManagerSingleton::Instance();
+    uint32_t originCore = volumeIo->GetOriginCore();
+    int wbIndex = GetActiveStripeTailIndex(volId, originCore,
+        affinityManager->GetNumaIdFromCoreId(originCore), affinityManager->GetNumaCount(),
+        volumeIo->GetWriteStream());
     StripeAddr writeBufferStripeAddress = volumeIo->GetLsidEntry(); // TODO(huijeong.kim): to only have wbLsid
 
-    BlockWriteDoneLogHandler* log = new BlockWriteDoneLogHandler(volId, startRba,
-        numBlks, startVsa, wbIndex, writeBufferStripeAddress);
+    LogHandlerInterface* log = nullptr;
+    if (config->IsCompactLogEnabled() == true)
+    {
+        log = new CompactBlockWriteDoneLogHandler(volId, startRba,
+            numBlks, startVsa, wbIndex, writeBufferStripeAddress);
+    }
+    else
+    {
+        log = new BlockWriteDoneLogHandler(volId, startRba,
+            numBlks, startVsa, wbIndex, writeBufferStripeAddress);
+    }
 
     MapList dirtyMap;
     dirtyMap.emplace(volId);
 
-    return new LogWriteContext(log, dirtyMap, callback);
+    LogWriteContext* context = new LogWriteContext(log, dirtyMap, callback);
+    context->SetVolumeId(volId);
+    context->SetStageTrace(volumeIo->GetStageTrace());
+    return context;
 }
 
 LogWriteContext*
@@ -90,7 +111,10 @@ LogWriteContextFactory::CreateStripeMapLogWriteContext(StripeSmartPtr stripe,
     MapList dirtyMap;
     dirtyMap.emplace(STRIPE_MAP_ID);
 
-    return new LogWriteContext(log, dirtyMap, callback);
+    // Follows the block logs of the stripe in the same stream
+    LogWriteContext* context = new LogWriteContext(log, dirtyMap, callback);
+    context->SetVolumeId(stripe->GetVolumeId());
+    return context;
 }
 
 LogWriteContext*
@@ -102,7 +126,9 @@ LogWriteContextFactory::CreateGcBlockMapLogWriteContext(GcStripeMapUpdateList ma
 
     MapList dummyDirty;
 
-    return new LogWriteContext(log, callback);
+    LogWriteContext* context = new LogWriteContext(log, callback);
+    context->SetVolumeId(mapUpdates.volumeId);
+    return context;
 }
 
 std::vector<LogWriteContext*>
@@ -130,7 +156,9 @@ LogWriteContextFactory::CreateGcBlockMapLogWriteContexts(GcStripeMapUpdateList m
 
         MapList dummyDirty;
 
-        returnList.push_back(new LogWriteContext(log, callback));
+        LogWriteContext* context = new LogWriteContext(log, callback);
+        context->SetVolumeId(mapUpdates.volumeId);
+        returnList.push_back(context);
 
         remainingBlocks -= numBlocks;
     }
@@ -160,7 +188,9 @@ LogWriteContextFactory::CreateGcStripeFlushedLogWriteContext(GcStripeMapUpdateLi
     dirtyMap.emplace(STRIPE_MAP_ID);
     dirtyMap.emplace(mapUpdates.volumeId);
 
-    return new LogWriteContext(log, dirtyMap, callbackEvent);
+    LogWriteContext* context = new LogWriteContext(log, dirtyMap, callbackEvent);
+    context->SetVolumeId(mapUpdates.volumeId);
+    return context;
 }
 
 LogWriteContext*
@@ -168,7 +198,23 @@ LogWriteContextFactory::CreateVolumeDeletedLogWriteContext(int volId,
     uint64_t contextVersion, EventSmartPtr callback)
 {
     LogHandlerInterface* log = new VolumeDeletedLogEntry(volId, contextVersion);
-    return new LogWriteContext(log, callback);
+    LogWriteContext* context = new LogWriteContext(log, callback);
+    context->SetVolumeId(volId);
+    return context;
+}
+
+LogWriteContext*
+LogWriteContextFactory::CreateRangeUnmappedLogWriteContext(int volId,
+    BlkAddr startRba, uint64_t numBlks, EventSmartPtr callback)
+{
+    LogHandlerInterface* log = new RangeUnmappedLogHandler(volId, startRba, numBlks);
+
+    MapList dirtyMap;
+    dirtyMap.emplace(volId);
+
+    LogWriteContext* context = new LogWriteContext(log, dirtyMap, callback);
+    context->SetVolumeId(volId);
+    return context;
 }
 
 } // namespace pos
@@ -60,6 +60,8 @@ public:
         GcStripeMapUpdateList mapUpdates, EventSmartPtr callbackEvent);
     virtual LogWriteContext* CreateVolumeDeletedLogWriteContext(int volId,
         uint64_t contextVersion, EventSmartPtr callback);
+    virtual LogWriteContext* CreateRangeUnmappedLogWriteContext(int volId,
+        BlkAddr startRba, uint64_t numBlks, EventSmartPtr callback);
 
 private:
     uint64_t _GetMaxNumGcBlockMapUpdateInAContext(void);
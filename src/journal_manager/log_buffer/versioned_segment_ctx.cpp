@@ -83,16 +83,15 @@ VersionedSegmentCtx::_Init(JournalConfiguration* journalConfiguration, SegmentIn
 
     numSegments = numSegments_;
     segmentInfos = new SegmentInfo[numSegments]();
-    for (uint32_t segId = 0; segId < numSegments; segId++)
+    if (nullptr != loadedSegmentInfo)
     {
-        if (nullptr != loadedSegmentInfo)
+        memcpy(segmentInfos, loadedSegmentInfo, sizeof(SegmentInfo) * numSegments);
+        for (uint32_t segId = 0; segId < numSegments; segId++)
         {
-            POS_TRACE_INFO(EID(JOURNAL_MANAGER_INITIALIZED), "Loaded segment: segId {}, validcnt {}, stripeCnt {}, state {}",
+            POS_TRACE_DEBUG(EID(JOURNAL_MANAGER_INITIALIZED), "Loaded segment: segId {}, validcnt {}, stripeCnt {}, state {}",
                            segId, loadedSegmentInfo[segId].GetValidBlockCount(),
                            loadedSegmentInfo[segId].GetOccupiedStripeCount(),
                            loadedSegmentInfo[segId].GetState());
-
-            memcpy(segmentInfos, loadedSegmentInfo, sizeof(SegmentInfo) * numSegments);
         }
     }
 }
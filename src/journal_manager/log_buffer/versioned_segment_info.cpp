@@ -31,65 +31,169 @@
  */
 
 #include "versioned_segment_info.h"
+
+#include <sched.h>
+#include <stdlib.h>
+
+#include <new>
+
 #include "src/logger/logger.h"
 
 namespace pos
 {
 VersionedSegmentInfo::VersionedSegmentInfo(void)
+: shards(nullptr)
 {
+    // new[] does not honor the alignment of Shard before C++17
+    void* mem = nullptr;
+    if (0 != posix_memalign(&mem, CACHE_LINE_SIZE, sizeof(Shard) * NUM_SHARDS))
+    {
+        throw std::bad_alloc();
+    }
+    shards = static_cast<Shard*>(mem);
+    for (uint32_t index = 0; index < NUM_SHARDS; index++)
+    {
+        new (&shards[index]) Shard();
+    }
 }
 
 VersionedSegmentInfo::~VersionedSegmentInfo(void)
 {
-    Reset();
+    for (uint32_t index = 0; index < NUM_SHARDS; index++)
+    {
+        shards[index].~Shard();
+    }
+    free(shards);
 }
 
 void
 VersionedSegmentInfo::Reset(void)
 {
-    changedOccupiedStripeCount.clear();
-    changedValidBlockCount.clear();
+    for (uint32_t index = 0; index < NUM_SHARDS; index++)
+    {
+        std::lock_guard<std::mutex> guard(shards[index].lock);
+        shards[index].deltas.clear();
+    }
 }
 
 void
 VersionedSegmentInfo::IncreaseValidBlockCount(SegmentId segId, uint32_t cnt)
 {
-    changedValidBlockCount[segId] += cnt;
+    Shard& shard = _GetShard();
+    std::lock_guard<std::mutex> guard(shard.lock);
+    SegmentDelta& delta = shard.deltas[segId];
+    delta.validBlockCount += cnt;
+    delta.validBlockCountChanged = true;
 }
 
 void
 VersionedSegmentInfo::DecreaseValidBlockCount(SegmentId segId, uint32_t cnt)
 {
-    changedValidBlockCount[segId] -= cnt;
+    Shard& shard = _GetShard();
+    std::lock_guard<std::mutex> guard(shard.lock);
+    SegmentDelta& delta = shard.deltas[segId];
+    delta.validBlockCount -= cnt;
+    delta.validBlockCountChanged = true;
 }
 
 void
 VersionedSegmentInfo::IncreaseOccupiedStripeCount(SegmentId segId)
 {
-    changedOccupiedStripeCount[segId]++;
+    Shard& shard = _GetShard();
+    std::lock_guard<std::mutex> guard(shard.lock);
+    SegmentDelta& delta = shard.deltas[segId];
+    delta.occupiedStripeCount++;
+    delta.occupiedStripeCountChanged = true;
 }
 
 void
 VersionedSegmentInfo::ResetOccupiedStripeCount(SegmentId segId)
 {
-    changedOccupiedStripeCount[segId] = 0;
+    for (uint32_t index = 0; index < NUM_SHARDS; index++)
+    {
+        std::lock_guard<std::mutex> guard(shards[index].lock);
+        auto it = shards[index].deltas.find(segId);
+        if (it != shards[index].deltas.end())
+        {
+            it->second.occupiedStripeCount = 0;
+            it->second.occupiedStripeCountChanged = false;
+            _EraseIfUnchanged(shards[index], segId);
+        }
+    }
 }
 
 void
 VersionedSegmentInfo::ResetValidBlockCount(SegmentId segId)
 {
-    changedValidBlockCount[segId] = 0;
+    for (uint32_t index = 0; index < NUM_SHARDS; index++)
+    {
+        std::lock_guard<std::mutex> guard(shards[index].lock);
+        auto it = shards[index].deltas.find(segId);
+        if (it != shards[index].deltas.end())
+        {
+            it->second.validBlockCount = 0;
+            it->second.validBlockCountChanged = false;
+            _EraseIfUnchanged(shards[index], segId);
+        }
+    }
 }
 
 tbb::concurrent_unordered_map<SegmentId, int>
 VersionedSegmentInfo::GetChangedValidBlockCount(void)
 {
-    return this->changedValidBlockCount;
+    tbb::concurrent_unordered_map<SegmentId, int> changedValidBlockCount;
+    for (uint32_t index = 0; index < NUM_SHARDS; index++)
+    {
+        std::lock_guard<std::mutex> guard(shards[index].lock);
+        for (auto& entry : shards[index].deltas)
+        {
+            if (entry.second.validBlockCountChanged)
+            {
+                changedValidBlockCount[entry.first] += entry.second.validBlockCount;
+            }
+        }
+    }
+    return changedValidBlockCount;
 }
 
 tbb::concurrent_unordered_map<SegmentId, uint32_t>
 VersionedSegmentInfo::GetChangedOccupiedStripeCount(void)
 {
-    return this->changedOccupiedStripeCount;
+    tbb::concurrent_unordered_map<SegmentId, uint32_t> changedOccupiedStripeCount;
+    for (uint32_t index = 0; index < NUM_SHARDS; index++)
+    {
+        std::lock_guard<std::mutex> guard(shards[index].lock);
+        for (auto& entry : shards[index].deltas)
+        {
+            if (entry.second.occupiedStripeCountChanged)
+            {
+                changedOccupiedStripeCount[entry.first] += entry.second.occupiedStripeCount;
+            }
+        }
+    }
+    return changedOccupiedStripeCount;
+}
+
+VersionedSegmentInfo::Shard&
+VersionedSegmentInfo::_GetShard(void)
+{
+    static thread_local uint32_t cpu = UINT32_MAX;
+    if (cpu == UINT32_MAX)
+    {
+        int current = sched_getcpu();
+        cpu = (current < 0) ? 0 : current;
+    }
+    return shards[cpu % NUM_SHARDS];
+}
+
+void
+VersionedSegmentInfo::_EraseIfUnchanged(Shard& shard, SegmentId segId)
+{
+    auto it = shard.deltas.find(segId);
+    if (it != shard.deltas.end() &&
+        !it->second.validBlockCountChanged && !it->second.occupiedStripeCountChanged)
+    {
+        shard.deltas.erase(it);
+    }
 }
 } // namespace pos
@@ -33,11 +33,17 @@
 #pragma once
 
 #include <atomic>
+#include <mutex>
+#include <unordered_map>
+
 #include "src/include/address_type.h"
 #include "tbb/concurrent_unordered_map.h"
 
 namespace pos
 {
+// Keeps only the segments changed in a log group. The changes are summed per
+// core, so that reactors updating the same segment do not contend, and the
+// cores are merged when the log group is checkpointed.
 class VersionedSegmentInfo
 {
 public:
@@ -54,9 +60,29 @@ public:
     virtual tbb::concurrent_unordered_map<SegmentId, int> GetChangedValidBlockCount(void);
     virtual tbb::concurrent_unordered_map<SegmentId, uint32_t> GetChangedOccupiedStripeCount(void);
 
+    static const uint32_t NUM_SHARDS = 64;
+
 private:
-    tbb::concurrent_unordered_map<SegmentId, int> changedValidBlockCount;
-    tbb::concurrent_unordered_map<SegmentId, uint32_t> changedOccupiedStripeCount;
+    static const uint32_t CACHE_LINE_SIZE = 64;
+
+    struct SegmentDelta
+    {
+        int validBlockCount;
+        uint32_t occupiedStripeCount;
+        bool validBlockCountChanged;
+        bool occupiedStripeCountChanged;
+    };
+    // a shard per cache line, so that the locks of two cores never share one
+    struct alignas(CACHE_LINE_SIZE) Shard
+    {
+        std::mutex lock;
+        std::unordered_map<SegmentId, SegmentDelta> deltas;
+    };
+
+    Shard& _GetShard(void);
+    static void _EraseIfUnchanged(Shard& shard, SegmentId segId);
+
+    Shard* shards;
 };
 
 } // namespace pos
@@ -32,6 +32,7 @@
 
 #include "buffer_offset_allocator.h"
 
+#include <algorithm>
 #include <functional>
 
 #include "src/include/pos_event_id.h"
@@ -39,12 +40,15 @@
 #include "src/journal_manager/config/journal_configuration.h"
 #include "src/journal_manager/config/log_buffer_layout.h"
 #include "src/logger/logger.h"
+#include "src/trace/flight_recorder.h"
 
 namespace pos
 {
 BufferOffsetAllocator::BufferOffsetAllocator(void)
 : config(nullptr),
   releaser(nullptr),
+  numLogStreams(1),
+  isRowActivated(false),
   nextSeqNumber(UINT32_MAX),
   currentLogGroupId(INT32_MAX)
 {
@@ -68,6 +72,7 @@ BufferOffsetAllocator::Init(LogGroupReleaser* logGroupReleaser,
 
     int numLogGroups = config->GetNumLogGroups();
     uint64_t metaPageSize = config->GetMetaPageSize();
+    numLogStreams = std::max(config->GetNumLogStreams(), 1);
 
     for (int groupId = 0; groupId < numLogGroups; groupId++)
     {
@@ -87,6 +92,7 @@ BufferOffsetAllocator::Init(LogGroupReleaser* logGroupReleaser,
     releaser = logGroupReleaser;
     config = journalConfiguration;
     statusList = LogBufferstatusList;
+    numLogStreams = (config != nullptr) ? std::max(config->GetNumLogStreams(), 1) : 1;
 }
 
 void
@@ -109,68 +115,149 @@ BufferOffsetAllocator::Reset(void)
 
     nextSeqNumber = 0;
     currentLogGroupId = 0;
+    isRowActivated = false;
 }
 
+// Volumes are spread over the streams so that their allocations do not contend.
+// Which group a log lands in does not matter to replay, that merges the logs of
+// all groups by their order
 int
-BufferOffsetAllocator::AllocateBuffer(uint32_t logSize, uint64_t& allocatedOffset)
+BufferOffsetAllocator::GetLogStream(int volumeId)
 {
-    std::lock_guard<std::mutex> lock(allocateLock);
+    return volumeId % numLogStreams;
+}
 
-    if (statusList[currentLogGroupId]->GetStatus() == LogGroupStatus::FULL)
+// The order of the log is taken by its log group together with the offset, so
+// the streams share no counter
+int
+BufferOffsetAllocator::AllocateBuffer(uint32_t logSize, uint64_t& allocatedOffset, int stream, uint64_t* order)
+{
+    // Fast path: allocate from the log group of the stream without taking the lock.
+    // Only the allocation that finds the group sealed falls back to the lock
+    int logGroupId = currentLogGroupId.load(std::memory_order_acquire) + stream;
+    if (statusList[logGroupId]->GetStatus() == LogGroupStatus::ACTIVE)
     {
-        return EID(JOURNAL_LOG_GROUP_FULL);
+        int result = statusList[logGroupId]->TryToAllocate(logSize, allocatedOffset, order);
+        if (result <= 0)
+        {
+            return result;
+        }
+        _TryToSetFull(logGroupId);
     }
 
-    if (statusList[currentLogGroupId]->GetStatus() == LogGroupStatus::INIT)
-    {
-        statusList[currentLogGroupId]->SetActive(_GetNextSeqNum());
+    return _AllocateFromNextGroup(stream, logSize, allocatedOffset, order);
+}
 
-        POS_TRACE_INFO(EID(JOURNAL_LOG_GROUP_ALLOCATED),
-            "logGroupId:{}", currentLogGroupId);
-    }
+int
+BufferOffsetAllocator::_AllocateFromNextGroup(int stream, uint32_t logSize, uint64_t& allocatedOffset, uint64_t* order)
+{
+    std::lock_guard<std::mutex> lock(allocateLock);
 
-    uint64_t offset = 0;
-    int result = 0;
-    result = statusList[currentLogGroupId]->TryToAllocate(logSize, offset);
-    if (result > 0)
+    int firstLogGroupId = currentLogGroupId.load(std::memory_order_acquire);
+    if (isRowActivated == false)
     {
-        _TryToSetFull(currentLogGroupId);
-        result = _GetNewActiveGroup();
-        if (result != 0)
+        if (_IsRowFree(firstLogGroupId) == false)
         {
-            return result;
+            return EID(JOURNAL_LOG_GROUP_FULL);
         }
+        _ActivateRow(firstLogGroupId);
+    }
 
-        result = statusList[currentLogGroupId]->TryToAllocate(logSize, offset);
-        if (result != 0)
+    // The group of this stream may be full while the groups of the other
+    // streams still have room. The log takes the first of them, starting from
+    // its own one, which another allocator may have already switched to the new row
+    for (int count = 0; count < numLogStreams; count++)
+    {
+        int logGroupId = firstLogGroupId + (stream + count) % numLogStreams;
+        if (statusList[logGroupId]->GetStatus() == LogGroupStatus::ACTIVE)
         {
-            return result;
+            int result = statusList[logGroupId]->TryToAllocate(logSize, allocatedOffset, order);
+            if (result <= 0)
+            {
+                return result;
+            }
+            _TryToSetFull(logGroupId);
         }
     }
 
-    allocatedOffset = offset;
+    // Every group of the row is full, so every stream moves to the next row
+    _SealRow(firstLogGroupId);
+    int result = _GetNewActiveRow();
+    if (result != 0)
+    {
+        return result;
+    }
 
-    return result;
+    int logGroupId = currentLogGroupId.load(std::memory_order_relaxed) + stream;
+    return statusList[logGroupId]->TryToAllocate(logSize, allocatedOffset, order);
 }
 
 int
-BufferOffsetAllocator::_GetNewActiveGroup(void)
+BufferOffsetAllocator::_GetNewActiveRow(void)
 {
     int numLogGroups = config->GetNumLogGroups();
-    currentLogGroupId = (currentLogGroupId + 1) % numLogGroups;
+    int newLogGroupId = (currentLogGroupId + numLogStreams) % numLogGroups;
 
-    if (statusList[currentLogGroupId]->GetStatus() != LogGroupStatus::INIT)
+    // Activate the new row before publishing it, so lock-free allocators
+    // never see the new group id with a stale sequence number
+    if (_IsRowFree(newLogGroupId) == false)
     {
+        isRowActivated = false;
+        currentLogGroupId.store(newLogGroupId, std::memory_order_release);
         POS_TRACE_WARN(EID(JOURNAL_NO_LOG_BUFFER_AVAILABLE),
-            "No log buffer available for journal (new log group id: {})", currentLogGroupId);
+            "No log buffer available for journal (new log group id: {})", newLogGroupId);
         return EID(JOURNAL_NO_LOG_BUFFER_AVAILABLE);
     }
-    else
+
+    _ActivateRow(newLogGroupId);
+    currentLogGroupId.store(newLogGroupId, std::memory_order_release);
+    return 0;
+}
+
+bool
+BufferOffsetAllocator::_IsRowFree(int firstLogGroupId)
+{
+    for (int id = firstLogGroupId; id < firstLogGroupId + numLogStreams; id++)
+    {
+        if (statusList[id]->GetStatus() != LogGroupStatus::INIT)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// The groups of a row take consecutive sequence numbers in id order, which is
+// the order they are released and replayed in
+void
+BufferOffsetAllocator::_ActivateRow(int firstLogGroupId)
+{
+    for (int id = firstLogGroupId; id < firstLogGroupId + numLogStreams; id++)
     {
-        statusList[currentLogGroupId]->SetActive(_GetNextSeqNum());
+        uint32_t seqNum = _GetNextSeqNum();
+        statusList[id]->SetActive(seqNum);
         POS_TRACE_INFO(EID(JOURNAL_LOG_GROUP_ALLOCATED),
-            "logGroupId:{}", currentLogGroupId);
-        return 0;
+            "logGroupId:{}", id);
+        // the allocator does not know its array
+        FlightRecorderSingleton::Instance()->Record(FlightEventType::LogGroupSwitch,
+            FlightRecorder::NO_ARRAY, id, seqNum);
+    }
+    isRowActivated = true;
+}
+
+// Seals the groups that are not full yet when the row is switched by the dirty
+// page budget, so that no group of an older row is still open when the next
+// row is released
+void
+BufferOffsetAllocator::_SealRow(int firstLogGroupId)
+{
+    for (int id = firstLogGroupId; id < firstLogGroupId + numLogStreams; id++)
+    {
+        if (statusList[id]->GetStatus() == LogGroupStatus::ACTIVE)
+        {
+            statusList[id]->Seal();
+            _TryToSetFull(id);
+        }
     }
 }
 
@@ -191,6 +278,45 @@ BufferOffsetAllocator::_TryToSetFull(int id)
     }
 }
 
+// Seals the active row so that it is checkpointed before it fills up, and
+// switches the allocation to the next row. The row is sealed only when the
+// next one is free, so an early seal never blocks the allocations
+bool
+BufferOffsetAllocator::SealActiveLogGroup(void)
+{
+    std::lock_guard<std::mutex> lock(allocateLock);
+
+    int firstLogGroupId = currentLogGroupId.load(std::memory_order_acquire);
+    int nextLogGroupId = (firstLogGroupId + numLogStreams) % config->GetNumLogGroups();
+    if (isRowActivated == false || _IsRowFree(nextLogGroupId) == false)
+    {
+        return false;
+    }
+
+    uint64_t numLogsAdded = 0;
+    for (int id = firstLogGroupId; id < firstLogGroupId + numLogStreams; id++)
+    {
+        if (statusList[id]->GetStatus() != LogGroupStatus::ACTIVE
+            || statusList[id]->IsSealed() == true)
+        {
+            // The row is already being switched by a full log group
+            return false;
+        }
+        numLogsAdded += statusList[id]->GetNumLogsAdded();
+    }
+    if (numLogsAdded == 0)
+    {
+        return false;
+    }
+
+    POS_TRACE_INFO(EID(JOURNAL_LOG_GROUP_SEALED),
+        "logGroupId:{}, numLogStreams:{}, numLogsAdded:{}, nextOffset:{}", firstLogGroupId,
+        numLogStreams, numLogsAdded, statusList[firstLogGroupId]->GetNextOffset());
+
+    _SealRow(firstLogGroupId);
+    return (_GetNewActiveRow() == 0);
+}
+
 void
 BufferOffsetAllocator::LogWriteCanceled(int id)
 {
@@ -32,6 +32,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <mutex>
 #include <vector>
 
@@ -59,13 +60,15 @@ public:
 
     void Reset(void);
 
-    virtual int AllocateBuffer(uint32_t logSize, uint64_t& allocatedOffset);
+    virtual int AllocateBuffer(uint32_t logSize, uint64_t& allocatedOffset, int stream = 0, uint64_t* order = nullptr);
+    virtual int GetLogStream(int volumeId);
     virtual void LogWriteCanceled(int logGroupId);
+    virtual bool SealActiveLogGroup(void);
 
     virtual void LogFilled(int logGroupId, const MapList& dirty) override;
     virtual void LogBufferReseted(int logGroupId) override;
 
-    uint64_t GetNumLogsAdded(void);
+    virtual uint64_t GetNumLogsAdded(void);
     uint64_t GetNextOffset(void);
 
     virtual LogGroupStatus GetBufferStatus(int logGroupId) override;
@@ -74,7 +77,11 @@ public:
     virtual int GetLogGroupId(uint64_t fileOffset);
 
 private:
-    int _GetNewActiveGroup(void);
+    int _AllocateFromNextGroup(int stream, uint32_t logSize, uint64_t& allocatedOffset, uint64_t* order);
+    int _GetNewActiveRow(void);
+    bool _IsRowFree(int firstLogGroupId);
+    void _ActivateRow(int firstLogGroupId);
+    void _SealRow(int firstLogGroupId);
     uint32_t _GetNextSeqNum(void);
     void _TryToSetFull(int logGroupId);
 
@@ -84,7 +91,12 @@ private:
     std::mutex allocateLock;
     std::vector<LogGroupBufferStatus*> statusList;
 
+    // Each stream allocates from its own log group of the active row, the groups
+    // from currentLogGroupId to currentLogGroupId + numLogStreams - 1
+    int numLogStreams;
+    bool isRowActivated;
+
     uint32_t nextSeqNumber;
-    int currentLogGroupId;
+    std::atomic<int> currentLogGroupId;
 };
 } // namespace pos
@@ -51,7 +51,7 @@ LogGroupBufferStatus::Reset(void)
     waitingToBeFilled = false;
     numLogsAdded = 0;
     numLogsFilled = 0;
-    nextOffset = startOffset;
+    tail = startOffset;
 
     memset(&statusChangedTime, 0x00, sizeof(statusChangedTime));
 
@@ -66,11 +66,12 @@ LogGroupBufferStatus::SetActive(uint64_t inputSeqNum)
     _SetStatus(LogGroupStatus::ACTIVE);
 }
 
+// The order is taken between loading the tail and moving it. An allocation
+// that lands behind another one loads the tail after it is moved, so its order
+// is never smaller. Sealing the row orders the groups of the rows the same way
 int
-LogGroupBufferStatus::TryToAllocate(uint32_t logSize, uint64_t& offset)
+LogGroupBufferStatus::TryToAllocate(uint32_t logSize, uint64_t& offset, uint64_t* order)
 {
-    int result = 0;
-
     if (logSize > metaPageSize)
     {
         POS_TRACE_ERROR(EID(JOURNAL_INVALID_SIZE_LOG_REQUESTED),
@@ -78,42 +79,66 @@ LogGroupBufferStatus::TryToAllocate(uint32_t logSize, uint64_t& offset)
         return -1 * EID(JOURNAL_INVALID_SIZE_LOG_REQUESTED);
     }
 
-    uint64_t currentMetaPage = _GetMetaPageNumber(nextOffset);
-    uint64_t endMetaPage = _GetMetaPageNumber(nextOffset + logSize - 1);
+    // Count the log before publishing its offset, so TryToSetFull can never
+    // see this group fully filled while an allocation is still in progress
+    numLogsAdded++;
 
-    if (currentMetaPage != endMetaPage)
-    {
-        nextOffset = endMetaPage * metaPageSize;
-    }
-    result = _AllocateIfNotFull(logSize, offset);
-    if (result != 0)
+    uint64_t current = tail.load(std::memory_order_acquire);
+    while ((current & TAIL_SEALED) == 0)
     {
-        waitingToBeFilled = true;
+        uint64_t allocated = current;
+        uint64_t currentMetaPage = _GetMetaPageNumber(allocated);
+        uint64_t endMetaPage = _GetMetaPageNumber(allocated + logSize - 1);
+        if (currentMetaPage != endMetaPage)
+        {
+            allocated = endMetaPage * metaPageSize;
+        }
+
+        if (allocated + logSize <= maxOffset)
+        {
+            uint64_t logOrder = (order != nullptr) ? _GetLogOrder() : 0;
+            if (tail.compare_exchange_weak(current, allocated + logSize,
+                    std::memory_order_acq_rel, std::memory_order_acquire) == true)
+            {
+                offset = allocated;
+                if (order != nullptr)
+                {
+                    *order = logOrder;
+                }
+                return EID(SUCCESS);
+            }
+        }
+        else if (tail.compare_exchange_weak(current, current | TAIL_SEALED,
+                     std::memory_order_acq_rel, std::memory_order_acquire) == true)
+        {
+            break;
+        }
     }
 
-    return result;
+    numLogsAdded--;
+    waitingToBeFilled = true;
+
+    return EID(JOURNAL_LOG_GROUP_FULL);
 }
 
-int
-LogGroupBufferStatus::_AllocateIfNotFull(uint32_t logSize, uint64_t& offset)
+// Closes the group before it runs out of space. Allocations after this fail
+// the same way as when a log does not fit, and the group becomes full once
+// every log already allocated is filled
+void
+LogGroupBufferStatus::Seal(void)
 {
-    if (nextOffset + logSize <= maxOffset)
-    {
-        offset = nextOffset;
-        nextOffset += logSize;
-        numLogsAdded++;
-
-        return EID(SUCCESS);
-    }
-    else
-    {
-        return EID(JOURNAL_LOG_GROUP_FULL);
-    }
+    tail.fetch_or(TAIL_SEALED, std::memory_order_acq_rel);
+    waitingToBeFilled = true;
 }
 
 bool
 LogGroupBufferStatus::TryToSetFull(void)
 {
+    if (waitingToBeFilled.load(std::memory_order_acquire) == false)
+    {
+        return false;
+    }
+
     std::unique_lock<std::mutex> lock(fullTriggerLock);
     if (waitingToBeFilled.load(std::memory_order_seq_cst) == true
         && _IsFullyFilled() == true)
@@ -141,7 +166,7 @@ LogGroupBufferStatus::LogFilled(void)
 void
 LogGroupBufferStatus::_SetStatus(LogGroupStatus toStatus)
 {
-    status = toStatus;
+    status.store(toStatus, std::memory_order_release);
     gettimeofday(&statusChangedTime[(int)toStatus], NULL);
 }
 
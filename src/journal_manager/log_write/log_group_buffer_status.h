@@ -33,6 +33,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <sys/time.h>
 
@@ -58,7 +59,8 @@ public:
 
     void SetActive(uint64_t inputSeqNum);
 
-    int TryToAllocate(uint32_t logSize, uint64_t& offset);
+    int TryToAllocate(uint32_t logSize, uint64_t& offset, uint64_t* order = nullptr);
+    virtual void Seal(void);
     virtual bool TryToSetFull(void);
 
     virtual void LogFilled(void);
@@ -66,7 +68,7 @@ public:
     inline LogGroupStatus
     GetStatus(void)
     {
-        return status;
+        return status.load(std::memory_order_acquire);
     }
 
     inline uint64_t
@@ -84,7 +86,13 @@ public:
     inline uint64_t
     GetNextOffset(void)
     {
-        return nextOffset;
+        return tail.load(std::memory_order_acquire) & ~TAIL_SEALED;
+    }
+
+    inline bool
+    IsSealed(void)
+    {
+        return (tail.load(std::memory_order_acquire) & TAIL_SEALED) != 0;
     }
 
     inline uint32_t
@@ -105,20 +113,29 @@ private:
         return offset / metaPageSize;
     }
 
-    int _AllocateIfNotFull(uint32_t logSize, uint64_t& offset);
+    inline uint64_t
+    _GetLogOrder(void)
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
 
     void _SetStatus(LogGroupStatus toStatus);
 
     std::mutex fullTriggerLock;
     uint32_t seqNum;
 
-    LogGroupStatus status;
+    std::atomic<LogGroupStatus> status;
     std::atomic<bool> waitingToBeFilled;
 
     std::atomic<uint64_t> numLogsAdded;
     std::atomic<uint64_t> numLogsFilled;
 
-    uint64_t nextOffset;
+    // Next free offset of this log group. The highest bit seals the group once
+    // a log does not fit, so that every allocation after that fails without
+    // touching the offset and the group can be switched by one allocator.
+    static const uint64_t TAIL_SEALED = (1ULL << 63);
+    std::atomic<uint64_t> tail;
     uint64_t startOffset;
     uint64_t maxOffset;
 
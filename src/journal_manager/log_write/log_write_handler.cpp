@@ -32,6 +32,7 @@
 
 #include "log_write_handler.h"
 
+#include <memory>
 #include <string>
 
 #include "buffer_offset_allocator.h"
@@ -41,6 +42,7 @@
 #include "src/journal_manager/log_buffer/log_write_io_context.h"
 #include "src/journal_manager/log_write/log_write_statistics.h"
 #include "src/journal_manager/replay/replay_stripe.h"
+#include "src/journal_manager/statistics/log_write_latency_statistics.h"
 #include "src/logger/logger.h"
 #include "src/metadata/block_map_update.h"
 #include "src/telemetry/telemetry_client/easy_telemetry_publisher.h"
@@ -59,15 +61,20 @@ LogWriteHandler::LogWriteHandler(LogWriteStatistics* statistics, WaitingLogList*
 : logBuffer(nullptr),
   bufferAllocator(nullptr),
   numLogGroups(0),
+  isLogOrdered(false),
   logWriteStats(statistics),
   waitingList(waitingList),
+  latencyStats(new LogWriteLatencyStatistics()),
   numIosRequested(nullptr),
   numIosCompleted(nullptr),
   easyTp(nullptr),
   interval(nullptr),
   sumOfTimeSpentPerInterval(0),
   doneCountPerInterval(0),
-  arrayId(INT_MAX)
+  arrayId(INT_MAX),
+  numBatchesInFlight(0),
+  maxBatchSize(0),
+  batchWindow(0)
 {
 }
 
@@ -75,6 +82,7 @@ LogWriteHandler::~LogWriteHandler(void)
 {
     delete logWriteStats;
     delete waitingList;
+    delete latencyStats;
 
     if (nullptr != interval)
     {
@@ -102,7 +110,10 @@ LogWriteHandler::Init(BufferOffsetAllocator* allocator, IJournalLogBuffer* buffe
     easyTp = tp;
     interval = timeInterval;
     numLogGroups = journalConfig->GetNumLogGroups();
+    isLogOrdered = (journalConfig->GetNumLogStreams() > 1);
     this->arrayId = arrayId;
+    maxBatchSize = journalConfig->GetGroupCommitMaxBatchSize();
+    batchWindow = std::chrono::microseconds(journalConfig->GetGroupCommitWindowInUsec());
 
     if (journalConfig->IsDebugEnabled() == true)
     {
@@ -111,6 +122,7 @@ LogWriteHandler::Init(BufferOffsetAllocator* allocator, IJournalLogBuffer* buffe
 
     numIosRequested = new std::vector<std::atomic<uint64_t>>(numLogGroups);
     numIosCompleted = new std::vector<std::atomic<uint64_t>>(numLogGroups);
+    pendingBatches.resize(numLogGroups);
 }
 
 void
@@ -123,8 +135,18 @@ int
 LogWriteHandler::AddLog(LogWriteContext* context)
 {
     uint64_t allocatedOffset = 0;
+    uint64_t order = 0;
+    uint64_t* orderToTake = nullptr;
 
-    int result = bufferAllocator->AllocateBuffer(context->GetLogSize(), allocatedOffset);
+    auto allocationStartedAt = std::chrono::steady_clock::now();
+    int stream = bufferAllocator->GetLogStream(context->GetVolumeId());
+    if (isLogOrdered == true)
+    {
+        context->SetLogOrdered();
+        orderToTake = &order;
+    }
+    int result = bufferAllocator->AllocateBuffer(context->GetLogSize(), allocatedOffset, stream, orderToTake);
+    latencyStats->Record(LogWriteLatencyStage::Allocation, allocationStartedAt);
 
     if (EID(SUCCESS) == result)
     {
@@ -132,7 +154,14 @@ LogWriteHandler::AddLog(LogWriteContext* context)
         assert(groupId < numLogGroups);
         uint32_t seqNum = bufferAllocator->GetSequenceNumber(groupId);
 
-        context->SetLogAllocated(groupId, seqNum);
+        context->SetLogAllocated(groupId, seqNum, order);
+
+        if (maxBatchSize != 0)
+        {
+            (*numIosRequested)[groupId]++;
+            _AddToBatch(context, groupId, allocatedOffset);
+            return result;
+        }
 
         result = logBuffer->WriteLog(context, allocatedOffset,
             std::bind(&LogWriteHandler::LogWriteDone, this, std::placeholders::_1));
@@ -153,9 +182,110 @@ LogWriteHandler::AddLog(LogWriteContext* context)
     return result;
 }
 
+// A log joins the open batch of its log group if it directly follows it, and the
+// batch is neither full nor older than the window. The batch is written right away
+// when no other batch is in flight, otherwise it waits for one to complete
+void
+LogWriteHandler::_AddToBatch(LogWriteContext* context, int logGroupId, uint64_t offset)
+{
+    std::vector<LogWriteBatch> batchesToSubmit;
+    {
+        std::lock_guard<std::mutex> lock(batchLock);
+        auto now = std::chrono::steady_clock::now();
+        LogWriteBatch& pendingBatch = pendingBatches[logGroupId];
+
+        if ((pendingBatch.logs.empty() == false) &&
+            (_CanJoinBatch(pendingBatch, offset, context->GetLogSize(), now) == false))
+        {
+            batchesToSubmit.push_back(std::move(pendingBatch));
+            pendingBatch.logs.clear();
+        }
+
+        if (pendingBatch.logs.empty() == true)
+        {
+            pendingBatch.logGroupId = logGroupId;
+            pendingBatch.startOffset = offset;
+            pendingBatch.openedAt = now;
+        }
+        pendingBatch.logs.push_back(context);
+        pendingBatch.endOffset = offset + context->GetLogSize();
+
+        bool isFull = (pendingBatch.endOffset - pendingBatch.startOffset >= maxBatchSize);
+        if ((numBatchesInFlight == 0) || (isFull == true))
+        {
+            batchesToSubmit.push_back(std::move(pendingBatch));
+            pendingBatch.logs.clear();
+        }
+        numBatchesInFlight += batchesToSubmit.size();
+    }
+
+    for (auto& batch : batchesToSubmit)
+    {
+        _SubmitBatch(batch);
+    }
+}
+
+bool
+LogWriteHandler::_CanJoinBatch(LogWriteBatch& batch, uint64_t offset, uint32_t logSize,
+    std::chrono::steady_clock::time_point now)
+{
+    bool isContiguous = (batch.endOffset == offset);
+    bool fits = (offset + logSize - batch.startOffset <= maxBatchSize);
+    bool inWindow = (now - batch.openedAt <= batchWindow);
+
+    return isContiguous && fits && inWindow;
+}
+
+void
+LogWriteHandler::_SubmitBatch(LogWriteBatch& batch)
+{
+    auto numLogsRemaining = std::make_shared<std::atomic<uint32_t>>(batch.logs.size());
+    FnCompleteMetaFileIo logWritten = [this, numLogsRemaining](AsyncMetaFileIoCtx* ctx)
+    {
+        LogWriteDone(ctx);
+        if (numLogsRemaining->fetch_sub(1) == 1)
+        {
+            _BatchWritten();
+        }
+    };
+
+    // On failure every log is already completed with the error through logWritten
+    int result = logBuffer->WriteLogs(batch.logs, batch.startOffset, logWritten);
+    if (EID(SUCCESS) != result)
+    {
+        POS_TRACE_ERROR(result, "Failed to write {} logs of log group {}",
+            batch.logs.size(), batch.logGroupId);
+    }
+}
+
+void
+LogWriteHandler::_BatchWritten(void)
+{
+    std::vector<LogWriteBatch> batchesToSubmit;
+    {
+        std::lock_guard<std::mutex> lock(batchLock);
+        numBatchesInFlight--;
+        for (auto& pendingBatch : pendingBatches)
+        {
+            if (pendingBatch.logs.empty() == false)
+            {
+                batchesToSubmit.push_back(std::move(pendingBatch));
+                pendingBatch.logs.clear();
+                numBatchesInFlight++;
+            }
+        }
+    }
+
+    for (auto& batch : batchesToSubmit)
+    {
+        _SubmitBatch(batch);
+    }
+}
+
 void
 LogWriteHandler::AddLogToWaitingList(LogWriteContext* context)
 {
+    context->SetWaitingStarted();
     waitingList->AddToList(context);
 }
 
@@ -171,6 +301,9 @@ LogWriteHandler::LogWriteDone(AsyncMetaFileIoCtx* ctx)
         (*numIosCompleted)[ioContext->GetLogGroupId()]++;
 
         ioContext->stopwatch.StoreTimestamp(LogStage::Complete);
+        auto completionStartedAt = std::chrono::steady_clock::now();
+        latencyStats->Record(LogWriteLatencyStage::BufferWrite,
+            ioContext->stopwatch.GetElapsedInMicro(LogStage::Issue, LogStage::Complete).count());
         _PublishPeriodicMetrics(ioContext);
 
         bool statusUpdatedToStats = false;
@@ -189,7 +322,9 @@ LogWriteHandler::LogWriteDone(AsyncMetaFileIoCtx* ctx)
             statusUpdatedToStats = logWriteStats->UpdateStatus(logWriteContext);
         }
 
+        logWriteContext->MarkStage(IoStage::JournalWritten);
         ioContext->IoDone();
+        latencyStats->Record(LogWriteLatencyStage::Completion, completionStartedAt);
 
         if (statusUpdatedToStats == true)
         {
@@ -235,6 +370,8 @@ LogWriteHandler::_PublishPeriodicMetrics(LogWriteIoContext* context)
         {
             easyTp->UpdateGauge(TEL36007_JRN_LOG_WRITE_TIME_AVERAGE, (time / count));
         }
+
+        latencyStats->Publish(easyTp, arrayId);
     }
 }
 
@@ -244,6 +381,7 @@ LogWriteHandler::_StartWaitingIos(void)
     auto log = waitingList->GetWaitingIo();
     if (log != nullptr)
     {
+        latencyStats->Record(LogWriteLatencyStage::WaitingList, log->GetWaitingStartedTime());
         AddLog(log);
     }
 }
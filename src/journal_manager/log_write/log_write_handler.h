@@ -33,6 +33,8 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <mutex>
 #include <vector>
 
 #include "../log/waiting_log_list.h"
@@ -50,6 +52,7 @@ class JournalConfiguration;
 class LogWriteStatistics;
 class EasyTelemetryPublisher;
 class LogWriteIoContext;
+class LogWriteLatencyStatistics;
 
 class LogWriteHandler : public LogBufferWriteDoneEvent
 {
@@ -71,15 +74,33 @@ public:
     virtual void LogBufferReseted(int logGroupId) override;
 
 private:
+    // Logs allocated back to back in one log group, written by a single I/O
+    struct LogWriteBatch
+    {
+        std::vector<LogWriteContext*> logs;
+        int logGroupId;
+        uint64_t startOffset;
+        uint64_t endOffset;
+        std::chrono::steady_clock::time_point openedAt;
+    };
+
     void _StartWaitingIos(void);
     void _PublishPeriodicMetrics(LogWriteIoContext* context);
+    void _AddToBatch(LogWriteContext* context, int logGroupId, uint64_t offset);
+    bool _CanJoinBatch(LogWriteBatch& batch, uint64_t offset, uint32_t logSize,
+        std::chrono::steady_clock::time_point now);
+    void _SubmitBatch(LogWriteBatch& batch);
+    void _BatchWritten(void);
 
     IJournalLogBuffer* logBuffer;
     BufferOffsetAllocator* bufferAllocator;
     int numLogGroups;
+    // With several log streams, every log carries its order for replay
+    bool isLogOrdered;
 
     LogWriteStatistics* logWriteStats;
     WaitingLogList* waitingList;
+    LogWriteLatencyStatistics* latencyStats;
 
     std::vector<std::atomic<uint64_t>>* numIosRequested;
     std::vector<std::atomic<uint64_t>>* numIosCompleted;
@@ -89,6 +110,14 @@ private:
     std::atomic<uint64_t> sumOfTimeSpentPerInterval;
     std::atomic<uint64_t> doneCountPerInterval;
     int arrayId;
+
+    // group commit; logs are held only while another batch is being written.
+    // Each log group has its own open batch, as the log streams interleave
+    std::mutex batchLock;
+    std::vector<LogWriteBatch> pendingBatches;
+    uint64_t numBatchesInFlight;
+    uint64_t maxBatchSize;
+    std::chrono::microseconds batchWindow;
 };
 
 } // namespace pos
@@ -32,6 +32,7 @@
 
 #include "src/journal_manager/log_write/log_write_statistics.h"
 
+#include "src/journal_manager/log/compact_block_write_done_log_handler.h"
 #include "src/journal_manager/log/log_handler.h"
 #include "src/journal_manager/log_buffer/log_write_context.h"
 #include "src/journal_manager/statistics/stripe_info.h"
@@ -125,6 +126,13 @@ LogWriteStatistics::UpdateStatus(LogWriteContext* context)
 
             return true;
         }
+        else if (log->GetType() == LogType::BLOCK_WRITE_DONE_COMPACT)
+        {
+            StripeLogWriteStatus* stripeStats = _FindStripeLogs(groupId, log->GetVsid());
+            stripeStats->BlockLogFound(static_cast<CompactBlockWriteDoneLogHandler*>(log)->GetBlockWriteDoneLog());
+
+            return true;
+        }
         else if (log->GetType() == LogType::STRIPE_MAP_UPDATED)
         {
             StripeLogWriteStatus* stripeStats = _FindStripeLogs(groupId, log->GetVsid());
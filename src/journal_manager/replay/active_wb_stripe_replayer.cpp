@@ -35,7 +35,9 @@
 #include <iomanip>
 #include <iostream>
 
+#include "src/allocator/include/allocator_const.h"
 #include "src/logger/logger.h"
+#include "src/mapper/reversemap/reverse_map_footer.h"
 
 namespace pos
 {
@@ -247,7 +249,8 @@ ActiveWBStripeReplayer::_AddActiveStripeToRestore(int index)
     {
         assert(stripeAddr.stripeLoc == IN_WRITE_BUFFER_AREA);
 
-        ActiveStripeAddr* currentAddr = new ActiveStripeAddr(index, readTails[index], stripeAddr.stripeId);
+        ActiveStripeAddr* currentAddr = new ActiveStripeAddr(GetVolumeIdOfActiveStripeTail(index),
+            readTails[index], stripeAddr.stripeId);
         foundActiveStripes[index].insert(currentAddr);
     }
 }
@@ -262,8 +265,9 @@ ActiveWBStripeReplayer::_IsStripeFull(VirtualBlkAddr vsa)
 uint32_t
 ActiveWBStripeReplayer::_GetNumBlksPerStripe(void)
 {
+    // A stripe is full when its blocks but the reverse map footer are written
     const PartitionLogicalSize* udSize = arrayInfo->GetSizeInfo(PartitionType::USER_DATA);
-    return udSize->blksPerStripe;
+    return udSize->blksPerStripe - ReverseMapFooter::GetBlockCount(udSize->blksPerStripe);
 }
 
 void
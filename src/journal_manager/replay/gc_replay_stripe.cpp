@@ -93,12 +93,18 @@ GcReplayStripe::_CreateBlockWriteReplayEvents(GcBlockMapUpdate* blockList, int v
     }
 }
 
+bool
+GcReplayStripe::IsReplayable(void)
+{
+    return (status->IsFlushed() == true && totalNumBlocks == status->GetNumFoundBlocks());
+}
+
 int
 GcReplayStripe::Replay(void)
 {
     int result = 0;
 
-    if (status->IsFlushed() == true && totalNumBlocks == status->GetNumFoundBlocks())
+    if (IsReplayable() == true)
     {
         _CreateStripeFlushReplayEvent();
         _CreateSegmentAllocationEvent();
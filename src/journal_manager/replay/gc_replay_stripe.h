@@ -47,6 +47,7 @@ public:
 
     virtual void AddLog(ReplayLog replayLog) override;
     virtual int Replay(void) override;
+    virtual bool IsReplayable(void) override;
 
 private:
     void _AddLog(LogHandlerInterface* log);
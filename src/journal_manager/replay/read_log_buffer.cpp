@@ -32,6 +32,10 @@
 
 #include "read_log_buffer.h"
 
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
 #include <queue>
 #include <vector>
 #include <iostream>
@@ -41,6 +45,7 @@
 #include "src/journal_manager/replay/replay_log_list.h"
 #include "src/journal_manager/log/log_buffer_parser.h"
 #include "src/journal_manager/log_buffer/journal_log_buffer.h"
+#include "src/include/memory.h"
 #include "src/include/pos_event_id.h"
 #include "src/logger/logger.h"
 namespace pos
@@ -58,17 +63,27 @@ ReadLogBuffer::ReadLogBuffer(JournalConfiguration* journalConfig,
   config(journalConfig),
   logBuffer(logBuffer),
   logList(logList),
+  readChunks(READ_AHEAD_DEPTH),
+  groupSize(0),
+  chunkSize(0),
+  numChunksPerGroup(0),
   parser(logBufferParser)
 {
+    for (auto& chunk : readChunks)
+    {
+        chunk.buffer = nullptr;
+        chunk.readDone = true;
+        chunk.result = EID(SUCCESS);
+    }
 }
 
 ReadLogBuffer::~ReadLogBuffer(void)
 {
-    for (auto buffer : readLogBuffer)
+    for (auto& chunk : readChunks)
     {
-        free(buffer);
+        free(chunk.buffer);
+        chunk.buffer = nullptr;
     }
-    readLogBuffer.clear();
     if (parser != nullptr)
     {
         delete parser;
@@ -89,26 +104,59 @@ ReadLogBuffer::Start(void)
 
     int result = 0;
     int numLogGroups = config->GetNumLogGroups();
-    uint64_t groupSize = config->GetLogGroupSize() * 2;
+    groupSize = config->GetLogGroupSize();
+    chunkSize = _GetChunkSize(groupSize);
+    numChunksPerGroup = (chunkSize == 0) ? 0 : DivideUp(groupSize, chunkSize);
 
-    for (int groupId = 0; groupId < numLogGroups; groupId++)
+    // A log found at the end of a chunk is parsed within the zeroed tail of its buffer
+    uint64_t bufferSize = chunkSize + config->GetMetaPageSize();
+    for (auto& chunk : readChunks)
     {
-        void* logGroupBuffer = calloc(groupSize, sizeof(char));
-        readLogBuffer.push_back(logGroupBuffer);
+        if (chunk.buffer == nullptr)
+        {
+            chunk.buffer = (char*)calloc(bufferSize, sizeof(char));
+        }
+    }
 
-        result = logBuffer->ReadLogBuffer(groupId, logGroupBuffer);
+    uint64_t numChunks = numChunksPerGroup * numLogGroups;
+    uint64_t numChunksIssued = 0;
+    for (uint64_t chunkIndex = 0; chunkIndex < numChunks; chunkIndex++)
+    {
+        while (numChunksIssued < numChunks && numChunksIssued < chunkIndex + READ_AHEAD_DEPTH)
+        {
+            result = _ReadChunk(numChunksIssued);
+            if (result != 0)
+            {
+                break;
+            }
+            numChunksIssued++;
+        }
         if (result != 0)
         {
             break;
         }
 
-        result = parser->GetLogs(logGroupBuffer, groupSize, logList);
+        ReadChunk& chunk = readChunks[chunkIndex % READ_AHEAD_DEPTH];
+        _WaitForRead(chunk);
+        if (chunk.result != EID(SUCCESS))
+        {
+            result = -1 * chunk.result;
+            break;
+        }
+
+        uint64_t offset = (chunkIndex % numChunksPerGroup) * chunkSize;
+        result = parser->GetLogs(chunk.buffer, std::min(chunkSize, groupSize - offset), logList);
         if (result != 0)
         {
             break;
         }
-        reporter->SubTaskCompleted(GetId(), 1);
+
+        if ((chunkIndex + 1) % numChunksPerGroup == 0)
+        {
+            reporter->SubTaskCompleted(GetId(), 1);
+        }
     }
+    _WaitForReadsInFlight();
 
     if (result == 0)
     {
@@ -127,6 +175,65 @@ ReadLogBuffer::Start(void)
     return result;
 }
 
+uint64_t
+ReadLogBuffer::_GetChunkSize(uint64_t groupSize)
+{
+    uint64_t size = NUM_META_PAGES_PER_CHUNK * config->GetMetaPageSize();
+    if (size == 0 || size > groupSize)
+    {
+        size = groupSize;
+    }
+    return size;
+}
+
+int
+ReadLogBuffer::_ReadChunk(uint64_t chunkIndex)
+{
+    int groupId = chunkIndex / numChunksPerGroup;
+    uint64_t offset = (chunkIndex % numChunksPerGroup) * chunkSize;
+    uint64_t size = std::min(chunkSize, groupSize - offset);
+
+    ReadChunk& chunk = readChunks[chunkIndex % READ_AHEAD_DEPTH];
+    // The buffer is reused, and a log buffer may fill only the front of it
+    memset(chunk.buffer, 0, chunkSize);
+    chunk.result = EID(SUCCESS);
+    chunk.readDone = false;
+
+    int result = logBuffer->ReadLogBufferChunk(groupId, offset, size, chunk.buffer,
+        [&chunk](AsyncMetaFileIoCtx* ctx)
+        {
+            chunk.result = ctx->GetError();
+            chunk.readDone = true;
+            delete ctx;
+        });
+    if (result != 0)
+    {
+        chunk.readDone = true;
+        POS_TRACE_ERROR(EID(JOURNAL_REPLAY_STATUS),
+            "Failed to read log group {} from offset {}, size {}", groupId, offset, size);
+    }
+    return result;
+}
+
+void
+ReadLogBuffer::_WaitForRead(ReadChunk& chunk)
+{
+    while (chunk.readDone == false)
+    {
+        usleep(1);
+    }
+}
+
+// Buffers of the chunks still being read cannot be reused or freed
+void
+ReadLogBuffer::_WaitForReadsInFlight(void)
+{
+    for (auto& chunk : readChunks)
+    {
+        _WaitForRead(chunk);
+    }
+}
+
 ReplayTaskId
 ReadLogBuffer::GetId(void)
 {
@@ -32,6 +32,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <vector>
 
 #include "src/journal_manager/replay/replay_task.h"
@@ -59,11 +61,31 @@ public:
     virtual int GetNumSubTasks(void) override;
 
 private:
+    struct ReadChunk
+    {
+        char* buffer;
+        std::atomic<bool> readDone;
+        int result;
+    };
+
+    uint64_t _GetChunkSize(uint64_t groupSize);
+    int _ReadChunk(uint64_t chunkIndex);
+    void _WaitForRead(ReadChunk& chunk);
+    void _WaitForReadsInFlight(void);
+
+    // Log groups are read and parsed by chunks of whole meta pages, so that a log never
+    // spans two chunks. Up to READ_AHEAD_DEPTH chunks are read while one is parsed
+    static const uint64_t NUM_META_PAGES_PER_CHUNK = 64;
+    static const uint64_t READ_AHEAD_DEPTH = 4;
+
     JournalConfiguration* config;
     IJournalLogBuffer* logBuffer;
     ReplayLogList& logList;
 
-    std::vector<void*> readLogBuffer;
+    std::vector<ReadChunk> readChunks;
+    uint64_t groupSize;
+    uint64_t chunkSize;
+    uint64_t numChunksPerGroup;
     LogBufferParser* parser;
 };
 
@@ -49,7 +49,8 @@ ReplayBlockMapUpdate::ReplayBlockMapUpdate(IVSAMap* vsaMap, ISegmentCtx* segment
   startVsa(startVsa),
   numBlks(numBlks),
   replaySegmentInfo(replaySegmentInfo),
-  wbStripeReplayer(wbReplayer)
+  wbStripeReplayer(wbReplayer),
+  mapReplayed(false)
 {
 }
 
@@ -71,23 +72,22 @@ ReplayBlockMapUpdate::_ReadBlockMap(void)
 int
 ReplayBlockMapUpdate::Replay(void)
 {
-    _ReadBlockMap();
-
     int result = 0;
-    for (uint32_t offset = 0; offset < numBlks; offset++)
+    if (mapReplayed == false)
     {
-        VirtualBlkAddr currentVsa = _GetVsa(offset);
-        VirtualBlkAddr read = readMap[offset];
+        result = ReplayMap();
+    }
 
-        // TODO (huijeong.kim) Read vsa can be the latest one than current vsa in the log
-        if (IsSameVsa(read, currentVsa) == false)
+    for (uint32_t offset = 0; offset < numBlks; offset++)
+    {
+        if (blockUpdated[offset] == true)
         {
             if (replaySegmentInfo == true)
             {
                 _InvalidateOldBlock(offset);
+                _ValidateNewBlock(offset);
             }
-
-            result = _UpdateMap(offset);
+            status->BlockWritten(_GetVsa(offset).offset, 1);
         }
     }
 
@@ -101,6 +101,30 @@ ReplayBlockMapUpdate::Replay(void)
     return result;
 }
 
+int
+ReplayBlockMapUpdate::ReplayMap(void)
+{
+    _ReadBlockMap();
+    blockUpdated.assign(numBlks, false);
+
+    int result = 0;
+    for (uint32_t offset = 0; offset < numBlks; offset++)
+    {
+        VirtualBlkAddr currentVsa = _GetVsa(offset);
+        VirtualBlkAddr read = readMap[offset];
+
+        // TODO (huijeong.kim) Read vsa can be the latest one than current vsa in the log
+        if (IsSameVsa(read, currentVsa) == false)
+        {
+            blockUpdated[offset] = true;
+            result = _UpdateMap(offset);
+        }
+    }
+    mapReplayed = true;
+
+    return result;
+}
+
 void
 ReplayBlockMapUpdate::_UpdateReverseMap(uint32_t offset)
 {
@@ -134,14 +158,17 @@ ReplayBlockMapUpdate::_UpdateMap(uint32_t offset)
     int result = vsaMap->SetVSAsWithSyncOpen(volId, rba, virtualBlks);
     assert(result >= 0);
 
-    if (replaySegmentInfo == true)
-    {
-        segmentCtx->ValidateBlks(virtualBlks);
-    }
+    return result;
+}
 
-    status->BlockWritten(virtualBlks.startVsa.offset, virtualBlks.numBlks);
+void
+ReplayBlockMapUpdate::_ValidateNewBlock(uint32_t offset)
+{
+    VirtualBlks virtualBlks = {
+        .startVsa = _GetVsa(offset),
+        .numBlks = 1};
 
-    return result;
+    segmentCtx->ValidateBlks(virtualBlks);
 }
 
 } // namespace pos
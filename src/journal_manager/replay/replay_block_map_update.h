@@ -54,16 +54,28 @@ public:
 
     virtual int Replay(void) override;
 
+    // Updates only the block map of this event. Events of different volumes
+    // do not share any map, so they can be replayed concurrently, while
+    // segment info is replayed later by Replay() in log order
+    virtual int ReplayMap(void);
+
     inline ReplayEventType
     GetType(void)
     {
         return ReplayEventType::BLOCK_MAP_UPDATE;
     }
 
+    inline int
+    GetVolumeId(void)
+    {
+        return volId;
+    }
+
 private:
     void _ReadBlockMap(void);
 
     void _InvalidateOldBlock(uint32_t offset);
+    void _ValidateNewBlock(uint32_t offset);
     int _UpdateMap(uint32_t offset);
     void _UpdateReverseMap(uint32_t offset);
 
@@ -93,5 +105,8 @@ private:
 
     bool replaySegmentInfo;
     ActiveWBStripeReplayer* wbStripeReplayer;
+
+    std::vector<bool> blockUpdated;
+    bool mapReplayed;
 };
 } // namespace pos
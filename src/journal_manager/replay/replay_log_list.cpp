@@ -130,6 +130,44 @@ ReplayLogList::PopReplayLogGroup(void)
     return logGroup;
 }
 
+// The log groups of the streams are filled at the same time, so their logs are
+// merged by the order written with each log. The order replaces the parse time
+// only when every log has one, so the two are never compared with each other
+bool
+ReplayLogList::ApplyLogOrder(void)
+{
+    for (auto& logGroup : logGroups)
+    {
+        for (auto& replayLog : logGroup.second.logs)
+        {
+            if (replayLog.log->GetOrder() == 0)
+            {
+                return false;
+            }
+        }
+    }
+    for (auto& replayLog : deletingLogs)
+    {
+        if (replayLog.log->GetOrder() == 0)
+        {
+            return false;
+        }
+    }
+
+    for (auto& logGroup : logGroups)
+    {
+        for (auto& replayLog : logGroup.second.logs)
+        {
+            replayLog.time = replayLog.log->GetOrder();
+        }
+    }
+    for (auto& replayLog : deletingLogs)
+    {
+        replayLog.time = replayLog.log->GetOrder();
+    }
+    return true;
+}
+
 std::vector<ReplayLog>&
 ReplayLogList::GetDeletingLogs(void)
 {
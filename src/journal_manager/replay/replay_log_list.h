@@ -54,6 +54,7 @@ public:
 
     virtual void EraseReplayLogGroup(uint32_t seqNum);
     virtual ReplayLogGroup PopReplayLogGroup(void);
+    virtual bool ApplyLogOrder(void);
     std::vector<ReplayLog>& GetDeletingLogs(void);
 
 private:
@@ -35,11 +35,15 @@
 #include <iomanip>
 #include <iostream>
 #include <algorithm>
+#include <atomic>
+#include <map>
+#include <thread>
 
 #include "src/journal_manager/log/log_handler.h"
 #include "src/journal_manager/replay/log_delete_checker.h"
 #include "src/journal_manager/replay/pending_stripe.h"
 #include "src/journal_manager/replay/gc_replay_stripe.h"
+#include "src/journal_manager/replay/replay_block_map_update.h"
 #include "src/journal_manager/replay/user_replay_stripe.h"
 
 #include "src/include/pos_event_id.h"
@@ -64,7 +68,8 @@ ReplayLogs::ReplayLogs(ReplayLogList& logList, LogDeleteChecker* deleteChecker,
   wbStripeAllocator(wbStripeAllocator),
   contextManager(contextManager),
   contextReplayer(ctxReplayer),
-  arrayInfo(arrayInfo)
+  arrayInfo(arrayInfo),
+  isLogOrdered(false)
 {
     wbStripeReplayer = new ActiveWBStripeReplayer(contextReplayer,
         wbStripeAllocator, stripeMap, pendingWbStripes, arrayInfo);
@@ -109,6 +114,7 @@ ReplayLogs::Start(void)
     POS_TRACE_INFO(EID(JOURNAL_REPLAY_STATUS),
         "[ReplayTask] Log replay started");
 
+    isLogOrdered = logList.ApplyLogOrder();
     logDeleteChecker->Update(logList.GetDeletingLogs());
 
     result = _ReplayFinishedStripes();
@@ -181,6 +187,15 @@ ReplayLogs::_ReplayFinishedStripes(void)
         replayLogs.insert(replayLogs.end(), logGroup.logs.begin(), logGroup.logs.end());
     }
 
+    // Log groups are popped in sequence number order, but the groups of a row
+    // are filled by the log streams at the same time. Logs of the same order
+    // keep their position in the group
+    if (isLogOrdered == true)
+    {
+        std::stable_sort(replayLogs.begin(), replayLogs.end(),
+            [](const ReplayLog& a, const ReplayLog& b) { return a.time < b.time; });
+    }
+
     POS_TRACE_TRACE(EID(JOURNAL_REPLAY_STATUS),
         "Start replaying logs, numLogs:{}", replayLogs.size());
 
@@ -189,6 +204,12 @@ ReplayLogs::_ReplayFinishedStripes(void)
     int numReplayedUserStripes = 0;
     int numReplayedGcStripes = 0;
 
+    // Logs are sorted into stripes first, and the block map updates of all
+    // finished stripes are replayed per volume in parallel. The other events
+    // of the stripes, including segment info updates, are still replayed one
+    // stripe at a time in log order
+    std::vector<ReplayStripe*> finishedStripes;
+    std::vector<ReplayLog> rangeUnmaps;
     for (auto replayLog : replayLogs)
     {
         LogHandlerInterface* log = replayLog.log;
@@ -206,12 +227,9 @@ ReplayLogs::_ReplayFinishedStripes(void)
             ReplayStripe* stripe = _FindUserStripe(log->GetVsid());
             stripe->AddLog(replayLog);
 
-            result = _ReplayStripe(stripe);
+            _PrepareFinishedStripe(stripe);
+            finishedStripes.push_back(stripe);
             numReplayedUserStripes++;
-            if (result != 0)
-            {
-                break;
-            }
 
             _MoveToReplayedStripe(stripe);
         }
@@ -228,21 +246,49 @@ ReplayLogs::_ReplayFinishedStripes(void)
             ReplayStripe* stripe = _FindGcStripe(log->GetVsid());
             stripe->AddLog(replayLog);
 
-            result = _ReplayStripe(stripe);
+            _PrepareFinishedStripe(stripe);
+            finishedStripes.push_back(stripe);
             numReplayedGcStripes++;
-            if (result != 0)
-            {
-                break;
-            }
 
             _MoveToReplayedStripe(stripe);
         }
+        else if (log->GetType() == LogType::RANGE_UNMAPPED)
+        {
+            int volumeId = reinterpret_cast<RangeUnmappedLog*>(log->GetData())->volId;
+            logDeleteChecker->ReplayedUntil(replayLog.time, volumeId);
+            if (logDeleteChecker->IsDeleted(volumeId) == false)
+            {
+                rangeUnmaps.push_back(replayLog);
+            }
+        }
         else
         {
             POS_TRACE_WARN(EID(JOURNAL_REPLAY_STATUS),
                 "Unknwon log type {} found", log->GetType());
         }
     }
+    reporter->ItemsProcessed(GetId(), replayLogs.size());
+
+    result = _ReplayRangeUnmaps(rangeUnmaps);
+    if (result != 0)
+    {
+        return result;
+    }
+
+    result = _ReplayBlockMaps(finishedStripes);
+    if (result != 0)
+    {
+        return result;
+    }
+
+    for (auto stripe : finishedStripes)
+    {
+        result = stripe->Replay();
+        if (result != 0)
+        {
+            break;
+        }
+    }
 
     POS_TRACE_TRACE(EID(JOURNAL_REPLAY_STATUS), "Replayed finished stripes, numReplayedUserStripes:{}, numReplayedGcStripes:{}",
         numReplayedUserStripes, numReplayedGcStripes);
@@ -250,15 +296,132 @@ ReplayLogs::_ReplayFinishedStripes(void)
     return result;
 }
 
-int
-ReplayLogs::_ReplayStripe(ReplayStripe* stripe)
+void
+ReplayLogs::_PrepareFinishedStripe(ReplayStripe* stripe)
 {
+    // Volume deletion should be checked with the logs found so far
     if (logDeleteChecker->IsDeleted(stripe->GetVolumeId()))
     {
         stripe->DeleteBlockMapReplayEvents();
     }
+}
+
+// Unmapped ranges are replayed ahead of the block maps, so a write that
+// completed after the unmap is not lost. A write that completed before it
+// in the same log window may be mapped again, which deallocation allows
+int
+ReplayLogs::_ReplayRangeUnmaps(std::vector<ReplayLog>& rangeUnmaps)
+{
+    for (auto replayLog : rangeUnmaps)
+    {
+        RangeUnmappedLog* log = reinterpret_cast<RangeUnmappedLog*>(replayLog.log->GetData());
+
+        std::vector<VirtualBlks> oldBlks;
+        int result = vsaMap->UnmapVSAsWithSyncOpen(log->volId, log->startRba, log->numBlks, oldBlks);
+        if (result < 0)
+        {
+            POS_TRACE_ERROR(EID(JOURNAL_REPLAY_FAILED),
+                "Failed to replay unmapped range, volume_id:{}, start_rba:{}, num_blks:{}",
+                log->volId, log->startRba, log->numBlks);
+            return result;
+        }
+
+        if (replayLog.segInfoFlushed == false)
+        {
+            for (auto& blks : oldBlks)
+            {
+                bool allowVictimSegRelease = true;
+                segmentCtx->InvalidateBlks(blks, allowVictimSegRelease);
+            }
+        }
+    }
+    return 0;
+}
+
+int
+ReplayLogs::_ReplayBlockMaps(std::vector<ReplayStripe*>& stripes)
+{
+    std::vector<ReplayBlockMapUpdate*> blockMapEvents;
+    for (auto stripe : stripes)
+    {
+        if (stripe->IsReplayable() == true)
+        {
+            stripe->GetBlockMapReplayEvents(blockMapEvents);
+        }
+    }
+
+    std::map<int, uint32_t> partitionIndex;
+    std::vector<std::vector<ReplayBlockMapUpdate*>> partitions;
+    for (auto replayEvent : blockMapEvents)
+    {
+        auto it = partitionIndex.find(replayEvent->GetVolumeId());
+        if (it == partitionIndex.end())
+        {
+            it = partitionIndex.emplace(replayEvent->GetVolumeId(), partitions.size()).first;
+            partitions.emplace_back();
+        }
+        partitions[it->second].push_back(replayEvent);
+    }
+
+    POS_TRACE_INFO(EID(JOURNAL_REPLAY_STATUS),
+        "Start replaying block maps, numEvents:{}, numVolumes:{}",
+        blockMapEvents.size(), partitions.size());
+
+    int result = _ReplayBlockMapsOfVolumes(partitions);
+    if (result == 0)
+    {
+        reporter->ItemsProcessed(GetId(), blockMapEvents.size());
+    }
+    return result;
+}
+
+int
+ReplayLogs::_ReplayBlockMapsOfVolumes(std::vector<std::vector<ReplayBlockMapUpdate*>>& partitions)
+{
+    std::atomic<uint32_t> nextPartition(0);
+    std::atomic<int> replayResult(0);
+
+    auto replayPartitions = [&](void) {
+        uint32_t index;
+        while ((index = nextPartition.fetch_add(1)) < partitions.size())
+        {
+            for (auto replayEvent : partitions[index])
+            {
+                int result = replayEvent->ReplayMap();
+                if (result != 0)
+                {
+                    int expected = 0;
+                    replayResult.compare_exchange_strong(expected, result);
+                    break;
+                }
+            }
+        }
+    };
+
+    uint32_t numReplayers = partitions.size();
+    if (numReplayers > MAX_NUM_BLOCK_MAP_REPLAYERS)
+    {
+        numReplayers = MAX_NUM_BLOCK_MAP_REPLAYERS;
+    }
+
+    if (numReplayers <= 1)
+    {
+        replayPartitions();
+    }
+    else
+    {
+        std::vector<std::thread> replayers;
+        for (uint32_t count = 0; count < numReplayers; count++)
+        {
+            replayers.push_back(std::thread(replayPartitions));
+        }
+        for (auto& replayer : replayers)
+        {
+            replayer.join();
+        }
+    }
 
-    return stripe->Replay();
+    return replayResult;
 }
 
 void
@@ -56,6 +56,7 @@ class IArrayInfo;
 
 class LogReplayer;
 class ReplayStripe;
+class ReplayBlockMapUpdate;
 class LogHandlerInterface;
 
 class ReplayLogs : public ReplayTask
@@ -78,7 +79,10 @@ private:
     int _ReplayFinishedStripes(void);
     int _ReplayUnfinishedStripes(void);
 
-    int _ReplayStripe(ReplayStripe* stripe);
+    void _PrepareFinishedStripe(ReplayStripe* stripe);
+    int _ReplayRangeUnmaps(std::vector<ReplayLog>& rangeUnmaps);
+    int _ReplayBlockMaps(std::vector<ReplayStripe*>& stripes);
+    int _ReplayBlockMapsOfVolumes(std::vector<std::vector<ReplayBlockMapUpdate*>>& partitions);
 
     ReplayStripe* _FindUserStripe(StripeId vsid);
     ReplayStripe* _FindGcStripe(StripeId vsid);
@@ -102,6 +106,9 @@ private:
     ActiveUserStripeReplayer* userStripeReplayer;
 
     std::vector<ReplayLog> replayLogs;
+    bool isLogOrdered;
+
+    static const uint32_t MAX_NUM_BLOCK_MAP_REPLAYERS = 8;
 };
 
 } // namespace pos
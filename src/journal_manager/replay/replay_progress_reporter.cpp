@@ -72,9 +72,24 @@ ReplayProgressReporter::SubTaskCompleted(ReplayTaskId taskId, int completedTasks
     _ReportProgress();
 }
 
+void
+ReplayProgressReporter::ItemsProcessed(ReplayTaskId taskId, uint64_t numItems)
+{
+    taskProgressList[taskId].ItemsProcessed(numItems);
+}
+
 void
 ReplayProgressReporter::TaskCompleted(ReplayTaskId taskId)
 {
+    TaskProgress& task = taskProgressList[taskId];
+    if (task.GetNumItemsProcessed() != 0)
+    {
+        POS_TRACE_INFO(EID(JOURNAL_REPLAY_STATUS),
+            "[ReplayTask] task:{}, numItemsProcessed:{}, elapsedMs:{}, itemsPerSec:{}",
+            static_cast<int>(taskId), task.GetNumItemsProcessed(),
+            task.GetElapsedTimeInMs(), task.GetThroughput());
+    }
+
     taskProgressList[taskId].Complete();
     progress += taskProgressList[taskId].GetCurerntProgress();
     currentTaskProgress = 0;
@@ -55,6 +55,7 @@ public:
     void RegisterTask(ReplayTaskId taskId, int taskWeight);
     void TaskStarted(ReplayTaskId taskId, int numSubTasks);
     void SubTaskCompleted(ReplayTaskId taskId, int numCompleted = 1);
+    void ItemsProcessed(ReplayTaskId taskId, uint64_t numItems);
     void TaskCompleted(ReplayTaskId taskId);
 
     void CompleteAll(void);
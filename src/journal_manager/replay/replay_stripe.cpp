@@ -33,6 +33,7 @@
 #include "src/journal_manager/replay/replay_stripe.h"
 
 #include "src/include/pos_event_id.h"
+#include "src/journal_manager/replay/replay_block_map_update.h"
 #include "src/journal_manager/replay/replay_event_factory.h"
 #include "src/logger/logger.h"
 
@@ -155,6 +156,18 @@ ReplayStripe::_ReplayEvents(void)
     return result;
 }
 
+void
+ReplayStripe::GetBlockMapReplayEvents(std::vector<ReplayBlockMapUpdate*>& events)
+{
+    for (auto replayEvent : replayEvents)
+    {
+        if (replayEvent->GetType() == ReplayEventType::BLOCK_MAP_UPDATE)
+        {
+            events.push_back(static_cast<ReplayBlockMapUpdate*>(replayEvent));
+        }
+    }
+}
+
 void
 ReplayStripe::DeleteBlockMapReplayEvents(void)
 {
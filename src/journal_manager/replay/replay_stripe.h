@@ -33,6 +33,7 @@
 #pragma once
 
 #include <list>
+#include <vector>
 
 #include "src/include/address_type.h"
 #include "src/journal_manager/replay/i_replay_stripe.h"
@@ -48,6 +49,7 @@ class IArrayInfo;
 
 class LogHandlerInterface;
 class StripeReplayStatus;
+class ReplayBlockMapUpdate;
 class ReplayEventFactory;
 class ActiveWBStripeReplayer;
 class ActiveUserStripeReplayer;
@@ -77,6 +79,9 @@ public:
 
     void DeleteBlockMapReplayEvents(void);
 
+    virtual bool IsReplayable(void) { return true; }
+    void GetBlockMapReplayEvents(std::vector<ReplayBlockMapUpdate*>& events);
+
 protected:
     void _CreateSegmentAllocationEvent(void);
     void _CreateStripeAllocationEvent(void);
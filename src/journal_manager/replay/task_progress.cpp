@@ -49,6 +49,8 @@ void
 TaskProgress::Start(int num)
 {
     numSubTasks = num;
+    numItemsProcessed = 0;
+    startTime = std::chrono::steady_clock::now();
 }
 
 void
@@ -98,4 +100,34 @@ TaskProgress::GetWeight(void)
 {
     return weight;
 }
+
+void
+TaskProgress::ItemsProcessed(uint64_t numItems)
+{
+    numItemsProcessed += numItems;
+}
+
+uint64_t
+TaskProgress::GetNumItemsProcessed(void)
+{
+    return numItemsProcessed;
+}
+
+uint64_t
+TaskProgress::GetElapsedTimeInMs(void)
+{
+    auto elapsed = std::chrono::steady_clock::now() - startTime;
+    return std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+}
+
+uint64_t
+TaskProgress::GetThroughput(void)
+{
+    uint64_t elapsedMs = GetElapsedTimeInMs();
+    if (elapsedMs == 0)
+    {
+        return numItemsProcessed * 1000;
+    }
+    return numItemsProcessed * 1000 / elapsedMs;
+}
 } // namespace pos
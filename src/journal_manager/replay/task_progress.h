@@ -31,6 +31,8 @@
  */
 
 #pragma once
+#include <chrono>
+#include <cstdint>
 #include <map>
 
 namespace pos
@@ -45,15 +47,24 @@ public:
     void Start(int numSubTasks);
     void SubTaskCompleted(int numCompleted);
     void Complete(void);
+    void ItemsProcessed(uint64_t numItems);
 
     int GetCurerntProgress(void);
     int GetNumSubTasks(void);
     int GetNumCompletedSubTasks(void);
     int GetWeight(void);
+    uint64_t GetNumItemsProcessed(void);
+    uint64_t GetElapsedTimeInMs(void);
+    uint64_t GetThroughput(void);
 
 private:
     int numSubTasks;
     int numSubTasksCompleted;
     int weight;
+
+    // Number of logs, stripes or blocks processed by the task, to report
+    // how fast replay is going on top of the sub task progress
+    uint64_t numItemsProcessed = 0;
+    std::chrono::steady_clock::time_point startTime;
 };
 } // namespace pos
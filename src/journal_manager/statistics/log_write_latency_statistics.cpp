@@ -0,0 +1,111 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/journal_manager/statistics/log_write_latency_statistics.h"
+
+#include "src/telemetry/telemetry_client/easy_telemetry_publisher.h"
+#include "src/telemetry/telemetry_id.h"
+
+namespace pos
+{
+LogWriteLatencyStatistics::LogWriteLatencyStatistics(void)
+: histograms((int)LogWriteLatencyStage::Count)
+{
+}
+
+LogWriteLatencyStatistics::~LogWriteLatencyStatistics(void)
+{
+}
+
+void
+LogWriteLatencyStatistics::Record(LogWriteLatencyStage stage, uint64_t latencyInUsec)
+{
+    histograms[(int)stage].Record(latencyInUsec);
+}
+
+void
+LogWriteLatencyStatistics::Record(LogWriteLatencyStage stage, std::chrono::steady_clock::time_point startedAt)
+{
+    auto elapsed = std::chrono::steady_clock::now() - startedAt;
+    Record(stage, std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+}
+
+void
+LogWriteLatencyStatistics::Publish(EasyTelemetryPublisher* publisher, int arrayId)
+{
+    std::unique_lock<std::mutex> lock(publishLock, std::try_to_lock);
+    if (lock.owns_lock() == false)
+    {
+        return;
+    }
+
+    for (int stage = 0; stage < (int)LogWriteLatencyStage::Count; stage++)
+    {
+        std::vector<uint64_t> counts = histograms[stage].CollectInterval();
+        if (PerCoreHistogram::GetTotalCount(counts) == 0)
+        {
+            continue;
+        }
+
+        VectorLabels labels;
+        labels.push_back({"stage", GetStageName((LogWriteLatencyStage)stage)});
+        labels.push_back({"array_id", std::to_string(arrayId)});
+        publisher->UpdateGauge(TEL36009_JRN_LOG_WRITE_LATENCY_P50,
+            PerCoreHistogram::GetPercentile(counts, 0.5), labels);
+        publisher->UpdateGauge(TEL36010_JRN_LOG_WRITE_LATENCY_P99,
+            PerCoreHistogram::GetPercentile(counts, 0.99), labels);
+        publisher->UpdateGauge(TEL36011_JRN_LOG_WRITE_LATENCY_P999,
+            PerCoreHistogram::GetPercentile(counts, 0.999), labels);
+        publisher->UpdateGauge(TEL36012_JRN_LOG_WRITE_LATENCY_MAX,
+            PerCoreHistogram::GetMax(counts), labels);
+    }
+}
+
+std::string
+LogWriteLatencyStatistics::GetStageName(LogWriteLatencyStage stage)
+{
+    switch (stage)
+    {
+        case LogWriteLatencyStage::Allocation:
+            return "allocation";
+        case LogWriteLatencyStage::WaitingList:
+            return "waiting_list";
+        case LogWriteLatencyStage::BufferWrite:
+            return "buffer_write";
+        case LogWriteLatencyStage::Completion:
+            return "completion";
+        default:
+            return "unknown";
+    }
+}
+
+} // namespace pos
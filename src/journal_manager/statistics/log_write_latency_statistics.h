@@ -0,0 +1,75 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "src/telemetry/telemetry_client/per_core_histogram.h"
+
+namespace pos
+{
+class EasyTelemetryPublisher;
+
+enum class LogWriteLatencyStage
+{
+    Allocation,
+    WaitingList,
+    BufferWrite,
+    Completion,
+    Count
+};
+
+// Latencies of each stage of journal log writes, kept regardless of the debug mode
+class LogWriteLatencyStatistics
+{
+public:
+    LogWriteLatencyStatistics(void);
+    virtual ~LogWriteLatencyStatistics(void);
+
+    virtual void Record(LogWriteLatencyStage stage, uint64_t latencyInUsec);
+    virtual void Record(LogWriteLatencyStage stage, std::chrono::steady_clock::time_point startedAt);
+
+    // Publishes the percentiles of latencies recorded since the previous publish
+    virtual void Publish(EasyTelemetryPublisher* publisher, int arrayId);
+
+    static std::string GetStageName(LogWriteLatencyStage stage);
+
+private:
+    std::vector<PerCoreHistogram> histograms;
+    std::mutex publishLock;
+};
+
+} // namespace pos
@@ -0,0 +1,236 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/lib/atomic_bitmap.h"
+
+#include "src/include/branch_prediction.h"
+
+namespace pos
+{
+AtomicBitMap::AtomicBitMap(uint64_t totalBits)
+: numBits(totalBits),
+  numEntry((totalBits + BITMAP_ENTRY_BITS - 1) / BITMAP_ENTRY_BITS),
+  numSummaryEntry((numEntry + BITMAP_ENTRY_BITS - 1) / BITMAP_ENTRY_BITS),
+  numBitsSet(0)
+{
+    map.reset(new std::atomic<uint64_t>[numEntry]);
+    summary.reset(new std::atomic<uint64_t>[numSummaryEntry]);
+    ResetBitmap();
+}
+
+uint64_t
+AtomicBitMap::GetNumBits(void)
+{
+    return numBits;
+}
+
+uint64_t
+AtomicBitMap::GetNumBitsSet(void)
+{
+    return numBitsSet.load(std::memory_order_relaxed);
+}
+
+bool
+AtomicBitMap::SetBit(uint64_t bitOffset)
+{
+    if (unlikely(IsValidBit(bitOffset) == false))
+    {
+        return false;
+    }
+
+    uint64_t mask = 1ULL << (bitOffset % BITMAP_ENTRY_BITS);
+    uint64_t entry = bitOffset / BITMAP_ENTRY_BITS;
+    uint64_t prev = map[entry].fetch_or(mask, std::memory_order_acq_rel);
+    if ((prev & mask) == 0)
+    {
+        numBitsSet.fetch_add(1, std::memory_order_relaxed);
+        if ((prev | mask) == ~0ULL)
+        {
+            _MarkFull(entry);
+        }
+    }
+    return true;
+}
+
+bool
+AtomicBitMap::ClearBit(uint64_t bitOffset)
+{
+    if (unlikely(IsValidBit(bitOffset) == false))
+    {
+        return false;
+    }
+
+    uint64_t mask = 1ULL << (bitOffset % BITMAP_ENTRY_BITS);
+    uint64_t entry = bitOffset / BITMAP_ENTRY_BITS;
+    uint64_t prev = map[entry].fetch_and(~mask, std::memory_order_acq_rel);
+    if ((prev & mask) != 0)
+    {
+        numBitsSet.fetch_sub(1, std::memory_order_relaxed);
+        if (prev == ~0ULL)
+        {
+            _MarkNotFull(entry);
+        }
+    }
+    return true;
+}
+
+bool
+AtomicBitMap::IsSetBit(uint64_t bitOffset)
+{
+    uint64_t mask = 1ULL << (bitOffset % BITMAP_ENTRY_BITS);
+    return (map[bitOffset / BITMAP_ENTRY_BITS].load(std::memory_order_acquire) & mask) != 0;
+}
+
+bool
+AtomicBitMap::IsValidBit(uint64_t bitOffset)
+{
+    return bitOffset < numBits;
+}
+
+void
+AtomicBitMap::ResetBitmap(void)
+{
+    for (uint64_t entry = 0; entry < numEntry; entry++)
+    {
+        map[entry].store(0, std::memory_order_relaxed);
+    }
+    for (uint64_t entry = 0; entry < numSummaryEntry; entry++)
+    {
+        summary[entry].store(0, std::memory_order_relaxed);
+    }
+    numBitsSet.store(0, std::memory_order_release);
+}
+
+// A bit set while the words are being drained is either moved in this call or
+// left for the next one, never lost
+uint64_t
+AtomicBitMap::MoveSetBitsTo(BitMap& dest)
+{
+    uint64_t numMoved = 0;
+    for (uint64_t entry = 0; entry < numEntry; entry++)
+    {
+        uint64_t bits = map[entry].exchange(0, std::memory_order_acq_rel);
+        if (bits == ~0ULL)
+        {
+            _MarkNotFull(entry);
+        }
+        while (bits != 0)
+        {
+            uint64_t col = __builtin_ctzll(bits);
+            dest.SetBit(entry * BITMAP_ENTRY_BITS + col);
+            bits &= bits - 1;
+            numMoved++;
+        }
+    }
+    numBitsSet.fetch_sub(numMoved, std::memory_order_relaxed);
+    return numMoved;
+}
+
+// Returns numBits when no zero bit is left in [begin, end]
+uint64_t
+AtomicBitMap::SetFirstZeroBit(uint64_t begin, uint64_t end)
+{
+    if (unlikely(IsValidBit(begin) == false || IsValidBit(end) == false || begin > end))
+    {
+        return numBits;
+    }
+
+    uint64_t entry = begin / BITMAP_ENTRY_BITS;
+    uint64_t lowMask = (1ULL << (begin % BITMAP_ENTRY_BITS)) - 1;
+    uint64_t lastEntry = end / BITMAP_ENTRY_BITS;
+    while (entry <= lastEntry)
+    {
+        uint64_t val = map[entry].load(std::memory_order_acquire);
+        while ((val | lowMask) != ~0ULL)
+        {
+            uint64_t col = __builtin_ctzll(~(val | lowMask));
+            uint64_t bitOffset = entry * BITMAP_ENTRY_BITS + col;
+            if (bitOffset > end)
+            {
+                return numBits;
+            }
+
+            uint64_t mask = 1ULL << col;
+            if (map[entry].compare_exchange_weak(val, val | mask, std::memory_order_acq_rel))
+            {
+                numBitsSet.fetch_add(1, std::memory_order_relaxed);
+                if ((val | mask) == ~0ULL)
+                {
+                    _MarkFull(entry);
+                }
+                return bitOffset;
+            }
+            // val is reloaded by the failed CAS
+        }
+        lowMask = 0;
+        entry = _FindNonFullEntry(entry + 1);
+    }
+    return numBits;
+}
+
+uint64_t
+AtomicBitMap::_FindNonFullEntry(uint64_t entry)
+{
+    while (entry < numEntry)
+    {
+        uint64_t summaryEntry = entry / BITMAP_ENTRY_BITS;
+        uint64_t summaryCol = entry % BITMAP_ENTRY_BITS;
+        uint64_t val = summary[summaryEntry].load(std::memory_order_acquire) | ((1ULL << summaryCol) - 1);
+        if (val != ~0ULL)
+        {
+            return (summaryEntry * BITMAP_ENTRY_BITS) + __builtin_ctzll(~val);
+        }
+        entry = (summaryEntry + 1) * BITMAP_ENTRY_BITS;
+    }
+    return numEntry;
+}
+
+void
+AtomicBitMap::_MarkFull(uint64_t entry)
+{
+    uint64_t mask = 1ULL << (entry % BITMAP_ENTRY_BITS);
+    summary[entry / BITMAP_ENTRY_BITS].fetch_or(mask, std::memory_order_seq_cst);
+    // A bit cleared in between may have been unmarked before this mark
+    if (map[entry].load(std::memory_order_seq_cst) != ~0ULL)
+    {
+        _MarkNotFull(entry);
+    }
+}
+
+void
+AtomicBitMap::_MarkNotFull(uint64_t entry)
+{
+    uint64_t mask = 1ULL << (entry % BITMAP_ENTRY_BITS);
+    summary[entry / BITMAP_ENTRY_BITS].fetch_and(~mask, std::memory_order_seq_cst);
+}
+
+} // namespace pos
@@ -0,0 +1,80 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "src/lib/bitmap.h"
+
+namespace pos
+{
+// Bitmap whose bits are set and cleared with atomic word operations, so that
+// concurrent writers need no lock. MoveSetBitsTo() takes a snapshot of the
+// set bits and clears them in one pass, for consumers that drain the bitmap.
+// SetFirstZeroBit() claims a zero bit with a CAS on the word it is found in,
+// skipping the full words through a summary of one bit per word. The summary
+// is only a hint: a word that is set full in it is always re-checked, so a bit
+// cleared concurrently is never lost to the search.
+class AtomicBitMap
+{
+public:
+    explicit AtomicBitMap(uint64_t totalBits);
+    virtual ~AtomicBitMap(void) = default;
+
+    virtual uint64_t GetNumBits(void);
+    virtual uint64_t GetNumBitsSet(void);
+
+    virtual bool SetBit(uint64_t bitOffset);
+    virtual bool ClearBit(uint64_t bitOffset);
+    virtual bool IsSetBit(uint64_t bitOffset);
+    virtual bool IsValidBit(uint64_t bitOffset);
+    virtual void ResetBitmap(void);
+    virtual uint64_t MoveSetBitsTo(BitMap& dest);
+    virtual uint64_t SetFirstZeroBit(uint64_t begin, uint64_t end);
+
+private:
+    uint64_t _FindNonFullEntry(uint64_t entry);
+    void _MarkFull(uint64_t entry);
+    void _MarkNotFull(uint64_t entry);
+
+    std::unique_ptr<std::atomic<uint64_t>[]> map;
+    std::unique_ptr<std::atomic<uint64_t>[]> summary;
+    uint64_t numBits;
+    uint64_t numEntry;
+    uint64_t numSummaryEntry;
+    std::atomic<uint64_t> numBitsSet;
+};
+
+} // namespace pos
@@ -47,7 +47,6 @@ namespace pos
  *  32 = ffsl(0x8000,0000)
  *  64 = ffsl(0x8000,0000,0000,0000)
  */
-#define ffzl(x) (ffsl((~x)))
 
 uint64_t
 BitMap::_GetMask(uint64_t numSetBits, uint64_t offset)
@@ -99,12 +98,15 @@ bool
 BitMap::SetNumBitsSet(uint64_t numBits)
 {
     numBitsSet = numBits;
+    summaryValid = false;
     return true;
 }
 
+// The map may be written through the returned address
 uint64_t*
 BitMap::GetMapAddr(void)
 {
+    summaryValid = false;
     return map;
 }
 
@@ -124,6 +126,7 @@ BitMap::SetBit(uint64_t bitOffset)
     uint64_t row = bitOffset / BITMAP_ENTRY_BITS;
     uint64_t col = bitOffset % BITMAP_ENTRY_BITS;
     map[row] |= (1ULL << col);
+    _UpdateSummary(row);
     ++numBitsSet;
     lastSetPosition = bitOffset;
     return true;
@@ -145,6 +148,7 @@ BitMap::ClearBit(uint64_t bitOffset)
     uint64_t row = bitOffset / BITMAP_ENTRY_BITS;
     uint64_t col = bitOffset % BITMAP_ENTRY_BITS;
     map[row] &= (~(1ULL << col));
+    _UpdateSummary(row);
     --numBitsSet;
     return true;
 }
@@ -183,6 +187,7 @@ BitMap::ClearBits(uint64_t begin, uint64_t end)
         numClearBits = endCol - startCol + 1;
         uint64_t mask = _GetMask(numClearBits, startCol);
         map[row] &= (~mask);
+        _UpdateSummary(row);
         numBitsSet -= numClearBits;
     }
 
@@ -196,6 +201,11 @@ BitMap::ResetBitmap(void)
     {
         map[row] = 0;
     }
+    for (uint64_t row = 0; row < numSummaryEntry; ++row)
+    {
+        summary[row] = 0;
+    }
+    summaryValid = true;
     numBitsSet = 0;
 }
 
@@ -214,32 +224,13 @@ BitMap::FlipBit(uint64_t bit)
     {
         map[row] |= (1ULL << col);
     }
+    _UpdateSummary(row);
 }
 
 uint64_t
 BitMap::FindFirstZero(void)
 {
-    uint64_t row = 0;
-    uint64_t offset = 0;
-
-    while (0 == (offset = ffzl(map[row])))
-    {
-        ++row;
-        if (unlikely(row >= numEntry))
-        {
-            return numBits;
-        }
-    }
-
-    offset += (row * BITMAP_ENTRY_BITS) - 1;
-    if (likely(IsValidBit(offset)))
-    {
-        return offset;
-    }
-    else
-    {
-        return numBits;
-    }
+    return _FindZeroFrom(0);
 }
 
 uint64_t
@@ -311,26 +302,48 @@ BitMap::FindFirstZero(uint64_t begin)
     {
         return numBits;
     }
+    return _FindZeroFrom(begin);
+}
+
+uint64_t
+BitMap::FindFirstZero(uint64_t begin, uint64_t end)
+{
+    if (unlikely(IsValidBit(begin) == false || IsValidBit(end) == false))
+    {
+        return numBits;
+    }
+
+    uint64_t offset = _FindZeroFrom(begin);
+    if (unlikely(offset > end))
+    {
+        return numBits;
+    }
+    return offset;
+}
+
+uint64_t
+BitMap::_FindZeroFrom(uint64_t begin)
+{
+    if (unlikely(summaryValid == false))
+    {
+        _RebuildSummary();
+    }
 
     uint64_t row = begin / BITMAP_ENTRY_BITS;
     uint64_t col = begin % BITMAP_ENTRY_BITS;
-    uint64_t offset = 0;
-
-    uint64_t val = map[row];
-    val |= ((1ULL << col) - 1);
 
-    if (0 == (offset = ffzl(val)))
+    uint64_t val = map[row] | ((1ULL << col) - 1);
+    if (val == ALL_BITS_SET)
     {
-        while (0 == (offset = ffzl(map[++row])))
+        row = _FindNonFullEntry(row + 1);
+        if (unlikely(row >= numEntry))
         {
-            if (unlikely(row >= numEntry))
-            {
-                return numBits;
-            }
+            return numBits;
         }
+        val = map[row];
     }
-    offset += (row * BITMAP_ENTRY_BITS) - 1;
 
+    uint64_t offset = (row * BITMAP_ENTRY_BITS) + __builtin_ctzll(~val);
     if (likely(IsValidBit(offset)))
     {
         return offset;
@@ -342,40 +355,48 @@ BitMap::FindFirstZero(uint64_t begin)
 }
 
 uint64_t
-BitMap::FindFirstZero(uint64_t begin, uint64_t end)
+BitMap::_FindNonFullEntry(uint64_t row)
 {
-    if (unlikely(IsValidBit(begin) == false || IsValidBit(end) == false))
+    while (row < numEntry)
     {
-        return numBits;
-    }
-
-    uint64_t row = begin / BITMAP_ENTRY_BITS;
-    uint64_t col = begin % BITMAP_ENTRY_BITS;
-    uint64_t offset = 0;
-
-    uint64_t val = map[row];
-    val |= ((1ULL << col) - 1);
-
-    if (0 == (offset = ffzl(val)))
-    {
-        while (0 == (offset = ffzl(map[++row])))
+        uint64_t summaryRow = row / BITMAP_ENTRY_BITS;
+        uint64_t summaryCol = row % BITMAP_ENTRY_BITS;
+        uint64_t val = summary[summaryRow] | ((1ULL << summaryCol) - 1);
+        if (val != ALL_BITS_SET)
         {
-            if (unlikely(row >= numEntry))
-            {
-                return numBits;
-            }
+            return (summaryRow * BITMAP_ENTRY_BITS) + __builtin_ctzll(~val);
         }
+        row = (summaryRow + 1) * BITMAP_ENTRY_BITS;
     }
-    offset += (row * BITMAP_ENTRY_BITS) - 1;
+    return numEntry;
+}
 
-    if (unlikely(!IsValidBit(offset) || (offset > end)))
+void
+BitMap::_UpdateSummary(uint64_t row)
+{
+    uint64_t mask = 1ULL << (row % BITMAP_ENTRY_BITS);
+    if (map[row] == ALL_BITS_SET)
     {
-        return numBits;
+        summary[row / BITMAP_ENTRY_BITS] |= mask;
     }
     else
     {
-        return offset;
+        summary[row / BITMAP_ENTRY_BITS] &= ~mask;
+    }
+}
+
+void
+BitMap::_RebuildSummary(void)
+{
+    for (uint64_t row = 0; row < numSummaryEntry; ++row)
+    {
+        summary[row] = 0;
+    }
+    for (uint64_t row = 0; row < numEntry; ++row)
+    {
+        _UpdateSummary(row);
     }
+    summaryValid = true;
 }
 
 bool
@@ -402,6 +423,7 @@ BitMap::Set(BitMap& inputBitMap)
     {
         map[row] |= inputBitMap.map[row];
     }
+    summaryValid = false;
     return true;
 }
 
@@ -425,12 +447,18 @@ BitMap::BitMap(uint64_t totalBits)
 
     map = new uint64_t[numEntry]();
     assert(map != nullptr);
+
+    numSummaryEntry = (numEntry + BITMAP_ENTRY_BITS - 1) / BITMAP_ENTRY_BITS;
+    summary = new uint64_t[numSummaryEntry]();
+    summaryValid = true;
 }
 
 BitMap::~BitMap(void)
 {
     delete[] map;
     map = nullptr;
+    delete[] summary;
+    summary = nullptr;
 }
 
 BitMapMutex::BitMapMutex(BitMap* bitmap)
@@ -505,6 +533,18 @@ BitMapMutex::SetBit(uint64_t bit)
     return bitMap->SetBit(bit);
 }
 
+// Sets the bit only when it is currently clear, returns false otherwise
+bool
+BitMapMutex::TrySetBit(uint64_t bit)
+{
+    std::unique_lock<std::mutex> lock(bitMapLock);
+    if (bitMap->IsValidBit(bit) == false || bitMap->IsSetBit(bit) == true)
+    {
+        return false;
+    }
+    return bitMap->SetBit(bit);
+}
+
 bool
 BitMapMutex::ClearBit(uint64_t bit)
 {
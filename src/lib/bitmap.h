@@ -39,6 +39,11 @@
 
 namespace pos
 {
+// Besides the map, a summary level keeps one bit per map entry that is set
+// while all of the bits in the entry are set. The zero searches skip the full
+// entries 64 at a time through the summary instead of scanning every entry.
+// Writing the map directly through GetMapAddr() invalidates the summary, and it
+// is rebuilt at the next search.
 class BitMap
 {
 public:
@@ -68,8 +73,17 @@ public:
 
 private:
     uint64_t _GetMask(uint64_t numSetBits, uint64_t offset);
+    uint64_t _FindZeroFrom(uint64_t begin);
+    uint64_t _FindNonFullEntry(uint64_t row);
+    void _UpdateSummary(uint64_t row);
+    void _RebuildSummary(void);
+
+    static const uint64_t ALL_BITS_SET = ~0ULL;
 
     uint64_t* map;
+    uint64_t* summary;
+    uint64_t numSummaryEntry;
+    bool summaryValid;
     uint64_t numBits; // The total number of bits set by the Ctor
     uint64_t numEntry;
     uint64_t numBitsSet;
@@ -90,6 +104,7 @@ public:
     uint64_t SetFirstZeroBit(uint64_t begin, uint64_t end);
     virtual uint64_t SetNextZeroBit(void);
     virtual bool SetBit(uint64_t bit);
+    virtual bool TrySetBit(uint64_t bit);
     virtual bool ClearBit(uint64_t bit);
     virtual bool ClearBits(uint64_t begin, uint64_t end);
     virtual void ResetBitmap(void);
@@ -0,0 +1,113 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/lib/block_fingerprint.h"
+
+#include <string.h>
+
+namespace pos
+{
+namespace
+{
+const uint64_t PRIME1 = 0x9E3779B185EBCA87ULL;
+const uint64_t PRIME2 = 0xC2B2AE3D27D4EB4FULL;
+const uint64_t PRIME3 = 0x165667B19E3779F9ULL;
+const uint64_t PRIME4 = 0x85EBCA77C2B2AE63ULL;
+const uint64_t PRIME5 = 0x27D4EB2F165667C5ULL;
+const uint32_t LANE_COUNT = 4;
+
+inline uint64_t
+_Rotate(uint64_t value, uint32_t bits)
+{
+    return (value << bits) | (value >> (64 - bits));
+}
+
+inline uint64_t
+_Round(uint64_t accumulated, uint64_t input)
+{
+    accumulated += input * PRIME2;
+    accumulated = _Rotate(accumulated, 31);
+    return accumulated * PRIME1;
+}
+
+inline uint64_t
+_Avalanche(uint64_t hash)
+{
+    hash ^= hash >> 33;
+    hash *= PRIME2;
+    hash ^= hash >> 29;
+    hash *= PRIME3;
+    hash ^= hash >> 32;
+    return hash;
+}
+} // namespace
+
+BlockFingerprint
+BlockFingerprint::Compute(const void* buffer, uint64_t size)
+{
+    const uint8_t* bytes = static_cast<const uint8_t*>(buffer);
+    uint64_t lanes[LANE_COUNT] = {PRIME1 + PRIME2, PRIME2, 0, 0 - PRIME1};
+
+    uint64_t offset = 0;
+    const uint64_t stripeSize = sizeof(uint64_t) * LANE_COUNT;
+    for (; offset + stripeSize <= size; offset += stripeSize)
+    {
+        uint64_t input[LANE_COUNT];
+        memcpy(input, bytes + offset, stripeSize);
+        for (uint32_t lane = 0; lane < LANE_COUNT; lane++)
+        {
+            lanes[lane] = _Round(lanes[lane], input[lane]);
+        }
+    }
+
+    uint64_t tail = 0;
+    for (uint32_t shift = 0; offset < size; offset++, shift = (shift + 8) % 64)
+    {
+        tail ^= static_cast<uint64_t>(bytes[offset]) << shift;
+    }
+
+    // Both halves are folded from all lanes, each with its own rotations, so
+    // that a collision needs both of them to agree
+    uint64_t low = _Rotate(lanes[0], 1) + _Rotate(lanes[1], 7)
+        + _Rotate(lanes[2], 12) + _Rotate(lanes[3], 18);
+    uint64_t high = _Rotate(lanes[0], 41) ^ _Rotate(lanes[1], 29)
+        ^ _Rotate(lanes[2], 17) ^ _Rotate(lanes[3], 5);
+    low = _Round(low, tail) + size * PRIME5;
+    high = _Round(high ^ PRIME4, tail ^ size);
+
+    BlockFingerprint fingerprint;
+    fingerprint.low = _Avalanche(low);
+    fingerprint.high = _Avalanche(high + fingerprint.low * PRIME3);
+    return fingerprint;
+}
+
+} // namespace pos
@@ -0,0 +1,161 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace pos
+{
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Bounded multi-producer single-consumer ring
+ *           Each cell carries a sequence number, so producers only contend on
+ *           the tail ticket and the consumer never takes a lock.
+ *           Capacity is rounded up to a power of two.
+ */
+/* --------------------------------------------------------------------------*/
+template<typename T>
+class MpscRing
+{
+public:
+    explicit MpscRing(uint32_t capacity)
+    : mask(_RoundUpPowerOfTwo(capacity) - 1),
+      cells(new Cell[mask + 1]),
+      tail(0),
+      head(0)
+    {
+        for (uint64_t index = 0; index <= mask; index++)
+        {
+            cells[index].sequence.store(index, std::memory_order_relaxed);
+        }
+    }
+
+    virtual ~MpscRing(void)
+    {
+        delete[] cells;
+    }
+
+    bool
+    Push(const T& item)
+    {
+        uint64_t pos = tail.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        while (true)
+        {
+            cell = &cells[pos & mask];
+            uint64_t sequence = cell->sequence.load(std::memory_order_acquire);
+            int64_t diff = static_cast<int64_t>(sequence) - static_cast<int64_t>(pos);
+            if (diff == 0)
+            {
+                if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // ring is full
+                return false;
+            }
+            else
+            {
+                pos = tail.load(std::memory_order_relaxed);
+            }
+        }
+        cell->item = item;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Only the owner of the ring may call Pop
+    bool
+    Pop(T& item)
+    {
+        Cell* cell = &cells[head & mask];
+        uint64_t sequence = cell->sequence.load(std::memory_order_acquire);
+        if (static_cast<int64_t>(sequence) - static_cast<int64_t>(head + 1) < 0)
+        {
+            return false;
+        }
+        item = cell->item;
+        cell->item = T();
+        cell->sequence.store(head + mask + 1, std::memory_order_release);
+        head++;
+        return true;
+    }
+
+    uint32_t
+    GetSize(void)
+    {
+        uint64_t currentTail = tail.load(std::memory_order_relaxed);
+        uint64_t currentHead = head;
+        return (currentTail > currentHead) ? static_cast<uint32_t>(currentTail - currentHead) : 0;
+    }
+
+    uint32_t
+    GetCapacity(void)
+    {
+        return static_cast<uint32_t>(mask + 1);
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic<uint64_t> sequence;
+        T item;
+    };
+
+    static uint64_t
+    _RoundUpPowerOfTwo(uint32_t value)
+    {
+        uint64_t result = 1;
+        while (result < value)
+        {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    static const uint32_t CACHE_LINE_SIZE = 64;
+    const uint64_t mask;
+    Cell* cells;
+    // Padded instead of aligned, so that the ring can be allocated by
+    // operator new of c++14, which does not take over-aligned types
+    char tailPadding[CACHE_LINE_SIZE];
+    std::atomic<uint64_t> tail;
+    char headPadding[CACHE_LINE_SIZE - sizeof(std::atomic<uint64_t>)];
+    uint64_t head;
+};
+
+} // namespace pos
@@ -0,0 +1,167 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+
+#include <stdlib.h>
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+
+#include "src/include/branch_prediction.h"
+
+namespace pos
+{
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Per thread shards of counters
+ *           Each writing thread owns a cache-line-aligned Shard of its own,
+ *           allocated at its first write, so that it can update the counters
+ *           with a plain load and store instead of an atomic read-modify-write.
+ *           Threads beyond MAX_WRITERS share one shard, which has to be updated
+ *           atomically. Readers sum the counters over all shards.
+ *           Shard must consist of std::atomic counters only; they start at zero.
+ */
+/* --------------------------------------------------------------------------*/
+template<typename Shard>
+class PerThreadShards
+{
+public:
+    PerThreadShards(void)
+    : sharedShard(_NewShard())
+    {
+        for (uint32_t writer = 0; writer < MAX_WRITERS; writer++)
+        {
+            shards[writer] = nullptr;
+        }
+    }
+
+    virtual ~PerThreadShards(void)
+    {
+        for (uint32_t writer = 0; writer < MAX_WRITERS; writer++)
+        {
+            _DeleteShard(shards[writer].load());
+        }
+        _DeleteShard(sharedShard);
+    }
+
+    // Returns the shard of the calling thread
+    inline Shard*
+    Get(void)
+    {
+        uint32_t writer = GetWriterIndex();
+        if (unlikely(writer >= MAX_WRITERS))
+        {
+            return sharedShard;
+        }
+        Shard* shard = shards[writer].load(std::memory_order_acquire);
+        if (unlikely(shard == nullptr))
+        {
+            // Only the writer of the index allocates its shard
+            shard = _NewShard();
+            shards[writer].store(shard, std::memory_order_release);
+        }
+        return shard;
+    }
+
+    template<typename T>
+    inline void
+    Add(Shard* shard, std::atomic<T>& counter, T delta)
+    {
+        if (likely(shard != sharedShard))
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+        }
+        else
+        {
+            counter.fetch_add(delta, std::memory_order_relaxed);
+        }
+    }
+
+    // Calls visit(const Shard&) for every shard allocated so far
+    template<typename Visitor>
+    void
+    ForEach(Visitor visit) const
+    {
+        for (uint32_t writer = 0; writer < MAX_WRITERS; writer++)
+        {
+            const Shard* shard = shards[writer].load(std::memory_order_acquire);
+            if (shard != nullptr)
+            {
+                visit(*shard);
+            }
+        }
+        visit(*sharedShard);
+    }
+
+    static inline uint32_t
+    GetWriterIndex(void)
+    {
+        // Threads are given an index once, in the order they write first to any shards
+        static std::atomic<uint32_t> numWriters(0);
+        static thread_local uint32_t writerIndex = numWriters.fetch_add(1);
+        return writerIndex;
+    }
+
+    static const uint32_t MAX_WRITERS = 128;
+    static const uint32_t CACHE_LINE_SIZE = 64;
+
+private:
+    static Shard*
+    _NewShard(void)
+    {
+        void* mem = nullptr;
+        if (0 != posix_memalign(&mem, CACHE_LINE_SIZE, sizeof(Shard)))
+        {
+            throw std::bad_alloc();
+        }
+        // value-initialized, so the counters are zero
+        return new (mem) Shard();
+    }
+
+    static void
+    _DeleteShard(Shard* shard)
+    {
+        if (shard != nullptr)
+        {
+            shard->~Shard();
+            free(shard);
+        }
+    }
+
+    std::atomic<Shard*> shards[MAX_WRITERS];
+    Shard* sharedShard;
+};
+
+} // namespace pos
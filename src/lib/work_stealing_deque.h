@@ -0,0 +1,167 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace pos
+{
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Bounded Chase-Lev work stealing deque of pointers
+ *           The owner pushes and pops at the bottom without locking,
+ *           thieves take the oldest entry from the top with a single CAS.
+ *           Capacity is rounded up to a power of two.
+ */
+/* --------------------------------------------------------------------------*/
+template<typename T>
+class WorkStealingDeque
+{
+public:
+    explicit WorkStealingDeque(uint32_t capacity)
+    : mask(_RoundUpPowerOfTwo(capacity) - 1),
+      buffer(new std::atomic<T*>[mask + 1]),
+      top(0),
+      bottom(0)
+    {
+        for (uint64_t index = 0; index <= mask; index++)
+        {
+            buffer[index].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    virtual ~WorkStealingDeque(void)
+    {
+        delete[] buffer;
+    }
+
+    // Owner only
+    bool
+    Push(T* item)
+    {
+        int64_t b = bottom.load(std::memory_order_relaxed);
+        int64_t t = top.load(std::memory_order_acquire);
+        if (b - t > static_cast<int64_t>(mask))
+        {
+            return false;
+        }
+        buffer[b & mask].store(item, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Owner only
+    T*
+    Pop(void)
+    {
+        int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top.load(std::memory_order_relaxed);
+        if (t > b)
+        {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        T* item = buffer[b & mask].load(std::memory_order_relaxed);
+        if (t == b)
+        {
+            // last entry, race against thieves
+            if (false == top.compare_exchange_strong(t, t + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                item = nullptr;
+            }
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    // Any thread
+    T*
+    Steal(void)
+    {
+        int64_t t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t b = bottom.load(std::memory_order_acquire);
+        if (t >= b)
+        {
+            return nullptr;
+        }
+
+        T* item = buffer[t & mask].load(std::memory_order_relaxed);
+        if (false == top.compare_exchange_strong(t, t + 1,
+                std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return nullptr;
+        }
+        return item;
+    }
+
+    uint32_t
+    GetSize(void)
+    {
+        int64_t b = bottom.load(std::memory_order_relaxed);
+        int64_t t = top.load(std::memory_order_relaxed);
+        return (b > t) ? static_cast<uint32_t>(b - t) : 0;
+    }
+
+    uint32_t
+    GetCapacity(void)
+    {
+        return static_cast<uint32_t>(mask + 1);
+    }
+
+private:
+    static uint64_t
+    _RoundUpPowerOfTwo(uint32_t value)
+    {
+        uint64_t result = 1;
+        while (result < value)
+        {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    static const uint32_t CACHE_LINE_SIZE = 64;
+    const uint64_t mask;
+    std::atomic<T*>* buffer;
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> top;
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> bottom;
+};
+
+} // namespace pos
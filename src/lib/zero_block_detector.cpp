@@ -0,0 +1,84 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/lib/zero_block_detector.h"
+
+#include <string.h>
+
+namespace pos
+{
+bool
+ZeroBlockDetector::IsZero(const void* buffer, uint64_t size)
+{
+    const uint8_t* bytes = static_cast<const uint8_t*>(buffer);
+    uint64_t offset = 0;
+
+    // Most non-zero blocks differ in the first word, so they leave at once
+    uint64_t word = 0;
+    if (size >= sizeof(word))
+    {
+        memcpy(&word, bytes, sizeof(word));
+        if (0 != word)
+        {
+            return false;
+        }
+    }
+
+    // Words of a line are or-ed without branching so that the compiler can
+    // turn the loop into vector instructions
+    const uint64_t lineSize = sizeof(uint64_t) * WORDS_PER_LINE;
+    for (; offset + lineSize <= size; offset += lineSize)
+    {
+        uint64_t line[WORDS_PER_LINE];
+        memcpy(line, bytes + offset, lineSize);
+        uint64_t accumulated = 0;
+        for (uint32_t index = 0; index < WORDS_PER_LINE; index++)
+        {
+            accumulated |= line[index];
+        }
+        if (0 != accumulated)
+        {
+            return false;
+        }
+    }
+
+    for (; offset < size; offset++)
+    {
+        if (0 != bytes[offset])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace pos
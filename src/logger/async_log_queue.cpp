@@ -0,0 +1,246 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/logger/async_log_queue.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace pos_logger
+{
+const uint32_t AsyncLogRing::CAPACITY;
+const uint32_t AsyncLogQueue::IDLE_SLEEP_IN_US;
+std::atomic<uint64_t> AsyncLogQueue::nextQueueId(1);
+
+namespace
+{
+// Closes the ring of the thread when the thread exits, so that the
+// background thread can release it once it is drained
+struct ThreadLocalRing
+{
+    ~ThreadLocalRing(void)
+    {
+        if (ring != nullptr)
+        {
+            ring->Close();
+        }
+    }
+
+    uint64_t queueId = 0;
+    std::shared_ptr<AsyncLogRing> ring;
+};
+
+thread_local ThreadLocalRing threadLocalRing;
+} // namespace
+
+AsyncLogRing::AsyncLogRing(void)
+: head(0),
+  tail(0),
+  closed(false)
+{
+}
+
+bool
+AsyncLogRing::Push(AsyncLogRecord* record)
+{
+    uint64_t currentTail = tail.load(std::memory_order_relaxed);
+    if (currentTail - head.load(std::memory_order_acquire) >= CAPACITY)
+    {
+        return false;
+    }
+    records[currentTail % CAPACITY] = record;
+    tail.store(currentTail + 1, std::memory_order_release);
+    return true;
+}
+
+AsyncLogRecord*
+AsyncLogRing::Pop(void)
+{
+    uint64_t currentHead = head.load(std::memory_order_relaxed);
+    if (currentHead == tail.load(std::memory_order_acquire))
+    {
+        return nullptr;
+    }
+    AsyncLogRecord* record = records[currentHead % CAPACITY];
+    head.store(currentHead + 1, std::memory_order_release);
+    return record;
+}
+
+void
+AsyncLogRing::Close(void)
+{
+    closed.store(true, std::memory_order_release);
+}
+
+bool
+AsyncLogRing::IsClosed(void)
+{
+    return closed.load(std::memory_order_acquire);
+}
+
+AsyncLogQueue::AsyncLogQueue(void)
+: queueId(nextQueueId.fetch_add(1)),
+  worker(nullptr),
+  isRunning(false)
+{
+}
+
+AsyncLogQueue::~AsyncLogQueue(void)
+{
+    Stop();
+    // records pushed after Stop() are released without being written
+    for (auto& ring : rings)
+    {
+        AsyncLogRecord* record = nullptr;
+        while ((record = ring->Pop()) != nullptr)
+        {
+            delete record;
+        }
+    }
+}
+
+void
+AsyncLogQueue::Start(Consumer consumer)
+{
+    if (worker != nullptr)
+    {
+        return;
+    }
+    this->consumer = consumer;
+    isRunning = true;
+    worker = new std::thread(&AsyncLogQueue::_Run, this);
+}
+
+void
+AsyncLogQueue::Stop(void)
+{
+    if (worker == nullptr)
+    {
+        return;
+    }
+    isRunning = false;
+    worker->join();
+    delete worker;
+    worker = nullptr;
+    Drain();
+}
+
+bool
+AsyncLogQueue::Push(AsyncLogRecord* record)
+{
+    if (isRunning == false)
+    {
+        return false;
+    }
+    if (threadLocalRing.queueId != queueId)
+    {
+        if (threadLocalRing.ring != nullptr)
+        {
+            threadLocalRing.ring->Close();
+        }
+        threadLocalRing.ring = _RegisterRing();
+        threadLocalRing.queueId = queueId;
+    }
+    return threadLocalRing.ring->Push(record);
+}
+
+std::shared_ptr<AsyncLogRing>
+AsyncLogQueue::_RegisterRing(void)
+{
+    std::shared_ptr<AsyncLogRing> ring = std::make_shared<AsyncLogRing>();
+    std::lock_guard<std::mutex> lock(ringLock);
+    rings.push_back(ring);
+    return ring;
+}
+
+uint32_t
+AsyncLogQueue::Drain(void)
+{
+    std::lock_guard<std::mutex> drain(drainLock);
+    std::vector<std::shared_ptr<AsyncLogRing>> current;
+    {
+        std::lock_guard<std::mutex> lock(ringLock);
+        current = rings;
+    }
+
+    uint32_t count = 0;
+    std::vector<std::shared_ptr<AsyncLogRing>> drainedRings;
+    for (auto& ring : current)
+    {
+        // a ring closed before it is drained gets nothing pushed after the last pop
+        bool isClosed = ring->IsClosed();
+        AsyncLogRecord* record = nullptr;
+        while ((record = ring->Pop()) != nullptr)
+        {
+            if (consumer)
+            {
+                consumer(record);
+            }
+            delete record;
+            count++;
+        }
+        if (isClosed == true)
+        {
+            drainedRings.push_back(ring);
+        }
+    }
+
+    if (drainedRings.empty() == false)
+    {
+        std::lock_guard<std::mutex> lock(ringLock);
+        for (auto& ring : drainedRings)
+        {
+            rings.erase(std::remove(rings.begin(), rings.end(), ring), rings.end());
+        }
+    }
+    return count;
+}
+
+uint32_t
+AsyncLogQueue::GetRingCount(void)
+{
+    std::lock_guard<std::mutex> lock(ringLock);
+    return rings.size();
+}
+
+void
+AsyncLogQueue::_Run(void)
+{
+    while (isRunning == true)
+    {
+        if (Drain() == 0)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(IDLE_SLEEP_IN_US));
+        }
+    }
+}
+} // namespace pos_logger
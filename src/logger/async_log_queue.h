@@ -0,0 +1,209 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "spdlog/spdlog.h"
+
+namespace pos_logger
+{
+// A log call whose message is formatted later by the async logging thread.
+// The arguments are kept by value, so that the calling thread only pays
+// for copying them.
+class AsyncLogRecord
+{
+public:
+    AsyncLogRecord(spdlog::source_loc loc, spdlog::level::level_enum lvl, int eventId)
+    : loc(loc),
+      lvl(lvl),
+      eventId(eventId)
+    {
+    }
+    virtual ~AsyncLogRecord(void) = default;
+    virtual std::string Format(void) = 0;
+
+    spdlog::source_loc loc;
+    spdlog::level::level_enum lvl;
+    int eventId;
+};
+
+// How an argument is kept until it is formatted: strings that are only
+// referenced are copied, and values that cannot be copied (e.g. atomics)
+// are formatted right away.
+template<typename T, bool copyable = std::is_copy_constructible<typename std::decay<T>::type>::value>
+struct AsyncLogArg
+{
+    using type = typename std::decay<T>::type;
+    static type
+    Capture(const T& arg)
+    {
+        return arg;
+    }
+};
+
+template<typename T>
+struct AsyncLogArg<T, false>
+{
+    using type = std::string;
+    static type
+    Capture(const T& arg)
+    {
+        return fmt::format("{}", arg);
+    }
+};
+
+template<>
+struct AsyncLogArg<const char*, true>
+{
+    using type = std::string;
+    static type
+    Capture(const char* arg)
+    {
+        return (arg != nullptr) ? std::string(arg) : std::string("(null)");
+    }
+};
+
+template<>
+struct AsyncLogArg<char*, true> : public AsyncLogArg<const char*, true>
+{
+};
+
+template<>
+struct AsyncLogArg<fmt::string_view, true>
+{
+    using type = std::string;
+    static type
+    Capture(const fmt::string_view& arg)
+    {
+        return std::string(arg.data(), arg.size());
+    }
+};
+
+template<typename... Args>
+class AsyncLogRecordWithArgs : public AsyncLogRecord
+{
+public:
+    AsyncLogRecordWithArgs(spdlog::source_loc loc, spdlog::level::level_enum lvl, int eventId,
+        spdlog::string_view_t fmt, const Args&... args)
+    : AsyncLogRecord(loc, lvl, eventId),
+      format(fmt.data(), fmt.size()),
+      args(AsyncLogArg<typename std::decay<Args>::type>::Capture(args)...)
+    {
+    }
+
+    std::string
+    Format(void) override
+    {
+        return _Format(std::index_sequence_for<Args...>{});
+    }
+
+private:
+    template<size_t... Index>
+    std::string
+    _Format(std::index_sequence<Index...>)
+    {
+        return fmt::format(format, std::get<Index>(args)...);
+    }
+
+    std::string format;
+    std::tuple<typename AsyncLogArg<typename std::decay<Args>::type>::type...> args;
+};
+
+// Single producer, single consumer ring owned by one logging thread
+class AsyncLogRing
+{
+public:
+    static const uint32_t CAPACITY = 4096;
+
+    AsyncLogRing(void);
+    bool Push(AsyncLogRecord* record);
+    AsyncLogRecord* Pop(void);
+    void Close(void);
+    bool IsClosed(void);
+
+private:
+    AsyncLogRecord* records[CAPACITY];
+    std::atomic<uint64_t> head;
+    uint8_t headPadding[56];
+    std::atomic<uint64_t> tail;
+    uint8_t tailPadding[56];
+    std::atomic<bool> closed;
+};
+
+// Hands log records from the logging threads to a background thread that
+// formats and writes them. Every logging thread gets its own ring on its
+// first push, so a push is a couple of relaxed loads and a release store.
+// A push fails when the ring of the thread is full, and the caller is
+// expected to log synchronously instead.
+class AsyncLogQueue
+{
+public:
+    using Consumer = std::function<void(AsyncLogRecord*)>;
+
+    AsyncLogQueue(void);
+    virtual ~AsyncLogQueue(void);
+
+    virtual void Start(Consumer consumer);
+    // Stops the background thread after the pending records are written
+    virtual void Stop(void);
+    virtual bool Push(AsyncLogRecord* record);
+    // Hands every pending record to the consumer; returns how many there were
+    virtual uint32_t Drain(void);
+    uint32_t GetRingCount(void);
+
+private:
+    void _Run(void);
+    std::shared_ptr<AsyncLogRing> _RegisterRing(void);
+
+    static const uint32_t IDLE_SLEEP_IN_US = 1000;
+    static std::atomic<uint64_t> nextQueueId;
+
+    uint64_t queueId;
+    Consumer consumer;
+    std::mutex ringLock;
+    std::mutex drainLock;
+    std::vector<std::shared_ptr<AsyncLogRing>> rings;
+    std::thread* worker;
+    std::atomic<bool> isRunning;
+};
+} // namespace pos_logger
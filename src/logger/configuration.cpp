@@ -103,6 +103,20 @@ Configuration::IsStrLoggingEnabled()
     return ENABLE_STRUCTURED_LOGGING;
 }
 
+bool
+Configuration::IsAsyncLoggingEnabled()
+{
+    int SUCCESS = EID(SUCCESS);
+    bool enable_async_logging = false;
+    int ret = ConfigManagerSingleton::Instance()->GetValue("logger", "enable_async_logging",
+        &enable_async_logging, ConfigType::CONFIG_TYPE_BOOL);
+    if (ret == SUCCESS)
+    {
+        return enable_async_logging;
+    }
+    return ENABLE_ASYNC_LOGGING;
+}
+
 bool
 Configuration::IsBurstFilterEnabled()
 {
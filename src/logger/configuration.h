@@ -47,6 +47,7 @@ public:
     string LogLevel();
     bool IsStrLoggingEnabled();
     bool IsBurstFilterEnabled();
+    bool IsAsyncLoggingEnabled();
     uint32_t GetBurstFilterWindowSize();
 
 private:
@@ -61,5 +62,6 @@ private:
     // TRUE after implementing structured logging functionality.
     const bool ENABLE_STRUCTURED_LOGGING = false;
     const bool ENABLE_BURST_FILTER = false;
+    const bool ENABLE_ASYNC_LOGGING = false;
 };
 } // namespace pos_logger
@@ -116,10 +116,23 @@ Logger::Logger(void)
     logger = std::make_shared<spdlog::logger>("pos_logger", begin(sinks), end(sinks));
     logger->flush_on(spdlog::level::debug);
     SetLevel(preferences.LogLevel());
+
+    if (preferences.IsAsyncLoggingEnabled() == true)
+    {
+        asyncQueue = new pos_logger::AsyncLogQueue();
+        asyncQueue->Start(std::bind(&Logger::_LogRecord, this, std::placeholders::_1));
+    }
 }
 
 Logger::~Logger(void)
 {
+    if (asyncQueue != nullptr)
+    {
+        asyncQueue->Stop();
+        delete asyncQueue;
+        asyncQueue = nullptr;
+    }
+
     for (uint32_t i = 0;
          i < static_cast<uint32_t>(ModuleInDebugLogDump::MAX_SIZE); i++)
     {
@@ -127,6 +140,21 @@ Logger::~Logger(void)
     }
 }
 
+void
+Logger::_LogRecord(pos_logger::AsyncLogRecord* record)
+{
+    std::string currMsg = "";
+    try
+    {
+        currMsg = record->Format();
+    }
+    catch (const std::exception& e)
+    {
+        // Proceed when an exception occurs in fmt::format()
+    }
+    _LogFormatted(record->loc, record->lvl, record->eventId, currMsg);
+}
+
 void
 Logger::ApplyPreference(void)
 {
@@ -42,6 +42,7 @@
 #include <string>
 #include <unordered_map>
 
+#include "async_log_queue.h"
 #include "preferences.h"
 #include "spdlog/spdlog.h"
 #include "src/cli/cli_event_code.h"
@@ -109,53 +110,42 @@ public:
 #ifndef POS_UT_SUPPRESS_LOGMSG
         if (ShouldFilter(lvl, eventId) == false)
         {
-            loggerMtx.lock();
-
-            std::string currMsg = "";
-            try
-            {
-                currMsg = fmt::format(fmt, args...);
-            }
-            catch (const std::exception& e)
-            {
-                // Proceed when an exception occurs in fmt::format()
-            }
+            PoslogUnfiltered(loc, lvl, eventId, fmt, args...);
+        }
+#endif
+    }
 
-            // BurstFilter: we won't log this event when its ID and message are
-            // the same as the previous ones.
-            if (preferences.IsBurstFilterEnabled())
+    // For the callers that have already checked ShouldFilter(), e.g. POS_TRACE_* macros,
+    // which check it before their arguments are evaluated
+    template<typename... Args>
+    void
+    PoslogUnfiltered(spdlog::source_loc loc, spdlog::level::level_enum lvl,
+        int eventId, spdlog::string_view_t fmt, const Args&... args)
+    {
+#ifndef POS_UT_SUPPRESS_LOGMSG
+        // Warnings and errors are written right away so that they are not
+        // left in a ring if the process crashes
+        if (asyncQueue != nullptr && lvl < spdlog::level::warn)
+        {
+            pos_logger::AsyncLogRecord* record =
+                new pos_logger::AsyncLogRecordWithArgs<Args...>(loc, lvl, eventId, fmt, args...);
+            if (asyncQueue->Push(record) == true)
             {
-                if (IsSameLog(eventId, currMsg, prevEventId, prevMsg))
-                {
-                    if (repeatCount >= preferences.GetBurstFilterWindowSize())
-                    {
-                        _Log(loc, lvl, prevEventId, prevMsg, repeatCount);
-                        repeatCount = 0;
-
-                        loggerMtx.unlock();
-                        return;
-                    }
-
-                    repeatCount++;
-
-                    loggerMtx.unlock();
-                    return;
-                }
-
-                if (repeatCount > 0)
-                {
-                    _Log(loc, lvl, prevEventId, prevMsg, repeatCount);
-                    repeatCount = 0;
-                }
-
-                prevEventId = eventId;
-                prevMsg = currMsg;
+                return;
             }
+            delete record;
+        }
 
-            _Log(loc, lvl, eventId, currMsg, 0);
-
-            loggerMtx.unlock();
+        std::string currMsg = "";
+        try
+        {
+            currMsg = fmt::format(fmt, args...);
+        }
+        catch (const std::exception& e)
+        {
+            // Proceed when an exception occurs in fmt::format()
         }
+        _LogFormatted(loc, lvl, eventId, currMsg);
 #endif
     }
 
@@ -236,6 +226,44 @@ private:
         return newMsg;
     }
 
+    void _LogFormatted(spdlog::source_loc loc, spdlog::level::level_enum lvl,
+        int eventId, const std::string& currMsg)
+    {
+        std::lock_guard<mutex> lock(loggerMtx);
+
+        // BurstFilter: we won't log this event when its ID and message are
+        // the same as the previous ones.
+        if (preferences.IsBurstFilterEnabled())
+        {
+            if (IsSameLog(eventId, currMsg, prevEventId, prevMsg))
+            {
+                if (repeatCount >= preferences.GetBurstFilterWindowSize())
+                {
+                    _Log(loc, lvl, prevEventId, prevMsg, repeatCount);
+                    repeatCount = 0;
+                    return;
+                }
+
+                repeatCount++;
+                return;
+            }
+
+            if (repeatCount > 0)
+            {
+                _Log(loc, lvl, prevEventId, prevMsg, repeatCount);
+                repeatCount = 0;
+            }
+
+            prevEventId = eventId;
+            prevMsg = currMsg;
+        }
+
+        _Log(loc, lvl, eventId, currMsg, 0);
+    }
+
+    // Called by the async logging thread
+    void _LogRecord(pos_logger::AsyncLogRecord* record);
+
     void _Log(spdlog::source_loc loc, spdlog::level::level_enum lvl, int eventId,
         std::string msg, int repeatCount)
     {
@@ -296,6 +324,7 @@ private:
     uint32_t repeatCount = 0;
     mutex loggerMtx;
     std::string command = "";
+    pos_logger::AsyncLogQueue* asyncQueue = nullptr;
     // LCOV_EXCL_STOP
 };
 
@@ -357,23 +386,34 @@ reporter()
 #define POS_TRACE_CRITICAL_IN_MEMORY(dumpmodule, eventid, ...) \
     logger()->IboflogWithDump(dumpmodule, spdlog::source_loc{__FILE__, __LINE__, __FUNCTION__}, spdlog::level::critical, static_cast<int>(eventid), __VA_ARGS__)
 
+// The level and the filter are checked before the arguments are evaluated
+#define POS_TRACE_IF_ENABLED(lvl, eventid, ...)                                                   \
+    do                                                                                             \
+    {                                                                                              \
+        if (logger()->ShouldFilter(lvl, static_cast<int>(eventid)) == false)                       \
+        {                                                                                          \
+            logger()->PoslogUnfiltered(spdlog::source_loc{__FILE__, __LINE__, __FUNCTION__}, lvl, \
+                static_cast<int>(eventid), __VA_ARGS__);                                           \
+        }                                                                                          \
+    } while (0)
+
 #define POS_TRACE_DEBUG(eventid, ...) \
-    logger()->Poslog(spdlog::source_loc{__FILE__, __LINE__, __FUNCTION__}, spdlog::level::debug, static_cast<int>(eventid), __VA_ARGS__)
+    POS_TRACE_IF_ENABLED(spdlog::level::debug, eventid, __VA_ARGS__)
 
 #define POS_TRACE_INFO(eventid, ...) \
-    logger()->Poslog(spdlog::source_loc{__FILE__, __LINE__, __FUNCTION__}, spdlog::level::info, static_cast<int>(eventid), __VA_ARGS__)
+    POS_TRACE_IF_ENABLED(spdlog::level::info, eventid, __VA_ARGS__)
 
 #define POS_TRACE_TRACE(eventid, ...) \
-    logger()->Poslog(spdlog::source_loc{__FILE__, __LINE__, __FUNCTION__}, spdlog::level::trace, static_cast<int>(eventid), __VA_ARGS__)
+    POS_TRACE_IF_ENABLED(spdlog::level::trace, eventid, __VA_ARGS__)
 
 #define POS_TRACE_WARN(eventid, ...) \
-    logger()->Poslog(spdlog::source_loc{__FILE__, __LINE__, __FUNCTION__}, spdlog::level::warn, static_cast<int>(eventid), __VA_ARGS__)
+    POS_TRACE_IF_ENABLED(spdlog::level::warn, eventid, __VA_ARGS__)
 
 #define POS_TRACE_ERROR(eventid, ...) \
-    logger()->Poslog(spdlog::source_loc{__FILE__, __LINE__, __FUNCTION__}, spdlog::level::err, static_cast<int>(eventid), __VA_ARGS__)
+    POS_TRACE_IF_ENABLED(spdlog::level::err, eventid, __VA_ARGS__)
 
 #define POS_TRACE_CRITICAL(eventid, ...) \
-    logger()->Poslog(spdlog::source_loc{__FILE__, __LINE__, __FUNCTION__}, spdlog::level::critical, static_cast<int>(eventid), __VA_ARGS__)
+    POS_TRACE_IF_ENABLED(spdlog::level::critical, eventid, __VA_ARGS__)
 
 #define POS_REPORT_TRACE(eventid, ...)                                                                        \
     {                                                                                                         \
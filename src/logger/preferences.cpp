@@ -47,6 +47,7 @@ Preferences::Preferences()
     logLevel = StringToLogLevel(conf.LogLevel());
     EnableStructuredLogging = conf.IsStrLoggingEnabled();
     EnableBurstFilter = conf.IsBurstFilterEnabled();
+    EnableAsyncLogging = conf.IsAsyncLoggingEnabled();
     burstFilterWindowSize = conf.GetBurstFilterWindowSize();
 
     ApplyFilter();
@@ -103,6 +104,7 @@ Preferences::ToJson()
         data.SetAttribute(JsonAttribute("filterExcluded", "\"" + filter.ExcludeRule() + "\""));
     }
     data.SetAttribute(JsonAttribute("structuredLogging", EnableStructuredLogging ? "true" : "false"));
+    data.SetAttribute(JsonAttribute("asyncLogging", EnableAsyncLogging ? "true" : "false"));
 
     return data;
 }
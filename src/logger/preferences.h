@@ -107,6 +107,7 @@ public:
     string LogLevelToString(spdlog::level::level_enum lvl);
     spdlog::level::level_enum StringToLogLevel(string lvl);
     bool IsBurstFilterEnabled() { return EnableBurstFilter; }
+    bool IsAsyncLoggingEnabled() { return EnableAsyncLogging; }
     uint32_t GetBurstFilterWindowSize() { return burstFilterWindowSize; }
     void SetBurstFilterWindowSize(uint32_t size) { burstFilterWindowSize = size; } 
 
@@ -125,6 +126,7 @@ private:
     Filter filter;
     bool EnableStructuredLogging;
     bool EnableBurstFilter;
+    bool EnableAsyncLogging;
     uint32_t burstFilterWindowSize = DEFAULT_BURST_FILTER_WINDOW_SIZE;
 };
 } // namespace pos_logger
@@ -45,8 +45,10 @@
 #include "src/cpu_affinity/affinity_manager.h"
 #include "src/cpu_affinity/affinity_viewer.h"
 #include "src/device/device_manager.h"
+#include "src/dump/dump_shared_ptr.h"
 #include "src/event_scheduler/event.h"
 #include "src/event_scheduler/event_scheduler.h"
+#include "src/event_scheduler/event_scheduler_statistics.h"
 #include "src/event_scheduler/io_completer.h"
 #include "src/event_scheduler/io_timeout_checker.h"
 #include "src/include/pos_event_id.h"
@@ -59,6 +61,7 @@
 #include "src/logger/logger.h"
 #include "src/master_context/config_manager.h"
 #include "src/master_context/version_provider.h"
+#include "src/memory_checker/object_pool.h"
 #include "src/metafs/include/metafs_service.h"
 #include "src/network/nvmf_target.h"
 #include "src/network/transport_configuration.h"
@@ -68,18 +71,23 @@
 #include "src/qos/qos_manager.h"
 #include "src/resource_checker/resource_checker.h"
 #include "src/resource_checker/smart_collector.h"
+#include "src/resource_checker/smart_sampler.h"
 #include "src/signal_handler/signal_handler.h"
 #include "src/signal_handler/user_signal_interface.h"
 #include "src/spdk_wrapper/accel_engine_api.h"
+#include "src/spdk_wrapper/reactor_cycle_accounting.h"
 #include "src/spdk_wrapper/spdk.h"
 #include "src/telemetry/telemetry_air/telemetry_air_delegator.h"
 #include "src/telemetry/telemetry_client/telemetry_client.h"
 #include "src/telemetry/telemetry_client/telemetry_publisher.h"
 #include "src/telemetry/telemetry_client/easy_telemetry_publisher.h"
+#include "src/telemetry/telemetry_client/telemetry_metric_registry.h"
 #include "src/resource_checker/resource_checker.h"
 #include "src/resource_checker/smart_collector.h"
 #include "src/trace/trace_exporter.h"
 #include "src/trace/otlp_factory.h"
+#include "src/trace/io_stage_tracer.h"
+#include "src/trace/flight_recorder.h"
 
 namespace pos
 {
@@ -120,6 +128,8 @@ Poseidonos::Init(int argc, char** argv)
         POS_TRACE_INFO((EID(HA_DEBUG_MSG)), "ReplicatorManager is excluded from POS. Skip initializing Replicator Manager");
 #endif
         _InitTraceExporter(argv[0], pos::ConfigManagerSingleton::Instance(), pos::VersionProviderSingleton::Instance(), pos::TraceExporterSingleton::Instance(new OtlpFactory()));
+        IoStageTracerSingleton::Instance()->Init(ConfigManagerSingleton::Instance(),
+            TraceExporterSingleton::Instance(), EasyTelemetryPublisherSingleton::Instance());
         POS_TRACE_INFO(EID(POS_INITIALIZING_EXPORTER), "");
     }
     else
@@ -171,6 +181,7 @@ Poseidonos::Terminate(void)
     DeviceManagerSingleton::ResetInstance();
     IODispatcherSingleton::ResetInstance();
     EventSchedulerSingleton::ResetInstance();
+    EventSchedulerStatisticsSingleton::ResetInstance();
     QosManagerSingleton::Instance()->FinalizeSpdkManager();
     QosManagerSingleton::ResetInstance();
     FlushCmdManagerSingleton::ResetInstance();
@@ -186,12 +197,14 @@ Poseidonos::Terminate(void)
     AccelEngineApi::Finalize();
     SpdkCallerSingleton::Instance()->SpdkBdevPosUnRegisterPoller(UNVMfCompleteHandler);
     EventFrameworkApiSingleton::ResetInstance();
+    ReactorCycleAccountingSingleton::ResetInstance();
     SpdkSingleton::ResetInstance();
     IoTimeoutCheckerSingleton::ResetInstance();
 
     IoTimeoutCheckerSingleton::ResetInstance();
 
     IoTimeoutCheckerSingleton::ResetInstance();
+    FlightRecorderSingleton::ResetInstance();
 
     air_deactivate();
     POS_TRACE_INFO(EID(AIR_DEACTIVATE_SUCCEED), "");
@@ -217,8 +230,10 @@ Poseidonos::Terminate(void)
     }
     SignalHandlerSingleton::ResetInstance();
     ResourceCheckerSingleton::ResetInstance();
+    SmartSamplerSingleton::ResetInstance();
     SmartCollectorSingleton::ResetInstance();
 
+    IoStageTracerSingleton::ResetInstance();
     TraceExporterSingleton::ResetInstance();
     ConfigManagerSingleton::ResetInstance();
     VersionProviderSingleton::ResetInstance();
@@ -362,9 +377,13 @@ Poseidonos::_SetupThreadModel(void)
     FlushCmdManagerSingleton::Instance();
 
     IoTimeoutCheckerSingleton::Instance()->Initialize();
+    FlightRecorderSingleton::Instance()->Initialize(ConfigManagerSingleton::Instance());
 
     cpu_set_t generalCPUSet = affinityManager->GetCpuSet(CoreType::GENERAL_USAGE);
     EasyTelemetryPublisherSingleton::Instance()->Initialize(ConfigManagerSingleton::Instance(), generalCPUSet);
+    TelemetryMetricRegistrySingleton::Instance()->Initialize(ConfigManagerSingleton::Instance(), generalCPUSet);
+    ReactorCycleAccountingSingleton::Instance()->Initialize(EasyTelemetryPublisherSingleton::Instance());
+    EventSchedulerStatisticsSingleton::Instance()->Initialize(EasyTelemetryPublisherSingleton::Instance());
 }
 
 void
@@ -393,9 +412,24 @@ Poseidonos::_InitMemoryChecker(void)
     }
     else
     {
+        enabled = false;
         MemoryChecker::Enable(false);
         POS_TRACE_WARN(EID(POS_INIT_EXCEPTIONS), "MemoryChecker: Failed to get a value of memory_checker from config.");
     }
+
+    // Objects taken from the pool are out of sight of the memory checker
+    bool poolEnabled = false;
+    ret = configManager.GetValue("performance", "io_object_pool_enable", &poolEnabled,
+        CONFIG_TYPE_BOOL);
+    ObjectPool::Enable(ret == EID(SUCCESS) && poolEnabled == true && enabled == false);
+
+    uint32_t sampleRate = 1;
+    ret = configManager.GetValue(module, "dump_shared_ptr_sample_rate", &sampleRate,
+        CONFIG_TYPE_UINT32);
+    if (ret == EID(SUCCESS))
+    {
+        DumpSharedModuleInstanceEnable::sampleRate = sampleRate;
+    }
 }
 
 void
@@ -404,6 +438,7 @@ Poseidonos::_InitResourceChecker(void)
     ResourceChecker* resourceChecker = ResourceCheckerSingleton::Instance();
     if (nullptr != resourceChecker)
     {
+        SmartSamplerSingleton::Instance()->Start();
         resourceChecker->Enable();
     }
     else
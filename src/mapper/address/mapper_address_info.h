@@ -39,6 +39,8 @@
 
 namespace pos
 {
+class WarmRestartImage;
+
 class MapperAddressInfo
 {
 public:
@@ -60,6 +62,9 @@ public:
     void SetNumWbStripes(uint32_t cnt) { numWbStripes = cnt; }
     void SetMPageSize(uint32_t cnt) { mpageSize = cnt; }
     void SetIsUT(bool ut) { isUT = ut; }
+    // Image the maps of this array are restored from at mount, if any
+    void SetWarmRestartImage(WarmRestartImage* image) { warmRestartImage = image; }
+    WarmRestartImage* GetWarmRestartImage(void) { return warmRestartImage; }
 
 private:
     uint32_t maxVsid;
@@ -68,6 +73,7 @@ private:
     uint32_t mpageSize;
     IArrayInfo* iArrayInfo;
     bool isUT;
+    WarmRestartImage* warmRestartImage = nullptr;
 };
 
 } // namespace pos
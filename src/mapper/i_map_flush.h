@@ -43,7 +43,9 @@ class IMapFlush
 public:
     virtual int FlushDirtyMpages(int mapId, EventSmartPtr callback) = 0;
     virtual int FlushDirtyMpagesGiven(int mapId, EventSmartPtr callback, MpageList dirtyPages) = 0;
+    virtual int FlushDirtyMaps(const MapList& mapIds, EventSmartPtr callback) = 0;
     virtual int StoreAll(void) = 0;
+    virtual uint64_t GetNumDirtyMpages(void) = 0;
 
     static MpageList DEFAULT_DIRTYPAGE_SET;
 };
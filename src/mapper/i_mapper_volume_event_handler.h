@@ -32,8 +32,11 @@
 
 #pragma once
 
+#include <cstdint>
 #include <vector>
 
+#include "src/include/address_type.h"
+
 namespace pos
 {
 class ISegmentCtx;
@@ -44,11 +47,18 @@ public:
     virtual int VolumeCreated(int volId, uint64_t volSizeByte) = 0;
     virtual int VolumeMounted(int volId, uint64_t volSizeByte) = 0;
     virtual int VolumeLoaded(int volId, uint64_t volSizeByte) = 0;
+    virtual int VolumeResized(int volId, uint64_t volSizeByte) = 0;
     virtual int VolumeUnmounted(int volId, bool flushMapRequired) = 0;
     virtual int VolumeDetached(std::vector<int> volList) = 0;
 
     virtual int PrepareVolumeDelete(int volId) = 0;
     virtual int InvalidateAllBlocksTo(int volId, ISegmentCtx* segmentCtx) = 0;
     virtual int DeleteVolumeMap(int volId) = 0;
+
+    // Background delete: the map is detached at delete and reclaimed afterwards
+    virtual int DetachVolumeMap(int volId) = 0;
+    virtual bool CollectDetachedBlocks(int volId, uint64_t& mpageId, uint32_t numMpages, std::vector<VirtualBlks>& validBlks) = 0;
+    virtual int DeleteDetachedMap(int volId) = 0;
+    virtual std::vector<int> GetDetachedVolumes(void) = 0;
 };
 } // namespace pos
@@ -45,6 +45,7 @@ public:
     virtual int Flush(ReverseMapPack* rev, EventSmartPtr cb) = 0;
     virtual ReverseMapPack* AllocReverseMapPack(StripeId vsid, StripeId wblsid) = 0;
     virtual int ReconstructReverseMap(uint32_t volumeId, uint64_t totalRba, uint32_t wblsid, uint32_t vsid, uint64_t blockCount, std::map<uint64_t, BlkAddr> revMapInfos, ReverseMapPack* revMapPack) = 0;
+    virtual bool GetBlockChecksum(StripeId vsid, uint64_t offset, uint32_t& checksum) = 0;
 };
 
 } // namespace pos
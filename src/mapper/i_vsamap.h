@@ -34,6 +34,8 @@
 
 #include "src/mapper/include/mpage_info.h"
 
+#include <vector>
+
 namespace pos
 {
 
@@ -41,11 +43,15 @@ class IVSAMap
 {
 public:
     virtual int GetVSAs(int volumeId, BlkAddr startRba, uint32_t numBlks, VsaArray& vsaArray) = 0;
+    virtual int GetVsaExtents(int volumeId, BlkAddr startRba, uint32_t numBlks, VsaExtentArray& extents, uint32_t& numExtents) = 0;
     virtual int SetVSAs(int volumeId, BlkAddr startRba, VirtualBlks& virtualBlks) = 0;
     virtual VirtualBlkAddr GetVSAInternal(int volumeId, BlkAddr rba, int& caller) = 0;
     virtual int SetVSAsInternal(int volumeId, BlkAddr startRba, VirtualBlks& virtualBlks) = 0;
     virtual VirtualBlkAddr GetVSAWithSyncOpen(int volumeId, BlkAddr rba) = 0;
     virtual int SetVSAsWithSyncOpen(int volumeId, BlkAddr startRba, VirtualBlks& virtualBlks) = 0;
+    // The blocks the range was mapped to are appended to oldBlks for the caller to invalidate
+    virtual int UnmapVSAs(int volumeId, BlkAddr startRba, uint64_t numBlks, std::vector<VirtualBlks>& oldBlks) = 0;
+    virtual int UnmapVSAsWithSyncOpen(int volumeId, BlkAddr startRba, uint64_t numBlks, std::vector<VirtualBlks>& oldBlks) = 0;
     virtual VirtualBlkAddr GetRandomVSA(BlkAddr rba) = 0;   // will be deprecated
 
     virtual MpageList GetDirtyVsaMapPages(int volumeId, BlkAddr startRba, uint64_t numBlks) = 0;
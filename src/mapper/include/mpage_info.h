@@ -46,5 +46,18 @@ using MpageList = std::unordered_set<MpageNum>;
 using MapPageList = std::map<int, MpageList>; // K: mapId
 using MapList = std::unordered_set<uint32_t>;
 using VsaArray = std::array<VirtualBlkAddr, MAX_PROCESSABLE_BLOCK_COUNT>;
+using VsaExtentArray = std::array<VirtualBlks, MAX_PROCESSABLE_BLOCK_COUNT>;
+
+// An extent is extended by the VSA right after its last block in the same stripe.
+// Unmapped blocks only extend an unmapped extent
+inline bool
+IsVsaExtendedBy(const VirtualBlks& extent, const VirtualBlkAddr& vsa)
+{
+    if (IsUnMapVsa(extent.startVsa) == true)
+    {
+        return IsUnMapVsa(vsa);
+    }
+    return ((vsa.stripeId == extent.startVsa.stripeId) && (vsa.offset == extent.startVsa.offset + extent.numBlks));
+}
 
 } // namespace pos
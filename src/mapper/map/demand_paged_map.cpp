@@ -0,0 +1,243 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/mapper/map/demand_paged_map.h"
+
+#include <string.h>
+#include <cassert>
+#include <chrono>
+
+#include "src/mapper/map/mpage_cache.h"
+
+namespace pos
+{
+DemandPagedMap::DemandPagedMap(uint64_t numMpages, uint64_t mpageSize, MpageCache* cache)
+: Map(),
+  cache(cache),
+  codec(nullptr)
+{
+    mPageArr = new Mpage[numMpages]();
+    for (uint64_t mpage = 0; mpage < numMpages; ++mpage)
+    {
+        mPageArr[mpage].mpageNr = mpage;
+    }
+    pageState = new std::atomic<uint8_t>[numMpages]();
+    encodedPages = new std::vector<uint8_t>*[numMpages]();
+
+    pageSize = mpageSize;
+    numPages = numMpages;
+}
+// LCOV_EXCL_START
+DemandPagedMap::~DemandPagedMap(void)
+{
+    cache->FreeAll(this);
+    for (uint64_t pageNr = 0; pageNr < numPages; ++pageNr)
+    {
+        _ReleaseEncoded(pageNr);
+    }
+    delete[] encodedPages;
+    encodedPages = nullptr;
+    delete[] pageState;
+    pageState = nullptr;
+}
+// LCOV_EXCL_STOP
+char*
+DemandPagedMap::GetMpage(uint64_t pageNr)
+{
+    if (pageNr >= numPages)
+    {
+        return nullptr;
+    }
+    char* mpage = mPageArr[pageNr].data;
+    if (mpage != nullptr)
+    {
+        pageState[pageNr].fetch_or(MPAGE_REFERENCED);
+    }
+    return mpage;
+}
+
+char*
+DemandPagedMap::AllocateMpage(uint64_t pageNr)
+{
+    assert(pageNr < numPages);
+    if (mPageArr[pageNr].data != nullptr)
+    {
+        POS_TRACE_ERROR(EID(MPAGE_ALREADY_EXIST),
+            "mpage exists but tried to allocate, pageNr:{} Mpage.data:{}", pageNr,
+            *((uint32_t*)mPageArr[pageNr].data));
+        return nullptr;
+    }
+
+    char* mpage = cache->Allocate(this, pageNr);
+    if (mpage == nullptr)
+    {
+        return nullptr;
+    }
+    memset(mpage, 0xFF, pageSize);
+    pageState[pageNr] = MPAGE_REFERENCED;
+    mPageArr[pageNr].data = mpage;
+
+    return mpage;
+}
+
+bool
+DemandPagedMap::IsDemandPaged(void)
+{
+    return true;
+}
+
+void
+DemandPagedMap::MarkMpageDirty(uint64_t pageNr)
+{
+    pageState[pageNr].fetch_or(MPAGE_DIRTY | MPAGE_REFERENCED);
+}
+
+void
+DemandPagedMap::StartMpageFlush(uint64_t pageNr)
+{
+    // set FLUSHING before clearing DIRTY so that the page is never seen unpinned
+    pageState[pageNr].fetch_or(MPAGE_FLUSHING);
+    pageState[pageNr].fetch_and(static_cast<uint8_t>(~MPAGE_DIRTY));
+}
+
+void
+DemandPagedMap::EndMpageFlush(uint64_t pageNr)
+{
+    pageState[pageNr].fetch_and(static_cast<uint8_t>(~MPAGE_FLUSHING));
+}
+
+void
+DemandPagedMap::DropMpage(uint64_t pageNr)
+{
+    if (mPageArr[pageNr].data != nullptr)
+    {
+        cache->Free(this, pageNr);
+        mPageArr[pageNr].data = nullptr;
+    }
+    _ReleaseEncoded(pageNr);
+    pageState[pageNr] = 0;
+}
+
+char*
+DemandPagedMap::RestoreMpage(uint64_t pageNr)
+{
+    if ((pageNr >= numPages) || (encodedPages[pageNr] == nullptr) || (mPageArr[pageNr].data != nullptr))
+    {
+        return nullptr;
+    }
+
+    char* mpage = cache->Allocate(this, pageNr);
+    if (mpage == nullptr)
+    {
+        return nullptr;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    codec->Decode(*encodedPages[pageNr], mpage, pageSize);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    cache->RecordDecode(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+
+    // the page can be modified from now on, so the encoded copy is stale
+    _ReleaseEncoded(pageNr);
+    pageState[pageNr] = MPAGE_REFERENCED;
+    mPageArr[pageNr].data = mpage;
+
+    return mpage;
+}
+
+void
+DemandPagedMap::SetCodec(IMpageCodec* codec_)
+{
+    codec = codec_;
+}
+
+bool
+DemandPagedMap::TryEvict(uint64_t pageNr)
+{
+    if (mPageArr[pageNr].lock.try_lock() == false)
+    {
+        return false;
+    }
+
+    bool evicted = false;
+    uint8_t state = pageState[pageNr];
+    if ((state & MPAGE_REFERENCED) != 0)
+    {
+        pageState[pageNr].fetch_and(static_cast<uint8_t>(~MPAGE_REFERENCED));
+    }
+    else if (((state & (MPAGE_DIRTY | MPAGE_FLUSHING)) == 0) && (mPageArr[pageNr].data != nullptr))
+    {
+        // the frame is reused right after this, so optimistic readers must see a new sequence
+        _Encode(pageNr);
+        BeginMpageUpdate(pageNr);
+        mPageArr[pageNr].data = nullptr;
+        EndMpageUpdate(pageNr);
+        evicted = true;
+    }
+
+    mPageArr[pageNr].lock.unlock();
+    return evicted;
+}
+
+void
+DemandPagedMap::_Encode(uint64_t pageNr)
+{
+    if ((codec == nullptr) || (cache->IsEncodingEnabled() == false))
+    {
+        return;
+    }
+
+    _ReleaseEncoded(pageNr);
+    std::vector<uint8_t>* encoded = new std::vector<uint8_t>();
+    if ((codec->Encode(mPageArr[pageNr].data, pageSize, *encoded) == true) && (cache->ReserveEncoded(encoded->size()) == true))
+    {
+        encoded->shrink_to_fit();
+        encodedPages[pageNr] = encoded;
+    }
+    else
+    {
+        delete encoded;
+    }
+}
+
+void
+DemandPagedMap::_ReleaseEncoded(uint64_t pageNr)
+{
+    if (encodedPages[pageNr] != nullptr)
+    {
+        cache->ReleaseEncoded(encodedPages[pageNr]->size());
+        delete encodedPages[pageNr];
+        encodedPages[pageNr] = nullptr;
+    }
+}
+
+} // namespace pos
@@ -0,0 +1,85 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "src/mapper/map/i_mpage_codec.h"
+#include "src/mapper/map/map.h"
+
+namespace pos
+{
+class MpageCache;
+
+// Map whose mpages live in frames of a shared MpageCache instead of one memPool.
+// Pages are faulted in by the owner (MapContent) under the mpage lock. Dirty pages,
+// and pages whose flush is still in flight, are never handed back to the cache.
+// With a codec set, a clean page being evicted is kept encoded while the encoded
+// budget of the cache allows, and RestoreMpage() brings it back without any I/O.
+class DemandPagedMap : public Map
+{
+public:
+    DemandPagedMap(uint64_t numPages, uint64_t pageSize, MpageCache* cache);
+    virtual ~DemandPagedMap(void);
+
+    virtual char* GetMpage(uint64_t pageNr) override;
+    virtual char* AllocateMpage(uint64_t pageNr) override;
+
+    virtual bool IsDemandPaged(void) override;
+    virtual void MarkMpageDirty(uint64_t pageNr) override;
+    virtual void StartMpageFlush(uint64_t pageNr) override;
+    virtual void EndMpageFlush(uint64_t pageNr) override;
+    virtual void DropMpage(uint64_t pageNr) override;
+    virtual char* RestoreMpage(uint64_t pageNr) override;
+
+    virtual void SetCodec(IMpageCodec* codec);
+
+    virtual bool TryEvict(uint64_t pageNr);
+
+    static const uint8_t MPAGE_REFERENCED = 1 << 0;
+    static const uint8_t MPAGE_DIRTY = 1 << 1;
+    static const uint8_t MPAGE_FLUSHING = 1 << 2;
+
+private:
+    void _Encode(uint64_t pageNr);
+    void _ReleaseEncoded(uint64_t pageNr);
+
+    MpageCache* cache;
+    std::atomic<uint8_t>* pageState;
+    IMpageCodec* codec;
+    std::vector<uint8_t>** encodedPages;
+};
+
+} // namespace pos
@@ -38,12 +38,22 @@ namespace pos
 {
 EventMpageAsyncIo::EventMpageAsyncIo(MapHeader* mapHeader_, Map* map_,
     MetaFileIntf* file_, FnCompleteMetaFileIo asyncIoReqCB_)
+: EventMpageAsyncIo(mapHeader_, map_, file_, asyncIoReqCB_, nullptr, 0)
+{
+}
+
+EventMpageAsyncIo::EventMpageAsyncIo(MapHeader* mapHeader_, Map* map_,
+    MetaFileIntf* file_, FnCompleteMetaFileIo asyncIoReqCB_,
+    std::atomic<int>* numLoadsInFlight_, int queueDepth_)
+: mapHeader(mapHeader_),
+  map(map_),
+  file(file_),
+  asyncIoReqCB(asyncIoReqCB_),
+  numLoadsInFlight(numLoadsInFlight_),
+  queueDepth(queueDepth_),
+  sequentialPages(nullptr),
+  pendingSet({.startMpage = 0, .numMpages = 0})
 {
-    mapHeader = mapHeader_;
-    map = map_;
-    file = file_;
-    asyncIoReqCB = asyncIoReqCB_;
-    startMpage = 0;
 }
 
 // LCOV_EXCL_START
@@ -55,35 +65,102 @@ EventMpageAsyncIo::~EventMpageAsyncIo(void)
 bool
 EventMpageAsyncIo::Execute(void)
 {
-    int mpageNum = startMpage;
-    uint64_t numBitsSet = mapHeader->GetMpageMap()->GetNumBitsSet();
+    if (sequentialPages == nullptr)
+    {
+        sequentialPages = std::make_unique<SequentialPageFinder>(mapHeader->GetMpageMap());
+    }
+
+    while ((pendingSet.numMpages != 0) || (sequentialPages->IsRemaining() == true))
+    {
+        if (_IsQueueFull() == true)
+        {
+            return false;
+        }
+
+        if (pendingSet.numMpages == 0)
+        {
+            pendingSet = sequentialPages->PopNextMpageSet();
+        }
+
+        if (_IssueLoad(pendingSet) == false)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool
+EventMpageAsyncIo::_IsQueueFull(void)
+{
+    return ((numLoadsInFlight != nullptr) && (queueDepth > 0) && (*numLoadsInFlight >= queueDepth));
+}
 
-    for (uint32_t cnt = startMpage; cnt < numBitsSet; ++cnt)
+// Issues one read for the longest run at the head of mpageSet whose mpages are
+// contiguous in memory, and trims that run off mpageSet
+bool
+EventMpageAsyncIo::_IssueLoad(MpageSet& mpageSet)
+{
+    uint64_t pageSize = map->GetSize();
+    char* buffer = _GetOrAllocateMpage(mpageSet.startMpage);
+    if (buffer == nullptr)
     {
-        mpageNum = mapHeader->GetMpageMap()->FindFirstSet(mpageNum);
-        char* mpage = map->AllocateMpage(mpageNum);
+        POS_TRACE_ERROR(EID(MAPPER_FAILED), "[Mapper AsyncLoad] Failed to allocate mpage, retry.. mpageNum:{}", mpageSet.startMpage);
+        return false;
+    }
+
+    int numMpages = 1;
+    while (numMpages < mpageSet.numMpages)
+    {
+        char* mpage = _GetOrAllocateMpage(mpageSet.startMpage + numMpages);
+        if (mpage != buffer + pageSize * numMpages)
+        {
+            break;
+        }
+        numMpages++;
+    }
 
-        MapFlushIoContext* mPageLoadRequest = new MapFlushIoContext(mpageNum, 1);
+    MapFlushIoContext* mPageLoadRequest = new MapFlushIoContext(mpageSet.startMpage, numMpages);
 
-        uint64_t fileOffset = mapHeader->GetSize() + (mpageNum * map->GetSize());
-        uint64_t length = map->GetSize();
+    uint64_t fileOffset = mapHeader->GetSize() + (mpageSet.startMpage * pageSize);
+    uint64_t length = pageSize * numMpages;
 
-        mPageLoadRequest->SetIoInfo(MetaFsIoOpcode::Read, fileOffset, length, mpage);
-        mPageLoadRequest->SetFileInfo(file->GetFd(), file->GetIoDoneCheckFunc());
-        mPageLoadRequest->SetCallback(asyncIoReqCB);
+    mPageLoadRequest->SetIoInfo(MetaFsIoOpcode::Read, fileOffset, length, buffer);
+    mPageLoadRequest->SetFileInfo(file->GetFd(), file->GetIoDoneCheckFunc());
+    mPageLoadRequest->SetCallback(asyncIoReqCB);
 
-        if (file->AsyncIO(mPageLoadRequest) < 0) // MFS_FAILED_DUE_TO_ERR
+    if (numLoadsInFlight != nullptr)
+    {
+        (*numLoadsInFlight)++;
+    }
+    if (file->AsyncIO(mPageLoadRequest) < 0) // MFS_FAILED_DUE_TO_ERR
+    {
+        POS_TRACE_ERROR(EID(MAPPER_FAILED), "[Mapper AsyncLoad] Failed to Issue AsyncLoad, retry.. mpageNum:{} numMpages:{}",
+            mpageSet.startMpage, numMpages);
+        POS_TRACE_ERROR(EID(MAPPER_FAILED), mPageLoadRequest->ToString());
+        if (numLoadsInFlight != nullptr)
         {
-            POS_TRACE_ERROR(EID(MAPPER_FAILED), "[Mapper AsyncLoad] Failed to Issue AsyncLoad, retry.. mpageNum:{}", mpageNum);
-            POS_TRACE_ERROR(EID(MAPPER_FAILED), mPageLoadRequest->ToString());
-            startMpage = mpageNum;
-            return false;
+            (*numLoadsInFlight)--;
         }
-        mpageNum++;
+        return false;
     }
 
+    mpageSet.startMpage += numMpages;
+    mpageSet.numMpages -= numMpages;
     return true;
 }
 
-} // namespace pos
+char*
+EventMpageAsyncIo::_GetOrAllocateMpage(MpageNum pageNr)
+{
+    // an mpage allocated by an earlier, failed attempt is reused as is
+    char* mpage = map->GetMpage(pageNr);
+    if (mpage == nullptr)
+    {
+        mpage = map->AllocateMpage(pageNr);
+    }
+    return mpage;
+}
 
+} // namespace pos
@@ -32,28 +32,43 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
+
 #include "src/event_scheduler/event.h"
 #include "src/mapper/map/map.h"
 #include "src/mapper/map/map_header.h"
+#include "src/mapper/map/sequential_page_finder.h"
 #include "src/meta_file_intf/async_context.h"
 #include "src/meta_file_intf/meta_file_intf.h"
 
 namespace pos
 {
+// Loads every valid mpage of a map. Runs of sequential mpages are read with a single
+// request, and at most queueDepth requests are kept in flight when numLoadsInFlight is
+// given (the completion callback is expected to decrement it)
 class EventMpageAsyncIo : public Event
 {
 public:
     EventMpageAsyncIo(MapHeader* mapHeader, Map* map, MetaFileIntf* file, FnCompleteMetaFileIo asyncIoReqCB);
+    EventMpageAsyncIo(MapHeader* mapHeader, Map* map, MetaFileIntf* file, FnCompleteMetaFileIo asyncIoReqCB,
+        std::atomic<int>* numLoadsInFlight, int queueDepth);
     virtual ~EventMpageAsyncIo(void);
     bool Execute(void) override;
 
 private:
+    bool _IsQueueFull(void);
+    bool _IssueLoad(MpageSet& mpageSet);
+    char* _GetOrAllocateMpage(MpageNum pageNr);
+
     MapHeader* mapHeader;
     Map* map;
     MetaFileIntf* file;
     FnCompleteMetaFileIo asyncIoReqCB;
-    int startMpage;
+    std::atomic<int>* numLoadsInFlight;
+    int queueDepth;
+    std::unique_ptr<SequentialPageFinder> sequentialPages;
+    MpageSet pendingSet;
 };
 
 } // namespace pos
-
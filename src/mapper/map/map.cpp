@@ -33,6 +33,11 @@
 #include "src/include/memory.h"
 #include "src/mapper/map/map.h"
 
+#include <cstring>
+#include <thread>
+
+#include "src/include/branch_prediction.h"
+
 namespace pos
 {
 Map::Map(void)
@@ -109,6 +114,84 @@ Map::ReleaseMpageLock(uint64_t pageNr)
     mPageArr[pageNr].lock.unlock();
 }
 
+uint32_t
+Map::GetMpageSeq(uint64_t pageNr)
+{
+    return mPageArr[pageNr].seq.load(std::memory_order_acquire);
+}
+
+bool
+Map::IsMpageSeqChanged(uint64_t pageNr, uint32_t seq)
+{
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return mPageArr[pageNr].seq.load(std::memory_order_relaxed) != seq;
+}
+
+void
+Map::BeginMpageUpdate(uint64_t pageNr)
+{
+    if (unlikely(mPageArr[pageNr].cowState.load(std::memory_order_acquire) != MPAGE_COW_NONE))
+    {
+        _CopyOnWrite(pageNr);
+    }
+    mPageArr[pageNr].seq.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+void
+Map::EndMpageUpdate(uint64_t pageNr)
+{
+    mPageArr[pageNr].seq.fetch_add(1, std::memory_order_release);
+}
+
+void
+Map::FreezeMpage(uint64_t pageNr, char* dest)
+{
+    mPageArr[pageNr].cowBuffer = dest;
+    mPageArr[pageNr].cowState.store(MPAGE_COW_FROZEN, std::memory_order_release);
+}
+
+void
+Map::CopyFrozenMpage(uint64_t pageNr)
+{
+    Mpage& mpage = mPageArr[pageNr];
+    uint8_t expected = MPAGE_COW_FROZEN;
+    if (mpage.cowState.compare_exchange_strong(expected, MPAGE_COW_COPYING, std::memory_order_acq_rel))
+    {
+        memcpy(mpage.cowBuffer, mpage.data, pageSize);
+    }
+    else
+    {
+        // a writer is copying, or has copied, the frozen image
+        while (mpage.cowState.load(std::memory_order_acquire) == MPAGE_COW_COPYING)
+        {
+            std::this_thread::yield();
+        }
+    }
+    mpage.cowBuffer = nullptr;
+    mpage.cowState.store(MPAGE_COW_NONE, std::memory_order_release);
+}
+
+// Called by a writer holding the mpage lock, before it changes a frozen page
+void
+Map::_CopyOnWrite(uint64_t pageNr)
+{
+    Mpage& mpage = mPageArr[pageNr];
+    uint8_t expected = MPAGE_COW_FROZEN;
+    if (mpage.cowState.compare_exchange_strong(expected, MPAGE_COW_COPYING, std::memory_order_acq_rel))
+    {
+        memcpy(mpage.cowBuffer, mpage.data, pageSize);
+        mpage.cowState.store(MPAGE_COW_COPIED, std::memory_order_release);
+        return;
+    }
+
+    // the flush is copying the frozen image right now
+    while (mpage.cowState.load(std::memory_order_acquire) == MPAGE_COW_COPYING)
+    {
+        std::this_thread::yield();
+    }
+}
+
 char*
 Map::GetMpage(uint64_t pageNr)
 {
@@ -130,6 +213,41 @@ Map::GetMpageWithLock(uint64_t pageNr)
     return mPageArr[pageNr].data;
 }
 
+bool
+Map::IsDemandPaged(void)
+{
+    return false;
+}
+
+void
+Map::MarkMpageDirty(uint64_t pageNr)
+{
+}
+
+void
+Map::StartMpageFlush(uint64_t pageNr)
+{
+}
+
+void
+Map::EndMpageFlush(uint64_t pageNr)
+{
+}
+
+void
+Map::DropMpage(uint64_t pageNr)
+{
+    // the slice of memPool is left as it is, so a lock-free reader that raced with
+    // the drop still reads unmapped entries out of it
+    mPageArr[pageNr].data = nullptr;
+}
+
+char*
+Map::RestoreMpage(uint64_t pageNr)
+{
+    return nullptr;
+}
+
 uint64_t
 Map::GetSize(void)
 {
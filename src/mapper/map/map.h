@@ -36,21 +36,35 @@
 #include "src/lib/bitmap.h"
 #include "src/logger/logger.h"
 
+#include <atomic>
+#include <mutex>
 #include <vector>
 
 namespace pos
 {
+enum MpageCowState : uint8_t
+{
+    MPAGE_COW_NONE = 0,
+    MPAGE_COW_FROZEN,
+    MPAGE_COW_COPYING,
+    MPAGE_COW_COPIED
+};
 
 class Mpage
 {
 public:
-    Mpage(void) : data(nullptr), mpageNr(-1)
+    Mpage(void) : data(nullptr), mpageNr(-1), seq(0), cowState(MPAGE_COW_NONE), cowBuffer(nullptr)
     {
     }
 
     char* data;
     int mpageNr;
     std::mutex lock;
+    // odd while a writer holding the lock is updating the page (seqlock)
+    std::atomic<uint32_t> seq;
+    // where the image of a page frozen for a flush has to be copied to
+    std::atomic<uint8_t> cowState;
+    char* cowBuffer;
 };
 
 class Map
@@ -69,10 +83,35 @@ public:
     virtual void GetMpageLock(uint64_t pageNr);
     virtual void ReleaseMpageLock(uint64_t pageNr);
 
+    // Optimistic read: take GetMpageSeq() before reading, retry if it was odd or IsMpageSeqChanged()
+    virtual uint32_t GetMpageSeq(uint64_t pageNr);
+    virtual bool IsMpageSeqChanged(uint64_t pageNr, uint32_t seq);
+    // Writers bracket their update with these while holding the mpage lock
+    virtual void BeginMpageUpdate(uint64_t pageNr);
+    virtual void EndMpageUpdate(uint64_t pageNr);
+
+    // Copy-on-write flush: FreezeMpage() is called under the mpage lock and only records
+    // the flush buffer. The next writer or CopyFrozenMpage(), whichever comes first,
+    // copies the page there, so a flush writes the image as of freezing without
+    // holding the lock for the copy
+    virtual void FreezeMpage(uint64_t pageNr, char* dest);
+    virtual void CopyFrozenMpage(uint64_t pageNr);
+
+    // Residency hooks for demand-paged maps; mostly no-ops for a fully loaded map
+    virtual bool IsDemandPaged(void);
+    virtual void MarkMpageDirty(uint64_t pageNr);
+    virtual void StartMpageFlush(uint64_t pageNr);
+    virtual void EndMpageFlush(uint64_t pageNr);
+    virtual void DropMpage(uint64_t pageNr);
+    virtual char* RestoreMpage(uint64_t pageNr);
+
     char* memPool;
     Mpage* mPageArr;
     uint64_t pageSize;
     uint64_t numPages;
+
+private:
+    void _CopyOnWrite(uint64_t pageNr);
 };
 
 } // namespace pos
@@ -34,6 +34,7 @@
 #include "src/metafs/include/metafs_service.h"
 #include "src/mapper/map/map_content.h"
 #include "src/mapper/map/map_io_handler.h"
+#include "src/mapper/map/warm_restart_image.h"
 #include "src/meta_file_intf/mock_file_intf.h"
 #include "src/event_scheduler/event_scheduler.h"
 
@@ -196,10 +197,42 @@ MapContent::DumpLoad(std::string fname)
     return ret;
 }
 
+// Returns the mpage, faulting it in for a demand-paged map. Caller must hold the mpage lock
+char*
+MapContent::_GetResidentMpage(uint64_t pageNr)
+{
+    char* mpage = map->GetMpage(pageNr);
+    if ((mpage == nullptr) && (map->IsDemandPaged() == true) && (mapHeader->GetMpageMap()->IsSetBit(pageNr) == true))
+    {
+        mpage = mapIoHandler->LoadMpage(pageNr);
+    }
+    return mpage;
+}
+
+void
+MapContent::AddToWarmRestartImage(WarmRestartImage* image)
+{
+    // A demand-paged map only loads its header at mount, there is nothing to restore
+    if ((isInitialized == true) && (map->IsDemandPaged() == false))
+    {
+        image->AddMap(mapId, mapHeader, map);
+    }
+}
+
 uint64_t
 MapContent::GetEntriesPerPage(void)
 {
     return entriesPerMpage;
 }
 
+uint64_t
+MapContent::GetNumDirtyPages(void)
+{
+    if (mapHeader == nullptr)
+    {
+        return 0;
+    }
+    return mapHeader->GetNumTouchedMpagesSet();
+}
+
 } // namespace pos
@@ -48,6 +48,7 @@ const int CREATE_FILE_IF_NOT_EXIST = 1;
 using AsyncLoadCallBack = std::function<void(int)>;
 
 class MapIoHandler;
+class WarmRestartImage;
 
 class MapContent
 {
@@ -74,8 +75,12 @@ public:
     virtual int DumpLoad(std::string fileName);
 
     virtual uint64_t GetEntriesPerPage(void);
+    virtual uint64_t GetNumDirtyPages(void);
+    virtual void AddToWarmRestartImage(WarmRestartImage* image);
 
 protected:
+    char* _GetResidentMpage(uint64_t pageNr);
+
     MapHeader* mapHeader;
     Map* map;
     MapIoHandler* mapIoHandler;
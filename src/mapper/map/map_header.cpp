@@ -38,7 +38,7 @@
 namespace pos
 {
 
-MapHeader::MapHeader(BitMap* mPageMap_, BitMap* touchedMpages_, int mapId_)
+MapHeader::MapHeader(BitMap* mPageMap_, AtomicBitMap* touchedMpages_, int mapId_)
 : age(0),
   size(0),
   numUsedBlks(0),
@@ -72,8 +72,7 @@ MapHeader::Init(uint64_t numMpages, uint64_t mpageSize)
 {
     mPageMap = new BitMap(numMpages);
     mPageMap->ResetBitmap();
-    touchedMpages = new BitMap(numMpages);
-    touchedMpages->ResetBitmap();
+    touchedMpages = new AtomicBitMap(numMpages);
 
     size = sizeof(MpageInfo) + (mPageMap->GetNumEntry() * BITMAP_ENTRY_SIZE);
     size = Align(size, mpageSize);
@@ -124,6 +123,27 @@ MapHeader::SetMapAllocated(int pageNr)
     mPageMap->SetBit(pageNr);
 }
 
+void
+MapHeader::SetMapUnallocated(int pageNr)
+{
+    std::unique_lock<std::mutex> lock(mpageHeaderLock);
+    mPageMap->ClearBit(pageNr);
+}
+
+// Clears an mpage from a header image taken by CopyToBuffer() that is yet to be flushed
+void
+MapHeader::ClearMapAllocatedInBuffer(char* buffer, int pageNr)
+{
+    MpageInfo* header = reinterpret_cast<MpageInfo*>(buffer);
+    uint64_t* bitmap = reinterpret_cast<uint64_t*>(buffer + sizeof(MpageInfo));
+    uint64_t mask = 1ULL << (pageNr % BITMAP_ENTRY_BITS);
+    if ((bitmap[pageNr / BITMAP_ENTRY_BITS] & mask) != 0)
+    {
+        bitmap[pageNr / BITMAP_ENTRY_BITS] &= ~mask;
+        header->numValidMpages--;
+    }
+}
+
 void
 MapHeader::UpdateNumUsedBlks(VirtualBlkAddr oldVsa)
 {
@@ -133,6 +153,21 @@ MapHeader::UpdateNumUsedBlks(VirtualBlkAddr oldVsa)
     }
 }
 
+void
+MapHeader::ReleaseNumUsedBlks(VirtualBlkAddr oldVsa)
+{
+    if (IsUnMapVsa(oldVsa) == false)
+    {
+        numUsedBlks--;
+    }
+}
+
+void
+MapHeader::DecreaseNumUsedBlks(uint64_t numBlks)
+{
+    numUsedBlks -= numBlks;
+}
+
 uint32_t
 MapHeader::GetNumTouchedMpagesSet(void)
 {
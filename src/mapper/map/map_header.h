@@ -33,6 +33,7 @@
 #pragma once
 
 #include "src/include/address_type.h"
+#include "src/lib/atomic_bitmap.h"
 #include "src/lib/bitmap.h"
 
 #include <atomic>
@@ -54,7 +55,7 @@ class MapHeader
 {
 public:
     explicit MapHeader(int mapId);
-    MapHeader(BitMap* mPageMap_, BitMap* touchedMpages_, int mapId_);
+    MapHeader(BitMap* mPageMap_, AtomicBitMap* touchedMpages_, int mapId_);
     virtual ~MapHeader(void);
     virtual void Init(uint64_t numMpages, uint64_t mpageSize);
 
@@ -67,12 +68,17 @@ public:
 
     virtual BitMap* GetMpageMap(void) { return mPageMap; }
     virtual void SetMapAllocated(int pageNr);
-    virtual BitMap* GetTouchedMpages(void) { return touchedMpages; }
+    virtual void SetMapUnallocated(int pageNr);
+    virtual void ClearMapAllocatedInBuffer(char* buffer, int pageNr);
+    virtual AtomicBitMap* GetTouchedMpages(void) { return touchedMpages; }
 
     virtual void UpdateNumUsedBlks(VirtualBlkAddr vsa);
+    virtual void ReleaseNumUsedBlks(VirtualBlkAddr vsa);
+    virtual void DecreaseNumUsedBlks(uint64_t numBlks);
     virtual uint64_t GetNumUsedBlks(void) { return numUsedBlks; }
 
     virtual int GetMapId(void) { return mapId; }
+    virtual uint64_t GetAge(void) { return age; }
     virtual uint32_t GetNumTouchedMpagesSet(void);
     virtual uint32_t GetNumTotalTouchedMpages(void);
     virtual void SetTouchedMpageBit(uint64_t pageNr);
@@ -84,7 +90,7 @@ private:
     uint64_t size;
     std::atomic<uint64_t> numUsedBlks;
     BitMap* mPageMap;
-    BitMap* touchedMpages;
+    AtomicBitMap* touchedMpages;
 
     int mapId;
 };
@@ -36,18 +36,22 @@
 
 #include "src/event_scheduler/event_scheduler.h"
 #include "src/logger/logger.h"
+#include "src/master_context/config_manager.h"
 #include "src/mapper/i_map_flush.h"
 #include "src/mapper/map/event_mpage_async_io.h"
 #include "src/meta_file_intf/mock_file_intf.h"
 #include "src/metafs/metafs_file_intf.h"
 #include "src/mapper/map/create_map_flush_event.h"
 #include "src/mapper/map/map_flush_event.h"
+#include "src/mapper/map/warm_restart_image.h"
 #include "src/metafs/include/metafs_service.h"
 #include "src/metafs/config/metafs_config_manager.h"
 #include "src/meta_file_intf/rocksdb_metafs_intf.h"
 
 namespace pos
 {
+const int MapIoHandler::DEFAULT_LOAD_QUEUE_DEPTH;
+
 MapFlushIoContext::MapFlushIoContext(MpageNum start, int num)
 : startMpage(start),
   numMpages(num)
@@ -77,6 +81,7 @@ MapIoHandler::MapIoHandler(MetaFileIntf* file_, Map* mapData, MapHeader* mapHead
   numPagesToAsyncIo(0),
   numPagesAsyncIoDone(0),
   flushInProgress(false),
+  numLoadsInFlight(0),
   ioError(0),
   addrInfo(addrInfo_),
   eventScheduler(scheduler_),
@@ -218,6 +223,46 @@ MapIoHandler::Load(AsyncLoadCallBack& cb)
     return ret;
 }
 
+int
+MapIoHandler::_GetLoadQueueDepth(void)
+{
+    int queueDepth = DEFAULT_LOAD_QUEUE_DEPTH;
+    int ret = ConfigManagerSingleton::Instance()->GetValue("mapper", "map_load_queue_depth",
+        &queueDepth, ConfigType::CONFIG_TYPE_INT);
+    if ((ret != 0) || (queueDepth <= 0))
+    {
+        queueDepth = DEFAULT_LOAD_QUEUE_DEPTH;
+    }
+    return queueDepth;
+}
+
+// Faults a single mpage in from the map file. Caller must hold the mpage lock
+char*
+MapIoHandler::LoadMpage(MpageNum pageNr)
+{
+    // the page becomes visible before its contents are read in, so keep optimistic readers out
+    map->BeginMpageUpdate(pageNr);
+    // an mpage kept encoded in memory comes back without any I/O
+    char* mpage = map->RestoreMpage(pageNr);
+    if (mpage == nullptr)
+    {
+        mpage = map->AllocateMpage(pageNr);
+        if (mpage != nullptr)
+        {
+            uint64_t fileOffset = mapHeader->GetSize() + pageNr * map->GetSize();
+            int ret = file->IssueIO(MetaFsIoOpcode::Read, fileOffset, map->GetSize(), mpage);
+            if (ret < 0)
+            {
+                POS_TRACE_ERROR(EID(MFS_SYNCIO_ERROR), "Failed to fault in mpage, mapId:{}, pageNr:{}, ret:{}", mapId, pageNr, ret);
+                map->DropMpage(pageNr);
+                mpage = nullptr;
+            }
+        }
+    }
+    map->EndMpageUpdate(pageNr);
+    return mpage;
+}
+
 int
 MapIoHandler::FlushHeader(EventSmartPtr callback)
 {
@@ -238,6 +283,17 @@ MapIoHandler::FlushDirtyPagesGiven(MpageList dirtyPages, EventSmartPtr callback)
 
     int result = EID(SUCCESS);
     _RemoveCleanPages(dirtyPages);
+    for (auto page = dirtyPages.begin(); page != dirtyPages.end(); )
+    {
+        if (_ElideIfUnmapped(*page) == true)
+        {
+            page = dirtyPages.erase(page);
+        }
+        else
+        {
+            ++page;
+        }
+    }
     numPagesToAsyncIo = dirtyPages.size();
 
     if (numPagesToAsyncIo != 0)
@@ -268,6 +324,7 @@ MapIoHandler::FlushTouchedPages(EventSmartPtr callback)
     BitMap* copiedBitmap = mapHeader->GetBitmapFromTempBuffer(mapHeaderTempBuffer);
     _GetTouchedPages(copiedBitmap);
     delete copiedBitmap;
+    _ElideUnmappedPages(touchedPages);
     if (touchedPages->GetNumBitsSet() != 0)
     {
         POS_TRACE_DEBUG(EID(MAP_FLUSH_STARTED), "[MAPPER FlushTouchedPages mapId:{}] started", mapId);
@@ -369,12 +426,38 @@ MapIoHandler::_HeaderAsyncLoaded(AsyncMetaFileIoCtx* ctx)
         return;
     }
 
+    if (map->IsDemandPaged() == true)
+    {
+        // mpages are faulted in on first access instead of being loaded at mount
+        status = LOADING_DONE;
+        POS_TRACE_INFO(EID(MAP_LOAD_COMPLETED), "mapId:{} header loaded, mpages are demand paged", mapId);
+        loadFinishedCallBack(mapId);
+        delete[] headerLoadReqCtx->GetBuffer();
+        delete headerLoadReqCtx;
+        return;
+    }
+
+    WarmRestartImage* image = (addrInfo != nullptr) ? addrInfo->GetWarmRestartImage() : nullptr;
+    if ((image != nullptr) && (ioError == 0) && (image->Restore(mapId, mapHeader, map) == true))
+    {
+        // the map file has not been written since the image was taken
+        status = LOADING_DONE;
+        POS_TRACE_INFO(EID(MAP_LOAD_COMPLETED), "mapId:{} restored from the warm restart image", mapId);
+        loadFinishedCallBack(mapId);
+        delete[] headerLoadReqCtx->GetBuffer();
+        delete headerLoadReqCtx;
+        return;
+    }
+
     // Mpages Async-load Request by Event
     numPagesToAsyncIo = mapHeader->GetNumValidMpages();
     numPagesAsyncIoDone = 0;
+    numLoadsInFlight = 0;
+    loadProgress.Start(mapId, numPagesToAsyncIo, map->GetSize());
     FnCompleteMetaFileIo mpageAsyncLoadReqCB = std::bind(&MapIoHandler::_MpageAsyncLoaded, this, std::placeholders::_1);
 
-    EventSmartPtr mpageLoadRequest = std::make_shared<EventMpageAsyncIo>(mapHeader, map, file, mpageAsyncLoadReqCB);
+    EventSmartPtr mpageLoadRequest = std::make_shared<EventMpageAsyncIo>(mapHeader, map, file, mpageAsyncLoadReqCB,
+        &numLoadsInFlight, _GetLoadQueueDepth());
     eventScheduler->EnqueueEvent(mpageLoadRequest);
 
     delete[] headerLoadReqCtx->GetBuffer();
@@ -394,10 +477,13 @@ MapIoHandler::_MpageAsyncLoaded(AsyncMetaFileIoCtx* ctx)
         POS_TRACE_ERROR(EID(MFS_ASYNCIO_ERROR), "MFS AsyncIO error, ioError:{}  startMpage:{} numMpages:{}", ioError, startMpage, numMpages);
         POS_TRACE_ERROR(EID(MFS_ASYNCIO_ERROR), mPageLoadReqCtx->ToString());
     }
+    loadProgress.PagesLoaded(numMpages);
+    numLoadsInFlight--;
     bool loadCompleted = _IncreaseAsyncIoDonePageNum(numMpages);
     if (loadCompleted)
     {
         _ResetAsyncIoPageNum();
+        loadProgress.Complete();
         if (ioError != 0)
         {
             status = LOADING_ERROR;
@@ -448,18 +534,37 @@ MapIoHandler::CreateFlushEvents(std::unique_ptr<SequentialPageFinder> sequential
     }
 }
 
+// Every page to flush is frozen up front, so the flush writes one image of the map as of
+// now. Host writes that reach a frozen page before it is copied copy it themselves
 void
 MapIoHandler::_Flush(std::unique_ptr<SequentialPageFinder> sequentialPages)
 {
+    std::vector<std::pair<MpageSet, char*>> frozenSets;
     while (sequentialPages->IsRemaining())
     {
         MpageSet mpageSet = sequentialPages->PopNextMpageSet();
-        _FlushMpages(mpageSet.startMpage, mpageSet.numMpages);
+        frozenSets.push_back(std::make_pair(mpageSet, _FreezeMpages(mpageSet.startMpage, mpageSet.numMpages)));
+    }
+
+    for (auto& frozen : frozenSets)
+    {
+        MpageSet& mpageSet = frozen.first;
+        _CopyFrozenMpages(mpageSet.startMpage, mpageSet.numMpages);
+        _IssueFlush(frozen.second, mpageSet.startMpage, mpageSet.numMpages);
     }
 }
 
 int
 MapIoHandler::_FlushMpages(MpageNum startMpage, int numMpages)
+{
+    char* buffer = _FreezeMpages(startMpage, numMpages);
+    _CopyFrozenMpages(startMpage, numMpages);
+
+    return _IssueFlush(buffer, startMpage, numMpages);
+}
+
+char*
+MapIoHandler::_FreezeMpages(MpageNum startMpage, int numMpages)
 {
     char* buffer = new char[map->GetSize() * numMpages];
     for (int offset = 0; offset < numMpages; offset++)
@@ -468,12 +573,22 @@ MapIoHandler::_FlushMpages(MpageNum startMpage, int numMpages)
         int pageNr = startMpage + offset;
 
         map->GetMpageLock(pageNr);
-        memcpy(dest, (void*)map->GetMpage(pageNr), map->GetSize());
+        map->FreezeMpage(pageNr, dest);
         mapHeader->GetTouchedMpages()->ClearBit(pageNr);
+        map->StartMpageFlush(pageNr);
         map->ReleaseMpageLock(pageNr);
     }
 
-    return _IssueFlush(buffer, startMpage, numMpages);
+    return buffer;
+}
+
+void
+MapIoHandler::_CopyFrozenMpages(MpageNum startMpage, int numMpages)
+{
+    for (int offset = 0; offset < numMpages; offset++)
+    {
+        map->CopyFrozenMpage(startMpage + offset);
+    }
 }
 
 int
@@ -526,6 +641,11 @@ MapIoHandler::_MpageFlushed(AsyncMetaFileIoCtx* ctx)
         POS_TRACE_ERROR(EID(MFS_ASYNCIO_ERROR), mpageFlushReq->ToString());
     }
 
+    for (uint32_t offset = 0; offset < numMpages; offset++)
+    {
+        map->EndMpageFlush(startMpage + offset);
+    }
+
     int ret = EID(SUCCESS);
     bool flushCompleted = _IncreaseAsyncIoDonePageNum(numMpages);
 
@@ -578,22 +698,92 @@ MapIoHandler::_HeaderFlushed(AsyncMetaFileIoCtx* ctx)
     delete ctx;
 }
 
+// Drains the touched bitmap in one pass instead of probing every valid page. A page
+// touched before it became valid in the header image being flushed is handed back
+// to the next flush
 void
 MapIoHandler::_GetTouchedPages(BitMap* validPages)
 {
+    mapHeader->GetTouchedMpages()->MoveSetBitsTo(*touchedPages);
+
     uint32_t lastBit = 0;
     uint32_t currentPage = 0;
 
-    while ((currentPage = validPages->FindFirstSet(lastBit)) != validPages->GetNumBits())
+    while ((currentPage = touchedPages->FindFirstSet(lastBit)) != touchedPages->GetNumBits())
     {
-        if (mapHeader->GetTouchedMpages()->IsSetBit(currentPage) == true)
+        if (validPages->IsSetBit(currentPage) == false)
         {
-            touchedPages->SetBit(currentPage);
+            touchedPages->ClearBit(currentPage);
+            mapHeader->SetTouchedMpageBit(currentPage);
         }
         lastBit = currentPage + 1;
     }
 }
 
+void
+MapIoHandler::_ElideUnmappedPages(BitMap* pages)
+{
+    uint32_t lastBit = 0;
+    uint32_t currentPage = 0;
+
+    while ((currentPage = pages->FindFirstSet(lastBit)) != pages->GetNumBits())
+    {
+        if (_ElideIfUnmapped(currentPage) == true)
+        {
+            pages->ClearBit(currentPage);
+        }
+        lastBit = currentPage + 1;
+    }
+}
+
+// An mpage holding nothing but unmapped entries is the same as one that was never
+// allocated. Instead of being flushed it is dropped and cleared from the header being
+// flushed, and it is materialised again by the next SetEntry
+bool
+MapIoHandler::_ElideIfUnmapped(MpageNum pageNr)
+{
+    bool elided = false;
+
+    map->GetMpageLock(pageNr);
+    char* mpage = map->GetMpage(pageNr);
+    if ((mpage != nullptr) && (_IsUnmapped(mpage) == true))
+    {
+        map->BeginMpageUpdate(pageNr);
+        map->DropMpage(pageNr);
+        map->EndMpageUpdate(pageNr);
+        mapHeader->SetMapUnallocated(pageNr);
+        mapHeader->GetTouchedMpages()->ClearBit(pageNr);
+        mapHeader->ClearMapAllocatedInBuffer(mapHeaderTempBuffer, pageNr);
+        elided = true;
+    }
+    map->ReleaseMpageLock(pageNr);
+
+    return elided;
+}
+
+bool
+MapIoHandler::_IsUnmapped(char* mpage)
+{
+    // AllocateMpage() fills an mpage with 0xFF, which is the unmapped entry of every map
+    uint64_t numWords = map->GetSize() / sizeof(uint64_t);
+    uint64_t* words = reinterpret_cast<uint64_t*>(mpage);
+    for (uint64_t idx = 0; idx < numWords; ++idx)
+    {
+        if (words[idx] != UINT64_MAX)
+        {
+            return false;
+        }
+    }
+    for (uint64_t idx = numWords * sizeof(uint64_t); idx < map->GetSize(); ++idx)
+    {
+        if (static_cast<uint8_t>(mpage[idx]) != UINT8_MAX)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool
 MapIoHandler::_PrepareFlush(EventSmartPtr callback)
 {
@@ -657,11 +847,16 @@ MapIoHandler::_IssueMpageIoByMockFs(MetaFsIoOpcode opType, MetaFileIntf* fileToI
     int ret = 0;
     uint64_t mpageNum = 0;
     uint64_t numBitsSet = mapHeader->GetNumValidMpages();
+    bool demandPaged = map->IsDemandPaged();
 
     for (uint64_t cnt = 0; cnt < numBitsSet; ++cnt)
     {
         mpageNum = mapHeader->GetMpageMap()->FindFirstSet(mpageNum);
         char* mpage = nullptr;
+        if (demandPaged == true)
+        {
+            map->GetMpageLock(mpageNum);
+        }
         if (opType == MetaFsIoOpcode::Read)
         {
             mpage = map->AllocateMpage(mpageNum);
@@ -670,10 +865,20 @@ MapIoHandler::_IssueMpageIoByMockFs(MetaFsIoOpcode opType, MetaFileIntf* fileToI
                 mpage = map->GetMpage(mpageNum);
                 POS_TRACE_INFO(EID(MAPPER_SUCCESS), "filename:{}  mpageNum:{} Dumped mapfile loaded -> Mpage double allocation Error Cleared", fileToIo->GetFileName(), mpageNum);
             }
+            if (demandPaged == true)
+            {
+                // keep the loaded contents resident until the next flush stores them
+                mapHeader->SetTouchedMpageBit(mpageNum);
+                map->MarkMpageDirty(mpageNum);
+            }
         }
         else
         {
             mpage = map->GetMpage(mpageNum);
+            if ((mpage == nullptr) && (demandPaged == true))
+            {
+                mpage = LoadMpage(mpageNum);
+            }
         }
 
         uint64_t fileOffset = mapHeader->GetSize() + (mpageNum * map->GetSize());
@@ -683,6 +888,10 @@ MapIoHandler::_IssueMpageIoByMockFs(MetaFsIoOpcode opType, MetaFileIntf* fileToI
             POS_TRACE_ERROR(EID(MFS_SYNCIO_ERROR), "AppendIO Error, retMFS:{}  fileName:{}  cnt:{}", retMFS, fileToIo->GetFileName(), cnt);
             ret = retMFS;
         }
+        if (demandPaged == true)
+        {
+            map->ReleaseMpageLock(mpageNum);
+        }
 
         mpageNum++;
     }
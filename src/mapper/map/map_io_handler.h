@@ -34,6 +34,7 @@
 
 #include "src/journal_manager/checkpoint/checkpoint_handler.h"
 #include "src/mapper/map/map_content.h"
+#include "src/mapper/map/map_load_progress.h"
 #include "src/mapper/map/sequential_page_finder.h"
 #include "src/meta_file_intf/async_context.h"
 #include "src/meta_file_intf/meta_file_intf.h"
@@ -89,14 +90,18 @@ public:
     int FlushDirtyPagesGiven(MpageList dirtyPages, EventSmartPtr callback);
     int FlushTouchedPages(EventSmartPtr callback);
     int FlushHeader(EventSmartPtr callback);
+    char* LoadMpage(MpageNum pageNr);
     int LoadForWBT(MetaFileIntf* fileFromLoad);
     int StoreForWBT(MetaFileIntf* fileToStore);
 
     virtual int CreateFlushRequestFor(const MpageSet& mpageSet);
     virtual void CreateFlushEvents(std::unique_ptr<SequentialPageFinder> sequentialPages);
 
+    static const int DEFAULT_LOAD_QUEUE_DEPTH = 32;
+
 private:
     int _MakeFileReady(void);
+    int _GetLoadQueueDepth(void);
     bool _IncreaseAsyncIoDonePageNum(int numPagesDone);
     void _ResetAsyncIoPageNum(void);
     void _HeaderFlushed(AsyncMetaFileIoCtx* ctx);
@@ -107,7 +112,12 @@ private:
     void _CompleteFlush(void);
     void _RemoveCleanPages(MpageList& pages);
     void _GetTouchedPages(BitMap* validPages);
+    void _ElideUnmappedPages(BitMap* pages);
+    bool _ElideIfUnmapped(MpageNum pageNr);
+    bool _IsUnmapped(char* mpage);
     int _FlushMpages(MpageNum startPage, int numPages);
+    char* _FreezeMpages(MpageNum startPage, int numPages);
+    void _CopyFrozenMpages(MpageNum startPage, int numPages);
     int _IssueFlush(char* buffer, MpageNum startMpage, int numMpages);
     int _IssueFlushHeader(void);
     void _Flush(std::unique_ptr<SequentialPageFinder> sequentialPages);
@@ -124,6 +134,8 @@ private:
     std::atomic<int> numPagesToAsyncIo;
     std::atomic<int> numPagesAsyncIoDone;
     std::atomic<bool> flushInProgress;
+    std::atomic<int> numLoadsInFlight;
+    MapLoadProgress loadProgress;
 
     AsyncLoadCallBack loadFinishedCallBack;
     EventSmartPtr flushDoneCallBack;
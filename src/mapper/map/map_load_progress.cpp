@@ -0,0 +1,116 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/mapper/map/map_load_progress.h"
+
+#include "src/include/memory.h"
+#include "src/logger/logger.h"
+
+namespace pos
+{
+const int MapLoadProgress::PROGRESS_STEP;
+
+MapLoadProgress::MapLoadProgress(void)
+: mapId(-1),
+  totalPages(0),
+  pageSize(0),
+  loadedPages(0),
+  reportedProgress(0)
+{
+}
+
+void
+MapLoadProgress::Start(int mapId_, uint64_t numPages, uint64_t pageSize_)
+{
+    mapId = mapId_;
+    totalPages = numPages;
+    pageSize = pageSize_;
+    loadedPages = 0;
+    reportedProgress = 0;
+    startTime = std::chrono::steady_clock::now();
+}
+
+void
+MapLoadProgress::PagesLoaded(uint64_t numPages)
+{
+    loadedPages += numPages;
+
+    int progress = GetProgress();
+    int reported = reportedProgress;
+    while ((progress - reported) >= PROGRESS_STEP)
+    {
+        int next = progress - (progress % PROGRESS_STEP);
+        if (reportedProgress.compare_exchange_weak(reported, next) == true)
+        {
+            POS_TRACE_INFO(EID(MAPPER_INFO), "[Mapper Load] mapId:{} {}% loaded ({}/{} mpages), {} MB/s",
+                mapId, next, loadedPages.load(), totalPages, GetThroughputInMBps());
+            break;
+        }
+    }
+}
+
+void
+MapLoadProgress::Complete(void)
+{
+    POS_TRACE_INFO(EID(MAP_LOAD_COMPLETED), "[Mapper Load] mapId:{} loaded {} mpages ({} MB) in {} ms, {} MB/s",
+        mapId, loadedPages.load(), (loadedPages * pageSize) / SZ_1MB, _GetElapsedMs(), GetThroughputInMBps());
+}
+
+int
+MapLoadProgress::GetProgress(void)
+{
+    if (totalPages == 0)
+    {
+        return 100;
+    }
+    return static_cast<int>((loadedPages * 100) / totalPages);
+}
+
+uint64_t
+MapLoadProgress::GetThroughputInMBps(void)
+{
+    uint64_t elapsedMs = _GetElapsedMs();
+    if (elapsedMs == 0)
+    {
+        elapsedMs = 1;
+    }
+    return (loadedPages * pageSize * 1000) / (elapsedMs * SZ_1MB);
+}
+
+uint64_t
+MapLoadProgress::_GetElapsedMs(void)
+{
+    auto elapsed = std::chrono::steady_clock::now() - startTime;
+    return std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+}
+
+} // namespace pos
@@ -0,0 +1,69 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace pos
+{
+// Tracks how far a map load has got, and logs progress every PROGRESS_STEP percent
+// and the load throughput when it finishes. PagesLoaded() is called from meta-fs threads
+class MapLoadProgress
+{
+public:
+    MapLoadProgress(void);
+    virtual ~MapLoadProgress(void) = default;
+
+    virtual void Start(int mapId, uint64_t numPages, uint64_t pageSize);
+    virtual void PagesLoaded(uint64_t numPages);
+    virtual void Complete(void);
+
+    int GetProgress(void);
+    uint64_t GetThroughputInMBps(void);
+
+    static const int PROGRESS_STEP = 10;
+
+private:
+    uint64_t _GetElapsedMs(void);
+
+    int mapId;
+    uint64_t totalPages;
+    uint64_t pageSize;
+    std::atomic<uint64_t> loadedPages;
+    std::atomic<int> reportedProgress;
+    std::chrono::steady_clock::time_point startTime;
+};
+
+} // namespace pos
@@ -0,0 +1,244 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/mapper/map/mpage_cache.h"
+
+#include <stdlib.h>
+
+#include "src/include/memory.h"
+#include "src/logger/logger.h"
+#include "src/mapper/map/demand_paged_map.h"
+
+namespace pos
+{
+MpageCache::MpageCache(uint64_t mpageSize, uint64_t budgetInMpages)
+: MpageCache(mpageSize, budgetInMpages, 0)
+{
+}
+
+MpageCache::MpageCache(uint64_t mpageSize, uint64_t budgetInMpages, uint64_t encodedBudgetInBytes)
+: clockHand(0),
+  mpageSize(mpageSize),
+  budget(budgetInMpages),
+  overBudgetCount(0),
+  encodedBudget(encodedBudgetInBytes),
+  numEncodedPages(0),
+  encodedBytes(0),
+  numDecodes(0),
+  decodeTimeNs(0)
+{
+}
+
+MpageCache::~MpageCache(void)
+{
+    for (auto frame : frames)
+    {
+        free(frame->data);
+        delete frame;
+    }
+    frames.clear();
+    freeFrames.clear();
+}
+
+char*
+MpageCache::Allocate(DemandPagedMap* owner, uint64_t pageNr)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    MpageFrame* frame = nullptr;
+    if (false == freeFrames.empty())
+    {
+        frame = freeFrames.back();
+        freeFrames.pop_back();
+    }
+    else if (frames.size() < budget)
+    {
+        frame = _CreateFrame();
+    }
+    else
+    {
+        frame = _Reclaim();
+        if (nullptr == frame)
+        {
+            // Every resident mpage is dirty or being flushed. Going over the budget
+            // until the next checkpoint is preferred to failing the map update.
+            if ((overBudgetCount++ % 1000) == 0)
+            {
+                POS_TRACE_WARN(EID(MAPPER_INFO),
+                    "[Mapper MpageCache] No clean mpage to evict, budget:{}, numFrames:{}, overBudgetCount:{}",
+                    budget, frames.size(), overBudgetCount);
+            }
+            frame = _CreateFrame();
+        }
+    }
+
+    if (nullptr == frame)
+    {
+        return nullptr;
+    }
+    frame->owner = owner;
+    frame->pageNr = pageNr;
+    return frame->data;
+}
+
+void
+MpageCache::Free(DemandPagedMap* owner, uint64_t pageNr)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    for (auto frame : frames)
+    {
+        if ((frame->owner == owner) && (frame->pageNr == pageNr))
+        {
+            frame->owner = nullptr;
+            freeFrames.push_back(frame);
+            return;
+        }
+    }
+}
+
+void
+MpageCache::FreeAll(DemandPagedMap* owner)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    for (auto frame : frames)
+    {
+        if (frame->owner == owner)
+        {
+            frame->owner = nullptr;
+            freeFrames.push_back(frame);
+        }
+    }
+}
+
+uint64_t
+MpageCache::GetNumFrames(void)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return frames.size();
+}
+
+uint64_t
+MpageCache::GetNumUsedFrames(void)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return frames.size() - freeFrames.size();
+}
+
+uint64_t
+MpageCache::GetBudget(void)
+{
+    return budget;
+}
+
+bool
+MpageCache::IsEncodingEnabled(void)
+{
+    return (encodedBudget != 0);
+}
+
+bool
+MpageCache::ReserveEncoded(uint64_t bytes)
+{
+    uint64_t used = encodedBytes;
+    do
+    {
+        if (used + bytes > encodedBudget)
+        {
+            return false;
+        }
+    } while (encodedBytes.compare_exchange_weak(used, used + bytes) == false);
+
+    numEncodedPages++;
+    return true;
+}
+
+void
+MpageCache::ReleaseEncoded(uint64_t bytes)
+{
+    encodedBytes -= bytes;
+    numEncodedPages--;
+}
+
+void
+MpageCache::RecordDecode(uint64_t elapsedNs)
+{
+    numDecodes++;
+    decodeTimeNs += elapsedNs;
+}
+
+MpageCodecStats
+MpageCache::GetCodecStats(void)
+{
+    MpageCodecStats stats = {
+        .numEncodedPages = numEncodedPages,
+        .encodedBytes = encodedBytes,
+        .numDecodes = numDecodes,
+        .decodeTimeNs = decodeTimeNs};
+    return stats;
+}
+
+MpageFrame*
+MpageCache::_CreateFrame(void)
+{
+    char* data = nullptr;
+    int ret = posix_memalign((void**)&data, pos::SECTOR_SIZE, mpageSize);
+    if (ret != 0)
+    {
+        POS_TRACE_ERROR(EID(MPAGE_MEMORY_ALLOC_FAILURE),
+            "[Mapper MpageCache] Failed to allocate mpage frame, size:{}, ret:{}", mpageSize, ret);
+        return nullptr;
+    }
+
+    MpageFrame* frame = new MpageFrame{data, nullptr, 0};
+    frames.push_back(frame);
+    return frame;
+}
+
+MpageFrame*
+MpageCache::_Reclaim(void)
+{
+    // CLOCK: the first lap clears reference bits, so the second lap finds a victim
+    // unless every frame is pinned
+    uint64_t numFrames = frames.size();
+    for (uint64_t scan = 0; scan < 2 * numFrames; scan++)
+    {
+        MpageFrame* frame = frames[clockHand];
+        clockHand = (clockHand + 1) % numFrames;
+        if ((nullptr != frame->owner) && (true == frame->owner->TryEvict(frame->pageNr)))
+        {
+            frame->owner = nullptr;
+            return frame;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace pos
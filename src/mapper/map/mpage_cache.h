@@ -0,0 +1,105 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace pos
+{
+class DemandPagedMap;
+
+struct MpageFrame
+{
+    char* data;
+    DemandPagedMap* owner;
+    uint64_t pageNr;
+};
+
+struct MpageCodecStats
+{
+    uint64_t numEncodedPages;
+    uint64_t encodedBytes;
+    uint64_t numDecodes;
+    uint64_t decodeTimeNs;
+};
+
+// Fixed-budget pool of mpage frames shared by the demand-paged maps of an array.
+// Frames are created on demand up to the budget; after that a CLOCK hand walks the
+// frames and reclaims the first clean, unreferenced one from its owning map.
+// With an encoded budget, the owning map may keep an encoded copy of a reclaimed
+// mpage instead of dropping it; the cache only accounts for that memory.
+class MpageCache
+{
+public:
+    MpageCache(uint64_t mpageSize, uint64_t budgetInMpages);
+    MpageCache(uint64_t mpageSize, uint64_t budgetInMpages, uint64_t encodedBudgetInBytes);
+    virtual ~MpageCache(void);
+
+    virtual char* Allocate(DemandPagedMap* owner, uint64_t pageNr);
+    virtual void Free(DemandPagedMap* owner, uint64_t pageNr);
+    virtual void FreeAll(DemandPagedMap* owner);
+
+    virtual uint64_t GetNumFrames(void);
+    virtual uint64_t GetNumUsedFrames(void);
+    virtual uint64_t GetBudget(void);
+
+    virtual bool IsEncodingEnabled(void);
+    virtual bool ReserveEncoded(uint64_t bytes);
+    virtual void ReleaseEncoded(uint64_t bytes);
+    virtual void RecordDecode(uint64_t elapsedNs);
+    virtual MpageCodecStats GetCodecStats(void);
+
+private:
+    MpageFrame* _CreateFrame(void);
+    MpageFrame* _Reclaim(void);
+
+    std::mutex lock;
+    std::vector<MpageFrame*> frames;
+    std::vector<MpageFrame*> freeFrames;
+    uint64_t clockHand;
+    uint64_t mpageSize;
+    uint64_t budget;
+    uint64_t overBudgetCount;
+
+    // updated from TryEvict() while lock is held by _Reclaim(), so kept lock-free
+    uint64_t encodedBudget;
+    std::atomic<uint64_t> numEncodedPages;
+    std::atomic<uint64_t> encodedBytes;
+    std::atomic<uint64_t> numDecodes;
+    std::atomic<uint64_t> decodeTimeNs;
+};
+
+} // namespace pos
@@ -0,0 +1,405 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/mapper/map/warm_restart_image.h"
+
+#include "src/include/pos_event_id.h"
+#include "src/logger/logger.h"
+#include "src/meta_file_intf/mock_file_intf.h"
+#include "src/meta_file_intf/rocksdb_metafs_intf.h"
+#include "src/metafs/config/metafs_config_manager.h"
+#include "src/metafs/include/metafs_service.h"
+#include "src/metafs/metafs_file_intf.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace pos
+{
+const uint64_t WarmRestartImage::MAGIC;
+const uint32_t WarmRestartImage::VERSION;
+const uint64_t WarmRestartImage::HEADER_SIZE;
+const uint64_t WarmRestartImage::IO_CHUNK_SIZE;
+
+static const char* WARM_RESTART_IMAGE_FILE_NAME = "WarmRestartImage";
+
+WarmRestartImage::WarmRestartImage(MapperAddressInfo* addrInfo_, MetaFileIntf* file_)
+: addrInfo(addrInfo_),
+  file(file_)
+{
+    if (file == nullptr)
+    {
+        if (addrInfo->IsUT() == true)
+        {
+            file = new MockFileIntf(WARM_RESTART_IMAGE_FILE_NAME, addrInfo->GetArrayId(), MetaFileType::Map);
+        }
+        else if (MetaFsServiceSingleton::Instance()->GetConfigManager()->IsRocksdbEnabled() == true)
+        {
+            file = new RocksDBMetaFsIntf(WARM_RESTART_IMAGE_FILE_NAME, addrInfo->GetArrayId(), MetaFileType::Map);
+        }
+        else
+        {
+            file = new MetaFsFileIntf(WARM_RESTART_IMAGE_FILE_NAME, addrInfo->GetArrayId(), MetaFileType::Map);
+        }
+    }
+}
+
+WarmRestartImage::~WarmRestartImage(void)
+{
+    _ClearRecords();
+    if (file != nullptr)
+    {
+        _CloseFile();
+        delete file;
+        file = nullptr;
+    }
+}
+
+void
+WarmRestartImage::AddMap(int mapId, MapHeader* mapHeader, Map* map)
+{
+    for (auto& source : sources)
+    {
+        if (source.mapId == mapId)
+        {
+            return;
+        }
+    }
+    sources.push_back({.mapId = mapId, .mapHeader = mapHeader, .map = map});
+}
+
+// Must be called after all maps are flushed and no map update is in progress.
+// The image header goes last, so a torn image is never taken as valid
+int
+WarmRestartImage::Store(void)
+{
+    auto start = std::chrono::steady_clock::now();
+    uint64_t imageSize = HEADER_SIZE;
+    for (auto& source : sources)
+    {
+        imageSize += sizeof(MapRecordHeader) + source.mapHeader->GetNumValidMpages() * source.map->GetSize();
+    }
+    int ret = _OpenFile(imageSize);
+    if (ret < 0)
+    {
+        sources.clear();
+        return ret;
+    }
+
+    char* staging = new char[IO_CHUNK_SIZE];
+    uint64_t stagedSize = 0;
+    uint64_t offset = HEADER_SIZE;
+    for (auto& source : sources)
+    {
+        BitMap* validPages = source.mapHeader->GetMpageMap();
+        MapRecordHeader record = {
+            .mapId = source.mapId,
+            .reserved = 0,
+            .age = source.mapHeader->GetAge(),
+            .numMpages = validPages->GetNumBitsSet(),
+            .mpageSize = source.map->GetSize()};
+        ret = _Write(offset, staging, stagedSize, reinterpret_cast<char*>(&record), sizeof(record));
+        for (uint64_t pageNr = 0; (ret == 0) && (pageNr < validPages->GetNumBits()); pageNr++)
+        {
+            if (validPages->IsSetBit(pageNr) == false)
+            {
+                continue;
+            }
+            char* mpage = source.map->GetMpage(pageNr);
+            if (mpage == nullptr)
+            {
+                ret = -1;
+                break;
+            }
+            ret = _Write(offset, staging, stagedSize, mpage, record.mpageSize);
+        }
+        if (ret < 0)
+        {
+            break;
+        }
+    }
+    if ((ret == 0) && (stagedSize > 0))
+    {
+        ret = file->IssueIO(MetaFsIoOpcode::Write, offset - stagedSize, stagedSize, staging);
+    }
+    if (ret == 0)
+    {
+        memset(staging, 0, HEADER_SIZE);
+        ImageHeader* header = reinterpret_cast<ImageHeader*>(staging);
+        header->magic = MAGIC;
+        header->version = VERSION;
+        header->numMaps = sources.size();
+        header->imageSize = imageSize;
+        ret = file->IssueIO(MetaFsIoOpcode::Write, 0, HEADER_SIZE, staging);
+    }
+    delete[] staging;
+    _CloseFile();
+
+    uint64_t elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    if (ret < 0)
+    {
+        POS_TRACE_ERROR(EID(MAPPER_FAILED), "[Mapper WarmRestart] Failed to store image, maps:{}, arrayId:{}, ret:{}",
+            sources.size(), addrInfo->GetArrayId(), ret);
+    }
+    else
+    {
+        POS_TRACE_INFO(EID(MAPPER_INFO), "[Mapper WarmRestart] Image stored, maps:{}, size:{}, elapsed_ms:{}, arrayId:{}",
+            sources.size(), imageSize, elapsedMs, addrInfo->GetArrayId());
+    }
+    sources.clear();
+    return ret;
+}
+
+int
+WarmRestartImage::Load(void)
+{
+    auto start = std::chrono::steady_clock::now();
+    if (file->DoesFileExist() == false)
+    {
+        POS_TRACE_INFO(EID(MAPPER_INFO), "[Mapper WarmRestart] No image to load, arrayId:{}", addrInfo->GetArrayId());
+        return -1;
+    }
+    if (file->Open() < 0)
+    {
+        return -1;
+    }
+
+    char* headerBuf = new char[HEADER_SIZE]();
+    int ret = _Read(0, HEADER_SIZE, headerBuf);
+    ImageHeader header = *reinterpret_cast<ImageHeader*>(headerBuf);
+    delete[] headerBuf;
+    if ((ret < 0) || (header.magic != MAGIC) || (header.version != VERSION) ||
+        (header.imageSize > file->GetFileSize()))
+    {
+        POS_TRACE_INFO(EID(MAPPER_INFO), "[Mapper WarmRestart] No valid image to load, arrayId:{}", addrInfo->GetArrayId());
+        _CloseFile();
+        return -1;
+    }
+
+    uint64_t offset = HEADER_SIZE;
+    for (uint32_t index = 0; index < header.numMaps; index++)
+    {
+        MapRecordHeader recordHeader;
+        ret = _Read(offset, sizeof(recordHeader), reinterpret_cast<char*>(&recordHeader));
+        if (ret < 0)
+        {
+            break;
+        }
+        offset += sizeof(recordHeader);
+
+        uint64_t dataSize = recordHeader.numMpages * recordHeader.mpageSize;
+        if (offset + dataSize > header.imageSize)
+        {
+            ret = -1;
+            break;
+        }
+        MapRecord record = {
+            .age = recordHeader.age,
+            .numMpages = recordHeader.numMpages,
+            .mpageSize = recordHeader.mpageSize,
+            .data = new char[dataSize]};
+        ret = _Read(offset, dataSize, record.data);
+        if (ret < 0)
+        {
+            delete[] record.data;
+            break;
+        }
+        offset += dataSize;
+        std::lock_guard<std::mutex> lock(recordLock);
+        records[recordHeader.mapId] = record;
+    }
+    _CloseFile();
+
+    if (ret < 0)
+    {
+        POS_TRACE_WARN(EID(MAPPER_FAILED), "[Mapper WarmRestart] Failed to load image, maps are loaded from their files, arrayId:{}, ret:{}",
+            addrInfo->GetArrayId(), ret);
+        _ClearRecords();
+        return ret;
+    }
+    uint64_t elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    POS_TRACE_INFO(EID(MAPPER_INFO), "[Mapper WarmRestart] Image loaded, maps:{}, size:{}, elapsed_ms:{}, arrayId:{}",
+        header.numMaps, header.imageSize, elapsedMs, addrInfo->GetArrayId());
+    return 0;
+}
+
+// Called with the header of the map file already applied. Each map is handed
+// out at most once, a stale one is dropped without being applied
+bool
+WarmRestartImage::Restore(int mapId, MapHeader* mapHeader, Map* map)
+{
+    MapRecord record;
+    {
+        std::lock_guard<std::mutex> lock(recordLock);
+        auto it = records.find(mapId);
+        if (it == records.end())
+        {
+            return false;
+        }
+        record = it->second;
+        records.erase(it);
+    }
+
+    bool restored = false;
+    if ((record.age == mapHeader->GetAge()) &&
+        (record.numMpages == mapHeader->GetNumValidMpages()) &&
+        (record.mpageSize == map->GetSize()))
+    {
+        restored = true;
+        BitMap* validPages = mapHeader->GetMpageMap();
+        char* src = record.data;
+        for (uint64_t pageNr = 0; pageNr < validPages->GetNumBits(); pageNr++)
+        {
+            if (validPages->IsSetBit(pageNr) == false)
+            {
+                continue;
+            }
+            char* mpage = map->GetMpage(pageNr);
+            if (mpage == nullptr)
+            {
+                mpage = map->AllocateMpage(pageNr);
+            }
+            if (mpage == nullptr)
+            {
+                restored = false;
+                break;
+            }
+            memcpy(mpage, src, record.mpageSize);
+            src += record.mpageSize;
+        }
+    }
+    if (restored == false)
+    {
+        POS_TRACE_INFO(EID(MAPPER_INFO), "[Mapper WarmRestart] Image of mapId:{} is stale, age:{}, map file age:{}",
+            mapId, record.age, mapHeader->GetAge());
+    }
+    delete[] record.data;
+    return restored;
+}
+
+uint32_t
+WarmRestartImage::GetNumLoadedMaps(void)
+{
+    std::lock_guard<std::mutex> lock(recordLock);
+    return records.size();
+}
+
+int
+WarmRestartImage::_OpenFile(uint64_t fileSize)
+{
+    if (file->DoesFileExist() == true)
+    {
+        _CloseFile();
+        int ret = file->Delete();
+        if (ret < 0)
+        {
+            POS_TRACE_ERROR(EID(MFS_FILE_DELETE_FAILED), "[Mapper WarmRestart] Failed to delete the old image, arrayId:{}", addrInfo->GetArrayId());
+            return ret;
+        }
+    }
+    int ret = file->Create(fileSize);
+    if (ret < 0)
+    {
+        POS_TRACE_WARN(EID(MFS_FILE_CREATE_FAILED), "[Mapper WarmRestart] Failed to create image, size:{}, arrayId:{}", fileSize, addrInfo->GetArrayId());
+        return ret;
+    }
+    return file->Open();
+}
+
+void
+WarmRestartImage::_CloseFile(void)
+{
+    if (file->IsOpened() == true)
+    {
+        file->Close();
+    }
+}
+
+// Appends len bytes to the image through the staging buffer, which is written
+// out whenever it fills up. offset is the file offset past the staged bytes
+int
+WarmRestartImage::_Write(uint64_t& offset, char* staging, uint64_t& stagedSize, const char* src, uint64_t len)
+{
+    while (len > 0)
+    {
+        uint64_t copySize = std::min(len, IO_CHUNK_SIZE - stagedSize);
+        memcpy(staging + stagedSize, src, copySize);
+        stagedSize += copySize;
+        offset += copySize;
+        src += copySize;
+        len -= copySize;
+        if (stagedSize == IO_CHUNK_SIZE)
+        {
+            int ret = file->IssueIO(MetaFsIoOpcode::Write, offset - stagedSize, stagedSize, staging);
+            if (ret < 0)
+            {
+                return ret;
+            }
+            stagedSize = 0;
+        }
+    }
+    return 0;
+}
+
+int
+WarmRestartImage::_Read(uint64_t offset, uint64_t len, char* buffer)
+{
+    while (len > 0)
+    {
+        uint64_t readSize = std::min(len, IO_CHUNK_SIZE);
+        int ret = file->IssueIO(MetaFsIoOpcode::Read, offset, readSize, buffer);
+        if (ret < 0)
+        {
+            return ret;
+        }
+        offset += readSize;
+        buffer += readSize;
+        len -= readSize;
+    }
+    return 0;
+}
+
+void
+WarmRestartImage::_ClearRecords(void)
+{
+    std::lock_guard<std::mutex> lock(recordLock);
+    for (auto& it : records)
+    {
+        delete[] it.second.data;
+    }
+    records.clear();
+}
+
+} // namespace pos
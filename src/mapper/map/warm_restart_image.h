@@ -0,0 +1,118 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "src/mapper/address/mapper_address_info.h"
+#include "src/mapper/map/map.h"
+#include "src/mapper/map/map_header.h"
+#include "src/meta_file_intf/meta_file_intf.h"
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace pos
+{
+// In-DRAM map image written at a clean shutdown so that the next mount can
+// stream the maps back with a few large reads instead of loading every map file
+// page by page. Each map is stored with the age of its map header. A map is
+// restored only if the header read from its own map file still has that age,
+// so a map written after the image was taken always falls back to its file
+class WarmRestartImage
+{
+public:
+    explicit WarmRestartImage(MapperAddressInfo* addrInfo, MetaFileIntf* file = nullptr);
+    virtual ~WarmRestartImage(void);
+
+    // Store side: collect the maps, then write them in one sequential pass
+    virtual void AddMap(int mapId, MapHeader* mapHeader, Map* map);
+    virtual int Store(void);
+
+    // Load side: stream the image into memory, then hand each map out once
+    virtual int Load(void);
+    virtual bool Restore(int mapId, MapHeader* mapHeader, Map* map);
+    virtual uint32_t GetNumLoadedMaps(void);
+
+    static const uint64_t MAGIC = 0x5741524D494D4721; // "WARMIMG!"
+    static const uint32_t VERSION = 1;
+    static const uint64_t HEADER_SIZE = 4096;
+    static const uint64_t IO_CHUNK_SIZE = 8 * 1024 * 1024;
+
+private:
+    struct ImageHeader
+    {
+        uint64_t magic;
+        uint32_t version;
+        uint32_t numMaps;
+        uint64_t imageSize;
+    };
+
+    struct MapRecordHeader
+    {
+        int32_t mapId;
+        uint32_t reserved;
+        uint64_t age;
+        uint64_t numMpages;
+        uint64_t mpageSize;
+    };
+
+    struct MapSource
+    {
+        int mapId;
+        MapHeader* mapHeader;
+        Map* map;
+    };
+
+    struct MapRecord
+    {
+        uint64_t age;
+        uint64_t numMpages;
+        uint64_t mpageSize;
+        char* data;
+    };
+
+    int _OpenFile(uint64_t fileSize);
+    void _CloseFile(void);
+    int _Write(uint64_t& offset, char* staging, uint64_t& stagedSize, const char* src, uint64_t len);
+    int _Read(uint64_t offset, uint64_t len, char* buffer);
+    void _ClearRecords(void);
+
+    MapperAddressInfo* addrInfo;
+    MetaFileIntf* file;
+    std::vector<MapSource> sources;
+    std::map<int, MapRecord> records;
+    std::mutex recordLock;
+};
+
+} // namespace pos
@@ -36,9 +36,12 @@
 #include <tuple>
 
 #include "src/mapper/mapper.h"
+#include "src/mapper/map_flush_batch.h"
 #include "src/mapper/map_flushed_event.h"
+#include "src/mapper/map/warm_restart_image.h"
 #include "src/mapper/reversemap/reverse_map.h"
 #include "src/mapper_service/mapper_service.h"
+#include "src/master_context/config_manager.h"
 #include "src/sys_event/volume_event_publisher.h"
 #include "src/sys_event/volume_event.h"
 #include "src/telemetry/telemetry_client/telemetry_publisher.h"
@@ -57,6 +60,7 @@ Mapper::Mapper(TelemetryClient* tc_, TelemetryPublisher* tp_, MapperWbt* mapperW
   metaFs(metaFs_),
   tp(tp_),
   tc(tc_),
+  warmRestartImage(nullptr),
   isInitialized(false),
   numMapLoadedVol(0),
   numMountedVol(0)
@@ -102,6 +106,11 @@ Mapper::~Mapper(void)
 {
     POS_TRACE_INFO(EID(MAPPER_INFO), "[Mapper Destructor] in arrayId:{} was Destroyed", arrayId);
     _Dispose();
+    if (warmRestartImage != nullptr)
+    {
+        delete warmRestartImage;
+        warmRestartImage = nullptr;
+    }
     if (mapperWbt != nullptr)
     {
         delete mapperWbt;
@@ -140,7 +149,11 @@ Mapper::Dispose(void)
 {
     if (isInitialized == true)
     {
-        StoreAll();
+        int ret = StoreAll();
+        if ((ret == 0) && (warmRestartImage != nullptr))
+        {
+            _StoreWarmRestartImage();
+        }
         _Dispose();
 
         isInitialized = false;
@@ -179,6 +192,7 @@ Mapper::Init(void)
         }
         int mpageSize = _GetMpageSize();
         addrInfo->SetupAddressInfo(mpageSize);
+        _LoadWarmRestartImage();
         POS_TRACE_INFO(EID(MAPPER_INITIALIZE), "[Mapper Init] VsaMap Init, arrayId:{}", arrayId);
         ret = vsaMapManager->Init();
         if (ret < 0)
@@ -256,6 +270,27 @@ Mapper::FlushDirtyMpagesGiven(int volId, EventSmartPtr event, MpageList dirtyPag
     return vsaMapManager->FlushDirtyPagesGiven(volId, dirtyPages, event);
 }
 
+// Flushes the given maps as one batch: the callback is enqueued once, after the
+// last map of the batch has been flushed. The batch holds one extra count while
+// the flushes are being issued so that it can not complete early
+int
+Mapper::FlushDirtyMaps(const MapList& mapIds, EventSmartPtr callback)
+{
+    std::shared_ptr<MapFlushBatch> batch = std::make_shared<MapFlushBatch>(mapIds.size() + 1, callback);
+    for (auto mapId : mapIds)
+    {
+        EventSmartPtr mapFlushed = std::make_shared<MapBatchFlushedEvent>(batch);
+        int ret = FlushDirtyMpages(mapId, mapFlushed);
+        if (ret != 0)
+        {
+            POS_TRACE_ERROR(EID(MAP_FLUSH_FAILED), "[Mapper FlushDirtyMaps] mapId:{}, numMaps:{}, arrayId:{}", mapId, mapIds.size(), arrayId);
+            return ret;
+        }
+    }
+    batch->MapFlushed();
+    return 0;
+}
+
 int
 Mapper::StoreAll(void)
 {
@@ -280,6 +315,24 @@ Mapper::StoreAll(void)
     return ret;
 }
 
+// Number of mpages touched since their last flush, summed over the stripe map
+// and the vsa maps of mounted volumes. The count is read without stopping the
+// writers, so it is only an estimate of the pages the next checkpoint flushes
+uint64_t
+Mapper::GetNumDirtyMpages(void)
+{
+    uint64_t numDirtyMpages = stripeMapManager->GetStripeMapContent()->GetNumDirtyPages();
+    for (int volId = 0; volId < MAX_VOLUME_COUNT; volId++)
+    {
+        VolState state = volState[volId].GetState();
+        if ((state == BACKGROUND_MOUNTED) || (state == FOREGROUND_MOUNTED))
+        {
+            numDirtyMpages += vsaMapManager->GetVSAMapContent(volId)->GetNumDirtyPages();
+        }
+    }
+    return numDirtyMpages;
+}
+
 int
 Mapper::EnableInternalAccess(int volId)
 {
@@ -386,6 +439,22 @@ Mapper::SetVSAsWithSyncOpen(int volId, BlkAddr startRba, VirtualBlks& virtualBlk
     return vsaMapManager->SetVSAsWoCond(volId, startRba, virtualBlks);
 }
 
+int
+Mapper::UnmapVSAsWithSyncOpen(int volId, BlkAddr startRba, uint64_t numBlks, std::vector<VirtualBlks>& oldBlks)
+{
+    int ret = EnableInternalAccess(volId);
+    if (ret < 0)
+    {
+        POS_TRACE_ERROR(EID(VSAMAP_LOAD_FAILURE), "[Mapper UnmapVSAsWithSyncOpen] Failed to Load VolumeId:{} arrayId:{}", volId, arrayId);
+        return ret;
+    }
+    if (ret == NEED_RETRY)
+    {
+        vsaMapManager->WaitVolumePendingIoDone(volId);
+    }
+    return vsaMapManager->UnmapVSAsWoCond(volId, startRba, numBlks, oldBlks);
+}
+
 MpageList
 Mapper::GetDirtyVsaMapPages(int volId, BlkAddr startRba, uint64_t numBlks)
 {
@@ -398,12 +467,24 @@ Mapper::GetVSAs(int volId, BlkAddr startRba, uint32_t numBlks, VsaArray& vsaArra
     return vsaMapManager->GetVSAs(volId, startRba, numBlks, vsaArray);
 }
 
+int
+Mapper::GetVsaExtents(int volId, BlkAddr startRba, uint32_t numBlks, VsaExtentArray& extents, uint32_t& numExtents)
+{
+    return vsaMapManager->GetVsaExtents(volId, startRba, numBlks, extents, numExtents);
+}
+
 int
 Mapper::SetVSAs(int volId, BlkAddr startRba, VirtualBlks& virtualBlks)
 {
     return vsaMapManager->SetVSAs(volId, startRba, virtualBlks);
 }
 
+int
+Mapper::UnmapVSAs(int volId, BlkAddr startRba, uint64_t numBlks, std::vector<VirtualBlks>& oldBlks)
+{
+    return vsaMapManager->UnmapVSAs(volId, startRba, numBlks, oldBlks);
+}
+
 VirtualBlkAddr
 Mapper::GetRandomVSA(BlkAddr rba)
 {
@@ -448,6 +529,12 @@ Mapper::VolumeCreated(int volId, uint64_t volSizeByte)
         return EID(VOL_EVENT_FAIL);
     }
 
+    if (vsaMapManager->ReserveMapCapacity(volId, volSizeByte) != 0)
+    {
+        POS_TRACE_ERROR(EID(MAPPER_FAILED), "[Mapper VolumeCreate] failed to reserve the map capacity of VolumeId:{} arrayId:{}", volId, addrInfo->GetArrayId());
+        return EID(VOL_EVENT_FAIL);
+    }
+
     if (vsaMapManager->CreateVsaMapContent(nullptr, volId, volSizeByte, false) != 0)
     {
         POS_TRACE_ERROR(EID(MAPPER_FAILED), "[Mapper VolumeCreate] failed to create vsaMap VolumeId:{} arrayId:{}", volId, addrInfo->GetArrayId());
@@ -510,6 +597,29 @@ Mapper::VolumeLoaded(int volId, uint64_t volSizeByte)
     return EID(VOL_EVENT_OK);
 }
 
+// The map is sized for its capacity from the start, so the volume grows in place
+// while I/O continues. The size is what the map is loaded with at the next mount
+int
+Mapper::VolumeResized(int volId, uint64_t volSizeByte)
+{
+    POS_TRACE_INFO(EID(MAPPER_INFO), "[Mapper VolumeResized] RESIZE_VOLUME Volume:{} size:{} arrayId:{}", volId, volSizeByte, arrayId);
+    std::unique_lock<std::mutex> lock(volState[volId].GetVolStateLock());
+    VolState state = volState[volId].GetState();
+    uint64_t curSizeByte = volState[volId].GetSize();
+    if ((state == VolState::NOT_EXIST) || (state == VolState::VOLUME_DELETING) || (volSizeByte < curSizeByte))
+    {
+        POS_TRACE_ERROR(EID(MAPPER_FAILED), "[Mapper VolumeResized] failed to resize VolumeId:{} arrayId:{}, state:{}, size:{}", volId, arrayId, state, curSizeByte);
+        return EID(VOL_EVENT_FAIL);
+    }
+
+    if (vsaMapManager->GrowVSAMap(volId, curSizeByte, volSizeByte) != 0)
+    {
+        return EID(VOL_EVENT_FAIL);
+    }
+    volState[volId].SetSize(volSizeByte);
+    return EID(VOL_EVENT_OK);
+}
+
 int
 Mapper::VolumeUnmounted(int volId, bool flushMapRequired)
 {
@@ -617,6 +727,37 @@ Mapper::DeleteVolumeMap(int volId)
     return 0;
 }
 
+int
+Mapper::DetachVolumeMap(int volId)
+{
+    int ret = vsaMapManager->DetachVSAMap(volId);
+    if (ret != 0)
+    {
+        POS_TRACE_WARN(EID(VSAMAP_GENERATION_FAILURE), "[Mapper VolumeDeleted] failed to detach VSA Map, volumeID:{} arrayId:{} ret:{}", volId, arrayId, ret);
+        return ret;
+    }
+    volState[volId].SetState(VolState::NOT_EXIST);
+    return 0;
+}
+
+bool
+Mapper::CollectDetachedBlocks(int volId, uint64_t& mpageId, uint32_t numMpages, std::vector<VirtualBlks>& validBlks)
+{
+    return vsaMapManager->CollectDetachedBlocks(volId, mpageId, numMpages, validBlks);
+}
+
+int
+Mapper::DeleteDetachedMap(int volId)
+{
+    return vsaMapManager->DeleteDetachedMap(volId);
+}
+
+std::vector<int>
+Mapper::GetDetachedVolumes(void)
+{
+    return vsaMapManager->GetDetachedVolumes();
+}
+
 int
 Mapper::VolumeDetached(vector<int> volList)
 {
@@ -664,6 +805,12 @@ Mapper::_Dispose(void)
         reverseMapManager->Dispose();
         _UnregisterFromMapperService();
         _ClearVolumeState();
+        if (warmRestartImage != nullptr)
+        {
+            addrInfo->SetWarmRestartImage(nullptr);
+            delete warmRestartImage;
+            warmRestartImage = nullptr;
+        }
         if ((addrInfo->IsUT() == false) && (tp != nullptr))
         {
             TelemetryClientSingleton::Instance()->DeregisterPublisher(tp->GetName());
@@ -768,4 +915,45 @@ Mapper::_GetMpageSize(void)
     return mpageSize;
 }
 
+bool
+Mapper::_IsWarmRestartEnabled(void)
+{
+    bool enabled = false;
+    int ret = ConfigManagerSingleton::Instance()->GetValue("mapper", "warm_restart_enable", &enabled, ConfigType::CONFIG_TYPE_BOOL);
+    return ((ret == 0) && (enabled == true));
+}
+
+// The maps loaded after this point take their mpages from the image when their
+// map file has not been written since the image was stored
+void
+Mapper::_LoadWarmRestartImage(void)
+{
+    if (_IsWarmRestartEnabled() == false)
+    {
+        return;
+    }
+    if (warmRestartImage == nullptr)
+    {
+        warmRestartImage = new WarmRestartImage(addrInfo);
+    }
+    if (warmRestartImage->Load() == 0)
+    {
+        addrInfo->SetWarmRestartImage(warmRestartImage);
+    }
+}
+
+// Called after StoreAll() succeeded, so every map in the image matches its file
+void
+Mapper::_StoreWarmRestartImage(void)
+{
+    addrInfo->SetWarmRestartImage(nullptr);
+    stripeMapManager->AddToWarmRestartImage(warmRestartImage);
+    vsaMapManager->AddToWarmRestartImage(warmRestartImage);
+    int ret = warmRestartImage->Store();
+    if (ret < 0)
+    {
+        POS_TRACE_WARN(EID(MAPPER_FAILED), "[Mapper Dispose] Next mount loads the maps from their files, arrayId:{}", arrayId);
+    }
+}
+
 } // namespace pos
@@ -54,6 +54,7 @@ class IStateControl;
 class MetaFs;
 class TelemetryPublisher;
 class TelemetryClient;
+class WarmRestartImage;
 
 enum VolState
 {
@@ -127,13 +128,19 @@ public:
     virtual int VolumeCreated(int volId, uint64_t volSizeByte) override;
     virtual int VolumeMounted(int volId, uint64_t volSizeByte) override;
     virtual int VolumeLoaded(int volId, uint64_t volSizeByte) override;
+    virtual int VolumeResized(int volId, uint64_t volSizeByte) override;
     virtual int VolumeUnmounted(int volId, bool flushMapRequired) override;
     virtual int PrepareVolumeDelete(int volId) override;
     virtual int InvalidateAllBlocksTo(int volId, ISegmentCtx* segmentCtx) override;
     virtual int DeleteVolumeMap(int volumeId) override;
+    virtual int DetachVolumeMap(int volId) override;
+    virtual bool CollectDetachedBlocks(int volId, uint64_t& mpageId, uint32_t numMpages, std::vector<VirtualBlks>& validBlks) override;
+    virtual int DeleteDetachedMap(int volId) override;
+    virtual std::vector<int> GetDetachedVolumes(void) override;
     virtual int VolumeDetached(vector<int> volList) override;
 
     virtual int GetVSAs(int volId, BlkAddr startRba, uint32_t numBlks, VsaArray& vsaArray);
+    virtual int GetVsaExtents(int volId, BlkAddr startRba, uint32_t numBlks, VsaExtentArray& extents, uint32_t& numExtents);
     virtual int SetVSAs(int volId, BlkAddr startRba, VirtualBlks& virtualBlks);
     virtual VirtualBlkAddr GetRandomVSA(BlkAddr rba);
     virtual int64_t GetNumUsedBlks(int volId);
@@ -141,12 +148,16 @@ public:
     virtual int SetVSAsInternal(int volId, BlkAddr startRba, VirtualBlks& virtualBlks);
     virtual VirtualBlkAddr GetVSAWithSyncOpen(int volId, BlkAddr rba);
     virtual int SetVSAsWithSyncOpen(int volId, BlkAddr startRba, VirtualBlks& virtualBlks);
+    virtual int UnmapVSAs(int volId, BlkAddr startRba, uint64_t numBlks, std::vector<VirtualBlks>& oldBlks);
+    virtual int UnmapVSAsWithSyncOpen(int volId, BlkAddr startRba, uint64_t numBlks, std::vector<VirtualBlks>& oldBlks);
     virtual MpageList GetDirtyVsaMapPages(int volId, BlkAddr startRba, uint64_t numBlks);
 
     virtual int EnableInternalAccess(int volId);
     virtual int FlushDirtyMpages(int mapId, EventSmartPtr callback);
     virtual int FlushDirtyMpagesGiven(int mapId, EventSmartPtr callback, MpageList dirtyPages);
+    virtual int FlushDirtyMaps(const MapList& mapIds, EventSmartPtr callback);
     virtual int StoreAll(void);
+    virtual uint64_t GetNumDirtyMpages(void);
 
     virtual void SetVolumeState(int volId, VolState state, uint64_t size); // for UT
 
@@ -158,6 +169,9 @@ private:
     void _ClearVolumeState(void);
     bool _ChangeVolumeStateDeleting(int volId);
     int _GetMpageSize(void);
+    bool _IsWarmRestartEnabled(void);
+    void _LoadWarmRestartImage(void);
+    void _StoreWarmRestartImage(void);
 
     MapperAddressInfo* addrInfo;
     VSAMapManager* vsaMapManager;
@@ -167,6 +181,7 @@ private:
     MetaFs* metaFs;
     TelemetryPublisher* tp;
     TelemetryClient* tc;
+    WarmRestartImage* warmRestartImage;
 
     bool isInitialized;
     VolumeMountState volState[MAX_VOLUME_COUNT];
@@ -121,6 +121,30 @@ ReverseMapPack::GetReverseMapEntry(uint64_t offset)
     return std::make_tuple(rba, volumeId);
 }
 
+void
+ReverseMapPack::SetReverseMapChecksum(uint64_t offset, uint32_t checksum)
+{
+    uint32_t pageIndex;
+    uint32_t sectorIndex;
+    uint32_t entryIndex;
+    std::tie(pageIndex, sectorIndex, entryIndex) = _ReverseMapGeometry(offset);
+
+    RevMapEntry& entry = revMaps[pageIndex]->sector[sectorIndex].u.body.entry[entryIndex];
+    entry.u.entry.checksum = checksum;
+}
+
+uint32_t
+ReverseMapPack::GetReverseMapChecksum(uint64_t offset)
+{
+    uint32_t pageIndex;
+    uint32_t sectorIndex;
+    uint32_t entryIndex;
+    std::tie(pageIndex, sectorIndex, entryIndex) = _ReverseMapGeometry(offset);
+
+    RevMapEntry& entry = revMaps[pageIndex]->sector[sectorIndex].u.body.entry[entryIndex];
+    return entry.u.entry.checksum;
+}
+
 std::vector<ReverseMapPage>
 ReverseMapPack::GetReverseMapPages(void)
 {
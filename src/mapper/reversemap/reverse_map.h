@@ -68,6 +68,11 @@ ReservedBit(int usedBit)
     return REVMAP_ENTRY_SIZE * 8 - usedBit;
 }
 
+// The bits left in an entry keep the low bits of the block checksum.
+// A pack is filled with 0xFF, so all ones means no checksum is recorded
+const int REVMAP_CHECKSUM_BIT = ReservedBit(BLOCK_ADDR_BIT_LEN + VOLUME_ID_BIT); // 22
+const uint32_t NO_REVMAP_CHECKSUM = (1u << REVMAP_CHECKSUM_BIT) - 1;
+
 enum class ACTION
 {
     OPEN,
@@ -84,7 +89,7 @@ struct RevMapEntry
         {
             BlkAddr rba;                                                         // 8 B
             uint32_t volumeId : VOLUME_ID_BIT;                                   // 10 b
-            uint32_t reserved : ReservedBit(BLOCK_ADDR_BIT_LEN + VOLUME_ID_BIT); // 22 b
+            uint32_t checksum : REVMAP_CHECKSUM_BIT;                             // 22 b
         } entry;
     } u;
 };
@@ -141,6 +146,8 @@ public:
 
     virtual int SetReverseMapEntry(uint64_t offset, BlkAddr rba, uint32_t volumeId);
     virtual std::tuple<BlkAddr, uint32_t> GetReverseMapEntry(uint64_t offset);
+    virtual void SetReverseMapChecksum(uint64_t offset, uint32_t checksum);
+    virtual uint32_t GetReverseMapChecksum(uint64_t offset);
 
     virtual std::vector<ReverseMapPage> GetReverseMapPages(void);
     virtual int HeaderLoaded(void);
@@ -0,0 +1,249 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/mapper/reversemap/reverse_map_cache.h"
+
+#include <cstring>
+#include <tuple>
+
+#include "src/include/meta_const.h"
+
+namespace pos
+{
+const uint32_t ReverseMapCache::INVALID_REVMAP_VOLUME_ID;
+
+ReverseMapCache::ReverseMapCache(uint64_t capacity_, uint64_t numEntriesPerStripe_, uint64_t bytesPerStripe_)
+: capacity(capacity_),
+  numEntriesPerStripe(numEntriesPerStripe_),
+  bytesPerStripe(bytesPerStripe_),
+  numHits(0),
+  numMisses(0),
+  numRuns(0),
+  numChecksums(0)
+{
+}
+
+void
+ReverseMapCache::Store(ReverseMapPack* rev)
+{
+    if (capacity == 0)
+    {
+        return;
+    }
+
+    // encode outside of the lock; the pack is not modified while it is flushed
+    CachedPack cached;
+    _Encode(rev, cached);
+
+    std::lock_guard<std::mutex> guard(lock);
+    auto it = index.find(cached.vsid);
+    if (it != index.end())
+    {
+        _Erase(it);
+    }
+    while (lru.size() >= capacity)
+    {
+        _Erase(index.find(lru.back().vsid));
+    }
+
+    numRuns += cached.runs.size();
+    numChecksums += cached.checksums.size();
+    lru.push_front(std::move(cached));
+    index[lru.front().vsid] = lru.begin();
+}
+
+bool
+ReverseMapCache::Restore(ReverseMapPack* rev)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    auto it = index.find(rev->GetVsid());
+    if (it == index.end())
+    {
+        numMisses++;
+        return false;
+    }
+
+    lru.splice(lru.begin(), lru, it->second);
+    _Decode(*(it->second), rev);
+    numHits++;
+    return true;
+}
+
+void
+ReverseMapCache::Invalidate(StripeId vsid)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    auto it = index.find(vsid);
+    if (it != index.end())
+    {
+        _Erase(it);
+    }
+}
+
+void
+ReverseMapCache::InvalidateAll(void)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    lru.clear();
+    index.clear();
+    numRuns = 0;
+    numChecksums = 0;
+}
+
+bool
+ReverseMapCache::GetChecksum(StripeId vsid, uint64_t offset, uint32_t& checksum)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    auto it = index.find(vsid);
+    if (it == index.end())
+    {
+        return false;
+    }
+    const CachedPack& cached = *(it->second);
+    if (offset >= cached.checksums.size() || cached.checksums[offset] == NO_REVMAP_CHECKSUM)
+    {
+        return false;
+    }
+    checksum = cached.checksums[offset];
+    return true;
+}
+
+ReverseMapCacheStats
+ReverseMapCache::GetStats(void)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    ReverseMapCacheStats stats;
+    stats.numHits = numHits;
+    stats.numMisses = numMisses;
+    stats.savedBytes = numHits * bytesPerStripe;
+    stats.numCachedPacks = lru.size();
+    stats.encodedBytes = lru.size() * REVMAP_SECTOR_SIZE + numRuns * sizeof(RevMapRun) +
+        numChecksums * sizeof(uint32_t);
+    return stats;
+}
+
+void
+ReverseMapCache::_Erase(std::unordered_map<StripeId, LruList::iterator>::iterator it)
+{
+    numRuns -= it->second->runs.size();
+    numChecksums -= it->second->checksums.size();
+    lru.erase(it->second);
+    index.erase(it);
+}
+
+bool
+ReverseMapCache::_IsWritten(BlkAddr rba, uint32_t volumeId)
+{
+    // a fresh pack is filled with 0xFF
+    return (rba != INVALID_RBA) || (volumeId != INVALID_REVMAP_VOLUME_ID);
+}
+
+void
+ReverseMapCache::_Encode(ReverseMapPack* rev, CachedPack& cached)
+{
+    cached.vsid = rev->GetVsid();
+    memcpy(cached.header, rev->GetReverseMapPages()[0].buffer, REVMAP_SECTOR_SIZE);
+
+    bool hasChecksum = false;
+    for (uint64_t offset = 0; offset < numEntriesPerStripe; offset++)
+    {
+        uint32_t checksum = rev->GetReverseMapChecksum(offset);
+        if (checksum != NO_REVMAP_CHECKSUM && hasChecksum == false)
+        {
+            cached.checksums.assign(numEntriesPerStripe, NO_REVMAP_CHECKSUM);
+            hasChecksum = true;
+        }
+        if (hasChecksum)
+        {
+            cached.checksums[offset] = checksum;
+        }
+
+        BlkAddr rba;
+        uint32_t volumeId;
+        std::tie(rba, volumeId) = rev->GetReverseMapEntry(offset);
+
+        if (cached.runs.empty() == false)
+        {
+            RevMapRun& last = cached.runs.back();
+            bool extendsLast = false;
+            if (_IsWritten(rba, volumeId) == false)
+            {
+                extendsLast = (_IsWritten(last.startRba, last.volumeId) == false);
+            }
+            else
+            {
+                extendsLast = _IsWritten(last.startRba, last.volumeId) &&
+                    (last.volumeId == volumeId) && (last.startRba + last.numEntries == rba);
+            }
+            if (extendsLast)
+            {
+                last.numEntries++;
+                continue;
+            }
+        }
+        cached.runs.push_back({.startRba = rba, .volumeId = volumeId, .numEntries = 1});
+    }
+}
+
+void
+ReverseMapCache::_Decode(const CachedPack& cached, ReverseMapPack* rev)
+{
+    std::vector<ReverseMapPage> pages = rev->GetReverseMapPages();
+    for (auto& page : pages)
+    {
+        memset(page.buffer, 0xFF, page.length);
+    }
+    memcpy(pages[0].buffer, cached.header, REVMAP_SECTOR_SIZE);
+
+    uint64_t offset = 0;
+    for (auto& run : cached.runs)
+    {
+        if (_IsWritten(run.startRba, run.volumeId) == false)
+        {
+            offset += run.numEntries;
+            continue;
+        }
+        for (uint32_t idx = 0; idx < run.numEntries; idx++)
+        {
+            rev->SetReverseMapEntry(offset++, run.startRba + idx, run.volumeId);
+        }
+    }
+    for (offset = 0; offset < cached.checksums.size(); offset++)
+    {
+        if (cached.checksums[offset] != NO_REVMAP_CHECKSUM)
+        {
+            rev->SetReverseMapChecksum(offset, cached.checksums[offset]);
+        }
+    }
+}
+
+} // namespace pos
@@ -0,0 +1,112 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "src/include/address_type.h"
+#include "src/mapper/reversemap/reverse_map.h"
+
+namespace pos
+{
+// Run of reverse map entries whose RBAs are consecutive within one volume.
+// Entries never written since the pack was allocated are kept as a run of
+// INVALID_REVMAP_VOLUME_ID with startRba == INVALID_RBA
+struct RevMapRun
+{
+    BlkAddr startRba;
+    uint32_t volumeId;
+    uint32_t numEntries;
+};
+
+struct ReverseMapCacheStats
+{
+    uint64_t numHits;
+    uint64_t numMisses;
+    uint64_t savedBytes;
+    uint64_t numCachedPacks;
+    uint64_t encodedBytes;
+};
+
+// LRU cache of recently flushed reverse map packs, keyed by vsid. Flushed packs
+// are kept delta encoded so that loading a young stripe (e.g. by GC) can be
+// served from memory instead of reading the whole pack from the metafs file.
+class ReverseMapCache
+{
+public:
+    ReverseMapCache(uint64_t capacity, uint64_t numEntriesPerStripe, uint64_t bytesPerStripe);
+    virtual ~ReverseMapCache(void) = default;
+
+    virtual void Store(ReverseMapPack* rev);
+    virtual bool Restore(ReverseMapPack* rev);
+    virtual void Invalidate(StripeId vsid);
+    virtual void InvalidateAll(void);
+    virtual bool GetChecksum(StripeId vsid, uint64_t offset, uint32_t& checksum);
+    virtual ReverseMapCacheStats GetStats(void);
+
+    static const uint32_t INVALID_REVMAP_VOLUME_ID = (1 << VOLUME_ID_BIT) - 1;
+
+private:
+    struct CachedPack
+    {
+        StripeId vsid;
+        uint8_t header[REVMAP_SECTOR_SIZE];
+        std::vector<RevMapRun> runs;
+        // per-entry block checksums, left empty when none is recorded
+        std::vector<uint32_t> checksums;
+    };
+    using LruList = std::list<CachedPack>;
+
+    void _Encode(ReverseMapPack* rev, CachedPack& cached);
+    void _Decode(const CachedPack& cached, ReverseMapPack* rev);
+    bool _IsWritten(BlkAddr rba, uint32_t volumeId);
+    void _Erase(std::unordered_map<StripeId, LruList::iterator>::iterator it);
+
+    std::mutex lock;
+    LruList lru;
+    std::unordered_map<StripeId, LruList::iterator> index;
+    uint64_t capacity;
+    uint64_t numEntriesPerStripe;
+    uint64_t bytesPerStripe;
+
+    uint64_t numHits;
+    uint64_t numMisses;
+    uint64_t numRuns;
+    uint64_t numChecksums;
+};
+
+} // namespace pos
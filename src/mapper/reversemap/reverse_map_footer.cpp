@@ -0,0 +1,181 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "src/mapper/reversemap/reverse_map_footer.h"
+
+#include <cstring>
+#include <vector>
+
+#include "src/event_scheduler/event_scheduler.h"
+#include "src/include/branch_prediction.h"
+#include "src/include/memory.h"
+#include "src/include/pos_event_id.h"
+#include "src/logger/logger.h"
+#include "src/master_context/config_manager.h"
+
+namespace pos
+{
+bool
+ReverseMapFooter::IsEnabled(void)
+{
+    static bool enabled = LoadConfig(ConfigManagerSingleton::Instance());
+    return enabled;
+}
+
+bool
+ReverseMapFooter::LoadConfig(ConfigManager* configManager)
+{
+    bool enabled = false;
+    int ret = configManager->GetValue("mapper", "reverse_map_in_stripe_footer",
+        &enabled, CONFIG_TYPE_BOOL);
+    if (ret != EID(SUCCESS) || false == enabled)
+    {
+        return false;
+    }
+
+    POS_TRACE_INFO(EID(REVMAP_INITIALIZED),
+        "Reverse maps are written in the footer blocks of their stripes");
+    return true;
+}
+
+uint32_t
+ReverseMapFooter::GetNumMpages(uint32_t blksPerStripe, uint64_t mpageSize)
+{
+    uint32_t entriesPerNormalPage = (mpageSize / REVMAP_SECTOR_SIZE) * (REVMAP_SECTOR_SIZE / REVMAP_ENTRY_SIZE);
+    uint32_t entriesPerFirstPage = entriesPerNormalPage - (REVMAP_SECTOR_SIZE / REVMAP_ENTRY_SIZE);
+
+    if (blksPerStripe <= entriesPerFirstPage)
+    {
+        return 1;
+    }
+    return 1 + DivideUp(blksPerStripe - entriesPerFirstPage, entriesPerNormalPage);
+}
+
+uint32_t
+ReverseMapFooter::GetBlockCount(uint32_t blksPerStripe)
+{
+    if (false == IsEnabled())
+    {
+        return 0;
+    }
+    return GetNumMpages(blksPerStripe, DEFAULT_REVMAP_PAGE_SIZE);
+}
+
+void
+ReverseMapFooter::Store(ReverseMapPack* revMapPack, uint32_t blksPerStripe,
+    const std::function<char*(uint32_t)>& blockOf)
+{
+    std::vector<ReverseMapPage> pages = revMapPack->GetReverseMapPages();
+    uint32_t footerOffset = blksPerStripe - pages.size();
+    for (uint32_t index = 0; index < pages.size(); index++)
+    {
+        char* block = blockOf(footerOffset + index);
+        memcpy(block, pages[index].buffer, pages[index].length);
+        memset(block + pages[index].length, 0xFF, BLOCK_SIZE - pages[index].length);
+    }
+}
+
+void
+ReverseMapFooter::Restore(ReverseMapPack* revMapPack, const char* footer)
+{
+    std::vector<ReverseMapPage> pages = revMapPack->GetReverseMapPages();
+    for (uint32_t index = 0; index < pages.size(); index++)
+    {
+        memcpy(pages[index].buffer, footer + index * BLOCK_SIZE, pages[index].length);
+    }
+}
+
+ReverseMapFooterLoadCompletion::ReverseMapFooterLoadCompletion(ReverseMapPack* revMapPack,
+    void* buffer, EventSmartPtr callback, std::function<void(void)> notifyLoadDone,
+    EventScheduler* eventScheduler)
+: Callback(false, CallbackType_ReverseMapFooterLoadCompletion),
+  revMapPack(revMapPack),
+  buffer(buffer),
+  callback(callback),
+  notifyLoadDone(notifyLoadDone),
+  eventScheduler(eventScheduler)
+{
+    if (nullptr == this->eventScheduler)
+    {
+        this->eventScheduler = EventSchedulerSingleton::Instance();
+    }
+}
+
+ReverseMapFooterLoadCompletion::~ReverseMapFooterLoadCompletion(void)
+{
+    Memory<BLOCK_SIZE>::Free(buffer);
+}
+
+bool
+ReverseMapFooterLoadCompletion::_DoSpecificJob(void)
+{
+    if (unlikely(0 != _GetErrorCount()))
+    {
+        POS_TRACE_ERROR(EID(REVMAP_IO_ERROR),
+            "Failed to read the reverse map footer, vsid:{}", revMapPack->GetVsid());
+        _InformErrorToCallback(_GetMostCriticalError());
+    }
+    else
+    {
+        ReverseMapFooter::Restore(revMapPack, static_cast<char*>(buffer));
+        int ret = revMapPack->HeaderLoaded();
+        if (ret < 0)
+        {
+            POS_TRACE_ERROR(EID(REVMAP_IO_ERROR),
+                "Wrong reverse map footer, vsid:{}", revMapPack->GetVsid());
+            _InformErrorToCallback(IOErrorType::GENERIC_ERROR);
+        }
+    }
+
+    if (notifyLoadDone != nullptr)
+    {
+        notifyLoadDone();
+    }
+    if (callback != nullptr)
+    {
+        eventScheduler->EnqueueEvent(callback);
+    }
+    return true;
+}
+
+void
+ReverseMapFooterLoadCompletion::_InformErrorToCallback(IOErrorType errorType)
+{
+    CallbackSmartPtr callbackToInform = std::dynamic_pointer_cast<Callback>(callback);
+    if (callbackToInform != nullptr)
+    {
+        callbackToInform->InformError(errorType);
+    }
+}
+
+} // namespace pos
@@ -0,0 +1,90 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+#include "src/event_scheduler/callback.h"
+#include "src/mapper/reversemap/reverse_map.h"
+
+namespace pos
+{
+class ConfigManager;
+class EventScheduler;
+
+// With "reverse_map_in_stripe_footer", the last blocks of every user stripe
+// keep the reverse map of the stripe, one mpage per block. The footer size is
+// stored in the allocator context when the array is created, and an array is
+// not mounted with a different configuration. They are never
+// allocated to writes, and go to the ssds in the same write as the data and
+// parity of the stripe, so that no metafs write is issued for the pack.
+class ReverseMapFooter
+{
+public:
+    static bool IsEnabled(void);
+    static bool LoadConfig(ConfigManager* configManager);
+
+    static uint32_t GetNumMpages(uint32_t blksPerStripe, uint64_t mpageSize);
+    static uint32_t GetBlockCount(uint32_t blksPerStripe);
+
+    // blockOf returns the buffer of a block given its offset in the stripe
+    static void Store(ReverseMapPack* revMapPack, uint32_t blksPerStripe,
+        const std::function<char*(uint32_t)>& blockOf);
+    static void Restore(ReverseMapPack* revMapPack, const char* footer);
+};
+
+// Fills a reverse map pack from its footer blocks read from the ssds. The
+// buffer is released with the completion. A failed read or a broken footer is
+// passed on to the callback as an error, the pack is left as it is then.
+class ReverseMapFooterLoadCompletion : public Callback
+{
+public:
+    ReverseMapFooterLoadCompletion(ReverseMapPack* revMapPack, void* buffer,
+        EventSmartPtr callback, std::function<void(void)> notifyLoadDone,
+        EventScheduler* eventScheduler = nullptr);
+    ~ReverseMapFooterLoadCompletion(void) override;
+
+private:
+    bool _DoSpecificJob(void) override;
+    void _InformErrorToCallback(IOErrorType errorType);
+
+    ReverseMapPack* revMapPack;
+    void* buffer;
+    EventSmartPtr callback;
+    std::function<void(void)> notifyLoadDone;
+    EventScheduler* eventScheduler;
+};
+
+} // namespace pos
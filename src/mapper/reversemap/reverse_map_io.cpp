@@ -13,6 +13,7 @@ ReverseMapIo::ReverseMapIo(ReverseMapPack* pack, EventSmartPtr clientCallback,
     TelemetryPublisher* tp, EventScheduler* es,
     std::function<void(ReverseMapIo*)> notify)
 : revMapPack(pack),
+  vsid(pack->GetVsid()),
   ioError(0),
   ioDirection(direction),
   fileOffset(offset),
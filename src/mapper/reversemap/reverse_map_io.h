@@ -46,11 +46,20 @@ public:
     {
         return ioDirection;
     }
+    virtual int GetIoError(void)
+    {
+        return ioError;
+    }
+    virtual StripeId GetVsid(void)
+    {
+        return vsid;
+    }
 
 private:
     void _RevMapPageIoDone(AsyncMetaFileIoCtx* ctx);
 
     ReverseMapPack* revMapPack;
+    StripeId vsid;
     int ioError;
     IoDirection ioDirection;
     uint64_t fileOffset;
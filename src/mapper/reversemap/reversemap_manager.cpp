@@ -37,9 +37,14 @@
 #include <tuple>
 #include <utility>
 
+#include "src/array/ft/buffer_entry.h"
 #include "src/array_mgmt/array_manager.h"
+#include "src/include/memory.h"
 #include "src/include/meta_const.h"
+#include "src/io_submit_interface/i_io_submit_handler.h"
+#include "src/mapper/reversemap/reverse_map_footer.h"
 #include "src/mapper/reversemap/reverse_map_io.h"
+#include "src/master_context/config_manager.h"
 #include "src/meta_file_intf/mock_file_intf.h"
 #include "src/meta_file_intf/rocksdb_metafs_intf.h"
 #include "src/metafs/config/metafs_config_manager.h"
@@ -49,11 +54,15 @@
 
 namespace pos
 {
+const uint64_t ReverseMapManager::DEFAULT_REVERSE_MAP_CACHE_ENTRIES;
+
 ReverseMapManager::ReverseMapManager(IVSAMap* ivsaMap, IStripeMap* istripeMap, IVolumeInfoManager* vol, MapperAddressInfo* addrInfo_, TelemetryPublisher* tp)
 : numMpagesPerStripe(0),
+  numFooterBlks(0),
   fileSizePerStripe(0),
   fileSizeWholeRevermap(0),
   revMapWholefile(nullptr),
+  revMapCache(nullptr),
   iVSAMap(ivsaMap),
   iStripeMap(istripeMap),
   volumeManager(vol),
@@ -84,6 +93,7 @@ ReverseMapManager::~ReverseMapManager(void)
         delete revMapWholefile;
         revMapWholefile = nullptr;
     }
+    _DeleteReverseMapCache();
 }
 // LCOV_EXCL_STOP
 void
@@ -95,6 +105,8 @@ ReverseMapManager::Init(void)
     }
 
     _SetNumMpages();
+    _SetFooterBlks();
+    _CreateReverseMapCache();
 
     // Create MFS and Open the file for whole reverse map
     if (addrInfo->IsUT() == false)
@@ -143,6 +155,7 @@ ReverseMapManager::Dispose(void)
         delete revMapWholefile;
         revMapWholefile = nullptr;
     }
+    _DeleteReverseMapCache();
 }
 
 uint64_t
@@ -155,6 +168,25 @@ int
 ReverseMapManager::Load(ReverseMapPack* rev, EventSmartPtr cb)
 {
     assert(rev != nullptr);
+    if ((revMapCache != nullptr) && revMapCache->Restore(rev))
+    {
+        int ret = rev->HeaderLoaded();
+        if (ret < 0)
+        {
+            return ret;
+        }
+        if (cb != nullptr)
+        {
+            EventSchedulerSingleton::Instance()->EnqueueEvent(cb);
+        }
+        return 0;
+    }
+
+    if (numFooterBlks != 0)
+    {
+        return _LoadFromFooter(rev, cb);
+    }
+
     ReverseMapIo* reverseMapLoadContext = _CreateIoContext(rev, cb, IoDirection::IO_LOAD);
 
     counts[IoDirection::IO_LOAD].issuedCount++;
@@ -166,11 +198,86 @@ int
 ReverseMapManager::Flush(ReverseMapPack* rev, EventSmartPtr cb)
 {
     assert(rev != nullptr);
+    if (numFooterBlks != 0)
+    {
+        return _FlushToFooter(rev, cb);
+    }
+
     ReverseMapIo* reverseMapFlushContext = _CreateIoContext(rev, cb, IoDirection::IO_FLUSH);
 
     counts[IoDirection::IO_FLUSH].issuedCount++;
 
-    return reverseMapFlushContext->Flush();
+    // the pack is cached as soon as its flush is issued, so that a load racing
+    // with the flush sees the same contents the flush is writing
+    if (revMapCache != nullptr)
+    {
+        revMapCache->Store(rev);
+        _PublishReverseMapCacheStats();
+    }
+
+    StripeId vsid = rev->GetVsid();
+    int ret = reverseMapFlushContext->Flush();
+    if ((ret < 0) && (revMapCache != nullptr))
+    {
+        revMapCache->Invalidate(vsid);
+    }
+    return ret;
+}
+
+int
+ReverseMapManager::_LoadFromFooter(ReverseMapPack* rev, EventSmartPtr cb)
+{
+    StripeId vsid = rev->GetVsid();
+    StripeAddr lsa = iStripeMap->GetLSA(vsid);
+    if (iStripeMap->IsInUserDataArea(lsa) == false)
+    {
+        POS_TRACE_ERROR(EID(REVMAP_IO_ERROR),
+            "The footer of a stripe in the write buffer cannot be read, vsid:{}", vsid);
+        return ERRID(REVMAP_IO_ERROR);
+    }
+
+    void* buffer = Memory<BLOCK_SIZE>::Alloc(numFooterBlks);
+    if (buffer == nullptr)
+    {
+        return ERRID(REVMAP_IO_ERROR);
+    }
+    std::list<BufferEntry> bufferList;
+    bufferList.push_back(BufferEntry(buffer, numFooterBlks));
+    LogicalBlkAddr startLsa = {
+        .stripeId = lsa.stripeId,
+        .offset = addrInfo->GetBlksPerStripe() - numFooterBlks};
+
+    CallbackSmartPtr callback = std::make_shared<ReverseMapFooterLoadCompletion>(rev, buffer, cb,
+        [this](void) { counts[IoDirection::IO_LOAD].completedCount++; });
+
+    counts[IoDirection::IO_LOAD].issuedCount++;
+
+    IOSubmitHandlerStatus status = IIOSubmitHandler::GetInstance()->SubmitAsyncIO(IODirection::READ,
+        bufferList, startLsa, numFooterBlks, PartitionType::USER_DATA, callback, addrInfo->GetArrayId());
+    if (status != IOSubmitHandlerStatus::SUCCESS)
+    {
+        POS_TRACE_ERROR(EID(REVMAP_IO_ERROR),
+            "Failed to submit the read of the reverse map footer, vsid:{}", vsid);
+        return ERRID(REVMAP_IO_ERROR);
+    }
+    return 0;
+}
+
+int
+ReverseMapManager::_FlushToFooter(ReverseMapPack* rev, EventSmartPtr cb)
+{
+    // The pack is copied into the footer blocks by the stripe write itself,
+    // so that there is nothing to issue here
+    if (revMapCache != nullptr)
+    {
+        revMapCache->Store(rev);
+        _PublishReverseMapCacheStats();
+    }
+    if (cb != nullptr)
+    {
+        EventSchedulerSingleton::Instance()->EnqueueEvent(cb);
+    }
+    return 0;
 }
 
 ReverseMapIo*
@@ -188,6 +295,11 @@ void
 ReverseMapManager::_ReverseMapIoDone(ReverseMapIo* reverseMapIo)
 {
     counts[reverseMapIo->GetIoDirection()].completedCount++;
+    if ((reverseMapIo->GetIoDirection() == IoDirection::IO_FLUSH) &&
+        (reverseMapIo->GetIoError() != 0) && (revMapCache != nullptr))
+    {
+        revMapCache->Invalidate(reverseMapIo->GetVsid());
+    }
     delete reverseMapIo;
 }
 
@@ -254,6 +366,10 @@ ReverseMapManager::LoadReverseMapForWBT(uint64_t offset, uint64_t fileSize, char
 int
 ReverseMapManager::StoreReverseMapForWBT(uint64_t offset, uint64_t fileSize, char* buf)
 {
+    if (revMapCache != nullptr)
+    {
+        revMapCache->InvalidateAll();
+    }
     return revMapWholefile->IssueIO(MetaFsIoOpcode::Write, offset, fileSize, buf);
 }
 
@@ -311,25 +427,105 @@ ReverseMapManager::_SetNumMpages(void)
     uint64_t mpageSize = addrInfo->GetMpageSize();
     uint32_t blksPerStripe = addrInfo->GetBlksPerStripe();
 
-    uint32_t entriesPerNormalPage = (mpageSize / REVMAP_SECTOR_SIZE) * (REVMAP_SECTOR_SIZE / REVMAP_ENTRY_SIZE);
-    uint32_t entriesPerFirstPage = entriesPerNormalPage - (REVMAP_SECTOR_SIZE / REVMAP_ENTRY_SIZE);
+    numMpagesPerStripe = ReverseMapFooter::GetNumMpages(blksPerStripe, mpageSize);
+    fileSizePerStripe = mpageSize * numMpagesPerStripe;
+    fileSizeWholeRevermap = fileSizePerStripe * maxVsid;
+
+    POS_TRACE_INFO(EID(REVMAP_FILE_SIZE), "[ReverseMap Info] numMpagesPerStripe:{}  fileSizePerStripe:{}",
+        numMpagesPerStripe, fileSizePerStripe);
 
-    if (blksPerStripe <= entriesPerFirstPage)
+    return 0;
+}
+
+void
+ReverseMapManager::_SetFooterBlks(void)
+{
+    uint32_t footerBlks = ReverseMapFooter::GetBlockCount(addrInfo->GetBlksPerStripe());
+    if (footerBlks == 0)
     {
-        numMpagesPerStripe = 1;
+        return;
     }
-    else
+
+    // The allocator reserves the footer from the same geometry, so a pack
+    // that does not fit it has to stay in the metafs file
+    if ((footerBlks != numMpagesPerStripe) || (addrInfo->GetMpageSize() > BLOCK_SIZE))
     {
-        numMpagesPerStripe = 1 + DivideUp(blksPerStripe - entriesPerFirstPage, entriesPerNormalPage);
+        POS_TRACE_ERROR(EID(REVMAP_FILE_SIZE),
+            "[ReverseMap Info] reverse map does not fit the stripe footer, footerBlks:{}  numMpagesPerStripe:{}  mpageSize:{}",
+            footerBlks, numMpagesPerStripe, addrInfo->GetMpageSize());
+        return;
     }
+    numFooterBlks = footerBlks;
+    POS_TRACE_INFO(EID(REVMAP_INITIALIZED), "[ReverseMap Info] reverse map footer enabled, footerBlks:{}, arrayId:{}",
+        numFooterBlks, addrInfo->GetArrayId());
+}
 
-    fileSizePerStripe = mpageSize * numMpagesPerStripe;
-    fileSizeWholeRevermap = fileSizePerStripe * maxVsid;
+bool
+ReverseMapManager::GetBlockChecksum(StripeId vsid, uint64_t offset, uint32_t& checksum)
+{
+    if (revMapCache == nullptr)
+    {
+        return false;
+    }
+    return revMapCache->GetChecksum(vsid, offset, checksum);
+}
 
-    POS_TRACE_INFO(EID(REVMAP_FILE_SIZE), "[ReverseMap Info] entriesPerNormalPage:{}  entriesPerFirstPage:{}  numMpagesPerStripe:{}  fileSizePerStripe:{}",
-        entriesPerNormalPage, entriesPerFirstPage, numMpagesPerStripe, fileSizePerStripe);
+ReverseMapCache*
+ReverseMapManager::GetReverseMapCache(void)
+{
+    return revMapCache;
+}
 
-    return 0;
+void
+ReverseMapManager::_CreateReverseMapCache(void)
+{
+    if (revMapCache != nullptr)
+    {
+        return;
+    }
+
+    uint64_t cacheEntries = DEFAULT_REVERSE_MAP_CACHE_ENTRIES;
+    int ret = ConfigManagerSingleton::Instance()->GetValue("mapper", "reverse_map_cache_entries",
+        &cacheEntries, ConfigType::CONFIG_TYPE_UINT64);
+    if (ret != 0)
+    {
+        cacheEntries = DEFAULT_REVERSE_MAP_CACHE_ENTRIES;
+    }
+    if (cacheEntries == 0)
+    {
+        return;
+    }
+
+    revMapCache = new ReverseMapCache(cacheEntries, addrInfo->GetBlksPerStripe(), fileSizePerStripe);
+    POS_TRACE_INFO(EID(REVMAP_INITIALIZED), "[ReverseMap Info] reverse map cache enabled, cacheEntries:{}, arrayId:{}",
+        cacheEntries, addrInfo->GetArrayId());
+}
+
+void
+ReverseMapManager::_DeleteReverseMapCache(void)
+{
+    if (revMapCache != nullptr)
+    {
+        delete revMapCache;
+        revMapCache = nullptr;
+    }
+}
+
+void
+ReverseMapManager::_PublishReverseMapCacheStats(void)
+{
+    if (telemetryPublisher == nullptr)
+    {
+        return;
+    }
+
+    ReverseMapCacheStats stats = revMapCache->GetStats();
+    uint64_t numLoads = stats.numHits + stats.numMisses;
+    POSMetricValue v;
+    v.gauge = (numLoads == 0) ? 0 : (stats.numHits * 100) / numLoads;
+    telemetryPublisher->PublishData(TEL33016_MAP_REVERSE_CACHE_HIT_RATE, v, MT_GAUGE);
+    v.gauge = stats.savedBytes;
+    telemetryPublisher->PublishData(TEL33017_MAP_REVERSE_IO_BYTES_SAVED, v, MT_GAUGE);
 }
 
 } // namespace pos
@@ -41,6 +41,7 @@
 #include "src/mapper/i_stripemap.h"
 #include "src/mapper/i_vsamap.h"
 #include "src/mapper/reversemap/reverse_map.h"
+#include "src/mapper/reversemap/reverse_map_cache.h"
 #include "src/mapper/reversemap/reverse_map_io.h"
 #include "src/meta_file_intf/meta_file_include.h"
 #include "src/volume/i_volume_info_manager.h"
@@ -70,6 +71,11 @@ public:
     virtual int LoadReverseMapForWBT(uint64_t offset, uint64_t fileSize, char* buf);
     virtual int StoreReverseMapForWBT(uint64_t offset, uint64_t fileSize, char* buf);
 
+    virtual bool GetBlockChecksum(StripeId vsid, uint64_t offset, uint32_t& checksum);
+    virtual ReverseMapCache* GetReverseMapCache(void);
+
+    static const uint64_t DEFAULT_REVERSE_MAP_CACHE_ENTRIES = 1024;
+
 private:
     struct IoCount
     {
@@ -79,17 +85,25 @@ private:
 
     bool _FindRba(uint32_t volumeId, uint64_t totalRbaNum, StripeId vsid, StripeId wblsid, uint64_t offset, BlkAddr rbaStart, BlkAddr& foundRba);
     int _SetNumMpages(void);
+    void _SetFooterBlks(void);
+    int _LoadFromFooter(ReverseMapPack* rev, EventSmartPtr cb);
+    int _FlushToFooter(ReverseMapPack* rev, EventSmartPtr cb);
     uint64_t _GetFileOffset(StripeId vsid);
     ReverseMapIo* _CreateIoContext(ReverseMapPack* rev, EventSmartPtr cb, IoDirection dir);
     void _ReverseMapIoDone(ReverseMapIo* reverseMapIo);
+    void _CreateReverseMapCache(void);
+    void _DeleteReverseMapCache(void);
+    void _PublishReverseMapCacheStats(void);
 
     uint64_t numMpagesPerStripe; // It depends on block count per a stripe
+    uint32_t numFooterBlks; // 0 unless the pack is kept in the stripe footer
     uint64_t fileSizePerStripe;
     uint64_t fileSizeWholeRevermap;
 
     IoCount counts[IoDirection::NUM_DIRECTIONS];
 
     MetaFileIntf* revMapWholefile;
+    ReverseMapCache* revMapCache;
 
     IVSAMap* iVSAMap;
     IStripeMap* iStripeMap;
@@ -34,6 +34,9 @@
 #include "src/include/branch_prediction.h"
 #include "src/mapper/stripemap/stripemap_content.h"
 #include "src/mapper/map/map_io_handler.h"
+
+#include <sys/mman.h>
+
 #include <string>
 
 namespace pos
@@ -52,15 +55,38 @@ StripeMapContent::StripeMapContent(int mapId, MapperAddressInfo* addrInfo)
     fileName = "StripeMap.bin";
 }
 
+StripeMapContent::~StripeMapContent(void)
+{
+    _FreeLookupTable();
+}
+
 int
 StripeMapContent::InMemoryInit(uint64_t numEntries, uint64_t mpageSize)
 {
-    return Init(numEntries, sizeof(StripeAddr), mpageSize);
+    int ret = Init(numEntries, sizeof(StripeAddr), mpageSize);
+    if (ret == 0)
+    {
+        _AllocateLookupTable(numEntries);
+    }
+    return ret;
+}
+
+int
+StripeMapContent::DumpLoad(std::string fileName)
+{
+    int ret = MapContent::DumpLoad(fileName);
+    RebuildLookupTable();
+    return ret;
 }
 
 StripeAddr
 StripeMapContent::GetEntry(StripeId vsid)
 {
+    if (likely(vsid < numLookupEntries))
+    {
+        return _Unpack(lookupTable[vsid].load(std::memory_order_acquire));
+    }
+
     uint32_t pageNr = vsid / entriesPerMpage;
 
     char* mpage = map->GetMpage(pageNr);
@@ -98,9 +124,15 @@ StripeMapContent::SetEntry(StripeId vsid, StripeAddr entry)
 
     StripeAddr* mpageMap = (StripeAddr*)mpage;
     uint32_t entNr = vsid % entriesPerMpage;
+    map->BeginMpageUpdate(pageNr);
     mpageMap[entNr] = entry;
+    map->EndMpageUpdate(pageNr);
+    if (vsid < numLookupEntries)
+    {
+        lookupTable[vsid].store(_Pack(entry), std::memory_order_release);
+    }
 
-    mapHeader->GetTouchedMpages()->SetBit(pageNr);
+    mapHeader->SetTouchedMpageBit(pageNr);
 
     map->ReleaseMpageLock(pageNr);
     return 0;
@@ -116,4 +148,76 @@ StripeMapContent::GetDirtyPages(uint64_t start, uint64_t numEntries)
     return dirtyList;
 }
 
+void
+StripeMapContent::RebuildLookupTable(void)
+{
+    for (uint64_t vsid = 0; vsid < numLookupEntries; ++vsid)
+    {
+        char* mpage = map->GetMpage(vsid / entriesPerMpage);
+        StripeAddr entry = {.stripeLoc = IN_WRITE_BUFFER_AREA, .stripeId = UNMAP_STRIPE};
+        if (mpage != nullptr)
+        {
+            entry = ((StripeAddr*)mpage)[vsid % entriesPerMpage];
+        }
+        lookupTable[vsid].store(_Pack(entry), std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+void
+StripeMapContent::_AllocateLookupTable(uint64_t numEntries)
+{
+    _FreeLookupTable();
+
+    // Backed by hugepages where the system has them reserved, otherwise by THP
+    // if it is enabled, so that random vsids on the read path don't miss the TLB
+    uint64_t size = numEntries * sizeof(std::atomic<uint32_t>);
+    size = (size + HUGEPAGE_SIZE - 1) / HUGEPAGE_SIZE * HUGEPAGE_SIZE;
+    void* mem = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (mem == MAP_FAILED)
+    {
+        mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mem == MAP_FAILED)
+        {
+            POS_TRACE_WARN(EID(MAPPER_INFO),
+                "[Mapper StripeMap] Failed to allocate the lookup table, size:{}, lookups go through the mpages", size);
+            return;
+        }
+        madvise(mem, size, MADV_HUGEPAGE);
+    }
+
+    lookupTable = static_cast<std::atomic<uint32_t>*>(mem);
+    lookupTableSize = size;
+    numLookupEntries = numEntries;
+    RebuildLookupTable();
+}
+
+void
+StripeMapContent::_FreeLookupTable(void)
+{
+    if (lookupTable != nullptr)
+    {
+        munmap(lookupTable, lookupTableSize);
+        lookupTable = nullptr;
+        lookupTableSize = 0;
+        numLookupEntries = 0;
+    }
+}
+
+uint32_t
+StripeMapContent::_Pack(StripeAddr entry)
+{
+    return (static_cast<uint32_t>(entry.stripeId) << STRIPE_LOC_BIT_LEN) | static_cast<uint32_t>(entry.stripeLoc);
+}
+
+StripeAddr
+StripeMapContent::_Unpack(uint32_t packed)
+{
+    StripeAddr entry;
+    entry.stripeLoc = static_cast<StripeLoc>(packed & ((1U << STRIPE_LOC_BIT_LEN) - 1));
+    entry.stripeId = packed >> STRIPE_LOC_BIT_LEN;
+    return entry;
+}
+
 } // namespace pos
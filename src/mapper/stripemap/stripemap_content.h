@@ -34,6 +34,7 @@
 
 #include "src/mapper/map/map_content.h"
 
+#include <atomic>
 #include <string>
 
 namespace pos
@@ -44,13 +45,31 @@ public:
     StripeMapContent(void) = default;
     StripeMapContent(Map* m, int mapId, MapperAddressInfo* addrInfo);
     StripeMapContent(int mapId, MapperAddressInfo* addrInfo);
-    virtual ~StripeMapContent(void) = default;
+    virtual ~StripeMapContent(void);
 
     virtual int InMemoryInit(uint64_t entrySize, uint64_t mpageSize);
     virtual MpageList GetDirtyPages(uint64_t start, uint64_t numEntries);
+    virtual int DumpLoad(std::string fileName);
 
+    // Lock-free for readers; writers are serialized by the caller
     virtual StripeAddr GetEntry(StripeId vsid);
     virtual int SetEntry(StripeId vsid, StripeAddr entry);
+    // Refills the lookup table from the mpages once a load has filled them
+    virtual void RebuildLookupTable(void);
+
+private:
+    void _AllocateLookupTable(uint64_t numEntries);
+    void _FreeLookupTable(void);
+    static uint32_t _Pack(StripeAddr entry);
+    static StripeAddr _Unpack(uint32_t packed);
+
+    static const uint64_t HUGEPAGE_SIZE = 2 * 1024 * 1024;
+
+    // Flat copy of the map with one packed entry per vsid. The mpages stay the
+    // source of truth for flush and load; reads on the I/O path only touch this
+    std::atomic<uint32_t>* lookupTable = nullptr;
+    uint64_t numLookupEntries = 0;
+    uint64_t lookupTableSize = 0;
 };
 
 } // namespace pos
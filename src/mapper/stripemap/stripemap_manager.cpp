@@ -39,6 +39,7 @@
 #include "src/allocator/i_wbstripe_allocator.h"
 #include "src/allocator/stripe_manager/stripe.h"
 #include "src/allocator_service/allocator_service.h"
+#include "src/include/branch_prediction.h"
 #include "src/event_scheduler/event_scheduler.h"
 #include "src/mapper/address/mapper_address_info.h"
 #include "src/mapper/map_flushed_event.h"
@@ -155,6 +156,7 @@ StripeMapManager::LoadStripeMapFile(void)
     }
 
     _WaitLoadIoDone();
+    stripeMap->RebuildLookupTable();
     POS_TRACE_INFO(EID(MAPPER_INFO), "[Mapper StripeMap] StripeMap Loaded, array:{}, arrayId:{}",
         addrInfo->GetArrayName(), addrInfo->GetArrayId());
     return ret;
@@ -218,6 +220,15 @@ StripeMapManager::FlushTouchedPages(EventSmartPtr cb)
     return ret;
 }
 
+void
+StripeMapManager::AddToWarmRestartImage(WarmRestartImage* image)
+{
+    if (stripeMap != nullptr)
+    {
+        stripeMap->AddToWarmRestartImage(image);
+    }
+}
+
 void
 StripeMapManager::MapFlushDone(int mapId)
 {
@@ -272,17 +283,23 @@ StripeMapManager::SetStripeMapContent(StripeMapContent* content)
 StripeAddr
 StripeMapManager::GetLSA(StripeId vsid)
 {
-    pthread_rwlock_rdlock(&stripeMapLock);
-    StripeAddr stripeAddr = stripeMap->GetEntry(vsid);
-    pthread_rwlock_unlock(&stripeMapLock);
-    return stripeAddr;
+    return stripeMap->GetEntry(vsid);
 }
 
 std::tuple<StripeAddr, bool>
 StripeMapManager::GetLSAandReferLsid(StripeId vsid)
 {
-    pthread_rwlock_rdlock(&stripeMapLock);
     StripeAddr stripeAddr = stripeMap->GetEntry(vsid);
+    if (likely(stripeAddr.stripeLoc == IN_USER_AREA))
+    {
+        // Nothing to pin for a stripe in the user area
+        return std::make_tuple(stripeAddr, false);
+    }
+
+    // A write buffer stripe may be released once its entry moves to the user area,
+    // so the entry is read again and referred under the lock that SetLSA takes
+    pthread_rwlock_rdlock(&stripeMapLock);
+    stripeAddr = stripeMap->GetEntry(vsid);
     IWBStripeAllocator* iWBStripeAllocator = AllocatorServiceSingleton::Instance()->GetIWBStripeAllocator(addrInfo->GetArrayId());
     bool referenced = iWBStripeAllocator->ReferLsidCnt(stripeAddr);
     pthread_rwlock_unlock(&stripeMapLock);
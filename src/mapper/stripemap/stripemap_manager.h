@@ -48,6 +48,7 @@ namespace pos
 {
 class EventScheduler;
 class TelemetryPublisher;
+class WarmRestartImage;
 
 class StripeMapManager : public IMapManagerInternal, public IStripeMap
 {
@@ -62,6 +63,7 @@ public:
     virtual int LoadStripeMapFile(void);
     virtual int FlushDirtyPagesGiven(MpageList list, EventSmartPtr cb);
     virtual int FlushTouchedPages(EventSmartPtr cb);
+    virtual void AddToWarmRestartImage(WarmRestartImage* image);
     virtual void MapFlushDone(int mapId) override;
     virtual void WaitAllPendingIoDone(void);
     virtual void WaitWritePendingIoDone(void);
@@ -0,0 +1,96 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/mapper/vsamap/vsa_extent_codec.h"
+
+#include <cstring>
+
+namespace pos
+{
+const uint64_t VsaExtentCodec::MIN_COMPRESSION_RATIO;
+
+bool
+VsaExtentCodec::Encode(const char* mpage, uint64_t pageSize, std::vector<uint8_t>& encoded)
+{
+    const VirtualBlkAddr* entries = reinterpret_cast<const VirtualBlkAddr*>(mpage);
+    uint64_t numEntries = pageSize / sizeof(VirtualBlkAddr);
+    uint64_t maxExtents = pageSize / (MIN_COMPRESSION_RATIO * sizeof(VirtualBlks));
+
+    std::vector<VirtualBlks> extents;
+    for (uint64_t entryIdx = 0; entryIdx < numEntries; ++entryIdx)
+    {
+        if ((extents.empty() == false) && (IsVsaExtendedBy(extents.back(), entries[entryIdx]) == true))
+        {
+            extents.back().numBlks++;
+            continue;
+        }
+        if (extents.size() == maxExtents)
+        {
+            return false;
+        }
+        extents.push_back({.startVsa = entries[entryIdx], .numBlks = 1});
+    }
+
+    encoded.resize(extents.size() * sizeof(VirtualBlks));
+    memcpy(encoded.data(), extents.data(), encoded.size());
+    return true;
+}
+
+void
+VsaExtentCodec::Decode(const std::vector<uint8_t>& encoded, char* mpage, uint64_t pageSize)
+{
+    // bytes past the last whole entry stay as AllocateMpage() leaves them
+    memset(mpage, 0xFF, pageSize);
+
+    VirtualBlkAddr* entries = reinterpret_cast<VirtualBlkAddr*>(mpage);
+    const VirtualBlks* extents = reinterpret_cast<const VirtualBlks*>(encoded.data());
+    uint64_t numExtents = encoded.size() / sizeof(VirtualBlks);
+    uint64_t entryIdx = 0;
+    for (uint64_t extentIdx = 0; extentIdx < numExtents; ++extentIdx)
+    {
+        const VirtualBlks& extent = extents[extentIdx];
+        for (uint64_t blk = 0; blk < extent.numBlks; ++blk)
+        {
+            if (IsUnMapVsa(extent.startVsa) == true)
+            {
+                entries[entryIdx++] = UNMAP_VSA;
+            }
+            else
+            {
+                entries[entryIdx++] = {.stripeId = extent.startVsa.stripeId,
+                    .offset = extent.startVsa.offset + blk};
+            }
+        }
+    }
+}
+
+} // namespace pos
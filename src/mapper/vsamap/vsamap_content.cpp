@@ -32,13 +32,17 @@
 
 #include "src/mapper/vsamap/vsamap_content.h"
 
+#include <algorithm>
 #include <string>
 
 #include "src/allocator/i_block_allocator.h"
 #include "src/allocator/i_segment_ctx.h"
 #include "src/allocator_service/allocator_service.h"
 #include "src/include/branch_prediction.h"
+#include "src/include/memory.h"
 #include "src/io/frontend_io/flush_command_manager.h"
+#include "src/mapper/map/demand_paged_map.h"
+#include "src/mapper/map/mpage_cache.h"
 
 namespace pos
 {
@@ -51,6 +55,7 @@ VSAMapContent::VSAMapContent(int mapId, MapperAddressInfo* addrInfo, FlushCmdMan
     totalBlks = 0;
     this->arrayId = addrInfo->GetArrayId();
     callback = nullptr;
+    mpageCache = nullptr;
 
     flushCmdManager = flm_;
     if (flushCmdManager == nullptr)
@@ -72,34 +77,145 @@ int
 VSAMapContent::InMemoryInit(uint64_t volId, uint64_t blkCnt, uint64_t mpageSize)
 {
     totalBlks = blkCnt;
+    if ((mpageCache != nullptr) && (map == nullptr))
+    {
+        uint64_t numMpages = DivideUp(blkCnt, mpageSize / sizeof(VirtualBlkAddr));
+        DemandPagedMap* pagedMap = new DemandPagedMap(numMpages, mpageSize, mpageCache);
+        if (mpageCache->IsEncodingEnabled() == true)
+        {
+            pagedMap->SetCodec(&codec);
+        }
+        map = pagedMap;
+    }
     return Init(totalBlks, sizeof(VirtualBlkAddr), mpageSize);
 }
 
 VirtualBlkAddr
 VSAMapContent::GetEntry(BlkAddr rba)
 {
-    uint64_t pageNr = rba / entriesPerMpage;
+    VirtualBlkAddr vsa;
+    _GetEntriesInMpage(rba / entriesPerMpage, rba % entriesPerMpage, 1, &vsa);
+    return vsa;
+}
+
+void
+VSAMapContent::GetEntries(BlkAddr startRba, uint32_t numBlks, VirtualBlkAddr* vsas)
+{
+    uint32_t blkIdx = 0;
+    while (blkIdx < numBlks)
+    {
+        BlkAddr rba = startRba + blkIdx;
+        uint64_t entNr = rba % entriesPerMpage;
+        uint32_t count = std::min(static_cast<uint64_t>(numBlks - blkIdx), entriesPerMpage - entNr);
+        _GetEntriesInMpage(rba / entriesPerMpage, entNr, count, vsas + blkIdx);
+        blkIdx += count;
+    }
+}
 
-    char* mpage = map->GetMpage(pageNr);
+void
+VSAMapContent::_GetEntriesInMpage(uint64_t pageNr, uint64_t entNr, uint32_t count, VirtualBlkAddr* vsas)
+{
+    if (map->IsDemandPaged() == false)
+    {
+        // mpages of a fully loaded map never move, and each entry is a single aligned word
+        char* mpage = map->GetMpage(pageNr);
+        _CopyEntries(mpage, entNr, count, vsas);
+        return;
+    }
 
+    if (unlikely(pageNr >= map->GetNumMpages()))
+    {
+        _CopyEntries(nullptr, entNr, count, vsas);
+        return;
+    }
+
+    // optimistic read; a frame can be evicted and reused under us, which bumps the sequence
+    uint32_t seq = map->GetMpageSeq(pageNr);
+    if (likely((seq & 1) == 0))
+    {
+        char* mpage = map->GetMpage(pageNr);
+        if (likely(nullptr != mpage))
+        {
+            _CopyEntries(mpage, entNr, count, vsas);
+            if (likely(map->IsMpageSeqChanged(pageNr, seq) == false))
+            {
+                return;
+            }
+        }
+    }
+
+    // raced with a writer, or the page has to be faulted in
+    map->GetMpageLock(pageNr);
+    char* mpage = _GetResidentMpage(pageNr);
+    _CopyEntries(mpage, entNr, count, vsas);
+    map->ReleaseMpageLock(pageNr);
+}
+
+void
+VSAMapContent::_CopyEntries(char* mpage, uint64_t entNr, uint32_t count, VirtualBlkAddr* vsas)
+{
     if (unlikely(nullptr == mpage))
     {
-        return UNMAP_VSA;
+        for (uint32_t idx = 0; idx < count; ++idx)
+        {
+            vsas[idx] = UNMAP_VSA;
+        }
+        return;
     }
-    else
+
+    VirtualBlkAddr* mpageMap = (VirtualBlkAddr*)mpage;
+    for (uint32_t idx = 0; idx < count; ++idx)
     {
-        uint64_t entNr = rba % entriesPerMpage;
-        return ((VirtualBlkAddr*)mpage)[entNr];
+        vsas[idx] = mpageMap[entNr + idx];
     }
 }
 
 int
 VSAMapContent::SetEntry(BlkAddr rba, VirtualBlkAddr vsa)
 {
-    uint64_t pageNr = rba / entriesPerMpage;
+    VirtualBlks vsas = {.startVsa = vsa, .numBlks = 1};
+    return SetEntries(rba, vsas);
+}
+
+int
+VSAMapContent::SetEntries(BlkAddr startRba, VirtualBlks& vsas)
+{
+    int ret = 0;
+    uint32_t blkIdx = 0;
+    while (blkIdx < vsas.numBlks)
+    {
+        BlkAddr rba = startRba + blkIdx;
+        uint64_t entNr = rba % entriesPerMpage;
+        uint32_t count = std::min(static_cast<uint64_t>(vsas.numBlks - blkIdx), entriesPerMpage - entNr);
+        VirtualBlkAddr startVsa = {.stripeId = vsas.startVsa.stripeId,
+            .offset = vsas.startVsa.offset + blkIdx};
+        ret = _SetEntriesInMpage(rba / entriesPerMpage, entNr, count, startVsa);
+        if (ret < 0)
+        {
+            return ret;
+        }
+        blkIdx += count;
+    }
+
+    if (internalFlushEnabled == true)
+    {
+        uint32_t numBitsSet = mapHeader->GetNumTouchedMpagesSet();
+        uint32_t totalNumBits =  mapHeader->GetNumTotalTouchedMpages();
 
+        if (((HUNDRED_PERCENT * numBitsSet) / totalNumBits) > flushThreshold)
+        {
+            flushCmdManager->UpdateVSANewEntries(mapHeader->GetMapId(), arrayId);
+        }
+    }
+
+    return ret;
+}
+
+int
+VSAMapContent::_SetEntriesInMpage(uint64_t pageNr, uint64_t entNr, uint32_t count, VirtualBlkAddr startVsa)
+{
     map->GetMpageLock(pageNr);
-    char* mpage = map->GetMpage(pageNr);
+    char* mpage = _GetResidentMpage(pageNr);
 
     if (mpage == nullptr)
     {
@@ -113,24 +229,111 @@ VSAMapContent::SetEntry(BlkAddr rba, VirtualBlkAddr vsa)
     }
 
     VirtualBlkAddr* mpageMap = (VirtualBlkAddr*)mpage;
-    uint64_t entNr = rba % entriesPerMpage;
-
-    VirtualBlkAddr oldVsa = mpageMap[entNr];
-    mapHeader->UpdateNumUsedBlks(oldVsa);
 
-    mpageMap[entNr] = vsa;
+    map->BeginMpageUpdate(pageNr);
+    if (IsUnMapVsa(startVsa))
+    {
+        // Unmapping a range sets every entry to UNMAP_VSA, not to offsets after it
+        for (uint32_t idx = 0; idx < count; ++idx)
+        {
+            mapHeader->ReleaseNumUsedBlks(mpageMap[entNr + idx]);
+            mpageMap[entNr + idx] = UNMAP_VSA;
+        }
+    }
+    else
+    {
+        for (uint32_t idx = 0; idx < count; ++idx)
+        {
+            mapHeader->UpdateNumUsedBlks(mpageMap[entNr + idx]);
+            mpageMap[entNr + idx] = {.stripeId = startVsa.stripeId, .offset = startVsa.offset + idx};
+        }
+    }
+    map->EndMpageUpdate(pageNr);
 
     mapHeader->SetTouchedMpageBit(pageNr);
+    map->MarkMpageDirty(pageNr);
 
-    if (internalFlushEnabled == true)
+    map->ReleaseMpageLock(pageNr);
+
+    return 0;
+}
+
+// Unmaps a range of entries and collects the blocks they were mapped to as
+// runs of contiguous VSAs. The mpages that have never been written are
+// skipped unread, and the mpages with no mapped entry in the range are not dirtied
+int
+VSAMapContent::UnmapEntries(BlkAddr startRba, uint64_t numBlks, std::vector<VirtualBlks>& oldBlks)
+{
+    if (unlikely(startRba + numBlks > static_cast<uint64_t>(totalBlks)))
     {
-        uint32_t numBitsSet = mapHeader->GetNumTouchedMpagesSet();
-        uint32_t totalNumBits =  mapHeader->GetNumTotalTouchedMpages();
+        POS_TRACE_ERROR(EID(VSAMAP_SET_FAILURE),
+            "Range to unmap is out of the map, start_rba:{}, num_blks:{}, total_blks:{}",
+            startRba, numBlks, totalBlks);
+        return ERRID(VSAMAP_SET_FAILURE);
+    }
 
-        if (((HUNDRED_PERCENT * numBitsSet) / totalNumBits) > flushThreshold)
+    uint64_t blkIdx = 0;
+    while (blkIdx < numBlks)
+    {
+        BlkAddr rba = startRba + blkIdx;
+        uint64_t entNr = rba % entriesPerMpage;
+        uint64_t count = std::min(numBlks - blkIdx, entriesPerMpage - entNr);
+        int ret = _UnmapEntriesInMpage(rba / entriesPerMpage, entNr, count, oldBlks);
+        if (ret < 0)
         {
-            flushCmdManager->UpdateVSANewEntries(mapHeader->GetMapId(), arrayId);
+            return ret;
+        }
+        blkIdx += count;
+    }
+    return 0;
+}
+
+int
+VSAMapContent::_UnmapEntriesInMpage(uint64_t pageNr, uint64_t entNr, uint64_t count, std::vector<VirtualBlks>& oldBlks)
+{
+    if (mapHeader->GetMpageMap()->IsSetBit(pageNr) == false)
+    {
+        return 0;
+    }
+
+    map->GetMpageLock(pageNr);
+    char* mpage = _GetResidentMpage(pageNr);
+    if (unlikely(mpage == nullptr))
+    {
+        map->ReleaseMpageLock(pageNr);
+        POS_TRACE_ERROR(EID(VSAMAP_SET_FAILURE), "[Mapper VSAMap] Failed to fault in mpage:{} to unmap, mapId:{}", pageNr, mapId);
+        return ERRID(VSAMAP_SET_FAILURE);
+    }
+
+    VirtualBlkAddr* entries = reinterpret_cast<VirtualBlkAddr*>(mpage) + entNr;
+    uint64_t numMapped = 0;
+    for (uint64_t idx = 0; idx < count; ++idx)
+    {
+        if (IsUnMapVsa(entries[idx]) == true)
+        {
+            continue;
         }
+        if ((oldBlks.empty() == false) && (IsVsaExtendedBy(oldBlks.back(), entries[idx]) == true))
+        {
+            oldBlks.back().numBlks++;
+        }
+        else
+        {
+            oldBlks.push_back({.startVsa = entries[idx], .numBlks = 1});
+        }
+        numMapped++;
+    }
+
+    if (numMapped != 0)
+    {
+        // A whole mpage is reset in one go, as is the part of it in the range
+        map->BeginMpageUpdate(pageNr);
+        std::fill_n(entries, count, UNMAP_VSA);
+        map->EndMpageUpdate(pageNr);
+        mapHeader->DecreaseNumUsedBlks(numMapped);
+
+        mapHeader->SetTouchedMpageBit(pageNr);
+        map->MarkMpageDirty(pageNr);
     }
 
     map->ReleaseMpageLock(pageNr);
@@ -166,6 +369,12 @@ VSAMapContent::GetNumUsedBlks(void)
     return mapHeader->GetNumUsedBlks();
 }
 
+uint64_t
+VSAMapContent::GetNumEntries(void)
+{
+    return totalBlks;
+}
+
 void
 VSAMapContent::SetCallback(EventSmartPtr cb)
 {
@@ -178,33 +387,85 @@ VSAMapContent::GetCallback(void)
     return callback;
 }
 
+void
+VSAMapContent::SetMpageCache(MpageCache* cache)
+{
+    mpageCache = cache;
+}
+
 int
 VSAMapContent::InvalidateAllBlocks(ISegmentCtx* segmentCtx)
 {
-    uint32_t mpageId = 0;
-
-    while ((mpageId = mapHeader->GetMpageMap()->FindFirstSet(mpageId)) != mapHeader->GetMpageMap()->GetNumBits())
+    std::vector<VirtualBlks> validBlks;
+    uint64_t numMpages = GetNumMpages();
+    uint64_t mpageId = 0;
+    while (mpageId < numMpages)
     {
-        map->GetMpageLock(mpageId);
+        validBlks.clear();
+        mpageId = CollectValidBlks(mpageId, 1, validBlks);
+        for (auto& vBlks : validBlks)
+        {
+            bool allowVictimSegRelease = true;
+            segmentCtx->InvalidateBlks(vBlks, allowVictimSegRelease);
+        }
+    }
 
-        char* mpage = map->GetMpage(mpageId);
+    return 0;
+}
 
-        for (uint32_t entryIdx = 0; entryIdx < entriesPerMpage; ++entryIdx)
+// Collects the mapped entries of up to numMpages written mpages from startMpage
+// as runs of contiguous VSAs and returns the mpage to continue from. The mpages
+// that have never been written are skipped through the mpage bitmap unread
+uint64_t
+VSAMapContent::CollectValidBlks(uint64_t startMpage, uint32_t numMpages, std::vector<VirtualBlks>& validBlks)
+{
+    BitMap* mpageMap = mapHeader->GetMpageMap();
+    uint64_t numBits = mpageMap->GetNumBits();
+    uint64_t mpageId = startMpage;
+
+    for (uint32_t count = 0; count < numMpages; ++count)
+    {
+        mpageId = mpageMap->FindFirstSet(mpageId);
+        if (mpageId >= numBits)
         {
-            VirtualBlkAddr vsa = ((VirtualBlkAddr*)mpage)[entryIdx];
-            if (IsUnMapVsa(vsa) == false)
+            return numBits;
+        }
+
+        map->GetMpageLock(mpageId);
+        char* mpage = _GetResidentMpage(mpageId);
+        if (mpage == nullptr)
+        {
+            POS_TRACE_ERROR(EID(MAPPER_FAILED), "[Mapper VSAMap] Failed to fault in mpage:{} to invalidate, mapId:{}", mpageId, mapId);
+        }
+        else
+        {
+            VirtualBlkAddr* vsas = reinterpret_cast<VirtualBlkAddr*>(mpage);
+            for (uint32_t entryIdx = 0; entryIdx < entriesPerMpage; ++entryIdx)
             {
-                VirtualBlks vBlks = {.startVsa = vsa, .numBlks = 1};
-                bool allowVictimSegRelease = true;
-                segmentCtx->InvalidateBlks(vBlks, allowVictimSegRelease);
+                if (IsUnMapVsa(vsas[entryIdx]) == true)
+                {
+                    continue;
+                }
+                if ((validBlks.empty() == false) && (IsVsaExtendedBy(validBlks.back(), vsas[entryIdx]) == true))
+                {
+                    validBlks.back().numBlks++;
+                }
+                else
+                {
+                    validBlks.push_back({.startVsa = vsas[entryIdx], .numBlks = 1});
+                }
             }
         }
-
         map->ReleaseMpageLock(mpageId);
         mpageId++;
     }
+    return mpageId;
+}
 
-    return 0;
+uint64_t
+VSAMapContent::GetNumMpages(void)
+{
+    return mapHeader->GetMpageMap()->GetNumBits();
 }
 
 } // namespace pos
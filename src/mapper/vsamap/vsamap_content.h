@@ -35,12 +35,15 @@
 #include "src/allocator/i_block_allocator.h"
 #include "src/io/frontend_io/flush_command_manager.h"
 #include "src/mapper/map/map_content.h"
+#include "src/mapper/vsamap/vsa_extent_codec.h"
 
 #include <string>
+#include <vector>
 
 namespace pos
 {
 class ISegmentCtx;
+class MpageCache;
 
 static const uint64_t HUNDRED_PERCENT = 100;
 
@@ -56,15 +59,26 @@ public:
     virtual int InMemoryInit(uint64_t volId, uint64_t numEntries, uint64_t mpageSize);
     virtual VirtualBlkAddr GetEntry(BlkAddr rba);
     virtual int SetEntry(BlkAddr rba, VirtualBlkAddr vsa);
+    virtual void GetEntries(BlkAddr startRba, uint32_t numBlks, VirtualBlkAddr* vsas);
+    virtual int SetEntries(BlkAddr startRba, VirtualBlks& vsas);
+    virtual int UnmapEntries(BlkAddr startRba, uint64_t numBlks, std::vector<VirtualBlks>& oldBlks);
 
     virtual int64_t GetNumUsedBlks(void);
+    virtual uint64_t GetNumEntries(void);
     virtual void SetCallback(EventSmartPtr cb);
     virtual EventSmartPtr GetCallback(void);
+    virtual void SetMpageCache(MpageCache* cache);
 
     int InvalidateAllBlocks(ISegmentCtx* segmentCtx);
+    virtual uint64_t CollectValidBlks(uint64_t startMpage, uint32_t numMpages, std::vector<VirtualBlks>& validBlks);
+    virtual uint64_t GetNumMpages(void);
 
 private:
     void _UpdateUsedBlkCnt(VirtualBlkAddr vsa);
+    void _GetEntriesInMpage(uint64_t pageNr, uint64_t entNr, uint32_t count, VirtualBlkAddr* vsas);
+    void _CopyEntries(char* mpage, uint64_t entNr, uint32_t count, VirtualBlkAddr* vsas);
+    int _SetEntriesInMpage(uint64_t pageNr, uint64_t entNr, uint32_t count, VirtualBlkAddr startVsa);
+    int _UnmapEntriesInMpage(uint64_t pageNr, uint64_t entNr, uint64_t count, std::vector<VirtualBlks>& oldBlks);
 
     int64_t totalBlks;
 
@@ -74,6 +88,8 @@ private:
 
     int arrayId;
     EventSmartPtr callback;
+    MpageCache* mpageCache;
+    VsaExtentCodec codec;
 };
 
 } // namespace pos
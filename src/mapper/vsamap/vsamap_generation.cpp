@@ -0,0 +1,244 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/mapper/vsamap/vsamap_generation.h"
+
+#include <utility>
+
+#include "src/include/pos_event_id.h"
+#include "src/logger/logger.h"
+#include "src/meta_file_intf/rocksdb_metafs_intf.h"
+#include "src/metafs/config/metafs_config_manager.h"
+#include "src/metafs/include/metafs_service.h"
+#include "src/metafs/metafs_file_intf.h"
+#include "src/volume/volume_base.h"
+
+namespace pos
+{
+VSAMapGeneration::VSAMapGeneration(int arrayId)
+: VSAMapGeneration(arrayId, nullptr)
+{
+    if (MetaFsServiceSingleton::Instance()->GetConfigManager()->IsRocksdbEnabled())
+    {
+        file = new RocksDBMetaFsIntf(fileName, arrayId, MetaFileType::General);
+    }
+    else
+    {
+        file = new MetaFsFileIntf(fileName, arrayId, MetaFileType::General);
+    }
+}
+
+VSAMapGeneration::VSAMapGeneration(int arrayId, MetaFileIntf* file)
+: arrayId(arrayId),
+  fileName("VSAMapGeneration.bin"),
+  file(file),
+  entries(MAX_VOLUME_COUNT)
+{
+    _ResetEntries();
+}
+
+VSAMapGeneration::~VSAMapGeneration(void)
+{
+    Dispose();
+    if (file != nullptr)
+    {
+        delete file;
+        file = nullptr;
+    }
+}
+
+int
+VSAMapGeneration::Init(void)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    _ResetEntries();
+
+    int ret = 0;
+    if (file->DoesFileExist() == false)
+    {
+        ret = file->Create(sizeof(GenerationEntry) * entries.size());
+        if (ret == 0)
+        {
+            ret = file->Open();
+        }
+        if (ret == 0)
+        {
+            ret = _Store();
+        }
+    }
+    else
+    {
+        ret = file->Open();
+        if (ret == 0)
+        {
+            ret = _Load();
+        }
+    }
+
+    if (ret != 0)
+    {
+        POS_TRACE_ERROR(EID(VSAMAP_GENERATION_FAILURE), "Failed to load {}, arrayId:{}, ret:{}", fileName, arrayId, ret);
+    }
+    return ret;
+}
+
+void
+VSAMapGeneration::Dispose(void)
+{
+    if (file != nullptr && file->IsOpened() == true)
+    {
+        file->Close();
+    }
+}
+
+// The capacity of the map is kept until Reclaimed(), because the map file is
+// still loaded with it after a restart
+int
+VSAMapGeneration::Retire(int volId, uint64_t numBlks)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    if (_IsValidVolume(volId) == false)
+    {
+        POS_TRACE_ERROR(EID(VSAMAP_GENERATION_FAILURE), "Cannot retire volume:{}, arrayId:{}", volId, arrayId);
+        return ERRID(VSAMAP_GENERATION_FAILURE);
+    }
+
+    uint64_t retiredBlks = entries[volId].retiredBlks;
+    entries[volId].retiredBlks = numBlks;
+    int ret = _Store();
+    if (ret != 0)
+    {
+        entries[volId].retiredBlks = retiredBlks;
+        POS_TRACE_ERROR(EID(VSAMAP_GENERATION_FAILURE), "Failed to store {} for the retirement of volume:{}, arrayId:{}, ret:{}", fileName, volId, arrayId, ret);
+    }
+    return ret;
+}
+
+int
+VSAMapGeneration::Reclaimed(int volId)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    if (_IsValidVolume(volId) == false)
+    {
+        return ERRID(VSAMAP_GENERATION_FAILURE);
+    }
+
+    GenerationEntry backup = entries[volId];
+    entries[volId].retiredBlks = 0;
+    entries[volId].capacityMpages = 0;
+    int ret = _Store();
+    if (ret != 0)
+    {
+        entries[volId] = backup;
+        POS_TRACE_ERROR(EID(VSAMAP_GENERATION_FAILURE), "Failed to store {} for the reclaim of volume:{}, arrayId:{}, ret:{}", fileName, volId, arrayId, ret);
+    }
+    return ret;
+}
+
+std::vector<std::pair<int, uint64_t>>
+VSAMapGeneration::GetRetiredVolumes(void)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    std::vector<std::pair<int, uint64_t>> retired;
+    for (int volId = 0; volId < MAX_VOLUME_COUNT; volId++)
+    {
+        if (entries[volId].retiredBlks != 0)
+        {
+            retired.emplace_back(volId, entries[volId].retiredBlks);
+        }
+    }
+    return retired;
+}
+
+// Zero means the map was created before the capacity was recorded, and is
+// exactly as large as the volume
+uint32_t
+VSAMapGeneration::GetMapCapacity(int volId)
+{
+    if (_IsValidVolume(volId) == false)
+    {
+        return 0;
+    }
+    return entries[volId].capacityMpages;
+}
+
+int
+VSAMapGeneration::SetMapCapacity(int volId, uint32_t numMpages)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    if (_IsValidVolume(volId) == false)
+    {
+        return ERRID(VSAMAP_GENERATION_FAILURE);
+    }
+    if (entries[volId].capacityMpages == numMpages)
+    {
+        return 0;
+    }
+
+    uint32_t capacityMpages = entries[volId].capacityMpages;
+    entries[volId].capacityMpages = numMpages;
+    int ret = _Store();
+    if (ret != 0)
+    {
+        entries[volId].capacityMpages = capacityMpages;
+        POS_TRACE_ERROR(EID(VSAMAP_GENERATION_FAILURE), "Failed to store {} for the map capacity of volume:{}, arrayId:{}, ret:{}", fileName, volId, arrayId, ret);
+    }
+    return ret;
+}
+
+bool
+VSAMapGeneration::_IsValidVolume(int volId)
+{
+    return (0 <= volId) && (volId < MAX_VOLUME_COUNT);
+}
+
+void
+VSAMapGeneration::_ResetEntries(void)
+{
+    for (int volId = 0; volId < MAX_VOLUME_COUNT; volId++)
+    {
+        entries[volId] = {.capacityMpages = 0, .reserved = 0, .retiredBlks = 0};
+    }
+}
+
+int
+VSAMapGeneration::_Store(void)
+{
+    return file->IssueIO(MetaFsIoOpcode::Write, 0, sizeof(GenerationEntry) * entries.size(), reinterpret_cast<char*>(entries.data()));
+}
+
+int
+VSAMapGeneration::_Load(void)
+{
+    return file->IssueIO(MetaFsIoOpcode::Read, 0, sizeof(GenerationEntry) * entries.size(), reinterpret_cast<char*>(entries.data()));
+}
+} // namespace pos
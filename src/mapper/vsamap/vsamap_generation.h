@@ -0,0 +1,87 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace pos
+{
+class MetaFileIntf;
+
+// Keeps what a VSA map file needs beyond the volume it belongs to: the number
+// of mpages the map of a volume is created with, which is how a volume grown
+// online finds its map file at the next mount, and the volumes deleted while
+// the blocks of their map are still being invalidated in the background, so
+// that the reclaim resumes after a restart.
+// The getters are on the I/O path and do not take the lock, which only
+// serializes the changes of the table.
+class VSAMapGeneration
+{
+public:
+    explicit VSAMapGeneration(int arrayId);
+    VSAMapGeneration(int arrayId, MetaFileIntf* file);
+    virtual ~VSAMapGeneration(void);
+
+    virtual int Init(void);
+    virtual void Dispose(void);
+
+    virtual int Retire(int volId, uint64_t numBlks);
+    virtual int Reclaimed(int volId);
+    virtual std::vector<std::pair<int, uint64_t>> GetRetiredVolumes(void);
+    virtual uint32_t GetMapCapacity(int volId);
+    virtual int SetMapCapacity(int volId, uint32_t numMpages);
+
+private:
+    struct GenerationEntry
+    {
+        uint32_t capacityMpages;
+        uint32_t reserved;
+        uint64_t retiredBlks;
+    };
+
+    bool _IsValidVolume(int volId);
+    void _ResetEntries(void);
+    int _Store(void);
+    int _Load(void);
+
+    int arrayId;
+    std::string fileName;
+    MetaFileIntf* file;
+    std::vector<GenerationEntry> entries;
+    std::mutex lock;
+};
+} // namespace pos
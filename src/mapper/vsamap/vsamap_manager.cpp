@@ -31,13 +31,19 @@
  */
 #include "src/mapper/vsamap/vsamap_manager.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "src/event_scheduler/event_scheduler.h"
+#include "src/include/memory.h"
+#include "src/master_context/config_manager.h"
 #include "src/mapper/include/mapper_const.h"
+#include "src/mapper/map/mpage_cache.h"
 #include "src/mapper/map_flushed_event.h"
+#include "src/mapper/vsamap/vsamap_generation.h"
+#include "src/meta_file_intf/mock_file_intf.h"
 #include "src/sys_event/volume_event_publisher.h"
 #include "src/telemetry/telemetry_client/telemetry_publisher.h"
 
@@ -107,7 +113,25 @@ VSAMapManager::Init(void)
     }
     numWriteIssuedCount = 0;
     numLoadIssuedCount = 0;
-    return 0;
+    _CreateMpageCache();
+    if (generation == nullptr)
+    {
+        int arrayId = addrInfo->GetArrayId();
+        if (addrInfo->IsUT() == false)
+        {
+            generation = new VSAMapGeneration(arrayId);
+        }
+        else
+        {
+            generation = new VSAMapGeneration(arrayId, new MockFileIntf("VSAMapGeneration.bin", arrayId, MetaFileType::General));
+        }
+    }
+    int ret = generation->Init();
+    if (ret == 0)
+    {
+        _LoadDetachedMaps();
+    }
+    return ret;
 }
 
 void
@@ -121,12 +145,31 @@ VSAMapManager::Dispose(void)
             vsaMaps[volId] = nullptr;
         }
     }
+    {
+        std::lock_guard<std::mutex> guard(detachedMapLock);
+        for (auto& it : detachedMaps)
+        {
+            delete it.second;
+        }
+        detachedMaps.clear();
+    }
+    _DeleteMpageCache();
+    if (generation != nullptr)
+    {
+        delete generation;
+        generation = nullptr;
+    }
 }
 
 int
 VSAMapManager::CreateVsaMapContent(VSAMapContent* vm, int volId, uint64_t volSizeByte, bool delVol)
 {
     assert(vsaMaps[volId] == nullptr);
+    if (_GetDetachedMap(volId) != nullptr)
+    {
+        POS_TRACE_ERROR(EID(VSAMAP_GENERATION_FAILURE), "[Mapper VSAMap] The map of deleted volume:{} is not reclaimed yet, arrayId:{}", volId, addrInfo->GetArrayId());
+        return -1;
+    }
     if (vm != nullptr)
     {
         // for UT
@@ -136,7 +179,8 @@ VSAMapManager::CreateVsaMapContent(VSAMapContent* vm, int volId, uint64_t volSiz
     {
         vsaMaps[volId] = new VSAMapContent(volId, addrInfo);
     }
-    uint64_t blkCnt = DivideUp(volSizeByte, (uint64_t)pos::BLOCK_SIZE);
+    vsaMaps[volId]->SetMpageCache(mpageCache);
+    uint64_t blkCnt = _GetMapCapacity(volId, DivideUp(volSizeByte, (uint64_t)pos::BLOCK_SIZE));
     do
     {
         if (vsaMaps[volId]->InMemoryInit(volId, blkCnt, addrInfo->GetMpageSize()) != 0)
@@ -186,6 +230,53 @@ VSAMapManager::CreateVsaMapContent(VSAMapContent* vm, int volId, uint64_t volSiz
     return -1;
 }
 
+// Sizes the map of a new volume with the configured headroom, so that the volume
+// can be grown online without moving the mpages in its map file
+int
+VSAMapManager::ReserveMapCapacity(int volId, uint64_t volSizeByte)
+{
+    if (generation == nullptr)
+    {
+        return 0;
+    }
+    uint64_t entriesPerMpage = addrInfo->GetMpageSize() / sizeof(VirtualBlkAddr);
+    uint64_t blkCnt = DivideUp(volSizeByte, (uint64_t)pos::BLOCK_SIZE);
+    uint64_t numMpages = DivideUp(blkCnt * (100 + _GetGrowHeadroomPercent()) / 100, entriesPerMpage);
+    if (numMpages > UINT32_MAX)
+    {
+        numMpages = DivideUp(blkCnt, entriesPerMpage);
+    }
+    return generation->SetMapCapacity(volId, static_cast<uint32_t>(numMpages));
+}
+
+// Only the part of the map within its capacity can be handed out, as the mpages
+// beyond it would overlap whatever follows the map file
+int
+VSAMapManager::GrowVSAMap(int volId, uint64_t curSizeByte, uint64_t newSizeByte)
+{
+    uint64_t blkCnt = DivideUp(newSizeByte, (uint64_t)pos::BLOCK_SIZE);
+    uint64_t capacity = 0;
+    if (vsaMaps[volId] != nullptr)
+    {
+        uint64_t entriesPerMpage = addrInfo->GetMpageSize() / sizeof(VirtualBlkAddr);
+        capacity = vsaMaps[volId]->GetNumMpages() * entriesPerMpage;
+    }
+    else
+    {
+        capacity = _GetMapCapacity(volId, DivideUp(curSizeByte, (uint64_t)pos::BLOCK_SIZE));
+    }
+
+    if (blkCnt > capacity)
+    {
+        POS_TRACE_WARN(EID(RESIZE_VOL_MAP_CAPACITY_EXCEEDED), "[Mapper VSAMap] volume:{} cannot grow to {} blocks over the map capacity of {} blocks, arrayId:{}",
+            volId, blkCnt, capacity, addrInfo->GetArrayId());
+        return ERRID(RESIZE_VOL_MAP_CAPACITY_EXCEEDED);
+    }
+    POS_TRACE_INFO(EID(MAPPER_INFO), "[Mapper VSAMap] volume:{} grows to {} blocks within the map capacity of {} blocks, arrayId:{}",
+        volId, blkCnt, capacity, addrInfo->GetArrayId());
+    return 0;
+}
+
 int
 VSAMapManager::LoadVSAMapFile(int volId)
 {
@@ -230,6 +321,7 @@ VSAMapManager::FlushDirtyPagesGiven(int volId, MpageList dirtyPages, EventSmartP
     POSMetricValue v;
     v.gauge = cnt;
     tp->PublishData(TEL33010_MAP_VSA_FLUSHED_DIRTYPAGE_CNT, v, MT_GAUGE);
+    _PublishMpageCodecStats();
     assert(vsaMaps[volId] != nullptr);
     assert(vsaMaps[volId]->GetCallback() == nullptr);
     vsaMaps[volId]->SetCallback(cb);
@@ -353,6 +445,99 @@ VSAMapManager::DeleteVSAMap(int volId)
     return ret;
 }
 
+// Takes the map of a deleted volume out of the volume slots so that the volume
+// id is gone for the I/O path, while the blocks still counted valid through the
+// map are invalidated in the background. The retirement is stored before the map
+// is detached so that a restart resumes the reclaim instead of leaking the blocks
+int
+VSAMapManager::DetachVSAMap(int volId)
+{
+    assert(vsaMaps[volId] != nullptr);
+    WaitVolumePendingIoDone(volId);
+    if (generation != nullptr)
+    {
+        int ret = generation->Retire(volId, vsaMaps[volId]->GetNumEntries());
+        if (ret != 0)
+        {
+            return ret;
+        }
+    }
+
+    std::lock_guard<std::mutex> guard(detachedMapLock);
+    detachedMaps[volId] = vsaMaps[volId];
+    vsaMaps[volId] = nullptr;
+    mapLoadState[volId] = MapLoadState::LOAD_DONE;
+    return 0;
+}
+
+// Returns false once the mpages of the detached map are exhausted
+bool
+VSAMapManager::CollectDetachedBlocks(int volId, uint64_t& mpageId, uint32_t numMpages, std::vector<VirtualBlks>& validBlks)
+{
+    VSAMapContent* content = _GetDetachedMap(volId);
+    if (content == nullptr)
+    {
+        return false;
+    }
+    mpageId = content->CollectValidBlks(mpageId, numMpages, validBlks);
+    return (mpageId < content->GetNumMpages());
+}
+
+int
+VSAMapManager::DeleteDetachedMap(int volId)
+{
+    VSAMapContent* content = _GetDetachedMap(volId);
+    if (content == nullptr)
+    {
+        return ERRID(VSAMAP_GENERATION_FAILURE);
+    }
+
+    int ret = content->DeleteMapFile();
+    if (ret != 0)
+    {
+        POS_TRACE_ERROR(EID(MFS_FILE_DELETE_FAILED), "[Mapper VSAMap] Failed to delete the map of retired volume:{}, arrayId:{}, ret:{}", volId, addrInfo->GetArrayId(), ret);
+        return ret;
+    }
+    {
+        std::lock_guard<std::mutex> guard(detachedMapLock);
+        detachedMaps.erase(volId);
+    }
+    delete content;
+
+    // Once the file is gone a restart drops the record by itself
+    if (generation != nullptr)
+    {
+        generation->Reclaimed(volId);
+    }
+    return 0;
+}
+
+std::vector<int>
+VSAMapManager::GetDetachedVolumes(void)
+{
+    std::vector<int> volumes;
+    std::lock_guard<std::mutex> guard(detachedMapLock);
+    for (auto& it : detachedMaps)
+    {
+        volumes.push_back(it.first);
+    }
+    return volumes;
+}
+
+// Only the maps FlushAllMaps() has just written are taken into the image
+void
+VSAMapManager::AddToWarmRestartImage(WarmRestartImage* image)
+{
+    for (int volId = 0; volId < MAX_VOLUME_COUNT; ++volId)
+    {
+        if ((isVsaMapInternalAccessable[volId] == true) && (vsaMaps[volId] != nullptr) &&
+            (mapLoadState[volId] == MapLoadState::LOAD_DONE))
+        {
+            vsaMaps[volId]->AddToWarmRestartImage(image);
+        }
+    }
+}
+
 void
 VSAMapManager::WaitAllPendingIoDone(void)
 {
@@ -428,13 +613,32 @@ VSAMapManager::GetVSAs(int volId, BlkAddr startRba, uint32_t numBlks, VsaArray&
         return ERRID(VSAMAP_NOT_ACCESSIBLE);
     }
 
-    VSAMapContent* vsaMap = vsaMaps[volId];
+    assert(numBlks <= vsaArray.size());
+    vsaMaps[volId]->GetEntries(startRba, numBlks, vsaArray.data());
+    return 0;
+}
+
+// Looks up the range as extents of contiguous VSAs, so that callers can build
+// their I/O per extent instead of per block. Unmapped blocks form extents of UNMAP_VSA
+int
+VSAMapManager::GetVsaExtents(int volId, BlkAddr startRba, uint32_t numBlks, VsaExtentArray& extents, uint32_t& numExtents)
+{
+    VsaArray vsaArray;
+    int ret = GetVSAs(volId, startRba, numBlks, vsaArray);
+
+    numExtents = 0;
     for (uint32_t blkIdx = 0; blkIdx < numBlks; ++blkIdx)
     {
-        BlkAddr targetRba = startRba + blkIdx;
-        vsaArray[blkIdx] = vsaMap->GetEntry(targetRba);
+        if ((numExtents != 0) && (IsVsaExtendedBy(extents[numExtents - 1], vsaArray[blkIdx]) == true))
+        {
+            extents[numExtents - 1].numBlks++;
+        }
+        else
+        {
+            extents[numExtents++] = {.startVsa = vsaArray[blkIdx], .numBlks = 1};
+        }
     }
-    return 0;
+    return ret;
 }
 
 int
@@ -448,6 +652,29 @@ VSAMapManager::SetVSAs(int volId, BlkAddr startRba, VirtualBlks& virtualBlks)
     return _UpdateVsaMap(volId, startRba, virtualBlks);
 }
 
+int
+VSAMapManager::UnmapVSAs(int volId, BlkAddr startRba, uint64_t numBlks, std::vector<VirtualBlks>& oldBlks)
+{
+    if (false == isVsaMapAccessable[volId])
+    {
+        POS_TRACE_WARN(EID(VSAMAP_NOT_ACCESSIBLE), "[Mapper VSAMap] VolumeId:{} is not accessible, maybe unmounted", volId);
+        return ERRID(VSAMAP_NOT_ACCESSIBLE);
+    }
+    return UnmapVSAsWoCond(volId, startRba, numBlks, oldBlks);
+}
+
+int
+VSAMapManager::UnmapVSAsWoCond(int volId, BlkAddr startRba, uint64_t numBlks, std::vector<VirtualBlks>& oldBlks)
+{
+    int ret = vsaMaps[volId]->UnmapEntries(startRba, numBlks, oldBlks);
+    if (ret < 0)
+    {
+        POS_TRACE_ERROR(EID(VSAMAP_SET_FAILURE), "[Mapper VSAMap] failed to unmap VSAMap entries, volumeId:{}  startRba:{}  numBlks:{}",
+            volId, startRba, numBlks);
+    }
+    return ret;
+}
+
 VirtualBlkAddr
 VSAMapManager::GetVSAWoCond(int volId, BlkAddr rba)
 {
@@ -571,23 +798,188 @@ VSAMapManager::_MapLoadDone(int volId)
 int
 VSAMapManager::_UpdateVsaMap(int volumeId, BlkAddr startRba, VirtualBlks& virtualBlks)
 {
-    int ret = 0;
-    VSAMapContent* vsaMap = vsaMaps[volumeId];
+    int ret = vsaMaps[volumeId]->SetEntries(startRba, virtualBlks);
+    if (ret < 0)
+    {
+        POS_TRACE_ERROR(EID(VSAMAP_SET_FAILURE), "[Mapper VSAMap] failed to update VSAMap Info, volumeId:{}  startRba:{}  startVsa.sid:{}  startVsa.offset:{}  numBlks:{}",
+            volumeId, startRba, virtualBlks.startVsa.stripeId, virtualBlks.startVsa.offset, virtualBlks.numBlks);
+    }
+    return ret;
+}
+
+MpageCache*
+VSAMapManager::GetMpageCache(void)
+{
+    return mpageCache;
+}
 
-    for (uint32_t blkIdx = 0; blkIdx < virtualBlks.numBlks; blkIdx++)
+void
+VSAMapManager::SetVSAMapGeneration(VSAMapGeneration* gen)
+{
+    // only for UT
+    if (generation != nullptr)
     {
-        VirtualBlkAddr targetVsa = {.stripeId = virtualBlks.startVsa.stripeId,
-            .offset = virtualBlks.startVsa.offset + blkIdx};
-        BlkAddr targetRba = startRba + blkIdx;
-        ret = vsaMap->SetEntry(targetRba, targetVsa);
+        delete generation;
+    }
+    generation = gen;
+}
+
+VSAMapContent*
+VSAMapManager::_GetDetachedMap(int volId)
+{
+    std::lock_guard<std::mutex> guard(detachedMapLock);
+    auto it = detachedMaps.find(volId);
+    return (it == detachedMaps.end()) ? nullptr : it->second;
+}
+
+// The maps of the volumes deleted before a restart are loaded back so that
+// their reclaim is resumed. A retired volume whose map file is already gone had
+// its blocks reclaimed, only the record in VSAMapGeneration was not cleared
+void
+VSAMapManager::_LoadDetachedMaps(void)
+{
+    for (auto& retired : generation->GetRetiredVolumes())
+    {
+        int volId = retired.first;
+        VSAMapContent* content = new VSAMapContent(volId, addrInfo);
+        content->SetMpageCache(mpageCache);
+        if (content->InMemoryInit(volId, retired.second, addrInfo->GetMpageSize()) != 0)
+        {
+            POS_TRACE_ERROR(EID(MAPPER_FAILED), "[Mapper VSAMap] Failed to prepare the map of retired volume:{}, arrayId:{}", volId, addrInfo->GetArrayId());
+            delete content;
+            continue;
+        }
+        int ret = content->OpenMapFile();
+        if (ret == EID(NEED_TO_INITIAL_STORE))
+        {
+            POS_TRACE_INFO(EID(MAPPER_INFO), "[Mapper VSAMap] The map of retired volume:{} is already reclaimed, arrayId:{}", volId, addrInfo->GetArrayId());
+            content->DeleteMapFile();
+            delete content;
+            generation->Reclaimed(volId);
+            continue;
+        }
+        else if (ret < 0)
+        {
+            delete content;
+            continue;
+        }
+
+        AsyncLoadCallBack cbLoadDone = [this, volId](int mapId) { _DetachedMapLoadDone(volId); };
+        numLoadIssuedCount++;
+        ret = content->Load(cbLoadDone);
         if (ret < 0)
         {
-            POS_TRACE_ERROR(EID(VSAMAP_SET_FAILURE), "[Mapper VSAMap] failed to update VSAMap Info, volumeId:{}  targetRba:{}  targetVsa.sid:{}  targetVsa.offset:{}",
-                volumeId, targetRba, targetVsa.stripeId, targetVsa.offset);
-            break;
+            numLoadIssuedCount--;
+            if (ret != ERRID(MAP_LOAD_COMPLETED))
+            {
+                POS_TRACE_ERROR(EID(MAPPER_FAILED), "[Mapper VSAMap] Failed to load the map of retired volume:{}, arrayId:{}, ret:{}", volId, addrInfo->GetArrayId(), ret);
+                delete content;
+                continue;
+            }
         }
+        std::lock_guard<std::mutex> guard(detachedMapLock);
+        detachedMaps[volId] = content;
+    }
+}
+
+void
+VSAMapManager::_DetachedMapLoadDone(int volId)
+{
+    POS_TRACE_INFO(EID(MAP_LOAD_COMPLETED), "[Mapper VSAMap] Load Done of retired volume:{} arrayId:{}", volId, addrInfo->GetArrayId());
+    assert(numLoadIssuedCount > 0);
+    numLoadIssuedCount--;
+}
+
+// The map file keeps the layout it was created with, whatever size the volume
+// has been grown to since
+uint64_t
+VSAMapManager::_GetMapCapacity(int volId, uint64_t blkCnt)
+{
+    uint64_t entriesPerMpage = addrInfo->GetMpageSize() / sizeof(VirtualBlkAddr);
+    uint64_t capacity = (generation == nullptr) ? 0 : generation->GetMapCapacity(volId) * entriesPerMpage;
+    if (capacity == 0)
+    {
+        capacity = DivideUp(blkCnt, entriesPerMpage) * entriesPerMpage;
+    }
+    return std::max(capacity, blkCnt);
+}
+
+uint32_t
+VSAMapManager::_GetGrowHeadroomPercent(void)
+{
+    uint32_t headroom = DEFAULT_VSA_MAP_GROW_HEADROOM_PERCENT;
+    int ret = ConfigManagerSingleton::Instance()->GetValue("mapper", "vsa_map_grow_headroom_percent", &headroom, ConfigType::CONFIG_TYPE_UINT32);
+    if (ret != 0)
+    {
+        headroom = DEFAULT_VSA_MAP_GROW_HEADROOM_PERCENT;
+    }
+    return headroom;
+}
+
+void
+VSAMapManager::_CreateMpageCache(void)
+{
+    if (mpageCache != nullptr)
+    {
+        return;
+    }
+
+    bool enabled = false;
+    ConfigManager* configManager = ConfigManagerSingleton::Instance();
+    int ret = configManager->GetValue("mapper", "vsa_map_demand_paging", &enabled, ConfigType::CONFIG_TYPE_BOOL);
+    if ((ret != 0) || (enabled == false))
+    {
+        return;
+    }
+
+    uint64_t cacheSizeInMb = DEFAULT_VSA_MAP_CACHE_SIZE_IN_MB;
+    ret = configManager->GetValue("mapper", "vsa_map_cache_size_in_mb", &cacheSizeInMb, ConfigType::CONFIG_TYPE_UINT64);
+    if (ret != 0)
+    {
+        cacheSizeInMb = DEFAULT_VSA_MAP_CACHE_SIZE_IN_MB;
+    }
+
+    // clean mpages evicted from the cache are kept run-length encoded within this budget
+    uint64_t compressedSizeInMb = 0;
+    ret = configManager->GetValue("mapper", "vsa_map_compressed_cache_size_in_mb", &compressedSizeInMb, ConfigType::CONFIG_TYPE_UINT64);
+    if (ret != 0)
+    {
+        compressedSizeInMb = 0;
+    }
+
+    uint64_t mpageSize = addrInfo->GetMpageSize();
+    uint64_t budgetInMpages = std::max((cacheSizeInMb * SZ_1MB) / mpageSize, (uint64_t)1);
+    mpageCache = new MpageCache(mpageSize, budgetInMpages, compressedSizeInMb * SZ_1MB);
+    POS_TRACE_INFO(EID(MAPPER_INFO), "[Mapper VSAMap] Demand paging enabled, cacheSizeInMb:{}, budgetInMpages:{}, compressedSizeInMb:{}, arrayId:{}",
+        cacheSizeInMb, budgetInMpages, compressedSizeInMb, addrInfo->GetArrayId());
+}
+
+void
+VSAMapManager::_PublishMpageCodecStats(void)
+{
+    if ((mpageCache == nullptr) || (mpageCache->IsEncodingEnabled() == false))
+    {
+        return;
+    }
+
+    MpageCodecStats stats = mpageCache->GetCodecStats();
+    POSMetricValue v;
+    v.gauge = stats.numEncodedPages;
+    tp->PublishData(TEL33013_MAP_VSA_COMPRESSED_MPAGE_CNT, v, MT_GAUGE);
+    v.gauge = (stats.encodedBytes == 0) ? 0 : (stats.numEncodedPages * addrInfo->GetMpageSize()) / stats.encodedBytes;
+    tp->PublishData(TEL33014_MAP_VSA_COMPRESSION_RATIO, v, MT_GAUGE);
+    v.gauge = (stats.numDecodes == 0) ? 0 : stats.decodeTimeNs / stats.numDecodes;
+    tp->PublishData(TEL33015_MAP_VSA_MPAGE_DECODE_TIME_AVG_NS, v, MT_GAUGE);
+}
+
+void
+VSAMapManager::_DeleteMpageCache(void)
+{
+    if (mpageCache != nullptr)
+    {
+        delete mpageCache;
+        mpageCache = nullptr;
     }
-    return ret;
 }
 
 } // namespace pos
@@ -40,13 +40,17 @@
 
 #include <condition_variable>
 #include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 
 namespace pos
 {
 class EventScheduler;
+class MpageCache;
 class TelemetryPublisher;
+class VSAMapGeneration;
+class WarmRestartImage;
 
 class VSAMapManager : public IMapManagerInternal
 {
@@ -59,10 +63,13 @@ public:
     virtual void Dispose(void);
 
     virtual int CreateVsaMapContent(VSAMapContent* vsaMap, int volId, uint64_t volSizeByte, bool delVol);
+    virtual int ReserveMapCapacity(int volId, uint64_t volSizeByte);
+    virtual int GrowVSAMap(int volId, uint64_t curSizeByte, uint64_t newSizeByte);
     virtual int LoadVSAMapFile(int volId);
     virtual int FlushDirtyPagesGiven(int volId, MpageList list, EventSmartPtr cb);
     virtual int FlushTouchedPages(int volId, EventSmartPtr cb);
     virtual int FlushAllMaps(void);
+    virtual void AddToWarmRestartImage(WarmRestartImage* image);
     virtual void WaitAllPendingIoDone(void);
     virtual void WaitLoadPendingIoDone(void);
     virtual void WaitWritePendingIoDone(void);
@@ -71,11 +78,14 @@ public:
     virtual void MapFlushDone(int mapId);
 
     virtual int GetVSAs(int volumeId, BlkAddr startRba, uint32_t numBlks, VsaArray& vsaArray);
+    virtual int GetVsaExtents(int volumeId, BlkAddr startRba, uint32_t numBlks, VsaExtentArray& extents, uint32_t& numExtents);
     virtual int SetVSAs(int volumeId, BlkAddr startRba, VirtualBlks& virtualBlks);
+    virtual int UnmapVSAs(int volumeId, BlkAddr startRba, uint64_t numBlks, std::vector<VirtualBlks>& oldBlks);
     virtual VirtualBlkAddr GetRandomVSA(BlkAddr rba);
     virtual int64_t GetNumUsedBlks(int volId);
     virtual VirtualBlkAddr GetVSAWoCond(int volumeId, BlkAddr rba);
     virtual int SetVSAsWoCond(int volumeId, BlkAddr startfRba, VirtualBlks& virtualBlks);
+    virtual int UnmapVSAsWoCond(int volumeId, BlkAddr startRba, uint64_t numBlks, std::vector<VirtualBlks>& oldBlks);
     virtual MpageList GetDirtyVsaMapPages(int volId, BlkAddr startRba, uint64_t numBlks);
     virtual VSAMapContent* GetVSAMapContent(int volId);
     virtual void SetVSAMapContent(int volId, VSAMapContent* content);
@@ -83,6 +93,10 @@ public:
     virtual bool NeedToDeleteFile(int volId);
     virtual int InvalidateAllBlocks(int volId, ISegmentCtx* segmentCtx);
     virtual int DeleteVSAMap(int volId);
+    virtual int DetachVSAMap(int volId);
+    virtual bool CollectDetachedBlocks(int volId, uint64_t& mpageId, uint32_t numMpages, std::vector<VirtualBlks>& validBlks);
+    virtual int DeleteDetachedMap(int volId);
+    virtual std::vector<int> GetDetachedVolumes(void);
 
     virtual bool IsVsaMapAccessible(int volId);
     virtual void EnableVsaMapAccess(int volId);
@@ -94,9 +108,24 @@ public:
     virtual int Dump(int volId, std::string fileName);
     virtual int DumpLoad(int volId, std::string fileName);
 
+    virtual MpageCache* GetMpageCache(void);
+
+    virtual void SetVSAMapGeneration(VSAMapGeneration* gen);
+
 private:
     void _MapLoadDone(int volId);
+    void _DetachedMapLoadDone(int volId);
+    void _LoadDetachedMaps(void);
+    VSAMapContent* _GetDetachedMap(int volId);
     int _UpdateVsaMap(int volumeId, BlkAddr startRba, VirtualBlks& virtualBlks);
+    uint64_t _GetMapCapacity(int volId, uint64_t blkCnt);
+    uint32_t _GetGrowHeadroomPercent(void);
+    void _CreateMpageCache(void);
+    void _DeleteMpageCache(void);
+    void _PublishMpageCodecStats(void);
+
+    static const uint64_t DEFAULT_VSA_MAP_CACHE_SIZE_IN_MB = 4096;
+    static const uint32_t DEFAULT_VSA_MAP_GROW_HEADROOM_PERCENT = 0;
 
     MapperAddressInfo* addrInfo;
     VSAMapContent* vsaMaps[MAX_VOLUME_COUNT];
@@ -108,6 +137,10 @@ private:
     std::atomic<int> numLoadIssuedCount;
     EventScheduler* eventScheduler;
     TelemetryPublisher* tp;
+    MpageCache* mpageCache = nullptr;
+    VSAMapGeneration* generation = nullptr;
+    std::map<int, VSAMapContent*> detachedMaps;
+    std::mutex detachedMapLock;
 };
 
 } // namespace pos
@@ -81,16 +81,26 @@ private:
         {"enable", "true"},
         {"buffer_size_in_mb", "0"},
         {"number_of_log_groups", "2"},
+        {"number_of_log_streams", "1"},
         {"debug_mode", "false"},
-        {"interval_in_msec_for_metric", "1000"}
+        {"interval_in_msec_for_metric", "1000"},
+        {"enable_compact_log", "false"},
+        {"enable_direct_nvram_write", "false"},
+        {"group_commit_window_in_usec", "20"},
+        {"group_commit_max_batch_size_in_kb", "64"},
+        {"checkpoint_dirty_page_budget", "0"},
+        {"checkpoint_target_replay_time_in_msec", "0"}
     };
     vector<ConfigKeyValue> flushData = {
         {"enable", "false"},
         {"internal_flush_enable", "true"},
-        {"internal_flush_threshold", "5"}
+        {"internal_flush_threshold", "5"},
+        {"nvram_durable_flush_enable", "false"}
     };
     vector<ConfigKeyValue> adminData = {
-        {"smart_log_page", "false"}
+        {"smart_log_page", "false"},
+        {"smart_sampler_enable", "false"},
+        {"smart_sample_interval_in_sec", "60"}
     };
     vector<ConfigKeyValue> loggerData = {
         {"logfile_size_in_mb", "50"},
@@ -99,19 +109,25 @@ private:
         // TODO (mj): The default value of structured_logging will be
         // TRUE after implementing the strcutured logging functionality.
         {"enable_structured_logging", "false"},
+        {"enable_async_logging", "false"},
     };
     vector<ConfigKeyValue> telemetryData = {
         {"enable_selective_publication", "true"},
         {"interval_in_millisecond_for_easy_telemetry_publisher", "1000"},
+        {"export_mode", "\"grpc\""},
     };
     vector<ConfigKeyValue> eventSchedulerData = {
-        {"numa_dedicated", "false"}
+        {"numa_dedicated", "false"},
+        {"work_stealing", "false"}
     };
     vector<ConfigKeyValue> debugData = {
-        {"memory_checker", "false"}
+        {"memory_checker", "false"},
+        {"dump_shared_ptr_sample_rate", "1"},
+        {"flight_recorder", "true"}
     };
     vector<ConfigKeyValue> ioatData = {
-        {"enable", "true"}
+        {"enable", "true"},
+        {"copy_offload_threshold_kb", "128"}
     };
     vector<ConfigKeyValue> affinityManagerData = {
         {"use_config", "true"},
@@ -129,7 +145,14 @@ private:
         {"use_config", "true"},
         {"ssd_timeout_us", "8000000"},
         {"retry_count_backend_io", "5"},
-        {"retry_count_frontend_io", "3"}
+        {"retry_count_frontend_io", "3"},
+        {"qpair_per_traffic_class", "false"},
+        {"wrr_arbitration_enable", "false"},
+        {"data_placement", "\"none\""},
+        {"placement_handle_host", "0"},
+        {"placement_handle_gc", "1"},
+        {"placement_handle_meta", "2"},
+        {"placement_handle_journal", "3"}
     };
     vector<ConfigKeyValue> perfImpactData = {
         {"rebuild", "\"high\""}
@@ -141,7 +164,15 @@ private:
         {"percent_of_normal_gc_threshold_to_total_capacity", "1"},
         {"percent_of_urgent_gc_threshold_to_normal_gc_threshold", "10"},
         {"normal_gc_threshold_count_lower_bound", "20"},
-        {"urgent_gc_threshold_count_lower_bound", "5"}
+        {"urgent_gc_threshold_count_lower_bound", "5"},
+        {"victim_policy", "\"greedy\""},
+        {"free_segment_policy", "\"lowest_id\""},
+        {"hot_cold_separation", "false"},
+        {"cold_data_separation", "false"},
+        {"cold_data_min_age_in_segments", "4"},
+        {"copy_offload_enable", "false"},
+        {"host_latency_target_us", "5000"},
+        {"concurrent_copier_count", "1"}
     };
     vector<ConfigKeyValue> flowControlData = {
         {"enable", "true"},
@@ -159,7 +190,8 @@ private:
         {"enable", "false"},
         {"type", "\"tcp\""},
         {"buf_cache_size", "64"},
-        {"num_shared_buffer", "4096"}
+        {"num_shared_buffer", "4096"},
+        {"zcopy", "false"}
     };
     vector<ConfigKeyValue> metaFsData = {
         {"mio_pool_capacity", "64"},
@@ -172,17 +204,41 @@ private:
         {"wrr_count_journal", "1"},
         {"wrr_count_map", "1"},
         {"wrr_count_general", "1"},
+        {"deadline_in_us_special_purpose_map", "0"},
+        {"deadline_in_us_journal", "1000"},
+        {"deadline_in_us_map", "0"},
+        {"deadline_in_us_general", "0"},
+        {"scheduler_count_per_numa", "1"},
         {"support_checking_crc_when_reading", "true"},
+        {"file_store_path", "\"\""},
+        {"placement_advisor_enable", "false"},
+        {"auto_placement_enable", "false"},
+        {"nvram_placement_budget_in_mb", "64"},
+        {"hot_file_max_size_in_kb", "4096"},
+        {"hot_file_min_iops", "100"},
     };
     vector<ConfigKeyValue> wtData = {
         {"enable", "false"}
     };
     vector<ConfigKeyValue> traceData = {
         {"enable", "false"},
-        {"collector_endpoint", "\"http://localhost:3418/v1/traces\""}
+        {"collector_endpoint", "\"http://localhost:3418/v1/traces\""},
+        {"io_stage_sample_rate", "0"}
     };
     vector<ConfigKeyValue> rebuildData = {
-        {"auto_start", "true"}
+        {"auto_start", "true"},
+        {"stripe_queue_depth", "256"},
+        {"scrub_enable", "false"},
+        {"scrub_stripe_interval_us", "1000"}
+    };
+    vector<ConfigKeyValue> mapperData = {
+        {"vsa_map_demand_paging", "false"},
+        {"vsa_map_cache_size_in_mb", "4096"},
+        {"vsa_map_compressed_cache_size_in_mb", "0"},
+        {"map_load_queue_depth", "32"},
+        {"reverse_map_cache_entries", "1024"},
+        {"reverse_map_in_stripe_footer", "false"},
+        {"warm_restart_enable", "false"}
     };
 
     using ConfigList =
@@ -206,7 +262,8 @@ private:
         {"metafs", metaFsData},
         {"write_through", wtData},
         {"trace", traceData},
-        {"rebuild", rebuildData}
+        {"rebuild", rebuildData},
+        {"mapper", mapperData}
     };
 
     const string CONFIGURATION_PATH = "/etc/pos/";
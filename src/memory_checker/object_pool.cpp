@@ -0,0 +1,243 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "object_pool.h"
+
+#include <cstdlib>
+
+#include "src/include/branch_prediction.h"
+#include "src/memory_checker/memory_checker.h"
+
+namespace pos
+{
+ObjectPoolCache* ObjectPool::caches[ObjectPool::MAX_CACHE_COUNT] = {nullptr, };
+std::atomic<uint32_t> ObjectPool::cacheCount(0);
+std::atomic<bool> ObjectPool::enable(false);
+thread_local ObjectPool::CacheHolder ObjectPool::localCache;
+
+ObjectPoolCache::ObjectPoolCache(uint32_t index, uint32_t sizeClassCount, uint32_t ringSize)
+: index(index),
+  retired(false),
+  freeList(sizeClassCount),
+  returnRing(ringSize)
+{
+}
+
+ObjectPoolCache::~ObjectPoolCache(void)
+{
+}
+
+void*
+ObjectPool::New(std::size_t size)
+{
+    std::size_t blockSize = size + sizeof(Header);
+    std::size_t sizeClass = (blockSize + SIZE_CLASS_BYTES - 1) / SIZE_CLASS_BYTES - 1;
+    ObjectPoolCache* cache = nullptr;
+    if (likely(enable == true) && sizeClass < SIZE_CLASS_COUNT)
+    {
+        cache = _GetCache();
+    }
+
+    Header* header = nullptr;
+    if (unlikely(nullptr == cache))
+    {
+        header = static_cast<Header*>(MemoryChecker::New(blockSize));
+        header->sizeClass = NOT_POOLED;
+        header->tag = 0;
+        return header + 1;
+    }
+
+    std::vector<void*>& freeList = cache->freeList[sizeClass];
+    if (freeList.empty() == true)
+    {
+        _DrainReturnRing(cache);
+    }
+    if (freeList.empty() == false)
+    {
+        header = static_cast<Header*>(freeList.back());
+        freeList.pop_back();
+        cache->stats.hit++;
+    }
+    else
+    {
+        header = static_cast<Header*>(std::malloc((sizeClass + 1) * SIZE_CLASS_BYTES));
+        cache->stats.miss++;
+    }
+    header->sizeClass = sizeClass;
+    header->cacheIndex = cache->index;
+    header->tag = 0;
+    return header + 1;
+}
+
+void
+ObjectPool::Delete(void* ptr)
+{
+    if (nullptr == ptr)
+    {
+        return;
+    }
+
+    Header* header = static_cast<Header*>(ptr) - 1;
+    if (NOT_POOLED == header->sizeClass)
+    {
+        MemoryChecker::Delete(header);
+        return;
+    }
+
+    ObjectPoolCache* cache = localCache.cache;
+    if (likely(nullptr != cache && cache->index == header->cacheIndex))
+    {
+        cache->stats.localReturn++;
+        _Return(cache, header);
+        return;
+    }
+
+    ObjectPoolCache* owner = caches[header->cacheIndex];
+    if (owner->returnRing.Push(header) == true)
+    {
+        owner->stats.remoteReturn++;
+        return;
+    }
+    owner->stats.overflow++;
+    std::free(header);
+}
+
+void
+ObjectPool::Enable(bool flag)
+{
+    enable = flag;
+}
+
+bool
+ObjectPool::IsEnabled(void)
+{
+    return enable;
+}
+
+void
+ObjectPool::SetTag(void* ptr, uint64_t tag)
+{
+    (static_cast<Header*>(ptr) - 1)->tag = tag;
+}
+
+uint64_t
+ObjectPool::GetTag(void* ptr)
+{
+    return (static_cast<Header*>(ptr) - 1)->tag;
+}
+
+ObjectPoolCache*
+ObjectPool::_GetCache(void)
+{
+    ObjectPoolCache* cache = localCache.cache;
+    if (unlikely(nullptr == cache) && localCache.adoptFailed == false)
+    {
+        cache = _AdoptCache();
+        localCache.cache = cache;
+        localCache.adoptFailed = (nullptr == cache);
+    }
+    return cache;
+}
+
+// A retired cache may still hold the objects returned after its owner exited,
+// which are taken over by the next owner
+ObjectPoolCache*
+ObjectPool::_AdoptCache(void)
+{
+    uint32_t count = cacheCount.load();
+    if (count > MAX_CACHE_COUNT)
+    {
+        count = MAX_CACHE_COUNT;
+    }
+    for (uint32_t index = 0; index < count; index++)
+    {
+        ObjectPoolCache* cache = caches[index];
+        bool expected = true;
+        if (nullptr != cache && cache->retired.compare_exchange_strong(expected, false))
+        {
+            return cache;
+        }
+    }
+
+    uint32_t index = cacheCount.fetch_add(1);
+    if (index >= MAX_CACHE_COUNT)
+    {
+        return nullptr;
+    }
+    caches[index] = new ObjectPoolCache(index, SIZE_CLASS_COUNT, RETURN_RING_SIZE);
+    return caches[index];
+}
+
+void
+ObjectPool::_DrainReturnRing(ObjectPoolCache* cache)
+{
+    void* block = nullptr;
+    while (cache->returnRing.Pop(block) == true)
+    {
+        _Return(cache, static_cast<Header*>(block));
+    }
+}
+
+void
+ObjectPool::_Return(ObjectPoolCache* cache, Header* header)
+{
+    std::vector<void*>& freeList = cache->freeList[header->sizeClass];
+    if (freeList.size() < MAX_FREE_OBJECTS)
+    {
+        freeList.push_back(header);
+        return;
+    }
+    cache->stats.overflow++;
+    std::free(header);
+}
+
+ObjectPool::CacheHolder::~CacheHolder(void)
+{
+    if (nullptr == cache)
+    {
+        return;
+    }
+    _DrainReturnRing(cache);
+    for (auto& freeList : cache->freeList)
+    {
+        for (void* block : freeList)
+        {
+            std::free(block);
+        }
+        freeList.clear();
+    }
+    ObjectPoolCache* retiredCache = cache;
+    cache = nullptr;
+    retiredCache->retired = true;
+}
+
+} // namespace pos
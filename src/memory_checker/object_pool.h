@@ -0,0 +1,125 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "src/lib/mpsc_ring.h"
+
+namespace pos
+{
+// Counters of a per-thread cache, read from a core dump by posgdb
+struct ObjectPoolStats
+{
+    uint64_t hit = 0;
+    uint64_t miss = 0;
+    uint64_t localReturn = 0;
+    std::atomic<uint64_t> remoteReturn{0};
+    std::atomic<uint64_t> overflow{0};
+};
+
+class ObjectPoolCache
+{
+public:
+    ObjectPoolCache(uint32_t index, uint32_t sizeClassCount, uint32_t ringSize);
+    ~ObjectPoolCache(void);
+
+    uint32_t index;
+    std::atomic<bool> retired;
+    std::vector<std::vector<void*>> freeList;
+    MpscRing<void*> returnRing;
+    ObjectPoolStats stats;
+};
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Per-thread size-class pool for the objects allocated on io path
+ *           Every thread keeps its own free lists, so that allocation on a
+ *           reactor or an event worker takes no lock. An object freed on
+ *           another thread goes back to its owner through the return ring of
+ *           the owner, and the owner takes it out when its free list is empty.
+ *           Memory checker allocates and tracks the objects as before,
+ *           if the pool is disabled or the object is larger than a size class.
+ */
+/* --------------------------------------------------------------------------*/
+class ObjectPool
+{
+public:
+    static void* New(std::size_t size);
+    static void Delete(void* ptr);
+    static void Enable(bool flag);
+    static bool IsEnabled(void);
+    // One tag per object, kept in front of it until it is freed
+    static void SetTag(void* ptr, uint64_t tag);
+    static uint64_t GetTag(void* ptr);
+
+    static const uint32_t SIZE_CLASS_BYTES = 64;
+    static const uint32_t SIZE_CLASS_COUNT = 16;
+    static const uint32_t MAX_CACHE_COUNT = 256;
+    static const uint32_t MAX_FREE_OBJECTS = 4096;
+    static const uint32_t RETURN_RING_SIZE = 4096;
+
+private:
+    // Keeps malloc alignment for the object behind it
+    struct Header
+    {
+        uint32_t sizeClass;
+        uint32_t cacheIndex;
+        uint64_t tag;
+    };
+    static const uint32_t NOT_POOLED = UINT32_MAX;
+
+    static ObjectPoolCache* _GetCache(void);
+    static ObjectPoolCache* _AdoptCache(void);
+    static void _DrainReturnRing(ObjectPoolCache* cache);
+    static void _Return(ObjectPoolCache* cache, Header* header);
+
+    static ObjectPoolCache* caches[MAX_CACHE_COUNT];
+    static std::atomic<uint32_t> cacheCount;
+    static std::atomic<bool> enable;
+
+    // Hands the cache over to the next thread when its owner exits
+    class CacheHolder
+    {
+    public:
+        ~CacheHolder(void);
+        ObjectPoolCache* cache = nullptr;
+        bool adoptFailed = false;
+    };
+    static thread_local CacheHolder localCache;
+};
+
+} // namespace pos
@@ -78,6 +78,12 @@ public:
     {
         return volumeType;
     }
+    // Returns the address where the file data at fileOffset can be stored by
+    // a plain memory copy, or nullptr if the file is not byte addressable
+    virtual char* GetDirectAccessAddress(uint64_t fileOffset)
+    {
+        return nullptr;
+    }
     // SyncIO APIs
     virtual int IssueIO(MetaFsIoOpcode opType, uint64_t fileOffset, uint64_t length, char* buffer);
     virtual int AppendIO(MetaFsIoOpcode opType, uint64_t& offset, uint64_t length, char* buffer);
@@ -46,5 +46,6 @@ public:
     virtual int UpdateBlockMap(VolumeIoSmartPtr volumeIo, CallbackSmartPtr callback) = 0;
     virtual int UpdateStripeMap(StripeSmartPtr stripe, CallbackSmartPtr callback) = 0;
     virtual int UpdateGcMap(StripeSmartPtr stripe, GcStripeMapUpdateList mapUpdateInfoList, std::map<SegmentId, uint32_t> invalidSegCnt, CallbackSmartPtr callback) = 0;
+    virtual int UnmapBlockRange(int volId, BlkAddr startRba, uint64_t numBlks, CallbackSmartPtr callback) = 0;
 };
 } // namespace pos
@@ -32,9 +32,14 @@
 
 #include "src/metadata/block_map_update.h"
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 #include "src/bio/volume_io.h"
 #include "src/include/branch_prediction.h"
 #include "src/include/pos_event_id.hpp"
+#include "src/io/general_io/block_checksum.h"
 #include "src/io/general_io/vsa_range_maker.h"
 #include "src/logger/logger.h"
 #include "src/spdk_wrapper/event_framework_api.h"
@@ -42,22 +47,25 @@
 namespace pos
 {
 BlockMapUpdate::BlockMapUpdate(VolumeIoSmartPtr volumeIo, IVSAMap* vsaMap,
-    ISegmentCtx* segmentCtx_, IWBStripeAllocator* wbStripeAllocator)
+    ISegmentCtx* segmentCtx_, IWBStripeAllocator* wbStripeAllocator,
+    uint32_t stripesPerSegment)
 : BlockMapUpdate(volumeIo, vsaMap, segmentCtx_, wbStripeAllocator,
     new VsaRangeMaker(volumeIo->GetVolumeId(),
         ChangeSectorToBlock(volumeIo->GetSectorRba()),
-        DivideUp(volumeIo->GetSize(), BLOCK_SIZE), volumeIo->GetArrayId()))
+        DivideUp(volumeIo->GetSize(), BLOCK_SIZE), volumeIo->GetArrayId()),
+    stripesPerSegment)
 {
 }
 
 BlockMapUpdate::BlockMapUpdate(VolumeIoSmartPtr volumeIo, IVSAMap* vsaMap,
     ISegmentCtx* segmentCtx_, IWBStripeAllocator* wbStripeAllocator,
-    VsaRangeMaker* vsaRangeMaker)
+    VsaRangeMaker* vsaRangeMaker, uint32_t stripesPerSegment)
 : MetaUpdateCallback(EventFrameworkApiSingleton::Instance()->IsReactorNow(), segmentCtx_),
     volumeIo(volumeIo),
     vsaMap(vsaMap),
     wbStripeAllocator(wbStripeAllocator),
-    oldVsaRangeMaker(vsaRangeMaker)
+    oldVsaRangeMaker(vsaRangeMaker),
+    stripesPerSegment(stripesPerSegment)
 {
 }
 
@@ -84,6 +92,23 @@ BlockMapUpdate::_DoSpecificJob(void)
     StripeSmartPtr stripe = _GetStripe(lsidEntry);
     _UpdateReverseMap(stripe);
 
+    if (stripesPerSegment == 0)
+    {
+        _InvalidateOldVsas();
+    }
+    else
+    {
+        _InvalidateOldVsasPerSegment();
+    }
+
+    ValidateBlks(targetVsaRange);
+
+    return true;
+}
+
+void
+BlockMapUpdate::_InvalidateOldVsas(void)
+{
     uint32_t vsaRangeCount = oldVsaRangeMaker->GetCount();
     for (uint32_t vsaRangeIndex = 0; vsaRangeIndex < vsaRangeCount;
         vsaRangeIndex++)
@@ -95,10 +120,48 @@ BlockMapUpdate::_DoSpecificJob(void)
         POS_TRACE_DEBUG_IN_MEMORY(ModuleInDebugLogDump::META, EID(MAPPER_SUCCESS),
             "Invalidate rba {} vsid {}", ChangeSectorToBlock(volumeIo->GetSectorRba()), vsaRange.startVsa.stripeId);
     }
+}
 
-    ValidateBlks(targetVsaRange);
+void
+BlockMapUpdate::_InvalidateOldVsasPerSegment(void)
+{
+    // Segment context only looks at the segment of the given vsa, so the
+    // old ranges of one write are summed up per segment and each segment's
+    // valid count is decreased once. A write spans only a few segments,
+    // so a linear search keeps the first-seen order without a map.
+    std::vector<std::pair<SegmentId, uint32_t>> invalidBlkCount;
+    uint32_t vsaRangeCount = oldVsaRangeMaker->GetCount();
+    for (uint32_t vsaRangeIndex = 0; vsaRangeIndex < vsaRangeCount;
+        vsaRangeIndex++)
+    {
+        VirtualBlks& vsaRange = oldVsaRangeMaker->GetVsaRange(vsaRangeIndex);
+        SegmentId segmentId = vsaRange.startVsa.stripeId / stripesPerSegment;
+
+        auto it = std::find_if(invalidBlkCount.begin(), invalidBlkCount.end(),
+            [segmentId](const std::pair<SegmentId, uint32_t>& entry) { return entry.first == segmentId; });
+        if (it == invalidBlkCount.end())
+        {
+            invalidBlkCount.emplace_back(segmentId, vsaRange.numBlks);
+        }
+        else
+        {
+            it->second += vsaRange.numBlks;
+        }
 
-    return true;
+        POS_TRACE_DEBUG_IN_MEMORY(ModuleInDebugLogDump::META, EID(MAPPER_SUCCESS),
+            "Invalidate rba {} vsid {}", ChangeSectorToBlock(volumeIo->GetSectorRba()), vsaRange.startVsa.stripeId);
+    }
+
+    for (auto& entry : invalidBlkCount)
+    {
+        VirtualBlks invalidRange = {
+            .startVsa = {
+                .stripeId = entry.first * stripesPerSegment,
+                .offset = 0},
+            .numBlks = entry.second};
+        bool allowVictimSegRelease = false;
+        InvalidateBlks(invalidRange, allowVictimSegRelease);
+    }
 }
 
 void
@@ -109,12 +172,22 @@ BlockMapUpdate::_UpdateReverseMap(StripeSmartPtr stripe)
     uint64_t startRba = ChangeSectorToBlock(volumeIo->GetSectorRba());
     uint32_t startVsOffset = startVsa.offset;
     uint32_t volumeId = volumeIo->GetVolumeId();
+    // a partial block is merged with its old data in the write buffer, not in
+    // this buffer, so it is left without a checksum
+    bool checksumEnabled = BlockChecksum::IsEnabled() &&
+        (volumeIo->GetSectorRba() % SECTORS_PER_BLOCK == 0) &&
+        (volumeIo->GetSize() % BLOCK_SIZE == 0);
 
     for (uint32_t blockIndex = 0; blockIndex < blocks; blockIndex++)
     {
         uint64_t vsOffset = startVsOffset + blockIndex;
         BlkAddr targetRba = startRba + blockIndex;
         stripe->UpdateReverseMapEntry(vsOffset, targetRba, volumeId);
+        if (checksumEnabled)
+        {
+            uint32_t checksum = BlockChecksum::Compute(volumeIo->GetBuffer(blockIndex));
+            stripe->UpdateReverseMapChecksum(vsOffset, checksum);
+        }
     }
 }
 
@@ -47,10 +47,11 @@ class BlockMapUpdate : public MetaUpdateCallback
 {
 public:
     BlockMapUpdate(VolumeIoSmartPtr volumeIo, IVSAMap* vsaMap,
-        ISegmentCtx* segmentCtx_, IWBStripeAllocator* wbStripeAllocator);
+        ISegmentCtx* segmentCtx_, IWBStripeAllocator* wbStripeAllocator,
+        uint32_t stripesPerSegment = 0);
     BlockMapUpdate(VolumeIoSmartPtr volumeIo, IVSAMap* vsaMap,
         ISegmentCtx* segmentCtx_, IWBStripeAllocator* wbStripeAllocator,
-        VsaRangeMaker* vsaRangeMaker);
+        VsaRangeMaker* vsaRangeMaker, uint32_t stripesPerSegment = 0);
     virtual ~BlockMapUpdate(void);
 
 private:
@@ -58,10 +59,14 @@ private:
 
     void _UpdateReverseMap(StripeSmartPtr stripe);
     StripeSmartPtr _GetStripe(StripeAddr& lsidEntry);
+    void _InvalidateOldVsas(void);
+    void _InvalidateOldVsasPerSegment(void);
 
     VolumeIoSmartPtr volumeIo;
     IVSAMap* vsaMap;
     IWBStripeAllocator* wbStripeAllocator;
     VsaRangeMaker* oldVsaRangeMaker;
+    // 0 means the segment geometry is unknown, so old ranges are invalidated one by one
+    uint32_t stripesPerSegment;
 };
 } // namespace pos
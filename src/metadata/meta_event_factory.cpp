@@ -35,10 +35,12 @@
 #include "src/allocator/i_block_allocator.h"
 #include "src/allocator/i_context_manager.h"
 #include "src/allocator/i_wbstripe_allocator.h"
+#include "src/array_models/interface/i_array_info.h"
 #include "src/mapper/i_stripemap.h"
 #include "src/mapper/i_vsamap.h"
 #include "src/metadata/block_map_update.h"
 #include "src/metadata/gc_map_update.h"
+#include "src/metadata/range_unmap.h"
 #include "src/metadata/stripe_map_update.h"
 
 namespace pos
@@ -59,7 +61,13 @@ MetaEventFactory::MetaEventFactory(IVSAMap* vsaMap, IStripeMap* stripeMap,
 CallbackSmartPtr
 MetaEventFactory::CreateBlockMapUpdateEvent(VolumeIoSmartPtr volumeIo)
 {
-    CallbackSmartPtr callback(new BlockMapUpdate(volumeIo, vsaMap, segmentCtx, wbStripeAllocator));
+    uint32_t stripesPerSegment = 0;
+    const PartitionLogicalSize* userDataSize = (arrayInfo == nullptr) ? nullptr : arrayInfo->GetSizeInfo(PartitionType::USER_DATA);
+    if (userDataSize != nullptr)
+    {
+        stripesPerSegment = userDataSize->stripesPerSegment;
+    }
+    CallbackSmartPtr callback(new BlockMapUpdate(volumeIo, vsaMap, segmentCtx, wbStripeAllocator, stripesPerSegment));
     return callback;
 }
 
@@ -77,4 +85,17 @@ MetaEventFactory::CreateGcMapUpdateEvent(StripeSmartPtr stripe, GcStripeMapUpdat
     return callback;
 }
 
+CallbackSmartPtr
+MetaEventFactory::CreateRangeUnmapEvent(int volId, BlkAddr startRba, uint64_t numBlks)
+{
+    uint32_t stripesPerSegment = 0;
+    const PartitionLogicalSize* userDataSize = (arrayInfo == nullptr) ? nullptr : arrayInfo->GetSizeInfo(PartitionType::USER_DATA);
+    if (userDataSize != nullptr)
+    {
+        stripesPerSegment = userDataSize->stripesPerSegment;
+    }
+    CallbackSmartPtr callback(new RangeUnmap(volId, startRba, numBlks, vsaMap, segmentCtx, stripesPerSegment));
+    return callback;
+}
+
 } // namespace pos
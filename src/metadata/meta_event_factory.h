@@ -34,6 +34,7 @@
 
 #include <map>
 
+#include "src/include/address_type.h"
 #include "src/include/smart_ptr_type.h"
 #include "src/journal_manager/log/gc_map_update_list.h"
 
@@ -58,6 +59,7 @@ public:
     virtual CallbackSmartPtr CreateBlockMapUpdateEvent(VolumeIoSmartPtr volumeIo);
     virtual CallbackSmartPtr CreateStripeMapUpdateEvent(StripeSmartPtr stripe);
     virtual CallbackSmartPtr CreateGcMapUpdateEvent(StripeSmartPtr stripe, GcStripeMapUpdateList mapUpdateInfoList, std::map<SegmentId, uint32_t> invalidSegCnt);
+    virtual CallbackSmartPtr CreateRangeUnmapEvent(int volId, BlkAddr startRba, uint64_t numBlks);
 
 private:
     IVSAMap* vsaMap;
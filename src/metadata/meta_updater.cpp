@@ -151,4 +151,28 @@ MetaUpdater::UpdateGcMap(StripeSmartPtr stripe, GcStripeMapUpdateList mapUpdateI
     return result;
 }
 
+int
+MetaUpdater::UnmapBlockRange(int volId, BlkAddr startRba, uint64_t numBlks, CallbackSmartPtr callback)
+{
+    int result = 0;
+
+    CallbackSmartPtr rangeUnmap =
+        metaEventFactory->CreateRangeUnmapEvent(volId, startRba, numBlks);
+    rangeUnmap->SetCallee(callback);
+
+    if (journal->IsEnabled() == true)
+    {
+        result = journalWriter->AddRangeUnmappedLog(volId, startRba, numBlks, rangeUnmap);
+    }
+    else
+    {
+        bool executedSuccessfully = rangeUnmap->Execute();
+        if (unlikely(false == executedSuccessfully))
+        {
+            eventScheduler->EnqueueEvent(rangeUnmap);
+        }
+    }
+    return result;
+}
+
 } // namespace pos
@@ -63,6 +63,7 @@ public:
     virtual int UpdateBlockMap(VolumeIoSmartPtr volumeIo, CallbackSmartPtr callback) override;
     virtual int UpdateStripeMap(StripeSmartPtr stripe, CallbackSmartPtr callback) override;
     virtual int UpdateGcMap(StripeSmartPtr stripe, GcStripeMapUpdateList mapUpdateInfoList, std::map<SegmentId, uint32_t> invalidSegCnt, CallbackSmartPtr callback) override;
+    virtual int UnmapBlockRange(int volId, BlkAddr startRba, uint64_t numBlks, CallbackSmartPtr callback) override;
 
 private:
     IStripeMap* stripeMap;
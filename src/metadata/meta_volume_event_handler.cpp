@@ -38,18 +38,21 @@
 #include "src/allocator/i_wbstripe_allocator.h"
 #include "src/logger/logger.h"
 #include "src/include/pos_event_id.h"
+#include "src/metadata/volume_map_reclaimer.h"
 
 namespace pos
 {
 MetaVolumeEventHandler::MetaVolumeEventHandler(IArrayInfo* info,
     IMapperVolumeEventHandler* mapperVolumeEventHandler,
     Allocator* allocator,
-    IJournalVolumeEventHandler* journal)
+    IJournalVolumeEventHandler* journal,
+    VolumeMapReclaimer* reclaimer)
 : VolumeEvent("Metadata", info->GetName(), info->GetIndex()),
   arrayInfo(info),
   mapper(mapperVolumeEventHandler),
   allocator(allocator),
-  journal(journal)
+  journal(journal),
+  reclaimer(reclaimer)
 {
     VolumeEventPublisherSingleton::Instance()->RegisterSubscriber(this, arrayInfo->GetName(), arrayInfo->GetIndex());
 }
@@ -62,6 +65,11 @@ MetaVolumeEventHandler::~MetaVolumeEventHandler(void)
 int
 MetaVolumeEventHandler::VolumeCreated(VolumeEventBase* volEventBase, VolumeEventPerf* volEventPerf, VolumeArrayInfo* volArrayInfo)
 {
+    if (reclaimer != nullptr)
+    {
+        // A reused volume id gets the map file of the deleted volume back
+        reclaimer->WaitForVolume(volEventBase->volId);
+    }
     int result = mapper->VolumeCreated(volEventBase->volId, volEventBase->volSizeByte);
     return result;
 }
@@ -119,6 +127,17 @@ MetaVolumeEventHandler::VolumeDeleted(VolumeEventBase* volEventBase, VolumeArray
         return EID(VOL_EVENT_FAIL);
     }
 
+    if (reclaimer != nullptr)
+    {
+        // The blocks are invalidated in the background after the map is detached
+        result = reclaimer->Delete(volEventBase->volId);
+        if (result != 0)
+        {
+            return EID(VOL_EVENT_FAIL);
+        }
+        return EID(VOL_EVENT_OK);
+    }
+
     // Invalidate all blocks in the volume
     result = mapper->InvalidateAllBlocksTo(volEventBase->volId, allocator->GetISegmentCtx());
     if (result != 0)
@@ -167,4 +186,11 @@ MetaVolumeEventHandler::VolumeDetached(vector<int> volList, VolumeArrayInfo* vol
     return result;
 }
 
+int
+MetaVolumeEventHandler::VolumeResized(VolumeEventBase* volEventBase, VolumeArrayInfo* volArrayInfo)
+{
+    int result = mapper->VolumeResized(volEventBase->volId, volEventBase->volSizeByte);
+    return result;
+}
+
 } // namespace pos
@@ -42,6 +42,7 @@
 namespace pos
 {
 class Allocator;
+class VolumeMapReclaimer;
 
 class MetaVolumeEventHandler : public VolumeEvent
 {
@@ -49,7 +50,8 @@ public:
     MetaVolumeEventHandler(IArrayInfo* arrayInfo,
         IMapperVolumeEventHandler* mapper,
         Allocator* allocator,
-        IJournalVolumeEventHandler* journal);
+        IJournalVolumeEventHandler* journal,
+        VolumeMapReclaimer* reclaimer = nullptr);
     virtual ~MetaVolumeEventHandler(void);
 
     virtual int VolumeCreated(VolumeEventBase* volEventBase, VolumeEventPerf* volEventPerf, VolumeArrayInfo* volArrayInfo) override;
@@ -59,6 +61,7 @@ public:
     virtual int VolumeUnmounted(VolumeEventBase* volEventBase, VolumeArrayInfo* volArrayInfo) override;
     virtual int VolumeDeleted(VolumeEventBase* volEventBase, VolumeArrayInfo* volArrayInfo) override;
     virtual int VolumeDetached(vector<int> volList, VolumeArrayInfo* volArrayInfo) override;
+    virtual int VolumeResized(VolumeEventBase* volEventBase, VolumeArrayInfo* volArrayInfo) override;
 
 private:
     IArrayInfo* arrayInfo;
@@ -66,6 +69,7 @@ private:
     IMapperVolumeEventHandler* mapper;
     Allocator* allocator;
     IJournalVolumeEventHandler* journal;
+    VolumeMapReclaimer* reclaimer;
 };
 
 } // namespace pos
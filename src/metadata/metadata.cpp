@@ -35,6 +35,8 @@
 #include <string>
 
 #include "src/allocator/allocator.h"
+#include "src/array_components/mount_dependency_graph.h"
+#include "src/array_components/mount_phase_recorder.h"
 #include "src/event_scheduler/event_scheduler.h"
 #include "src/journal_manager/journal_manager.h"
 #include "src/logger/logger.h"
@@ -44,6 +46,8 @@
 #include "src/metadata/meta_updater.h"
 #include "src/metadata/meta_volume_event_handler.h"
 #include "src/metadata/segment_context_updater.h"
+#include "src/metadata/stripe_scrubber.h"
+#include "src/metadata/volume_map_reclaimer.h"
 #include "src/telemetry/telemetry_client/telemetry_client.h"
 #include "src/volume/volume_service.h"
 
@@ -67,17 +71,31 @@ Metadata::Metadata(IArrayInfo* info, Mapper* mapper, Allocator* allocator,
   journal(journal),
   metaFsCtrl(metaFsCtrl),
   volumeEventHandler(nullptr),
+  volumeMapReclaimer(nullptr),
+  stripeScrubber(nullptr),
   metaService(service),
   metaUpdater(nullptr),
   segmentContextUpdater(nullptr),
   metaEventFactory(nullptr)
 {
+    IJournalVolumeEventHandler* journalVolumeEventHandler =
+        (journal->IsEnabled() ? journal->GetVolumeEventHandler() : nullptr);
+    auto sizeInfo = info->GetSizeInfo(PartitionType::USER_DATA);
+    volumeMapReclaimer = new VolumeMapReclaimer(arrayInfo->GetIndex(),
+        mapper->GetVolumeEventHandler(),
+        allocator->GetISegmentCtx(),
+        journalVolumeEventHandler,
+        sizeInfo);
+
+    stripeScrubber = StripeScrubber::Create(arrayInfo->GetIndex(), arrayInfo->GetName(),
+        allocator->GetIContextManager(), sizeInfo);
+
     volumeEventHandler = new MetaVolumeEventHandler(arrayInfo,
         mapper->GetVolumeEventHandler(),
         allocator,
-        (journal->IsEnabled() ? journal->GetVolumeEventHandler() : nullptr));
+        journalVolumeEventHandler,
+        volumeMapReclaimer);
 
-    auto sizeInfo = info->GetSizeInfo(PartitionType::USER_DATA);
     segmentContextUpdater = new SegmentContextUpdater(allocator->GetISegmentCtx(), journal->GetVersionedSegmentContext(), sizeInfo);
 
     metaEventFactory = new MetaEventFactory(
@@ -99,6 +117,18 @@ Metadata::Metadata(IArrayInfo* info, Mapper* mapper, Allocator* allocator,
 
 Metadata::~Metadata(void)
 {
+    if (stripeScrubber != nullptr)
+    {
+        delete stripeScrubber;
+        stripeScrubber = nullptr;
+    }
+
+    if (volumeMapReclaimer != nullptr)
+    {
+        delete volumeMapReclaimer;
+        volumeMapReclaimer = nullptr;
+    }
+
     if (journal != nullptr)
     {
         delete journal;
@@ -150,21 +180,39 @@ Metadata::Init(void)
 
     std::string arrayName = arrayInfo->GetName();
 
-    POS_TRACE_INFO(eventId, "Start initializing mapper of array {}", arrayName);
-    result = mapper->Init();
+    // The map files and the allocator contexts are loaded in parallel
+    MountDependencyGraph loadGraph;
+    loadGraph.AddStep("Metadata.MapperLoad",
+        [&](void)
+        {
+            POS_TRACE_INFO(eventId, "Start initializing mapper of array {}", arrayName);
+            MountPhaseTimer timer(arrayName, "Metadata.MapperLoad");
+            int ret = mapper->Init();
+            if (ret != 0)
+            {
+                POS_TRACE_ERROR(eventId, "[Metadata Error!!] Failed to Init Mapper, array {} error {}",
+                    arrayName, ret);
+            }
+            return ret;
+        },
+        {});
+    loadGraph.AddStep("Metadata.AllocatorLoad",
+        [&](void)
+        {
+            POS_TRACE_INFO(eventId, "Start initializing allocator of array {}", arrayName);
+            MountPhaseTimer timer(arrayName, "Metadata.AllocatorLoad");
+            int ret = allocator->Init();
+            if (ret != 0)
+            {
+                POS_TRACE_ERROR(eventId, "[Metadata Error!!] Failed to Init Allocator, array {}, error {}",
+                    arrayName, ret);
+            }
+            return ret;
+        },
+        {});
+    result = loadGraph.Run();
     if (result != 0)
     {
-        POS_TRACE_ERROR(eventId, "[Metadata Error!!] Failed to Init Mapper, array {} error {}",
-            arrayName, result);
-        return result;
-    }
-
-    POS_TRACE_INFO(eventId, "Start initializing allocator of array {}", arrayName);
-    result = allocator->Init();
-    if (result != 0)
-    {
-        POS_TRACE_ERROR(eventId, "[Metadata Error!!] Failed to Init Allocator, array {}, error {}",
-            arrayName, result);
         return result;
     }
 
@@ -178,18 +226,21 @@ Metadata::Init(void)
         arrayInfo->GetIndex(), metaUpdater, journal->GetJournalStatusProvider());
 
     POS_TRACE_INFO(eventId, "Start initializing journal of array {}", arrayName);
-    result = journal->Init(
-        mapper->GetIVSAMap(),
-        mapper->GetIStripeMap(),
-        mapper->GetIMapFlush(),
-        allocator->GetISegmentCtx(),
-        allocator->GetIWBStripeAllocator(),
-        allocator->GetIContextManager(),
-        allocator->GetIContextReplayer(),
-        VolumeServiceSingleton::Instance()->GetVolumeManager(arrayInfo->GetIndex()),
-        metaFsCtrl,
-        EventSchedulerSingleton::Instance(),
-        TelemetryClientSingleton::Instance());
+    {
+        MountPhaseTimer timer(arrayName, "Metadata.JournalReplay");
+        result = journal->Init(
+            mapper->GetIVSAMap(),
+            mapper->GetIStripeMap(),
+            mapper->GetIMapFlush(),
+            allocator->GetISegmentCtx(),
+            allocator->GetIWBStripeAllocator(),
+            allocator->GetIContextManager(),
+            allocator->GetIContextReplayer(),
+            VolumeServiceSingleton::Instance()->GetVolumeManager(arrayInfo->GetIndex()),
+            metaFsCtrl,
+            EventSchedulerSingleton::Instance(),
+            TelemetryClientSingleton::Instance());
+    }
 
     if (result != 0)
     {
@@ -197,6 +248,18 @@ Metadata::Init(void)
         return result;
     }
 
+    // Freed segments are trimmed only after journal replay has settled the segment states
+    allocator->StartSegmentTrim();
+
+    // The deleted volumes are reclaimed on top of the replayed segment context as well
+    volumeMapReclaimer->Start();
+
+    // Only the segments settled by the replay are scrubbed
+    if (stripeScrubber != nullptr)
+    {
+        stripeScrubber->Start();
+    }
+
     return result;
 }
 
@@ -206,6 +269,12 @@ Metadata::Dispose(void)
     int eventId = EID(UNMOUNT_ARRAY_DEBUG_MSG);
     std::string arrayName = arrayInfo->GetName();
 
+    if (stripeScrubber != nullptr)
+    {
+        stripeScrubber->Stop();
+    }
+    volumeMapReclaimer->Stop();
+
     POS_TRACE_INFO(eventId, "Start disposing allocator of array {}", arrayName);
     allocator->Dispose();
 
@@ -224,6 +293,12 @@ Metadata::Shutdown(void)
     int eventId = EID(UNMOUNT_ARRAY_DEBUG_MSG);
     std::string arrayName = arrayInfo->GetName();
 
+    if (stripeScrubber != nullptr)
+    {
+        stripeScrubber->Stop();
+    }
+    volumeMapReclaimer->Stop();
+
     POS_TRACE_INFO(eventId, "Start shutdown allocator of array {}", arrayName);
     allocator->Shutdown();
 
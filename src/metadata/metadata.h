@@ -47,6 +47,8 @@ class MetaUpdater;
 class SegmentContextUpdater;
 class MetaEventFactory;
 class MetaVolumeEventHandler;
+class VolumeMapReclaimer;
+class StripeScrubber;
 class MetaService;
 
 class Metadata : public IMountSequence
@@ -72,6 +74,8 @@ private:
     JournalManager* journal;
     MetaFsFileControlApi* metaFsCtrl;
     MetaVolumeEventHandler* volumeEventHandler;
+    VolumeMapReclaimer* volumeMapReclaimer;
+    StripeScrubber* stripeScrubber;
     MetaService* metaService;
 
     MetaUpdater* metaUpdater;
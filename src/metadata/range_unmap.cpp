@@ -0,0 +1,106 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/metadata/range_unmap.h"
+
+#include "src/include/branch_prediction.h"
+#include "src/include/pos_event_id.h"
+#include "src/logger/logger.h"
+#include "src/spdk_wrapper/event_framework_api.h"
+
+namespace pos
+{
+RangeUnmap::RangeUnmap(int volId, BlkAddr startRba, uint64_t numBlks,
+    IVSAMap* vsaMap, ISegmentCtx* segmentCtx_, uint32_t stripesPerSegment)
+: MetaUpdateCallback(EventFrameworkApiSingleton::Instance()->IsReactorNow(), segmentCtx_),
+  volId(volId),
+  startRba(startRba),
+  numBlks(numBlks),
+  vsaMap(vsaMap),
+  stripesPerSegment(stripesPerSegment)
+{
+}
+
+RangeUnmap::~RangeUnmap(void)
+{
+}
+
+bool
+RangeUnmap::_DoSpecificJob(void)
+{
+    std::vector<VirtualBlks> oldBlks;
+    int ret = vsaMap->UnmapVSAs(volId, startRba, numBlks, oldBlks);
+    if (unlikely(ret < 0))
+    {
+        // Deallocation is advisory, so the range is left mapped as it was
+        POS_TRACE_WARN(EID(VSAMAP_SET_FAILURE),
+            "Range is not unmapped, volume_id:{}, start_rba:{}, num_blks:{}",
+            volId, startRba, numBlks);
+    }
+
+    _InvalidateOldBlks(oldBlks);
+
+    return true;
+}
+
+void
+RangeUnmap::_InvalidateOldBlks(std::vector<VirtualBlks>& oldBlks)
+{
+    if (stripesPerSegment == 0)
+    {
+        for (auto& blks : oldBlks)
+        {
+            bool allowVictimSegRelease = false;
+            InvalidateBlks(blks, allowVictimSegRelease);
+        }
+        return;
+    }
+
+    std::map<SegmentId, uint32_t> invalidSegCnt;
+    for (auto& blks : oldBlks)
+    {
+        invalidSegCnt[blks.startVsa.stripeId / stripesPerSegment] += blks.numBlks;
+    }
+
+    for (auto& it : invalidSegCnt)
+    {
+        VirtualBlks invalidRange = {
+            .startVsa = {
+                .stripeId = it.first * stripesPerSegment,
+                .offset = 0},
+            .numBlks = it.second};
+        bool allowVictimSegRelease = false;
+        InvalidateBlks(invalidRange, allowVictimSegRelease);
+    }
+}
+
+} // namespace pos
@@ -0,0 +1,429 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/metadata/stripe_scrubber.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <fstream>
+#include <vector>
+
+#include "src/allocator/context_manager/segment_ctx/segment_ctx.h"
+#include "src/allocator/i_context_manager.h"
+#include "src/array/service/array_service_layer.h"
+#include "src/array/service/io_recover/i_io_recover.h"
+#include "src/array_models/dto/partition_logical_size.h"
+#include "src/device/i_io_dispatcher.h"
+#include "src/include/array_config.h"
+#include "src/include/backend_event.h"
+#include "src/include/i_array_device.h"
+#include "src/include/partition_type.h"
+#include "src/include/pos_event_id.h"
+#include "src/include/recover_method.h"
+#include "src/io_scheduler/io_dispatcher.h"
+#include "src/logger/logger.h"
+#include "src/master_context/config_manager.h"
+#include "src/qos/qos_manager.h"
+
+namespace pos
+{
+const std::string StripeScrubber::CURSOR_DIR = "/etc/pos/";
+
+StripeScrubber::StripeScrubber(int arrayId, std::string cursorPath, SegmentCtx* segmentCtx,
+    const PartitionLogicalSize* sizeInfo, IIORecover* recover, IIODispatcher* ioDispatcher,
+    uint32_t stripeIntervalUs)
+: arrayId(arrayId),
+  cursorPath(cursorPath),
+  segmentCtx(segmentCtx),
+  sizeInfo(sizeInfo),
+  recover(recover),
+  ioDispatcher(ioDispatcher),
+  stripeIntervalUs(stripeIntervalUs),
+  chunkBytes(sizeInfo->blksPerChunk * ArrayConfig::BLOCK_SIZE_BYTE),
+  cursor(0),
+  stop(true),
+  worker(nullptr)
+{
+}
+
+StripeScrubber::~StripeScrubber(void)
+{
+    Stop();
+}
+
+// It has to be called after the journal replay, which settles the segment states
+void
+StripeScrubber::Start(void)
+{
+    if (worker != nullptr)
+    {
+        return;
+    }
+
+    _LoadCursor();
+    POS_TRACE_INFO(EID(SCRUB_PASS_STARTED), "Start scrubbing, array_id:{}, from_stripe:{}, total_stripes:{}",
+        arrayId, cursor, sizeInfo->totalStripes);
+    stop = false;
+    worker = new std::thread(&StripeScrubber::_Worker, this);
+}
+
+// The stripe in progress is finished before the worker returns
+void
+StripeScrubber::Stop(void)
+{
+    if (worker == nullptr)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(stopLock);
+        stop = true;
+    }
+    stopCv.notify_all();
+    worker->join();
+    delete worker;
+    worker = nullptr;
+    _SaveCursor();
+}
+
+StripeId
+StripeScrubber::GetCursor(void)
+{
+    return cursor;
+}
+
+void
+StripeScrubber::_Worker(void)
+{
+    while (stop == false)
+    {
+        StripeId stripeId = cursor;
+        bool scrubbable = _IsScrubbable(stripeId);
+        if (scrubbable)
+        {
+            ScrubStripe(stripeId);
+            stripeId++;
+        }
+        else
+        {
+            // Free or open segments are skipped as a whole
+            stripeId = (stripeId / sizeInfo->stripesPerSegment + 1) * sizeInfo->stripesPerSegment;
+        }
+
+        if (stripeId >= sizeInfo->totalStripes)
+        {
+            stripeId = 0;
+            POS_TRACE_INFO(EID(SCRUB_PASS_STARTED), "Scrub pass completed, start over, array_id:{}", arrayId);
+        }
+        cursor = stripeId;
+
+        if (scrubbable == false && stripeId != 0)
+        {
+            // Nothing has been read, so the next segment is looked at without delay
+            continue;
+        }
+        if (stripeId % sizeInfo->stripesPerSegment == 0)
+        {
+            _SaveCursor();
+        }
+
+        std::unique_lock<std::mutex> lock(stopLock);
+        stopCv.wait_for(lock, std::chrono::microseconds(_GetStripeIntervalUs()),
+            [this] { return stop == true; });
+    }
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Read every chunk of a stripe and verify the parity. A chunk which
+ *           fails to read is rebuilt from the others and written back, and a
+ *           parity which does not match the data is rewritten.
+ *
+ * @Param    stripeId: a user data stripe in a segment of SSD state
+ * @return   SKIPPED if the stripe has no redundancy or a device is not NORMAL
+ *           (rebuild takes care of it then), UNRECOVERABLE if the stripe has
+ *           more unreadable chunks than can be rebuilt one at a time
+ */
+/* --------------------------------------------------------------------------*/
+ScrubResult
+StripeScrubber::ScrubStripe(StripeId stripeId)
+{
+    RecoverMethod method;
+    int ret = recover->GetParityRecoverMethod(arrayId, PartitionType::USER_DATA, stripeId, method);
+    if (ret != 0 || method.dstAddr.empty())
+    {
+        return ScrubResult::SKIPPED;
+    }
+
+    std::list<PhysicalBlkAddr> stripeAddr = method.srcAddr;
+    stripeAddr.insert(stripeAddr.end(), method.dstAddr.begin(), method.dstAddr.end());
+    for (PhysicalBlkAddr& pba : stripeAddr)
+    {
+        if (pba.arrayDev->GetState() != ArrayDeviceState::NORMAL)
+        {
+            return ScrubResult::SKIPPED;
+        }
+    }
+
+    // Read without the recovery of io dispatcher, which would hide the latent errors
+    std::map<IArrayDevice*, UbioSmartPtr> chunks;
+    std::vector<UbioSmartPtr> failed;
+    for (PhysicalBlkAddr& pba : stripeAddr)
+    {
+        UbioSmartPtr ubio = _ReadChunk(pba);
+        chunks[pba.arrayDev] = ubio;
+        if (ubio->GetError() != IOErrorType::SUCCESS)
+        {
+            failed.push_back(ubio);
+        }
+    }
+
+    if (failed.empty())
+    {
+        return _VerifyParity(stripeId, method.srcAddr, method.dstAddr, chunks, method.recoverFunc);
+    }
+    if (failed.size() > 1)
+    {
+        POS_TRACE_ERROR(EID(SCRUB_UNRECOVERABLE),
+            "Too many unreadable chunks to repair, array_id:{}, stripe_id:{}, failed_chunks:{}",
+            arrayId, stripeId, failed.size());
+        return ScrubResult::UNRECOVERABLE;
+    }
+    return _RepairChunk(stripeId, failed.front(), chunks);
+}
+
+ScrubResult
+StripeScrubber::_VerifyParity(StripeId stripeId, const std::list<PhysicalBlkAddr>& dataAddr,
+    const std::list<PhysicalBlkAddr>& parityAddr, std::map<IArrayDevice*, UbioSmartPtr>& chunks,
+    const RecoverFunc& recoverFunc)
+{
+    std::vector<uint8_t> data(dataAddr.size() * chunkBytes);
+    uint32_t index = 0;
+    for (const PhysicalBlkAddr& pba : dataAddr)
+    {
+        memcpy(data.data() + index * chunkBytes, chunks[pba.arrayDev]->GetBuffer(), chunkBytes);
+        index++;
+    }
+
+    // The parity is recomputed with the same kernels as the write path uses
+    std::vector<uint8_t> parity(parityAddr.size() * chunkBytes);
+    recoverFunc(parity.data(), data.data(), parity.size());
+
+    ScrubResult result = ScrubResult::CLEAN;
+    index = 0;
+    for (const PhysicalBlkAddr& pba : parityAddr)
+    {
+        const uint8_t* expected = parity.data() + index * chunkBytes;
+        index++;
+        if (memcmp(chunks[pba.arrayDev]->GetBuffer(), expected, chunkBytes) == 0)
+        {
+            continue;
+        }
+        if (_IsScrubbable(stripeId) == false)
+        {
+            return ScrubResult::SKIPPED;
+        }
+        if (_WriteChunk(pba, expected) != 0)
+        {
+            return ScrubResult::UNRECOVERABLE;
+        }
+        POS_TRACE_WARN(EID(SCRUB_PARITY_REPAIRED),
+            "array_id:{}, stripe_id:{}, dev:{}", arrayId, stripeId, pba.arrayDev->GetName());
+        result = ScrubResult::PARITY_REPAIRED;
+    }
+    return result;
+}
+
+ScrubResult
+StripeScrubber::_RepairChunk(StripeId stripeId, UbioSmartPtr failed,
+    std::map<IArrayDevice*, UbioSmartPtr>& chunks)
+{
+    RecoverMethod method;
+    int ret = recover->GetRecoverMethod(arrayId, failed, method);
+    if (ret != 0)
+    {
+        POS_TRACE_ERROR(EID(SCRUB_UNRECOVERABLE),
+            "No recover method for the unreadable chunk, array_id:{}, stripe_id:{}, ret:{}",
+            arrayId, stripeId, ret);
+        return ScrubResult::UNRECOVERABLE;
+    }
+
+    std::vector<uint8_t> src(method.srcAddr.size() * chunkBytes);
+    uint32_t index = 0;
+    for (PhysicalBlkAddr& pba : method.srcAddr)
+    {
+        auto it = chunks.find(pba.arrayDev);
+        if (it == chunks.end() || it->second->GetError() != IOErrorType::SUCCESS)
+        {
+            POS_TRACE_ERROR(EID(SCRUB_UNRECOVERABLE),
+                "A chunk to rebuild from is not readable, array_id:{}, stripe_id:{}", arrayId, stripeId);
+            return ScrubResult::UNRECOVERABLE;
+        }
+        memcpy(src.data() + index * chunkBytes, it->second->GetBuffer(), chunkBytes);
+        index++;
+    }
+
+    std::vector<uint8_t> dst(chunkBytes);
+    method.recoverFunc(dst.data(), src.data(), chunkBytes);
+    if (_IsScrubbable(stripeId) == false)
+    {
+        return ScrubResult::SKIPPED;
+    }
+    PhysicalBlkAddr pba = failed->GetPba();
+    if (_WriteChunk(pba, dst.data()) != 0)
+    {
+        return ScrubResult::UNRECOVERABLE;
+    }
+    POS_TRACE_WARN(EID(SCRUB_CHUNK_REPAIRED),
+        "array_id:{}, stripe_id:{}, dev:{}", arrayId, stripeId, pba.arrayDev->GetName());
+    return ScrubResult::CHUNK_REPAIRED;
+}
+
+// Checked again right before a repair, as GC may have reclaimed the segment while
+// the stripe was read. The window up to the write itself is left open, but a reused
+// segment is written from its first stripe, which takes far longer than one chunk write.
+bool
+StripeScrubber::_IsScrubbable(StripeId stripeId)
+{
+    SegmentId segId = stripeId / sizeInfo->stripesPerSegment;
+    return segmentCtx->GetSegmentState(segId) == SegmentState::SSD;
+}
+
+uint32_t
+StripeScrubber::_GetStripeIntervalUs(void)
+{
+    // Shares the perf impact of rebuild, which is the other background reader of whole stripes
+    qos_backend_policy policy = QosManagerSingleton::Instance()->GetBackendPolicy(BackendEvent_UserdataRebuild);
+    if (policy.priorityImpact == PRIORITY_MEDIUM)
+    {
+        return stripeIntervalUs * 2;
+    }
+    else if (policy.priorityImpact == PRIORITY_LOW)
+    {
+        return stripeIntervalUs * 4;
+    }
+    return stripeIntervalUs;
+}
+
+UbioSmartPtr
+StripeScrubber::_ReadChunk(const PhysicalBlkAddr& pba)
+{
+    PhysicalBlkAddr addr = pba;
+    UbioSmartPtr ubio(new Ubio(nullptr, chunkBytes / Ubio::BYTES_PER_UNIT, arrayId));
+    ubio->dir = UbioDir::Read;
+    ubio->SetPba(addr);
+    ubio->SetUblock(addr.arrayDev->GetUblock());
+    ubio->SetEventType(BackendEvent_UserdataRebuild);
+    int ret = ioDispatcher->Submit(ubio, true);
+    if (ret < 0 && ubio->GetError() == IOErrorType::SUCCESS)
+    {
+        ubio->SetError(IOErrorType::GENERIC_ERROR);
+    }
+    return ubio;
+}
+
+int
+StripeScrubber::_WriteChunk(const PhysicalBlkAddr& pba, const uint8_t* data)
+{
+    PhysicalBlkAddr addr = pba;
+    UbioSmartPtr ubio(new Ubio(nullptr, chunkBytes / Ubio::BYTES_PER_UNIT, arrayId));
+    memcpy(ubio->GetBuffer(), data, chunkBytes);
+    ubio->dir = UbioDir::Write;
+    ubio->SetPba(addr);
+    ubio->SetUblock(addr.arrayDev->GetUblock());
+    ubio->SetEventType(BackendEvent_UserdataRebuild);
+    int ret = ioDispatcher->Submit(ubio, true);
+    if (ret < 0 || ubio->GetError() != IOErrorType::SUCCESS)
+    {
+        POS_TRACE_ERROR(EID(SCRUB_UNRECOVERABLE),
+            "Failed to write the repaired chunk, array_id:{}, dev:{}, lba:{}, ret:{}",
+            arrayId, addr.arrayDev->GetName(), addr.lba, ret);
+        return EID(SCRUB_UNRECOVERABLE);
+    }
+    return 0;
+}
+
+void
+StripeScrubber::_LoadCursor(void)
+{
+    StripeId saved = 0;
+    std::ifstream file(cursorPath);
+    if (file.is_open() && (file >> saved) && saved < sizeInfo->totalStripes)
+    {
+        cursor = saved;
+        return;
+    }
+    cursor = 0;
+}
+
+void
+StripeScrubber::_SaveCursor(void)
+{
+    std::ofstream file(cursorPath, std::ofstream::trunc);
+    if (file.is_open())
+    {
+        file << cursor << std::endl;
+    }
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Create the scrubber from rebuild.scrub_enable and
+ *           rebuild.scrub_stripe_interval_us
+ *
+ * @return   nullptr if scrub is disabled or not configured
+ */
+/* --------------------------------------------------------------------------*/
+StripeScrubber*
+StripeScrubber::Create(int arrayId, std::string arrayName, IContextManager* contextManager,
+    const PartitionLogicalSize* sizeInfo)
+{
+    bool enabled = false;
+    int ret = ConfigManagerSingleton::Instance()->GetValue("rebuild", "scrub_enable",
+        &enabled, CONFIG_TYPE_BOOL);
+    if (ret != EID(SUCCESS) || false == enabled)
+    {
+        return nullptr;
+    }
+
+    uint32_t intervalUs = DEFAULT_STRIPE_INTERVAL_US;
+    ConfigManagerSingleton::Instance()->GetValue("rebuild", "scrub_stripe_interval_us",
+        &intervalUs, CONFIG_TYPE_UINT32);
+
+    return new StripeScrubber(arrayId, CURSOR_DIR + "scrub_cursor_" + arrayName,
+        contextManager->GetSegmentCtx(), sizeInfo,
+        ArrayService::Instance()->Getter()->GetRecover(), IODispatcherSingleton::Instance(),
+        intervalUs);
+}
+} // namespace pos
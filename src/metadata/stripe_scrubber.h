@@ -0,0 +1,124 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "src/bio/ubio.h"
+#include "src/include/address_type.h"
+#include "src/include/recover_func.h"
+
+namespace pos
+{
+class IArrayDevice;
+class IContextManager;
+class IIODispatcher;
+class IIORecover;
+class PartitionLogicalSize;
+class SegmentCtx;
+
+enum class ScrubResult
+{
+    CLEAN,
+    SKIPPED,
+    PARITY_REPAIRED,
+    CHUNK_REPAIRED,
+    UNRECOVERABLE,
+};
+
+// Walks the user data stripes in the background and verifies them against
+// their parity, so that latent sector errors are found before a rebuild needs
+// the chunks. Only the segments in SSD state are scrubbed, as their stripes
+// are fully written and stay unchanged until the segment becomes a victim.
+// A stripe whose recomputed parity differs from the stored one gets the
+// recomputed parity written back, and a chunk which fails to read is rebuilt
+// from the rest of the stripe through the recover method of the array.
+// The interval between stripes follows the rebuild perf impact, and the next
+// stripe to scrub is saved to a file at every segment, so that a restart
+// resumes the pass rather than starting over.
+class StripeScrubber
+{
+public:
+    StripeScrubber(int arrayId, std::string cursorPath, SegmentCtx* segmentCtx,
+        const PartitionLogicalSize* sizeInfo, IIORecover* recover, IIODispatcher* ioDispatcher,
+        uint32_t stripeIntervalUs);
+    virtual ~StripeScrubber(void);
+
+    virtual void Start(void);
+    virtual void Stop(void);
+    virtual ScrubResult ScrubStripe(StripeId stripeId);
+    StripeId GetCursor(void);
+
+    static StripeScrubber* Create(int arrayId, std::string arrayName, IContextManager* contextManager,
+        const PartitionLogicalSize* sizeInfo);
+
+    static const uint32_t DEFAULT_STRIPE_INTERVAL_US = 1000;
+    static const std::string CURSOR_DIR;
+
+private:
+    void _Worker(void);
+    bool _IsScrubbable(StripeId stripeId);
+    uint32_t _GetStripeIntervalUs(void);
+    UbioSmartPtr _ReadChunk(const PhysicalBlkAddr& pba);
+    int _WriteChunk(const PhysicalBlkAddr& pba, const uint8_t* data);
+    ScrubResult _VerifyParity(StripeId stripeId, const std::list<PhysicalBlkAddr>& dataAddr,
+        const std::list<PhysicalBlkAddr>& parityAddr, std::map<IArrayDevice*, UbioSmartPtr>& chunks,
+        const RecoverFunc& recoverFunc);
+    ScrubResult _RepairChunk(StripeId stripeId, UbioSmartPtr failed,
+        std::map<IArrayDevice*, UbioSmartPtr>& chunks);
+    void _LoadCursor(void);
+    void _SaveCursor(void);
+
+    int arrayId;
+    std::string cursorPath;
+    SegmentCtx* segmentCtx;
+    const PartitionLogicalSize* sizeInfo;
+    IIORecover* recover;
+    IIODispatcher* ioDispatcher;
+    uint32_t stripeIntervalUs;
+    uint32_t chunkBytes;
+
+    std::atomic<StripeId> cursor;
+    std::atomic<bool> stop;
+    std::mutex stopLock;
+    std::condition_variable stopCv;
+    std::thread* worker;
+};
+} // namespace pos
@@ -0,0 +1,287 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/metadata/volume_map_reclaimer.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+
+#include "src/allocator/i_segment_ctx.h"
+#include "src/array_models/dto/partition_logical_size.h"
+#include "src/include/pos_event_id.h"
+#include "src/journal_manager/log_write/i_journal_volume_event_handler.h"
+#include "src/logger/logger.h"
+#include "src/mapper/i_mapper_volume_event_handler.h"
+
+namespace pos
+{
+VolumeMapReclaimer::VolumeMapReclaimer(int arrayId, IMapperVolumeEventHandler* mapper, ISegmentCtx* segmentCtx,
+    IJournalVolumeEventHandler* journal, const PartitionLogicalSize* sizeInfo)
+: VolumeMapReclaimer(arrayId, mapper, segmentCtx, journal, sizeInfo,
+      DEFAULT_MPAGES_PER_BATCH, DEFAULT_BATCH_INTERVAL_US)
+{
+}
+
+VolumeMapReclaimer::VolumeMapReclaimer(int arrayId, IMapperVolumeEventHandler* mapper, ISegmentCtx* segmentCtx,
+    IJournalVolumeEventHandler* journal, const PartitionLogicalSize* sizeInfo,
+    uint32_t mpagesPerBatch, uint32_t batchIntervalUs)
+: arrayId(arrayId),
+  mapper(mapper),
+  segmentCtx(segmentCtx),
+  journal(journal),
+  sizeInfo(sizeInfo),
+  mpagesPerBatch(std::max(mpagesPerBatch, (uint32_t)1)),
+  batchIntervalUs(batchIntervalUs),
+  stop(true),
+  worker(nullptr)
+{
+}
+
+VolumeMapReclaimer::~VolumeMapReclaimer(void)
+{
+    Stop();
+}
+
+// The maps detached before the array was unmounted are picked up again here.
+// It has to be called after the journal replay, which settles the segment context
+void
+VolumeMapReclaimer::Start(void)
+{
+    if (worker != nullptr)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(queueLock);
+        pendingVolumes.clear();
+        for (int volId : mapper->GetDetachedVolumes())
+        {
+            POS_TRACE_INFO(EID(VOL_EVENT_OK), "Resume reclaiming the blocks of deleted volume {}, array_id:{}", volId, arrayId);
+            pendingVolumes.push_back(volId);
+        }
+        stop = false;
+    }
+    worker = new std::thread(&VolumeMapReclaimer::_Worker, this);
+}
+
+// A reclaim in progress is abandoned at the next batch and resumed at the next mount
+void
+VolumeMapReclaimer::Stop(void)
+{
+    if (worker == nullptr)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(queueLock);
+        stop = true;
+    }
+    queueCv.notify_all();
+    worker->join();
+    delete worker;
+    worker = nullptr;
+}
+
+int
+VolumeMapReclaimer::Delete(int volId)
+{
+    int ret = 0;
+    {
+        std::lock_guard<std::mutex> guard(journalLock);
+        if (journal != nullptr)
+        {
+            // Replay skips the logs of the volume from now on
+            ret = journal->WriteVolumeDeletedLog(volId);
+            if (ret == 0)
+            {
+                ret = journal->TriggerMetadataFlush();
+            }
+            if (ret != 0)
+            {
+                POS_TRACE_ERROR(EID(VSAMAP_INVALIDATE_ALLBLKS_FAILURE), "Failed to journal the deletion of volume {}, array_id:{}, ret:{}", volId, arrayId, ret);
+                return ret;
+            }
+        }
+
+        ret = mapper->DetachVolumeMap(volId);
+        if (ret != 0)
+        {
+            return ret;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(queueLock);
+        pendingVolumes.push_back(volId);
+    }
+    queueCv.notify_all();
+    POS_TRACE_INFO(EID(VOL_EVENT_OK), "The blocks of volume {} will be reclaimed in the background, array_id:{}", volId, arrayId);
+    return 0;
+}
+
+void
+VolumeMapReclaimer::WaitForVolume(int volId)
+{
+    std::unique_lock<std::mutex> lock(queueLock);
+    queueCv.wait(lock, [&] {
+        return (stop == true) ||
+            (std::find(pendingVolumes.begin(), pendingVolumes.end(), volId) == pendingVolumes.end());
+    });
+}
+
+bool
+VolumeMapReclaimer::IsReclaiming(int volId)
+{
+    std::lock_guard<std::mutex> lock(queueLock);
+    return (std::find(pendingVolumes.begin(), pendingVolumes.end(), volId) != pendingVolumes.end());
+}
+
+void
+VolumeMapReclaimer::_Worker(void)
+{
+    std::unique_lock<std::mutex> lock(queueLock);
+    while (true)
+    {
+        queueCv.wait(lock, [&] {
+            return (stop == true) || (pendingVolumes.empty() == false);
+        });
+        if (stop == true)
+        {
+            break;
+        }
+
+        int volId = pendingVolumes.front();
+        lock.unlock();
+        bool finished = _Reclaim(volId);
+        lock.lock();
+        if (finished == false)
+        {
+            break;
+        }
+        pendingVolumes.pop_front();
+        queueCv.notify_all();
+    }
+}
+
+// Returns false only when stopped, a failed reclaim is retried at the next mount
+bool
+VolumeMapReclaimer::_Reclaim(int volId)
+{
+    POS_TRACE_INFO(EID(VOL_EVENT_OK), "Start reclaiming the blocks of deleted volume {}, array_id:{}", volId, arrayId);
+    uint32_t stripesPerSegment = sizeInfo->stripesPerSegment;
+    uint32_t numSegments = sizeInfo->totalSegments;
+    std::vector<uint32_t> invalidBlks(numSegments, 0);
+    std::vector<VirtualBlks> validBlks;
+    uint64_t mpageId = 0;
+    uint64_t numBlks = 0;
+    bool remaining = true;
+    while (remaining == true)
+    {
+        if (stop == true)
+        {
+            POS_TRACE_INFO(EID(VOL_EVENT_OK), "Reclaim of volume {} is stopped at mpage {}, array_id:{}", volId, mpageId, arrayId);
+            return false;
+        }
+
+        validBlks.clear();
+        remaining = mapper->CollectDetachedBlocks(volId, mpageId, mpagesPerBatch, validBlks);
+        for (auto& blks : validBlks)
+        {
+            SegmentId segId = blks.startVsa.stripeId / stripesPerSegment;
+            if (segId >= numSegments)
+            {
+                POS_TRACE_ERROR(EID(VSAMAP_INVALIDATE_ALLBLKS_FAILURE), "Volume {} maps a block out of the user area, stripe_id:{}, array_id:{}",
+                    volId, blks.startVsa.stripeId, arrayId);
+                continue;
+            }
+            invalidBlks[segId] += blks.numBlks;
+            numBlks += blks.numBlks;
+        }
+
+        if ((remaining == true) && (batchIntervalUs != 0))
+        {
+            usleep(batchIntervalUs);
+        }
+    }
+
+    int ret = _ApplyInvalidation(volId, invalidBlks);
+    if (ret != 0)
+    {
+        POS_TRACE_ERROR(EID(VSAMAP_INVALIDATE_ALLBLKS_FAILURE), "Failed to reclaim the blocks of volume {}, array_id:{}, ret:{}", volId, arrayId, ret);
+        return true;
+    }
+    POS_TRACE_INFO(EID(VOL_EVENT_OK), "{} blocks of deleted volume {} are reclaimed, array_id:{}", numBlks, volId, arrayId);
+    return true;
+}
+
+// The checkpoint is blocked from before the map file is deleted until the segment
+// context is stored, so that no stored segment context has the blocks counted
+// out while the map that would count them out again is still on the disk
+int
+VolumeMapReclaimer::_ApplyInvalidation(int volId, std::vector<uint32_t>& invalidBlks)
+{
+    std::lock_guard<std::mutex> guard(journalLock);
+    int ret = 0;
+    if (journal != nullptr)
+    {
+        ret = journal->WriteVolumeDeletedLog(volId);
+        if (ret != 0)
+        {
+            return ret;
+        }
+    }
+
+    ret = mapper->DeleteDetachedMap(volId);
+    if (ret == 0)
+    {
+        for (uint32_t segId = 0; segId < invalidBlks.size(); segId++)
+        {
+            if (invalidBlks[segId] != 0)
+            {
+                VirtualBlks blks = {.startVsa = {.stripeId = segId * sizeInfo->stripesPerSegment, .offset = 0}, .numBlks = invalidBlks[segId]};
+                bool allowVictimSegRelease = true;
+                segmentCtx->InvalidateBlks(blks, allowVictimSegRelease);
+            }
+        }
+    }
+
+    if (journal != nullptr)
+    {
+        int flushRet = journal->TriggerMetadataFlush();
+        ret = (ret == 0) ? flushRet : ret;
+    }
+    return ret;
+}
+} // namespace pos
@@ -0,0 +1,102 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "src/include/address_type.h"
+
+namespace pos
+{
+class IJournalVolumeEventHandler;
+class IMapperVolumeEventHandler;
+class ISegmentCtx;
+class PartitionLogicalSize;
+
+// Invalidates the blocks of deleted volumes in the background, so that a
+// volume delete returns once the deletion is journaled and the map is detached.
+// A detached map is scanned in batches of mpages, skipping the mpages that have
+// never been written, and the valid blocks it still holds are summed up per
+// segment. The sums are applied to the segment context only at the end, with
+// the checkpoint blocked, and the map is deleted before the checkpoint is
+// resumed. A restart in the middle of a reclaim therefore finds the segment
+// context untouched and scans the map again, and the worst a restart right
+// after the sums are applied can do is to leak the blocks of the volume.
+class VolumeMapReclaimer
+{
+public:
+    VolumeMapReclaimer(int arrayId, IMapperVolumeEventHandler* mapper, ISegmentCtx* segmentCtx,
+        IJournalVolumeEventHandler* journal, const PartitionLogicalSize* sizeInfo);
+    VolumeMapReclaimer(int arrayId, IMapperVolumeEventHandler* mapper, ISegmentCtx* segmentCtx,
+        IJournalVolumeEventHandler* journal, const PartitionLogicalSize* sizeInfo,
+        uint32_t mpagesPerBatch, uint32_t batchIntervalUs);
+    virtual ~VolumeMapReclaimer(void);
+
+    virtual void Start(void);
+    virtual void Stop(void);
+    virtual int Delete(int volId);
+    virtual void WaitForVolume(int volId);
+    virtual bool IsReclaiming(int volId);
+
+    static const uint32_t DEFAULT_MPAGES_PER_BATCH = 64;
+    static const uint32_t DEFAULT_BATCH_INTERVAL_US = 1000;
+
+private:
+    void _Worker(void);
+    bool _Reclaim(int volId);
+    int _ApplyInvalidation(int volId, std::vector<uint32_t>& invalidBlks);
+
+    int arrayId;
+    IMapperVolumeEventHandler* mapper;
+    ISegmentCtx* segmentCtx;
+    IJournalVolumeEventHandler* journal;
+    const PartitionLogicalSize* sizeInfo;
+    uint32_t mpagesPerBatch;
+    uint32_t batchIntervalUs;
+
+    // The journal handles one volume deletion at a time
+    std::mutex journalLock;
+
+    std::atomic<bool> stop;
+    std::deque<int> pendingVolumes;
+    std::mutex queueLock;
+    std::condition_variable queueCv;
+    std::thread* worker;
+};
+} // namespace pos
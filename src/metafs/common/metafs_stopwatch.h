@@ -60,6 +60,7 @@ public:
     virtual std::chrono::milliseconds GetElapsedInMilli(void) const;
     /* If the return value is 0, please check your code again. */
     virtual std::chrono::milliseconds GetElapsedInMilli(StageEnum from, StageEnum to) const;
+    virtual std::chrono::microseconds GetElapsedInMicro(StageEnum from, StageEnum to) const;
 
 private:
     std::vector<std::chrono::system_clock::time_point> stamp_;
@@ -165,4 +166,15 @@ MetaFsStopwatch<StageEnum>::GetElapsedInMilli(StageEnum from, StageEnum to) cons
         return {};
     return std::chrono::duration_cast<std::chrono::milliseconds>(stamp_[(size_t)to] - stamp_[(size_t)from]);
 }
+
+template<class StageEnum>
+std::chrono::microseconds
+MetaFsStopwatch<StageEnum>::GetElapsedInMicro(StageEnum from, StageEnum to) const
+{
+    if ((to <= from) ||
+        (stamp_[(size_t)to].time_since_epoch().count() == 0) ||
+        (stamp_[(size_t)from].time_since_epoch().count() == 0))
+        return {};
+    return std::chrono::duration_cast<std::chrono::microseconds>(stamp_[(size_t)to] - stamp_[(size_t)from]);
+}
 } // namespace pos
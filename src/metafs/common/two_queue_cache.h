@@ -0,0 +1,200 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+#include "src/include/pos_event_id.h"
+#include "src/metafs/common/fifo_cache.h"
+#include "src/metafs/log/metafs_log.h"
+
+namespace pos
+{
+/*
+2Q replacement (Johnson and Shasha). A key seen for the first time enters
+"a1in", a FIFO that keeps one-time pages from flushing the hot ones. Keys
+evicted from "a1in" are remembered in "a1out" without their values. When
+such a key comes back it is known to be reused, so it enters "am", an LRU
+kept for hot pages. Victims come from "a1in" while it holds more than its
+share, and from the least recently used end of "am" otherwise.
+
+thread unsafe, 'Value' should be a pointer type of certain object
+*/
+template<typename Key_1, typename Key_2, typename Value>
+class TwoQueueCache
+{
+public:
+    TwoQueueCache(void) = delete;
+    explicit TwoQueueCache(const size_t cacheSize)
+    : CAPACITY(cacheSize),
+      A1IN_CAPACITY(std::max<size_t>(cacheSize / 4, 1)),
+      A1OUT_CAPACITY(std::max<size_t>(cacheSize / 2, 1))
+    {
+    }
+    virtual ~TwoQueueCache(void)
+    {
+        map_.clear();
+        a1in_.clear();
+        am_.clear();
+        ghostMap_.clear();
+        a1out_.clear();
+    }
+    /* A hit in "am" makes the entry the most recently used one */
+    virtual Value Find(const std::pair<Key_1, Key_2>& key)
+    {
+        auto iter = map_.find(key);
+        if (iter == map_.end())
+            return nullptr;
+
+        Entry& entry = iter->second;
+        if (entry.isHot)
+            am_.splice(am_.end(), am_, entry.pos);
+        return entry.pos->second;
+    }
+    /* If the key already exists in the cache, this will return nullptr */
+    virtual Value Push(const std::pair<Key_1, Key_2>& key, const Value& value)
+    {
+        if (map_.find(key) != map_.end())
+        {
+            POS_TRACE_ERROR(EID(MFS_INVALID_PARAMETER),
+                "the key pair is already existed.");
+            return nullptr;
+        }
+
+        Value victim = (IsFull() && !IsEmpty()) ? _PopVictim() : nullptr;
+        auto ghost = ghostMap_.find(key);
+        if (ghost != ghostMap_.end())
+        {
+            a1out_.erase(ghost->second);
+            ghostMap_.erase(ghost);
+            _Push(am_, true, key, value);
+        }
+        else
+        {
+            _Push(a1in_, false, key, value);
+        }
+        return victim;
+    }
+    virtual Value PopVictim(void)
+    {
+        if (IsEmpty())
+            return nullptr;
+
+        return _PopVictim();
+    }
+    virtual Value Remove(const std::pair<Key_1, Key_2>& key)
+    {
+        auto iter = map_.find(key);
+        if (iter == map_.end())
+            return nullptr;
+
+        Entry entry = iter->second;
+        map_.erase(iter);
+        Value v = entry.pos->second;
+        (entry.isHot ? am_ : a1in_).erase(entry.pos);
+        return v;
+    }
+    virtual bool IsHot(const std::pair<Key_1, Key_2>& key) const
+    {
+        auto iter = map_.find(key);
+        return (iter != map_.end()) && iter->second.isHot;
+    }
+    virtual size_t GetCapacity(void) const
+    {
+        return CAPACITY;
+    }
+    virtual bool IsEmpty(void) const
+    {
+        return (0 == map_.size());
+    }
+    virtual bool IsFull(void) const
+    {
+        return (CAPACITY <= map_.size());
+    }
+    virtual size_t GetSize(void) const
+    {
+        return map_.size();
+    }
+
+private:
+    using Item = std::pair<std::pair<Key_1, Key_2>, Value>;
+    using Queue = std::list<Item>;
+    struct Entry
+    {
+        bool isHot;
+        typename Queue::iterator pos;
+    };
+
+    void _Push(Queue& queue, const bool isHot, const std::pair<Key_1, Key_2>& key, const Value v)
+    {
+        queue.push_back(std::make_pair(key, v));
+        map_.insert({key, Entry{isHot, std::prev(queue.end())}});
+    }
+    Value _PopVictim(void)
+    {
+        bool fromA1in = !a1in_.empty() && ((a1in_.size() > A1IN_CAPACITY) || am_.empty());
+        Queue& queue = fromA1in ? a1in_ : am_;
+
+        Item item = queue.front();
+        queue.pop_front();
+        map_.erase(item.first);
+
+        if (fromA1in)
+            _Remember(item.first);
+        return item.second;
+    }
+    void _Remember(const std::pair<Key_1, Key_2>& key)
+    {
+        if (ghostMap_.size() >= A1OUT_CAPACITY)
+        {
+            ghostMap_.erase(a1out_.front());
+            a1out_.pop_front();
+        }
+        a1out_.push_back(key);
+        ghostMap_.insert({key, std::prev(a1out_.end())});
+    }
+
+    std::unordered_map<std::pair<Key_1, Key_2>, Entry, MakeHash> map_;
+    Queue a1in_;
+    Queue am_;
+    std::list<std::pair<Key_1, Key_2>> a1out_;
+    std::unordered_map<std::pair<Key_1, Key_2>,
+        typename std::list<std::pair<Key_1, Key_2>>::iterator, MakeHash> ghostMap_;
+    const size_t CAPACITY;
+    const size_t A1IN_CAPACITY;
+    const size_t A1OUT_CAPACITY;
+};
+} // namespace pos
@@ -66,5 +66,7 @@ public:
     static const uint64_t META_PAGE_CONTROL_INFO_SIZE = 64;
     // 4032B = 4096B - 64B
     static const uint64_t DEFAULT_META_PAGE_DATA_CHUNK_SIZE = META_PAGE_SIZE_IN_BYTES - META_PAGE_CONTROL_INFO_SIZE;
+    // 128K = 4K LPN * 32, the largest read that a single mpio sends to the device
+    static const uint32_t MAX_PAGE_COUNT_PER_MULTI_PAGE_IO = 32;
 };
 } // namespace pos
@@ -52,10 +52,19 @@ MetaFsConfigManager::MetaFsConfigManager(ConfigManager* configManager)
   wrrCountJournal_(0),
   wrrCountMap_(0),
   wrrCountGeneral_(0),
+  deadlineInUs_(),
   rocksdbEnabled_(false),
   rocksDbPath_(""),
   supportNumaDedicatedScheduling_(false),
-  needToIgnoreNumaDedicatedScheduling_(false)
+  schedulerCountPerNuma_(1),
+  needToIgnoreNumaDedicatedScheduling_(false),
+  supportCheckingCrcWhenReading_(false),
+  fileStorePath_(""),
+  placementAdvisorEnabled_(false),
+  autoPlacementEnabled_(false),
+  nvramPlacementBudgetInMb_(DEFAULT_NVRAM_PLACEMENT_BUDGET_IN_MB),
+  hotFileMaxSizeInKb_(DEFAULT_HOT_FILE_MAX_SIZE_IN_KB),
+  hotFileMinIops_(DEFAULT_HOT_FILE_MIN_IOPS)
 {
     _BuildConfigMap();
 }
@@ -78,14 +87,29 @@ MetaFsConfigManager::Init(void)
     wrrCountJournal_ = _GetWrrCountJournal();
     wrrCountMap_ = _GetWrrCountMap();
     wrrCountGeneral_ = _GetWrrCountGeneral();
+    deadlineInUs_ = {
+        _GetDeadlineInUs(MetaFsConfigType::DeadlineInUsSpecialPurposeMap),
+        _GetDeadlineInUs(MetaFsConfigType::DeadlineInUsJournal),
+        _GetDeadlineInUs(MetaFsConfigType::DeadlineInUsMap),
+        _GetDeadlineInUs(MetaFsConfigType::DeadlineInUsGeneral)};
     rocksdbEnabled_ = _IsRocksdbEnabled();
     if (rocksdbEnabled_)
     {
         rocksDbPath_ = _GetRocksDbPath();
     }
     supportNumaDedicatedScheduling_ = _IsSupportingNumaDedicatedScheduling();
+    schedulerCountPerNuma_ = _GetSchedulerCountPerNuma();
     needToIgnoreNumaDedicatedScheduling_ = false;
     supportCheckingCrcWhenReading_ = _IsSupportCheckingCrcWhenReading();
+    fileStorePath_ = _GetFileStorePath();
+    placementAdvisorEnabled_ = _IsPlacementAdvisorEnabled();
+    autoPlacementEnabled_ = _IsAutoPlacementEnabled();
+    nvramPlacementBudgetInMb_ = _GetPlacementValue(MetaFsConfigType::NvramPlacementBudgetInMb,
+        DEFAULT_NVRAM_PLACEMENT_BUDGET_IN_MB);
+    hotFileMaxSizeInKb_ = _GetPlacementValue(MetaFsConfigType::HotFileMaxSizeInKb,
+        DEFAULT_HOT_FILE_MAX_SIZE_IN_KB);
+    hotFileMinIops_ = _GetPlacementValue(MetaFsConfigType::HotFileMinIops,
+        DEFAULT_HOT_FILE_MIN_IOPS);
 
     if (!_ValidateConfig())
     {
@@ -120,10 +144,32 @@ MetaFsConfigManager::_BuildConfigMap(void)
         {"wrr_count_map", CONFIG_TYPE_UINT64}});
     configMap_.insert({MetaFsConfigType::WrrCountGeneral,
         {"wrr_count_general", CONFIG_TYPE_UINT64}});
+    configMap_.insert({MetaFsConfigType::DeadlineInUsSpecialPurposeMap,
+        {"deadline_in_us_special_purpose_map", CONFIG_TYPE_UINT64}});
+    configMap_.insert({MetaFsConfigType::DeadlineInUsJournal,
+        {"deadline_in_us_journal", CONFIG_TYPE_UINT64}});
+    configMap_.insert({MetaFsConfigType::DeadlineInUsMap,
+        {"deadline_in_us_map", CONFIG_TYPE_UINT64}});
+    configMap_.insert({MetaFsConfigType::DeadlineInUsGeneral,
+        {"deadline_in_us_general", CONFIG_TYPE_UINT64}});
+    configMap_.insert({MetaFsConfigType::SchedulerCountPerNuma,
+        {"scheduler_count_per_numa", CONFIG_TYPE_UINT32}});
     configMap_.insert({MetaFsConfigType::SupportNumaDedicatedScheduling,
         {"numa_dedicated", CONFIG_TYPE_BOOL}});
     configMap_.insert({MetaFsConfigType::SupportCheckingCrcWhenReading,
         {"checking_crc_when_reading_enable", CONFIG_TYPE_BOOL}});
+    configMap_.insert({MetaFsConfigType::FileStorePath,
+        {"file_store_path", CONFIG_TYPE_STRING}});
+    configMap_.insert({MetaFsConfigType::PlacementAdvisorEnabled,
+        {"placement_advisor_enable", CONFIG_TYPE_BOOL}});
+    configMap_.insert({MetaFsConfigType::AutoPlacementEnabled,
+        {"auto_placement_enable", CONFIG_TYPE_BOOL}});
+    configMap_.insert({MetaFsConfigType::NvramPlacementBudgetInMb,
+        {"nvram_placement_budget_in_mb", CONFIG_TYPE_UINT64}});
+    configMap_.insert({MetaFsConfigType::HotFileMaxSizeInKb,
+        {"hot_file_max_size_in_kb", CONFIG_TYPE_UINT64}});
+    configMap_.insert({MetaFsConfigType::HotFileMinIops,
+        {"hot_file_min_iops", CONFIG_TYPE_UINT64}});
 }
 
 bool
@@ -271,6 +317,32 @@ MetaFsConfigManager::_GetWrrCountGeneral(void)
     return count;
 }
 
+uint64_t
+MetaFsConfigManager::_GetDeadlineInUs(const MetaFsConfigType type)
+{
+    uint64_t deadline = 0;
+    if (_ReadConfiguration<uint64_t>(type, &deadline))
+        return 0;
+
+    POS_TRACE_INFO(static_cast<int>(EID(MFS_INFO_MESSAGE)),
+        configMap_[type].first + ": " + std::to_string(deadline));
+
+    return deadline;
+}
+
+uint32_t
+MetaFsConfigManager::_GetSchedulerCountPerNuma(void)
+{
+    uint32_t count = 1;
+    if (_ReadConfiguration<uint32_t>(MetaFsConfigType::SchedulerCountPerNuma, &count) || (0 == count))
+        return 1;
+
+    POS_TRACE_INFO(static_cast<int>(EID(MFS_INFO_MESSAGE)),
+        configMap_[MetaFsConfigType::SchedulerCountPerNuma].first + ": " + std::to_string(count));
+
+    return count;
+}
+
 bool
 MetaFsConfigManager::_IsRocksdbEnabled(void)
 {
@@ -339,4 +411,59 @@ MetaFsConfigManager::_IsSupportCheckingCrcWhenReading(void)
 
     return enabled;
 }
+
+std::string
+MetaFsConfigManager::_GetFileStorePath(void)
+{
+    std::string path = "";
+    if (_ReadConfiguration<std::string>(MetaFsConfigType::FileStorePath, &path))
+        return "";
+
+    if (path.size())
+    {
+        POS_TRACE_INFO(static_cast<int>(EID(MFS_INFO_MESSAGE)),
+            "Meta storage will be placed on files in {}", path);
+    }
+
+    return path;
+}
+
+bool
+MetaFsConfigManager::_IsPlacementAdvisorEnabled(void)
+{
+    bool enabled = false;
+    if (_ReadConfiguration<bool>(MetaFsConfigType::PlacementAdvisorEnabled, &enabled))
+        return false;
+
+    POS_TRACE_INFO(static_cast<int>(EID(MFS_INFO_MESSAGE)),
+        configMap_[MetaFsConfigType::PlacementAdvisorEnabled].first + (enabled ? " is enabled" : " is disabled"));
+
+    return enabled;
+}
+
+bool
+MetaFsConfigManager::_IsAutoPlacementEnabled(void)
+{
+    bool enabled = false;
+    if (_ReadConfiguration<bool>(MetaFsConfigType::AutoPlacementEnabled, &enabled))
+        return false;
+
+    POS_TRACE_INFO(static_cast<int>(EID(MFS_INFO_MESSAGE)),
+        configMap_[MetaFsConfigType::AutoPlacementEnabled].first + (enabled ? " is enabled" : " is disabled"));
+
+    return enabled;
+}
+
+uint64_t
+MetaFsConfigManager::_GetPlacementValue(const MetaFsConfigType type, const uint64_t defaultValue)
+{
+    uint64_t value = 0;
+    if (_ReadConfiguration<uint64_t>(type, &value))
+        return defaultValue;
+
+    POS_TRACE_INFO(static_cast<int>(EID(MFS_INFO_MESSAGE)),
+        configMap_[type].first + ": " + std::to_string(value));
+
+    return value;
+}
 } // namespace pos
@@ -57,6 +57,17 @@ enum class MetaFsConfigType
     WrrCountGeneral,
     SupportNumaDedicatedScheduling,
     SupportCheckingCrcWhenReading,
+    FileStorePath,
+    DeadlineInUsSpecialPurposeMap,
+    DeadlineInUsJournal,
+    DeadlineInUsMap,
+    DeadlineInUsGeneral,
+    SchedulerCountPerNuma,
+    PlacementAdvisorEnabled,
+    AutoPlacementEnabled,
+    NvramPlacementBudgetInMb,
+    HotFileMaxSizeInKb,
+    HotFileMinIops,
 };
 
 class MetaFsConfigManager
@@ -115,6 +126,10 @@ public:
             (int)wrrCountMap_,
             (int)wrrCountGeneral_};
     }
+    virtual std::vector<uint64_t> GetDeadlineInUs(void) const
+    {
+        return deadlineInUs_;
+    }
     virtual bool IsRocksdbEnabled(void) const
     {
         return rocksdbEnabled_;
@@ -127,6 +142,10 @@ public:
     {
         return supportNumaDedicatedScheduling_;
     }
+    virtual uint32_t GetSchedulerCountPerNuma(void) const
+    {
+        return schedulerCountPerNuma_;
+    }
     virtual void SetIgnoreNumaDedicatedScheduling(const bool ignore)
     {
         needToIgnoreNumaDedicatedScheduling_ = ignore;
@@ -139,6 +158,30 @@ public:
     {
         return supportCheckingCrcWhenReading_;
     }
+    virtual std::string GetFileStorePath(void) const
+    {
+        return fileStorePath_;
+    }
+    virtual bool IsPlacementAdvisorEnabled(void) const
+    {
+        return placementAdvisorEnabled_;
+    }
+    virtual bool IsAutoPlacementEnabled(void) const
+    {
+        return autoPlacementEnabled_;
+    }
+    virtual uint64_t GetNvramPlacementBudgetInMb(void) const
+    {
+        return nvramPlacementBudgetInMb_;
+    }
+    virtual uint64_t GetHotFileMaxSizeInKb(void) const
+    {
+        return hotFileMaxSizeInKb_;
+    }
+    virtual uint64_t GetHotFileMinIops(void) const
+    {
+        return hotFileMinIops_;
+    }
 
 protected:
     virtual bool _ValidateConfig(void) const;
@@ -167,10 +210,16 @@ private:
     size_t _GetWrrCountJournal(void);
     size_t _GetWrrCountMap(void);
     size_t _GetWrrCountGeneral(void);
+    uint64_t _GetDeadlineInUs(const MetaFsConfigType type);
     bool _IsRocksdbEnabled(void);
     std::string _GetRocksDbPath(void);
     bool _IsSupportingNumaDedicatedScheduling(void);
+    uint32_t _GetSchedulerCountPerNuma(void);
     bool _IsSupportCheckingCrcWhenReading(void);
+    std::string _GetFileStorePath(void);
+    bool _IsPlacementAdvisorEnabled(void);
+    bool _IsAutoPlacementEnabled(void);
+    uint64_t _GetPlacementValue(const MetaFsConfigType type, const uint64_t defaultValue);
 
     std::unordered_map<MetaFsConfigType, std::pair<std::string, int>> configMap_;
     ConfigManager* configManager_;
@@ -184,11 +233,23 @@ private:
     size_t wrrCountJournal_;
     size_t wrrCountMap_;
     size_t wrrCountGeneral_;
+    std::vector<uint64_t> deadlineInUs_;
     bool rocksdbEnabled_;
     std::string rocksDbPath_;
     bool supportNumaDedicatedScheduling_;
+    uint32_t schedulerCountPerNuma_;
     bool needToIgnoreNumaDedicatedScheduling_;
     bool supportCheckingCrcWhenReading_;
+    std::string fileStorePath_;
+    bool placementAdvisorEnabled_;
+    bool autoPlacementEnabled_;
+    uint64_t nvramPlacementBudgetInMb_;
+    uint64_t hotFileMaxSizeInKb_;
+    uint64_t hotFileMinIops_;
+
+    static const uint64_t DEFAULT_NVRAM_PLACEMENT_BUDGET_IN_MB = 64;
+    static const uint64_t DEFAULT_HOT_FILE_MAX_SIZE_IN_KB = 4096;
+    static const uint64_t DEFAULT_HOT_FILE_MIN_IOPS = 100;
 };
 
 } // namespace pos
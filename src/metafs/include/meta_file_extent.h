@@ -79,7 +79,7 @@ public:
         return startLpn > a->startLpn;
     }
 
-    MetaLpnType GetStartLpn(void)
+    MetaLpnType GetStartLpn(void) const
     {
         return startLpn;
     }
@@ -89,7 +89,7 @@ public:
         startLpn = lpn;
     }
 
-    MetaLpnType GetCount(void)
+    MetaLpnType GetCount(void) const
     {
         return count;
     }
@@ -99,7 +99,7 @@ public:
         count = lpn;
     }
 
-    MetaLpnType GetLast(void)
+    MetaLpnType GetLast(void) const
     {
         return startLpn + count - 1;
     }
@@ -0,0 +1,206 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "src/metafs/meta_file_placement.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "src/include/pos_event_id.h"
+#include "src/logger/logger.h"
+#include "src/metafs/config/metafs_config_manager.h"
+
+namespace pos
+{
+MetaFilePlacement::MetaFilePlacement(MetaFsConfigManager* configManager)
+: MetaFilePlacement(configManager->IsAutoPlacementEnabled(),
+      configManager->GetNvramPlacementBudgetInMb() * 1024 * 1024,
+      configManager->GetHotFileMaxSizeInKb() * 1024,
+      configManager->GetHotFileMinIops())
+{
+}
+
+MetaFilePlacement::MetaFilePlacement(bool autoPlacementEnabled, uint64_t budgetBytes,
+    uint64_t hotFileMaxBytes, uint64_t hotFileMinIops,
+    std::function<uint64_t(void)> clock)
+: autoPlacementEnabled(autoPlacementEnabled),
+  budgetBytes(budgetBytes),
+  hotFileMaxBytes(hotFileMaxBytes),
+  hotFileMinIops(hotFileMinIops),
+  clock(clock)
+{
+    if (nullptr == this->clock)
+    {
+        this->clock = _GetTimeInUs;
+    }
+
+    POS_TRACE_INFO(EID(MFS_META_FILE_PLACEMENT_ENABLED),
+        "auto_placement:{}, budget:{}, hot_file_max_size:{}, hot_file_min_iops:{}",
+        autoPlacementEnabled, budgetBytes, hotFileMaxBytes, hotFileMinIops);
+}
+
+MetaFilePlacement::~MetaFilePlacement(void)
+{
+    stats.clear();
+}
+
+bool
+MetaFilePlacement::IsAutoPlacementEnabled(void) const
+{
+    return autoPlacementEnabled;
+}
+
+std::shared_ptr<MetaFileIoStat>
+MetaFilePlacement::Track(const std::string& fileName,
+    MetaVolumeType requestedVolume, MetaVolumeType volume, uint64_t fileSize)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    auto it = stats.find(fileName);
+    if (it == stats.end())
+    {
+        auto stat = std::make_shared<MetaFileIoStat>(fileName, requestedVolume, clock());
+        it = stats.emplace(fileName, stat).first;
+    }
+    it->second->volume = volume;
+    it->second->fileSize = fileSize;
+    return it->second;
+}
+
+void
+MetaFilePlacement::Untrack(const std::string& fileName)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    stats.erase(fileName);
+}
+
+MetaVolumeType
+MetaFilePlacement::GetTargetVolume(const std::string& fileName)
+{
+    MetaFilePlacementAdvice advice = GetAdvice();
+
+    std::lock_guard<std::mutex> guard(lock);
+    auto it = stats.find(fileName);
+    if (it == stats.end())
+    {
+        return MetaVolumeType::Invalid;
+    }
+
+    if (autoPlacementEnabled)
+    {
+        for (auto& heat : advice.hotFiles)
+        {
+            if (heat.fileName == fileName && heat.placedOnNvram)
+            {
+                return MetaVolumeType::NvRamVolume;
+            }
+        }
+    }
+    return it->second->requestedVolume;
+}
+
+MetaFilePlacementAdvice
+MetaFilePlacement::GetAdvice(void)
+{
+    MetaFilePlacementAdvice advice = {};
+    advice.budgetBytes = budgetBytes;
+    uint64_t nowInUs = clock();
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        for (auto& entry : stats)
+        {
+            MetaFileIoStat& stat = *entry.second;
+            if (MetaVolumeType::NvRamVolume == stat.requestedVolume)
+            {
+                advice.pinnedNvramBytes += stat.fileSize;
+                continue;
+            }
+
+            uint64_t iops = _GetIops(stat, nowInUs);
+            if (_IsRelocatable(stat) && iops >= hotFileMinIops)
+            {
+                advice.hotFiles.push_back({stat.fileName, stat.fileSize, iops, stat.volume, false});
+                advice.hotFileBytes += stat.fileSize;
+            }
+        }
+    }
+
+    // the most I/Os per byte of nvram first
+    std::sort(advice.hotFiles.begin(), advice.hotFiles.end(),
+        [](const MetaFileHeat& a, const MetaFileHeat& b)
+        {
+            return a.iops * std::max(b.fileSize, 1UL) > b.iops * std::max(a.fileSize, 1UL);
+        });
+
+    for (auto& heat : advice.hotFiles)
+    {
+        if (advice.placedBytes + heat.fileSize <= budgetBytes)
+        {
+            heat.placedOnNvram = true;
+            advice.placedBytes += heat.fileSize;
+        }
+    }
+
+    const uint64_t MB = 1024 * 1024;
+    advice.recommendedNvramBytes =
+        (advice.pinnedNvramBytes + advice.hotFileBytes + MB - 1) / MB * MB;
+
+    return advice;
+}
+
+uint64_t
+MetaFilePlacement::_GetIops(const MetaFileIoStat& stat, uint64_t nowInUs) const
+{
+    const uint64_t US_PER_SEC = 1000000;
+    // a file opened moments ago is not hot just because of its first I/Os
+    uint64_t elapsedInUs = std::max(nowInUs - stat.trackingStartInUs, US_PER_SEC);
+    uint64_t weightedIoCount = stat.asyncIoCount + stat.syncIoCount * SYNC_IO_WEIGHT;
+
+    return weightedIoCount * US_PER_SEC / elapsedInUs;
+}
+
+bool
+MetaFilePlacement::_IsRelocatable(const MetaFileIoStat& stat) const
+{
+    return MetaVolumeType::SsdVolume == stat.requestedVolume &&
+        0 != stat.fileSize && stat.fileSize <= hotFileMaxBytes;
+}
+
+uint64_t
+MetaFilePlacement::_GetTimeInUs(void)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+} // namespace pos
@@ -0,0 +1,146 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "src/metafs/include/meta_volume_type.h"
+
+namespace pos
+{
+class MetaFsConfigManager;
+
+struct MetaFileIoStat
+{
+    MetaFileIoStat(const std::string& fileName, MetaVolumeType requestedVolume,
+        uint64_t trackingStartInUs)
+    : fileName(fileName),
+      requestedVolume(requestedVolume),
+      volume(requestedVolume),
+      fileSize(0),
+      syncIoCount(0),
+      asyncIoCount(0),
+      byteCount(0),
+      trackingStartInUs(trackingStartInUs)
+    {
+    }
+    void Record(bool isSync, uint64_t length)
+    {
+        if (isSync)
+        {
+            syncIoCount.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            asyncIoCount.fetch_add(1, std::memory_order_relaxed);
+        }
+        byteCount.fetch_add(length, std::memory_order_relaxed);
+    }
+
+    const std::string fileName;
+    const MetaVolumeType requestedVolume;
+    std::atomic<MetaVolumeType> volume;
+    std::atomic<uint64_t> fileSize;
+    std::atomic<uint64_t> syncIoCount;
+    std::atomic<uint64_t> asyncIoCount;
+    std::atomic<uint64_t> byteCount;
+    const uint64_t trackingStartInUs;
+};
+
+struct MetaFileHeat
+{
+    std::string fileName;
+    uint64_t fileSize;
+    uint64_t iops;
+    MetaVolumeType volume;
+    bool placedOnNvram;
+};
+
+struct MetaFilePlacementAdvice
+{
+    uint64_t budgetBytes;
+    // files which are created on the nvram volume by their owners
+    uint64_t pinnedNvramBytes;
+    // every hot file, whether it fits in the budget or not
+    uint64_t hotFileBytes;
+    // hot files chosen for the nvram volume within the budget
+    uint64_t placedBytes;
+    uint64_t recommendedNvramBytes;
+    std::vector<MetaFileHeat> hotFiles;
+};
+
+// Counts the I/Os of each meta file and picks the small files that are
+// accessed often enough to be kept on the nvram volume. A sync I/O blocks
+// its caller, so it weighs SYNC_IO_WEIGHT times as much as an async one.
+// Hot files are placed by I/Os per byte until the budget is used up.
+class MetaFilePlacement
+{
+public:
+    explicit MetaFilePlacement(MetaFsConfigManager* configManager);
+    MetaFilePlacement(bool autoPlacementEnabled, uint64_t budgetBytes,
+        uint64_t hotFileMaxBytes, uint64_t hotFileMinIops,
+        std::function<uint64_t(void)> clock = nullptr);
+    virtual ~MetaFilePlacement(void);
+
+    virtual bool IsAutoPlacementEnabled(void) const;
+    virtual std::shared_ptr<MetaFileIoStat> Track(const std::string& fileName,
+        MetaVolumeType requestedVolume, MetaVolumeType volume, uint64_t fileSize);
+    virtual void Untrack(const std::string& fileName);
+    // The volume the file should be stored on when it is closed
+    virtual MetaVolumeType GetTargetVolume(const std::string& fileName);
+    virtual MetaFilePlacementAdvice GetAdvice(void);
+
+    static const uint64_t SYNC_IO_WEIGHT = 4;
+
+private:
+    uint64_t _GetIops(const MetaFileIoStat& stat, uint64_t nowInUs) const;
+    bool _IsRelocatable(const MetaFileIoStat& stat) const;
+    static uint64_t _GetTimeInUs(void);
+
+    const bool autoPlacementEnabled;
+    const uint64_t budgetBytes;
+    const uint64_t hotFileMaxBytes;
+    const uint64_t hotFileMinIops;
+    std::function<uint64_t(void)> clock;
+    std::mutex lock;
+    std::unordered_map<std::string, std::shared_ptr<MetaFileIoStat>> stats;
+};
+} // namespace pos
@@ -39,6 +39,8 @@
 #include "src/include/partition_type.h"
 #include "src/metafs/include/metafs_service.h"
 #include "src/metafs/log/metafs_log.h"
+#include "src/metafs/meta_file_placement.h"
+#include "src/metafs/storage/mss_on_file.h"
 #include "src/metafs/storage/pstore/mss_on_disk.h"
 #include "src/telemetry/telemetry_client/telemetry_client.h"
 #include "src/metafs/config/metafs_config_manager.h"
@@ -50,6 +52,7 @@ MetaFs::MetaFs(void)
   io(nullptr),
   ctrl(nullptr),
   wbt(nullptr),
+  placement(nullptr),
   concurrentMetaFsTimeInterval(nullptr),
   isNpor_(false),
   isLoaded_(false),
@@ -74,7 +77,15 @@ MetaFs::MetaFs(IArrayInfo* arrayInfo, const bool isLoaded)
     arrayName_ = arrayInfo->GetName();
     arrayId_ = arrayInfo->GetIndex();
 
-    metaStorage_ = new MssOnDisk(arrayId_);
+    std::string fileStorePath = configMgr_->GetFileStorePath();
+    if (fileStorePath.size())
+    {
+        metaStorage_ = new MssOnFile(arrayId_, fileStorePath);
+    }
+    else
+    {
+        metaStorage_ = new MssOnDisk(arrayId_);
+    }
 
     telemetryPublisher_ = new TelemetryPublisher("metafs_" + to_string(arrayId_));
     TelemetryClientSingleton::Instance()->RegisterPublisher(telemetryPublisher_);
@@ -87,6 +98,10 @@ MetaFs::MetaFs(IArrayInfo* arrayInfo, const bool isLoaded)
     ctrl = new MetaFsFileControlApi(arrayId_, metaStorage_, mgmt, telemetryPublisher_);
     io = new MetaFsIoApi(arrayId_, ctrl, metaStorage_, telemetryPublisher_, concurrentMetaFsTimeInterval, supportNuma);
     wbt = new MetaFsWBTApi(arrayId_, ctrl);
+    if (configMgr_->IsPlacementAdvisorEnabled() || configMgr_->IsAutoPlacementEnabled())
+    {
+        placement = new MetaFilePlacement(configMgr_);
+    }
 
     MetaFsServiceSingleton::Instance()->Register(arrayName_, arrayId_, this);
 }
@@ -98,6 +113,7 @@ MetaFs::MetaFs(IArrayInfo* arrayInfo, const bool isLoaded, MetaFsManagementApi*
   io(io),
   ctrl(ctrl),
   wbt(wbt),
+  placement(nullptr),
   isNpor_(false),
   isLoaded_(isLoaded),
   isNormal_(false),
@@ -149,6 +165,12 @@ MetaFs::~MetaFs(void)
         wbt = nullptr;
     }
 
+    if (nullptr != placement)
+    {
+        delete placement;
+        placement = nullptr;
+    }
+
     if (nullptr != metaStorage_)
     {
         metaStorage_->Close();
@@ -51,6 +51,7 @@
 
 namespace pos
 {
+class MetaFilePlacement;
 class MetaFsConfigManager;
 
 class MetaFs : public IMountSequence
@@ -86,6 +87,8 @@ public:
     MetaFsIoApi* io;
     MetaFsFileControlApi* ctrl;
     MetaFsWBTApi* wbt;
+    // null unless the placement advisor or auto placement is enabled
+    MetaFilePlacement* placement;
 
 private:
     bool _Initialize(void);
@@ -36,11 +36,16 @@
 #include <string.h>
 #include <unistd.h>
 
+#include <atomic>
+#include <vector>
+
+#include "src/array/service/array_service_layer.h"
 #include "src/array_mgmt/array_manager.h"
 #include "src/array_models/interface/i_array_info.h"
 #include "src/io_submit_interface/i_io_submit_handler.h"
 #include "src/metafs/config/metafs_config_manager.h"
 #include "src/metafs/include/metafs_service.h"
+#include "src/metafs/meta_file_placement.h"
 #include "src/metafs/nvram_io_completion.h"
 
 namespace pos
@@ -49,8 +54,11 @@ MetaFsFileIntf::MetaFsFileIntf(const std::string fileName, const int arrayId,
                     MetaFileType fileType, MetaVolumeType volumeType)
 : MetaFileIntf(fileName, arrayId, fileType, volumeType),
   metaFs(MetaFsServiceSingleton::Instance()->GetMetaFs(arrayId)),
+  requestedVolumeType(volumeType),
+  ioStat(nullptr),
   blksPerStripe(0),
   baseLpn(UINT64_MAX),
+  baseByteAddress(nullptr),
   BYTE_ACCESS_ENABLED(MetaFsServiceSingleton::Instance()->GetConfigManager()->IsDirectAccessEnabled())
 {
 }
@@ -61,8 +69,11 @@ MetaFsFileIntf::MetaFsFileIntf(std::string fileName, int arrayId, MetaFs* metaFs
                     const MetaVolumeType volumeType)
 : MetaFileIntf(fileName, arrayId, fileType, volumeType),
   metaFs(metaFs),
+  requestedVolumeType(volumeType),
+  ioStat(nullptr),
   blksPerStripe(0),
   baseLpn(UINT64_MAX),
+  baseByteAddress(nullptr),
   BYTE_ACCESS_ENABLED(configManager->IsDirectAccessEnabled())
 {
 }
@@ -75,6 +86,7 @@ int
 MetaFsFileIntf::_Read(int fd, uint64_t fileOffset, uint64_t length, char* buffer)
 {
     MetaStorageType storageType = MetaFileUtil::ConvertToMediaType(volumeType);
+    _RecordIo(true, length);
     POS_EVENT_ID rc = metaFs->io->Read(fd, fileOffset, length, buffer, storageType);
 
     if (EID(SUCCESS) != rc)
@@ -87,6 +99,7 @@ int
 MetaFsFileIntf::_Write(int fd, uint64_t fileOffset, uint64_t length, char* buffer)
 {
     MetaStorageType storageType = MetaFileUtil::ConvertToMediaType(volumeType);
+    _RecordIo(true, length);
     POS_EVENT_ID rc = metaFs->io->Write(fd, fileOffset, length, buffer, storageType);
 
     if (EID(SUCCESS) != rc)
@@ -144,34 +157,18 @@ MetaFsFileIntf::AsyncIO(AsyncMetaFileIoCtx* ctx)
     assert(ctx->IsReadyToUse() == true);
 
     POS_EVENT_ID rc = EID(SUCCESS);
+    _RecordIo(false, ctx->GetLength());
 
-    if (BYTE_ACCESS_ENABLED &&
-        ctx->GetOpcode() == MetaFsIoOpcode::Write &&
-        volumeType == MetaVolumeType::NvRamVolume &&
-        ctx->GetLength() < MetaFsIoConfig::DEFAULT_META_PAGE_DATA_CHUNK_SIZE)
+    if (_IsSubPageNvramWrite(ctx))
     {
-        MetaLpnType pageNumber = _GetBaseLpn(MetaVolumeType::NvRamVolume) +
-            (ctx->GetFileOffset() / MetaFsIoConfig::DEFAULT_META_PAGE_DATA_CHUNK_SIZE);
-        pageNumber = pageNumber * MetaFsIoConfig::META_PAGE_SIZE_IN_BYTES /
-            ArrayConfig::BLOCK_SIZE_BYTE;
-
-        pos::LogicalByteAddr byteAddr = _CalculateByteAddress(pageNumber,
-            ctx->GetFileOffset() % MetaFsIoConfig::DEFAULT_META_PAGE_DATA_CHUNK_SIZE,
-            ctx->GetLength());
-
-        CallbackSmartPtr callback(new NvramIoCompletion(ctx));
-
-        IOSubmitHandlerStatus ioStatus =
-            IIOSubmitHandler::GetInstance()->SubmitAsyncByteIO(
-                IODirection::WRITE, (void*)ctx->GetBuffer(), byteAddr,
-                PartitionType::META_NVM, callback, arrayId);
-
-        if (IOSubmitHandlerStatus::SUCCESS != ioStatus)
+        char* address = GetDirectAccessAddress(ctx->GetFileOffset());
+        if (nullptr != address)
         {
-            MFS_TRACE_ERROR(EID(MFS_IO_FAILED_DUE_TO_ERROR),
-                "It is failed to submit the write request to NVRAM using direct method");
-
-            rc = EID(MFS_IO_FAILED_DUE_TO_ERROR);
+            _WriteDirectly(ctx, address);
+        }
+        else
+        {
+            rc = _SubmitByteWrite(ctx);
         }
     }
     else
@@ -185,6 +182,100 @@ MetaFsFileIntf::AsyncIO(AsyncMetaFileIoCtx* ctx)
     return EID(SUCCESS);
 }
 
+bool
+MetaFsFileIntf::_IsSubPageNvramWrite(AsyncMetaFileIoCtx* ctx) const
+{
+    const uint64_t offsetInPage = ctx->GetFileOffset() % MetaFsIoConfig::DEFAULT_META_PAGE_DATA_CHUNK_SIZE;
+
+    // the bytes must not run into the control info at the end of the page
+    return BYTE_ACCESS_ENABLED &&
+        ctx->GetOpcode() == MetaFsIoOpcode::Write &&
+        volumeType == MetaVolumeType::NvRamVolume &&
+        ctx->GetLength() < MetaFsIoConfig::DEFAULT_META_PAGE_DATA_CHUNK_SIZE &&
+        offsetInPage + ctx->GetLength() <= MetaFsIoConfig::DEFAULT_META_PAGE_DATA_CHUNK_SIZE;
+}
+
+// The bytes are stored by the caller's thread and completed right away,
+// so the update does not wait for the metafs scheduler and io workers
+void
+MetaFsFileIntf::_WriteDirectly(AsyncMetaFileIoCtx* ctx, char* address)
+{
+    memcpy(address, ctx->GetBuffer(), ctx->GetLength());
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    ctx->error = EID(SUCCESS);
+    auto callback = ctx->GetCallback();
+    if (callback)
+    {
+        callback(ctx);
+    }
+}
+
+POS_EVENT_ID
+MetaFsFileIntf::_SubmitByteWrite(AsyncMetaFileIoCtx* ctx)
+{
+    MetaLpnType pageNumber = _GetBaseLpn(MetaVolumeType::NvRamVolume) +
+        (ctx->GetFileOffset() / MetaFsIoConfig::DEFAULT_META_PAGE_DATA_CHUNK_SIZE);
+    pageNumber = pageNumber * MetaFsIoConfig::META_PAGE_SIZE_IN_BYTES /
+        ArrayConfig::BLOCK_SIZE_BYTE;
+
+    pos::LogicalByteAddr byteAddr = _CalculateByteAddress(pageNumber,
+        ctx->GetFileOffset() % MetaFsIoConfig::DEFAULT_META_PAGE_DATA_CHUNK_SIZE,
+        ctx->GetLength());
+
+    CallbackSmartPtr callback(new NvramIoCompletion(ctx));
+
+    IOSubmitHandlerStatus ioStatus =
+        IIOSubmitHandler::GetInstance()->SubmitAsyncByteIO(
+            IODirection::WRITE, (void*)ctx->GetBuffer(), byteAddr,
+            PartitionType::META_NVM, callback, arrayId);
+
+    if (IOSubmitHandlerStatus::SUCCESS != ioStatus)
+    {
+        MFS_TRACE_ERROR(EID(MFS_IO_FAILED_DUE_TO_ERROR),
+            "It is failed to submit the write request to NVRAM using direct method");
+
+        return EID(MFS_IO_FAILED_DUE_TO_ERROR);
+    }
+
+    return EID(SUCCESS);
+}
+
+// The file is a single extent of the nvram partition, so its meta pages are
+// contiguous in memory and only the first one has to be translated
+char*
+MetaFsFileIntf::GetDirectAccessAddress(uint64_t fileOffset)
+{
+    if (volumeType != MetaVolumeType::NvRamVolume || isOpened == false)
+    {
+        return nullptr;
+    }
+
+    if (nullptr == baseByteAddress)
+    {
+        MetaLpnType pageNumber = _GetBaseLpn(MetaVolumeType::NvRamVolume) *
+            MetaFsIoConfig::META_PAGE_SIZE_IN_BYTES / ArrayConfig::BLOCK_SIZE_BYTE;
+        pos::LogicalByteAddr byteAddr = _CalculateByteAddress(pageNumber, 0,
+            MetaFsIoConfig::DEFAULT_META_PAGE_DATA_CHUNK_SIZE);
+        PhysicalByteAddr physicalAddr = {.byteAddress = 0x0};
+
+        int ret = ArrayService::Instance()->Getter()->GetTranslator()->ByteTranslate(
+            arrayId, PartitionType::META_NVM, physicalAddr, byteAddr);
+        if (0 != ret)
+        {
+            MFS_TRACE_ERROR(EID(MFS_IO_FAILED_DUE_TO_ERROR),
+                "Failed to translate the nvram address of {}, ret:{}", fileName, ret);
+            return nullptr;
+        }
+
+        baseByteAddress = reinterpret_cast<char*>(physicalAddr.byteAddress);
+    }
+
+    return baseByteAddress +
+        (fileOffset / MetaFsIoConfig::DEFAULT_META_PAGE_DATA_CHUNK_SIZE) * MetaFsIoConfig::META_PAGE_SIZE_IN_BYTES +
+        (fileOffset % MetaFsIoConfig::DEFAULT_META_PAGE_DATA_CHUNK_SIZE);
+}
+
 FnCheckMetaFileIoDone
 MetaFsFileIntf::GetIoDoneCheckFunc(void)
 {
@@ -224,11 +315,27 @@ MetaFsFileIntf::Open(void)
 {
     POS_EVENT_ID rc = metaFs->ctrl->Open(fileName, fd, volumeType);
 
+    if (EID(SUCCESS) != rc && _IsRelocatable())
+    {
+        MetaVolumeType alternative = _GetAlternativeVolume();
+        if (EID(SUCCESS) == metaFs->ctrl->Open(fileName, fd, alternative))
+        {
+            volumeType = alternative;
+            rc = EID(SUCCESS);
+        }
+    }
+
     if (EID(SUCCESS) != rc)
     {
         return -(int)rc;
     }
 
+    if (nullptr != metaFs->placement)
+    {
+        ioStat = metaFs->placement->Track(fileName, requestedVolumeType, volumeType,
+            metaFs->ctrl->GetFileSize(fd, volumeType));
+    }
+
     return MetaFileIntf::Open();
 }
 
@@ -242,6 +349,12 @@ MetaFsFileIntf::Close(void)
         return -(int)rc;
     }
 
+    baseLpn = UINT64_MAX;
+    baseByteAddress = nullptr;
+    ioStat = nullptr;
+
+    _Relocate();
+
     return MetaFileIntf::Close();
 }
 
@@ -250,12 +363,27 @@ MetaFsFileIntf::DoesFileExist(void)
 {
     POS_EVENT_ID rc = metaFs->ctrl->CheckFileExist(fileName, volumeType);
 
+    if (EID(SUCCESS) != rc && _IsRelocatable())
+    {
+        MetaVolumeType alternative = _GetAlternativeVolume();
+        if (EID(SUCCESS) == metaFs->ctrl->CheckFileExist(fileName, alternative))
+        {
+            volumeType = alternative;
+            rc = EID(SUCCESS);
+        }
+    }
+
     return (EID(SUCCESS) == rc);
 }
 
 int
 MetaFsFileIntf::Delete(void)
 {
+    if (_IsRelocatable())
+    {
+        DoesFileExist();
+    }
+
     POS_EVENT_ID rc = metaFs->ctrl->Delete(fileName, volumeType);
 
     if (EID(SUCCESS) != rc)
@@ -263,6 +391,12 @@ MetaFsFileIntf::Delete(void)
         return -(int)rc;
     }
 
+    if (nullptr != metaFs->placement)
+    {
+        metaFs->placement->Untrack(fileName);
+    }
+    volumeType = requestedVolumeType;
+
     return (int)rc;
 }
 
@@ -271,4 +405,132 @@ MetaFsFileIntf::GetFileSize(void)
 {
     return metaFs->ctrl->GetFileSize(fd, volumeType);
 }
+
+// Only the files asked for on the ssd volume are moved, and only to the nvram
+// volume. Such a file is looked up on both volumes, so that it is found even
+// after auto placement has been turned off.
+bool
+MetaFsFileIntf::_IsRelocatable(void) const
+{
+    return MetaVolumeType::SsdVolume == requestedVolumeType;
+}
+
+MetaVolumeType
+MetaFsFileIntf::_GetAlternativeVolume(void) const
+{
+    return (MetaVolumeType::NvRamVolume == volumeType) ? requestedVolumeType : MetaVolumeType::NvRamVolume;
+}
+
+void
+MetaFsFileIntf::_RecordIo(bool isSync, uint64_t length)
+{
+    if (nullptr != ioStat)
+    {
+        ioStat->Record(isSync, length);
+    }
+}
+
+// A closed file has no I/O in flight, so it is moved here rather than while
+// it is in use. The owner finds it on the new volume when it opens it again.
+void
+MetaFsFileIntf::_Relocate(void)
+{
+    if (!_IsRelocatable())
+    {
+        return;
+    }
+
+    MetaVolumeType target = requestedVolumeType;
+    if (nullptr != metaFs->placement)
+    {
+        MetaVolumeType placed = metaFs->placement->GetTargetVolume(fileName);
+        if (MetaVolumeType::Invalid != placed)
+        {
+            target = placed;
+        }
+    }
+
+    if (target == volumeType || !metaFs->mgmt->IsValidVolume(target))
+    {
+        return;
+    }
+
+    if (!_CopyTo(target))
+    {
+        return;
+    }
+
+    if (EID(SUCCESS) != metaFs->ctrl->Delete(fileName, volumeType))
+    {
+        MFS_TRACE_WARN(EID(MFS_META_FILE_MOVE_FAILED),
+            "The old copy of {} on volume {} could not be deleted", fileName, (int)volumeType);
+    }
+
+    MFS_TRACE_INFO(EID(MFS_META_FILE_MOVED),
+        "{} has been moved from volume {} to volume {}", fileName, (int)volumeType, (int)target);
+
+    volumeType = target;
+    if (nullptr != metaFs->placement)
+    {
+        metaFs->placement->Track(fileName, requestedVolumeType, volumeType, size);
+    }
+}
+
+bool
+MetaFsFileIntf::_CopyTo(MetaVolumeType target)
+{
+    MetaFsFileControlApi* ctrl = metaFs->ctrl;
+    int srcFd = 0;
+    if (EID(SUCCESS) != ctrl->Open(fileName, srcFd, volumeType))
+    {
+        return false;
+    }
+
+    uint64_t fileSize = ctrl->GetFileSize(srcFd, volumeType);
+    if (ctrl->GetAvailableSpace(fileProperty, target) < fileSize)
+    {
+        ctrl->Close(srcFd, volumeType);
+        MFS_TRACE_INFO(EID(MFS_META_FILE_MOVE_FAILED),
+            "Volume {} has no room for {}, size: {}", (int)target, fileName, fileSize);
+        return false;
+    }
+
+    std::vector<char> buffer(fileSize);
+    POS_EVENT_ID rc = metaFs->io->Read(srcFd, 0, fileSize, buffer.data(),
+        MetaFileUtil::ConvertToMediaType(volumeType));
+    ctrl->Close(srcFd, volumeType);
+    if (EID(SUCCESS) != rc)
+    {
+        MFS_TRACE_WARN(EID(MFS_META_FILE_MOVE_FAILED),
+            "Failed to read {} to move it, rc: {}", fileName, (int)rc);
+        return false;
+    }
+
+    if (EID(SUCCESS) != ctrl->Create(fileName, fileSize, fileProperty, target))
+    {
+        MFS_TRACE_WARN(EID(MFS_META_FILE_MOVE_FAILED),
+            "Failed to create {} on volume {}", fileName, (int)target);
+        return false;
+    }
+
+    int dstFd = 0;
+    rc = ctrl->Open(fileName, dstFd, target);
+    if (EID(SUCCESS) == rc)
+    {
+        rc = metaFs->io->Write(dstFd, 0, fileSize, buffer.data(),
+            MetaFileUtil::ConvertToMediaType(target));
+        ctrl->Close(dstFd, target);
+    }
+
+    if (EID(SUCCESS) != rc)
+    {
+        MFS_TRACE_WARN(EID(MFS_META_FILE_MOVE_FAILED),
+            "Failed to write {} on volume {}, rc: {}", fileName, (int)target, (int)rc);
+        ctrl->Delete(fileName, target);
+        return false;
+    }
+
+    size = fileSize;
+    return true;
+}
 } // namespace pos
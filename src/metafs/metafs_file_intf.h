@@ -34,6 +34,7 @@
 
 #include <cassert>
 #include <cstdint>
+#include <memory>
 #include <string>
 
 #include "src/meta_file_intf/meta_file_include.h"
@@ -44,6 +45,7 @@
 namespace pos
 {
 class MetaFsConfigManager;
+struct MetaFileIoStat;
 
 class MetaFsFileIntf : public MetaFileIntf
 {
@@ -68,6 +70,7 @@ public:
 
     virtual int Open(void) override;
     virtual int Close(void) override;
+    virtual char* GetDirectAccessAddress(uint64_t fileOffset) override;
 
 protected:
     virtual int _Read(int fd, uint64_t fileOffset, uint64_t length, char* buffer) override;
@@ -76,10 +79,22 @@ protected:
     uint32_t _GetMaxLpnCntPerIOSubmit(PartitionType type);
     MetaLpnType _GetBaseLpn(MetaVolumeType type);
     pos::LogicalByteAddr _CalculateByteAddress(uint64_t pageNumber, uint64_t offset, uint64_t size);
+    bool _IsSubPageNvramWrite(AsyncMetaFileIoCtx* ctx) const;
+    void _WriteDirectly(AsyncMetaFileIoCtx* ctx, char* address);
+    POS_EVENT_ID _SubmitByteWrite(AsyncMetaFileIoCtx* ctx);
+    bool _IsRelocatable(void) const;
+    MetaVolumeType _GetAlternativeVolume(void) const;
+    void _RecordIo(bool isSync, uint64_t length);
+    void _Relocate(void);
+    bool _CopyTo(MetaVolumeType target);
 
     MetaFs* metaFs;
+    // the volume the owner asked for; the file may have been moved to nvram
+    const MetaVolumeType requestedVolumeType;
+    std::shared_ptr<MetaFileIoStat> ioStat;
     uint32_t blksPerStripe;
     MetaLpnType baseLpn;
+    char* baseByteAddress;
     const bool BYTE_ACCESS_ENABLED;
 };
 
@@ -32,6 +32,7 @@
 
 #include "metafs_service.h"
 
+#include <algorithm>
 #include <string>
 #include <unordered_map>
 
@@ -175,8 +176,10 @@ MetaFsService::_CreateScheduler(const uint32_t totalCoreCount,
     }
 
     const std::string threadName = "MetaScheduler";
+    const uint32_t countPerNuma = _GetSchedulerCountPerNuma();
     int numOfSchedulersCreated = 0;
-    bool needToIgnoreNuma = (countOfScheduler < MAX_SCHEDULER_COUNT) ? true : false;
+    bool needToIgnoreNuma = (countOfScheduler < MAX_SCHEDULER_COUNT * (int)countPerNuma) ? true : false;
+    std::unordered_map<uint32_t, uint32_t> countInNuma;
 
     configManager_->SetIgnoreNumaDedicatedScheduling(needToIgnoreNuma);
 
@@ -187,21 +190,24 @@ MetaFsService::_CreateScheduler(const uint32_t totalCoreCount,
             MetaFsIoScheduler* scheduler = factory_->CreateMetaFsIoScheduler(0, coreId, totalCoreCount,
                 threadName, mioSet, configManager_, tp_);
 
-            int numaId = needToIgnoreNuma ? 0 : _GetNumaId(coreId);
+            uint32_t numaId = needToIgnoreNuma ? 0 : _GetNumaId(coreId);
+            // the schedulers of a numa are keyed from numaId * countPerNuma
+            uint32_t key = numaId * countPerNuma + countInNuma[numaId];
             POS_TRACE_INFO(EID(MFS_INFO_MESSAGE),
-                "{} MetaScheduler(s) has been created, coreId: {}, numaId: {}",
-                numOfSchedulersCreated, coreId, numaId);
+                "{} MetaScheduler(s) has been created, coreId: {}, numaId: {}, key: {}",
+                numOfSchedulersCreated, coreId, numaId, key);
 
-            if (ioScheduler_.find(numaId) == ioScheduler_.end())
+            if (countInNuma[numaId] < countPerNuma)
             {
-                ioScheduler_.insert({numaId, scheduler});
+                ioScheduler_.insert({key, scheduler});
                 scheduler->StartThread();
+                countInNuma[numaId]++;
                 numOfSchedulersCreated++;
             }
             else
             {
                 POS_TRACE_ERROR(EID(MFS_TRY_TO_CREATE_SCHEDULER_IN_THE_SAME_NUMA),
-                    "Only one scheduler can be created for each NUMA");
+                    "Only {} scheduler(s) can be created for each NUMA", countPerNuma);
                 delete scheduler;
                 assert(false);
             }
@@ -209,9 +215,17 @@ MetaFsService::_CreateScheduler(const uint32_t totalCoreCount,
     }
 }
 
+uint32_t
+MetaFsService::_GetSchedulerCountPerNuma(void) const
+{
+    return std::max(configManager_->GetSchedulerCountPerNuma(), (uint32_t)1);
+}
+
 bool
 MetaFsService::_CheckSchedulerSettingFromConfig(const int countOfScheduler) const
 {
+    const int countPerNuma = (int)_GetSchedulerCountPerNuma();
+
     if (countOfScheduler == 0)
     {
         POS_TRACE_ERROR(EID(MFS_SCHEDULER_NONE),
@@ -219,26 +233,26 @@ MetaFsService::_CheckSchedulerSettingFromConfig(const int countOfScheduler) cons
             countOfScheduler);
         return false;
     }
-    else if (countOfScheduler > MAX_SCHEDULER_COUNT)
+    else if (countOfScheduler > MAX_SCHEDULER_COUNT * countPerNuma)
     {
         POS_TRACE_ERROR(EID(MFS_MAX_SCHEDULER_EXCEEDED),
-            "It has exceeded the maximum number that can be generated, countOfScheduler:{}, MAX_SCHEDULER_COUNT: {}",
-            countOfScheduler, MAX_SCHEDULER_COUNT);
+            "It has exceeded the maximum number that can be generated, countOfScheduler:{}, MAX_SCHEDULER_COUNT: {}, countPerNuma: {}",
+            countOfScheduler, MAX_SCHEDULER_COUNT, countPerNuma);
         return false;
     }
 
     if (configManager_->IsSupportingNumaDedicatedScheduling())
     {
-        if (countOfScheduler < MAX_SCHEDULER_COUNT)
+        if (countOfScheduler < MAX_SCHEDULER_COUNT * countPerNuma)
         {
             POS_TRACE_WARN(EID(MFS_SCHEDULER_COUNT_SMALLER_THAN_EXPECTED),
-                "Numa_dedicated is set but the count of metafs io scheduler is not more than one");
+                "Numa_dedicated is set but the count of metafs io scheduler is less than expected");
             return true;
         }
     }
     else
     {
-        if (countOfScheduler > 1)
+        if (countOfScheduler > countPerNuma)
         {
             POS_TRACE_ERROR(EID(MFS_UNNECESSARY_SCHEDULER_SET),
                 "This meta scheduler will not be created, when the numa_dedicated setting is turned on");
@@ -32,7 +32,7 @@
 
 #include "mdpage.h"
 
-#include <boost/crc.hpp>
+#include <isa-l.h>
 
 #include "mdpage_buf_pool.h"
 #include "meta_io_manager.h"
@@ -192,10 +192,8 @@ MDPage::UpdateCrcToControlInfo(void)
 uint32_t
 MDPage::_GenerateCrc(void) const
 {
-    boost::crc_32_type result;
-    result.reset();
-    result.process_bytes(dataAll, GetCrcCoveredSize());
-    return result.checksum();
+    // the same crc-32 as boost::crc_32_type, computed with pclmulqdq
+    return crc32_gzip_refl(0, dataAll, GetCrcCoveredSize());
 }
 
 std::string
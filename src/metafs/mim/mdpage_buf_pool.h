@@ -43,8 +43,10 @@ namespace pos
 class MDPageBufPool
 {
 public:
-    explicit MDPageBufPool(uint32_t numBuf)
-    : totalNumBuf(numBuf)
+    explicit MDPageBufPool(uint32_t numBuf, uint32_t numaId = ANY_NUMA, uint32_t pagesPerBuf = 1)
+    : totalNumBuf(numBuf),
+      numaId(numaId),
+      pagesPerBuf(pagesPerBuf)
     {
         base = nullptr;
     }
@@ -58,20 +60,30 @@ public:
     void
     Init(void)
     {
-        base = pos::Memory<MDPAGE_BUF_SIZE>::Alloc(totalNumBuf);
+        // keep the pages on the node of the worker that does io with them
+        if (ANY_NUMA == numaId)
+        {
+            base = pos::Memory<MDPAGE_BUF_SIZE>::Alloc(totalNumBuf * pagesPerBuf);
+        }
+        else
+        {
+            base = pos::Memory<MDPAGE_BUF_SIZE>::AllocFromSocket(totalNumBuf * pagesPerBuf, numaId);
+        }
         assert(base != nullptr); // please check hugepage preallocation
         for (uint32_t bufIdx = 0; bufIdx < totalNumBuf; ++bufIdx)
         {
-            mdPageBufList.push_back((uint8_t*)base + (MDPAGE_BUF_SIZE * bufIdx));
+            mdPageBufList.push_back((uint8_t*)base + (MDPAGE_BUF_SIZE * pagesPerBuf * bufIdx));
         }
     }
 
+    // the pool is never refilled by another thread, so waiting on an empty
+    // pool would never end. let the caller decide what to do instead.
     void*
     PopNewBuf(void)
     {
-        while (mdPageBufList.empty())
+        if (mdPageBufList.empty())
         {
-            usleep(1);
+            return nullptr;
         }
         void* newBuf = mdPageBufList.back();
         mdPageBufList.pop_back();
@@ -97,8 +109,12 @@ public:
         return mdPageBufList.size();
     }
 
+    static const uint32_t ANY_NUMA = UINT32_MAX;
+
 private:
     uint32_t totalNumBuf;
+    uint32_t numaId;
+    uint32_t pagesPerBuf;
     static const FileSizeType MDPAGE_BUF_SIZE = MetaFsIoConfig::META_PAGE_SIZE_IN_BYTES;
     void* base;
     std::vector<void*> mdPageBufList;
@@ -40,12 +40,14 @@
 
 #include <numa.h>
 
+#include <algorithm>
 #include <string>
 
 #include "metafs_control_request.h"
 #include "metafs_log.h"
 #include "metafs_mem_lib.h"
 #include "src/cpu_affinity/affinity_manager.h"
+#include "src/metafs/config/metafs_config_manager.h"
 #include "src/logger/logger.h"
 #include "src/metafs/include/metafs_service.h"
 #include "src/metafs/mim/metafs_io_scheduler.h"
@@ -55,21 +57,30 @@
 namespace pos
 {
 MetaIoManager::MetaIoManager(const bool supportNumaDedicated, MetaStorageSubsystem* storage)
-: MetaIoManager(supportNumaDedicated, MetaFsServiceSingleton::Instance()->GetScheduler(), storage)
+: MetaIoManager(supportNumaDedicated, MetaFsServiceSingleton::Instance()->GetScheduler(), storage,
+      MetaFsServiceSingleton::Instance()->GetConfigManager()->GetSchedulerCountPerNuma())
 {
 }
 
 MetaIoManager::MetaIoManager(const bool supportNumaDedicated, const SchedulerMap& ioScheduler,
-    MetaStorageSubsystem* storage)
+    MetaStorageSubsystem* storage, const uint32_t schedulerCountPerNuma)
 : IS_SINGLE_SCHEDULER(ioScheduler.size() == 1),
   SUPPORT_NUMA_DEDICATED_SCHEDULING(supportNumaDedicated),
   ioScheduler(ioScheduler),
+  schedulersInNuma(),
   totalMetaIoCoreCnt(0),
   mioHandlerCount(0),
   finalized(false),
   metaStorage(storage)
 {
     _InitReqHandler();
+
+    // the schedulers of a numa are keyed from numaId * schedulerCountPerNuma
+    for (const auto& scheduler : ioScheduler)
+    {
+        uint32_t numaId = scheduler.first / std::max(schedulerCountPerNuma, (uint32_t)1);
+        schedulersInNuma[numaId].push_back(scheduler.second);
+    }
 }
 
 MetaIoManager::~MetaIoManager(void)
@@ -217,7 +228,11 @@ MetaIoManager::_IssueToScheduler(MetaFsIoRequest* reqMsg)
     else
     {
         uint32_t numaId = SUPPORT_NUMA_DEDICATED_SCHEDULING ? reqMsg->numaId : 0;
-        ioScheduler[numaId]->EnqueueNewReq(reqMsg);
+        std::vector<MetaFsIoScheduler*>& schedulers = schedulersInNuma[numaId];
+
+        // requests of a file always meet the same scheduler to keep their order
+        uint64_t key = ((uint64_t)reqMsg->arrayId << 32) | (uint32_t)reqMsg->fd;
+        schedulers[key % schedulers.size()]->EnqueueNewReq(reqMsg);
     }
 }
 
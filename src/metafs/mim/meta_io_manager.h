@@ -39,6 +39,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "meta_io_manager.h"
 #include "meta_volume_manager.h"
@@ -59,7 +60,8 @@ class MetaIoManager : public MetaFsManagerBase
 public:
     // only for test
     MetaIoManager(const bool supportNumaDedicated, MetaStorageSubsystem* storage = nullptr);
-    MetaIoManager(const bool supportNumaDedicated, const SchedulerMap& ioScheduler, MetaStorageSubsystem* storage);
+    MetaIoManager(const bool supportNumaDedicated, const SchedulerMap& ioScheduler, MetaStorageSubsystem* storage,
+        const uint32_t schedulerCountPerNuma = 1);
     virtual ~MetaIoManager(void);
 
     bool IsSuccess(POS_EVENT_ID rc);
@@ -86,6 +88,7 @@ private:
     const bool SUPPORT_NUMA_DEDICATED_SCHEDULING;
     MetaIoReqHandler reqHandler[NUM_IO_TYPE];
     SchedulerMap ioScheduler;
+    std::unordered_map<uint32_t, std::vector<MetaFsIoScheduler*>> schedulersInNuma;
     uint32_t totalMetaIoCoreCnt;
     uint32_t mioHandlerCount;
     bool finalized;
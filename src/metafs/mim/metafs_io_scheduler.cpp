@@ -35,6 +35,7 @@
 #include <numa.h>
 #include <sched.h>
 
+#include <algorithm>
 #include <string>
 #include <thread>
 
@@ -104,6 +105,8 @@ MetaFsIoScheduler::MetaFsIoScheduler(const int threadId, const int coreId,
 {
     mioCoreCountInTheSameNuma_.resize(TOTAL_CORE_COUNT);
     ioSQ_.SetWeight(weight_);
+    if (config_)
+        ioSQ_.SetDeadline(config_->GetDeadlineInUs());
 }
 
 MetaFsIoScheduler::~MetaFsIoScheduler(void)
@@ -169,8 +172,6 @@ MetaFsIoScheduler::_SetCurrentContextFrom(MetaFsIoRequest* reqMsg)
     currentExtent_ = 0;
     // currentExtent_ will be updated again at _UpdateCurrentExtentToNextExtentConditionally()
 
-    // set the request count to process the callback count
-    _SetRequestCountOrCallbackCountOfCurrentRequest(requestCount_);
 }
 
 void
@@ -211,6 +212,7 @@ MetaFsIoScheduler::IssueRequestAndDelete(MetaFsIoRequest* reqMsg)
 {
     uint64_t byteOffset = 0;
     bool isFirstLpn = true;
+    std::vector<MetaFsIoRequest*> cloneReqList;
 
     _SetCurrentContextFrom(reqMsg);
     _UpdateCurrentExtentToNextExtentConditionally();
@@ -223,50 +225,51 @@ MetaFsIoScheduler::IssueRequestAndDelete(MetaFsIoRequest* reqMsg)
         // cloneReqMsg: new copy, sent to meta handler thread by scheduler
         // reqMsg->originalMsg: from a user thread
         MetaFsIoRequest* cloneReqMsg = new MetaFsIoRequest(*currentReqMsg_);
+        const size_t lpnCount = _GetLpnCountToCoalesce();
+        const FileSizeType byteOffsetInChunk = isFirstLpn ? (currentReqMsg_->byteOffsetInFile % chunkSize_) : 0;
 
-        // 1st
-        if (isFirstLpn)
-        {
-            isFirstLpn = false;
-            cloneReqMsg->buf = currentReqMsg_->buf;
-            cloneReqMsg->byteOffsetInFile = currentReqMsg_->byteOffsetInFile;
-            if (chunkSize_ < (currentReqMsg_->byteSize + (currentReqMsg_->byteOffsetInFile % chunkSize_)))
-            {
-                cloneReqMsg->byteSize = chunkSize_ - (currentReqMsg_->byteOffsetInFile % chunkSize_);
-            }
-            else
-            {
-                cloneReqMsg->byteSize = currentReqMsg_->byteSize;
-            }
-        }
-        // last
-        else if (remainCount_ == 1)
-        {
-            cloneReqMsg->buf = (FileBufType)((uint64_t)currentReqMsg_->buf + byteOffset);
-            cloneReqMsg->byteOffsetInFile = currentReqMsg_->byteOffsetInFile + byteOffset;
-            cloneReqMsg->byteSize = currentReqMsg_->byteSize - byteOffset;
-        }
-        else
-        {
-            cloneReqMsg->buf = (FileBufType)((uint64_t)currentReqMsg_->buf + byteOffset);
-            cloneReqMsg->byteOffsetInFile = currentReqMsg_->byteOffsetInFile + byteOffset;
-            cloneReqMsg->byteSize = chunkSize_;
-        }
+        isFirstLpn = false;
+        cloneReqMsg->buf = (FileBufType)((uint64_t)currentReqMsg_->buf + byteOffset);
+        cloneReqMsg->byteOffsetInFile = currentReqMsg_->byteOffsetInFile + byteOffset;
+        cloneReqMsg->byteSize = std::min(currentReqMsg_->byteSize - byteOffset,
+            (lpnCount * chunkSize_) - byteOffsetInChunk);
 
         byteOffset += cloneReqMsg->byteSize;
         cloneReqMsg->baseMetaLpn = currentLpn_;
 
-        _IssueRequestToMioWorker(cloneReqMsg);
+        cloneReqList.push_back(cloneReqMsg);
 
-        ++currentLpn_;
-        --remainCount_;
+        currentLpn_ += lpnCount;
+        remainCount_ -= lpnCount;
         _UpdateCurrentLpnAndExtentConditionally();
     }
 
+    // the count has to be known before any clone can be completed by a worker
+    _SetRequestCountOrCallbackCountOfCurrentRequest(cloneReqList.size());
+
+    for (auto cloneReqMsg : cloneReqList)
+    {
+        _IssueRequestToMioWorker(cloneReqMsg);
+    }
+
     // delete msg instance, this instance was only for meta scheduler
     delete reqMsg;
 }
 
+size_t
+MetaFsIoScheduler::_GetLpnCountToCoalesce(void) const
+{
+    // only reads from the ssd are coalesced, writes keep the per lpn range lock
+    if ((MetaIoRequestType::Read != currentReqMsg_->reqType) ||
+        (MetaStorageType::SSD != currentReqMsg_->targetMediaType))
+    {
+        return 1;
+    }
+
+    size_t lpnCount = std::min(remainCount_, (size_t)MetaFsIoConfig::MAX_PAGE_COUNT_PER_MULTI_PAGE_IO);
+    return std::min(lpnCount, (size_t)(extents_[currentExtent_].GetLast() - currentLpn_ + 1));
+}
+
 uint32_t
 MetaFsIoScheduler::_GetNumaIdConsideringNumaDedicatedScheduling(const uint32_t numaId)
 {
@@ -274,9 +277,9 @@ MetaFsIoScheduler::_GetNumaIdConsideringNumaDedicatedScheduling(const uint32_t n
 }
 
 uint32_t
-MetaFsIoScheduler::_GetIndexOfWorkerConsideringNumaDedicatedScheduling(const uint32_t numaId)
+MetaFsIoScheduler::_GetIndexOfWorkerConsideringNumaDedicatedScheduling(const uint32_t numaId, const MetaLpnType lpn)
 {
-    return !needToIgnoreNuma_ ? currentLpn_ % mioCoreCountInTheSameNuma_[numaId] : currentLpn_ % mioCoreCount_;
+    return !needToIgnoreNuma_ ? lpn % mioCoreCountInTheSameNuma_[numaId] : lpn % mioCoreCount_;
 }
 
 void
@@ -298,7 +301,7 @@ void
 MetaFsIoScheduler::_IssueRequestToMioWorker(MetaFsIoRequest* reqMsg)
 {
     uint32_t numaId = _GetNumaIdConsideringNumaDedicatedScheduling(reqMsg->numaId);
-    uint32_t index = _GetIndexOfWorkerConsideringNumaDedicatedScheduling(numaId);
+    uint32_t index = _GetIndexOfWorkerConsideringNumaDedicatedScheduling(numaId, reqMsg->baseMetaLpn);
     metaIoWorkerList_[numaId][index]->EnqueueNewReq(reqMsg);
 }
 
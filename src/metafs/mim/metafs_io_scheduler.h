@@ -83,11 +83,12 @@ private:
     void _SetCurrentContextFrom(MetaFsIoRequest* reqMsg);
     void _UpdateCurrentLpnAndExtentConditionally(void);
     void _UpdateCurrentExtentToNextExtentConditionally(void);
+    size_t _GetLpnCountToCoalesce(void) const;
     void _PushToMioThreadList(const uint32_t coreId, ScalableMetaIoWorker* worker);
     void _IssueRequestToMioWorker(MetaFsIoRequest* reqMsg);
     bool _DoesMioWorkerForNumaExist(const int numaId);
     uint32_t _GetNumaIdConsideringNumaDedicatedScheduling(const uint32_t numaId);
-    uint32_t _GetIndexOfWorkerConsideringNumaDedicatedScheduling(const uint32_t numaId);
+    uint32_t _GetIndexOfWorkerConsideringNumaDedicatedScheduling(const uint32_t numaId, const MetaLpnType lpn);
     void _PublishPeriodicMetrics(void);
 
     const size_t TOTAL_NUMA_COUNT;
@@ -34,6 +34,7 @@
 
 #include <array>
 #include <algorithm>
+#include <chrono>
 #include <vector>
 
 #include "metafs_io_q.h"
@@ -50,10 +51,18 @@ public:
     {
     }
     MetaFsIoWrrQ(const std::vector<int> weight)
+    : MetaFsIoWrrQ(weight, std::vector<uint64_t>())
+    {
+    }
+    MetaFsIoWrrQ(const std::vector<int> weight, const std::vector<uint64_t> deadlineInUs)
     : weight_(weight),
       index_(0),
-      remainedWeight_(weight[0])
+      remainedWeight_(weight[0]),
+      deadline_(),
+      hasDeadline_(false),
+      head_()
     {
+        SetDeadline(deadlineInUs);
     }
     /* All items in queue will be deleted */
     virtual ~MetaFsIoWrrQ(void)
@@ -67,14 +76,22 @@ public:
     /* thread safe */
     virtual void Enqueue(const ItemT entry, const TypeE type)
     {
-        queue_[(size_t)type].Enqueue(entry);
+        const size_t index = (size_t)type;
+        if (deadline_[index].count())
+            queue_[index].push({entry, Clock::now() + deadline_[index]});
+        else
+            queue_[index].push({entry, TimePoint::max()});
     }
     /* thread unsafe */
     virtual ItemT Dequeue(void)
     {
+        ItemT t = _DequeueOverdue();
+        if (nullptr != t)
+            return t;
+
         for (size_t cnt = 0; cnt < TYPE_COUNT; ++cnt)
         {
-            ItemT t = queue_[index_].Dequeue();
+            t = _Pop(index_);
             if (nullptr != t)
             {
                 _DecreaseCurrentWeight();
@@ -94,8 +111,77 @@ public:
     {
         weight_ = weight;
     }
+    /* 0 means the type has no deadline, the missing types as well */
+    virtual void SetDeadline(const std::vector<uint64_t> deadlineInUs)
+    {
+        hasDeadline_ = false;
+        for (size_t index = 0; index < TYPE_COUNT; ++index)
+        {
+            uint64_t us = (index < deadlineInUs.size()) ? deadlineInUs[index] : 0;
+            deadline_[index] = std::chrono::microseconds(us);
+            if (us)
+                hasDeadline_ = true;
+        }
+    }
 
 private:
+    using Clock = std::chrono::steady_clock;
+    using TimePoint = Clock::time_point;
+    struct Entry
+    {
+        ItemT item;
+        TimePoint due;
+    };
+
+    ItemT _Pop(const size_t index)
+    {
+        ItemT t = head_[index].item;
+        if (nullptr != t)
+        {
+            head_[index].item = nullptr;
+            return t;
+        }
+
+        Entry e;
+        if (queue_[index].try_pop(e))
+            return e.item;
+        return nullptr;
+    }
+    /* the head is popped out of the concurrent queue to see its due time */
+    Entry* _Peek(const size_t index)
+    {
+        if (nullptr == head_[index].item)
+        {
+            if (!queue_[index].try_pop(head_[index]))
+                return nullptr;
+        }
+        return &head_[index];
+    }
+    /* earliest deadline first among the types whose head has been overdue */
+    ItemT _DequeueOverdue(void)
+    {
+        if (!hasDeadline_)
+            return nullptr;
+
+        const TimePoint now = Clock::now();
+        size_t earliest = TYPE_COUNT;
+        for (size_t index = 0; index < TYPE_COUNT; ++index)
+        {
+            if (!deadline_[index].count())
+                continue;
+
+            Entry* e = _Peek(index);
+            if ((nullptr != e) && (e->due <= now))
+            {
+                if ((TYPE_COUNT == earliest) || (e->due < head_[earliest].due))
+                    earliest = index;
+            }
+        }
+
+        if (TYPE_COUNT == earliest)
+            return nullptr;
+        return _Pop(earliest);
+    }
     void _MoveToNextIndex(void)
     {
         index_++;
@@ -117,9 +203,12 @@ private:
     }
 
     static const size_t TYPE_COUNT = (size_t)TypeE::MAX;
-    std::array<MetaFsIoQ<ItemT>, TYPE_COUNT> queue_;
+    std::array<tbb::concurrent_queue<Entry>, TYPE_COUNT> queue_;
     std::vector<int> weight_;
     size_t index_;
     int remainedWeight_;
+    std::array<std::chrono::microseconds, TYPE_COUNT> deadline_;
+    bool hasDeadline_;
+    std::array<Entry, TYPE_COUNT> head_;
 };
 } // namespace pos
@@ -36,87 +36,191 @@
 namespace pos
 {
 MetaFsIoRangeOverlapChker::MetaFsIoRangeOverlapChker(void)
-: outstandingIoMap(nullptr)
-{
-}
-
-MetaFsIoRangeOverlapChker::MetaFsIoRangeOverlapChker(BitMap* outstandingIoMap)
-: outstandingIoMap(outstandingIoMap)
+: maxLpn(0),
+  shardCount(0),
+  shards(nullptr),
+  outstandingCount(0)
 {
 }
 
 MetaFsIoRangeOverlapChker::~MetaFsIoRangeOverlapChker(void)
 {
-    if (nullptr != outstandingIoMap)
+    if (nullptr != shards)
     {
-        delete outstandingIoMap;
+        for (size_t idx = 0; idx < shardCount; ++idx)
+        {
+            delete[] shards[idx].load();
+        }
+        delete[] shards;
     }
 }
 
 void
 MetaFsIoRangeOverlapChker::Init(MetaLpnType maxLpn)
 {
-    outstandingIoMap = new BitMap(maxLpn + 1);
-    outstandingIoMap->ResetBitmap();
+    this->maxLpn = maxLpn;
+    shardCount = (maxLpn / LPN_COUNT_PER_SHARD) + 1;
+    shards = new std::atomic<Word*>[shardCount];
+    for (size_t idx = 0; idx < shardCount; ++idx)
+    {
+        shards[idx].store(nullptr);
+    }
+    outstandingCount = 0;
 }
 
 bool
 MetaFsIoRangeOverlapChker::IsRangeOverlapConflicted(MetaFsIoRequest* newReq)
 {
-    if (unlikely(outstandingIoMap == nullptr))
-        return false;
-
-    if (false == outstandingIoMap->IsSetBit(newReq->baseMetaLpn))
-        return false;
-
-    return true;
+    return IsLocked(newReq->baseMetaLpn);
 }
 
 void
 MetaFsIoRangeOverlapChker::FreeLockContext(uint64_t startLpn, bool isRead)
 {
-    if (unlikely(outstandingIoMap == nullptr))
+    if (unlikely(shards == nullptr))
         return;
 
     if (true != isRead)
     {
-        if (!outstandingIoMap->IsSetBit(startLpn))
+        if (!IsLocked(startLpn))
         {
             POS_TRACE_ERROR(EID(MFS_INVALID_PARAMETER),
                 "The bit is already cleared, startLpn: {}", startLpn);
             assert(false);
         }
-        outstandingIoMap->ClearBit(startLpn);
+        UnlockRange(startLpn, 1);
     }
 }
 
 void
 MetaFsIoRangeOverlapChker::PushReqToRangeLockMap(MetaFsIoRequest* newReq)
 {
-    if (likely(outstandingIoMap != nullptr))
+    if (likely(shards != nullptr))
     {
         if (newReq->reqType == MetaIoRequestType::Write)
         {
-            if (outstandingIoMap->IsSetBit(newReq->baseMetaLpn))
+            if (!TryLockRange(newReq->baseMetaLpn, 1))
             {
                 POS_TRACE_ERROR(EID(MFS_INVALID_PARAMETER),
                     "The bit is already set, baseMetaLpn: {}", newReq->baseMetaLpn);
                 assert(false);
             }
-            outstandingIoMap->SetBit(newReq->baseMetaLpn);
         }
     }
 }
 
-BitMap*
-MetaFsIoRangeOverlapChker::GetOutstandingMioMap(void)
+bool
+MetaFsIoRangeOverlapChker::TryLockRange(const MetaLpnType startLpn, const MetaLpnType count)
 {
-    return outstandingIoMap;
+    if (unlikely(shards == nullptr))
+        return true;
+
+    for (MetaLpnType lpn = startLpn; lpn < startLpn + count; ++lpn)
+    {
+        if (!_TestAndSet(lpn))
+        {
+            // somebody else owns this lpn, give back what has been taken so far
+            UnlockRange(startLpn, lpn - startLpn);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void
+MetaFsIoRangeOverlapChker::UnlockRange(const MetaLpnType startLpn, const MetaLpnType count)
+{
+    if (unlikely(shards == nullptr))
+        return;
+
+    for (MetaLpnType lpn = startLpn; lpn < startLpn + count; ++lpn)
+    {
+        _Clear(lpn);
+    }
+}
+
+bool
+MetaFsIoRangeOverlapChker::IsLocked(const MetaLpnType lpn) const
+{
+    Word* word = _GetWord(lpn);
+    if (nullptr == word)
+        return false;
+
+    return (word->load(std::memory_order_acquire) & (1ULL << (lpn % BITS_PER_WORD)));
 }
 
 uint64_t
 MetaFsIoRangeOverlapChker::GetOutstandingMioCount(void)
 {
-    return outstandingIoMap->GetNumBitsSet();
+    return outstandingCount;
+}
+
+MetaFsIoRangeOverlapChker::Word*
+MetaFsIoRangeOverlapChker::_GetWord(const MetaLpnType lpn) const
+{
+    if (unlikely((shards == nullptr) || (lpn > maxLpn)))
+        return nullptr;
+
+    Word* shard = shards[lpn / LPN_COUNT_PER_SHARD].load(std::memory_order_acquire);
+    if (nullptr == shard)
+        return nullptr;
+
+    return &shard[(lpn % LPN_COUNT_PER_SHARD) / BITS_PER_WORD];
+}
+
+MetaFsIoRangeOverlapChker::Word*
+MetaFsIoRangeOverlapChker::_GetOrCreateWord(const MetaLpnType lpn)
+{
+    Word* word = _GetWord(lpn);
+    if ((nullptr != word) || (lpn > maxLpn))
+        return word;
+
+    Word* newShard = new Word[WORDS_PER_SHARD];
+    for (uint32_t idx = 0; idx < WORDS_PER_SHARD; ++idx)
+    {
+        newShard[idx].store(0, std::memory_order_relaxed);
+    }
+
+    Word* expected = nullptr;
+    if (!shards[lpn / LPN_COUNT_PER_SHARD].compare_exchange_strong(expected, newShard,
+            std::memory_order_acq_rel))
+    {
+        // the other one has installed the shard first
+        delete[] newShard;
+    }
+
+    return _GetWord(lpn);
+}
+
+bool
+MetaFsIoRangeOverlapChker::_TestAndSet(const MetaLpnType lpn)
+{
+    Word* word = _GetOrCreateWord(lpn);
+    if (nullptr == word)
+    {
+        POS_TRACE_ERROR(EID(MFS_INVALID_PARAMETER),
+            "The lpn is out of range, lpn: {}, maxLpn: {}", lpn, maxLpn);
+        return false;
+    }
+
+    const uint64_t mask = 1ULL << (lpn % BITS_PER_WORD);
+    if (word->fetch_or(mask, std::memory_order_acq_rel) & mask)
+        return false;
+
+    outstandingCount++;
+    return true;
+}
+
+void
+MetaFsIoRangeOverlapChker::_Clear(const MetaLpnType lpn)
+{
+    Word* word = _GetWord(lpn);
+    if (nullptr == word)
+        return;
+
+    const uint64_t mask = 1ULL << (lpn % BITS_PER_WORD);
+    if (word->fetch_and(~mask, std::memory_order_acq_rel) & mask)
+        outstandingCount--;
 }
 } // namespace pos
@@ -32,29 +32,48 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "metafs_common.h"
 #include "metafs_io_request.h"
-#include "src/lib/bitmap.h"
 
 namespace pos
 {
 using MetaIoReqIdType = uint32_t;
 
+// keeps the lpns of outstanding writes with atomic test-and-set on a bitmap.
+// the bitmap is split into shards which are allocated on the first write to
+// them, so a worker only pays for the ranges it actually writes.
 class MetaFsIoRangeOverlapChker
 {
 public:
     MetaFsIoRangeOverlapChker(void);
-    MetaFsIoRangeOverlapChker(BitMap* outstandingIoMap);
     virtual ~MetaFsIoRangeOverlapChker(void);
     virtual void Init(MetaLpnType maxLpn);
 
     virtual bool IsRangeOverlapConflicted(MetaFsIoRequest* newReq);
     virtual void FreeLockContext(uint64_t startLpn, bool isRead);
     virtual void PushReqToRangeLockMap(MetaFsIoRequest* newReq);
-    virtual BitMap* GetOutstandingMioMap(void);
+    virtual bool TryLockRange(const MetaLpnType startLpn, const MetaLpnType count);
+    virtual void UnlockRange(const MetaLpnType startLpn, const MetaLpnType count);
+    virtual bool IsLocked(const MetaLpnType lpn) const;
     virtual uint64_t GetOutstandingMioCount(void);
 
+    static const MetaLpnType LPN_COUNT_PER_SHARD = 64 * 1024;
+
 private:
-    BitMap* outstandingIoMap;
+    using Word = std::atomic<uint64_t>;
+    static const uint32_t BITS_PER_WORD = 64;
+    static const uint32_t WORDS_PER_SHARD = LPN_COUNT_PER_SHARD / BITS_PER_WORD;
+
+    Word* _GetWord(const MetaLpnType lpn) const;
+    Word* _GetOrCreateWord(const MetaLpnType lpn);
+    bool _TestAndSet(const MetaLpnType lpn);
+    void _Clear(const MetaLpnType lpn);
+
+    MetaLpnType maxLpn;
+    size_t shardCount;
+    std::atomic<Word*>* shards;
+    std::atomic<uint64_t> outstandingCount;
 };
 } // namespace pos
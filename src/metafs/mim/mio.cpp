@@ -32,6 +32,7 @@
 
 #include "mio.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "meta_volume_manager.h"
@@ -55,6 +56,7 @@ Mio::Mio(MpioAllocator* mpioAllocator)
   mpioAllocator(nullptr),
   mergedRequestList(nullptr),
   fileType(MetaFileType::General),
+  outstandingMpioCount(0),
   metaStorage(nullptr),
   UNIQUE_ID(idAllocate_++)
 {
@@ -94,6 +96,7 @@ Mio::Reset(void)
     MetaAsyncRunnable<MetaAsyncCbCxt, MioState, MioStateExecuteEntry>::Init();
     fileDataChunkSize = 0;
     error = std::make_pair(0, false);
+    outstandingMpioCount = 0;
 
     if (nullptr != mergedRequestList)
     {
@@ -152,6 +155,12 @@ Mio::_HandleMpioDone(void* data)
 
     _FinalizeMpio(*mpio);
 
+    // the mio is done when the last of its mpios is done
+    if (0 != --outstandingMpioCount)
+    {
+        return;
+    }
+
     SetNextState(MioState::Complete);
     ExecuteAsyncState();
 }
@@ -303,6 +312,7 @@ Mio::_BuildMpioMap(void)
     MpioType ioType = _LookupMpioType(originReq->reqType);
 
     uint32_t mpio_cnt = 0;
+    outstandingMpioCount = originReq->GetRequestLpnCount();
     // issue Mpios
     do
     {
@@ -356,6 +366,72 @@ Mio::_BuildMpioMap(void)
     } while (remainingBytes);
 }
 
+bool
+Mio::_IsMultiPageRead(void) const
+{
+    return IsRead() && (MetaStorageType::SSD == originReq->targetMediaType) &&
+        (1 < originReq->GetRequestLpnCount());
+}
+
+// the scheduler hands a run of contiguous lpns of a read to a mio only for the ssd.
+// the run is split at stripe boundaries so that each mpio becomes a single device request.
+void
+Mio::_BuildMultiPageMpioMap(void)
+{
+    const MetaLpnType lpnCount = originReq->GetRequestLpnCount();
+    std::vector<std::pair<MetaLpnType, MetaLpnType>> runList;
+    StripeId prevStripeId = metaStorage->TranslateAddress(originReq->targetMediaType, startLpn).stripeId;
+
+    runList.push_back({startLpn, 0});
+    for (MetaLpnType lpn = startLpn; lpn < startLpn + lpnCount; ++lpn)
+    {
+        StripeId stripeId = metaStorage->TranslateAddress(originReq->targetMediaType, lpn).stripeId;
+        if (stripeId != prevStripeId)
+        {
+            runList.push_back({lpn, 0});
+            prevStripeId = stripeId;
+        }
+        runList.back().second++;
+    }
+
+    // all mpios have to be counted before the first one can be completed
+    outstandingMpioCount = runList.size();
+
+    FileSizeType remainingBytes = originReq->byteSize;
+    FileSizeType byteOffsetInChunk = originReq->byteOffsetInFile % fileDataChunkSize;
+    FileBufType curUserBuf = originReq->buf;
+    uint32_t mpio_cnt = 0;
+
+    for (auto& run : runList)
+    {
+        while (mpioAllocator->IsMultiPageReadEmpty())
+        {
+            mpioDonePoller();
+        }
+
+        FileSizeType byteSize = std::min(remainingBytes, (run.second * fileDataChunkSize) - byteOffsetInChunk);
+
+        MpioIoInfo mpioIoInfo;
+        _PrepareMpioInfo(mpioIoInfo, run.first, byteOffsetInChunk, byteSize, curUserBuf, run.second, mpio_cnt++);
+
+        Mpio* mpio = mpioAllocator->TryAllocMultiPageRead();
+        mpio->StoreTimestamp(MpioTimestampStage::Allocate);
+        mpio->Setup(mpioIoInfo, false /*partialIO*/, false /*forceSyncIO*/, metaStorage);
+        mpio->SetLocalAioCbCxt(mpioAsyncDoneCallback);
+        mpio->SetPartialDoneNotifier(partialMpioDoneNotifier);
+
+        MFS_TRACE_DEBUG(EID(MFS_DEBUG_MESSAGE),
+            "[Mpio][Alloc      ] multi-page read, req.tagId={}, mpio_id={}, lpn={}, pageCnt={}, size={}",
+            mpioIoInfo.tagId, mpioIoInfo.mpioId, run.first, run.second, byteSize);
+
+        mpio->ExecuteAsyncState();
+
+        curUserBuf = (void*)((uint8_t*)curUserBuf + byteSize);
+        remainingBytes -= byteSize;
+        byteOffsetInChunk = 0;
+    }
+}
+
 MetaLpnType
 Mio::GetStartLpn(void)
 {
@@ -392,7 +468,14 @@ bool
 Mio::Issue(MioState expNextState)
 {
     StoreTimestamp(MioTimestampStage::Issue);
-    _BuildMpioMap();
+    if (_IsMultiPageRead())
+    {
+        _BuildMultiPageMpioMap();
+    }
+    else
+    {
+        _BuildMpioMap();
+    }
     SetNextState(expNextState);
 
     return false; // not continue to execute. bottom half procedure will dispatch pending mpio
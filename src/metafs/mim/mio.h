@@ -133,6 +133,8 @@ protected:
     virtual void _InitStateHandler(void) override;
     void _BindMpioAllocator(MpioAllocator* mpioAllocator);
     void _BuildMpioMap(void);
+    void _BuildMultiPageMpioMap(void);
+    bool _IsMultiPageRead(void) const;
     void _PrepareMpioInfo(MpioIoInfo& mpioIoInfo,
         MetaLpnType lpn, FileSizeType byteOffset, FileSizeType byteSize, FileBufType buf,
         MetaLpnType lpnCnt, uint32_t mpio_id);
@@ -157,6 +159,7 @@ protected:
     MetaAsyncCbCxt aioCbCxt;
     std::vector<MetaFsIoRequest*>* mergedRequestList;
     MetaFileType fileType;
+    uint32_t outstandingMpioCount;
 
     static const MetaIoOpcode ioOpcodeMap[static_cast<uint32_t>(MetaIoRequestType::Max)];
     MetaFsSpinLock mpioListCxtLock;
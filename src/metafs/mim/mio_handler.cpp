@@ -41,6 +41,7 @@
 #include "metafs_log.h"
 #include "metafs_mutex.h"
 #include "mfs_async_runnable_template.h"
+#include "src/cpu_affinity/affinity_manager.h"
 #include "src/event_scheduler/event.h"
 #include "src/metafs/config/metafs_config_manager.h"
 #include "src/metafs/include/metafs_service.h"
@@ -66,12 +67,15 @@ MioHandler::MioHandler(const int threadId, const int coreId,
   skipCount(0),
   SAMPLING_SKIP_COUNT(configManager->GetSamplingSkipCount()),
   issueCountByStorage(),
-  issueCountByFileType()
+  issueCountByFileType(),
+  mpioExhaustedCount()
 {
     ioCQ = new MetaFsIoQ<Mio*>();
-    ioSQ = new MetaFsIoWrrQ<MetaFsIoRequest*, MetaFileType>(configManager->GetWrrWeight());
+    ioSQ = new MetaFsIoWrrQ<MetaFsIoRequest*, MetaFileType>(configManager->GetWrrWeight(),
+        configManager->GetDeadlineInUs());
 
-    mpioAllocator = new MpioAllocator(configManager);
+    mpioAllocator = new MpioAllocator(configManager, nullptr,
+        AffinityManagerSingleton::Instance()->GetNumaIdFromCoreId(coreId));
     _CreateMioPool();
 
     mioCompletionCallback = AsEntryPointParam1(&MioHandler::_HandleMioCompletion, this);
@@ -104,7 +108,8 @@ MioHandler::MioHandler(const int threadId, const int coreId,
   skipCount(0),
   SAMPLING_SKIP_COUNT(configManager->GetSamplingSkipCount()),
   issueCountByStorage(),
-  issueCountByFileType()
+  issueCountByFileType(),
+  mpioExhaustedCount()
 {
     mioCompletionCallback = AsEntryPointParam1(&MioHandler::_HandleMioCompletion, this);
 
@@ -196,6 +201,13 @@ MioHandler::_HandleIoSQ(void)
         return;
     }
 
+    // re-queue the request rather than waiting inside the mio for an mpio
+    if (_IsMpioExhausted(reqMsg))
+    {
+        EnqueueNewReq(reqMsg);
+        return;
+    }
+
     Mio* mio = DispatchMio(*reqMsg);
     if (!mio)
     {
@@ -208,6 +220,23 @@ MioHandler::_HandleIoSQ(void)
     ExecuteMio(*mio);
 }
 
+bool
+MioHandler::_IsMpioExhausted(MetaFsIoRequest* reqMsg)
+{
+    const bool isMultiPageRead = (MetaIoRequestType::Read == reqMsg->reqType) &&
+        (MetaStorageType::SSD == reqMsg->targetMediaType) &&
+        (1 < reqMsg->GetRequestLpnCount());
+    MpioType type = (MetaIoRequestType::Read == reqMsg->reqType) ? MpioType::Read : MpioType::Write;
+    bool isEmpty = isMultiPageRead ? mpioAllocator->IsMultiPageReadEmpty() : mpioAllocator->IsEmpty(type);
+    if (!isEmpty)
+    {
+        return false;
+    }
+
+    mpioExhaustedCount[(uint32_t)reqMsg->reqType]++;
+    return true;
+}
+
 void
 MioHandler::_UpdateSubmissionMetricsConditionally(const Mio& mio)
 {
@@ -264,6 +293,27 @@ MioHandler::_PublishPeriodicMetrics(void)
             metricVector->emplace_back(m);
         }
 
+        {
+            POSMetric mHit(TEL40310_METAFS_MPIO_CACHE_HIT_COUNT, POSMetricTypes::MT_GAUGE);
+            mHit.SetGaugeValue(mpioAllocator->GetCacheHitCount());
+            metricVector->emplace_back(mHit);
+
+            POSMetric mMiss(TEL40311_METAFS_MPIO_CACHE_MISS_COUNT, POSMetricTypes::MT_GAUGE);
+            mMiss.SetGaugeValue(mpioAllocator->GetCacheMissCount());
+            metricVector->emplace_back(mMiss);
+
+            mpioAllocator->ResetCacheHitCount();
+        }
+
+        for (uint32_t ioType = 0; ioType < NUM_IO_TYPE; ++ioType)
+        {
+            POSMetric m(TEL40309_METAFS_MPIO_EXHAUSTED_COUNT, POSMetricTypes::MT_GAUGE);
+            m.SetGaugeValue(mpioExhaustedCount[ioType]);
+            m.AddLabel("direction", MetaFileUtil::ConvertToDirectionName(ioType));
+            metricVector->emplace_back(m);
+            mpioExhaustedCount[ioType] = 0;
+        }
+
         for (uint32_t idx = 0; idx < NUM_STORAGE_TYPE; idx++)
         {
             for (uint32_t ioType = 0; ioType < NUM_IO_TYPE; ++ioType)
@@ -98,6 +98,7 @@ private:
     void _PublishPeriodicMetrics(void);
     void _CreateMioPool(void);
     bool _ExecutePendedIo(MetaFsIoRequest* reqMsg);
+    bool _IsMpioExhausted(MetaFsIoRequest* reqMsg);
 
     MetaFsIoWrrQ<MetaFsIoRequest*, MetaFileType>* ioSQ;
     MetaFsIoQ<Mio*>* ioCQ;
@@ -133,5 +134,6 @@ private:
 
     int64_t issueCountByStorage[NUM_STORAGE_TYPE][NUM_IO_TYPE];
     int64_t issueCountByFileType[NUM_FILE_TYPE][NUM_IO_TYPE];
+    int64_t mpioExhaustedCount[NUM_IO_TYPE];
 };
 } // namespace pos
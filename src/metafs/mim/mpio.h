@@ -96,6 +96,10 @@ public:
 
     virtual void SetPartialDoneNotifier(PartialMpioDoneCb& partialMpioDoneNotifier);
     virtual bool IsPartialIO(void) const;
+    virtual bool IsMultiPage(void) const
+    {
+        return false;
+    }
 
     virtual bool IsCacheableVolumeType(void) const
     {
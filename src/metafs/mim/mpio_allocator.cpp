@@ -35,6 +35,7 @@
 #include <vector>
 
 #include "metafs_common.h"
+#include "multi_page_read_mpio.h"
 #include "read_mpio.h"
 #include "write_mpio.h"
 #include "src/metafs/config/metafs_config_manager.h"
@@ -42,9 +43,12 @@
 
 namespace pos
 {
-MpioAllocator::MpioAllocator(MetaFsConfigManager* configManager, std::shared_ptr<FifoCache<int, MetaLpnType, Mpio*>> writeCache)
+MpioAllocator::MpioAllocator(MetaFsConfigManager* configManager,
+    std::shared_ptr<TwoQueueCache<int, MetaLpnType, Mpio*>> writeCache, const uint32_t numaId)
 : WRITE_CACHE_CAPACITY(configManager->GetWriteMpioCacheCapacity()),
-  writeCache_(writeCache)
+  writeCache_(writeCache),
+  cacheHitCount(0),
+  cacheMissCount(0)
 {
     const size_t poolSize = configManager->GetMpioPoolCapacity();
     const bool directAccessEnabled = configManager->IsDirectAccessEnabled();
@@ -60,10 +64,10 @@ MpioAllocator::MpioAllocator(MetaFsConfigManager* configManager, std::shared_ptr
     // tuple of array id, meta lpn, and mpio
     if (!writeCache_)
     {
-        writeCache_ = std::make_shared<FifoCache<int, MetaLpnType, Mpio*>>(WRITE_CACHE_CAPACITY);
+        writeCache_ = std::make_shared<TwoQueueCache<int, MetaLpnType, Mpio*>>(WRITE_CACHE_CAPACITY);
     }
 
-    mdPageBufPool = std::make_shared<MDPageBufPool>(poolSize * (uint32_t)MpioType::Max);
+    mdPageBufPool = std::make_shared<MDPageBufPool>(poolSize * (uint32_t)MpioType::Max, numaId);
     mdPageBufPool->Init();
 
     for (int idx = (int)MpioType::First; idx <= (int)MpioType::Last; ++idx)
@@ -74,9 +78,22 @@ MpioAllocator::MpioAllocator(MetaFsConfigManager* configManager, std::shared_ptr
             pool_[idx]->AddToPool(_CreateMpio((MpioType)idx, directAccessEnabled, checkingCrcWhenReading));
     }
 
+    const uint32_t multiPageCount = MULTI_PAGE_READ_MPIO_COUNT;
+    const uint32_t pagesPerMpio = MetaFsIoConfig::MAX_PAGE_COUNT_PER_MULTI_PAGE_IO;
+    multiPageBufPool = std::make_shared<MDPageBufPool>(multiPageCount, numaId, pagesPerMpio);
+    multiPageBufPool->Init();
+    multiPageReadPool_ = std::make_shared<MetaFsPool<Mpio*>>(multiPageCount);
+    for (uint32_t idx = 0; idx < multiPageCount; ++idx)
+    {
+        auto buf = multiPageBufPool->PopNewBuf();
+        assert(nullptr != buf);
+        multiPageReadPool_->AddToPool(new MultiPageReadMpio(buf, pagesPerMpio,
+            directAccessEnabled, checkingCrcWhenReading));
+    }
+
     POS_TRACE_INFO(EID(MFS_INFO_MESSAGE),
-        "Mpio allocator constructed. mpio pool size: {}, write cache size: {}",
-        poolSize, WRITE_CACHE_CAPACITY);
+        "Mpio allocator constructed. mpio pool size: {}, write cache size: {}, multi-page read mpio count: {}",
+        poolSize, WRITE_CACHE_CAPACITY, multiPageCount);
 }
 
 MpioAllocator::~MpioAllocator(void)
@@ -105,9 +122,11 @@ MpioAllocator::TryAlloc(const MpioType mpioType, const MetaStorageType storageTy
         mpio = writeCache_->Find({arrayId, lpn});
         if (nullptr != mpio)
         {
+            cacheHitCount++;
             mpio->PrintLog("[alloc-   hit]", arrayId, lpn);
             return mpio;
         }
+        cacheMissCount++;
 
         // alloc new mpio, not cached
         mpio = _TryAlloc(mpioType);
@@ -128,10 +147,27 @@ MpioAllocator::TryAlloc(const MpioType mpioType, const MetaStorageType storageTy
     return mpio;
 }
 
+Mpio*
+MpioAllocator::TryAllocMultiPageRead(void)
+{
+    if (0 == multiPageReadPool_->GetFreeCount())
+        return nullptr;
+
+    return multiPageReadPool_->TryAlloc();
+}
+
 void
 MpioAllocator::Release(Mpio* mpio)
 {
-    if (mpio->IsCached())
+    if (mpio->IsMultiPage())
+    {
+        MFS_TRACE_DEBUG(EID(MFS_DEBUG_MESSAGE),
+            "[Mpio][Release    ] multi-page read, req.tagId:{}, mpio_id:{}, pageCnt:{}",
+            mpio->io.tagId, mpio->GetId(), mpio->io.pageCnt);
+
+        multiPageReadPool_->Release(mpio);
+    }
+    else if (mpio->IsCached())
     {
         MFS_TRACE_DEBUG(EID(MFS_DEBUG_MESSAGE),
             "[Mpio][Release    ] cached mpio, not released. type:{}, req.tagId:{}, mpio_id:{}, fileOffset:{}, buffer:{}",
@@ -194,7 +230,7 @@ MpioAllocator::ReleaseAllCache(void)
 void
 MpioAllocator::_ReleaseCache(void)
 {
-    auto victim = writeCache_->PopTheOldest();
+    auto victim = writeCache_->PopVictim();
     if (!victim)
         return;
 
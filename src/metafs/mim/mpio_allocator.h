@@ -42,7 +42,7 @@
 #include "mpio.h"
 #include "os_header.h"
 #include "src/metafs/lib/metafs_pool.h"
-#include "src/metafs/common/fifo_cache.h"
+#include "src/metafs/common/two_queue_cache.h"
 
 namespace pos
 {
@@ -52,11 +52,13 @@ class MpioAllocator
 {
 public:
     explicit MpioAllocator(MetaFsConfigManager* configManager,
-        std::shared_ptr<FifoCache<int, MetaLpnType, Mpio*>> writeCache = nullptr);
+        std::shared_ptr<TwoQueueCache<int, MetaLpnType, Mpio*>> writeCache = nullptr,
+        const uint32_t numaId = MDPageBufPool::ANY_NUMA);
     virtual ~MpioAllocator(void);
 
     virtual Mpio* TryAlloc(const MpioType mpioType, const MetaStorageType storageType,
         const MetaLpnType lpn, const bool partialIO, const int arrayId);
+    virtual Mpio* TryAllocMultiPageRead(void);
     virtual void Release(Mpio* item);
     virtual size_t GetFreeCount(void) const
     {
@@ -81,6 +83,14 @@ public:
     {
         return (0 == pool_[(uint32_t)type]->GetFreeCount());
     }
+    virtual bool IsMultiPageReadEmpty(void) const
+    {
+        return (0 == multiPageReadPool_->GetFreeCount());
+    }
+    virtual size_t GetMultiPageReadFreeCount(void) const
+    {
+        return multiPageReadPool_->GetFreeCount();
+    }
     virtual void TryReleaseTheOldestCache(const bool forceReleaseCacheEntry = false);
     virtual void ReleaseAllCache(void);
     virtual size_t GetCacheSize(void) const
@@ -91,6 +101,19 @@ public:
     {
         return writeCache_->IsFull();
     }
+    virtual uint64_t GetCacheHitCount(void) const
+    {
+        return cacheHitCount;
+    }
+    virtual uint64_t GetCacheMissCount(void) const
+    {
+        return cacheMissCount;
+    }
+    virtual void ResetCacheHitCount(void)
+    {
+        cacheHitCount = 0;
+        cacheMissCount = 0;
+    }
 
 private:
     Mpio* _CreateMpio(const MpioType type, const bool directAccessEnabled, const bool checkingCrcWhenReading);
@@ -100,6 +123,13 @@ private:
     const size_t WRITE_CACHE_CAPACITY;
     std::shared_ptr<MDPageBufPool> mdPageBufPool;
     std::array<std::shared_ptr<MetaFsPool<Mpio*>>, (uint32_t)MpioType::Max> pool_;
-    std::shared_ptr<FifoCache<int, MetaLpnType, Mpio*>> writeCache_;
+    std::shared_ptr<MDPageBufPool> multiPageBufPool;
+    std::shared_ptr<MetaFsPool<Mpio*>> multiPageReadPool_;
+    std::shared_ptr<TwoQueueCache<int, MetaLpnType, Mpio*>> writeCache_;
+    uint64_t cacheHitCount;
+    uint64_t cacheMissCount;
+
+    // 16 * 128K, a few of them are enough to keep the ssd busy
+    static const uint32_t MULTI_PAGE_READ_MPIO_COUNT = 16;
 };
 } // namespace pos
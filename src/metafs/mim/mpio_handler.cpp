@@ -64,7 +64,8 @@ MpioHandler::MpioHandler(const int threadId, const int coreId,
         "threadId={}, coreId={}", threadId, coreId);
 
     if (nullptr == doneQ)
-        partialMpioDoneQ = new MetaFsIoWrrQ<Mpio*, MetaFileType>(configManager->GetWrrWeight());
+        partialMpioDoneQ = new MetaFsIoWrrQ<Mpio*, MetaFileType>(configManager->GetWrrWeight(),
+            configManager->GetDeadlineInUs());
 }
 
 MpioHandler::~MpioHandler(void)
@@ -69,7 +69,7 @@ public:
     MetaLpnType metaLpn;
     FileSizeType startByteOffset;
     FileSizeType byteSize;
-    MetaLpnType pageCnt; // should be 1 since currently we only supports 4KB considering IO Parallelism for 4KB IO
+    MetaLpnType pageCnt; // 1 except for MultiPageReadMpio which reads a run of lpns at once
     int arrayId;
     void* userBuf;
     uint64_t signature;
@@ -0,0 +1,149 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "multi_page_read_mpio.h"
+
+#include <algorithm>
+
+namespace pos
+{
+MultiPageReadMpio::MultiPageReadMpio(void* mdPageBuf, const uint32_t maxPageCount,
+    const bool directAccessEnabled, const bool checkingCrcWhenReading)
+: ReadMpio(mdPageBuf, directAccessEnabled, checkingCrcWhenReading),
+  MAX_PAGE_COUNT(maxPageCount),
+  CHECKING_CRC_WHEN_READING(checkingCrcWhenReading)
+{
+    for (uint32_t idx = 0; idx < MAX_PAGE_COUNT; ++idx)
+    {
+        pages.push_back(new MDPage((uint8_t*)mdPageBuf + (idx * MetaFsIoConfig::META_PAGE_SIZE_IN_BYTES)));
+    }
+}
+
+// LCOV_EXCL_START
+MultiPageReadMpio::~MultiPageReadMpio(void)
+{
+    for (auto page : pages)
+    {
+        delete page;
+    }
+    pages.clear();
+}
+// LCOV_EXCL_STOP
+
+void
+MultiPageReadMpio::Reset(void)
+{
+    Mpio::Reset();
+
+    for (auto page : pages)
+    {
+        page->ClearControlInfo();
+    }
+}
+
+void
+MultiPageReadMpio::Setup(MpioIoInfo& mpioIoInfo, bool partialIO, bool forceSyncIO,
+    MetaStorageSubsystem* metaStorage)
+{
+    if ((0 == mpioIoInfo.pageCnt) || (MAX_PAGE_COUNT < mpioIoInfo.pageCnt))
+    {
+        POS_TRACE_ERROR(EID(MFS_INVALID_PARAMETER),
+            "The page count is out of range, pageCnt: {}, max: {}",
+            mpioIoInfo.pageCnt, MAX_PAGE_COUNT);
+        assert(false);
+    }
+
+    Mpio::Setup(mpioIoInfo, partialIO, forceSyncIO, metaStorage);
+}
+
+bool
+MultiPageReadMpio::DoE2ECheck(const MpAioState expNextState)
+{
+    SetNextState(expNextState);
+
+    for (uint32_t idx = 0; idx < io.pageCnt; ++idx)
+    {
+        MDPage* page = pages[idx];
+        MetaLpnType lpn = io.metaLpn + idx;
+        page->AttachControlInfo();
+
+        if (page->IsValidSignature(io.signature))
+        {
+            if (page->CheckDataIntegrity(lpn, io.targetFD, !CHECKING_CRC_WHEN_READING))
+            {
+                SetNextState(MpAioState::Error);
+                POS_TRACE_ERROR(EID(MFS_FAILED_TO_CHECK_INTEGRITY),
+                    "[Mpio][DoE2ECheck ] E2E Check fail!, arrayId={}, mediaType={}, lpn={}",
+                    io.arrayId, (int)io.targetMediaType, lpn);
+                break;
+            }
+        }
+        else
+        {
+            MFS_TRACE_DEBUG(EID(MFS_DEBUG_MESSAGE),
+                "[Mpio][DoE2ECheck ] Read data will be cleared due to invalid data, arrayId={}, mediaType={}, lpn={}",
+                io.arrayId, (int)io.targetMediaType, lpn);
+
+            memset(page->GetDataBuffer(), 0x0, page->GetDefaultDataChunkSize());
+        }
+    }
+
+    return true;
+}
+
+bool
+MultiPageReadMpio::_CopyToUserBuf(void)
+{
+    uint8_t* userBuf = (uint8_t*)io.userBuf;
+    FileSizeType byteOffset = io.startByteOffset;
+    FileSizeType remainingBytes = io.byteSize;
+
+    MFS_TRACE_DEBUG(EID(MFS_DEBUG_MESSAGE),
+        "[Mpio][CopyDat2Buf] Copy R data to user buf req.tagId={}, mpio_id={}, offsetInChunk={}, size={}, pageCnt={}",
+        io.tagId, io.mpioId, byteOffset, remainingBytes, io.pageCnt);
+
+    // the control info at the end of each page is not a part of the file data
+    for (uint32_t idx = 0; (idx < io.pageCnt) && remainingBytes; ++idx)
+    {
+        MDPage* page = pages[idx];
+        FileSizeType byteSize = std::min(remainingBytes, page->GetDefaultDataChunkSize() - byteOffset);
+
+        memcpy(userBuf, page->GetDataBuffer() + byteOffset, byteSize);
+
+        userBuf += byteSize;
+        remainingBytes -= byteSize;
+        byteOffset = 0;
+    }
+
+    return true;
+}
+} // namespace pos
@@ -0,0 +1,70 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "read_mpio.h"
+
+namespace pos
+{
+// reads a run of contiguous lpns within a stripe with a single device request
+class MultiPageReadMpio : public ReadMpio
+{
+public:
+    explicit MultiPageReadMpio(void* mdPageBuf, const uint32_t maxPageCount,
+        const bool directAccessEnabled, const bool checkingCrcWhenReading);
+    virtual ~MultiPageReadMpio(void);
+
+    virtual void Reset(void) override;
+    virtual void Setup(MpioIoInfo& mpioIoInfo, bool partialIO, bool forceSyncIO,
+        MetaStorageSubsystem* metaStorage) override;
+    virtual bool IsMultiPage(void) const override
+    {
+        return true;
+    }
+    virtual uint32_t GetMaxPageCount(void) const
+    {
+        return MAX_PAGE_COUNT;
+    }
+    virtual bool DoE2ECheck(const MpAioState expNextState) override;
+
+protected:
+    virtual bool _CopyToUserBuf(void) override;
+
+private:
+    const uint32_t MAX_PAGE_COUNT;
+    const bool CHECKING_CRC_WHEN_READING;
+    std::vector<MDPage*> pages;
+};
+} // namespace pos
@@ -51,10 +51,10 @@ protected:
     virtual void _InitStateHandler(void) override;
     bool _HandleError(MpAioState expNextState);
     bool _CompleteIO(MpAioState expNextState);
+    virtual bool _CopyToUserBuf(void);
 
 private:
     bool _Init(MpAioState expNextState);
     bool _MakeReady(MpAioState expNextState);
-    bool _CopyToUserBuf(void);
 };
 } // namespace pos
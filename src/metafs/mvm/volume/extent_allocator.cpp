@@ -78,23 +78,10 @@ ExtentAllocator::AllocExtents(MetaLpnType lpnCnt)
 
     if (availableLpnCount >= newLpnCnt)
     {
-        MetaLpnType remainedCnt = newLpnCnt;
-
-        for (auto item = freeList.begin(); item != freeList.end() && remainedCnt != 0; )
+        // a file in one extent lets the sequential io stay in the extent
+        if (!_AllocBestFitExtent(newLpnCnt, result))
         {
-            if ((*item).GetCount() <= remainedCnt)
-            {
-                remainedCnt -= (*item).GetCount();
-                result.push_back(*item);
-                item = freeList.erase(item);
-            }
-            else
-            {
-                (*item).SetCount((*item).GetCount() - remainedCnt);
-                result.push_back({ (*item).GetStartLpn(), remainedCnt });
-                (*item).SetStartLpn((*item).GetStartLpn() + remainedCnt);
-                remainedCnt = 0;
-            }
+            _AllocFromLargestExtents(newLpnCnt, result);
         }
 
         _SortAndCalcAvailable(false, newLpnCnt);
@@ -330,10 +317,105 @@ ExtentAllocator::AddToFreeList(MetaLpnType _start, MetaLpnType _count)
     return result;
 }
 
+bool
+ExtentAllocator::_AllocBestFitExtent(const MetaLpnType lpnCnt, std::vector<MetaFileExtent>& result)
+{
+    auto bestFit = freeList.end();
+
+    // the smallest free extent that can hold all of the lpns
+    for (auto item = freeList.begin(); item != freeList.end(); ++item)
+    {
+        if ((item->GetCount() >= lpnCnt) &&
+            ((bestFit == freeList.end()) || (item->GetCount() < bestFit->GetCount())))
+        {
+            bestFit = item;
+        }
+    }
+
+    if (bestFit == freeList.end())
+    {
+        return false;
+    }
+
+    result.push_back({ bestFit->GetStartLpn(), lpnCnt });
+
+    if (bestFit->GetCount() == lpnCnt)
+    {
+        freeList.erase(bestFit);
+    }
+    else
+    {
+        bestFit->SetStartLpn(bestFit->GetStartLpn() + lpnCnt);
+        bestFit->SetCount(bestFit->GetCount() - lpnCnt);
+    }
+
+    return true;
+}
+
+void
+ExtentAllocator::_AllocFromLargestExtents(const MetaLpnType lpnCnt, std::vector<MetaFileExtent>& result)
+{
+    // taking the largest extents first keeps the extent count of the file small
+    std::vector<MetaFileExtent> candidates(freeList.begin(), freeList.end());
+    std::stable_sort(candidates.begin(), candidates.end(),
+        [](const MetaFileExtent& a, const MetaFileExtent& b) {
+            return a.GetCount() > b.GetCount();
+        });
+
+    MetaLpnType remainedCnt = lpnCnt;
+    freeList.clear();
+
+    for (auto& extent : candidates)
+    {
+        if (0 == remainedCnt)
+        {
+            freeList.push_back(extent);
+        }
+        else if (extent.GetCount() <= remainedCnt)
+        {
+            remainedCnt -= extent.GetCount();
+            result.push_back(extent);
+        }
+        else
+        {
+            result.push_back({ extent.GetStartLpn(), remainedCnt });
+            freeList.push_back({ extent.GetStartLpn() + remainedCnt, extent.GetCount() - remainedCnt });
+            remainedCnt = 0;
+        }
+    }
+}
+
+void
+ExtentAllocator::_MergeAdjacentFreeExtents(void)
+{
+    if (freeList.size() < 2)
+    {
+        return;
+    }
+
+    // the free list has been sorted by the start lpn
+    auto prev = freeList.begin();
+    for (auto iter = prev + 1; iter != freeList.end(); )
+    {
+        if (prev->GetLast() + 1 == iter->GetStartLpn())
+        {
+            prev->SetCount(prev->GetCount() + iter->GetCount());
+            iter = freeList.erase(iter);
+            prev = iter - 1;
+        }
+        else
+        {
+            prev = iter;
+            ++iter;
+        }
+    }
+}
+
 void
 ExtentAllocator::_SortAndCalcAvailable(bool needToAdd, MetaLpnType size)
 {
     std::sort(freeList.begin(), freeList.end());
+    _MergeAdjacentFreeExtents();
     if (needToAdd)
         availableLpnCount += size;
     else
@@ -65,6 +65,9 @@ public:
 
 protected:
     void _SortAndCalcAvailable(bool needToAdd, MetaLpnType size);
+    bool _AllocBestFitExtent(const MetaLpnType lpnCnt, std::vector<MetaFileExtent>& result);
+    void _AllocFromLargestExtents(const MetaLpnType lpnCnt, std::vector<MetaFileExtent>& result);
+    void _MergeAdjacentFreeExtents(void);
     bool _RemoveFreeRange(MetaLpnType _start, MetaLpnType _count);
 
     MetaLpnType fileRegionBaseLpnInVolume;
@@ -0,0 +1,401 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mss_on_file.h"
+
+#include <fcntl.h>
+#include <linux/falloc.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "src/metafs/config/metafs_config.h"
+#include "src/metafs/log/metafs_log.h"
+
+namespace pos
+{
+MssOnFile::MssOnFile(const int arrayId, const std::string& basePath)
+: MetaStorageSubsystem(arrayId),
+  BASE_PATH(basePath),
+  fds((int)MetaStorageType::Max, -1),
+  capacity((int)MetaStorageType::Max, 0),
+  ioContext(0),
+  reaper(nullptr),
+  reaperRunning(false),
+  outstandingCount(0)
+{
+}
+
+MssOnFile::~MssOnFile(void)
+{
+    Close();
+}
+
+std::string
+MssOnFile::GetFilePath(const MetaStorageType mediaType) const
+{
+    return BASE_PATH + "/meta_store_" + std::to_string(arrayId) + "_" +
+        std::to_string((int)mediaType);
+}
+
+POS_EVENT_ID
+MssOnFile::CreateMetaStore(const int arrayId, const MetaStorageType mediaType,
+    const uint64_t capacity, const bool formatFlag)
+{
+    if (capacity % MetaFsIoConfig::META_PAGE_SIZE_IN_BYTES)
+    {
+        POS_TRACE_ERROR(EID(MFS_INVALID_PARAMETER),
+            "The capacity should be aligned to 4kb, capacity: {}", capacity);
+        return EID(MFS_INVALID_PARAMETER);
+    }
+
+    const int index = (int)mediaType;
+    if (fds[index] < 0)
+    {
+        const std::string path = GetFilePath(mediaType);
+        int fd = open(path.c_str(), O_RDWR | O_CREAT | O_DIRECT, 0644);
+        if ((fd < 0) && (EINVAL == errno))
+        {
+            // some filesystems such as tmpfs do not support direct io
+            fd = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        }
+        if (fd < 0)
+        {
+            POS_TRACE_ERROR(EID(MFS_ERROR_MESSAGE),
+                "Failed to open the meta store, path: {}, errno: {}", path, errno);
+            return EID(MFS_ERROR_MESSAGE);
+        }
+
+        // block devices already have their size, only grow regular files
+        struct stat st;
+        if ((0 == fstat(fd, &st)) && S_ISREG(st.st_mode) && ((uint64_t)st.st_size < capacity))
+        {
+            if (0 != ftruncate(fd, capacity))
+            {
+                POS_TRACE_ERROR(EID(MFS_ERROR_MESSAGE),
+                    "Failed to resize the meta store, path: {}, errno: {}", path, errno);
+                close(fd);
+                return EID(MFS_ERROR_MESSAGE);
+            }
+        }
+
+        fds[index] = fd;
+        this->capacity[index] = capacity;
+
+        POS_TRACE_INFO(EID(MFS_INFO_MESSAGE),
+            "Meta store on file is created, path: {}, capacity: {}", path, capacity);
+    }
+
+    if (formatFlag)
+    {
+        TrimFileData(mediaType, 0, nullptr, capacity / MetaFsIoConfig::META_PAGE_SIZE_IN_BYTES);
+    }
+
+    return Open();
+}
+
+POS_EVENT_ID
+MssOnFile::Open(void)
+{
+    if (!reaperRunning)
+    {
+        int ret = io_setup(QUEUE_DEPTH, &ioContext);
+        if (ret < 0)
+        {
+            POS_TRACE_ERROR(EID(MFS_ERROR_MESSAGE),
+                "Failed to set up an aio context, ret: {}", ret);
+            return EID(MFS_ERROR_MESSAGE);
+        }
+        _StartReaper();
+    }
+
+    return EID(SUCCESS);
+}
+
+POS_EVENT_ID
+MssOnFile::Close(void)
+{
+    if (reaperRunning)
+    {
+        // let the pending pages finish before the context goes away
+        while (outstandingCount)
+        {
+            usleep(1);
+        }
+        _StopReaper();
+        io_destroy(ioContext);
+        ioContext = 0;
+    }
+
+    for (auto& fd : fds)
+    {
+        if (fd >= 0)
+        {
+            fsync(fd);
+            close(fd);
+            fd = -1;
+        }
+    }
+
+    return EID(SUCCESS);
+}
+
+uint64_t
+MssOnFile::GetCapacity(const MetaStorageType mediaType)
+{
+    return capacity[(int)mediaType];
+}
+
+POS_EVENT_ID
+MssOnFile::ReadPage(const MetaStorageType mediaType, const MetaLpnType pageNumber,
+    void* buffer, const MetaLpnType numPages)
+{
+    return _DoSyncIO(true, mediaType, pageNumber, buffer, numPages);
+}
+
+POS_EVENT_ID
+MssOnFile::WritePage(const MetaStorageType mediaType, const MetaLpnType pageNumber,
+    void* buffer, const MetaLpnType numPages)
+{
+    return _DoSyncIO(false, mediaType, pageNumber, buffer, numPages);
+}
+
+POS_EVENT_ID
+MssOnFile::ReadPageAsync(MssAioCbCxt* ctx)
+{
+    return _SubmitAsync(true, ctx);
+}
+
+POS_EVENT_ID
+MssOnFile::WritePageAsync(MssAioCbCxt* ctx)
+{
+    return _SubmitAsync(false, ctx);
+}
+
+POS_EVENT_ID
+MssOnFile::TrimFileData(const MetaStorageType mediaType, const MetaLpnType startLpn,
+    void* buffer, const MetaLpnType numPages)
+{
+    if (!_IsValidRange(mediaType, startLpn, numPages))
+    {
+        return EID(MFS_INVALID_PARAMETER);
+    }
+
+    const off_t offset = startLpn * MetaFsIoConfig::META_PAGE_SIZE_IN_BYTES;
+    const off_t length = numPages * MetaFsIoConfig::META_PAGE_SIZE_IN_BYTES;
+    if (0 == fallocate(fds[(int)mediaType], FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, offset, length))
+    {
+        return EID(SUCCESS);
+    }
+
+    // punching a hole is not supported by every device, write zeroes instead
+    void* zero = nullptr;
+    if (0 != posix_memalign(&zero, MetaFsIoConfig::META_PAGE_SIZE_IN_BYTES, MetaFsIoConfig::META_PAGE_SIZE_IN_BYTES))
+    {
+        return EID(MFS_ERROR_MESSAGE);
+    }
+    memset(zero, 0, MetaFsIoConfig::META_PAGE_SIZE_IN_BYTES);
+
+    POS_EVENT_ID result = EID(SUCCESS);
+    for (MetaLpnType lpn = startLpn; lpn < startLpn + numPages; ++lpn)
+    {
+        result = _DoSyncIO(false, mediaType, lpn, zero, 1);
+        if (EID(SUCCESS) != result)
+        {
+            break;
+        }
+    }
+    free(zero);
+
+    return result;
+}
+
+LogicalBlkAddr
+MssOnFile::TranslateAddress(const MetaStorageType type, const MetaLpnType theLpn)
+{
+    // a file has no stripe, so a multi-pages io never needs to be split
+    LogicalBlkAddr addr;
+    addr.stripeId = 0;
+    addr.offset = theLpn;
+    return addr;
+}
+
+bool
+MssOnFile::_IsValidRange(const MetaStorageType mediaType, const MetaLpnType startLpn,
+    const MetaLpnType numPages) const
+{
+    const int index = (int)mediaType;
+    const uint64_t totalPages = capacity[index] / MetaFsIoConfig::META_PAGE_SIZE_IN_BYTES;
+
+    if ((fds[index] < 0) || (startLpn + numPages > totalPages))
+    {
+        MFS_TRACE_ERROR(EID(MFS_INVALID_PARAMETER),
+            "Out of boundary: mediaType={}, startLpn={}, numPages={}, totalPages={}",
+            index, startLpn, numPages, totalPages);
+        return false;
+    }
+
+    return true;
+}
+
+POS_EVENT_ID
+MssOnFile::_DoSyncIO(const bool isRead, const MetaStorageType mediaType,
+    const MetaLpnType startLpn, void* buffer, const MetaLpnType numPages)
+{
+    if (!_IsValidRange(mediaType, startLpn, numPages))
+    {
+        return EID(MFS_INVALID_PARAMETER);
+    }
+
+    const int fd = fds[(int)mediaType];
+    uint8_t* buf = static_cast<uint8_t*>(buffer);
+    off_t offset = startLpn * MetaFsIoConfig::META_PAGE_SIZE_IN_BYTES;
+    size_t remaining = numPages * MetaFsIoConfig::META_PAGE_SIZE_IN_BYTES;
+
+    while (remaining)
+    {
+        ssize_t done = isRead ? pread(fd, buf, remaining, offset) : pwrite(fd, buf, remaining, offset);
+        if (done <= 0)
+        {
+            if ((done < 0) && (EINTR == errno))
+            {
+                continue;
+            }
+            POS_TRACE_ERROR(EID(MFS_IO_FAILED_DUE_TO_ERROR),
+                "Sync io has been failed, isRead: {}, offset: {}, errno: {}", isRead, offset, errno);
+            return EID(MFS_IO_FAILED_DUE_TO_ERROR);
+        }
+        buf += done;
+        offset += done;
+        remaining -= done;
+    }
+
+    return EID(SUCCESS);
+}
+
+POS_EVENT_ID
+MssOnFile::_SubmitAsync(const bool isRead, MssAioCbCxt* ctx)
+{
+    MssAioData* aioData = ctx->GetIoContext();
+    const MetaStorageType mediaType = aioData->GetStorageType();
+    const MetaLpnType startLpn = aioData->GetMetaLpn();
+    const MetaLpnType numPages = aioData->GetLpnCount();
+
+    if (!_IsValidRange(mediaType, startLpn, numPages))
+    {
+        return EID(MFS_INVALID_PARAMETER);
+    }
+
+    struct iocb* cb = new struct iocb;
+    const size_t size = numPages * MetaFsIoConfig::META_PAGE_SIZE_IN_BYTES;
+    const long long offset = startLpn * MetaFsIoConfig::META_PAGE_SIZE_IN_BYTES;
+    if (isRead)
+    {
+        io_prep_pread(cb, fds[(int)mediaType], aioData->GetBuffer(), size, offset);
+    }
+    else
+    {
+        io_prep_pwrite(cb, fds[(int)mediaType], aioData->GetBuffer(), size, offset);
+    }
+    cb->data = ctx;
+
+    outstandingCount++;
+
+    int ret = 0;
+    do
+    {
+        // the queue can be full for a moment, the reaper will make room
+        ret = io_submit(ioContext, 1, &cb);
+    } while (-EAGAIN == ret);
+
+    if (1 != ret)
+    {
+        outstandingCount--;
+        delete cb;
+        POS_TRACE_ERROR(EID(MFS_IO_FAILED_DUE_TO_ERROR),
+            "Failed to submit an aio, ret: {}, lpn: {}, pageCnt: {}", ret, startLpn, numPages);
+        return EID(MFS_IO_FAILED_DUE_TO_ERROR);
+    }
+
+    return EID(SUCCESS);
+}
+
+void
+MssOnFile::_ReapCompletions(void)
+{
+    struct io_event events[QUEUE_DEPTH];
+    struct timespec timeout = {0, 1000000}; // 1ms
+
+    while (reaperRunning)
+    {
+        int count = io_getevents(ioContext, 1, QUEUE_DEPTH, events, &timeout);
+        for (int idx = 0; idx < count; ++idx)
+        {
+            struct iocb* cb = events[idx].obj;
+            MssAioCbCxt* ctx = static_cast<MssAioCbCxt*>(events[idx].data);
+            const bool failed = (events[idx].res != cb->u.c.nbytes);
+
+            if (failed)
+            {
+                POS_TRACE_ERROR(EID(MFS_IO_FAILED_DUE_TO_ERROR),
+                    "Aio has been failed, res: {}, expected: {}", (long)events[idx].res, cb->u.c.nbytes);
+            }
+
+            delete cb;
+            ctx->SaveIOStatus(failed ? 1 : 0);
+            ctx->InvokeCallback();
+            outstandingCount--;
+        }
+    }
+}
+
+void
+MssOnFile::_StartReaper(void)
+{
+    reaperRunning = true;
+    reaper = new std::thread(&MssOnFile::_ReapCompletions, this);
+}
+
+void
+MssOnFile::_StopReaper(void)
+{
+    reaperRunning = false;
+    if (reaper)
+    {
+        reaper->join();
+        delete reaper;
+        reaper = nullptr;
+    }
+}
+} // namespace pos
@@ -0,0 +1,98 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <libaio.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "src/metafs/storage/mss.h"
+
+namespace pos
+{
+// meta storage on plain files or kernel block devices, for the setups
+// without spdk such as offline tools and test rigs.
+// async pages are submitted with linux native aio and reaped by a thread.
+class MssOnFile : public MetaStorageSubsystem
+{
+public:
+    MssOnFile(void) = delete;
+    MssOnFile(const int arrayId, const std::string& basePath);
+    virtual ~MssOnFile(void);
+
+    virtual POS_EVENT_ID CreateMetaStore(const int arrayId, const MetaStorageType mediaType,
+        const uint64_t capacity, const bool formatFlag = false) override;
+    virtual POS_EVENT_ID Open(void) override;
+    virtual POS_EVENT_ID Close(void) override;
+    virtual uint64_t GetCapacity(const MetaStorageType mediaType) override;
+    virtual POS_EVENT_ID ReadPage(const MetaStorageType mediaType, const MetaLpnType pageNumber,
+        void* buffer, const MetaLpnType numPages) override;
+    virtual POS_EVENT_ID WritePage(const MetaStorageType mediaType, const MetaLpnType pageNumber,
+        void* buffer, const MetaLpnType numPages) override;
+    virtual bool IsAIOSupport(void) override
+    {
+        return true;
+    }
+    virtual POS_EVENT_ID ReadPageAsync(MssAioCbCxt* ctx) override;
+    virtual POS_EVENT_ID WritePageAsync(MssAioCbCxt* ctx) override;
+
+    virtual POS_EVENT_ID TrimFileData(const MetaStorageType mediaType, const MetaLpnType startLpn,
+        void* buffer, const MetaLpnType numPages) override;
+    virtual LogicalBlkAddr TranslateAddress(const MetaStorageType type, const MetaLpnType theLpn) override;
+
+    virtual std::string GetFilePath(const MetaStorageType mediaType) const;
+
+    static const uint32_t QUEUE_DEPTH = 128;
+
+private:
+    bool _IsValidRange(const MetaStorageType mediaType, const MetaLpnType startLpn,
+        const MetaLpnType numPages) const;
+    POS_EVENT_ID _DoSyncIO(const bool isRead, const MetaStorageType mediaType,
+        const MetaLpnType startLpn, void* buffer, const MetaLpnType numPages);
+    POS_EVENT_ID _SubmitAsync(const bool isRead, MssAioCbCxt* ctx);
+    void _ReapCompletions(void);
+    void _StartReaper(void);
+    void _StopReaper(void);
+
+    const std::string BASE_PATH;
+    std::vector<int> fds;
+    std::vector<uint64_t> capacity;
+    io_context_t ioContext;
+    std::thread* reaper;
+    std::atomic<bool> reaperRunning;
+    std::atomic<uint64_t> outstandingCount;
+};
+} // namespace pos
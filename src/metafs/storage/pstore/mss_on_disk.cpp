@@ -37,6 +37,7 @@
 #include <utility>
 
 #include "src/include/array_config.h"
+#include "src/io/general_io/write_amplification_monitor_service.h"
 #include "src/metafs/config/metafs_config.h"
 #include "src/metafs/log/metafs_log.h"
 #include "src/metafs/storage/pstore/issue_write_event.h"
@@ -271,6 +272,7 @@ POS_EVENT_ID
 MssOnDisk::WritePage(const MetaStorageType mediaType, const MetaLpnType pageNumber,
     void* buffer, const MetaLpnType numPages)
 {
+    _AddWrittenBytes(mediaType, numPages);
     return _SendSyncRequest(IODirection::WRITE, mediaType, pageNumber, numPages, buffer);
 }
 
@@ -316,23 +318,24 @@ MssOnDisk::_SendAsyncRequest(const IODirection direction, MssAioCbCxt* cb, Callb
 
     _AdjustPageIoToFitTargetPartition(mediaType, startLpn, requestLpnCount);
 
-    if (requestLpnCount != 1)
-    {
-        // TODO (munseop.lim): need to support multi-pages IO
-        POS_TRACE_ERROR(EID(MFS_ERROR_MESSAGE),
-            "MetaFs does not support multi-pages IO.");
-        assert(false);
-    }
-
     MssDiskPlace* storagelld = mssDiskPlace[(int)mediaType];
 
-    BufferEntry buffEntry(buffer, 1 /*4KB*/);
-    std::list<BufferEntry> bufferList;
-    bufferList.push_back(buffEntry);
-
     pos::LogicalBlkAddr blkAddr =
         storagelld->CalculateOnDiskAddress(startLpn); // get physical address
 
+    // a multi-pages io is submitted at once, so it must not cross the stripe
+    if ((requestLpnCount == 0) ||
+        (blkAddr.offset + requestLpnCount > storagelld->GetMaxLpnCntPerIOSubmit()))
+    {
+        POS_TRACE_ERROR(EID(MFS_ERROR_MESSAGE),
+            "MetaFs does not support multi-pages IO across stripes, startLpn:{}, lpnCount:{}",
+            startLpn, requestLpnCount);
+        return EID(MFS_INVALID_PARAMETER);
+    }
+
+    std::list<BufferEntry> bufferList =
+        _GetBufferList(mediaType, blkAddr.offset, requestLpnCount, static_cast<uint8_t*>(buffer));
+
     MFS_TRACE_DEBUG(EID(MFS_DEBUG_MESSAGE),
         "[MssDisk][SendReq ] type:{}, req.tagId:{}, mpio_id:{}, stripe:{}, offsetInDisk:{}, buf[0]:{}",
         (int)direction, aioData->GetTagId(), aioData->GetMpioId(),
@@ -433,6 +436,7 @@ MssOnDisk::WritePageAsync(MssAioCbCxt* ctx)
 {
     MssAioData* aioData = reinterpret_cast<MssAioData*>(ctx->GetAsycCbCxt());
     CallbackSmartPtr callback = _CreateCompletionCallback(ctx);
+    _AddWrittenBytes(aioData->GetStorageType(), aioData->GetLpnCount());
 
     if (aioData->GetStorageType() == MetaStorageType::SSD)
     {
@@ -445,6 +449,17 @@ MssOnDisk::WritePageAsync(MssAioCbCxt* ctx)
     }
 }
 
+void
+MssOnDisk::_AddWrittenBytes(const MetaStorageType mediaType, const MetaLpnType numPages) const
+{
+    // nvram does not wear, so only the pages written to the ssds count
+    if (mediaType != MetaStorageType::NVRAM)
+    {
+        WriteAmplificationMonitorServiceSingleton::Instance()->Add(arrayId,
+            WriteSource::Meta, numPages * MetaFsIoConfig::META_PAGE_SIZE_IN_BYTES);
+    }
+}
+
 POS_EVENT_ID
 MssOnDisk::TrimFileData(const MetaStorageType mediaType, const MetaLpnType pageNumber,
     void* buffer, const MetaLpnType numPages)
@@ -97,6 +97,7 @@ private:
         CallbackSmartPtr callback, const int arrayId, const bool waitUntilSuccessToSubmit) const;
     void _SubmitToEventHandler(MssAioCbCxt* ctx, CallbackSmartPtr callback);
     CallbackSmartPtr _CreateCompletionCallback(MssAioCbCxt* ctx) const;
+    void _AddWrittenBytes(const MetaStorageType mediaType, const MetaLpnType numPages) const;
     bool _IsRequestToJournal(const MetaStorageType mediaType) const
     {
         return (mediaType != MetaStorageType::SSD) ? true : false;
@@ -60,7 +60,9 @@ int
 Nvmf::Init(void)
 {
     unvmf_io_handler handler = {.submit = UNVMfSubmitHandler,
-        .complete = UNVMfCompleteHandler};
+        .complete = UNVMfCompleteHandler,
+        .zcopy_get_buf = UNVMfZcopyGetBufHandler,
+        .zcopy_put_buf = UNVMfZcopyPutBufHandler};
     SetuNVMfIOHandler(handler);
 
     volume = new NvmfVolumePos(ioHandler);
@@ -100,6 +102,8 @@ Nvmf::SetuNVMfIOHandler(unvmf_io_handler handler)
     }
     ioHandler.submit = handler.submit;
     ioHandler.complete = handler.complete;
+    ioHandler.zcopy_get_buf = handler.zcopy_get_buf;
+    ioHandler.zcopy_put_buf = handler.zcopy_put_buf;
 }
 
 void
@@ -261,4 +265,19 @@ Nvmf::VolumeDetached(vector<int> volList, VolumeArrayInfo* volArrayInfo)
     return EID(VOL_EVENT_FAIL);
 }
 
+int
+Nvmf::VolumeResized(VolumeEventBase* volEventBase, VolumeArrayInfo* volArrayInfo)
+{
+    struct pos_volume_info* vInfo = new pos_volume_info;
+    if (vInfo)
+    {
+        _CopyVolumeEventBase(vInfo, volEventBase);
+        _CopyVolumeArrayInfo(vInfo, volArrayInfo);
+
+        volume->VolumeResized(vInfo);
+        return EID(VOL_EVENT_OK);
+    }
+    return EID(VOL_EVENT_FAIL);
+}
+
 } // namespace pos
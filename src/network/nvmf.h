@@ -65,13 +65,14 @@ public:
     int VolumeLoaded(VolumeEventBase* volEventBase, VolumeEventPerf* volEventPerf, VolumeArrayInfo* volArrayInfo) override;
     int VolumeUpdated(VolumeEventBase* volEventBase, VolumeEventPerf* volEventPerf, VolumeArrayInfo* volArrayInfo) override;
     int VolumeDetached(vector<int> volList, VolumeArrayInfo* volArrayInfo) override;
+    int VolumeResized(VolumeEventBase* volEventBase, VolumeArrayInfo* volArrayInfo) override;
 
 private:
     NvmfVolumePos* volume;
     VolumeEventPublisher* volumeEventPublisher;
     const uint32_t MIB_IN_BYTE = 1024 * 1024;
     const uint32_t KIOPS = 1000;
-    unvmf_io_handler ioHandler = {nullptr, nullptr};
+    unvmf_io_handler ioHandler = {nullptr, nullptr, nullptr, nullptr};
 
     void _CopyVolumeInfo(char* destInfo, const char* srcInfo, int len);
     void _CopyVolumeEventBase(pos_volume_info* vInfo, VolumeEventBase* volEventBase);
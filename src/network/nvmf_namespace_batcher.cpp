@@ -0,0 +1,262 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/network/nvmf_namespace_batcher.h"
+
+#include <algorithm>
+
+#include "spdk/log.h"
+#include "spdk/nvme_spec.h"
+#include "src/network/nvmf_target.h"
+#include "src/spdk_wrapper/caller/spdk_nvmf_caller.h"
+#include "src/spdk_wrapper/event_framework_api.h"
+
+namespace pos
+{
+NvmfNamespaceBatcher::NvmfNamespaceBatcher(void)
+{
+}
+
+NvmfNamespaceBatcher::~NvmfNamespaceBatcher(void)
+{
+}
+
+void
+NvmfNamespaceBatcher::Submit(struct spdk_nvmf_subsystem* subsystem, NamespaceOperationType type,
+    struct EventContext* ctx, SpdkNvmfCaller* spdkNvmfCaller, EventFrameworkApi* eventFrameworkApi)
+{
+    Batch& batch = batches[subsystem];
+    batch.queued.push_back({type, ctx});
+    if (batch.inFlight)
+    {
+        return;
+    }
+    batch.inFlight = true;
+    PauseBatch(subsystem, this, eventFrameworkApi, spdkNvmfCaller);
+}
+
+uint32_t
+NvmfNamespaceBatcher::GetQueuedCount(struct spdk_nvmf_subsystem* subsystem)
+{
+    auto it = batches.find(subsystem);
+    return (it == batches.end()) ? 0 : it->second.queued.size();
+}
+
+uint32_t
+NvmfNamespaceBatcher::GetApplyingCount(struct spdk_nvmf_subsystem* subsystem)
+{
+    auto it = batches.find(subsystem);
+    return (it == batches.end()) ? 0 : it->second.applying.size();
+}
+
+uint32_t
+NvmfNamespaceBatcher::SelectPauseNsid(const std::vector<NamespaceOperation>& operations)
+{
+    // Attaching needs no namespace drained. A single detach drains only its own
+    // namespace, more of them drain all the namespaces at once.
+    uint32_t pauseNsid = 0;
+    for (auto& operation : operations)
+    {
+        if (operation.type != NamespaceOperationType::DETACH)
+        {
+            continue;
+        }
+        uint32_t nsid = _GetDetachNsid(operation);
+        if (pauseNsid != 0 && pauseNsid != nsid)
+        {
+            return SPDK_NVME_GLOBAL_NS_TAG;
+        }
+        pauseNsid = nsid;
+    }
+    return pauseNsid;
+}
+
+void
+NvmfNamespaceBatcher::PauseBatch(void* arg1, void* arg2,
+    EventFrameworkApi* eventFrameworkApi, SpdkNvmfCaller* spdkNvmfCaller)
+{
+    struct spdk_nvmf_subsystem* subsystem = static_cast<struct spdk_nvmf_subsystem*>(arg1);
+    NvmfNamespaceBatcher* batcher = static_cast<NvmfNamespaceBatcher*>(arg2);
+    bool callerCreated = false;
+    if (nullptr == spdkNvmfCaller)
+    {
+        spdkNvmfCaller = new SpdkNvmfCaller();
+        callerCreated = true;
+    }
+
+    uint32_t pauseNsid = 0;
+    if (nullptr != batcher)
+    {
+        Batch& batch = batcher->batches[subsystem];
+        pauseNsid = SelectPauseNsid(batch.queued);
+        batch.pausedNsid = pauseNsid;
+    }
+    int ret = spdkNvmfCaller->SpdkNvmfSubsystemPause(subsystem, pauseNsid, BatchPauseDone, batcher);
+    if (ret != 0)
+    {
+        SPDK_NOTICELOG("failed to pause subsystem during namespace operations : retrying \n");
+        if (nullptr == eventFrameworkApi)
+        {
+            eventFrameworkApi = EventFrameworkApiSingleton::Instance();
+        }
+        eventFrameworkApi->SendSpdkEvent(eventFrameworkApi->GetFirstReactor(),
+            (EventFuncFourParams)PauseBatch, subsystem, batcher);
+    }
+    if (callerCreated)
+    {
+        delete spdkNvmfCaller;
+    }
+}
+
+void
+NvmfNamespaceBatcher::BatchPauseDone(struct spdk_nvmf_subsystem* subsystem, void* arg, int status)
+{
+    NvmfNamespaceBatcher* batcher = static_cast<NvmfNamespaceBatcher*>(arg);
+    Batch& batch = batcher->batches[subsystem];
+    batcher->_TakeCoveredOperations(batch);
+
+    if (status != NvmfCallbackStatus::SUCCESS)
+    {
+        batcher->_FailApplying(batch);
+        ActivateSubsystem(subsystem);
+        batcher->_StartNextBatch(subsystem);
+        return;
+    }
+
+    for (auto& operation : batch.applying)
+    {
+        if (operation.type == NamespaceOperationType::ATTACH)
+        {
+            AddNamespace(subsystem, operation.ctx);
+        }
+        else
+        {
+            RemoveNamespace(subsystem, operation.ctx);
+        }
+    }
+
+    SpdkNvmfCaller spdkNvmfCaller;
+    int ret = spdkNvmfCaller.SpdkNvmfSubsystemResume(subsystem, BatchResumeDone, batcher);
+    if (ret != 0)
+    {
+        SPDK_ERRLOG("fail to resume subsystem(%s) during namespace operations\n",
+            spdkNvmfCaller.SpdkNvmfSubsystemGetNqn(subsystem));
+        batcher->_FailApplying(batch);
+        batcher->_StartNextBatch(subsystem);
+    }
+}
+
+void
+NvmfNamespaceBatcher::BatchResumeDone(struct spdk_nvmf_subsystem* subsystem, void* arg, int status)
+{
+    NvmfNamespaceBatcher* batcher = static_cast<NvmfNamespaceBatcher*>(arg);
+    if (status != NvmfCallbackStatus::SUCCESS)
+    {
+        SpdkNvmfCaller spdkNvmfCaller;
+        SPDK_ERRLOG("Failed to resume subsystem(%s)\n",
+            spdkNvmfCaller.SpdkNvmfSubsystemGetNqn(subsystem));
+    }
+
+    Batch& batch = batcher->batches[subsystem];
+    SPDK_NOTICELOG("%zu namespace operation(s) applied under one pause\n", batch.applying.size());
+    for (auto& operation : batch.applying)
+    {
+        if (operation.type == NamespaceOperationType::ATTACH)
+        {
+            CompleteAttachNamespace(operation.ctx);
+        }
+        else
+        {
+            CompleteDetachNamespace(subsystem, operation.ctx);
+        }
+    }
+    batch.applying.clear();
+    batcher->_StartNextBatch(subsystem);
+}
+
+uint32_t
+NvmfNamespaceBatcher::_GetDetachNsid(const NamespaceOperation& operation)
+{
+    uint32_t nsid = 0;
+    sscanf(static_cast<char*>(operation.ctx->eventArg1), "%u", &nsid);
+    return nsid;
+}
+
+bool
+NvmfNamespaceBatcher::_IsCoveredByPause(const NamespaceOperation& operation, uint32_t pausedNsid)
+{
+    if (operation.type == NamespaceOperationType::ATTACH || pausedNsid == SPDK_NVME_GLOBAL_NS_TAG)
+    {
+        return true;
+    }
+    return (_GetDetachNsid(operation) == pausedNsid);
+}
+
+void
+NvmfNamespaceBatcher::_TakeCoveredOperations(Batch& batch)
+{
+    auto uncovered = std::stable_partition(batch.queued.begin(), batch.queued.end(),
+        [&batch](const NamespaceOperation& operation)
+        {
+            return _IsCoveredByPause(operation, batch.pausedNsid);
+        });
+    batch.applying.insert(batch.applying.end(), batch.queued.begin(), uncovered);
+    batch.queued.erase(batch.queued.begin(), uncovered);
+}
+
+void
+NvmfNamespaceBatcher::_FailApplying(Batch& batch)
+{
+    for (auto& operation : batch.applying)
+    {
+        CompleteNamespaceOperation(operation.ctx, NvmfCallbackStatus::FAILED);
+    }
+    batch.applying.clear();
+}
+
+void
+NvmfNamespaceBatcher::_StartNextBatch(struct spdk_nvmf_subsystem* subsystem)
+{
+    auto it = batches.find(subsystem);
+    if (it == batches.end())
+    {
+        return;
+    }
+    if (it->second.queued.empty())
+    {
+        batches.erase(it);
+        return;
+    }
+    PauseBatch(subsystem, this);
+}
+
+} // namespace pos
@@ -0,0 +1,104 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "src/network/nvmf_target_spdk.h"
+
+namespace pos
+{
+class EventFrameworkApi;
+class SpdkNvmfCaller;
+
+enum class NamespaceOperationType
+{
+    ATTACH,
+    DETACH
+};
+
+struct NamespaceOperation
+{
+    NamespaceOperationType type;
+    struct EventContext* ctx;
+};
+
+// Applies the namespace attaches and detaches of a subsystem in batches, each under
+// a single pause and resume of the subsystem. An operation submitted while the
+// subsystem is being paused joins that batch if the pause covers it: an attach
+// always does, a detach only if the namespace it removes is paused. The rest wait
+// for the next batch, which starts as soon as the current one is resumed.
+// A pause drains only the namespaces being detached, so the I/O to the other
+// namespaces of the subsystem keeps flowing while a batch is applied.
+// Every operation is submitted and completed on the first reactor.
+class NvmfNamespaceBatcher
+{
+public:
+    NvmfNamespaceBatcher(void);
+    virtual ~NvmfNamespaceBatcher(void);
+
+    virtual void Submit(struct spdk_nvmf_subsystem* subsystem, NamespaceOperationType type,
+        struct EventContext* ctx, SpdkNvmfCaller* spdkNvmfCaller = nullptr,
+        EventFrameworkApi* eventFrameworkApi = nullptr);
+    uint32_t GetQueuedCount(struct spdk_nvmf_subsystem* subsystem);
+    uint32_t GetApplyingCount(struct spdk_nvmf_subsystem* subsystem);
+
+    static uint32_t SelectPauseNsid(const std::vector<NamespaceOperation>& operations);
+
+    // EventFuncFourParams signature, arg1 is the subsystem and arg2 the batcher
+    static void PauseBatch(void* arg1, void* arg2,
+        EventFrameworkApi* eventFrameworkApi = nullptr, SpdkNvmfCaller* spdkNvmfCaller = nullptr);
+    static void BatchPauseDone(struct spdk_nvmf_subsystem* subsystem, void* arg, int status);
+    static void BatchResumeDone(struct spdk_nvmf_subsystem* subsystem, void* arg, int status);
+
+private:
+    struct Batch
+    {
+        std::vector<NamespaceOperation> queued;
+        std::vector<NamespaceOperation> applying;
+        uint32_t pausedNsid = 0;
+        bool inFlight = false;
+    };
+
+    static uint32_t _GetDetachNsid(const NamespaceOperation& operation);
+    static bool _IsCoveredByPause(const NamespaceOperation& operation, uint32_t pausedNsid);
+    void _TakeCoveredOperations(Batch& batch);
+    void _FailApplying(Batch& batch);
+    void _StartNextBatch(struct spdk_nvmf_subsystem* subsystem);
+
+    std::map<struct spdk_nvmf_subsystem*, Batch> batches;
+};
+
+} // namespace pos
@@ -47,6 +47,7 @@
 #include "src/master_context/config_manager.h"
 #include "src/network/nvmf_target_spdk.h"
 #include "src/network/nvmf_volume_pos.h"
+#include "src/network/volume_reactor_affinity.h"
 #include "src/qos/qos_manager.h"
 #include "src/spdk_wrapper/spdk.h"
 #include "src/sys_event/volume_event_publisher.h"
@@ -57,6 +58,7 @@ extern struct spdk_nvmf_tgt* g_spdk_nvmf_tgt;
 namespace pos
 {
 struct NvmfTargetCallbacks NvmfTarget::nvmfCallbacks;
+NvmfNamespaceBatcher NvmfTarget::namespaceBatcher;
 const char* NvmfTarget::BDEV_NAME_PREFIX = "bdev_";
 std::atomic<int> NvmfTarget::attachedNsid;
 std::atomic<int> NvmfTarget::deletedBdev;
@@ -198,6 +200,27 @@ NvmfTarget::DeletePosBdev(const string& bdevName)
     return true;
 }
 
+bool
+NvmfTarget::ResizePosBdev(const string& bdevName, uint64_t volumeSizeInMb, uint32_t blockSize)
+{
+    struct spdk_bdev* bdev = spdkCaller->SpdkBdevGetByName(bdevName.c_str());
+    if (bdev == nullptr)
+    {
+        SPDK_ERRLOG("bdev %s does not exist\n", bdevName.c_str());
+        return false;
+    }
+
+    // The subsystem holding the namespace sends the namespace attribute changed notice to the hosts
+    uint64_t numBlocks = volumeSizeInMb * MB / blockSize;
+    int ret = spdkCaller->SpdkBdevNotifyBlockcntChange(bdev, numBlocks);
+    if (ret != 0)
+    {
+        SPDK_ERRLOG("fail to resize bdev %s to %lu blocks (%d)\n", bdevName.c_str(), numBlocks, ret);
+        return false;
+    }
+    return true;
+}
+
 bool
 NvmfTarget::DeletePosBdevAll(string arrayName, uint64_t time)
 {
@@ -363,11 +386,7 @@ NvmfTarget::_AttachNamespaceWithNsid(const string& nqn, const string& bdevName,
             return false;
         }
 
-        int ret = spdkNvmfCaller->SpdkNvmfSubsystemPause(subsystem, nsid, nvmfCallbacks.attachNamespacePauseDone, ctx);
-        if (ret != 0)
-        {
-            _AttachNamespaceWithPause(subsystem, ctx, nullptr, nullptr);
-        }
+        namespaceBatcher.Submit(subsystem, NamespaceOperationType::ATTACH, ctx, spdkNvmfCaller);
         delete spdkNvmfCaller;
         return true;
     }
@@ -379,36 +398,6 @@ NvmfTarget::_AttachNamespaceWithNsid(const string& nqn, const string& bdevName,
     }
 }
 
-void
-NvmfTarget::_AttachNamespaceWithPause(void* arg1, void* arg2, EventFrameworkApi* eventFrameworkApi, SpdkNvmfCaller* spdkNvmfCaller)
-{
-    if (nullptr == spdkNvmfCaller)
-    {
-        spdkNvmfCaller = new SpdkNvmfCaller();
-    }
-
-    if (nullptr != spdkNvmfCaller)
-    {
-        struct spdk_nvmf_subsystem* subsystem = (struct spdk_nvmf_subsystem*)arg1;
-        int ret = spdkNvmfCaller->SpdkNvmfSubsystemPause(subsystem, 0, nvmfCallbacks.attachNamespacePauseDone, (void*)arg2);
-        if (ret != 0)
-        {
-            SPDK_NOTICELOG("failed to pause subsystem during attaching namespace : retrying \n");
-            if (nullptr == eventFrameworkApi)
-            {
-                eventFrameworkApi = EventFrameworkApiSingleton::Instance();
-            }
-            eventFrameworkApi->SendSpdkEvent(eventFrameworkApi->GetFirstReactor(), (EventFuncFourParams)_AttachNamespaceWithPause, subsystem, arg2);
-        }
-        delete spdkNvmfCaller;
-    }
-    else
-    {
-        int event = static_cast<int>(EID(IONVMF_SPDK_NVMF_CALLER_NULLPTR));
-        POS_TRACE_ERROR(event, "Failed to attach namespace. SpdkNvmfCaller is nullptr");
-    }
-}
-
 struct spdk_nvmf_ns*
 NvmfTarget::GetNamespace(
     struct spdk_nvmf_subsystem* subsystem, const string& bdevName)
@@ -474,11 +463,7 @@ NvmfTarget::DetachNamespace(const string& nqn, uint32_t nsid,
         return false;
     }
 
-    int ret = spdkNvmfCaller->SpdkNvmfSubsystemPause(subsystem, nsid, nvmfCallbacks.detachNamespacePauseDone, ctx);
-    if (ret != 0)
-    {
-        _DetachNamespaceWithPause(subsystem, ctx, nullptr, nullptr);
-    }
+    namespaceBatcher.Submit(subsystem, NamespaceOperationType::DETACH, ctx, spdkNvmfCaller, eventFrameworkApi);
 
     return true;
 }
@@ -501,37 +486,6 @@ NvmfTarget::CheckSubsystemExistance(void)
     return false;
 }
 
-void
-NvmfTarget::_DetachNamespaceWithPause(void* arg1, void* arg2, EventFrameworkApi* eventFrameworkApi, SpdkNvmfCaller* spdkNvmfCaller)
-{
-    struct spdk_nvmf_subsystem* subsystem = (struct spdk_nvmf_subsystem*)arg1;
-    if (nullptr == spdkNvmfCaller)
-    {
-        spdkNvmfCaller = new SpdkNvmfCaller();
-    }
-
-    if (nullptr != spdkNvmfCaller)
-    {
-        int ret = spdkNvmfCaller->SpdkNvmfSubsystemPause(subsystem, 0,
-            nvmfCallbacks.detachNamespacePauseDone, (void*)arg2);
-        if (ret != 0)
-        {
-            if (nullptr == eventFrameworkApi)
-            {
-                eventFrameworkApi = EventFrameworkApiSingleton::Instance();
-            }
-            SPDK_NOTICELOG("failed to pause subsystem during detaching namespace : retrying \n");
-            eventFrameworkApi->SendSpdkEvent(eventFrameworkApi->GetFirstReactor(), (EventFuncFourParams)_DetachNamespaceWithPause, subsystem, arg2);
-        }
-        delete spdkNvmfCaller;
-    }
-    else
-    {
-        int event = static_cast<int>(EID(IONVMF_SPDK_NVMF_CALLER_NULLPTR));
-        POS_TRACE_ERROR(event, "Failed to detach namespace. SpdkNvmfCaller is nullptr");
-    }
-}
-
 bool
 NvmfTarget::DetachNamespaceAll(const string& nqn,
     PosNvmfEventDoneCallback_t callback, void* arg)
@@ -680,6 +634,49 @@ NvmfTarget::GetVolumeNqnId(const string& nqn)
     return spdkCaller->SpdkNvmfSubsystemGetId(subsystem);
 }
 
+void
+NvmfTarget::UpdatePollGroupHint(const string& subnqn, VolumeReactorAffinity* affinity)
+{
+    struct spdk_nvmf_subsystem* subsystem = FindSubsystem(subnqn);
+    if (nullptr == subsystem)
+    {
+        return;
+    }
+    struct spdk_nvmf_subsystem_listener* listener = spdkNvmfCaller->SpdkNvmfSubsystemGetFirstListener(subsystem);
+    while (listener != nullptr)
+    {
+        string trsvcid = spdkNvmfCaller->SpdkNvmfSubsystemListenerGetTrid(listener)->trsvcid;
+        cpu_set_t reactors;
+        CPU_ZERO(&reactors);
+        struct spdk_nvmf_subsystem* other = spdkNvmfCaller->SpdkNvmfSubsystemGetFirst(g_spdk_nvmf_tgt);
+        while (other != nullptr)
+        {
+            struct spdk_nvmf_subsystem_listener* otherListener = spdkNvmfCaller->SpdkNvmfSubsystemGetFirstListener(other);
+            while (otherListener != nullptr)
+            {
+                if (trsvcid == spdkNvmfCaller->SpdkNvmfSubsystemListenerGetTrid(otherListener)->trsvcid)
+                {
+                    cpu_set_t homeReactors = affinity->GetSubsystemHomeReactors(GetVolumeNqn(other));
+                    CPU_OR(&reactors, &reactors, &homeReactors);
+                    break;
+                }
+                otherListener = spdkNvmfCaller->SpdkNvmfSubsystemGetNextListener(other, otherListener);
+            }
+            other = spdkNvmfCaller->SpdkNvmfSubsystemGetNext(other);
+        }
+
+        if (CPU_COUNT(&reactors) == 0)
+        {
+            spdkNvmfCaller->SpdkNvmfClearListenerPollGroupHint(trsvcid.c_str());
+        }
+        else
+        {
+            spdkNvmfCaller->SpdkNvmfSetListenerPollGroupHint(trsvcid.c_str(), &reactors);
+        }
+        listener = spdkNvmfCaller->SpdkNvmfSubsystemGetNextListener(subsystem, listener);
+    }
+}
+
 struct spdk_nvmf_subsystem*
 NvmfTarget::FindSubsystem(const string& subnqn)
 {
@@ -40,6 +40,7 @@
 
 #include "src/include/nvmf_const.h"
 #include "src/lib/singleton.h"
+#include "src/network/nvmf_namespace_batcher.h"
 #include "src/network/nvmf_target_spdk.h"
 #include "src/spdk_wrapper/caller/spdk_caller.h"
 #include "src/spdk_wrapper/caller/spdk_nvmf_caller.h"
@@ -51,6 +52,7 @@ class EventFrameworkApi;
 namespace pos
 {
 class ConfigManager;
+class VolumeReactorAffinity;
 enum NvmfCallbackStatus
 {
     SUCCESS = 0,
@@ -69,6 +71,7 @@ public:
     virtual bool CreatePosBdev(const string& bdevName, const string uuid, uint32_t id, uint64_t volumeSizeInMb,
         uint32_t blockSize, bool volumeTypeInMem, const string& arrayName, uint64_t arrayId);
     virtual bool DeletePosBdev(const string& bdevName);
+    virtual bool ResizePosBdev(const string& bdevName, uint64_t volumeSizeInMb, uint32_t blockSize);
     virtual bool DeletePosBdevAll(string arrayName, uint64_t time = NS_DELETE_TIMEOUT);
 
     virtual bool DetachNamespace(const string& nqn, uint32_t nsid,
@@ -100,9 +103,13 @@ public:
     virtual string GetSubsystemArrayName(string& subnqn);
 
     virtual void RemoveSubsystemArrayName(string& subnqn);
+    // Steers the qpairs accepted on the listeners of the subsystem to the home reactors of
+    // the volumes of every subsystem on the same listener
+    virtual void UpdatePollGroupHint(const string& subnqn, VolumeReactorAffinity* affinity);
 
 protected:
     static struct NvmfTargetCallbacks nvmfCallbacks;
+    static NvmfNamespaceBatcher namespaceBatcher;
     static atomic<bool> deleteDone;
     static void _DeletePosBdevAllHandler(void* arg1);
     static void _DeletePosBdevAllHandler(void* arg1, SpdkCaller* spdkCaller,
@@ -110,10 +117,6 @@ protected:
 
     static bool _AttachNamespaceWithNsid(const string& nqn, const string& bdevName, uint32_t nsid,
         PosNvmfEventDoneCallback_t cb, void* cbArg, SpdkNvmfCaller* spdkNvmfCaller = nullptr);
-    static void _AttachNamespaceWithPause(void* arg1, void* arg2,
-        EventFrameworkApi* eventFrameworkApi = nullptr, SpdkNvmfCaller* spdkNvmfCaller = nullptr);
-    static void _DetachNamespaceWithPause(void* arg1, void* arg2,
-        EventFrameworkApi* eventFrameworkApi = nullptr, SpdkNvmfCaller* spdkNvmfCaller = nullptr);
     static void _DetachNamespaceAllWithPause(void* arg1, void* arg2,
         EventFrameworkApi* eventFrameworkApi = nullptr, SpdkNvmfCaller* spdkNvmfCaller = nullptr);
 
@@ -135,8 +138,6 @@ private:
     static bool _IsTargetExist(void);
     static void _AttachDone(void* cbArg, int status);
     static void _DeleteDone(void* cbArg, int status);
-    static void _DetachNamespaceWithPause(void* arg1, void* arg2);
-    static void _AttachNamespaceWithPause(void* arg1, void* arg2);
     static void _DetachNamespaceAllWithPause(void* arg1, void* arg2);
     static void _TryAttachHandler(void* arg1, void* arg2);
 };
@@ -142,69 +142,103 @@ ActivateSubsystem(void* arg1)
     }
 }
 
-static void
-AttachNamespaceResumeDone(struct spdk_nvmf_subsystem* subsystem, void* arg, int status)
+void
+CompleteNamespaceOperation(struct EventContext* ctx, int status)
+{
+    GenericCallback(__FUNCTION__, ctx, status);
+}
+
+void
+AddNamespace(struct spdk_nvmf_subsystem* subsystem, struct EventContext* ctx)
 {
     SpdkNvmfCaller spdkNvmfCaller;
-    if (status != NvmfCallbackStatus::SUCCESS)
+    SpdkCaller* spdkCaller = SpdkCallerSingleton::Instance();
+    struct spdk_bdev* bdev = NULL;
+    char* bdevName = (char*)ctx->eventArg1;
+    char* nsid = (char*)ctx->eventArg2;
+    bdev = spdkCaller->SpdkBdevGetByName(bdevName);
+    if (bdev)
     {
-        SPDK_ERRLOG("Failed to resume subsystem(%s)\n",
-            spdkNvmfCaller.SpdkNvmfSubsystemGetNqn(subsystem));
+        struct spdk_nvmf_ns_opts opt;
+        uint32_t newNsid = 0;
+        memset((char*)&opt, 0, sizeof(struct spdk_nvmf_ns_opts));
+        opt.nsid = atoi(nsid);
+        newNsid = spdkNvmfCaller.SpdkNvmfSubsystemAddNs(subsystem, bdevName, &opt, sizeof(opt), NULL);
+        free(ctx->eventArg2);
+        ctx->eventArg2 = spdk_sprintf_alloc("%u", newNsid);
+        if (newNsid > 0)
+        {
+            SPDK_NOTICELOG("Success to add namespace nsid=%d\n", newNsid);
+        }
+        else
+        {
+            SPDK_ERRLOG("fail to add namespace (bdevName=%s)\n", bdevName);
+        }
+    }
+    else
+    {
+        SPDK_ERRLOG("No bdev with name %s\n", bdevName);
     }
+}
 
-    struct EventContext* ctx = (struct EventContext*)arg;
+void
+CompleteAttachNamespace(struct EventContext* ctx)
+{
     uint32_t nsid = 0;
     sscanf((char*)ctx->eventArg2, "%u", &nsid);
-    status = nsid;
+    int status = (nsid > 0) ? NvmfCallbackStatus::SUCCESS : NvmfCallbackStatus::FAILED;
+    GenericCallback(__FUNCTION__, ctx, status);
+}
 
-    if (nsid > 0)
+void
+RemoveNamespace(struct spdk_nvmf_subsystem* subsystem, struct EventContext* ctx)
+{
+    SpdkNvmfCaller spdkNvmfCaller;
+    uint32_t nsid = 0;
+    sscanf((char*)ctx->eventArg1, "%u", &nsid);
+    int ret = spdkNvmfCaller.SpdkNvmfSubsystemRemoveNs(subsystem, nsid);
+    if (ret < 0)
     {
-        status = NvmfCallbackStatus::SUCCESS;
+        SPDK_ERRLOG("Failed to detach namespace from subsystem(%s) nsid=%d\n",
+            spdkNvmfCaller.SpdkNvmfSubsystemGetNqn(subsystem), nsid);
     }
-    else
+}
+
+void
+CompleteDetachNamespace(struct spdk_nvmf_subsystem* subsystem, struct EventContext* ctx)
+{
+    SpdkNvmfCaller spdkNvmfCaller;
+    uint32_t nsid = 0;
+    sscanf((char*)ctx->eventArg1, "%u", &nsid);
+    int status = NvmfCallbackStatus::FAILED;
+    if (spdkNvmfCaller.SpdkNvmfSubsystemGetNs(subsystem, nsid) == nullptr)
     {
-        status = NvmfCallbackStatus::FAILED;
+        status = NvmfCallbackStatus::SUCCESS;
     }
+    GenericCallback(__FUNCTION__, ctx, status);
+}
 
-    GenericCallback(__FUNCTION__, arg, status);
+static void
+AttachNamespaceResumeDone(struct spdk_nvmf_subsystem* subsystem, void* arg, int status)
+{
+    SpdkNvmfCaller spdkNvmfCaller;
+    if (status != NvmfCallbackStatus::SUCCESS)
+    {
+        SPDK_ERRLOG("Failed to resume subsystem(%s)\n",
+            spdkNvmfCaller.SpdkNvmfSubsystemGetNqn(subsystem));
+    }
+    CompleteAttachNamespace((struct EventContext*)arg);
 }
 
 static void
 AttachNamespacePauseDone(struct spdk_nvmf_subsystem* subsystem, void* arg, int status)
 {
     SpdkNvmfCaller spdkNvmfCaller;
-    SpdkCaller* spdkCaller = SpdkCallerSingleton::Instance();
     struct EventContext* ctx = (struct EventContext*)arg;
     if (status == NvmfCallbackStatus::SUCCESS)
     {
         int ret = 0;
-        struct spdk_bdev* bdev = NULL;
-        char* bdevName = (char*)ctx->eventArg1;
-        char* nsid = (char*)ctx->eventArg2;
-        bdev = spdkCaller->SpdkBdevGetByName(bdevName);
-        if (bdev)
-        {
-            struct spdk_nvmf_ns_opts opt;
-            uint32_t newNsid = 0;
-            memset((char*)&opt, 0, sizeof(struct spdk_nvmf_ns_opts));
-            opt.nsid = atoi(nsid);
-            newNsid = spdkNvmfCaller.SpdkNvmfSubsystemAddNs(subsystem, bdevName, &opt, sizeof(opt), NULL);
-            free(ctx->eventArg2);
-            ctx->eventArg2 = spdk_sprintf_alloc("%u", newNsid);
-            if (newNsid > 0)
-            {
-                SPDK_NOTICELOG("Success to add namespace nsid=%d\n", newNsid);
-            }
-            else
-            {
-                SPDK_ERRLOG("fail to add namespace (bdevName=%s)\n", bdevName);
-            }
-        }
-        else
-        {
-            SPDK_ERRLOG("No bdev with name %s\n", bdevName);
-        }
-
+        AddNamespace(subsystem, ctx);
         ret = spdkNvmfCaller.SpdkNvmfSubsystemResume(subsystem, AttachNamespaceResumeDone, ctx);
         if (ret != 0)
         {
@@ -229,18 +263,7 @@ DetachNamespaceResumeDone(struct spdk_nvmf_subsystem* subsystem, void* arg, int
             spdkNvmfCaller.SpdkNvmfSubsystemGetNqn(subsystem));
     }
 
-    struct EventContext* ctx = (struct EventContext*)arg;
-    uint32_t nsid = 0;
-    sscanf((char*)ctx->eventArg1, "%u", &nsid);
-    if (spdkNvmfCaller.SpdkNvmfSubsystemGetNs(subsystem, nsid) == nullptr)
-    {
-        status = NvmfCallbackStatus::SUCCESS;
-    }
-    else
-    {
-        status = NvmfCallbackStatus::FAILED;
-    }
-    GenericCallback(__FUNCTION__, arg, status);
+    CompleteDetachNamespace(subsystem, (struct EventContext*)arg);
 }
 
 static void
@@ -251,14 +274,7 @@ DetachNamespacePauseDone(struct spdk_nvmf_subsystem* subsystem, void* arg, int s
     if (status == NvmfCallbackStatus::SUCCESS)
     {
         int ret = 0;
-        uint32_t nsid = 0;
-        sscanf((char*)ctx->eventArg1, "%u", &nsid);
-        ret = spdkNvmfCaller.SpdkNvmfSubsystemRemoveNs(subsystem, nsid);
-        if (ret < 0)
-        {
-            SPDK_ERRLOG("Failed to detach namespace from subsystem(%s) nsid=%d\n",
-                spdkNvmfCaller.SpdkNvmfSubsystemGetNqn(subsystem), nsid);
-        }
+        RemoveNamespace(subsystem, ctx);
         ret = spdkNvmfCaller.SpdkNvmfSubsystemResume(subsystem, DetachNamespaceResumeDone, arg);
         if (ret != 0)
         {
@@ -82,4 +82,13 @@ struct EventContext* AllocEventContext(PosNvmfEventDoneCallback_t callback, void
 void FreeEventContext(struct EventContext* e);
 void ActivateSubsystem(void* arg1);
 
+// Steps of a namespace attach (bdev name in eventArg1, nsid in eventArg2) and of a
+// namespace detach (nsid in eventArg1). Add and remove are done while the subsystem
+// is paused, the complete ones report the result to the user callback and free ctx.
+void AddNamespace(struct spdk_nvmf_subsystem* subsystem, struct EventContext* ctx);
+void CompleteAttachNamespace(struct EventContext* ctx);
+void RemoveNamespace(struct spdk_nvmf_subsystem* subsystem, struct EventContext* ctx);
+void CompleteDetachNamespace(struct spdk_nvmf_subsystem* subsystem, struct EventContext* ctx);
+void CompleteNamespaceOperation(struct EventContext* ctx, int status);
+
 } // namespace pos
@@ -41,6 +41,7 @@
 #include "src/include/pos_event_id.hpp"
 #include "src/lib/system_timeout_checker.h"
 #include "src/logger/logger.h"
+#include "src/network/volume_reactor_affinity.h"
 #include "src/volume/volume_manager.h"
 
 namespace pos
@@ -242,6 +243,13 @@ NvmfVolumePos::_VolumeMountHandler(void* arg1, void* arg2)
         }
         set_pos_volume_info(bdevName.c_str(), subNqn.c_str(), nqn_id);
         target->SetVolumeQos(bdevName, vInfo->iops_limit, vInfo->bw_limit);
+        VolumeReactorAffinity* affinity = VolumeReactorAffinitySingleton::Instance();
+        if (affinity->IsEnabled())
+        {
+            string arrayName(vInfo->array_name);
+            affinity->Assign(arrayName, vInfo->id, subNqn, VolumeReactorAffinity::GetArrayNuma(arrayName));
+            target->UpdatePollGroupHint(subNqn, affinity);
+        }
         delete vInfo;
         vInfo = nullptr;
     }
@@ -270,6 +278,7 @@ NvmfVolumePos::_VolumeUnmountHandler(void* arg1, void* arg2)
         if (nqn != NULL)
         {
             string subnqn(nqn);
+            _ReleaseHomeReactors(subnqn, vInfo->array_name, {static_cast<int>(vInfo->id)});
             ret = target->DetachNamespace(subnqn, 0, _NamespaceDetachedHandler, vInfo);
             if (false == ret)
             {
@@ -338,12 +347,38 @@ NvmfVolumePos::VolumeUpdated(struct pos_volume_info* vInfo)
         _VolumeUpdateHandler, vInfo, nullptr);
 }
 
+void
+NvmfVolumePos::_VolumeResizeHandler(void* arg1, void* arg2)
+{
+    struct pos_volume_info* vInfo = (struct pos_volume_info*)arg1;
+    if (vInfo)
+    {
+        string bdevName = target->GetBdevName(vInfo->id, vInfo->array_name);
+        bool ret = target->ResizePosBdev(bdevName, vInfo->size_mb, 512);
+        if (false == ret)
+        {
+            POS_TRACE_WARN(EID(RESIZE_VOL_NAME_DOES_NOT_EXIST),
+                "Fail to notify the new size of volume {} to the hosts", vInfo->name);
+        }
+        delete vInfo;
+        vInfo = nullptr;
+    }
+}
+
+void
+NvmfVolumePos::VolumeResized(struct pos_volume_info* vInfo)
+{
+    eventFrameworkApi->SendSpdkEvent(eventFrameworkApi->GetFirstReactor(),
+        _VolumeResizeHandler, vInfo, nullptr);
+}
+
 void
 NvmfVolumePos::_VolumeDetachHandler(void* volListInfo, void* arg)
 {
     int ret = false;
     volumeListInfo volsInfo = *(static_cast<volumeListInfo*>(volListInfo));
     string subnqn = volsInfo.subnqn;
+    _ReleaseHomeReactors(subnqn, volsInfo.arrayName, volsInfo.vols);
     ret = target->DetachNamespaceAll(subnqn, _NamespaceDetachedAllHandler, volListInfo);
     if (ret == false)
     {
@@ -352,6 +387,21 @@ NvmfVolumePos::_VolumeDetachHandler(void* volListInfo, void* arg)
     }
 }
 
+void
+NvmfVolumePos::_ReleaseHomeReactors(const string& subnqn, const string& arrayName, const vector<int>& vols)
+{
+    VolumeReactorAffinity* affinity = VolumeReactorAffinitySingleton::Instance();
+    if (affinity->IsEnabled() == false)
+    {
+        return;
+    }
+    for (int volId : vols)
+    {
+        affinity->Release(arrayName, volId);
+    }
+    target->UpdatePollGroupHint(subnqn, affinity);
+}
+
 bool
 NvmfVolumePos::VolumeDetached(vector<int>& volList, string arrayName, uint64_t time)
 {
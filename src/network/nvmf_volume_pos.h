@@ -64,6 +64,7 @@ public:
     virtual void VolumeMounted(struct pos_volume_info* info);
     virtual bool VolumeUnmounted(struct pos_volume_info* info, uint64_t time = NS_DETACH_TIMEOUT);
     virtual void VolumeUpdated(struct pos_volume_info* info);
+    virtual void VolumeResized(struct pos_volume_info* info);
     virtual bool VolumeDetached(vector<int>& volList, string arrayName, uint64_t time = NS_DETACH_TIMEOUT);
 
 protected:
@@ -80,8 +81,10 @@ protected:
     static void _VolumeUnmountHandler(void* arg1, void* arg2);
     static void _VolumeDeleteHandler(void* arg1, void* arg2);
     static void _VolumeUpdateHandler(void* arg1, void* arg2);
+    static void _VolumeResizeHandler(void* arg1, void* arg2);
     static void _NamespaceDetachedHandler(void* cbArg, int status);
     static void _NamespaceDetachedAllHandler(void* cbArg, int status);
+    static void _ReleaseHomeReactors(const string& subnqn, const string& arrayName, const vector<int>& vols);
 
     bool _WaitVolumeCreated(uint32_t volId, string arrayName, uint64_t time);
     bool _WaitVolumeDeleted(uint32_t volId, string arrayName, uint64_t time);
@@ -51,6 +51,7 @@ TransportConfiguration::TransportConfiguration(ConfigManager* configManager, Spd
   bufCacheSize(DEFAULT_BUF_CACHE_SIZE),
   numSharedBuf(DEFAULT_NUM_SHARED_BUF),
   ioUnitSize(DEFAULT_IO_UNIT_SIZE),
+  zcopy(false),
   rpcClient(inputRpcClient)
 {
     if (nullptr == rpcClient)
@@ -86,6 +87,11 @@ TransportConfiguration::ReadConfig(void)
             POS_TRACE_WARN(static_cast<uint32_t>(eventId),
                 "Fail to read transport config. Default num_shared_buffer: {} (May change according to the env.)", numSharedBuf);
         }
+        ret = configManager->GetValue("transport", "zcopy", &zcopy, ConfigType::CONFIG_TYPE_BOOL);
+        if (EID(SUCCESS) != ret)
+        {
+            zcopy = false;
+        }
     }
     else
     {
@@ -105,7 +111,7 @@ TransportConfiguration::CreateTransport(void)
     ReadConfig();
 
     std::transform(trtype.begin(), trtype.end(), trtype.begin(), ::tolower);
-    auto result = rpcClient->TransportCreate(trtype, bufCacheSize, numSharedBuf, ioUnitSize);
+    auto result = rpcClient->TransportCreate(trtype, bufCacheSize, numSharedBuf, ioUnitSize, zcopy);
     if (result.first != 0)
     {
         POS_EVENT_ID eventId = EID(IONVMF_FAIL_TO_CREATE_TRANSPORT);
@@ -55,6 +55,7 @@ private:
     uint32_t bufCacheSize = 0;
     uint32_t numSharedBuf = 0;
     uint32_t ioUnitSize = 0;
+    bool zcopy = false;
     SpdkRpcClient* rpcClient;
     bool _IsEnabled(void);
 };
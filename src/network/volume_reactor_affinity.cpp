@@ -0,0 +1,225 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/network/volume_reactor_affinity.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "src/array_mgmt/array_manager.h"
+#include "src/cpu_affinity/affinity_manager.h"
+#include "src/device/device_identifier.h"
+#include "src/device/device_manager.h"
+#include "src/include/pos_event_id.h"
+#include "src/logger/logger.h"
+#include "src/master_context/config_manager.h"
+
+namespace pos
+{
+VolumeReactorAffinity::VolumeReactorAffinity(void)
+: VolumeReactorAffinity(AffinityManagerSingleton::Instance(), ConfigManagerSingleton::Instance())
+{
+}
+
+VolumeReactorAffinity::VolumeReactorAffinity(AffinityManager* affinityManager, ConfigManager* configManager)
+: affinityManager(affinityManager),
+  enabled(false),
+  homeReactorCount(0)
+{
+    bool enable = false;
+    int ret = configManager->GetValue("performance", "volume_reactor_affinity_enable",
+        &enable, CONFIG_TYPE_BOOL);
+    enabled = (ret == EID(SUCCESS) && enable == true);
+
+    uint32_t count = 0;
+    ret = configManager->GetValue("performance", "volume_home_reactor_count",
+        &count, CONFIG_TYPE_UINT32);
+    if (ret == EID(SUCCESS))
+    {
+        homeReactorCount = count;
+    }
+}
+
+VolumeReactorAffinity::~VolumeReactorAffinity(void)
+{
+}
+
+bool
+VolumeReactorAffinity::IsEnabled(void)
+{
+    return enabled;
+}
+
+cpu_set_t
+VolumeReactorAffinity::Assign(const std::string& arrayName, uint32_t volId,
+    const std::string& subnqn, int numa)
+{
+    std::lock_guard<std::mutex> lock(volumeLock);
+    std::string key = _GetKey(arrayName, volId);
+    auto it = volumes.find(key);
+    if (it != volumes.end())
+    {
+        return it->second.reactors;
+    }
+
+    cpu_set_t candidates = _GetCandidates(numa);
+    std::vector<uint32_t> reactors;
+    for (uint32_t reactor = 0; reactor < CPU_SETSIZE; reactor++)
+    {
+        if (CPU_ISSET(reactor, &candidates))
+        {
+            reactors.push_back(reactor);
+        }
+    }
+    // the least loaded first, the lower core first among the equally loaded
+    std::stable_sort(reactors.begin(), reactors.end(),
+        [this](uint32_t left, uint32_t right) {
+            return volumeCountPerReactor[left] < volumeCountPerReactor[right];
+        });
+    if (homeReactorCount != 0 && reactors.size() > homeReactorCount)
+    {
+        reactors.resize(homeReactorCount);
+    }
+
+    HomeReactors home;
+    home.subnqn = subnqn;
+    CPU_ZERO(&home.reactors);
+    for (uint32_t reactor : reactors)
+    {
+        CPU_SET(reactor, &home.reactors);
+        volumeCountPerReactor[reactor]++;
+    }
+    volumes.emplace(key, home);
+
+    POS_TRACE_INFO(EID(IONVMF_VOLUME_HOME_REACTORS_ASSIGNED),
+        "array_name:{}, vol_id:{}, subnqn:{}, numa:{}, home_reactor_count:{}",
+        arrayName, volId, subnqn, numa, reactors.size());
+    return home.reactors;
+}
+
+void
+VolumeReactorAffinity::Release(const std::string& arrayName, uint32_t volId)
+{
+    std::lock_guard<std::mutex> lock(volumeLock);
+    auto it = volumes.find(_GetKey(arrayName, volId));
+    if (it == volumes.end())
+    {
+        return;
+    }
+    for (auto& reactor : volumeCountPerReactor)
+    {
+        if (CPU_ISSET(reactor.first, &it->second.reactors) && reactor.second > 0)
+        {
+            reactor.second--;
+        }
+    }
+    volumes.erase(it);
+}
+
+cpu_set_t
+VolumeReactorAffinity::GetSubsystemHomeReactors(const std::string& subnqn)
+{
+    std::lock_guard<std::mutex> lock(volumeLock);
+    cpu_set_t reactors;
+    CPU_ZERO(&reactors);
+    for (auto& volume : volumes)
+    {
+        if (volume.second.subnqn == subnqn)
+        {
+            CPU_OR(&reactors, &reactors, &volume.second.reactors);
+        }
+    }
+    return reactors;
+}
+
+uint32_t
+VolumeReactorAffinity::GetVolumeCount(uint32_t reactor)
+{
+    std::lock_guard<std::mutex> lock(volumeLock);
+    auto it = volumeCountPerReactor.find(reactor);
+    return (it == volumeCountPerReactor.end()) ? 0 : it->second;
+}
+
+int
+VolumeReactorAffinity::GetArrayNuma(const std::string& arrayName)
+{
+    // the write buffer decides the node of an array, as in NumaAwaredArrayCreation
+    ComponentsInfo* info = ArrayMgr()->GetInfo(arrayName);
+    if (nullptr == info || nullptr == info->arrayInfo)
+    {
+        return -1;
+    }
+    DeviceSet<std::string> devs = info->arrayInfo->GetDevNames();
+    if (devs.nvm.empty())
+    {
+        return -1;
+    }
+    DevName name(devs.nvm.front());
+    UblockSharedPtr buffer = DeviceManagerSingleton::Instance()->GetDev(name);
+    return (nullptr == buffer) ? -1 : buffer->GetNuma();
+}
+
+std::string
+VolumeReactorAffinity::_GetKey(const std::string& arrayName, uint32_t volId)
+{
+    return arrayName + "/" + std::to_string(volId);
+}
+
+cpu_set_t
+VolumeReactorAffinity::_GetCandidates(int numa)
+{
+    cpu_set_t reactorSet = affinityManager->GetCpuSet(CoreType::REACTOR);
+    cpu_set_t candidates;
+    cpu_set_t ioReactors;
+    CPU_ZERO(&candidates);
+    CPU_ZERO(&ioReactors);
+    for (uint32_t reactor = 0; reactor < CPU_SETSIZE; reactor++)
+    {
+        if (CPU_ISSET(reactor, &reactorSet) == false || affinityManager->IsEventReactor(reactor))
+        {
+            continue;
+        }
+        CPU_SET(reactor, &ioReactors);
+        if (numa >= 0 && affinityManager->GetNumaIdFromCoreId(reactor) == static_cast<uint32_t>(numa))
+        {
+            CPU_SET(reactor, &candidates);
+        }
+    }
+    // a node without io reactors falls back to every io reactor
+    if (CPU_COUNT(&candidates) == 0)
+    {
+        return ioReactors;
+    }
+    return candidates;
+}
+
+} // namespace pos
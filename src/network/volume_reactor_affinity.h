@@ -0,0 +1,92 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <sched.h>
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "src/lib/singleton.h"
+
+namespace pos
+{
+class AffinityManager;
+class ConfigManager;
+
+// Gives every mounted volume a set of home reactors on the NUMA node of its
+// array, picking the reactors that are home to the fewest volumes. The home
+// reactors of the volumes of a subsystem are handed to the nvmf target as
+// poll group hints of its listeners so that the qpairs of the host
+// connections, and the host I/Os submitted on them, land there.
+class VolumeReactorAffinity
+{
+public:
+    VolumeReactorAffinity(void);
+    VolumeReactorAffinity(AffinityManager* affinityManager, ConfigManager* configManager);
+    virtual ~VolumeReactorAffinity(void);
+
+    virtual bool IsEnabled(void);
+    virtual cpu_set_t Assign(const std::string& arrayName, uint32_t volId,
+        const std::string& subnqn, int numa);
+    virtual void Release(const std::string& arrayName, uint32_t volId);
+    // The union of the home reactors of the volumes attached to the subsystem
+    virtual cpu_set_t GetSubsystemHomeReactors(const std::string& subnqn);
+    virtual uint32_t GetVolumeCount(uint32_t reactor);
+
+    static int GetArrayNuma(const std::string& arrayName);
+
+private:
+    struct HomeReactors
+    {
+        std::string subnqn;
+        cpu_set_t reactors;
+    };
+
+    std::string _GetKey(const std::string& arrayName, uint32_t volId);
+    cpu_set_t _GetCandidates(int numa);
+
+    AffinityManager* affinityManager;
+    bool enabled;
+    // 0 for every reactor of the NUMA node
+    uint32_t homeReactorCount;
+    std::map<std::string, HomeReactors> volumes;
+    std::map<uint32_t, uint32_t> volumeCountPerReactor;
+    std::mutex volumeLock;
+};
+
+using VolumeReactorAffinitySingleton = Singleton<VolumeReactorAffinity>;
+
+} // namespace pos
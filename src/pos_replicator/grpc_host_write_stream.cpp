@@ -0,0 +1,500 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/pos_replicator/grpc_host_write_stream.h"
+
+#include <grpc/compression.h>
+
+#include <algorithm>
+
+#include "src/include/array_config.h"
+#include "src/include/pos_event_id.h"
+#include "src/logger/logger.h"
+
+namespace pos
+{
+const char* GrpcHostWriteStream::METHOD_NAME = "/replicator_rpc.ReplicatorIoService/PushHostWriteStream";
+
+// protobuf wire format of PushHostWriteBatch, HostWriteEntry and PushHostWriteAck
+enum WireType
+{
+    WIRE_VARINT = 0,
+    WIRE_FIXED64 = 1,
+    WIRE_LENGTH_DELIMITED = 2,
+    WIRE_FIXED32 = 5
+};
+
+enum BatchField
+{
+    BATCH_ID = 1,
+    BATCH_WRITES = 2
+};
+
+enum EntryField
+{
+    ENTRY_ARRAY_NAME = 1,
+    ENTRY_VOLUME_NAME = 2,
+    ENTRY_RBA = 3,
+    ENTRY_NUM_BLOCKS = 4,
+    ENTRY_DATA = 5
+};
+
+enum AckField
+{
+    ACK_SUCCESSFUL = 1,
+    ACK_BATCH_ID = 2,
+    ACK_LAST_LSN = 3
+};
+
+static void
+AppendVarint(std::string& out, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+static void
+AppendTag(std::string& out, uint32_t field, WireType wireType)
+{
+    AppendVarint(out, (field << 3) | wireType);
+}
+
+static void
+AppendString(std::string& out, uint32_t field, const std::string& value)
+{
+    AppendTag(out, field, WIRE_LENGTH_DELIMITED);
+    AppendVarint(out, value.size());
+    out.append(value);
+}
+
+static bool
+ReadVarint(const std::string& in, size_t& pos, uint64_t& value)
+{
+    value = 0;
+    for (uint32_t shift = 0; shift < 64; shift += 7)
+    {
+        if (pos >= in.size())
+        {
+            return false;
+        }
+        uint8_t byte = static_cast<uint8_t>(in[pos++]);
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void
+ReleaseVolumeIo(void* volumeIo)
+{
+    delete static_cast<VolumeIoSmartPtr*>(volumeIo);
+}
+
+static void
+AppendDataSlices(HostWriteStreamEntry& write, uint64_t dataSize, std::vector<grpc::Slice>& slices)
+{
+    // Each slice keeps a reference of the VolumeIo so that the buffer stays
+    // valid until grpc has put the data on the wire.
+    if (write.volumeIo->IsVectored())
+    {
+        uint64_t remaining = dataSize;
+        for (auto& iov : write.volumeIo->GetIoVectors())
+        {
+            if (remaining == 0)
+            {
+                break;
+            }
+            uint64_t length = std::min(static_cast<uint64_t>(iov.iov_len), remaining);
+            slices.push_back(grpc::Slice(iov.iov_base, length, ReleaseVolumeIo,
+                new VolumeIoSmartPtr(write.volumeIo)));
+            remaining -= length;
+        }
+    }
+    else
+    {
+        slices.push_back(grpc::Slice(write.volumeIo->GetBuffer(), dataSize, ReleaseVolumeIo,
+            new VolumeIoSmartPtr(write.volumeIo)));
+    }
+}
+
+GrpcHostWriteStream::GrpcHostWriteStream(std::shared_ptr<grpc::Channel> channel, uint32_t windowSize,
+    uint32_t maxBatchCount, bool compression,
+    HostWriteStreamAckHandler ackHandler, HostWriteStreamFailHandler failHandler)
+: channel(channel),
+  compression(compression),
+  ackHandler(ackHandler),
+  failHandler(failHandler),
+  window(windowSize, maxBatchCount),
+  active(false),
+  broken(false),
+  starting(false),
+  writing(false),
+  reading(false),
+  finishing(false),
+  stub(channel),
+  poller(nullptr)
+{
+}
+
+GrpcHostWriteStream::~GrpcHostWriteStream(void)
+{
+    Stop();
+}
+
+void
+GrpcHostWriteStream::Start(void)
+{
+    std::unique_lock<std::mutex> lock(streamLock);
+    if (poller != nullptr)
+    {
+        return;
+    }
+
+    if (compression == true)
+    {
+        context.set_compression_algorithm(GRPC_COMPRESS_GZIP);
+    }
+    call = stub.PrepareCall(&context, METHOD_NAME, &cq);
+    starting = true;
+    call->StartCall(reinterpret_cast<void*>(TAG_START));
+    poller = new std::thread(&GrpcHostWriteStream::_Poll, this);
+}
+
+void
+GrpcHostWriteStream::Stop(void)
+{
+    std::unique_lock<std::mutex> lock(streamLock);
+    if (poller == nullptr)
+    {
+        return;
+    }
+    _Break(lock);
+
+    poller->join();
+    delete poller;
+    poller = nullptr;
+}
+
+bool
+GrpcHostWriteStream::IsActive(void)
+{
+    std::unique_lock<std::mutex> lock(streamLock);
+    return active;
+}
+
+bool
+GrpcHostWriteStream::Push(const HostWriteStreamEntry& entry)
+{
+    std::unique_lock<std::mutex> lock(streamLock);
+    if (active == false)
+    {
+        return false;
+    }
+    window.Enqueue(entry);
+    _SendBatchIfPossible();
+    return true;
+}
+
+void
+GrpcHostWriteStream::EncodeBatch(uint64_t batchId, std::vector<HostWriteStreamEntry>& writes,
+    grpc::ByteBuffer& buffer)
+{
+    std::vector<grpc::Slice> slices;
+    std::string header;
+    AppendTag(header, BATCH_ID, WIRE_VARINT);
+    AppendVarint(header, batchId);
+
+    for (auto& write : writes)
+    {
+        uint64_t dataSize = write.numBlocks * ArrayConfig::SECTOR_SIZE_BYTE;
+        std::string entry;
+        AppendString(entry, ENTRY_ARRAY_NAME, write.arrayName);
+        AppendString(entry, ENTRY_VOLUME_NAME, write.volumeName);
+        AppendTag(entry, ENTRY_RBA, WIRE_VARINT);
+        AppendVarint(entry, write.rba);
+        AppendTag(entry, ENTRY_NUM_BLOCKS, WIRE_VARINT);
+        AppendVarint(entry, write.numBlocks);
+        AppendTag(entry, ENTRY_DATA, WIRE_LENGTH_DELIMITED);
+        AppendVarint(entry, dataSize);
+
+        AppendTag(header, BATCH_WRITES, WIRE_LENGTH_DELIMITED);
+        AppendVarint(header, entry.size() + dataSize);
+        header.append(entry);
+        slices.push_back(grpc::Slice(header));
+        header.clear();
+
+        if (dataSize != 0)
+        {
+            AppendDataSlices(write, dataSize, slices);
+        }
+    }
+    if (header.empty() == false)
+    {
+        slices.push_back(grpc::Slice(header));
+    }
+    buffer = grpc::ByteBuffer(slices.data(), slices.size());
+}
+
+bool
+GrpcHostWriteStream::DecodeAck(const grpc::ByteBuffer& buffer, HostWriteAck& ack)
+{
+    std::vector<grpc::Slice> slices;
+    if (buffer.Dump(&slices).ok() == false)
+    {
+        return false;
+    }
+    std::string message;
+    for (auto& slice : slices)
+    {
+        message.append(reinterpret_cast<const char*>(slice.begin()), slice.size());
+    }
+
+    ack = HostWriteAck{false, 0, 0};
+    size_t pos = 0;
+    while (pos < message.size())
+    {
+        uint64_t tag = 0;
+        uint64_t value = 0;
+        if (ReadVarint(message, pos, tag) == false)
+        {
+            return false;
+        }
+        switch (tag & 0x7)
+        {
+            case WIRE_VARINT:
+                if (ReadVarint(message, pos, value) == false)
+                {
+                    return false;
+                }
+                break;
+            case WIRE_LENGTH_DELIMITED:
+                if (ReadVarint(message, pos, value) == false || value > message.size() - pos)
+                {
+                    return false;
+                }
+                pos += value;
+                continue;
+            case WIRE_FIXED64:
+                pos += sizeof(uint64_t);
+                continue;
+            case WIRE_FIXED32:
+                pos += sizeof(uint32_t);
+                continue;
+            default:
+                return false;
+        }
+
+        switch (tag >> 3)
+        {
+            case ACK_SUCCESSFUL:
+                ack.successful = (value != 0);
+                break;
+            case ACK_BATCH_ID:
+                ack.batchId = value;
+                break;
+            case ACK_LAST_LSN:
+                ack.lastLsn = value;
+                break;
+            default:
+                break;
+        }
+    }
+    return pos == message.size();
+}
+
+void
+GrpcHostWriteStream::_Poll(void)
+{
+    void* tag = nullptr;
+    bool ok = false;
+    while (cq.Next(&tag, &ok))
+    {
+        switch (static_cast<StreamTag>(reinterpret_cast<intptr_t>(tag)))
+        {
+            case TAG_START:
+                _HandleStart(ok);
+                break;
+            case TAG_WRITE:
+                _HandleWrite(ok);
+                break;
+            case TAG_READ:
+                _HandleRead(ok);
+                break;
+            case TAG_FINISH:
+                POS_TRACE_INFO(EID(HA_DEBUG_MSG), "Host write stream has been closed, status: {}",
+                    finishStatus.error_code());
+                cq.Shutdown();
+                break;
+        }
+    }
+}
+
+void
+GrpcHostWriteStream::_HandleStart(bool ok)
+{
+    std::unique_lock<std::mutex> lock(streamLock);
+    starting = false;
+    if (ok == false || broken == true)
+    {
+        _Break(lock);
+        return;
+    }
+
+    active = true;
+    reading = true;
+    call->Read(&ackBuffer, reinterpret_cast<void*>(TAG_READ));
+    POS_TRACE_INFO(EID(HA_DEBUG_MSG), "Host write stream has been established");
+}
+
+void
+GrpcHostWriteStream::_HandleWrite(bool ok)
+{
+    std::unique_lock<std::mutex> lock(streamLock);
+    writing = false;
+    if (ok == false || broken == true)
+    {
+        _Break(lock);
+        return;
+    }
+    _SendBatchIfPossible();
+}
+
+void
+GrpcHostWriteStream::_HandleRead(bool ok)
+{
+    HostWriteAck ack;
+    {
+        std::unique_lock<std::mutex> lock(streamLock);
+        reading = false;
+        if (ok == false || broken == true || DecodeAck(ackBuffer, ack) == false)
+        {
+            _Break(lock);
+            return;
+        }
+        reading = true;
+        call->Read(&ackBuffer, reinterpret_cast<void*>(TAG_READ));
+    }
+    _HandleAck(ack);
+}
+
+void
+GrpcHostWriteStream::_HandleAck(const HostWriteAck& ack)
+{
+    std::vector<AckedHostWrite> acked;
+    {
+        std::unique_lock<std::mutex> lock(streamLock);
+        window.Acknowledge(ack.batchId, ack.lastLsn, acked);
+        _SendBatchIfPossible();
+    }
+
+    if (ack.successful == false)
+    {
+        POS_TRACE_WARN(EID(HA_HOST_WRITE_STREAM_FAIL),
+            "Replicator rejected host writes up to batch {}, count: {}", ack.batchId, acked.size());
+    }
+    for (auto& write : acked)
+    {
+        if (ack.successful == true)
+        {
+            ackHandler(write.first, write.second);
+        }
+        else
+        {
+            failHandler(write.second);
+        }
+    }
+}
+
+void
+GrpcHostWriteStream::_SendBatchIfPossible(void)
+{
+    if (active == false || writing == true)
+    {
+        return;
+    }
+
+    uint64_t batchId = 0;
+    std::vector<HostWriteStreamEntry> writes;
+    if (window.PopBatch(batchId, writes) == false)
+    {
+        return;
+    }
+
+    grpc::ByteBuffer buffer;
+    EncodeBatch(batchId, writes, buffer);
+    writing = true;
+    call->Write(buffer, reinterpret_cast<void*>(TAG_WRITE));
+}
+
+void
+GrpcHostWriteStream::_Break(std::unique_lock<std::mutex>& lock)
+{
+    active = false;
+    std::vector<HostWriteStreamEntry> remaining;
+    if (broken == false)
+    {
+        broken = true;
+        context.TryCancel();
+        window.Drain(remaining);
+    }
+    _FinishIfIdle();
+    lock.unlock();
+
+    if (remaining.empty() == false)
+    {
+        POS_TRACE_WARN(EID(HA_HOST_WRITE_STREAM_FAIL),
+            "Host write stream is broken, {} writes fall back to PushHostWrite", remaining.size());
+    }
+    for (auto& entry : remaining)
+    {
+        failHandler(entry);
+    }
+}
+
+void
+GrpcHostWriteStream::_FinishIfIdle(void)
+{
+    if (starting == true || writing == true || reading == true || finishing == true)
+    {
+        return;
+    }
+    finishing = true;
+    call->Finish(&finishStatus, reinterpret_cast<void*>(TAG_FINISH));
+}
+} // namespace pos
@@ -0,0 +1,126 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <grpc++/generic/generic_stub.h>
+#include <grpc++/grpc++.h>
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "src/pos_replicator/host_write_window.h"
+
+namespace pos
+{
+struct HostWriteAck
+{
+    bool successful;
+    uint64_t batchId;
+    uint64_t lastLsn;
+};
+
+using HostWriteStreamAckHandler = std::function<void(uint64_t lsn, HostWriteStreamEntry& entry)>;
+using HostWriteStreamFailHandler = std::function<void(HostWriteStreamEntry& entry)>;
+
+// Client side of ReplicatorIoService.PushHostWriteStream. Host writes are
+// sent as PushHostWriteBatch messages on a single bidirectional call, and the
+// replicator answers with cumulative PushHostWriteAck messages (see
+// replicator_rpc.proto). The batch is encoded here rather than through the
+// generated message classes so that the data of each write goes out as a
+// grpc slice referencing the VolumeIo buffer.
+// Writes still queued or unacknowledged when the call breaks are handed to
+// failHandler, which is expected to replicate them with PushHostWrite.
+class GrpcHostWriteStream
+{
+public:
+    GrpcHostWriteStream(std::shared_ptr<grpc::Channel> channel, uint32_t windowSize,
+        uint32_t maxBatchCount, bool compression,
+        HostWriteStreamAckHandler ackHandler, HostWriteStreamFailHandler failHandler);
+    virtual ~GrpcHostWriteStream(void);
+
+    void Start(void);
+    void Stop(void);
+    bool IsActive(void);
+    bool Push(const HostWriteStreamEntry& entry);
+
+    static void EncodeBatch(uint64_t batchId, std::vector<HostWriteStreamEntry>& writes,
+        grpc::ByteBuffer& buffer);
+    static bool DecodeAck(const grpc::ByteBuffer& buffer, HostWriteAck& ack);
+
+    static const char* METHOD_NAME;
+
+private:
+    enum StreamTag
+    {
+        TAG_START = 1,
+        TAG_WRITE,
+        TAG_READ,
+        TAG_FINISH
+    };
+
+    void _Poll(void);
+    void _HandleStart(bool ok);
+    void _HandleWrite(bool ok);
+    void _HandleRead(bool ok);
+    void _HandleAck(const HostWriteAck& ack);
+    void _SendBatchIfPossible(void);
+    void _Break(std::unique_lock<std::mutex>& lock);
+    void _FinishIfIdle(void);
+
+    std::shared_ptr<grpc::Channel> channel;
+    bool compression;
+    HostWriteStreamAckHandler ackHandler;
+    HostWriteStreamFailHandler failHandler;
+
+    std::mutex streamLock;
+    HostWriteWindow window;
+    bool active;
+    bool broken;
+    bool starting;
+    bool writing;
+    bool reading;
+    bool finishing;
+
+    grpc::GenericStub stub;
+    grpc::CompletionQueue cq;
+    grpc::ClientContext context;
+    std::unique_ptr<grpc::GenericClientAsyncReaderWriter> call;
+    grpc::ByteBuffer ackBuffer;
+    grpc::Status finishStatus;
+    std::thread* poller;
+};
+} // namespace pos
@@ -40,15 +40,19 @@
 
 #include "src/include/array_config.h"
 #include "src/include/grpc_server_socket_address.h"
+#include "src/include/memory.h"
 #include "src/include/pos_event_id.h"
 #include "src/logger/logger.h"
 #include "src/master_context/config_manager.h"
+#include "src/pos_replicator/grpc_host_write_stream.h"
+#include "src/pos_replicator/posreplicator_config.h"
 
 namespace pos
 {
 GrpcPublisher::GrpcPublisher(std::shared_ptr<grpc::Channel> channel_, ConfigManager* configManager)
 : channel(channel_),
-  configManager(configManager)
+  configManager(configManager),
+  hostWriteStream(nullptr)
 {
     std::string serverAddress;
     int ret = configManager->GetValue("replicator", "ha_publisher_address",
@@ -64,6 +68,11 @@ GrpcPublisher::GrpcPublisher(std::shared_ptr<grpc::Channel> channel_, ConfigMana
 
 GrpcPublisher::~GrpcPublisher(void)
 {
+    if (hostWriteStream != nullptr)
+    {
+        delete hostWriteStream;
+        hostWriteStream = nullptr;
+    }
     POS_TRACE_INFO(EID(HA_DEBUG_MSG), "Replicator publisher has been destructed");
 }
 
@@ -80,9 +89,51 @@ GrpcPublisher::_ConnectGrpcServer(std::string targetAddress)
     }
 
     stub = ::replicator_rpc::ReplicatorIoService::NewStub(channel);
+    _StartHostWriteStream();
     POS_TRACE_INFO(EID(HA_DEBUG_MSG), "Replicator publisher has been initialized with the channel newly established on {}", targetAddress);
 }
 
+void
+GrpcPublisher::_StartHostWriteStream(void)
+{
+    bool enabled = false;
+    int ret = configManager->GetValue("replicator", "host_write_stream_enable",
+        static_cast<void*>(&enabled), CONFIG_TYPE_BOOL);
+    if (ret != EID(SUCCESS) || enabled == false)
+    {
+        return;
+    }
+
+    uint32_t windowSize = DEFAULT_HOST_WRITE_STREAM_WINDOW;
+    ret = configManager->GetValue("replicator", "host_write_stream_window",
+        static_cast<void*>(&windowSize), CONFIG_TYPE_UINT32);
+    if (ret != EID(SUCCESS) || windowSize == 0)
+    {
+        windowSize = DEFAULT_HOST_WRITE_STREAM_WINDOW;
+    }
+    uint32_t batchCount = DEFAULT_HOST_WRITE_STREAM_BATCH;
+    ret = configManager->GetValue("replicator", "host_write_stream_batch",
+        static_cast<void*>(&batchCount), CONFIG_TYPE_UINT32);
+    if (ret != EID(SUCCESS) || batchCount == 0)
+    {
+        batchCount = DEFAULT_HOST_WRITE_STREAM_BATCH;
+    }
+    bool compression = false;
+    ret = configManager->GetValue("replicator", "host_write_stream_compression",
+        static_cast<void*>(&compression), CONFIG_TYPE_BOOL);
+    if (ret != EID(SUCCESS))
+    {
+        compression = false;
+    }
+
+    hostWriteStream = new GrpcHostWriteStream(channel, windowSize, batchCount, compression,
+        std::bind(&GrpcPublisher::_AcknowledgeHostWrite, this, std::placeholders::_1, std::placeholders::_2),
+        std::bind(&GrpcPublisher::_PushHostWriteWithoutStream, this, std::placeholders::_1));
+    hostWriteStream->Start();
+    POS_TRACE_INFO(EID(HA_DEBUG_MSG), "Host write stream is enabled, window: {}, batch: {}, compression: {}",
+        windowSize, batchCount, compression);
+}
+
 bool
 GrpcPublisher::_WaitUntilReady(void)
 {
@@ -158,6 +209,53 @@ GrpcPublisher::PushHostWrite(string arrayName, string volumeName, uint64_t rba,
     return EID(SUCCESS);
 }
 
+int
+GrpcPublisher::StreamHostWrite(string arrayName, string volumeName, VolumeIoSmartPtr volumeIo)
+{
+    HostWriteStreamEntry entry{arrayName, volumeName, volumeIo->GetSectorRba(),
+        ChangeByteToSector(volumeIo->GetSize()), volumeIo};
+    if (hostWriteStream == nullptr || hostWriteStream->Push(entry) == false)
+    {
+        _PushHostWriteWithoutStream(entry);
+    }
+    return EID(SUCCESS);
+}
+
+bool
+GrpcPublisher::IsHostWriteStreamActive(void)
+{
+    return hostWriteStream != nullptr && hostWriteStream->IsActive();
+}
+
+void
+GrpcPublisher::SetHostWriteAckHandler(HostWriteAckHandler handler)
+{
+    hostWriteAckHandler = handler;
+}
+
+void
+GrpcPublisher::_AcknowledgeHostWrite(uint64_t lsn, HostWriteStreamEntry& entry)
+{
+    POS_TRACE_DEBUG(EID(HA_DEBUG_MSG), "PushHostWriteStream, array_name: {}, volume_name: {}, rba: {}, num_blocks:{}, lsn: {}",
+        entry.arrayName, entry.volumeName, entry.rba, entry.numBlocks, lsn);
+    if (hostWriteAckHandler != nullptr)
+    {
+        hostWriteAckHandler(lsn, entry.volumeIo);
+    }
+}
+
+void
+GrpcPublisher::_PushHostWriteWithoutStream(HostWriteStreamEntry& entry)
+{
+    uint64_t lsn = 0;
+    int ret = PushHostWrite(entry.arrayName, entry.volumeName, entry.rba, entry.numBlocks,
+        entry.volumeIo->GetBuffer(), lsn);
+    if (ret == EID(SUCCESS))
+    {
+        _AcknowledgeHostWrite(lsn, entry);
+    }
+}
+
 int
 GrpcPublisher::CompleteUserWrite(uint64_t lsn, string volumeName, string arrayName)
 {
@@ -33,28 +33,39 @@
 #pragma once
 
 #include <grpc++/grpc++.h>
+#include <functional>
 #include <memory>
 #include <string>
 
 #include "proto/generated/cpp/replicator_rpc.grpc.pb.h"
 #include "proto/generated/cpp/replicator_rpc.pb.h"
+#include "src/bio/volume_io.h"
 #include "src/helper/json/json_helper.h"
 
 namespace pos
 {
 class ConfigManager;
+class GrpcHostWriteStream;
+struct HostWriteStreamEntry;
+
+using HostWriteAckHandler = std::function<void(uint64_t lsn, VolumeIoSmartPtr volumeIo)>;
 
 class GrpcPublisher
 {
 public:
     GrpcPublisher(std::shared_ptr<grpc::Channel> channel_, ConfigManager* configManager);
-    ~GrpcPublisher(void);
+    virtual ~GrpcPublisher(void);
 
     int PushDirtyLog(std::string arrayName, std::string volumeName, uint64_t rba, uint64_t numBlocks);
     int PushHostWrite(string arrayName, string volumeName, uint64_t rba, uint64_t numBlocks, void* buffer, uint64_t& lsn);
+    // Replicates the host write on the PushHostWriteStream call. The ack
+    // handler receives the LSN of the write once the replicator has accepted it.
+    int StreamHostWrite(string arrayName, string volumeName, VolumeIoSmartPtr volumeIo);
+    bool IsHostWriteStreamActive(void);
+    void SetHostWriteAckHandler(HostWriteAckHandler handler);
     int CompleteUserWrite(uint64_t lsn, std::string volumeName, string arrayName);
-    int CompleteWrite(std::string arrayName, std::string volumeName, uint64_t rba, uint64_t numBlocks, uint64_t lsn);
-    int CompleteRead(std::string arrayName, std::string volumeName, uint64_t rba, uint64_t numBlocks, uint64_t lsn, void* buffer);
+    virtual int CompleteWrite(std::string arrayName, std::string volumeName, uint64_t rba, uint64_t numBlocks, uint64_t lsn);
+    virtual int CompleteRead(std::string arrayName, std::string volumeName, uint64_t rba, uint64_t numBlocks, uint64_t lsn, void* buffer);
 
     void WaitClientConnected(void);
 
@@ -63,9 +74,14 @@ private:
     bool _WaitUntilReady(void);
     void _InsertBlockToChunk(replicator_rpc::CompleteReadRequest& request, void* data, uint64_t numBlocks);
     void _InsertBlockToChunk(replicator_rpc::PushHostWriteRequest& request, void* data, uint64_t numBlocks);
+    void _StartHostWriteStream(void);
+    void _AcknowledgeHostWrite(uint64_t lsn, HostWriteStreamEntry& entry);
+    void _PushHostWriteWithoutStream(HostWriteStreamEntry& entry);
 
     std::shared_ptr<grpc::Channel> channel;
     ConfigManager* configManager;
     std::unique_ptr<replicator_rpc::ReplicatorIoService::Stub> stub;
+    GrpcHostWriteStream* hostWriteStream;
+    HostWriteAckHandler hostWriteAckHandler;
 };
 } // namespace pos
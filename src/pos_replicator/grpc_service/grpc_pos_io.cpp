@@ -85,8 +85,12 @@ GrpcPosIo::WriteBlocks(::grpc::ServerContext* context,
         return ret;
     }
 
-    PosReplicatorManagerSingleton::Instance()->HAIOSubmission(IO_TYPE::WRITE, arraySet.second, volumeSet.second,
+    int result = PosReplicatorManagerSingleton::Instance()->HAIOSubmission(IO_TYPE::WRITE, arraySet.second, volumeSet.second,
         request->rba(), request->num_blocks(), dataList, request->lsn());
+    if (result != EID(SUCCESS))
+    {
+        return ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, "The volume is being promoted to primary");
+    }
     return ::grpc::Status::OK;
 }
 
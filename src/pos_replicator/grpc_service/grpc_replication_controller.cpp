@@ -57,7 +57,23 @@ GrpcReplicationController::StartVolumeSync(
     bool is_primary = request->is_primary();
     if (is_primary)
     {
+        // A secondary taking over becomes writable once its replicated I/Os are done
+        if (replicatorManager->Promote() != EID(SUCCESS))
+        {
+            response->set_result(pos_rpc::PosResult::FAIL);
+            response->set_reason("Failed to complete the replicated writes before promotion");
+            return ::grpc::Status::OK;
+        }
         replicatorManager->SetVolumeCopyStatus(ReplicatorStatus::VOLUMECOPY_PrimaryVolumeCopy);
+        // Hand the regions changed since the last sync over as dirty logs
+        // so that the replicator copies only those
+        int ret = replicatorManager->PushDirtyRegions(request->array_name(), request->volume_name());
+        if (ret != EID(SUCCESS))
+        {
+            response->set_result(pos_rpc::PosResult::FAIL);
+            response->set_reason("Failed to push the dirty regions");
+            return ::grpc::Status::OK;
+        }
     }
     else
     {
@@ -78,6 +94,7 @@ GrpcReplicationController::FinishVolumeSync(
     ReplicatorStatus status = replicatorManager->GetVolumeCopyStatus();
     if (status == ReplicatorStatus::VOLUMECOPY_PrimaryVolumeCopyWriteSuspend)
     {
+        replicatorManager->ClearDirtyRegions(request->array_name(), request->volume_name());
         replicatorManager->SetVolumeCopyStatus(ReplicatorStatus::VOLUMECOPY_PrimaryLiveReplication);
     }
     else if (status == ReplicatorStatus::VOLUMECOPY_SecondaryVolumeCopy)
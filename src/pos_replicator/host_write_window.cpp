@@ -0,0 +1,125 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/pos_replicator/host_write_window.h"
+
+#include <algorithm>
+
+namespace pos
+{
+HostWriteWindow::HostWriteWindow(uint32_t windowSize, uint32_t maxBatchCount)
+: windowSize(std::max(windowSize, 1U)),
+  maxBatchCount(std::max(maxBatchCount, 1U)),
+  nextBatchId(1),
+  inflightCount(0)
+{
+}
+
+void
+HostWriteWindow::Enqueue(const HostWriteStreamEntry& entry)
+{
+    queued.push_back(entry);
+}
+
+bool
+HostWriteWindow::PopBatch(uint64_t& batchId, std::vector<HostWriteStreamEntry>& writes)
+{
+    if (queued.empty() || inflightCount >= windowSize)
+    {
+        return false;
+    }
+
+    uint32_t count = std::min(static_cast<uint32_t>(queued.size()),
+        std::min(maxBatchCount, windowSize - inflightCount));
+    Batch batch;
+    batch.batchId = nextBatchId++;
+    batch.writes.assign(queued.begin(), queued.begin() + count);
+    queued.erase(queued.begin(), queued.begin() + count);
+
+    batchId = batch.batchId;
+    writes = batch.writes;
+    inflightCount += count;
+    inflight.push_back(std::move(batch));
+    return true;
+}
+
+uint32_t
+HostWriteWindow::Acknowledge(uint64_t batchId, uint64_t lastLsn, std::vector<AckedHostWrite>& acked)
+{
+    uint32_t count = 0;
+    auto end = inflight.begin();
+    while (end != inflight.end() && end->batchId <= batchId)
+    {
+        count += end->writes.size();
+        end++;
+    }
+
+    // The writes of the acknowledged batches were given consecutive LSNs
+    // in the order they were sent, ending with lastLsn.
+    uint64_t lsn = lastLsn - count + 1;
+    for (auto it = inflight.begin(); it != end; it++)
+    {
+        for (auto& write : it->writes)
+        {
+            acked.push_back(AckedHostWrite(lsn++, write));
+        }
+    }
+    inflight.erase(inflight.begin(), end);
+    inflightCount -= count;
+    return count;
+}
+
+void
+HostWriteWindow::Drain(std::vector<HostWriteStreamEntry>& remaining)
+{
+    for (auto& batch : inflight)
+    {
+        remaining.insert(remaining.end(), batch.writes.begin(), batch.writes.end());
+    }
+    remaining.insert(remaining.end(), queued.begin(), queued.end());
+    inflight.clear();
+    queued.clear();
+    inflightCount = 0;
+}
+
+uint32_t
+HostWriteWindow::GetQueuedCount(void)
+{
+    return queued.size();
+}
+
+uint32_t
+HostWriteWindow::GetInflightCount(void)
+{
+    return inflightCount;
+}
+} // namespace pos
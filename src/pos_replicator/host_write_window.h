@@ -0,0 +1,89 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "src/bio/volume_io.h"
+
+namespace pos
+{
+struct HostWriteStreamEntry
+{
+    std::string arrayName;
+    std::string volumeName;
+    uint64_t rba;
+    uint64_t numBlocks;
+    VolumeIoSmartPtr volumeIo;
+};
+
+using AckedHostWrite = std::pair<uint64_t, HostWriteStreamEntry>;
+
+// Keeps the host writes of a replication stream in LSN order: queued writes
+// are cut into batches of at most maxBatchCount writes, and no more than
+// windowSize writes stay unacknowledged at any time. An acknowledgement is
+// cumulative, so it retires every inflight batch up to the given batch id.
+// The window is not thread safe; the owning stream serializes the accesses.
+class HostWriteWindow
+{
+public:
+    HostWriteWindow(uint32_t windowSize, uint32_t maxBatchCount);
+    virtual ~HostWriteWindow(void) = default;
+
+    void Enqueue(const HostWriteStreamEntry& entry);
+    bool PopBatch(uint64_t& batchId, std::vector<HostWriteStreamEntry>& writes);
+    uint32_t Acknowledge(uint64_t batchId, uint64_t lastLsn, std::vector<AckedHostWrite>& acked);
+    void Drain(std::vector<HostWriteStreamEntry>& remaining);
+
+    uint32_t GetQueuedCount(void);
+    uint32_t GetInflightCount(void);
+
+private:
+    struct Batch
+    {
+        uint64_t batchId;
+        std::vector<HostWriteStreamEntry> writes;
+    };
+
+    uint32_t windowSize;
+    uint32_t maxBatchCount;
+    uint64_t nextBatchId;
+    uint32_t inflightCount;
+    std::deque<HostWriteStreamEntry> queued;
+    std::deque<Batch> inflight;
+};
+} // namespace pos
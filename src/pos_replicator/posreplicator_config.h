@@ -41,6 +41,9 @@ namespace pos
 {
 const int HA_INVALID_ARRAY_IDX = 0xFFFFFFFF;
 const int HA_INVALID_VOLUME_IDX = 0xFFFFFFFF;
+const uint32_t DEFAULT_HOST_WRITE_STREAM_WINDOW = 256;
+const uint32_t DEFAULT_HOST_WRITE_STREAM_BATCH = 32;
+const uint32_t DEFAULT_DIRTY_BITMAP_WRITEBACK_INTERVAL_MS = 100;
 } // namespace pos
 
 #endif
\ No newline at end of file
@@ -31,6 +31,9 @@
  */
 #include "posreplicator_manager.h"
 
+#include <algorithm>
+#include <chrono>
+
 #include "spdk/pos.h"
 #include "src/event_scheduler/callback.h"
 #include "src/include/pos_event_id.h"
@@ -43,6 +46,7 @@
 #include "src/pos_replicator/grpc_subscriber.h"
 #include "src/pos_replicator/pos_replicator_io_completion.h"
 #include "src/pos_replicator/posreplicator_status.h"
+#include "src/pos_replicator/replication_dirty_bitmap.h"
 #include "src/pos_replicator/replicator_volume_subscriber.h"
 #include "src/qos/qos_manager.h"
 #include "src/sys_event/volume_event.h"
@@ -62,6 +66,8 @@ PosReplicatorManager::PosReplicatorManager(void)
 PosReplicatorManager::PosReplicatorManager(AIO* aio, TelemetryPublisher* telemetryPublisher)
 : aio(aio),
   telemetryPublisher(telemetryPublisher),
+  numReplicatedWritesInFlight(0),
+  isReplicatedWriteFenced(false),
   volumeSubscriberCnt(0),
   isEnabled(false)
 {
@@ -69,6 +75,10 @@ PosReplicatorManager::PosReplicatorManager(AIO* aio, TelemetryPublisher* telemet
     for (int i = 0; i < ArrayMgmtPolicy::MAX_ARRAY_CNT; i++)
     {
         items[i] = nullptr;
+        for (int j = 0; j < MAX_VOLUME_COUNT; j++)
+        {
+            lastWaitLsn[i][j] = 0;
+        }
     }
 
     arrayConvertTable.clear();
@@ -96,6 +106,8 @@ PosReplicatorManager::Init(GrpcPublisher* publisher, GrpcSubscriber* subscriber,
         replicatorStatus.Set(ReplicatorStatus::VOLUMECOPY_None);
         grpcPublisher = publisher;
         grpcSubscriber = subscriber;
+        grpcPublisher->SetHostWriteAckHandler(std::bind(&PosReplicatorManager::_AddWaitPOSIoRequest,
+            this, std::placeholders::_1, std::placeholders::_2));
         isEnabled = true;
         POS_TRACE_INFO(EID(HA_DEBUG_MSG), "PosReplicatorManager has been initialized");
     }
@@ -201,6 +213,18 @@ PosReplicatorManager::Unregister(int arrayId)
 int
 PosReplicatorManager::HAIOSubmission(IO_TYPE ioType, int arrayId, int volumeId, uint64_t rba, uint64_t numChunks, std::shared_ptr<char*> dataList, uint64_t lsn)
 {
+    if (ioType == IO_TYPE::WRITE)
+    {
+        std::lock_guard<std::mutex> lock(replicatedWriteLock);
+        if (isReplicatedWriteFenced == true)
+        {
+            POS_TRACE_WARN(EID(HA_REPLICATED_WRITE_FENCED), "lsn:{}, array_id:{}, volume_id:{}, rba:{}",
+                lsn, arrayId, volumeId, rba);
+            return EID(HA_REPLICATED_WRITE_FENCED);
+        }
+        numReplicatedWritesInFlight++;
+    }
+
     VolumeIoSmartPtr volumeIo = _MakeVolumeIo(ioType, arrayId, volumeId, rba, numChunks);
     // TODO (cheolho.kang): Should add the error handling. if nullptr return
 
@@ -223,6 +247,7 @@ PosReplicatorManager::HAIOCompletion(uint64_t lsn, VolumeIoSmartPtr volumeIo, ui
             break;
         case UbioDir::Write:
             HAWriteCompletion(lsn, volumeIo, originRba, originNumChunks);
+            _CompleteReplicatedWrite();
             break;
         default:
             std::string errorMsg = "Wrong IO direction (only read/write types are supported). input dir: " + std::to_string((uint32_t)volumeIo->dir);
@@ -332,6 +357,14 @@ PosReplicatorManager::HandleHostWrite(VolumeIoSmartPtr volumeIo)
         }
 
         ReplicatorStatus currentStatus = replicatorStatus.Get();
+        ReplicationDirtyBitmap* dirtyBitmap = _GetDirtyBitmap(volumeIo->GetArrayId());
+        if (dirtyBitmap != nullptr)
+        {
+            // Only a live replicated write can be cleaned up by its acknowledgement
+            bool waitAck = (currentStatus == ReplicatorStatus::VOLUMECOPY_PrimaryLiveReplication);
+            dirtyBitmap->MarkDirty(volumeIo->GetVolumeId(), volumeIo->GetSectorRba(), ChangeByteToSector(volumeIo->GetSize()), waitAck);
+        }
+
         if (currentStatus == ReplicatorStatus::VOLUMECOPY_PrimaryVolumeCopy)
         {
             result = grpcPublisher->PushDirtyLog(arrayName, volumeName, volumeIo->GetSectorRba(), ChangeByteToSector(volumeIo->GetSize()));
@@ -347,6 +380,11 @@ PosReplicatorManager::HandleHostWrite(VolumeIoSmartPtr volumeIo)
         }
         else if (currentStatus == ReplicatorStatus::VOLUMECOPY_PrimaryLiveReplication)
         {
+            if (grpcPublisher->IsHostWriteStreamActive() == true)
+            {
+                // The write is submitted once its LSN is acknowledged on the stream
+                return grpcPublisher->StreamHostWrite(arrayName, volumeName, volumeIo);
+            }
             uint64_t lsn = 0;
             result = grpcPublisher->PushHostWrite(arrayName, volumeName, volumeIo->GetSectorRba(), ChangeByteToSector(volumeIo->GetSize()), volumeIo->GetBuffer(), lsn);
             _AddWaitPOSIoRequest(lsn, volumeIo);
@@ -371,17 +409,106 @@ int
 PosReplicatorManager::CompleteUserIO(uint64_t lsn, int arrayId, int volumeId)
 {
     VolumeIoSmartPtr volumeIo;
-    auto itr = waitPosIoRequest[arrayId][volumeId].find(lsn);
-    if (itr != waitPosIoRequest[arrayId][volumeId].end())
     {
+        std::lock_guard<std::mutex> lock(waitLock);
+        auto itr = waitPosIoRequest[arrayId][volumeId].find(lsn);
+        if (itr == waitPosIoRequest[arrayId][volumeId].end())
+        {
+            // The acknowledgement of a streamed write can reach us after the
+            // replicator has already completed it. Keep the LSN so that the
+            // write is submitted as soon as it is acknowledged.
+            if (lsn > lastWaitLsn[arrayId][volumeId])
+            {
+                completedBeforeWait[arrayId][volumeId].insert(lsn);
+            }
+            POS_TRACE_WARN(EID(HA_REQUESTED_NOT_FOUND), "Not Found Request lsn : {}, array Idx : {}, volume Idx : {}", lsn, arrayId, volumeId);
+            return EID(HA_REQUESTED_NOT_FOUND);
+        }
         volumeIo = itr->second;
+        waitPosIoRequest[arrayId][volumeId].erase(itr);
     }
-    else
+
+    _SubmitHostWrite(volumeIo);
+    return EID(SUCCESS);
+}
+
+int
+PosReplicatorManager::PushDirtyRegions(std::string arrayName, std::string volumeName)
+{
+    std::pair<std::string, int> arraySet(arrayName, HA_INVALID_ARRAY_IDX);
+    std::pair<std::string, int> volumeSet(volumeName, HA_INVALID_VOLUME_IDX);
+    int ret = ConvertNameToIdx(arraySet, volumeSet);
+    if (ret != EID(SUCCESS))
+    {
+        return ret;
+    }
+
+    ReplicationDirtyBitmap* dirtyBitmap = _GetDirtyBitmap(arraySet.second);
+    if (dirtyBitmap == nullptr)
+    {
+        return EID(SUCCESS);
+    }
+
+    std::vector<DirtyExtent> extents;
+    dirtyBitmap->GetDirtyExtents(volumeSet.second, extents);
+    for (auto& extent : extents)
+    {
+        ret = grpcPublisher->PushDirtyLog(arrayName, volumeName, extent.first, extent.second);
+        if (ret != EID(SUCCESS))
+        {
+            POS_TRACE_ERROR(EID(HA_DIRTY_BITMAP_IO_FAIL),
+                "Failed to push the dirty regions, array_name: {}, volume_name: {}, rba: {}, num_blocks: {}",
+                arrayName, volumeName, extent.first, extent.second);
+            return ret;
+        }
+    }
+
+    POS_TRACE_INFO(EID(HA_DEBUG_MSG), "Dirty regions are pushed, array_name: {}, volume_name: {}, extent_count: {}, region_size: {}",
+        arrayName, volumeName, extents.size(), dirtyBitmap->GetRegionSize(volumeSet.second));
+    return EID(SUCCESS);
+}
+
+void
+PosReplicatorManager::ClearDirtyRegions(std::string arrayName, std::string volumeName)
+{
+    std::pair<std::string, int> arraySet(arrayName, HA_INVALID_ARRAY_IDX);
+    std::pair<std::string, int> volumeSet(volumeName, HA_INVALID_VOLUME_IDX);
+    if (ConvertNameToIdx(arraySet, volumeSet) != EID(SUCCESS))
+    {
+        return;
+    }
+
+    ReplicationDirtyBitmap* dirtyBitmap = _GetDirtyBitmap(arraySet.second);
+    if (dirtyBitmap != nullptr)
+    {
+        dirtyBitmap->ClearVolume(volumeSet.second);
+    }
+}
+
+ReplicationDirtyBitmap*
+PosReplicatorManager::_GetDirtyBitmap(int arrayId)
+{
+    if (arrayId < 0 || arrayId >= ArrayMgmtPolicy::MAX_ARRAY_CNT)
+    {
+        return nullptr;
+    }
+
+    std::unique_lock<std::mutex> lock(listMutex);
+    if (items[arrayId] == nullptr)
+    {
+        return nullptr;
+    }
+    return items[arrayId]->GetDirtyBitmap();
+}
+
+void
+PosReplicatorManager::_SubmitHostWrite(VolumeIoSmartPtr volumeIo)
+{
+    ReplicationDirtyBitmap* dirtyBitmap = _GetDirtyBitmap(volumeIo->GetArrayId());
+    if (dirtyBitmap != nullptr)
     {
-        POS_TRACE_WARN(EID(HA_REQUESTED_NOT_FOUND), "Not Found Request lsn : {}, array Idx : {}, volume Idx : {}", lsn, arrayId, volumeId);
-        return EID(HA_REQUESTED_NOT_FOUND);
+        dirtyBitmap->Acknowledge(volumeIo->GetVolumeId(), volumeIo->GetSectorRba(), ChangeByteToSector(volumeIo->GetSize()));
     }
-    waitPosIoRequest[arrayId][volumeId].erase(lsn);
 
     if (true == QosManagerSingleton::Instance()->IsFeQosEnabled())
     {
@@ -393,8 +520,6 @@ PosReplicatorManager::CompleteUserIO(uint64_t lsn, int arrayId, int volumeId)
         AIO aio;
         aio.SubmitAsyncIO(volumeIo);
     }
-
-    return EID(SUCCESS);
 }
 
 bool
@@ -410,6 +535,11 @@ PosReplicatorManager::SetVolumeCopyStatus(ReplicatorStatus status)
     // TODO(cheolho.kang): add argument to speicific volume index
     // TODO(cheolho.kang): add status list each volume
     replicatorStatus.Set(status);
+    if (_IsSecondary(status) == true)
+    {
+        std::lock_guard<std::mutex> fenceLock(replicatedWriteLock);
+        isReplicatedWriteFenced = false;
+    }
 
     POSMetricValue v;
     v.gauge = static_cast<uint64_t>(status);
@@ -426,6 +556,62 @@ PosReplicatorManager::GetVolumeCopyStatus(void)
     return result;
 }
 
+// A secondary applies the replicated writes through the I/O path of its own
+// array, so its mapper, allocator and journal are already up to date and it
+// can take over without mounting and replaying again. It only waits for the
+// replicated I/Os in flight, so that no host write to the new primary races
+// with an older replicated write of the same blocks. Replicated writes
+// arriving after the promotion has started are refused, so the drain ends
+int
+PosReplicatorManager::Promote(uint32_t timeoutInSec)
+{
+    ReplicatorStatus status = GetVolumeCopyStatus();
+    if (_IsSecondary(status) == false)
+    {
+        return EID(SUCCESS);
+    }
+
+    auto startedAt = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> lock(replicatedWriteLock);
+    isReplicatedWriteFenced = true;
+    bool drained = replicatedWritesDrained.wait_for(lock, std::chrono::seconds(timeoutInSec),
+        [this] { return numReplicatedWritesInFlight == 0; });
+    if (drained == false)
+    {
+        // Stay a secondary and keep applying the replicated writes
+        isReplicatedWriteFenced = false;
+        POS_TRACE_ERROR(EID(HA_PROMOTION_TIMEOUT),
+            "status:{}, replicated_writes_in_flight:{}, timeout_sec:{}",
+            status, numReplicatedWritesInFlight, timeoutInSec);
+        return EID(HA_PROMOTION_TIMEOUT);
+    }
+    lock.unlock();
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - startedAt);
+    POS_TRACE_INFO(EID(HA_PROMOTED), "previous_status:{}, elapsed_usec:{}",
+        status, elapsed.count());
+    return EID(SUCCESS);
+}
+
+void
+PosReplicatorManager::_CompleteReplicatedWrite(void)
+{
+    std::lock_guard<std::mutex> lock(replicatedWriteLock);
+    numReplicatedWritesInFlight--;
+    if (numReplicatedWritesInFlight == 0)
+    {
+        replicatedWritesDrained.notify_all();
+    }
+}
+
+bool
+PosReplicatorManager::_IsSecondary(ReplicatorStatus status)
+{
+    return (status == ReplicatorStatus::VOLUMECOPY_SecondaryVolumeCopy)
+        || (status == ReplicatorStatus::VOLUMECOPY_SecondaryLiveReplication);
+}
+
 VolumeIoSmartPtr
 PosReplicatorManager::_MakeVolumeIo(IO_TYPE ioType, int arrayId, int volumeId, uint64_t rba, uint64_t numChunks, std::shared_ptr<char*> dataList)
 {
@@ -531,7 +717,20 @@ PosReplicatorManager::_ConvertVolumeNameToId(std::string volumeName, int arrayId
 void
 PosReplicatorManager::_AddWaitPOSIoRequest(uint64_t lsn, VolumeIoSmartPtr volumeIo)
 {
-    waitPosIoRequest[volumeIo->GetArrayId()][volumeIo->GetVolumeId()].insert({lsn, volumeIo});
+    int arrayId = volumeIo->GetArrayId();
+    uint32_t volumeId = volumeIo->GetVolumeId();
+    {
+        std::lock_guard<std::mutex> lock(waitLock);
+        lastWaitLsn[arrayId][volumeId] = std::max(lastWaitLsn[arrayId][volumeId], lsn);
+        auto itr = completedBeforeWait[arrayId][volumeId].find(lsn);
+        if (itr == completedBeforeWait[arrayId][volumeId].end())
+        {
+            waitPosIoRequest[arrayId][volumeId].insert({lsn, volumeIo});
+            return;
+        }
+        completedBeforeWait[arrayId][volumeId].erase(itr);
+    }
+    _SubmitHostWrite(volumeIo);
 }
 
 void
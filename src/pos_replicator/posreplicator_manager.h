@@ -32,9 +32,12 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "lib/spdk/include/spdk/pos_volume.h"
 #include "proto/generated/cpp/pos_rpc.grpc.pb.h"
@@ -52,6 +55,7 @@ class AIO;
 class ConfigManager;
 class GrpcPublisher;
 class GrpcSubscriber;
+class ReplicationDirtyBitmap;
 class ReplicatorVolumeSubscriber;
 class TelemetryPublisher;
 
@@ -76,12 +80,16 @@ public:
     void HAReadCompletion(uint64_t lsn, VolumeIoSmartPtr volumeIo, uint64_t originRba, uint64_t originNumChunks);
     int HandleHostWrite(VolumeIoSmartPtr volumeIo);
     int CompleteUserIO(uint64_t lsn, int arrayId, int volumeId);
+    int PushDirtyRegions(std::string arrayName, std::string volumeName);
+    void ClearDirtyRegions(std::string arrayName, std::string volumeName);
 
     int ConvertIdToName(int arrayId, int volumeId, std::string& arrayName, std::string& volumeName);
     int ConvertNameToIdx(std::pair<std::string, int>& arraySet, std::pair<std::string, int>& volumeSet);
 
     void SetVolumeCopyStatus(ReplicatorStatus status);
     ReplicatorStatus GetVolumeCopyStatus(void);
+    static const uint32_t PROMOTION_TIMEOUT_IN_SEC = 30;
+    int Promote(uint32_t timeoutInSec = PROMOTION_TIMEOUT_IN_SEC);
     virtual bool IsEnabled(void) override;
 
 private:
@@ -95,12 +103,27 @@ private:
     int _ConvertVolumeNameToId(std::string volumeName, int arrayId);
 
     void _AddWaitPOSIoRequest(uint64_t lsn, VolumeIoSmartPtr volumeIo);
+    void _SubmitHostWrite(VolumeIoSmartPtr volumeIo);
+    ReplicationDirtyBitmap* _GetDirtyBitmap(int arrayId);
 
     void _PublishIopsMetrics(IO_TYPE ioType, VolumeIoSmartPtr volumeIo);
+    void _CompleteReplicatedWrite(void);
+    bool _IsSecondary(ReplicatorStatus status);
 
     AIO* aio;
     TelemetryPublisher* telemetryPublisher;
     std::unordered_map<uint64_t, VolumeIoSmartPtr> waitPosIoRequest[ArrayMgmtPolicy::MAX_ARRAY_CNT][MAX_VOLUME_COUNT];
+    std::unordered_set<uint64_t> completedBeforeWait[ArrayMgmtPolicy::MAX_ARRAY_CNT][MAX_VOLUME_COUNT];
+    uint64_t lastWaitLsn[ArrayMgmtPolicy::MAX_ARRAY_CNT][MAX_VOLUME_COUNT];
+    std::mutex waitLock;
+
+    // Replicated writes submitted to the array and not completed yet. New
+    // ones are refused from the start of a promotion until this node becomes
+    // a secondary again
+    std::mutex replicatedWriteLock;
+    std::condition_variable replicatedWritesDrained;
+    uint64_t numReplicatedWritesInFlight;
+    bool isReplicatedWriteFenced;
 
     int volumeSubscriberCnt;
     ReplicatorVolumeSubscriber* items[ArrayMgmtPolicy::MAX_ARRAY_CNT];
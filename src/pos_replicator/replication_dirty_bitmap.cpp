@@ -0,0 +1,531 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/pos_replicator/replication_dirty_bitmap.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "src/include/memory.h"
+#include "src/include/pos_event_id.h"
+#include "src/logger/logger.h"
+#include "src/meta_file_intf/rocksdb_metafs_intf.h"
+#include "src/metafs/config/metafs_config_manager.h"
+#include "src/metafs/include/metafs_service.h"
+#include "src/metafs/metafs_file_intf.h"
+#include "src/pos_replicator/posreplicator_config.h"
+#include "src/volume/volume_base.h"
+
+namespace pos
+{
+ReplicationDirtyBitmap::ReplicationDirtyBitmap(int arrayId)
+: ReplicationDirtyBitmap(arrayId, nullptr, DEFAULT_DIRTY_BITMAP_WRITEBACK_INTERVAL_MS)
+{
+    if (MetaFsServiceSingleton::Instance()->GetConfigManager()->IsRocksdbEnabled())
+    {
+        file = new RocksDBMetaFsIntf(fileName, arrayId, MetaFileType::General);
+    }
+    else
+    {
+        file = new MetaFsFileIntf(fileName, arrayId, MetaFileType::General);
+    }
+}
+
+ReplicationDirtyBitmap::ReplicationDirtyBitmap(int arrayId, MetaFileIntf* file, uint32_t writebackIntervalMs)
+: arrayId(arrayId),
+  fileName("ReplicationDirtyBitmap.bin"),
+  file(file),
+  writebackIntervalMs(writebackIntervalMs),
+  maps(MAX_VOLUME_COUNT),
+  stopWriteback(false),
+  writebackThread(nullptr)
+{
+    for (auto& map : maps)
+    {
+        _ResetMap(map);
+    }
+}
+
+ReplicationDirtyBitmap::~ReplicationDirtyBitmap(void)
+{
+    Dispose();
+    if (file != nullptr)
+    {
+        delete file;
+        file = nullptr;
+    }
+}
+
+int
+ReplicationDirtyBitmap::Init(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(mapLock);
+        for (auto& map : maps)
+        {
+            _ResetMap(map);
+        }
+    }
+
+    int ret = 0;
+    if (file->DoesFileExist() == false)
+    {
+        uint64_t fileSize = HEADER_SIZE + static_cast<uint64_t>(MAX_VOLUME_COUNT) * SLOT_SIZE;
+        ret = file->Create(fileSize);
+        if (ret != 0)
+        {
+            POS_TRACE_ERROR(EID(HA_DIRTY_BITMAP_IO_FAIL), "Failed to create {}, array_id:{}, ret:{}", fileName, arrayId, ret);
+            return ret;
+        }
+        ret = file->Open();
+    }
+    else
+    {
+        ret = file->Open();
+        if (ret == 0)
+        {
+            ret = _Load();
+        }
+    }
+
+    if (ret != 0)
+    {
+        POS_TRACE_ERROR(EID(HA_DIRTY_BITMAP_IO_FAIL), "Failed to load {}, array_id:{}, ret:{}", fileName, arrayId, ret);
+        return ret;
+    }
+
+    stopWriteback = false;
+    writebackThread = new std::thread(&ReplicationDirtyBitmap::_WritebackWorker, this);
+    return ret;
+}
+
+void
+ReplicationDirtyBitmap::Dispose(void)
+{
+    if (writebackThread != nullptr)
+    {
+        {
+            std::lock_guard<std::mutex> lock(writebackLock);
+            stopWriteback = true;
+        }
+        writebackCv.notify_all();
+        writebackThread->join();
+        delete writebackThread;
+        writebackThread = nullptr;
+    }
+
+    if (file != nullptr && file->IsOpened() == true)
+    {
+        Flush();
+        file->Close();
+    }
+}
+
+int
+ReplicationDirtyBitmap::Flush(void)
+{
+    std::lock_guard<std::mutex> flushGuard(flushLock);
+    if (file == nullptr || file->IsOpened() == false)
+    {
+        return 0;
+    }
+
+    std::vector<char> header(HEADER_SIZE, 0);
+    std::vector<std::pair<int, std::vector<uint64_t>>> slots;
+    {
+        std::lock_guard<std::mutex> lock(mapLock);
+        for (int volumeId = 0; volumeId < MAX_VOLUME_COUNT; volumeId++)
+        {
+            header[volumeId] = static_cast<char>(maps[volumeId].regionShift);
+            if (maps[volumeId].changed == true)
+            {
+                slots.emplace_back(volumeId, maps[volumeId].dirty);
+                maps[volumeId].changed = false;
+            }
+        }
+    }
+
+    if (slots.empty() == true)
+    {
+        return 0;
+    }
+
+    int ret = file->IssueIO(MetaFsIoOpcode::Write, 0, HEADER_SIZE, header.data());
+    for (auto& slot : slots)
+    {
+        if (ret != 0)
+        {
+            break;
+        }
+        uint64_t offset = HEADER_SIZE + static_cast<uint64_t>(slot.first) * SLOT_SIZE;
+        ret = file->IssueIO(MetaFsIoOpcode::Write, offset, SLOT_SIZE, reinterpret_cast<char*>(slot.second.data()));
+    }
+
+    if (ret != 0)
+    {
+        POS_TRACE_ERROR(EID(HA_DIRTY_BITMAP_IO_FAIL), "Failed to store {}, array_id:{}, ret:{}", fileName, arrayId, ret);
+        std::lock_guard<std::mutex> lock(mapLock);
+        for (auto& slot : slots)
+        {
+            maps[slot.first].changed = true;
+        }
+    }
+    return ret;
+}
+
+void
+ReplicationDirtyBitmap::SetVolumeSize(int volumeId, uint64_t volumeSizeByte)
+{
+    if (_IsValidVolume(volumeId) == false || volumeSizeByte == 0)
+    {
+        return;
+    }
+
+    uint32_t regionShift = MIN_REGION_SHIFT;
+    while (((volumeSizeByte - 1) >> regionShift) >= MAX_REGION_COUNT)
+    {
+        regionShift++;
+    }
+
+    std::lock_guard<std::mutex> lock(mapLock);
+    VolumeDirtyMap& map = maps[volumeId];
+    map.volumeSizeByte = volumeSizeByte;
+    // A volume only grows, so the regions only get coarser
+    if (regionShift > map.regionShift)
+    {
+        _Rescale(map, regionShift);
+    }
+}
+
+void
+ReplicationDirtyBitmap::ResetVolume(int volumeId)
+{
+    if (_IsValidVolume(volumeId) == false)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mapLock);
+    _ResetMap(maps[volumeId]);
+    maps[volumeId].changed = true;
+}
+
+void
+ReplicationDirtyBitmap::MarkDirty(int volumeId, uint64_t rba, uint64_t numBlocks, bool waitAck)
+{
+    if (_IsValidVolume(volumeId) == false || numBlocks == 0)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mapLock);
+    VolumeDirtyMap& map = maps[volumeId];
+    uint32_t first, last;
+    _GetRegionRange(map, rba, numBlocks, first, last);
+    for (uint32_t region = first; region <= last; region++)
+    {
+        if (_TestBit(map.dirty, region) == false)
+        {
+            _SetBit(map.dirty, region);
+            map.changed = true;
+        }
+
+        if (waitAck == true)
+        {
+            map.pendingAck[region]++;
+        }
+        else
+        {
+            _SetBit(map.sticky, region);
+        }
+    }
+}
+
+void
+ReplicationDirtyBitmap::Acknowledge(int volumeId, uint64_t rba, uint64_t numBlocks)
+{
+    if (_IsValidVolume(volumeId) == false || numBlocks == 0)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mapLock);
+    VolumeDirtyMap& map = maps[volumeId];
+    uint32_t first, last;
+    _GetRegionRange(map, rba, numBlocks, first, last);
+    for (uint32_t region = first; region <= last; region++)
+    {
+        auto itr = map.pendingAck.find(region);
+        if (itr == map.pendingAck.end())
+        {
+            continue;
+        }
+
+        itr->second--;
+        if (itr->second == 0)
+        {
+            map.pendingAck.erase(itr);
+            if (_TestBit(map.sticky, region) == false)
+            {
+                _ClearBit(map.dirty, region);
+                map.changed = true;
+            }
+        }
+    }
+}
+
+void
+ReplicationDirtyBitmap::ClearVolume(int volumeId)
+{
+    if (_IsValidVolume(volumeId) == false)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mapLock);
+    VolumeDirtyMap& map = maps[volumeId];
+    std::fill(map.dirty.begin(), map.dirty.end(), 0);
+    std::fill(map.sticky.begin(), map.sticky.end(), 0);
+    // The writes still waiting for the replicator keep their regions dirty
+    for (auto& pending : map.pendingAck)
+    {
+        _SetBit(map.dirty, pending.first);
+    }
+    map.changed = true;
+}
+
+void
+ReplicationDirtyBitmap::GetDirtyExtents(int volumeId, std::vector<DirtyExtent>& extents)
+{
+    extents.clear();
+    if (_IsValidVolume(volumeId) == false)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mapLock);
+    VolumeDirtyMap& map = maps[volumeId];
+    uint64_t regionSize = 1ULL << map.regionShift;
+    uint32_t region = 0;
+    while (region < MAX_REGION_COUNT)
+    {
+        if (_TestBit(map.dirty, region) == false)
+        {
+            region++;
+            continue;
+        }
+
+        uint32_t first = region;
+        while (region < MAX_REGION_COUNT && _TestBit(map.dirty, region) == true)
+        {
+            region++;
+        }
+
+        uint64_t startByte = first * regionSize;
+        uint64_t endByte = region * regionSize;
+        if (map.volumeSizeByte != 0)
+        {
+            endByte = std::min(endByte, map.volumeSizeByte);
+        }
+        if (startByte < endByte)
+        {
+            extents.emplace_back(ChangeByteToSector(startByte), ChangeByteToSector(endByte - startByte));
+        }
+    }
+}
+
+uint64_t
+ReplicationDirtyBitmap::GetRegionSize(int volumeId)
+{
+    if (_IsValidVolume(volumeId) == false)
+    {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(mapLock);
+    return 1ULL << maps[volumeId].regionShift;
+}
+
+uint32_t
+ReplicationDirtyBitmap::GetDirtyRegionCount(int volumeId)
+{
+    if (_IsValidVolume(volumeId) == false)
+    {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(mapLock);
+    uint32_t count = 0;
+    for (auto word : maps[volumeId].dirty)
+    {
+        count += __builtin_popcountll(word);
+    }
+    return count;
+}
+
+bool
+ReplicationDirtyBitmap::_IsValidVolume(int volumeId)
+{
+    return (volumeId >= 0 && volumeId < MAX_VOLUME_COUNT);
+}
+
+void
+ReplicationDirtyBitmap::_ResetMap(VolumeDirtyMap& map)
+{
+    map.regionShift = MIN_REGION_SHIFT;
+    map.volumeSizeByte = 0;
+    map.dirty.assign(MAX_REGION_COUNT / 64, 0);
+    map.sticky.assign(MAX_REGION_COUNT / 64, 0);
+    map.pendingAck.clear();
+    map.changed = false;
+}
+
+void
+ReplicationDirtyBitmap::_Rescale(VolumeDirtyMap& map, uint32_t regionShift)
+{
+    uint32_t delta = regionShift - map.regionShift;
+    std::vector<uint64_t> dirty(MAX_REGION_COUNT / 64, 0);
+    std::vector<uint64_t> sticky(MAX_REGION_COUNT / 64, 0);
+    for (uint32_t region = 0; region < MAX_REGION_COUNT; region++)
+    {
+        if (_TestBit(map.dirty, region) == true)
+        {
+            _SetBit(dirty, region >> delta);
+        }
+        if (_TestBit(map.sticky, region) == true)
+        {
+            _SetBit(sticky, region >> delta);
+        }
+    }
+
+    std::unordered_map<uint32_t, uint32_t> pendingAck;
+    for (auto& pending : map.pendingAck)
+    {
+        pendingAck[pending.first >> delta] += pending.second;
+    }
+
+    map.regionShift = regionShift;
+    map.dirty.swap(dirty);
+    map.sticky.swap(sticky);
+    map.pendingAck.swap(pendingAck);
+    map.changed = true;
+}
+
+void
+ReplicationDirtyBitmap::_GetRegionRange(VolumeDirtyMap& map, uint64_t rba, uint64_t numBlocks, uint32_t& first, uint32_t& last)
+{
+    uint64_t startByte = ChangeSectorToByte(rba);
+    uint64_t endByte = ChangeSectorToByte(rba + numBlocks) - 1;
+    first = static_cast<uint32_t>(std::min<uint64_t>(startByte >> map.regionShift, MAX_REGION_COUNT - 1));
+    last = static_cast<uint32_t>(std::min<uint64_t>(endByte >> map.regionShift, MAX_REGION_COUNT - 1));
+}
+
+int
+ReplicationDirtyBitmap::_Load(void)
+{
+    std::vector<char> header(HEADER_SIZE, 0);
+    int ret = file->IssueIO(MetaFsIoOpcode::Read, 0, HEADER_SIZE, header.data());
+    if (ret != 0)
+    {
+        return ret;
+    }
+
+    uint32_t dirtyVolumeCount = 0;
+    std::vector<uint64_t> slot(MAX_REGION_COUNT / 64, 0);
+    for (int volumeId = 0; volumeId < MAX_VOLUME_COUNT; volumeId++)
+    {
+        uint32_t regionShift = static_cast<uint8_t>(header[volumeId]);
+        if (regionShift < MIN_REGION_SHIFT || regionShift >= 64)
+        {
+            // The slot has never been written
+            continue;
+        }
+
+        uint64_t offset = HEADER_SIZE + static_cast<uint64_t>(volumeId) * SLOT_SIZE;
+        ret = file->IssueIO(MetaFsIoOpcode::Read, offset, SLOT_SIZE, reinterpret_cast<char*>(slot.data()));
+        if (ret != 0)
+        {
+            return ret;
+        }
+
+        std::lock_guard<std::mutex> lock(mapLock);
+        VolumeDirtyMap& map = maps[volumeId];
+        map.regionShift = regionShift;
+        map.dirty = slot;
+        // Nothing is known about the replication of the loaded regions
+        map.sticky = slot;
+        if (std::any_of(slot.begin(), slot.end(), [](uint64_t word) { return word != 0; }))
+        {
+            dirtyVolumeCount++;
+        }
+    }
+
+    POS_TRACE_INFO(EID(HA_DEBUG_MSG), "{} has been loaded, array_id:{}, dirty_volume_count:{}",
+        fileName, arrayId, dirtyVolumeCount);
+    return 0;
+}
+
+void
+ReplicationDirtyBitmap::_WritebackWorker(void)
+{
+    std::unique_lock<std::mutex> lock(writebackLock);
+    while (stopWriteback == false)
+    {
+        writebackCv.wait_for(lock, std::chrono::milliseconds(writebackIntervalMs));
+        if (stopWriteback == true)
+        {
+            break;
+        }
+        lock.unlock();
+        Flush();
+        lock.lock();
+    }
+}
+
+bool
+ReplicationDirtyBitmap::_TestBit(std::vector<uint64_t>& bits, uint32_t index)
+{
+    return (bits[index / 64] & (1ULL << (index % 64))) != 0;
+}
+
+void
+ReplicationDirtyBitmap::_SetBit(std::vector<uint64_t>& bits, uint32_t index)
+{
+    bits[index / 64] |= (1ULL << (index % 64));
+}
+
+void
+ReplicationDirtyBitmap::_ClearBit(std::vector<uint64_t>& bits, uint32_t index)
+{
+    bits[index / 64] &= ~(1ULL << (index % 64));
+}
+} // namespace pos
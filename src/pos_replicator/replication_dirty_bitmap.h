@@ -0,0 +1,121 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace pos
+{
+class MetaFileIntf;
+
+// (sector rba, number of sectors) of a range that has to be resynchronized
+using DirtyExtent = std::pair<uint64_t, uint64_t>;
+
+// Tracks, per volume, the coarse regions whose data may differ from the
+// replica so that a resync only copies the changed regions.
+// A region gets dirty when a host write lands on it. A write that goes through
+// live replication keeps the region pending until the replicator acknowledges
+// it, and the region is clean again once nothing is pending. Writes done while
+// the volume is not live replicated (and every region loaded from the disk)
+// stay dirty until the volume is resynchronized.
+// The bitmap is written back to the MetaFs file lazily, so the regions dirtied
+// within the last write-back interval may be lost in a sudden power off.
+class ReplicationDirtyBitmap
+{
+public:
+    explicit ReplicationDirtyBitmap(int arrayId);
+    ReplicationDirtyBitmap(int arrayId, MetaFileIntf* file, uint32_t writebackIntervalMs);
+    virtual ~ReplicationDirtyBitmap(void);
+
+    virtual int Init(void);
+    virtual void Dispose(void);
+    virtual int Flush(void);
+
+    virtual void SetVolumeSize(int volumeId, uint64_t volumeSizeByte);
+    virtual void ResetVolume(int volumeId);
+    virtual void MarkDirty(int volumeId, uint64_t rba, uint64_t numBlocks, bool waitAck);
+    virtual void Acknowledge(int volumeId, uint64_t rba, uint64_t numBlocks);
+    virtual void ClearVolume(int volumeId);
+    virtual void GetDirtyExtents(int volumeId, std::vector<DirtyExtent>& extents);
+
+    virtual uint64_t GetRegionSize(int volumeId);
+    virtual uint32_t GetDirtyRegionCount(int volumeId);
+
+    static const uint32_t MAX_REGION_COUNT = 65536;
+    static const uint32_t MIN_REGION_SHIFT = 20;
+    static const uint32_t HEADER_SIZE = 4096;
+    static const uint32_t SLOT_SIZE = MAX_REGION_COUNT / 8;
+
+private:
+    struct VolumeDirtyMap
+    {
+        uint32_t regionShift;
+        uint64_t volumeSizeByte;
+        std::vector<uint64_t> dirty;
+        std::vector<uint64_t> sticky;
+        std::unordered_map<uint32_t, uint32_t> pendingAck;
+        bool changed;
+    };
+
+    bool _IsValidVolume(int volumeId);
+    void _ResetMap(VolumeDirtyMap& map);
+    void _Rescale(VolumeDirtyMap& map, uint32_t regionShift);
+    void _GetRegionRange(VolumeDirtyMap& map, uint64_t rba, uint64_t numBlocks, uint32_t& first, uint32_t& last);
+    int _Load(void);
+    void _WritebackWorker(void);
+
+    static bool _TestBit(std::vector<uint64_t>& bits, uint32_t index);
+    static void _SetBit(std::vector<uint64_t>& bits, uint32_t index);
+    static void _ClearBit(std::vector<uint64_t>& bits, uint32_t index);
+
+    int arrayId;
+    std::string fileName;
+    MetaFileIntf* file;
+    uint32_t writebackIntervalMs;
+    std::vector<VolumeDirtyMap> maps;
+    std::mutex mapLock;
+    std::mutex flushLock;
+
+    bool stopWriteback;
+    std::mutex writebackLock;
+    std::condition_variable writebackCv;
+    std::thread* writebackThread;
+};
+} // namespace pos
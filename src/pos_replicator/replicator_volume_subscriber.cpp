@@ -35,14 +35,21 @@
 #include "src/include/pos_event_id.h"
 #include "src/logger/logger.h"
 #include "src/pos_replicator/posreplicator_manager.h"
+#include "src/pos_replicator/replication_dirty_bitmap.h"
 #include "src/sys_event/volume_event_publisher.h"
 #include "src/volume/volume_service.h"
 
 namespace pos
 {
 ReplicatorVolumeSubscriber::ReplicatorVolumeSubscriber(IArrayInfo* info)
+: ReplicatorVolumeSubscriber(info, nullptr)
+{
+}
+
+ReplicatorVolumeSubscriber::ReplicatorVolumeSubscriber(IArrayInfo* info, ReplicationDirtyBitmap* dirtyBitmap)
 : VolumeEvent("ReplicatorVolumeSubscriber", info->GetName(), info->GetIndex()),
-  arrayInfo(info)
+  arrayInfo(info),
+  dirtyBitmap(dirtyBitmap)
 {
     volumeManager = nullptr;
     POS_TRACE_INFO(EID(HA_DEBUG_MSG), "ReplicatorVolumeSubscriber has been constructed");
@@ -50,12 +57,32 @@ ReplicatorVolumeSubscriber::ReplicatorVolumeSubscriber(IArrayInfo* info)
 
 ReplicatorVolumeSubscriber::~ReplicatorVolumeSubscriber(void)
 {
+    if (dirtyBitmap != nullptr)
+    {
+        delete dirtyBitmap;
+        dirtyBitmap = nullptr;
+    }
     POS_TRACE_INFO(EID(HA_DEBUG_MSG), "ReplicatorVolumeSubscriber has been destructed");
 }
 
 int
 ReplicatorVolumeSubscriber::Init(void)
 {
+    if (dirtyBitmap == nullptr && PosReplicatorManagerSingleton::Instance()->IsEnabled() == true)
+    {
+        dirtyBitmap = new ReplicationDirtyBitmap(arrayId);
+    }
+    if (dirtyBitmap != nullptr)
+    {
+        int result = dirtyBitmap->Init();
+        if (result != 0)
+        {
+            // Without the bitmap the replicator falls back to a full copy
+            delete dirtyBitmap;
+            dirtyBitmap = nullptr;
+        }
+    }
+
     int ret = PosReplicatorManagerSingleton::Instance()->Register(arrayId, this);
     volumeManager = VolumeServiceSingleton::Instance()->GetVolumeManager(arrayId);
     VolumeEventPublisherSingleton::Instance()->RegisterSubscriber(this, arrayName, arrayId);
@@ -69,6 +96,10 @@ ReplicatorVolumeSubscriber::Dispose(void)
 {
     PosReplicatorManagerSingleton::Instance()->Unregister(arrayId);
     VolumeEventPublisherSingleton::Instance()->RemoveSubscriber(this, arrayName, arrayId);
+    if (dirtyBitmap != nullptr)
+    {
+        dirtyBitmap->Dispose();
+    }
     POS_TRACE_INFO(EID(HA_DEBUG_MSG), "ReplicatorVolumeSubscriber has been disposed (arrayId = {}, arrayName = {})",
         arrayId, arrayName);
 }
@@ -84,23 +115,41 @@ ReplicatorVolumeSubscriber::Shutdown(void)
 void
 ReplicatorVolumeSubscriber::Flush(void)
 {
+    if (dirtyBitmap != nullptr)
+    {
+        dirtyBitmap->Flush();
+    }
 }
 
 int
 ReplicatorVolumeSubscriber::VolumeCreated(VolumeEventBase* volEventBase, VolumeEventPerf* volEventPerf, VolumeArrayInfo* volArrayInfo)
 {
+    if (dirtyBitmap != nullptr)
+    {
+        // The slot of a deleted volume may be reused by the new one
+        dirtyBitmap->ResetVolume(volEventBase->volId);
+        dirtyBitmap->SetVolumeSize(volEventBase->volId, volEventBase->volSizeByte);
+    }
     return EID(VOL_EVENT_OK);
 }
 
 int
 ReplicatorVolumeSubscriber::VolumeDeleted(VolumeEventBase* volEventBase, VolumeArrayInfo* volArrayInfo)
 {
+    if (dirtyBitmap != nullptr)
+    {
+        dirtyBitmap->ResetVolume(volEventBase->volId);
+    }
     return EID(VOL_EVENT_OK);
 }
 
 int
 ReplicatorVolumeSubscriber::VolumeMounted(VolumeEventBase* volEventBase, VolumeEventPerf* volEventPerf, VolumeArrayInfo* volArrayInfo)
 {
+    if (dirtyBitmap != nullptr)
+    {
+        dirtyBitmap->SetVolumeSize(volEventBase->volId, volEventBase->volSizeByte);
+    }
     return EID(VOL_EVENT_OK);
 }
 
@@ -113,12 +162,20 @@ ReplicatorVolumeSubscriber::VolumeUnmounted(VolumeEventBase* volEventBase, Volum
 int
 ReplicatorVolumeSubscriber::VolumeLoaded(VolumeEventBase* volEventBase, VolumeEventPerf* volEventPerf, VolumeArrayInfo* volArrayInfo)
 {
+    if (dirtyBitmap != nullptr)
+    {
+        dirtyBitmap->SetVolumeSize(volEventBase->volId, volEventBase->volSizeByte);
+    }
     return EID(VOL_EVENT_OK);
 }
 
 int
 ReplicatorVolumeSubscriber::VolumeUpdated(VolumeEventBase* volEventBase, VolumeEventPerf* volEventPerf, VolumeArrayInfo* volArrayInfo)
 {
+    if (dirtyBitmap != nullptr)
+    {
+        dirtyBitmap->SetVolumeSize(volEventBase->volId, volEventBase->volSizeByte);
+    }
     return EID(VOL_EVENT_OK);
 }
 
@@ -134,6 +191,12 @@ ReplicatorVolumeSubscriber::GetVolumeManager(void)
     return volumeManager;
 }
 
+ReplicationDirtyBitmap*
+ReplicatorVolumeSubscriber::GetDirtyBitmap(void)
+{
+    return dirtyBitmap;
+}
+
 std::string
 ReplicatorVolumeSubscriber::GetArrayName(void)
 {
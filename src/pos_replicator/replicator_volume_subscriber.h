@@ -39,10 +39,13 @@
 
 namespace pos
 {
+class ReplicationDirtyBitmap;
+
 class ReplicatorVolumeSubscriber : public VolumeEvent, public IMountSequence
 {
 public:
     ReplicatorVolumeSubscriber(IArrayInfo* arrayInfo);
+    ReplicatorVolumeSubscriber(IArrayInfo* arrayInfo, ReplicationDirtyBitmap* dirtyBitmap);
     virtual ~ReplicatorVolumeSubscriber(void);
 
     int Init(void) override;
@@ -59,12 +62,14 @@ public:
     int VolumeDetached(vector<int> volList, VolumeArrayInfo* volArrayInfo) override;
 
     IVolumeEventManager* GetVolumeManager(void);
+    ReplicationDirtyBitmap* GetDirtyBitmap(void);
 
     std::string GetArrayName(void);
 
 private:
     IArrayInfo* arrayInfo;
     IVolumeEventManager* volumeManager;
+    ReplicationDirtyBitmap* dirtyBitmap;
 };
 
 } // namespace pos
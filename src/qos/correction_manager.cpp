@@ -36,8 +36,12 @@
 #include "src/qos/qos_context.h"
 #include "src/qos/qos_manager.h"
 #include "src/qos/throttling_policy_deficit.h"
+#include "src/telemetry/telemetry_client/telemetry_client.h"
+#include "src/telemetry/telemetry_client/telemetry_publisher.h"
+#include "src/telemetry/telemetry_id.h"
 #include <queue>
 #include <list>
+#include <string>
 #include <tuple>
 
 namespace pos
@@ -49,12 +53,24 @@ namespace pos
  * @Returns
  */
 /* --------------------------------------------------------------------------*/
-QosCorrectionManager::QosCorrectionManager(QosContext* qosCtx, QosManager* qosManager)
+QosCorrectionManager::QosCorrectionManager(QosContext* qosCtx, QosManager* qosManager,
+    TelemetryClient* telemetryClient, TelemetryPublisher* publisher)
 : qosContext(qosCtx),
-  qosManager(qosManager)
+  qosManager(qosManager),
+  telemetryClient(telemetryClient),
+  publisher(publisher)
 {
     nextManagerType = QosInternalManager_Unknown;
     throttlingLogic = new ThrottlingPolicyDeficit(qosCtx, qosManager);
+    for (uint32_t event = BackendEvent_Start; event < BackendEvent_Count; event++)
+    {
+        wrrCorrection[event] = 0;
+    }
+    if (nullptr != telemetryClient && nullptr == publisher)
+    {
+        this->publisher = new TelemetryPublisher("QosControl");
+        telemetryClient->RegisterPublisher(this->publisher);
+    }
 }
 
 /* --------------------------------------------------------------------------*/
@@ -67,6 +83,14 @@ QosCorrectionManager::QosCorrectionManager(QosContext* qosCtx, QosManager* qosMa
 QosCorrectionManager::~QosCorrectionManager(void)
 {
     delete throttlingLogic;
+    if (nullptr != publisher)
+    {
+        if (nullptr != telemetryClient)
+        {
+            telemetryClient->DeregisterPublisher(publisher->GetName());
+        }
+        delete publisher;
+    }
 }
 
 /* --------------------------------------------------------------------------*/
@@ -84,6 +108,7 @@ QosCorrectionManager::_HandleWrrCorrection(void)
     for (uint32_t event = BackendEvent_Start; event < BackendEvent_Count; event++)
     {
         int32_t weight = qosManager->GetEventWeightWRR((BackendEvent)event);
+        int32_t prevWeight = weight;
         if (true == eventWrrPolicy.IsReset(event))
         {
             qosManager->SetEventWeightWRR((BackendEvent)event, M_DEFAULT_WEIGHT);
@@ -148,6 +173,7 @@ QosCorrectionManager::_HandleWrrCorrection(void)
         }
         qosManager->SetEventWeightWRR((BackendEvent)event, weight);
         eventWrrPolicy.SetEventWrrWeight((BackendEvent)event, weight);
+        wrrCorrection[event] = weight - prevWeight;
     }
 }
 
@@ -239,6 +265,10 @@ QosCorrectionManager::Execute(void)
 {
     QosCorrection& qosCorrection = qosContext->GetQosCorrection();
     qos_correction_type qosCorrectionType = qosCorrection.GetCorrectionType();
+    for (uint32_t event = BackendEvent_Start; event < BackendEvent_Count; event++)
+    {
+        wrrCorrection[event] = 0;
+    }
     if (true == qosCorrectionType.volumeThrottle)
     {
         _HandleVolumeCorrection();
@@ -247,9 +277,97 @@ QosCorrectionManager::Execute(void)
     {
         _HandleWrrCorrection();
     }
+    _PublishCycle();
     _SetNextManagerType();
 }
 
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Publish what the control cycle measured and decided, so that
+ *           a throttled volume can be explained from the time series
+ *
+ * @Returns
+ */
+/* --------------------------------------------------------------------------*/
+void
+QosCorrectionManager::_PublishCycle(void)
+{
+    if (nullptr == publisher || false == publisher->IsRunning())
+    {
+        return;
+    }
+
+    POSMetricVector* metricList = publisher->AllocatePOSMetricVector();
+    AllVolumeParameter& allVolumeParameter = qosContext->GetQosParameters().GetAllVolumeParameter();
+    std::list<std::pair<uint32_t, uint32_t>> mountedVolumeList;
+    qosManager->GetMountedVolumes(mountedVolumeList);
+    for (auto volPair : mountedVolumeList)
+    {
+        uint32_t arrayId = volPair.first;
+        uint32_t volId = volPair.second;
+        std::string arrayLabel = std::to_string(arrayId);
+        std::string volumeLabel = std::to_string(volId);
+
+        POSMetric limitBw(TEL120007_FEQOS_VOLUME_LIMIT_BW, MT_GAUGE);
+        limitBw.SetGaugeValue(qosManager->GetVolumeLimit(volId, false, arrayId));
+        POSMetric limitIops(TEL120008_FEQOS_VOLUME_LIMIT_IOPS, MT_GAUGE);
+        limitIops.SetGaugeValue(qosManager->GetVolumeLimit(volId, true, arrayId));
+        for (POSMetric* metric : {&limitBw, &limitIops})
+        {
+            metric->AddLabel("array_id", arrayLabel);
+            metric->AddLabel("volume_id", volumeLabel);
+            metricList->push_back(*metric);
+        }
+
+        if (false == allVolumeParameter.VolumeExists(arrayId, volId))
+        {
+            continue;
+        }
+        VolumeParameter& volumeParameter = allVolumeParameter.GetVolumeParameter(arrayId, volId);
+        POSMetric measuredBw(TEL120005_FEQOS_VOLUME_MEASURED_BW, MT_GAUGE);
+        measuredBw.SetGaugeValue(volumeParameter.GetAvgBandwidth());
+        POSMetric measuredIops(TEL120006_FEQOS_VOLUME_MEASURED_IOPS, MT_GAUGE);
+        measuredIops.SetGaugeValue(volumeParameter.GetAvgIops());
+        for (POSMetric* metric : {&measuredBw, &measuredIops})
+        {
+            metric->AddLabel("array_id", arrayLabel);
+            metric->AddLabel("volume_id", volumeLabel);
+            metricList->push_back(*metric);
+        }
+
+        for (auto& reactorPair : volumeParameter.GetReactorParameterMap())
+        {
+            std::string reactorLabel = std::to_string(reactorPair.first);
+            POSMetric reactorBw(TEL120009_FEQOS_REACTOR_MEASURED_BW, MT_GAUGE);
+            reactorBw.SetGaugeValue(reactorPair.second.GetBandwidth());
+            POSMetric reactorIops(TEL120010_FEQOS_REACTOR_MEASURED_IOPS, MT_GAUGE);
+            reactorIops.SetGaugeValue(reactorPair.second.GetIops());
+            for (POSMetric* metric : {&reactorBw, &reactorIops})
+            {
+                metric->AddLabel("array_id", arrayLabel);
+                metric->AddLabel("volume_id", volumeLabel);
+                metric->AddLabel("reactor", reactorLabel);
+                metricList->push_back(*metric);
+            }
+        }
+    }
+
+    for (uint32_t event = BackendEvent_Start; event < BackendEvent_Count; event++)
+    {
+        std::string eventLabel = std::to_string(event);
+        POSMetric weight(TEL120011_FEQOS_EVENT_WRR_WEIGHT, MT_GAUGE);
+        weight.SetGaugeValue(qosManager->GetEventWeightWRR((BackendEvent)event));
+        weight.AddLabel("event", eventLabel);
+        metricList->push_back(weight);
+        POSMetric correction(TEL120012_FEQOS_EVENT_WRR_CORRECTION, MT_GAUGE);
+        correction.SetGaugeValue(wrrCorrection[event]);
+        correction.AddLabel("event", eventLabel);
+        metricList->push_back(correction);
+    }
+
+    publisher->PublishMetricList(metricList);
+}
+
 /* --------------------------------------------------------------------------*/
 /**
  * @Synopsis
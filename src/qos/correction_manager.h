@@ -43,6 +43,8 @@ namespace pos
 {
 class QosContext;
 class QosManager;
+class TelemetryClient;
+class TelemetryPublisher;
 class VolumeParameter;
 class VolumeUserPolicy;
 class IThrottlingLogic;
@@ -55,7 +57,8 @@ class IThrottlingLogic;
 class QosCorrectionManager : public QosInternalManager
 {
 public:
-    explicit QosCorrectionManager(QosContext* qosCtx, QosManager* qosManager);
+    QosCorrectionManager(QosContext* qosCtx, QosManager* qosManager,
+        TelemetryClient* telemetryClient = nullptr, TelemetryPublisher* publisher = nullptr);
     ~QosCorrectionManager(void);
     void Execute(void) override;
     QosInternalManagerType GetNextManagerType(void) override;
@@ -69,11 +72,15 @@ private:
     void _HandleWrrCorrection(void);
     uint64_t _InitialValueCheck(uint64_t value, bool iops, VolumeParameter& volParameter, VolumeUserPolicy& volUserPolicy);
     uint64_t _GetUserMaxWeight(uint32_t arrayId, uint32_t volId, bool iops);
+    void _PublishCycle(void);
 
     QosContext* qosContext;
     QosManager* qosManager;
     QosInternalManagerType nextManagerType;
     IThrottlingLogic *throttlingLogic;
+    TelemetryClient* telemetryClient;
+    TelemetryPublisher* publisher;
+    int64_t wrrCorrection[BackendEvent_Count];
     uint64_t INVALID_WEIGHT = 0xffffffff;
     uint64_t volumeBwThrottling[MAX_ARRAY_COUNT][MAX_VOLUME_COUNT];
     uint64_t volumeIopsThrottling[MAX_ARRAY_COUNT][MAX_VOLUME_COUNT];
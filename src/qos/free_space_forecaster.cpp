@@ -0,0 +1,142 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/qos/free_space_forecaster.h"
+
+#include <algorithm>
+
+namespace pos
+{
+FreeSpaceForecaster::FreeSpaceForecaster(uint64_t horizonMs)
+: horizonMs(horizonMs)
+{
+}
+
+FreeSpaceForecaster::~FreeSpaceForecaster(void)
+{
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Takes the free segment count of an array every window. The net
+ *           change between windows already accounts for the segments GC
+ *           reclaimed, so a growing count brings the rate down.
+ *
+ * @Returns
+ */
+/* --------------------------------------------------------------------------*/
+void
+FreeSpaceForecaster::Update(uint32_t arrayId, uint32_t freeSegments, uint32_t urgentThreshold, uint64_t elapsedMs)
+{
+    if (arrayId >= MAX_ARRAY_COUNT || elapsedMs == 0)
+    {
+        return;
+    }
+    ArrayForecast& array = forecast[arrayId];
+    if (array.sampled == false)
+    {
+        array.sampled = true;
+        array.freeSegments = freeSegments;
+        return;
+    }
+    double consumed = static_cast<double>(array.freeSegments) - static_cast<double>(freeSegments);
+    double rate = consumed * 1000 / elapsedMs;
+    array.consumptionRate += (rate - array.consumptionRate) / SMOOTHING_DIVISOR;
+    array.freeSegments = freeSegments;
+
+    if (freeSegments <= urgentThreshold)
+    {
+        array.timeToUrgentMs = 0;
+    }
+    else if (array.consumptionRate <= 0)
+    {
+        array.timeToUrgentMs = NEVER;
+    }
+    else
+    {
+        array.timeToUrgentMs = static_cast<uint64_t>((freeSegments - urgentThreshold) * 1000 / array.consumptionRate);
+    }
+}
+
+uint64_t
+FreeSpaceForecaster::GetTimeToUrgentMs(uint32_t arrayId)
+{
+    return forecast[arrayId].timeToUrgentMs;
+}
+
+uint32_t
+FreeSpaceForecaster::_GetTargetLevel(uint64_t timeToUrgentMs)
+{
+    if (timeToUrgentMs >= horizonMs)
+    {
+        return 0;
+    }
+    // linear in the remaining time: the closer to urgent, the higher
+    uint64_t level = ((horizonMs - timeToUrgentMs) * MAX_BOOST_LEVEL + horizonMs - 1) / horizonMs;
+    return static_cast<uint32_t>(std::min(level, static_cast<uint64_t>(MAX_BOOST_LEVEL)));
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis  Moves the boost level one step toward the level for the array
+ *            closest to its urgent threshold
+ *
+ * @Returns   new boost level
+ */
+/* --------------------------------------------------------------------------*/
+uint32_t
+FreeSpaceForecaster::Evaluate(void)
+{
+    uint64_t shortest = NEVER;
+    for (uint32_t arrayId = 0; arrayId < MAX_ARRAY_COUNT; arrayId++)
+    {
+        shortest = std::min(shortest, forecast[arrayId].timeToUrgentMs);
+    }
+    uint32_t target = _GetTargetLevel(shortest);
+    if (target > boostLevel)
+    {
+        boostLevel++;
+    }
+    else if (target < boostLevel)
+    {
+        boostLevel--;
+    }
+    return boostLevel;
+}
+
+uint32_t
+FreeSpaceForecaster::GetBoostLevel(void)
+{
+    return boostLevel;
+}
+
+} // namespace pos
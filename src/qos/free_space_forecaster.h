@@ -0,0 +1,79 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "src/qos/qos_common.h"
+
+namespace pos
+{
+// Forecasts how long the free segments of each array last at the recent
+// net consumption rate (allocation minus GC reclaim) and turns the shortest
+// forecast into a GC boost level. Level 0 leaves GC alone; each level above
+// raises the floor of the GC weight further, so GC speeds up gradually
+// before the urgent threshold is reached instead of all at once.
+class FreeSpaceForecaster
+{
+public:
+    explicit FreeSpaceForecaster(uint64_t horizonMs = DEFAULT_HORIZON_MS);
+    virtual ~FreeSpaceForecaster(void);
+
+    void Update(uint32_t arrayId, uint32_t freeSegments, uint32_t urgentThreshold, uint64_t elapsedMs);
+    uint64_t GetTimeToUrgentMs(uint32_t arrayId);
+    uint32_t Evaluate(void);
+    uint32_t GetBoostLevel(void);
+
+    static const uint32_t MAX_BOOST_LEVEL = 5;
+    static const uint64_t DEFAULT_HORIZON_MS = 30000;
+    static const uint64_t NEVER = UINT64_MAX;
+
+private:
+    uint32_t _GetTargetLevel(uint64_t timeToUrgentMs);
+
+    struct ArrayForecast
+    {
+        bool sampled = false;
+        uint32_t freeSegments = 0;
+        // segments consumed per second, smoothed
+        double consumptionRate = 0;
+        uint64_t timeToUrgentMs = NEVER;
+    };
+
+    ArrayForecast forecast[MAX_ARRAY_COUNT];
+    uint64_t horizonMs;
+    uint32_t boostLevel = 0;
+    static const uint32_t SMOOTHING_DIVISOR = 8;
+};
+
+} // namespace pos
@@ -36,6 +36,7 @@
 #include "src/qos/policy_manager.h"
 #include "src/qos/correction_manager.h"
 #include "src/qos/qos_context.h"
+#include "src/telemetry/telemetry_client/telemetry_client.h"
 
 namespace pos
 {
@@ -61,7 +62,8 @@ InternalManagerFactory::CreateInternalManager(QosInternalManagerType type, QosCo
             break;
 
         case QosInternalManager_Correction:
-            internalManager = new QosCorrectionManager(ctx, qosManager);
+            internalManager = new QosCorrectionManager(ctx, qosManager,
+                TelemetryClientSingleton::Instance());
             break;
 
         default:
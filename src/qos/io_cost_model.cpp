@@ -0,0 +1,144 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/qos/io_cost_model.h"
+
+#include "src/include/memory.h"
+#include "src/include/pos_event_id.h"
+#include "src/logger/logger.h"
+#include "src/master_context/config_manager.h"
+
+namespace pos
+{
+IoCostModel::IoCostModel(ConfigManager* configManager)
+{
+    for (uint32_t volId = 0; volId < MAX_VOLUME_COUNT; volId++)
+    {
+        nextSectorRba[volId] = 0;
+    }
+    if (configManager == nullptr)
+    {
+        return;
+    }
+    bool enable = false;
+    int ret = configManager->GetValue("fe_qos", "io_cost_model_enable",
+        static_cast<void*>(&enable), CONFIG_TYPE_BOOL);
+    if (ret != EID(SUCCESS) || enable == false)
+    {
+        return;
+    }
+    _LoadCost(configManager, "sequential_read_cost", sequentialReadCost);
+    _LoadCost(configManager, "random_read_cost", randomReadCost);
+    _LoadCost(configManager, "sequential_write_cost", sequentialWriteCost);
+    _LoadCost(configManager, "random_write_cost", randomWriteCost);
+    _LoadCost(configManager, "unaligned_write_cost", unalignedWriteCost);
+    enabled = true;
+    POS_TRACE_INFO(EID(QOS_IO_COST_MODEL_LOADED),
+        "seq_read:{}, rand_read:{}, seq_write:{}, rand_write:{}, unaligned_write:{}",
+        sequentialReadCost, randomReadCost, sequentialWriteCost, randomWriteCost, unalignedWriteCost);
+}
+
+IoCostModel::~IoCostModel(void)
+{
+}
+
+void
+IoCostModel::_LoadCost(ConfigManager* configManager, const char* key, uint64_t& cost)
+{
+    uint64_t value = 0;
+    int ret = configManager->GetValue("fe_qos", key,
+        static_cast<void*>(&value), CONFIG_TYPE_UINT64);
+    if (ret == EID(SUCCESS) && value != 0)
+    {
+        cost = value;
+    }
+}
+
+bool
+IoCostModel::IsEnabled(void)
+{
+    return enabled;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis The first block of an I/O pays the sequential or random cost of
+ *           its direction, the following blocks are contiguous and pay the
+ *           sequential cost. Writes not aligned to a block pay the read
+ *           modify write on top.
+ *
+ * @Returns  cost units, 1 for every I/O while the model is disabled
+ */
+/* --------------------------------------------------------------------------*/
+uint64_t
+IoCostModel::GetCost(uint32_t volId, UbioDir dir, uint64_t sectorRba, uint64_t size)
+{
+    if (enabled == false || volId >= MAX_VOLUME_COUNT)
+    {
+        return 1;
+    }
+    if (dir != UbioDir::Read && dir != UbioDir::Write)
+    {
+        return 1;
+    }
+    uint64_t blockCount = (size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    if (blockCount == 0)
+    {
+        return 1;
+    }
+    bool sequential = _IsSequential(volId, sectorRba, size);
+    uint64_t cost = 0;
+    if (dir == UbioDir::Read)
+    {
+        cost = (sequential ? sequentialReadCost : randomReadCost) + (blockCount - 1) * sequentialReadCost;
+    }
+    else
+    {
+        cost = (sequential ? sequentialWriteCost : randomWriteCost) + (blockCount - 1) * sequentialWriteCost;
+        uint64_t endSector = sectorRba + ChangeByteToSector(size);
+        if ((sectorRba % SECTORS_PER_BLOCK) != 0 || (endSector % SECTORS_PER_BLOCK) != 0)
+        {
+            cost += unalignedWriteCost;
+        }
+    }
+    return cost;
+}
+
+bool
+IoCostModel::_IsSequential(uint32_t volId, uint64_t sectorRba, uint64_t size)
+{
+    uint64_t expected = nextSectorRba[volId].exchange(sectorRba + ChangeByteToSector(size),
+        std::memory_order_relaxed);
+    return expected == sectorRba;
+}
+
+} // namespace pos
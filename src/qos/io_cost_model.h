@@ -0,0 +1,78 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "src/bio/ubio.h"
+#include "src/qos/qos_common.h"
+
+namespace pos
+{
+class ConfigManager;
+
+// Charges each volume I/O in cost units instead of one operation.
+// One unit is the backend work of one aligned 4KB sequential read, so a
+// random 4KB write that also costs parity, journal and GC work charges more.
+// The costs come from the "fe_qos" config and the model is off by default.
+class IoCostModel
+{
+public:
+    explicit IoCostModel(ConfigManager* configManager);
+    virtual ~IoCostModel(void);
+
+    bool IsEnabled(void);
+    uint64_t GetCost(uint32_t volId, UbioDir dir, uint64_t sectorRba, uint64_t size);
+
+    static const uint64_t DEFAULT_SEQUENTIAL_READ_COST = 1;
+    static const uint64_t DEFAULT_RANDOM_READ_COST = 1;
+    static const uint64_t DEFAULT_SEQUENTIAL_WRITE_COST = 2;
+    static const uint64_t DEFAULT_RANDOM_WRITE_COST = 5;
+    static const uint64_t DEFAULT_UNALIGNED_WRITE_COST = 2;
+
+private:
+    void _LoadCost(ConfigManager* configManager, const char* key, uint64_t& cost);
+    bool _IsSequential(uint32_t volId, uint64_t sectorRba, uint64_t size);
+
+    bool enabled = false;
+    uint64_t sequentialReadCost = DEFAULT_SEQUENTIAL_READ_COST;
+    uint64_t randomReadCost = DEFAULT_RANDOM_READ_COST;
+    uint64_t sequentialWriteCost = DEFAULT_SEQUENTIAL_WRITE_COST;
+    uint64_t randomWriteCost = DEFAULT_RANDOM_WRITE_COST;
+    uint64_t unalignedWriteCost = DEFAULT_UNALIGNED_WRITE_COST;
+    // end sector of the last I/O per volume, to tell sequential streams apart
+    std::atomic<uint64_t> nextSectorRba[MAX_VOLUME_COUNT];
+};
+
+} // namespace pos
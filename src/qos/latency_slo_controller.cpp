@@ -0,0 +1,146 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/qos/latency_slo_controller.h"
+
+namespace pos
+{
+LatencySloController::LatencySloController(void)
+{
+}
+
+LatencySloController::~LatencySloController(void)
+{
+    for (uint32_t arrayId = 0; arrayId < MAX_ARRAY_COUNT; arrayId++)
+    {
+        for (uint32_t volId = 0; volId < MAX_VOLUME_COUNT; volId++)
+        {
+            delete slo[arrayId][volId].latency.load();
+        }
+    }
+}
+
+void
+LatencySloController::SetTarget(uint32_t arrayId, uint32_t volId, uint64_t targetUs)
+{
+    VolumeSlo& volumeSlo = slo[arrayId][volId];
+    if (targetUs != 0 && volumeSlo.latency.load() == nullptr)
+    {
+        PerCoreHistogram* latency = new PerCoreHistogram();
+        volumeSlo.windowStart = latency->Collect();
+        volumeSlo.latency.store(latency, std::memory_order_release);
+    }
+    volumeSlo.targetUs = targetUs;
+}
+
+uint64_t
+LatencySloController::GetTarget(uint32_t arrayId, uint32_t volId)
+{
+    return slo[arrayId][volId].targetUs;
+}
+
+void
+LatencySloController::Record(uint32_t arrayId, uint32_t volId, uint64_t latencyUs)
+{
+    VolumeSlo& volumeSlo = slo[arrayId][volId];
+    if (volumeSlo.targetUs.load(std::memory_order_relaxed) == 0)
+    {
+        return;
+    }
+    PerCoreHistogram* latency = volumeSlo.latency.load(std::memory_order_acquire);
+    if (latency != nullptr)
+    {
+        latency->Record(latencyUs);
+    }
+}
+
+uint32_t
+LatencySloController::Evaluate(void)
+{
+    bool violated = false;
+    bool satisfied = true;
+    for (uint32_t arrayId = 0; arrayId < MAX_ARRAY_COUNT; arrayId++)
+    {
+        for (uint32_t volId = 0; volId < MAX_VOLUME_COUNT; volId++)
+        {
+            VolumeSlo& volumeSlo = slo[arrayId][volId];
+            uint64_t targetUs = volumeSlo.targetUs;
+            PerCoreHistogram* latency = volumeSlo.latency.load(std::memory_order_acquire);
+            if (targetUs == 0 || latency == nullptr)
+            {
+                continue;
+            }
+
+            std::vector<uint64_t> now = latency->Collect();
+            std::vector<uint64_t> window = PerCoreHistogram::GetInterval(volumeSlo.windowStart, now);
+            if (PerCoreHistogram::GetTotalCount(window) < MIN_SAMPLES_PER_WINDOW)
+            {
+                // too few reads for a p99, let the window grow
+                continue;
+            }
+            uint64_t p99Us = PerCoreHistogram::GetPercentile(window, TARGET_PERCENTILE);
+            volumeSlo.windowStart = now;
+
+            // p99Us is the upper bound of a bucket, up to 12.5% above the real value,
+            // so a bucket that straddles the target neither raises nor lowers the level
+            if (p99Us > targetUs + targetUs / PerCoreHistogram::NUM_SUB_BUCKETS)
+            {
+                violated = true;
+            }
+            else if (p99Us > targetUs)
+            {
+                satisfied = false;
+            }
+        }
+    }
+
+    if (violated == true)
+    {
+        if (throttleLevel < MAX_THROTTLE_LEVEL)
+        {
+            throttleLevel++;
+        }
+    }
+    else if (satisfied == true && throttleLevel > 0)
+    {
+        throttleLevel--;
+    }
+    return throttleLevel;
+}
+
+uint32_t
+LatencySloController::GetThrottleLevel(void)
+{
+    return throttleLevel;
+}
+
+} // namespace pos
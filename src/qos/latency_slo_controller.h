@@ -0,0 +1,77 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "src/qos/qos_common.h"
+#include "src/telemetry/telemetry_client/per_core_histogram.h"
+
+namespace pos
+{
+// Tracks read latency of the volumes that have a p99 target and turns the
+// result of every window into a backend throttle level.
+// Level 0 leaves backend events alone; each level above slows them further.
+class LatencySloController
+{
+public:
+    LatencySloController(void);
+    virtual ~LatencySloController(void);
+
+    void SetTarget(uint32_t arrayId, uint32_t volId, uint64_t targetUs);
+    uint64_t GetTarget(uint32_t arrayId, uint32_t volId);
+    void Record(uint32_t arrayId, uint32_t volId, uint64_t latencyUs);
+    uint32_t Evaluate(void);
+    uint32_t GetThrottleLevel(void);
+
+    static const uint32_t MAX_THROTTLE_LEVEL = 5;
+    static const uint64_t MIN_SAMPLES_PER_WINDOW = 64;
+
+private:
+    struct VolumeSlo
+    {
+        std::atomic<uint64_t> targetUs{0};
+        // allocated on the first target and kept until destruction,
+        // because completions may still be recording into it
+        std::atomic<PerCoreHistogram*> latency{nullptr};
+        std::vector<uint64_t> windowStart;
+    };
+
+    VolumeSlo slo[MAX_ARRAY_COUNT][MAX_VOLUME_COUNT];
+    uint32_t throttleLevel = 0;
+    static constexpr double TARGET_PERCENTILE = 0.99;
+};
+
+} // namespace pos
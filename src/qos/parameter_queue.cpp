@@ -78,11 +78,23 @@ ParameterQueue::EnqueueParameter(uint32_t id1, uint32_t id2, bw_iops_parameter&
  */
 /* --------------------------------------------------------------------------*/
 bw_iops_parameter
-ParameterQueue::DequeueParameter(uint32_t id1, uint32_t id2)
+ParameterQueue::DequeueParameter(uint32_t id1, uint32_t id2, bool nonBlocking)
 {
     bw_iops_parameter ret;
     ret.valid = M_INVALID_ENTRY;
-    std::unique_lock<std::mutex> uniqueLock(queueLock[id1][id2]);
+    std::unique_lock<std::mutex> uniqueLock(queueLock[id1][id2], std::defer_lock);
+    if (true == nonBlocking)
+    {
+        // a reactor never waits for the producer, a busy queue is read at the next round
+        if (false == uniqueLock.try_lock())
+        {
+            return ret;
+        }
+    }
+    else
+    {
+        uniqueLock.lock();
+    }
     if (false == parameterQueue[id1][id2].empty())
     {
         ret = parameterQueue[id1][id2].front();
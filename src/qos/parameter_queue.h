@@ -46,7 +46,7 @@ public:
     ParameterQueue(void);
     ~ParameterQueue(void);
     void EnqueueParameter(uint32_t id1, uint32_t id2, bw_iops_parameter& param);
-    bw_iops_parameter DequeueParameter(uint32_t id1, uint32_t id2);
+    bw_iops_parameter DequeueParameter(uint32_t id1, uint32_t id2, bool nonBlocking = false);
     void ClearParameters(uint32_t id2);
 
 private:
@@ -55,6 +55,7 @@ QosArrayManager::QosArrayManager(uint32_t arrayIndex, QosContext* qosCtx,
     initialized = false;
     volMinPolicyInEffect = false;
     gcFreeSegments = UPPER_GC_TH + 1;
+    gcUrgentThreshold = LOW_GC_TH;
     minBwGuarantee = false;
     volumePolicyUpdated = false;
     qosVolumeManager = new QosVolumeManager(qosCtx, feQosEnabled,
@@ -115,6 +116,7 @@ QosArrayManager::ResetVolumeThrottling(void)
     {
         qosVolumeManager->ResetVolumeThrottling(volId, arrayId);
     }
+    qosVolumeManager->ResetGroupThrottling();
 }
 /* --------------------------------------------------------------------------*/
 /**
@@ -385,6 +387,55 @@ QosArrayManager::GetVolumeLimit(uint32_t volId, bool iops)
   */
 /* --------------------------------------------------------------------------*/
 void
+QosArrayManager::SetVolumeBurst(uint32_t volId, uint32_t percent, uint32_t durationSec)
+{
+    qosVolumeManager->SetVolumeBurst(volId, percent, durationSec);
+}
+/* --------------------------------------------------------------------------*/
+/**
+  * @Synopsis
+  *
+  * @Returns
+  */
+/* --------------------------------------------------------------------------*/
+int64_t
+QosArrayManager::GetVolumeBurstCredit(uint32_t volId, bool iops)
+{
+    return qosVolumeManager->GetVolumeBurstCredit(volId, iops);
+}
+/* --------------------------------------------------------------------------*/
+/**
+  * @Synopsis
+  *
+  * @Returns
+  */
+/* --------------------------------------------------------------------------*/
+int
+QosArrayManager::CreateQosGroup(const std::string& name, const std::vector<uint32_t>& volumes,
+    const std::vector<uint32_t>& nqnIds, uint64_t maxBw, uint64_t maxIops)
+{
+    return qosVolumeManager->CreateQosGroup(name, volumes, nqnIds, maxBw, maxIops);
+}
+/* --------------------------------------------------------------------------*/
+/**
+  * @Synopsis
+  *
+  * @Returns
+  */
+/* --------------------------------------------------------------------------*/
+void
+QosArrayManager::GetQosGroupUsage(std::vector<qos_group_usage>& groupUsage)
+{
+    qosVolumeManager->GetQosGroupUsage(groupUsage);
+}
+/* --------------------------------------------------------------------------*/
+/**
+  * @Synopsis
+  *
+  * @Returns
+  */
+/* --------------------------------------------------------------------------*/
+void
 QosArrayManager::SetGcFreeSegment(uint32_t freeSegments)
 {
     gcFreeSegments = freeSegments;
@@ -408,6 +459,30 @@ QosArrayManager::GetGcFreeSegment(void)
   * @Returns
   */
 /* --------------------------------------------------------------------------*/
+void
+QosArrayManager::SetGcUrgentThreshold(uint32_t threshold)
+{
+    gcUrgentThreshold = threshold;
+}
+/* --------------------------------------------------------------------------*/
+/**
+  * @Synopsis
+  *
+  * @Returns
+  */
+/* --------------------------------------------------------------------------*/
+uint32_t
+QosArrayManager::GetGcUrgentThreshold(void)
+{
+    return gcUrgentThreshold;
+}
+/* --------------------------------------------------------------------------*/
+/**
+  * @Synopsis
+  *
+  * @Returns
+  */
+/* --------------------------------------------------------------------------*/
 std::vector<int>
 QosArrayManager::GetVolumeFromActiveSubsystem(uint32_t nqnId)
 {
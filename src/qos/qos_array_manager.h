@@ -69,9 +69,16 @@ public:
     void SetVolumeLimit(uint32_t volId, int64_t weight, bool iops);
     void GetMountedVolumes(std::list<uint32_t>& volumeList);
     int64_t GetVolumeLimit(uint32_t volId, bool iops);
+    void SetVolumeBurst(uint32_t volId, uint32_t percent, uint32_t durationSec);
+    int64_t GetVolumeBurstCredit(uint32_t volId, bool iops);
+    int CreateQosGroup(const std::string& name, const std::vector<uint32_t>& volumes,
+        const std::vector<uint32_t>& nqnIds, uint64_t maxBw, uint64_t maxIops);
+    void GetQosGroupUsage(std::vector<qos_group_usage>& groupUsage);
     bool IsVolumePolicyUpdated(void);
     void SetGcFreeSegment(uint32_t count);
     uint32_t GetGcFreeSegment(void);
+    void SetGcUrgentThreshold(uint32_t threshold);
+    uint32_t GetGcUrgentThreshold(void);
     void GetVolumePolicyMap(std::map<uint32_t, qos_vol_policy>& volumePolicyMapCopy);
     void UpdateSubsystemToVolumeMap(uint32_t nqnId, uint32_t volId);
     void DeleteVolumeFromSubsystemMap(uint32_t nqnId, uint32_t volId);
@@ -96,6 +103,7 @@ private:
     std::atomic<bool> minBwGuarantee;
     std::atomic<bool> volumePolicyUpdated;
     uint32_t gcFreeSegments;
+    uint32_t gcUrgentThreshold;
     qos_vol_policy volPolicyCli[MAX_VOLUME_COUNT];
     std::map<uint32_t, qos_vol_policy> volumePolicyMapCli;
     QosManager* qosManager;
@@ -32,6 +32,9 @@
 
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include "src/device/base/ublock_device.h"
 #include "src/event_scheduler/event.h"
 #include "src/include/array_mgmt_policy.h"
@@ -118,6 +121,13 @@ const uint32_t DEFAULT_MIN_IOPS = 1000;
 const int64_t DEFAULT_MIN_BW_PCS = DEFAULT_MIN_BW_MBPS * (M_KBYTES * M_KBYTES / (PARAMETER_COLLECTION_INTERVAL));
 const int64_t DEFAULT_MIN_IO_PCS = DEFAULT_MIN_IOPS / PARAMETER_COLLECTION_INTERVAL;
 const int64_t DEFAULT_MAX_BW_IOPS = INT64_MAX / PARAMETER_COLLECTION_INTERVAL;
+// burst limit in percent of the max limit, 100 disables burst credits
+const uint32_t DEFAULT_BURST_PERCENT = 100;
+const uint32_t MAX_BURST_PERCENT = 1000;
+const uint32_t DEFAULT_BURST_DURATION_SEC = 60;
+const uint32_t MAX_BURST_DURATION_SEC = 3600;
+const uint32_t MAX_QOS_GROUP_COUNT = 32;
+const int32_t NO_QOS_GROUP = -1;
 const uint32_t M_BW_10_KB = 10 * 1024;
 const uint32_t BW_CORRECTION_UNIT = 5;
 const uint32_t IOPS_CORRECTION_UNIT = 100;
@@ -303,6 +313,27 @@ struct qos_vol_policy
     bool maxValueChanged;
 };
 
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+struct qos_group_usage
+{
+    qos_group_usage(void)
+    {
+        maxBw = 0;
+        maxIops = 0;
+        usedBw = 0;
+        usedIops = 0;
+    }
+    std::string name;
+    std::vector<uint32_t> volumes;
+    std::vector<uint32_t> subsystems;
+    uint64_t maxBw;
+    uint64_t maxIops;
+    uint64_t usedBw;
+    uint64_t usedIops;
+};
+
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
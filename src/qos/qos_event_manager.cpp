@@ -208,9 +208,9 @@ QosEventManager::_EnqueueParams(uint32_t workerId, BackendEvent event, bw_iops_p
  */
 /* --------------------------------------------------------------------------*/
 bw_iops_parameter
-QosEventManager::DequeueParams(uint32_t workerId, BackendEvent event)
+QosEventManager::DequeueParams(uint32_t workerId, BackendEvent event, bool nonBlocking)
 {
-    return parameterQueue->DequeueParameter(workerId, event);
+    return parameterQueue->DequeueParameter(workerId, event, nonBlocking);
 }
 
 /* --------------------------------------------------------------------------*/
@@ -55,7 +55,7 @@ public:
     int IOWorkerPoller(uint32_t id, SubmissionAdapter* ioSubmission);
     void HandleEventUbioSubmission(SubmissionAdapter* ioSubmission,
         SubmissionNotifier* submissionNotifier, uint32_t id, UbioSmartPtr ubio);
-    bw_iops_parameter DequeueParams(uint32_t workerId, BackendEvent event);
+    bw_iops_parameter DequeueParams(uint32_t workerId, BackendEvent event, bool nonBlocking = false);
     int64_t GetEventWeightWRR(BackendEvent eventId);
     int64_t GetDefaultEventWeightWRR(BackendEvent eventId);
     void SetEventWeightWRR(BackendEvent eventId, int64_t weight);
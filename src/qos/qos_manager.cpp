@@ -116,6 +116,40 @@ QosManager::QosManager(SpdkEnvCaller* spdkEnvCaller,
         previousDelay[reactor] = 0;
     }
 
+    latencySloController = new LatencySloController();
+    latencySloSliceCnt = 0;
+    appliedSloThrottleLevel = 0;
+    for (uint32_t event = 0; event < BackendEvent_Count; event++)
+    {
+        weightBeforeSloThrottle[event] = M_DEFAULT_WEIGHT;
+    }
+    uint64_t horizonSec = FreeSpaceForecaster::DEFAULT_HORIZON_MS / 1000;
+    ret = configManager->GetValue("fe_qos", "gc_forecast_horizon_sec", &horizonSec, CONFIG_TYPE_UINT64);
+    if (ret != EID(SUCCESS) || horizonSec == 0)
+    {
+        horizonSec = FreeSpaceForecaster::DEFAULT_HORIZON_MS / 1000;
+    }
+    freeSpaceForecaster = new FreeSpaceForecaster(horizonSec * 1000);
+    gcForecastSliceCnt = 0;
+    appliedGcBoostLevel = 0;
+    gcWeightBeforeBoost = M_DEFAULT_WEIGHT;
+
+    controlInPoller = false;
+    controlPollerPeriodUs = DEFAULT_CONTROL_POLLER_PERIOD_US;
+    ret = configManager->GetValue("fe_qos", "control_in_poller", &controlInPoller, CONFIG_TYPE_BOOL);
+    if (ret != EID(SUCCESS))
+    {
+        controlInPoller = false;
+    }
+    uint64_t periodUs = 0;
+    ret = configManager->GetValue("fe_qos", "control_poller_period_us", &periodUs, CONFIG_TYPE_UINT64);
+    if (ret == EID(SUCCESS) && periodUs != 0)
+    {
+        controlPollerPeriodUs = periodUs;
+    }
+    currentInternalManager = monitoringManager;
+    controlNextTick = 0;
+
     currentNumberOfArrays = 0;
     systemMinPolicy = false;
     affinityManager = AffinityManagerSingleton::Instance();
@@ -143,6 +177,8 @@ QosManager::~QosManager(void)
     delete policyManager;
     delete correctionManager;
     delete qosContext;
+    delete latencySloController;
+    delete freeSpaceForecaster;
     if (spdkEnvCaller != nullptr)
     {
         delete spdkEnvCaller;
@@ -182,6 +218,12 @@ QosManager::Initialize(void)
     {
         return;
     }
+    if (true == controlInPoller && nullptr != spdkManager && true == feQosEnabled)
+    {
+        spdkManager->RegisterControlPoller(controlPollerPeriodUs);
+        initialized = true;
+        return;
+    }
     cpuSet = affinityManager->GetCpuSet(CoreType::QOS);
     qosThread = new std::thread(&QosManager::_QosWorker, this);
     initialized = true;
@@ -211,6 +253,7 @@ QosManager::FinalizeSpdkManager(void)
 {
     if (true == feQosEnabled)
     {
+        spdkManager->UnregisterControlPoller();
         spdkManager->Finalize();
     }
     POS_TRACE_INFO(EID(QOS_FINALIZATION), "QosSpdkManager Finalization complete");
@@ -301,6 +344,8 @@ QosManager::PeriodicalJob(uint64_t* nextTick)
         IODispatcherSubmissionSingleton::Instance()->RefillRemaining(SPDK_SEC_TO_USEC
             / IBOF_QOS_TIMESLICE_IN_USEC);
         _ControlThrottling();
+        _ControlLatencySlo();
+        _ControlGcWeightByForecast();
     }
 }
 
@@ -355,24 +400,49 @@ QosManager::_QosWorker(void)
 {
     sched_setaffinity(0, sizeof(cpuSet), &cpuSet);
     pthread_setname_np(pthread_self(), "QoSWorker");
-    QosInternalManager* currentManager = monitoringManager;
-    QosInternalManagerType nextManagerType = QosInternalManager_Unknown;
-    QosInternalManager* nextManager = nullptr;
-    uint64_t nextTick = 0;
-    while (nullptr != currentManager)
+    while (true == ExecuteControlStep())
     {
-        if (true == IsExitQosSet())
-        {
-            POS_TRACE_INFO(EID(QOS_FINALIZATION), "QosManager Finalization Triggered, QosWorker thread exit");
-            break;
-        }
-        currentManager->Execute();
-        nextManagerType = currentManager->GetNextManagerType();
-        nextManager = _GetNextInternalManager(nextManagerType);
-        currentManager = nextManager;
+    }
+    if (true == IsExitQosSet())
+    {
+        POS_TRACE_INFO(EID(QOS_FINALIZATION), "QosManager Finalization Triggered, QosWorker thread exit");
+    }
+}
 
-        PeriodicalJob(&nextTick);
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis
+ *
+ * @Returns   true if the control loop runs from a reactor poller
+ */
+/* --------------------------------------------------------------------------*/
+bool
+QosManager::IsControlInPoller(void)
+{
+    return controlInPoller;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis  Runs one internal manager and the periodical job. The qos thread
+ *            calls it back to back, the control poller once per period.
+ *
+ * @Returns   false once the control loop is finished
+ */
+/* --------------------------------------------------------------------------*/
+bool
+QosManager::ExecuteControlStep(void)
+{
+    if (nullptr == currentInternalManager || true == IsExitQosSet())
+    {
+        return false;
     }
+    currentInternalManager->Execute();
+    QosInternalManagerType nextManagerType = currentInternalManager->GetNextManagerType();
+    currentInternalManager = _GetNextInternalManager(nextManagerType);
+
+    PeriodicalJob(&controlNextTick);
+    return true;
 }
 
 /* --------------------------------------------------------------------------*/
@@ -416,7 +486,8 @@ QosManager::_GetNextInternalManager(QosInternalManagerType internalManagerType)
 bw_iops_parameter
 QosManager::DequeueEventParams(uint32_t workerId, BackendEvent event)
 {
-    return qosEventManager->DequeueParams(workerId, event);
+    // the control poller runs on a reactor and must not wait for the event workers
+    return qosEventManager->DequeueParams(workerId, event, controlInPoller);
 }
 
 /* --------------------------------------------------------------------------*/
@@ -627,6 +698,173 @@ QosManager::IsMinimumPolicyInEffectInSystem(void)
     return systemMinPolicy;
 }
 
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis  Record the submit-to-completion latency of a host io
+ *
+ * @Param    latencyUs
+ */
+/* --------------------------------------------------------------------------*/
+void
+QosManager::RecordHostLatency(uint64_t latencyUs)
+{
+    hostLatency.Record(latencyUs);
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis  Cumulative host latency histogram in microseconds,
+ *            PerCoreHistogram::GetInterval of two results gives a window
+ *
+ * @Returns   counts per bucket of PerCoreHistogram
+ */
+/* --------------------------------------------------------------------------*/
+std::vector<uint64_t>
+QosManager::CollectHostLatency(void)
+{
+    return hostLatency.Collect();
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis  Record the read latency of a volume for its latency target
+ *
+ * @Param    arrayId
+ * @Param    volId
+ * @Param    latencyUs
+ */
+/* --------------------------------------------------------------------------*/
+void
+QosManager::RecordVolumeReadLatency(uint32_t arrayId, uint32_t volId, uint64_t latencyUs)
+{
+    latencySloController->Record(arrayId, volId, latencyUs);
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis  Set the p99 read latency target of a volume, 0 clears it
+ *
+ * @Param    arrayId
+ * @Param    volId
+ * @Param    targetUs
+ */
+/* --------------------------------------------------------------------------*/
+void
+QosManager::SetVolumeReadLatencyTarget(uint32_t arrayId, uint32_t volId, uint64_t targetUs)
+{
+    latencySloController->SetTarget(arrayId, volId, targetUs);
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis
+ *
+ * @Returns
+ */
+/* --------------------------------------------------------------------------*/
+uint64_t
+QosManager::GetVolumeReadLatencyTarget(uint32_t arrayId, uint32_t volId)
+{
+    return latencySloController->GetTarget(arrayId, volId);
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis  Raise the floor of the gc weight step by step while the free
+ *            segments of some array are forecast to reach the urgent
+ *            threshold soon, and give the original weight back afterwards.
+ *            Runs after the latency target control, so a close urgent gc
+ *            wins over the latency target.
+ */
+/* --------------------------------------------------------------------------*/
+void
+QosManager::_ControlGcWeightByForecast(void)
+{
+    gcForecastSliceCnt++;
+    if (gcForecastSliceCnt < GC_FORECAST_WINDOW_SLICES)
+    {
+        return;
+    }
+    gcForecastSliceCnt = 0;
+
+    uint64_t windowMs = GC_FORECAST_WINDOW_SLICES * IBOF_QOS_TIMESLICE_IN_USEC / 1000;
+    for (uint32_t arrayId = 0; arrayId < MAX_ARRAY_COUNT; arrayId++)
+    {
+        freeSpaceForecaster->Update(arrayId, qosArrayManager[arrayId]->GetGcFreeSegment(),
+            qosArrayManager[arrayId]->GetGcUrgentThreshold(), windowMs);
+    }
+    uint32_t level = freeSpaceForecaster->Evaluate();
+    if (level == 0 && appliedGcBoostLevel == 0)
+    {
+        return;
+    }
+
+    static const int64_t GC_BOOST_LEVEL_WEIGHT[FreeSpaceForecaster::MAX_BOOST_LEVEL + 1] = {
+        PRIO_WT_LOWEST, PRIO_WT_LOW, PRIO_WT_MEDIUM, PRIO_WT_HIGH, PRIO_WT_HIGHER, PRIO_WT_HIGHEST};
+    if (appliedGcBoostLevel == 0)
+    {
+        gcWeightBeforeBoost = GetEventWeightWRR(BackendEvent_GC);
+    }
+    int64_t weight = gcWeightBeforeBoost;
+    if (level != 0)
+    {
+        // reapplied every window, the other controllers may have lowered it
+        weight = std::max(GetEventWeightWRR(BackendEvent_GC), GC_BOOST_LEVEL_WEIGHT[level]);
+    }
+    SetEventWeightWRR(BackendEvent_GC, weight);
+    if (level != appliedGcBoostLevel)
+    {
+        POS_TRACE_INFO(EID(QOS_GC_FORECAST_BOOST_CHANGED),
+            "gc boost level for free space forecast: {} -> {}, gc weight: {}",
+            appliedGcBoostLevel, level, weight);
+    }
+    appliedGcBoostLevel = level;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis  Slow down flush, gc and rebuild while a latency target is missed
+ *            and give the original weights back once all targets hold again
+ */
+/* --------------------------------------------------------------------------*/
+void
+QosManager::_ControlLatencySlo(void)
+{
+    latencySloSliceCnt++;
+    if (latencySloSliceCnt < LATENCY_SLO_WINDOW_SLICES)
+    {
+        return;
+    }
+    latencySloSliceCnt = 0;
+
+    uint32_t level = latencySloController->Evaluate();
+    if (level == appliedSloThrottleLevel)
+    {
+        return;
+    }
+
+    static const BackendEvent SLO_THROTTLED_EVENTS[] = {
+        BackendEvent_Flush, BackendEvent_GC, BackendEvent_UserdataRebuild};
+    static const int64_t SLO_LEVEL_WEIGHT[LatencySloController::MAX_THROTTLE_LEVEL + 1] = {
+        M_DEFAULT_WEIGHT, PRIO_WT_HIGH, PRIO_WT_MEDIUM, PRIO_WT_LOW, PRIO_WT_LOWER, PRIO_WT_LOWEST};
+    for (BackendEvent event : SLO_THROTTLED_EVENTS)
+    {
+        if (appliedSloThrottleLevel == 0)
+        {
+            weightBeforeSloThrottle[event] = GetEventWeightWRR(event);
+        }
+        int64_t weight = weightBeforeSloThrottle[event];
+        if (level != 0)
+        {
+            weight = std::min(weight, SLO_LEVEL_WEIGHT[level]);
+        }
+        SetEventWeightWRR(event, weight);
+    }
+    POS_TRACE_INFO(EID(QOS_LATENCY_SLO_THROTTLE_CHANGED),
+        "backend throttle level for latency target: {} -> {}", appliedSloThrottleLevel, level);
+    appliedSloThrottleLevel = level;
+}
+
 /* --------------------------------------------------------------------------*/
 /**
  * @Synopsis
@@ -831,6 +1069,59 @@ QosManager::GetVolumeLimit(uint32_t volId, bool iops, uint32_t arrayId)
     return qosArrayManager[arrayId]->GetVolumeLimit(volId, iops);
 }
 
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis
+ *
+ * @Returns
+ */
+/* --------------------------------------------------------------------------*/
+void
+QosManager::SetVolumeBurst(uint32_t volId, uint32_t percent, uint32_t durationSec, uint32_t arrayId)
+{
+    qosArrayManager[arrayId]->SetVolumeBurst(volId, percent, durationSec);
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis
+ *
+ * @Returns
+ */
+/* --------------------------------------------------------------------------*/
+int64_t
+QosManager::GetVolumeBurstCredit(uint32_t volId, bool iops, uint32_t arrayId)
+{
+    return qosArrayManager[arrayId]->GetVolumeBurstCredit(volId, iops);
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis
+ *
+ * @Returns
+ */
+/* --------------------------------------------------------------------------*/
+int
+QosManager::CreateQosGroup(uint32_t arrayId, const std::string& name, const std::vector<uint32_t>& volumes,
+    const std::vector<uint32_t>& nqnIds, uint64_t maxBw, uint64_t maxIops)
+{
+    return qosArrayManager[arrayId]->CreateQosGroup(name, volumes, nqnIds, maxBw, maxIops);
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis
+ *
+ * @Returns
+ */
+/* --------------------------------------------------------------------------*/
+void
+QosManager::GetQosGroupUsage(uint32_t arrayId, std::vector<qos_group_usage>& groupUsage)
+{
+    qosArrayManager[arrayId]->GetQosGroupUsage(groupUsage);
+}
+
 /* --------------------------------------------------------------------------*/
 /**
  * @Synopsis
@@ -870,6 +1161,19 @@ QosManager::GetGcFreeSegment(uint32_t arrayId)
     return qosArrayManager[arrayId]->GetGcFreeSegment();
 }
 
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis
+ *
+ * @Returns
+ */
+/* --------------------------------------------------------------------------*/
+void
+QosManager::SetGcUrgentThreshold(uint32_t threshold, uint32_t arrayId)
+{
+    qosArrayManager[arrayId]->SetGcUrgentThreshold(threshold);
+}
+
 /* --------------------------------------------------------------------------*/
 /**
  * @Synopsis
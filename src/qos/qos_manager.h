@@ -54,8 +54,11 @@
 #include "src/spdk_wrapper/caller/spdk_env_caller.h"
 #include "src/spdk_wrapper/caller/spdk_pos_nvmf_caller.h"
 #include "src/qos/exit_handler.h"
+#include "src/qos/free_space_forecaster.h"
+#include "src/qos/latency_slo_controller.h"
 #include "src/qos/qos_array_manager.h"
 #include "src/qos/qos_common.h"
+#include "src/telemetry/telemetry_client/per_core_histogram.h"
 #include "submission_adapter.h"
 #include "submission_notifier.h"
 
@@ -89,6 +92,8 @@ public:
         AffinityManager* affinityManager = AffinityManagerSingleton::Instance());
     virtual ~QosManager(void);
     void Initialize(void);
+    bool ExecuteControlStep(void);
+    bool IsControlInPoller(void);
     void InitializeSpdkManager(void);
     virtual int IOWorkerPoller(uint32_t id, SubmissionAdapter* ioSubmission);
     virtual void HandleEventUbioSubmission(SubmissionAdapter* ioSubmission,
@@ -114,13 +119,19 @@ public:
     void HandlePosIoSubmission(IbofIoSubmissionAdapter* aioSubmission, VolumeIoSmartPtr io);
     int VolumeQosPoller(poller_structure* param, IbofIoSubmissionAdapter* aioSubmission);
     virtual bool IsFeQosEnabled(void);
-    qos_backend_policy GetBackendPolicy(BackendEvent);
+    virtual qos_backend_policy GetBackendPolicy(BackendEvent);
     int UpdateBackendPolicy(BackendEvent event, qos_backend_policy rebuildPolicy);
     void SetVolumeLimit(uint32_t volId, int64_t weight, bool iops, uint32_t arrayId);
     int64_t GetVolumeLimit(uint32_t volId, bool iops, uint32_t arrayId);
+    void SetVolumeBurst(uint32_t volId, uint32_t percent, uint32_t durationSec, uint32_t arrayId);
+    int64_t GetVolumeBurstCredit(uint32_t volId, bool iops, uint32_t arrayId);
+    int CreateQosGroup(uint32_t arrayId, const std::string& name, const std::vector<uint32_t>& volumes,
+        const std::vector<uint32_t>& nqnIds, uint64_t maxBw, uint64_t maxIops);
+    void GetQosGroupUsage(uint32_t arrayId, std::vector<qos_group_usage>& groupUsage);
     bool IsVolumePolicyUpdated(uint32_t arrayId);
     void SetGcFreeSegment(uint32_t count, uint32_t arrayId);
     uint32_t GetGcFreeSegment(uint32_t arrayId);
+    void SetGcUrgentThreshold(uint32_t threshold, uint32_t arrayId);
     void GetVolumePolicyMap(uint32_t arrayId, std::map<uint32_t, qos_vol_policy>& volumePolicyMapCopy);
     std::vector<int> GetVolumeFromActiveSubsystem(uint32_t nqnId, uint32_t arrayId);
     int32_t GetArrayIdFromMap(std::string arrayName);
@@ -131,6 +142,11 @@ public:
     void GetSubsystemVolumeMap(std::unordered_map<int32_t, std::vector<int>>& subsysVolMap, uint32_t arrayId);
     uint32_t GetNoContentionCycles(void);
     virtual bool IsMinimumPolicyInEffectInSystem(void);
+    virtual void RecordHostLatency(uint64_t latencyUs);
+    virtual std::vector<uint64_t> CollectHostLatency(void);
+    virtual void RecordVolumeReadLatency(uint32_t arrayId, uint32_t volId, uint64_t latencyUs);
+    void SetVolumeReadLatencyTarget(uint32_t arrayId, uint32_t volId, uint64_t targetUs);
+    uint64_t GetVolumeReadLatencyTarget(uint32_t arrayId, uint32_t volId);
     void ResetCorrection(void);
     void FinalizeSpdkManager(void);
     void GetMountedVolumes(std::list<std::pair<uint32_t, uint32_t>>& volumeList);
@@ -148,6 +164,8 @@ private:
     virtual void _Finalize(void);
     void _QosWorker(void);
     void _ControlThrottling(void);
+    void _ControlLatencySlo(void);
+    void _ControlGcWeightByForecast(void);
     QosInternalManager* _GetNextInternalManager(QosInternalManagerType internalManagerType);
     std::thread* qosThread;
     cpu_set_t cpuSet;
@@ -180,6 +198,24 @@ private:
     AffinityManager* affinityManager;
 
     uint64_t previousDelay[M_MAX_REACTORS];
+    PerCoreHistogram hostLatency;
+    LatencySloController* latencySloController;
+    uint32_t latencySloSliceCnt;
+    uint32_t appliedSloThrottleLevel;
+    int64_t weightBeforeSloThrottle[BackendEvent_Count];
+    // 100ms windows with the 10ms time slice
+    static const uint32_t LATENCY_SLO_WINDOW_SLICES = 10;
+    FreeSpaceForecaster* freeSpaceForecaster;
+    uint32_t gcForecastSliceCnt;
+    uint32_t appliedGcBoostLevel;
+    int64_t gcWeightBeforeBoost;
+    static const uint32_t GC_FORECAST_WINDOW_SLICES = 10;
+    // run the control loop from a reactor poller instead of the qos core
+    bool controlInPoller;
+    uint64_t controlPollerPeriodUs;
+    QosInternalManager* currentInternalManager;
+    uint64_t controlNextTick;
+    static const uint64_t DEFAULT_CONTROL_POLLER_PERIOD_US = 1000;
 };
 
 using QosManagerSingleton = Singleton<QosManager>;
@@ -48,6 +48,7 @@ namespace pos
 // SPDK MANAGER INITIALIZATIONS
 std::atomic<bool> QosSpdkManager::registerQosPollerDone(false);
 std::atomic<bool> QosSpdkManager::unregistrationComplete(false);
+std::atomic<bool> QosSpdkManager::controlPollerDone(false);
 
 /* --------------------------------------------------------------------------*/
 /**
@@ -63,7 +64,9 @@ QosSpdkManager::QosSpdkManager(QosContext* qosCtx, bool feQos,
     reactorId(M_MAX_REACTORS + 1),
     feQosEnabled(feQos),
     eventFrameworkApi(eventFrameworkApiArg),
-    spdkPosNvmfCaller(spdkPosNvmfCaller)
+    spdkPosNvmfCaller(spdkPosNvmfCaller),
+    controlPoller(nullptr),
+    controlPollerPeriodUs(0)
 {
     for (int i = 0; i < M_MAX_REACTORS; i++)
     {
@@ -369,4 +372,120 @@ QosSpdkManager::RegisterQosPoller(void* arg1, void* arg2)
     }
 }
 
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis
+ *
+ * @Returns
+ */
+/* --------------------------------------------------------------------------*/
+int
+QosSpdkManager::SpdkQosControlPoller(void* arg1)
+{
+    return QosManagerSingleton::Instance()->ExecuteControlStep() ? 1 : 0;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis
+ *
+ * @Returns
+ */
+/* --------------------------------------------------------------------------*/
+void
+QosSpdkManager::RegisterControlPoller(uint64_t periodUs)
+{
+    controlPollerPeriodUs = periodUs;
+    controlPollerDone = false;
+    uint32_t reactor = eventFrameworkApi->GetFirstReactor();
+    bool succeeded = eventFrameworkApi->SendSpdkEvent(reactor, ControlPollerRegister, this, nullptr);
+    if (unlikely(false == succeeded))
+    {
+        POS_EVENT_ID eventId = EID(QOS_POLLER_REGISTRATION_FAILED);
+        POS_TRACE_ERROR(static_cast<int>(eventId),
+            "Failed to register Qos control poller on reactor #: {}", reactor);
+        return;
+    }
+    while (false == controlPollerDone)
+    {
+        usleep(1);
+    }
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis
+ *
+ * @Returns
+ */
+/* --------------------------------------------------------------------------*/
+void
+QosSpdkManager::ControlPollerRegister(void* arg1, void* arg2)
+{
+    QosSpdkManager* spdkManager = static_cast<QosSpdkManager*>(arg1);
+    SpdkThreadCaller spdkThreadCaller;
+    char name[] = "qos_control_poller";
+    spdkManager->controlPoller = static_cast<spdk_poller*>(spdkThreadCaller.SpdkPollerRegister(SpdkQosControlPoller,
+        nullptr, spdkManager->controlPollerPeriodUs, name));
+    if (unlikely(nullptr == spdkManager->controlPoller))
+    {
+        POS_EVENT_ID eventId = EID(QOS_POLLER_REGISTRATION_FAILED);
+        POS_TRACE_ERROR(static_cast<int>(eventId),
+            "Failed to register Qos control poller on reactor #: {}", spdkManager->eventFrameworkApi->GetCurrentReactor());
+    }
+    else
+    {
+        POS_TRACE_INFO(EID(QOS_POLLER_REGISTRATION), "Qos control poller registered on reactor {}, period: {}us",
+            spdkManager->eventFrameworkApi->GetCurrentReactor(), spdkManager->controlPollerPeriodUs);
+    }
+    controlPollerDone = true;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis
+ *
+ * @Returns
+ */
+/* --------------------------------------------------------------------------*/
+void
+QosSpdkManager::UnregisterControlPoller(void)
+{
+    if (nullptr == controlPoller)
+    {
+        return;
+    }
+    controlPollerDone = false;
+    uint32_t reactor = eventFrameworkApi->GetFirstReactor();
+    bool succeeded = eventFrameworkApi->SendSpdkEvent(reactor, ControlPollerUnregister, this, nullptr);
+    if (unlikely(false == succeeded))
+    {
+        POS_EVENT_ID eventId = EID(QOS_POLLER_UNREGISTRATION_FAILED);
+        POS_TRACE_ERROR(static_cast<int>(eventId),
+            "Failed to un-register Qos control poller on reactor #: {}", reactor);
+        return;
+    }
+    while (false == controlPollerDone)
+    {
+        usleep(1);
+    }
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis
+ *
+ * @Returns
+ */
+/* --------------------------------------------------------------------------*/
+void
+QosSpdkManager::ControlPollerUnregister(void* arg1, void* arg2)
+{
+    QosSpdkManager* spdkManager = static_cast<QosSpdkManager*>(arg1);
+    SpdkThreadCaller spdkThreadCaller;
+    spdkThreadCaller.SpdkPollerUnregister(&spdkManager->controlPoller);
+    spdkManager->controlPoller = nullptr;
+    controlPollerDone = true;
+}
+
 } // namespace pos
@@ -56,10 +56,16 @@ public:
     static void RegisterQosPoller(void* arg1, void* arg2);
     static void PollerUnregister(void* arg1, void* arg2);
     static int SpdkVolumeQosPoller(void* arg1);
+    void RegisterControlPoller(uint64_t periodUs);
+    void UnregisterControlPoller(void);
+    static void ControlPollerRegister(void* arg1, void* arg2);
+    static void ControlPollerUnregister(void* arg1, void* arg2);
+    static int SpdkQosControlPoller(void* arg1);
     uint32_t GetReactorId(void);
     void SetReactorId(uint32_t id);
     static std::atomic<bool> registerQosPollerDone;
     static std::atomic<bool> unregistrationComplete;
+    static std::atomic<bool> controlPollerDone;
     bool IsFeQosEnabled(void);
 
 private:
@@ -72,5 +78,7 @@ private:
     bool feQosEnabled;
     EventFrameworkApi* eventFrameworkApi;
     SpdkPosNvmfCaller* spdkPosNvmfCaller;
+    spdk_poller* controlPoller;
+    uint64_t controlPollerPeriodUs;
 };
 } // namespace pos
@@ -100,8 +100,15 @@ QosVolumeManager::QosVolumeManager(QosContext* qosCtx, bool feQos, uint32_t arra
         SetVolumeLimit(volId, DEFAULT_MAX_BW_IOPS, false);
         SetVolumeLimit(volId, DEFAULT_MAX_BW_IOPS, true);
         pendingIO[volId] = 0;
-        remainingVolumeBw[volId] = 0;
-        remainingVolumeIops[volId] = 0;
+        remainingVolumeBw[volId] = bwThrottling[volId] * MAX_THROTTLING_RATE;
+        remainingVolumeIops[volId] = iopsThrottling[volId] * MAX_THROTTLING_RATE;
+        tokenEpoch[volId] = 0;
+        _UpdateTokenBorrowUnit(volId);
+        burstPercent[volId] = DEFAULT_BURST_PERCENT;
+        burstDurationSec[volId] = DEFAULT_BURST_DURATION_SEC;
+        burstCreditBw[volId] = 0;
+        burstCreditIops[volId] = 0;
+        volumeQosGroup[volId] = NO_QOS_GROUP;
         dynamicBwThrottling[volId] = 0;
         dynamicIopsThrottling[volId] = 0;
         previousRemainingVolumeBw[volId] = 0;
@@ -175,6 +182,7 @@ QosVolumeManager::QosVolumeManager(QosContext* qosCtx, bool feQos, uint32_t arra
             minThrottlingBiasedRate = (float)valueFloat / 100.0;
         }
     }
+    ioCostModel = new IoCostModel(configManager);
     pthread_rwlock_init(&nqnLock, nullptr);
 }
 
@@ -190,6 +198,7 @@ QosVolumeManager::~QosVolumeManager(void)
     volumeEventPublisher->RemoveSubscriber(this, "", arrayId);
     delete bwIopsRateLimit;
     delete parameterQueue;
+    delete ioCostModel;
 
     if (spdkPosVolumeCaller != nullptr)
     {
@@ -215,6 +224,7 @@ QosVolumeManager::UpdateSubsystemToVolumeMap(uint32_t nqnId, uint32_t volId)
     }
     nqnVolumeMap[nqnId].push_back(volId);
     pthread_rwlock_unlock(&nqnLock);
+    _AssignQosGroupBySubsystem(nqnId, volId);
 }
 
 /* --------------------------------------------------------------------------*/
@@ -290,7 +300,7 @@ QosVolumeManager::HandlePosIoSubmission(IbofIoSubmissionAdapter* aioSubmission,
     }
     uint32_t volId = volIo->GetVolumeId();
 
-    if (pendingIO[volId] == 0 && _GlobalRateLimit() == false && _RateLimit(volId) == false && _SpecialRateLimit(volId) == false && _MinimumRateLimit(volId) == false)
+    if (pendingIO[volId] == 0 && _GlobalRateLimit() == false && _GroupRateLimit(volId) == false && _RateLimit(volId) == false && _SpecialRateLimit(volId) == false && _MinimumRateLimit(volId) == false)
     {
         SubmitVolumeIoToAio(aioSubmission, volId, volIo);
         return;
@@ -496,12 +506,110 @@ QosVolumeManager::GetMountedVolumes(std::list<uint32_t>& volumeList)
 bool
 QosVolumeManager::_RateLimit(int volId)
 {
-    bool results = false;
-    if ((remainingVolumeBw[volId] < 0) || (remainingVolumeIops[volId] < 0))
+    uint32_t reactor = eventFrameworkApi->GetCurrentReactor();
+    _RefreshTokenCache(reactor, volId);
+    ReactorTokenCache& cache = tokenCache[reactor][volId];
+    if (cache.bw.load(std::memory_order_relaxed) <= 0)
     {
-        results = true;
+        _ChargeTokenCache(cache.bw, _BorrowTokens(remainingVolumeBw[volId], tokenBorrowBw[volId]));
     }
-    return results;
+    if (cache.iops.load(std::memory_order_relaxed) <= 0)
+    {
+        _ChargeTokenCache(cache.iops, _BorrowTokens(remainingVolumeIops[volId], tokenBorrowIops[volId]));
+    }
+    return (cache.bw.load(std::memory_order_relaxed) <= 0) || (cache.iops.load(std::memory_order_relaxed) <= 0);
+}
+
+// only the owning reactor writes its cache, so a plain load and store is
+// enough, and ResetVolumeThrottling can still read it while it changes
+void
+QosVolumeManager::_ChargeTokenCache(std::atomic<int64_t>& cached, int64_t value)
+{
+    cached.store(cached.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+int64_t
+QosVolumeManager::_BorrowTokens(std::atomic<int64_t>& bucket, int64_t unit)
+{
+    int64_t before = bucket.fetch_sub(unit, std::memory_order_relaxed);
+    if (before <= 0)
+    {
+        bucket.fetch_add(unit, std::memory_order_relaxed);
+        return 0;
+    }
+    if (before < unit)
+    {
+        // give back what the bucket did not have
+        bucket.fetch_add(unit - before, std::memory_order_relaxed);
+        return before;
+    }
+    return unit;
+}
+
+void
+QosVolumeManager::_RefreshTokenCache(uint32_t reactor, uint32_t volId)
+{
+    ReactorTokenCache& cache = tokenCache[reactor][volId];
+    uint64_t epoch = tokenEpoch[volId].load(std::memory_order_acquire);
+    if (cache.epoch.load(std::memory_order_relaxed) == epoch)
+    {
+        return;
+    }
+    // tokens left from the previous time slice expire, while the overuse of
+    // the last submission is charged to the new one like the global deficit
+    int64_t bw = cache.bw.load(std::memory_order_relaxed);
+    int64_t iops = cache.iops.load(std::memory_order_relaxed);
+    if (bw < 0)
+    {
+        remainingVolumeBw[volId].fetch_add(bw, std::memory_order_relaxed);
+    }
+    if (iops < 0)
+    {
+        remainingVolumeIops[volId].fetch_add(iops, std::memory_order_relaxed);
+    }
+    cache.bw.store(0, std::memory_order_relaxed);
+    cache.iops.store(0, std::memory_order_relaxed);
+    cache.epoch.store(epoch, std::memory_order_relaxed);
+}
+
+// tokens the reactors borrowed in the current time slice and did not spend
+// yet are missing from the global bucket, but they are unused all the same
+void
+QosVolumeManager::_SumCachedTokens(uint32_t volId, int64_t& bw, int64_t& iops)
+{
+    uint64_t epoch = tokenEpoch[volId].load(std::memory_order_acquire);
+    bw = 0;
+    iops = 0;
+    for (uint32_t reactor = 0; reactor < M_MAX_REACTORS; reactor++)
+    {
+        ReactorTokenCache& cache = tokenCache[reactor][volId];
+        if (cache.epoch.load(std::memory_order_relaxed) == epoch)
+        {
+            bw += std::max(cache.bw.load(std::memory_order_relaxed), static_cast<int64_t>(0));
+            iops += std::max(cache.iops.load(std::memory_order_relaxed), static_cast<int64_t>(0));
+        }
+    }
+}
+
+// reactors keep borrowing from the bucket and charging their overuse to it
+// during the refill, so the refill is added as a delta instead of a store
+// that would overwrite their updates. Tokens left in the bucket expire and a
+// deficit is carried over, as in _ResetThrottlingCommon
+int64_t
+QosVolumeManager::_RefillBucket(std::atomic<int64_t>& bucket, int64_t refill)
+{
+    int64_t remaining = bucket.load(std::memory_order_relaxed);
+    bucket.fetch_add(refill - std::max(remaining, static_cast<int64_t>(0)), std::memory_order_relaxed);
+    return remaining;
+}
+
+void
+QosVolumeManager::_UpdateTokenBorrowUnit(uint32_t volId)
+{
+    int64_t bwPerSlice = bwThrottling[volId] * MAX_THROTTLING_RATE;
+    int64_t iopsPerSlice = iopsThrottling[volId] * MAX_THROTTLING_RATE;
+    tokenBorrowBw[volId] = std::max(bwPerSlice / TOKEN_BORROW_DIVISOR, static_cast<int64_t>(1));
+    tokenBorrowIops[volId] = std::max(iopsPerSlice / TOKEN_BORROW_DIVISOR, static_cast<int64_t>(1));
 }
 
 bool
@@ -516,6 +624,222 @@ QosVolumeManager::_GlobalRateLimit(void)
     return results;
 }
 
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis
+ *
+ * @Returns true if the group of the volume has used up its tokens
+ */
+/* --------------------------------------------------------------------------*/
+bool
+QosVolumeManager::_GroupRateLimit(uint32_t volId)
+{
+    int32_t groupId = volumeQosGroup[volId];
+    if (groupId == NO_QOS_GROUP)
+    {
+        return false;
+    }
+    QosGroup& group = qosGroup[groupId];
+    return (group.remainingBw <= 0) || (group.remainingIops <= 0);
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Creates a group or replaces the members and limits of the group
+ *           with the same name. maxBw is in bytes per second and maxIops in
+ *           cost units per second, 0 leaves the group unlimited.
+ *
+ * @Returns
+ */
+/* --------------------------------------------------------------------------*/
+int
+QosVolumeManager::CreateQosGroup(const std::string& name, const std::vector<uint32_t>& volumes,
+    const std::vector<uint32_t>& nqnIds, uint64_t maxBw, uint64_t maxIops)
+{
+    std::vector<uint32_t> subsystemVolumes;
+    for (auto nqnId : nqnIds)
+    {
+        for (auto volId : GetVolumeFromActiveSubsystem(nqnId))
+        {
+            subsystemVolumes.push_back(volId);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(qosGroupLock);
+    int32_t groupId = NO_QOS_GROUP;
+    int32_t freeGroupId = NO_QOS_GROUP;
+    for (uint32_t index = 0; index < MAX_QOS_GROUP_COUNT; index++)
+    {
+        if (qosGroup[index].name == name)
+        {
+            groupId = index;
+            break;
+        }
+        if (freeGroupId == NO_QOS_GROUP && qosGroup[index].name.empty())
+        {
+            freeGroupId = index;
+        }
+    }
+    if (groupId == NO_QOS_GROUP)
+    {
+        groupId = freeGroupId;
+    }
+    if (groupId == NO_QOS_GROUP)
+    {
+        POS_TRACE_WARN(EID(QOS_GROUP_CREATION_FAILED),
+            "group:{}, no more than {} groups per array", name, MAX_QOS_GROUP_COUNT);
+        return EID(QOS_GROUP_CREATION_FAILED);
+    }
+    for (auto volId : volumes)
+    {
+        if (volId >= MAX_VOLUME_COUNT || (volumeQosGroup[volId] != NO_QOS_GROUP && volumeQosGroup[volId] != groupId))
+        {
+            POS_TRACE_WARN(EID(QOS_GROUP_CREATION_FAILED),
+                "group:{}, volume {} is invalid or already in another group", name, volId);
+            return EID(QOS_GROUP_CREATION_FAILED);
+        }
+    }
+    for (uint32_t index = 0; index < MAX_QOS_GROUP_COUNT; index++)
+    {
+        if (static_cast<int32_t>(index) == groupId)
+        {
+            continue;
+        }
+        for (auto nqnId : nqnIds)
+        {
+            std::vector<uint32_t>& others = qosGroup[index].nqnIds;
+            if (std::find(others.begin(), others.end(), nqnId) != others.end())
+            {
+                POS_TRACE_WARN(EID(QOS_GROUP_CREATION_FAILED),
+                    "group:{}, subsystem {} is already in group {}", name, nqnId, qosGroup[index].name);
+                return EID(QOS_GROUP_CREATION_FAILED);
+            }
+        }
+    }
+
+    for (uint32_t volId = 0; volId < MAX_VOLUME_COUNT; volId++)
+    {
+        if (volumeQosGroup[volId] == groupId)
+        {
+            volumeQosGroup[volId] = NO_QOS_GROUP;
+        }
+    }
+    QosGroup& group = qosGroup[groupId];
+    group.name = name;
+    group.volumes = volumes;
+    group.nqnIds = nqnIds;
+    group.maxBw = (maxBw == 0) ? DEFAULT_MAX_BW_IOPS : maxBw / PARAMETER_COLLECTION_INTERVAL;
+    group.maxIops = (maxIops == 0) ? DEFAULT_MAX_BW_IOPS : maxIops / PARAMETER_COLLECTION_INTERVAL;
+    group.remainingBw = group.maxBw;
+    group.remainingIops = group.maxIops;
+    for (auto volId : volumes)
+    {
+        volumeQosGroup[volId] = groupId;
+    }
+    for (auto volId : subsystemVolumes)
+    {
+        if (volId < MAX_VOLUME_COUNT && volumeQosGroup[volId] == NO_QOS_GROUP)
+        {
+            volumeQosGroup[volId] = groupId;
+        }
+    }
+    POS_TRACE_INFO(EID(QOS_GROUP_CREATED),
+        "group:{}, volumes:{}, subsystems:{}, maxbw:{}, maxiops:{}",
+        name, volumes.size(), nqnIds.size(), maxBw, maxIops);
+    return EID(SUCCESS);
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Volumes mounted later into a subsystem of a group join the group,
+ *           unless they already belong to a group by name
+ *
+ * @Returns
+ */
+/* --------------------------------------------------------------------------*/
+void
+QosVolumeManager::_AssignQosGroupBySubsystem(uint32_t nqnId, uint32_t volId)
+{
+    if (volId >= MAX_VOLUME_COUNT)
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(qosGroupLock);
+    for (uint32_t index = 0; index < MAX_QOS_GROUP_COUNT; index++)
+    {
+        std::vector<uint32_t>& nqnIds = qosGroup[index].nqnIds;
+        if (std::find(nqnIds.begin(), nqnIds.end(), nqnId) != nqnIds.end())
+        {
+            if (volumeQosGroup[volId] == NO_QOS_GROUP)
+            {
+                volumeQosGroup[volId] = index;
+            }
+            return;
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis
+ *
+ * @Returns
+ */
+/* --------------------------------------------------------------------------*/
+void
+QosVolumeManager::ResetGroupThrottling(void)
+{
+    std::lock_guard<std::mutex> lock(qosGroupLock);
+    for (uint32_t index = 0; index < MAX_QOS_GROUP_COUNT; index++)
+    {
+        QosGroup& group = qosGroup[index];
+        if (group.name.empty())
+        {
+            continue;
+        }
+        group.lastUsedBw = group.usedBw.exchange(0);
+        group.lastUsedIops = group.usedIops.exchange(0);
+        group.remainingBw = _ResetThrottlingCommon(group.remainingBw, group.maxBw);
+        group.remainingIops = _ResetThrottlingCommon(group.remainingIops, group.maxIops);
+    }
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis usage of the last time slice, scaled to a second
+ *
+ * @Returns
+ */
+/* --------------------------------------------------------------------------*/
+void
+QosVolumeManager::GetQosGroupUsage(std::vector<qos_group_usage>& groupUsage)
+{
+    std::lock_guard<std::mutex> lock(qosGroupLock);
+    for (uint32_t index = 0; index < MAX_QOS_GROUP_COUNT; index++)
+    {
+        QosGroup& group = qosGroup[index];
+        if (group.name.empty())
+        {
+            continue;
+        }
+        qos_group_usage usage;
+        usage.name = group.name;
+        usage.subsystems = group.nqnIds;
+        for (uint32_t volId = 0; volId < MAX_VOLUME_COUNT; volId++)
+        {
+            if (volumeQosGroup[volId] == static_cast<int32_t>(index))
+            {
+                usage.volumes.push_back(volId);
+            }
+        }
+        usage.maxBw = (group.maxBw == DEFAULT_MAX_BW_IOPS) ? 0 : group.maxBw * PARAMETER_COLLECTION_INTERVAL;
+        usage.maxIops = (group.maxIops == DEFAULT_MAX_BW_IOPS) ? 0 : group.maxIops * PARAMETER_COLLECTION_INTERVAL;
+        usage.usedBw = group.lastUsedBw * PARAMETER_COLLECTION_INTERVAL;
+        usage.usedIops = group.lastUsedIops * PARAMETER_COLLECTION_INTERVAL;
+        groupUsage.push_back(usage);
+    }
+}
+
 int64_t
 QosVolumeManager::_GetThrottlingChange(int64_t remainingValue, int64_t plusUpdateUnit, uint64_t minusUpdateUnit)
 {
@@ -705,8 +1029,17 @@ QosVolumeManager::ResetVolumeThrottling(int volId, uint32_t arrayId)
     previousRemainingVolumeBw[volId] = remainingDynamicVolumeBw[volId];
     previousRemainingVolumeIops[volId] = remainingDynamicVolumeIops[volId];
 
-    remainingVolumeBw[volId] = _ResetThrottlingCommon(remainingVolumeBw[volId], userSetBwWeight * MAX_THROTTLING_RATE);
-    remainingVolumeIops[volId] = _ResetThrottlingCommon(remainingVolumeIops[volId], userSetIops * MAX_THROTTLING_RATE);
+    int64_t cachedBw = 0;
+    int64_t cachedIops = 0;
+    _SumCachedTokens(volId, cachedBw, cachedIops);
+    int64_t bwBurst = _SpendBurstCredit(volId, remainingVolumeBw[volId] + cachedBw, userSetBwWeight, burstCreditBw[volId]);
+    int64_t iopsBurst = _SpendBurstCredit(volId, remainingVolumeIops[volId] + cachedIops, userSetIops, burstCreditIops[volId]);
+    airlog("Feqos_Burst_Credit_BW", "internal", arrVolId, burstCreditBw[volId]);
+    airlog("Feqos_Burst_Credit_Iops", "internal", arrVolId, burstCreditIops[volId]);
+    _RefillBucket(remainingVolumeBw[volId], userSetBwWeight * MAX_THROTTLING_RATE + bwBurst);
+    _RefillBucket(remainingVolumeIops[volId], userSetIops * MAX_THROTTLING_RATE + iopsBurst);
+    _UpdateTokenBorrowUnit(volId);
+    tokenEpoch[volId].fetch_add(1, std::memory_order_release);
 }
 
 /* --------------------------------------------------------------------------*/
@@ -906,13 +1239,25 @@ QosVolumeManager::SubmitVolumeIoToAio(IbofIoSubmissionAdapter* aioSubmission, ui
     }
     uint64_t blockSize = 0;
     blockSize = volumeIo->GetSize();
+    // iops tokens are spent in cost units, 1 per I/O unless the cost model is enabled
+    int64_t ioCost = ioCostModel->GetCost(volId, volumeIo->dir, volumeIo->GetSectorRba(), blockSize);
     aioSubmission->Do(volumeIo);
-    remainingVolumeBw[volId] -= blockSize;
+    ReactorTokenCache& cache = tokenCache[eventFrameworkApi->GetCurrentReactor()][volId];
+    _ChargeTokenCache(cache.bw, -static_cast<int64_t>(blockSize));
     globalRemainingVolumeBw -= blockSize;
-    remainingVolumeIops[volId] -= 1;
-    globalRemainingVolumeIops -= 1;
+    _ChargeTokenCache(cache.iops, -ioCost);
+    globalRemainingVolumeIops -= ioCost;
     remainingDynamicVolumeBw[volId] -= blockSize;
-    remainingDynamicVolumeIops[volId] -= 1;
+    remainingDynamicVolumeIops[volId] -= ioCost;
+    int32_t groupId = volumeQosGroup[volId];
+    if (groupId != NO_QOS_GROUP)
+    {
+        QosGroup& group = qosGroup[groupId];
+        group.remainingBw -= blockSize;
+        group.remainingIops -= ioCost;
+        group.usedBw += blockSize;
+        group.usedIops += ioCost;
+    }
 
     if (minVolumeBw[volId] == 0)
     {
@@ -921,7 +1266,7 @@ QosVolumeManager::SubmitVolumeIoToAio(IbofIoSubmissionAdapter* aioSubmission, ui
 
     if (minVolumeIops[volId] == 0)
     {
-        remainingNotThrottledVolumesIops -= 1;
+        remainingNotThrottledVolumesIops -= ioCost;
     }
 }
 
@@ -963,6 +1308,10 @@ QosVolumeManager::VolumeQosPoller(IbofIoSubmissionAdapter* aioSubmission, double
             {
                 break;
             }
+            if (_GroupRateLimit(volId) == true)
+            {
+                break;
+            }
             if (_RateLimit(volId) == true)
             {
                 break;
@@ -1017,6 +1366,96 @@ QosVolumeManager::SetVolumeLimit(uint32_t volId, int64_t value, bool iops)
     }
 }
 
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis Unused max limit tokens of the last time slice are saved as burst
+ *           credit, up to (percent - 100)% of the limit for durationSec.
+ *           While the volume runs out of tokens, the credit is granted on top
+ *           of the refill, at most (percent - 100)% of the limit per slice.
+ *
+ * @Returns  tokens to add to the refill of this time slice
+ */
+/* --------------------------------------------------------------------------*/
+int64_t
+QosVolumeManager::_SpendBurstCredit(uint32_t volId, int64_t remainingValue, uint64_t limit, std::atomic<int64_t>& credit)
+{
+    uint32_t percent = burstPercent[volId];
+    if (percent <= PERCENTAGE_VALUE || limit >= static_cast<uint64_t>(DEFAULT_MAX_BW_IOPS))
+    {
+        credit = 0;
+        return 0;
+    }
+    int64_t extraPerSlice = limit / PERCENTAGE_VALUE * (percent - PERCENTAGE_VALUE);
+    int64_t ceiling = extraPerSlice * burstDurationSec[volId] * PARAMETER_COLLECTION_INTERVAL;
+    if (remainingValue > 0)
+    {
+        credit = std::min(credit + remainingValue, ceiling);
+        return 0;
+    }
+    int64_t grant = std::min(credit.load(), extraPerSlice);
+    credit -= grant;
+    return grant;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis
+ *
+ * @Returns
+ */
+/* --------------------------------------------------------------------------*/
+void
+QosVolumeManager::SetVolumeBurst(uint32_t volId, uint32_t percent, uint32_t durationSec)
+{
+    burstPercent[volId] = percent;
+    burstDurationSec[volId] = durationSec;
+    burstCreditBw[volId] = 0;
+    burstCreditIops[volId] = 0;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis
+ *
+ * @Returns
+ */
+/* --------------------------------------------------------------------------*/
+uint32_t
+QosVolumeManager::GetVolumeBurstPercent(uint32_t volId)
+{
+    return burstPercent[volId];
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis
+ *
+ * @Returns
+ */
+/* --------------------------------------------------------------------------*/
+uint32_t
+QosVolumeManager::GetVolumeBurstDuration(uint32_t volId)
+{
+    return burstDurationSec[volId];
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Synopsis
+ *
+ * @Returns
+ */
+/* --------------------------------------------------------------------------*/
+int64_t
+QosVolumeManager::GetVolumeBurstCredit(uint32_t volId, bool iops)
+{
+    if (iops == true)
+    {
+        return burstCreditIops[volId];
+    }
+    return burstCreditBw[volId];
+}
+
 /* --------------------------------------------------------------------------*/
 /**
  * @Synopsis
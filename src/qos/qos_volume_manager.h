@@ -46,6 +46,7 @@
 #include "src/spdk_wrapper/caller/spdk_pos_nvmf_caller.h"
 #include "src/spdk_wrapper/caller/spdk_pos_volume_caller.h"
 #include "src/qos/exit_handler.h"
+#include "src/qos/io_cost_model.h"
 #include "src/qos/qos_array_manager.h"
 #include "src/qos/qos_common.h"
 #include "src/spdk_wrapper/event_framework_api.h"
@@ -82,6 +83,14 @@ public:
     int VolumeQosPoller(IbofIoSubmissionAdapter* aioSubmission, double offset);
     void SetVolumeLimit(uint32_t volId, int64_t weight, bool iops);
     int64_t GetVolumeLimit(uint32_t volId, bool iops);
+    void SetVolumeBurst(uint32_t volId, uint32_t percent, uint32_t durationSec);
+    uint32_t GetVolumeBurstPercent(uint32_t volId);
+    uint32_t GetVolumeBurstDuration(uint32_t volId);
+    int64_t GetVolumeBurstCredit(uint32_t volId, bool iops);
+    int CreateQosGroup(const std::string& name, const std::vector<uint32_t>& volumes,
+        const std::vector<uint32_t>& nqnIds, uint64_t maxBw, uint64_t maxIops);
+    void GetQosGroupUsage(std::vector<qos_group_usage>& groupUsage);
+    void ResetGroupThrottling(void);
     void DeleteVolumeFromSubsystemMap(uint32_t nqnId, uint32_t volId);
     void GetSubsystemVolumeMap(std::unordered_map<int32_t, std::vector<int>>& subsysVolMap);
     void ResetRateLimit(uint32_t reactor, int volId, double offset);
@@ -110,10 +119,19 @@ public:
 
 protected:
     EventFrameworkApi* eventFrameworkApi;
+    bool _RateLimit(int volId);
+    static int64_t _RefillBucket(std::atomic<int64_t>& bucket, int64_t refill);
 
 private:
-    bool _RateLimit(int volId);
+    int64_t _BorrowTokens(std::atomic<int64_t>& bucket, int64_t unit);
+    static void _ChargeTokenCache(std::atomic<int64_t>& cached, int64_t value);
+    void _RefreshTokenCache(uint32_t reactor, uint32_t volId);
+    void _SumCachedTokens(uint32_t volId, int64_t& bw, int64_t& iops);
+    void _UpdateTokenBorrowUnit(uint32_t volId);
+    int64_t _SpendBurstCredit(uint32_t volId, int64_t remainingValue, uint64_t limit, std::atomic<int64_t>& credit);
     bool _GlobalRateLimit(void);
+    bool _GroupRateLimit(uint32_t volId);
+    void _AssignQosGroupBySubsystem(uint32_t nqnId, uint32_t volId);
     bool _SpecialRateLimit(uint32_t volId);
     bool _MinimumRateLimit(int volId);
 
@@ -146,8 +164,48 @@ private:
     std::atomic<bool> volumeMap[MAX_VOLUME_COUNT];
     std::mutex volumePendingIOLock[MAX_VOLUME_COUNT];
 
-    int64_t remainingVolumeBw[MAX_VOLUME_COUNT];
-    int64_t remainingVolumeIops[MAX_VOLUME_COUNT];
+    // per volume global buckets refilled every time slice; reactors borrow
+    // tokens from them in chunks and spend them from their own token cache
+    std::atomic<int64_t> remainingVolumeBw[MAX_VOLUME_COUNT];
+    std::atomic<int64_t> remainingVolumeIops[MAX_VOLUME_COUNT];
+    std::atomic<int64_t> tokenBorrowBw[MAX_VOLUME_COUNT];
+    std::atomic<int64_t> tokenBorrowIops[MAX_VOLUME_COUNT];
+    std::atomic<uint64_t> tokenEpoch[MAX_VOLUME_COUNT];
+    // written by the owning reactor only, and read at the refill
+    struct ReactorTokenCache
+    {
+        std::atomic<int64_t> bw{0};
+        std::atomic<int64_t> iops{0};
+        std::atomic<uint64_t> epoch{0};
+    };
+    ReactorTokenCache tokenCache[M_MAX_REACTORS][MAX_VOLUME_COUNT];
+    static const int64_t TOKEN_BORROW_DIVISOR = 64;
+    // credits are earned from unused max limit tokens while the volume is
+    // below its limit and spent on top of the limit in later time slices
+    std::atomic<uint32_t> burstPercent[MAX_VOLUME_COUNT];
+    std::atomic<uint32_t> burstDurationSec[MAX_VOLUME_COUNT];
+    std::atomic<int64_t> burstCreditBw[MAX_VOLUME_COUNT];
+    std::atomic<int64_t> burstCreditIops[MAX_VOLUME_COUNT];
+    IoCostModel* ioCostModel;
+    // a group shares one max limit among its volumes and the volumes of its
+    // subsystems; the group bucket is checked before the volume bucket
+    struct QosGroup
+    {
+        std::string name;
+        std::vector<uint32_t> volumes;
+        std::vector<uint32_t> nqnIds;
+        int64_t maxBw = 0;
+        int64_t maxIops = 0;
+        std::atomic<int64_t> remainingBw{0};
+        std::atomic<int64_t> remainingIops{0};
+        std::atomic<uint64_t> usedBw{0};
+        std::atomic<uint64_t> usedIops{0};
+        uint64_t lastUsedBw = 0;
+        uint64_t lastUsedIops = 0;
+    };
+    QosGroup qosGroup[MAX_QOS_GROUP_COUNT];
+    std::atomic<int32_t> volumeQosGroup[MAX_VOLUME_COUNT];
+    std::mutex qosGroupLock;
     std::string volumeName[MAX_VOLUME_COUNT];
     std::atomic<uint64_t> minVolumeBw[MAX_VOLUME_COUNT];
     std::atomic<uint64_t> minVolumeIops[MAX_VOLUME_COUNT];
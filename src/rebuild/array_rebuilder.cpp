@@ -33,7 +33,11 @@
 #include "array_rebuilder.h"
 #include "array_rebuild.h"
 #include "rebuild_behavior_factory.h"
+#include "rebuild_scheduler.h"
+#include "src/array/ft/erasure_code.h"
+#include "src/array_mgmt/array_manager.h"
 #include "src/include/pos_event_id.h"
+#include "src/include/raid_type.h"
 #include "src/logger/logger.h"
 
 namespace pos
@@ -62,6 +66,7 @@ ArrayRebuilder::Rebuild(string array, uint32_t arrayId, vector<IArrayDevice*> ds
     RebuildBehaviorFactory factory(AllocatorServiceSingleton::Instance()->GetIContextManager(array));
     ArrayRebuild* job = new ArrayRebuild(array, arrayId, dst, cb, tgt, &factory);
     jobsInProgress.emplace(array, job);
+    RebuildSchedulerSingleton::Instance()->Register(array, _GetFaultsLeft(arrayId, dst.size()));
     mtxStart.unlock();
 
     if (ret == 0)
@@ -95,6 +100,8 @@ ArrayRebuilder::QuickRebuild(string array, uint32_t arrayId, QuickRebuildPair re
     RebuildBehaviorFactory factory(AllocatorServiceSingleton::Instance()->GetIContextManager(array));
     ArrayRebuild* job = new ArrayRebuild(array, arrayId, rebuildPair, cb, tgt, &factory);
     jobsInProgress.emplace(array, job);
+    // The source devices of a quick rebuild are still in service
+    RebuildSchedulerSingleton::Instance()->Register(array, _GetFaultsLeft(arrayId, 0));
     mtxStart.unlock();
 
     if (ret == 0)
@@ -133,6 +140,7 @@ ArrayRebuilder::RebuildDone(RebuildResult result)
     {
         delete job;
         jobsInProgress.erase(array);
+        RebuildSchedulerSingleton::Instance()->Unregister(array);
     }
     POS_TRACE_INFO(EID(REBUILD_JOB_DISPOSE),
         "array_name:{}, remaining_jobs:{}",
@@ -190,18 +198,45 @@ ArrayRebuilder::_PrepareRebuild(string arrayname, list<RebuildTarget*>& tgt)
     }
     if (resume)
     {
-        for (auto it : tgt)
-        {
-            if (it->IsResumable() == false)
-            {
-                tgt.remove(it);
-                break;
-            }
-        }
+        // Resume only the partitions which keep their rebuild progress,
+        // the others are not rebuilt again
+        tgt.remove_if([](RebuildTarget* it) { return it->IsResumable() == false; });
     }
     return ret;
 }
 
+// The number of further device faults the user data of the array can survive
+// while the given devices are rebuilt
+uint32_t
+ArrayRebuilder::_GetFaultsLeft(uint32_t arrayId, uint32_t rebuildingDevCnt)
+{
+    ComponentsInfo* info = ArrayMgr()->GetInfo(arrayId);
+    if (info == nullptr || info->arrayInfo == nullptr)
+    {
+        return 0;
+    }
+
+    uint32_t parityCnt = 0;
+    RaidType raidType(info->arrayInfo->GetDataRaidType());
+    switch (raidType)
+    {
+        case RaidTypeEnum::RAID5:
+        case RaidTypeEnum::RAID10:
+            parityCnt = 1;
+            break;
+        case RaidTypeEnum::RAID6:
+            parityCnt = 2;
+            break;
+        case RaidTypeEnum::EC3:
+        case RaidTypeEnum::EC4:
+            parityCnt = ErasureCode::GetParityCount(raidType);
+            break;
+        default:
+            break;
+    }
+    return (parityCnt > rebuildingDevCnt) ? (parityCnt - rebuildingDevCnt) : 0;
+}
+
 ArrayRebuild*
 ArrayRebuilder::_Find(string array)
 {
@@ -66,6 +66,7 @@ public:
 private:
     int _PrepareRebuild(string arrayname, list<RebuildTarget*>& tgt);
     ArrayRebuild* _Find(string arrayname);
+    uint32_t _GetFaultsLeft(uint32_t arrayId, uint32_t rebuildingDevCnt);
     map<string, ArrayRebuild*> jobsInProgress;
     IRebuildNotification* iRebuildNoti = nullptr;
     std::mutex mtxStart;
@@ -49,7 +49,8 @@ NToMRebuild::NToMRebuild(vector<IArrayDevice*> src, vector<IArrayDevice*> dst, R
 : RebuildMethod(src.size(), dst.size()),
   src(src),
   dst(dst),
-  recoverFunc(recoverFunc)
+  recoverFunc(recoverFunc),
+  readFailCnt(0)
 {
     string srcList = "";
     for (IArrayDevice* dev : src)
@@ -177,16 +178,20 @@ NToMRebuild::_ReadDone(int arrayIndex, StripeId stripeId, const PartitionPhysica
         srcBuffer->ReturnBuffer(src);
         if (backupMethod != nullptr)
         {
-            if (IsFailOver() == false)
+            bool ret = backupMethod->Init(owner + "_backup");
+            if (ret == false)
             {
-                bool ret = backupMethod->Init(owner + "_backup");
-                if (ret == false)
-                {
-                    POS_TRACE_ERROR(EID(REBUILD_FAILOVER), "Initialization error occurs while switching to backup method");
-                    callback(result);
-                }
+                POS_TRACE_ERROR(EID(REBUILD_FAILOVER), "Initialization error occurs while switching to backup method");
+                callback(result);
+                return;
             }
-            SetFailOver();
+            uint32_t failCnt = readFailCnt.fetch_add(1) + 1;
+            if (failCnt >= FAILOVER_READ_FAIL_THRESHOLD)
+            {
+                SetFailOver();
+            }
+            // Recover only this stripe from the others, and keep copying the rest
+            // while the source device is still readable
             backupMethod->Recover(arrayIndex, stripeId, pSize, callback);
         }
         else
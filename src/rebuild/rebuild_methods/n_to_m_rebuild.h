@@ -36,6 +36,7 @@
 #include "src/include/recover_func.h"
 #include "src/include/i_array_device.h"
 
+#include <atomic>
 #include <vector>
 
 using namespace std;
@@ -65,6 +66,10 @@ private:
     uint64_t airKey = 0;
     NToMRebuild* backupMethod = nullptr;
     bool isFailOver = false;
+    // Read failures are recovered by the backup method stripe by stripe,
+    // and only this many of them make it replace this method for good
+    static const uint32_t FAILOVER_READ_FAIL_THRESHOLD = 32;
+    atomic<uint32_t> readFailCnt;
     bool enableDebugLog = false;
 };
 } // namespace pos
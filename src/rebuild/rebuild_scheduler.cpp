@@ -0,0 +1,93 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "rebuild_scheduler.h"
+
+#include <algorithm>
+
+#include "src/include/pos_event_id.h"
+#include "src/logger/logger.h"
+
+namespace pos
+{
+void
+RebuildScheduler::Register(string arrayName, uint32_t faultsLeft)
+{
+    unique_lock<mutex> lock(mtx);
+    auto it = weights.find(arrayName);
+    if (it != weights.end())
+    {
+        totalWeight -= it->second;
+    }
+    uint32_t weight = _GetWeight(faultsLeft);
+    weights[arrayName] = weight;
+    totalWeight += weight;
+    POS_TRACE_INFO(EID(REBUILD_JOB_SCHEDULED),
+        "array_name:{}, faults_left:{}, weight:{}, total_weight:{}",
+        arrayName, faultsLeft, weight, totalWeight);
+}
+
+// The share of a finished rebuild goes back to the others from their next segment
+void
+RebuildScheduler::Unregister(string arrayName)
+{
+    unique_lock<mutex> lock(mtx);
+    auto it = weights.find(arrayName);
+    if (it != weights.end())
+    {
+        totalWeight -= it->second;
+        weights.erase(it);
+    }
+}
+
+uint32_t
+RebuildScheduler::GetQueueDepth(string arrayName, uint32_t nodeQueueDepth)
+{
+    unique_lock<mutex> lock(mtx);
+    auto it = weights.find(arrayName);
+    if (it == weights.end() || totalWeight == 0)
+    {
+        return nodeQueueDepth;
+    }
+    uint64_t share = static_cast<uint64_t>(nodeQueueDepth) * it->second / totalWeight;
+    return std::max(static_cast<uint32_t>(share), 1u);
+}
+
+// Each fault less that an array can survive doubles its weight, e.g. RAID6 with
+// two failed devices weighs twice as much as one with a single failed device
+uint32_t
+RebuildScheduler::_GetWeight(uint32_t faultsLeft)
+{
+    return 1u << (MAX_FAULTS_TO_PRIORITIZE - std::min(faultsLeft, MAX_FAULTS_TO_PRIORITIZE));
+}
+} // namespace pos
@@ -0,0 +1,68 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+
+#include "src/lib/singleton.h"
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+using namespace std;
+
+namespace pos
+{
+// Shares the rebuild queue depth of the node among the arrays rebuilding at
+// once, so that concurrent rebuilds do not add up their backend load. An array
+// that can survive fewer further faults gets a larger share
+class RebuildScheduler
+{
+public:
+    RebuildScheduler(void) = default;
+    virtual ~RebuildScheduler(void) = default;
+    virtual void Register(string arrayName, uint32_t faultsLeft);
+    virtual void Unregister(string arrayName);
+    virtual uint32_t GetQueueDepth(string arrayName, uint32_t nodeQueueDepth);
+
+private:
+    uint32_t _GetWeight(uint32_t faultsLeft);
+    static const uint32_t MAX_FAULTS_TO_PRIORITIZE = 2;
+    map<string, uint32_t> weights;
+    uint32_t totalWeight = 0;
+    mutex mtx;
+};
+
+using RebuildSchedulerSingleton = Singleton<RebuildScheduler>;
+} // namespace pos
@@ -37,16 +37,31 @@
 #include "src/logger/logger.h"
 #include "src/include/branch_prediction.h"
 #include "src/include/backend_event.h"
-#include "src/event_scheduler/event_scheduler.h"
 #include "src/include/address_type.h"
+#include "src/include/array_config.h"
+
+#include <algorithm>
 
 namespace pos
 {
-SegmentBasedRebuild::SegmentBasedRebuild(unique_ptr<RebuildContext> c, IContextManager* allocatorSvc)
+SegmentBasedRebuild::SegmentBasedRebuild(unique_ptr<RebuildContext> c, IContextManager* allocatorSvc,
+    ConfigManager* configManager, QosManager* qosManager,
+    RebuildScheduler* rebuildScheduler, EventScheduler* eventScheduler)
 : RebuildBehavior(move(c)),
-  allocatorSvc(allocatorSvc)
+  allocatorSvc(allocatorSvc),
+  qosManager(qosManager),
+  rebuildScheduler(rebuildScheduler),
+  eventScheduler(eventScheduler),
+  nextTaskIdx(0)
 {
-    POS_TRACE_DEBUG(EID(STRIPES_REBUILD_INIT), "SegmentBasedRebuild");
+    uint32_t queueDepth = 0;
+    int ret = configManager->GetValue("rebuild", "stripe_queue_depth",
+        &queueDepth, ConfigType::CONFIG_TYPE_UINT32);
+    if (ret == EID(SUCCESS) && queueDepth > 0)
+    {
+        maxQueueDepth = queueDepth;
+    }
+    POS_TRACE_DEBUG(EID(STRIPES_REBUILD_INIT), "SegmentBasedRebuild, queueDepth:{}", maxQueueDepth);
 }
 
 SegmentBasedRebuild::~SegmentBasedRebuild(void)
@@ -132,30 +147,37 @@ SegmentBasedRebuild::_Recover(void)
         return true;
     }
 
-    uint32_t strCnt = ctx->size->stripesPerSegment;
+    // Only the stripes handed out of the segment so far can hold data
+    uint32_t strCnt = allocatorSvc->GetRebuildTargetStripeCount(segId);
+    baseStripe = segId * ctx->size->stripesPerSegment;
+    if (strCnt == 0)
+    {
+        POS_TRACE_INFO(EID(STRIPES_REBUILD_DONE),
+            "segID:{}, no stripe is allocated, skip", segId);
+        allocatorSvc->ReleaseRebuildSegment(segId);
+        EventSmartPtr nextEvent(new Rebuilder(this));
+        nextEvent->SetEventType(BackendEvent_UserdataRebuild);
+        eventScheduler->EnqueueEvent(nextEvent);
+        return true;
+    }
     uint32_t callbackCnt = ctx->rm.size();
-    ctx->taskCnt = strCnt * callbackCnt;
-    StripeId baseStripe = segId * strCnt;
+    totalTaskCnt = strCnt * callbackCnt;
+    nextTaskIdx = 0;
+    // One more for the issuer, so that the segment is not completed while
+    // the first tasks are still being issued
+    ctx->taskCnt = totalTaskCnt + 1;
+
+    // Every task holds a buffer of its rebuild method until it is written
+    uint32_t queueDepth = _GetQueueDepth();
+    uint32_t initialTaskCnt = std::min(queueDepth * callbackCnt, totalTaskCnt);
+    initialTaskCnt = std::min(initialTaskCnt, static_cast<uint32_t>(ArrayConfig::REBUILD_STRIPES_UNIT));
     POS_TRACE_INFO(EID(STRIPES_REBUILD_BEGIN),
-        "segID:{}, from:{}, taskCnt:{}", segId, baseStripe, ctx->taskCnt);
-    for (uint32_t offset = 0; offset < strCnt; offset++)
+        "segID:{}, from:{}, taskCnt:{}, queueDepth:{}", segId, baseStripe, totalTaskCnt, queueDepth);
+    for (uint32_t count = 0; count < initialTaskCnt; count++)
     {
-        StripeId stripeId = baseStripe + offset;
-        for (RebuildMethod* rm : ctx->rm)
-        {
-            StripeRebuildDoneCallback callback = bind(&SegmentBasedRebuild::_RecoverCompleted, this, segId, stripeId, placeholders::_1);
-            int ret = rm->Recover(ctx->arrayIndex, stripeId, ctx->size, callback);
-            if (ret != 0)
-            {
-                POS_TRACE_ERROR(ret,
-                    "stripeId:{}, part:{}",
-                    stripeId, PARTITION_TYPE_STR[ctx->part]);
-                ctx->SetResult(RebuildState::FAIL);
-                _Finish(RebuildState::FAIL);
-                return true;
-            }
-        }
+        _IssueNextTask(segId);
     }
+    _CompleteTask(segId);
     return true;
 }
 
@@ -167,6 +189,48 @@ void SegmentBasedRebuild::_RecoverCompleted(SegmentId segmentId, StripeId stripe
             "segID:{}, stripeID:{}, result:{}", segmentId, stripeId, result);
         ctx->SetResult(RebuildState::FAIL);
     }
+    // Refill the queue before this task is counted, as the segment
+    // must not complete (and the next one begin) in between
+    _IssueNextTask(segmentId);
+    _CompleteTask(segmentId);
+}
+
+void
+SegmentBasedRebuild::_IssueNextTask(SegmentId segmentId)
+{
+    uint32_t callbackCnt = ctx->rm.size();
+    while (true)
+    {
+        uint32_t taskIdx = nextTaskIdx.fetch_add(1);
+        if (taskIdx >= totalTaskCnt)
+        {
+            return;
+        }
+
+        StripeId stripeId = baseStripe + taskIdx / callbackCnt;
+        if (ctx->GetResult() < RebuildState::CANCELLED)
+        {
+            RebuildMethod* rm = ctx->rm[taskIdx % callbackCnt];
+            StripeRebuildDoneCallback callback = bind(&SegmentBasedRebuild::_RecoverCompleted, this, segmentId, stripeId, placeholders::_1);
+            int ret = rm->Recover(ctx->arrayIndex, stripeId, ctx->size, callback);
+            if (ret == 0)
+            {
+                return;
+            }
+            POS_TRACE_ERROR(ret,
+                "stripeId:{}, part:{}",
+                stripeId, PARTITION_TYPE_STR[ctx->part]);
+            ctx->SetResult(RebuildState::FAIL);
+        }
+        // Not issued, after a failure or a stop. The caller still holds its own
+        // task, so this never completes the segment
+        _CompleteTask(segmentId);
+    }
+}
+
+void
+SegmentBasedRebuild::_CompleteTask(SegmentId segmentId)
+{
     uint32_t currentTaskCnt = ctx->taskCnt -= 1;
     if (currentTaskCnt == 0)
     {
@@ -175,8 +239,27 @@ void SegmentBasedRebuild::_RecoverCompleted(SegmentId segmentId, StripeId stripe
         allocatorSvc->ReleaseRebuildSegment(segmentId);
         EventSmartPtr nextEvent(new Rebuilder(this));
         nextEvent->SetEventType(BackendEvent_UserdataRebuild);
-        EventSchedulerSingleton::Instance()->EnqueueEvent(nextEvent);
+        eventScheduler->EnqueueEvent(nextEvent);
+    }
+}
+
+uint32_t
+SegmentBasedRebuild::_GetQueueDepth(void)
+{
+    // Follows the rebuild perf impact, which can be changed while rebuilding
+    qos_backend_policy policy = qosManager->GetBackendPolicy(BackendEvent_UserdataRebuild);
+    uint32_t queueDepth = maxQueueDepth;
+    if (policy.priorityImpact == PRIORITY_MEDIUM)
+    {
+        queueDepth = maxQueueDepth / 2;
+    }
+    else if (policy.priorityImpact == PRIORITY_LOW)
+    {
+        queueDepth = maxQueueDepth / 4;
     }
+    // The queue depth is for the node, and is shared with the other rebuilding arrays
+    queueDepth = rebuildScheduler->GetQueueDepth(ctx->array, queueDepth);
+    return std::max(queueDepth, 1u);
 }
 
 void
@@ -205,7 +288,7 @@ SegmentBasedRebuild::_Finish(RebuildState state)
 
     EventSmartPtr complete(new RebuildCompleted(this));
     complete->SetEventType(BackendEvent_UserdataRebuild);
-    EventSchedulerSingleton::Instance()->EnqueueEvent(complete);
+    eventScheduler->EnqueueEvent(complete);
 }
 
 SegmentId
@@ -32,18 +32,27 @@
 
 #pragma once
 
+#include <atomic>
 #include <string>
 #include <memory>
 
 #include "rebuild_behavior.h"
+#include "rebuild_scheduler.h"
 #include "src/allocator/i_context_manager.h"
+#include "src/event_scheduler/event_scheduler.h"
+#include "src/master_context/config_manager.h"
+#include "src/qos/qos_manager.h"
 
 namespace pos
 {
 class SegmentBasedRebuild : public RebuildBehavior
 {
 public:
-    SegmentBasedRebuild(unique_ptr<RebuildContext> c, IContextManager* allocatorSvc);
+    SegmentBasedRebuild(unique_ptr<RebuildContext> c, IContextManager* allocatorSvc,
+        ConfigManager* configManager = ConfigManagerSingleton::Instance(),
+        QosManager* qosManager = QosManagerSingleton::Instance(),
+        RebuildScheduler* rebuildScheduler = RebuildSchedulerSingleton::Instance(),
+        EventScheduler* eventScheduler = EventSchedulerSingleton::Instance());
     ~SegmentBasedRebuild(void);
 
     virtual bool Rebuild(void) override;
@@ -53,10 +62,24 @@ private:
     virtual bool _Init(void);
     virtual bool _Recover(void);
     void _RecoverCompleted(SegmentId segmentId, StripeId stripeId, int result);
+    void _IssueNextTask(SegmentId segmentId);
+    void _CompleteTask(SegmentId segmentId);
+    uint32_t _GetQueueDepth(void);
     void _Finish(RebuildState state);
     SegmentId _GetNextSegment(void);
     IContextManager* allocatorSvc = nullptr;
+    QosManager* qosManager = nullptr;
+    RebuildScheduler* rebuildScheduler = nullptr;
+    EventScheduler* eventScheduler = nullptr;
     static const int INIT_REBUILD_MAX_RETRY = 1000;
     int initRetryCnt = 0;
+
+    // A task is a stripe to recover with one of the rebuild methods.
+    // Only up to the queue depth of them are in flight for a segment
+    static const uint32_t DEFAULT_STRIPE_QUEUE_DEPTH = 256;
+    uint32_t maxQueueDepth = DEFAULT_STRIPE_QUEUE_DEPTH;
+    StripeId baseStripe = 0;
+    uint32_t totalTaskCnt = 0;
+    atomic<uint32_t> nextTaskIdx;
 };
 } // namespace pos
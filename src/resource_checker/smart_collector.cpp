@@ -44,6 +44,7 @@
 #include "src/device/unvme/unvme_ssd.h"
 #include "src/include/smart_ptr_type.h"
 #include "src/logger/logger.h"
+#include "src/resource_checker/smart_sampler.h"
 
 using namespace std;
 
@@ -82,6 +83,13 @@ SmartCollector::~SmartCollector(void)
 void
 SmartCollector::PublishSmartDataToTelemetryAllCtrl(void)
 {
+    SmartSampler* sampler = SmartSamplerSingleton::Instance();
+    if (sampler->IsEnabled())
+    {
+        _PublishSampledSmartData(sampler);
+        return;
+    }
+
     DeviceManager* deviceMgr = DeviceManagerSingleton::Instance();
     vector<DeviceProperty> list = deviceMgr->ListDevs();
 
@@ -123,6 +131,25 @@ SmartCollector::PublishSmartDataToTelemetryAllCtrl(void)
     }
 }
 
+void
+SmartCollector::_PublishSampledSmartData(SmartSampler* sampler)
+{
+    // The pages are read by the sampler, no admin command is issued here
+    for (auto& deviceName : sampler->GetSampledDevices())
+    {
+        struct spdk_nvme_health_information_page payload = {};
+        if (sampler->GetHealthPage(deviceName, payload))
+        {
+            PublishSmartTelemetry(&payload, deviceName);
+        }
+        struct spdk_nvme_log_samsung_extended_information_entry extPayload = {};
+        if (sampler->GetExtendedPage(deviceName, extPayload))
+        {
+            PublishExtSmartTelemetry(&extPayload, deviceName);
+        }
+    }
+}
+
 int
 SmartCollector::CollectGetLogPage(void* payload, spdk_nvme_ctrlr* ctrlr, std::string deviceName, SmartReqId reqId)
 {
@@ -44,6 +44,7 @@ struct spdk_nvme_log_samsung_extended_information_entry;
 
 namespace pos
 {
+class SmartSampler;
 class TelemetryPublisher;
 class TelemetryClient;
 
@@ -72,6 +73,7 @@ public:
     SmartReturnType CollectPerCtrl(void* payload, spdk_nvme_ctrlr* ctrlr, SmartReqId reqId);
 
 private:
+    void _PublishSampledSmartData(SmartSampler* sampler);
     int CollectGetLogPage(void* payload, spdk_nvme_ctrlr* ctrlr, std::string deviceName, SmartReqId reqId);
 
     void PublishSmartTelemetry(spdk_nvme_health_information_page* payload, std::string deviceName);
@@ -0,0 +1,357 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "src/resource_checker/smart_sampler.h"
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstring>
+
+#include "spdk/nvme.h"
+#include "src/cpu_affinity/affinity_manager.h"
+#include "src/device/device_manager.h"
+#include "src/device/unvme/unvme_ssd.h"
+#include "src/include/pos_event_id.h"
+#include "src/logger/logger.h"
+#include "src/master_context/config_manager.h"
+
+namespace pos
+{
+struct SmartSampler::Snapshot
+{
+    spdk_nvme_health_information_page health;
+    bool hasExtended;
+    spdk_nvme_log_samsung_extended_information_entry extended;
+};
+
+// Outlives the command if it times out, as the completion may still come
+struct LogPageRequest
+{
+    explicit LogPageRequest(uint32_t size)
+    : done(false),
+      success(false),
+      payload(new uint8_t[size]())
+    {
+    }
+    ~LogPageRequest(void)
+    {
+        delete[] payload;
+    }
+
+    std::atomic<bool> done;
+    bool success;
+    uint8_t* payload;
+};
+
+static void
+CompleteLogPage(void* arg, const spdk_nvme_cpl* cpl)
+{
+    LogPageRequest* request = static_cast<LogPageRequest*>(arg);
+    request->success = (false == spdk_nvme_cpl_is_error(cpl));
+    request->done = true;
+}
+
+SmartSampler::SmartSampler(void)
+: SmartSampler(ConfigManagerSingleton::Instance())
+{
+}
+
+SmartSampler::SmartSampler(ConfigManager* configManager, DeviceLister deviceLister,
+    LogPageReader logPageReader)
+: enabled(false),
+  sampleIntervalInMs(DEFAULT_SAMPLE_INTERVAL_IN_SEC * 1000),
+  deviceLister(deviceLister),
+  logPageReader(logPageReader),
+  cursor(0),
+  snapshots(std::make_shared<SnapshotMap>()),
+  sampler(nullptr),
+  running(false)
+{
+    if (nullptr == this->deviceLister)
+    {
+        this->deviceLister = _ListDevices;
+    }
+    if (nullptr == this->logPageReader)
+    {
+        this->logPageReader = _ReadLogPage;
+    }
+
+    bool enable = false;
+    int ret = configManager->GetValue("admin", "smart_sampler_enable", &enable, CONFIG_TYPE_BOOL);
+    if (ret != EID(SUCCESS) || false == enable)
+    {
+        return;
+    }
+
+    uint32_t intervalInSec = 0;
+    ret = configManager->GetValue("admin", "smart_sample_interval_in_sec", &intervalInSec, CONFIG_TYPE_UINT32);
+    if (ret == EID(SUCCESS) && 0 != intervalInSec)
+    {
+        sampleIntervalInMs = intervalInSec * 1000;
+    }
+    enabled = true;
+    POS_TRACE_INFO(EID(SMART_SAMPLER_ENABLED), "smart_sample_interval_in_sec: {}",
+        sampleIntervalInMs / 1000);
+}
+
+SmartSampler::~SmartSampler(void)
+{
+    Stop();
+}
+
+bool
+SmartSampler::IsEnabled(void)
+{
+    return enabled;
+}
+
+void
+SmartSampler::Start(void)
+{
+    if (false == enabled || nullptr != sampler)
+    {
+        return;
+    }
+    running = true;
+    sampler = new std::thread(&SmartSampler::_Run, this);
+}
+
+void
+SmartSampler::Stop(void)
+{
+    if (nullptr == sampler)
+    {
+        return;
+    }
+    {
+        std::unique_lock<std::mutex> lock(waitLock);
+        running = false;
+    }
+    waitCv.notify_all();
+    sampler->join();
+    delete sampler;
+    sampler = nullptr;
+}
+
+uint32_t
+SmartSampler::SampleNext(void)
+{
+    if (cursor >= devices.size())
+    {
+        // A new round picks up added devices and forgets the detached ones
+        devices = deviceLister();
+        cursor = 0;
+        std::shared_ptr<const SnapshotMap> current = std::atomic_load(&snapshots);
+        std::shared_ptr<SnapshotMap> next = std::make_shared<SnapshotMap>();
+        for (auto& deviceName : devices)
+        {
+            auto it = current->find(deviceName);
+            if (it != current->end())
+            {
+                next->emplace(deviceName, it->second);
+            }
+        }
+        std::atomic_store(&snapshots, std::shared_ptr<const SnapshotMap>(next));
+        if (devices.empty())
+        {
+            return sampleIntervalInMs;
+        }
+    }
+
+    const std::string& deviceName = devices[cursor++];
+    std::shared_ptr<Snapshot> snapshot = std::make_shared<Snapshot>();
+    if (logPageReader(deviceName, SPDK_NVME_LOG_HEALTH_INFORMATION, &snapshot->health,
+            sizeof(snapshot->health)))
+    {
+        snapshot->hasExtended = logPageReader(deviceName, SPDK_NVME_LOG_EXTENDED_SMART,
+            &snapshot->extended, sizeof(snapshot->extended));
+        _Publish(deviceName, snapshot);
+    }
+    else
+    {
+        POS_TRACE_WARN(EID(SMART_SAMPLER_READ_FAILED), "device_name: {}", deviceName);
+    }
+
+    // The devices of a round are spread evenly over the interval
+    return sampleIntervalInMs / devices.size();
+}
+
+bool
+SmartSampler::GetHealthPage(const std::string& deviceName, spdk_nvme_health_information_page& page)
+{
+    std::shared_ptr<const Snapshot> snapshot = _Find(deviceName);
+    if (nullptr == snapshot)
+    {
+        return false;
+    }
+    page = snapshot->health;
+    return true;
+}
+
+bool
+SmartSampler::GetExtendedPage(const std::string& deviceName,
+    spdk_nvme_log_samsung_extended_information_entry& page)
+{
+    std::shared_ptr<const Snapshot> snapshot = _Find(deviceName);
+    if (nullptr == snapshot || false == snapshot->hasExtended)
+    {
+        return false;
+    }
+    page = snapshot->extended;
+    return true;
+}
+
+std::vector<std::string>
+SmartSampler::GetSampledDevices(void)
+{
+    std::vector<std::string> sampled;
+    std::shared_ptr<const SnapshotMap> current = std::atomic_load(&snapshots);
+    for (auto& entry : *current)
+    {
+        sampled.push_back(entry.first);
+    }
+    return sampled;
+}
+
+void
+SmartSampler::_Run(void)
+{
+    cpu_set_t cpuSet = AffinityManagerSingleton::Instance()->GetCpuSet(CoreType::GENERAL_USAGE);
+    sched_setaffinity(0, sizeof(cpuSet), &cpuSet);
+    pthread_setname_np(pthread_self(), "SmartSampler");
+
+    while (running)
+    {
+        uint32_t waitInMs = SampleNext();
+        std::unique_lock<std::mutex> lock(waitLock);
+        waitCv.wait_for(lock, std::chrono::milliseconds(waitInMs), [this] { return false == running; });
+    }
+}
+
+void
+SmartSampler::_Publish(const std::string& deviceName, std::shared_ptr<const Snapshot> snapshot)
+{
+    // Only the sampler thread publishes, readers keep the map they loaded
+    std::shared_ptr<const SnapshotMap> current = std::atomic_load(&snapshots);
+    std::shared_ptr<SnapshotMap> next = std::make_shared<SnapshotMap>(*current);
+    (*next)[deviceName] = snapshot;
+    std::atomic_store(&snapshots, std::shared_ptr<const SnapshotMap>(next));
+}
+
+std::shared_ptr<const SmartSampler::Snapshot>
+SmartSampler::_Find(const std::string& deviceName)
+{
+    std::shared_ptr<const SnapshotMap> current = std::atomic_load(&snapshots);
+    auto it = current->find(deviceName);
+    if (it == current->end())
+    {
+        return nullptr;
+    }
+    return it->second;
+}
+
+std::vector<std::string>
+SmartSampler::_ListDevices(void)
+{
+    std::vector<std::string> ssds;
+    DeviceManager* deviceMgr = DeviceManagerSingleton::Instance();
+    for (auto& device : deviceMgr->ListDevs())
+    {
+        // ListDevs() includes NVRAM, which has no NVMe controller
+        if (nullptr != deviceMgr->GetNvmeCtrlr(device.name))
+        {
+            ssds.push_back(device.name);
+        }
+    }
+    return ssds;
+}
+
+bool
+SmartSampler::_ReadLogPage(const std::string& deviceName, uint8_t lid, void* payload, uint32_t size)
+{
+    DeviceManager* deviceMgr = DeviceManagerSingleton::Instance();
+    std::string name(deviceName);
+    if (SPDK_NVME_LOG_EXTENDED_SMART == lid)
+    {
+        DevName dev(name);
+        UnvmeSsdSharedPtr ssd = std::dynamic_pointer_cast<UnvmeSsd>(deviceMgr->GetDev(dev));
+        if (nullptr == ssd || false == ssd->IsSupportedExtSmart())
+        {
+            return false;
+        }
+    }
+
+    struct spdk_nvme_ctrlr* ctrlr = deviceMgr->GetNvmeCtrlr(name);
+    if (nullptr == ctrlr)
+    {
+        return false;
+    }
+
+    LogPageRequest* request = new LogPageRequest(size);
+    if (0 != spdk_nvme_ctrlr_cmd_get_log_page(ctrlr, lid, SPDK_NVME_GLOBAL_NS_TAG,
+            request->payload, size, 0, CompleteLogPage, request))
+    {
+        delete request;
+        return false;
+    }
+
+    uint32_t waitedInUs = 0;
+    while (false == request->done && waitedInUs < ADMIN_TIMEOUT_IN_MS * 1000)
+    {
+        if (spdk_nvme_ctrlr_process_admin_completions(ctrlr) < 0)
+        {
+            break;
+        }
+        if (false == request->done)
+        {
+            usleep(10);
+            waitedInUs += 10;
+        }
+    }
+
+    if (false == request->done)
+    {
+        // The request is left to the completion that may still come
+        return false;
+    }
+    bool success = request->success;
+    if (success)
+    {
+        memcpy(payload, request->payload, size);
+    }
+    delete request;
+    return success;
+}
+
+} // namespace pos
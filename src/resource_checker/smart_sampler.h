@@ -0,0 +1,112 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "src/lib/singleton.h"
+
+struct spdk_nvme_health_information_page;
+struct spdk_nvme_log_samsung_extended_information_entry;
+
+namespace pos
+{
+class ConfigManager;
+
+// Reads the SMART log pages of the SSDs in the background, one device at a
+// time and spread over the sampling interval, through the admin queue of each
+// controller. The latest pages are kept in an immutable snapshot that is
+// swapped as a whole, so CLI, telemetry and the host get log page are served
+// from memory and never issue an admin command next to the host I/O.
+class SmartSampler
+{
+public:
+    using DeviceLister = std::function<std::vector<std::string>(void)>;
+    using LogPageReader = std::function<bool(const std::string& deviceName, uint8_t lid,
+        void* payload, uint32_t size)>;
+
+    SmartSampler(void);
+    SmartSampler(ConfigManager* configManager, DeviceLister deviceLister = nullptr,
+        LogPageReader logPageReader = nullptr);
+    virtual ~SmartSampler(void);
+
+    virtual bool IsEnabled(void);
+    void Start(void);
+    void Stop(void);
+    // Samples the next device of the round and returns the time until the next one
+    uint32_t SampleNext(void);
+
+    virtual bool GetHealthPage(const std::string& deviceName, spdk_nvme_health_information_page& page);
+    virtual bool GetExtendedPage(const std::string& deviceName,
+        spdk_nvme_log_samsung_extended_information_entry& page);
+    std::vector<std::string> GetSampledDevices(void);
+
+    static const uint32_t DEFAULT_SAMPLE_INTERVAL_IN_SEC = 60;
+    static const uint32_t ADMIN_TIMEOUT_IN_MS = 1000;
+
+private:
+    struct Snapshot;
+    using SnapshotMap = std::map<std::string, std::shared_ptr<const Snapshot>>;
+
+    void _Run(void);
+    void _Publish(const std::string& deviceName, std::shared_ptr<const Snapshot> snapshot);
+    std::shared_ptr<const Snapshot> _Find(const std::string& deviceName);
+    static std::vector<std::string> _ListDevices(void);
+    static bool _ReadLogPage(const std::string& deviceName, uint8_t lid, void* payload, uint32_t size);
+
+    bool enabled;
+    uint32_t sampleIntervalInMs;
+    DeviceLister deviceLister;
+    LogPageReader logPageReader;
+    std::vector<std::string> devices;
+    size_t cursor;
+    std::shared_ptr<const SnapshotMap> snapshots;
+    std::thread* sampler;
+    std::atomic<bool> running;
+    std::mutex waitLock;
+    std::condition_variable waitCv;
+};
+
+using SmartSamplerSingleton = Singleton<SmartSampler>;
+
+} // namespace pos
@@ -42,6 +42,21 @@ struct BufferInfo
     std::string owner = "";
     uint64_t size = 0;
     uint64_t count = 0;
+    // A lazy pool maps its hugepages chunk by chunk on demand instead of
+    // all at once. Meant for large pools that are rarely used.
+    bool lazy = false;
+};
+
+struct BufferPoolStat
+{
+    std::string owner = "";
+    uint64_t totalCount = 0;
+    uint64_t freeCount = 0;
+    uint64_t cachedCount = 0;
+    uint64_t getCount = 0;
+    uint64_t refillMissCount = 0;
+    uint64_t populatedCount = 0;
+    uint64_t initTimeUs = 0;
 };
 
 } // namespace pos
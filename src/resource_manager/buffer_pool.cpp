@@ -36,6 +36,10 @@
 #include "src/include/pos_event_id.hpp"
 #include "src/logger/logger.h"
 #include <cassert>
+#include <chrono>
+#include <cstring>
+#include <sched.h>
+#include <thread>
 
 using namespace pos;
 using namespace std;
@@ -45,7 +49,9 @@ BufferPool::BufferPool(const BufferInfo info,
     HugepageAllocator* hugepageAllocator)
 : BUFFER_INFO(info),
   SOCKET(socket),
-  hugepageAllocator(hugepageAllocator)
+  hugepageAllocator(hugepageAllocator),
+  getCount(0),
+  refillMissCount(0)
 {
     if (hugepageAllocator == nullptr)
     {
@@ -53,6 +59,7 @@ BufferPool::BufferPool(const BufferInfo info,
             "Faild to get hugepageAllocator");
         return;
     }
+    auto start = chrono::steady_clock::now();
     if (_Init() == false)
     {
         _Clear();
@@ -61,6 +68,8 @@ BufferPool::BufferPool(const BufferInfo info,
     {
         isAllocated = true;
     }
+    initTimeUs = chrono::duration_cast<chrono::microseconds>(
+        chrono::steady_clock::now() - start).count();
 }
 
 BufferPool::~BufferPool(void)
@@ -77,16 +86,25 @@ BufferPool::TryGetBuffer(void)
             "Failed to get buffer before init, owner:{}", BUFFER_INFO.owner);
         return nullptr;
     }
-    unique_lock<mutex> lock(consumerLock);
-    _TrySwapWhenConsumerPoolEmpty();
-    if (consumerPool->empty())
+    Magazine* magazine = _LockMagazine();
+    if (magazine != nullptr)
     {
-        return nullptr;
+        void* buffer = nullptr;
+        getCount++;
+        if (magazine->count > 0 || _Refill(magazine))
+        {
+            magazine->count--;
+            buffer = magazine->buffers[magazine->count];
+        }
+        _UnlockMagazine(magazine);
+        if (buffer != nullptr)
+        {
+            return buffer;
+        }
+        // Free buffers may be parked in the magazines of other cores
+        _ReclaimMagazines();
     }
-    void* buffer = nullptr;
-    buffer = consumerPool->front();
-    consumerPool->pop_front();
-    return buffer;
+    return _TryGetBufferFromDepot();
 }
 
 bool
@@ -98,33 +116,49 @@ BufferPool::TryGetBuffers(uint32_t reqCnt, std::vector<void*>* retBuffers, uint3
             "Failed to get buffer before init, owner:{}", BUFFER_INFO.owner);
         return false;
     }
-    unique_lock<mutex> lock(consumerLock);
-    if (consumerPool->size() + producerPool->size() < minAcqCnt)
-    {
-        return false;
-    }
-
-    while (consumerPool->size() > 0 && reqCnt > 0)
+    Magazine* magazine = _LockMagazine();
+    if (magazine == nullptr)
     {
-        void* buffer = consumerPool->front();
-        consumerPool->pop_front();
-        retBuffers->push_back(buffer);
-        reqCnt--;
+        return _TryGetBuffersFromDepot(reqCnt, retBuffers, minAcqCnt);
     }
 
-    if (reqCnt > 0)
+    bool acquired = false;
+    getCount++;
     {
-        _TrySwapWhenProducerPoolIsNotEmpty();
-        while (consumerPool->size() > 0 && reqCnt > 0)
+        unique_lock<mutex> lock(consumerLock);
+        uint64_t freeCnt = magazine->count + consumerPool->size() + producerPool->size();
+        if (freeCnt < reqCnt)
         {
-            void* buffer = consumerPool->front();
-            consumerPool->pop_front();
-            retBuffers->push_back(buffer);
-            reqCnt--;
+            _Grow(reqCnt - freeCnt);
+        }
+        if (magazine->count + consumerPool->size() + producerPool->size() >= minAcqCnt)
+        {
+            while (magazine->count > 0 && reqCnt > 0)
+            {
+                magazine->count--;
+                retBuffers->push_back(magazine->buffers[magazine->count]);
+                reqCnt--;
+            }
+            if (reqCnt > 0)
+            {
+                refillMissCount++;
+                size_t offset = retBuffers->size();
+                retBuffers->resize(offset + reqCnt);
+                uint32_t popCnt = _PopFromDepot(reqCnt, retBuffers->data() + offset);
+                retBuffers->resize(offset + popCnt);
+            }
+            acquired = true;
         }
     }
+    _UnlockMagazine(magazine);
+    if (acquired)
+    {
+        return true;
+    }
 
-    return true;
+    // Count the buffers parked in the magazines of other cores before giving up
+    _ReclaimMagazines();
+    return _TryGetBuffersFromDepot(reqCnt, retBuffers, minAcqCnt);
 }
 
 void
@@ -137,6 +171,19 @@ BufferPool::ReturnBuffer(void* buffer)
         return;
     }
 
+    Magazine* magazine = _LockMagazine();
+    if (magazine != nullptr)
+    {
+        if (magazine->count == magazineSize)
+        {
+            _Flush(magazine, magazineSize / 2);
+        }
+        magazine->buffers[magazine->count] = buffer;
+        magazine->count++;
+        _UnlockMagazine(magazine);
+        return;
+    }
+
     unique_lock<mutex> lock(producerLock);
     producerPool->push_back(buffer);
 }
@@ -146,9 +193,33 @@ BufferPool::ReturnBuffers(std::vector<void*>* buffers)
 {
     if (buffers->size() > 0)
     {
+        size_t index = 0;
+        Magazine* magazine = _LockMagazine();
+        if (magazine != nullptr)
+        {
+            while (index < buffers->size() && magazine->count < magazineSize)
+            {
+                void* buffer = (*buffers)[index++];
+                if (buffer == nullptr)
+                {
+                    POS_TRACE_WARN(EID(RESOURCE_MANAGER_DEBUG_MSG),
+                        "Failed to return buffer. Buffer is nullptr");
+                    continue;
+                }
+                magazine->buffers[magazine->count] = buffer;
+                magazine->count++;
+            }
+            _UnlockMagazine(magazine);
+        }
+        if (index == buffers->size())
+        {
+            return;
+        }
+
         unique_lock<mutex> lock(producerLock);
-        for (void* buffer : *buffers)
+        for (; index < buffers->size(); index++)
         {
+            void* buffer = (*buffers)[index];
             if (buffer == nullptr)
             {
                 POS_TRACE_WARN(EID(RESOURCE_MANAGER_DEBUG_MSG),
@@ -160,6 +231,33 @@ BufferPool::ReturnBuffers(std::vector<void*>* buffers)
     }
 }
 
+BufferPoolStat
+BufferPool::GetStat(void)
+{
+    BufferPoolStat stat;
+    stat.owner = BUFFER_INFO.owner;
+    stat.totalCount = BUFFER_INFO.count;
+    stat.getCount = getCount;
+    stat.refillMissCount = refillMissCount;
+    stat.initTimeUs = initTimeUs;
+    if (isAllocated == false)
+    {
+        return stat;
+    }
+
+    for (uint32_t index = 0; index < magazineCount; index++)
+    {
+        stat.cachedCount += magazines[index].count;
+    }
+    unique_lock<mutex> lock1(consumerLock);
+    unique_lock<mutex> lock2(producerLock);
+    // Buffers not populated yet are free as well
+    stat.populatedCount = populatedCount;
+    stat.freeCount = stat.cachedCount + consumerPool->size() + producerPool->size() +
+        (BUFFER_INFO.count - populatedCount);
+    return stat;
+}
+
 bool
 BufferPool::_Init(void)
 {
@@ -167,8 +265,31 @@ BufferPool::_Init(void)
     unique_lock<mutex> lock2(producerLock);
     bufferList1.clear();
     bufferList2.clear();
-    uint32_t remainBufferCount = 0;
-    uint8_t* buffer = 0;
+    populatedCount = 0;
+    consumerPool = &bufferList1;
+    producerPool = &bufferList2;
+    // A lazy pool starts with a single chunk and grows on demand
+    uint64_t initCount = (BUFFER_INFO.lazy && BUFFER_INFO.count > 0) ? 1 : BUFFER_INFO.count;
+    while (populatedCount < initCount)
+    {
+        if (_AllocateChunk() == 0)
+        {
+            return false;
+        }
+    }
+    // Set the swap size to prevent frequent swaps
+    swapThreshold = (size_t)((BUFFER_INFO.count * SWAP_THRESHOLD_PERCENT) / 100);
+    _InitMagazines();
+    POS_TRACE_INFO(EID(RESOURCE_MANAGER_DEBUG_MSG),
+        "BufferPool initialized, size:{}, populated:{}, swap_threshold:{}, magazine_size:{}, owner:{}",
+        BUFFER_INFO.count, populatedCount, swapThreshold, magazineSize, BUFFER_INFO.owner);
+    return true;
+}
+
+uint64_t
+BufferPool::_AllocateChunk(void)
+{
+    // This method should be executed with the lock of consumer.
     // 2MB allocation for avoiding buddy allocation overhead
     uint64_t allocSize = hugepageAllocator->GetDefaultPageSize();
     uint32_t allocCount = 1;
@@ -176,34 +297,44 @@ BufferPool::_Init(void)
     {
         allocCount = BUFFER_INFO.size / allocSize + 1;
     }
-    for (uint32_t i = 0; i < BUFFER_INFO.count; i++)
+    uint8_t* buffer = static_cast<uint8_t*>(
+        hugepageAllocator->AllocFromSocket(allocSize, allocCount, this->SOCKET));
+    if (buffer == nullptr)
     {
-        if (remainBufferCount == 0)
-        {
-            buffer = static_cast<uint8_t*>(
-                hugepageAllocator->AllocFromSocket(allocSize, allocCount, this->SOCKET));
-
-            if (buffer == nullptr)
-            {
-                POS_TRACE_WARN(EID(RESOURCE_MANAGER_DEBUG_MSG),
-                    "Failed to allocated buffer for {}", BUFFER_INFO.owner);
-                return false;
-            }
-            remainBufferCount = allocSize * allocCount / BUFFER_INFO.size;
-            allocatedHugepages.push_back(buffer);
-        }
+        POS_TRACE_WARN(EID(RESOURCE_MANAGER_DEBUG_MSG),
+            "Failed to allocated buffer for {}", BUFFER_INFO.owner);
+        return 0;
+    }
+    allocatedHugepages.push_back(buffer);
 
-        bufferList1.push_back(buffer);
+    uint64_t bufferCount = allocSize * allocCount / BUFFER_INFO.size;
+    if (bufferCount > BUFFER_INFO.count - populatedCount)
+    {
+        bufferCount = BUFFER_INFO.count - populatedCount;
+    }
+    for (uint64_t index = 0; index < bufferCount; index++)
+    {
+        consumerPool->push_back(buffer);
         buffer += BUFFER_INFO.size;
-        remainBufferCount--;
     }
-    // Set the swap size to prevent frequent swaps
-    swapThreshold = (size_t)((bufferList1.size() * SWAP_THRESHOLD_PERCENT) / 100);
-    consumerPool = &bufferList1;
-    producerPool = &bufferList2;
-    POS_TRACE_INFO(EID(RESOURCE_MANAGER_DEBUG_MSG),
-        "BufferPool initialized, size:{}, swap_threshold:{}, owner:{}", bufferList1.size(), swapThreshold, BUFFER_INFO.owner);
-    return true;
+    populatedCount += bufferCount;
+    return bufferCount;
+}
+
+void
+BufferPool::_Grow(uint64_t shortage)
+{
+    // This method should be executed with the lock of consumer.
+    // Only lazy pools have buffers left to populate.
+    while (shortage > 0 && populatedCount < BUFFER_INFO.count)
+    {
+        uint64_t grownCount = _AllocateChunk();
+        if (grownCount == 0)
+        {
+            return;
+        }
+        shortage = (grownCount < shortage) ? (shortage - grownCount) : 0;
+    }
 }
 
 void
@@ -215,6 +346,14 @@ BufferPool::_Clear()
     producerPool = nullptr;
     bufferList1.clear();
     bufferList2.clear();
+    if (magazines != nullptr)
+    {
+        delete[] magazines;
+        magazines = nullptr;
+    }
+    magazineCount = 0;
+    magazineSize = 0;
+    populatedCount = 0;
     while (allocatedHugepages.size() != 0)
     {
         void* mem = allocatedHugepages.front();
@@ -227,6 +366,183 @@ BufferPool::_Clear()
     isAllocated = false;
 }
 
+void
+BufferPool::_InitMagazines(void)
+{
+    // Keep at most half of the pool in magazines so that a burst on
+    // a few cores does not starve the others. Small pools go without them.
+    uint32_t coreCount = std::thread::hardware_concurrency();
+    if (coreCount == 0)
+    {
+        coreCount = 1;
+    }
+    uint64_t size = BUFFER_INFO.count / (coreCount * 2);
+    if (size > MAX_MAGAZINE_SIZE)
+    {
+        size = MAX_MAGAZINE_SIZE;
+    }
+    if (size < MIN_MAGAZINE_SIZE)
+    {
+        return;
+    }
+
+    magazines = new Magazine[coreCount];
+    for (uint32_t index = 0; index < coreCount; index++)
+    {
+        magazines[index].inUse = false;
+        magazines[index].count = 0;
+    }
+    magazineCount = coreCount;
+    magazineSize = static_cast<uint32_t>(size);
+}
+
+BufferPool::Magazine*
+BufferPool::_LockMagazine(void)
+{
+    if (magazineSize == 0)
+    {
+        return nullptr;
+    }
+    int cpu = sched_getcpu();
+    uint32_t index = (cpu < 0) ? 0 : static_cast<uint32_t>(cpu) % magazineCount;
+    if (magazines[index].inUse.exchange(true, memory_order_acquire) == true)
+    {
+        // Another thread on this core or a reclaim holds it, go to the depot
+        return nullptr;
+    }
+    return &magazines[index];
+}
+
+void
+BufferPool::_UnlockMagazine(Magazine* magazine)
+{
+    magazine->inUse.store(false, memory_order_release);
+}
+
+bool
+BufferPool::_Refill(Magazine* magazine)
+{
+    // This method should be executed with the magazine locked.
+    refillMissCount++;
+    unique_lock<mutex> lock(consumerLock);
+    magazine->count = _PopFromDepot(magazineSize / 2, magazine->buffers);
+    return magazine->count > 0;
+}
+
+void
+BufferPool::_Flush(Magazine* magazine, uint32_t flushCnt)
+{
+    // This method should be executed with the magazine locked.
+    // The oldest entries go back to the depot, the hot ones stay.
+    uint32_t remainCnt = magazine->count - flushCnt;
+    {
+        unique_lock<mutex> lock(producerLock);
+        for (uint32_t index = 0; index < flushCnt; index++)
+        {
+            producerPool->push_back(magazine->buffers[index]);
+        }
+    }
+    memmove(magazine->buffers, magazine->buffers + flushCnt, remainCnt * sizeof(void*));
+    magazine->count = remainCnt;
+}
+
+void
+BufferPool::_ReclaimMagazines(void)
+{
+    // This method should be executed without holding any lock of this pool.
+    vector<void*> reclaimed;
+    for (uint32_t index = 0; index < magazineCount; index++)
+    {
+        Magazine* magazine = &magazines[index];
+        if (magazine->count == 0 ||
+            magazine->inUse.exchange(true, memory_order_acquire) == true)
+        {
+            continue;
+        }
+        reclaimed.insert(reclaimed.end(), magazine->buffers, magazine->buffers + magazine->count);
+        magazine->count = 0;
+        _UnlockMagazine(magazine);
+    }
+    if (reclaimed.size() > 0)
+    {
+        unique_lock<mutex> lock(producerLock);
+        producerPool->insert(producerPool->end(), reclaimed.begin(), reclaimed.end());
+    }
+}
+
+void*
+BufferPool::_TryGetBufferFromDepot(void)
+{
+    unique_lock<mutex> lock(consumerLock);
+    _TrySwapWhenConsumerPoolEmpty();
+    if (consumerPool->empty())
+    {
+        _Grow(1);
+    }
+    if (consumerPool->empty())
+    {
+        return nullptr;
+    }
+    void* buffer = nullptr;
+    buffer = consumerPool->front();
+    consumerPool->pop_front();
+    return buffer;
+}
+
+bool
+BufferPool::_TryGetBuffersFromDepot(uint32_t reqCnt, std::vector<void*>* retBuffers, uint32_t minAcqCnt)
+{
+    unique_lock<mutex> lock(consumerLock);
+    uint64_t freeCnt = consumerPool->size() + producerPool->size();
+    if (freeCnt < reqCnt)
+    {
+        _Grow(reqCnt - freeCnt);
+    }
+    if (consumerPool->size() + producerPool->size() < minAcqCnt)
+    {
+        return false;
+    }
+
+    size_t offset = retBuffers->size();
+    retBuffers->resize(offset + reqCnt);
+    uint32_t popCnt = _PopFromDepot(reqCnt, retBuffers->data() + offset);
+    retBuffers->resize(offset + popCnt);
+    return true;
+}
+
+uint32_t
+BufferPool::_PopFromDepot(uint32_t reqCnt, void** buffers)
+{
+    // This method should be executed with the lock of consumer.
+    uint32_t popCnt = 0;
+    while (consumerPool->size() > 0 && popCnt < reqCnt)
+    {
+        buffers[popCnt++] = consumerPool->front();
+        consumerPool->pop_front();
+    }
+
+    if (popCnt < reqCnt)
+    {
+        _TrySwapWhenProducerPoolIsNotEmpty();
+        while (consumerPool->size() > 0 && popCnt < reqCnt)
+        {
+            buffers[popCnt++] = consumerPool->front();
+            consumerPool->pop_front();
+        }
+    }
+
+    if (popCnt < reqCnt)
+    {
+        _Grow(reqCnt - popCnt);
+        while (consumerPool->size() > 0 && popCnt < reqCnt)
+        {
+            buffers[popCnt++] = consumerPool->front();
+            consumerPool->pop_front();
+        }
+    }
+    return popCnt;
+}
+
 void
 BufferPool::_TrySwapWhenConsumerPoolEmpty(void)
 {
@@ -33,6 +33,7 @@
 #ifndef BUFFER_POOL_H_
 #define BUFFER_POOL_H_
 
+#include <atomic>
 #include <list>
 #include <vector>
 #include <mutex>
@@ -59,11 +60,36 @@ public:
     virtual void ReturnBuffer(void*);
     virtual void ReturnBuffers(std::vector<void*>* buffers);
     virtual bool IsAllocated(void) { return isAllocated; }
+    virtual BufferPoolStat GetStat(void);
     std::string GetOwner(void) { return BUFFER_INFO.owner; }
+    uint32_t GetMagazineSize(void) { return magazineSize; }
+
+    const static uint32_t MAX_MAGAZINE_SIZE = 32;
+    const static uint32_t MIN_MAGAZINE_SIZE = 4;
 
 private:
+    // Per-core cache of free buffers in front of the shared lists.
+    // Only the core owning the slot touches it, except for reclaim.
+    struct Magazine
+    {
+        std::atomic<bool> inUse;
+        std::atomic<uint32_t> count;
+        void* buffers[MAX_MAGAZINE_SIZE];
+    };
+
     bool _Init(void);
     void _Clear(void);
+    uint64_t _AllocateChunk(void);
+    void _Grow(uint64_t shortage);
+    void _InitMagazines(void);
+    Magazine* _LockMagazine(void);
+    void _UnlockMagazine(Magazine* magazine);
+    bool _Refill(Magazine* magazine);
+    void _Flush(Magazine* magazine, uint32_t flushCnt);
+    void _ReclaimMagazines(void);
+    void* _TryGetBufferFromDepot(void);
+    bool _TryGetBuffersFromDepot(uint32_t reqCnt, std::vector<void*>* retBuffers, uint32_t minAcqCnt);
+    uint32_t _PopFromDepot(uint32_t reqCnt, void** buffers);
     void _TrySwapWhenConsumerPoolEmpty(void);
     void _TrySwapWhenProducerPoolIsNotEmpty(void);
     void _Swap(void);
@@ -82,7 +108,15 @@ private:
     std::mutex producerLock;
     bool isAllocated = false;
     size_t swapThreshold = 0;
+    uint64_t populatedCount = 0;
+    uint64_t initTimeUs = 0;
     const static size_t SWAP_THRESHOLD_PERCENT = 25;
+
+    Magazine* magazines = nullptr;
+    uint32_t magazineCount = 0;
+    uint32_t magazineSize = 0;
+    std::atomic<uint64_t> getCount;
+    std::atomic<uint64_t> refillMissCount;
 };
 
 } // namespace pos
@@ -37,13 +37,17 @@
 #include "src/include/pos_event_id.hpp"
 #include "src/logger/logger.h"
 
+#include <numa.h>
+#include <thread>
+
 using namespace pos;
 using namespace std;
 
 MemoryManager::MemoryManager(BufferPoolFactory* bufferPoolFactory,
     AffinityManager* affinityManager)
 : bufferPoolFactory(bufferPoolFactory),
-  affinityManager(affinityManager)
+  affinityManager(affinityManager),
+  totalInitTimeUs(0)
 {
     if (this->bufferPoolFactory == nullptr)
     {
@@ -76,8 +80,16 @@ MemoryManager::CreateBufferPool(BufferInfo& info, uint32_t socket)
     BufferPool* pool = bufferPoolFactory->Create(info, socket);
     if (pool != nullptr)
     {
-        unique_lock<mutex> lock(bufferPoolsLock);
-        bufferPools.push_back(pool);
+        {
+            unique_lock<mutex> lock(bufferPoolsLock);
+            bufferPools.push_back(pool);
+        }
+        BufferPoolStat stat = pool->GetStat();
+        totalInitTimeUs += stat.initTimeUs;
+        POS_TRACE_INFO(EID(RESOURCE_MANAGER_DEBUG_MSG),
+            "BufferPool created, owner:{}, socket:{}, populated:{}/{}, init_time_us:{}, total_init_time_us:{}",
+            stat.owner, socket, stat.populatedCount, stat.totalCount,
+            stat.initTimeUs, totalInitTimeUs);
     }
     else
     {
@@ -89,6 +101,48 @@ MemoryManager::CreateBufferPool(BufferInfo& info, uint32_t socket)
     return pool;
 }
 
+std::vector<BufferPool*>
+MemoryManager::CreateBufferPoolsPerNuma(std::vector<BufferInfo>& infos)
+{
+    // infos[numa] is created by a thread running on that node so that the
+    // hugepages of each node are populated in parallel and node-locally.
+    std::vector<BufferPool*> pools(infos.size(), nullptr);
+    std::vector<std::thread> workers;
+    for (uint32_t numa = 0; numa < infos.size(); numa++)
+    {
+        workers.emplace_back([this, &infos, &pools, numa](void)
+        {
+            if (numa_available() >= 0)
+            {
+                // Best effort, the pool is bound to the socket anyway
+                numa_run_on_node(numa);
+            }
+            pools[numa] = CreateBufferPool(infos[numa], numa);
+        });
+    }
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    for (BufferPool* pool : pools)
+    {
+        if (pool == nullptr)
+        {
+            for (BufferPool* created : pools)
+            {
+                if (created != nullptr)
+                {
+                    DeleteBufferPool(created);
+                }
+            }
+            pools.clear();
+            break;
+        }
+    }
+    return pools;
+}
+
 bool
 MemoryManager::DeleteBufferPool(BufferPool* poolToDelete)
 {
@@ -99,10 +153,37 @@ MemoryManager::DeleteBufferPool(BufferPool* poolToDelete)
     {
         return false;
     }
+    _LogBufferPoolStat(poolToDelete->GetStat());
     delete poolToDelete;
     return true;
 }
 
+std::vector<BufferPoolStat>
+MemoryManager::GetBufferPoolStats(void)
+{
+    std::vector<BufferPoolStat> stats;
+    unique_lock<mutex> lock(bufferPoolsLock);
+    for (BufferPool* pool : bufferPools)
+    {
+        stats.push_back(pool->GetStat());
+    }
+    return stats;
+}
+
+void
+MemoryManager::_LogBufferPoolStat(const BufferPoolStat& stat)
+{
+    uint64_t missRatePercent = 0;
+    if (stat.getCount > 0)
+    {
+        missRatePercent = stat.refillMissCount * 100 / stat.getCount;
+    }
+    POS_TRACE_INFO(EID(RESOURCE_MANAGER_DEBUG_MSG),
+        "BufferPool stat, owner:{}, free:{}/{}, populated:{}, cached:{}, get:{}, refill_miss:{}, refill_miss_rate:{}%, init_time_us:{}",
+        stat.owner, stat.freeCount, stat.totalCount, stat.populatedCount, stat.cachedCount,
+        stat.getCount, stat.refillMissCount, missRatePercent, stat.initTimeUs);
+}
+
 bool
 MemoryManager::_CheckBufferPolicy(const BufferInfo& info, uint32_t& socket)
 {
@@ -33,8 +33,10 @@
 #ifndef MEMORY_MANAGER_H_
 #define MEMORY_MANAGER_H_
 
+#include <atomic>
 #include <list>
 #include <mutex>
+#include <vector>
 
 #include "buffer_info.h"
 #include "src/lib/singleton.h"
@@ -55,16 +57,21 @@ public:
     virtual ~MemoryManager(void);
     virtual BufferPool* CreateBufferPool(BufferInfo& info,
         uint32_t socket = USE_DEFAULT_SOCKET);
+    virtual std::vector<BufferPool*> CreateBufferPoolsPerNuma(
+        std::vector<BufferInfo>& infos);
     virtual bool DeleteBufferPool(BufferPool* pool);
+    virtual std::vector<BufferPoolStat> GetBufferPoolStats(void);
 
 private:
     bool _CheckBufferPolicy(const BufferInfo& info, uint32_t& socket);
+    void _LogBufferPoolStat(const BufferPoolStat& stat);
 
     std::mutex bufferPoolsLock;
     std::list<BufferPool*> bufferPools;
 
     BufferPoolFactory* bufferPoolFactory;
     AffinityManager* affinityManager;
+    std::atomic<uint64_t> totalInitTimeUs;
 };
 
 using MemoryManagerSingleton = Singleton<MemoryManager>;
@@ -34,9 +34,11 @@
 
 #include <math.h>
 
+#include <algorithm>
 #include <experimental/filesystem>
 #include <string>
 
+#include "rocksdb/write_batch.h"
 #include "src/event_scheduler/callback.h"
 #include "src/event_scheduler/event_scheduler.h"
 #include "src/journal_manager/log/log_event.h"
@@ -58,7 +60,8 @@ RocksDBLogBuffer::RocksDBLogBuffer(void)
   rocksJournal(nullptr),
   logBufferSize(0),
   telemetryPublisher(nullptr),
-  basePathName("")
+  basePathName(""),
+  isCommitting(false)
 {
 }
 
@@ -71,11 +74,7 @@ RocksDBLogBuffer::RocksDBLogBuffer(const std::string arrayName)
 // LCOV_EXCL_START
 RocksDBLogBuffer::~RocksDBLogBuffer(void)
 {
-    if (rocksJournal != nullptr)
-    {
-        delete rocksJournal;
-        rocksJournal = nullptr;
-    }
+    _CloseDB();
 }
 // LCOV_EXCL_STOP
 
@@ -111,11 +110,7 @@ RocksDBLogBuffer::Dispose(void)
         POS_TRACE_WARN(static_cast<int>(EID(ROCKSDB_LOG_BUFFER_DISPOSED)), "RocksDB Disposed RocksDB was not opened (path : {})", pathName);
     }
 
-    if (rocksJournal != nullptr)
-    {
-        delete rocksJournal;
-        rocksJournal = nullptr;
-    }
+    _CloseDB();
 }
 
 int
@@ -127,16 +122,17 @@ RocksDBLogBuffer::Create(uint64_t logBufferSize)
         return ret;
     }
 
-    rocksdb::Options options;
+    rocksdb::Options options = _GetOptions();
     options.create_if_missing = true;
-    rocksdb::Status status = rocksdb::DB::Open(options, pathName, &rocksJournal);
+    options.create_missing_column_families = true;
+    rocksdb::Status status = _OpenDB(options);
 
     if (status.ok() == true)
     {
         isOpened = true;
         std::string logBufferSizeKey = "logBufferSizeKey";
         rocksdb::Slice value(to_string(logBufferSize));
-        rocksdb::Status addBufferSizeStatus = rocksJournal->Put(rocksdb::WriteOptions(), logBufferSizeKey, value);
+        rocksdb::Status addBufferSizeStatus = rocksJournal->Put(_GetWriteOptions(), logBufferSizeKey, value);
         if (addBufferSizeStatus.ok())
         {
             POS_TRACE_INFO(static_cast<int>(EID(ROCKSDB_LOG_BUFFER_CREATED)),
@@ -162,8 +158,8 @@ int
 RocksDBLogBuffer::Open(uint64_t& logBufferSize)
 {
     // Do not Open RocksDB Twice (Create and Open is also same)
-    rocksdb::Options options;
-    rocksdb::Status status = rocksdb::DB::Open(options, pathName, &rocksJournal);
+    rocksdb::Options options = _GetOptions();
+    rocksdb::Status status = _OpenDB(options);
 
     if (status.ok() == true)
     {
@@ -198,8 +194,7 @@ RocksDBLogBuffer::Close(void)
     isOpened = false;
     if (rocksJournal != nullptr)
     {
-        delete rocksJournal;
-        rocksJournal = nullptr;
+        _CloseDB();
         POS_TRACE_INFO(static_cast<int>(EID(ROCKSDB_LOG_BUFFER_CLOSED)), "RocksDB Journal Closed (path :{}) ", pathName);
     }
     else
@@ -215,7 +210,7 @@ RocksDBLogBuffer::ReadLogBuffer(int groupId, void* buffer)
     std::string keyToStart = _MakeRocksDbKey(groupId, 0);
     std::string keyToLimit = _MakeRocksDbKey(groupId + 1, 0);
 
-    rocksdb::Iterator* it = rocksJournal->NewIterator(rocksdb::ReadOptions());
+    rocksdb::Iterator* it = rocksJournal->NewIterator(rocksdb::ReadOptions(), _GetColumnFamily(groupId));
     uint64_t offset = 0;
     for (it->Seek(keyToStart); it->Valid() && it->key().ToString() < keyToLimit; it->Next())
     {
@@ -227,13 +222,17 @@ RocksDBLogBuffer::ReadLogBuffer(int groupId, void* buffer)
             POS_TRACE_ERROR(static_cast<int>(EID(ROCKSDB_LOG_BUFFER_READ_LOG_BUFFER_FAILED_WRONG_BUFFER_OFFSET)),
                 "RocksDB Read LogBuffer failed, size of read buffer is over logbuffersize (offset + size > logbuffersize) ({} + {} >= {}), logGroupID : {} (path : {})",
                 offset, size, this->logBufferSize, groupId, pathName);
+            delete it;
             return -1 * EID(ROCKSDB_LOG_BUFFER_READ_LOG_BUFFER_FAILED_WRONG_BUFFER_OFFSET);
         }
         memcpy((void*)((char*)buffer + offset), itValue.c_str(), size);
         offset += size;
     }
 
-    if (it->status().ok())
+    bool scanSucceeded = it->status().ok();
+    delete it;
+
+    if (scanSucceeded)
     {
         POS_TRACE_DEBUG(static_cast<int>(EID(ROCKSDB_LOG_BUFFER_READ_LOG_BUFFER_SUCCEED)),
             "RocksDB Read LogBuffer succeed logGroupID : {} (path : {})", groupId, pathName);
@@ -247,8 +246,98 @@ RocksDBLogBuffer::ReadLogBuffer(int groupId, void* buffer)
     }
 }
 
+// Logs stored in the range are packed from the start of the buffer, as ReadLogBuffer does
+int
+RocksDBLogBuffer::ReadLogBufferChunk(int groupId, uint64_t offset, uint64_t size, void* buffer, FnCompleteMetaFileIo func)
+{
+    std::string keyToStart = _MakeRocksDbKey(groupId, offset);
+    std::string keyToLimit = _MakeRocksDbKey(groupId, offset + size);
+    if (offset + size >= config->GetLogGroupSize())
+    {
+        keyToLimit = _MakeRocksDbKey(groupId + 1, 0);
+    }
+
+    rocksdb::Iterator* it = rocksJournal->NewIterator(rocksdb::ReadOptions(), _GetColumnFamily(groupId));
+    uint64_t readSize = 0;
+    int result = EID(SUCCESS);
+    for (it->Seek(keyToStart); it->Valid() && it->key().ToString() < keyToLimit; it->Next())
+    {
+        std::string itValue = it->value().ToString();
+        if (readSize + itValue.size() > size)
+        {
+            POS_TRACE_ERROR(static_cast<int>(EID(ROCKSDB_LOG_BUFFER_READ_LOG_BUFFER_FAILED_WRONG_BUFFER_OFFSET)),
+                "RocksDB Read LogBuffer failed, logs are over the read size ({} + {} > {}), logGroupID : {} (path : {})",
+                readSize, itValue.size(), size, groupId, pathName);
+            result = EID(ROCKSDB_LOG_BUFFER_READ_LOG_BUFFER_FAILED_WRONG_BUFFER_OFFSET);
+            break;
+        }
+        memcpy((void*)((char*)buffer + readSize), itValue.c_str(), itValue.size());
+        readSize += itValue.size();
+    }
+
+    if (result == EID(SUCCESS) && it->status().ok() == false)
+    {
+        POS_TRACE_ERROR(static_cast<int>(EID(ROCKSDB_LOG_BUFFER_READ_LOG_BUFFER_FAILED_ROCKSDB_SCAN_FAILED)),
+            "RocksDB Read LogBuffer failed logGroupID : {} (path : {})", groupId, pathName);
+        result = EID(ROCKSDB_LOG_BUFFER_READ_LOG_BUFFER_FAILED_ROCKSDB_SCAN_FAILED);
+    }
+    delete it;
+
+    AsyncMetaFileIoCtx* readRequest = new AsyncMetaFileIoCtx();
+    readRequest->SetIoInfo(MetaFsIoOpcode::Read, offset, size, (char*)buffer);
+    readRequest->error = result;
+    func(readRequest);
+
+    return 0;
+}
+
 int
 RocksDBLogBuffer::WriteLog(LogWriteContext* context, uint64_t fileOffset, FnCompleteMetaFileIo func)
+{
+    PendingLogWrite write = _CreatePendingWrite(context, fileOffset, func);
+    if (config->IsRocksdbWriteBatchEnabled() == true)
+    {
+        std::vector<PendingLogWrite> writes = {write};
+        _CommitWrites(writes);
+        return EID(SUCCESS);
+    }
+
+    int result = EID(SUCCESS);
+
+    rocksdb::Status ret = rocksJournal->Put(_GetWriteOptions(), _GetColumnFamily(write.logGroupId), write.key, write.value);
+    if (ret.ok())
+    {
+        POS_TRACE_DEBUG(static_cast<int>(EID(ROCKSDB_LOG_BUFFER_WRITE_LOG_DONE)), "RocksDB Key : {} insertion succeed", write.key);
+        write.ioContext->HandleIoComplete(context);
+    }
+    else
+    {
+        POS_TRACE_ERROR(static_cast<int>(EID(ROCKSDB_LOG_BUFFER_WRITE_LOG_FAILED)),
+            "RocksDB Key : {} (logGroupId : {}, fileOffset : {}) insertion failed by RocksDB, status code : {} (path : {})", write.key, write.logGroupId, fileOffset, ret.code(), pathName);
+        result = -1 * EID(ROCKSDB_LOG_BUFFER_WRITE_LOG_FAILED);
+
+        delete write.ioContext;
+    }
+
+    return result;
+}
+
+// Logs are put into rocksdb with a single write batch, and failures are notified through func
+int
+RocksDBLogBuffer::WriteLogs(std::vector<LogWriteContext*>& contexts, uint64_t fileOffset, FnCompleteMetaFileIo func)
+{
+    std::vector<PendingLogWrite> writes;
+    for (auto context : contexts)
+    {
+        writes.push_back(_CreatePendingWrite(context, fileOffset, func));
+        fileOffset += context->GetLogSize();
+    }
+    _CommitWrites(writes);
+    return EID(SUCCESS);
+}
+
+RocksDBLogBuffer::PendingLogWrite
+RocksDBLogBuffer::_CreatePendingWrite(LogWriteContext* context, uint64_t fileOffset, FnCompleteMetaFileIo func)
 {
     // TODO do not use log write io context (it's needed for now because of callback func)
     LogWriteIoContext* ioContext = ioContextFactory->CreateMapUpdateLogWriteIoContext(context);
@@ -256,30 +345,76 @@ RocksDBLogBuffer::WriteLog(LogWriteContext* context, uint64_t fileOffset, FnComp
     ioContext->SetFileInfo(0, [](void* data) { return 0; });
     ioContext->SetCallback(func);
 
-    int logGroupId = context->GetLogGroupId();
-    std::string key = _MakeRocksDbKey(logGroupId, fileOffset);
+    PendingLogWrite write;
+    write.logGroupId = context->GetLogGroupId();
+    write.key = _MakeRocksDbKey(write.logGroupId, fileOffset);
+    write.value = std::string((char*)context->GetBuffer(), context->GetLogSize());
+    write.ioContext = ioContext;
+
     POS_TRACE_DEBUG(static_cast<int>(EID(ROCKSDB_LOG_BUFFER_TRY_WRITE_LOG)),
-        "RocksDB Key : {} (logGroupId : {}, fileOffset : {}) , Trying to Write Log (path : {})", key, logGroupId, fileOffset, pathName);
+        "RocksDB Key : {} (logGroupId : {}, fileOffset : {}) , Trying to Write Log (path : {})", write.key, write.logGroupId, fileOffset, pathName);
+    return write;
+}
 
-    int result = EID(SUCCESS);
+// The first writer commits its logs together with the ones added while it is committing,
+// and the others return right after adding theirs. Locks are released while committing
+// so that log writes issued from the completion callbacks are gathered to the next batch
+void
+RocksDBLogBuffer::_CommitWrites(std::vector<PendingLogWrite>& writes)
+{
+    std::unique_lock<std::mutex> lock(pendingWriteLock);
+    pendingWrites.insert(pendingWrites.end(), writes.begin(), writes.end());
+    if (isCommitting == true)
+    {
+        return;
+    }
 
-    std::string value((char*)context->GetBuffer(), context->GetLogSize());
-    rocksdb::Status ret = rocksJournal->Put(rocksdb::WriteOptions(), key, value);
-    if (ret.ok())
+    isCommitting = true;
+    while (pendingWrites.size() != 0)
     {
-        POS_TRACE_DEBUG(static_cast<int>(EID(ROCKSDB_LOG_BUFFER_WRITE_LOG_DONE)), "RocksDB Key : {} insertion succeed", key);
-        ioContext->HandleIoComplete(context);
+        std::vector<PendingLogWrite> batch;
+        batch.swap(pendingWrites);
+        lock.unlock();
+
+        rocksdb::WriteBatch writeBatch;
+        for (auto& write : batch)
+        {
+            writeBatch.Put(_GetColumnFamily(write.logGroupId), write.key, write.value);
+        }
+        rocksdb::Status status = rocksJournal->Write(_GetWriteOptions(), &writeBatch);
+        _CompleteWrites(batch, status);
+
+        lock.lock();
+    }
+    isCommitting = false;
+}
+
+void
+RocksDBLogBuffer::_CompleteWrites(std::vector<PendingLogWrite>& writes, rocksdb::Status status)
+{
+    if (status.ok())
+    {
+        POS_TRACE_DEBUG(static_cast<int>(EID(ROCKSDB_LOG_BUFFER_WRITE_LOG_DONE)),
+            "RocksDB {} logs insertion succeed", writes.size());
     }
     else
     {
         POS_TRACE_ERROR(static_cast<int>(EID(ROCKSDB_LOG_BUFFER_WRITE_LOG_FAILED)),
-            "RocksDB Key : {} (logGroupId : {}, fileOffset : {}) insertion failed by RocksDB, status code : {} (path : {})", key, logGroupId, fileOffset, ret.code(), pathName);
-        result = -1 * EID(ROCKSDB_LOG_BUFFER_WRITE_LOG_FAILED);
-
-        delete ioContext;
+            "RocksDB {} logs insertion failed by RocksDB, status code : {} (path : {})", writes.size(), status.code(), pathName);
     }
 
-    return result;
+    for (auto& write : writes)
+    {
+        if (status.ok())
+        {
+            write.ioContext->HandleIoComplete(write.ioContext->GetLogWriteContext());
+        }
+        else
+        {
+            write.ioContext->error = -1 * EID(ROCKSDB_LOG_BUFFER_WRITE_LOG_FAILED);
+            write.ioContext->GetCallback()(write.ioContext);
+        }
+    }
 }
 
 int
@@ -303,11 +438,7 @@ RocksDBLogBuffer::SyncResetAll(void)
 int
 RocksDBLogBuffer::AsyncReset(int id, EventSmartPtr callbackEvent)
 {
-    std::string keyStart = _MakeRocksDbKey(id, 0);
-    std::string keyEnd = _MakeRocksDbKey(id + 1, 0);
-    rocksdb::ColumnFamilyHandle* cf = rocksJournal->DefaultColumnFamily();
-    rocksdb::Slice start(keyStart), end(keyEnd);
-    rocksdb::Status ret = rocksJournal->DeleteRange(rocksdb::WriteOptions(), cf, start, end);
+    rocksdb::Status ret = _ResetColumnFamily(id);
     if (ret.ok())
     {
         POS_TRACE_INFO(static_cast<int>(EID(ROCKSDB_LOG_BUFFER_LOG_GROUP_RESET)), "RocksDB logs in logGroupId {} is reset ", id);
@@ -333,7 +464,7 @@ RocksDBLogBuffer::WriteLogGroupFooter(uint64_t fileOffset, LogGroupFooter footer
     int result = EID(SUCCESS);
 
     std::string value((char*)ioContext->GetBuffer(), ioContext->GetLength());
-    rocksdb::Status ret = rocksJournal->Put(rocksdb::WriteOptions(), key, value);
+    rocksdb::Status ret = rocksJournal->Put(_GetWriteOptions(), _GetColumnFamily(logGroupId), key, value);
     if (ret.ok())
     {
         POS_TRACE_DEBUG(static_cast<int>(EID(ROCKSDB_LOG_BUFFER_WRITE_LOG_DONE)), "RocksDB Key : {} insertion succeed", key);
@@ -350,6 +481,143 @@ RocksDBLogBuffer::WriteLogGroupFooter(uint64_t fileOffset, LogGroupFooter footer
     return result;
 }
 
+rocksdb::Options
+RocksDBLogBuffer::_GetOptions(void)
+{
+    rocksdb::Options options;
+    uint64_t memtableSize = config->GetRocksdbMemtableSize();
+    if (memtableSize != 0)
+    {
+        options.write_buffer_size = memtableSize;
+    }
+    return options;
+}
+
+rocksdb::WriteOptions
+RocksDBLogBuffer::_GetWriteOptions(void)
+{
+    rocksdb::WriteOptions options;
+    options.sync = config->IsRocksdbSyncWriteEnabled();
+    return options;
+}
+
+// Opens every column family in the db, and creates the ones of log groups
+// only when options.create_missing_column_families is set
+rocksdb::Status
+RocksDBLogBuffer::_OpenDB(rocksdb::Options& options)
+{
+    int numLogGroups = config->GetNumLogGroups();
+
+    std::vector<std::string> names;
+    rocksdb::DB::ListColumnFamilies(options, pathName, &names);
+    if (options.create_missing_column_families == true)
+    {
+        for (int groupId = 0; groupId < numLogGroups; groupId++)
+        {
+            std::string name = _GetColumnFamilyName(groupId);
+            if (std::find(names.begin(), names.end(), name) == names.end())
+            {
+                names.push_back(name);
+            }
+        }
+    }
+    if (std::find(names.begin(), names.end(), rocksdb::kDefaultColumnFamilyName) == names.end())
+    {
+        names.push_back(rocksdb::kDefaultColumnFamilyName);
+    }
+
+    std::vector<rocksdb::ColumnFamilyDescriptor> descriptors;
+    for (auto& name : names)
+    {
+        descriptors.push_back(rocksdb::ColumnFamilyDescriptor(name, rocksdb::ColumnFamilyOptions(options)));
+    }
+
+    std::vector<rocksdb::ColumnFamilyHandle*> handles;
+    rocksdb::Status status = rocksdb::DB::Open(rocksdb::DBOptions(options), pathName, descriptors, &handles, &rocksJournal);
+    if (status.ok() == true)
+    {
+        columnFamilies.assign(numLogGroups, rocksJournal->DefaultColumnFamily());
+        for (auto handle : handles)
+        {
+            bool isLogGroup = false;
+            for (int groupId = 0; groupId < numLogGroups; groupId++)
+            {
+                if (handle->GetName() == _GetColumnFamilyName(groupId))
+                {
+                    columnFamilies[groupId] = handle;
+                    isLogGroup = true;
+                }
+            }
+            if (isLogGroup == false)
+            {
+                rocksJournal->DestroyColumnFamilyHandle(handle);
+            }
+        }
+    }
+    return status;
+}
+
+void
+RocksDBLogBuffer::_CloseDB(void)
+{
+    if (rocksJournal != nullptr)
+    {
+        for (auto handle : columnFamilies)
+        {
+            if (handle != rocksJournal->DefaultColumnFamily())
+            {
+                rocksJournal->DestroyColumnFamilyHandle(handle);
+            }
+        }
+        columnFamilies.clear();
+
+        delete rocksJournal;
+        rocksJournal = nullptr;
+    }
+}
+
+rocksdb::ColumnFamilyHandle*
+RocksDBLogBuffer::_GetColumnFamily(int groupId)
+{
+    if (groupId >= 0 && groupId < static_cast<int>(columnFamilies.size()))
+    {
+        return columnFamilies[groupId];
+    }
+    return rocksJournal->DefaultColumnFamily();
+}
+
+// Log group is reset by dropping its column family and creating it again,
+// or by deleting its key range when it is in the default column family
+rocksdb::Status
+RocksDBLogBuffer::_ResetColumnFamily(int groupId)
+{
+    rocksdb::ColumnFamilyHandle* cf = _GetColumnFamily(groupId);
+    if (cf == rocksJournal->DefaultColumnFamily())
+    {
+        std::string keyStart = _MakeRocksDbKey(groupId, 0);
+        std::string keyEnd = _MakeRocksDbKey(groupId + 1, 0);
+        rocksdb::Slice start(keyStart), end(keyEnd);
+        return rocksJournal->DeleteRange(_GetWriteOptions(), cf, start, end);
+    }
+
+    rocksdb::Status status = rocksJournal->DropColumnFamily(cf);
+    if (status.ok() == false)
+    {
+        return status;
+    }
+    rocksJournal->DestroyColumnFamilyHandle(cf);
+    columnFamilies[groupId] = rocksJournal->DefaultColumnFamily();
+
+    rocksdb::ColumnFamilyHandle* newHandle = nullptr;
+    status = rocksJournal->CreateColumnFamily(rocksdb::ColumnFamilyOptions(_GetOptions()),
+        _GetColumnFamilyName(groupId), &newHandle);
+    if (status.ok() == true)
+    {
+        columnFamilies[groupId] = newHandle;
+    }
+    return status;
+}
+
 void
 RocksDBLogBuffer::_InternalIoDone(AsyncMetaFileIoCtx* ctx)
 {
@@ -374,8 +642,7 @@ RocksDBLogBuffer::Delete(void)
         if (rocksJournal != nullptr)
         {
             POS_TRACE_INFO(static_cast<int>(EID(ROCKSDB_LOG_BUFFER_DELETE_DB)), "RocksDB DB handler deleted (path : {})", pathName);
-            delete rocksJournal;
-            rocksJournal = nullptr;
+            _CloseDB();
         }
         ret = _DeleteDirectory();
         return ret;
@@ -32,13 +32,17 @@
 
 #pragma once
 
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include "rocksdb/db.h"
 #include "src/journal_manager/log_buffer/i_journal_log_buffer.h"
 
 namespace pos
 {
+class LogWriteIoContext;
+
 class RocksDBLogBuffer : public IJournalLogBuffer
 {
 public:
@@ -56,7 +60,9 @@ public:
     virtual int Close(void);
 
     virtual int ReadLogBuffer(int groupId, void* buffer) override;
+    virtual int ReadLogBufferChunk(int groupId, uint64_t offset, uint64_t size, void* buffer, FnCompleteMetaFileIo func) override;
     virtual int WriteLog(LogWriteContext* context, uint64_t offset, FnCompleteMetaFileIo func) override;
+    virtual int WriteLogs(std::vector<LogWriteContext*>& contexts, uint64_t offset, FnCompleteMetaFileIo func) override;
 
     virtual int SyncResetAll(void) override;
     virtual int AsyncReset(int id, EventSmartPtr callbackEvent) override;
@@ -84,8 +90,33 @@ protected:
     bool isOpened;
 
 private:
+    struct PendingLogWrite
+    {
+        int logGroupId;
+        std::string key;
+        std::string value;
+        LogWriteIoContext* ioContext;
+    };
+
     void _InternalIoDone(AsyncMetaFileIoCtx* ctx);
 
+    rocksdb::Options _GetOptions(void);
+    rocksdb::WriteOptions _GetWriteOptions(void);
+    rocksdb::Status _OpenDB(rocksdb::Options& options);
+    void _CloseDB(void);
+    rocksdb::ColumnFamilyHandle* _GetColumnFamily(int groupId);
+    rocksdb::Status _ResetColumnFamily(int groupId);
+
+    PendingLogWrite _CreatePendingWrite(LogWriteContext* context, uint64_t fileOffset, FnCompleteMetaFileIo func);
+    void _CommitWrites(std::vector<PendingLogWrite>& writes);
+    void _CompleteWrites(std::vector<PendingLogWrite>& writes, rocksdb::Status status);
+
+    inline std::string
+    _GetColumnFamilyName(int groupId)
+    {
+        return "LogGroup" + std::to_string(groupId);
+    }
+
     inline uint64_t
     _GetFileOffset(int groupId, uint64_t offset)
     {
@@ -107,11 +138,19 @@ private:
     JournalConfiguration* config;
     LogBufferIoContextFactory* ioContextFactory;
     rocksdb::DB* rocksJournal;
+    // Each log group has its own column family, so that it can be reset by dropping it.
+    // Log groups of a journal created without them are kept in the default column family
+    std::vector<rocksdb::ColumnFamilyHandle*> columnFamilies;
     uint64_t logBufferSize;
     std::string arrayName;
 
     TelemetryPublisher* telemetryPublisher;
     std::string basePathName;
+
+    // Logs written while a batch is being committed are gathered to the next batch
+    std::mutex pendingWriteLock;
+    std::vector<PendingLogWrite> pendingWrites;
+    bool isCommitting;
 };
 
 } // namespace pos
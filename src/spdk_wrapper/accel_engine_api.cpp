@@ -65,6 +65,7 @@ std::atomic<bool> AccelEngineApi::initialized;
 std::atomic<bool> AccelEngineApi::finalized;
 std::atomic<bool> AccelEngineApi::enabled;
 thread_local spdk_io_channel* AccelEngineApi::spdkChannel;
+thread_local bool AccelEngineApi::ioatChannel = false;
 uint32_t AccelEngineApi::ioatReactorArray[RTE_MAX_LCORE] = {
     0,
 };
@@ -128,6 +129,7 @@ AccelEngineApi::_SetChannel(void)
     uint32_t currentReactor = EventFrameworkApiSingleton::Instance()->GetCurrentReactor();
     if (ioatChannelExist)
     {
+        ioatChannel = true;
         ioatReactorArray[ioatReactorCount] = currentReactor;
         ioatReactorCount++;
         uint32_t ioatCount = get_ioat_count_per_numa(detected_numa_count);
@@ -227,6 +229,12 @@ AccelEngineApi::IsIoatEnable(void)
     return enabled;
 }
 
+bool
+AccelEngineApi::IsIoatReactorNow(void)
+{
+    return _IsChannelValid() && ioatChannel;
+}
+
 void
 AccelEngineApi::_SetIoat(void)
 {
@@ -289,6 +297,7 @@ AccelEngineApi::_PutChannel(void)
 {
     spdk_put_io_channel(spdkChannel);
     spdkChannel = nullptr;
+    ioatChannel = false;
     SPDK_NOTICELOG("Ioat Copy Engine Offload Disabled\n");
 }
 
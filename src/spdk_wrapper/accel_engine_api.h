@@ -63,6 +63,7 @@ struct IoatArgument
     IoatCb cbFunction;
     void* cbArgument;
 };
+
 class AccelEngineApi
 {
 public:
@@ -74,6 +75,8 @@ public:
         void* cbArgument);
     static void Finalize(EventFrameworkApi* eventFrameworkApi = nullptr);
     static bool IsIoatEnable(void);
+    // Whether the channel of the current reactor copies by dma
+    static bool IsIoatReactorNow(void);
     static int GetIoatReactorByIndex(uint32_t index);
     static int GetReactorByIndex(uint32_t index);
     static uint32_t GetIoatReactorCount(void);
@@ -90,6 +93,7 @@ private:
     static std::atomic<uint32_t> ioatReactorCountPerNode[RTE_MAX_NUMA_NODES];
     static uint32_t detected_numa_count;
     static thread_local spdk_io_channel* spdkChannel;
+    static thread_local bool ioatChannel;
 
     static void _HandleInitialize(void* arg1);
     static void _HandleCopy(void* arg1, void* arg2);
@@ -122,6 +122,22 @@ SpdkBdevCaller::SpdkBdevWrite(struct spdk_bdev_desc *desc, struct spdk_io_channe
     return spdk_bdev_write(desc, ch, buf, offset, nbytes, cb, cb_arg);
 }
 
+int
+SpdkBdevCaller::SpdkBdevReadv(struct spdk_bdev_desc *desc, struct spdk_io_channel *ch,
+        struct iovec *iov, int iovcnt, uint64_t offset, uint64_t nbytes,
+        spdk_bdev_io_completion_cb cb, void *cb_arg)
+{
+    return spdk_bdev_readv(desc, ch, iov, iovcnt, offset, nbytes, cb, cb_arg);
+}
+
+int
+SpdkBdevCaller::SpdkBdevWritev(struct spdk_bdev_desc *desc, struct spdk_io_channel *ch,
+        struct iovec *iov, int iovcnt, uint64_t offset, uint64_t nbytes,
+        spdk_bdev_io_completion_cb cb, void *cb_arg)
+{
+    return spdk_bdev_writev(desc, ch, iov, iovcnt, offset, nbytes, cb, cb_arg);
+}
+
 void
 SpdkBdevCaller::SpdkBdevFreeIo(struct spdk_bdev_io* bdev_io)
 {
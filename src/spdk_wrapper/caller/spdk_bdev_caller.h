@@ -74,6 +74,22 @@ public:
         uint64_t nbytes,
         spdk_bdev_io_completion_cb cb,
         void *cb_arg);
+    virtual int SpdkBdevReadv(struct spdk_bdev_desc *desc,
+        struct spdk_io_channel *ch,
+        struct iovec *iov,
+        int iovcnt,
+        uint64_t offset,
+        uint64_t nbytes,
+        spdk_bdev_io_completion_cb cb,
+        void *cb_arg);
+    virtual int SpdkBdevWritev(struct spdk_bdev_desc *desc,
+        struct spdk_io_channel *ch,
+        struct iovec *iov,
+        int iovcnt,
+        uint64_t offset,
+        uint64_t nbytes,
+        spdk_bdev_io_completion_cb cb,
+        void *cb_arg);
     virtual void SpdkBdevFreeIo(struct spdk_bdev_io* bdev_io);
 };
 
@@ -103,6 +103,12 @@ SpdkCaller::SpdkBdevGetName(const struct spdk_bdev* bdev)
     return spdk_bdev_get_name(bdev);
 }
 
+int
+SpdkCaller::SpdkBdevNotifyBlockcntChange(struct spdk_bdev* bdev, uint64_t size)
+{
+    return spdk_bdev_notify_blockcnt_change(bdev, size);
+}
+
 void
 SpdkCaller::SpdkBdevSetQosRateLimits(struct spdk_bdev* bdev, uint64_t* limits,
     void (*cbFunc)(void* cbArg, int status), void* cbArg)
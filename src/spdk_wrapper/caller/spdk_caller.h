@@ -56,6 +56,7 @@ public:
     virtual void SpdkBdevDeletePosDisk(struct spdk_bdev* bdev, pos_bdev_delete_callback cbFunc, void* cbArg);
     virtual struct spdk_bdev* SpdkBdevGetByName(const char* bdevName);
     virtual const char* SpdkBdevGetName(const struct spdk_bdev* bdev);
+    virtual int SpdkBdevNotifyBlockcntChange(struct spdk_bdev* bdev, uint64_t size);
     virtual void SpdkBdevSetQosRateLimits(struct spdk_bdev* bdev, uint64_t* limits,
         void (*cbFunc)(void* cbArg, int status), void* cbArg);
     virtual const char* SpdkGetAttachedSubsystemNqn(const char* bdevName);
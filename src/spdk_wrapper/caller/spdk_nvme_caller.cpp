@@ -98,6 +98,38 @@ SpdkNvmeCaller::SpdkNvmeNsCmdWrite(
         ns, qpair, buffer, lba, lba_count, cb_fn, cb_arg, io_flags);
 }
 
+int
+SpdkNvmeCaller::SpdkNvmeNsCmdReadv(
+    struct spdk_nvme_ns* ns,
+    struct spdk_nvme_qpair* qpair,
+    uint64_t lba,
+    uint32_t lba_count,
+    spdk_nvme_cmd_cb cb_fn,
+    void* cb_arg,
+    uint32_t io_flags,
+    spdk_nvme_req_reset_sgl_cb reset_sgl_fn,
+    spdk_nvme_req_next_sge_cb next_sge_fn)
+{
+    return spdk_nvme_ns_cmd_readv(
+        ns, qpair, lba, lba_count, cb_fn, cb_arg, io_flags, reset_sgl_fn, next_sge_fn);
+}
+
+int
+SpdkNvmeCaller::SpdkNvmeNsCmdWritev(
+    struct spdk_nvme_ns* ns,
+    struct spdk_nvme_qpair* qpair,
+    uint64_t lba,
+    uint32_t lba_count,
+    spdk_nvme_cmd_cb cb_fn,
+    void* cb_arg,
+    uint32_t io_flags,
+    spdk_nvme_req_reset_sgl_cb reset_sgl_fn,
+    spdk_nvme_req_next_sge_cb next_sge_fn)
+{
+    return spdk_nvme_ns_cmd_writev(
+        ns, qpair, lba, lba_count, cb_fn, cb_arg, io_flags, reset_sgl_fn, next_sge_fn);
+}
+
 int
 SpdkNvmeCaller::SpdkNvmeCtrlrCmdAbort(
     struct spdk_nvme_ctrlr* ctrlr,
@@ -185,6 +217,15 @@ SpdkNvmeCaller::SpdkNvmeCtrlrAllocIoQpair(
     return spdk_nvme_ctrlr_alloc_io_qpair(ctrlr, user_opts, opts_size);
 }
 
+void
+SpdkNvmeCaller::SpdkNvmeCtrlrGetDefaultIoQpairOpts(
+    struct spdk_nvme_ctrlr* ctrlr,
+    struct spdk_nvme_io_qpair_opts* opts,
+    size_t opts_size)
+{
+    spdk_nvme_ctrlr_get_default_io_qpair_opts(ctrlr, opts, opts_size);
+}
+
 int
 SpdkNvmeCaller::SpdkNvmeCtrlrFreeIoQpair(struct spdk_nvme_qpair* qpair)
 {
@@ -196,6 +237,13 @@ SpdkNvmeCaller::SpdkNvmeNsGetSectorSize(struct spdk_nvme_ns* ns)
 {
     return spdk_nvme_ns_get_sector_size(ns);
 }
+
+uint32_t
+SpdkNvmeCaller::SpdkNvmeNsGetMaxIoXferSize(struct spdk_nvme_ns* ns)
+{
+    return spdk_nvme_ns_get_max_io_xfer_size(ns);
+}
+
 const struct spdk_nvme_ctrlr_data*
 SpdkNvmeCaller::SpdkNvmeCtrlrGetData(struct spdk_nvme_ctrlr* ctrlr)
 {
@@ -207,3 +255,27 @@ SpdkNvmeCaller::SpdkNvmeCtrlrGetPciDevice(struct spdk_nvme_ctrlr* ctrlr)
 {
     return spdk_nvme_ctrlr_get_pci_device(ctrlr);
 }
+
+enum spdk_nvme_csi
+SpdkNvmeCaller::SpdkNvmeNsGetCsi(struct spdk_nvme_ns* ns)
+{
+    return spdk_nvme_ns_get_csi(ns);
+}
+
+uint64_t
+SpdkNvmeCaller::SpdkNvmeZnsNsGetZoneSize(struct spdk_nvme_ns* ns)
+{
+    return spdk_nvme_zns_ns_get_zone_size(ns);
+}
+
+uint64_t
+SpdkNvmeCaller::SpdkNvmeZnsNsGetNumZones(struct spdk_nvme_ns* ns)
+{
+    return spdk_nvme_zns_ns_get_num_zones(ns);
+}
+
+const struct spdk_nvme_ns_data*
+SpdkNvmeCaller::SpdkNvmeNsGetData(struct spdk_nvme_ns* ns)
+{
+    return spdk_nvme_ns_get_data(ns);
+}
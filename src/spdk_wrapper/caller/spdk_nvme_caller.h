@@ -35,6 +35,7 @@
 #include <cstdint>
 
 #include "spdk/nvme.h"
+#include "spdk/nvme_zns.h"
 
 namespace pos
 {
@@ -72,6 +73,26 @@ public:
         spdk_nvme_cmd_cb cb_fn,
         void* cb_arg,
         uint32_t io_flags);
+    virtual int SpdkNvmeNsCmdReadv(
+        struct spdk_nvme_ns* ns,
+        struct spdk_nvme_qpair* qpair,
+        uint64_t lba,
+        uint32_t lba_count,
+        spdk_nvme_cmd_cb cb_fn,
+        void* cb_arg,
+        uint32_t io_flags,
+        spdk_nvme_req_reset_sgl_cb reset_sgl_fn,
+        spdk_nvme_req_next_sge_cb next_sge_fn);
+    virtual int SpdkNvmeNsCmdWritev(
+        struct spdk_nvme_ns* ns,
+        struct spdk_nvme_qpair* qpair,
+        uint64_t lba,
+        uint32_t lba_count,
+        spdk_nvme_cmd_cb cb_fn,
+        void* cb_arg,
+        uint32_t io_flags,
+        spdk_nvme_req_reset_sgl_cb reset_sgl_fn,
+        spdk_nvme_req_next_sge_cb next_sge_fn);
     virtual int SpdkNvmeCtrlrCmdAbort(
         struct spdk_nvme_ctrlr* ctrlr,
         struct spdk_nvme_qpair* qpair,
@@ -112,12 +133,21 @@ public:
         struct spdk_nvme_ctrlr *ctrlr,
         const struct spdk_nvme_io_qpair_opts *user_opts,
         size_t opts_size);
+    virtual void SpdkNvmeCtrlrGetDefaultIoQpairOpts(
+        struct spdk_nvme_ctrlr* ctrlr,
+        struct spdk_nvme_io_qpair_opts* opts,
+        size_t opts_size);
     virtual int SpdkNvmeCtrlrFreeIoQpair(struct spdk_nvme_qpair* qpair);
     virtual uint32_t SpdkNvmeNsGetSectorSize(struct spdk_nvme_ns* ns);
+    virtual uint32_t SpdkNvmeNsGetMaxIoXferSize(struct spdk_nvme_ns* ns);
     virtual const struct spdk_nvme_ctrlr_data* SpdkNvmeCtrlrGetData(
         struct spdk_nvme_ctrlr* ctrlr);
     virtual struct spdk_pci_device* SpdkNvmeCtrlrGetPciDevice(
         struct spdk_nvme_ctrlr* ctrlr);
+    virtual enum spdk_nvme_csi SpdkNvmeNsGetCsi(struct spdk_nvme_ns* ns);
+    virtual uint64_t SpdkNvmeZnsNsGetZoneSize(struct spdk_nvme_ns* ns);
+    virtual uint64_t SpdkNvmeZnsNsGetNumZones(struct spdk_nvme_ns* ns);
+    virtual const struct spdk_nvme_ns_data* SpdkNvmeNsGetData(struct spdk_nvme_ns* ns);
 };
 
 } // namespace pos
@@ -156,4 +156,35 @@ SpdkNvmfCaller::SpdkNvmfSetUseEventReactor(cpu_set_t eventReactorSet)
     spdk_nvmf_set_use_event_reactor(eventReactorSet);
 }
 
+struct spdk_nvmf_subsystem_listener*
+SpdkNvmfCaller::SpdkNvmfSubsystemGetFirstListener(struct spdk_nvmf_subsystem* subsystem)
+{
+    return spdk_nvmf_subsystem_get_first_listener(subsystem);
+}
+
+struct spdk_nvmf_subsystem_listener*
+SpdkNvmfCaller::SpdkNvmfSubsystemGetNextListener(struct spdk_nvmf_subsystem* subsystem,
+    struct spdk_nvmf_subsystem_listener* prevListener)
+{
+    return spdk_nvmf_subsystem_get_next_listener(subsystem, prevListener);
+}
+
+const struct spdk_nvme_transport_id*
+SpdkNvmfCaller::SpdkNvmfSubsystemListenerGetTrid(struct spdk_nvmf_subsystem_listener* listener)
+{
+    return spdk_nvmf_subsystem_listener_get_trid(listener);
+}
+
+void
+SpdkNvmfCaller::SpdkNvmfSetListenerPollGroupHint(const char* trsvcid, const cpu_set_t* cores)
+{
+    spdk_nvmf_set_listener_poll_group_hint(trsvcid, cores);
+}
+
+void
+SpdkNvmfCaller::SpdkNvmfClearListenerPollGroupHint(const char* trsvcid)
+{
+    spdk_nvmf_clear_listener_poll_group_hint(trsvcid);
+}
+
 } // namespace pos
@@ -60,5 +60,11 @@ public:
     virtual uint32_t SpdkNvmfNsGetId(const struct spdk_nvmf_ns* ns);
     virtual void SpdkNvmfInitializeNumaAwarePollGroup(void);
     virtual void SpdkNvmfSetUseEventReactor(cpu_set_t eventReactorSet);
+    virtual struct spdk_nvmf_subsystem_listener* SpdkNvmfSubsystemGetFirstListener(struct spdk_nvmf_subsystem* subsystem);
+    virtual struct spdk_nvmf_subsystem_listener* SpdkNvmfSubsystemGetNextListener(struct spdk_nvmf_subsystem* subsystem,
+        struct spdk_nvmf_subsystem_listener* prevListener);
+    virtual const struct spdk_nvme_transport_id* SpdkNvmfSubsystemListenerGetTrid(struct spdk_nvmf_subsystem_listener* listener);
+    virtual void SpdkNvmfSetListenerPollGroupHint(const char* trsvcid, const cpu_set_t* cores);
+    virtual void SpdkNvmfClearListenerPollGroupHint(const char* trsvcid);
 };
 } // namespace pos
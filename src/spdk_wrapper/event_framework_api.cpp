@@ -62,9 +62,10 @@ EventFuncWrapper(void* ctx)
 }
 
 EventFrameworkApi::EventFrameworkApi(SpdkThreadCaller* spdkThreadCaller,
-    SpdkEnvCaller* spdkEnvCaller)
+    SpdkEnvCaller* spdkEnvCaller, ReactorCycleAccounting* cycleAccounting)
 : spdkThreadCaller(spdkThreadCaller),
-  spdkEnvCaller(spdkEnvCaller)
+  spdkEnvCaller(spdkEnvCaller),
+  cycleAccounting(cycleAccounting)
 {
     bool enable = false;
     int ret = ConfigManagerSingleton::Instance()->GetValue("performance",
@@ -162,6 +163,7 @@ EventFrameworkApi::CompleteEvents(void)
     }
 
     uint32_t core = GetCurrentReactor();
+    uint64_t startTick = cycleAccounting->GetTicks();
     EventQueue& eventQueue = eventQueues[core];
     uint32_t processedEvents = 0;
     EventArgument eventArgument;
@@ -178,6 +180,9 @@ EventFrameworkApi::CompleteEvents(void)
             break;
         }
     }
+    cycleAccounting->Add(core,
+        (processedEvents > 0) ? ReactorCycleType::ReactorEvent : ReactorCycleType::Idle,
+        cycleAccounting->GetTicks() - startTick);
     if (eventQueue.empty() == true)
     {
 	    return true;
@@ -197,6 +202,7 @@ EventFrameworkApi::CompleteSingleQueueEvents(void)
     {
         numaIndex = AffinityManagerSingleton::Instance()->GetNumaIdFromCurrentThread();
     }
+    uint64_t startTick = cycleAccounting->GetTicks();
     EventQueue& eventQueue = eventSingleQueue[numaIndex];
     uint32_t processedEvents = 0;
     EventArgument eventArgument;
@@ -213,6 +219,9 @@ EventFrameworkApi::CompleteSingleQueueEvents(void)
             break;
         }
     }
+    cycleAccounting->Add(GetCurrentReactor(),
+        (processedEvents > 0) ? ReactorCycleType::SharedEvent : ReactorCycleType::Idle,
+        cycleAccounting->GetTicks() - startTick);
     if (eventQueue.empty() == true)
     {
         return true;
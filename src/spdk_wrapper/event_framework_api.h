@@ -45,6 +45,7 @@
 #include "src/spdk_wrapper/caller/spdk_env_caller.h"
 #include "src/spdk_wrapper/caller/spdk_nvmf_caller.h"
 #include "src/spdk_wrapper/caller/spdk_thread_caller.h"
+#include "src/spdk_wrapper/reactor_cycle_accounting.h"
 #include "tbb/concurrent_queue.h"
 namespace pos
 {
@@ -65,7 +66,8 @@ class EventFrameworkApi
 {
 public:
     EventFrameworkApi(SpdkThreadCaller* spdkThreadCaller = new SpdkThreadCaller(),
-        SpdkEnvCaller* spdkEnvCaller = new SpdkEnvCaller());
+        SpdkEnvCaller* spdkEnvCaller = new SpdkEnvCaller(),
+        ReactorCycleAccounting* cycleAccounting = ReactorCycleAccountingSingleton::Instance());
     virtual ~EventFrameworkApi(void);
     virtual bool SendSpdkEvent(uint32_t core, EventFuncTwoParams func, void* arg1,
             void* arg2);
@@ -102,6 +104,7 @@ private:
 
     SpdkThreadCaller* spdkThreadCaller;
     SpdkEnvCaller* spdkEnvCaller;
+    ReactorCycleAccounting* cycleAccounting;
     void _SendEventToSpareQueue(uint32_t core, EventFuncOneParam func, void* arg1);
     void _SendEventToSingleQueue(EventFuncOneParam func, void* arg1);
     bool numaDedicatedSchedulingPolicy;
@@ -168,6 +168,53 @@ Nvme::GetRetryCount(RetryType retryType)
     return retryCount[static_cast<int>(retryType)];
 }
 
+bool
+Nvme::IsQpairPerTrafficClassEnabled(void)
+{
+    static bool enabled = _GetBoolConfig("qpair_per_traffic_class");
+    return enabled;
+}
+
+// Controllers are probed before _Initialize() is called, so that the
+// arbitration mechanism is read here on its own
+bool
+Nvme::IsWrrArbitrationEnabled(void)
+{
+    static bool enabled = _GetBoolConfig("wrr_arbitration_enable");
+    return enabled;
+}
+
+bool
+Nvme::_GetBoolConfig(const char* key)
+{
+    bool enabled = false;
+    if (false == GetConfig(key, &enabled, CONFIG_TYPE_BOOL))
+    {
+        return false;
+    }
+    return enabled;
+}
+
+// Returns false and leaves value untouched,
+// if the key is not found or the driver does not use the configuration
+bool
+Nvme::GetConfig(const char* key, void* value, ConfigType type)
+{
+    ConfigManager& configManager = *ConfigManagerSingleton::Instance();
+    std::string module("user_nvme_driver");
+
+    bool useConfig = false;
+    int ret = configManager.GetValue(module, "use_config", &useConfig,
+        CONFIG_TYPE_BOOL);
+    if (ret != EID(SUCCESS) || useConfig == false)
+    {
+        return false;
+    }
+
+    ret = configManager.GetValue(module, key, value, type);
+    return (ret == EID(SUCCESS));
+}
+
 void
 Nvme::Start(void)
 {
@@ -228,6 +275,11 @@ Nvme::_ProbeCallback(void* cbCtx,
     spdk_nvme_ctrlr_opts* opts)
 {
     POS_TRACE_INFO(EID(UNVME_PROBE_CALLBACK), "Probing {} ", trid->traddr);
+    // The controller fails to attach if it does not support weighted round robin
+    if (IsWrrArbitrationEnabled())
+    {
+        opts->arb_mechanism = SPDK_NVME_CC_AMS_WRR;
+    }
     return true;
 }
 
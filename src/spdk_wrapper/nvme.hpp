@@ -50,6 +50,7 @@
 #include "src/device/device_monitor.h"
 #include "src/lib/system_timeout_checker.h"
 #include "src/include/smart_ptr_type.h"
+#include "src/master_context/config_manager.h"
 
 using namespace std;
 
@@ -142,6 +143,9 @@ public:
     static void SpdkDetach(void* arg1);
     static void Cleanup(void* arg1);
     uint32_t GetRetryCount(RetryType retryType);
+    static bool IsQpairPerTrafficClassEnabled(void);
+    static bool IsWrrArbitrationEnabled(void);
+    static bool GetConfig(const char* key, void* value, ConfigType type);
     static void RegisterTimeoutHandlerFunc(TimeoutHandlerFunction timeoutAbortFunc,
         TimeoutHandlerFunction resetFunc);
     static void ControllerTimeoutCallback(void* cb_arg, struct spdk_nvme_ctrlr* ctrlr,
@@ -171,6 +175,7 @@ private:
     static TimeoutHandlerFunction resetHandler;
 
     static void _Initialize();
+    static bool _GetBoolConfig(const char* key);
 
     void _Monitoring();
     static SpdkAttachEvent attachCb;
@@ -0,0 +1,238 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/spdk_wrapper/reactor_cycle_accounting.h"
+
+#include <unistd.h>
+
+#include <chrono>
+#include <functional>
+
+#include "src/telemetry/telemetry_client/easy_telemetry_publisher.h"
+#include "src/telemetry/telemetry_id.h"
+
+namespace pos
+{
+uint64_t
+ReactorCycleBreakdown::GetTotal(void) const
+{
+    uint64_t total = 0;
+    for (int type = 0; type < (int)ReactorCycleType::Count; type++)
+    {
+        total += cycles[type];
+    }
+    return total;
+}
+
+ReactorCycleAccounting::ReactorCycleAccounting(SpdkEnvCaller* spdkEnvCaller)
+: lastCollected(MAX_REACTOR_COUNT),
+  spdkEnvCaller(spdkEnvCaller),
+  publisher(nullptr),
+  worker(nullptr),
+  isRunnable(false)
+{
+    for (uint32_t reactor = 0; reactor < MAX_REACTOR_COUNT; reactor++)
+    {
+        for (int type = 0; type < (int)ReactorCycleType::Count; type++)
+        {
+            slots[reactor].cycles[type] = 0;
+            lastCollected[reactor].cycles[type] = 0;
+        }
+        slots[reactor].lastExitTick = 0;
+        slots[reactor].nestedCycles = 0;
+        lastCollected[reactor].reactor = reactor;
+    }
+}
+
+ReactorCycleAccounting::~ReactorCycleAccounting(void)
+{
+    Dispose();
+    if (spdkEnvCaller != nullptr)
+    {
+        delete spdkEnvCaller;
+    }
+}
+
+void
+ReactorCycleAccounting::Initialize(EasyTelemetryPublisher* tp)
+{
+    publisher = tp;
+    if (worker == nullptr)
+    {
+        isRunnable = true;
+        worker = new std::thread(std::bind(&ReactorCycleAccounting::_PeriodicFlush, this));
+    }
+}
+
+void
+ReactorCycleAccounting::Dispose(void)
+{
+    if (worker != nullptr)
+    {
+        isRunnable = false;
+        worker->join();
+        delete worker;
+        worker = nullptr;
+    }
+}
+
+uint64_t
+ReactorCycleAccounting::GetTicks(void)
+{
+    return spdkEnvCaller->SpdkGetTicks();
+}
+
+uint64_t
+ReactorCycleAccounting::GetTicksHz(void)
+{
+    return spdkEnvCaller->SpdkGetTicksHz();
+}
+
+std::vector<ReactorCycleBreakdown>
+ReactorCycleAccounting::GetBreakdown(void)
+{
+    std::vector<ReactorCycleBreakdown> result;
+    for (uint32_t reactor = 0; reactor < MAX_REACTOR_COUNT; reactor++)
+    {
+        ReactorCycleBreakdown breakdown;
+        breakdown.reactor = reactor;
+        for (int type = 0; type < (int)ReactorCycleType::Count; type++)
+        {
+            breakdown.cycles[type] = slots[reactor].cycles[type].load(std::memory_order_relaxed);
+        }
+        if (breakdown.GetTotal() != 0)
+        {
+            result.push_back(breakdown);
+        }
+    }
+    return result;
+}
+
+std::vector<ReactorCycleBreakdown>
+ReactorCycleAccounting::GetIntervalBreakdown(void)
+{
+    std::lock_guard<std::mutex> lock(intervalLock);
+    return lastInterval;
+}
+
+void
+ReactorCycleAccounting::Flush(void)
+{
+    std::vector<ReactorCycleBreakdown> interval;
+    for (ReactorCycleBreakdown& current : GetBreakdown())
+    {
+        ReactorCycleBreakdown& last = lastCollected[current.reactor];
+        ReactorCycleBreakdown delta;
+        delta.reactor = current.reactor;
+        for (int type = 0; type < (int)ReactorCycleType::Count; type++)
+        {
+            delta.cycles[type] = current.cycles[type] - last.cycles[type];
+            last.cycles[type] = current.cycles[type];
+        }
+        interval.push_back(delta);
+    }
+
+    _Publish(interval);
+
+    std::lock_guard<std::mutex> lock(intervalLock);
+    lastInterval.swap(interval);
+}
+
+void
+ReactorCycleAccounting::_Publish(const std::vector<ReactorCycleBreakdown>& interval)
+{
+    if (publisher == nullptr)
+    {
+        return;
+    }
+
+    for (const ReactorCycleBreakdown& breakdown : interval)
+    {
+        uint64_t total = breakdown.GetTotal();
+        if (total == 0)
+        {
+            continue;
+        }
+        std::string reactor = std::to_string(breakdown.reactor);
+        for (int type = 0; type < (int)ReactorCycleType::Count; type++)
+        {
+            VectorLabels labels;
+            labels.push_back({"reactor", reactor});
+            labels.push_back({"type", GetTypeName((ReactorCycleType)type)});
+            publisher->UpdateGauge(TEL130024_REACTOR_CYCLES, breakdown.cycles[type], labels);
+        }
+        VectorLabels labels;
+        labels.push_back({"reactor", reactor});
+        uint64_t idle = breakdown.cycles[(int)ReactorCycleType::Idle];
+        publisher->UpdateGauge(TEL130025_REACTOR_BUSY_PERCENT, (total - idle) * 100 / total, labels);
+    }
+}
+
+void
+ReactorCycleAccounting::_PeriodicFlush(void)
+{
+    auto lastFlushed = std::chrono::steady_clock::now();
+    while (isRunnable)
+    {
+        auto now = std::chrono::steady_clock::now();
+        if (now - lastFlushed >= std::chrono::milliseconds(static_cast<uint32_t>(FLUSH_INTERVAL_IN_MS)))
+        {
+            lastFlushed = now;
+            Flush();
+        }
+        usleep(1000);
+    }
+}
+
+std::string
+ReactorCycleAccounting::GetTypeName(ReactorCycleType type)
+{
+    switch (type)
+    {
+        case ReactorCycleType::NvmfPoll:
+            return "nvmf_poll";
+        case ReactorCycleType::HostSubmission:
+            return "host_submission";
+        case ReactorCycleType::IoCompletion:
+            return "io_completion";
+        case ReactorCycleType::ReactorEvent:
+            return "reactor_event";
+        case ReactorCycleType::SharedEvent:
+            return "shared_event";
+        case ReactorCycleType::Idle:
+            return "idle";
+        default:
+            return "unknown";
+    }
+}
+
+} // namespace pos
@@ -0,0 +1,175 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "src/include/branch_prediction.h"
+#include "src/lib/singleton.h"
+#include "src/spdk_wrapper/caller/spdk_env_caller.h"
+
+namespace pos
+{
+class EasyTelemetryPublisher;
+
+enum class ReactorCycleType
+{
+    NvmfPoll,
+    HostSubmission,
+    IoCompletion,
+    ReactorEvent,
+    SharedEvent,
+    Idle,
+    Count
+};
+
+struct ReactorCycleBreakdown
+{
+    uint32_t reactor;
+    uint64_t cycles[(int)ReactorCycleType::Count];
+
+    uint64_t GetTotal(void) const;
+};
+
+// Accounts the TSC cycles each reactor spends per kind of work. POS only
+// runs inside its own poller and submission handler, so the cycles between
+// two runs of the poller, minus the submissions nested in them, are
+// accounted as NVMe-oF polling by spdk.
+class ReactorCycleAccounting
+{
+public:
+    explicit ReactorCycleAccounting(SpdkEnvCaller* spdkEnvCaller = new SpdkEnvCaller());
+    virtual ~ReactorCycleAccounting(void);
+
+    virtual void Initialize(EasyTelemetryPublisher* tp);
+    virtual void Dispose(void);
+
+    uint64_t GetTicks(void);
+    uint64_t GetTicksHz(void);
+
+    inline void
+    Add(uint32_t reactor, ReactorCycleType type, uint64_t cycles)
+    {
+        if (unlikely(reactor >= MAX_REACTOR_COUNT))
+        {
+            return;
+        }
+        // only the reactor itself writes its slot
+        std::atomic<uint64_t>& counter = slots[reactor].cycles[(int)type];
+        counter.store(counter.load(std::memory_order_relaxed) + cycles,
+            std::memory_order_relaxed);
+    }
+
+    // For the work running inside the cycles accounted as NVMe-oF polling
+    inline void
+    AddNested(uint32_t reactor, ReactorCycleType type, uint64_t cycles)
+    {
+        if (unlikely(reactor >= MAX_REACTOR_COUNT))
+        {
+            return;
+        }
+        Add(reactor, type, cycles);
+        slots[reactor].nestedCycles += cycles;
+    }
+
+    inline void
+    EnterPoller(uint32_t reactor, uint64_t tick)
+    {
+        if (unlikely(reactor >= MAX_REACTOR_COUNT))
+        {
+            return;
+        }
+        ReactorCycleSlot& slot = slots[reactor];
+        if (slot.lastExitTick != 0 && tick > slot.lastExitTick + slot.nestedCycles)
+        {
+            Add(reactor, ReactorCycleType::NvmfPoll,
+                tick - slot.lastExitTick - slot.nestedCycles);
+        }
+        slot.nestedCycles = 0;
+    }
+
+    inline void
+    ExitPoller(uint32_t reactor, uint64_t tick)
+    {
+        if (unlikely(reactor >= MAX_REACTOR_COUNT))
+        {
+            return;
+        }
+        slots[reactor].lastExitTick = tick;
+    }
+
+    // Cycles since the start, of reactors which have run the poller
+    virtual std::vector<ReactorCycleBreakdown> GetBreakdown(void);
+    // Cycles within the last publication interval
+    virtual std::vector<ReactorCycleBreakdown> GetIntervalBreakdown(void);
+    // Collects the cycles since the previous call and publishes them
+    virtual void Flush(void);
+
+    static std::string GetTypeName(ReactorCycleType type);
+
+    static const uint32_t MAX_REACTOR_COUNT = 256;
+
+private:
+    void _Publish(const std::vector<ReactorCycleBreakdown>& interval);
+    void _PeriodicFlush(void);
+
+    static const uint32_t FLUSH_INTERVAL_IN_MS = 1000;
+
+    // sized to two cache lines so that reactors do not share a written line
+    struct ReactorCycleSlot
+    {
+        std::atomic<uint64_t> cycles[(int)ReactorCycleType::Count];
+        uint64_t lastExitTick;
+        uint64_t nestedCycles;
+        char padding[64];
+    };
+
+    ReactorCycleSlot slots[MAX_REACTOR_COUNT];
+    std::vector<ReactorCycleBreakdown> lastCollected;
+    std::vector<ReactorCycleBreakdown> lastInterval;
+    std::mutex intervalLock;
+
+    SpdkEnvCaller* spdkEnvCaller;
+    EasyTelemetryPublisher* publisher;
+    std::thread* worker;
+    std::atomic<bool> isRunnable;
+};
+
+using ReactorCycleAccountingSingleton = Singleton<ReactorCycleAccounting>;
+
+} // namespace pos
@@ -32,6 +32,8 @@
 
 #include "src/sys_event/volume_event.h"
 
+#include "src/include/pos_event_id.h"
+
 namespace pos
 {
 VolumeEvent::VolumeEvent(std::string _tag, std::string _arrayName, int _arrayId)
@@ -73,6 +75,12 @@ VolumeEvent::SetVolumePerf(VolumeEventPerf* volEventPerf, uint64_t maxiops, uint
     volEventPerf->maxiops = maxiops;
 }
 
+int
+VolumeEvent::VolumeResized(VolumeEventBase* volEventBase, VolumeArrayInfo* volArrayInfo)
+{
+    return EID(VOL_EVENT_OK);
+}
+
 void
 VolumeEvent::SetVolumeArrayInfo(VolumeArrayInfo* volArrayInfo, int arrayId, string arrayName)
 {
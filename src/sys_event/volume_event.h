@@ -80,6 +80,8 @@ public:
     virtual int VolumeUnmounted(VolumeEventBase* volEventBase, VolumeArrayInfo* volArrayInfo) = 0;
     virtual int VolumeLoaded(VolumeEventBase* volEventBase, VolumeEventPerf* volEventPerf, VolumeArrayInfo* volArrayInfo) = 0;
     virtual int VolumeDetached(vector<int> volList, VolumeArrayInfo* volArrayInfo) = 0;
+    // Only the subscribers that size something by the volume need to handle a grow
+    virtual int VolumeResized(VolumeEventBase* volEventBase, VolumeArrayInfo* volArrayInfo);
 
 protected:
     string arrayName = "";
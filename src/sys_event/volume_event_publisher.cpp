@@ -303,4 +303,38 @@ VolumeEventPublisher::NotifyVolumeDetached(vector<int> volList, VolumeArrayInfo*
 
 }
 
+// Delivered in the order of a create, so that the network is the last to see the
+// new size. A subscriber that cannot grow stops the event before the host can
+// address blocks the layers below it do not have
+bool
+VolumeEventPublisher::NotifyVolumeResized(VolumeEventBase* volEventBase, VolumeArrayInfo* volArrayInfo)
+{
+    POS_TRACE_DEBUG(EID(VOLUME_EVENT),
+        "NotifyVolumeResized, # of subscribers: {}", subscribers.size());
+
+    for (auto it = subscribers.rbegin(); it != subscribers.rend(); ++it)
+    {
+        if (it->first == volArrayInfo->arrayId)
+        {
+            POS_TRACE_DEBUG(EID(VOLUME_EVENT),
+                "NotifyVolumeResized to {} : {} {} {}",
+                it->second->Tag(), volEventBase->volName, volEventBase->volId, volEventBase->volSizeByte);
+            int res = it->second->VolumeResized(volEventBase, volArrayInfo);
+            if (res != EID(VOL_EVENT_OK))
+            {
+                POS_TRACE_WARN(EID(VOLUME_EVENT),
+                    "Failure returned during volume event(RESIZE) notification to {}, res:{}",
+                    it->second->Tag(), res);
+                return false;
+            }
+
+            POS_TRACE_DEBUG(EID(VOLUME_EVENT),
+                "NotifyVolumeResized to {} done, res: {}",
+                it->second->Tag(), res);
+        }
+    }
+
+    return true;
+}
+
 } // namespace pos
@@ -60,6 +60,7 @@ public:
     virtual bool NotifyVolumeUnmounted(VolumeEventBase* volEventBase, VolumeArrayInfo* volArrayInfo);
     virtual bool NotifyVolumeLoaded(VolumeEventBase* volEventBase, VolumeEventPerf* volEventPerf, VolumeArrayInfo* volArrayInfo);
     virtual void NotifyVolumeDetached(vector<int> volList, VolumeArrayInfo* volArrayInfo);
+    virtual bool NotifyVolumeResized(VolumeEventBase* volEventBase, VolumeArrayInfo* volArrayInfo);
 
 private:
     vector<std::pair<int, VolumeEvent*>> subscribers;
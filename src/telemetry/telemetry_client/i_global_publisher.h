@@ -43,6 +43,7 @@ namespace pos
 class IGlobalPublisher
 {
 public:
+    virtual ~IGlobalPublisher(void) = default;
     virtual int PublishToServer(MetricLabelMap* defaultLabelList, POSMetricVector* metricList) = 0;
 };
 
@@ -0,0 +1,168 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/telemetry/telemetry_client/per_core_histogram.h"
+
+#include <cmath>
+
+namespace pos
+{
+PerCoreHistogram::PerCoreHistogram(void)
+: collected(NUM_BUCKETS, 0)
+{
+}
+
+PerCoreHistogram::~PerCoreHistogram(void)
+{
+}
+
+std::vector<uint64_t>
+PerCoreHistogram::Collect(void) const
+{
+    std::vector<uint64_t> result(NUM_BUCKETS, 0);
+    shards.ForEach([&result](const Shard& shard) { _AddShard(result, shard); });
+    return result;
+}
+
+std::vector<uint64_t>
+PerCoreHistogram::CollectInterval(void)
+{
+    std::vector<uint64_t> result = Collect();
+
+    // Counters are never reset, so that recording threads do not race with collection
+    for (uint32_t bucket = 0; bucket < NUM_BUCKETS; bucket++)
+    {
+        uint64_t total = result[bucket];
+        result[bucket] = total - collected[bucket];
+        collected[bucket] = total;
+    }
+    return result;
+}
+
+void
+PerCoreHistogram::Merge(std::vector<uint64_t>& counts, const std::vector<uint64_t>& other)
+{
+    if (counts.size() < other.size())
+    {
+        counts.resize(other.size(), 0);
+    }
+    for (uint32_t bucket = 0; bucket < other.size(); bucket++)
+    {
+        counts[bucket] += other[bucket];
+    }
+}
+
+std::vector<uint64_t>
+PerCoreHistogram::GetInterval(const std::vector<uint64_t>& from, const std::vector<uint64_t>& to)
+{
+    std::vector<uint64_t> result(to);
+    for (uint32_t bucket = 0; bucket < from.size() && bucket < result.size(); bucket++)
+    {
+        result[bucket] = (result[bucket] > from[bucket]) ? (result[bucket] - from[bucket]) : 0;
+    }
+    return result;
+}
+
+uint64_t
+PerCoreHistogram::GetPercentile(const std::vector<uint64_t>& counts, double ratio)
+{
+    uint64_t totalCount = GetTotalCount(counts);
+    if (totalCount == 0)
+    {
+        return 0;
+    }
+
+    uint64_t rank = static_cast<uint64_t>(std::ceil(totalCount * ratio));
+    if (rank == 0)
+    {
+        rank = 1;
+    }
+
+    uint64_t countSoFar = 0;
+    for (uint32_t bucket = 0; bucket < counts.size(); bucket++)
+    {
+        countSoFar += counts[bucket];
+        if (countSoFar >= rank)
+        {
+            return GetBucketUpperBound(bucket);
+        }
+    }
+    return GetBucketUpperBound(counts.size() - 1);
+}
+
+uint64_t
+PerCoreHistogram::GetMax(const std::vector<uint64_t>& counts)
+{
+    for (uint32_t bucket = counts.size(); bucket > 0; bucket--)
+    {
+        if (counts[bucket - 1] != 0)
+        {
+            return GetBucketUpperBound(bucket - 1);
+        }
+    }
+    return 0;
+}
+
+uint64_t
+PerCoreHistogram::GetTotalCount(const std::vector<uint64_t>& counts)
+{
+    uint64_t totalCount = 0;
+    for (auto count : counts)
+    {
+        totalCount += count;
+    }
+    return totalCount;
+}
+
+uint64_t
+PerCoreHistogram::GetBucketUpperBound(uint32_t bucketIndex)
+{
+    if (bucketIndex < NUM_SUB_BUCKETS)
+    {
+        return bucketIndex;
+    }
+
+    uint32_t shift = bucketIndex / NUM_SUB_BUCKETS - 1;
+    uint64_t subBucket = bucketIndex % NUM_SUB_BUCKETS;
+    return ((NUM_SUB_BUCKETS + subBucket + 1) << shift) - 1;
+}
+
+void
+PerCoreHistogram::_AddShard(std::vector<uint64_t>& counts, const Shard& shard)
+{
+    for (uint32_t bucket = 0; bucket < NUM_BUCKETS; bucket++)
+    {
+        counts[bucket] += shard.counts[bucket].load(std::memory_order_relaxed);
+    }
+}
+
+} // namespace pos
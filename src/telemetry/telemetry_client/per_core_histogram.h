@@ -0,0 +1,113 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "src/lib/per_thread_shards.h"
+
+namespace pos
+{
+// Log-linear histogram of latencies, in the manner of HdrHistogram.
+// Every power of two range is split into 8 buckets, so a value is reported within 12.5%.
+// Each recording thread counts in a PerThreadShards shard of its own, so that
+// Record() is a plain load and store on core-local lines without a lock or an
+// atomic read-modify-write.
+class PerCoreHistogram
+{
+public:
+    PerCoreHistogram(void);
+    virtual ~PerCoreHistogram(void);
+
+    inline void
+    Record(uint64_t value)
+    {
+        Shard* shard = shards.Get();
+        shards.Add(shard, shard->counts[GetBucketIndex(value)], static_cast<uint64_t>(1));
+    }
+
+    // Returns the counts per bucket recorded so far, merged over the shards
+    virtual std::vector<uint64_t> Collect(void) const;
+    // Returns the counts per bucket recorded since the previous call.
+    // Should not be called by several threads at once
+    virtual std::vector<uint64_t> CollectInterval(void);
+
+    static void Merge(std::vector<uint64_t>& counts, const std::vector<uint64_t>& other);
+    // Returns the counts recorded between two results of Collect(). An empty from is all zero
+    static std::vector<uint64_t> GetInterval(const std::vector<uint64_t>& from, const std::vector<uint64_t>& to);
+    static uint64_t GetPercentile(const std::vector<uint64_t>& counts, double ratio);
+    static uint64_t GetMax(const std::vector<uint64_t>& counts);
+    static uint64_t GetTotalCount(const std::vector<uint64_t>& counts);
+
+    static inline uint32_t
+    GetBucketIndex(uint64_t value)
+    {
+        if (value < NUM_SUB_BUCKETS)
+        {
+            return value;
+        }
+
+        uint32_t msb = 63 - __builtin_clzll(value);
+        if (msb >= MAX_VALUE_BITS)
+        {
+            return NUM_BUCKETS - 1;
+        }
+
+        uint32_t shift = msb - SUB_BUCKET_BITS;
+        uint32_t subBucket = (value >> shift) & (NUM_SUB_BUCKETS - 1);
+        return (shift + 1) * NUM_SUB_BUCKETS + subBucket;
+    }
+    static uint64_t GetBucketUpperBound(uint32_t bucketIndex);
+
+    static const uint32_t SUB_BUCKET_BITS = 3;
+    static const uint32_t NUM_SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    static const uint32_t MAX_VALUE_BITS = 40;
+    static const uint32_t NUM_BUCKETS = NUM_SUB_BUCKETS * (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1);
+
+    // Counts of one recording thread
+    struct Shard
+    {
+        std::atomic<uint64_t> counts[NUM_BUCKETS];
+    };
+    static const uint32_t MAX_WRITERS = PerThreadShards<Shard>::MAX_WRITERS;
+
+private:
+    static void _AddShard(std::vector<uint64_t>& counts, const Shard& shard);
+
+    PerThreadShards<Shard> shards;
+    std::vector<uint64_t> collected;
+};
+
+} // namespace pos
@@ -0,0 +1,279 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/telemetry/telemetry_client/shm_global_publisher.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cassert>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <map>
+
+#include "src/include/pos_event_id.h"
+#include "src/logger/logger.h"
+
+namespace pos
+{
+const char* ShmGlobalPublisher::DEFAULT_PATH = "/dev/shm/pos_telemetry";
+
+ShmGlobalPublisher::ShmGlobalPublisher(std::string path, uint32_t slotCount, IGlobalPublisher* fallback)
+: path(path),
+  slotCount(slotCount),
+  fallback(fallback),
+  fd(-1),
+  mappedSize(0),
+  header(nullptr),
+  slots(nullptr),
+  droppedCount(0)
+{
+    if (_Map() == true)
+    {
+        POS_TRACE_INFO(EID(TELEMETRY_SHM_EXPORT_ENABLED),
+            "path:{}, slot_count:{}, size:{}", path, slotCount, mappedSize);
+    }
+}
+
+ShmGlobalPublisher::~ShmGlobalPublisher(void)
+{
+    _Unmap();
+    delete fallback;
+}
+
+bool
+ShmGlobalPublisher::IsMapped(void)
+{
+    return header != nullptr;
+}
+
+bool
+ShmGlobalPublisher::_Map(void)
+{
+    size_t size = sizeof(ShmMetricTableHeader) + sizeof(ShmMetricSlot) * slotCount;
+    fd = open(path.c_str(), O_CREAT | O_RDWR, 0644);
+    if (fd < 0 || ftruncate(fd, size) != 0)
+    {
+        POS_TRACE_ERROR(EID(TELEMETRY_SHM_EXPORT_FAILED),
+            "path:{}, size:{}, errno:{}", path, size, errno);
+        _Unmap();
+        return false;
+    }
+    void* addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (addr == MAP_FAILED)
+    {
+        POS_TRACE_ERROR(EID(TELEMETRY_SHM_EXPORT_FAILED),
+            "path:{}, size:{}, errno:{}", path, size, errno);
+        _Unmap();
+        return false;
+    }
+    mappedSize = size;
+    header = static_cast<ShmMetricTableHeader*>(addr);
+    slots = reinterpret_cast<ShmMetricSlot*>(header + 1);
+
+    // a reader attached to the previous pos instance sees an invalid magic
+    // until the table is reset, then a new generation
+    header->magic = 0;
+    std::atomic_thread_fence(std::memory_order_release);
+    memset(static_cast<void*>(slots), 0, sizeof(ShmMetricSlot) * slotCount);
+    header->version = SHM_METRIC_TABLE_VERSION;
+    header->slotSize = sizeof(ShmMetricSlot);
+    header->slotCount = slotCount;
+    header->usedSlotCount.store(0, std::memory_order_relaxed);
+    header->generation = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    std::atomic_thread_fence(std::memory_order_release);
+    header->magic = SHM_METRIC_TABLE_MAGIC;
+    return true;
+}
+
+void
+ShmGlobalPublisher::_Unmap(void)
+{
+    if (header != nullptr)
+    {
+        munmap(header, mappedSize);
+        header = nullptr;
+        slots = nullptr;
+        mappedSize = 0;
+    }
+    if (fd >= 0)
+    {
+        close(fd);
+        fd = -1;
+    }
+}
+
+int
+ShmGlobalPublisher::PublishToServer(MetricLabelMap* defaultLabelList, POSMetricVector* metricList)
+{
+    assert(metricList != nullptr);
+    if (header == nullptr)
+    {
+        return (fallback != nullptr) ? fallback->PublishToServer(defaultLabelList, metricList) : -1;
+    }
+
+    POSMetricVector* rest = nullptr;
+    for (auto& metric : (*metricList))
+    {
+        POSMetricTypes type = metric.GetType();
+        ShmMetricSlot* slot = nullptr;
+        if (type == MT_COUNT || type == MT_GAUGE)
+        {
+            slot = _GetSlot(BuildKey(metric.GetName(), defaultLabelList, metric.GetLabelList()), type);
+        }
+        if (slot != nullptr)
+        {
+            uint64_t value = (type == MT_COUNT) ? metric.GetCountValue()
+                : static_cast<uint64_t>(metric.GetGaugeValue());
+            _UpdateSlot(slot, type, value);
+        }
+        else if (fallback != nullptr)
+        {
+            if (rest == nullptr)
+            {
+                rest = new POSMetricVector;
+            }
+            rest->push_back(metric);
+        }
+        else
+        {
+            _Drop(metric.GetName());
+        }
+    }
+
+    int ret = 0;
+    if (rest != nullptr)
+    {
+        ret = fallback->PublishToServer(defaultLabelList, rest);
+        delete rest;
+    }
+    return ret;
+}
+
+std::string
+ShmGlobalPublisher::BuildKey(const std::string& name, MetricLabelMap* defaultLabelList, MetricLabelMap* labelList)
+{
+    // labels are sorted so that every publish of a series lands in the same slot
+    std::map<std::string, std::string> sorted;
+    if (defaultLabelList != nullptr)
+    {
+        sorted.insert(defaultLabelList->begin(), defaultLabelList->end());
+    }
+    if (labelList != nullptr)
+    {
+        for (auto& label : (*labelList))
+        {
+            sorted[label.first] = label.second;
+        }
+    }
+    std::string key = name;
+    for (auto& label : sorted)
+    {
+        key += "\n" + label.first + "=" + label.second;
+    }
+    return key;
+}
+
+ShmMetricSlot*
+ShmGlobalPublisher::_GetSlot(const std::string& key, POSMetricTypes type)
+{
+    std::lock_guard<std::mutex> lock(slotLock);
+    auto it = slotMap.find(key);
+    if (it != slotMap.end())
+    {
+        return it->second;
+    }
+
+    uint32_t used = header->usedSlotCount.load(std::memory_order_relaxed);
+    if (used >= slotCount || key.size() > SHM_METRIC_KEY_CAPACITY)
+    {
+        return nullptr;
+    }
+    ShmMetricSlot* slot = &slots[used];
+    slot->type = static_cast<uint32_t>(type);
+    slot->keyLength = static_cast<uint16_t>(key.size());
+    memcpy(slot->key, key.data(), key.size());
+    header->usedSlotCount.store(used + 1, std::memory_order_release);
+    slotMap.emplace(key, slot);
+    return slot;
+}
+
+void
+ShmGlobalPublisher::_UpdateSlot(ShmMetricSlot* slot, POSMetricTypes type, uint64_t value)
+{
+    // writers of the same series are serialized by claiming an even sequence
+    uint32_t seq = slot->sequence.load(std::memory_order_relaxed);
+    while ((seq & 1) != 0 ||
+        slot->sequence.compare_exchange_weak(seq, seq + 1, std::memory_order_acquire) == false)
+    {
+        seq = slot->sequence.load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+
+    if (type == MT_COUNT)
+    {
+        value += slot->value.load(std::memory_order_relaxed);
+    }
+    slot->value.store(value, std::memory_order_relaxed);
+    slot->updateTimeNs.store(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count(), std::memory_order_relaxed);
+
+    slot->sequence.store(seq + 2, std::memory_order_release);
+}
+
+void
+ShmGlobalPublisher::_Drop(const std::string& name)
+{
+    if (droppedCount.fetch_add(1, std::memory_order_relaxed) == 0)
+    {
+        POS_TRACE_WARN(EID(TELEMETRY_SHM_METRIC_DROPPED),
+            "metric:{}, used_slots:{}, slot_count:{}",
+            name, header->usedSlotCount.load(std::memory_order_relaxed), slotCount);
+    }
+}
+
+uint32_t
+ShmGlobalPublisher::GetUsedSlotCount(void)
+{
+    return (header != nullptr) ? header->usedSlotCount.load(std::memory_order_acquire) : 0;
+}
+
+uint64_t
+ShmGlobalPublisher::GetDroppedCount(void)
+{
+    return droppedCount.load(std::memory_order_relaxed);
+}
+
+} // namespace pos
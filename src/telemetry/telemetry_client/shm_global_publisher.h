@@ -0,0 +1,121 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "src/telemetry/telemetry_client/i_global_publisher.h"
+
+namespace pos
+{
+// Layout of the metric table shared with tool/pos-exporter (shm_reader.go).
+// Any change here has to bump SHM_METRIC_TABLE_VERSION and be mirrored there.
+const uint64_t SHM_METRIC_TABLE_MAGIC = 0x4d4c4554534f50ULL; // "POSTELM"
+const uint32_t SHM_METRIC_TABLE_VERSION = 1;
+const uint32_t SHM_METRIC_KEY_CAPACITY = 230;
+
+struct ShmMetricTableHeader
+{
+    uint64_t magic;
+    uint32_t version;
+    uint32_t slotSize;
+    uint32_t slotCount;
+    std::atomic<uint32_t> usedSlotCount;
+    // changes on every pos start so that the reader can drop its counter baselines
+    uint64_t generation;
+    uint8_t reserved[32];
+};
+
+// A slot is claimed once and never moves; type and key are written before
+// usedSlotCount is released, so only value and updateTimeNs change afterwards.
+// sequence is odd while a writer is updating them (seqlock).
+struct ShmMetricSlot
+{
+    std::atomic<uint32_t> sequence;
+    uint32_t type;
+    std::atomic<uint64_t> value;
+    std::atomic<uint64_t> updateTimeNs;
+    uint16_t keyLength;
+    char key[SHM_METRIC_KEY_CAPACITY];
+};
+
+static_assert(sizeof(ShmMetricTableHeader) == 64, "shm metric table header is a fixed 64 byte layout");
+static_assert(sizeof(ShmMetricSlot) == 256, "shm metric slot is a fixed 256 byte layout");
+
+// Publishes metrics by updating a seqlock protected table in a shared memory
+// file instead of sending them over gRPC. pos-exporter maps the same file and
+// reads it at scrape time, so a publish costs a map lookup and a few stores.
+// Counters are accumulated in the slot (the reader turns them back into deltas)
+// and gauges are overwritten. Histograms and metrics that do not fit in the
+// table are handed to the fallback publisher, if any, which is owned by this
+// object.
+class ShmGlobalPublisher : public IGlobalPublisher
+{
+public:
+    static const char* DEFAULT_PATH;
+    static const uint32_t DEFAULT_SLOT_COUNT = 16384;
+
+    explicit ShmGlobalPublisher(std::string path = DEFAULT_PATH,
+        uint32_t slotCount = DEFAULT_SLOT_COUNT, IGlobalPublisher* fallback = nullptr);
+    virtual ~ShmGlobalPublisher(void);
+    virtual bool IsMapped(void);
+    virtual int PublishToServer(MetricLabelMap* defaultLabelList, POSMetricVector* metricList) override;
+    virtual uint32_t GetUsedSlotCount(void);
+    virtual uint64_t GetDroppedCount(void);
+
+    static std::string BuildKey(const std::string& name, MetricLabelMap* defaultLabelList, MetricLabelMap* labelList);
+
+private:
+    bool _Map(void);
+    void _Unmap(void);
+    ShmMetricSlot* _GetSlot(const std::string& key, POSMetricTypes type);
+    void _UpdateSlot(ShmMetricSlot* slot, POSMetricTypes type, uint64_t value);
+    void _Drop(const std::string& name);
+
+    std::string path;
+    uint32_t slotCount;
+    IGlobalPublisher* fallback;
+    int fd;
+    size_t mappedSize;
+    ShmMetricTableHeader* header;
+    ShmMetricSlot* slots;
+    std::mutex slotLock;
+    std::unordered_map<std::string, ShmMetricSlot*> slotMap;
+    std::atomic<uint64_t> droppedCount;
+};
+
+} // namespace pos
@@ -31,6 +31,7 @@
  */
 #include "src/include/pos_event_id.h"
 #include "src/logger/logger.h"
+#include "src/master_context/config_manager.h"
 #include "src/telemetry/telemetry_client/telemetry_client.h"
 
 #include <memory>
@@ -38,9 +39,9 @@
 namespace pos
 {
 
-TelemetryClient::TelemetryClient(std::shared_ptr<grpc::Channel> channel_)
+TelemetryClient::TelemetryClient(std::shared_ptr<grpc::Channel> channel_, ConfigManager* configManager)
 {
-    globalPublisher = new GrpcGlobalPublisher(channel_);
+    globalPublisher = _CreateGlobalPublisher(channel_, configManager);
     publisherId = 0;
     defaultEnable = false;
     isRunning = false;
@@ -56,6 +57,31 @@ TelemetryClient::~TelemetryClient(void)
     delete globalPublisher;
 }
 
+IGlobalPublisher*
+TelemetryClient::_CreateGlobalPublisher(std::shared_ptr<grpc::Channel> channel_, ConfigManager* configManager)
+{
+    if (configManager == nullptr)
+    {
+        configManager = ConfigManagerSingleton::Instance();
+    }
+    std::string exportMode = "grpc";
+    configManager->GetValue("telemetry", "export_mode", &exportMode, CONFIG_TYPE_STRING);
+    if (exportMode != "shm")
+    {
+        return new GrpcGlobalPublisher(channel_);
+    }
+
+    // histograms are still sent over gRPC
+    ShmGlobalPublisher* shmPublisher = new ShmGlobalPublisher(ShmGlobalPublisher::DEFAULT_PATH,
+        ShmGlobalPublisher::DEFAULT_SLOT_COUNT, new GrpcGlobalPublisher(channel_));
+    if (shmPublisher->IsMapped() == false)
+    {
+        delete shmPublisher;
+        return new GrpcGlobalPublisher(channel_);
+    }
+    return shmPublisher;
+}
+
 int
 TelemetryClient::RegisterPublisher(TelemetryPublisher* publisher)
 {
@@ -63,6 +89,7 @@ TelemetryClient::RegisterPublisher(TelemetryPublisher* publisher)
     std::string name = publisher->GetName();
     name = to_string(publisherId.fetch_add(1)) + name;
     publisher->SetName(name);
+    std::lock_guard<std::mutex> lock(publisherListLock);
     publisherList.emplace(name, publisher);
     publisher->SetGlobalPublisher(globalPublisher);
     if (defaultEnable == true)
@@ -77,6 +104,7 @@ TelemetryClient::RegisterPublisher(TelemetryPublisher* publisher)
 int
 TelemetryClient::DeregisterPublisher(std::string name)
 {
+    std::lock_guard<std::mutex> lock(publisherListLock);
     auto ret = publisherList.erase(name);
     if (ret == 0)
     {
@@ -32,22 +32,25 @@
 
 #pragma once
 #include "src/telemetry/telemetry_client/grpc_global_publisher.h"
+#include "src/telemetry/telemetry_client/shm_global_publisher.h"
 #include "src/telemetry/telemetry_client/telemetry_publisher.h"
 #include "src/telemetry/telemetry_config/telemetry_config.h"
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
 namespace pos
 {
 class GrpcGlobalPublisher;
+class ConfigManager;
 
 class TelemetryClient : public ConfigObserver
 {
 public:
-    explicit TelemetryClient(std::shared_ptr<grpc::Channel> channel_);
+    explicit TelemetryClient(std::shared_ptr<grpc::Channel> channel_, ConfigManager* configManager = nullptr);
     TelemetryClient(void);
     virtual ~TelemetryClient(void);
     virtual int RegisterPublisher(TelemetryPublisher* tp);
@@ -68,9 +71,13 @@ public:
     virtual bool IsRunning(void);
 
 private:
+    IGlobalPublisher* _CreateGlobalPublisher(std::shared_ptr<grpc::Channel> channel_, ConfigManager* configManager);
+
     std::string publicationListPath;
     std::map<std::string, TelemetryPublisher*> publisherList;
-    GrpcGlobalPublisher* globalPublisher;
+    // Components of a mounting array register their publishers in parallel
+    std::mutex publisherListLock;
+    IGlobalPublisher* globalPublisher;
     std::atomic<uint64_t> publisherId;
     bool defaultEnable;
     bool isRunning;
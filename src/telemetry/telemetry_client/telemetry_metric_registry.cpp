@@ -0,0 +1,315 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/telemetry/telemetry_client/telemetry_metric_registry.h"
+
+#include <unistd.h>
+
+#include <chrono>
+#include <functional>
+
+#include "src/include/pos_event_id.h"
+#include "src/logger/logger.h"
+#include "src/master_context/config_manager.h"
+#include "src/telemetry/telemetry_client/telemetry_client.h"
+
+namespace pos
+{
+TelemetryMetricRegistry::TelemetryMetricRegistry(TelemetryPublisher* tp)
+: DEFAULT_INTERVAL_IN_MILLISECOND(1000),
+  PUBLISHER_NAME("TelemetryMetricRegistry"),
+  publisher(tp),
+  isCreatedPublisher(false),
+  interval_in_millisecond(DEFAULT_INTERVAL_IN_MILLISECOND),
+  nextShard(0),
+  worker(nullptr),
+  isRunnable(false)
+{
+    for (uint32_t shard = 0; shard < MAX_METRIC_SHARDS; shard++)
+    {
+        for (uint32_t slot = 0; slot < MAX_METRIC_SLOTS; slot++)
+        {
+            counters[shard][slot] = 0;
+        }
+    }
+    for (uint32_t slot = 0; slot < MAX_METRIC_SLOTS; slot++)
+    {
+        gauges[slot] = 0;
+    }
+    // never reallocated, so the worker can walk it while others register
+    registered.reserve(MAX_METRIC_SLOTS);
+
+    if (!publisher)
+    {
+        isCreatedPublisher = true;
+        publisher = new TelemetryPublisher(PUBLISHER_NAME);
+        TelemetryClientSingleton::Instance()->RegisterPublisher(publisher);
+    }
+}
+
+TelemetryMetricRegistry::~TelemetryMetricRegistry(void)
+{
+    _StopWorker();
+
+    if (isCreatedPublisher)
+    {
+        isCreatedPublisher = false;
+        TelemetryClientSingleton::Instance()->DeregisterPublisher(PUBLISHER_NAME);
+        delete publisher;
+    }
+}
+
+void
+TelemetryMetricRegistry::Initialize(ConfigManager* config, const cpu_set_t& generalCpuSet)
+{
+    if (config != nullptr)
+    {
+        _UpdateInterval(config);
+    }
+    sched_setaffinity(0, sizeof(generalCpuSet), &generalCpuSet);
+    _RunWorker();
+
+    POS_TRACE_INFO(EID(SUCCESS),
+        "Telemetry metric registry is to publish {} metrics every {} ms, coreId:{}",
+        GetRegisteredCount(), interval_in_millisecond, sched_getcpu());
+}
+
+MetricHandle
+TelemetryMetricRegistry::RegisterCounter(const std::string& id)
+{
+    MetricLabels emptyLabels;
+    return _Register(id, POSMetricTypes::MT_COUNT, emptyLabels);
+}
+
+MetricHandle
+TelemetryMetricRegistry::RegisterCounter(const std::string& id, const MetricLabels& labels)
+{
+    return _Register(id, POSMetricTypes::MT_COUNT, labels);
+}
+
+MetricHandle
+TelemetryMetricRegistry::RegisterGauge(const std::string& id)
+{
+    MetricLabels emptyLabels;
+    return _Register(id, POSMetricTypes::MT_GAUGE, emptyLabels);
+}
+
+MetricHandle
+TelemetryMetricRegistry::RegisterGauge(const std::string& id, const MetricLabels& labels)
+{
+    return _Register(id, POSMetricTypes::MT_GAUGE, labels);
+}
+
+MetricHandle
+TelemetryMetricRegistry::_Register(const std::string& id, POSMetricTypes type,
+    const MetricLabels& labels)
+{
+    POSMetric metric(id, type);
+    for (auto& label : labels)
+    {
+        metric.AddLabel(label.first, label.second);
+    }
+
+    std::lock_guard<std::mutex> lock(registerLock);
+    size_t hashed = metric.Hash();
+    auto itor = handleMap.find(hashed);
+    if (itor != handleMap.end())
+    {
+        if (registered[itor->second].metric.GetType() != type)
+        {
+            POS_TRACE_WARN(EID(TELEMETRY_NOT_SUPPORT_TYPE),
+                "The metric {} has already been registered with another type", id);
+            return INVALID_METRIC_HANDLE;
+        }
+        return itor->second;
+    }
+
+    if (registered.size() >= MAX_METRIC_SLOTS)
+    {
+        POS_TRACE_WARN(EID(TELEMETRY_METRIC_REGISTRY_FULL),
+            "id:{}, max_metric_slots:{}", id, static_cast<uint32_t>(MAX_METRIC_SLOTS));
+        return INVALID_METRIC_HANDLE;
+    }
+
+    MetricHandle handle = static_cast<MetricHandle>(registered.size());
+    bool toPublish = (publisher != nullptr) && publisher->IsToPublish(id);
+    registered.push_back(RegisteredMetric{metric, toPublish, false, 0, 0});
+    handleMap.insert({hashed, handle});
+    return handle;
+}
+
+uint64_t
+TelemetryMetricRegistry::GetCounterValue(MetricHandle handle)
+{
+    if (handle >= MAX_METRIC_SLOTS)
+    {
+        return 0;
+    }
+
+    uint64_t sum = 0;
+    for (uint32_t shard = 0; shard < MAX_METRIC_SHARDS; shard++)
+    {
+        sum += counters[shard][handle].load(std::memory_order_relaxed);
+    }
+    return sum;
+}
+
+int64_t
+TelemetryMetricRegistry::GetGaugeValue(MetricHandle handle)
+{
+    if (handle >= MAX_METRIC_SLOTS)
+    {
+        return 0;
+    }
+    return gauges[handle].load(std::memory_order_relaxed);
+}
+
+uint32_t
+TelemetryMetricRegistry::GetRegisteredCount(void)
+{
+    std::lock_guard<std::mutex> lock(registerLock);
+    return static_cast<uint32_t>(registered.size());
+}
+
+POSMetricVector*
+TelemetryMetricRegistry::Collect(void)
+{
+    POSMetricVector* metricList = new POSMetricVector;
+
+    std::lock_guard<std::mutex> lock(registerLock);
+    metricList->reserve(registered.size());
+    for (MetricHandle handle = 0; handle < registered.size(); handle++)
+    {
+        RegisteredMetric& entry = registered[handle];
+        if (entry.toPublish == false)
+        {
+            continue;
+        }
+
+        if (entry.metric.GetType() == POSMetricTypes::MT_COUNT)
+        {
+            uint64_t count = GetCounterValue(handle);
+            if (entry.exported && count == entry.lastCount)
+            {
+                continue;
+            }
+            entry.lastCount = count;
+            entry.metric.SetCountValue(count);
+        }
+        else
+        {
+            int64_t gauge = GetGaugeValue(handle);
+            if (entry.exported && gauge == entry.lastGauge)
+            {
+                continue;
+            }
+            entry.lastGauge = gauge;
+            entry.metric.SetGaugeValue(gauge);
+        }
+        entry.exported = true;
+        metricList->push_back(entry.metric);
+    }
+
+    return metricList;
+}
+
+void
+TelemetryMetricRegistry::PublishAll(void)
+{
+    POSMetricVector* metricList = Collect();
+    if (metricList->size() > 0 && publisher != nullptr)
+    {
+        publisher->PublishMetricList(metricList);
+    }
+    else
+    {
+        delete metricList;
+    }
+}
+
+void
+TelemetryMetricRegistry::_RunWorker(void)
+{
+    if (worker != nullptr)
+    {
+        return;
+    }
+    isRunnable = true;
+    worker = new std::thread(std::bind(&TelemetryMetricRegistry::_PeriodicPublish, this));
+}
+
+void
+TelemetryMetricRegistry::_StopWorker(void)
+{
+    if (worker != nullptr)
+    {
+        isRunnable = false;
+        worker->join();
+        delete worker;
+        worker = nullptr;
+    }
+}
+
+void
+TelemetryMetricRegistry::_UpdateInterval(ConfigManager* config)
+{
+    uint32_t interval = 0;
+    std::string module = "telemetry";
+    std::string key = "interval_in_millisecond_for_easy_telemetry_publisher";
+
+    if (!config->GetValue(module, key, &interval, ConfigType::CONFIG_TYPE_UINT32) && interval > 0)
+    {
+        interval_in_millisecond = interval;
+    }
+    else
+    {
+        POS_TRACE_WARN(EID(TELEMETRY_INTERVAL_HAS_NOT_BEEN_LOADED), "The interval has not been loaded");
+    }
+}
+
+void
+TelemetryMetricRegistry::_PeriodicPublish(void)
+{
+    auto lastPublished = std::chrono::steady_clock::now();
+    while (isRunnable)
+    {
+        auto now = std::chrono::steady_clock::now();
+        if (now - lastPublished >= std::chrono::milliseconds(interval_in_millisecond))
+        {
+            lastPublished = now;
+            PublishAll();
+        }
+        usleep(1000);
+    }
+}
+
+} // namespace pos
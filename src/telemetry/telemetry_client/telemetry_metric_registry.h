@@ -0,0 +1,147 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <sched.h>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "src/lib/singleton.h"
+#include "src/telemetry/telemetry_client/pos_metric.h"
+#include "src/telemetry/telemetry_client/telemetry_publisher.h"
+
+namespace pos
+{
+class ConfigManager;
+
+using MetricHandle = uint32_t;
+using MetricLabels = std::vector<std::pair<std::string, std::string>>;
+
+// Interns metric ids (and their labels) to integer handles once at
+// registration, so that hot paths can update a metric by handle without
+// building strings or allocating. Counters are sharded per thread to keep
+// the update a relaxed atomic add on a mostly core-local cache line; a
+// worker sums the shards and publishes every registered metric in one list.
+class TelemetryMetricRegistry
+{
+public:
+    explicit TelemetryMetricRegistry(TelemetryPublisher* tp = nullptr);
+    virtual ~TelemetryMetricRegistry(void);
+
+    virtual void Initialize(ConfigManager* config, const cpu_set_t& generalCpuSet);
+
+    virtual MetricHandle RegisterCounter(const std::string& id);
+    virtual MetricHandle RegisterCounter(const std::string& id, const MetricLabels& labels);
+    virtual MetricHandle RegisterGauge(const std::string& id);
+    virtual MetricHandle RegisterGauge(const std::string& id, const MetricLabels& labels);
+
+    inline void
+    Add(MetricHandle handle, uint64_t value = 1)
+    {
+        if (handle < MAX_METRIC_SLOTS)
+        {
+            counters[_GetShard()][handle].fetch_add(value, std::memory_order_relaxed);
+        }
+    }
+
+    inline void
+    Set(MetricHandle handle, int64_t value)
+    {
+        if (handle < MAX_METRIC_SLOTS)
+        {
+            gauges[handle].store(value, std::memory_order_relaxed);
+        }
+    }
+
+    uint64_t GetCounterValue(MetricHandle handle);
+    int64_t GetGaugeValue(MetricHandle handle);
+    uint32_t GetRegisteredCount(void);
+
+    // builds one list out of the metrics changed since the last call
+    virtual POSMetricVector* Collect(void);
+    virtual void PublishAll(void);
+
+    static const MetricHandle INVALID_METRIC_HANDLE = UINT32_MAX;
+    static const uint32_t MAX_METRIC_SLOTS = 256;
+    static const uint32_t MAX_METRIC_SHARDS = 64;
+
+private:
+    struct RegisteredMetric
+    {
+        POSMetric metric;
+        bool toPublish;
+        bool exported;
+        uint64_t lastCount;
+        int64_t lastGauge;
+    };
+
+    MetricHandle _Register(const std::string& id, POSMetricTypes type,
+        const MetricLabels& labels);
+    void _PeriodicPublish(void);
+    void _RunWorker(void);
+    void _StopWorker(void);
+    void _UpdateInterval(ConfigManager* config);
+
+    inline uint32_t
+    _GetShard(void)
+    {
+        static thread_local uint32_t shard = nextShard.fetch_add(1, std::memory_order_relaxed) % MAX_METRIC_SHARDS;
+        return shard;
+    }
+
+    const uint32_t DEFAULT_INTERVAL_IN_MILLISECOND;
+    const std::string PUBLISHER_NAME;
+    TelemetryPublisher* publisher;
+    bool isCreatedPublisher;
+    uint32_t interval_in_millisecond;
+
+    std::atomic<uint64_t> counters[MAX_METRIC_SHARDS][MAX_METRIC_SLOTS];
+    std::atomic<int64_t> gauges[MAX_METRIC_SLOTS];
+    std::atomic<uint32_t> nextShard;
+
+    std::vector<RegisteredMetric> registered;
+    std::unordered_map<size_t, MetricHandle> handleMap;
+    std::mutex registerLock;
+
+    std::thread* worker;
+    std::atomic<bool> isRunnable;
+};
+
+using TelemetryMetricRegistrySingleton = Singleton<TelemetryMetricRegistry>;
+
+} // namespace pos
@@ -182,6 +182,46 @@ TelemetryPublisher::PublishMetricList(POSMetricVector* metricList)
     return ret;
 }
 
+int
+TelemetryPublisher::PublishHistogram(std::string id, PerCoreHistogram* histogram,
+    const MetricLabelMap& labels)
+{
+    if ((turnOn == false) || (_ShouldPublish(id) == false))
+    {
+        return -1;
+    }
+
+    std::vector<uint64_t> counts = histogram->CollectInterval();
+    if (PerCoreHistogram::GetTotalCount(counts) == 0)
+    {
+        return -1;
+    }
+
+    const std::vector<std::pair<std::string, double>> quantiles = {
+        {"0.5", 0.5}, {"0.99", 0.99}, {"0.999", 0.999}};
+    POSMetricVector* metricList = AllocatePOSMetricVector();
+    for (auto& quantile : quantiles)
+    {
+        POSMetric metric(id, MT_GAUGE);
+        metric.SetGaugeValue(PerCoreHistogram::GetPercentile(counts, quantile.second));
+        metric.AddLabel("quantile", quantile.first);
+        metricList->push_back(metric);
+    }
+    POSMetric max(id, MT_GAUGE);
+    max.SetGaugeValue(PerCoreHistogram::GetMax(counts));
+    max.AddLabel("quantile", "1");
+    metricList->push_back(max);
+
+    for (auto& metric : *metricList)
+    {
+        for (auto& label : labels)
+        {
+            metric.AddLabel(label.first, label.second);
+        }
+    }
+    return PublishMetricList(metricList);
+}
+
 void
 TelemetryPublisher::SetGlobalPublisher(IGlobalPublisher* gp)
 {
@@ -252,6 +292,12 @@ TelemetryPublisher::_RemoveMetricNotToPublish(POSMetricVector* metricList)
     }
 }
 
+bool
+TelemetryPublisher::IsToPublish(std::string metricId)
+{
+    return _ShouldPublish(metricId);
+}
+
 bool
 TelemetryPublisher::_ShouldPublish(std::string metricId)
 {
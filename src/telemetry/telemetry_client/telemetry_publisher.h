@@ -34,6 +34,7 @@
 
 #include <list>
 #include "src/telemetry/telemetry_client/i_global_publisher.h"
+#include "src/telemetry/telemetry_client/per_core_histogram.h"
 #include "src/telemetry/telemetry_client/telemetry_data_pool.h"
 #include <string>
 #include <vector>
@@ -63,10 +64,15 @@ public:
     virtual int PublishData(std::string id_, POSMetricValue value_, POSMetricTypes type_);
     virtual int PublishMetric(POSMetric metric);
     virtual int PublishMetricList(std::vector<POSMetric>* metricList);
+    // Publishes the percentiles of the values recorded since the previous call,
+    // as gauges of the id labelled with "quantile" ("1" for the max)
+    virtual int PublishHistogram(std::string id, PerCoreHistogram* histogram,
+        const MetricLabelMap& labels = MetricLabelMap());
     virtual POSMetricVector* AllocatePOSMetricVector(void);
     virtual void SetGlobalPublisher(IGlobalPublisher* gp);
     virtual int AddDefaultLabel(std::string key, std::string value);
     void LoadPublicationList(std::string filePath);
+    virtual bool IsToPublish(std::string metricId);
 
 private:
     const std::string PUBLICATION_LIST_ROOT = "metrics_to_publish";
@@ -52,10 +52,10 @@ static const std::string TEL30000_ALCT_FREE_SEG_CNT = "alct_free_seg_cnt";
 static const std::string TEL30001_ALCT_ALCTX_PENDINGIO_CNT = "alct_allocctx_pendio_cnt";
 static const std::string TEL30002_ALCT_GCVICTIM_SEG = "alct_gcvictim_segid";
 static const std::string TEL30003_ALCT_GCMODE = "alct_gcmode";
-static const std::string TEL30004_ALCT_RSV = "rsv";
-static const std::string TEL30005_ALCT_RSV = "rsv";
-static const std::string TEL30006_ALCT_RSV = "rsv";
-static const std::string TEL30007_ALCT_RSV = "rsv";
+static const std::string TEL30004_ALCT_HOST_STRIPE_CNT = "alct_host_stripe_cnt";
+static const std::string TEL30005_ALCT_GC_STRIPE_CNT = "alct_gc_stripe_cnt";
+static const std::string TEL30006_ALCT_WRITE_AMPLIFICATION = "alct_write_amplification_x100";
+static const std::string TEL30007_ALCT_TRIM_PENDING_SEG_CNT = "alct_trim_pending_seg_cnt";
 static const std::string TEL30008_ALCT_RSV = "rsv";
 static const std::string TEL30009_ALCT_RSV = "rsv";
 static const std::string TEL30010_ALCT_VICTIM_SEG_INVALID_PAGE_CNT = "alct_victim_invalidpg_cnt";
@@ -74,6 +74,11 @@ static const std::string TEL33009_MAP_STRIPE_FLUSH_PENDINGIO_CNT = "map_stripe_f
 static const std::string TEL33010_MAP_VSA_FLUSHED_DIRTYPAGE_CNT = "map_vsa_flushed_dirtypg_cnt";
 static const std::string TEL33011_MAP_REVERSE_FLUSH_IO_ISSUED_CNT = "map_reverse_flush_io_issued_cnt";
 static const std::string TEL33012_MAP_REVERSE_FLUSH_IO_DONE_CNT = "map_reverse_flush_io_done_cnt";
+static const std::string TEL33013_MAP_VSA_COMPRESSED_MPAGE_CNT = "map_vsa_compressed_mpage_cnt";
+static const std::string TEL33014_MAP_VSA_COMPRESSION_RATIO = "map_vsa_compression_ratio";
+static const std::string TEL33015_MAP_VSA_MPAGE_DECODE_TIME_AVG_NS = "map_vsa_mpage_decode_time_avg_ns";
+static const std::string TEL33016_MAP_REVERSE_CACHE_HIT_RATE = "map_reverse_cache_hit_rate";
+static const std::string TEL33017_MAP_REVERSE_IO_BYTES_SAVED = "map_reverse_io_bytes_saved";
 
 static const std::string TEL36000_JRN_ = "j_test";
 static const std::string TEL36001_JRN_CHECKPOINT = "jrn_checkpoint";
@@ -84,6 +89,10 @@ static const std::string TEL36005_JRN_LOG_COUNT = "jrn_log_count";
 static const std::string TEL36006_JRN_LOG_DONE_COUNT = "jrn_log_done_count";
 static const std::string TEL36007_JRN_LOG_WRITE_TIME_AVERAGE = "jrn_log_write_time_average";
 static const std::string TEL36008_JRN_REPLAY_WORKING_TIME = "jrn_replay_working_time";
+static const std::string TEL36009_JRN_LOG_WRITE_LATENCY_P50 = "jrn_log_write_latency_p50";
+static const std::string TEL36010_JRN_LOG_WRITE_LATENCY_P99 = "jrn_log_write_latency_p99";
+static const std::string TEL36011_JRN_LOG_WRITE_LATENCY_P999 = "jrn_log_write_latency_p999";
+static const std::string TEL36012_JRN_LOG_WRITE_LATENCY_MAX = "jrn_log_write_latency_max";
 static const std::string TEL39999_JRN_ = "j_test_end";
 
 static const std::string TEL40000_METAFS_NORMAL_SHUTDOWN = "normal_shutdown_npor";
@@ -113,6 +122,9 @@ static const std::string TEL40305_METAFS_MPIO_SAMPLED_COUNT = "sampled_mpio_coun
 static const std::string TEL40306_METAFS_CACHED_MPIO_COUNT = "cached_mpio_count";
 static const std::string TEL40307_METAFS_MPIO_WRITE_TYPE_COUNT = "mpio_write_type_count";
 static const std::string TEL40308_METAFS_MPIO_TOTAL_IO_COUNT = "mpio_total_io_count";
+static const std::string TEL40309_METAFS_MPIO_EXHAUSTED_COUNT = "mpio_exhausted_count";
+static const std::string TEL40310_METAFS_MPIO_CACHE_HIT_COUNT = "mpio_cache_hit_count";
+static const std::string TEL40311_METAFS_MPIO_CACHE_MISS_COUNT = "mpio_cache_miss_count";
 
 static const std::string TEL50000_READ_IOPS_VOLUME = "read_iops_volume";
 static const std::string TEL50001_READ_BPS_VOLUME = "read_bps_volume";
@@ -123,12 +135,22 @@ static const std::string TEL50012_WRITE_AVG_LAT_VOLUME = "write_avg_lat_volume";
 static const std::string TEL50020_VOL_VOLUME_STATE = "volume_state";
 static const std::string TEL50021_VOL_VOLUME_TOTAL_CAPACITY= "volume_capacity_total";
 static const std::string TEL50022_VOL_VOLUME_USED_CAPACITY = "volume_capacity_used";
+static const std::string TEL50023_VOL_VOLUME_COMPRESSION_RATIO = "volume_compression_ratio";
+static const std::string TEL50024_VOL_VOLUME_DUPLICATE_RATIO = "volume_duplicate_ratio";
+static const std::string TEL50025_VOL_ACCESS_HEATMAP_READ = "volume_access_heatmap_read";
+static const std::string TEL50026_VOL_ACCESS_HEATMAP_WRITE = "volume_access_heatmap_write";
 
 static const std::string TEL60001_ARRAY_STATUS = "array_status";
 static const std::string TEL60002_ARRAY_USAGE_BLK_CNT = "array_usage_blk_cnt";
 static const std::string TEL60003_VOL_USAGE_BLK_CNT = "volume_usage_blk_cnt";
 static const std::string TEL60004_ARRAY_CAPACITY_TOTAL = "array_capacity_total";
 static const std::string TEL60005_ARRAY_CAPACITY_USED = "array_capacity_used";
+static const std::string TEL60006_ARRAY_RAID6_DECODING_TABLE_HIT_CNT = "array_raid6_decoding_table_hit_cnt";
+static const std::string TEL60007_ARRAY_RAID6_DECODING_TABLE_MISS_CNT = "array_raid6_decoding_table_miss_cnt";
+static const std::string TEL60008_ARRAY_WRITTEN_BYTES = "array_written_bytes";
+static const std::string TEL60009_ARRAY_WRITE_AMPLIFICATION = "array_write_amplification_x100";
+static const std::string TEL60010_ARRAY_GC_EFFICIENCY = "array_gc_efficiency_percent";
+static const std::string TEL60011_ARRAY_MOUNT_PHASE_TIME_US = "array_mount_phase_time_us";
 
 static const std::string TEL70000_READ_IOPS_NETWORK = "read_iops_network";
 static const std::string TEL70001_READ_BPS_NETWORK = "read_bps_network";
@@ -144,6 +166,9 @@ static const std::string TEL90003_GC_STRIPE_COUNT_FLUSH_COMPLETED  = "gc_stripe_
 static const std::string TEL90004_GC_STRIPE_COUNT_MAP_UPDATE_REQUESTED  = "gc_stripe_count_map_update_requested";
 static const std::string TEL90005_GC_STRIPE_COUNT_MAP_UPDATE_COMPLETED  = "gc_stripe_count_map_update_completed";
 static const std::string TEL90006_GC_STRIPE_COUNT_FORCE_FLUSH_REQUESTED  = "gc_stripe_count_force_flush_requested";
+static const std::string TEL90007_FLOW_CONTROL_USER_TOKEN = "flow_control_user_token";
+static const std::string TEL90008_FLOW_CONTROL_GC_TOKEN = "flow_control_gc_token";
+static const std::string TEL90009_FLOW_CONTROL_REJECTED_COUNT = "flow_control_rejected_count";
 
 static const std::string TEL100000_RESOURCE_CHECKER_AVAILABLE_MEMORY = "available_memory_size";
 
@@ -182,6 +207,14 @@ static const std::string TEL120001_FEQOS_DYNAMIC_BW = "feqos_dynamic_bw_throttli
 static const std::string TEL120002_FEQOS_GLOBAL_IOPS = "feqos_global_iops_throttling";
 static const std::string TEL120003_FEQOS_DYNAMIC_BW = "feqos_dynamic_iops_throttling";
 static const std::string TEL120004_FEQOS_VOLUME_Q_BW = "feqos_volume_queue_count";
+static const std::string TEL120005_FEQOS_VOLUME_MEASURED_BW = "feqos_volume_measured_bw";
+static const std::string TEL120006_FEQOS_VOLUME_MEASURED_IOPS = "feqos_volume_measured_iops";
+static const std::string TEL120007_FEQOS_VOLUME_LIMIT_BW = "feqos_volume_limit_bw";
+static const std::string TEL120008_FEQOS_VOLUME_LIMIT_IOPS = "feqos_volume_limit_iops";
+static const std::string TEL120009_FEQOS_REACTOR_MEASURED_BW = "feqos_reactor_measured_bw";
+static const std::string TEL120010_FEQOS_REACTOR_MEASURED_IOPS = "feqos_reactor_measured_iops";
+static const std::string TEL120011_FEQOS_EVENT_WRR_WEIGHT = "feqos_event_wrr_weight";
+static const std::string TEL120012_FEQOS_EVENT_WRR_CORRECTION = "feqos_event_wrr_correction";
 
 static const std::string TEL130000_COUNT_OF_UBIO_CONSTRUCTORS = "count_of_ubio_constructors";
 static const std::string TEL130001_COUNT_OF_UBIO_DESTRUCTORS = "count_of_ubio_destructors";
@@ -199,6 +232,22 @@ static const std::string TEL130012_EVENT_PENDING_Q_AVG = "pending_avg_qd_in_even
 static const std::string TEL130013_EVENT_PENDING_Q_MAX = "pending_max_qd_in_event_queue";
 static const std::string TEL130014_READ_MAX_LAT_VOLUME = "read_max_lat_volume";
 static const std::string TEL130015_WRITE_MAX_LAT_VOLUME = "write_max_lat_volume";
+static const std::string TEL130016_COUNT_OF_COALESCED_UBIO = "coalesced_ubio_count";
+static const std::string TEL130017_COUNT_OF_COALESCED_COMMAND = "coalesced_command_count";
+static const std::string TEL130018_POLLER_SLEEP_TIME_US = "poller_sleep_time_us";
+static const std::string TEL130019_POLLER_SLEEP_INTERVAL_US = "poller_sleep_interval_us";
+static const std::string TEL130020_WRITE_STAGE_LATENCY_P50 = "write_stage_latency_p50";
+static const std::string TEL130021_WRITE_STAGE_LATENCY_P99 = "write_stage_latency_p99";
+static const std::string TEL130022_WRITE_STAGE_LATENCY_P999 = "write_stage_latency_p999";
+static const std::string TEL130023_WRITE_STAGE_LATENCY_MAX = "write_stage_latency_max";
+static const std::string TEL130024_REACTOR_CYCLES = "reactor_cycles";
+static const std::string TEL130025_REACTOR_BUSY_PERCENT = "reactor_busy_percent";
+static const std::string TEL130026_EVENT_WAIT_TIME_US_P50 = "event_wait_time_us_p50";
+static const std::string TEL130027_EVENT_WAIT_TIME_US_P99 = "event_wait_time_us_p99";
+static const std::string TEL130028_EVENT_WAIT_TIME_US_P999 = "event_wait_time_us_p999";
+static const std::string TEL130029_EVENT_WAIT_TIME_US_MAX = "event_wait_time_us_max";
+static const std::string TEL130030_EVENT_QUEUE_DEPTH = "event_queue_depth";
+static const std::string TEL130031_EVENT_WORKER_BUSY_PERCENT = "event_worker_busy_percent";
 
 static const std::string TEL140000_COUNT_OF_REQUSTED_USER_READ = "count_of_requested_user_read";
 static const std::string TEL140001_COUNT_OF_REQUSTED_USER_WRITE = "count_of_requested_user_write";
@@ -0,0 +1,227 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/trace/flight_recorder.h"
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+#include "src/include/pos_event_id.h"
+#include "src/logger/logger.h"
+#include "src/master_context/config_manager.h"
+
+namespace pos
+{
+const char* FlightRecorder::DEFAULT_DUMP_DIR = "/var/log/pos/";
+
+FlightRecorder::FlightRecorder(uint32_t ringCount, uint32_t eventsPerRing)
+: enabled(true),
+  ringCount(ringCount),
+  eventsPerRing(1),
+  eventMask(0),
+  rings(nullptr),
+  eventBuffer(nullptr),
+  lastTimeoutDumpNs(0)
+{
+    if (this->ringCount == 0)
+    {
+        long cpuCount = sysconf(_SC_NPROCESSORS_CONF);
+        this->ringCount = (cpuCount > 0) ? static_cast<uint32_t>(cpuCount) : 1;
+    }
+    // a power of two so that the ring index is a mask
+    while (this->eventsPerRing < eventsPerRing)
+    {
+        this->eventsPerRing <<= 1;
+    }
+    eventMask = this->eventsPerRing - 1;
+
+    eventBuffer = new FlightEvent[static_cast<uint64_t>(this->ringCount) * this->eventsPerRing];
+    memset(eventBuffer, 0, sizeof(FlightEvent) * this->ringCount * this->eventsPerRing);
+    rings = new FlightRecorderRing[this->ringCount];
+    for (uint32_t index = 0; index < this->ringCount; index++)
+    {
+        rings[index].head = 0;
+        rings[index].events = &eventBuffer[static_cast<uint64_t>(index) * this->eventsPerRing];
+    }
+}
+
+FlightRecorder::~FlightRecorder(void)
+{
+    delete[] rings;
+    delete[] eventBuffer;
+}
+
+void
+FlightRecorder::Initialize(ConfigManager* config)
+{
+    bool enable = true;
+    if (config->GetValue("debug", "flight_recorder", &enable, CONFIG_TYPE_BOOL) != 0)
+    {
+        enable = true;
+    }
+    SetEnabled(enable);
+}
+
+int64_t
+FlightRecorder::Dump(std::string path)
+{
+    FILE* file = fopen(path.c_str(), "wb");
+    if (file == nullptr)
+    {
+        POS_TRACE_ERROR(EID(FLIGHT_RECORDER_DUMP_FAILED), "path:{}, errno:{}", path, errno);
+        return -1;
+    }
+
+    FlightRecorderDumpHeader header;
+    header.magic = DUMP_MAGIC;
+    header.version = DUMP_VERSION;
+    header.eventSize = sizeof(FlightEvent);
+    header.ringCount = ringCount;
+    header.eventsPerRing = eventsPerRing;
+    header.steadyTimeNs = GetTime();
+    header.wallClockTimeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    bool success = (fwrite(&header, sizeof(header), 1, file) == 1);
+
+    int64_t written = 0;
+    FlightEvent* snapshot = new FlightEvent[eventsPerRing];
+    for (uint32_t index = 0; index < ringCount && success == true; index++)
+    {
+        // copy out the ring first, oldest event first, so the writers are not held back by file I/O
+        uint64_t head = rings[index].head.load(std::memory_order_acquire);
+        uint32_t count = (head < eventsPerRing) ? static_cast<uint32_t>(head) : eventsPerRing;
+        for (uint32_t offset = 0; offset < count; offset++)
+        {
+            snapshot[offset] = rings[index].events[(head - count + offset) & eventMask];
+        }
+        uint32_t ringHeader[2] = {index, count};
+        success = (fwrite(ringHeader, sizeof(ringHeader), 1, file) == 1) &&
+            (count == 0 || fwrite(snapshot, sizeof(FlightEvent), count, file) == count);
+        written += count;
+    }
+    delete[] snapshot;
+
+    if (fclose(file) != 0 || success == false)
+    {
+        POS_TRACE_ERROR(EID(FLIGHT_RECORDER_DUMP_FAILED), "path:{}, errno:{}", path, errno);
+        return -1;
+    }
+    POS_TRACE_INFO(EID(FLIGHT_RECORDER_DUMPED), "path:{}, num_events:{}", path, written);
+    return written;
+}
+
+std::string
+FlightRecorder::DumpToDefaultPath(std::string reason)
+{
+    char timeStr[32];
+    time_t now = time(nullptr);
+    struct tm localTime;
+    localtime_r(&now, &localTime);
+    strftime(timeStr, sizeof(timeStr), "%Y%m%d_%H%M%S", &localTime);
+
+    std::string path = std::string(DEFAULT_DUMP_DIR) + "flight_recorder_" + reason + "_" + timeStr + ".bin";
+    return (Dump(path) < 0) ? "" : path;
+}
+
+void
+FlightRecorder::DumpOnTimeout(void)
+{
+    if (enabled == false)
+    {
+        return;
+    }
+    uint64_t now = GetTime();
+    uint64_t last = lastTimeoutDumpNs.load();
+    if (last != 0 && now - last < MIN_TIMEOUT_DUMP_INTERVAL_NS)
+    {
+        return;
+    }
+    if (lastTimeoutDumpNs.compare_exchange_strong(last, now) == true)
+    {
+        DumpToDefaultPath("io_timeout");
+    }
+}
+
+void
+FlightRecorder::SetEnabled(bool enable)
+{
+    enabled = enable;
+}
+
+bool
+FlightRecorder::IsEnabled(void)
+{
+    return enabled;
+}
+
+uint32_t
+FlightRecorder::GetRingCount(void)
+{
+    return ringCount;
+}
+
+uint32_t
+FlightRecorder::GetEventsPerRing(void)
+{
+    return eventsPerRing;
+}
+
+std::string
+FlightRecorder::GetTypeName(FlightEventType type)
+{
+    switch (type)
+    {
+        case FlightEventType::IoSubmit:
+            return "io_submit";
+        case FlightEventType::IoComplete:
+            return "io_complete";
+        case FlightEventType::GcVictimStart:
+            return "gc_victim_start";
+        case FlightEventType::GcVictimEnd:
+            return "gc_victim_end";
+        case FlightEventType::CheckpointStart:
+            return "checkpoint_start";
+        case FlightEventType::CheckpointEnd:
+            return "checkpoint_end";
+        case FlightEventType::LogGroupSwitch:
+            return "log_group_switch";
+        case FlightEventType::FlowControlBlock:
+            return "flow_control_block";
+        default:
+            return "unknown";
+    }
+}
+
+} // namespace pos
@@ -0,0 +1,177 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <sched.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "src/include/branch_prediction.h"
+#include "src/lib/singleton.h"
+
+namespace pos
+{
+class ConfigManager;
+
+enum class FlightEventType : uint8_t
+{
+    IoSubmit,         // arg0: volume id, arg1: sector rba, arg2: size in bytes
+    IoComplete,       // arg0: volume id, arg1: sector rba, arg2: latency in us
+    GcVictimStart,    // arg0: victim segment id, arg1: free segment count
+    GcVictimEnd,      // arg0: victim segment id, arg1: copied block count
+    CheckpointStart,  // arg0: log group id
+    CheckpointEnd,    // arg0: log group id
+    LogGroupSwitch,   // arg0: new log group id, arg1: sequence number
+    FlowControlBlock, // arg0: flow control type, arg1: requested token, arg2: free segment count
+    Count
+};
+
+// Layout shared with tool/dump/flight_recorder_decoder.py
+struct FlightEvent
+{
+    uint64_t timestampNs; // steady clock
+    uint8_t type;
+    uint8_t arrayId;
+    uint8_t direction;
+    uint8_t reserved;
+    uint32_t arg0;
+    uint64_t arg1;
+    uint64_t arg2;
+};
+
+static_assert(sizeof(FlightEvent) == 32, "flight event is a fixed 32 byte layout");
+
+struct FlightRecorderDumpHeader
+{
+    uint64_t magic;
+    uint32_t version;
+    uint32_t eventSize;
+    uint32_t ringCount;
+    uint32_t eventsPerRing;
+    // taken together so the decoder can convert the steady timestamps to wall clock
+    uint64_t steadyTimeNs;
+    uint64_t wallClockTimeNs;
+};
+
+// Keeps the most recent events of every core in a ring buffer so that the
+// history around a latency outlier or an I/O timeout can be dumped and
+// decoded offline by tool/dump/flight_recorder_decoder.py. Recording an
+// event costs a clock read and a few stores; a thread records into the
+// ring of the cpu it first ran on, which is its own for pinned reactors and
+// event workers. A dump taken while events are recorded may contain a few
+// torn entries at the head of a ring.
+class FlightRecorder
+{
+public:
+    static const uint64_t DUMP_MAGIC = 0x435254464c534f50ULL; // "POSFLTRC"
+    static const uint32_t DUMP_VERSION = 1;
+    static const uint32_t DEFAULT_EVENTS_PER_RING = 8192;
+    static const uint8_t NO_ARRAY = 0xff;
+    static const char* DEFAULT_DUMP_DIR;
+
+    explicit FlightRecorder(uint32_t ringCount = 0, uint32_t eventsPerRing = DEFAULT_EVENTS_PER_RING);
+    virtual ~FlightRecorder(void);
+
+    virtual void Initialize(ConfigManager* config);
+
+    inline void
+    Record(FlightEventType type, uint32_t arrayId, uint32_t arg0,
+        uint64_t arg1 = 0, uint64_t arg2 = 0, uint8_t direction = 0)
+    {
+        if (unlikely(enabled == false))
+        {
+            return;
+        }
+        static thread_local uint32_t cpu = UINT32_MAX;
+        if (unlikely(cpu == UINT32_MAX))
+        {
+            int current = sched_getcpu();
+            cpu = (current < 0) ? 0 : current;
+        }
+        FlightRecorderRing& ring = rings[(cpu < ringCount) ? cpu : (cpu % ringCount)];
+        uint64_t index = ring.head.fetch_add(1, std::memory_order_relaxed);
+        FlightEvent& event = ring.events[index & eventMask];
+        event.timestampNs = GetTime();
+        event.type = static_cast<uint8_t>(type);
+        event.arrayId = static_cast<uint8_t>(arrayId);
+        event.direction = direction;
+        event.arg0 = arg0;
+        event.arg1 = arg1;
+        event.arg2 = arg2;
+    }
+
+    static inline uint64_t
+    GetTime(void)
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Returns the number of events written, or -1 if the file could not be written
+    virtual int64_t Dump(std::string path);
+    // Dumps to DEFAULT_DUMP_DIR and returns the path, or an empty string on failure
+    virtual std::string DumpToDefaultPath(std::string reason);
+    // Rate limited dump for the I/O timeout checker, which can fire every 100 ms
+    virtual void DumpOnTimeout(void);
+
+    void SetEnabled(bool enable);
+    bool IsEnabled(void);
+    uint32_t GetRingCount(void);
+    uint32_t GetEventsPerRing(void);
+    static std::string GetTypeName(FlightEventType type);
+
+private:
+    struct FlightRecorderRing
+    {
+        std::atomic<uint64_t> head;
+        FlightEvent* events;
+        uint8_t padding[48];
+    };
+
+    static const uint64_t MIN_TIMEOUT_DUMP_INTERVAL_NS = 60ULL * 1000 * 1000 * 1000;
+
+    std::atomic<bool> enabled;
+    uint32_t ringCount;
+    uint32_t eventsPerRing;
+    uint64_t eventMask;
+    FlightRecorderRing* rings;
+    FlightEvent* eventBuffer;
+    std::atomic<uint64_t> lastTimeoutDumpNs;
+};
+
+using FlightRecorderSingleton = Singleton<FlightRecorder>;
+
+} // namespace pos
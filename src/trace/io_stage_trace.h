@@ -0,0 +1,99 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+namespace pos
+{
+// Stages of a host write in the order they are passed
+enum class IoStage
+{
+    Submitted,
+    RbaLocked,
+    BufferAllocated,
+    UramWritten,
+    JournalWritten,
+    MapUpdated,
+    Completed,
+    Count
+};
+
+// Timestamps of the stages one sampled I/O has passed.
+// Shared by the split VolumeIos of the same host I/O, so a stage keeps
+// the time the last split passed it.
+class IoStageTrace
+{
+public:
+    IoStageTrace(int arrayId, uint32_t volumeId, uint64_t sectorRba, uint64_t size)
+    : arrayId(arrayId),
+      volumeId(volumeId),
+      sectorRba(sectorRba),
+      size(size)
+    {
+        for (int stage = 0; stage < (int)IoStage::Count; stage++)
+        {
+            timestamps[stage] = 0;
+        }
+    }
+
+    inline void
+    Mark(IoStage stage)
+    {
+        uint64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        timestamps[(int)stage].store(now, std::memory_order_relaxed);
+    }
+
+    // steady clock time in nanoseconds, or 0 when the stage was not passed
+    inline uint64_t
+    GetTimestamp(IoStage stage) const
+    {
+        return timestamps[(int)stage].load(std::memory_order_relaxed);
+    }
+
+    const int arrayId;
+    const uint32_t volumeId;
+    const uint64_t sectorRba;
+    const uint64_t size;
+
+private:
+    std::atomic<uint64_t> timestamps[(int)IoStage::Count];
+};
+
+using IoStageTraceSmartPtr = std::shared_ptr<IoStageTrace>;
+
+} // namespace pos
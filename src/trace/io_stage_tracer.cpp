@@ -0,0 +1,263 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/trace/io_stage_tracer.h"
+
+#include <unistd.h>
+
+#include <chrono>
+#include <functional>
+
+#include "src/include/pos_event_id.h"
+#include "src/logger/logger.h"
+#include "src/master_context/config_manager.h"
+#include "src/telemetry/telemetry_client/easy_telemetry_publisher.h"
+#include "src/telemetry/telemetry_id.h"
+#include "src/trace/trace_exporter.h"
+
+namespace pos
+{
+IoStageTracer::IoStageTracer(void)
+: sampleRate(0),
+  exporter(nullptr),
+  publisher(nullptr),
+  histograms((int)IoStage::Count),
+  pendingSpanCount(0),
+  worker(nullptr),
+  isRunnable(false)
+{
+}
+
+IoStageTracer::~IoStageTracer(void)
+{
+    Dispose();
+}
+
+void
+IoStageTracer::Init(ConfigManager* config, TraceExporter* exporter,
+    EasyTelemetryPublisher* tp)
+{
+    this->exporter = exporter;
+    publisher = tp;
+
+    uint32_t rate = 0;
+    int ret = config->GetValue("trace", "io_stage_sample_rate", &rate,
+        ConfigType::CONFIG_TYPE_UINT32);
+    if (ret != EID(SUCCESS) || rate == 0)
+    {
+        return;
+    }
+
+    SetSampleRate(rate);
+    isRunnable = true;
+    worker = new std::thread(std::bind(&IoStageTracer::_PeriodicFlush, this));
+    POS_TRACE_INFO(EID(IO_STAGE_TRACE_ENABLED), "sample_rate:{}, span_export:{}",
+        rate, (exporter != nullptr && exporter->IsEnabled()));
+}
+
+void
+IoStageTracer::Dispose(void)
+{
+    sampleRate = 0;
+    if (worker != nullptr)
+    {
+        isRunnable = false;
+        worker->join();
+        delete worker;
+        worker = nullptr;
+    }
+
+    IoStageTraceSmartPtr trace;
+    while (pendingSpans.try_pop(trace))
+    {
+    }
+    pendingSpanCount = 0;
+}
+
+void
+IoStageTracer::SetSampleRate(uint32_t rate)
+{
+    sampleRate = rate;
+}
+
+uint32_t
+IoStageTracer::GetSampleRate(void)
+{
+    return sampleRate;
+}
+
+void
+IoStageTracer::Finish(IoStageTraceSmartPtr trace)
+{
+    if (trace == nullptr)
+    {
+        return;
+    }
+    trace->Mark(IoStage::Completed);
+
+    uint64_t previous = trace->GetTimestamp(IoStage::Submitted);
+    for (int stage = (int)IoStage::Submitted + 1; stage < (int)IoStage::Count; stage++)
+    {
+        uint64_t current = trace->GetTimestamp((IoStage)stage);
+        if (current == 0)
+        {
+            // e.g. no map update for a write of zero blocks
+            continue;
+        }
+        if (current >= previous)
+        {
+            histograms[stage].Record((current - previous) / 1000);
+        }
+        previous = current;
+    }
+
+    if (exporter == nullptr || exporter->IsEnabled() == false)
+    {
+        return;
+    }
+    // keep the completion path bounded when the collector falls behind
+    if (pendingSpanCount.fetch_add(1, std::memory_order_relaxed) >= MAX_PENDING_SPANS)
+    {
+        pendingSpanCount.fetch_sub(1, std::memory_order_relaxed);
+        return;
+    }
+    pendingSpans.push(trace);
+}
+
+void
+IoStageTracer::Flush(void)
+{
+    _Publish();
+    _Export();
+}
+
+void
+IoStageTracer::_Publish(void)
+{
+    if (publisher == nullptr)
+    {
+        return;
+    }
+
+    for (int stage = (int)IoStage::Submitted + 1; stage < (int)IoStage::Count; stage++)
+    {
+        std::vector<uint64_t> counts = histograms[stage].CollectInterval();
+        if (PerCoreHistogram::GetTotalCount(counts) == 0)
+        {
+            continue;
+        }
+
+        VectorLabels labels;
+        labels.push_back({"stage", GetStageName((IoStage)stage)});
+        publisher->UpdateGauge(TEL130020_WRITE_STAGE_LATENCY_P50,
+            PerCoreHistogram::GetPercentile(counts, 0.5), labels);
+        publisher->UpdateGauge(TEL130021_WRITE_STAGE_LATENCY_P99,
+            PerCoreHistogram::GetPercentile(counts, 0.99), labels);
+        publisher->UpdateGauge(TEL130022_WRITE_STAGE_LATENCY_P999,
+            PerCoreHistogram::GetPercentile(counts, 0.999), labels);
+        publisher->UpdateGauge(TEL130023_WRITE_STAGE_LATENCY_MAX,
+            PerCoreHistogram::GetMax(counts), labels);
+    }
+}
+
+void
+IoStageTracer::_Export(void)
+{
+    IoStageTraceSmartPtr trace;
+    while (pendingSpans.try_pop(trace))
+    {
+        pendingSpanCount.fetch_sub(1, std::memory_order_relaxed);
+
+        std::vector<TraceStage> stages;
+        uint64_t previous = trace->GetTimestamp(IoStage::Submitted);
+        for (int stage = (int)IoStage::Submitted + 1; stage < (int)IoStage::Count; stage++)
+        {
+            uint64_t current = trace->GetTimestamp((IoStage)stage);
+            if (current == 0 || current < previous)
+            {
+                continue;
+            }
+            stages.push_back({GetStageName((IoStage)stage), previous, current});
+            previous = current;
+        }
+
+        TraceAttributes attributes = {
+            {"array_id", static_cast<uint64_t>(trace->arrayId)},
+            {"volume_id", trace->volumeId},
+            {"sector_rba", trace->sectorRba},
+            {"size", trace->size}};
+        exporter->ExportStagedSpan("write", trace->GetTimestamp(IoStage::Submitted),
+            trace->GetTimestamp(IoStage::Completed), stages, attributes);
+    }
+}
+
+void
+IoStageTracer::_PeriodicFlush(void)
+{
+    auto lastFlushed = std::chrono::steady_clock::now();
+    while (isRunnable)
+    {
+        auto now = std::chrono::steady_clock::now();
+        if (now - lastFlushed >= std::chrono::milliseconds(static_cast<uint32_t>(FLUSH_INTERVAL_IN_MS)))
+        {
+            lastFlushed = now;
+            Flush();
+        }
+        usleep(1000);
+    }
+}
+
+std::string
+IoStageTracer::GetStageName(IoStage stage)
+{
+    switch (stage)
+    {
+        case IoStage::Submitted:
+            return "submitted";
+        case IoStage::RbaLocked:
+            return "rba_lock";
+        case IoStage::BufferAllocated:
+            return "write_buffer_allocation";
+        case IoStage::UramWritten:
+            return "uram_write";
+        case IoStage::JournalWritten:
+            return "journal_write";
+        case IoStage::MapUpdated:
+            return "map_update";
+        case IoStage::Completed:
+            return "completion";
+        default:
+            return "unknown";
+    }
+}
+
+} // namespace pos
@@ -0,0 +1,117 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <tbb/concurrent_queue.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "src/include/branch_prediction.h"
+#include "src/lib/singleton.h"
+#include "src/telemetry/telemetry_client/per_core_histogram.h"
+#include "src/trace/io_stage_trace.h"
+
+namespace pos
+{
+class ConfigManager;
+class EasyTelemetryPublisher;
+class TraceExporter;
+
+// Samples one of every N host writes and keeps the time each of them passes
+// the stages of the write path. The time spent per stage goes to histograms
+// published as percentiles, and sampled writes are exported as a span with
+// a child span per stage.
+class IoStageTracer
+{
+public:
+    IoStageTracer(void);
+    virtual ~IoStageTracer(void);
+
+    virtual void Init(ConfigManager* config, TraceExporter* exporter,
+        EasyTelemetryPublisher* tp);
+    virtual void Dispose(void);
+
+    // Returns nullptr unless the I/O is sampled
+    inline IoStageTraceSmartPtr
+    Sample(int arrayId, uint32_t volumeId, uint64_t sectorRba, uint64_t size)
+    {
+        if (likely(sampleRate == 0))
+        {
+            return nullptr;
+        }
+        static thread_local uint32_t count = 0;
+        if (++count < sampleRate)
+        {
+            return nullptr;
+        }
+        count = 0;
+
+        IoStageTraceSmartPtr trace = std::make_shared<IoStageTrace>(arrayId, volumeId, sectorRba, size);
+        trace->Mark(IoStage::Submitted);
+        return trace;
+    }
+
+    virtual void Finish(IoStageTraceSmartPtr trace);
+    // Publishes the percentiles recorded since the previous call and exports pending spans
+    virtual void Flush(void);
+
+    void SetSampleRate(uint32_t rate);
+    uint32_t GetSampleRate(void);
+    static std::string GetStageName(IoStage stage);
+
+private:
+    void _Publish(void);
+    void _Export(void);
+    void _PeriodicFlush(void);
+
+    static const uint32_t MAX_PENDING_SPANS = 1024;
+    static const uint32_t FLUSH_INTERVAL_IN_MS = 1000;
+
+    uint32_t sampleRate;
+    TraceExporter* exporter;
+    EasyTelemetryPublisher* publisher;
+    std::vector<PerCoreHistogram> histograms;
+    tbb::concurrent_queue<IoStageTraceSmartPtr> pendingSpans;
+    std::atomic<uint32_t> pendingSpanCount;
+
+    std::thread* worker;
+    std::atomic<bool> isRunnable;
+};
+
+using IoStageTracerSingleton = Singleton<IoStageTracer>;
+
+} // namespace pos
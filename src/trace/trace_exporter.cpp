@@ -4,6 +4,8 @@
 #include "src/include/pos_event_id.h"
 #include "opentelemetry/trace/provider.h"
 
+#include <chrono>
+
 using namespace opentelemetry;
 
 namespace pos
@@ -69,6 +71,54 @@ TraceExporter::IsEnabled(void)
     return enabled;
 }
 
+void
+TraceExporter::ExportStagedSpan(std::string name, uint64_t startNs, uint64_t endNs,
+    const std::vector<TraceStage>& stages, const TraceAttributes& attributes)
+{
+    if (false == enabled)
+    {
+        return;
+    }
+
+    // spans take the wall clock time as well, derived from the steady clock time given
+    auto steadyNow = std::chrono::steady_clock::now().time_since_epoch();
+    auto systemNow = std::chrono::system_clock::now().time_since_epoch();
+    auto toSystemTime = [&](uint64_t steadyNs)
+    {
+        auto elapsed = steadyNow - std::chrono::nanoseconds(steadyNs);
+        return common::SystemTimestamp(std::chrono::system_clock::time_point(
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(systemNow - elapsed)));
+    };
+
+    auto tracer = trace::Provider::GetTracerProvider()->GetTracer(TRACER_NAME);
+
+    trace::StartSpanOptions options;
+    options.start_system_time = toSystemTime(startNs);
+    options.start_steady_time = common::SteadyTimestamp(std::chrono::nanoseconds(startNs));
+    auto span = tracer->StartSpan(name, options);
+    for (auto& attribute : attributes)
+    {
+        span->SetAttribute(attribute.first, attribute.second);
+    }
+
+    for (auto& stage : stages)
+    {
+        trace::StartSpanOptions stageOptions;
+        stageOptions.start_system_time = toSystemTime(stage.startNs);
+        stageOptions.start_steady_time = common::SteadyTimestamp(std::chrono::nanoseconds(stage.startNs));
+        stageOptions.parent = span->GetContext();
+        auto stageSpan = tracer->StartSpan(stage.name, stageOptions);
+
+        trace::EndSpanOptions stageEndOptions;
+        stageEndOptions.end_steady_time = common::SteadyTimestamp(std::chrono::nanoseconds(stage.endNs));
+        stageSpan->End(stageEndOptions);
+    }
+
+    trace::EndSpanOptions endOptions;
+    endOptions.end_steady_time = common::SteadyTimestamp(std::chrono::nanoseconds(endNs));
+    span->End(endOptions);
+}
+
 void
 TraceExporter::_Enable(void)
 {
@@ -32,7 +32,10 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "src/trace/otlp_factory.h"
 #include "src/lib/singleton.h"
@@ -40,6 +43,16 @@
 namespace pos
 {
 
+// A child span of a staged span, in steady clock nanoseconds
+struct TraceStage
+{
+    std::string name;
+    uint64_t startNs;
+    uint64_t endNs;
+};
+
+using TraceAttributes = std::vector<std::pair<std::string, uint64_t>>;
+
 class TraceExporter
 {
 public:
@@ -47,12 +60,16 @@ public:
     virtual ~TraceExporter();
     virtual void Init(std::string serviceName, std::string serviceVersion, std::string endPoint);
     virtual bool IsEnabled(void);
+    // Exports one span of [startNs, endNs] with a child span per stage
+    virtual void ExportStagedSpan(std::string name, uint64_t startNs, uint64_t endNs,
+        const std::vector<TraceStage>& stages, const TraceAttributes& attributes);
 
 private:
     void _Enable(void);
 
     bool enabled;
     OtlpFactory *otlpFactory {nullptr};
+    const std::string TRACER_NAME = "poseidonos";
 };
 
 using TraceExporterSingleton = Singleton<TraceExporter>;
@@ -57,6 +57,7 @@ public:
     virtual int UpdateReplicationRole(std::string name, 
     ReplicationRole nodeProperty) = 0;
     virtual int Rename(std::string oldname, std::string newname) = 0;
+    virtual int Resize(std::string name, uint64_t newSize) = 0;
     virtual int SaveVolumeMeta(void) = 0;
 
     virtual int CheckVolumeValidity(std::string name) = 0;
@@ -39,6 +39,7 @@
 #include "src/sys_info/space_info.h"
 #include "src/volume/volume_base.h"
 #include "src/volume/volume_meta_intf.h"
+#include "src/volume/volume_meta_writer.h"
 
 namespace pos
 {
@@ -141,6 +142,11 @@ VolumeInterface::_PrintLogVolumeQos(VolumeBase* volume, uint64_t originalMaxIops
 int
 VolumeInterface::_SaveVolumes(void)
 {
+    VolumeMetaWriter* writer = volumeList.GetMetaWriter();
+    if (writer != nullptr)
+    {
+        return writer->Save(VolumeMetaIntf::EncodeVolumes(volumeList));
+    }
     return VolumeMetaIntf::SaveVolumes(volumeList, arrayName, arrayID);
 }
 
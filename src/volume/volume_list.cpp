@@ -49,6 +49,7 @@ VolumeList::VolumeList()
     {
         items[i] = nullptr;
     }
+    idSnapshot = std::make_shared<const std::vector<int>>();
 }
 
 VolumeList::~VolumeList(void)
@@ -69,6 +70,7 @@ VolumeList::Clear()
         }
     }
     volCnt = 0;
+    _PublishIdSnapshot();
 }
 
 int
@@ -90,6 +92,7 @@ VolumeList::Add(VolumeBase* volume)
     items[id] = volume;
     volCnt++;
     InitializePendingIOCount(id, VolumeIoType::InternalIo);
+    _PublishIdSnapshot();
     POS_TRACE_DEBUG(EID(SUCCESS), "Volume added to the list, VOL_CNT: {}, VOL_ID: {}", volCnt, id);
     return EID(SUCCESS);
 }
@@ -104,6 +107,7 @@ VolumeList::Add(VolumeBase* volume, int id)
         items[id] = volume;
         volCnt++;
         InitializePendingIOCount(id, VolumeIoType::InternalIo);
+        _PublishIdSnapshot();
         POS_TRACE_DEBUG(EID(VOL_DEBUG_MSG), "Volume added to the list, VOL_CNT: {}, VOL_ID: {}", volCnt, id);
         return EID(SUCCESS);
     }
@@ -132,6 +136,7 @@ VolumeList::Remove(int volId)
     delete target;
     items[volId] = nullptr;
     volCnt--;
+    _PublishIdSnapshot();
 
     POS_TRACE_INFO(EID(VOL_DEBUG_MSG), "Volume removed from the list VOL_CNT {}", volCnt);
 }
@@ -202,6 +207,28 @@ VolumeList::Next(int& index)
     return nullptr;
 }
 
+std::shared_ptr<const std::vector<int>>
+VolumeList::GetIdSnapshot(void)
+{
+    return std::atomic_load(&idSnapshot);
+}
+
+// Called with listMutex held, so the readers of the snapshot never take it
+void
+VolumeList::_PublishIdSnapshot(void)
+{
+    std::shared_ptr<std::vector<int>> ids = std::make_shared<std::vector<int>>();
+    ids->reserve(volCnt);
+    for (int i = 0; i < MAX_VOLUME_COUNT; i++)
+    {
+        if (items[i] != nullptr)
+        {
+            ids->push_back(i);
+        }
+    }
+    std::atomic_store(&idSnapshot, std::shared_ptr<const std::vector<int>>(ids));
+}
+
 void
 VolumeList::InitializePendingIOCount(int volId, VolumeIoType volumeIoType)
 {
@@ -36,11 +36,14 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 #include "src/volume/volume_base.h"
 
 namespace pos
 {
+class VolumeMetaWriter;
+
 class VolumeList
 {
 public:
@@ -54,6 +57,8 @@ public:
     VolumeBase* GetVolume(int volId);
     VolumeBase* GetVolume(std::string volName);
     VolumeBase* Next(int& index);
+    // Ids of the listed volumes in ascending order, swapped as a whole on add and remove
+    std::shared_ptr<const std::vector<int>> GetIdSnapshot(void);
     int
     Count()
     {
@@ -66,12 +71,25 @@ public:
     void WaitUntilIdleUserIo(int volId);
     bool CheckIdleAndSetZero(int volId, VolumeIoType volumeIoType);
     void InitializePendingIOCount(int volId, VolumeIoType volumeIoType);
+    void
+    SetMetaWriter(VolumeMetaWriter* writer)
+    {
+        metaWriter = writer;
+    }
+    VolumeMetaWriter*
+    GetMetaWriter(void)
+    {
+        return metaWriter;
+    }
 
 private:
     int _NewID();
+    void _PublishIdSnapshot(void);
     int volCnt;
     VolumeBase* items[MAX_VOLUME_COUNT];
     std::mutex listMutex;
+    std::shared_ptr<const std::vector<int>> idSnapshot;
+    VolumeMetaWriter* metaWriter = nullptr;
 
     std::atomic<bool> possibleIncreaseIOCount[MAX_VOLUME_COUNT][static_cast<uint32_t>(VolumeIoType::MaxVolumeIoTypeCnt)];
     std::atomic<uint32_t> pendingIOCount[MAX_VOLUME_COUNT][static_cast<uint32_t>(VolumeIoType::MaxVolumeIoTypeCnt)];
@@ -53,7 +53,9 @@
 #include "src/volume/volume_loader.h"
 #include "src/volume/volume_unmounter.h"
 #include "src/volume/volume_meta_intf.h"
+#include "src/volume/volume_meta_writer.h"
 #include "src/volume/volume_renamer.h"
+#include "src/volume/volume_resizer.h"
 #include "src/volume/volume_replicate_property_updater.h"
 #include "src/volume/volume_qos_updater.h"
 #include "src/telemetry/telemetry_client/telemetry_publisher.h"
@@ -73,6 +75,12 @@ wtEnabled(false)
 VolumeManager::~VolumeManager(void)
 {
     state->Unsubscribe(this);
+    if (metaWriter != nullptr)
+    {
+        volumes.SetMetaWriter(nullptr);
+        delete metaWriter;
+        metaWriter = nullptr;
+    }
 }
 
 int
@@ -84,6 +92,13 @@ VolumeManager::Init(void)
     _ClearLock();
     _LoadVolumes();
 
+    if (metaWriter == nullptr)
+    {
+        metaWriter = new VolumeMetaWriter(arrayInfo->GetName(), arrayInfo->GetIndex());
+        metaWriter->Start();
+        volumes.SetMetaWriter(metaWriter);
+    }
+
     if (tp == nullptr)
     {
         tp = new TelemetryPublisher(("VolumeManager"));
@@ -113,6 +128,12 @@ void
 VolumeManager::Dispose(void)
 {
     initialized = false;
+    if (metaWriter != nullptr)
+    {
+        volumes.SetMetaWriter(nullptr);
+        delete metaWriter;
+        metaWriter = nullptr;
+    }
     volumes.Clear();
     _ClearLock();
 
@@ -485,6 +506,38 @@ VolumeManager::Rename(std::string oldName, std::string newName)
     return ret;
 }
 
+int
+VolumeManager::Resize(std::string name, uint64_t newSize)
+{
+    int ret = _CheckPrerequisite();
+    if (ret != EID(SUCCESS))
+    {
+        return ret;
+    }
+
+    unique_lock<mutex> eventLock(volumeEventLock, std::defer_lock);
+    unique_lock<mutex> exceptionLock(volumeExceptionLock, std::defer_lock);
+
+    ret = std::try_lock(exceptionLock, eventLock);
+
+    if (ret != -1)
+    {
+        POS_TRACE_WARN(EID(VOL_UPDATE_LOCK_FAIL), "failed try lock index : {} fail vol name: {}", ret, name);
+
+        return EID(VOL_MGR_BUSY);
+    }
+
+    VolumeResizer volumeResizer(volumes, arrayInfo->GetName(), arrayInfo->GetIndex());
+    ret = volumeResizer.Do(name, newSize);
+    if (ret == EID(SUCCESS))
+    {
+        _PublishTelemetryVolumeCapacity(name, newSize);
+        _PublishTelemetryArrayUsage();
+    }
+
+    return ret;
+}
+
 int
 VolumeManager::SaveVolumeMeta(void)
 {
@@ -506,8 +559,23 @@ VolumeManager::SaveVolumeMeta(void)
         return EID(VOL_MGR_BUSY);
     }
 
-    VolumeMetaSaver volumeMetaSaver(volumes, arrayInfo->GetName(), arrayInfo->GetIndex());
-    return volumeMetaSaver.Do();
+    if (metaWriter == nullptr)
+    {
+        VolumeMetaSaver volumeMetaSaver(volumes, arrayInfo->GetName(), arrayInfo->GetIndex());
+        return volumeMetaSaver.Do();
+    }
+
+    // Waiting outside of the locks lets the saves that come in meanwhile share the write
+    uint64_t ticket = metaWriter->Submit(VolumeMetaIntf::EncodeVolumes(volumes));
+    exceptionLock.unlock();
+    eventLock.unlock();
+
+    ret = metaWriter->Wait(ticket);
+    if (ret != EID(SUCCESS))
+    {
+        POS_TRACE_WARN(EID(VOL_UPDATE_META_SAVE_FAIL), "Array {} VolumeMeta Update Fail", arrayInfo->GetName());
+    }
+    return ret;
 }
 
 int
@@ -54,6 +54,7 @@
 
 namespace pos
 {
+class VolumeMetaWriter;
 
 class VolumeBase;
 class TelemetryPublisher;
@@ -79,6 +80,7 @@ public:
     int UpdateReplicationState(std::string name, ReplicationState state) override;
     int UpdateReplicationRole(std::string name, ReplicationRole nodeProperty) override;
     int Rename(std::string oldname, std::string newname) override;
+    int Resize(std::string name, uint64_t newSize) override;
     int SaveVolumeMeta(void) override;
     int CheckVolumeValidity(std::string name) override;
 
@@ -130,6 +132,7 @@ private:
     std::mutex volumeExceptionLock;
 
     bool wtEnabled;
+    VolumeMetaWriter* metaWriter = nullptr;
 };
 
 } // namespace pos
@@ -33,6 +33,8 @@
 #include "src/volume/volume_meta_intf.h"
 
 #include <rapidjson/document.h>
+
+#include <algorithm>
 #include <string>
 #include "src/metafs/include/metafs_service.h"
 #include "src/helper/json/json_helper.h"
@@ -125,10 +127,13 @@ VolumeMetaIntf::LoadVolumes(VolumeList& volList, std::string arrayName, int arra
 int
 VolumeMetaIntf::SaveVolumes(VolumeList& volList, std::string arrayName, int arrayID)
 {
-    std::string volFile = "vbr";
-    uint32_t fileSize = 256 * 1024; // 256KB
+    return WriteVolumes(EncodeVolumes(volList), arrayName);
+}
+
+std::string
+VolumeMetaIntf::EncodeVolumes(VolumeList& volList)
+{
     std::string contents = "";
-    MetaFs* metaFs = MetaFsServiceSingleton::Instance()->GetMetaFs(arrayName);
 
     int vol_cnt = volList.Count();
     if (vol_cnt > 0)
@@ -164,6 +169,15 @@ VolumeMetaIntf::SaveVolumes(VolumeList& volList, std::string arrayName, int arra
         root.SetArray(array);
         contents = root.ToJson();
     }
+    return contents;
+}
+
+int
+VolumeMetaIntf::WriteVolumes(const std::string& contents, std::string arrayName)
+{
+    std::string volFile = "vbr";
+    uint32_t fileSize = 256 * 1024; // 256KB
+    MetaFs* metaFs = MetaFsServiceSingleton::Instance()->GetMetaFs(arrayName);
 
     POS_EVENT_ID rc = metaFs->ctrl->CheckFileExist(volFile);
     if (EID(SUCCESS) != (int)rc)
@@ -178,6 +192,14 @@ VolumeMetaIntf::SaveVolumes(VolumeList& volList, std::string arrayName, int arra
         }
     }
 
+    uint32_t contentsSize = contents.size();
+    if (contentsSize >= fileSize)
+    {
+        POS_TRACE_ERROR(EID(VOL_UNABLE_TO_SAVE_CONTENT_OVERFLOW),
+            "array_name: {}", arrayName);
+        return EID(VOL_UNABLE_TO_SAVE_CONTENT_OVERFLOW);
+    }
+
     int fd = 0;
     rc = metaFs->ctrl->Open(volFile, fd);
     if (EID(SUCCESS) != (int)rc)
@@ -187,19 +209,17 @@ VolumeMetaIntf::SaveVolumes(VolumeList& volList, std::string arrayName, int arra
         return EID(VOL_UNABLE_TO_SAVE_OPEN_FAILED);
     }
 
-    uint32_t contentsSize = contents.size();
-    if (contentsSize >= fileSize)
-    {
-        POS_TRACE_ERROR(EID(VOL_UNABLE_TO_SAVE_CONTENT_OVERFLOW),
-            "array_name: {}", arrayName);
-        return EID(VOL_UNABLE_TO_SAVE_CONTENT_OVERFLOW);
-    }
+    // Only the contents and its terminator are written. LoadVolumes stops
+    // parsing at the terminator, so whatever follows it is never read.
+    uint32_t writeSize = contentsSize + 1;
+    writeSize = (writeSize + WRITE_ALIGNMENT - 1) / WRITE_ALIGNMENT * WRITE_ALIGNMENT;
+    writeSize = std::min(writeSize, fileSize);
 
-    char* wBuf = (char*)malloc(fileSize);
-    memset(wBuf, 0, fileSize);
+    char* wBuf = (char*)malloc(writeSize);
+    memset(wBuf, 0, writeSize);
     strncpy(wBuf, contents.c_str(), contentsSize);
 
-    POS_EVENT_ID ioRC = metaFs->io->Write(fd, wBuf);
+    POS_EVENT_ID ioRC = metaFs->io->Write(fd, 0, writeSize, wBuf);
 
     metaFs->ctrl->Close(fd);
 
@@ -212,7 +232,7 @@ VolumeMetaIntf::SaveVolumes(VolumeList& volList, std::string arrayName, int arra
     }
 
     free(wBuf);
-    POS_TRACE_DEBUG(EID(SUCCESS), "SaveVolumes succeed");
+    POS_TRACE_DEBUG(EID(SUCCESS), "SaveVolumes succeed, size:{}", writeSize);
     return EID(SUCCESS);
 }
 
@@ -44,6 +44,11 @@ class VolumeMetaIntf
 public:
     static int LoadVolumes(VolumeList& volList, std::string arrayName, int arrayID);
     static int SaveVolumes(VolumeList& volList, std::string arrayName, int arrayID);
+    static std::string EncodeVolumes(VolumeList& volList);
+    static int WriteVolumes(const std::string& contents, std::string arrayName);
+
+private:
+    static const uint32_t WRITE_ALIGNMENT = 4096;
 };
 } // namespace pos
 
@@ -0,0 +1,189 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/volume/volume_meta_writer.h"
+
+#include "src/include/pos_event_id.h"
+#include "src/logger/logger.h"
+#include "src/volume/volume_meta_intf.h"
+
+namespace pos
+{
+VolumeMetaWriter::VolumeMetaWriter(std::string arrayName, int arrayID)
+: VolumeMetaWriter(arrayName, arrayID,
+      [arrayName](const std::string& contents)
+      {
+          return VolumeMetaIntf::WriteVolumes(contents, arrayName);
+      })
+{
+}
+
+VolumeMetaWriter::VolumeMetaWriter(std::string arrayName, int arrayID, WriteFunc writeFunc)
+: arrayName(arrayName),
+  arrayID(arrayID),
+  writeFunc(writeFunc),
+  submittedTicket(0),
+  writtenTicket(0),
+  durableTicket(0),
+  lastError(EID(SUCCESS)),
+  numWrites(0),
+  stop(true),
+  worker(nullptr)
+{
+}
+
+VolumeMetaWriter::~VolumeMetaWriter(void)
+{
+    Stop();
+}
+
+void
+VolumeMetaWriter::Start(void)
+{
+    if (worker != nullptr)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stop = false;
+    }
+    worker = new std::thread(&VolumeMetaWriter::_Worker, this);
+}
+
+// The contents submitted before the stop are written before the worker exits
+void
+VolumeMetaWriter::Stop(void)
+{
+    if (worker == nullptr)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stop = true;
+    }
+    submitCv.notify_all();
+    worker->join();
+    delete worker;
+    worker = nullptr;
+}
+
+uint64_t
+VolumeMetaWriter::Submit(std::string contents)
+{
+    uint64_t ticket = 0;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        pendingContents = std::move(contents);
+        ticket = ++submittedTicket;
+    }
+    submitCv.notify_one();
+    return ticket;
+}
+
+int
+VolumeMetaWriter::Wait(uint64_t ticket)
+{
+    std::unique_lock<std::mutex> guard(lock);
+    if (worker == nullptr && writtenTicket < ticket)
+    {
+        // Not started; write in the caller's context
+        std::string contents = std::move(pendingContents);
+        uint64_t covered = submittedTicket;
+        int ret = writeFunc(contents);
+        numWrites++;
+        writtenTicket = covered;
+        if (ret == EID(SUCCESS))
+        {
+            durableTicket = covered;
+        }
+        else
+        {
+            lastError = ret;
+        }
+    }
+    writeCv.wait(guard, [&] { return writtenTicket >= ticket; });
+    return (durableTicket >= ticket) ? EID(SUCCESS) : lastError;
+}
+
+int
+VolumeMetaWriter::Save(std::string contents)
+{
+    return Wait(Submit(std::move(contents)));
+}
+
+uint64_t
+VolumeMetaWriter::GetNumWrites(void)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return numWrites;
+}
+
+void
+VolumeMetaWriter::_Worker(void)
+{
+    std::unique_lock<std::mutex> guard(lock);
+    while (true)
+    {
+        submitCv.wait(guard, [&] { return stop == true || submittedTicket > writtenTicket; });
+        if (submittedTicket == writtenTicket)
+        {
+            break;
+        }
+
+        std::string contents = std::move(pendingContents);
+        uint64_t covered = submittedTicket;
+        uint64_t numCoalesced = covered - writtenTicket;
+        guard.unlock();
+
+        int ret = writeFunc(contents);
+
+        guard.lock();
+        numWrites++;
+        writtenTicket = covered;
+        if (ret == EID(SUCCESS))
+        {
+            durableTicket = covered;
+        }
+        else
+        {
+            lastError = ret;
+            POS_TRACE_ERROR(ret, "Failed to write volume meta, array_name:{}, array_id:{}, num_saves:{}",
+                arrayName, arrayID, numCoalesced);
+        }
+        writeCv.notify_all();
+    }
+}
+} // namespace pos
@@ -0,0 +1,85 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace pos
+{
+// Persists the volume meta of an array from a single background thread.
+// Each save hands over the whole encoded volume list, so a newer save supersedes
+// the ones that have not been written yet. The saves that pile up while a write
+// is in flight are coalesced into the next write, and its result is fanned out
+// to all of them. A save is reported durable once a write of the same or newer
+// contents has succeeded.
+class VolumeMetaWriter
+{
+public:
+    using WriteFunc = std::function<int(const std::string&)>;
+
+    VolumeMetaWriter(std::string arrayName, int arrayID);
+    VolumeMetaWriter(std::string arrayName, int arrayID, WriteFunc writeFunc);
+    virtual ~VolumeMetaWriter(void);
+
+    virtual void Start(void);
+    virtual void Stop(void);
+    virtual uint64_t Submit(std::string contents);
+    virtual int Wait(uint64_t ticket);
+    virtual int Save(std::string contents);
+    virtual uint64_t GetNumWrites(void);
+
+private:
+    void _Worker(void);
+
+    std::string arrayName;
+    int arrayID;
+    WriteFunc writeFunc;
+
+    std::mutex lock;
+    std::condition_variable submitCv;
+    std::condition_variable writeCv;
+    std::string pendingContents;
+    uint64_t submittedTicket;
+    uint64_t writtenTicket;
+    uint64_t durableTicket;
+    int lastError;
+    uint64_t numWrites;
+    bool stop;
+    std::thread* worker;
+};
+} // namespace pos
@@ -0,0 +1,110 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2021 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/volume/volume_resizer.h"
+
+#include <string>
+
+#include "src/include/pos_event_id.h"
+#include "src/logger/logger.h"
+#include "src/sys_event/volume_event_publisher.h"
+#include "src/volume/volume_base.h"
+#include "src/volume/volume_list.h"
+
+namespace pos
+{
+VolumeResizer::VolumeResizer(VolumeList& volumeList, std::string arrayName, int arrayID, VolumeEventPublisher* volumeEventPublisher)
+: VolumeInterface(volumeList, arrayName, arrayID, volumeEventPublisher)
+{
+}
+
+VolumeResizer::~VolumeResizer(void)
+{
+}
+
+int
+VolumeResizer::Do(string name, uint64_t newSize)
+{
+    VolumeBase* vol = volumeList.GetVolume(name);
+    if (vol == nullptr)
+    {
+        POS_TRACE_WARN(EID(RESIZE_VOL_NAME_DOES_NOT_EXIST), "vol_name:{}", name);
+        return EID(RESIZE_VOL_NAME_DOES_NOT_EXIST);
+    }
+
+    uint64_t originalSize = vol->GetTotalSize();
+    if (newSize <= originalSize)
+    {
+        POS_TRACE_WARN(EID(RESIZE_VOL_SIZE_NOT_LARGER),
+            "vol_name:{}, size:{}, requested:{}", name, originalSize, newSize);
+        return EID(RESIZE_VOL_SIZE_NOT_LARGER);
+    }
+
+    try
+    {
+        _CheckVolumeSize(newSize - originalSize);
+    }
+    catch (int& exceptionEvent)
+    {
+        return static_cast<int>(exceptionEvent);
+    }
+
+    // The space check above counts the new size only once it is set here
+    vol->SetTotalSize(newSize);
+    _SetVolumeEventBase(vol);
+    _SetVolumeArrayInfo();
+
+    bool res = eventPublisher->NotifyVolumeResized(&volumeEventBase, &volumeArrayInfo);
+    if (res == false)
+    {
+        vol->SetTotalSize(originalSize);
+        POS_TRACE_WARN(EID(RESIZE_VOL_MAP_CAPACITY_EXCEEDED),
+            "vol_name:{}, array_name:{}, size:{}, requested:{}",
+            name, arrayName, originalSize, newSize);
+        return EID(RESIZE_VOL_MAP_CAPACITY_EXCEEDED);
+    }
+
+    int ret = _SaveVolumes();
+    if (ret != EID(SUCCESS))
+    {
+        // The inner layers already serve the new size, so only the record is stale
+        POS_TRACE_ERROR(ret, "Fail to save the new size of volume {} ({}->{})",
+            name, originalSize, newSize);
+        return ret;
+    }
+
+    POS_TRACE_INFO(EID(SUCCESS), "Volume {} is resized ({}->{})",
+        name, originalSize, newSize);
+    return EID(SUCCESS);
+}
+
+} // namespace pos
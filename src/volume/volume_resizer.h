@@ -30,27 +30,21 @@
  *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
-#include "src/io/general_io/sync_io_completion.h"
+#pragma once
+
+#include <string>
+
+#include "src/volume/volume_interface.h"
 
 namespace pos
 {
-SyncIoCompletion::SyncIoCompletion(
-    std::atomic<bool>& inputNeedToWait, uint32_t& inputErrorCount)
-: Callback(false, CallbackType_SyncIoCompletion),
-  needToWait(inputNeedToWait),
-  errorCount(inputErrorCount)
+class VolumeResizer : public VolumeInterface
 {
-}
+public:
+    explicit VolumeResizer(VolumeList& volumeList, std::string arrayName, int arrayID, VolumeEventPublisher* volumeEventPublisher = nullptr);
+    ~VolumeResizer(void) override;
 
-SyncIoCompletion::~SyncIoCompletion(void)
-{
-}
+    int Do(string name, uint64_t newSize);
+};
 
-bool
-SyncIoCompletion::_DoSpecificJob(void)
-{
-    errorCount = _GetErrorCount();
-    needToWait = false;
-    return true;
-}
-} // namespace pos
+}  // namespace pos
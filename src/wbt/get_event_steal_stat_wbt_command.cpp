@@ -0,0 +1,84 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "get_event_steal_stat_wbt_command.h"
+
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+#include "src/event_scheduler/backend_event_stealing_policy.h"
+#include "src/event_scheduler/event_scheduler.h"
+
+namespace pos
+{
+GetEventStealStatWbtCommand::GetEventStealStatWbtCommand(void)
+:   WbtCommand(GET_EVENT_STEAL_STAT, "get_event_steal_stat")
+{
+}
+// LCOV_EXCL_START
+GetEventStealStatWbtCommand::~GetEventStealStatWbtCommand(void)
+{
+}
+// LCOV_EXCL_STOP
+int
+GetEventStealStatWbtCommand::Execute(Args &argv, JsonElement &elem)
+{
+    BackendEventStealingPolicy* policy =
+        dynamic_cast<BackendEventStealingPolicy*>(EventSchedulerSingleton::Instance()->policy);
+    if (policy == nullptr)
+    {
+        // work_stealing is not enabled in pos.conf
+        return -1;
+    }
+
+    uint64_t localPickCount = policy->GetLocalPickCount();
+    uint64_t stealCount = policy->GetStealCount();
+    uint64_t overflowCount = policy->GetOverflowCount();
+    uint64_t totalCount = localPickCount + stealCount;
+
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(2)
+        << ((totalCount == 0) ? 0.0 : (100.0 * stealCount / totalCount));
+
+    JsonElement statElem("event_steal_stat");
+    statElem.SetAttribute(JsonAttribute("local_pick", std::to_string(localPickCount)));
+    statElem.SetAttribute(JsonAttribute("steal", std::to_string(stealCount)));
+    statElem.SetAttribute(JsonAttribute("overflow", std::to_string(overflowCount)));
+    statElem.SetAttribute(JsonAttribute("steal_rate_percent", "\"" + oss.str() + "\""));
+    elem.SetElement(statElem);
+
+    return 0;
+}
+
+} // namespace pos
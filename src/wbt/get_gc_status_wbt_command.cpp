@@ -167,6 +167,13 @@ GetGcStatusWbtCommand::Execute(Args &argv, JsonElement &elem)
     segElem.SetAttribute(JsonAttribute("free", freeSegments));
     gcElem.SetElement(segElem);
 
+    JsonElement copyElem("copy");
+    copyElem.SetAttribute(JsonAttribute("target_depth", gc->GetCopyTargetDepth()));
+    copyElem.SetAttribute(JsonAttribute("current_depth", gc->GetCopyCurrentDepth()));
+    copyElem.SetAttribute(JsonAttribute("read_batch", gc->GetCopyReadBatch()));
+    copyElem.SetAttribute(JsonAttribute("host_p99_us", std::to_string(gc->GetHostP99Us())));
+    gcElem.SetElement(copyElem);
+
     elem.SetElement(gcElem);
 
     return 0;
@@ -47,6 +47,7 @@
 #include "get_aligned_file_io_size_wbt_command.h"
 #include "get_bitmap_layout_wbt_command.h"
 #include "get_current_ssd_lsid_wbt_command.h"
+#include "get_event_steal_stat_wbt_command.h"
 #include "get_file_size_wbt_command.h"
 #include "get_gc_status_wbt_command.h"
 #include "get_gc_threshold_wbt_command.h"
@@ -156,6 +157,9 @@ WbtCmdHandler::PrepareWbtCommands(void)
     wbtCommandMap["get_gc_threshold"] = std::make_unique<GetGcThresholdWbtCommand>();
     wbtCommandMap["get_gc_status"] = std::make_unique<GetGcStatusWbtCommand>();
 
+    // Event Scheduler
+    wbtCommandMap["get_event_steal_stat"] = std::make_unique<GetEventStealStatWbtCommand>();
+
     // Journal Manager
     wbtCommandMap["get_journal_status"] = std::make_unique<GetJournalStatusWbtCommand>();
 
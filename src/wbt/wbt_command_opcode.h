@@ -107,6 +107,9 @@ enum WbtCommandOpcode
     GET_GC_THRESHOLD,
     GET_GC_STATUS,
 
+    // Event Scheduler
+    GET_EVENT_STEAL_STAT,
+
     // NVMe Cli
     NVME_CLI,
     ADMIN_PASS_THROUGH,
@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "src/io_scheduler/adaptive_poller.h"
+#include "test/unit-tests/telemetry/telemetry_client/easy_telemetry_publisher_mock.h"
+
+namespace pos
+{
+using ::testing::NiceMock;
+using Clock = std::chrono::steady_clock;
+
+static const uint32_t MAX_SLEEP_TIME_US = 10000;
+static const uint32_t IDLE_ROUND_THRESHOLD = 10;
+static const int NUM_REQUESTS = 200;
+
+// Measures how long a request waits until a polling thread picks it up,
+// with the tight polling and with the adaptive polling backed off to its max sleep.
+// Results are printed, and the wait is only checked not to reach the max sleep.
+class AdaptivePollerBenchmarkTest : public ::testing::Test
+{
+protected:
+    void _Run(AdaptivePoller* poller);
+    std::vector<uint64_t> _Measure(AdaptivePoller* poller, int numRequests);
+    void _PrintResult(std::string name, std::vector<uint64_t>& latencies);
+
+    NiceMock<MockEasyTelemetryPublisher> telemetryPublisher;
+    std::atomic<bool> exit{false};
+    std::atomic<bool> requested{false};
+    std::atomic<int64_t> requestedTime{0};
+    std::vector<uint64_t> pickedUpLatencies;
+};
+
+void
+AdaptivePollerBenchmarkTest::_Run(AdaptivePoller* poller)
+{
+    while (false == exit)
+    {
+        bool isIdle = true;
+        if (requested.exchange(false))
+        {
+            int64_t now = Clock::now().time_since_epoch().count();
+            pickedUpLatencies.push_back((now - requestedTime) / 1000);
+            isIdle = false;
+        }
+        poller->Poll(isIdle);
+    }
+}
+
+std::vector<uint64_t>
+AdaptivePollerBenchmarkTest::_Measure(AdaptivePoller* poller, int numRequests)
+{
+    pickedUpLatencies.clear();
+    exit = false;
+    std::thread pollingThread(&AdaptivePollerBenchmarkTest::_Run, this, poller);
+
+    for (int count = 0; count < numRequests; count++)
+    {
+        // Let the poller back off while idle
+        while (poller->GetSleepTime() < MAX_SLEEP_TIME_US)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        requestedTime = Clock::now().time_since_epoch().count();
+        requested = true;
+        poller->Wakeup();
+        while (requested)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    exit = true;
+    poller->Wakeup();
+    pollingThread.join();
+    return pickedUpLatencies;
+}
+
+void
+AdaptivePollerBenchmarkTest::_PrintResult(std::string name, std::vector<uint64_t>& latencies)
+{
+    std::sort(latencies.begin(), latencies.end());
+    std::cout << "[" << name << "] requests: " << latencies.size()
+              << ", p50: " << latencies[latencies.size() / 2] << "us"
+              << ", p99: " << latencies[latencies.size() * 99 / 100] << "us"
+              << ", max: " << latencies.back() << "us" << std::endl;
+}
+
+TEST_F(AdaptivePollerBenchmarkTest, CompareWakeupLatencyOfBackedOffPoller)
+{
+    AdaptivePoller poller(MAX_SLEEP_TIME_US, "benchmark", IDLE_ROUND_THRESHOLD,
+        &telemetryPublisher);
+
+    std::vector<uint64_t> latencies = _Measure(&poller, NUM_REQUESTS);
+    _PrintResult("adaptive polling from max sleep", latencies);
+    std::cout << "[adaptive polling] total sleep: " << poller.GetTotalSleepTime()
+              << "us" << std::endl;
+
+    ASSERT_EQ(NUM_REQUESTS, latencies.size());
+    EXPECT_LT(latencies[latencies.size() / 2], MAX_SLEEP_TIME_US);
+}
+
+} // namespace pos
@@ -27,6 +27,8 @@ public:
     virtual int StopRebuilding(void) { return 0; }
     virtual bool NeedRebuildAgain(void) { return true; }
     virtual uint32_t GetRebuildTargetSegmentCount(void) { return 0; }
+    virtual uint32_t GetRebuildTargetStripeCount(SegmentId segmentId) { return 0; }
+    virtual void PrioritizeRebuildTarget(StripeId lsid) {}
     virtual int GetGcThreshold(GcMode mode) { return 0; }
     virtual uint64_t GetStoredContextVersion(int owner) { return 0; }
     virtual SegmentCtx* GetSegmentCtx(void) { return nullptr; }
@@ -20,6 +20,8 @@ VSAMapMock::VSAMapMock(TestInfo* testInfo)
         &VSAMapMock::_SetVSAsInternal));
     ON_CALL(*this, SetVSAsWithSyncOpen).WillByDefault(::testing::Invoke(this,
         &VSAMapMock::_SetVSAsWithSyncOpen));
+    ON_CALL(*this, UnmapVSAsWithSyncOpen).WillByDefault(::testing::Invoke(this,
+        &VSAMapMock::_UnmapVSAsWithSyncOpen));
 }
 
 VSAMapMock::~VSAMapMock(void)
@@ -79,6 +81,14 @@ VSAMapMock::GetVSAs(int volumeId, BlkAddr startRba, uint32_t numBlks,
     return 0;
 }
 
+int
+VSAMapMock::GetVsaExtents(int volumeId, BlkAddr startRba, uint32_t numBlks,
+    VsaExtentArray& extents, uint32_t& numExtents)
+{
+    numExtents = 0;
+    return 0;
+}
+
 int
 VSAMapMock::SetVSAs(int volumeId, BlkAddr startRba, VirtualBlks& virtualBlks)
 {
@@ -119,4 +129,21 @@ VSAMapMock::_SetVSAsWithSyncOpen(int volId, BlkAddr startRba, VirtualBlks& virtu
     return 0;
 }
 
+int
+VSAMapMock::_UnmapVSAsWithSyncOpen(int volId, BlkAddr startRba, uint64_t numBlks, std::vector<VirtualBlks>& oldBlks)
+{
+    assert(volId < testInfo->maxNumVolume);
+    for (uint64_t blkCount = 0; blkCount < numBlks; blkCount++)
+    {
+        assert(startRba + blkCount < testInfo->maxVolumeSizeInBlock);
+        VirtualBlkAddr& entry = map[volId][startRba + blkCount];
+        if (IsUnMapVsa(entry) == false)
+        {
+            oldBlks.push_back({.startVsa = entry, .numBlks = 1});
+            entry = UNMAP_VSA;
+        }
+    }
+    return 0;
+}
+
 } // namespace pos
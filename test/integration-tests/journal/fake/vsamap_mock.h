@@ -23,9 +23,15 @@ public:
         VirtualBlks& virtualBlks), (override));
     MOCK_METHOD(int, SetVSAsWithSyncOpen, (int volumeId, BlkAddr startRba,
         VirtualBlks& virtualBlks), (override));
+    MOCK_METHOD(int, UnmapVSAs, (int volumeId, BlkAddr startRba,
+        uint64_t numBlks, std::vector<VirtualBlks>& oldBlks), (override));
+    MOCK_METHOD(int, UnmapVSAsWithSyncOpen, (int volumeId, BlkAddr startRba,
+        uint64_t numBlks, std::vector<VirtualBlks>& oldBlks), (override));
 
     virtual int GetVSAs(int volumeId, BlkAddr startRba, uint32_t numBlks,
         VsaArray& vsaArray) override;
+    virtual int GetVsaExtents(int volumeId, BlkAddr startRba, uint32_t numBlks,
+        VsaExtentArray& extents, uint32_t& numExtents) override;
     virtual int SetVSAs(int volumeId, BlkAddr startRba,
         VirtualBlks& virtualBlks) override;
     virtual VirtualBlkAddr GetRandomVSA(BlkAddr rba) override;
@@ -36,6 +42,7 @@ public:
 private:
     int _SetVSAsInternal(int volumeId, BlkAddr startRba, VirtualBlks& virtualBlks);
     int _SetVSAsWithSyncOpen(int volumeId, BlkAddr startRba, VirtualBlks& virtualBlks);
+    int _UnmapVSAsWithSyncOpen(int volumeId, BlkAddr startRba, uint64_t numBlks, std::vector<VirtualBlks>& oldBlks);
 
     TestInfo* testInfo;
     VirtualBlkAddr** map;
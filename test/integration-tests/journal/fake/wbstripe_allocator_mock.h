@@ -22,6 +22,7 @@ public:
     virtual StripeSmartPtr GetStripe(StripeId wbLsid) override { return nullptr; }
     virtual void FreeWBStripeId(StripeId lsid) override {}
 
+    virtual bool IsWbStripeQuotaExceeded(uint32_t volumeId) override { return false; }
     virtual bool ReferLsidCnt(StripeAddr& lsa) override { return true; }
     virtual void DereferLsidCnt(StripeAddr& lsa, uint32_t blockCount) override {}
 
@@ -91,12 +91,17 @@ void
 JournalManagerTestFixture::SimulateSPORWithoutRecovery(void)
 {
     JournalConfigurationBuilder configurationBuilder(testInfo);
+    SimulateSPORWithoutRecovery(configurationBuilder.Build());
+}
 
+void
+JournalManagerTestFixture::SimulateSPORWithoutRecovery(JournalConfigurationSpy* config)
+{
     delete journal;
 
     telemetryPublisher = new NiceMock<MockTelemetryPublisher>;
     journal = new JournalManagerSpy(telemetryPublisher, arrayInfo, stateSub, GetLogFileName());
-    journal->ResetJournalConfiguration(configurationBuilder.Build());
+    journal->ResetJournalConfiguration(config);
     writeTester->UpdateJournal(journal);
 
     journal->InitializeForTest(telemetryClient, testMapper, testAllocator, volumeManager);
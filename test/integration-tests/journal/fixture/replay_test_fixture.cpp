@@ -118,6 +118,26 @@ ReplayTestFixture::ExpectReplayFullStripe(StripeTestFixture stripe)
     ExpectReplayBlockLogsForStripe(stripe.GetVolumeId(), blksToWrite);
 }
 
+void
+ReplayTestFixture::ExpectReplayFullStripesInOrder(std::list<StripeTestFixture>& stripes)
+{
+    {
+        InSequence s;
+
+        for (auto stripe : stripes)
+        {
+            ExpectReplaySegmentAllocation(stripe.GetUserAddr().stripeId);
+            ExpectReplayStripeAllocation(stripe.GetVsid(), stripe.GetWbAddr().stripeId);
+            ExpectReplayStripeFlush(stripe);
+        }
+    }
+
+    for (auto stripe : stripes)
+    {
+        ExpectReplayBlockLogsForStripe(stripe.GetVolumeId(), stripe.GetBlockMapList());
+    }
+}
+
 void
 ReplayTestFixture::ExpectReplayOverwrittenBlockLog(StripeTestFixture stripe)
 {
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <list>
+
 #include "test/integration-tests/journal/utils/test_info.h"
 
 #include "test/integration-tests/journal/fake/mapper_mock.h"
@@ -25,6 +27,7 @@ public:
 
     void ExpectReplayOverwrittenBlockLog(StripeTestFixture stripe);
     void ExpectReplayFullStripe(StripeTestFixture stripe);
+    void ExpectReplayFullStripesInOrder(std::list<StripeTestFixture>& stripes);
 
     void ExpectReplayUnflushedActiveStripe(VirtualBlkAddr tail, StripeTestFixture stripe);
     void ExpectReplayFlushedActiveStripe(void);
@@ -35,4 +35,11 @@ JournalConfigurationSpy::SetLogBufferSize(uint64_t loadedBufferSize, MetaFsFileC
     return 0;
 }
 
+void
+JournalConfigurationSpy::SetNumLogStreams(int count)
+{
+    numLogStreams = count;
+    numLogGroups = count * 2;
+}
+
 } // namespace pos
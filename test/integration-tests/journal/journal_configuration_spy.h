@@ -12,5 +12,6 @@ public:
     virtual ~JournalConfigurationSpy(void);
 
     virtual int SetLogBufferSize(uint64_t logBufferSize = 0, MetaFsFileControlApi* metaFsCtrl = nullptr) override;
+    void SetNumLogStreams(int count);
 };
 } // namespace pos
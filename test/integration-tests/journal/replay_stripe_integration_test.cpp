@@ -116,6 +116,40 @@ TEST_F(ReplayStripeIntegrationTest, ReplayFullStripeSeveralTimes)
     EXPECT_TRUE(journal->DoRecoveryForTest() == 0);
 }
 
+TEST_F(ReplayStripeIntegrationTest, ReplayFullStripesOfVolumesInDifferentLogStreams)
+{
+    POS_TRACE_DEBUG(9999, "ReplayStripeIntegrationTest::ReplayFullStripesOfVolumesInDifferentLogStreams");
+
+    JournalConfigurationBuilder builder(testInfo);
+    builder.SetNumLogStreams(2);
+    InitializeJournal(builder.Build());
+
+    // The stripes of the two volumes go to different log streams, and are
+    // written one after another
+    int volumes[] = {testInfo->defaultTestVol, testInfo->defaultTestVol + 1};
+    std::list<StripeTestFixture> writtenStripes;
+    for (uint32_t vsid = 0; vsid < 6; vsid++)
+    {
+        StripeTestFixture stripe(vsid, volumes[vsid % 2]);
+        writeTester->GenerateLogsForStripe(stripe, 0, testInfo->numBlksPerStripe);
+        writeTester->WriteLogsForStripe(stripe);
+        writeTester->WaitForAllLogWriteDone();
+        writtenStripes.push_back(stripe);
+    }
+
+    SimulateSPORWithoutRecovery(builder.Build());
+
+    // The stripes are replayed in the order they were written, not stream by stream
+    replayTester->ExpectReturningUnmapStripes();
+    replayTester->ExpectReplayFullStripesInOrder(writtenStripes);
+    EXPECT_CALL(*(testAllocator->GetIContextReplayerMock()),
+        ResetActiveStripeTail(volumes[1]))
+        .Times(1);
+    replayTester->ExpectReplayFlushedActiveStripe();
+
+    EXPECT_TRUE(journal->DoRecoveryForTest() == 0);
+}
+
 TEST_F(ReplayStripeIntegrationTest, ReplaySeveralUnflushedStripe)
 {
     POS_TRACE_DEBUG(9999, "ReplayStripeIntegrationTest::ReplaySeveralUnflushedStripe");
@@ -11,7 +11,8 @@ JournalConfigurationBuilder::JournalConfigurationBuilder(TestInfo* testInfo)
   partitionSize(testInfo->metaPartitionSize),
   isRocksDBEnabled(false),
   rocksDBBasePath(""),
-  isVscEnabled(false)
+  isVscEnabled(false),
+  numLogStreams(1)
 {
 }
 
@@ -61,11 +62,19 @@ JournalConfigurationBuilder::SetRocksDBBasePath(std::string rocksDBBasePath)
     return this;
 }
 
+JournalConfigurationBuilder*
+JournalConfigurationBuilder::SetNumLogStreams(int numLogStreams)
+{
+    this->numLogStreams = numLogStreams;
+    return this;
+}
+
 JournalConfigurationSpy*
 JournalConfigurationBuilder::Build(void)
 {
     JournalConfigurationSpy* config = new JournalConfigurationSpy(isJournalEnabled, logBufferSize, metaPageSize,
         partitionSize, isRocksDBEnabled, rocksDBBasePath, isVscEnabled);
+    config->SetNumLogStreams(numLogStreams);
     return config;
 }
 
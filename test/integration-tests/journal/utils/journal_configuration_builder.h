@@ -17,6 +17,7 @@ public:
     JournalConfigurationBuilder* SetMaxPartitionSize(uint64_t partitionSize);
     JournalConfigurationBuilder* SetRocksDBEnable(uint64_t isRocksDBEnabled);
     JournalConfigurationBuilder* SetRocksDBBasePath(std::string rocksDBBasePath);
+    JournalConfigurationBuilder* SetNumLogStreams(int numLogStreams);
     JournalConfigurationSpy* Build(void);
 
 private:
@@ -27,5 +28,6 @@ private:
     bool isRocksDBEnabled;
     std::string rocksDBBasePath;
     bool isVscEnabled;
+    int numLogStreams;
 };
 } // namespace pos
@@ -45,7 +45,7 @@ MapIoHandlerTest::SetUp(void)
     _CreateRandVolume(0);
     _MountVolume(0);
     map = new Map(NUM_PAGES_IN_MAP, MPAGE_SIZE);
-    mapHeader = new MapHeader(new BitMap(NUM_PAGES_IN_MAP), new BitMap(NUM_PAGES_IN_MAP));
+    mapHeader = new MapHeader(new BitMap(NUM_PAGES_IN_MAP), new AtomicBitMap(NUM_PAGES_IN_MAP));
     mapIoHandler = new MapIoHandler(map, mapHeader, TEST_VOL_ID, 0);
 
     mapHeader->GetMpageMap()->ResetBitmap();
@@ -0,0 +1,130 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <boost/crc.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "src/metafs/config/metafs_config.h"
+#include "src/metafs/mim/mdpage.h"
+
+namespace pos
+{
+class MDPageCrcBenchmarkTest : public ::testing::Test
+{
+public:
+    virtual void SetUp(void) override
+    {
+        ASSERT_EQ(posix_memalign(&buf, PAGE_SIZE_IN_BYTES, PAGE_SIZE_IN_BYTES * PAGE_COUNT), 0);
+
+        std::mt19937 gen(0);
+        uint32_t* data = static_cast<uint32_t*>(buf);
+        for (size_t idx = 0; idx < PAGE_SIZE_IN_BYTES * PAGE_COUNT / sizeof(uint32_t); ++idx)
+        {
+            data[idx] = gen();
+        }
+    }
+    virtual void TearDown(void) override
+    {
+        free(buf);
+    }
+
+protected:
+    using Clock = std::chrono::steady_clock;
+
+    double _GetGBPerSecond(const Clock::time_point start, const Clock::time_point end, const size_t bytes)
+    {
+        double sec = std::chrono::duration<double>(end - start).count();
+        return (sec > 0) ? (bytes / sec / 1000000000) : 0;
+    }
+
+    static const size_t PAGE_SIZE_IN_BYTES = MetaFsIoConfig::META_PAGE_SIZE_IN_BYTES;
+    static const size_t PAGE_COUNT = 16384;
+    static const int ROUND = 8;
+    void* buf = nullptr;
+};
+
+TEST_F(MDPageCrcBenchmarkTest, CompareVerifiedBandwidthWithBoostCrc)
+{
+    std::vector<MDPage*> pages;
+    std::vector<uint32_t> expected;
+    for (size_t idx = 0; idx < PAGE_COUNT; ++idx)
+    {
+        pages.push_back(new MDPage((uint8_t*)buf + idx * PAGE_SIZE_IN_BYTES));
+    }
+    const size_t coveredSize = pages[0]->GetCrcCoveredSize();
+    const size_t totalBytes = coveredSize * PAGE_COUNT * ROUND;
+
+    Clock::time_point start = Clock::now();
+    for (int round = 0; round < ROUND; ++round)
+    {
+        expected.clear();
+        for (size_t idx = 0; idx < PAGE_COUNT; ++idx)
+        {
+            boost::crc_32_type result;
+            result.process_bytes((uint8_t*)buf + idx * PAGE_SIZE_IN_BYTES, coveredSize);
+            expected.push_back(result.checksum());
+        }
+    }
+    double boostRate = _GetGBPerSecond(start, Clock::now(), totalBytes);
+
+    size_t mismatched = 0;
+    start = Clock::now();
+    for (int round = 0; round < ROUND; ++round)
+    {
+        for (size_t idx = 0; idx < PAGE_COUNT; ++idx)
+        {
+            if (pages[idx]->GenerateCrcFromDataBuffer() != expected[idx])
+            {
+                mismatched++;
+            }
+        }
+    }
+    double mdpageRate = _GetGBPerSecond(start, Clock::now(), totalBytes);
+
+    std::cout << "[boost crc] " << boostRate << " GB/s verified" << std::endl;
+    std::cout << "[mdpage crc] " << mdpageRate << " GB/s verified" << std::endl;
+
+    // the on-disk crc must stay the same as what the previous versions wrote
+    EXPECT_EQ(mismatched, 0U);
+
+    for (auto page : pages)
+    {
+        delete page;
+    }
+}
+} // namespace pos
@@ -0,0 +1,184 @@
+#include <atomic>
+#include <chrono>
+#include <experimental/filesystem>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "src/include/smart_ptr_type.h"
+#include "src/journal_manager/log_buffer/buffer_write_done_notifier.h"
+#include "src/journal_manager/log_buffer/callback_sequence_controller.h"
+#include "src/journal_manager/log_buffer/journal_log_buffer.h"
+#include "src/journal_manager/log_buffer/log_buffer_io_context_factory.h"
+#include "src/journal_manager/log_buffer/log_write_context_factory.h"
+#include "src/journal_manager/log_buffer/log_write_io_context.h"
+#include "src/meta_file_intf/mock_file_intf.h"
+#include "src/rocksdb_log_buffer/rocksdb_log_buffer.h"
+#include "test/integration-tests/journal/log_buffer_integration_test.h"
+
+namespace pos
+{
+using ::testing::Return;
+
+// Compares log write throughput of journal log buffer on metafs and rocksdb log buffer.
+// Results are printed only, as they depend on the environment
+class RocksDBLogBufferBenchmarkTest : public ::testing::Test
+{
+public:
+    void WriteDone(AsyncMetaFileIoCtx* ctx);
+
+protected:
+    virtual void SetUp(void);
+    virtual void TearDown(void);
+
+    uint64_t _WriteLogs(IJournalLogBuffer* logBuffer, int numThreads);
+    void _WriteLogsOfThread(IJournalLogBuffer* logBuffer);
+    void _PrintResult(std::string name, int numThreads, uint64_t elapsedInUsec);
+    RocksDBLogBuffer* _CreateRocksDBLogBuffer(void);
+
+    const int NUM_LOG_GROUPS = 2;
+    const uint64_t LOG_BUFFER_SIZE = 16 * 1024 * 1024;
+    const uint64_t LOG_GROUP_SIZE = LOG_BUFFER_SIZE / NUM_LOG_GROUPS;
+    const int NUM_LOGS_PER_THREAD = 5000;
+    const std::string rocksdbPath = "/etc/pos/POSRaid";
+
+    NiceMock<MockJournalConfiguration> config;
+    LogWriteContextFactory factory;
+    LogBufferIoContextFactory ioContextFactory;
+
+    std::atomic<uint64_t> nextOffset;
+    std::atomic<uint64_t> numLogsWritten;
+};
+
+void
+RocksDBLogBufferBenchmarkTest::SetUp(void)
+{
+    std::experimental::filesystem::remove_all(rocksdbPath + "/" + GetLogDirName() + "_RocksJournal");
+
+    ON_CALL(config, IsEnabled).WillByDefault(Return(true));
+    ON_CALL(config, GetLogBufferSize).WillByDefault(Return(LOG_BUFFER_SIZE));
+    ON_CALL(config, GetLogGroupSize).WillByDefault(Return(LOG_GROUP_SIZE));
+    ON_CALL(config, GetNumLogGroups).WillByDefault(Return(NUM_LOG_GROUPS));
+    ON_CALL(config, GetRocksdbPath).WillByDefault(Return(rocksdbPath));
+
+    factory.Init(&config);
+    ioContextFactory.Init(&config, new LogBufferWriteDoneNotifier(), new CallbackSequenceController());
+}
+
+void
+RocksDBLogBufferBenchmarkTest::TearDown(void)
+{
+    std::experimental::filesystem::remove_all(rocksdbPath + "/" + GetLogDirName() + "_RocksJournal");
+}
+
+void
+RocksDBLogBufferBenchmarkTest::WriteDone(AsyncMetaFileIoCtx* ctx)
+{
+    LogWriteIoContext* ioContext = dynamic_cast<LogWriteIoContext*>(ctx);
+    if (ioContext != nullptr)
+    {
+        EXPECT_EQ(0, ioContext->GetError());
+        delete ioContext->GetLogWriteContext();
+    }
+    delete ctx;
+    numLogsWritten++;
+}
+
+uint64_t
+RocksDBLogBufferBenchmarkTest::_WriteLogs(IJournalLogBuffer* logBuffer, int numThreads)
+{
+    nextOffset = 0;
+    numLogsWritten = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for (int count = 0; count < numThreads; count++)
+    {
+        threads.push_back(std::thread(&RocksDBLogBufferBenchmarkTest::_WriteLogsOfThread, this, logBuffer));
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    uint64_t numLogsToWrite = numThreads * NUM_LOGS_PER_THREAD;
+    while (numLogsWritten != numLogsToWrite)
+    {
+        std::this_thread::yield();
+    }
+
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+}
+
+void
+RocksDBLogBufferBenchmarkTest::_WriteLogsOfThread(IJournalLogBuffer* logBuffer)
+{
+    auto callback = std::bind(&RocksDBLogBufferBenchmarkTest::WriteDone, this, std::placeholders::_1);
+
+    for (int count = 0; count < NUM_LOGS_PER_THREAD; count++)
+    {
+        VolumeIoSmartPtr volumeIo(new VolumeIo(nullptr, 0, 0));
+        volumeIo->SetSectorRba(count);
+        volumeIo->SetVolumeId(1);
+
+        EventSmartPtr event(new LogBufferWriteDone());
+        LogWriteContext* context = factory.CreateBlockMapLogWriteContext(volumeIo, event);
+
+        uint64_t offset = nextOffset.fetch_add(context->GetLogSize());
+        context->SetLogAllocated(offset / LOG_GROUP_SIZE, 0);
+
+        int result = logBuffer->WriteLog(context, offset, callback);
+        EXPECT_EQ(0, result);
+    }
+}
+
+void
+RocksDBLogBufferBenchmarkTest::_PrintResult(std::string name, int numThreads, uint64_t elapsedInUsec)
+{
+    uint64_t numLogs = numThreads * NUM_LOGS_PER_THREAD;
+    std::cout << name << " : " << numLogs << " logs by " << numThreads << " threads in "
+              << elapsedInUsec << " us (" << (numLogs * 1000000 / (elapsedInUsec + 1)) << " logs/s)" << std::endl;
+}
+
+RocksDBLogBuffer*
+RocksDBLogBufferBenchmarkTest::_CreateRocksDBLogBuffer(void)
+{
+    std::experimental::filesystem::remove_all(rocksdbPath + "/" + GetLogDirName() + "_RocksJournal");
+
+    RocksDBLogBuffer* logBuffer = new RocksDBLogBuffer(GetLogDirName());
+    logBuffer->Init(&config, &ioContextFactory, 0, nullptr);
+    EXPECT_EQ(0, logBuffer->Create(LOG_BUFFER_SIZE));
+    return logBuffer;
+}
+
+TEST_F(RocksDBLogBufferBenchmarkTest, WriteLog_compareThroughput)
+{
+    for (int numThreads : {1, 4, 8})
+    {
+        JournalLogBuffer journalLogBuffer(new MockFileIntf(GetLogFileName(), 0, MetaFileType::Journal));
+        journalLogBuffer.Delete();
+        ASSERT_EQ(0, journalLogBuffer.Create(LOG_BUFFER_SIZE));
+        journalLogBuffer.Init(&config, &ioContextFactory, 0, nullptr);
+        _PrintResult("JournalLogBuffer", numThreads, _WriteLogs(&journalLogBuffer, numThreads));
+        journalLogBuffer.Delete();
+        journalLogBuffer.Dispose();
+
+        ON_CALL(config, IsRocksdbWriteBatchEnabled).WillByDefault(Return(false));
+        RocksDBLogBuffer* rocksdbLogBuffer = _CreateRocksDBLogBuffer();
+        _PrintResult("RocksDBLogBuffer", numThreads, _WriteLogs(rocksdbLogBuffer, numThreads));
+        rocksdbLogBuffer->Dispose();
+        delete rocksdbLogBuffer;
+
+        ON_CALL(config, IsRocksdbWriteBatchEnabled).WillByDefault(Return(true));
+        rocksdbLogBuffer = _CreateRocksDBLogBuffer();
+        _PrintResult("RocksDBLogBuffer (batched)", numThreads, _WriteLogs(rocksdbLogBuffer, numThreads));
+        rocksdbLogBuffer->Dispose();
+        delete rocksdbLogBuffer;
+    }
+}
+
+} // namespace pos
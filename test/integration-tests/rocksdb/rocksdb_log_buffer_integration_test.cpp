@@ -3,6 +3,7 @@
 #include <time.h>
 
 #include <experimental/filesystem>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "src/journal_manager/log/block_write_done_log_handler.h"
@@ -351,6 +352,47 @@ TEST_F(RocksDBLogBufferIntegrationTest, WriteAndVerify)
     _CompareWithAdded(logs);
 }
 
+TEST_F(RocksDBLogBufferIntegrationTest, WriteBatchAndVerify)
+{
+    // Given : logs are written with a write batch
+    ON_CALL(config, IsRocksdbWriteBatchEnabled).WillByDefault(Return(true));
+    auto callback = std::bind(&RocksDBLogBufferIntegrationTest::WriteDone, this, std::placeholders::_1);
+
+    std::vector<LogWriteContext*> contexts;
+    contexts.push_back(_CreateContextForBlockWriteDoneLog());
+    contexts.push_back(_CreateContextForStripeMapUpdatedLog());
+    contexts.push_back(_CreateContextForGcBlockWriteDoneLog());
+    contexts.push_back(_CreateContextForGcStripeFlushedLog());
+    for (auto context : contexts)
+    {
+        context->SetLogAllocated(0, 0);
+        _AddToList(context);
+    }
+
+    // When
+    EXPECT_TRUE(journalRocks->WriteLogs(contexts, 0, callback) == 0);
+    _WaitForLogWriteDone(addedLogs.size());
+
+    LogWriteContext* context = _CreateContextForBlockWriteDoneLog();
+    context->SetLogAllocated(0, 0);
+    uint64_t offset = 0;
+    for (auto written : contexts)
+    {
+        offset += written->GetLogSize();
+    }
+    EXPECT_TRUE(journalRocks->WriteLog(context, offset, callback) == 0);
+    _AddToList(context);
+    _WaitForLogWriteDone(addedLogs.size());
+
+    SimulateSPOR();
+
+    // Then : all the logs are read in the order of the offset
+    LogList logs;
+    EXPECT_TRUE(_ParseLogBuffer(0, logs) == 0);
+
+    _CompareWithAdded(logs);
+}
+
 TEST_F(RocksDBLogBufferIntegrationTest, ParseLogBuffer)
 {
     uint64_t offset = 0;
@@ -0,0 +1,223 @@
+import graph
+import iogen
+import json
+import lib
+import node
+import rsfmt
+import threading
+import time
+import traceback
+import urllib.request
+
+
+# Gauges sampled from pos-exporter every second during the overwrite phase
+TIMELINE_METRICS = [
+    "read_iops_volume",
+    "write_iops_volume",
+    "write_avg_lat_volume",
+    "alct_free_seg_cnt",
+    "gc_stripe_count_completed",
+    "flow_control_user_token",
+    "flow_control_gc_token",
+    "flow_control_rejected_count",
+    "array_write_amplification_x100",
+]
+
+EXPORTER_PORT = 2112
+DEFAULT_FILL_PERCENT = 100
+DEFAULT_OVERWRITE_SECONDS = 3600
+# a second whose host write iops falls below this share of the average before gc is a cliff
+CLIFF_RATIO = 0.5
+
+
+def scrape(address):
+    # sums over the label sets (volumes, arrays, types) of each metric
+    values = {}
+    url = f"http://{address}:{EXPORTER_PORT}/metrics"
+    with urllib.request.urlopen(url, timeout=1) as response:
+        for line in response.read().decode().splitlines():
+            if line.startswith("#"):
+                continue
+            name = line.split("{", 1)[0].split(" ", 1)[0]
+            if name in TIMELINE_METRICS:
+                values[name] = values.get(name, 0.0) + float(line.rsplit(" ", 1)[1])
+    return values
+
+
+class TimelineRecorder(threading.Thread):
+    def __init__(self, address, interval=1.0):
+        super().__init__(daemon=True)
+        self.address = address
+        self.interval = interval
+        self.samples = []
+        self.stop_event = threading.Event()
+
+    def run(self):
+        start = time.time()
+        next_tick = start
+        while not self.stop_event.is_set():
+            try:
+                sample = scrape(self.address)
+                sample["second"] = round(time.time() - start)
+                self.samples.append(sample)
+            except Exception as e:
+                lib.printer.red(f" telemetry sample failed: {e}")
+            next_tick += self.interval
+            self.stop_event.wait(max(0, next_tick - time.time()))
+
+    def stop(self):
+        self.stop_event.set()
+        self.join()
+
+
+def build_timeline(samples):
+    # gc copy rate comes from the difference of the completed gc stripes between samples
+    timeline = []
+    previous = None
+    for sample in samples:
+        row = {"second": sample["second"]}
+        for metric in TIMELINE_METRICS:
+            row[metric] = sample.get(metric, 0)
+        row["gc_stripes_per_sec"] = 0
+        if previous is not None and sample["second"] > previous["second"]:
+            completed = sample.get("gc_stripe_count_completed", 0) - previous.get("gc_stripe_count_completed", 0)
+            row["gc_stripes_per_sec"] = max(0, completed) / (sample["second"] - previous["second"])
+        row["waf"] = row["array_write_amplification_x100"] / 100.0
+        timeline.append(row)
+        previous = sample
+    return timeline
+
+
+def percentile(values, ratio):
+    if not values:
+        return 0
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(len(ordered) * ratio))]
+
+
+def summarize(timeline):
+    gc_rows = [row for row in timeline if row["gc_stripes_per_sec"] > 0]
+    pre_gc = [row["write_iops_volume"] for row in timeline if not gc_rows or row["second"] < gc_rows[0]["second"]]
+    pre_gc_iops = sum(pre_gc) / len(pre_gc) if pre_gc else 0
+    # the last half of the run is taken as the steady state
+    steady = timeline[len(timeline) // 2:]
+    steady_iops = [row["write_iops_volume"] for row in steady]
+    steady_lat = [row["write_avg_lat_volume"] for row in steady]
+    cliffs = [row["second"] for row in timeline
+              if pre_gc_iops > 0 and row["write_iops_volume"] < pre_gc_iops * CLIFF_RATIO]
+    return {
+        "seconds": len(timeline),
+        "gc_start_second": gc_rows[0]["second"] if gc_rows else None,
+        "pre_gc_write_iops": pre_gc_iops,
+        "steady_write_iops_avg": sum(steady_iops) / len(steady_iops) if steady_iops else 0,
+        "steady_write_iops_p1": percentile(steady_iops, 0.01),
+        "steady_write_lat_avg_p50": percentile(steady_lat, 0.5),
+        "steady_write_lat_avg_p99": percentile(steady_lat, 0.99),
+        "min_free_segments": min([row["alct_free_seg_cnt"] for row in timeline], default=0),
+        "steady_gc_stripes_per_sec": sum(row["gc_stripes_per_sec"] for row in steady) / len(steady) if steady else 0,
+        "final_waf": timeline[-1]["waf"] if timeline else 0,
+        "cliff_seconds": len(cliffs),
+        "first_cliff_second": cliffs[0] if cliffs else None,
+    }
+
+
+def write_report(file_prefix, label, timeline, summary):
+    with open(f"{file_prefix}_timeline.csv", "w") as f:
+        columns = ["second"] + TIMELINE_METRICS + ["gc_stripes_per_sec", "waf"]
+        f.write(",".join(columns) + "\n")
+        for row in timeline:
+            f.write(",".join(str(row[column]) for column in columns) + "\n")
+    with open(f"{file_prefix}_report.json", "w") as f:
+        json.dump({"label": label, "summary": summary}, f, indent=2)
+    lib.printer.green(f" gc steady-state report ({label})")
+    for key, value in summary.items():
+        print(f"   {key}: {value}")
+
+
+def run_fio(initiators, timestamp, test_case, scenario, result_fmt, grapher):
+    # setup fio_cmd
+    fio_cmd_list = []
+    for key in initiators:
+        fio_cmd = iogen.fio.Fio(initiators[key], timestamp)
+        fio_cmd.initialize()
+        fio_cmd.update(test_case)
+        fio_cmd_list.append(fio_cmd.stringify())
+
+    # run fio
+    lib.printer.green(f" run -> {timestamp} {test_case['name']}")
+    result_fmt.start_test(test_case["name"])
+    lib.subproc.sync_parallel_run(fio_cmd_list, True)
+
+    # copy output
+    for key in initiators:
+        initiators[key].copy_output(
+            timestamp, test_case["name"], scenario["OUTPUT_DIR"])
+
+    # set result status (& message)
+    result_fmt.end_test(test_case["name"], "pass")
+
+    # draw graph
+    for key in initiators:
+        grapher.draw(initiators[key], test_case["name"])
+
+
+def play(tgts, inits, scenario, timestamp, data):
+    try:  # Prepare sequence
+        node_manager = node.NodeManager(tgts, inits)
+        targets, initiators = node_manager.initialize()
+
+        fill_percent = scenario.get("FILL_PERCENT", DEFAULT_FILL_PERCENT)
+        overwrite_seconds = scenario.get("OVERWRITE_SECONDS", DEFAULT_OVERWRITE_SECONDS)
+        label = scenario.get("LABEL", scenario["NAME"])
+
+        # per second fio logs give the host side of the timeline
+        test_case_list = [
+            {"name": "0_fill", "rw": "write", "bs": "128k", "iodepth": "4", "io_size": f"{fill_percent}%",
+                "time_based": "0", "runtime": "0", "log_avg_msec": "30000"},
+            {"name": "1_overwrite", "rw": "randwrite", "bs": scenario.get("BS", "4k"), "iodepth": "128",
+                "time_based": "1", "runtime": str(overwrite_seconds), "log_avg_msec": "1000"},
+        ]
+
+        lib.subproc.sync_run("./bin/poseidonos-cli telemetry start")
+        grapher = graph.manager.Grapher(scenario, timestamp)
+        result_fmt = rsfmt.manager.Formatter(scenario, timestamp)
+        result_fmt.add_test_cases([tc['name'] for tc in test_case_list])
+    except Exception as e:
+        lib.printer.red(traceback.format_exc())
+        return data
+
+    try:  # Test sequence
+        run_fio(initiators, timestamp, test_case_list[0], scenario, result_fmt, grapher)
+
+        recorder = TimelineRecorder(tgts[0]["NIC"]["SSH"])
+        recorder.start()
+        try:
+            run_fio(initiators, timestamp, test_case_list[1], scenario, result_fmt, grapher)
+        finally:
+            recorder.stop()
+
+        timeline = build_timeline(recorder.samples)
+        write_report(f"{scenario['OUTPUT_DIR']}/{timestamp}_gc_steady", label, timeline, summarize(timeline))
+    except Exception as e:
+        lib.printer.red(traceback.format_exc())
+
+    try:  # Wrapup sequence
+        result_fmt.write_file()
+        node_manager.finalize()
+    except Exception as e:
+        lib.printer.red(traceback.format_exc())
+
+    return data
+
+
+# Compares the reports of two runs, e.g. before and after a gc policy change:
+#   python3 fio_gc_steady.py <base_report.json> <new_report.json>
+if __name__ == "__main__":
+    import sys
+    with open(sys.argv[1], "r") as f:
+        base = json.load(f)
+    with open(sys.argv[2], "r") as f:
+        new = json.load(f)
+    print(f"{'':28} {base['label']:>16} {new['label']:>16}")
+    for key, value in base["summary"].items():
+        print(f"{key:28} {str(value):>16} {str(new['summary'].get(key)):>16}")
@@ -0,0 +1,220 @@
+import graph
+import iogen
+import json
+import lib
+import node
+import os
+import rsfmt
+import time
+import traceback
+import urllib.request
+
+
+# Standard profiles of the regression run. Every profile is measured against
+# the baseline, the "prepare" ones only bring the array into the state the
+# following profiles expect (e.g. GC steady-state after a 2x device fill).
+TEST_CASE_LIST = [
+    {"name": "00_fill_seq", "rw": "write", "bs": "128k", "iodepth": "4", "io_size": "100%",
+        "time_based": "0", "runtime": "0", "log_avg_msec": "30000", "prepare": True},
+    {"name": "01_sw_128k", "rw": "write", "bs": "128k", "iodepth": "4",
+        "time_based": "1", "runtime": "120", "log_avg_msec": "2000"},
+    {"name": "02_sr_128k", "rw": "read", "bs": "128k", "iodepth": "4",
+        "time_based": "1", "runtime": "120", "log_avg_msec": "2000"},
+    {"name": "03_rr_4k_qd1", "rw": "randread", "bs": "4k", "iodepth": "1",
+        "time_based": "1", "runtime": "120", "log_avg_msec": "2000"},
+    {"name": "04_rr_4k_qd128", "rw": "randread", "bs": "4k", "iodepth": "128",
+        "time_based": "1", "runtime": "120", "log_avg_msec": "2000"},
+    {"name": "05_rw_4k_qd1", "rw": "randwrite", "bs": "4k", "iodepth": "1",
+        "time_based": "1", "runtime": "120", "log_avg_msec": "2000"},
+    {"name": "06_rw_4k_qd128", "rw": "randwrite", "bs": "4k", "iodepth": "128",
+        "time_based": "1", "runtime": "120", "log_avg_msec": "2000"},
+    {"name": "07_mix_70_30", "rw": "randrw", "rwmixread": "70", "bs": "4k", "iodepth": "128",
+        "time_based": "1", "runtime": "120", "log_avg_msec": "2000"},
+    {"name": "08_fill_rand", "rw": "randwrite", "bs": "4k", "iodepth": "128", "io_size": "100%",
+        "time_based": "0", "runtime": "0", "log_avg_msec": "30000", "prepare": True},
+    {"name": "09_gc_steady", "rw": "randwrite", "bs": "4k", "iodepth": "128",
+        "time_based": "1", "runtime": "600", "log_avg_msec": "10000"},
+    {"name": "10_degraded_rr", "rw": "randread", "bs": "4k", "iodepth": "128",
+        "time_based": "1", "runtime": "120", "log_avg_msec": "2000", "degraded": True},
+    {"name": "11_rebuild_mix", "rw": "randrw", "rwmixread": "70", "bs": "4k", "iodepth": "128",
+        "time_based": "1", "runtime": "120", "log_avg_msec": "2000", "rebuild": True},
+]
+
+# Metrics compared to the baseline and whether a larger value is better.
+METRICS = {
+    "iops": True,
+    "bw_kib": True,
+    "lat_p50_us": False,
+    "lat_p99_us": False,
+    "lat_p999_us": False,
+    "reactor_busy_percent": False,
+}
+
+DEFAULT_BASELINE = "./test/system/benchmark/baseline/fio_regression.json"
+DEFAULT_TOLERANCE_PERCENT = 10
+EXPORTER_PORT = 2112
+
+
+def load_fio_json(file):
+    with open(file, "r") as f:
+        text = f.read()
+    # fio may print warnings before the json body
+    return json.loads(text[text.find("{"):])
+
+
+def summarize_fio(results):
+    summary = {"iops": 0.0, "bw_kib": 0.0, "lat_p50_us": 0.0, "lat_p99_us": 0.0, "lat_p999_us": 0.0}
+    for result in results:
+        for job in result["jobs"]:
+            for direction in ["read", "write"]:
+                io = job[direction]
+                if io["total_ios"] == 0:
+                    continue
+                summary["iops"] += io["iops"]
+                summary["bw_kib"] += io["bw"]
+                percentile = io["clat_ns"].get("percentile", {})
+                # the slowest job determines the latency of the run
+                for key, pct in [("lat_p50_us", "50.000000"), ("lat_p99_us", "99.000000"),
+                                 ("lat_p999_us", "99.900000")]:
+                    summary[key] = max(summary[key], percentile.get(pct, 0) / 1000.0)
+    return summary
+
+
+def scrape_reactor_busy(address):
+    # per-core CPU usage comes from the reactor busy ratio published to pos-exporter
+    url = f"http://{address}:{EXPORTER_PORT}/metrics"
+    per_core = {}
+    with urllib.request.urlopen(url, timeout=5) as response:
+        for line in response.read().decode().splitlines():
+            if not line.startswith("reactor_busy_percent{"):
+                continue
+            labels, value = line.rsplit(" ", 1)
+            for label in labels[labels.find("{") + 1:labels.rfind("}")].split(","):
+                key, _, val = label.partition("=")
+                if key == "reactor":
+                    per_core[val.strip('"')] = float(value)
+    return per_core
+
+
+def compare(name, measured, baseline, tolerance):
+    regressions = []
+    if name not in baseline:
+        return regressions
+    for metric, higher_is_better in METRICS.items():
+        if metric not in measured or metric not in baseline[name] or baseline[name][metric] == 0:
+            continue
+        expected = baseline[name][metric]
+        change = (measured[metric] - expected) * 100.0 / expected
+        if (higher_is_better and change < -tolerance) or (not higher_is_better and change > tolerance):
+            regressions.append(f"{metric}: {measured[metric]:.1f} (baseline {expected:.1f}, {change:+.1f}%)")
+    return regressions
+
+
+def play(tgts, inits, scenario, timestamp, data):
+    try:  # Prepare sequence
+        node_manager = node.NodeManager(tgts, inits)
+        targets, initiators = node_manager.initialize()
+
+        baseline_file = scenario.get("BASELINE", DEFAULT_BASELINE)
+        tolerance = scenario.get("TOLERANCE_PERCENT", DEFAULT_TOLERANCE_PERCENT)
+        update_baseline = scenario.get("UPDATE_BASELINE", "no") == "yes"
+        array_name = scenario.get("ARRAY_NAME", "ARR0")
+        with open(baseline_file, "r") as f:
+            baseline = json.load(f)
+
+        os.system("./bin/poseidonos-cli telemetry start")
+        grapher = graph.manager.Grapher(scenario, timestamp)
+        result_fmt = rsfmt.manager.Formatter(scenario, timestamp)
+        result_fmt.add_test_cases([tc["name"] for tc in TEST_CASE_LIST])
+    except Exception as e:
+        lib.printer.red(traceback.format_exc())
+        return data
+
+    measured = {}
+    failed = []
+    try:  # Test sequence
+        for test_case in TEST_CASE_LIST:
+            if test_case.get("degraded"):
+                for key in targets:
+                    targets[key].pcie_scan()
+                    targets[key].detach_device(scenario["DETACH_DEVICE"])
+            if test_case.get("rebuild"):
+                os.system(f"./bin/poseidonos-cli array addspare --spare {scenario['SPARE_DEVICE']} "
+                          f"--array-name {array_name}")
+                time.sleep(scenario.get("WAIT_AFTER_SPARE", 10))
+
+            # setup fio_cmd
+            fio_case = {k: v for k, v in test_case.items() if k not in ["prepare", "degraded", "rebuild"]}
+            fio_cmd_list = []
+            for key in initiators:
+                fio_cmd = iogen.fio.Fio(initiators[key], timestamp)
+                fio_cmd.initialize()
+                fio_cmd.update(fio_case)
+                fio_cmd_list.append(fio_cmd.stringify())
+
+            # run fio
+            lib.printer.green(f" run -> {timestamp} {test_case['name']}")
+            result_fmt.start_test(test_case["name"])
+            lib.subproc.sync_parallel_run(fio_cmd_list, True)
+
+            # copy output
+            for key in initiators:
+                initiators[key].copy_output(
+                    timestamp, test_case["name"], scenario["OUTPUT_DIR"])
+
+            # get result
+            fio_results = []
+            for key in initiators:
+                file = (
+                    f"{scenario['OUTPUT_DIR']}/{timestamp}_"
+                    f"{test_case['name']}_{key}"
+                )
+                fio_results.append(load_fio_json(file))
+            summary = summarize_fio(fio_results)
+            for tgt in tgts:
+                try:
+                    per_core = scrape_reactor_busy(tgt["NIC"]["SSH"])
+                    summary["per_core_busy_percent"] = per_core
+                    if per_core:
+                        summary["reactor_busy_percent"] = sum(per_core.values()) / len(per_core)
+                except Exception as e:
+                    lib.printer.red(f" telemetry is not available from {tgt['NAME']}: {e}")
+            print(json.dumps(summary, indent=2))
+
+            # set result status (& message)
+            status = "pass"
+            if not test_case.get("prepare"):
+                measured[test_case["name"]] = summary
+                regressions = compare(test_case["name"], summary, baseline.get("profiles", {}), tolerance)
+                if regressions:
+                    status = "fail"
+                    failed.append(test_case["name"])
+                    for regression in regressions:
+                        lib.printer.red(f" regression -> {test_case['name']} {regression}")
+            result_fmt.end_test(test_case["name"], status)
+
+            # draw graph
+            for key in initiators:
+                grapher.draw(initiators[key], test_case["name"])
+
+            if test_case.get("rebuild"):
+                for key in targets:
+                    targets[key].check_rebuild_complete(array_name)
+
+    except Exception as e:
+        lib.printer.red(traceback.format_exc())
+
+    try:  # Wrapup sequence
+        with open(f"{scenario['OUTPUT_DIR']}/{timestamp}_regression.json", "w") as f:
+            json.dump({"failed": failed, "profiles": measured}, f, indent=2)
+        if update_baseline:
+            baseline["profiles"] = measured
+            with open(baseline_file, "w") as f:
+                json.dump(baseline, f, indent=4)
+            lib.printer.green(f" baseline updated -> {baseline_file}")
+        result_fmt.write_file()
+        node_manager.finalize()
+    except Exception as e:
+        lib.printer.red(traceback.format_exc())
+
+    return data
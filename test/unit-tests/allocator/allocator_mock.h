@@ -27,6 +27,7 @@ public:
     MOCK_METHOD(IContextManager*, GetIContextManager, (), (override));
     MOCK_METHOD(IContextReplayer*, GetIContextReplayer, (), (override));
     MOCK_METHOD(ISegmentCtx*, GetISegmentCtx, (), (override));
+    MOCK_METHOD(void, StartSegmentTrim, (), (override));
 };
 
 } // namespace pos
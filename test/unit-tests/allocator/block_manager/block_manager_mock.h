@@ -14,8 +14,9 @@ class MockBlockManager : public BlockManager
 public:
     using BlockManager::BlockManager;
     MOCK_METHOD(void, Init, (StripeManager * stripeManager), (override));
-    MOCK_METHOD((std::pair<VirtualBlks, StripeId>), AllocateWriteBufferBlks, (uint32_t volumeId, uint32_t numBlks), (override));
+    MOCK_METHOD((std::pair<VirtualBlks, StripeId>), AllocateWriteBufferBlks, (uint32_t volumeId, uint32_t numBlks, uint32_t originCore, WriteStreamType stream), (override));
     MOCK_METHOD(StripeSmartPtr, AllocateGcDestStripe, (uint32_t volumeId), (override));
+    MOCK_METHOD(StripeSmartPtr, AllocateGcColdDestStripe, (uint32_t volumeId), (override));
     MOCK_METHOD(void, ProhibitUserBlkAlloc, (), (override));
     MOCK_METHOD(bool, IsProhibitedUserBlkAlloc, (), (override));
     MOCK_METHOD(void, PermitUserBlkAlloc, (), (override));
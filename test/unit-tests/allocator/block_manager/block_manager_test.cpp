@@ -2,7 +2,10 @@
 
 #include <gtest/gtest.h>
 
+#include <map>
+
 #include "src/allocator/address/allocator_address_info.h"
+#include "src/cpu_affinity/affinity_manager.h"
 #include "src/include/address_type.h"
 #include "test/unit-tests/allocator/block_manager/block_manager_spy.h"
 #include "test/unit-tests/allocator/context_manager/allocator_ctx/allocator_ctx_mock.h"
@@ -92,23 +95,58 @@ TEST_F(BlockManagerTestFixture, AllocateWriteBufferBlks_testAllocationWhenActive
         .WillOnce(Return(true));
 
     // when 1.
-    auto ret = blockManager->AllocateWriteBufferBlks(0, 1);
+    auto ret = blockManager->AllocateWriteBufferBlks(0, 1, 0, WRITE_STREAM_MIXED);
     // then 1.
     EXPECT_EQ(1, ret.first.numBlks);
 
     // when 2. block allocation is prohibited
     blockManager->ProhibitUserBlkAlloc();
-    ret = blockManager->AllocateWriteBufferBlks(0, 1);
+    ret = blockManager->AllocateWriteBufferBlks(0, 1, 0, WRITE_STREAM_MIXED);
     // then 2.
     EXPECT_EQ(UNMAP_VSA, ret.first.startVsa);
 
     // when 3. block allocation of volume 0 is blocked
     blockManager->BlockAllocating(0);
-    ret = blockManager->AllocateWriteBufferBlks(0, 1);
+    ret = blockManager->AllocateWriteBufferBlks(0, 1, 0, WRITE_STREAM_MIXED);
     // then 3.
     EXPECT_EQ(UNMAP_VSA, ret.first.startVsa);
 }
 
+TEST_F(BlockManagerTestFixture, AllocateWriteBufferBlks_testIfEachOriginCoreUsesItsOwnActiveStripeTail)
+{
+    // given
+    uint32_t volumeId = 3;
+    VirtualBlkAddr vsa = {
+        .stripeId = 0,
+        .offset = 0};
+    EXPECT_CALL(blockAllocationStatus, IsUserBlockAllocationProhibited).WillRepeatedly(Return(false));
+
+    // then: the tails of the same volume are chosen by the origin core of the io
+    // and by its numa node
+    AffinityManager* affinityManager = AffinityManagerSingleton::Instance();
+    std::map<ASTailArrayIdx, int> expectedCount;
+    for (uint32_t core = 0; core < ACTIVE_STRIPE_TAIL_COUNT_PER_VOLUME; core++)
+    {
+        ASTailArrayIdx expected = GetActiveStripeTailIndex(volumeId, core,
+            affinityManager->GetNumaIdFromCoreId(core), affinityManager->GetNumaCount());
+        EXPECT_EQ(volumeId, GetVolumeIdOfActiveStripeTail(expected));
+        expectedCount[expected]++;
+    }
+    for (auto& entry : expectedCount)
+    {
+        EXPECT_CALL(allocCtx, GetActiveStripeTailLock(entry.first)).Times(entry.second).WillRepeatedly(ReturnRef(wbLock));
+        EXPECT_CALL(allocCtx, GetActiveStripeTail(entry.first)).WillRepeatedly(Return(vsa));
+        EXPECT_CALL(allocCtx, SetActiveStripeTail(entry.first, _)).Times(entry.second);
+    }
+
+    // when
+    for (uint32_t core = 0; core < ACTIVE_STRIPE_TAIL_COUNT_PER_VOLUME; core++)
+    {
+        auto ret = blockManager->AllocateWriteBufferBlks(volumeId, 1, core, WRITE_STREAM_MIXED);
+        EXPECT_EQ(1, ret.first.numBlks);
+    }
+}
+
 TEST_F(BlockManagerTestFixture, ProhibitUserBlkAlloc_TestSimpleSetter)
 {
     // then
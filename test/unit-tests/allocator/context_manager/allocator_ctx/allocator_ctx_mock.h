@@ -26,6 +26,7 @@ public:
     MOCK_METHOD(void, SetCurrentSsdLsid, (StripeId stripe), (override));
     MOCK_METHOD(StripeId, GetCurrentSsdLsid, (), (override));
     MOCK_METHOD(void, SetNextSsdLsid, (SegmentId segId), (override));
+    MOCK_METHOD(uint32_t, GetFooterBlksPerStripe, (), (override));
     MOCK_METHOD(void, AllocWbStripe, (StripeId stripeId), (override));
     MOCK_METHOD(StripeId, AllocFreeWbStripe, (), (override));
     MOCK_METHOD(void, ReleaseWbStripe, (StripeId stripeId), (override));
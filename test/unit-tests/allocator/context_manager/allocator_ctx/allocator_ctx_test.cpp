@@ -1,6 +1,8 @@
 #include "src/allocator/context_manager/allocator_ctx/allocator_ctx.h"
 
 #include <gtest/gtest.h>
+#include <cstring>
+#include <set>
 
 #include "src/allocator/address/allocator_address_info.h"
 #include "test/unit-tests/allocator/address/allocator_address_info_mock.h"
@@ -36,6 +38,71 @@ TEST(AllocatorCtx, AfterLoad_TestCheckingSignatureSuccess)
     delete allocBitmap;
 }
 
+TEST(AllocatorCtx, AfterLoad_testIfHeaderWrittenWithoutFooterLayoutDisablesFooter)
+{
+    // given: a header stored before the footer layout, with arbitrary bytes in its tail padding
+    char* buf = new char[sizeof(AllocatorCtxHeader)];
+    memset(buf, 0xAB, sizeof(AllocatorCtxHeader));
+    AllocatorCtxHeader* oldHeader = reinterpret_cast<AllocatorCtxHeader*>(buf);
+    oldHeader->sig = AllocatorCtx::SIG_ALLOCATOR_CTX;
+    oldHeader->ctxVersion = 3;
+    oldHeader->numValidWbLsid = 10;
+    NiceMock<MockBitMapMutex> allocBitmap(100);
+    AllocatorCtx allocCtx(nullptr, nullptr, &allocBitmap, nullptr);
+
+    // when
+    memcpy(allocCtx.GetSectionAddr(AC_HEADER), buf, allocCtx.GetSectionSize(AC_HEADER));
+    allocCtx.AfterLoad(buf);
+
+    // then: the array has no footer, and the layout is stored with the signature
+    EXPECT_EQ(0, allocCtx.GetFooterBlksPerStripe());
+    AllocatorCtxHeader* header = reinterpret_cast<AllocatorCtxHeader*>(allocCtx.GetSectionAddr(AC_HEADER));
+    uint16_t expectedSig = AllocatorCtxHeader::SIG_FOOTER_LAYOUT;
+    EXPECT_EQ(expectedSig, header->footerLayoutSig);
+    EXPECT_EQ(0, header->footerBlksPerStripe);
+
+    delete[] buf;
+}
+
+TEST(AllocatorCtx, AfterLoad_testIfStoredFooterLayoutIsKept)
+{
+    // given
+    AllocatorCtxHeader* buf = new AllocatorCtxHeader();
+    buf->sig = AllocatorCtx::SIG_ALLOCATOR_CTX;
+    buf->footerLayoutSig = AllocatorCtxHeader::SIG_FOOTER_LAYOUT;
+    buf->footerBlksPerStripe = 2;
+    NiceMock<MockBitMapMutex> allocBitmap(100);
+    AllocatorCtx allocCtx(nullptr, nullptr, &allocBitmap, nullptr);
+
+    // when
+    memcpy(allocCtx.GetSectionAddr(AC_HEADER), buf, allocCtx.GetSectionSize(AC_HEADER));
+    allocCtx.AfterLoad((char*)buf);
+
+    // then
+    EXPECT_EQ(2, allocCtx.GetFooterBlksPerStripe());
+
+    delete buf;
+}
+
+TEST(AllocatorCtx, Init_testIfFooterLayoutOfNewArrayIsStored)
+{
+    // given
+    AllocatorAddressInfo addrInfo;
+    addrInfo.SetnumWbStripes(10);
+    addrInfo.SetfooterBlksPerStripe(2);
+    AllocatorCtx allocCtx(nullptr, &addrInfo);
+
+    // when
+    allocCtx.Init();
+
+    // then
+    EXPECT_EQ(2, allocCtx.GetFooterBlksPerStripe());
+    AllocatorCtxHeader* header = reinterpret_cast<AllocatorCtxHeader*>(allocCtx.GetSectionAddr(AC_HEADER));
+    uint16_t expectedSig = AllocatorCtxHeader::SIG_FOOTER_LAYOUT;
+    EXPECT_EQ(expectedSig, header->footerLayoutSig);
+    allocCtx.Dispose();
+}
+
 TEST(AllocatorCtx, GetStoredVersion_TestSimpleGetter)
 {
     // given
@@ -256,6 +323,37 @@ TEST(AllocatorCtx, AllocFreeWbStripe_TestAllocStripeWithConditions)
     delete allocBitmap;
 }
 
+TEST(AllocatorCtx, AllocFreeWbStripe_testIfReleasedStripeIsReusedAndAllocatedOnesAreSkipped)
+{
+    // given
+    AllocatorAddressInfo addrInfo;
+    addrInfo.SetnumUserAreaSegments(10);
+    addrInfo.SetnumWbStripes(8);
+    AllocatorCtx allocCtx(nullptr, &addrInfo);
+    allocCtx.Init();
+    allocCtx.AllocWbStripe(0);
+
+    // when 1. every free stripe is allocated
+    std::set<StripeId> allocated;
+    for (int i = 0; i < 7; i++)
+    {
+        allocated.insert(allocCtx.AllocFreeWbStripe());
+    }
+
+    // then 1. stripe 0, allocated by replay, is not handed out again
+    EXPECT_EQ(7u, allocated.size());
+    EXPECT_EQ(0u, allocated.count(0));
+    EXPECT_EQ(UNMAP_STRIPE, allocCtx.AllocFreeWbStripe());
+
+    // when 2.
+    allocCtx.ReleaseWbStripe(3);
+
+    // then 2.
+    EXPECT_EQ(3u, allocCtx.AllocFreeWbStripe());
+    EXPECT_EQ(UNMAP_STRIPE, allocCtx.AllocFreeWbStripe());
+    allocCtx.Dispose();
+}
+
 TEST(AllocatorCtx, ReleaseWbStripe_TestSimpleSetter)
 {
     // given
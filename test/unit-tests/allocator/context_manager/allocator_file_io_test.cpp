@@ -330,6 +330,68 @@ TEST(AllocatorFileIo, Flush_testFlushFail)
     }
 }
 
+TEST(AllocatorFileIo, Flush_testIfOnlyChangedUnitsAreWrittenAfterTheFirstFlush)
+{
+    NiceMock<MockIAllocatorFileIoClient> client;
+    NiceMock<AllocatorAddressInfo> addrInfo;
+    NiceMock<MockMetaFileIntf>* file = new NiceMock<MockMetaFileIntf>("aa", "bb", MetaFileType::Map);
+    AllocatorFileIo fileManager(ALLOCATOR_CTX, &client, &addrInfo, file);
+
+    const int unitSize = 4096;
+    const int dataSize = 4 * unitSize;
+    CtxHeader* header = new CtxHeader();
+    header->sig = 0xAFAFAFAF;
+    char* data = new char[dataSize]();
+
+    ON_CALL(client, GetNumSections).WillByDefault(Return(2));
+    ON_CALL(client, GetSignature).WillByDefault(Return(0xAFAFAFAF));
+    ON_CALL(client, GetSectionAddr(0)).WillByDefault(Return((char*)header));
+    ON_CALL(client, GetSectionSize(0)).WillByDefault(Return(sizeof(CtxHeader)));
+    ON_CALL(client, GetSectionAddr(1)).WillByDefault(Return(data));
+    ON_CALL(client, GetSectionSize(1)).WillByDefault(Return(dataSize));
+    fileManager.Init();
+
+    std::mutex lock;
+    ON_CALL(client, GetCtxLock).WillByDefault(ReturnRef(lock));
+
+    std::vector<std::pair<uint64_t, uint64_t>> issued;
+    ON_CALL(*file, AsyncIO).WillByDefault([&](AsyncMetaFileIoCtx* ctx)
+        {
+            issued.push_back({ctx->GetFileOffset(), ctx->GetLength()});
+            ctx->HandleIoComplete(ctx);
+            return 0;
+        });
+
+    int callbackCount = 0;
+    auto testCallback = [&]() { callbackCount++; };
+    uint64_t fileSize = sizeof(CtxHeader) + dataSize;
+
+    // when 1. the first flush writes the whole file
+    EXPECT_EQ(0, fileManager.Flush(testCallback, -1));
+
+    // then 1.
+    ASSERT_EQ(1u, issued.size());
+    EXPECT_EQ(0u, issued[0].first);
+    EXPECT_EQ(fileSize, issued[0].second);
+
+    // when 2. only a byte in the third unit is changed
+    issued.clear();
+    data[3 * unitSize] = 'a';
+    EXPECT_EQ(0, fileManager.Flush(testCallback, -1));
+
+    // then 2. the header unit and the changed unit are written
+    ASSERT_EQ(2u, issued.size());
+    EXPECT_EQ(0u, issued[0].first);
+    EXPECT_EQ((uint64_t)unitSize, issued[0].second);
+    EXPECT_EQ((uint64_t)(3 * unitSize), issued[1].first);
+    EXPECT_EQ((uint64_t)unitSize, issued[1].second);
+    EXPECT_EQ(2, callbackCount);
+    EXPECT_EQ(0, fileManager.GetNumFilesFlushing());
+
+    delete header;
+    delete[] data;
+}
+
 TEST(AllocatorFileIo, GetStoredVersion_TestSimpleGetter)
 {
     NiceMock<MockIAllocatorFileIoClient> client;
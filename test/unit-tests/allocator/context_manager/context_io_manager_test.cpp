@@ -8,6 +8,8 @@
 #include "test/unit-tests/journal_manager/checkpoint/checkpoint_meta_flush_completed_mock.h"
 #include "test/unit-tests/telemetry/telemetry_client/telemetry_publisher_mock.h"
 
+using ::testing::AnyNumber;
+using ::testing::Expectation;
 using ::testing::NiceMock;
 using ::testing::Return;
 
@@ -101,6 +103,30 @@ TEST(ContextIoManager, Init_testFileLoad)
     ioManager.Init();
 }
 
+TEST(ContextIoManager, Init_testIfAllFilesAreLoadedBeforeWaitingForThem)
+{
+    // given
+    NiceMock<MockAllocatorAddressInfo> info;
+    NiceMock<MockTelemetryPublisher> tp;
+
+    NiceMock<MockAllocatorFileIo>* segmentCtxIo = new NiceMock<MockAllocatorFileIo>;
+    NiceMock<MockAllocatorFileIo>* allocatorCtxIo = new NiceMock<MockAllocatorFileIo>;
+    NiceMock<MockAllocatorFileIo>* rebuildCtxIo = new NiceMock<MockAllocatorFileIo>;
+
+    ContextIoManager ioManager(&info, &tp, segmentCtxIo, allocatorCtxIo, rebuildCtxIo);
+
+    Expectation segmentLoad = EXPECT_CALL(*segmentCtxIo, LoadContext).WillOnce(Return(EID(SUCCEED_TO_OPEN_WITHOUT_CREATION)));
+    Expectation allocatorLoad = EXPECT_CALL(*allocatorCtxIo, LoadContext).WillOnce(Return(EID(SUCCEED_TO_OPEN_WITHOUT_CREATION)));
+    Expectation rebuildLoad = EXPECT_CALL(*rebuildCtxIo, LoadContext).WillOnce(Return(EID(SUCCEED_TO_OPEN_WITHOUT_CREATION)));
+
+    // then: pending reads are checked only after every load has been issued
+    EXPECT_CALL(*segmentCtxIo, GetNumFilesReading).Times(AnyNumber()).After(segmentLoad, allocatorLoad, rebuildLoad);
+
+    // when
+    int ret = ioManager.Init();
+    EXPECT_EQ(EID(SUCCESS), ret);
+}
+
 TEST(ContextIoManager, Init_testFileFlushFail)
 {
     // given
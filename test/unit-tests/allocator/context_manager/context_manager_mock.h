@@ -22,6 +22,8 @@ public:
     MOCK_METHOD(bool, NeedRebuildAgain, (), (override));
     MOCK_METHOD(int, StopRebuilding, (), (override));
     MOCK_METHOD(uint32_t, GetRebuildTargetSegmentCount, (), (override));
+    MOCK_METHOD(uint32_t, GetRebuildTargetStripeCount, (SegmentId segmentId), (override));
+    MOCK_METHOD(void, PrioritizeRebuildTarget, (StripeId lsid), (override));
     MOCK_METHOD(int, MakeRebuildTargetSegmentList, (), (override));
     MOCK_METHOD(std::set<SegmentId>, GetNvramSegmentList, (), (override));
     MOCK_METHOD(int, GetGcThreshold, (GcMode mode), (override));
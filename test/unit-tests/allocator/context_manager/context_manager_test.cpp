@@ -56,6 +56,36 @@ TEST(ContextManager, Init_TestCaseFormatFormat)
     EXPECT_EQ(EID(SUCCESS), ctxManager.Init());
 }
 
+TEST(ContextManager, Init_testIfMountIsRefusedWhenFooterLayoutDiffers)
+{
+    // given: the array was created without the reverse map footer
+    NiceMock<MockAllocatorAddressInfo> addrInfo;
+    NiceMock<MockAllocatorCtx>* allocCtx = new NiceMock<MockAllocatorCtx>;
+    NiceMock<MockSegmentCtx>* segCtx = new NiceMock<MockSegmentCtx>;
+    NiceMock<MockRebuildCtx>* reCtx = new NiceMock<MockRebuildCtx>;
+    NiceMock<MockGcCtx>* gcCtx = new NiceMock<MockGcCtx>;
+    NiceMock<MockBlockAllocationStatus>* blockAllocStatus = new NiceMock<MockBlockAllocationStatus>;
+    NiceMock<MockContextIoManager>* ioManager = new NiceMock<MockContextIoManager>;
+    NiceMock<MockTelemetryPublisher> tc;
+    ContextManager ctxManager(&tc, allocCtx, segCtx, reCtx, nullptr, gcCtx, blockAllocStatus,
+        ioManager, nullptr, &addrInfo, 0);
+
+    ON_CALL(*ioManager, Init).WillByDefault(Return(EID(SUCCESS)));
+    ON_CALL(*allocCtx, GetFooterBlksPerStripe).WillByDefault(Return(0));
+
+    // when: the footer is configured at mount
+    ON_CALL(addrInfo, GetfooterBlksPerStripe).WillByDefault(Return(2));
+
+    // then
+    EXPECT_EQ(EID(ALLOCATOR_REVMAP_FOOTER_MISMATCH), ctxManager.Init());
+
+    // when: the configuration matches the array again
+    ON_CALL(addrInfo, GetfooterBlksPerStripe).WillByDefault(Return(0));
+
+    // then
+    EXPECT_EQ(EID(SUCCESS), ctxManager.Init());
+}
+
 TEST(ContextManager, Close_TestAllClosed)
 {
     // given
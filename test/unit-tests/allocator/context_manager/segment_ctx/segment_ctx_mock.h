@@ -34,12 +34,20 @@ public:
     MOCK_METHOD(int, GetOccupiedStripeCount, (SegmentId segId), (override));
     MOCK_METHOD(SegmentState, GetSegmentState, (SegmentId segId), (override));
     MOCK_METHOD(void, ResetSegmentsStates, (), (override));
+    MOCK_METHOD(void, StartSegmentTrim, (), (override));
     MOCK_METHOD(void, AllocateSegment, (SegmentId segId), (override));
     MOCK_METHOD(SegmentId, AllocateFreeSegment, (), (override));
     MOCK_METHOD(uint64_t, GetNumOfFreeSegment, (), (override));
     MOCK_METHOD(uint64_t, GetNumOfFreeSegmentWoLock, (), (override));
     MOCK_METHOD(int, GetAllocatedSegmentCount, (), (override));
     MOCK_METHOD(SegmentId, AllocateGCVictimSegment, (), (override));
+    MOCK_METHOD(void, SetGcVictimPolicy, (GcVictimPolicy policy), (override));
+    MOCK_METHOD(void, SetFreeSegmentPolicy, (FreeSegmentPolicy policy), (override));
+    MOCK_METHOD(void, SetStripeAllocated, (StripeId lsid), (override));
+    MOCK_METHOD(uint32_t, GetNumStripesToRebuild, (SegmentId segId), (override));
+    MOCK_METHOD(void, PrioritizeRebuildTarget, (SegmentId segId), (override));
+    MOCK_METHOD(SegmentId, FindUnsealedNvramSegment, (SegmentId excludedSegment, SegmentId otherExcludedSegment), (override));
+    MOCK_METHOD(uint64_t, GetSegmentAge, (SegmentId segId), (override));
     MOCK_METHOD(SegmentId, GetRebuildTargetSegment, (), (override));
     MOCK_METHOD(int, SetRebuildCompleted, (SegmentId segId), (override));
     MOCK_METHOD(int, MakeRebuildTarget, (), (override));
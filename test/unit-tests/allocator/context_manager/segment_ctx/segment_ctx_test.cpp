@@ -97,7 +97,9 @@ TEST(SegmentCtx, AfterLoad_testIfSegmentListIsRebuilt)
     }
 
     EXPECT_CALL(addrInfo, GetnumUserAreaSegments).WillRepeatedly(Return(4));
-    EXPECT_CALL(segmentList[SegmentState::FREE], AddToList).Times(4);
+    std::vector<SegmentId> expected = {0, 1, 2, 3};
+    EXPECT_CALL(segmentList[SegmentState::FREE], AddSegments(expected)).Times(1);
+    EXPECT_CALL(segmentList[SegmentState::FREE], AddToList).Times(0);
 
     // when
     segCtx.AfterLoad(nullptr);
@@ -455,6 +457,41 @@ TEST(SegmentCtx, Init_testInitAndClose)
     segCtx.Dispose();
 }
 
+TEST(SegmentCtx, GetNumStripesToRebuild_testIfOnlyAllocatedStripesAreRebuilt)
+{
+    // given
+    AllocatorAddressInfo addrInfo;
+    addrInfo.SetnumUserAreaSegments(10);
+    addrInfo.SetstripesPerSegment(16);
+    NiceMock<MockRebuildCtx>* rebuildCtx = new NiceMock<MockRebuildCtx>();
+    NiceMock<MockTelemetryPublisher>* tp = new NiceMock<MockTelemetryPublisher>();
+    NiceMock<MockGcCtx> gcCtx;
+    SegmentCtx segCtx(tp, rebuildCtx, &addrInfo, &gcCtx, 0);
+    NiceMock<MockSegmentList>* freeSegmentList = new NiceMock<MockSegmentList>;
+    segCtx.SetSegmentList(SegmentState::FREE, freeSegmentList);
+    segCtx.Init();
+
+    // Segments found at load time have unknown allocation
+    EXPECT_EQ(16u, segCtx.GetNumStripesToRebuild(5));
+
+    // when
+    EXPECT_CALL(*freeSegmentList, PopSegment).WillOnce(Return(3));
+    EXPECT_EQ(3, segCtx.AllocateFreeSegment());
+
+    // then
+    EXPECT_EQ(0u, segCtx.GetNumStripesToRebuild(3));
+    segCtx.SetStripeAllocated(3 * 16 + 0);
+    segCtx.SetStripeAllocated(3 * 16 + 4);
+    segCtx.SetStripeAllocated(3 * 16 + 2);
+    EXPECT_EQ(5u, segCtx.GetNumStripesToRebuild(3));
+    segCtx.SetStripeAllocated(5 * 16 + 1);
+    EXPECT_EQ(16u, segCtx.GetNumStripesToRebuild(5));
+
+    segCtx.Dispose();
+    delete rebuildCtx;
+    delete tp;
+}
+
 TEST_F(SegmentCtxTestFixture, GetSectionAddr_TestSimpleGetter)
 {
     char* buf = segCtx->GetSectionAddr(SC_HEADER);
@@ -563,6 +600,36 @@ TEST(SegmentCtx, AllocateFreeSegment_testWhenSegmentIsAllocated)
     delete tp;
 }
 
+TEST(SegmentCtx, AllocateFreeSegment_testIfRoundRobinPolicyContinuesAfterLastAllocatedSegment)
+{
+    // given
+    NiceMock<MockAllocatorAddressInfo>* addrInfo = new NiceMock<MockAllocatorAddressInfo>;
+    SegmentInfo* segInfos = new SegmentInfo[100]();
+    NiceMock<MockSegmentList> freeSegmentList, nvramSegmentList;
+    NiceMock<MockRebuildCtx>* rebuildCtx = new NiceMock<MockRebuildCtx>();
+    NiceMock<MockTelemetryPublisher>* tp = new NiceMock<MockTelemetryPublisher>();
+
+    NiceMock<MockGcCtx> gcCtx;
+    SegmentCtx segCtx(tp, nullptr, segInfos, nullptr, rebuildCtx, addrInfo, &gcCtx, 0);
+    segCtx.SetSegmentList(SegmentState::FREE, &freeSegmentList);
+    segCtx.SetSegmentList(SegmentState::NVRAM, &nvramSegmentList);
+    segCtx.SetFreeSegmentPolicy(FreeSegmentPolicy::FREE_SEGMENT_ROUND_ROBIN);
+
+    // then
+    EXPECT_CALL(freeSegmentList, PopSegment).Times(0);
+    EXPECT_CALL(freeSegmentList, PopSegmentFrom(0)).WillOnce(Return(8));
+    EXPECT_CALL(freeSegmentList, PopSegmentFrom(9)).WillOnce(Return(20));
+
+    // when
+    EXPECT_EQ(8, segCtx.AllocateFreeSegment());
+    EXPECT_EQ(20, segCtx.AllocateFreeSegment());
+
+    delete addrInfo;
+    delete[] segInfos;
+    delete rebuildCtx;
+    delete tp;
+}
+
 TEST(SegmentCtx, AllocateGCVictimSegment_testWhenVictimSegmentIsFound)
 {
     // given
@@ -629,6 +696,39 @@ TEST(SegmentCtx, AllocateGCVictimSegment_testWhenVictimSegmentIsFoundFromTheRebu
     delete tp;
 }
 
+TEST(SegmentCtx, FindUnsealedNvramSegment_testIfHostSegmentIsExcluded)
+{
+    // given
+    NiceMock<MockAllocatorAddressInfo>* addrInfo = new NiceMock<MockAllocatorAddressInfo>;
+    NiceMock<MockTelemetryPublisher>* tp = new NiceMock<MockTelemetryPublisher>();
+    SegmentInfo* segInfos = new SegmentInfo[4](0, 0, SegmentState::FREE);
+
+    NiceMock<MockGcCtx> gcCtx;
+    SegmentCtx segCtx(tp, nullptr, segInfos, nullptr, nullptr, addrInfo, &gcCtx, 0);
+
+    EXPECT_CALL(*addrInfo, GetnumUserAreaSegments).WillRepeatedly(Return(4));
+    EXPECT_CALL(*addrInfo, GetstripesPerSegment).WillRepeatedly(Return(10));
+
+    segInfos[1].SetState(SegmentState::NVRAM);
+    segInfos[1].SetOccupiedStripeCount(3);
+    segInfos[3].SetState(SegmentState::NVRAM);
+    segInfos[3].SetOccupiedStripeCount(5);
+
+    // when & then
+    EXPECT_EQ(segCtx.FindUnsealedNvramSegment(1), 3);
+    EXPECT_EQ(segCtx.FindUnsealedNvramSegment(UNMAP_SEGMENT), 1);
+
+    // when: segment 3 is sealed
+    segInfos[3].SetOccupiedStripeCount(10);
+
+    // then
+    EXPECT_EQ(segCtx.FindUnsealedNvramSegment(1), UNMAP_SEGMENT);
+
+    delete addrInfo;
+    delete[] segInfos;
+    delete tp;
+}
+
 TEST(SegmentCtx, AllocateGCVictimSegment_testWhenVictimSegmentIsNotFound)
 {
     // given
@@ -758,6 +858,37 @@ TEST_F(SegmentCtxTestFixture, GetRebuildTargetSegment_TestRebuildTargetFindSucce
     EXPECT_EQ(ret, 0);
 }
 
+TEST_F(SegmentCtxTestFixture, GetRebuildTargetSegment_testIfPrioritizedTargetIsRebuiltFirst)
+{
+    // given
+    EXPECT_CALL(rebuildSegmentList, Contains(0)).WillOnce(Return(true));
+    segCtx->PrioritizeRebuildTarget(0);
+
+    // then
+    EXPECT_CALL(rebuildSegmentList, RemoveFromList(0)).WillOnce(Return(true));
+    EXPECT_CALL(rebuildSegmentList, PopSegment).Times(0);
+    EXPECT_CALL(segInfos, GetState).WillOnce(Return(SegmentState::SSD));
+
+    // when
+    SegmentId ret = segCtx->GetRebuildTargetSegment();
+    EXPECT_EQ(ret, 0);
+}
+
+TEST_F(SegmentCtxTestFixture, PrioritizeRebuildTarget_testIfSegmentNotInTheRebuildListIsIgnored)
+{
+    // given
+    EXPECT_CALL(rebuildSegmentList, Contains(0)).WillOnce(Return(false));
+    segCtx->PrioritizeRebuildTarget(0);
+
+    // then
+    EXPECT_CALL(rebuildSegmentList, RemoveFromList).Times(0);
+    EXPECT_CALL(rebuildSegmentList, PopSegment).WillOnce(Return(UNMAP_SEGMENT));
+
+    // when
+    SegmentId ret = segCtx->GetRebuildTargetSegment();
+    EXPECT_EQ(ret, UINT32_MAX);
+}
+
 TEST(SegmentCtx, MakeRebuildTarget_testWhenRebuildTargetListIsEmpty)
 {
     NiceMock<MockAllocatorAddressInfo> addrInfo;
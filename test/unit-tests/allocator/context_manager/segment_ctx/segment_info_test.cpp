@@ -2,6 +2,10 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 namespace pos
 {
 TEST(SegmentInfo, SegmentInfo_Constructor)
@@ -162,4 +166,54 @@ TEST(SegmentInfo, GetValidBlockCountIfSsdState_testIfValidCountIsReturnedWhenIts
     EXPECT_EQ(freeSegInfo.GetValidBlockCountIfSsdState(), UINT32_MAX);
 }
 
+TEST(SegmentInfo, SegmentInfo_testIfEachSegmentInfoOfArrayOwnsOneCacheLine)
+{
+    // given
+    const int numSegments = 5;
+    SegmentInfo* segInfos = new SegmentInfo[numSegments];
+
+    // then
+    for (int segId = 0; segId < numSegments; segId++)
+    {
+        uintptr_t addr = reinterpret_cast<uintptr_t>(&segInfos[segId]);
+        EXPECT_EQ(0u, addr % SEGMENT_INFO_ALIGNMENT);
+    }
+
+    delete[] segInfos;
+}
+
+TEST(SegmentInfo, DecreaseValidBlockCount_testIfConcurrentInvalidationsFreeSegmentOnce)
+{
+    // given
+    const int numThreads = 4;
+    const int blocksPerThread = 1000;
+    SegmentInfo segInfo(numThreads * blocksPerThread, 10, SegmentState::SSD);
+    std::atomic<int> freedCount(0);
+
+    // when
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < numThreads; thread++)
+    {
+        threads.emplace_back([&]()
+        {
+            for (int blk = 0; blk < blocksPerThread; blk++)
+            {
+                if (segInfo.DecreaseValidBlockCount(1, false).first == true)
+                {
+                    freedCount++;
+                }
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    // then
+    EXPECT_EQ(1, freedCount.load());
+    EXPECT_EQ(SegmentState::FREE, segInfo.GetState());
+    EXPECT_EQ(0u, segInfo.GetValidBlockCount());
+}
+
 } // namespace pos
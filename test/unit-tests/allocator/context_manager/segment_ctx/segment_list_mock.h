@@ -13,7 +13,9 @@ public:
     using SegmentList::SegmentList;
     MOCK_METHOD(void, Reset, (), (override));
     MOCK_METHOD(SegmentId, PopSegment, (), (override));
+    MOCK_METHOD(SegmentId, PopSegmentFrom, (SegmentId startSegId), (override));
     MOCK_METHOD(void, AddToList, (SegmentId segId), (override));
+    MOCK_METHOD(void, AddSegments, (const std::vector<SegmentId>& segIds), (override));
     MOCK_METHOD(bool, RemoveFromList, (SegmentId segId), (override));
     MOCK_METHOD(uint32_t, GetNumSegments, (), (override));
     MOCK_METHOD(uint32_t, GetNumSegmentsWoLock, (), (override));
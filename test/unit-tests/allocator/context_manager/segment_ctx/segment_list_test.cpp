@@ -81,6 +81,34 @@ TEST(SegmentList, AddToList_testAddAndPop)
     EXPECT_EQ(list.GetNumSegmentsWoLock(), 0);
 }
 
+TEST(SegmentList, PopSegmentFrom_testIfPopWrapsAroundToTheLowestSegment)
+{
+    SegmentList list;
+
+    list.AddToList(1);
+    list.AddToList(5);
+    list.AddToList(9);
+
+    EXPECT_EQ(list.PopSegmentFrom(2), 5);
+    EXPECT_EQ(list.PopSegmentFrom(9), 9);
+    EXPECT_EQ(list.PopSegmentFrom(10), 1);
+    EXPECT_EQ(list.GetNumSegments(), 0);
+
+    EXPECT_EQ(list.PopSegmentFrom(0), UNMAP_SEGMENT);
+}
+
+TEST(SegmentList, AddSegments_testIfAllSegmentsAreAddedAtOnce)
+{
+    SegmentList list;
+    list.AddToList(7);
+
+    list.AddSegments({1, 3, 5});
+
+    EXPECT_EQ(list.GetNumSegments(), 4);
+    EXPECT_EQ(list.PopSegment(), 1);
+    EXPECT_TRUE(list.Contains(7));
+}
+
 TEST(SegmentList, RemoveFromList_testRemove)
 {
     SegmentList list;
@@ -0,0 +1,23 @@
+#include <gmock/gmock.h>
+#include <set>
+#include <string>
+#include <list>
+#include <vector>
+#include "src/allocator/context_manager/segment_ctx/segment_trimmer.h"
+
+namespace pos
+{
+class MockSegmentTrimmer : public SegmentTrimmer
+{
+public:
+    using SegmentTrimmer::SegmentTrimmer;
+    MOCK_METHOD(void, Start, (SegmentTrimDoneHandler handler), (override));
+    MOCK_METHOD(void, Stop, (), (override));
+    MOCK_METHOD(bool, Enqueue, (SegmentId segId), (override));
+    MOCK_METHOD(void, Flush, (), (override));
+    MOCK_METHOD(uint32_t, GetNumPendingSegments, (), (override));
+    MOCK_METHOD(uint32_t, GetNumRunsInFlight, (), (override));
+    MOCK_METHOD(bool, NeedsTrimAhead, (uint32_t numReadySegments), (override));
+};
+
+} // namespace pos
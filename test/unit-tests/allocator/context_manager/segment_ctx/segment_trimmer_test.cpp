@@ -0,0 +1,188 @@
+#include "src/allocator/context_manager/segment_ctx/segment_trimmer.h"
+
+#include <gtest/gtest.h>
+
+#include <list>
+#include <vector>
+
+#include "test/unit-tests/allocator/address/allocator_address_info_mock.h"
+#include "test/unit-tests/array/service/io_translator/i_io_translator_mock.h"
+#include "test/unit-tests/device/i_io_dispatcher_mock.h"
+#include "test/unit-tests/include/i_array_device_mock.h"
+
+using ::testing::_;
+using ::testing::DoAll;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::SetArgReferee;
+
+namespace pos
+{
+static const uint32_t TEST_STRIPES_PER_SEGMENT = 4;
+static const uint32_t TEST_BLKS_PER_CHUNK = 8;
+
+static void
+SetAddressInfo(NiceMock<MockAllocatorAddressInfo>& addrInfo)
+{
+    EXPECT_CALL(addrInfo, GetstripesPerSegment).WillRepeatedly(Return(TEST_STRIPES_PER_SEGMENT));
+    EXPECT_CALL(addrInfo, GetblksPerStripe).WillRepeatedly(Return(TEST_BLKS_PER_CHUNK * 2));
+    EXPECT_CALL(addrInfo, GetchunksPerStripe).WillRepeatedly(Return(2));
+}
+
+TEST(SegmentTrimmer, MergeSegments_testIfConsecutiveSegmentsAreMergedIntoARun)
+{
+    // Given
+    std::set<SegmentId> segments = {1, 2, 3, 7, 9, 10};
+
+    // When
+    std::vector<SegmentRun> runs = SegmentTrimmer::MergeSegments(segments, 100);
+
+    // Then
+    ASSERT_EQ(3U, runs.size());
+    EXPECT_EQ(SegmentRun(1, 3), runs[0]);
+    EXPECT_EQ(SegmentRun(7, 1), runs[1]);
+    EXPECT_EQ(SegmentRun(9, 2), runs[2]);
+}
+
+TEST(SegmentTrimmer, MergeSegments_testIfARunIsSplitAtMaxRunLength)
+{
+    // Given
+    std::set<SegmentId> segments = {0, 1, 2, 3, 4};
+
+    // When
+    std::vector<SegmentRun> runs = SegmentTrimmer::MergeSegments(segments, 2);
+
+    // Then
+    ASSERT_EQ(3U, runs.size());
+    EXPECT_EQ(SegmentRun(0, 2), runs[0]);
+    EXPECT_EQ(SegmentRun(2, 2), runs[1]);
+    EXPECT_EQ(SegmentRun(4, 1), runs[2]);
+}
+
+TEST(SegmentTrimmer, Enqueue_testIfSegmentIsRejectedBeforeStart)
+{
+    // Given
+    NiceMock<MockAllocatorAddressInfo> addrInfo;
+    NiceMock<MockIIOTranslator> translator;
+    NiceMock<MockIIODispatcher> ioDispatcher;
+    SegmentTrimmer trimmer(0, &addrInfo, 2, &translator, &ioDispatcher);
+
+    // When
+    bool ret = trimmer.Enqueue(3);
+
+    // Then
+    EXPECT_FALSE(ret);
+    EXPECT_EQ(0U, trimmer.GetNumPendingSegments());
+}
+
+TEST(SegmentTrimmer, Enqueue_testIfFullBatchIsDeallocatedOnEveryDeviceBeforeSegmentsAreFreed)
+{
+    // Given
+    NiceMock<MockAllocatorAddressInfo> addrInfo;
+    SetAddressInfo(addrInfo);
+    NiceMock<MockIIOTranslator> translator;
+    NiceMock<MockIIODispatcher> ioDispatcher;
+    NiceMock<MockIArrayDevice> dev[2];
+    std::list<PhysicalEntry> ranges;
+    for (int i = 0; i < 2; i++)
+    {
+        EXPECT_CALL(dev[i], GetState).WillRepeatedly(Return(ArrayDeviceState::NORMAL));
+        PhysicalEntry range;
+        range.addr = {.lba = 0x1000, .arrayDev = &dev[i]};
+        range.blkCnt = 2 * TEST_STRIPES_PER_SEGMENT * TEST_BLKS_PER_CHUNK;
+        ranges.push_back(range);
+    }
+    SegmentTrimmer trimmer(0, &addrInfo, 2, &translator, &ioDispatcher);
+    std::vector<SegmentId> freed;
+    trimmer.Start([&freed](SegmentId segId) { freed.push_back(segId); });
+
+    // Then
+    EXPECT_CALL(translator, GetPhysicalRanges(0, PartitionType::USER_DATA, _,
+        5 * TEST_STRIPES_PER_SEGMENT, 2 * TEST_STRIPES_PER_SEGMENT))
+        .WillOnce(DoAll(SetArgReferee<2>(ranges), Return(0)));
+    std::vector<UbioSmartPtr> submitted;
+    EXPECT_CALL(ioDispatcher, Submit).Times(2).WillRepeatedly(
+        Invoke([&submitted](UbioSmartPtr ubio, bool sync, bool ioRecoveryNeeded)
+        {
+            submitted.push_back(ubio);
+            return 0;
+        }));
+
+    // When
+    EXPECT_TRUE(trimmer.Enqueue(6));
+    EXPECT_EQ(1U, trimmer.GetNumPendingSegments());
+    EXPECT_TRUE(trimmer.Enqueue(5));
+
+    // Then
+    EXPECT_EQ(0U, trimmer.GetNumPendingSegments());
+    ASSERT_EQ(2U, submitted.size());
+    for (auto& ubio : submitted)
+    {
+        EXPECT_EQ(UbioDir::Deallocate, ubio->dir);
+        EXPECT_EQ(BackendEvent_GC, ubio->GetEventType());
+        EXPECT_EQ(2 * TEST_STRIPES_PER_SEGMENT * TEST_BLKS_PER_CHUNK * Ubio::UNITS_PER_BLOCK,
+            ubio->GetSize() / Ubio::BYTES_PER_UNIT);
+    }
+
+    // When: the first device completes
+    submitted[0]->GetCallback()->Execute();
+
+    // Then: the segments are not freed yet
+    EXPECT_TRUE(freed.empty());
+    EXPECT_EQ(1U, trimmer.GetNumRunsInFlight());
+
+    // When: the last device completes
+    submitted[1]->GetCallback()->Execute();
+
+    // Then
+    EXPECT_EQ(std::vector<SegmentId>({5, 6}), freed);
+    EXPECT_EQ(0U, trimmer.GetNumRunsInFlight());
+}
+
+TEST(SegmentTrimmer, Stop_testIfPendingSegmentsAreFreedWithoutDeallocation)
+{
+    // Given
+    NiceMock<MockAllocatorAddressInfo> addrInfo;
+    NiceMock<MockIIOTranslator> translator;
+    NiceMock<MockIIODispatcher> ioDispatcher;
+    SegmentTrimmer trimmer(0, &addrInfo, 4, &translator, &ioDispatcher);
+    std::vector<SegmentId> freed;
+    trimmer.Start([&freed](SegmentId segId) { freed.push_back(segId); });
+    trimmer.Enqueue(8);
+    trimmer.Enqueue(2);
+
+    // Then
+    EXPECT_CALL(ioDispatcher, Submit).Times(0);
+
+    // When
+    trimmer.Stop();
+
+    // Then
+    EXPECT_EQ(std::vector<SegmentId>({2, 8}), freed);
+    EXPECT_FALSE(trimmer.Enqueue(9));
+}
+
+TEST(SegmentTrimmer, NeedsTrimAhead_testIfPendingSegmentsAreTrimmedOnlyBelowReadyTarget)
+{
+    // Given
+    NiceMock<MockAllocatorAddressInfo> addrInfo;
+    NiceMock<MockIIOTranslator> translator;
+    NiceMock<MockIIODispatcher> ioDispatcher;
+    SegmentTrimmer trimmer(0, &addrInfo, 4, &translator, &ioDispatcher, 3);
+    trimmer.Start([](SegmentId segId) {});
+
+    // Then: nothing to trim ahead while no segment is pending
+    EXPECT_FALSE(trimmer.NeedsTrimAhead(0));
+
+    // When
+    trimmer.Enqueue(5);
+
+    // Then
+    EXPECT_TRUE(trimmer.NeedsTrimAhead(2));
+    EXPECT_FALSE(trimmer.NeedsTrimAhead(3));
+
+    trimmer.Stop();
+    EXPECT_FALSE(trimmer.NeedsTrimAhead(0));
+}
+} // namespace pos
@@ -0,0 +1,232 @@
+#include "src/allocator/context_manager/segment_ctx/victim_segment_index.h"
+
+#include <gtest/gtest.h>
+
+#include "src/allocator/context_manager/segment_ctx/segment_info.h"
+
+namespace pos
+{
+static SegmentInfo*
+_CreateSsdSegmentInfos(uint32_t numSegments, uint32_t validCount)
+{
+    SegmentInfo* segInfos = new SegmentInfo[numSegments];
+    for (uint32_t segId = 0; segId < numSegments; segId++)
+    {
+        segInfos[segId].SetValidBlockCount(validCount);
+        segInfos[segId].SetState(SegmentState::SSD);
+    }
+    return segInfos;
+}
+
+TEST(VictimSegmentIndex, VictimSegmentIndex_Constructor)
+{
+    {
+        VictimSegmentIndex index(10, 10);
+    }
+
+    {
+        VictimSegmentIndex* index = new VictimSegmentIndex(10, 10);
+        delete index;
+    }
+}
+
+TEST(VictimSegmentIndex, Pick_testWhenIndexIsEmpty)
+{
+    // given
+    SegmentInfo* segInfos = _CreateSsdSegmentInfos(4, 0);
+    VictimSegmentIndex index(4, 10);
+
+    // when
+    SegmentId victim = index.Pick(GcVictimPolicy::GC_VICTIM_GREEDY, segInfos);
+
+    // then
+    EXPECT_EQ(victim, UNMAP_SEGMENT);
+    delete[] segInfos;
+}
+
+TEST(VictimSegmentIndex, Pick_testIfGreedyPolicyReturnsSegmentWithMinValidCount)
+{
+    // given
+    uint32_t blksPerSegment = 1024;
+    SegmentInfo* segInfos = _CreateSsdSegmentInfos(4, 0);
+    VictimSegmentIndex index(4, blksPerSegment);
+    uint32_t counts[4] = {1024, 601, 600, 900};
+    for (SegmentId segId = 0; segId < 4; segId++)
+    {
+        segInfos[segId].SetValidBlockCount(counts[segId]);
+        index.Add(segId, counts[segId]);
+    }
+
+    // when
+    SegmentId victim = index.Pick(GcVictimPolicy::GC_VICTIM_GREEDY, segInfos);
+
+    // then
+    EXPECT_EQ(victim, 2);
+    EXPECT_EQ(index.GetNumIndexedSegments(), 4);
+    delete[] segInfos;
+}
+
+TEST(VictimSegmentIndex, Pick_testIfFullyValidSegmentIsNotPicked)
+{
+    // given
+    SegmentInfo* segInfos = _CreateSsdSegmentInfos(2, 10);
+    VictimSegmentIndex index(2, 10);
+    index.Add(0, 10);
+    index.Add(1, 10);
+
+    // when
+    SegmentId victim = index.Pick(GcVictimPolicy::GC_VICTIM_GREEDY, segInfos);
+
+    // then
+    EXPECT_EQ(victim, UNMAP_SEGMENT);
+    delete[] segInfos;
+}
+
+TEST(VictimSegmentIndex, Update_testIfSegmentMovesToLowerBucket)
+{
+    // given
+    uint32_t blksPerSegment = 1024;
+    SegmentInfo* segInfos = _CreateSsdSegmentInfos(3, 500);
+    VictimSegmentIndex index(3, blksPerSegment);
+    for (SegmentId segId = 0; segId < 3; segId++)
+    {
+        index.Add(segId, 500);
+    }
+
+    // when
+    segInfos[1].SetValidBlockCount(3);
+    index.Update(1, 3);
+
+    // then
+    EXPECT_EQ(index.Pick(GcVictimPolicy::GC_VICTIM_GREEDY, segInfos), 1);
+    delete[] segInfos;
+}
+
+TEST(VictimSegmentIndex, Pick_testIfStaleEntryIsRebucketed)
+{
+    // given
+    uint32_t blksPerSegment = 1024;
+    SegmentInfo* segInfos = _CreateSsdSegmentInfos(3, 500);
+    VictimSegmentIndex index(3, blksPerSegment);
+    for (SegmentId segId = 0; segId < 3; segId++)
+    {
+        index.Add(segId, 500);
+    }
+    segInfos[0].SetValidBlockCount(100);
+    index.Update(0, 100);
+
+    // when: the count changed without an index update
+    segInfos[0].SetValidBlockCount(900);
+    segInfos[2].SetValidBlockCount(400);
+
+    // then
+    EXPECT_EQ(index.Pick(GcVictimPolicy::GC_VICTIM_GREEDY, segInfos), 2);
+    EXPECT_EQ(index.GetNumIndexedSegments(), 3);
+    delete[] segInfos;
+}
+
+TEST(VictimSegmentIndex, Pick_testIfNonSsdSegmentIsDropped)
+{
+    // given
+    SegmentInfo* segInfos = _CreateSsdSegmentInfos(2, 5);
+    VictimSegmentIndex index(2, 10);
+    index.Add(0, 5);
+    index.Add(1, 5);
+    segInfos[0].SetState(SegmentState::VICTIM);
+    segInfos[1].SetState(SegmentState::VICTIM);
+
+    // when
+    SegmentId victim = index.Pick(GcVictimPolicy::GC_VICTIM_GREEDY, segInfos);
+
+    // then
+    EXPECT_EQ(victim, UNMAP_SEGMENT);
+    EXPECT_EQ(index.GetNumIndexedSegments(), 0);
+    delete[] segInfos;
+}
+
+TEST(VictimSegmentIndex, Remove_testIfRemovedSegmentIsNotPicked)
+{
+    // given
+    SegmentInfo* segInfos = _CreateSsdSegmentInfos(2, 0);
+    VictimSegmentIndex index(2, 10);
+    segInfos[0].SetValidBlockCount(1);
+    segInfos[1].SetValidBlockCount(5);
+    index.Add(0, 1);
+    index.Add(1, 5);
+
+    // when
+    index.Remove(0);
+    index.Remove(0);
+
+    // then
+    EXPECT_EQ(index.GetNumIndexedSegments(), 1);
+    EXPECT_EQ(index.Pick(GcVictimPolicy::GC_VICTIM_GREEDY, segInfos), 1);
+    delete[] segInfos;
+}
+
+TEST(VictimSegmentIndex, Pick_testIfCostBenefitPolicyPrefersOlderSegment)
+{
+    // given
+    uint32_t blksPerSegment = 1024;
+    SegmentInfo* segInfos = _CreateSsdSegmentInfos(8, 0);
+    VictimSegmentIndex index(8, blksPerSegment);
+    segInfos[0].SetValidBlockCount(300);
+    index.Add(0, 300);
+    for (uint32_t count = 0; count < 100; count++)
+    {
+        index.AdvanceEpoch();
+    }
+    for (SegmentId segId = 1; segId < 8; segId++)
+    {
+        segInfos[segId].SetValidBlockCount(1000);
+        index.Add(segId, 1000);
+    }
+    segInfos[7].SetValidBlockCount(250);
+    index.Update(7, 250);
+
+    // when
+    SegmentId costBenefitVictim = index.Pick(GcVictimPolicy::GC_VICTIM_COST_BENEFIT, segInfos);
+    SegmentId greedyVictim = index.Pick(GcVictimPolicy::GC_VICTIM_GREEDY, segInfos);
+
+    // then
+    EXPECT_EQ(costBenefitVictim, 0);
+    EXPECT_EQ(greedyVictim, 7);
+    delete[] segInfos;
+}
+
+TEST(VictimSegmentIndex, Update_testIfLastModifiedEpochIsRecorded)
+{
+    // given
+    VictimSegmentIndex index(2, 10);
+    index.Add(0, 5);
+    index.Add(1, 5);
+    index.AdvanceEpoch();
+    index.AdvanceEpoch();
+
+    // when
+    index.Update(1, 4);
+
+    // then
+    EXPECT_EQ(index.GetEpoch(), 2);
+    EXPECT_EQ(index.GetLastModifiedEpoch(0), 0);
+    EXPECT_EQ(index.GetLastModifiedEpoch(1), 2);
+}
+
+TEST(VictimSegmentIndex, Reset_testIfAllEntriesAreCleared)
+{
+    // given
+    SegmentInfo* segInfos = _CreateSsdSegmentInfos(2, 1);
+    VictimSegmentIndex index(2, 10);
+    index.Add(0, 1);
+    index.Add(1, 1);
+
+    // when
+    index.Reset();
+
+    // then
+    EXPECT_EQ(index.GetNumIndexedSegments(), 0);
+    EXPECT_EQ(index.Pick(GcVictimPolicy::GC_VICTIM_GREEDY, segInfos), UNMAP_SEGMENT);
+    delete[] segInfos;
+}
+
+} // namespace pos
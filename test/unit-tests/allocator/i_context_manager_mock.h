@@ -19,6 +19,8 @@ public:
     MOCK_METHOD(int, StopRebuilding, (), (override));
     MOCK_METHOD(bool, NeedRebuildAgain, (), (override));
     MOCK_METHOD(uint32_t, GetRebuildTargetSegmentCount, (), (override));
+    MOCK_METHOD(uint32_t, GetRebuildTargetStripeCount, (SegmentId segmentId), (override));
+    MOCK_METHOD(void, PrioritizeRebuildTarget, (StripeId lsid), (override));
     MOCK_METHOD(int, GetGcThreshold, (GcMode mode), (override));
     MOCK_METHOD(SegmentCtx*, GetSegmentCtx, (), (override));
     MOCK_METHOD(GcCtx*, GetGcCtx, (), (override));
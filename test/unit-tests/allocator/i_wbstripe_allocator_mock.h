@@ -13,6 +13,7 @@ public:
     MOCK_METHOD(void, AssignStripe, (StripeSmartPtr stripe), (override));
     MOCK_METHOD(StripeSmartPtr, GetStripe, (StripeId wbLsid), (override));
     MOCK_METHOD(void, FreeWBStripeId, (StripeId lsid), (override));
+    MOCK_METHOD(bool, IsWbStripeQuotaExceeded, (uint32_t volumeId), (override));
     MOCK_METHOD(bool, ReferLsidCnt, (StripeAddr& lsa), (override));
     MOCK_METHOD(void, DereferLsidCnt, (StripeAddr& lsa, uint32_t blockCount), (override));
     MOCK_METHOD(int, ReconstructActiveStripe, (uint32_t volumeId, StripeId wbLsid, VirtualBlkAddr tailVsa, (std::map<uint64_t, BlkAddr> revMapInfos)), (override));
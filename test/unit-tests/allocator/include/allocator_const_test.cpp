@@ -1,3 +1,65 @@
 #include "src/allocator/include/allocator_const.h"
 
 #include <gtest/gtest.h>
+
+namespace pos
+{
+TEST(AllocatorConst, GetActiveStripeTailIndex_testIfAllCoresShareTheTailsOnSingleNuma)
+{
+    // Given
+    uint32_t volumeId = 3;
+
+    // When, Then
+    for (uint32_t core = 0; core < ACTIVE_STRIPE_TAIL_COUNT_PER_VOLUME; core++)
+    {
+        ASTailArrayIdx index = GetActiveStripeTailIndex(volumeId, core);
+        EXPECT_EQ(volumeId + core * MAX_VOLUME_COUNT, index);
+        EXPECT_EQ(volumeId, GetVolumeIdOfActiveStripeTail(index));
+        EXPECT_EQ(0U, GetNumaOfActiveStripeTail(index, 1));
+    }
+}
+
+TEST(AllocatorConst, GetActiveStripeTailIndex_testIfEachNumaHasItsOwnTails)
+{
+    // Given
+    uint32_t volumeId = 3;
+    uint32_t numaCount = 2;
+
+    // When, Then
+    for (uint32_t core = 0; core < 16; core++)
+    {
+        for (uint32_t numa = 0; numa < numaCount; numa++)
+        {
+            ASTailArrayIdx index = GetActiveStripeTailIndex(volumeId, core, numa, numaCount);
+            EXPECT_EQ(volumeId, GetVolumeIdOfActiveStripeTail(index));
+            EXPECT_EQ(numa, GetNumaOfActiveStripeTail(index, numaCount));
+        }
+    }
+}
+
+TEST(AllocatorConst, GetActiveStripeTailIndex_testIfSequentialWritesHaveTheirOwnTailInEachNuma)
+{
+    // Given
+    uint32_t volumeId = 3;
+    uint32_t numaCount = 2;
+
+    // When, Then: sequential and random writes of a numa never share a tail
+    for (uint32_t numa = 0; numa < numaCount; numa++)
+    {
+        ASTailArrayIdx sequential = GetActiveStripeTailIndex(volumeId, 0, numa, numaCount,
+            WRITE_STREAM_SEQUENTIAL);
+        EXPECT_EQ(numa, GetNumaOfActiveStripeTail(sequential, numaCount));
+        for (uint32_t core = 0; core < 16; core++)
+        {
+            EXPECT_EQ(sequential, GetActiveStripeTailIndex(volumeId, core, numa, numaCount,
+                WRITE_STREAM_SEQUENTIAL));
+            ASTailArrayIdx random = GetActiveStripeTailIndex(volumeId, core, numa, numaCount,
+                WRITE_STREAM_RANDOM);
+            EXPECT_NE(sequential, random);
+            EXPECT_EQ(volumeId, GetVolumeIdOfActiveStripeTail(random));
+            EXPECT_EQ(numa, GetNumaOfActiveStripeTail(random, numaCount));
+        }
+    }
+}
+
+} // namespace pos
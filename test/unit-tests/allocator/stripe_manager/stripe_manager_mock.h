@@ -13,8 +13,10 @@ class MockStripeManager : public StripeManager
 public:
     using StripeManager::StripeManager;
     MOCK_METHOD(void, Init, (IWBStripeAllocator * wbStripeManager), (override));
-    MOCK_METHOD((std::pair<StripeId, StripeId>), AllocateStripesForUser, (uint32_t volumeId), (override));
+    MOCK_METHOD((std::pair<StripeId, StripeId>), AllocateStripesForUser, (ASTailArrayIdx asTailArrayIdx), (override));
     MOCK_METHOD(StripeSmartPtr, AllocateGcDestStripe, (uint32_t volumeId), (override));
+    MOCK_METHOD(StripeSmartPtr, AllocateGcColdDestStripe, (uint32_t volumeId), (override));
+    MOCK_METHOD(void, SetHotColdSeparation, (bool enable), (override));
 };
 
 } // namespace pos
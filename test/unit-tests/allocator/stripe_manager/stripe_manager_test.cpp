@@ -89,6 +89,21 @@ TEST_F(StripeManagerTestFixture, AllocateStripesForUser_testIfAllocFailsWhenWbSt
     EXPECT_EQ(UNMAP_STRIPE, ret.second);
 }
 
+TEST_F(StripeManagerTestFixture, AllocateStripesForUser_testIfAllocFailsWhenVolumeIsOverWbStripeQuota)
+{
+    // Given: the volume already holds its share of scarce write buffer stripes
+    uint32_t volumeId = 3;
+    EXPECT_CALL(wbStripeManager, IsWbStripeQuotaExceeded(volumeId)).WillOnce(Return(true));
+    EXPECT_CALL(allocCtx, AllocFreeWbStripe).Times(0);
+
+    // when
+    auto ret = stripeManager->AllocateStripesForUser(volumeId);
+
+    // then
+    EXPECT_EQ(UNMAP_STRIPE, ret.first);
+    EXPECT_EQ(UNMAP_STRIPE, ret.second);
+}
+
 TEST_F(StripeManagerTestFixture, AllocateStripesForUser_testIfAllocFailsWhenUserStripeAllocationIsProhibited)
 {
     // Given: Failed to allocate new write buffer stripe
@@ -220,6 +235,71 @@ TEST_F(StripeManagerTestFixture, AllocateGcDestStripe_testIfReturnsNullRightAway
     EXPECT_EQ(nullptr, stripe);
 }
 
+TEST_F(StripeManagerTestFixture, AllocateGcDestStripe_testIfGcUsesItsOwnSegmentWhenHotColdSeparationIsEnabled)
+{
+    // Given: hot/cold separation is enabled, no gc segment to resume
+    stripeManager->SetHotColdSeparation(true);
+    EXPECT_CALL(allocStatus, IsBlockAllocationProhibited).WillRepeatedly(Return(false));
+    EXPECT_CALL(ctxManager, GetSegmentCtx).WillRepeatedly(Return(nullptr));
+    EXPECT_CALL(ctxManager, AllocateFreeSegment).WillOnce(Return(3));
+    // Then: the host ssd lsid is untouched
+    EXPECT_CALL(allocCtx, SetCurrentSsdLsid).Times(0);
+
+    // when
+    StripeSmartPtr first = stripeManager->AllocateGcDestStripe(0);
+    StripeSmartPtr second = stripeManager->AllocateGcDestStripe(0);
+
+    // then
+    StripeId gcSegmentStart = 3 * addrInfo.GetstripesPerSegment();
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(first->GetUserLsid(), gcSegmentStart);
+    EXPECT_EQ(second->GetUserLsid(), gcSegmentStart + 1);
+}
+
+TEST_F(StripeManagerTestFixture, AllocateGcDestStripe_testIfGcAllocatesNewSegmentWhenItsSegmentIsFull)
+{
+    // Given: hot/cold separation is enabled
+    stripeManager->SetHotColdSeparation(true);
+    EXPECT_CALL(allocStatus, IsBlockAllocationProhibited).WillRepeatedly(Return(false));
+    EXPECT_CALL(ctxManager, GetSegmentCtx).WillRepeatedly(Return(nullptr));
+    EXPECT_CALL(ctxManager, AllocateFreeSegment).WillOnce(Return(1)).WillOnce(Return(5));
+
+    // when
+    StripeSmartPtr stripe = nullptr;
+    for (uint32_t count = 0; count <= addrInfo.GetstripesPerSegment(); count++)
+    {
+        stripe = stripeManager->AllocateGcDestStripe(0);
+    }
+
+    // then
+    ASSERT_NE(stripe, nullptr);
+    EXPECT_EQ(stripe->GetUserLsid(), 5 * addrInfo.GetstripesPerSegment());
+}
+
+TEST_F(StripeManagerTestFixture, AllocateGcColdDestStripe_testIfColdDataUsesItsOwnSegment)
+{
+    // Given: hot/cold separation is enabled, no gc segment to resume
+    stripeManager->SetHotColdSeparation(true);
+    EXPECT_CALL(allocStatus, IsBlockAllocationProhibited).WillRepeatedly(Return(false));
+    EXPECT_CALL(ctxManager, GetSegmentCtx).WillRepeatedly(Return(nullptr));
+    EXPECT_CALL(ctxManager, AllocateFreeSegment).WillOnce(Return(2)).WillOnce(Return(6));
+    EXPECT_CALL(allocCtx, SetCurrentSsdLsid).Times(0);
+
+    // when
+    StripeSmartPtr gcStripe = stripeManager->AllocateGcDestStripe(0);
+    StripeSmartPtr coldStripe = stripeManager->AllocateGcColdDestStripe(0);
+    StripeSmartPtr nextColdStripe = stripeManager->AllocateGcColdDestStripe(0);
+
+    // then
+    ASSERT_NE(gcStripe, nullptr);
+    ASSERT_NE(coldStripe, nullptr);
+    ASSERT_NE(nextColdStripe, nullptr);
+    EXPECT_EQ(gcStripe->GetUserLsid(), 2 * addrInfo.GetstripesPerSegment());
+    EXPECT_EQ(coldStripe->GetUserLsid(), 6 * addrInfo.GetstripesPerSegment());
+    EXPECT_EQ(nextColdStripe->GetUserLsid(), 6 * addrInfo.GetstripesPerSegment() + 1);
+}
+
 TEST_F(StripeManagerTestFixture, AllocateGcDestStripe_testIfReturnsNullWhenBlockAllocationIsProhibited)
 {
     // Given: Block allocation is prohibited
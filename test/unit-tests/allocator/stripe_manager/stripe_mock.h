@@ -17,6 +17,7 @@ public:
     MOCK_METHOD(StripeId, GetUserLsid, (), (override));
     MOCK_METHOD(void, UpdateReverseMapEntry, (uint32_t offset, BlkAddr rba, uint32_t volumeId), (override));
     MOCK_METHOD((std::tuple<BlkAddr, uint32_t>), GetReverseMapEntry, (uint32_t offset), (override));
+    MOCK_METHOD(void, UpdateReverseMapChecksum, (uint32_t offset, uint32_t checksum), (override));
     MOCK_METHOD(int, Flush, (EventSmartPtr callback), (override));
     MOCK_METHOD(void, UpdateVictimVsa, (uint32_t offset, VirtualBlkAddr vsa), (override));
     MOCK_METHOD(VirtualBlkAddr, GetVictimVsa, (uint32_t offset), (override));
@@ -30,6 +31,8 @@ public:
     MOCK_METHOD(void, UpdateFlushIo, (FlushIoSmartPtr flushIo), (override));
     MOCK_METHOD(bool, IsActiveFlushTarget, (), (override));
     MOCK_METHOD(void, SetActiveFlushTarget, (), (override));
+    MOCK_METHOD(bool, IsDirectWritten, (), (override));
+    MOCK_METHOD(void, SetDirectWritten, (), (override));
 };
 
 } // namespace pos
@@ -60,6 +60,10 @@ public:
     UpdateReverseMapEntry(uint32_t offset, BlkAddr rba, uint32_t volumeId)
     {
     }
+    void
+    UpdateReverseMapChecksum(uint32_t offset, uint32_t checksum)
+    {
+    }
     uint32_t
     DecreseBlksRemaining(uint32_t amount)
     {
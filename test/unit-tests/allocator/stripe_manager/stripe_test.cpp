@@ -2,6 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <thread>
+#include <vector>
+
 #include "src/allocator/address/allocator_address_info.h"
 #include "src/include/meta_const.h"
 #include "test/unit-tests/mapper/reversemap/reverse_map_mock.h"
@@ -150,6 +153,36 @@ TEST(Stripe, IsOkToFree_TestSimpleGetter)
     stripe.Derefer(5);
 }
 
+TEST(Stripe, GetReferenceCount_testIfReferencesFromAllCoresAreSummedUp)
+{
+    // given
+    Stripe stripe(nullptr, 10);
+    std::vector<std::thread> readers;
+    for (int reader = 0; reader < 4; reader++)
+    {
+        readers.emplace_back([&stripe]() {
+            for (int i = 0; i < 1000; i++)
+            {
+                stripe.Refer();
+            }
+        });
+    }
+    for (auto& t : readers)
+    {
+        t.join();
+    }
+
+    // when
+    stripe.Derefer(3000);
+
+    // then
+    EXPECT_EQ(1000, stripe.GetReferenceCount());
+    EXPECT_FALSE(stripe.IsOkToFree());
+
+    stripe.Derefer(1000);
+    EXPECT_TRUE(stripe.IsOkToFree());
+}
+
 TEST(Stripe, UpdateReverseMapEntry_Test)
 {
     // given
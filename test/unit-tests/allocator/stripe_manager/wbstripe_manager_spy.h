@@ -49,6 +49,12 @@ public:
     using WBStripeManager::WBStripeManager;
     virtual ~WBStripeManagerSpy(void) = default;
 
+    void
+    SetWbStripeQuotaPerVolume(uint32_t quota)
+    {
+        wbStripeQuotaPerVolume = quota;
+    }
+
     int
     _ReconstructAS(StripeSmartPtr stripe, uint64_t blockCount)
     {
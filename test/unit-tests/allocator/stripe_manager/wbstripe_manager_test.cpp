@@ -197,7 +197,7 @@ TEST(WBStripeManager, FlushAllPendingStripesInVolume_testIfWaitsForStripesWithTh
 
     WBStripeManager wbStripeManager(nullptr, 1, nullptr, nullptr, &stripeMap, allocCtx, &addrInfo, ctxManager, blkManager, nullptr, "", 0);
 
-    EXPECT_CALL(*allocCtx, GetActiveStripeTail).WillOnce(Return(UNMAP_VSA));
+    EXPECT_CALL(*allocCtx, GetActiveStripeTail).Times(ACTIVE_STRIPE_TAIL_COUNT_PER_VOLUME).WillRepeatedly(Return(UNMAP_VSA));
 
     int volumeId = 5;
 
@@ -219,6 +219,39 @@ TEST(WBStripeManager, FlushAllPendingStripesInVolume_testIfWaitsForStripesWithTh
     delete blkManager;
 }
 */
+TEST_F(WBStripeManagerTestFixture, IsWbStripeQuotaExceeded_testIfVolumeOverQuotaBorrowsOnlyWhileStripesAreLeft)
+{
+    // given: volume 1 holds 2 of 5 stripes, and may hold 2 while stripes are scarce
+    wbStripeManager->SetWbStripeQuotaPerVolume(2);
+    uint32_t volumeId = 1;
+    for (StripeId wbLsid = 0; wbLsid < 2; wbLsid++)
+    {
+        NiceMock<MockStripe>* stripe = new NiceMock<MockStripe>();
+        ON_CALL(*stripe, GetWbLsid).WillByDefault(Return(wbLsid));
+        ON_CALL(*stripe, GetVolumeId).WillByDefault(Return(volumeId));
+        wbStripeManager->AssignStripe(StripeSmartPtr(stripe));
+    }
+    EXPECT_EQ(2U, wbStripeManager->GetWbStripeCount(volumeId));
+    ON_CALL(allocatorCtx, GetNumTotalWbStripe).WillByDefault(Return(5));
+
+    // when 1. 3 stripes are free
+    ON_CALL(allocatorCtx, GetAllocatedWbStripeCount).WillByDefault(Return(2));
+    // then 1. the volume may borrow
+    EXPECT_FALSE(wbStripeManager->IsWbStripeQuotaExceeded(volumeId));
+
+    // when 2. only 1 stripe is free
+    ON_CALL(allocatorCtx, GetAllocatedWbStripeCount).WillByDefault(Return(4));
+    // then 2. the volume over quota has to wait, but the others do not
+    EXPECT_TRUE(wbStripeManager->IsWbStripeQuotaExceeded(volumeId));
+    EXPECT_FALSE(wbStripeManager->IsWbStripeQuotaExceeded(volumeId + 1));
+
+    // when 3. one of its stripes is freed
+    wbStripeManager->FreeWBStripeId(0);
+    // then 3.
+    EXPECT_EQ(1U, wbStripeManager->GetWbStripeCount(volumeId));
+    EXPECT_FALSE(wbStripeManager->IsWbStripeQuotaExceeded(volumeId));
+}
+
 TEST_F(WBStripeManagerTestFixture, ReferLsidCnt_TestwithAllConditions)
 {    
     // given 1. User area stripe is given
@@ -0,0 +1,143 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/array/ft/erasure_code.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "src/array_models/dto/partition_physical_size.h"
+#include "src/include/array_config.h"
+#include "test/unit-tests/cpu_affinity/affinity_manager_mock.h"
+#include "test/unit-tests/resource_manager/buffer_pool_mock.h"
+#include "test/unit-tests/resource_manager/memory_manager_mock.h"
+#include "test/unit-tests/utils/mock_builder.h"
+
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+static const uint32_t CHUNK_SIZE = ArrayConfig::BLOCK_SIZE_BYTE;
+
+TEST(ErasureCode, CheckNumofDevsToConfigure_testIfDataDevsAreRequiredBesideParities)
+{
+    // Given
+    const PartitionPhysicalSize physicalSize{
+        .startLba = 0/* not interesting */,
+        .lastLba = 0/* not interesting */,
+        .blksPerChunk = 1,
+        .chunksPerStripe = 24,
+        .stripesPerSegment = 0/* not interesting */,
+        .totalSegments = 0/* not interesting */};
+    ErasureCode ec4(RaidTypeEnum::EC4, &physicalSize, 0, nullptr);
+
+    // When & Then
+    EXPECT_FALSE(ec4.CheckNumofDevsToConfigure(5));
+    EXPECT_TRUE(ec4.CheckNumofDevsToConfigure(6));
+    EXPECT_TRUE(ec4.CheckNumofDevsToConfigure(24));
+    EXPECT_EQ(RaidTypeEnum::EC4, ec4.GetRaidType());
+    EXPECT_EQ(4u, ec4.GetParityOffset(0).size());
+    EXPECT_EQ(20u, ec4.GetParityOffset(0).front());
+}
+
+TEST(ErasureCode, RecoverFunc_testIfFourLostChunksAreRecovered)
+{
+    // Given: 3 data + 4 parity chunks of a single block
+    const PartitionPhysicalSize physicalSize{
+        .startLba = 0/* not interesting */,
+        .lastLba = 0/* not interesting */,
+        .blksPerChunk = 1,
+        .chunksPerStripe = 7,
+        .stripesPerSegment = 0/* not interesting */,
+        .totalSegments = 0/* not interesting */};
+    MockAffinityManager mockAffMgr = BuildDefaultAffinityManagerMock();
+    EXPECT_CALL(mockAffMgr, GetNumaCount).WillRepeatedly(Return(1));
+    EXPECT_CALL(mockAffMgr, GetNumaIdFromCurrentThread).WillRepeatedly(Return(0));
+    BufferInfo info = {
+        .owner = "ErasureCodeTest_RecoverFunc",
+        .size = CHUNK_SIZE,
+        .count = 4};
+    char* chunks = new char[CHUNK_SIZE * physicalSize.chunksPerStripe];
+    MockBufferPool mockBufferPool(info, 0, nullptr);
+    EXPECT_CALL(mockBufferPool, TryGetBuffer)
+        .WillOnce(Return(chunks + CHUNK_SIZE * 3))
+        .WillOnce(Return(chunks + CHUNK_SIZE * 4))
+        .WillOnce(Return(chunks + CHUNK_SIZE * 5))
+        .WillOnce(Return(chunks + CHUNK_SIZE * 6));
+    MockMemoryManager mockMemoryManager;
+    EXPECT_CALL(mockMemoryManager, CreateBufferPool).WillOnce(Return(&mockBufferPool));
+    ErasureCode ec4(RaidTypeEnum::EC4, &physicalSize, 0, nullptr);
+    ec4.AllocParityPools(4, &mockAffMgr, &mockMemoryManager);
+
+    list<BufferEntry> buffers;
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        unsigned int seed = i + 1;
+        for (uint32_t j = 0; j < CHUNK_SIZE; j++)
+        {
+            chunks[CHUNK_SIZE * i + j] = rand_r(&seed);
+        }
+        buffers.push_back(BufferEntry(chunks + CHUNK_SIZE * i, 1));
+    }
+    LogicalWriteEntry src{
+        .addr = {.stripeId = 0, .offset = 0},
+        .blkCnt = 3,
+        .buffers = &buffers};
+    list<FtWriteEntry> parities;
+    ASSERT_EQ(0, ec4.MakeParity(parities, src));
+    ASSERT_EQ(4u, parities.size());
+
+    // When: devices 0, 2, 4 and 5 are lost and 0, 2 are recovered from 1, 3 and 6
+    char* survivors = new char[CHUNK_SIZE * 3];
+    memcpy(survivors, chunks + CHUNK_SIZE * 1, CHUNK_SIZE);
+    memcpy(survivors + CHUNK_SIZE, chunks + CHUNK_SIZE * 3, CHUNK_SIZE);
+    memcpy(survivors + CHUNK_SIZE * 2, chunks + CHUNK_SIZE * 6, CHUNK_SIZE);
+    char* recovered = new char[CHUNK_SIZE * 2];
+    RecoverFunc recoverFunc = ec4.GetRecoverFunc(vector<uint32_t>{0, 2}, vector<uint32_t>{4, 5});
+    recoverFunc(recovered, survivors, CHUNK_SIZE * 2);
+    recoverFunc(recovered, survivors, CHUNK_SIZE * 2);
+
+    // Then
+    EXPECT_EQ(0, memcmp(recovered, chunks, CHUNK_SIZE));
+    EXPECT_EQ(0, memcmp(recovered + CHUNK_SIZE, chunks + CHUNK_SIZE * 2, CHUNK_SIZE));
+    EXPECT_EQ(1u, ec4.GetDecodingTableMissCount());
+    EXPECT_EQ(1u, ec4.GetDecodingTableHitCount());
+
+    ec4.ClearParityPools();
+    delete[] recovered;
+    delete[] survivors;
+    delete[] chunks;
+}
+
+} // namespace pos
@@ -57,6 +57,60 @@ TEST(Raid10, Translate_ifDestinationIsFilledWithStripeIdAndOffset)
     ASSERT_EQ(OFFSET, dest.front().addr.offset);
 }
 
+TEST(Raid10, TranslateForRead_testIfReadsAlternateBetweenTheCopies)
+{
+    // Given: 2 mirror pairs
+    const PartitionPhysicalSize physicalSize{
+        .startLba = 0,
+        .lastLba = 0/* not interesting */,
+        .blksPerChunk = 10,
+        .chunksPerStripe = 4,
+        .stripesPerSegment = 20,
+        .totalSegments = 100};
+    Raid10 raid10(&physicalSize);
+    vector<uint32_t> noAbnormals;
+
+    LogicalEntry src;
+    src.addr.stripeId = 0;
+    src.addr.offset = 3;
+    src.blkCnt = 2;
+
+    // When, Then: the first chunk of an even stripe is read from the primary
+    EXPECT_EQ(3u, raid10.TranslateForRead(src, noAbnormals).front().addr.offset);
+
+    // When, Then: the next chunk or stripe is read from the mirror (offset + 2 chunks)
+    src.addr.offset = 13;
+    EXPECT_EQ(33u, raid10.TranslateForRead(src, noAbnormals).front().addr.offset);
+    src.addr.stripeId = 1;
+    src.addr.offset = 3;
+    EXPECT_EQ(23u, raid10.TranslateForRead(src, noAbnormals).front().addr.offset);
+}
+
+TEST(Raid10, TranslateForRead_testIfAbnormalCopyIsAvoided)
+{
+    // Given: 2 mirror pairs, the mirror of chunk 0 (index 2) is abnormal
+    const PartitionPhysicalSize physicalSize{
+        .startLba = 0,
+        .lastLba = 0/* not interesting */,
+        .blksPerChunk = 10,
+        .chunksPerStripe = 4,
+        .stripesPerSegment = 20,
+        .totalSegments = 100};
+    Raid10 raid10(&physicalSize);
+
+    LogicalEntry src;
+    src.addr.stripeId = 1;
+    src.addr.offset = 3;
+    src.blkCnt = 1;
+
+    // When, Then: it is read from the primary
+    EXPECT_EQ(3u, raid10.TranslateForRead(src, vector<uint32_t>{2}).front().addr.offset);
+
+    // When, Then: the primary is abnormal, it is read from the mirror
+    src.addr.stripeId = 0;
+    EXPECT_EQ(23u, raid10.TranslateForRead(src, vector<uint32_t>{0}).front().addr.offset);
+}
+
 TEST(Raid10, MakeParity_testIfDestinationIsFilledWithTwoItems)
 {
     // Given
@@ -164,6 +164,55 @@ TEST(Raid5, MakeParity_testIfParityBufferIsProperlyCalculated)
     verifyIfXORProducesZeroBuffer(dest.front().buffers, bufSize);
 }
 
+TEST(Raid5, MakeParity_testIfParityIsAllocatedFromPoolOfWriteBufferNuma)
+{
+    // Given: the write buffer is on numa 1 while the current thread runs on numa 0
+    const PartitionPhysicalSize physicalSize{
+        .startLba = 0/* not interesting */,
+        .lastLba = 0/* not interesting */,
+        .blksPerChunk = 4,
+        .chunksPerStripe = 3,
+        .stripesPerSegment = 0/* not interesting */,
+        .totalSegments = 0/* not interesting */};
+    MockAffinityManager mockAffMgr = BuildDefaultAffinityManagerMock();
+    EXPECT_CALL(mockAffMgr, GetNumaCount).WillRepeatedly(Return(2));
+    EXPECT_CALL(mockAffMgr, GetNumaIdFromCurrentThread).WillRepeatedly(Return(0));
+    EXPECT_CALL(mockAffMgr, GetNumaIdFromAddress).WillRepeatedly(Return(1));
+    BufferInfo info = {
+        .owner = "Raid5Test_MakeParityNuma",
+        .size = 65535,
+        .count = 1
+    };
+    char mem[65535];
+    MockBufferPool mockBufferPoolNuma0(info, 0, nullptr);
+    MockBufferPool mockBufferPoolNuma1(info, 1, nullptr);
+    EXPECT_CALL(mockBufferPoolNuma0, TryGetBuffer).Times(0);
+    EXPECT_CALL(mockBufferPoolNuma1, TryGetBuffer).WillOnce(Return(&mem));
+    MockMemoryManager mockMemoryManager;
+    EXPECT_CALL(mockMemoryManager, CreateBufferPool)
+        .WillOnce(Return(&mockBufferPoolNuma0))
+        .WillOnce(Return(&mockBufferPoolNuma1));
+    Raid5 raid5(&physicalSize, 0);
+    raid5.AllocParityPools(1, &mockAffMgr, &mockMemoryManager);
+
+    std::list<BufferEntry> buffers;
+    buffers.push_back(generateRandomBufferEntry(physicalSize.blksPerChunk, false));
+    buffers.push_back(generateRandomBufferEntry(physicalSize.blksPerChunk, false));
+    const LogicalWriteEntry& src{
+        .addr = {.stripeId = 0, .offset = 0},
+        .blkCnt = 2,
+        .buffers = &buffers};
+    list<FtWriteEntry> dest;
+
+    // When
+    int actual = raid5.MakeParity(dest, src);
+
+    // Then
+    ASSERT_EQ(0, actual);
+    ASSERT_EQ(1, dest.size());
+    EXPECT_EQ(&mem, dest.front().buffers.front().GetBufferPtr());
+}
+
 TEST(Raid5, GetRebuildGroup_testIfRebuildGroupDoesNotContainTargetFtBlockAddr)
 {
     // Given
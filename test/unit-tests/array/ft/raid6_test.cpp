@@ -0,0 +1,144 @@
+#include "src/array/ft/raid6.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "src/array_models/dto/partition_physical_size.h"
+#include "src/include/array_config.h"
+#include "test/unit-tests/cpu_affinity/affinity_manager_mock.h"
+#include "test/unit-tests/resource_manager/buffer_pool_mock.h"
+#include "test/unit-tests/resource_manager/memory_manager_mock.h"
+#include "test/unit-tests/utils/mock_builder.h"
+
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+static const uint32_t CHUNK_SIZE = ArrayConfig::BLOCK_SIZE_BYTE;
+
+static void
+fillRandom(char* buffer, uint32_t size, unsigned int seed)
+{
+    for (uint32_t i = 0; i < size; i++)
+    {
+        buffer[i] = rand_r(&seed);
+    }
+}
+
+TEST(Raid6, RecoverFunc_testIfPreparedDecodingTableIsUsedWithoutMiss)
+{
+    // Given: 2 data + P + Q chunks of a single block
+    const PartitionPhysicalSize physicalSize{
+        .startLba = 0/* not interesting */,
+        .lastLba = 0/* not interesting */,
+        .blksPerChunk = 1,
+        .chunksPerStripe = 4,
+        .stripesPerSegment = 0/* not interesting */,
+        .totalSegments = 0/* not interesting */};
+    MockAffinityManager mockAffMgr = BuildDefaultAffinityManagerMock();
+    EXPECT_CALL(mockAffMgr, GetNumaCount).WillRepeatedly(Return(1));
+    EXPECT_CALL(mockAffMgr, GetNumaIdFromCurrentThread).WillRepeatedly(Return(0));
+    BufferInfo info = {
+        .owner = "Raid6Test_RecoverFunc",
+        .size = CHUNK_SIZE,
+        .count = 2};
+    char* chunks = new char[CHUNK_SIZE * physicalSize.chunksPerStripe];
+    MockBufferPool mockBufferPool(info, 0, nullptr);
+    EXPECT_CALL(mockBufferPool, TryGetBuffer)
+        .WillOnce(Return(chunks + CHUNK_SIZE * 2))
+        .WillOnce(Return(chunks + CHUNK_SIZE * 3));
+    MockMemoryManager mockMemoryManager;
+    EXPECT_CALL(mockMemoryManager, CreateBufferPool).WillOnce(Return(&mockBufferPool));
+    Raid6 raid6(&physicalSize, 0, nullptr);
+    raid6.AllocParityPools(2, &mockAffMgr, &mockMemoryManager);
+
+    fillRandom(chunks, CHUNK_SIZE, 1);
+    fillRandom(chunks + CHUNK_SIZE, CHUNK_SIZE, 2);
+    list<BufferEntry> buffers;
+    buffers.push_back(BufferEntry(chunks, 1));
+    buffers.push_back(BufferEntry(chunks + CHUNK_SIZE, 1));
+    LogicalWriteEntry src{
+        .addr = {.stripeId = 0, .offset = 0},
+        .blkCnt = 2,
+        .buffers = &buffers};
+    list<FtWriteEntry> parities;
+    ASSERT_EQ(0, raid6.MakeParity(parities, src));
+
+    // When: device 0 is lost and recovered from device 1 and P
+    raid6.PrepareDecodingTables();
+    char* survivors = new char[CHUNK_SIZE * 2];
+    memcpy(survivors, chunks + CHUNK_SIZE, CHUNK_SIZE);
+    memcpy(survivors + CHUNK_SIZE, chunks + CHUNK_SIZE * 2, CHUNK_SIZE);
+    char* recovered = new char[CHUNK_SIZE];
+    RecoverFunc recoverFunc = raid6.GetRecoverFunc(vector<uint32_t>{0}, vector<uint32_t>{});
+    recoverFunc(recovered, survivors, CHUNK_SIZE);
+
+    // Then
+    EXPECT_EQ(0, memcmp(recovered, chunks, CHUNK_SIZE));
+    EXPECT_EQ(1, raid6.GetDecodingTableHitCount());
+    EXPECT_EQ(0, raid6.GetDecodingTableMissCount());
+
+    raid6.ClearParityPools();
+    delete[] recovered;
+    delete[] survivors;
+    delete[] chunks;
+}
+
+TEST(Raid6, RecoverFunc_testIfDecodingTableIsBuiltOnceOnMiss)
+{
+    // Given
+    const PartitionPhysicalSize physicalSize{
+        .startLba = 0/* not interesting */,
+        .lastLba = 0/* not interesting */,
+        .blksPerChunk = 1,
+        .chunksPerStripe = 6,
+        .stripesPerSegment = 0/* not interesting */,
+        .totalSegments = 0/* not interesting */};
+    MockAffinityManager mockAffMgr = BuildDefaultAffinityManagerMock();
+    Raid6 raid6(&physicalSize, 0, nullptr);
+    char* survivors = new char[CHUNK_SIZE * 4];
+    char* recovered = new char[CHUNK_SIZE * 2];
+    RecoverFunc recoverFunc = raid6.GetRecoverFunc(vector<uint32_t>{3, 1}, vector<uint32_t>{});
+
+    // When
+    recoverFunc(recovered, survivors, CHUNK_SIZE * 2);
+    recoverFunc(recovered, survivors, CHUNK_SIZE * 2);
+
+    // Then
+    EXPECT_EQ(1, raid6.GetDecodingTableMissCount());
+    EXPECT_EQ(1, raid6.GetDecodingTableHitCount());
+    delete[] recovered;
+    delete[] survivors;
+}
+
+TEST(Raid6, GetRaidState_testIfDegradedStatePreparesDecodingTables)
+{
+    // Given
+    const PartitionPhysicalSize physicalSize{
+        .startLba = 0/* not interesting */,
+        .lastLba = 0/* not interesting */,
+        .blksPerChunk = 1,
+        .chunksPerStripe = 5,
+        .stripesPerSegment = 0/* not interesting */,
+        .totalSegments = 0/* not interesting */};
+    MockAffinityManager mockAffMgr = BuildDefaultAffinityManagerMock();
+    Raid6 raid6(&physicalSize, 0, nullptr);
+    vector<ArrayDeviceState> devs{ArrayDeviceState::FAULT, ArrayDeviceState::NORMAL,
+        ArrayDeviceState::NORMAL, ArrayDeviceState::NORMAL, ArrayDeviceState::NORMAL};
+
+    // When
+    RaidState actual = raid6.GetRaidState(devs);
+    char* survivors = new char[CHUNK_SIZE * 3];
+    char* recovered = new char[CHUNK_SIZE * 2];
+    raid6.GetRecoverFunc(vector<uint32_t>{0, 4}, vector<uint32_t>{})(recovered, survivors, CHUNK_SIZE * 2);
+
+    // Then
+    EXPECT_EQ(RaidState::DEGRADED, actual);
+    EXPECT_EQ(0, raid6.GetDecodingTableMissCount());
+    delete[] recovered;
+    delete[] survivors;
+}
+
+} // namespace pos
@@ -0,0 +1,130 @@
+#include "src/array/ft/xor_engine.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace pos
+{
+static void*
+allocRandomBuffer(uint32_t size, uint32_t offset, unsigned int* seed)
+{
+    char* buffer = static_cast<char*>(aligned_alloc(XorEngine::ALIGNMENT, size + XorEngine::ALIGNMENT));
+    for (uint32_t i = 0; i < size + XorEngine::ALIGNMENT; i++)
+    {
+        buffer[i] = rand_r(seed);
+    }
+    return buffer + offset;
+}
+
+static void
+expectXorOfAll(void* dst, const std::vector<void*>& srcs, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++)
+    {
+        char expected = 0;
+        for (void* src : srcs)
+        {
+            expected ^= static_cast<char*>(src)[i];
+        }
+        ASSERT_EQ(expected, static_cast<char*>(dst)[i]);
+    }
+}
+
+TEST(XorEngine, Compute_testIfAllSourcesAreFoldedIntoDestination)
+{
+    // Given
+    const uint32_t SIZE = 4096 * 4;
+    unsigned int seed = 1234;
+    for (uint32_t srcCnt = 2; srcCnt <= 16; srcCnt++)
+    {
+        std::vector<void*> srcs;
+        for (uint32_t i = 0; i < srcCnt; i++)
+        {
+            srcs.push_back(allocRandomBuffer(SIZE, 0, &seed));
+        }
+        void* dst = allocRandomBuffer(SIZE, 0, &seed);
+
+        // When
+        XorEngine::Compute(dst, srcs.data(), srcCnt, SIZE);
+
+        // Then
+        expectXorOfAll(dst, srcs, SIZE);
+        for (void* src : srcs)
+        {
+            free(src);
+        }
+        free(dst);
+    }
+}
+
+TEST(XorEngine, Compute_testIfUnalignedBuffersFallBackToScalar)
+{
+    // Given: buffers are shifted by a byte and the length is not word aligned
+    const uint32_t SIZE = 4096 + 3;
+    unsigned int seed = 5678;
+    std::vector<void*> srcs;
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        srcs.push_back(allocRandomBuffer(SIZE, 1, &seed));
+    }
+    void* dst = allocRandomBuffer(SIZE, 1, &seed);
+    ASSERT_FALSE(XorEngine::IsAccelerable(dst, srcs.data(), srcs.size(), SIZE));
+
+    // When
+    XorEngine::Compute(dst, srcs.data(), srcs.size(), SIZE);
+
+    // Then
+    expectXorOfAll(dst, srcs, SIZE);
+    for (void* src : srcs)
+    {
+        free(static_cast<char*>(src) - 1);
+    }
+    free(static_cast<char*>(dst) - 1);
+}
+
+TEST(XorEngine, Compute_testIfSingleSourceIsCopiedAndNoSourceZeroesDestination)
+{
+    // Given
+    const uint32_t SIZE = 512;
+    unsigned int seed = 42;
+    void* src = allocRandomBuffer(SIZE, 0, &seed);
+    void* dst = allocRandomBuffer(SIZE, 0, &seed);
+
+    // When
+    XorEngine::Compute(dst, &src, 1, SIZE);
+
+    // Then
+    ASSERT_EQ(0, memcmp(dst, src, SIZE));
+
+    // When
+    XorEngine::Compute(dst, nullptr, 0, SIZE);
+
+    // Then
+    for (uint32_t i = 0; i < SIZE; i++)
+    {
+        ASSERT_EQ(0, static_cast<char*>(dst)[i]);
+    }
+    free(src);
+    free(dst);
+}
+
+TEST(XorEngine, IsAccelerable_testIfDestinationAliasingSourceIsRejected)
+{
+    // Given
+    const uint32_t SIZE = 4096;
+    unsigned int seed = 7;
+    void* src = allocRandomBuffer(SIZE, 0, &seed);
+    void* srcs[2] = {src, src};
+
+    // When
+    bool actual = XorEngine::IsAccelerable(src, srcs, 2, SIZE);
+
+    // Then
+    ASSERT_FALSE(actual);
+    free(src);
+}
+
+} // namespace pos
@@ -19,7 +19,10 @@ public:
     MOCK_METHOD(int, ByteTranslate, (PhysicalByteAddr & dst, const LogicalByteAddr& src), (override));
     MOCK_METHOD(int, ByteConvert, (list<PhysicalByteWriteEntry> & dst, const LogicalByteWriteEntry& src), (override));
     MOCK_METHOD(bool, IsByteAccessSupported, (), (override));
+    MOCK_METHOD(int, GetPhysicalRanges, (list<PhysicalEntry> & pel, StripeId startStripe, uint32_t stripeCnt), (override));
+    MOCK_METHOD(int, TranslateForRead, (list<PhysicalEntry> & pel, const LogicalEntry& le), (override));
     MOCK_METHOD(int, GetRecoverMethod, (UbioSmartPtr ubio, RecoverMethod& out), (override));
+    MOCK_METHOD(int, GetParityRecoverMethod, (StripeId stripeId, RecoverMethod& out), (override));
     MOCK_METHOD(unique_ptr<RebuildContext>, GetRebuildCtx, (const vector<IArrayDevice*>& fault), (override));
     MOCK_METHOD(unique_ptr<RebuildContext>, GetQuickRebuildCtx, (const QuickRebuildPair& rebuildPair), (override));
 };
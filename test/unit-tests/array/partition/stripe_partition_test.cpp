@@ -176,6 +176,119 @@ TEST(StripePartition, Translate_testIfFtBlkAddrIsMappedToPhysicalBlkAddr)
     }
 }
 
+TEST(StripePartition, TranslateForReadInPlace_testIfChunkLayoutMatchesTranslateForRaid5)
+{
+    // Given
+    vector<ArrayDevice*> devs;
+    string devNamePrefix = "unvme-ns-"; // not interesting
+    uint64_t devSize = 1024 * 1024 * 1024; // not interesting
+    int devCnt = 4;
+    for (int i = 0; i < devCnt; i++)
+    {
+        string devName = devNamePrefix + to_string(i);
+        shared_ptr<MockUBlockDevice> mockUblock = make_shared<MockUBlockDevice>(
+            devName, devSize, nullptr);
+        EXPECT_CALL(*mockUblock, GetName).WillRepeatedly(Return(devName.c_str()));
+        EXPECT_CALL(*mockUblock, GetSize).WillRepeatedly(Return(devSize));
+        ArrayDevice* dev = new ArrayDevice(mockUblock, ArrayDeviceState::NORMAL);
+        devs.push_back(dev);
+    }
+    uint64_t startLba = 1024; // not interesting
+    uint32_t totalNvmBlks = 1024 * 1024; // not interesting
+    uint32_t segCnt = 1; // not interesting
+    StripePartition sPartition(PartitionType::USER_DATA, devs, RaidTypeEnum::RAID5);
+    sPartition.Create(startLba, segCnt, totalNvmBlks);
+    auto lsize = sPartition.GetLogicalSize();
+
+    // When: every stripe of a parity rotation is read across all its data chunks
+    for (StripeId stripeId = 0; stripeId < (StripeId)devCnt + 1; stripeId++)
+    {
+        LogicalEntry src{
+            .addr = {.stripeId = stripeId, .offset = lsize->blksPerChunk / 2},
+            .blkCnt = lsize->blksPerStripe - lsize->blksPerChunk};
+        list<PhysicalEntry> expected;
+        PhysicalEntryArray actual;
+        ASSERT_EQ(0, sPartition.Translate(expected, src));
+        ASSERT_EQ(0, sPartition.TranslateForReadInPlace(actual, src));
+
+        // Then: the table lookup gives the same entries as the translation
+        ASSERT_EQ(expected.size(), actual.count);
+        uint32_t index = 0;
+        for (PhysicalEntry& pe : expected)
+        {
+            EXPECT_EQ(pe.addr.arrayDev, actual.entries[index].addr.arrayDev);
+            EXPECT_EQ(pe.addr.lba, actual.entries[index].addr.lba);
+            EXPECT_EQ(pe.blkCnt, actual.entries[index].blkCnt);
+            index++;
+        }
+    }
+
+    // Wrap up
+    for (auto dev : devs)
+    {
+        delete dev;
+    }
+}
+
+TEST(StripePartition, GetPhysicalRanges_testIfEveryDeviceGetsOneContiguousRange)
+{
+    // Given
+    vector<ArrayDevice*> devs;
+    string devNamePrefix = "unvme-ns-"; // not interesting
+    uint64_t devSize = 1024 * 1024 * 1024; // not interesting
+    int devCnt = 4;
+    for (int i = 0; i < devCnt; i++)
+    {
+        string devName = devNamePrefix + to_string(i);
+        shared_ptr<MockUBlockDevice> mockUblock = make_shared<MockUBlockDevice>(
+            devName, devSize, nullptr);
+        EXPECT_CALL(*mockUblock, GetName).WillRepeatedly(Return(devName.c_str()));
+        EXPECT_CALL(*mockUblock, GetSize).WillRepeatedly(Return(devSize));
+        ArrayDevice* dev = new ArrayDevice(mockUblock, ArrayDeviceState::NORMAL);
+        devs.push_back(dev);
+    }
+    uint64_t startLba = 0; // not interesting
+    uint32_t totalNvmBlks = 1024 * 1024; // not interesting
+    uint32_t segCnt = 1; // not interesting
+    RaidTypeEnum raid = RaidTypeEnum::RAID10;
+    StripePartition sPartition(PartitionType::META_SSD, devs, raid);
+    sPartition.Create(startLba, segCnt, totalNvmBlks);
+    auto psize = sPartition.GetPhysicalSize();
+    auto lsize = sPartition.GetLogicalSize();
+    StripeId startStripe = 1;
+    uint32_t stripeCnt = 2;
+    list<PhysicalEntry> dest;
+
+    // When
+    int actual = sPartition.GetPhysicalRanges(dest, startStripe, stripeCnt);
+
+    // Then
+    ASSERT_EQ(0, actual);
+    ASSERT_EQ((size_t)devCnt, dest.size());
+    uint64_t expectedLba = psize->startLba + startStripe * psize->blksPerChunk * ArrayConfig::SECTORS_PER_BLOCK;
+    int devIndex = 0;
+    for (auto& pe : dest)
+    {
+        EXPECT_EQ(devs.at(devIndex++), pe.addr.arrayDev);
+        EXPECT_EQ(expectedLba, pe.addr.lba);
+        EXPECT_EQ(psize->blksPerChunk * stripeCnt, pe.blkCnt);
+    }
+
+    // When: the range runs past the last stripe
+    dest.clear();
+    actual = sPartition.GetPhysicalRanges(dest, lsize->totalStripes - 1, stripeCnt);
+
+    // Then
+    EXPECT_EQ(EID(ADDRESS_TRANSLATION_INVALID_LBA), actual);
+    EXPECT_TRUE(dest.empty());
+
+    // Wrap up
+    for (auto dev : devs)
+    {
+        delete dev;
+    }
+}
+
 TEST(StripePartition, GetParityList_testIfParityWithRaid10FillsDestIn)
 {
     // Given
@@ -280,6 +393,52 @@ TEST(StripePartition, GetRecoverMethod_testIfValidUbioCanRetrieveRecoverMethodSu
     }
 }
 
+TEST(StripePartition, GetParityRecoverMethod_testIfDataAndParityChunksAreSplitByParityLocation)
+{
+    // Given
+    vector<ArrayDevice*> devs;
+    string devNamePrefix = "unvme-ns-"; // not interesting
+    uint64_t devSize = 1024 * 1024 * 1024; // not interesting
+    int devCnt = 3;
+    for (int i = 0; i < devCnt; i++)
+    {
+        string devName = devNamePrefix + to_string(i);
+        shared_ptr<MockUBlockDevice> mockUblock = make_shared<MockUBlockDevice>(
+            devName, devSize, nullptr);
+        EXPECT_CALL(*mockUblock, GetName).WillRepeatedly(Return(devName.c_str()));
+        EXPECT_CALL(*mockUblock, GetSize).WillRepeatedly(Return(devSize));
+        ArrayDevice* dev = new ArrayDevice(mockUblock, ArrayDeviceState::NORMAL);
+        devs.push_back(dev);
+    }
+    uint64_t startLba = 0; // not interesting
+    uint32_t totalNvmBlks = 1024 * 1024; // not interesting
+    uint32_t segCnt = 1; // not interesting
+    StripePartition sPartition(PartitionType::USER_DATA, devs, RaidTypeEnum::RAID5);
+    sPartition.Create(startLba, segCnt, totalNvmBlks);
+    StripeId stripeId = 1; // parity of RAID5 rotates to devs[1]
+
+    RecoverMethod out;
+
+    // When
+    int actual = sPartition.GetParityRecoverMethod(stripeId, out);
+
+    // Then
+    ASSERT_EQ(EID(SUCCESS), actual);
+    ASSERT_EQ(2, out.srcAddr.size());
+    ASSERT_EQ(1, out.dstAddr.size());
+    EXPECT_EQ(devs[1], out.dstAddr.front().arrayDev);
+    EXPECT_EQ(devs[0], out.srcAddr.front().arrayDev);
+    EXPECT_EQ(devs[2], out.srcAddr.back().arrayDev);
+    EXPECT_TRUE(out.recoverFunc != nullptr);
+    EXPECT_EQ(stripeId, out.stripeId);
+
+    // Wrap up
+    for (auto dev : devs)
+    {
+        delete dev;
+    }
+}
+
 TEST(StripePartition, GetRebuildCtx_testIfRebuildContextIsFilledInWithFaultyDevice)
 {
     // Given
@@ -12,7 +12,8 @@ class MockIIORecover : public IIORecover
 {
 public:
     using IIORecover::IIORecover;
-    MOCK_METHOD(int, GetRecoverMethod, (string array, UbioSmartPtr ubio, RecoverMethod& out), (override));
+    MOCK_METHOD(int, GetRecoverMethod, (unsigned int arrayIndex, UbioSmartPtr ubio, RecoverMethod& out), (override));
+    MOCK_METHOD(int, GetParityRecoverMethod, (unsigned int arrayIndex, PartitionType part, StripeId stripeId, RecoverMethod& out), (override));
 };
 
 } // namespace pos
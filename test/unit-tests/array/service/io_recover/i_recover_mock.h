@@ -13,6 +13,7 @@ class MockIRecover : public IRecover
 public:
     using IRecover::IRecover;
     MOCK_METHOD(int, GetRecoverMethod, (UbioSmartPtr ubio, RecoverMethod& out), (override));
+    MOCK_METHOD(int, GetParityRecoverMethod, (StripeId stripeId, RecoverMethod& out), (override));
 };
 
 } // namespace pos
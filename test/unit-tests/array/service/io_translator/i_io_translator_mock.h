@@ -16,6 +16,8 @@ public:
     MOCK_METHOD(int, GetParityList, (unsigned int arrayIndex, PartitionType part, list<PhysicalWriteEntry>& parity, const LogicalWriteEntry& src), (override));
     MOCK_METHOD(int, ByteTranslate, (unsigned int arrayIndex, PartitionType part, PhysicalByteAddr& dst, const LogicalByteAddr& src), (override));
     MOCK_METHOD(int, ByteConvert, (unsigned int arrayIndex, PartitionType part, list<PhysicalByteWriteEntry>& dst, const LogicalByteWriteEntry& src), (override));
+    MOCK_METHOD(int, GetPhysicalRanges, (unsigned int arrayIndex, PartitionType part, list<PhysicalEntry>& pel, StripeId startStripe, uint32_t stripeCnt), (override));
+    MOCK_METHOD(int, TranslateForRead, (unsigned int arrayIndex, PartitionType part, list<PhysicalEntry>& pel, const LogicalEntry& le), (override));
 };
 
 } // namespace pos
@@ -17,6 +17,8 @@ public:
     MOCK_METHOD(int, ByteTranslate, (PhysicalByteAddr & dst, const LogicalByteAddr& src), (override));
     MOCK_METHOD(int, ByteConvert, (list<PhysicalByteWriteEntry> & dst, const LogicalByteWriteEntry& src), (override));
     MOCK_METHOD(bool, IsByteAccessSupported, (), (override));
+    MOCK_METHOD(int, GetPhysicalRanges, (list<PhysicalEntry>& pel, StripeId startStripe, uint32_t stripeCnt), (override));
+    MOCK_METHOD(int, TranslateForRead, (list<PhysicalEntry>& pel, const LogicalEntry& le), (override));
 };
 
 } // namespace pos
@@ -92,6 +92,38 @@ TEST(ArrayMountSequence, Mount_testIfPartiallyFailedSequenceLeadsToDisposeOnEver
     ASSERT_EQ(SEQ3_INIT_FAILURE, actual);
 }
 
+TEST(ArrayMountSequence, Mount_testIfSequencesWithSameDependencyAreStartedTogether)
+{
+    // Given
+    MockIMountSequence mockSeq1, mockSeq2, mockSeq3;
+    vector<IMountSequence*> seqVec = {&mockSeq1, &mockSeq2, &mockSeq3};
+    NiceMock<MockStateControl> stateControl("array");
+    StateContext* mockDefaultState = new StateContext("sender", SituationEnum::DEFAULT);
+    StateContext* mockMountState = new StateContext("sender", SituationEnum::TRY_MOUNT);
+    MockIArrayRebuilder* mockRebuilder = new MockIArrayRebuilder();
+
+    int SEQ2_INIT_FAILURE = 123;
+    EXPECT_CALL(stateControl, GetState)
+        .WillOnce(Return(mockDefaultState))
+        .WillOnce(Return(mockMountState));
+    EXPECT_CALL(mockSeq1, Init).WillOnce(Return(0));
+    EXPECT_CALL(mockSeq2, Init).WillOnce(Return(SEQ2_INIT_FAILURE));
+    EXPECT_CALL(mockSeq3, Init).WillOnce(Return(0));
+
+    EXPECT_CALL(mockSeq1, Dispose).Times(1);
+    EXPECT_CALL(mockSeq2, Dispose).Times(1);
+    EXPECT_CALL(mockSeq3, Dispose).Times(1);
+
+    ArrayMountSequence mntSeq(seqVec, &stateControl, "mock-array", mockMountState, nullptr, nullptr, nullptr, mockRebuilder);
+    mntSeq.SetDependency(&mockSeq3, {&mockSeq1});
+
+    // When
+    int actual = mntSeq.Mount();
+
+    // Then
+    ASSERT_EQ(SEQ2_INIT_FAILURE, actual);
+}
+
 TEST(ArrayMountSequence, Unmount_testIfFailsToUnmountWhenInFaultSituation)
 {
     // Given
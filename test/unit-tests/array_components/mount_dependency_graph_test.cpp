@@ -0,0 +1,103 @@
+#include "src/array_components/mount_dependency_graph.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "src/include/pos_event_id.h"
+
+namespace pos
+{
+TEST(MountDependencyGraph, Run_testIfStepsRunAfterTheirDependencies)
+{
+    // Given
+    MountDependencyGraph graph;
+    std::vector<std::string> order;
+    int first = graph.AddStep("first", [&](void) { order.push_back("first"); return 0; }, {});
+    int second = graph.AddStep("second", [&](void) { order.push_back("second"); return 0; }, {first});
+    graph.AddStep("third", [&](void) { order.push_back("third"); return 0; }, {second});
+
+    // When
+    int actual = graph.Run();
+
+    // Then
+    ASSERT_EQ(EID(SUCCESS), actual);
+    std::vector<std::string> expected = {"first", "second", "third"};
+    EXPECT_EQ(expected, order);
+}
+
+TEST(MountDependencyGraph, Run_testIfIndependentStepsRunInParallel)
+{
+    // Given
+    MountDependencyGraph graph;
+    std::atomic<int> arrived(0);
+    auto waitForTheOther = [&](void)
+    {
+        arrived++;
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (arrived < 2 && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::yield();
+        }
+        return (arrived == 2) ? 0 : -1;
+    };
+    int root = graph.AddStep("root", [](void) { return 0; }, {});
+    graph.AddStep("left", waitForTheOther, {root});
+    graph.AddStep("right", waitForTheOther, {root});
+
+    // When
+    int actual = graph.Run();
+
+    // Then
+    EXPECT_EQ(EID(SUCCESS), actual);
+}
+
+TEST(MountDependencyGraph, Run_testIfNoStepStartsAfterFailure)
+{
+    // Given
+    MountDependencyGraph graph;
+    bool dependentRan = false;
+    int failed = graph.AddStep("failed", [](void) { return -1; }, {});
+    graph.AddStep("dependent", [&](void) { dependentRan = true; return 0; }, {failed});
+
+    // When
+    int actual = graph.Run();
+
+    // Then
+    EXPECT_EQ(-1, actual);
+    EXPECT_FALSE(dependentRan);
+    std::vector<int> expectedStarted = {failed};
+    EXPECT_EQ(expectedStarted, graph.GetStartedSteps());
+}
+
+TEST(MountDependencyGraph, GetCriticalPath_testIfLongestChainIsReported)
+{
+    // Given
+    MountDependencyGraph graph;
+    auto sleepFor = [](int ms)
+    {
+        return [ms](void)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+            return 0;
+        };
+    };
+    int root = graph.AddStep("root", sleepFor(1), {});
+    int slow = graph.AddStep("slow", sleepFor(50), {root});
+    graph.AddStep("fast", sleepFor(1), {root});
+    graph.AddStep("last", sleepFor(1), {slow});
+    graph.Run();
+
+    // When
+    uint64_t elapsedUs = 0;
+    std::vector<std::string> path = graph.GetCriticalPath(elapsedUs);
+
+    // Then
+    std::vector<std::string> expected = {"root", "slow", "last"};
+    EXPECT_EQ(expected, path);
+    EXPECT_GE(elapsedUs, 50000);
+}
+
+} // namespace pos
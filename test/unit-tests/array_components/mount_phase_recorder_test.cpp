@@ -0,0 +1,86 @@
+#include "src/array_components/mount_phase_recorder.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "src/telemetry/telemetry_id.h"
+#include "test/unit-tests/telemetry/telemetry_client/easy_telemetry_publisher_mock.h"
+
+using ::testing::_;
+using ::testing::NiceMock;
+
+namespace pos
+{
+class MountPhaseRecorderTestSequence
+{
+};
+
+TEST(MountPhaseRecorder, Record_testIfPhasesAreKeptInOrderAndPublished)
+{
+    // Given
+    NiceMock<MockEasyTelemetryPublisher> tp(nullptr);
+    MountPhaseRecorder recorder(&tp);
+    recorder.Begin("POSArray");
+    VectorLabels expectedLabels = {{"array_name", "POSArray"}, {"phase", "Metadata"}};
+
+    // Then
+    EXPECT_CALL(tp, UpdateGauge(TEL60011_ARRAY_MOUNT_PHASE_TIME_US, 200, expectedLabels)).Times(1);
+    EXPECT_CALL(tp, UpdateGauge(TEL60011_ARRAY_MOUNT_PHASE_TIME_US, 100, _)).Times(1);
+
+    // When
+    recorder.Record("POSArray", "Metadata", 200);
+    recorder.Record("POSArray", "GarbageCollector", 100);
+
+    // Then
+    MountPhaseList phases = recorder.GetPhases("POSArray");
+    ASSERT_EQ(2, phases.size());
+    EXPECT_EQ("Metadata", phases[0].first);
+    EXPECT_EQ(200, phases[0].second);
+    EXPECT_EQ("GarbageCollector", phases[1].first);
+    EXPECT_EQ(100, phases[1].second);
+    EXPECT_EQ(0, recorder.GetPhases("OtherArray").size());
+}
+
+TEST(MountPhaseRecorder, Begin_testIfPhasesOfThePreviousMountAreCleared)
+{
+    // Given
+    NiceMock<MockEasyTelemetryPublisher> tp(nullptr);
+    MountPhaseRecorder recorder(&tp);
+    recorder.Begin("POSArray");
+    recorder.Record("POSArray", "Metadata", 200);
+
+    // When
+    recorder.Begin("POSArray");
+
+    // Then
+    EXPECT_EQ(0, recorder.GetPhases("POSArray").size());
+}
+
+TEST(MountPhaseRecorder, GetPhaseName_testIfTheClassNameIsReturnedWithoutNamespace)
+{
+    // When
+    std::string name = MountPhaseRecorder::GetPhaseName(typeid(MountPhaseRecorderTestSequence));
+
+    // Then
+    EXPECT_EQ("MountPhaseRecorderTestSequence", name);
+}
+
+TEST(MountPhaseTimer, MountPhaseTimer_testIfThePhaseIsRecordedWhenTheTimerGoesOutOfScope)
+{
+    // Given
+    NiceMock<MockEasyTelemetryPublisher> tp(nullptr);
+    MountPhaseRecorder recorder(&tp);
+    recorder.Begin("POSArray");
+
+    // When
+    {
+        MountPhaseTimer timer("POSArray", "Metadata.JournalReplay", &recorder);
+        EXPECT_EQ(0, recorder.GetPhases("POSArray").size());
+    }
+
+    // Then
+    MountPhaseList phases = recorder.GetPhases("POSArray");
+    ASSERT_EQ(1, phases.size());
+    EXPECT_EQ("Metadata.JournalReplay", phases[0].first);
+}
+} // namespace pos
@@ -88,6 +88,96 @@ TEST(Ubio, GetBuffer)
     delete ubio;
 }
 
+TEST(Ubio, GetBuffer_testIfVectoredUbioWalksThroughIoVectors)
+{
+    // Given : two scattered buffers of one block each
+    char first[4096];
+    char second[4096];
+    std::vector<struct iovec> ioVectors = {
+        {.iov_base = first, .iov_len = 4096},
+        {.iov_base = second, .iov_len = 4096}};
+
+    // When
+    Ubio ubio(ioVectors, 0);
+
+    // Then : the size covers every vector and offsets resolve into the right one
+    EXPECT_TRUE(ubio.IsVectored());
+    EXPECT_EQ(2U, ubio.GetIoVectors().size());
+    EXPECT_EQ(8192U, ubio.GetSize());
+    EXPECT_EQ(first, ubio.GetBuffer());
+    EXPECT_EQ(first + 512 * 3, ubio.GetBuffer(0, 3));
+    EXPECT_EQ(second, ubio.GetBuffer(1, 0));
+    EXPECT_EQ(second + 512, ubio.GetBuffer(1, 1));
+}
+
+TEST(Ubio, Split_testIfVectoredUbioSlicesIoVectorsFromHead)
+{
+    // Given : one block followed by two blocks in another buffer
+    char first[4096];
+    char second[8192];
+    std::vector<struct iovec> ioVectors = {
+        {.iov_base = first, .iov_len = 4096},
+        {.iov_base = second, .iov_len = 8192}};
+    UbioSmartPtr ubio = std::make_shared<Ubio>(ioVectors, 0);
+
+    // When : the first block and a half are split off
+    UbioSmartPtr head = ubio->Split(12, false);
+
+    // Then : each part only sees the vectors of its own byte range
+    ASSERT_EQ(2U, head->GetIoVectors().size());
+    EXPECT_EQ(6144U, head->GetSize());
+    EXPECT_EQ(first, head->GetBuffer());
+    EXPECT_EQ(second, head->GetIoVectors()[1].iov_base);
+    EXPECT_EQ(2048U, head->GetIoVectors()[1].iov_len);
+    ASSERT_EQ(1U, ubio->GetIoVectors().size());
+    EXPECT_EQ(6144U, ubio->GetSize());
+    EXPECT_EQ(second + 2048, ubio->GetBuffer());
+    EXPECT_EQ(6144U, ubio->GetIoVectors()[0].iov_len);
+}
+
+TEST(Ubio, Split_testIfVectoredUbioSlicesIoVectorsFromTail)
+{
+    // Given : two scattered buffers of one block each
+    char first[4096];
+    char second[4096];
+    std::vector<struct iovec> ioVectors = {
+        {.iov_base = first, .iov_len = 4096},
+        {.iov_base = second, .iov_len = 4096}};
+    UbioSmartPtr ubio = std::make_shared<Ubio>(ioVectors, 0);
+
+    // When : the last block is split off
+    UbioSmartPtr tail = ubio->Split(8, true);
+
+    // Then
+    ASSERT_EQ(1U, tail->GetIoVectors().size());
+    EXPECT_EQ(second, tail->GetBuffer());
+    EXPECT_EQ(4096U, tail->GetSize());
+    ASSERT_EQ(1U, ubio->GetIoVectors().size());
+    EXPECT_EQ(first, ubio->GetBuffer());
+    EXPECT_EQ(4096U, ubio->GetSize());
+}
+
+TEST(Ubio, FillZero_testIfEveryScatteredBufferIsZeroed)
+{
+    // Given : a block scattered over two host buffers
+    char first[2048];
+    char second[2048];
+    memset(first, 0xFF, sizeof(first));
+    memset(second, 0xFF, sizeof(second));
+    std::vector<struct iovec> ioVectors = {
+        {.iov_base = first, .iov_len = 2048},
+        {.iov_base = second, .iov_len = 2048}};
+    Ubio ubio(ioVectors, 0);
+    char zero[2048] = {0};
+
+    // When
+    ubio.FillZero();
+
+    // Then
+    EXPECT_EQ(0, memcmp(first, zero, sizeof(zero)));
+    EXPECT_EQ(0, memcmp(second, zero, sizeof(zero)));
+}
+
 TEST(Ubio, Complete)
 {
     // Given : Nothing
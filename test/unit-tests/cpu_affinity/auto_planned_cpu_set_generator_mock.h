@@ -0,0 +1,17 @@
+#include <gmock/gmock.h>
+
+#include <list>
+#include <string>
+#include <vector>
+
+#include "src/cpu_affinity/auto_planned_cpu_set_generator.h"
+
+namespace pos
+{
+class MockAutoPlannedCpuSetGenerator : public AutoPlannedCpuSetGenerator
+{
+public:
+    using AutoPlannedCpuSetGenerator::AutoPlannedCpuSetGenerator;
+};
+
+} // namespace pos
@@ -0,0 +1,123 @@
+#include "src/cpu_affinity/auto_planned_cpu_set_generator.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+namespace pos
+{
+// Two numa nodes of 4 physical cores with 2 SMT threads each:
+// numa 0 has cpu 0-7 with siblings (0,4) (1,5) (2,6) (3,7), numa 1 has cpu 8-15
+static AffinityTopology
+MakeTopology(void)
+{
+    AffinityTopology topology;
+    for (uint32_t cpu = 0; cpu < 16; cpu++)
+    {
+        uint32_t numa = (cpu < 8) ? 0 : 1;
+        uint32_t physicalCore = (cpu % 8 < 4) ? cpu : cpu - 4;
+        topology.cpus.push_back(AffinityTopology::Cpu{cpu, numa, physicalCore});
+    }
+    topology.nicNumas = {1};
+    topology.ssdNumas = {0, 0, 0, 1};
+    topology.nvramNumas = {0};
+    return topology;
+}
+
+static CoreDescriptionArray
+MakeDescriptions(std::string reactor, std::string ioWorker, std::string eventWorker)
+{
+    return CoreDescriptionArray{
+        CoreDescription{CoreType::REACTOR, {0, 0}, reactor},
+        CoreDescription{CoreType::UDD_IO_WORKER, {0, 0}, ioWorker},
+        CoreDescription{CoreType::EVENT_SCHEDULER, {0, 0}, ""},
+        CoreDescription{CoreType::EVENT_WORKER, {0, 0}, eventWorker},
+        CoreDescription{CoreType::GENERAL_USAGE, {0, 0}, "0"},
+        CoreDescription{CoreType::QOS, {0, 0}, "0"},
+        CoreDescription{CoreType::META_SCHEDULER, {0, 0}, ""},
+        CoreDescription{CoreType::META_IO, {0, 0}, "0"},
+        CoreDescription{CoreType::AIR, {0, 0}, ""},
+        CoreDescription{CoreType::EVENT_REACTOR, {0, 0}, ""},
+    };
+}
+
+static uint32_t
+CountOnNuma(cpu_set_t cpuSet, uint32_t firstCpu)
+{
+    uint32_t count = 0;
+    for (uint32_t cpu = firstCpu; cpu < firstCpu + 8; cpu++)
+    {
+        count += CPU_ISSET(cpu, &cpuSet) ? 1 : 0;
+    }
+    return count;
+}
+
+TEST(AutoPlannedCpuSetGenerator, CountCores_ListAndMask)
+{
+    EXPECT_EQ(0, AutoPlannedCpuSetGenerator::CountCores(""));
+    EXPECT_EQ(1, AutoPlannedCpuSetGenerator::CountCores("7"));
+    EXPECT_EQ(6, AutoPlannedCpuSetGenerator::CountCores("3-5,8,10-11"));
+    EXPECT_EQ(3, AutoPlannedCpuSetGenerator::CountCores("0x38"));
+}
+
+TEST(AutoPlannedCpuSetGenerator, Plan_PlacesRolesByLocality)
+{
+    // Given: NIC on numa 1, three of four SSDs and NVRAM on numa 0
+    AffinityTopology topology = MakeTopology();
+
+    // When
+    AutoPlannedCpuSetGenerator generator(MakeDescriptions("0-1", "0-3", "0"), topology);
+    const CpuSetArray& cpuSets = generator.GetCpuSetArray();
+
+    // Then: reactors next to the NIC, IO workers follow the SSDs, meta IO next to NVRAM
+    cpu_set_t reactor = cpuSets[static_cast<uint32_t>(CoreType::REACTOR)];
+    EXPECT_EQ(2, CountOnNuma(reactor, 8));
+    cpu_set_t ioWorker = cpuSets[static_cast<uint32_t>(CoreType::UDD_IO_WORKER)];
+    EXPECT_EQ(3, CountOnNuma(ioWorker, 0));
+    EXPECT_EQ(1, CountOnNuma(ioWorker, 8));
+    cpu_set_t metaIo = cpuSets[static_cast<uint32_t>(CoreType::META_IO)];
+    EXPECT_EQ(1, CountOnNuma(metaIo, 0));
+    EXPECT_FALSE(generator.GetRationale().empty());
+}
+
+TEST(AutoPlannedCpuSetGenerator, Plan_PollingRolesDoNotShareSmtSiblings)
+{
+    // Given
+    AffinityTopology topology = MakeTopology();
+
+    // When: 8 polling threads on 8 physical cores
+    AutoPlannedCpuSetGenerator generator(MakeDescriptions("0-1", "0-3", "0"), topology);
+    const CpuSetArray& cpuSets = generator.GetCpuSetArray();
+
+    // Then: no two polling cpus are siblings
+    CoreType pollingTypes[] = {CoreType::REACTOR, CoreType::UDD_IO_WORKER,
+        CoreType::EVENT_SCHEDULER, CoreType::EVENT_WORKER, CoreType::META_IO};
+    uint32_t physicalCoreUse[16] = {0, };
+    for (auto type : pollingTypes)
+    {
+        cpu_set_t cpuSet = cpuSets[static_cast<uint32_t>(type)];
+        for (auto& cpu : topology.cpus)
+        {
+            if (CPU_ISSET(cpu.id, &cpuSet))
+            {
+                physicalCoreUse[cpu.physicalCore]++;
+            }
+        }
+    }
+    for (uint32_t core = 0; core < 16; core++)
+    {
+        EXPECT_LE(physicalCoreUse[core], 1);
+    }
+}
+
+TEST(AutoPlannedCpuSetGenerator, Plan_NotEnoughPhysicalCores_Throws)
+{
+    // Given: 9 polling threads on 8 physical cores
+    AffinityTopology topology = MakeTopology();
+
+    // When, Then
+    EXPECT_THROW(AutoPlannedCpuSetGenerator(MakeDescriptions("0-1", "0-3", "0-1"), topology),
+        std::runtime_error);
+}
+
+} // namespace pos
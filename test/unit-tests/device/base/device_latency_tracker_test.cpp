@@ -0,0 +1,67 @@
+#include "src/device/base/device_latency_tracker.h"
+
+#include <gtest/gtest.h>
+
+using namespace pos;
+
+TEST(DeviceLatencyTracker, Record_testIfFirstSampleBecomesAverage)
+{
+    // Given
+    DeviceLatencyTracker overall(nullptr);
+    DeviceLatencyTracker tracker(&overall);
+
+    // When
+    tracker.Record(8000);
+
+    // Then
+    EXPECT_EQ(8000, tracker.GetAverage());
+    EXPECT_EQ(1, tracker.GetSampleCount());
+    EXPECT_EQ(8000, overall.GetAverage());
+    EXPECT_EQ(1, overall.GetSampleCount());
+}
+
+TEST(DeviceLatencyTracker, Record_testIfAverageMovesTowardNewSamples)
+{
+    // Given
+    DeviceLatencyTracker tracker(nullptr);
+    tracker.Record(8000);
+
+    // When
+    tracker.Record(16000);
+
+    // Then: new sample is weighted by 1/8
+    EXPECT_EQ(9000, tracker.GetAverage());
+    EXPECT_EQ(2, tracker.GetSampleCount());
+}
+
+TEST(DeviceLatencyTracker, Record_testIfOverallAveragesAllDevices)
+{
+    // Given
+    DeviceLatencyTracker overall(nullptr);
+    DeviceLatencyTracker fastDevice(&overall);
+    DeviceLatencyTracker slowDevice(&overall);
+
+    // When
+    for (int count = 0; count < 100; count++)
+    {
+        fastDevice.Record(1000);
+        slowDevice.Record(100000);
+    }
+
+    // Then
+    EXPECT_EQ(1000, fastDevice.GetAverage());
+    EXPECT_EQ(100000, slowDevice.GetAverage());
+    EXPECT_GT(overall.GetAverage(), fastDevice.GetAverage());
+    EXPECT_LT(overall.GetAverage(), slowDevice.GetAverage());
+    EXPECT_EQ(200, overall.GetSampleCount());
+}
+
+TEST(DeviceLatencyTracker, DeviceLatencyTracker_testIfDefaultTrackerFeedsOverallOfAllDevices)
+{
+    // Given
+    DeviceLatencyTracker tracker;
+
+    // When, Then
+    EXPECT_EQ(DeviceLatencyTracker::GetOverallOfAllDevices(), tracker.GetOverall());
+    EXPECT_EQ(nullptr, DeviceLatencyTracker::GetOverallOfAllDevices()->GetOverall());
+}
@@ -16,6 +16,7 @@ public:
     MOCK_METHOD(std::string, GetDeviceName, ());
     MOCK_METHOD(UbioDir, GetOpcode, ());
     MOCK_METHOD(void*, GetBuffer, ());
+    MOCK_METHOD(const std::vector<struct iovec>*, GetIoVectors, ());
     MOCK_METHOD(uint64_t, GetStartByteOffset, ());
     MOCK_METHOD(uint64_t, GetByteCount, ());
     MOCK_METHOD(uint64_t, GetStartSectorOffset, ());
@@ -34,10 +34,12 @@ public:
     MOCK_METHOD(void, AddPendingErrorCount, (uint32_t errorsToAdd), (override));
     MOCK_METHOD(void, SubtractPendingErrorCount, (uint32_t errorsToSubtract), (override));
     MOCK_METHOD(void, SetDedicatedIOWorker, (IOWorker * ioWorker), (override));
+    MOCK_METHOD(void, ChangeDedicatedIOWorker, (IOWorker * ioWorker), (override));
     MOCK_METHOD(IOWorker*, GetDedicatedIOWorker, (), (override));
     MOCK_METHOD(DeviceContext*, _AllocateDeviceContext, (), (override));
     MOCK_METHOD(void, _ReleaseDeviceContext, (DeviceContext * deviceContextToRelease), (override));
     MOCK_METHOD(bool, WrapupOpenDeviceSpecific, (), (override));
+    MOCK_METHOD(DeviceLatencyTracker*, GetLatencyTracker, (), (override));
     MOCK_METHOD(void*, GetByteAddress, (), (override));
 };
 
@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 
+#include "src/bio/copy_command.h"
 #include "src/spdk_wrapper/abort_context.h"
 #include "test/unit-tests/device/unvme/unvme_device_context_mock.h"
 #include "test/unit-tests/device/unvme/unvme_io_context_mock.h"
@@ -9,8 +10,10 @@
 #include "src/admin/disk_query_manager.h"
 
 using testing::_;
+using testing::DoAll;
 using testing::NiceMock;
 using testing::Return;
+using testing::SaveArgPointee;
 
 namespace pos
 {
@@ -35,6 +38,133 @@ TEST(UnvmeCmd, RequestIO_testIfUbioDirIsWriteUncorAndWorksProperly)
     EXPECT_EQ(ret, 0);
 }
 
+TEST(UnvmeCmd, RequestIO_testIfWriteIsTaggedWithPlacementHandle)
+{
+    // Given
+    NiceMock<MockUnvmeIOContext> mockIoContext;
+    NiceMock<MockUnvmeDeviceContext> mockDevContext;
+    mockDevContext.placementDirective = UnvmePlacementDirective_Fdp;
+    mockDevContext.placementHandle[UnvmePlacementClass_GcCold] = 5;
+    ON_CALL(mockIoContext, GetOpcode).WillByDefault(Return(UbioDir::Write));
+    ON_CALL(mockIoContext, GetEventType).WillByDefault(Return(BackendEvent_GC));
+    ON_CALL(mockIoContext, GetSectorCount).WillByDefault(Return(8));
+    ON_CALL(mockIoContext, GetByteCount).WillByDefault(Return(4096));
+
+    NiceMock<MockSpdkNvmeCaller>* mockCaller = new NiceMock<MockSpdkNvmeCaller>();
+    ON_CALL(*mockCaller, SpdkNvmeNsGetMaxIoXferSize).WillByDefault(Return(131072));
+    struct spdk_nvme_cmd cmd;
+    EXPECT_CALL(*mockCaller, SpdkNvmeNsCmdWrite).Times(0);
+    EXPECT_CALL(*mockCaller, SpdkNvmeCtrlrCmdIoRaw)
+        .WillOnce(DoAll(SaveArgPointee<2>(&cmd), Return(0)));
+
+    UnvmeCmd unvmeCmd(mockCaller);
+
+    // When
+    int ret = unvmeCmd.RequestIO(&mockDevContext, nullptr, &mockIoContext);
+
+    // Then
+    EXPECT_EQ(ret, 0);
+    EXPECT_EQ(SPDK_NVME_OPC_WRITE, cmd.opc);
+    EXPECT_EQ((7U | (2U << 20)), cmd.cdw12);
+    EXPECT_EQ((5U << 16), cmd.cdw13);
+}
+
+TEST(UnvmeCmd, RequestIO_testIfWriteLargerThanMaxXferSizeGoesUntagged)
+{
+    // Given
+    NiceMock<MockUnvmeIOContext> mockIoContext;
+    NiceMock<MockUnvmeDeviceContext> mockDevContext;
+    mockDevContext.placementDirective = UnvmePlacementDirective_Fdp;
+    ON_CALL(mockIoContext, GetOpcode).WillByDefault(Return(UbioDir::Write));
+    ON_CALL(mockIoContext, GetByteCount).WillByDefault(Return(262144));
+
+    NiceMock<MockSpdkNvmeCaller>* mockCaller = new NiceMock<MockSpdkNvmeCaller>();
+    ON_CALL(*mockCaller, SpdkNvmeNsGetMaxIoXferSize).WillByDefault(Return(131072));
+    EXPECT_CALL(*mockCaller, SpdkNvmeCtrlrCmdIoRaw).Times(0);
+    EXPECT_CALL(*mockCaller, SpdkNvmeNsCmdWrite).WillOnce(Return(0));
+
+    UnvmeCmd unvmeCmd(mockCaller);
+
+    // When
+    int ret = unvmeCmd.RequestIO(&mockDevContext, nullptr, &mockIoContext);
+
+    // Then
+    EXPECT_EQ(ret, 0);
+}
+
+TEST(UnvmeCmd, RequestIO_testIfCopyIsSubmittedWithSourceRanges)
+{
+    // Given
+    NiceMock<MockUnvmeIOContext> mockIoContext;
+    NiceMock<MockUnvmeDeviceContext> mockDevContext;
+    CopyCommand copyCommand;
+    copyCommand.rangeCount = 2;
+    ON_CALL(mockIoContext, GetOpcode).WillByDefault(Return(UbioDir::Copy));
+    ON_CALL(mockIoContext, GetBuffer).WillByDefault(Return(&copyCommand));
+    ON_CALL(mockIoContext, GetStartSectorOffset).WillByDefault(Return(0x100000000ULL + 64));
+
+    NiceMock<MockSpdkNvmeCaller>* mockCaller = new NiceMock<MockSpdkNvmeCaller>();
+    struct spdk_nvme_cmd cmd;
+    EXPECT_CALL(*mockCaller, SpdkNvmeCtrlrCmdIoRaw(_, _, _, copyCommand.ranges, 2 * sizeof(CopySourceRange), _, _))
+        .WillOnce(DoAll(SaveArgPointee<2>(&cmd), Return(0)));
+
+    UnvmeCmd unvmeCmd(mockCaller);
+
+    // When
+    int ret = unvmeCmd.RequestIO(&mockDevContext, nullptr, &mockIoContext);
+
+    // Then
+    EXPECT_EQ(ret, 0);
+    EXPECT_EQ(0x19, cmd.opc);
+    EXPECT_EQ(64U, cmd.cdw10);
+    EXPECT_EQ(1U, cmd.cdw11);
+    EXPECT_EQ(1U, cmd.cdw12);
+}
+
+TEST(UnvmeCmd, RequestIO_testIfCopyWithoutRangeIsRejected)
+{
+    // Given
+    NiceMock<MockUnvmeIOContext> mockIoContext;
+    NiceMock<MockUnvmeDeviceContext> mockDevContext;
+    CopyCommand copyCommand;
+    copyCommand.rangeCount = 0;
+    ON_CALL(mockIoContext, GetOpcode).WillByDefault(Return(UbioDir::Copy));
+    ON_CALL(mockIoContext, GetBuffer).WillByDefault(Return(&copyCommand));
+
+    NiceMock<MockSpdkNvmeCaller>* mockCaller = new NiceMock<MockSpdkNvmeCaller>();
+    EXPECT_CALL(*mockCaller, SpdkNvmeCtrlrCmdIoRaw).Times(0);
+
+    UnvmeCmd unvmeCmd(mockCaller);
+
+    // When
+    int ret = unvmeCmd.RequestIO(&mockDevContext, nullptr, &mockIoContext);
+
+    // Then
+    EXPECT_EQ(ret, -EINVAL);
+}
+
+TEST(UnvmeCmd, RequestIO_testIfVectoredReadIsSubmittedWithSgl)
+{
+    // Given
+    std::vector<struct iovec> ioVectors(2);
+    NiceMock<MockUnvmeIOContext> mockIoContext;
+    NiceMock<MockUnvmeDeviceContext> mockDevContext;
+    ON_CALL(mockIoContext, GetOpcode).WillByDefault(Return(UbioDir::Read));
+    ON_CALL(mockIoContext, GetIoVectors).WillByDefault(Return(&ioVectors));
+
+    NiceMock<MockSpdkNvmeCaller>* mockCaller = new NiceMock<MockSpdkNvmeCaller>();
+    EXPECT_CALL(*mockCaller, SpdkNvmeNsCmdRead).Times(0);
+    EXPECT_CALL(*mockCaller, SpdkNvmeNsCmdReadv).WillOnce(Return(0));
+
+    UnvmeCmd unvmeCmd(mockCaller);
+
+    // When
+    int ret = unvmeCmd.RequestIO(&mockDevContext, nullptr, &mockIoContext);
+
+    // Then
+    EXPECT_EQ(ret, 0);
+}
+
 TEST(UnvmeCmd, RequestIO_testIfUbioDirIsAbortAndWorksProperly)
 {
     // Given
@@ -2,6 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include "lib/spdk/lib/nvme/nvme_internal.h"
+#include "src/bio/ubio.h"
+
 namespace pos
 {
 
@@ -33,4 +36,46 @@ TEST(UnvmeDeviceContext, DecAdminCommandCount_testIfDecreasedSuccessfully)
     EXPECT_TRUE(ret);
 }
 
+TEST(UnvmeDeviceContext, GetIoQPair_testIfBackendQPairIsUsedWithoutFrontendQPair)
+{
+    // Given
+    UnvmeDeviceContext devCtx;
+    struct spdk_nvme_qpair backendQPair;
+    devCtx.ioQPair = &backendQPair;
+
+    // When, Then
+    EXPECT_EQ(&backendQPair, devCtx.GetIoQPair(UbioDir::Read, BackendEvent_FrontendIO));
+    EXPECT_EQ(&backendQPair, devCtx.GetIoQPair(UbioDir::Write, BackendEvent_FrontendIO));
+    EXPECT_EQ(&backendQPair, devCtx.GetIoQPair(UbioDir::Write, BackendEvent_Flush));
+}
+
+TEST(UnvmeDeviceContext, GetIoQPair_testIfQPairIsSelectedByTrafficClass)
+{
+    // Given
+    UnvmeDeviceContext devCtx;
+    struct spdk_nvme_qpair backendQPair, readQPair, writeQPair;
+    devCtx.ioQPair = &backendQPair;
+    devCtx.frontendQPair[UnvmeQpairClass_FrontendRead] = &readQPair;
+    devCtx.frontendQPair[UnvmeQpairClass_FrontendWrite] = &writeQPair;
+
+    // When, Then
+    EXPECT_EQ(&readQPair, devCtx.GetIoQPair(UbioDir::Read, BackendEvent_FrontendIO));
+    EXPECT_EQ(&writeQPair, devCtx.GetIoQPair(UbioDir::Write, BackendEvent_FrontendIO));
+    EXPECT_EQ(&backendQPair, devCtx.GetIoQPair(UbioDir::Write, BackendEvent_Flush));
+    EXPECT_EQ(&backendQPair, devCtx.GetIoQPair(UbioDir::Read, BackendEvent_GC));
+    EXPECT_EQ(&backendQPair, devCtx.GetIoQPair(UbioDir::Read, BackendEvent_UserdataRebuild));
+}
+
+TEST(UnvmeDeviceContext, GetPlacementClass_testIfWritesAreClassifiedByLifetime)
+{
+    // When, Then
+    EXPECT_EQ(UnvmePlacementClass_HostHot, UnvmeDeviceContext::GetPlacementClass(BackendEvent_FrontendIO));
+    EXPECT_EQ(UnvmePlacementClass_HostHot, UnvmeDeviceContext::GetPlacementClass(BackendEvent_Flush));
+    EXPECT_EQ(UnvmePlacementClass_GcCold, UnvmeDeviceContext::GetPlacementClass(BackendEvent_GC));
+    EXPECT_EQ(UnvmePlacementClass_GcCold, UnvmeDeviceContext::GetPlacementClass(BackendEvent_UserdataRebuild));
+    EXPECT_EQ(UnvmePlacementClass_Metadata, UnvmeDeviceContext::GetPlacementClass(BackendEvent_MetaIO));
+    EXPECT_EQ(UnvmePlacementClass_Metadata, UnvmeDeviceContext::GetPlacementClass(BackendEvent_FlushMap));
+    EXPECT_EQ(UnvmePlacementClass_Journal, UnvmeDeviceContext::GetPlacementClass(BackendEvent_JournalIO));
+}
+
 } // namespace pos
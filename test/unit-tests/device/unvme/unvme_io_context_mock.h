@@ -15,6 +15,8 @@ public:
     MOCK_METHOD(bool, IsFrontEnd, (), (override));
     MOCK_METHOD(void, SetAdminCommand, (), (override));
     MOCK_METHOD(bool, IsAdminCommand, (), (override));
+    MOCK_METHOD(void, SetSubmitTime, (uint64_t timeNs), (override));
+    MOCK_METHOD(uint64_t, GetSubmitTime, (), (override));
 
     // IoContext Functions
     MOCK_METHOD(void, SetErrorKey, (std::list<IOContext*>::iterator it), (override));
@@ -23,10 +25,12 @@ public:
     MOCK_METHOD(uint64_t, GetEncodedPCIeAddr, (), (override));
     MOCK_METHOD(UbioDir, GetOpcode, (), (override));
     MOCK_METHOD(void*, GetBuffer, (), (override));
+    MOCK_METHOD(const std::vector<struct iovec>*, GetIoVectors, (), (override));
     MOCK_METHOD(uint64_t, GetStartByteOffset, (), (override));
     MOCK_METHOD(uint64_t, GetByteCount, (), (override));
     MOCK_METHOD(uint64_t, GetStartSectorOffset, (), (override));
     MOCK_METHOD(uint64_t, GetSectorCount, (), (override));
+    MOCK_METHOD(BackendEvent, GetEventType, (), (override));
     MOCK_METHOD(void, AddPendingErrorCount, (uint32_t errorCountToAdd), (override));
     MOCK_METHOD(void, SubtractPendingErrorCount, (uint32_t errorCountToSubtract), (override));
     MOCK_METHOD(void, CompleteIo, (IOErrorType error), (override));
@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include "src/bio/ubio.h"
+
 namespace pos
 {
 
@@ -18,4 +20,37 @@ TEST(UnvmeIOContext, SetAdminCommand_testIfSetProperly)
 
 }
 
+TEST(UnvmeIOContext, GetNextSge_testIfIoVectorsAreReturnedFromSglOffset)
+{
+    // Given
+    char first[4096];
+    char second[8192];
+    std::vector<struct iovec> ioVectors = {
+        {.iov_base = first, .iov_len = sizeof(first)},
+        {.iov_base = second, .iov_len = sizeof(second)}};
+    UbioSmartPtr ubio(new Ubio(ioVectors, 0));
+    UnvmeIOContext ioCtx(nullptr, ubio, 0, false);
+    void* address = nullptr;
+    uint32_t length = 0;
+
+    // When : spdk restarts the sgl in the middle of the second vector
+    ioCtx.ResetSgl(sizeof(first) + 512);
+
+    // Then
+    EXPECT_EQ(0, ioCtx.GetNextSge(&address, &length));
+    EXPECT_EQ(second + 512, address);
+    EXPECT_EQ(sizeof(second) - 512, length);
+    EXPECT_NE(0, ioCtx.GetNextSge(&address, &length));
+
+    // When : spdk restarts the sgl from the beginning
+    ioCtx.ResetSgl(0);
+
+    // Then
+    EXPECT_EQ(0, ioCtx.GetNextSge(&address, &length));
+    EXPECT_EQ(first, address);
+    EXPECT_EQ(sizeof(first), length);
+    EXPECT_EQ(0, ioCtx.GetNextSge(&address, &length));
+    EXPECT_EQ(second, address);
+}
+
 } // namespace pos
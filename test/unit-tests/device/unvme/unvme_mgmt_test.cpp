@@ -120,6 +120,28 @@ TEST(UnvmeMgmt, Close_testIfFailedToFreeIoQpair)
     EXPECT_FALSE(ret);
 }
 
+TEST(UnvmeMgmt, Close_testIfFrontendQPairsAreFreed)
+{
+    // Given
+    NiceMock<MockSpdkNvmeCaller>* mockCaller = new NiceMock<MockSpdkNvmeCaller>();
+    EXPECT_CALL(*mockCaller, SpdkNvmeCtrlrFreeIoQpair).Times(3).WillRepeatedly(Return(0));
+    UnvmeMgmt unvmeMgmt(mockCaller);
+    UnvmeDeviceContext devCtx;
+    struct spdk_nvme_qpair backendQPair, readQPair, writeQPair;
+    devCtx.ioQPair = &backendQPair;
+    devCtx.frontendQPair[UnvmeQpairClass_FrontendRead] = &readQPair;
+    devCtx.frontendQPair[UnvmeQpairClass_FrontendWrite] = &writeQPair;
+
+    // When
+    bool ret = unvmeMgmt.Close(&devCtx);
+
+    // Then
+    EXPECT_TRUE(ret);
+    EXPECT_EQ(nullptr, devCtx.ioQPair);
+    EXPECT_EQ(nullptr, devCtx.frontendQPair[UnvmeQpairClass_FrontendRead]);
+    EXPECT_EQ(nullptr, devCtx.frontendQPair[UnvmeQpairClass_FrontendWrite]);
+}
+
 TEST(UnvmeMgmt, ScanDevs_testIfSpdkInitAlreadyDone)
 {
     // Given
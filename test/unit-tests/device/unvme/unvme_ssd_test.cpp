@@ -56,3 +56,31 @@ TEST(UnvmeSsd, GetByteAddress_testIfGetByteAddressInUnvmeSsd)
     // Then
     EXPECT_EQ(ret, nullptr);
 }
+
+TEST(UnvmeSsd, UnvmeSsd_testIfZonedNamespaceIsReportedInProperty)
+{
+    // Given
+    NiceMock<MockSpdkNvmeCaller>* mockSpdkNvmeCaller =
+        new NiceMock<MockSpdkNvmeCaller>();
+    NiceMock<MockSpdkEnvCaller>* mockSpdkEnvCaller =
+        new NiceMock<MockSpdkEnvCaller>();
+    struct spdk_nvme_ns* ns = nullptr;
+    struct spdk_nvme_ctrlr_data data;
+    data.mn[0] = 0;
+    data.sn[0] = 0;
+    uint64_t zoneSize = 1024 * 1024;
+    EXPECT_CALL(*mockSpdkNvmeCaller, SpdkNvmeCtrlrGetData)
+        .Times(3).WillRepeatedly(Return(&data));
+    EXPECT_CALL(*mockSpdkNvmeCaller, SpdkNvmeNsGetCsi)
+        .WillOnce(Return(SPDK_NVME_CSI_ZNS));
+    ON_CALL(*mockSpdkNvmeCaller, SpdkNvmeZnsNsGetZoneSize)
+        .WillByDefault(Return(zoneSize));
+
+    // When
+    UnvmeSsd unvmeSsd(
+        "", 0, nullptr, ns, "", mockSpdkNvmeCaller, mockSpdkEnvCaller);
+
+    // Then
+    EXPECT_TRUE(unvmeSsd.GetProperty().zoned);
+    EXPECT_EQ(zoneSize, unvmeSsd.GetProperty().zoneSize);
+}
@@ -16,6 +16,12 @@ TEST(UramRestoreCompletion, WaitPendingUbioZero_)
 {
 }
 
+TEST(UramRestoreCompletion, WaitPendingUbioBelow_testIfItReturnsWhenNothingIsPending)
+{
+    // When, Then: returns without waiting
+    UramRestoreCompletion::WaitPendingUbioBelow(1);
+}
+
 TEST(UramRestoreCompletion, _DoSpecificJob_)
 {
 }
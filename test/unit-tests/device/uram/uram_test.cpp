@@ -3,12 +3,31 @@
 #include <gtest/gtest.h>
 
 #include "test/unit-tests/device/uram/uram_drv_mock.h"
+#include "test/unit-tests/master_context/config_manager_mock.h"
 
 using testing::_;
 using testing::NiceMock;
 using testing::Return;
 
 using namespace pos;
+
+class UramSpy : public Uram
+{
+public:
+    using Uram::Uram;
+    bool
+    IsCopyOffloadTarget(uint64_t size, uint32_t ioatReactorCount, bool ioatReactorNow)
+    {
+        return Uram::_IsCopyOffloadTarget(size, ioatReactorCount, ioatReactorNow);
+    }
+};
+
+ACTION_P(SetArg2ToUint64AndReturn0, value)
+{
+    *static_cast<uint64_t*>(arg2) = value;
+    return 0;
+}
+
 TEST(Uram, Open_testIfFailedToOpenDeviceDriver)
 {
     // Given
@@ -88,3 +107,51 @@ TEST(Uram, GetName_testIfGetNameProperly)
     // Then
     EXPECT_EQ(name, ret);
 }
+
+TEST(Uram, IsCopyOffloadTarget_testIfDefaultThresholdIsUsedWithoutConfig)
+{
+    // Given
+    NiceMock<MockConfigManager> mockConfigManager;
+    ON_CALL(mockConfigManager, GetValue("ioat", "copy_offload_threshold_kb", _, _)).WillByDefault(Return(-1));
+    UramSpy uram("uram", 0, nullptr, 0, &mockConfigManager);
+
+    // When, Then: ios from 128KB are forwarded to an ioat reactor
+    EXPECT_TRUE(uram.IsCopyOffloadTarget(128 * 1024, 2, false));
+    EXPECT_FALSE(uram.IsCopyOffloadTarget(128 * 1024 - 512, 2, false));
+}
+
+TEST(Uram, IsCopyOffloadTarget_testIfConfiguredThresholdIsUsed)
+{
+    // Given
+    NiceMock<MockConfigManager> mockConfigManager;
+    ON_CALL(mockConfigManager, GetValue("ioat", "copy_offload_threshold_kb", _, _)).WillByDefault(SetArg2ToUint64AndReturn0(64));
+    UramSpy uram("uram", 0, nullptr, 0, &mockConfigManager);
+
+    // When, Then
+    EXPECT_TRUE(uram.IsCopyOffloadTarget(64 * 1024, 2, false));
+    EXPECT_FALSE(uram.IsCopyOffloadTarget(32 * 1024, 2, false));
+}
+
+TEST(Uram, IsCopyOffloadTarget_testIfZeroThresholdDisablesForwarding)
+{
+    // Given
+    NiceMock<MockConfigManager> mockConfigManager;
+    ON_CALL(mockConfigManager, GetValue("ioat", "copy_offload_threshold_kb", _, _)).WillByDefault(SetArg2ToUint64AndReturn0(0));
+    UramSpy uram("uram", 0, nullptr, 0, &mockConfigManager);
+
+    // When, Then
+    EXPECT_FALSE(uram.IsCopyOffloadTarget(1024 * 1024, 2, false));
+}
+
+TEST(Uram, IsCopyOffloadTarget_testIfIoIsKeptWithoutIoatOrOnIoatReactor)
+{
+    // Given
+    NiceMock<MockConfigManager> mockConfigManager;
+    ON_CALL(mockConfigManager, GetValue("ioat", "copy_offload_threshold_kb", _, _)).WillByDefault(SetArg2ToUint64AndReturn0(64));
+    UramSpy uram("uram", 0, nullptr, 0, &mockConfigManager);
+
+    // When, Then: no reactor owns an ioat channel
+    EXPECT_FALSE(uram.IsCopyOffloadTarget(1024 * 1024, 0, false));
+    // When, Then: the current reactor already copies by dma
+    EXPECT_FALSE(uram.IsCopyOffloadTarget(1024 * 1024, 2, true));
+}
@@ -26,6 +26,48 @@ TEST(DumpSharedPtr, newdeleteOperator)
     delete[] dumpSharedPtr3;
 }
 
+TEST(DumpSharedPtr, newOperator_testIfOnlySampledObjectsAreTracked)
+{
+    // Given : DumpSharedPtr is turned on, and one in two objects is tracked
+    pos::DumpSharedModuleInstanceEnable::debugLevelEnable = true;
+    pos::DumpSharedModuleInstanceEnable::sampleRate = 2;
+    DumpSharedModuleInstanceSingleton<DumpSharedPtrTest*, 3>::ResetInstance();
+    auto dumpModule = DumpSharedModuleInstanceSingleton<DumpSharedPtrTest*, 3>::Instance()->DumpInstance();
+
+    // When : four objects are created
+    DumpSharedPtrTest* dumpSharedPtr[4];
+    for (auto& ptr : dumpSharedPtr)
+    {
+        ptr = new DumpSharedPtrTest;
+    }
+
+    // Then : two of them are tracked, and untracked when deleted
+    EXPECT_EQ(2U, dumpModule->dumpMap.size());
+    for (auto& ptr : dumpSharedPtr)
+    {
+        delete ptr;
+    }
+    EXPECT_EQ(0U, dumpModule->dumpMap.size());
+    pos::DumpSharedModuleInstanceEnable::sampleRate = 1;
+    DumpSharedModuleInstanceSingleton<DumpSharedPtrTest*, 3>::ResetInstance();
+}
+
+TEST(DumpSharedPtr, newOperator_testIfNoObjectIsTrackedWithoutDebugLevel)
+{
+    // Given : DumpSharedPtr is turned off
+    pos::DumpSharedModuleInstanceEnable::debugLevelEnable = false;
+    DumpSharedModuleInstanceSingleton<DumpSharedPtrTest*, 3>::ResetInstance();
+    auto dumpModule = DumpSharedModuleInstanceSingleton<DumpSharedPtrTest*, 3>::Instance()->DumpInstance();
+
+    // When : DumpSharedPtr is newly created
+    DumpSharedPtrTest* dumpSharedPtr = new DumpSharedPtrTest;
+
+    // Then : it is not tracked
+    EXPECT_EQ(0U, dumpModule->dumpMap.size());
+    delete dumpSharedPtr;
+    DumpSharedModuleInstanceSingleton<DumpSharedPtrTest*, 3>::ResetInstance();
+}
+
 } // namespace pos
 
 namespace pos
@@ -0,0 +1,194 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/event_scheduler/backend_event_stealing_policy.h"
+
+#include <gtest/gtest.h>
+
+#include "src/event_scheduler/event_worker.h"
+#include "src/qos/qos_common.h"
+#include "test/unit-tests/event_scheduler/event_scheduler_mock.h"
+#include "test/unit-tests/qos/qos_manager_mock.h"
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+class StubEventBESP : public Event
+{
+public:
+    StubEventBESP(void)
+    : Event(false, BackendEvent_GC)
+    {
+    }
+    virtual bool Execute(void) final
+    {
+        return true;
+    }
+};
+
+static void
+AdmitAll(BackendEventStealingPolicy& policy)
+{
+    const uint32_t MAX_RUN = 100;
+    for (uint32_t run = 0; run < MAX_RUN; run++)
+    {
+        if (QosReturnCode::FAILURE == policy.Run())
+        {
+            break;
+        }
+    }
+}
+
+TEST(BackendEventStealingPolicy, BackendEventStealingPolicy_Stack)
+{
+    // Given
+    NiceMock<MockQosManager> mockQosManager;
+    std::vector<EventWorker*> workerArray;
+
+    // When
+    BackendEventStealingPolicy policy(&mockQosManager, &workerArray, 2);
+
+    // Then
+    EXPECT_EQ(0, policy.GetLocalPickCount());
+    EXPECT_EQ(0, policy.GetStealCount());
+    EXPECT_EQ(0, policy.GetOverflowCount());
+}
+
+TEST(BackendEventStealingPolicy, PickWorkerEvent_testIfEachWorkerPicksFromItsOwnRing)
+{
+    // Given
+    NiceMock<MockQosManager> mockQosManager;
+    NiceMock<MockEventScheduler> mockEventScheduler;
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(1, &cpuSet);
+    EventWorker worker0{cpuSet, &mockEventScheduler, 0};
+    EventWorker worker1{cpuSet, &mockEventScheduler, 1};
+    std::vector<EventWorker*> workerArray = {&worker0, &worker1};
+    std::vector<uint32_t> workerIDPerNuma[RTE_MAX_NUMA_NODES];
+    workerIDPerNuma[0] = {0, 1};
+    BackendEventStealingPolicy policy(&mockQosManager, &workerArray, 2);
+    policy.Init(workerIDPerNuma, {0, 1}, false);
+    EventSmartPtr event0 = std::make_shared<StubEventBESP>();
+    EventSmartPtr event1 = std::make_shared<StubEventBESP>();
+    policy.EnqueueEvent(event0);
+    policy.EnqueueEvent(event1);
+    AdmitAll(policy);
+
+    // When
+    EventSmartPtr picked0 = policy.PickWorkerEvent(&worker0);
+    EventSmartPtr picked1 = policy.PickWorkerEvent(&worker1);
+
+    // Then
+    EXPECT_EQ(event0, picked0);
+    EXPECT_EQ(event1, picked1);
+    EXPECT_EQ(2, policy.GetLocalPickCount());
+    EXPECT_EQ(0, policy.GetStealCount());
+    EXPECT_EQ(nullptr, policy.PickWorkerEvent(&worker0));
+}
+
+TEST(BackendEventStealingPolicy, PickWorkerEvent_testIfIdleWorkerStealsSurplusOfBusyPeer)
+{
+    // Given
+    NiceMock<MockQosManager> mockQosManager;
+    NiceMock<MockEventScheduler> mockEventScheduler;
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(1, &cpuSet);
+    EventWorker worker0{cpuSet, &mockEventScheduler, 0};
+    EventWorker worker1{cpuSet, &mockEventScheduler, 1};
+    std::vector<EventWorker*> workerArray = {&worker0, &worker1};
+    std::vector<uint32_t> workerIDPerNuma[RTE_MAX_NUMA_NODES];
+    workerIDPerNuma[0] = {0, 1};
+    BackendEventStealingPolicy policy(&mockQosManager, &workerArray, 2);
+    policy.Init(workerIDPerNuma, {0, 1}, false);
+    EventSmartPtr events[4];
+    for (uint32_t index = 0; index < 4; index++)
+    {
+        events[index] = std::make_shared<StubEventBESP>();
+        policy.EnqueueEvent(events[index]);
+    }
+    AdmitAll(policy);
+
+    // When: worker0 keeps busy with its first event, worker1 drains its own and comes back
+    EventSmartPtr busy = policy.PickWorkerEvent(&worker0);
+    EventSmartPtr own0 = policy.PickWorkerEvent(&worker1);
+    EventSmartPtr own1 = policy.PickWorkerEvent(&worker1);
+    EventSmartPtr stolen = policy.PickWorkerEvent(&worker1);
+
+    // Then
+    EXPECT_EQ(events[0], busy);
+    EXPECT_EQ(events[1], own0);
+    EXPECT_EQ(events[3], own1);
+    EXPECT_EQ(events[2], stolen);
+    EXPECT_EQ(3, policy.GetLocalPickCount());
+    EXPECT_EQ(1, policy.GetStealCount());
+    EXPECT_EQ(nullptr, policy.PickWorkerEvent(&worker0));
+}
+
+TEST(BackendEventStealingPolicy, PickWorkerEvent_testIfNumaDedicatedWorkerDoesNotStealAcrossNuma)
+{
+    // Given
+    NiceMock<MockQosManager> mockQosManager;
+    NiceMock<MockEventScheduler> mockEventScheduler;
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(1, &cpuSet);
+    EventWorker worker0{cpuSet, &mockEventScheduler, 0};
+    EventWorker worker1{cpuSet, &mockEventScheduler, 1};
+    std::vector<EventWorker*> workerArray = {&worker0, &worker1};
+    std::vector<uint32_t> workerIDPerNuma[RTE_MAX_NUMA_NODES];
+    workerIDPerNuma[0] = {0};
+    workerIDPerNuma[1] = {1};
+    BackendEventStealingPolicy policy(&mockQosManager, &workerArray, 2);
+    policy.Init(workerIDPerNuma, {0, 1}, true);
+    for (uint32_t index = 0; index < 4; index++)
+    {
+        policy.EnqueueEvent(std::make_shared<StubEventBESP>());
+    }
+    AdmitAll(policy);
+    policy.PickWorkerEvent(&worker0);
+    policy.PickWorkerEvent(&worker1);
+    policy.PickWorkerEvent(&worker1);
+
+    // When
+    EventSmartPtr stolen = policy.PickWorkerEvent(&worker1);
+
+    // Then
+    EXPECT_EQ(nullptr, stolen);
+    EXPECT_EQ(0, policy.GetStealCount());
+}
+
+} // namespace pos
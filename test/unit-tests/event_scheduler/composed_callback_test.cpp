@@ -0,0 +1,153 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2021 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/event_scheduler/composed_callback.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "test/unit-tests/event_scheduler/event_scheduler_mock.h"
+
+using ::testing::NiceMock;
+
+namespace pos
+{
+class StubBaseCallback : public Callback
+{
+public:
+    StubBaseCallback(std::string& trace, bool result, EventScheduler* eventSchedulerArg)
+    : Callback(true, CallbackType_Unknown, 1, nullptr, eventSchedulerArg),
+      trace(trace),
+      result(result)
+    {
+    }
+    void SetResult(bool value)
+    {
+        result = value;
+    }
+    uint32_t GetErrorCount(void)
+    {
+        return _GetErrorCount();
+    }
+
+protected:
+    bool _DoSpecificJob(void) override
+    {
+        trace += "B";
+        return result;
+    }
+
+private:
+    std::string& trace;
+    bool result;
+};
+
+class StubStage
+{
+public:
+    StubStage(std::string& trace, char name, bool fail = false)
+    : trace(&trace),
+      name(name),
+      fail(fail)
+    {
+    }
+    void Run(Callback& host, uint32_t errorCount)
+    {
+        *trace += name;
+        if (fail)
+        {
+            host.InformError(IOErrorType::GENERIC_ERROR);
+        }
+    }
+
+private:
+    std::string* trace;
+    char name;
+    bool fail;
+};
+
+TEST(ComposedCallback, Execute_RunsStagesInOrderBeforeBase)
+{
+    // Given: a base callback with two stages
+    NiceMock<MockEventScheduler> mockEventScheduler;
+    std::string trace;
+    ComposedCallback<StubBaseCallback, StubStage, StubStage> callback(
+        std::make_tuple(StubStage(trace, '1'), StubStage(trace, '2')),
+        trace, true, &mockEventScheduler);
+
+    // When: Execute
+    bool actual = callback.Execute();
+
+    // Then: the stages run in order and the base job runs last
+    EXPECT_TRUE(actual);
+    EXPECT_EQ("12B", trace);
+}
+
+TEST(ComposedCallback, Execute_RunsStagesOnceWhenBaseIsRetried)
+{
+    // Given: a base callback that asks to be retried once
+    NiceMock<MockEventScheduler> mockEventScheduler;
+    std::string trace;
+    ComposedCallback<StubBaseCallback, StubStage> callback(
+        std::make_tuple(StubStage(trace, '1')),
+        trace, false, &mockEventScheduler);
+
+    // When: Execute twice
+    EXPECT_FALSE(callback.Execute());
+    callback.SetResult(true);
+    EXPECT_TRUE(callback.Execute());
+
+    // Then: only the base job runs again
+    EXPECT_EQ("1BB", trace);
+}
+
+TEST(ComposedCallback, Execute_StageErrorReachesCallee)
+{
+    // Given: a failing stage and a callee
+    NiceMock<MockEventScheduler> mockEventScheduler;
+    std::string trace, calleeTrace;
+    auto callback = std::make_shared<ComposedCallback<StubBaseCallback, StubStage>>(
+        std::make_tuple(StubStage(trace, '1', true)),
+        trace, true, &mockEventScheduler);
+    auto callee = std::make_shared<StubBaseCallback>(calleeTrace, true, &mockEventScheduler);
+    callback->SetCallee(callee);
+
+    // When: Execute
+    callback->Execute();
+
+    // Then: the callee runs inline and the error of the stage reaches it
+    EXPECT_EQ("B", calleeTrace);
+    EXPECT_EQ(1, callee->GetErrorCount());
+}
+
+} // namespace pos
@@ -0,0 +1,40 @@
+#include "src/event_scheduler/continuation_callback.h"
+
+#include <gtest/gtest.h>
+
+#include <future>
+
+namespace pos
+{
+TEST(ContinuationCallback, Execute_testIfContinuationRunsWithErrorCount)
+{
+    // Given: continuation callback which failed once
+    uint32_t calledErrorCount = UINT32_MAX;
+    ContinuationCallback callback([&](uint32_t errorCount) { calledErrorCount = errorCount; });
+    callback.InformError(IOErrorType::GENERIC_ERROR);
+
+    // When: the callback is executed
+    bool actual = callback.Execute();
+
+    // Then: the continuation gets the error count and the callback is done
+    EXPECT_TRUE(actual);
+    EXPECT_EQ(1, calledErrorCount);
+}
+
+TEST(ContinuationCallback, WithFuture_testIfFutureIsReadyAfterExecute)
+{
+    // Given: callback bound to a future
+    std::future<uint32_t> future;
+    CallbackSmartPtr callback = ContinuationCallback::WithFuture(future, CallbackType_SyncIoCompletion);
+    EXPECT_EQ(std::future_status::timeout, future.wait_for(std::chrono::seconds(0)));
+
+    // When: the callback is executed
+    callback->Execute();
+
+    // Then: the future gives the error count
+    EXPECT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(0)));
+    EXPECT_EQ(0, future.get());
+    EXPECT_EQ(CallbackType_SyncIoCompletion, callback->GetCallbackType());
+}
+
+} // namespace pos
@@ -18,6 +18,7 @@ public:
     MOCK_METHOD(void, IoEnqueued, (BackendEvent type, uint64_t size), (override));
     MOCK_METHOD(void, IoDequeued, (BackendEvent type, uint64_t size), (override));
     MOCK_METHOD(int32_t, GetAllowedIoCount, (BackendEvent eventId), (override));
+    MOCK_METHOD(bool, TryParkWorker, (EventWorker* worker, uint32_t idleRounds), (override));
     // MOCK_METHOD(uint32_t, GetWorkerIDMinimumJobs, (uint32_t numa), (override));
     // MOCK_METHOD((EventSmartPtr), DequeueWorkerEvent, (), (override));
     // MOCK_METHOD(uint32_t, GetWorkerQueueSize, (), (override));
@@ -0,0 +1,84 @@
+#include "src/event_scheduler/event_scheduler_statistics.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "test/unit-tests/event_scheduler/event_mock.h"
+#include "test/unit-tests/telemetry/telemetry_client/easy_telemetry_publisher_mock.h"
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::StrEq;
+
+namespace pos
+{
+TEST(EventSchedulerStatistics, RecordPick_testIfWaitTimeAndQueueDepthAreKeptPerEventType)
+{
+    // Given
+    EventSchedulerStatistics statistics;
+    NiceMock<MockEvent> flushEvent;
+    NiceMock<MockEvent> gcEvent;
+    ON_CALL(flushEvent, GetEventType).WillByDefault(Return(BackendEvent_Flush));
+    ON_CALL(gcEvent, GetEventType).WillByDefault(Return(BackendEvent_GC));
+
+    // When
+    statistics.RecordEnqueue(&flushEvent);
+    statistics.RecordEnqueue(&gcEvent);
+
+    // Then
+    EXPECT_EQ(1, statistics.GetQueueDepth(BackendEvent_Flush));
+    EXPECT_EQ(1, statistics.GetQueueDepth(BackendEvent_GC));
+
+    // When
+    flushEvent.SetEnqueueTime(EventSchedulerStatistics::GetTime() - 5000000);
+    statistics.RecordPick(&flushEvent);
+
+    // Then: about 5ms, within the 12.5% resolution of the histogram
+    std::vector<uint64_t> counts = statistics.CollectWaitTime(BackendEvent_Flush);
+    EXPECT_EQ(1, PerCoreHistogram::GetTotalCount(counts));
+    EXPECT_LE(5000, PerCoreHistogram::GetMax(counts));
+    EXPECT_GE(6000, PerCoreHistogram::GetMax(counts));
+    EXPECT_EQ(0, PerCoreHistogram::GetTotalCount(statistics.CollectWaitTime(BackendEvent_GC)));
+    EXPECT_EQ(0, statistics.GetQueueDepth(BackendEvent_Flush));
+    EXPECT_EQ(0, flushEvent.GetEnqueueTime());
+}
+
+TEST(EventSchedulerStatistics, RecordPick_testIfEventNotCountedAtEnqueueIsIgnored)
+{
+    // Given
+    EventSchedulerStatistics statistics;
+    NiceMock<MockEvent> event;
+    ON_CALL(event, GetEventType).WillByDefault(Return(BackendEvent_MetaIO));
+
+    // When: e.g. an event sent to a reactor and enqueued again by a worker
+    statistics.RecordPick(&event);
+
+    // Then
+    EXPECT_EQ(0, statistics.GetQueueDepth(BackendEvent_MetaIO));
+    EXPECT_EQ(0, PerCoreHistogram::GetTotalCount(statistics.CollectWaitTime(BackendEvent_MetaIO)));
+}
+
+TEST(EventSchedulerStatistics, Flush_testIfBusyPercentIsPublishedPerWorker)
+{
+    // Given
+    EventSchedulerStatistics statistics;
+    NiceMock<MockEasyTelemetryPublisher> publisher;
+    statistics.SetWorkerCount(2);
+    statistics.Flush();
+    statistics.RecordExecution(1, EventSchedulerStatistics::GetTime() - 1000000000ULL);
+
+    // Then: a depth per event type, and busy percent for both workers
+    EXPECT_CALL(publisher, UpdateGauge(StrEq(TEL130030_EVENT_QUEUE_DEPTH), _, _))
+        .Times(static_cast<int>(BackendEvent_Count));
+    EXPECT_CALL(publisher, UpdateGauge(StrEq(TEL130031_EVENT_WORKER_BUSY_PERCENT), 0, _)).Times(1);
+    EXPECT_CALL(publisher, UpdateGauge(StrEq(TEL130031_EVENT_WORKER_BUSY_PERCENT), 100, _)).Times(1);
+
+    // When
+    statistics.Initialize(&publisher);
+    statistics.Dispose();
+    statistics.Flush();
+    EXPECT_LE(1000000000ULL, statistics.GetBusyTime(1));
+}
+} // namespace pos
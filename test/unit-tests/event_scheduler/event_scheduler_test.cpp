@@ -34,6 +34,7 @@
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <unistd.h>
 
 #include "src/cpu_affinity/affinity_manager.h"
 #include "src/event_scheduler/event.h"
@@ -147,6 +148,47 @@ TEST(EventScheduler, Initialize_NotEnoughCore)
     // Then: Do nothing
 }
 
+TEST(EventScheduler, TryParkWorker_KeepsMinActiveWorkers)
+{
+    // Given: elastic event workers with one worker kept active
+    NiceMock<MockQosManager> mockQosManager;
+    NiceMock<MockConfigManager> mockConfigManager;
+    NiceMock<MockAffinityManager> mockAffinityManager;
+    ON_CALL(mockConfigManager, GetValue).WillByDefault(
+        [] (string module, string key, void* value, ConfigType type)
+        {
+            if (key == "event_worker_elastic_enable")
+            {
+                *static_cast<bool*>(value) = true;
+            }
+            else if (key == "event_worker_min_active_count")
+            {
+                *static_cast<uint32_t*>(value) = 1;
+            }
+            return static_cast<int>(EID(SUCCESS));
+        });
+    ON_CALL(mockAffinityManager, GetTotalCore()).WillByDefault(Return(10));
+    ON_CALL(mockAffinityManager, GetNumaIdFromCoreId(_)).WillByDefault(Return(0));
+    EventScheduler eventScheduler{&mockQosManager, &mockConfigManager, &mockAffinityManager};
+    cpu_set_t schedulerCPU, eventCPU;
+    CPU_ZERO(&schedulerCPU);
+    CPU_SET(1, &schedulerCPU);
+    CPU_ZERO(&eventCPU);
+    CPU_SET(2, &eventCPU);
+    CPU_SET(3, &eventCPU);
+
+    // When: both workers stay idle
+    eventScheduler.Initialize(2, schedulerCPU, eventCPU);
+    for (int retry = 0; retry < 1000 && eventScheduler.GetActiveWorkerCount() > 1; retry++)
+    {
+        usleep(10000);
+    }
+
+    // Then: one worker parks and the other keeps polling
+    EXPECT_EQ(1, eventScheduler.GetActiveWorkerCount());
+    EXPECT_FALSE(eventScheduler.TryParkWorker(nullptr, UINT32_MAX));
+}
+
 /*TEST(EventScheduler, GetWorkerIDMinimumJobs)
 {
     // Given: MockQosManager, MockConfigManager, MockAffinityManager, EventScheduler
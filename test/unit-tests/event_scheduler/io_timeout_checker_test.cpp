@@ -0,0 +1,124 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "src/event_scheduler/io_timeout_checker.h"
+
+#include <gtest/gtest.h>
+
+namespace pos
+{
+class IoTimeoutCheckerSpy : public IoTimeoutChecker
+{
+public:
+    IoTimeoutCheckerSpy(void)
+    {
+        // count without starting the timer, the test moves the time itself
+        initialize = true;
+    }
+    using IoTimeoutChecker::_GetPendingCnt;
+    using IoTimeoutChecker::_GetStuckCnt;
+};
+
+static void
+MoveTime(IoTimeoutChecker& checker, uint64_t from, uint64_t to)
+{
+    for (uint64_t time = from; time <= to; time++)
+    {
+        checker.MoveCurrentIdx(time);
+    }
+}
+
+TEST(IoTimeoutChecker, MoveCurrentIdx_testIfReusedSlotCountsOnlyNewCallbacks)
+{
+    // Given: a callback pending since time 0 for a whole turn of the wheel
+    IoTimeoutCheckerSpy checker;
+    CallbackType type = CallbackType_Unknown;
+    checker.IncreasePendingCnt(type, 0);
+
+    // When: its slot is about to be reused
+    MoveTime(checker, 1, PENDING_IO_WHEEL_SIZE - 1);
+
+    // Then: it is counted as stuck and the slot starts empty
+    EXPECT_EQ(1, checker._GetStuckCnt(type));
+    EXPECT_EQ(0, checker._GetPendingCnt(type, 0));
+
+    // When: a new callback is counted in the reused slot
+    checker.IncreasePendingCnt(type, PENDING_IO_WHEEL_SIZE);
+
+    // Then
+    EXPECT_EQ(1, checker._GetPendingCnt(type, 0));
+    EXPECT_EQ(1, checker._GetStuckCnt(type));
+}
+
+TEST(IoTimeoutChecker, DecreasePendingCnt_testIfStuckCallbackCompletesWithoutTouchingReusedSlot)
+{
+    // Given: a stuck callback from time 0 and a new one in the same slot
+    IoTimeoutCheckerSpy checker;
+    CallbackType type = CallbackType_Unknown;
+    checker.IncreasePendingCnt(type, 0);
+    MoveTime(checker, 1, PENDING_IO_WHEEL_SIZE);
+    checker.IncreasePendingCnt(type, PENDING_IO_WHEEL_SIZE);
+
+    // When: the stuck callback completes late
+    checker.DecreasePendingCnt(type, 0);
+
+    // Then: only the stuck count goes down
+    EXPECT_EQ(0, checker._GetStuckCnt(type));
+    EXPECT_EQ(1, checker._GetPendingCnt(type, 0));
+
+    // When: the new one completes
+    checker.DecreasePendingCnt(type, PENDING_IO_WHEEL_SIZE);
+
+    // Then
+    EXPECT_EQ(0, checker._GetPendingCnt(type, 0));
+    EXPECT_EQ(0, checker._GetStuckCnt(type));
+}
+
+TEST(IoTimeoutChecker, DecreasePendingCnt_testIfYoungCallbackCompletesInItsSlot)
+{
+    // Given
+    IoTimeoutCheckerSpy checker;
+    CallbackType type = CallbackType_Unknown;
+    MoveTime(checker, 1, 3);
+    checker.IncreasePendingCnt(type, 3);
+    MoveTime(checker, 4, 10);
+
+    // When
+    checker.DecreasePendingCnt(type, 3);
+
+    // Then
+    EXPECT_EQ(0, checker._GetPendingCnt(type, 3));
+    EXPECT_EQ(0, checker._GetStuckCnt(type));
+}
+
+} // namespace pos
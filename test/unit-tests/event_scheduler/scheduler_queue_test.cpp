@@ -33,6 +33,7 @@
 #include "src/event_scheduler/scheduler_queue.h"
 
 #include <gtest/gtest.h>
+#include <vector>
 
 #include "test/unit-tests/qos/qos_manager_mock.h"
 
@@ -136,4 +137,61 @@ TEST(SchedulerQueue, DequeueEvent_OneInput)
     EXPECT_EQ(event.get(), result.get());
 }
 
+TEST(SchedulerQueue, DequeueEvent_ArrayFairShareByWeight)
+{
+    // Given: SchedulerQueue with array fair share, array 0 weighted twice as array 1
+    NiceMock<MockQosManager> mockQosManager;
+    SchedulerQueue schedulerQueue {&mockQosManager};
+    schedulerQueue.SetArrayFairShare(true);
+    schedulerQueue.SetArrayWeight(0, 2);
+    schedulerQueue.SetArrayWeight(1, 1);
+    for (int count = 0; count < 4; count++)
+    {
+        auto busyArrayEvent = std::make_shared<StubEventSQ>(false, BackendEvent_GC);
+        busyArrayEvent->SetArrayId(0);
+        schedulerQueue.EnqueueEvent(busyArrayEvent);
+    }
+    for (int count = 0; count < 2; count++)
+    {
+        auto otherArrayEvent = std::make_shared<StubEventSQ>(false, BackendEvent_Flush);
+        otherArrayEvent->SetArrayId(1);
+        schedulerQueue.EnqueueEvent(otherArrayEvent);
+    }
+    EXPECT_EQ(6u, schedulerQueue.GetQueueSize());
+
+    // When: Dequeue all events
+    std::vector<int> order;
+    EventSmartPtr event = schedulerQueue.DequeueEvent();
+    while (nullptr != event)
+    {
+        order.push_back(event->GetArrayId());
+        event = schedulerQueue.DequeueEvent();
+    }
+
+    // Then: Arrays are served by their weight instead of arrival order
+    std::vector<int> expected {0, 0, 1, 0, 0, 1};
+    EXPECT_EQ(expected, order);
+}
+
+TEST(SchedulerQueue, DequeueEvent_FifoWithoutArrayFairShare)
+{
+    // Given: SchedulerQueue without array fair share
+    NiceMock<MockQosManager> mockQosManager;
+    SchedulerQueue schedulerQueue {&mockQosManager};
+    auto first = std::make_shared<StubEventSQ>(false);
+    first->SetArrayId(1);
+    auto second = std::make_shared<StubEventSQ>(false);
+    second->SetArrayId(0);
+    schedulerQueue.EnqueueEvent(first);
+    schedulerQueue.EnqueueEvent(second);
+
+    // When: Dequeue twice
+    EventSmartPtr result1 = schedulerQueue.DequeueEvent();
+    EventSmartPtr result2 = schedulerQueue.DequeueEvent();
+
+    // Then: Events come out in arrival order
+    EXPECT_EQ(first.get(), result1.get());
+    EXPECT_EQ(second.get(), result2.get());
+}
+
 } // namespace pos
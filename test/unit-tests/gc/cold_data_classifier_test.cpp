@@ -0,0 +1,144 @@
+#include "src/gc/cold_data_classifier.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "src/include/pos_event_id.h"
+#include "test/unit-tests/allocator/context_manager/segment_ctx/segment_ctx_mock.h"
+#include "test/unit-tests/io/frontend_io/access_heatmap_mock.h"
+#include "test/unit-tests/master_context/config_manager_mock.h"
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+static const uint32_t STRIPES_PER_SEGMENT = 64;
+static const uint32_t MIN_AGE_IN_SEGMENTS = 2;
+
+static void
+EnableColdDataSeparation(MockConfigManager& configManager)
+{
+    ON_CALL(configManager, GetValue).WillByDefault(Invoke(
+        [](string module, string key, void* value, ConfigType type)
+        {
+            if (key == "cold_data_separation")
+            {
+                *static_cast<bool*>(value) = true;
+            }
+            else if (key == "cold_data_min_age_in_segments")
+            {
+                *static_cast<uint32_t*>(value) = MIN_AGE_IN_SEGMENTS;
+            }
+            return EID(SUCCESS);
+        }));
+}
+
+static BlkInfo
+MakeBlkInfo(BlkAddr rba, SegmentId segId)
+{
+    BlkInfo blkInfo;
+    blkInfo.rba = rba;
+    blkInfo.volID = 0;
+    blkInfo.vsa = {segId * STRIPES_PER_SEGMENT, 0};
+    return blkInfo;
+}
+
+TEST(ColdDataClassifier, IsCold_testIfDisabledByDefault)
+{
+    // Given: cold data separation is not configured
+    NiceMock<MockConfigManager> configManager;
+    NiceMock<MockSegmentCtx> segmentCtx;
+    ColdDataClassifier classifier(0, STRIPES_PER_SEGMENT, &configManager, &segmentCtx, nullptr);
+    ON_CALL(segmentCtx, GetSegmentAge).WillByDefault(Return(UINT64_MAX));
+    std::vector<BlkInfo> blkInfos = {MakeBlkInfo(0, 1)};
+
+    // Then
+    EXPECT_FALSE(classifier.IsEnabled());
+    EXPECT_FALSE(classifier.IsCold(0, blkInfos));
+}
+
+TEST(ColdDataClassifier, IsCold_testIfOldSegmentsWithoutAccessAreCold)
+{
+    // Given: all blocks come from a segment unchanged for long, never accessed
+    NiceMock<MockConfigManager> configManager;
+    EnableColdDataSeparation(configManager);
+    NiceMock<MockSegmentCtx> segmentCtx;
+    NiceMock<MockAccessHeatmap> heatmap(nullptr, nullptr, nullptr, nullptr);
+    ColdDataClassifier classifier(0, STRIPES_PER_SEGMENT, &configManager, &segmentCtx, &heatmap);
+    EXPECT_CALL(segmentCtx, GetSegmentAge(1)).WillRepeatedly(Return(MIN_AGE_IN_SEGMENTS * STRIPES_PER_SEGMENT));
+    ON_CALL(heatmap, IsEnabled).WillByDefault(Return(true));
+    ON_CALL(heatmap, GetEstimate).WillByDefault(Return(0));
+    std::vector<BlkInfo> blkInfos = {MakeBlkInfo(0, 1), MakeBlkInfo(1, 1), MakeBlkInfo(2, 1), MakeBlkInfo(3, 1)};
+
+    // When
+    bool cold = classifier.IsCold(0, blkInfos);
+
+    // Then
+    EXPECT_TRUE(classifier.IsEnabled());
+    EXPECT_TRUE(cold);
+}
+
+TEST(ColdDataClassifier, IsCold_testIfYoungSegmentsAreNotCold)
+{
+    // Given: half of the blocks come from a segment modified recently
+    NiceMock<MockConfigManager> configManager;
+    EnableColdDataSeparation(configManager);
+    NiceMock<MockSegmentCtx> segmentCtx;
+    NiceMock<MockAccessHeatmap> heatmap(nullptr, nullptr, nullptr, nullptr);
+    ColdDataClassifier classifier(0, STRIPES_PER_SEGMENT, &configManager, &segmentCtx, &heatmap);
+    EXPECT_CALL(segmentCtx, GetSegmentAge(1)).WillRepeatedly(Return(UINT64_MAX));
+    EXPECT_CALL(segmentCtx, GetSegmentAge(2)).WillRepeatedly(Return(STRIPES_PER_SEGMENT));
+    ON_CALL(heatmap, IsEnabled).WillByDefault(Return(false));
+    std::vector<BlkInfo> blkInfos = {MakeBlkInfo(0, 1), MakeBlkInfo(1, 1), MakeBlkInfo(2, 2), MakeBlkInfo(3, 2)};
+
+    // When
+    bool cold = classifier.IsCold(0, blkInfos);
+
+    // Then
+    EXPECT_FALSE(cold);
+}
+
+TEST(ColdDataClassifier, IsCold_testIfRecentlyAccessedBlocksAreNotCold)
+{
+    // Given: old segment, but the heatmap still sees writes to the blocks
+    NiceMock<MockConfigManager> configManager;
+    EnableColdDataSeparation(configManager);
+    NiceMock<MockSegmentCtx> segmentCtx;
+    NiceMock<MockAccessHeatmap> heatmap(nullptr, nullptr, nullptr, nullptr);
+    ColdDataClassifier classifier(0, STRIPES_PER_SEGMENT, &configManager, &segmentCtx, &heatmap);
+    ON_CALL(segmentCtx, GetSegmentAge).WillByDefault(Return(UINT64_MAX));
+    ON_CALL(heatmap, IsEnabled).WillByDefault(Return(true));
+    ON_CALL(heatmap, GetEstimate(_, _, true)).WillByDefault(Return(8));
+    std::vector<BlkInfo> blkInfos = {MakeBlkInfo(0, 1), MakeBlkInfo(1, 1)};
+
+    // When
+    bool cold = classifier.IsCold(0, blkInfos);
+
+    // Then
+    EXPECT_FALSE(cold);
+}
+
+TEST(ColdDataClassifier, IsCold_testIfInvalidBlocksAreNotCounted)
+{
+    // Given: the buffer ends with an unused entry
+    NiceMock<MockConfigManager> configManager;
+    EnableColdDataSeparation(configManager);
+    NiceMock<MockSegmentCtx> segmentCtx;
+    NiceMock<MockAccessHeatmap> heatmap(nullptr, nullptr, nullptr, nullptr);
+    ColdDataClassifier classifier(0, STRIPES_PER_SEGMENT, &configManager, &segmentCtx, &heatmap);
+    ON_CALL(segmentCtx, GetSegmentAge).WillByDefault(Return(UINT64_MAX));
+    ON_CALL(heatmap, IsEnabled).WillByDefault(Return(false));
+    BlkInfo invalid = MakeBlkInfo(0, 2);
+    invalid.volID = UINT32_MAX;
+    std::vector<BlkInfo> blkInfos = {MakeBlkInfo(0, 1), invalid};
+
+    // Then
+    EXPECT_TRUE(classifier.IsCold(0, blkInfos));
+    EXPECT_FALSE(classifier.IsCold(0, {invalid}));
+}
+
+} // namespace pos
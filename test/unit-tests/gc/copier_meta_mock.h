@@ -26,7 +26,10 @@ public:
     MOCK_METHOD(uint32_t, GetStripePerSegment, (), (override));
     MOCK_METHOD(uint32_t, GetBlksPerStripe, (), (override));
     MOCK_METHOD(VictimStripe*, GetVictimStripe, (uint32_t victimSegmentIndex, uint32_t stripeOffset), (override));
+    MOCK_METHOD(void, SetReverseMapReadahead, (uint32_t victimSegmentIndex, StripeId baseStripeId, uint32_t loadedCount), (override));
+    MOCK_METHOD(void, LoadReverseMapAhead, (uint32_t victimSegmentIndex, uint32_t endOffset), (override));
     MOCK_METHOD(GcStripeManager*, GetGcStripeManager, (), (override));
+    MOCK_METHOD(GcCopyController*, GetCopyController, (), (override));
     MOCK_METHOD(std::string, GetArrayName, (), (override));
 };
 
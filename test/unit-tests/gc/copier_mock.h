@@ -20,6 +20,7 @@ public:
     MOCK_METHOD(void, DisableThresholdCheck, (), (override));
     MOCK_METHOD(bool, IsEnableThresholdCheck, (), (override));
     MOCK_METHOD(CopierStateType, GetCopybackState, (), (override));
+    MOCK_METHOD(GcStripeManager*, GetGcStripeManager, (), (override));
 };
 
 } // namespace pos
@@ -170,7 +170,7 @@ protected:
 
     const PartitionLogicalSize* udSize = &partitionLogicalSize;
     static const uint32_t ALLOCATION_SIZE_BYTE = 2 * 1024 * 1024;
-    std::list<BlkInfo> mockBlkInfoList;
+    std::vector<BlkInfo> mockBlkInfoList;
 
     PartitionLogicalSize partitionLogicalSize = {
     .minWriteBlkCnt = 0/* not interesting */,
@@ -199,7 +199,7 @@ TEST_F(CopierReadCompletionTestFixture, Execute_testIfGcStripemanagerFailedtoAll
         mockBlkInfoList.push_back(blkInfo);
     }
 
-    EXPECT_CALL(*victimStripe, GetBlkInfoList(testListIndex)).WillRepeatedly(ReturnRef(mockBlkInfoList));
+    EXPECT_CALL(*victimStripe, GetBlkInfoList(testListIndex)).WillRepeatedly(Return(BlkInfoSpan{mockBlkInfoList.data(), (uint32_t)mockBlkInfoList.size()}));
     copierReadCompletion = new CopierReadCompletion(victimStripe, testListIndex, buffer,
                             meta, testStripeId,
                             inputFlushEvent, inputVolumeManager, inputEventScheduler);
@@ -228,7 +228,7 @@ TEST_F(CopierReadCompletionTestFixture, Execute_testIfGcStripeManaerDecreaseRema
         EXPECT_CALL(*gcStripeManager, SetBlkInfo(testVolumeId, offset, _)).Times(1);
     }
 
-    EXPECT_CALL(*victimStripe, GetBlkInfoList(testListIndex)).WillRepeatedly(ReturnRef(mockBlkInfoList));
+    EXPECT_CALL(*victimStripe, GetBlkInfoList(testListIndex)).WillRepeatedly(Return(BlkInfoSpan{mockBlkInfoList.data(), (uint32_t)mockBlkInfoList.size()}));
     copierReadCompletion = new CopierReadCompletion(victimStripe, testListIndex, buffer,
                             meta, testStripeId,
                             inputFlushEvent, inputVolumeManager, inputEventScheduler);
@@ -266,7 +266,7 @@ TEST_F(CopierReadCompletionTestFixture, Execute_testIfGcStripeManaerAllocatesWri
         EXPECT_CALL(*gcStripeManager, SetBlkInfo(testVolumeId, offset, _)).Times(1);
     }
 
-    EXPECT_CALL(*victimStripe, GetBlkInfoList(testListIndex)).WillRepeatedly(ReturnRef(mockBlkInfoList));
+    EXPECT_CALL(*victimStripe, GetBlkInfoList(testListIndex)).WillRepeatedly(Return(BlkInfoSpan{mockBlkInfoList.data(), (uint32_t)mockBlkInfoList.size()}));
     copierReadCompletion = new CopierReadCompletion(victimStripe, testListIndex, buffer,
                             meta, testStripeId,
                             inputFlushEvent, inputVolumeManager, inputEventScheduler);
@@ -309,7 +309,7 @@ TEST_F(CopierReadCompletionTestFixture, Execute_testIfFaliedThatVolumeManagerInc
         EXPECT_CALL(*gcStripeManager, SetBlkInfo(testVolumeId, offset, _)).Times(1);
     }
 
-    EXPECT_CALL(*victimStripe, GetBlkInfoList(testListIndex)).WillRepeatedly(ReturnRef(mockBlkInfoList));
+    EXPECT_CALL(*victimStripe, GetBlkInfoList(testListIndex)).WillRepeatedly(Return(BlkInfoSpan{mockBlkInfoList.data(), (uint32_t)mockBlkInfoList.size()}));
     copierReadCompletion = new CopierReadCompletion(victimStripe, testListIndex, buffer,
                             meta, testStripeId,
                             inputFlushEvent, inputVolumeManager, inputEventScheduler);
@@ -2,6 +2,7 @@
 #include "src/gc/flow_control/flow_control.h"
 #include "src/array_models/dto/partition_logical_size.h"
 #include "src/include/pos_event_id.h"
+#include "src/telemetry/telemetry_id.h"
 
 #include <test/unit-tests/allocator/i_context_manager_mock.h>
 #include <test/unit-tests/lib/system_timeout_checker_mock.h>
@@ -10,6 +11,7 @@
 #include <test/unit-tests/gc/flow_control/token_distributer_mock.h>
 #include <test/unit-tests/gc/flow_control/flow_control_configuration_mock.h>
 #include <test/unit-tests/allocator/context_manager/segment_ctx/segment_ctx_mock.h>
+#include <test/unit-tests/telemetry/telemetry_client/easy_telemetry_publisher_mock.h>
 
 using ::testing::Test;
 using ::testing::Return;
@@ -429,4 +431,35 @@ TEST_F(FlowControlTestFixture, InitDistributer_testInitDistributer)
     flowControl->InitDistributer();
 }
 
+TEST_F(FlowControlTestFixture, GetToken_testIfDistributedTokensArePublishedAtRefill)
+{
+    // Given: FlowControl which publishes to a mock publisher
+    delete flowControl;
+    NiceMock<MockEasyTelemetryPublisher> telemetryPublisher;
+    mockSystemTimeoutChecker = new NiceMock<MockSystemTimeoutChecker>;
+    mockTokenDistributer = new NiceMock<MockTokenDistributer>(nullptr, nullptr, nullptr);
+    mockFlowControlConfiguration = new NiceMock<MockFlowControlConfiguration>(mockIArrayInfo, nullptr);
+    flowControl = new FlowControl(mockIArrayInfo, mockIContextManager,
+        mockSystemTimeoutChecker, mockFlowControlService, mockTokenDistributer,
+        mockFlowControlConfiguration, &telemetryPublisher);
+
+    EXPECT_CALL(*mockIContextManager, GetSegmentCtx).WillRepeatedly(Return(mockSegmentCtx));
+    EXPECT_CALL(*mockIContextManager, GetGcThreshold(GcMode::MODE_NORMAL_GC)).WillOnce(Return(20));
+    EXPECT_CALL(*mockIContextManager, GetGcThreshold(GcMode::MODE_URGENT_GC)).WillOnce(Return(5));
+    EXPECT_CALL(*mockFlowControlConfiguration, GetFlowControlStrategy()).WillRepeatedly(Return(FlowControlStrategy::LINEAR));
+    flowControl->Init();
+
+    // When: the user bucket is refilled as free segments are below the gc threshold
+    EXPECT_CALL(*mockSegmentCtx, GetNumOfFreeSegmentWoLock()).WillRepeatedly(Return(15));
+    EXPECT_CALL(*mockTokenDistributer, Distribute(15)).WillOnce(Return(std::make_tuple(100, 40)));
+
+    // Then: the distributed tokens and the rejected counts are published
+    EXPECT_CALL(telemetryPublisher, UpdateGauge(TEL90007_FLOW_CONTROL_USER_TOKEN, 100, _)).Times(1);
+    EXPECT_CALL(telemetryPublisher, UpdateGauge(TEL90008_FLOW_CONTROL_GC_TOKEN, 40, _)).Times(1);
+    EXPECT_CALL(telemetryPublisher, UpdateGauge(TEL90009_FLOW_CONTROL_REJECTED_COUNT, 0, _)).Times(2);
+    int actual = flowControl->GetToken(FlowControlType::USER, 30);
+
+    EXPECT_EQ(30, actual);
+}
+
 }  // namespace pos
@@ -0,0 +1,17 @@
+#include <gmock/gmock.h>
+#include <string>
+#include <list>
+#include <vector>
+#include "src/gc/flow_control/model_distributer.h"
+
+namespace pos
+{
+class MockModelDistributer : public ModelDistributer
+{
+public:
+    using ModelDistributer::ModelDistributer;
+    MOCK_METHOD(void, Init, (), (override));
+    MOCK_METHOD((std::tuple<uint32_t, uint32_t>), Distribute, (uint32_t freeSegments), (override));
+};
+
+} // namespace pos
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+#include "src/gc/flow_control/model_distributer.h"
+#include <test/unit-tests/allocator/i_context_manager_mock.h>
+#include <test/unit-tests/array_models/interface/i_array_info_mock.h>
+#include <test/unit-tests/gc/flow_control/flow_control_configuration_mock.h>
+
+using ::testing::Test;
+using ::testing::Return;
+using ::testing::_;
+using ::testing::NiceMock;
+
+namespace pos {
+
+class ModelDistributerTestFixture : public ::testing::Test
+{
+public:
+    ModelDistributerTestFixture(void)
+    {
+    }
+
+    virtual ~ModelDistributerTestFixture(void)
+    {
+    }
+
+    virtual void
+    SetUp(void)
+    {
+        arrayName = "POSArray";
+        mockIArrayInfo = new NiceMock<MockIArrayInfo>;
+        EXPECT_CALL(*mockIArrayInfo, GetName()).WillRepeatedly(Return(arrayName));
+        partitionLogicalSize = {.minWriteBlkCnt = 0, /* not interesting */
+                                .blksPerChunk = 64,
+                                .blksPerStripe = 2048,
+                                .chunksPerStripe = 32,
+                                .stripesPerSegment = 1024,
+                                .totalStripes = 32,
+                                .totalSegments = 32768};
+
+        EXPECT_CALL(*mockIArrayInfo, GetSizeInfo(_)).WillRepeatedly(Return(&partitionLogicalSize));
+
+        mockFlowControlConfiguration = new NiceMock<MockFlowControlConfiguration>(mockIArrayInfo, nullptr);
+        uint32_t totalTokenInStripe = partitionLogicalSize.stripesPerSegment;
+        uint32_t totalToken = partitionLogicalSize.stripesPerSegment * partitionLogicalSize.blksPerStripe;
+        EXPECT_CALL(*mockFlowControlConfiguration, GetTotalTokenInStripe()).WillRepeatedly(Return(totalTokenInStripe));
+        EXPECT_CALL(*mockFlowControlConfiguration, GetTotalToken()).WillRepeatedly(Return(totalToken));
+
+        mockIContextManager = new NiceMock<MockIContextManager>;
+        EXPECT_CALL(*mockIContextManager, GetGcThreshold(GcMode::MODE_NORMAL_GC)).WillRepeatedly(Return(20));
+        EXPECT_CALL(*mockIContextManager, GetGcThreshold(GcMode::MODE_URGENT_GC)).WillRepeatedly(Return(5));
+
+        modelDistributer = new ModelDistributer(mockIArrayInfo, mockFlowControlConfiguration, mockIContextManager);
+    }
+    virtual void
+    TearDown(void)
+    {
+        delete modelDistributer;
+        delete mockIArrayInfo;
+        delete mockFlowControlConfiguration;
+        delete mockIContextManager;
+    }
+
+protected:
+    ModelDistributer* modelDistributer;
+
+    NiceMock<MockIArrayInfo>* mockIArrayInfo;
+    PartitionLogicalSize partitionLogicalSize;
+    NiceMock<MockFlowControlConfiguration>* mockFlowControlConfiguration;
+    NiceMock<MockIContextManager>* mockIContextManager;
+
+    std::string arrayName;
+};
+
+TEST_F(ModelDistributerTestFixture, ModelDistributer_testFreeSegmentMoreThanThreshold)
+{
+    // Given: Total token is 2097152 & GC Threshold is 20
+    // When: number of free segment is 30
+    uint32_t userTokenActual, gcTokenActual;
+    std::tie(userTokenActual, gcTokenActual) = modelDistributer->Distribute(30);
+    // Then: All tokens are given to user
+    EXPECT_EQ(2097152, userTokenActual);
+    EXPECT_EQ(0, gcTokenActual);
+}
+
+TEST_F(ModelDistributerTestFixture, ModelDistributer_testFreeSegmentLessThanUrgentThreshold)
+{
+    // Given: Total token is 2097152 & GC Urgent Threshold is 5
+    // When: number of free segment is 5
+    uint32_t userTokenActual, gcTokenActual;
+    std::tie(userTokenActual, gcTokenActual) = modelDistributer->Distribute(5);
+    // Then: All tokens are given to GC
+    EXPECT_EQ(0, userTokenActual);
+    EXPECT_EQ(2097152, gcTokenActual);
+}
+
+TEST_F(ModelDistributerTestFixture, ModelDistributer_testTokenSplitBetweenThresholds)
+{
+    // Given: Total token is 2097152 & thresholds are 20 and 5
+    // When: number of free segment is in the middle of the thresholds
+    uint32_t userTokenActual, gcTokenActual;
+    std::tie(userTokenActual, gcTokenActual) = modelDistributer->Distribute(12);
+    // Then: Both user and GC get tokens and they add up to total token
+    EXPECT_GT(userTokenActual, 0);
+    EXPECT_GT(gcTokenActual, 0);
+    EXPECT_EQ(2097152, userTokenActual + gcTokenActual);
+}
+
+TEST_F(ModelDistributerTestFixture, ModelDistributer_testMoreReclaimGivesMoreUserToken)
+{
+    // Given: two distributers started from the same free segment count
+    ModelDistributer other(mockIArrayInfo, mockFlowControlConfiguration, mockIContextManager);
+    modelDistributer->Distribute(12);
+    other.Distribute(12);
+
+    // When: GC of one array reclaims two more segments during the window
+    uint32_t userTokenSlow, userTokenFast, gcToken;
+    std::tie(userTokenSlow, gcToken) = modelDistributer->Distribute(12);
+    std::tie(userTokenFast, gcToken) = other.Distribute(14);
+
+    // Then: The array reclaiming faster gives more tokens to user
+    EXPECT_GT(userTokenFast, userTokenSlow);
+}
+
+TEST_F(ModelDistributerTestFixture, ModelDistributer_testUserTokenChangesSmoothly)
+{
+    // Given: Total token is 2097152
+    uint32_t maxStep = 2097152 / 10 + 1;
+    uint32_t previousUserToken, gcToken;
+    std::tie(previousUserToken, gcToken) = modelDistributer->Distribute(19);
+
+    // When: free segments drop one by one toward the urgent threshold
+    for (uint32_t freeSegments = 18; freeSegments > 5; freeSegments--)
+    {
+        uint32_t userToken;
+        std::tie(userToken, gcToken) = modelDistributer->Distribute(freeSegments);
+        // Then: User token never jumps more than a tenth of total token at once
+        uint32_t diff = (userToken > previousUserToken) ? (userToken - previousUserToken) : (previousUserToken - userToken);
+        EXPECT_LE(diff, maxStep);
+        EXPECT_LE(userToken, previousUserToken);
+        previousUserToken = userToken;
+    }
+}
+
+}  // namespace pos
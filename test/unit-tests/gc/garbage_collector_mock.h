@@ -25,6 +25,10 @@ public:
     MOCK_METHOD(bool, GetGcRunning, (), (override));
     MOCK_METHOD(struct timeval, GetStartTime, (), (override));
     MOCK_METHOD(struct timeval, GetEndTime, (), (override));
+    MOCK_METHOD(uint32_t, GetCopyTargetDepth, (), (override));
+    MOCK_METHOD(uint32_t, GetCopyCurrentDepth, (), (override));
+    MOCK_METHOD(uint32_t, GetCopyReadBatch, (), (override));
+    MOCK_METHOD(uint64_t, GetHostP99Us, (), (override));
 };
 
 } // namespace pos
@@ -253,6 +253,47 @@ TEST_F(GarbageCollectorTestFixture, Shutdown_testIfShutdownAfterGcStart)
     EXPECT_TRUE(gc->GetGcRunning() == false);
 }
 
+TEST_F(GarbageCollectorTestFixture, Start_testHelperCopiersShareDestinationStripesOfFirstCopier)
+{
+    // given garbage collector with two copiers
+    NiceMock<MockCopier>* helper = new NiceMock<MockCopier>(0, 0, nullptr, nullptr,
+        &partitionLogicalSize, nullptr, nullptr, nullptr, nullptr, nullptr);
+    CopierSmartPtr helperPtr(helper);
+    GcStripeManager* gcStripeManager = reinterpret_cast<GcStripeManager*>(0x1234);
+    GcStripeManager* sharedGcStripeManager = nullptr;
+    HelperCopierFactory helperFactory = [&](GcStatus* gcStatus, IArrayInfo* array, GcStripeManager* stripeManager)
+    {
+        sharedGcStripeManager = stripeManager;
+        return helperPtr;
+    };
+    GarbageCollector* testGc = new GarbageCollector(array, stateControl, copierPtr, copierFactory,
+        eventScheduler, 2, helperFactory);
+    ON_CALL(*copier, GetGcStripeManager).WillByDefault(Return(gcStripeManager));
+
+    // when gc start
+    // then both copiers are enqueued and the helper uses the stripes of the first copier
+    EXPECT_CALL(*eventScheduler, EnqueueEvent).Times(2);
+    EXPECT_TRUE(testGc->Start() == 0);
+    EXPECT_EQ(gcStripeManager, sharedGcStripeManager);
+
+    // when gc pause
+    // then every copier is paused
+    EXPECT_CALL(*copier, Pause).Times(1);
+    EXPECT_CALL(*helper, Pause).Times(1);
+    testGc->Pause();
+
+    // when gc end
+    // then every copier is stopped and released
+    EXPECT_CALL(*copier, Stop).Times(1);
+    EXPECT_CALL(*helper, Stop).Times(1);
+    EXPECT_CALL(*copier, IsStopped).WillOnce(Return(false));
+    EXPECT_CALL(*helper, IsStopped).WillOnce(Return(false));
+    EXPECT_CALL(*copier, ReadyToEnd).Times(1);
+    EXPECT_CALL(*helper, ReadyToEnd).Times(1);
+    testGc->End();
+    delete testGc;
+}
+
 TEST_F(GarbageCollectorTestFixture, Flush_Invoked)
 {
     gc->Flush(); // trival no op for IMountSequence
@@ -0,0 +1,120 @@
+#include "src/gc/gc_copy_controller.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "src/telemetry/telemetry_client/per_core_histogram.h"
+#include "test/unit-tests/qos/qos_manager_mock.h"
+
+using ::testing::Invoke;
+using ::testing::NiceMock;
+
+namespace pos
+{
+static std::vector<uint64_t>
+_FillLatency(uint64_t latencyUs, uint64_t count)
+{
+    std::vector<uint64_t> counts(PerCoreHistogram::NUM_BUCKETS, 0);
+    counts[PerCoreHistogram::GetBucketIndex(latencyUs)] = count;
+    return counts;
+}
+
+TEST(GcCopyController, GcCopyController_testIfDefaultDepthIsUsed)
+{
+    // given
+    GcCopyController controller(nullptr, nullptr);
+
+    // then
+    EXPECT_EQ(controller.GetTargetDepth(), GcCopyController::DEFAULT_DEPTH);
+    EXPECT_EQ(controller.GetCurrentDepth(), 0);
+    EXPECT_EQ(controller.GetReadBatch(), GcCopyController::DEFAULT_DEPTH * GcCopyController::READS_PER_DEPTH);
+}
+
+TEST(GcCopyController, Update_testIfDepthIncreasesWhenFreeSegmentsShrink)
+{
+    // given
+    GcCopyController controller(nullptr, nullptr);
+    uint64_t now = 1000000;
+    controller.Update(100, false, now);
+
+    // when
+    now += GcCopyController::UPDATE_INTERVAL_US;
+    controller.Update(90, false, now);
+
+    // then
+    EXPECT_EQ(controller.GetTargetDepth(), GcCopyController::DEFAULT_DEPTH + GcCopyController::ADDITIVE_STEP);
+    EXPECT_EQ(controller.GetFreeSegmentSlope(), -10);
+}
+
+TEST(GcCopyController, Update_testIfUpdateIsRateLimited)
+{
+    // given
+    GcCopyController controller(nullptr, nullptr);
+    uint64_t now = 1000000;
+    controller.Update(100, true, now);
+    uint32_t depth = controller.GetTargetDepth();
+
+    // when
+    controller.Update(100, true, now + GcCopyController::UPDATE_INTERVAL_US / 2);
+
+    // then
+    EXPECT_EQ(controller.GetTargetDepth(), depth);
+}
+
+TEST(GcCopyController, Update_testIfDepthIsBoundedInUrgentMode)
+{
+    // given
+    GcCopyController controller(nullptr, nullptr);
+    uint64_t now = 1000000;
+
+    // when
+    for (uint32_t count = 0; count < GcCopyController::MAX_DEPTH; count++)
+    {
+        controller.Update(10, true, now);
+        now += GcCopyController::UPDATE_INTERVAL_US;
+    }
+
+    // then
+    EXPECT_EQ(controller.GetTargetDepth(), GcCopyController::MAX_DEPTH);
+}
+
+TEST(GcCopyController, Update_testIfDepthIsHalvedWhenHostLatencyExceedsTarget)
+{
+    // given: every host io of the window took 10ms
+    NiceMock<MockQosManager> qosManager;
+    uint64_t latencyUs = 10000;
+    uint64_t sampled = 0;
+    ON_CALL(qosManager, CollectHostLatency()).WillByDefault(Invoke([&](void)
+    {
+        sampled += 1000;
+        return _FillLatency(latencyUs, sampled);
+    }));
+    GcCopyController controller(&qosManager, nullptr);
+    uint64_t now = 1000000;
+
+    // when
+    controller.Update(100, false, now);
+    controller.Update(90, false, now + GcCopyController::UPDATE_INTERVAL_US);
+
+    // then
+    EXPECT_EQ(controller.GetTargetDepth(), GcCopyController::DEFAULT_DEPTH / 4);
+    uint32_t bucket = PerCoreHistogram::GetBucketIndex(latencyUs);
+    EXPECT_EQ(controller.GetHostP99Us(), PerCoreHistogram::GetBucketUpperBound(bucket));
+}
+
+TEST(GcCopyController, CopyStarted_testIfCurrentDepthIsTracked)
+{
+    // given
+    GcCopyController controller(nullptr, nullptr);
+
+    // when
+    controller.CopyStarted(8);
+    controller.CopyFinished();
+    controller.CopyFinished();
+
+    // then
+    EXPECT_EQ(controller.GetCurrentDepth(), 6);
+}
+
+} // namespace pos
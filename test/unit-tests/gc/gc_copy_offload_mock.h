@@ -0,0 +1,21 @@
+#include <gmock/gmock.h>
+
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "src/gc/gc_copy_offload.h"
+
+namespace pos
+{
+class MockGcCopyOffload : public GcCopyOffload
+{
+public:
+    using GcCopyOffload::GcCopyOffload;
+    MOCK_METHOD(bool, TryCopy, (StripeId victimLsid, uint32_t listIndex, uint32_t copyIndex, CopierMeta* meta), (override));
+    MOCK_METHOD(void, CopyDone, (std::shared_ptr<GcCopyStripe> copyStripe), (override));
+    MOCK_METHOD(void, CloseAll, (), (override));
+};
+
+} // namespace pos
@@ -0,0 +1,127 @@
+#include "src/gc/gc_copy_offload.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "src/include/pos_event_id.h"
+#include "test/unit-tests/array_models/interface/i_array_info_mock.h"
+#include "test/unit-tests/master_context/config_manager_mock.h"
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+static const uint32_t SECTORS_PER_BLOCK = 8;
+
+static void
+EnableCopyOffload(MockConfigManager& configManager)
+{
+    ON_CALL(configManager, GetValue).WillByDefault(Invoke(
+        [](string module, string key, void* value, ConfigType type)
+        {
+            if (key == "copy_offload_enable")
+            {
+                *static_cast<bool*>(value) = true;
+                return static_cast<int>(EID(SUCCESS));
+            }
+            return -1;
+        }));
+}
+
+TEST(GcCopyOffload, BuildRanges_testIfAdjacentBlocksAreMerged)
+{
+    // Given: two runs of blocks
+    CopyCommand copyCommand;
+    std::vector<uint64_t> srcLbas = {800, 808, 816, 1600, 1608};
+
+    // When
+    uint32_t rangeCount = GcCopyOffload::BuildRanges(&copyCommand, srcLbas, SECTORS_PER_BLOCK, 65536, 128);
+
+    // Then
+    EXPECT_EQ(2, rangeCount);
+    EXPECT_EQ(2, copyCommand.rangeCount);
+    EXPECT_EQ(40, copyCommand.sectorCount);
+    EXPECT_EQ(800, copyCommand.ranges[0].startLba);
+    EXPECT_EQ(23, copyCommand.ranges[0].sectorCount);
+    EXPECT_EQ(1600, copyCommand.ranges[1].startLba);
+    EXPECT_EQ(15, copyCommand.ranges[1].sectorCount);
+}
+
+TEST(GcCopyOffload, BuildRanges_testIfRangeIsSplitAtMaxRangeSectors)
+{
+    // Given: the ssd takes up to two blocks per range
+    CopyCommand copyCommand;
+    std::vector<uint64_t> srcLbas = {0, 8, 16};
+
+    // When
+    uint32_t rangeCount = GcCopyOffload::BuildRanges(&copyCommand, srcLbas, SECTORS_PER_BLOCK, 16, 128);
+
+    // Then
+    EXPECT_EQ(2, rangeCount);
+    EXPECT_EQ(15, copyCommand.ranges[0].sectorCount);
+    EXPECT_EQ(16, copyCommand.ranges[1].startLba);
+    EXPECT_EQ(7, copyCommand.ranges[1].sectorCount);
+}
+
+TEST(GcCopyOffload, BuildRanges_testIfTooManyRangesAreRejected)
+{
+    // Given: three separate blocks, but the ssd takes two ranges
+    CopyCommand copyCommand;
+    std::vector<uint64_t> srcLbas = {0, 16, 32};
+
+    // When
+    uint32_t rangeCount = GcCopyOffload::BuildRanges(&copyCommand, srcLbas, SECTORS_PER_BLOCK, 65536, 2);
+
+    // Then
+    EXPECT_EQ(0, rangeCount);
+}
+
+TEST(GcCopyOffload, BuildRanges_testIfBlockLargerThanMaxRangeIsRejected)
+{
+    // Given
+    CopyCommand copyCommand;
+    std::vector<uint64_t> srcLbas = {0};
+
+    // When
+    uint32_t rangeCount = GcCopyOffload::BuildRanges(&copyCommand, srcLbas, SECTORS_PER_BLOCK, 4, 128);
+
+    // Then
+    EXPECT_EQ(0, rangeCount);
+}
+
+TEST(GcCopyOffload, Create_testIfDisabledByDefault)
+{
+    // Given
+    NiceMock<MockIArrayInfo> arrayInfo;
+    NiceMock<MockConfigManager> configManager;
+    ON_CALL(configManager, GetValue).WillByDefault(Return(-1));
+    ON_CALL(arrayInfo, GetDataRaidType).WillByDefault(Return("RAID0"));
+
+    // When
+    GcCopyOffload* copyOffload = GcCopyOffload::Create(&arrayInfo, nullptr, &configManager);
+
+    // Then
+    EXPECT_EQ(nullptr, copyOffload);
+}
+
+TEST(GcCopyOffload, Create_testIfArrayWithParityIsNotOffloaded)
+{
+    // Given
+    NiceMock<MockIArrayInfo> arrayInfo;
+    NiceMock<MockConfigManager> configManager;
+    EnableCopyOffload(configManager);
+    ON_CALL(arrayInfo, GetDataRaidType).WillByDefault(Return("RAID5"));
+
+    // When
+    GcCopyOffload* copyOffload = GcCopyOffload::Create(&arrayInfo, nullptr, &configManager);
+
+    // Then
+    EXPECT_EQ(nullptr, copyOffload);
+}
+
+} // namespace pos
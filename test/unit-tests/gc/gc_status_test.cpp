@@ -102,4 +102,31 @@ TEST(GcStatus, SetCopyInfo_SetCopyInfoStartedAndSetCopyInfoEnded)
     EXPECT_TRUE(copyInfo.GetCopiedBlkCnt() == copyDoneCnt);
 }
 
+TEST(GcStatus, SetCopyInfo_testGcRunningUntilAllConcurrentCopiesEnd)
+{
+    // given two copies started by concurrent copiers
+    GcStatus gcStatus;
+    gcStatus.SetCopyInfo(false, 10, 0, 0);
+    gcStatus.SetCopyInfo(false, 20, 0, 0);
+
+    // when the first copy ends
+    gcStatus.SetCopyInfo(true, 10, 100, 28);
+
+    // then gc is still running
+    EXPECT_TRUE(gcStatus.GetGcRunning() == true);
+
+    // when the second copy ends
+    gcStatus.SetCopyInfo(true, 20, 90, 38);
+
+    // then gc is not running and both copies are logged in order of completion
+    EXPECT_TRUE(gcStatus.GetGcRunning() == false);
+    std::queue<CopyInfo> copyInfoList = gcStatus.GetCopyInfoList();
+    ASSERT_EQ(2, copyInfoList.size());
+    EXPECT_EQ(10, copyInfoList.front().GetSegmentId());
+    EXPECT_EQ(28, copyInfoList.front().GetCopiedBlkCnt());
+    copyInfoList.pop();
+    EXPECT_EQ(20, copyInfoList.front().GetSegmentId());
+    EXPECT_EQ(38, copyInfoList.front().GetCopiedBlkCnt());
+}
+
 } // namespace pos
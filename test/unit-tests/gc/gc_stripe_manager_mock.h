@@ -24,12 +24,16 @@ public:
     MOCK_METHOD(bool, DecreaseRemainingAndCheckIsFull, (uint32_t volumeId, uint32_t cnt), (override));
     MOCK_METHOD(void, SetBlkInfo, (uint32_t volumeId, uint32_t offset, BlkInfo blkInfo), (override));
     MOCK_METHOD(std::vector<BlkInfo>*, GetBlkInfoList, (uint32_t volumeId), (override));
+    MOCK_METHOD(bool, IsColdData, (uint32_t volumeId, std::vector<BlkInfo>* blkInfos), (override));
     MOCK_METHOD(void, SetFlushed, (uint32_t volumeId, bool force), (override));
     MOCK_METHOD(bool, IsAllFinished, (), (override));
     MOCK_METHOD(void, FlushSubmitted, (), (override));
     MOCK_METHOD(void, FlushCompleted, (), (override));
     MOCK_METHOD(void, UpdateMapRequested, (), (override));
     MOCK_METHOD(void, UpdateMapCompleted, (), (override));
+    MOCK_METHOD(void, CopyStripeRequested, (), (override));
+    MOCK_METHOD(GcCopyOffload*, GetCopyOffload, (), (override));
+    MOCK_METHOD(void, CloseCopyStripes, (), (override));
 };
 
 } // namespace pos
@@ -2,6 +2,12 @@
 
 #include <gtest/gtest.h>
 
+#include "test/unit-tests/array_models/interface/i_array_info_mock.h"
+#include "test/unit-tests/gc/victim_stripe_mock.h"
+
+using ::testing::NiceMock;
+using ::testing::Return;
+
 namespace pos
 {
 TEST(ReverseMapLoadCompletion, Execute_Invoke)
@@ -11,4 +17,25 @@ TEST(ReverseMapLoadCompletion, Execute_Invoke)
     delete revMapLoadCompletion;
 }
 
+TEST(ReverseMapLoadCompletion, Execute_testIfVictimStripeIsMarkedLoaded)
+{
+    NiceMock<MockIArrayInfo> array;
+    PartitionLogicalSize partitionLogicalSize = {
+        .minWriteBlkCnt = 0,
+        .blksPerChunk = 4,
+        .blksPerStripe = 16,
+        .chunksPerStripe = 4,
+        .stripesPerSegment = 32,
+        .totalStripes = 3200,
+        .totalSegments = 100,
+    };
+    EXPECT_CALL(array, GetSizeInfo(PartitionType::USER_DATA)).WillRepeatedly(Return(&partitionLogicalSize));
+    NiceMock<MockVictimStripe> victimStripe(&array, nullptr, nullptr, nullptr, nullptr);
+
+    ReverseMapLoadCompletion* revMapLoadCompletion = new ReverseMapLoadCompletion(&victimStripe);
+    EXPECT_CALL(victimStripe, SetReverseMapLoaded).Times(1);
+    EXPECT_TRUE(revMapLoadCompletion->Execute() == true);
+    delete revMapLoadCompletion;
+}
+
 } // namespace pos
@@ -120,11 +120,26 @@ TEST_F(StripeCopierTestFixture, Execute_testIfExecuteFailsWhenFailedToLoadValidB
                         mockStripeCopier, eventScheduler);
 
     NiceMock<MockVictimStripe> victimStripe(array, nullptr, nullptr, nullptr, nullptr);
-    EXPECT_CALL(*meta, GetVictimStripe(copyIndex, baseStripeId % STRIPES_PER_SEGMENT)).WillOnce(Return(&victimStripe));
+    EXPECT_CALL(*meta, GetVictimStripe(copyIndex, baseStripeId % STRIPES_PER_SEGMENT)).WillRepeatedly(Return(&victimStripe));
+    EXPECT_CALL(victimStripe, IsReverseMapLoaded).WillOnce(Return(true));
     EXPECT_CALL(victimStripe, LoadValidBlock).WillOnce(Return(false));
     EXPECT_TRUE(stripeCopier->Execute() == false);
 }
 
+TEST_F(StripeCopierTestFixture, Execute_testIfExecuteWaitsUntilReverseMapIsLoaded)
+{
+    stripeCopier = new StripeCopier(baseStripeId, meta, copyIndex, mockCopyEvent,
+                        mockStripeCopier, eventScheduler);
+
+    NiceMock<MockVictimStripe> victimStripe(array, nullptr, nullptr, nullptr, nullptr);
+    EXPECT_CALL(*meta, GetVictimStripe(copyIndex, baseStripeId % STRIPES_PER_SEGMENT)).WillRepeatedly(Return(&victimStripe));
+    EXPECT_CALL(*meta, LoadReverseMapAhead(copyIndex,
+        baseStripeId % STRIPES_PER_SEGMENT + CopierMeta::REVERSE_MAP_READAHEAD_COUNT)).Times(1);
+    EXPECT_CALL(victimStripe, IsReverseMapLoaded).WillOnce(Return(false));
+    EXPECT_CALL(victimStripe, LoadValidBlock).Times(0);
+    EXPECT_TRUE(stripeCopier->Execute() == false);
+}
+
 TEST_F(StripeCopierTestFixture, Execute_testIfExecuteSucceedsEvenWhenBlockInfoListIsEmpty)
 {
     eventScheduler = new NiceMock<MockEventScheduler>;
@@ -135,6 +150,7 @@ TEST_F(StripeCopierTestFixture, Execute_testIfExecuteSucceedsEvenWhenBlockInfoLi
 
     NiceMock<MockVictimStripe> victimStripe(array, nullptr, nullptr, nullptr, nullptr);
     EXPECT_CALL(*meta, GetVictimStripe(copyIndex, baseStripeId % STRIPES_PER_SEGMENT)).WillRepeatedly(Return(&victimStripe));
+    EXPECT_CALL(victimStripe, IsReverseMapLoaded).WillOnce(Return(true));
     EXPECT_CALL(victimStripe, LoadValidBlock).WillOnce(Return(true));
     EXPECT_CALL(victimStripe, GetBlkInfoListSize).WillOnce(Return(0));
     EXPECT_CALL(*meta, SetStartCopyStripes).Times(1);
@@ -163,6 +179,7 @@ TEST_F(StripeCopierTestFixture, Execute_testIfExecuteFailsWhenBufferAllocationFa
 
     NiceMock<MockVictimStripe> victimStripe(array, nullptr, nullptr, nullptr, nullptr);
     EXPECT_CALL(*meta, GetVictimStripe(copyIndex, baseStripeId % STRIPES_PER_SEGMENT)).WillRepeatedly(Return(&victimStripe));
+    EXPECT_CALL(victimStripe, IsReverseMapLoaded).WillOnce(Return(true));
     EXPECT_CALL(victimStripe, LoadValidBlock).WillOnce(Return(true));
     EXPECT_CALL(victimStripe, GetBlkInfoListSize).WillOnce(Return(1));
     std::vector<void*> emptyVector;
@@ -189,15 +206,16 @@ TEST_F(StripeCopierTestFixture, Execute_testIfExecuteSucceedsWhenThereIsOneValid
 
     NiceMock<MockVictimStripe> victimStripe(array, nullptr, nullptr, nullptr, nullptr);
     EXPECT_CALL(*meta, GetVictimStripe(copyIndex, baseStripeId % STRIPES_PER_SEGMENT)).WillRepeatedly(Return(&victimStripe));
+    EXPECT_CALL(victimStripe, IsReverseMapLoaded).WillOnce(Return(true));
     EXPECT_CALL(victimStripe, LoadValidBlock).WillOnce(Return(true));
     EXPECT_CALL(victimStripe, GetBlkInfoListSize).WillOnce(Return(1));
     std::vector<void*> oneBuffer{(void*)0x20000000};
     EXPECT_CALL(*meta, GetBuffers(_,_)).WillOnce(testing::SetArgPointee<1>(oneBuffer));
-    std::list<BlkInfo> blkInfoList;
+    std::vector<BlkInfo> blkInfoList;
     BlkInfo blkInfo = {.rba = testRba, .volID = testVolId,
                 .vsa = {.stripeId = testStripeId, .offset = testStripeOffset}};
     blkInfoList.push_back(blkInfo);
-    EXPECT_CALL(victimStripe, GetBlkInfoList(0)).WillOnce(ReturnRef(blkInfoList));
+    EXPECT_CALL(victimStripe, GetBlkInfoList(0)).WillOnce(Return(BlkInfoSpan{blkInfoList.data(), 1}));
 
     EXPECT_CALL(*meta, SetStartCopyStripes).Times(1);
     EXPECT_CALL(*meta, GetStripePerSegment).WillOnce(Return(STRIPES_PER_SEGMENT));
@@ -226,15 +244,16 @@ TEST_F(StripeCopierTestFixture, Execute_CopyOneValidBlockCreateCopyEvent)
 
     NiceMock<MockVictimStripe> victimStripe(array, nullptr, nullptr, nullptr, nullptr);
     EXPECT_CALL(*meta, GetVictimStripe(copyIndex, baseStripeId % STRIPES_PER_SEGMENT)).WillRepeatedly(Return(&victimStripe));
+    EXPECT_CALL(victimStripe, IsReverseMapLoaded).WillOnce(Return(true));
     EXPECT_CALL(victimStripe, LoadValidBlock).WillOnce(Return(true));
     EXPECT_CALL(victimStripe, GetBlkInfoListSize).WillOnce(Return(1));
     std::vector<void*> oneBuffer{(void*)0x20000000};
     EXPECT_CALL(*meta, GetBuffers(_,_)).WillOnce(testing::SetArgPointee<1>(oneBuffer));
-    std::list<BlkInfo> blkInfoList;
+    std::vector<BlkInfo> blkInfoList;
     BlkInfo blkInfo = {.rba = testRba, .volID = testVolId,
                 .vsa = {.stripeId = testStripeId, .offset = testStripeOffset}};
     blkInfoList.push_back(blkInfo);
-    EXPECT_CALL(victimStripe, GetBlkInfoList(0)).WillOnce(ReturnRef(blkInfoList));
+    EXPECT_CALL(victimStripe, GetBlkInfoList(0)).WillOnce(Return(BlkInfoSpan{blkInfoList.data(), 1}));
     EXPECT_CALL(*eventScheduler, EnqueueEvent(mockCopyEvent)).Times(1);
 
     EXPECT_CALL(*meta, SetStartCopyStripes).Times(1);
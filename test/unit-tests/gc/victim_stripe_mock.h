@@ -17,8 +17,10 @@ class MockVictimStripe : public VictimStripe
 public:
     using VictimStripe::VictimStripe;
     MOCK_METHOD(void, Load, (StripeId, CallbackSmartPtr), (override));
-    MOCK_METHOD(list<BlkInfo>&, GetBlkInfoList, (uint32_t), (override));
+    MOCK_METHOD(BlkInfoSpan, GetBlkInfoList, (uint32_t), (override));
     MOCK_METHOD(uint32_t, GetBlkInfoListSize, (), (override));
+    MOCK_METHOD(bool, IsReverseMapLoaded, (), (override));
+    MOCK_METHOD(void, SetReverseMapLoaded, (), (override));
     MOCK_METHOD(bool, LoadValidBlock, (), (override));
 };
 
@@ -115,6 +115,16 @@ TEST_F(VictimStripeTestFixture, GetBlkInfoListSize_)
 {
 }
 
+TEST_F(VictimStripeTestFixture, Load_testIfReverseMapLoadedFlagIsResetOnReload)
+{
+    victimStripe->SetReverseMapLoaded();
+    EXPECT_TRUE(victimStripe->IsReverseMapLoaded() == true);
+
+    victimStripe->Load(TEST_SEGMENT_1_BASE_STRIPE_ID, (reverseMapLoadCompletionPtr));
+
+    EXPECT_TRUE(victimStripe->IsReverseMapLoaded() == false);
+}
+
 TEST_F(VictimStripeTestFixture, LoadValidBlock_GetVsaRetry)
 {
     uint32_t chunksPerStripe = partitionLogicalSize.chunksPerStripe;
@@ -163,7 +173,7 @@ TEST_F(VictimStripeTestFixture, LoadValidBlockWithValidAllBlocks)
 
     // then
     EXPECT_TRUE(victimStripe->GetBlkInfoListSize() == partitionLogicalSize.chunksPerStripe);
-    list<BlkInfo> blkInfoList = victimStripe->GetBlkInfoList(0);
+    BlkInfoSpan blkInfoList = victimStripe->GetBlkInfoList(0);
     EXPECT_TRUE(blkInfoList.size() == partitionLogicalSize.blksPerChunk);
     uint32_t blockOffset = 0;
     for (auto blockInfo : blkInfoList)
@@ -175,7 +185,6 @@ TEST_F(VictimStripeTestFixture, LoadValidBlockWithValidAllBlocks)
         blockOffset++;
     }
 
-    blkInfoList.clear();
     blkInfoList = victimStripe->GetBlkInfoList(1);
     EXPECT_TRUE(blkInfoList.size() == partitionLogicalSize.blksPerChunk);
 
@@ -324,7 +333,7 @@ TEST_F(VictimStripeTestFixture, LoadValidBlockWithUnmapLsa)
     EXPECT_TRUE(blkInfoListCnt == partitionLogicalSize.chunksPerStripe);
     for (uint32_t index = 0; index < blkInfoListCnt; index++)
     {
-        list<BlkInfo> blkInfoList = victimStripe->GetBlkInfoList(index);
+        BlkInfoSpan blkInfoList = victimStripe->GetBlkInfoList(index);
         totalValidBlkCnt += blkInfoList.size();
     }
     EXPECT_TRUE(totalValidBlkCnt == ((partitionLogicalSize.blksPerChunk * blkInfoListCnt) - 1));
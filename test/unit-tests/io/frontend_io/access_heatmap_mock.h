@@ -0,0 +1,23 @@
+#include <gmock/gmock.h>
+
+#include <list>
+#include <string>
+#include <vector>
+
+#include "src/io/frontend_io/access_heatmap.h"
+
+namespace pos
+{
+class MockAccessHeatmap : public AccessHeatmap
+{
+public:
+    using AccessHeatmap::AccessHeatmap;
+    MOCK_METHOD(bool, IsEnabled, (), (override));
+    MOCK_METHOD(void, Record, (uint32_t volumeId, uint64_t sectorRba, bool isWrite), (override));
+    MOCK_METHOD(uint64_t, GetBucket, (uint64_t sectorRba), (override));
+    MOCK_METHOD(uint64_t, GetEstimate, (uint32_t volumeId, uint64_t bucket, bool isWrite), (override));
+    MOCK_METHOD(std::vector<AccessHeatmapBucket>, GetHotBuckets, (uint32_t volumeId), (override));
+    MOCK_METHOD(uint64_t, GetBucketSizeInMb, (), (override));
+};
+
+} // namespace pos
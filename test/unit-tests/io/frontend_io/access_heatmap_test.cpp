@@ -0,0 +1,145 @@
+#include "src/io/frontend_io/access_heatmap.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+
+#include "src/include/pos_event_id.h"
+#include "test/unit-tests/array_models/interface/i_array_info_mock.h"
+#include "test/unit-tests/master_context/config_manager_mock.h"
+#include "test/unit-tests/telemetry/telemetry_client/telemetry_publisher_mock.h"
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+static const uint64_t SECTORS_PER_MB = 2048;
+
+static void
+EnableHeatmap(MockConfigManager& configManager, uint32_t sampleRate, uint64_t bucketSizeInMb)
+{
+    ON_CALL(configManager, GetValue).WillByDefault(Invoke(
+        [sampleRate, bucketSizeInMb](string module, string key, void* value, ConfigType type)
+        {
+            if (key == "access_heatmap_enable")
+            {
+                *static_cast<bool*>(value) = true;
+            }
+            else if (key == "access_heatmap_sample_rate")
+            {
+                *static_cast<uint32_t*>(value) = sampleRate;
+            }
+            else if (key == "access_heatmap_bucket_size_in_mb")
+            {
+                *static_cast<uint64_t*>(value) = bucketSizeInMb;
+            }
+            return EID(SUCCESS);
+        }));
+}
+
+TEST(AccessHeatmap, Record_testIfNothingIsCountedWhenDisabled)
+{
+    // Given
+    NiceMock<MockIArrayInfo> arrayInfo;
+    NiceMock<MockConfigManager> configManager;
+    ON_CALL(configManager, GetValue).WillByDefault(Return(-1));
+    AccessHeatmap heatmap(&arrayInfo, &configManager, nullptr, new NiceMock<MockTelemetryPublisher>());
+    heatmap.Init();
+
+    // When
+    heatmap.Record(1, 0, true);
+
+    // Then
+    EXPECT_FALSE(heatmap.IsEnabled());
+    EXPECT_TRUE(heatmap.GetHotBuckets(1).empty());
+}
+
+TEST(AccessHeatmap, Record_testIfReadsAndWritesAreCountedPerBucket)
+{
+    // Given
+    NiceMock<MockIArrayInfo> arrayInfo;
+    NiceMock<MockConfigManager> configManager;
+    EnableHeatmap(configManager, 1, 1024);
+    AccessHeatmap heatmap(&arrayInfo, &configManager, nullptr, new NiceMock<MockTelemetryPublisher>());
+    heatmap.Init();
+
+    // When
+    for (int i = 0; i < 30; i++)
+    {
+        heatmap.Record(1, 3 * 1024 * SECTORS_PER_MB + i, false);
+    }
+    for (int i = 0; i < 10; i++)
+    {
+        heatmap.Record(1, 3 * 1024 * SECTORS_PER_MB + i, true);
+        heatmap.Record(1, 7 * 1024 * SECTORS_PER_MB, true);
+    }
+
+    // Then: the sketch never underestimates
+    EXPECT_EQ(1024U, heatmap.GetBucketSizeInMb());
+    EXPECT_GE(heatmap.GetEstimate(1, 3, false), 30U);
+    EXPECT_GE(heatmap.GetEstimate(1, 3, true), 10U);
+    EXPECT_GE(heatmap.GetEstimate(1, 7, true), 10U);
+    std::vector<AccessHeatmapBucket> hotBuckets = heatmap.GetHotBuckets(1);
+    ASSERT_EQ(2U, hotBuckets.size());
+    EXPECT_EQ(3U, hotBuckets[0].bucket);
+    EXPECT_EQ(7U, hotBuckets[1].bucket);
+    EXPECT_TRUE(heatmap.GetHotBuckets(2).empty());
+}
+
+TEST(AccessHeatmap, Record_testIfOnlyTheHottestBucketsAreKept)
+{
+    // Given
+    NiceMock<MockIArrayInfo> arrayInfo;
+    NiceMock<MockConfigManager> configManager;
+    EnableHeatmap(configManager, 1, 1);
+    AccessHeatmap heatmap(&arrayInfo, &configManager, nullptr, new NiceMock<MockTelemetryPublisher>());
+    heatmap.Init();
+
+    // When: a hot bucket is accessed among many buckets accessed once
+    for (uint64_t bucket = 0; bucket < 4 * AccessHeatmap::MAX_HOT_BUCKETS; bucket++)
+    {
+        heatmap.Record(0, bucket * SECTORS_PER_MB, true);
+        heatmap.Record(0, 1000 * SECTORS_PER_MB, true);
+    }
+
+    // Then
+    std::vector<AccessHeatmapBucket> hotBuckets = heatmap.GetHotBuckets(0);
+    EXPECT_EQ(static_cast<size_t>(AccessHeatmap::MAX_HOT_BUCKETS), hotBuckets.size());
+    EXPECT_EQ(1000U, hotBuckets[0].bucket);
+}
+
+TEST(AccessHeatmap, Record_testIfEstimatesAreScaledBySampleRateAndAged)
+{
+    // Given
+    NiceMock<MockIArrayInfo> arrayInfo;
+    NiceMock<MockConfigManager> configManager;
+    EnableHeatmap(configManager, 4, 1024);
+    NiceMock<MockTelemetryPublisher>* publisher = new NiceMock<MockTelemetryPublisher>();
+    AccessHeatmap heatmap(&arrayInfo, &configManager, nullptr, publisher);
+    heatmap.Init();
+
+    // When: the first publication, but not yet aged
+    EXPECT_CALL(*publisher, PublishMetric).Times(2);
+    for (uint32_t i = 0; i < 4 * AccessHeatmap::PUBLISH_INTERVAL; i++)
+    {
+        heatmap.Record(5, 0, false);
+    }
+
+    // Then
+    EXPECT_EQ(4U * AccessHeatmap::PUBLISH_INTERVAL, heatmap.GetEstimate(5, 0, false));
+
+    // When: aged once
+    EXPECT_CALL(*publisher, PublishMetric).Times(2 * (AccessHeatmap::AGING_INTERVAL / AccessHeatmap::PUBLISH_INTERVAL - 1));
+    for (uint32_t i = 4 * AccessHeatmap::PUBLISH_INTERVAL; i < 4 * AccessHeatmap::AGING_INTERVAL; i++)
+    {
+        heatmap.Record(5, 0, false);
+    }
+
+    // Then
+    EXPECT_EQ(2U * AccessHeatmap::AGING_INTERVAL, heatmap.GetEstimate(5, 0, false));
+}
+} // namespace pos
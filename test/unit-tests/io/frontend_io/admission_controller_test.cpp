@@ -0,0 +1,102 @@
+#include "src/io/frontend_io/admission_controller.h"
+
+#include <gtest/gtest.h>
+
+#include "src/include/pos_event_id.h"
+#include "test/unit-tests/master_context/config_manager_mock.h"
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+static void
+SetAdmissionConfig(NiceMock<MockConfigManager>& configManager, uint32_t perReactor, uint32_t perVolume)
+{
+    ON_CALL(configManager, GetValue).WillByDefault(Invoke(
+        [perReactor, perVolume](string module, string key, void* value, ConfigType type)
+        {
+            if (key == "admission_control_enable")
+            {
+                *static_cast<bool*>(value) = true;
+            }
+            else if (key == "admission_max_outstanding_io_per_reactor")
+            {
+                *static_cast<uint32_t*>(value) = perReactor;
+            }
+            else if (key == "admission_max_outstanding_io_per_volume")
+            {
+                *static_cast<uint32_t*>(value) = perVolume;
+            }
+            return EID(SUCCESS);
+        }));
+}
+
+TEST(AdmissionController, Admit_testIfEveryIoIsAdmittedWhenDisabled)
+{
+    // Given
+    NiceMock<MockConfigManager> configManager;
+    ON_CALL(configManager, GetValue).WillByDefault(Return(EID(CONFIG_REQUEST_KEY_ERROR)));
+    AdmissionController admissionController(&configManager);
+
+    // When, Then
+    EXPECT_FALSE(admissionController.IsEnabled());
+    EXPECT_TRUE(admissionController.Admit(0, 1, UINT32_MAX));
+    EXPECT_EQ(0U, admissionController.GetOutstandingCount(0, 1));
+}
+
+TEST(AdmissionController, Admit_testIfIoOverVolumeLimitIsRejectedUntilReleased)
+{
+    // Given
+    NiceMock<MockConfigManager> configManager;
+    SetAdmissionConfig(configManager, 0, 2);
+    AdmissionController admissionController(&configManager);
+
+    // When
+    EXPECT_TRUE(admissionController.Admit(0, 3, 0));
+    EXPECT_TRUE(admissionController.Admit(0, 3, 0));
+
+    // Then : the third one is rejected, the other volume is not affected
+    EXPECT_FALSE(admissionController.Admit(0, 3, 0));
+    EXPECT_TRUE(admissionController.Admit(0, 4, 0));
+    EXPECT_EQ(2U, admissionController.GetOutstandingCount(0, 3));
+    EXPECT_EQ(1U, admissionController.GetRejectedCount());
+
+    // When
+    admissionController.Release(0, 3);
+
+    // Then
+    EXPECT_TRUE(admissionController.Admit(0, 3, 0));
+}
+
+TEST(AdmissionController, Admit_testIfIoOverReactorLimitIsRejected)
+{
+    // Given
+    NiceMock<MockConfigManager> configManager;
+    SetAdmissionConfig(configManager, 8, 0);
+    AdmissionController admissionController(&configManager);
+
+    // When, Then
+    EXPECT_TRUE(admissionController.Admit(1, 0, 7));
+    EXPECT_FALSE(admissionController.Admit(1, 0, 8));
+    EXPECT_EQ(1U, admissionController.GetOutstandingCount(1, 0));
+}
+
+TEST(AdmissionController, Release_testIfCountDoesNotWrapBelowZero)
+{
+    // Given
+    NiceMock<MockConfigManager> configManager;
+    SetAdmissionConfig(configManager, 0, 1);
+    AdmissionController admissionController(&configManager);
+
+    // When
+    admissionController.Release(0, 0);
+
+    // Then
+    EXPECT_EQ(0U, admissionController.GetOutstandingCount(0, 0));
+    EXPECT_TRUE(admissionController.Admit(0, 0, 0));
+}
+
+} // namespace pos
@@ -0,0 +1,95 @@
+#include "src/io/frontend_io/completion_batcher.h"
+
+#include <gtest/gtest.h>
+
+#include "test/unit-tests/event_scheduler/event_mock.h"
+#include "test/unit-tests/spdk_wrapper/event_framework_api_mock.h"
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+TEST(CompletionBatcher, Enqueue_testIfCompletionsToTheSameReactorShareOneMessage)
+{
+    // Given
+    NiceMock<MockEventFrameworkApi> mockEventFrameworkApi;
+    CompletionBatcher batcher(&mockEventFrameworkApi);
+    EventSmartPtr first = std::make_shared<NiceMock<MockEvent>>();
+    EventSmartPtr second = std::make_shared<NiceMock<MockEvent>>();
+    EventSmartPtr third = std::make_shared<NiceMock<MockEvent>>();
+
+    // Then : one message rings each destination reactor
+    EXPECT_CALL(mockEventFrameworkApi, SendSpdkEvent(3, CompletionBatcher::InvokeDrain, _))
+        .WillOnce(Return(true));
+    EXPECT_CALL(mockEventFrameworkApi, SendSpdkEvent(5, CompletionBatcher::InvokeDrain, _))
+        .WillOnce(Return(true));
+
+    // When
+    EXPECT_TRUE(batcher.Enqueue(3, first));
+    EXPECT_TRUE(batcher.Enqueue(3, second));
+    EXPECT_TRUE(batcher.Enqueue(5, third));
+}
+
+TEST(CompletionBatcher, Drain_testIfAllQueuedCompletionsAreExecuted)
+{
+    // Given
+    NiceMock<MockEventFrameworkApi> mockEventFrameworkApi;
+    ON_CALL(mockEventFrameworkApi, SendSpdkEvent(_, CompletionBatcher::InvokeDrain, _))
+        .WillByDefault(Return(true));
+    CompletionBatcher batcher(&mockEventFrameworkApi);
+    auto first = std::make_shared<NiceMock<MockEvent>>();
+    auto second = std::make_shared<NiceMock<MockEvent>>();
+    batcher.Enqueue(1, first);
+    batcher.Enqueue(1, second);
+
+    // Then
+    EXPECT_CALL(*first, Execute).WillOnce(Return(true));
+    EXPECT_CALL(*second, Execute).WillOnce(Return(true));
+
+    // When
+    uint32_t drainedCount = batcher.Drain(1);
+
+    // Then
+    EXPECT_EQ(2U, drainedCount);
+    EXPECT_EQ(0U, batcher.Drain(1));
+}
+
+TEST(CompletionBatcher, Enqueue_testIfReactorIsRungAgainAfterDrain)
+{
+    // Given
+    NiceMock<MockEventFrameworkApi> mockEventFrameworkApi;
+    CompletionBatcher batcher(&mockEventFrameworkApi);
+    auto completion = std::make_shared<NiceMock<MockEvent>>();
+    ON_CALL(*completion, Execute).WillByDefault(Return(true));
+
+    // Then
+    EXPECT_CALL(mockEventFrameworkApi, SendSpdkEvent(2, CompletionBatcher::InvokeDrain, _))
+        .Times(2)
+        .WillRepeatedly(Return(true));
+
+    // When
+    batcher.Enqueue(2, completion);
+    batcher.Drain(2);
+    batcher.Enqueue(2, completion);
+}
+
+TEST(CompletionBatcher, Enqueue_testIfInvalidReactorIsRejected)
+{
+    // Given
+    NiceMock<MockEventFrameworkApi> mockEventFrameworkApi;
+    CompletionBatcher batcher(&mockEventFrameworkApi);
+    EventSmartPtr completion = std::make_shared<NiceMock<MockEvent>>();
+
+    // Then
+    EXPECT_CALL(mockEventFrameworkApi, SendSpdkEvent(_, CompletionBatcher::InvokeDrain, _)).Times(0);
+
+    // When
+    bool success = batcher.Enqueue(CompletionBatcher::MAX_REACTOR_COUNT, completion);
+
+    // Then
+    EXPECT_FALSE(success);
+}
+
+} // namespace pos
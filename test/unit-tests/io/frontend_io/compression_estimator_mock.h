@@ -0,0 +1,24 @@
+#include <gmock/gmock.h>
+
+#include <list>
+#include <string>
+#include <vector>
+
+#include "src/io/frontend_io/compression_estimator.h"
+
+namespace pos
+{
+class MockCompressionEstimator : public CompressionEstimator
+{
+public:
+    using CompressionEstimator::CompressionEstimator;
+    MOCK_METHOD(int, Init, (), (override));
+    MOCK_METHOD(void, Dispose, (), (override));
+    MOCK_METHOD(void, Shutdown, (), (override));
+    MOCK_METHOD(void, Flush, (), (override));
+    MOCK_METHOD(bool, IsEnabled, (), (override));
+    MOCK_METHOD(void, Sample, (uint32_t volumeId, const void* buffer, uint64_t size), (override));
+    MOCK_METHOD(uint64_t, GetRatioInPercent, (uint32_t volumeId), (override));
+};
+
+} // namespace pos
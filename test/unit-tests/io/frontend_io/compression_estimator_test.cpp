@@ -0,0 +1,123 @@
+#include "src/io/frontend_io/compression_estimator.h"
+
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+#include <random>
+#include <string>
+
+#include "src/include/memory.h"
+#include "src/include/pos_event_id.h"
+#include "test/unit-tests/array_models/interface/i_array_info_mock.h"
+#include "test/unit-tests/master_context/config_manager_mock.h"
+#include "test/unit-tests/telemetry/telemetry_client/telemetry_publisher_mock.h"
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+TEST(CompressionEstimator, EstimateCompressedSize_testIfZeroBlockShrinksToFewBytes)
+{
+    // Given
+    uint8_t block[BLOCK_SIZE];
+    memset(block, 0, sizeof(block));
+
+    // When
+    uint32_t estimated = CompressionEstimator::EstimateCompressedSize(block, BLOCK_SIZE);
+
+    // Then
+    EXPECT_LT(estimated, 64U);
+}
+
+TEST(CompressionEstimator, EstimateCompressedSize_testIfRandomBlockDoesNotShrink)
+{
+    // Given
+    uint8_t block[BLOCK_SIZE];
+    std::mt19937 generator(7);
+    for (uint32_t index = 0; index < BLOCK_SIZE; index++)
+    {
+        block[index] = static_cast<uint8_t>(generator());
+    }
+
+    // When
+    uint32_t estimated = CompressionEstimator::EstimateCompressedSize(block, BLOCK_SIZE);
+
+    // Then
+    EXPECT_GT(estimated, BLOCK_SIZE * 9 / 10);
+    EXPECT_LE(estimated, BLOCK_SIZE);
+}
+
+TEST(CompressionEstimator, EstimateCompressedSize_testIfRepeatedTextShrinks)
+{
+    // Given
+    uint8_t block[BLOCK_SIZE];
+    std::string line = "{\"time\":\"2022-01-01T00:00:00\",\"level\":\"info\",\"msg\":\"ok\"}\n";
+    for (uint32_t index = 0; index < BLOCK_SIZE; index++)
+    {
+        block[index] = line[index % line.size()];
+    }
+
+    // When
+    uint32_t estimated = CompressionEstimator::EstimateCompressedSize(block, BLOCK_SIZE);
+
+    // Then
+    EXPECT_LT(estimated, BLOCK_SIZE / 4);
+}
+
+TEST(CompressionEstimator, Sample_testIfRatioOfSampledWritesIsPublished)
+{
+    // Given
+    NiceMock<MockIArrayInfo> arrayInfo;
+    NiceMock<MockConfigManager> configManager;
+    NiceMock<MockTelemetryPublisher>* publisher = new NiceMock<MockTelemetryPublisher>();
+    ON_CALL(arrayInfo, GetName).WillByDefault(Return("POSArray"));
+    ON_CALL(configManager, GetValue).WillByDefault(Invoke(
+        [](string module, string key, void* value, ConfigType type)
+        {
+            *static_cast<bool*>(value) = true;
+            return EID(SUCCESS);
+        }));
+    CompressionEstimator estimator(&arrayInfo, &configManager, nullptr, publisher);
+    estimator.Init();
+    uint8_t block[BLOCK_SIZE];
+    memset(block, 0, sizeof(block));
+
+    // Then
+    EXPECT_CALL(*publisher, PublishMetric).Times(1);
+
+    // When
+    uint32_t writeCount = CompressionEstimator::SAMPLE_INTERVAL * CompressionEstimator::PUBLISH_INTERVAL;
+    for (uint32_t index = 0; index < writeCount; index++)
+    {
+        estimator.Sample(1, block, BLOCK_SIZE);
+    }
+
+    // Then
+    EXPECT_GT(estimator.GetRatioInPercent(1), 100U);
+    EXPECT_EQ(0U, estimator.GetRatioInPercent(2));
+}
+
+TEST(CompressionEstimator, Sample_testIfNothingIsSampledWhenDisabled)
+{
+    // Given
+    NiceMock<MockIArrayInfo> arrayInfo;
+    NiceMock<MockConfigManager> configManager;
+    ON_CALL(configManager, GetValue).WillByDefault(Return(-1));
+    CompressionEstimator estimator(&arrayInfo, &configManager, nullptr, nullptr);
+    estimator.Init();
+    uint8_t block[BLOCK_SIZE];
+    memset(block, 0, sizeof(block));
+
+    // When
+    estimator.Sample(1, block, BLOCK_SIZE);
+
+    // Then
+    EXPECT_FALSE(estimator.IsEnabled());
+    EXPECT_EQ(0U, estimator.GetRatioInPercent(1));
+}
+
+} // namespace pos
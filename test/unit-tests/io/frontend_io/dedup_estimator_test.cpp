@@ -0,0 +1,133 @@
+#include "src/io/frontend_io/dedup_estimator.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "src/include/memory.h"
+#include "src/include/pos_event_id.h"
+#include "test/unit-tests/array_models/interface/i_array_info_mock.h"
+#include "test/unit-tests/master_context/config_manager_mock.h"
+#include "test/unit-tests/telemetry/telemetry_client/telemetry_publisher_mock.h"
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+static void
+EnableEstimate(MockConfigManager& configManager)
+{
+    ON_CALL(configManager, GetValue).WillByDefault(Invoke(
+        [](string module, string key, void* value, ConfigType type)
+        {
+            *static_cast<bool*>(value) = true;
+            return EID(SUCCESS);
+        }));
+}
+
+static std::vector<uint8_t>
+MakeRandomBlocks(uint32_t blockCount, uint32_t seed)
+{
+    std::vector<uint8_t> buffer(static_cast<uint64_t>(blockCount) * BLOCK_SIZE);
+    std::mt19937 generator(seed);
+    for (uint8_t& byte : buffer)
+    {
+        byte = static_cast<uint8_t>(generator());
+    }
+    return buffer;
+}
+
+TEST(DedupEstimator, Sample_testIfCopiesWrittenToAnotherVolumeAreCountedAsDuplicates)
+{
+    // Given
+    NiceMock<MockIArrayInfo> arrayInfo;
+    NiceMock<MockConfigManager> configManager;
+    EnableEstimate(configManager);
+    DedupEstimator estimator(&arrayInfo, &configManager, nullptr, new NiceMock<MockTelemetryPublisher>());
+    estimator.Init();
+    std::vector<uint8_t> image = MakeRandomBlocks(1024, 3);
+
+    // When
+    estimator.Sample(1, image.data(), image.size());
+    estimator.Sample(2, image.data(), image.size());
+
+    // Then
+    EXPECT_EQ(0U, estimator.GetDuplicateRatioInPercent(1));
+    EXPECT_EQ(100U, estimator.GetDuplicateRatioInPercent(2));
+}
+
+TEST(DedupEstimator, Sample_testIfUniqueBlocksAreNotCountedAsDuplicates)
+{
+    // Given
+    NiceMock<MockIArrayInfo> arrayInfo;
+    NiceMock<MockConfigManager> configManager;
+    EnableEstimate(configManager);
+    DedupEstimator estimator(&arrayInfo, &configManager, nullptr, new NiceMock<MockTelemetryPublisher>());
+    estimator.Init();
+    std::vector<uint8_t> first = MakeRandomBlocks(1024, 5);
+    std::vector<uint8_t> second = MakeRandomBlocks(1024, 6);
+
+    // When
+    estimator.Sample(1, first.data(), first.size());
+    estimator.Sample(1, second.data(), second.size());
+
+    // Then
+    EXPECT_EQ(0U, estimator.GetDuplicateRatioInPercent(1));
+}
+
+TEST(DedupEstimator, Sample_testIfRatioIsPublishedPerInterval)
+{
+    // Given
+    NiceMock<MockIArrayInfo> arrayInfo;
+    NiceMock<MockConfigManager> configManager;
+    EnableEstimate(configManager);
+    NiceMock<MockTelemetryPublisher>* publisher = new NiceMock<MockTelemetryPublisher>();
+    DedupEstimator estimator(&arrayInfo, &configManager, nullptr, publisher);
+    estimator.Init();
+    std::vector<uint8_t> sampledBlocks;
+    std::mt19937 generator(9);
+    const uint64_t sampleMask = (1ULL << DedupEstimator::SAMPLE_BITS) - 1;
+    while (sampledBlocks.size() < DedupEstimator::PUBLISH_INTERVAL * BLOCK_SIZE)
+    {
+        std::vector<uint8_t> block(BLOCK_SIZE);
+        for (uint8_t& byte : block)
+        {
+            byte = static_cast<uint8_t>(generator());
+        }
+        if (0 == (BlockFingerprint::Compute(block.data(), BLOCK_SIZE).low & sampleMask))
+        {
+            sampledBlocks.insert(sampledBlocks.end(), block.begin(), block.end());
+        }
+    }
+
+    // Then
+    EXPECT_CALL(*publisher, PublishMetric).Times(1);
+
+    // When
+    estimator.Sample(1, sampledBlocks.data(), sampledBlocks.size());
+}
+
+TEST(DedupEstimator, Sample_testIfNothingIsSampledWhenDisabled)
+{
+    // Given
+    NiceMock<MockIArrayInfo> arrayInfo;
+    NiceMock<MockConfigManager> configManager;
+    ON_CALL(configManager, GetValue).WillByDefault(Return(-1));
+    DedupEstimator estimator(&arrayInfo, &configManager, nullptr, nullptr);
+    estimator.Init();
+    std::vector<uint8_t> image = MakeRandomBlocks(64, 7);
+
+    // When
+    estimator.Sample(1, image.data(), image.size());
+    estimator.Sample(1, image.data(), image.size());
+
+    // Then
+    EXPECT_FALSE(estimator.IsEnabled());
+    EXPECT_EQ(0U, estimator.GetDuplicateRatioInPercent(1));
+}
+
+} // namespace pos
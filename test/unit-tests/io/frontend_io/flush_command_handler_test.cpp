@@ -234,6 +234,35 @@ TEST(FlushCmdHandler, FlushCmdHandler_Execute_CaseMetaFlushInProgress_IsStripeMa
 
 namespace pos
 {
+TEST(FlushCmdHandler, FlushCmdHandler_Execute_NvramDurableFlush_WaitsForSealedWritesWithoutStripeFlush)
+{
+    // Given: nvram durable flush is enabled and the sealed write sequence is not acknowledged yet
+    FlushIoSmartPtr flushIo = std::make_shared<FlushIo>(0);
+    NiceMock<MockFlushCmdManager> mockFlushCmdManager;
+    NiceMock<MockIBlockAllocator> mockIBlockAllocator;
+    NiceMock<MockIWBStripeAllocator> mockIWBStripeAllocator;
+    NiceMock<MockIContextManager> mockIContextManager;
+    NiceMock<MockIMapFlush> mockIMapFlush;
+    FlushCmdHandler flushCmdHandler(flushIo, &mockFlushCmdManager, &mockIBlockAllocator,
+        &mockIWBStripeAllocator, &mockIContextManager, &mockIMapFlush);
+
+    ON_CALL(mockFlushCmdManager, IsFlushEnabled()).WillByDefault(Return(true));
+    ON_CALL(mockFlushCmdManager, IsNvramDurableFlushEnabled()).WillByDefault(Return(true));
+    EXPECT_CALL(mockFlushCmdManager, TrySealWriteSequence(_, _)).WillOnce(Return(true));
+    ON_CALL(mockFlushCmdManager, IsWriteSequenceDurable(_, _)).WillByDefault(Return(false));
+    EXPECT_CALL(mockIWBStripeAllocator, FlushAllPendingStripesInVolume(_, _)).Times(0);
+    EXPECT_CALL(mockIMapFlush, FlushDirtyMpages).Times(0);
+
+    // When: Execute twice
+    bool first = flushCmdHandler.Execute();
+    bool second = flushCmdHandler.Execute();
+
+    // Then: the handler keeps waiting on the sealed sequence without sealing again
+    EXPECT_FALSE(first);
+    EXPECT_FALSE(second);
+    EXPECT_EQ(FLUSH__WRITE_SEQUENCE_SEALED, flushIo->GetState());
+}
+
 TEST(MapFlushCompleteEvent, MapFlushCompleteEvent_Constructor_WithTwoArguments_Stack)
 {
     // Given
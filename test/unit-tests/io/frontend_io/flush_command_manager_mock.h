@@ -20,6 +20,12 @@ public:
     MOCK_METHOD(int, GetInternalFlushThreshold, (), (override));
     MOCK_METHOD(bool, TrySetFlushInProgress, (uint32_t volId), (override));
     MOCK_METHOD(void, ResetFlushInProgress, (uint32_t volId, bool isBackendFlush), (override));
+    MOCK_METHOD(bool, IsNvramDurableFlushEnabled, (), (override));
+    MOCK_METHOD(uint32_t, StartWrite, (uint32_t volId), (override));
+    MOCK_METHOD(void, AckWrite, (uint32_t volId, uint32_t slot), (override));
+    MOCK_METHOD(bool, TrySealWriteSequence, (uint32_t volId, uint64_t& sealedSequence), (override));
+    MOCK_METHOD(bool, IsWriteSequenceDurable, (uint32_t volId, uint64_t sealedSequence), (override));
+    MOCK_METHOD(void, ReleaseWriteSequence, (uint32_t volId), (override));
 };
 
 } // namespace pos
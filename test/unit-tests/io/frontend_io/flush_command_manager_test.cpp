@@ -124,4 +124,41 @@ TEST(FlushCmdManager, FlushCmdManager_ResetFlushInProgress_Normal)
     flushCmdManager.ResetFlushInProgress(0, true);
 }
 
+TEST(FlushCmdManager, IsWriteSequenceDurable_WaitsForWritesStartedBeforeSeal)
+{
+    // Given: two writes started on volume 0
+    FlushCmdManager flushCmdManager;
+    uint32_t slot1 = flushCmdManager.StartWrite(0);
+    uint32_t slot2 = flushCmdManager.StartWrite(0);
+    uint64_t sealedSequence;
+
+    // When: a flush seals the sequence and one write is acknowledged
+    ASSERT_TRUE(flushCmdManager.TrySealWriteSequence(0, sealedSequence));
+    flushCmdManager.AckWrite(0, slot1);
+
+    // Then: the sealed sequence waits for the other write only
+    uint32_t slotAfterSeal = flushCmdManager.StartWrite(0);
+    EXPECT_NE(slotAfterSeal, slot1);
+    EXPECT_FALSE(flushCmdManager.IsWriteSequenceDurable(0, sealedSequence));
+    flushCmdManager.AckWrite(0, slot2);
+    EXPECT_TRUE(flushCmdManager.IsWriteSequenceDurable(0, sealedSequence));
+}
+
+TEST(FlushCmdManager, TrySealWriteSequence_SerializedPerVolume)
+{
+    // Given
+    FlushCmdManager flushCmdManager;
+    uint64_t sealedSequence;
+
+    // When: a sequence is sealed on volume 0
+    ASSERT_TRUE(flushCmdManager.TrySealWriteSequence(0, sealedSequence));
+
+    // Then: another seal on volume 0 waits for the release, volume 1 does not
+    EXPECT_FALSE(flushCmdManager.TrySealWriteSequence(0, sealedSequence));
+    EXPECT_TRUE(flushCmdManager.TrySealWriteSequence(1, sealedSequence));
+    flushCmdManager.ReleaseWriteSequence(0);
+    EXPECT_TRUE(flushCmdManager.TrySealWriteSequence(0, sealedSequence));
+    EXPECT_EQ(1, sealedSequence);
+}
+
 } // namespace pos
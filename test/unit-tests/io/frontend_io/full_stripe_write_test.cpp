@@ -0,0 +1,178 @@
+#include "src/io/frontend_io/full_stripe_write.h"
+
+#include <gtest/gtest.h>
+
+#include "src/include/meta_const.h"
+#include "src/include/pos_event_id.h"
+#include "test/unit-tests/allocator/i_wbstripe_allocator_mock.h"
+#include "test/unit-tests/allocator/stripe_manager/stripe_mock.h"
+#include "test/unit-tests/bio/volume_io_mock.h"
+#include "test/unit-tests/event_scheduler/callback_mock.h"
+#include "test/unit-tests/io_submit_interface/i_io_submit_handler_mock.h"
+#include "test/unit-tests/master_context/config_manager_mock.h"
+#include "test/unit-tests/meta_service/i_meta_updater_mock.h"
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::ReturnRef;
+
+namespace pos
+{
+static PartitionLogicalSize
+MakeUserDataSize(void)
+{
+    PartitionLogicalSize udSize;
+    udSize.chunksPerStripe = 4;
+    udSize.blksPerChunk = BLOCKS_IN_CHUNK;
+    udSize.blksPerStripe = udSize.chunksPerStripe * BLOCKS_IN_CHUNK;
+    return udSize;
+}
+
+TEST(FullStripeWrite, IsFullStripe_testIfOnlyWholeStripeFromOffsetZeroMatches)
+{
+    // Given
+    VolumeIoSmartPtr volumeIo(new NiceMock<MockVolumeIo>(nullptr, 0, 0));
+    PartitionLogicalSize udSize = MakeUserDataSize();
+    FullStripeWrite fullStripeWrite(volumeIo, nullptr, nullptr, &udSize);
+    FullStripeWrite withoutSize(volumeIo, nullptr, nullptr, nullptr);
+    VirtualBlks wholeStripe = {.startVsa = {.stripeId = 3, .offset = 0}, .numBlks = udSize.blksPerStripe};
+    VirtualBlks partOfStripe = {.startVsa = {.stripeId = 3, .offset = 0}, .numBlks = udSize.blksPerStripe - 1};
+    VirtualBlks shiftedStripe = {.startVsa = {.stripeId = 3, .offset = 1}, .numBlks = udSize.blksPerStripe};
+
+    // When, Then
+    EXPECT_TRUE(fullStripeWrite.IsFullStripe(wholeStripe));
+    EXPECT_FALSE(fullStripeWrite.IsFullStripe(partOfStripe));
+    EXPECT_FALSE(fullStripeWrite.IsFullStripe(shiftedStripe));
+    EXPECT_FALSE(withoutSize.IsFullStripe(wholeStripe));
+}
+
+TEST(FullStripeWrite, Execute_testIfWholeStripeIsWrittenToUserDataWithParity)
+{
+    // Given
+    NiceMock<MockVolumeIo>* volumeIo = new NiceMock<MockVolumeIo>(nullptr, 0, 0);
+    VolumeIoSmartPtr volumeIoPtr(volumeIo);
+    NiceMock<MockIIOSubmitHandler> ioSubmitHandler;
+    NiceMock<MockIWBStripeAllocator> wbStripeAllocator;
+    NiceMock<MockStripe>* stripe = new NiceMock<MockStripe>();
+    StripeSmartPtr stripePtr(stripe);
+    PartitionLogicalSize udSize = MakeUserDataSize();
+    StripeAddr lsidEntry = {.stripeLoc = IN_WRITE_BUFFER_AREA, .stripeId = 11};
+    ON_CALL(*volumeIo, GetLsidEntry).WillByDefault(ReturnRef(lsidEntry));
+    ON_CALL(wbStripeAllocator, GetStripe(11)).WillByDefault(Return(stripePtr));
+    ON_CALL(*stripe, GetUserLsid).WillByDefault(Return(7));
+    FullStripeWrite fullStripeWrite(volumeIoPtr, &ioSubmitHandler, &wbStripeAllocator, &udSize);
+
+    // Then
+    EXPECT_CALL(ioSubmitHandler, SubmitAsyncIO(IODirection::WRITE, _, _, udSize.blksPerStripe, USER_DATA, _, _, false))
+        .WillOnce(Invoke(
+            [&](IODirection direction, std::list<BufferEntry>& bufferList, LogicalBlkAddr& startLSA,
+                uint64_t blockCount, PartitionType partitionToIO, CallbackSmartPtr callback,
+                int arrayId, bool parityOnly)
+            {
+                EXPECT_EQ(udSize.chunksPerStripe, bufferList.size());
+                EXPECT_EQ(7U, startLSA.stripeId);
+                EXPECT_EQ(0U, startLSA.offset);
+                callback->Execute();
+                return IOSubmitHandlerStatus::SUCCESS;
+            }));
+
+    // When
+    bool result = fullStripeWrite.Execute();
+
+    // Then
+    EXPECT_TRUE(result);
+}
+
+TEST(FullStripeWrite, Execute_testIfNothingIsSubmittedWithoutStripe)
+{
+    // Given
+    NiceMock<MockVolumeIo>* volumeIo = new NiceMock<MockVolumeIo>(nullptr, 0, 0);
+    VolumeIoSmartPtr volumeIoPtr(volumeIo);
+    NiceMock<MockIIOSubmitHandler> ioSubmitHandler;
+    NiceMock<MockIWBStripeAllocator> wbStripeAllocator;
+    PartitionLogicalSize udSize = MakeUserDataSize();
+    StripeAddr lsidEntry = {.stripeLoc = IN_WRITE_BUFFER_AREA, .stripeId = 11};
+    ON_CALL(*volumeIo, GetLsidEntry).WillByDefault(ReturnRef(lsidEntry));
+    ON_CALL(wbStripeAllocator, GetStripe).WillByDefault(Return(nullptr));
+    FullStripeWrite fullStripeWrite(volumeIoPtr, &ioSubmitHandler, &wbStripeAllocator, &udSize);
+
+    // Then
+    EXPECT_CALL(ioSubmitHandler, SubmitAsyncIO).Times(0);
+
+    // When
+    bool result = fullStripeWrite.Execute();
+
+    // Then
+    EXPECT_FALSE(result);
+}
+
+TEST(FullStripeWriteCompletion, Execute_testIfStripeMapIsUpdatedBeforeBlockMap)
+{
+    // Given
+    NiceMock<MockVolumeIo>* volumeIo = new NiceMock<MockVolumeIo>(nullptr, 0, 0);
+    VolumeIoSmartPtr volumeIoPtr(volumeIo);
+    NiceMock<MockStripe>* stripe = new NiceMock<MockStripe>();
+    StripeSmartPtr stripePtr(stripe);
+    NiceMock<MockIMetaUpdater> metaUpdater;
+    CallbackSmartPtr blockMapUpdateRequest(new NiceMock<MockCallback>(true));
+    volumeIo->SetCallback(blockMapUpdateRequest);
+    FullStripeWriteCompletion completion(volumeIoPtr, stripePtr, &metaUpdater);
+
+    // Then
+    EXPECT_CALL(*stripe, SetDirectWritten).Times(1);
+    EXPECT_CALL(metaUpdater, UpdateStripeMap(stripePtr, blockMapUpdateRequest)).WillOnce(Return(0));
+
+    // When
+    bool result = completion.Execute();
+
+    // Then
+    EXPECT_TRUE(result);
+}
+
+TEST(FullStripeWriteCompletion, Execute_testIfFailedWriteSkipsStripeMapUpdate)
+{
+    // Given
+    NiceMock<MockVolumeIo>* volumeIo = new NiceMock<MockVolumeIo>(nullptr, 0, 0);
+    VolumeIoSmartPtr volumeIoPtr(volumeIo);
+    NiceMock<MockStripe>* stripe = new NiceMock<MockStripe>();
+    StripeSmartPtr stripePtr(stripe);
+    NiceMock<MockIMetaUpdater> metaUpdater;
+    NiceMock<MockCallback>* blockMapUpdateRequest = new NiceMock<MockCallback>(true);
+    CallbackSmartPtr blockMapUpdateRequestPtr(blockMapUpdateRequest);
+    volumeIo->SetCallback(blockMapUpdateRequestPtr);
+    FullStripeWriteCompletion completion(volumeIoPtr, stripePtr, &metaUpdater);
+    completion.InformError(IOErrorType::GENERIC_ERROR);
+
+    // Then
+    EXPECT_CALL(*stripe, SetDirectWritten).Times(0);
+    EXPECT_CALL(metaUpdater, UpdateStripeMap).Times(0);
+    EXPECT_CALL(*blockMapUpdateRequest, _RecordCallerCompletionAndCheckOkToCall(1, _, _)).WillOnce(Return(false));
+
+    // When
+    bool result = completion.Execute();
+
+    // Then
+    EXPECT_TRUE(result);
+}
+
+TEST(FullStripeWrite, LoadConfig_testIfJournalKeepsItDisabled)
+{
+    // Given
+    NiceMock<MockConfigManager> configManager;
+    ON_CALL(configManager, GetValue).WillByDefault(Invoke(
+        [](string module, string key, void* value, ConfigType type)
+        {
+            *static_cast<bool*>(value) = true;
+            return EID(SUCCESS);
+        }));
+
+    // When
+    bool enabled = FullStripeWrite::LoadConfig(&configManager);
+
+    // Then
+    EXPECT_FALSE(enabled);
+}
+
+} // namespace pos
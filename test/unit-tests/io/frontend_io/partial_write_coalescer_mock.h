@@ -0,0 +1,35 @@
+#include <gmock/gmock.h>
+
+#include <list>
+#include <string>
+#include <vector>
+
+#include "src/io/frontend_io/partial_write_coalescer.h"
+
+namespace pos
+{
+class MockPartialBlockMergeCompletion : public PartialBlockMergeCompletion
+{
+public:
+    using PartialBlockMergeCompletion::PartialBlockMergeCompletion;
+    MOCK_METHOD(bool, _DoSpecificJob, (), (override));
+};
+
+class MockPartialWriteCoalescer : public PartialWriteCoalescer
+{
+public:
+    using PartialWriteCoalescer::PartialWriteCoalescer;
+    MOCK_METHOD(int, Init, (), (override));
+    MOCK_METHOD(void, Dispose, (), (override));
+    MOCK_METHOD(void, Shutdown, (), (override));
+    MOCK_METHOD(void, Flush, (), (override));
+    MOCK_METHOD(bool, IsEnabled, (), (override));
+    MOCK_METHOD(bool, Claim, (uint32_t volumeId, BlkAddr rba), (override));
+    MOCK_METHOD(void, Unclaim, (uint32_t volumeId, BlkAddr rba), (override));
+    MOCK_METHOD(PartialWriteResult, Coalesce, (uint32_t volumeId, BlkAddr rba, VirtualBlkAddr oldVsa, StripeAddr oldLsidEntry, VirtualBlkAddr newVsa, uint32_t sectorOffset, uint32_t sectorCount), (override));
+    MOCK_METHOD(void, CompleteWrite, (uint32_t volumeId, BlkAddr rba, VirtualBlkAddr vsa, bool success), (override));
+    MOCK_METHOD(bool, TryCompleteBlocks, (uint32_t volumeId, BlkAddr startRba, uint32_t blockCount), (override));
+    MOCK_METHOD(bool, TryCompleteStripe, (StripeSmartPtr stripe, uint32_t blksPerStripe), (override));
+};
+
+} // namespace pos
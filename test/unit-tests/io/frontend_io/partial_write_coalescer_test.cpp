@@ -0,0 +1,180 @@
+#include "src/io/frontend_io/partial_write_coalescer.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "src/array/device/array_device.h"
+#include "src/include/pos_event_id.h"
+#include "test/unit-tests/allocator/i_segment_ctx_mock.h"
+#include "test/unit-tests/array/service/io_translator/i_io_translator_mock.h"
+#include "test/unit-tests/array_models/interface/i_array_info_mock.h"
+#include "test/unit-tests/device/base/ublock_device_mock.h"
+#include "test/unit-tests/device/i_io_dispatcher_mock.h"
+#include "test/unit-tests/mapper/i_stripemap_mock.h"
+#include "test/unit-tests/master_context/config_manager_mock.h"
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+class PartialWriteCoalescerTestFixture : public ::testing::Test
+{
+protected:
+    void
+    SetUp(void) override
+    {
+        ublock = std::make_shared<NiceMock<MockUBlockDevice>>("uram0", 1024 * 1024, nullptr);
+        writeBufferDevice = new ArrayDevice(ublock);
+        ON_CALL(*ublock, GetByteAddress).WillByDefault(Return(writeBuffer));
+        ON_CALL(arrayInfo, GetIndex).WillByDefault(Return(0));
+        ON_CALL(arrayInfo, GetName).WillByDefault(Return("POSArray"));
+        ON_CALL(translator, Translate).WillByDefault(Invoke(
+            [this](unsigned int arrayIndex, PartitionType part, list<PhysicalEntry>& pel, const LogicalEntry& le)
+            {
+                PhysicalEntry entry = {.addr = {.lba = 0, .arrayDev = writeBufferDevice}, .blkCnt = 1};
+                pel.push_back(entry);
+                return EID(SUCCESS);
+            }));
+    }
+
+    void
+    TearDown(void) override
+    {
+        delete writeBufferDevice;
+    }
+
+    void
+    SetConfig(bool coalescingEnabled, bool journalEnabled)
+    {
+        ON_CALL(configManager, GetValue).WillByDefault(Invoke(
+            [coalescingEnabled, journalEnabled](string module, string key, void* value, ConfigType type)
+            {
+                *static_cast<bool*>(value) = ("journal" == module) ? journalEnabled : coalescingEnabled;
+                return EID(SUCCESS);
+            }));
+    }
+
+    NiceMock<MockIArrayInfo> arrayInfo;
+    NiceMock<MockConfigManager> configManager;
+    NiceMock<MockISegmentCtx> segmentCtx;
+    NiceMock<MockIStripeMap> stripeMap;
+    NiceMock<MockIIOTranslator> translator;
+    NiceMock<MockIIODispatcher> ioDispatcher;
+    std::shared_ptr<NiceMock<MockUBlockDevice>> ublock;
+    ArrayDevice* writeBufferDevice;
+    char writeBuffer[BLOCK_SIZE];
+
+    const uint32_t volumeId = 1;
+    const BlkAddr rba = 100;
+    const VirtualBlkAddr baseVsa = {.stripeId = 10, .offset = 3};
+    const StripeAddr userAreaEntry = {.stripeLoc = IN_USER_AREA, .stripeId = 10};
+    const VirtualBlkAddr firstVsa = {.stripeId = 20, .offset = 0};
+    const VirtualBlkAddr secondVsa = {.stripeId = 20, .offset = 1};
+};
+
+TEST_F(PartialWriteCoalescerTestFixture, Init_testIfJournalKeepsCoalescingDisabled)
+{
+    // Given
+    SetConfig(true, true);
+    PartialWriteCoalescer coalescer(&arrayInfo, &configManager, &segmentCtx, &stripeMap, &translator, &ioDispatcher);
+
+    // When
+    coalescer.Init();
+
+    // Then
+    EXPECT_FALSE(coalescer.IsEnabled());
+    EXPECT_EQ(PartialWriteResult::NotCoalesced,
+        coalescer.Coalesce(volumeId, rba, baseVsa, userAreaEntry, firstVsa, 0, 1));
+}
+
+TEST_F(PartialWriteCoalescerTestFixture, Coalesce_testIfFirstPartialWriteIsDeferredAndPinsTheBase)
+{
+    // Given
+    SetConfig(true, false);
+    PartialWriteCoalescer coalescer(&arrayInfo, &configManager, &segmentCtx, &stripeMap, &translator, &ioDispatcher);
+    coalescer.Init();
+
+    // Then
+    EXPECT_CALL(segmentCtx, ValidateBlks(VirtualBlks{.startVsa = baseVsa, .numBlks = 1})).Times(1);
+
+    // When
+    PartialWriteResult result = coalescer.Coalesce(volumeId, rba, baseVsa, userAreaEntry, firstVsa, 0, 2);
+
+    // Then
+    EXPECT_EQ(PartialWriteResult::Deferred, result);
+    EXPECT_EQ(1U, coalescer.GetPendingBlockCount());
+    EXPECT_FALSE(coalescer.TryCompleteBlocks(volumeId, rba, 1));
+}
+
+TEST_F(PartialWriteCoalescerTestFixture, Coalesce_testIfUnmappedOrWriteBufferBlockIsNotCoalesced)
+{
+    // Given
+    SetConfig(true, false);
+    PartialWriteCoalescer coalescer(&arrayInfo, &configManager, &segmentCtx, &stripeMap, &translator, &ioDispatcher);
+    coalescer.Init();
+    StripeAddr writeBufferEntry = {.stripeLoc = IN_WRITE_BUFFER_AREA, .stripeId = 10};
+
+    // Then
+    EXPECT_CALL(segmentCtx, ValidateBlks).Times(0);
+
+    // When, Then
+    EXPECT_EQ(PartialWriteResult::NotCoalesced,
+        coalescer.Coalesce(volumeId, rba, UNMAP_VSA, userAreaEntry, firstVsa, 0, 1));
+    EXPECT_EQ(PartialWriteResult::NotCoalesced,
+        coalescer.Coalesce(volumeId, rba, baseVsa, writeBufferEntry, firstVsa, 0, 1));
+    EXPECT_EQ(0U, coalescer.GetPendingBlockCount());
+}
+
+TEST_F(PartialWriteCoalescerTestFixture, CompleteWrite_testIfBlockWrittenInFullReleasesTheBase)
+{
+    // Given
+    SetConfig(true, false);
+    PartialWriteCoalescer coalescer(&arrayInfo, &configManager, &segmentCtx, &stripeMap, &translator, &ioDispatcher);
+    coalescer.Init();
+    uint32_t halfBlock = PartialWriteCoalescer::SECTORS_PER_BLOCK / 2;
+    coalescer.Coalesce(volumeId, rba, baseVsa, userAreaEntry, firstVsa, 0, halfBlock);
+    coalescer.CompleteWrite(volumeId, rba, firstVsa, true);
+
+    // Then
+    EXPECT_CALL(segmentCtx, InvalidateBlks(VirtualBlks{.startVsa = baseVsa, .numBlks = 1}, _)).Times(1);
+
+    // When
+    EXPECT_TRUE(coalescer.Claim(volumeId, rba));
+    EXPECT_EQ(PartialWriteResult::Inherited,
+        coalescer.Coalesce(volumeId, rba, firstVsa, userAreaEntry, secondVsa, halfBlock, halfBlock));
+    coalescer.CompleteWrite(volumeId, rba, secondVsa, true);
+
+    // Then
+    EXPECT_EQ(0U, coalescer.GetPendingBlockCount());
+    EXPECT_TRUE(coalescer.TryCompleteBlocks(volumeId, rba, 1));
+}
+
+TEST_F(PartialWriteCoalescerTestFixture, CompleteWrite_testIfFailedWriteGoesBackToThePreviousWrite)
+{
+    // Given
+    SetConfig(true, false);
+    PartialWriteCoalescer coalescer(&arrayInfo, &configManager, &segmentCtx, &stripeMap, &translator, &ioDispatcher);
+    coalescer.Init();
+    coalescer.Coalesce(volumeId, rba, baseVsa, userAreaEntry, firstVsa, 0, 1);
+    coalescer.CompleteWrite(volumeId, rba, firstVsa, true);
+    coalescer.Claim(volumeId, rba);
+    coalescer.Coalesce(volumeId, rba, firstVsa, userAreaEntry, secondVsa, 1, 1);
+
+    // Then
+    EXPECT_CALL(segmentCtx, InvalidateBlks).Times(0);
+
+    // When
+    coalescer.CompleteWrite(volumeId, rba, secondVsa, false);
+
+    // Then
+    EXPECT_EQ(1U, coalescer.GetPendingBlockCount());
+    EXPECT_TRUE(coalescer.Claim(volumeId, rba));
+    EXPECT_EQ(PartialWriteResult::Inherited,
+        coalescer.Coalesce(volumeId, rba, firstVsa, userAreaEntry, secondVsa, 1, 1));
+}
+
+} // namespace pos
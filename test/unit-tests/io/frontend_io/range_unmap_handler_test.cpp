@@ -0,0 +1,111 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io/frontend_io/range_unmap_handler.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "test/unit-tests/event_scheduler/callback_mock.h"
+#include "test/unit-tests/io/general_io/rba_state_manager_mock.h"
+#include "test/unit-tests/meta_service/i_meta_updater_mock.h"
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+TEST(RangeUnmapHandler, Execute_testIfRetriedWhenOwnershipIsNotAcquired)
+{
+    // Given
+    NiceMock<MockRBAStateManager> rbaStateManager("", 0);
+    NiceMock<MockIMetaUpdater> metaUpdater;
+    CallbackSmartPtr completion(new NiceMock<MockCallback>(true));
+    RangeUnmapHandler handler(0, 1, 256, 4096, completion, &rbaStateManager, &metaUpdater);
+
+    // Then
+    EXPECT_CALL(rbaStateManager, BulkAcquireOwnership(1, 256, 4096)).WillOnce(Return(false));
+    EXPECT_CALL(metaUpdater, UnmapBlockRange).Times(0);
+
+    // When
+    EXPECT_FALSE(handler.Execute());
+}
+
+TEST(RangeUnmapHandler, Execute_testIfWholeRangeIsUnmappedByOneRequest)
+{
+    // Given
+    NiceMock<MockRBAStateManager> rbaStateManager("", 0);
+    NiceMock<MockIMetaUpdater> metaUpdater;
+    CallbackSmartPtr completion(new NiceMock<MockCallback>(true));
+    RangeUnmapHandler handler(0, 1, 256, 4096, completion, &rbaStateManager, &metaUpdater);
+
+    // Then
+    EXPECT_CALL(rbaStateManager, BulkAcquireOwnership(1, 256, 4096)).WillOnce(Return(true));
+    EXPECT_CALL(metaUpdater, UnmapBlockRange(1, 256, 4096, _)).WillOnce(Return(0));
+
+    // When
+    EXPECT_TRUE(handler.Execute());
+}
+
+TEST(RangeUnmapHandler, Execute_testIfOwnershipIsKeptWhileUnmapIsRetried)
+{
+    // Given
+    NiceMock<MockRBAStateManager> rbaStateManager("", 0);
+    NiceMock<MockIMetaUpdater> metaUpdater;
+    CallbackSmartPtr completion(new NiceMock<MockCallback>(true));
+    RangeUnmapHandler handler(0, 1, 256, 4096, completion, &rbaStateManager, &metaUpdater);
+
+    // Then
+    EXPECT_CALL(rbaStateManager, BulkAcquireOwnership).WillOnce(Return(true));
+    EXPECT_CALL(rbaStateManager, BulkReleaseOwnership).Times(0);
+    EXPECT_CALL(metaUpdater, UnmapBlockRange).WillOnce(Return(-1)).WillOnce(Return(0));
+
+    // When
+    EXPECT_FALSE(handler.Execute());
+    EXPECT_TRUE(handler.Execute());
+}
+
+TEST(RangeUnmapCompletion, Execute_testIfOwnershipIsReleased)
+{
+    // Given
+    NiceMock<MockRBAStateManager> rbaStateManager("", 0);
+    RangeUnmapCompletion completion(1, 256, 4096, &rbaStateManager);
+
+    // Then
+    EXPECT_CALL(rbaStateManager, BulkReleaseOwnership(1, 256, 4096)).Times(1);
+
+    // When
+    EXPECT_TRUE(completion.Execute());
+}
+
+} // namespace pos
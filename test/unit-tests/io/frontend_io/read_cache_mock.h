@@ -0,0 +1,32 @@
+#include <gmock/gmock.h>
+
+#include <list>
+#include <string>
+#include <vector>
+
+#include "src/io/frontend_io/read_cache.h"
+
+namespace pos
+{
+class MockReadCache : public ReadCache
+{
+public:
+    using ReadCache::ReadCache;
+    MOCK_METHOD(int, Init, (), (override));
+    MOCK_METHOD(void, Dispose, (), (override));
+    MOCK_METHOD(void, Shutdown, (), (override));
+    MOCK_METHOD(void, Flush, (), (override));
+    MOCK_METHOD(bool, IsEnabled, (), (override));
+    MOCK_METHOD(uint32_t, GetGeneration, (const VirtualBlkAddr& vsa), (override));
+    MOCK_METHOD(bool, Lookup, (const VirtualBlkAddr& vsa, void* dst), (override));
+    MOCK_METHOD(void, Insert, (const VirtualBlkAddr& vsa, uint32_t generation, const void* src), (override));
+    MOCK_METHOD(void, Invalidate, (const VirtualBlkAddr& vsa), (override));
+    MOCK_METHOD(void, InvalidateSegment, (SegmentId segmentId), (override));
+    MOCK_METHOD(ReadCacheStats, GetStats, (), (override));
+    MOCK_METHOD(void, RecordRead, (uint32_t volumeId, BlkAddr rba, bool hit), (override));
+    MOCK_METHOD(void, InsertPrefetched, (const VirtualBlkAddr& vsa, uint32_t generation, const void* src, uint32_t numa), (override));
+    MOCK_METHOD(void, ReadAheadStarted, (), (override));
+    MOCK_METHOD(void, ReadAheadDone, (), (override));
+};
+
+} // namespace pos
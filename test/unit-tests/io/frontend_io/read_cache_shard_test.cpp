@@ -0,0 +1,171 @@
+#include "src/io/frontend_io/read_cache_shard.h"
+
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+#include <vector>
+
+#include "src/include/memory.h"
+
+using namespace pos;
+using namespace std;
+
+namespace pos
+{
+class ReadCacheShardFixture : public ::testing::Test
+{
+protected:
+    vector<void*>
+    _CreateFrames(uint32_t count)
+    {
+        vector<void*> frames;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            frames.push_back(new char[BLOCK_SIZE]);
+        }
+        return frames;
+    }
+
+    void
+    _DeleteFrames(ReadCacheShard& shard)
+    {
+        for (auto frame : shard.ReleaseFrames())
+        {
+            delete[] static_cast<char*>(frame);
+        }
+    }
+
+    void
+    _Fill(char pattern)
+    {
+        memset(src, pattern, BLOCK_SIZE);
+    }
+
+    char src[BLOCK_SIZE];
+    char dst[BLOCK_SIZE];
+};
+
+TEST_F(ReadCacheShardFixture, Lookup_testIfInsertedBlockIsCopiedOut)
+{
+    // Given
+    ReadCacheShard shard(_CreateFrames(4), false);
+    _Fill('a');
+
+    // When
+    bool missed = shard.Lookup(1, 0, dst);
+    shard.Insert(1, 0, src);
+    bool hit = shard.Lookup(1, 0, dst);
+
+    // Then
+    EXPECT_FALSE(missed);
+    EXPECT_TRUE(hit);
+    EXPECT_EQ(0, memcmp(src, dst, BLOCK_SIZE));
+    ReadCacheStats stats = shard.GetStats();
+    EXPECT_EQ(1U, stats.hit);
+    EXPECT_EQ(1U, stats.miss);
+    _DeleteFrames(shard);
+}
+
+TEST_F(ReadCacheShardFixture, Lookup_testIfEntryOfOldGenerationIsDropped)
+{
+    // Given
+    ReadCacheShard shard(_CreateFrames(4), false);
+    _Fill('a');
+    shard.Insert(1, 0, src);
+
+    // When: the segment of the block was freed and reused
+    bool hitWithNewGeneration = shard.Lookup(1, 1, dst);
+    bool hitWithOldGeneration = shard.Lookup(1, 0, dst);
+
+    // Then
+    EXPECT_FALSE(hitWithNewGeneration);
+    EXPECT_FALSE(hitWithOldGeneration);
+    _DeleteFrames(shard);
+}
+
+TEST_F(ReadCacheShardFixture, Invalidate_testIfInvalidatedBlockMisses)
+{
+    // Given
+    ReadCacheShard shard(_CreateFrames(4), false);
+    _Fill('a');
+    shard.Insert(1, 0, src);
+
+    // When
+    shard.Invalidate(1);
+
+    // Then
+    EXPECT_FALSE(shard.Lookup(1, 0, dst));
+    EXPECT_EQ(1U, shard.GetStats().invalidate);
+    _DeleteFrames(shard);
+}
+
+TEST_F(ReadCacheShardFixture, Insert_testIfScanDoesNotEvictProtectedBlock)
+{
+    // Given: the block 1 is hit once and moves to the protected segment
+    ReadCacheShard shard(_CreateFrames(5), false);
+    _Fill('a');
+    shard.Insert(1, 0, src);
+    shard.Lookup(1, 0, dst);
+
+    // When: a scan of cold blocks goes through the cache
+    for (uint64_t key = 100; key < 120; key++)
+    {
+        shard.Insert(key, 0, src);
+    }
+
+    // Then
+    EXPECT_TRUE(shard.Lookup(1, 0, dst));
+    EXPECT_FALSE(shard.Lookup(100, 0, dst));
+    _DeleteFrames(shard);
+}
+
+TEST_F(ReadCacheShardFixture, Insert_testIfTinyLfuRejectsColdBlockWhenFull)
+{
+    // Given: a full cache of blocks looked up several times
+    ReadCacheShard shard(_CreateFrames(2), true);
+    _Fill('a');
+    for (uint64_t key = 1; key <= 2; key++)
+    {
+        for (int count = 0; count < 3; count++)
+        {
+            shard.Lookup(key, 0, dst);
+        }
+        shard.Insert(key, 0, src);
+    }
+
+    // When: a block seen once tries to get in
+    shard.Lookup(3, 0, dst);
+    shard.Insert(3, 0, src);
+
+    // Then
+    EXPECT_FALSE(shard.Lookup(3, 0, dst));
+    EXPECT_TRUE(shard.Lookup(1, 0, dst));
+    EXPECT_TRUE(shard.Lookup(2, 0, dst));
+    EXPECT_EQ(1U, shard.GetStats().reject);
+    _DeleteFrames(shard);
+}
+
+TEST_F(ReadCacheShardFixture, Insert_testIfPrefetchedBlockBypassesAdmissionAndIsNotPromoted)
+{
+    // Given: a full shard whose blocks were read before
+    ReadCacheShard shard(_CreateFrames(2), true);
+    _Fill('a');
+    shard.Insert(1, 0, src);
+    shard.Insert(2, 0, src);
+    shard.Lookup(1, 0, dst);
+    shard.Lookup(2, 0, dst);
+
+    // When
+    shard.Insert(3, 0, src, true);
+    bool firstHit = shard.Lookup(3, 0, dst);
+
+    // Then: the prefetched block was admitted and its hit is counted apart
+    ReadCacheStats stats = shard.GetStats();
+    EXPECT_TRUE(firstHit);
+    EXPECT_EQ(1, stats.prefetch);
+    EXPECT_EQ(1, stats.prefetchHit);
+    _DeleteFrames(shard);
+}
+
+} // namespace pos
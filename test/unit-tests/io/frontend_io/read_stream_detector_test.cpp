@@ -0,0 +1,82 @@
+#include "src/io/frontend_io/read_stream_detector.h"
+
+#include <gtest/gtest.h>
+
+namespace pos
+{
+TEST(ReadStreamDetector, Record_testIfSequentialStreamTriggersReadAhead)
+{
+    // Given
+    ReadStreamDetector detector(32, 256);
+    ReadAheadRange range;
+
+    // When: the stream reaches the threshold
+    bool readAhead = false;
+    for (BlkAddr rba = 100; rba < 100 + ReadStreamDetector::SEQUENTIAL_THRESHOLD; rba++)
+    {
+        readAhead = detector.Record(1, rba, false, range);
+    }
+
+    // Then: the window starts right after the last read
+    EXPECT_TRUE(readAhead);
+    EXPECT_EQ(1, range.volumeId);
+    EXPECT_EQ(100 + ReadStreamDetector::SEQUENTIAL_THRESHOLD, range.startRba);
+    EXPECT_EQ(32, range.numBlks);
+}
+
+TEST(ReadStreamDetector, Record_testIfRandomReadsDoNotTriggerReadAhead)
+{
+    // Given
+    ReadStreamDetector detector(32, 256);
+    ReadAheadRange range;
+
+    // When, Then
+    for (BlkAddr rba = 0; rba < 64; rba++)
+    {
+        EXPECT_FALSE(detector.Record(0, rba * 1000, false, range));
+    }
+}
+
+TEST(ReadStreamDetector, Record_testIfWindowGrowsWhenReadAheadHits)
+{
+    // Given: a stream whose first window was issued
+    ReadStreamDetector detector(32, 256);
+    ReadAheadRange range;
+    BlkAddr rba = 0;
+    for (; rba < ReadStreamDetector::SEQUENTIAL_THRESHOLD; rba++)
+    {
+        detector.Record(0, rba, false, range);
+    }
+    BlkAddr firstEnd = range.startRba + range.numBlks;
+
+    // When: the stream hits the blocks read ahead until the next window
+    bool readAhead = false;
+    while (false == readAhead)
+    {
+        readAhead = detector.Record(0, rba++, true, range);
+    }
+
+    // Then: the next window continues the first one and is twice as long
+    EXPECT_EQ(firstEnd, range.startRba);
+    EXPECT_EQ(rba + 64, range.startRba + range.numBlks);
+}
+
+TEST(ReadStreamDetector, Record_testIfInterleavedStreamsAreTrackedApart)
+{
+    // Given
+    ReadStreamDetector detector(32, 256);
+    ReadAheadRange range;
+    int numReadAhead = 0;
+
+    // When: two streams of the same volume are read in turns
+    for (BlkAddr offset = 0; offset < ReadStreamDetector::SEQUENTIAL_THRESHOLD; offset++)
+    {
+        numReadAhead += detector.Record(0, offset, false, range) ? 1 : 0;
+        numReadAhead += detector.Record(0, 1000000 + offset, false, range) ? 1 : 0;
+    }
+
+    // Then
+    EXPECT_EQ(2, numReadAhead);
+}
+
+} // namespace pos
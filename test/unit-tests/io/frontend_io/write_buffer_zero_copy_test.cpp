@@ -0,0 +1,235 @@
+#include "src/io/frontend_io/write_buffer_zero_copy.h"
+
+#include <gtest/gtest.h>
+
+#include <list>
+#include <string>
+
+#include "spdk/pos.h"
+#include "src/array/device/array_device.h"
+#include "src/include/pos_event_id.h"
+#include "test/unit-tests/allocator/i_block_allocator_mock.h"
+#include "test/unit-tests/allocator/i_wbstripe_allocator_mock.h"
+#include "test/unit-tests/allocator/stripe_manager/stripe_mock.h"
+#include "test/unit-tests/array/service/io_translator/i_io_translator_mock.h"
+#include "test/unit-tests/array_models/interface/i_array_info_mock.h"
+#include "test/unit-tests/device/base/ublock_device_mock.h"
+#include "test/unit-tests/gc/flow_control/flow_control_mock.h"
+#include "test/unit-tests/io/general_io/rba_state_manager_mock.h"
+#include "test/unit-tests/mapper/i_stripemap_mock.h"
+#include "test/unit-tests/master_context/config_manager_mock.h"
+#include "test/unit-tests/spdk_wrapper/event_framework_api_mock.h"
+#include "test/unit-tests/state/state_control_mock.h"
+#include "test/unit-tests/volume/volume_manager_mock.h"
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+class WriteBufferZeroCopyTestFixture : public ::testing::Test
+{
+public:
+    WriteBufferZeroCopyTestFixture(void)
+    : flowControl(nullptr, nullptr, nullptr, nullptr, nullptr, nullptr),
+      rbaStateManager("POSArray", 0)
+    {
+    }
+
+protected:
+    void
+    SetUp(void) override
+    {
+        ublock = std::make_shared<NiceMock<MockUBlockDevice>>("uram0", 1024 * 1024, nullptr);
+        writeBufferDevice = new ArrayDevice(ublock);
+        ON_CALL(*ublock, GetByteAddress).WillByDefault(Return(writeBuffer));
+        ON_CALL(arrayInfo, GetIndex).WillByDefault(Return(0));
+        ON_CALL(arrayInfo, GetName).WillByDefault(Return("POSArray"));
+        ON_CALL(configManager, GetValue).WillByDefault(Invoke(
+            [](string module, string key, void* value, ConfigType type)
+            {
+                *static_cast<bool*>(value) = true;
+                return EID(SUCCESS);
+            }));
+        ON_CALL(translator, Translate).WillByDefault(Invoke(
+            [this](unsigned int arrayIndex, PartitionType part, list<PhysicalEntry>& pel, const LogicalEntry& le)
+            {
+                uint64_t lba = (le.addr.stripeId * BLOCKS_PER_STRIPE + le.addr.offset) * (BLOCK_SIZE / SECTOR_SIZE);
+                PhysicalEntry entry = {.addr = {.lba = lba, .arrayDev = writeBufferDevice}, .blkCnt = le.blkCnt};
+                pel.push_back(entry);
+                return EID(SUCCESS);
+            }));
+        ON_CALL(stripeMap, GetLSA).WillByDefault(Invoke(
+            [](StripeId vsid)
+            {
+                return StripeAddr{.stripeLoc = IN_WRITE_BUFFER_AREA, .stripeId = vsid};
+            }));
+        ON_CALL(volumeManager, IncreasePendingIOCountIfNotZero).WillByDefault(Return(EID(SUCCESS)));
+        ON_CALL(blockAllocator, TryRdLock).WillByDefault(Return(true));
+        ON_CALL(blockAllocator, Unlock).WillByDefault(Return(true));
+        ON_CALL(flowControl, GetToken).WillByDefault(Invoke(
+            [](FlowControlType type, int token)
+            {
+                return token;
+            }));
+        ON_CALL(rbaStateManager, BulkAcquireOwnership).WillByDefault(Return(true));
+
+        zeroCopy = new WriteBufferZeroCopy(&arrayInfo, &configManager, &volumeManager,
+            &rbaStateManager, &blockAllocator, &wbStripeAllocator, &flowControl, &stripeMap,
+            &translator, &eventFrameworkApi);
+        zeroCopy->Init();
+    }
+
+    void
+    TearDown(void) override
+    {
+        delete zeroCopy;
+        delete writeBufferDevice;
+    }
+
+    struct pos_io
+    MakeWrite(uint64_t rba, uint32_t blockCount)
+    {
+        struct pos_io io = {};
+        io.ioType = WRITE;
+        io.volume_id = volumeId;
+        io.iov = iov;
+        io.iovcnt = POS_ZCOPY_MAX_IOVCNT;
+        io.offset = rba * BLOCK_SIZE;
+        io.length = blockCount * BLOCK_SIZE;
+        return io;
+    }
+
+    static const uint32_t BLOCKS_PER_STRIPE = 4;
+
+    NiceMock<MockIArrayInfo> arrayInfo;
+    NiceMock<MockConfigManager> configManager;
+    NiceMock<MockStateControl> stateControl{"array"};
+    NiceMock<MockVolumeManager> volumeManager{nullptr, &stateControl};
+    NiceMock<MockFlowControl> flowControl;
+    NiceMock<MockRBAStateManager> rbaStateManager;
+    NiceMock<MockIBlockAllocator> blockAllocator;
+    NiceMock<MockIWBStripeAllocator> wbStripeAllocator;
+    NiceMock<MockIStripeMap> stripeMap;
+    NiceMock<MockIIOTranslator> translator;
+    NiceMock<MockEventFrameworkApi> eventFrameworkApi;
+    std::shared_ptr<NiceMock<MockUBlockDevice>> ublock;
+    ArrayDevice* writeBufferDevice;
+    char writeBuffer[BLOCK_SIZE * BLOCKS_PER_STRIPE * 4];
+    struct iovec iov[POS_ZCOPY_MAX_IOVCNT];
+    WriteBufferZeroCopy* zeroCopy;
+
+    const uint32_t volumeId = 1;
+};
+
+TEST_F(WriteBufferZeroCopyTestFixture, GetBuffer_testIfTheWriteBufferBlocksOfTheWriteAreHandedOut)
+{
+    // Given: the write gets the last block of stripe 1 and the first of stripe 2
+    struct pos_io io = MakeWrite(10, 3);
+    VirtualBlks first = {.startVsa = {.stripeId = 1, .offset = 3}, .numBlks = 1};
+    VirtualBlks second = {.startVsa = {.stripeId = 2, .offset = 0}, .numBlks = 2};
+    EXPECT_CALL(blockAllocator, AllocateWriteBufferBlks(volumeId, 3, _, WRITE_STREAM_MIXED)).WillOnce(Return(std::make_pair(first, 1)));
+    EXPECT_CALL(blockAllocator, AllocateWriteBufferBlks(volumeId, 2, _, WRITE_STREAM_MIXED)).WillOnce(Return(std::make_pair(second, 2)));
+
+    // When
+    int ret = zeroCopy->GetBuffer(io);
+
+    // Then: the blocks are next to each other in the write buffer
+    EXPECT_EQ(POS_IO_STATUS_SUCCESS, ret);
+    ASSERT_EQ(1, io.iovcnt);
+    EXPECT_EQ(writeBuffer + 7 * BLOCK_SIZE, io.iov[0].iov_base);
+    EXPECT_EQ(3 * BLOCK_SIZE, io.iov[0].iov_len);
+    EXPECT_EQ(1U, zeroCopy->GetReservationCount());
+}
+
+TEST_F(WriteBufferZeroCopyTestFixture, GetBuffer_testIfWritesOfPartOfABlockAreNotReceivedIntoTheWriteBuffer)
+{
+    // Given
+    struct pos_io io = MakeWrite(10, 1);
+    io.offset += SECTOR_SIZE;
+
+    // Then
+    EXPECT_CALL(blockAllocator, AllocateWriteBufferBlks).Times(0);
+    EXPECT_CALL(rbaStateManager, BulkAcquireOwnership).Times(0);
+
+    // When
+    int ret = zeroCopy->GetBuffer(io);
+
+    // Then
+    EXPECT_EQ(POS_IO_STATUS_FAIL, ret);
+    EXPECT_EQ(0U, zeroCopy->GetReservationCount());
+}
+
+TEST_F(WriteBufferZeroCopyTestFixture, GetBuffer_testIfOwnershipAndTokenAreGivenBackWhenTheBufferIsFull)
+{
+    // Given
+    struct pos_io io = MakeWrite(10, 2);
+    ON_CALL(blockAllocator, AllocateWriteBufferBlks).WillByDefault(
+        Return(std::make_pair(VirtualBlks{.startVsa = UNMAP_VSA, .numBlks = 0}, UNMAP_STRIPE)));
+
+    // Then
+    EXPECT_CALL(rbaStateManager, BulkReleaseOwnership(volumeId, 10, 2)).Times(1);
+    EXPECT_CALL(flowControl, ReturnToken(FlowControlType::USER, 2)).Times(1);
+    EXPECT_CALL(volumeManager, DecreasePendingIOCount(volumeId, VolumeIoType::UserWrite, 1)).Times(1);
+
+    // When
+    int ret = zeroCopy->GetBuffer(io);
+
+    // Then
+    EXPECT_EQ(POS_IO_STATUS_FAIL, ret);
+}
+
+TEST_F(WriteBufferZeroCopyTestFixture, Take_testIfTheReservationIsTakenOverOnlyOnce)
+{
+    // Given
+    struct pos_io io = MakeWrite(10, 2);
+    VirtualBlks blks = {.startVsa = {.stripeId = 1, .offset = 0}, .numBlks = 2};
+    ON_CALL(blockAllocator, AllocateWriteBufferBlks).WillByDefault(Return(std::make_pair(blks, 1)));
+    zeroCopy->GetBuffer(io);
+    std::list<VirtualBlksInfo> virtualBlks;
+
+    // Then: the ownership stays with the write
+    EXPECT_CALL(rbaStateManager, BulkReleaseOwnership).Times(0);
+    EXPECT_CALL(volumeManager, DecreasePendingIOCount).Times(1);
+
+    // When
+    bool otherRange = zeroCopy->Take(volumeId, 11, 2, io.iov[0].iov_base, virtualBlks);
+    bool taken = zeroCopy->Take(volumeId, 10, 2, io.iov[0].iov_base, virtualBlks);
+    bool takenAgain = zeroCopy->Take(volumeId, 10, 2, io.iov[0].iov_base, virtualBlks);
+
+    // Then
+    EXPECT_FALSE(otherRange);
+    EXPECT_TRUE(taken);
+    EXPECT_FALSE(takenAgain);
+    ASSERT_EQ(1U, virtualBlks.size());
+    EXPECT_EQ(blks, virtualBlks.front().first);
+    EXPECT_EQ(0U, zeroCopy->GetReservationCount());
+}
+
+TEST_F(WriteBufferZeroCopyTestFixture, PutBuffer_testIfTheBlocksOfAnAbortedWriteAreCountedAsWritten)
+{
+    // Given
+    struct pos_io io = MakeWrite(10, 2);
+    VirtualBlks blks = {.startVsa = {.stripeId = 1, .offset = 0}, .numBlks = 2};
+    ON_CALL(blockAllocator, AllocateWriteBufferBlks).WillByDefault(Return(std::make_pair(blks, 1)));
+    zeroCopy->GetBuffer(io);
+    NiceMock<MockStripe>* stripe = new NiceMock<MockStripe>();
+    StripeSmartPtr stripeSmartPtr(stripe);
+    ON_CALL(wbStripeAllocator, GetStripe(1)).WillByDefault(Return(stripeSmartPtr));
+
+    // Then
+    EXPECT_CALL(*stripe, DecreseBlksRemaining(2)).WillOnce(Return(1));
+    EXPECT_CALL(*stripe, Flush).Times(0);
+    EXPECT_CALL(rbaStateManager, BulkReleaseOwnership(volumeId, 10, 2)).Times(1);
+    EXPECT_CALL(flowControl, ReturnToken(FlowControlType::USER, 2)).Times(1);
+    EXPECT_CALL(volumeManager, DecreasePendingIOCount(volumeId, VolumeIoType::UserWrite, 1)).Times(1);
+
+    // When
+    zeroCopy->PutBuffer(io);
+
+    // Then
+    EXPECT_EQ(0U, zeroCopy->GetReservationCount());
+}
+} // namespace pos
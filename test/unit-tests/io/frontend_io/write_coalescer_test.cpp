@@ -0,0 +1,147 @@
+#include "src/io/frontend_io/write_coalescer.h"
+
+#include <gtest/gtest.h>
+
+#include "src/include/memory.h"
+#include "src/include/pos_event_id.h"
+#include "test/unit-tests/event_scheduler/callback_mock.h"
+#include "test/unit-tests/io/frontend_io/aio_mock.h"
+#include "test/unit-tests/master_context/config_manager_mock.h"
+#include "test/unit-tests/spdk_wrapper/event_framework_api_mock.h"
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::SaveArg;
+
+namespace pos
+{
+static void
+SetCoalescingConfig(NiceMock<MockConfigManager>& configManager, uint32_t maxSizeInKb)
+{
+    ON_CALL(configManager, GetValue).WillByDefault(Invoke(
+        [maxSizeInKb](string module, string key, void* value, ConfigType type)
+        {
+            if (key == "write_coalescing_enable")
+            {
+                *static_cast<bool*>(value) = true;
+            }
+            else if (key == "write_coalescing_max_size_in_kb")
+            {
+                *static_cast<uint32_t*>(value) = maxSizeInKb;
+            }
+            return EID(SUCCESS);
+        }));
+}
+
+static VolumeIoSmartPtr
+CreateWrite(char* buffer, uint32_t volumeId, uint64_t blockRba, uint32_t blockCount)
+{
+    uint32_t sectorsPerBlock = ChangeByteToSector(BLOCK_SIZE);
+    VolumeIoSmartPtr volumeIo(new VolumeIo(buffer, blockCount * sectorsPerBlock, 0));
+    volumeIo->dir = UbioDir::Write;
+    volumeIo->SetVolumeId(volumeId);
+    volumeIo->SetSectorRba(blockRba * sectorsPerBlock);
+    return volumeIo;
+}
+
+TEST(WriteCoalescer, Submit_testIfWriteIsSubmittedAtOnceWhenDisabled)
+{
+    // Given
+    NiceMock<MockConfigManager> configManager;
+    NiceMock<MockEventFrameworkApi> eventFrameworkApi;
+    NiceMock<MockAIO> aio;
+    ON_CALL(configManager, GetValue).WillByDefault(Return(EID(CONFIG_REQUEST_KEY_ERROR)));
+    WriteCoalescer coalescer(&configManager, &eventFrameworkApi, &aio);
+    char buffer[BLOCK_SIZE];
+    VolumeIoSmartPtr write = CreateWrite(buffer, 1, 0, 1);
+
+    // Then
+    EXPECT_CALL(aio, SubmitAsyncIO(write)).Times(1);
+
+    // When
+    EXPECT_FALSE(coalescer.IsEnabled());
+    coalescer.Submit(write);
+}
+
+TEST(WriteCoalescer, Flush_testIfContiguousWritesAreSubmittedAsOneAndCompletedEach)
+{
+    // Given
+    NiceMock<MockConfigManager> configManager;
+    NiceMock<MockEventFrameworkApi> eventFrameworkApi;
+    NiceMock<MockAIO> aio;
+    SetCoalescingConfig(configManager, 128);
+    WriteCoalescer coalescer(&configManager, &eventFrameworkApi, &aio);
+    char buffer[2][BLOCK_SIZE];
+    VolumeIoSmartPtr first = CreateWrite(buffer[0], 1, 10, 1);
+    VolumeIoSmartPtr second = CreateWrite(buffer[1], 1, 11, 1);
+    auto firstCallback = std::make_shared<NiceMock<MockCallback>>(true);
+    auto secondCallback = std::make_shared<NiceMock<MockCallback>>(true);
+    first->SetCallback(firstCallback);
+    second->SetCallback(secondCallback);
+
+    // When : nothing goes down until the end of the poll cycle
+    EXPECT_CALL(aio, SubmitAsyncIO).Times(0);
+    coalescer.Submit(first);
+    coalescer.Submit(second);
+
+    // Then
+    VolumeIoSmartPtr merged;
+    EXPECT_CALL(aio, SubmitAsyncIO).WillOnce(SaveArg<0>(&merged));
+    coalescer.Flush();
+    ASSERT_NE(nullptr, merged);
+    EXPECT_EQ(2 * BLOCK_SIZE, merged->GetSize());
+    EXPECT_EQ(10 * ChangeByteToSector(BLOCK_SIZE), merged->GetSectorRba());
+    EXPECT_EQ(1U, merged->GetVolumeId());
+    EXPECT_EQ(2U, coalescer.GetCoalescedCount());
+
+    // When
+    EXPECT_CALL(*firstCallback, _DoSpecificJob).WillOnce(Return(true));
+    EXPECT_CALL(*secondCallback, _DoSpecificJob).WillOnce(Return(true));
+    merged->GetCallback()->Execute();
+}
+
+TEST(WriteCoalescer, Submit_testIfRunIsSubmittedBeforeWriteThatDoesNotExtendIt)
+{
+    // Given
+    NiceMock<MockConfigManager> configManager;
+    NiceMock<MockEventFrameworkApi> eventFrameworkApi;
+    NiceMock<MockAIO> aio;
+    SetCoalescingConfig(configManager, 128);
+    WriteCoalescer coalescer(&configManager, &eventFrameworkApi, &aio);
+    char buffer[2][BLOCK_SIZE];
+    VolumeIoSmartPtr first = CreateWrite(buffer[0], 1, 10, 1);
+    VolumeIoSmartPtr other = CreateWrite(buffer[1], 1, 20, 1);
+
+    // Then : the write alone is submitted as it is, the other one waits
+    EXPECT_CALL(aio, SubmitAsyncIO(first)).Times(1);
+    EXPECT_CALL(aio, SubmitAsyncIO(other)).Times(0);
+
+    // When
+    coalescer.Submit(first);
+    coalescer.Submit(other);
+}
+
+TEST(WriteCoalescer, Submit_testIfUnalignedWriteIsNotHeld)
+{
+    // Given
+    NiceMock<MockConfigManager> configManager;
+    NiceMock<MockEventFrameworkApi> eventFrameworkApi;
+    NiceMock<MockAIO> aio;
+    SetCoalescingConfig(configManager, 128);
+    WriteCoalescer coalescer(&configManager, &eventFrameworkApi, &aio);
+    char buffer[BLOCK_SIZE];
+    VolumeIoSmartPtr partial(new VolumeIo(buffer, 1, 0));
+    partial->dir = UbioDir::Write;
+    partial->SetVolumeId(1);
+    partial->SetSectorRba(3);
+
+    // Then
+    EXPECT_CALL(aio, SubmitAsyncIO(partial)).Times(1);
+
+    // When
+    coalescer.Submit(partial);
+}
+
+} // namespace pos
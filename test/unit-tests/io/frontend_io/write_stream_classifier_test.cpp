@@ -0,0 +1,78 @@
+#include "src/io/frontend_io/write_stream_classifier.h"
+
+#include <gtest/gtest.h>
+
+#include "src/include/pos_event_id.h"
+#include "test/unit-tests/master_context/config_manager_mock.h"
+
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+static void
+SetSeparationConfig(NiceMock<MockConfigManager>& configManager, uint32_t largeWriteSizeInKb)
+{
+    ON_CALL(configManager, GetValue).WillByDefault(Invoke(
+        [largeWriteSizeInKb](string module, string key, void* value, ConfigType type)
+        {
+            if (key == "write_stream_separation_enable")
+            {
+                *static_cast<bool*>(value) = true;
+            }
+            else if (key == "write_stream_large_write_size_in_kb")
+            {
+                *static_cast<uint32_t*>(value) = largeWriteSizeInKb;
+            }
+            return EID(SUCCESS);
+        }));
+}
+
+TEST(WriteStreamClassifier, Classify_testIfWritesAreMixedWhenDisabled)
+{
+    // Given
+    NiceMock<MockConfigManager> configManager;
+    ON_CALL(configManager, GetValue).WillByDefault(Return(EID(CONFIG_REQUEST_KEY_ERROR)));
+    WriteStreamClassifier classifier(&configManager);
+
+    // When, Then
+    EXPECT_FALSE(classifier.IsEnabled());
+    EXPECT_EQ(WRITE_STREAM_MIXED, classifier.Classify(0, 1, 0, 1024));
+    EXPECT_EQ(WRITE_STREAM_MIXED, classifier.Classify(0, 1, 1024, 1));
+}
+
+TEST(WriteStreamClassifier, Classify_testIfLargeWriteIsSequential)
+{
+    // Given: large writes are 64KB or more
+    NiceMock<MockConfigManager> configManager;
+    SetSeparationConfig(configManager, 64);
+    WriteStreamClassifier classifier(&configManager);
+
+    // When, Then
+    EXPECT_TRUE(classifier.IsEnabled());
+    EXPECT_EQ(WRITE_STREAM_SEQUENTIAL, classifier.Classify(0, 1, 1000, 16));
+    EXPECT_EQ(WRITE_STREAM_RANDOM, classifier.Classify(0, 1, 5000, 15));
+}
+
+TEST(WriteStreamClassifier, Classify_testIfSmallWritesContinuingEachOtherAreSequential)
+{
+    // Given
+    NiceMock<MockConfigManager> configManager;
+    SetSeparationConfig(configManager, 128);
+    WriteStreamClassifier classifier(&configManager);
+
+    // When: the first write of the stream is not known to be sequential yet
+    EXPECT_EQ(WRITE_STREAM_RANDOM, classifier.Classify(0, 2, 100, 2));
+
+    // Then: the writes following it are, even with random writes in between
+    EXPECT_EQ(WRITE_STREAM_SEQUENTIAL, classifier.Classify(0, 2, 102, 2));
+    EXPECT_EQ(WRITE_STREAM_RANDOM, classifier.Classify(0, 2, 90000, 1));
+    EXPECT_EQ(WRITE_STREAM_SEQUENTIAL, classifier.Classify(0, 2, 104, 1));
+
+    // Then: the stream is tracked per volume and per array
+    EXPECT_EQ(WRITE_STREAM_RANDOM, classifier.Classify(0, 3, 105, 1));
+    EXPECT_EQ(WRITE_STREAM_RANDOM, classifier.Classify(1, 2, 105, 1));
+}
+
+} // namespace pos
@@ -0,0 +1,18 @@
+#include <gmock/gmock.h>
+
+#include <list>
+#include <string>
+#include <vector>
+
+#include "src/io/frontend_io/zero_block_unmap.h"
+
+namespace pos
+{
+class MockZeroBlockUnmap : public ZeroBlockUnmap
+{
+public:
+    using ZeroBlockUnmap::ZeroBlockUnmap;
+    MOCK_METHOD(bool, Execute, (), (override));
+};
+
+} // namespace pos
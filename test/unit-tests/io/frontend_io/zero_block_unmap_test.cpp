@@ -0,0 +1,88 @@
+#include "src/io/frontend_io/zero_block_unmap.h"
+
+#include <gtest/gtest.h>
+
+#include "src/include/pos_event_id.h"
+#include "test/unit-tests/allocator/i_segment_ctx_mock.h"
+#include "test/unit-tests/bio/volume_io_mock.h"
+#include "test/unit-tests/io/general_io/vsa_range_maker_mock.h"
+#include "test/unit-tests/mapper/i_vsamap_mock.h"
+#include "test/unit-tests/master_context/config_manager_mock.h"
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::ReturnRef;
+
+namespace pos
+{
+TEST(ZeroBlockUnmap, Execute_testIfBlocksAreUnmappedAndOldBlocksInvalidated)
+{
+    // Given
+    NiceMock<MockVolumeIo>* volumeIo = new NiceMock<MockVolumeIo>(nullptr, 0, 0);
+    VolumeIoSmartPtr volumeIoPtr(volumeIo);
+    NiceMock<MockIVSAMap> vsaMap;
+    NiceMock<MockISegmentCtx> segmentCtx;
+    NiceMock<MockVsaRangeMaker>* oldVsaRangeMaker = new NiceMock<MockVsaRangeMaker>(0, 0, 0, &vsaMap);
+    VirtualBlks oldRange = {.startVsa = {.stripeId = 5, .offset = 2}, .numBlks = 2};
+    ON_CALL(*volumeIo, GetVolumeId).WillByDefault(Return(1));
+    ON_CALL(*volumeIo, GetSectorRba).WillByDefault(Return(ChangeBlockToSector(10)));
+    ON_CALL(*volumeIo, GetSize).WillByDefault(Return(2 * BLOCK_SIZE));
+    ON_CALL(*oldVsaRangeMaker, GetCount).WillByDefault(Return(1));
+    ON_CALL(*oldVsaRangeMaker, GetVsaRange(0)).WillByDefault(ReturnRef(oldRange));
+    ZeroBlockUnmap zeroBlockUnmap(volumeIoPtr, &vsaMap, &segmentCtx, oldVsaRangeMaker);
+
+    // Then
+    VirtualBlks unmapRange = {.startVsa = UNMAP_VSA, .numBlks = 2};
+    EXPECT_CALL(vsaMap, SetVSAs(1, 10, unmapRange)).WillOnce(Return(0));
+    EXPECT_CALL(segmentCtx, InvalidateBlks(oldRange, false)).Times(1);
+
+    // When
+    bool result = zeroBlockUnmap.Execute();
+
+    // Then
+    EXPECT_TRUE(result);
+}
+
+TEST(ZeroBlockUnmap, Execute_testIfOldBlocksAreKeptWhenMapUpdateFails)
+{
+    // Given
+    NiceMock<MockVolumeIo>* volumeIo = new NiceMock<MockVolumeIo>(nullptr, 0, 0);
+    VolumeIoSmartPtr volumeIoPtr(volumeIo);
+    NiceMock<MockIVSAMap> vsaMap;
+    NiceMock<MockISegmentCtx> segmentCtx;
+    NiceMock<MockVsaRangeMaker>* oldVsaRangeMaker = new NiceMock<MockVsaRangeMaker>(0, 0, 0, &vsaMap);
+    ON_CALL(*volumeIo, GetSize).WillByDefault(Return(BLOCK_SIZE));
+    ON_CALL(vsaMap, SetVSAs).WillByDefault(Return(-1));
+    ZeroBlockUnmap zeroBlockUnmap(volumeIoPtr, &vsaMap, &segmentCtx, oldVsaRangeMaker);
+
+    // Then
+    EXPECT_CALL(segmentCtx, InvalidateBlks).Times(0);
+
+    // When
+    bool result = zeroBlockUnmap.Execute();
+
+    // Then
+    EXPECT_FALSE(result);
+}
+
+TEST(ZeroBlockUnmap, LoadConfig_testIfJournalKeepsUnmapDisabled)
+{
+    // Given
+    NiceMock<MockConfigManager> configManager;
+    bool journalEnabled = true;
+    ON_CALL(configManager, GetValue).WillByDefault(Invoke(
+        [&journalEnabled](string module, string key, void* value, ConfigType type)
+        {
+            *static_cast<bool*>(value) = ("journal" == module) ? journalEnabled : true;
+            return EID(SUCCESS);
+        }));
+
+    // When, Then
+    EXPECT_FALSE(ZeroBlockUnmap::LoadConfig(&configManager));
+    journalEnabled = false;
+    EXPECT_TRUE(ZeroBlockUnmap::LoadConfig(&configManager));
+}
+
+} // namespace pos
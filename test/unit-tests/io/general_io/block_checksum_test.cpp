@@ -0,0 +1,76 @@
+#include "src/io/general_io/block_checksum.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "src/include/memory.h"
+#include "src/include/pos_event_id.h"
+#include "src/mapper/reversemap/reverse_map.h"
+#include "test/unit-tests/master_context/config_manager_mock.h"
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+TEST(BlockChecksum, Compute_testIfChecksumFitsInReverseMapEntry)
+{
+    // Given
+    std::vector<uint8_t> block(BLOCK_SIZE);
+    for (uint32_t i = 0; i < BLOCK_SIZE; i++)
+    {
+        block[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    // When
+    uint32_t checksum = BlockChecksum::Compute(block.data());
+
+    // Then
+    EXPECT_LT(checksum, NO_REVMAP_CHECKSUM);
+    EXPECT_EQ(checksum, BlockChecksum::Compute(block.data()));
+}
+
+TEST(BlockChecksum, Verify_testIfFlippedBitIsDetected)
+{
+    // Given
+    std::vector<uint8_t> block(BLOCK_SIZE, 0xA5);
+    uint32_t checksum = BlockChecksum::Compute(block.data());
+
+    // When
+    block[BLOCK_SIZE / 2] ^= 0x10;
+
+    // Then
+    EXPECT_FALSE(BlockChecksum::Verify(block.data(), checksum));
+    block[BLOCK_SIZE / 2] ^= 0x10;
+    EXPECT_TRUE(BlockChecksum::Verify(block.data(), checksum));
+}
+
+TEST(BlockChecksum, LoadConfig_testIfChecksumIsDisabledByDefault)
+{
+    // Given
+    NiceMock<MockConfigManager> configManager;
+    ON_CALL(configManager, GetValue).WillByDefault(Return(EID(CONFIG_REQUEST_KEY_ERROR)));
+
+    // When, Then
+    EXPECT_FALSE(BlockChecksum::LoadConfig(&configManager));
+}
+
+TEST(BlockChecksum, LoadConfig_testIfChecksumIsEnabledByConfig)
+{
+    // Given
+    NiceMock<MockConfigManager> configManager;
+    ON_CALL(configManager, GetValue).WillByDefault(Invoke(
+        [](string module, string key, void* value, ConfigType type)
+        {
+            *static_cast<bool*>(value) = true;
+            return EID(SUCCESS);
+        }));
+
+    // When, Then
+    EXPECT_TRUE(BlockChecksum::LoadConfig(&configManager));
+}
+
+} // namespace pos
@@ -127,6 +127,30 @@ TEST(MergedIO, IsContiguous_false)
     ASSERT_EQ(expected, actual);
 }
 
+TEST(MergedIO, CanAddSegment_testIfNotContiguousOrNotNvmeDevice)
+{
+    // Given
+    char buffer[4096];
+    CallbackSmartPtr callback(new NiceMock<MockCallback>(true));
+    NiceMock<MockIArrayDevice> mockIArrayDevice;
+    ON_CALL(mockIArrayDevice, GetUblockPtr).WillByDefault(Return(nullptr));
+    PhysicalBlkAddr startAddr{0, &mockIArrayDevice};
+    PhysicalBlkAddr contiguousAddr{8, &mockIArrayDevice};
+    PhysicalBlkAddr farAddr{64, &mockIArrayDevice};
+    MergedIO mergedIO(callback);
+
+    // When : nothing is merged yet
+    // Then
+    EXPECT_FALSE(mergedIO.CanAddSegment(contiguousAddr));
+
+    // When : the block is contiguous, but no nvme device is behind it
+    mergedIO.SetNewStart(buffer, startAddr);
+
+    // Then
+    EXPECT_FALSE(mergedIO.CanAddSegment(contiguousAddr));
+    EXPECT_FALSE(mergedIO.CanAddSegment(farAddr));
+}
+
 TEST(MergedIO, Process_success)
 {
     // Given
@@ -185,4 +209,35 @@ TEST(MergedIO, Process_ExistError)
     delete mockIODispatcher;
 }
 
+TEST(MergedIO, Process_GatherUbioInsteadOfSubmit)
+{
+    // Given
+    void* buffer = Memory<SECTOR_SIZE>::Alloc(512 / SECTOR_SIZE);
+
+    CallbackSmartPtr callback(new NiceMock<MockCallback>(true));
+    NiceMock<MockIArrayDevice> mockIArrayDevice;
+    NiceMock<MockIODispatcher>* mockIODispatcher = new NiceMock<MockIODispatcher>;
+
+    PhysicalBlkAddr physicalBlkAddr{0, &mockIArrayDevice};
+    std::vector<UbioSmartPtr> ubios;
+
+    MergedIO mergedIO(callback, mockIODispatcher);
+    mergedIO.GatherInto(&ubios);
+    mergedIO.SetNewStart(buffer, physicalBlkAddr);
+
+    // Then: the ubio is kept for the caller, not submitted
+    EXPECT_CALL(*mockIODispatcher, Submit(_, _, _)).Times(0);
+
+    // When
+    IOSubmitHandlerStatus actual = mergedIO.Process(0);
+
+    EXPECT_EQ(IOSubmitHandlerStatus::SUCCESS, actual);
+    ASSERT_EQ(1U, ubios.size());
+    EXPECT_EQ(physicalBlkAddr.lba, ubios.front()->GetPba().lba);
+
+    Memory<SECTOR_SIZE>::Free(buffer);
+
+    delete mockIODispatcher;
+}
+
 } // namespace pos
@@ -0,0 +1,30 @@
+#include "src/io/general_io/parity_write_completion.h"
+
+#include <gtest/gtest.h>
+
+#include "test/unit-tests/event_scheduler/callback_mock.h"
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+TEST(ParityWriteCompletion, Execute_testIfParityWritesAreReportedAsSingleCaller)
+{
+    // Given
+    NiceMock<MockCallback>* callee = new NiceMock<MockCallback>(false);
+    CallbackSmartPtr calleePtr(callee);
+    CallbackSmartPtr parityCompletion(new ParityWriteCompletion(0));
+    parityCompletion->SetCallee(calleePtr);
+
+    // Then: the callee is informed once, whatever the number of parity writes
+    EXPECT_CALL(*callee, _RecordCallerCompletionAndCheckOkToCall(0, _, _)).WillOnce(Return(false));
+    EXPECT_CALL(*callee, _DoSpecificJob).Times(0);
+
+    // When
+    bool ret = parityCompletion->Execute();
+    EXPECT_TRUE(ret);
+}
+
+} // namespace pos
@@ -24,6 +24,7 @@ public:
     MOCK_METHOD(int, VolumeDetached, (vector<int> volList, VolumeArrayInfo* volArrayInfo), (override));
     MOCK_METHOD(int, VolumeDeleted, (VolumeEventBase* volEventBase, VolumeArrayInfo* volArrayInfo), (override));
     MOCK_METHOD(int, VolumeUnmounted, (VolumeEventBase* volEventBase, VolumeArrayInfo* volArrayInfo), (override));
+    MOCK_METHOD(int, VolumeResized, (VolumeEventBase* volEventBase, VolumeArrayInfo* volArrayInfo), (override));
 };
 
 } // namespace pos
@@ -243,4 +243,70 @@ TEST_F(RBAStateManagerFixture, VolumeEventTest)
     EXPECT_FALSE(rbaStateManager->BulkAcquireOwnership(VOLUME_ID, 0, RBA_AMOUNT));
 }
 
+TEST_F(RBAStateManagerFixture, BulkAcquireOwnership_testIfConflictInLaterWordRollsBackEarlierWords)
+{
+    //Given: rba 70 (third word of the packed owner bitmap) is already owned
+    rbaStateManager->CreateRBAState(VOLUME_ID, RBA_AMOUNT);
+    EXPECT_TRUE(rbaStateManager->BulkAcquireOwnership(VOLUME_ID, 70, 1));
+
+    //When: try to acquire a range spanning three words that overlaps rba 70
+    //Then: returns failure
+    EXPECT_FALSE(rbaStateManager->BulkAcquireOwnership(VOLUME_ID, 10, 100));
+
+    //Then: the words acquired before the conflict have been rolled back
+    EXPECT_TRUE(rbaStateManager->BulkAcquireOwnership(VOLUME_ID, 10, 60));
+    EXPECT_TRUE(rbaStateManager->BulkAcquireOwnership(VOLUME_ID, 71, 39));
+}
+
+TEST_F(RBAStateManagerFixture, GrowRBAState_testIfOwnershipIsKeptAcrossGrowAndNewRbasBecomeAccessible)
+{
+    //Given: the last rba of the volume is owned
+    rbaStateManager->CreateRBAState(VOLUME_ID, RBA_AMOUNT);
+    EXPECT_TRUE(rbaStateManager->BulkAcquireOwnership(VOLUME_ID, RBA_AMOUNT - 1, 1));
+    EXPECT_FALSE(rbaStateManager->BulkAcquireOwnership(VOLUME_ID, RBA_AMOUNT, 1));
+
+    //When: grow over several chunks of owner words
+    uint64_t grownRbaAmount = RBA_AMOUNT * 100;
+    VolumeEventBase volumeEventBase;
+    volumeEventBase.volId = VOLUME_ID;
+    volumeEventBase.volSizeByte = ChangeBlockToByte(grownRbaAmount);
+    VolumeArrayInfo volumeArrayInfo;
+    EXPECT_EQ(EID(VOL_EVENT_OK), rbaStateManager->VolumeResized(&volumeEventBase, &volumeArrayInfo));
+
+    //Then: the owner taken before the grow is kept, and the new rbas can be acquired
+    EXPECT_FALSE(rbaStateManager->BulkAcquireOwnership(VOLUME_ID, RBA_AMOUNT - 1, 1));
+    EXPECT_TRUE(rbaStateManager->BulkAcquireOwnership(VOLUME_ID, RBA_AMOUNT, 1));
+    EXPECT_TRUE(rbaStateManager->BulkAcquireOwnership(VOLUME_ID, grownRbaAmount - 100, 100));
+    EXPECT_FALSE(rbaStateManager->BulkAcquireOwnership(VOLUME_ID, grownRbaAmount, 1));
+
+    //When: shrink is requested
+    rbaStateManager->GrowRBAState(VOLUME_ID, RBA_AMOUNT);
+    //Then: nothing changes
+    EXPECT_FALSE(rbaStateManager->BulkAcquireOwnership(VOLUME_ID, grownRbaAmount - 1, 1));
+    EXPECT_TRUE(rbaStateManager->BulkAcquireOwnership(VOLUME_ID, grownRbaAmount - 101, 1));
+}
+
+TEST_F(RBAStateManagerFixture, GetOwner_testIfOwnerIsKeptPerRbaInPackedWord)
+{
+    //Given: neighbour rbas in the same word are owned by HOST and GC respectively
+    rbaStateManager->CreateRBAState(VOLUME_ID, RBA_AMOUNT);
+    EXPECT_TRUE(rbaStateManager->BulkAcquireOwnership(VOLUME_ID, 32, 1));
+    VolumeIo::RbaList gcRbas{{ChangeBlockToSector(33), ChangeBlockToByte(1)}};
+    uint32_t acqCount = 0;
+    rbaStateManager->AcquireOwnershipRbaList(VOLUME_ID, gcRbas, gcRbas.begin(), acqCount);
+    EXPECT_EQ(1, acqCount);
+
+    //When & Then
+    EXPECT_EQ(RBAOwnerType::HOST, rbaStateManager->GetOwner(VOLUME_ID, {ChangeBlockToSector(32), ChangeBlockToByte(1)}));
+    EXPECT_EQ(RBAOwnerType::GC, rbaStateManager->GetOwner(VOLUME_ID, {ChangeBlockToSector(33), ChangeBlockToByte(1)}));
+    EXPECT_EQ(RBAOwnerType::NoOwner, rbaStateManager->GetOwner(VOLUME_ID, {ChangeBlockToSector(34), ChangeBlockToByte(1)}));
+
+    //When: release gc rba only
+    rbaStateManager->ReleaseOwnershipRbaList(VOLUME_ID, gcRbas);
+
+    //Then
+    EXPECT_EQ(RBAOwnerType::HOST, rbaStateManager->GetOwner(VOLUME_ID, {ChangeBlockToSector(32), ChangeBlockToByte(1)}));
+    EXPECT_EQ(RBAOwnerType::NoOwner, rbaStateManager->GetOwner(VOLUME_ID, {ChangeBlockToSector(33), ChangeBlockToByte(1)}));
+}
+
 } // namespace pos
\ No newline at end of file
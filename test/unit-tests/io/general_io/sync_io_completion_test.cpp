@@ -1,15 +0,0 @@
-#include "src/io/general_io/sync_io_completion.h"
-
-#include <gtest/gtest.h>
-
-namespace pos
-{
-TEST(SyncIoCompletion, SyncIoCompletion_)
-{
-}
-
-TEST(SyncIoCompletion, _DoSpecificJob_)
-{
-}
-
-} // namespace pos
@@ -20,6 +20,9 @@ public:
     MOCK_METHOD(bool, IsUnmapped, (), (override));
     MOCK_METHOD(bool, IsMapped, (), (override));
     MOCK_METHOD(VirtualBlkAddr, GetVsa, (uint32_t blockIndex), (override));
+    MOCK_METHOD(uint32_t, GetVsaExtentCount, (), (override));
+    MOCK_METHOD(VirtualBlks, GetVsaExtent, (uint32_t extentIndex), (override));
+    MOCK_METHOD(PhysicalEntryArray, GetPhysicalEntriesOfBlocks, (uint32_t blockIndex, uint32_t numBlks), (override));
 };
 
 } // namespace pos
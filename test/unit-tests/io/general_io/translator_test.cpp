@@ -38,16 +38,16 @@ public:
     SetUp(void)
     {
         mockIVSAMap = new NiceMock<MockIVSAMap>;
-        ON_CALL(*mockIVSAMap, GetVSAs(_, _, _, _)).WillByDefault([](int volumeId, BlkAddr startRba, uint32_t numBlks, VsaArray& vsaArray) {
+        ON_CALL(*mockIVSAMap, GetVsaExtents(_, _, _, _, _)).WillByDefault([](int volumeId, BlkAddr startRba, uint32_t numBlks, VsaExtentArray& extents, uint32_t& numExtents) {
             if (startRba <= 1)
             {
-                vsaArray[0] = {.stripeId = 0, .offset = 0};
-                vsaArray[1] = {.stripeId = 0, .offset = 1};
+                extents[0] = {.startVsa = {.stripeId = 0, .offset = 0}, .numBlks = std::min(numBlks, 2U)};
             }
             else
             {
-                vsaArray[0] = UNMAP_VSA;
+                extents[0] = {.startVsa = UNMAP_VSA, .numBlks = numBlks};
             }
+            numExtents = 1;
             return 0;
         });
         ON_CALL(*mockIVSAMap, GetRandomVSA(_)).WillByDefault(Return(vsa));
@@ -68,6 +68,11 @@ public:
             dst = tmpPWEs;
             return 0;
         });
+        ON_CALL(*mockITranslator, TranslateForRead(arrayId, _, _, _)).WillByDefault([tmpPWEs](unsigned int arrayIndex, PartitionType part, list<PhysicalEntry>& dst, const LogicalEntry& src)
+        {
+            dst = tmpPWEs;
+            return 0;
+        });
     }
 
     virtual void
@@ -230,13 +235,39 @@ TEST_F(TranslatorTestFixture, GetPhysicalEntries)
     EXPECT_EQ(actual.size(), 1);
 
     //Given: make the conversion return fail
-    ON_CALL(*mockITranslator, Translate(arrayId, _, _, _)).WillByDefault(Return(-1));
+    ON_CALL(*mockITranslator, TranslateForRead(arrayId, _, _, _)).WillByDefault(Return(-1));
 
     //When: get physical entries
     //Then: exception is thrown
     EXPECT_THROW(translator.GetPhysicalEntries(nullptr, 0), POS_EVENT_ID);
 }
 
+TEST_F(TranslatorTestFixture, GetVsaExtent_testIfContiguousBlocksAreReturnedAsOneExtent)
+{
+    //When: translate two blocks mapped to contiguous VSAs
+    Translator translator(0, 0, 2, 0, true, mockIVSAMap, mockIStripeMap, mockWBAllocator, mockITranslator, &mockVolumeInfoManager);
+
+    //Then: one extent covers both blocks and per-block VSAs are expanded from it
+    EXPECT_EQ(1, translator.GetVsaExtentCount());
+    VirtualBlks extent = translator.GetVsaExtent(0);
+    EXPECT_EQ(0, extent.startVsa.stripeId);
+    EXPECT_EQ(0, extent.startVsa.offset);
+    EXPECT_EQ(2, extent.numBlks);
+    EXPECT_EQ(1, translator.GetVsa(1).offset);
+    EXPECT_EQ(0, translator.GetVsaExtent(1).numBlks);
+}
+
+TEST_F(TranslatorTestFixture, GetPhysicalEntriesOfBlocks_testIfExtentIsTranslatedOnce)
+{
+    //Given
+    Translator translator(0, 0, 2, 0, true, mockIVSAMap, mockIStripeMap, mockWBAllocator, mockITranslator, &mockVolumeInfoManager);
+
+    //Then: the whole extent is translated by a single request for read
+    EXPECT_CALL(*mockITranslator, TranslateForRead(arrayId, _, _, _)).Times(1);
+    PhysicalEntryArray entries = translator.GetPhysicalEntriesOfBlocks(0, 2);
+    EXPECT_EQ(1, entries.count);
+}
+
 TEST_F(TranslatorTestFixture, IsMapped)
 {
     //When: translate to a mapped VSA
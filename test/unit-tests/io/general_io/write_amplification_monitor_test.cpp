@@ -0,0 +1,111 @@
+#include "src/io/general_io/write_amplification_monitor.h"
+
+#include <gtest/gtest.h>
+
+#include "src/io/general_io/write_amplification_monitor_service.h"
+#include "test/unit-tests/array_models/interface/i_array_info_mock.h"
+#include "test/unit-tests/telemetry/telemetry_client/telemetry_publisher_mock.h"
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+static const uint64_t MB = 1ULL << 20;
+
+TEST(WriteAmplificationMonitor, Add_testIfHostBytesAreAddedOncePerBatch)
+{
+    // Given
+    NiceMock<MockIArrayInfo> arrayInfo;
+    ON_CALL(arrayInfo, GetIndex).WillByDefault(Return(1));
+    WriteAmplificationMonitor monitor(&arrayInfo, nullptr, new NiceMock<MockTelemetryPublisher>());
+    uint64_t batchBytes = static_cast<uint64_t>(WriteAmplificationMonitor::HOST_BATCH_BYTES);
+
+    // When
+    monitor.Add(WriteSource::Host, batchBytes / 2);
+
+    // Then
+    EXPECT_EQ(0, monitor.GetBytes(WriteSource::Host));
+
+    // When
+    monitor.Add(WriteSource::Host, batchBytes / 2);
+
+    // Then
+    EXPECT_EQ(batchBytes, monitor.GetBytes(WriteSource::Host));
+}
+
+TEST(WriteAmplificationMonitor, GetWriteAmplificationX100_testIfJournalBytesAreNotCountedTwice)
+{
+    // Given
+    NiceMock<MockIArrayInfo> arrayInfo;
+    ON_CALL(arrayInfo, GetIndex).WillByDefault(Return(0));
+    WriteAmplificationMonitor monitor(&arrayInfo, nullptr, new NiceMock<MockTelemetryPublisher>());
+    EXPECT_EQ(0, monitor.GetWriteAmplificationX100());
+
+    // When
+    monitor.Add(WriteSource::Host, 4 * MB);
+    monitor.Add(WriteSource::Flush, 4 * MB);
+    monitor.Add(WriteSource::Gc, 2 * MB);
+    monitor.Add(WriteSource::Parity, 1 * MB);
+    monitor.Add(WriteSource::Journal, 1 * MB);
+    monitor.Add(WriteSource::Meta, 1 * MB);
+
+    // Then
+    EXPECT_EQ(1 * MB, monitor.GetBytes(WriteSource::Journal));
+    EXPECT_EQ(200, monitor.GetWriteAmplificationX100());
+}
+
+TEST(WriteAmplificationMonitor, GetGcEfficiencyPercent_testIfShareOfHostStripesIsReturned)
+{
+    // Given
+    NiceMock<MockIArrayInfo> arrayInfo;
+    WriteAmplificationMonitor monitor(&arrayInfo, nullptr, new NiceMock<MockTelemetryPublisher>());
+    EXPECT_EQ(100, monitor.GetGcEfficiencyPercent());
+
+    // When
+    monitor.Add(WriteSource::Flush, 3 * MB);
+    monitor.Add(WriteSource::Gc, 1 * MB);
+
+    // Then
+    EXPECT_EQ(75, monitor.GetGcEfficiencyPercent());
+}
+
+TEST(WriteAmplificationMonitor, Add_testIfMetricsArePublishedEveryIntervalOfStripes)
+{
+    // Given
+    NiceMock<MockIArrayInfo> arrayInfo;
+    NiceMock<MockTelemetryPublisher>* publisher = new NiceMock<MockTelemetryPublisher>();
+    WriteAmplificationMonitor monitor(&arrayInfo, nullptr, publisher);
+    uint32_t interval = static_cast<uint32_t>(WriteAmplificationMonitor::PUBLISH_INTERVAL);
+
+    // Then: a counter per source, the write amplification and the gc efficiency
+    EXPECT_CALL(*publisher, PublishMetric).Times(static_cast<int>(WriteSource::Count) + 2);
+
+    // When
+    for (uint32_t stripe = 0; stripe < interval; stripe++)
+    {
+        monitor.Add(WriteSource::Parity, MB);
+        monitor.Add(stripe % 2 ? WriteSource::Gc : WriteSource::Flush, MB);
+    }
+}
+
+TEST(WriteAmplificationMonitorService, Add_testIfBytesAreIgnoredForUnregisteredArray)
+{
+    // Given
+    NiceMock<MockIArrayInfo> arrayInfo;
+    ON_CALL(arrayInfo, GetIndex).WillByDefault(Return(0));
+    WriteAmplificationMonitor monitor(&arrayInfo, nullptr, new NiceMock<MockTelemetryPublisher>());
+    WriteAmplificationMonitorService service;
+
+    // When
+    service.Add(0, WriteSource::Flush, MB);
+    service.Register(0, &monitor);
+    service.Add(0, WriteSource::Flush, MB);
+    service.Add(ArrayMgmtPolicy::MAX_ARRAY_CNT, WriteSource::Flush, MB);
+
+    // Then
+    EXPECT_EQ(MB, monitor.GetBytes(WriteSource::Flush));
+    service.Unregister(0);
+}
+} // namespace pos
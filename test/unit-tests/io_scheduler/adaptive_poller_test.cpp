@@ -0,0 +1,111 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io_scheduler/adaptive_poller.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "test/unit-tests/telemetry/telemetry_client/easy_telemetry_publisher_mock.h"
+
+using ::testing::_;
+using ::testing::NiceMock;
+
+namespace pos
+{
+TEST(AdaptivePoller, Poll_testIfSleepTimeIsKeptMinimumUntilThreshold)
+{
+    // Given
+    NiceMock<MockEasyTelemetryPublisher> telemetryPublisher;
+    AdaptivePoller poller(64, "test", 3, &telemetryPublisher);
+
+    // When
+    for (int round = 0; round < 3; round++)
+    {
+        poller.Poll(true);
+    }
+
+    // Then
+    EXPECT_EQ(1, poller.GetSleepTime());
+    EXPECT_EQ(0, poller.GetTotalSleepTime());
+}
+
+TEST(AdaptivePoller, Poll_testIfSleepTimeGrowsExponentiallyUpToMax)
+{
+    // Given
+    NiceMock<MockEasyTelemetryPublisher> telemetryPublisher;
+    AdaptivePoller poller(8, "test", 0, &telemetryPublisher);
+
+    // When, Then
+    poller.Poll(true);
+    EXPECT_EQ(2, poller.GetSleepTime());
+    poller.Poll(true);
+    EXPECT_EQ(4, poller.GetSleepTime());
+    poller.Poll(true);
+    EXPECT_EQ(8, poller.GetSleepTime());
+    poller.Poll(true);
+    EXPECT_EQ(8, poller.GetSleepTime());
+    EXPECT_EQ(2 + 4 + 8 + 8, poller.GetTotalSleepTime());
+}
+
+TEST(AdaptivePoller, Poll_testIfBusyRoundGoesBackToTightPolling)
+{
+    // Given
+    NiceMock<MockEasyTelemetryPublisher> telemetryPublisher;
+    AdaptivePoller poller(8, "test", 0, &telemetryPublisher);
+    poller.Poll(true);
+    poller.Poll(true);
+
+    // When
+    EXPECT_CALL(telemetryPublisher, UpdateGauge(_, 1, _)).Times(1);
+    poller.Poll(false);
+
+    // Then
+    EXPECT_EQ(1, poller.GetSleepTime());
+}
+
+TEST(AdaptivePoller, Wakeup_testIfWakeupGoesBackToTightPolling)
+{
+    // Given
+    NiceMock<MockEasyTelemetryPublisher> telemetryPublisher;
+    AdaptivePoller poller(8, "test", 0, &telemetryPublisher);
+    poller.Poll(true);
+
+    // When
+    poller.Wakeup();
+    poller.Poll(true);
+
+    // Then
+    EXPECT_EQ(1, poller.GetSleepTime());
+}
+
+} // namespace pos
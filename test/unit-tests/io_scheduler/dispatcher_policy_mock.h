@@ -13,6 +13,7 @@ class MockDispatcherPolicyI : public DispatcherPolicyI
 public:
     using DispatcherPolicyI::DispatcherPolicyI;
     MOCK_METHOD(void, Submit, (IOWorker * ioWorker, UbioSmartPtr ubio), (override));
+    MOCK_METHOD(void, SubmitBatch, (IOWorker * ioWorker, std::vector<UbioSmartPtr>& ubios), (override));
     MOCK_METHOD(void, Process, (), (override));
 };
 
@@ -21,6 +22,7 @@ class MockDispatcherPolicyDirect : public DispatcherPolicyDirect
 public:
     using DispatcherPolicyDirect::DispatcherPolicyDirect;
     MOCK_METHOD(void, Submit, (IOWorker * ioWorker, UbioSmartPtr ubio), (override));
+    MOCK_METHOD(void, SubmitBatch, (IOWorker * ioWorker, std::vector<UbioSmartPtr>& ubios), (override));
     MOCK_METHOD(void, Process, (), (override));
 };
 
@@ -29,6 +31,7 @@ class MockDispatcherPolicyQos : public DispatcherPolicyQos
 public:
     using DispatcherPolicyQos::DispatcherPolicyQos;
     MOCK_METHOD(void, Submit, (IOWorker * ioWorker, UbioSmartPtr ubio), (override));
+    MOCK_METHOD(void, SubmitBatch, (IOWorker * ioWorker, std::vector<UbioSmartPtr>& ubios), (override));
     MOCK_METHOD(void, Process, (), (override));
 };
 
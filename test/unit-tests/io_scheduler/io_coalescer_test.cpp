@@ -0,0 +1,183 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io_scheduler/io_coalescer.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "src/include/memory.h"
+#include "test/unit-tests/device/base/ublock_device_mock.h"
+#include "test/unit-tests/event_scheduler/callback_mock.h"
+#include "test/unit-tests/telemetry/telemetry_client/easy_telemetry_publisher_mock.h"
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+static const uint32_t TEST_MAX_COALESCED_SIZE = 4 * BLOCK_SIZE;
+
+static UbioSmartPtr
+CreateTestUbio(void* buffer, uint64_t lba, UblockSharedPtr device, UbioDir dir = UbioDir::Write)
+{
+    UbioSmartPtr ubio(new Ubio(buffer, Ubio::UNITS_PER_BLOCK, 0));
+    ubio->dir = dir;
+    ubio->SetLba(lba);
+    ubio->SetUblock(device);
+    ubio->SetCallback(CallbackSmartPtr(new NiceMock<MockCallback>(true)));
+    return ubio;
+}
+
+static std::shared_ptr<NiceMock<MockUBlockDevice>>
+CreateTestDevice(DeviceType type)
+{
+    auto device = std::make_shared<NiceMock<MockUBlockDevice>>("test", 0, nullptr);
+    ON_CALL(*device, GetType).WillByDefault(Return(type));
+    return device;
+}
+
+TEST(IOCoalescer, Flush_testIfNullIsReturnedWhenNothingIsPending)
+{
+    // Given
+    NiceMock<MockEasyTelemetryPublisher> telemetryPublisher;
+    IOCoalescer coalescer(TEST_MAX_COALESCED_SIZE, &telemetryPublisher);
+
+    // When
+    UbioSmartPtr ubio = coalescer.Flush();
+
+    // Then
+    EXPECT_EQ(nullptr, ubio);
+}
+
+TEST(IOCoalescer, Flush_testIfSingleUbioIsReturnedAsItIs)
+{
+    // Given
+    NiceMock<MockEasyTelemetryPublisher> telemetryPublisher;
+    IOCoalescer coalescer(TEST_MAX_COALESCED_SIZE, &telemetryPublisher);
+    auto device = CreateTestDevice(DeviceType::SSD);
+    void* buffer = Memory<BLOCK_SIZE>::Alloc(1);
+    UbioSmartPtr ubio = CreateTestUbio(buffer, 0, device);
+
+    // When
+    EXPECT_TRUE(coalescer.Add(ubio));
+    UbioSmartPtr flushed = coalescer.Flush();
+
+    // Then
+    EXPECT_EQ(ubio, flushed);
+    EXPECT_EQ(0, coalescer.GetCoalescedCommandCount());
+    Memory<BLOCK_SIZE>::Free(buffer);
+}
+
+TEST(IOCoalescer, Flush_testIfAdjacentUbiosAreMergedIntoVectoredUbio)
+{
+    // Given
+    NiceMock<MockEasyTelemetryPublisher> telemetryPublisher;
+    IOCoalescer coalescer(TEST_MAX_COALESCED_SIZE, &telemetryPublisher);
+    auto device = CreateTestDevice(DeviceType::SSD);
+    void* first = Memory<BLOCK_SIZE>::Alloc(1);
+    void* second = Memory<BLOCK_SIZE>::Alloc(1);
+
+    // When
+    EXPECT_TRUE(coalescer.Add(CreateTestUbio(first, 0, device)));
+    EXPECT_TRUE(coalescer.Add(CreateTestUbio(second, Ubio::UNITS_PER_BLOCK, device)));
+    UbioSmartPtr merged = coalescer.Flush();
+
+    // Then
+    ASSERT_NE(nullptr, merged);
+    EXPECT_TRUE(merged->IsVectored());
+    EXPECT_EQ(2 * BLOCK_SIZE, merged->GetSize());
+    EXPECT_EQ(0, merged->GetLba());
+    EXPECT_EQ(UbioDir::Write, merged->dir);
+    EXPECT_EQ(device.get(), merged->GetUBlock());
+    EXPECT_EQ(second, merged->GetBuffer(1, 0));
+    EXPECT_EQ(2, coalescer.GetCoalescedUbioCount());
+    EXPECT_EQ(1, coalescer.GetCoalescedCommandCount());
+    EXPECT_EQ(nullptr, coalescer.Flush());
+    Memory<BLOCK_SIZE>::Free(first);
+    Memory<BLOCK_SIZE>::Free(second);
+}
+
+TEST(IOCoalescer, Add_testIfNotAdjacentUbiosAreRejected)
+{
+    // Given
+    NiceMock<MockEasyTelemetryPublisher> telemetryPublisher;
+    IOCoalescer coalescer(TEST_MAX_COALESCED_SIZE, &telemetryPublisher);
+    auto device = CreateTestDevice(DeviceType::SSD);
+    auto otherDevice = CreateTestDevice(DeviceType::SSD);
+    void* buffer = Memory<BLOCK_SIZE>::Alloc(1);
+    EXPECT_TRUE(coalescer.Add(CreateTestUbio(buffer, 0, device)));
+
+    // When, Then : not lba-adjacent, other device and other direction
+    EXPECT_FALSE(coalescer.Add(CreateTestUbio(buffer, 2 * Ubio::UNITS_PER_BLOCK, device)));
+    EXPECT_FALSE(coalescer.Add(CreateTestUbio(buffer, Ubio::UNITS_PER_BLOCK, otherDevice)));
+    EXPECT_FALSE(coalescer.Add(CreateTestUbio(buffer, Ubio::UNITS_PER_BLOCK, device, UbioDir::Read)));
+    Memory<BLOCK_SIZE>::Free(buffer);
+}
+
+TEST(IOCoalescer, Add_testIfSizeIsLimited)
+{
+    // Given
+    NiceMock<MockEasyTelemetryPublisher> telemetryPublisher;
+    IOCoalescer coalescer(2 * BLOCK_SIZE, &telemetryPublisher);
+    auto device = CreateTestDevice(DeviceType::SSD);
+    void* buffer = Memory<BLOCK_SIZE>::Alloc(1);
+
+    // When
+    EXPECT_TRUE(coalescer.Add(CreateTestUbio(buffer, 0, device)));
+    EXPECT_TRUE(coalescer.Add(CreateTestUbio(buffer, Ubio::UNITS_PER_BLOCK, device)));
+
+    // Then
+    EXPECT_FALSE(coalescer.Add(CreateTestUbio(buffer, 2 * Ubio::UNITS_PER_BLOCK, device)));
+    Memory<BLOCK_SIZE>::Free(buffer);
+}
+
+TEST(IOCoalescer, Add_testIfUbioOfUramOrSyncModeIsNotCoalesced)
+{
+    // Given
+    NiceMock<MockEasyTelemetryPublisher> telemetryPublisher;
+    IOCoalescer coalescer(TEST_MAX_COALESCED_SIZE, &telemetryPublisher);
+    auto uram = CreateTestDevice(DeviceType::NVRAM);
+    auto device = CreateTestDevice(DeviceType::SSD);
+    void* buffer = Memory<BLOCK_SIZE>::Alloc(1);
+    UbioSmartPtr syncUbio = CreateTestUbio(buffer, 0, device);
+    syncUbio->SetSyncMode();
+
+    // When, Then
+    EXPECT_FALSE(coalescer.Add(CreateTestUbio(buffer, 0, uram)));
+    EXPECT_FALSE(coalescer.Add(syncUbio));
+    EXPECT_EQ(nullptr, coalescer.Flush());
+    Memory<BLOCK_SIZE>::Free(buffer);
+}
+
+} // namespace pos
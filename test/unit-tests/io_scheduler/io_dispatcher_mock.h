@@ -19,6 +19,7 @@ public:
     MOCK_METHOD(void, AddDeviceForIOWorker, (UblockSharedPtr dev, cpu_set_t cpuSet), (override));
     MOCK_METHOD(void, RemoveDeviceForIOWorker, (UblockSharedPtr dev), (override));
     MOCK_METHOD(int, Submit, (UbioSmartPtr ubio, bool sync, bool ioRecoveryNeeded), (override));
+    MOCK_METHOD(int, SubmitBatch, (std::vector<UbioSmartPtr>& ubios), (override));
 };
 
 } // namespace pos
@@ -86,6 +86,23 @@ TEST(IOQueue, EnqueueUbio_InputUbio)
     EXPECT_EQ(1, ioQueue.GetQueueSize());
 }
 
+TEST(IOQueue, EnqueueUbios_SkipNullptr)
+{
+    // Given: IOQueue, two ubios and a nullptr
+    IOQueue ioQueue;
+    auto ubio1 = std::make_shared<Ubio>(nullptr, 0, 0);
+    auto ubio2 = std::make_shared<Ubio>(nullptr, 0, 0);
+    std::vector<UbioSmartPtr> ubios = {ubio1, nullptr, ubio2};
+
+    // When: Call EnqueueUbios
+    ioQueue.EnqueueUbios(ubios);
+
+    // Then: Expect the ubios to be queued in order without the nullptr
+    EXPECT_EQ(2, ioQueue.GetQueueSize());
+    EXPECT_EQ(ubio1.get(), ioQueue.DequeueUbio().get());
+    EXPECT_EQ(ubio2.get(), ioQueue.DequeueUbio().get());
+}
+
 TEST(IOQueue, DequeueUbio_EmptyQueue)
 {
     // Given: IOQueue
@@ -135,4 +135,18 @@ TEST(IoWorkerDeviceOperation, GetCommand_SimpleCall)
     EXPECT_EQ(actual, expected);
 }
 
+TEST(IoWorkerDeviceOperation, SetFailed_SimpleCall)
+{
+    // Given: IoWorkerDeviceOperation
+    IoWorkerDeviceOperation ioWorkerDeviceOperation {IoWorkerDeviceOperationType::MIGRATE_IN, nullptr};
+    EXPECT_TRUE(ioWorkerDeviceOperation.IsSucceeded());
+
+    // When: Call SetFailed
+    ioWorkerDeviceOperation.SetFailed();
+    ioWorkerDeviceOperation.SetDone();
+
+    // Then: Expect to be failed
+    EXPECT_FALSE(ioWorkerDeviceOperation.IsSucceeded());
+}
+
 } // namespace pos
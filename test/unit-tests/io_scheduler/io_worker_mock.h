@@ -45,7 +45,9 @@ class MockIOWorker : public IOWorker
 public:
     using IOWorker::IOWorker;
     MOCK_METHOD(void, EnqueueUbio, (UbioSmartPtr), (override));
+    MOCK_METHOD(void, EnqueueUbios, (std::vector<UbioSmartPtr>&), (override));
     MOCK_METHOD(uint32_t, RemoveDevice, (UblockSharedPtr), (override));
+    MOCK_METHOD(bool, MigrateDeviceIn, (UblockSharedPtr), (override));
     MOCK_METHOD(void, DecreaseCurrentOutstandingIoCount, (int count), (override));
 };
 
@@ -0,0 +1,131 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io_scheduler/io_worker_rebalancer.h"
+
+#include <gtest/gtest.h>
+
+namespace pos
+{
+static const uint32_t TEST_IMBALANCE_PERCENT = 20;
+
+TEST(IOWorkerRebalancer, PickMigration_testIfDeviceMovesFromBusyWorkerToIdleWorker)
+{
+    // Given: worker 0 has two busy devices, worker 1 has none
+    std::vector<IOWorkerLoad> workers = {{0, 0}, {0, 0}};
+    std::vector<DeviceLoad> devices = {
+        {0, 1000, 0, {0, 1}},
+        {0, 1000, 0, {0, 1}}};
+    uint32_t deviceIndex = 0, workerIndex = 0;
+
+    // When
+    bool ret = IOWorkerRebalancer::PickMigration(workers, devices,
+        TEST_IMBALANCE_PERCENT, deviceIndex, workerIndex);
+
+    // Then
+    EXPECT_TRUE(ret);
+    EXPECT_EQ(1, workerIndex);
+    EXPECT_EQ(2000, workers[0].load);
+}
+
+TEST(IOWorkerRebalancer, PickMigration_testIfBalancedWorkersAreLeftAsIs)
+{
+    // Given
+    std::vector<IOWorkerLoad> workers = {{0, 0}, {0, 0}};
+    std::vector<DeviceLoad> devices = {
+        {0, 1000, 0, {0, 1}},
+        {0, 900, 0, {0, 1}},
+        {0, 1000, 1, {0, 1}},
+        {0, 1000, 1, {0, 1}}};
+    uint32_t deviceIndex = 0, workerIndex = 0;
+
+    // When
+    bool ret = IOWorkerRebalancer::PickMigration(workers, devices,
+        TEST_IMBALANCE_PERCENT, deviceIndex, workerIndex);
+
+    // Then
+    EXPECT_FALSE(ret);
+}
+
+TEST(IOWorkerRebalancer, PickMigration_testIfWorkerWithSingleDeviceIsLeftAsIs)
+{
+    // Given
+    std::vector<IOWorkerLoad> workers = {{0, 0}, {0, 0}};
+    std::vector<DeviceLoad> devices = {{0, 1000, 0, {0, 1}}};
+    uint32_t deviceIndex = 0, workerIndex = 0;
+
+    // When
+    bool ret = IOWorkerRebalancer::PickMigration(workers, devices,
+        TEST_IMBALANCE_PERCENT, deviceIndex, workerIndex);
+
+    // Then
+    EXPECT_FALSE(ret);
+}
+
+TEST(IOWorkerRebalancer, PickMigration_testIfWorkerOnSameNumaIsPreferred)
+{
+    // Given: worker 1 is idle on the other numa node, worker 2 is less busy on the same one
+    std::vector<IOWorkerLoad> workers = {{0, 0}, {1, 0}, {0, 0}};
+    std::vector<DeviceLoad> devices = {
+        {0, 1000, 0, {0, 1, 2}},
+        {0, 1000, 0, {0, 1, 2}},
+        {0, 1000, 0, {0, 1, 2}},
+        {0, 500, 2, {0, 1, 2}}};
+    uint32_t deviceIndex = 0, workerIndex = 0;
+
+    // When
+    bool ret = IOWorkerRebalancer::PickMigration(workers, devices,
+        TEST_IMBALANCE_PERCENT, deviceIndex, workerIndex);
+
+    // Then
+    EXPECT_TRUE(ret);
+    EXPECT_EQ(2, workerIndex);
+}
+
+TEST(IOWorkerRebalancer, PickMigration_testIfDeviceMovesOnlyToItsCandidates)
+{
+    // Given
+    std::vector<IOWorkerLoad> workers = {{0, 0}, {0, 0}, {0, 0}};
+    std::vector<DeviceLoad> devices = {
+        {IOWorkerRebalancer::UNKNOWN_NUMA, 1000, 0, {0, 2}},
+        {IOWorkerRebalancer::UNKNOWN_NUMA, 1000, 0, {0, 2}},
+        {IOWorkerRebalancer::UNKNOWN_NUMA, 1000, 2, {0, 2}}};
+    uint32_t deviceIndex = 0, workerIndex = 0;
+
+    // When
+    bool ret = IOWorkerRebalancer::PickMigration(workers, devices,
+        TEST_IMBALANCE_PERCENT, deviceIndex, workerIndex);
+
+    // Then: worker 1 would help, but the devices are not allowed to it
+    EXPECT_FALSE(ret);
+}
+} // namespace pos
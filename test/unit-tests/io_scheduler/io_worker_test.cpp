@@ -136,6 +136,30 @@ TEST(IOWorker, EnqueueUbio_InputNullptr)
     // Then: Do nothing
 }
 
+TEST(IOWorker, EnqueueUbios_CountEveryUbioOnce)
+{
+    // Given: cpu_set_t, IOWorker, MockQosManager, two ubios and a nullptr
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(1, &cpuSet);
+    NiceMock<MockQosManager> mockQosManager;
+    ON_CALL(mockQosManager, IOWorkerPoller(_, _)).WillByDefault(Return(0));
+    ON_CALL(mockQosManager, HandleEventUbioSubmission(_, _, _, _)).WillByDefault(Return());
+    NiceMock<MockEventScheduler> mockEventScheduler;
+    ON_CALL(mockEventScheduler, IoDequeued(_, _)).WillByDefault(Return());
+    IOWorker ioWorker{cpuSet, 0, nullptr, &mockQosManager, &mockEventScheduler};
+    std::vector<UbioSmartPtr> ubios;
+    ubios.push_back(std::make_shared<Ubio>(nullptr, 0, 0));
+    ubios.push_back(nullptr);
+    ubios.push_back(std::make_shared<Ubio>(nullptr, 0, 0));
+
+    // Then: Expect the ubios but the nullptr to be counted as enqueued
+    EXPECT_CALL(mockEventScheduler, IoEnqueued(_, _)).Times(2);
+
+    // When: Call EnqueueUbios
+    ioWorker.EnqueueUbios(ubios);
+}
+
 TEST(IOWorker, AddDevice_DeviceNullptr)
 {
     // Given: cpu_set_t, IOWorker, MockQosManager
@@ -0,0 +1,139 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/io_scheduler/read_hedging_policy.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "src/bio/ubio.h"
+#include "src/device/base/device_latency_tracker.h"
+#include "test/unit-tests/device/base/ublock_device_mock.h"
+#include "test/unit-tests/include/i_array_device_mock.h"
+
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+static const uint64_t TEST_THRESHOLD_US = 100;
+static const uint32_t TEST_LATENCY_RATIO = 4;
+
+// The slow device completes one io while the others complete 16
+static void
+RecordRounds(DeviceLatencyTracker& others, uint64_t othersLatencyNs,
+    DeviceLatencyTracker& target, uint64_t targetLatencyNs)
+{
+    for (int round = 0; round < 1024; round++)
+    {
+        for (int count = 0; count < 16; count++)
+        {
+            others.Record(othersLatencyNs);
+        }
+        target.Record(targetLatencyNs);
+    }
+}
+
+class ReadHedgingPolicyFixture : public ::testing::Test
+{
+protected:
+    void
+    SetUp(void) override
+    {
+        ublock = std::make_shared<NiceMock<MockUBlockDevice>>("", 0, nullptr);
+        ON_CALL(*ublock, GetLatencyTracker).WillByDefault(Return(&slowDevice));
+        ubio = std::make_shared<Ubio>(nullptr, 8, 0);
+        ubio->dir = UbioDir::Read;
+        PhysicalBlkAddr pba = {.lba = 0, .arrayDev = &arrayDev};
+        ubio->SetPba(pba);
+        ubio->SetUblock(ublock);
+    }
+
+    DeviceLatencyTracker overall{nullptr};
+    DeviceLatencyTracker slowDevice{&overall};
+    DeviceLatencyTracker fastDevice{&overall};
+    NiceMock<MockIArrayDevice> arrayDev;
+    std::shared_ptr<NiceMock<MockUBlockDevice>> ublock;
+    UbioSmartPtr ubio;
+    ReadHedgingPolicy policy{TEST_THRESHOLD_US, TEST_LATENCY_RATIO};
+};
+
+TEST_F(ReadHedgingPolicyFixture, ShouldReadFromPeers_testIfReadOfSlowDeviceGoesToPeers)
+{
+    // Given
+    RecordRounds(fastDevice, 10000, slowDevice, 1000000);
+
+    // When, Then
+    EXPECT_TRUE(policy.ShouldReadFromPeers(ubio));
+}
+
+TEST_F(ReadHedgingPolicyFixture, ShouldReadFromPeers_testIfReadStaysWhenAllDevicesAreSlow)
+{
+    // Given
+    RecordRounds(fastDevice, 1000000, slowDevice, 1000000);
+
+    // When, Then
+    EXPECT_FALSE(policy.ShouldReadFromPeers(ubio));
+}
+
+TEST_F(ReadHedgingPolicyFixture, ShouldReadFromPeers_testIfReadStaysUnderThreshold)
+{
+    // Given
+    RecordRounds(fastDevice, 1000, slowDevice, 50000);
+
+    // When, Then
+    EXPECT_FALSE(policy.ShouldReadFromPeers(ubio));
+}
+
+TEST_F(ReadHedgingPolicyFixture, ShouldReadFromPeers_testIfRetriedOrWriteIoStays)
+{
+    // Given
+    RecordRounds(fastDevice, 10000, slowDevice, 1000000);
+
+    // When, Then
+    ubio->SetRetry(true);
+    EXPECT_FALSE(policy.ShouldReadFromPeers(ubio));
+    ubio->SetRetry(false);
+    ubio->dir = UbioDir::Write;
+    EXPECT_FALSE(policy.ShouldReadFromPeers(ubio));
+}
+
+TEST_F(ReadHedgingPolicyFixture, ShouldReadFromPeers_testIfReadStaysWithoutEnoughSamples)
+{
+    // Given
+    fastDevice.Record(1000);
+    slowDevice.Record(1000000);
+
+    // When, Then
+    EXPECT_FALSE(policy.ShouldReadFromPeers(ubio));
+}
+} // namespace pos
@@ -12,6 +12,7 @@ public:
     using IIOSubmitHandler::IIOSubmitHandler;
     MOCK_METHOD(IOSubmitHandlerStatus, SyncIO, (IODirection direction, std::list<BufferEntry>& bufferList, LogicalBlkAddr& startLSA, uint64_t blockCount, PartitionType partitionToIO, int arrayId), (override));
     MOCK_METHOD(IOSubmitHandlerStatus, SubmitAsyncIO, (IODirection direction, std::list<BufferEntry>& bufferList, LogicalBlkAddr& startLSA, uint64_t blockCount, PartitionType partitionToIO, CallbackSmartPtr callback, int arrayId, bool parityOnly), (override));
+    MOCK_METHOD(IOSubmitHandlerStatus, SubmitAsyncIOBatch, (IODirection direction, std::vector<AsyncIORequest>& requests, PartitionType partitionToIO, int arrayId), (override));
     MOCK_METHOD(IOSubmitHandlerStatus, SubmitAsyncByteIO, (IODirection direction, void* buffer, LogicalByteAddr& startLSA, PartitionType partitionToIO, CallbackSmartPtr callback, int arrayId), (override));
 };
 
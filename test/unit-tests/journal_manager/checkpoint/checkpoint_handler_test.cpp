@@ -63,12 +63,9 @@ public:
     }
 
     void
-    ExpectFlushDirtyMpages(MapList pendingDirtyMaps)
+    ExpectFlushDirtyMaps(MapList pendingDirtyMaps)
     {
-        for (auto mapId : pendingDirtyMaps)
-        {
-            EXPECT_CALL(*mapFlush, FlushDirtyMpages(mapId, _)).WillOnce(Return(0));
-        }
+        EXPECT_CALL(*mapFlush, FlushDirtyMaps(pendingDirtyMaps, _)).WillOnce(Return(0));
     }
 
 protected:
@@ -86,7 +83,7 @@ TEST_F(CheckpointHandlerTestFixture, Start_testIfCheckpointStartSuccessfullywith
 
     // When : Succeed flushing dirty map and allocator meta pages
     MapList pendingDirtyMaps = GenerateDummyDirtyPageList(1);
-    ExpectFlushDirtyMpages(pendingDirtyMaps);
+    ExpectFlushDirtyMaps(pendingDirtyMaps);
     EXPECT_CALL(*contextManager, FlushContexts).WillOnce(Return(0));
 
     // Then : Will restore the active stipre tail to this stripe
@@ -102,7 +99,7 @@ TEST_F(CheckpointHandlerTestFixture, Start_testIfCheckpointStartSuccessfullywith
 
     // When : Succeed flushing dirty map and allocator meta pages
     MapList pendingDirtyMaps = GenerateDummyDirtyPageList(numDirtyMaps);
-    ExpectFlushDirtyMpages(pendingDirtyMaps);
+    ExpectFlushDirtyMaps(pendingDirtyMaps);
     EXPECT_CALL(*contextManager, FlushContexts).WillOnce(Return(0));
 
     // Then : Will restore the active stipre tail to this stripe
@@ -115,7 +112,7 @@ TEST_F(CheckpointHandlerTestFixture, Start_testIfFlushCompletedImmediatelyDuring
 {
 }
 
-TEST_F(CheckpointHandlerTestFixture, Start_testIfCheckpointFailedWhenFlushDirtyMpagesFailed)
+TEST_F(CheckpointHandlerTestFixture, Start_testIfCheckpointFailedWhenFlushDirtyMapsFailed)
 {
     // Given
     checkpointHandler = new CheckpointHandler(0);
@@ -123,7 +120,7 @@ TEST_F(CheckpointHandlerTestFixture, Start_testIfCheckpointFailedWhenFlushDirtyM
 
     // When : Failed to flushing dirty map pages
     MapList pendingDirtyMaps = GenerateDummyDirtyPageList(numDirtyMaps);
-    EXPECT_CALL(*mapFlush, FlushDirtyMpages).WillOnce(Return(-1));
+    EXPECT_CALL(*mapFlush, FlushDirtyMaps).WillOnce(Return(-1));
 
     // Then : Checkpoint should be started
     EXPECT_TRUE(checkpointHandler->Start(pendingDirtyMaps, nullptr) != 0);
@@ -138,7 +135,7 @@ TEST_F(CheckpointHandlerTestFixture, Start_testIfCheckpointFailedWhencontextMana
 
     // When : Succeed to flushing dirty map pages and failed flushing allocator meta pages
     MapList pendingDirtyMaps = GenerateDummyDirtyPageList(numDirtyMaps);
-    ExpectFlushDirtyMpages(pendingDirtyMaps);
+    ExpectFlushDirtyMaps(pendingDirtyMaps);
     EXPECT_CALL(*contextManager, FlushContexts).WillOnce(Return(-1));
 
     // Then : Checkpoint should be started
@@ -150,4 +150,22 @@ TEST(DirtyMapList, Delete_testIfDirtyListDeleteSuccessWhenEmpty)
     EXPECT_EQ(actual.find(deletedMapId), actual.end());
 }
 
+TEST(DirtyMapList, PopDirtyList_testIfStripeMapIsReturnedAndListCleared)
+{
+    // Given: Dirty list with volume maps and the stripe map
+    MapList added;
+    added.emplace(0);
+    added.emplace(255);
+    added.emplace(STRIPE_MAP_ID);
+    DirtyMapList dirtyMapList;
+    dirtyMapList.Add(added);
+
+    // When: Dirty list is popped
+    MapList actual = dirtyMapList.PopDirtyList();
+
+    // Then: All the added maps are returned and nothing is left behind
+    EXPECT_EQ(added, actual);
+    EXPECT_EQ(dirtyMapList.GetList().empty(), true);
+}
+
 } // namespace pos
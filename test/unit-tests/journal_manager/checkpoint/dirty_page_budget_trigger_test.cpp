@@ -0,0 +1,154 @@
+#include "src/journal_manager/checkpoint/dirty_page_budget_trigger.h"
+
+#include <gtest/gtest.h>
+
+#include "test/unit-tests/journal_manager/config/journal_configuration_mock.h"
+#include "test/unit-tests/journal_manager/log_write/buffer_offset_allocator_mock.h"
+#include "test/unit-tests/mapper/i_map_flush_mock.h"
+#include "test/unit-tests/qos/qos_manager_mock.h"
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+static const int NUM_LOGS_PER_CHECK = 256;
+
+class DirtyPageBudgetTriggerTestFixture : public ::testing::Test
+{
+public:
+    DirtyPageBudgetTriggerTestFixture(void)
+    {
+    }
+    virtual ~DirtyPageBudgetTriggerTestFixture(void)
+    {
+    }
+
+    virtual void
+    SetUp(void)
+    {
+        ON_CALL(qosManager, GetEventWeightWRR(BackendEvent_FlushMap)).WillByDefault(Return(20));
+        ON_CALL(qosManager, GetDefaultEventWeightWRR(BackendEvent_FlushMap)).WillByDefault(Return(20));
+        ON_CALL(bufferAllocator, GetNumLogsAdded).WillByDefault(Return(0));
+    }
+
+    virtual void
+    TearDown(void)
+    {
+    }
+
+protected:
+    void
+    _Init(uint64_t dirtyPageBudget, uint64_t targetReplayTimeInMsec)
+    {
+        ON_CALL(config, GetCheckpointDirtyPageBudget).WillByDefault(Return(dirtyPageBudget));
+        ON_CALL(config, GetCheckpointTargetReplayTimeInMsec).WillByDefault(Return(targetReplayTimeInMsec));
+        trigger.Init(&config, &mapFlush, &bufferAllocator, &qosManager);
+    }
+
+    void
+    _FillLogs(int numLogs)
+    {
+        MapList dirty;
+        for (int count = 0; count < numLogs; count++)
+        {
+            trigger.LogFilled(0, dirty);
+        }
+    }
+
+    NiceMock<MockJournalConfiguration> config;
+    NiceMock<MockIMapFlush> mapFlush;
+    NiceMock<MockBufferOffsetAllocator> bufferAllocator;
+    NiceMock<MockQosManager> qosManager;
+
+    DirtyPageBudgetTrigger trigger;
+};
+
+TEST_F(DirtyPageBudgetTriggerTestFixture, IsEnabled_testIfDisabledWithoutBudgetAndTarget)
+{
+    // Given
+    _Init(0, 0);
+
+    // When, Then
+    EXPECT_FALSE(trigger.IsEnabled());
+}
+
+TEST_F(DirtyPageBudgetTriggerTestFixture, IsEnabled_testIfEnabledWithBudgetOrTarget)
+{
+    _Init(100, 0);
+    EXPECT_TRUE(trigger.IsEnabled());
+
+    _Init(0, 1000);
+    EXPECT_TRUE(trigger.IsEnabled());
+}
+
+TEST_F(DirtyPageBudgetTriggerTestFixture, LogFilled_testIfLogGroupIsSealedWhenDirtyPagesExceedBudget)
+{
+    // Given
+    _Init(100, 0);
+    ON_CALL(mapFlush, GetNumDirtyMpages).WillByDefault(Return(150));
+
+    // Then: budget is checked once per NUM_LOGS_PER_CHECK logs
+    EXPECT_CALL(mapFlush, GetNumDirtyMpages).Times(1);
+    EXPECT_CALL(bufferAllocator, SealActiveLogGroup).Times(1);
+
+    // When
+    _FillLogs(NUM_LOGS_PER_CHECK);
+}
+
+TEST_F(DirtyPageBudgetTriggerTestFixture, LogFilled_testIfLogGroupIsNotSealedWithinBudget)
+{
+    // Given
+    _Init(100, 0);
+    ON_CALL(mapFlush, GetNumDirtyMpages).WillByDefault(Return(99));
+
+    // Then
+    EXPECT_CALL(bufferAllocator, SealActiveLogGroup).Times(0);
+
+    // When
+    _FillLogs(NUM_LOGS_PER_CHECK);
+}
+
+TEST_F(DirtyPageBudgetTriggerTestFixture, LogFilled_testIfLogGroupIsSealedWhenReplayTimeExceedsTarget)
+{
+    // Given: 1000 logs and 100 dirty pages take 3 msec to be replayed
+    _Init(0, 3);
+    ON_CALL(mapFlush, GetNumDirtyMpages).WillByDefault(Return(100));
+    ON_CALL(bufferAllocator, GetNumLogsAdded).WillByDefault(Return(1000));
+
+    // Then
+    EXPECT_CALL(bufferAllocator, SealActiveLogGroup).Times(1);
+
+    // When
+    _FillLogs(NUM_LOGS_PER_CHECK);
+}
+
+TEST_F(DirtyPageBudgetTriggerTestFixture, LogFilled_testIfSealIsDeferredWhileMapFlushIsThrottled)
+{
+    // Given
+    _Init(100, 0);
+    ON_CALL(qosManager, GetEventWeightWRR(BackendEvent_FlushMap)).WillByDefault(Return(-10));
+    ON_CALL(mapFlush, GetNumDirtyMpages).WillByDefault(Return(150));
+
+    // Then
+    EXPECT_CALL(bufferAllocator, SealActiveLogGroup).Times(0);
+
+    // When
+    _FillLogs(NUM_LOGS_PER_CHECK);
+}
+
+TEST_F(DirtyPageBudgetTriggerTestFixture, LogFilled_testIfThrottlingIsIgnoredWhenBudgetIsFarExceeded)
+{
+    // Given
+    _Init(100, 0);
+    ON_CALL(qosManager, GetEventWeightWRR(BackendEvent_FlushMap)).WillByDefault(Return(-10));
+    ON_CALL(mapFlush, GetNumDirtyMpages).WillByDefault(Return(200));
+
+    // Then
+    EXPECT_CALL(bufferAllocator, SealActiveLogGroup).Times(1);
+
+    // When
+    _FillLogs(NUM_LOGS_PER_CHECK);
+}
+} // namespace pos
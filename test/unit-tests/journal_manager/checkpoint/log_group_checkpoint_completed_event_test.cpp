@@ -0,0 +1,27 @@
+#include "src/journal_manager/checkpoint/log_group_checkpoint_completed_event.h"
+
+#include <gtest/gtest.h>
+
+#include "test/unit-tests/journal_manager/checkpoint/log_group_releaser_mock.h"
+
+using ::testing::_;
+using ::testing::NiceMock;
+
+namespace pos
+{
+TEST(LogGroupCheckpointCompletedEvent, Execute_testIfReleaserIsNotified)
+{
+    // Given
+    NiceMock<MockLogGroupReleaser> releaser;
+
+    int logGroupId = 1;
+    LogGroupCheckpointCompletedEvent event(&releaser, logGroupId, nullptr);
+
+    // When
+    EXPECT_CALL(releaser, LogGroupCheckpointCompleted(logGroupId, _)).Times(1);
+    bool result = event.Execute();
+
+    // Then
+    EXPECT_EQ(result, true);
+}
+} // namespace pos
@@ -16,6 +16,7 @@ public:
     MOCK_METHOD(int, GetFlushingLogGroupId, (), (override));
     MOCK_METHOD(std::list<int>, GetFullLogGroups, (), (override));
     MOCK_METHOD(CheckpointStatus, GetStatus, (), (override));
+    MOCK_METHOD(void, LogGroupCheckpointCompleted, (int logGroupId, EventSmartPtr resetEvent), (override));
     MOCK_METHOD(void, LogGroupResetCompleted, (int logGroupId), (override));
     MOCK_METHOD(void, _FlushNextLogGroup, (), (override));
     MOCK_METHOD(void, _TriggerCheckpoint, (), (override));
@@ -191,4 +191,73 @@ TEST(LogGroupReleaser, LogGroupResetCompleted_testIfNextCheckpointIsNotStartedWh
     EXPECT_EQ(releaser.GetFlushingLogGroupId(), 1);
     EXPECT_EQ(releaser.GetFullLogGroups().empty(), true);
 }
+
+TEST(LogGroupReleaser, LogGroupCheckpointCompleted_testIfNextCheckpointStartsBeforeReset)
+{
+    // Given
+    NiceMock<MockJournalConfiguration> config;
+    NiceMock<MockIContextManager> contextManager;
+    NiceMock<MockCheckpointManager> checkpointManager;
+    NiceMock<MockLogBufferWriteDoneNotifier> notifier;
+    NiceMock<MockEventScheduler> eventScheduler;
+
+    ON_CALL(config, GetNumLogGroups).WillByDefault(Return(3));
+
+    LogGroupReleaser releaser;
+    releaser.Init(&config, &notifier, nullptr, &checkpointManager,
+        nullptr, &contextManager, &eventScheduler);
+
+    // When: Log group 0 and 1 is full, and checkpoint for log group 0 starts
+    EXPECT_CALL(eventScheduler, EnqueueEvent).Times(1);
+
+    releaser.MarkLogGroupFull(0, 10);
+    releaser.MarkLogGroupFull(1, 11);
+
+    // Then: Reset of log group 0 and checkpoint of log group 1 should be started together
+    EXPECT_CALL(notifier, NotifyLogBufferReseted).Times(0);
+    EXPECT_CALL(eventScheduler, EnqueueEvent).Times(2);
+
+    // When: Checkpoint of log group 0 is completed
+    releaser.LogGroupCheckpointCompleted(0, nullptr);
+
+    // Then: Log group 0 should stay full until its reset is completed
+    EXPECT_EQ(releaser.GetFlushingLogGroupId(), 1);
+    std::list<int> expectedFullLogGroups = {0, 1};
+    EXPECT_EQ(releaser.GetFullLogGroups(), expectedFullLogGroups);
+}
+
+TEST(LogGroupReleaser, LogGroupCheckpointCompleted_testIfResetIsDelayedUntilPreviousResetCompleted)
+{
+    // Given
+    NiceMock<MockJournalConfiguration> config;
+    NiceMock<MockIContextManager> contextManager;
+    NiceMock<MockCheckpointManager> checkpointManager;
+    NiceMock<MockLogBufferWriteDoneNotifier> notifier;
+    NiceMock<MockEventScheduler> eventScheduler;
+
+    ON_CALL(config, GetNumLogGroups).WillByDefault(Return(3));
+
+    LogGroupReleaser releaser;
+    releaser.Init(&config, &notifier, nullptr, &checkpointManager,
+        nullptr, &contextManager, &eventScheduler);
+
+    releaser.MarkLogGroupFull(0, 10);
+    releaser.MarkLogGroupFull(1, 11);
+    releaser.LogGroupCheckpointCompleted(0, nullptr);
+
+    // When: Checkpoint of log group 1 is completed before log group 0 is reset
+    // Then: Reset of log group 1 should not be started
+    EXPECT_CALL(eventScheduler, EnqueueEvent).Times(0);
+    releaser.LogGroupCheckpointCompleted(1, nullptr);
+
+    // When: Reset of log group 0 is completed
+    // Then: Reset of log group 1 should be started
+    EXPECT_CALL(notifier, NotifyLogBufferReseted(0)).Times(1);
+    EXPECT_CALL(eventScheduler, EnqueueEvent).Times(1);
+    releaser.LogGroupResetCompleted(0);
+
+    std::list<int> expectedFullLogGroups = {1};
+    EXPECT_EQ(releaser.GetFullLogGroups(), expectedFullLogGroups);
+    EXPECT_EQ(releaser.GetFlushingLogGroupId(), 2);
+}
 } // namespace pos
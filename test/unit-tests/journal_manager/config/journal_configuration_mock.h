@@ -14,15 +14,25 @@ public:
     MOCK_METHOD(int, SetLogBufferSize, (uint64_t loadedLogBufferSize, MetaFsFileControlApi* metaFsCtrl), (override));
     MOCK_METHOD(bool, IsEnabled, (), (override));
     MOCK_METHOD(bool, IsDebugEnabled, (), (override));
+    MOCK_METHOD(bool, IsCompactLogEnabled, (), (override));
+    MOCK_METHOD(bool, IsDirectNvramWriteEnabled, (), (override));
+    MOCK_METHOD(uint64_t, GetGroupCommitWindowInUsec, (), (override));
+    MOCK_METHOD(uint64_t, GetGroupCommitMaxBatchSize, (), (override));
+    MOCK_METHOD(uint64_t, GetCheckpointDirtyPageBudget, (), (override));
+    MOCK_METHOD(uint64_t, GetCheckpointTargetReplayTimeInMsec, (), (override));
     MOCK_METHOD(bool, AreReplayWbStripesInUserArea, (), (override));
     MOCK_METHOD(bool, IsRocksdbEnabled, (), (override));
     MOCK_METHOD(int, GetNumLogGroups, (), (override));
+    MOCK_METHOD(int, GetNumLogStreams, (), (override));
     MOCK_METHOD(uint64_t, GetLogBufferSize, (), (override));
     MOCK_METHOD(uint64_t, GetLogGroupSize, (), (override));
     MOCK_METHOD(uint64_t, GetMetaPageSize, (), (override));
     MOCK_METHOD(MetaVolumeType, GetMetaVolumeToUse, (), (override));
     MOCK_METHOD(LogGroupLayout, GetLogBufferLayout, (int groupId), (override));
     MOCK_METHOD(std::string, GetRocksdbPath, (), (override));
+    MOCK_METHOD(bool, IsRocksdbWriteBatchEnabled, (), (override));
+    MOCK_METHOD(bool, IsRocksdbSyncWriteEnabled, (), (override));
+    MOCK_METHOD(uint64_t, GetRocksdbMemtableSize, (), (override));
 };
 
 } // namespace pos
@@ -99,6 +99,25 @@ TEST(JournalConfiguration, JournalConfiguration_testConstructedSuccessfully)
     delete configManager;
 }
 
+TEST(JournalConfiguration, JournalConfiguration_testIfRocksdbWriteOptionsAreRead)
+{
+    // Given
+    NiceMock<MockConfigManager>* configManager = CreateMockConfigManager(true, false, 0, true, 1000, 2);
+    ON_CALL(*configManager, GetValue("meta_rocksdb", "journal_write_batch_enable", _, _)).WillByDefault(SetArg2ToBoolAndReturn0(true));
+    ON_CALL(*configManager, GetValue("meta_rocksdb", "journal_sync_write_enable", _, _)).WillByDefault(SetArg2ToBoolAndReturn0(true));
+    ON_CALL(*configManager, GetValue("meta_rocksdb", "journal_memtable_size_in_mb", _, _)).WillByDefault(SetArg2ToLongAndReturn0(64));
+
+    // When
+    JournalConfiguration config(configManager);
+
+    // Then
+    EXPECT_EQ(config.IsRocksdbWriteBatchEnabled(), true);
+    EXPECT_EQ(config.IsRocksdbSyncWriteEnabled(), true);
+    EXPECT_EQ(config.GetRocksdbMemtableSize(), 64 * SIZE_MB);
+
+    delete configManager;
+}
+
 TEST(JournalConfiguration, JournalConfiguration_testWithJournalDisabled)
 {
     // Given
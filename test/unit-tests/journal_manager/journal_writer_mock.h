@@ -16,6 +16,7 @@ public:
     MOCK_METHOD(int, AddBlockMapUpdatedLog, (VolumeIoSmartPtr volumeIo, EventSmartPtr callbackEvent), (override));
     MOCK_METHOD(int, AddStripeMapUpdatedLog, (StripeSmartPtr stripe, StripeAddr oldAddr, EventSmartPtr callbackEvent), (override));
     MOCK_METHOD(int, AddGcStripeFlushedLog, (GcStripeMapUpdateList mapUpdates, EventSmartPtr callbackEvent), (override));
+    MOCK_METHOD(int, AddRangeUnmappedLog, (int volId, BlkAddr startRba, uint64_t numBlks, EventSmartPtr callbackEvent), (override));
 };
 
 } // namespace pos
@@ -0,0 +1,95 @@
+#include "src/journal_manager/log/compact_block_write_done_log_handler.h"
+
+#include <gtest/gtest.h>
+
+#include "src/journal_manager/log/block_write_done_log_handler.h"
+
+namespace pos
+{
+TEST(CompactBlockWriteDoneLogHandler, GetType_testIfCompactTypeIsReturned)
+{
+    CompactBlockWriteDoneLogHandler logHandler(0, 0, 1, UNMAP_VSA, 0, StripeAddr{IN_WRITE_BUFFER_AREA, UNMAP_STRIPE});
+    EXPECT_EQ(logHandler.GetType(), LogType::BLOCK_WRITE_DONE_COMPACT);
+}
+
+TEST(CompactBlockWriteDoneLogHandler, GetSize_testIfSmallerThanFixedSizeLog)
+{
+    // Given
+    VirtualBlkAddr startVsa = {
+        .stripeId = 1000000,
+        .offset = 127};
+    StripeAddr stripeAddr = {
+        .stripeLoc = IN_WRITE_BUFFER_AREA,
+        .stripeId = 1000};
+
+    // When
+    CompactBlockWriteDoneLogHandler logHandler(3, 1ULL << 32, 32, startVsa, 3, stripeAddr);
+
+    // Then
+    EXPECT_LT(logHandler.GetSize(), sizeof(BlockWriteDoneLog));
+    EXPECT_EQ(logHandler.GetSize() % sizeof(uint32_t), 0);
+}
+
+TEST(CompactBlockWriteDoneLogHandler, Decode_testIfEncodedLogIsRestored)
+{
+    // Given
+    int volId = 5;
+    BlkAddr startRba = 0x123456789A;
+    uint32_t numBlks = 64;
+    VirtualBlkAddr startVsa = {
+        .stripeId = 20000,
+        .offset = 3};
+    int wbIndex = 2;
+    StripeAddr stripeAddr = {
+        .stripeLoc = IN_WRITE_BUFFER_AREA,
+        .stripeId = 17};
+    CompactBlockWriteDoneLogHandler logHandler(volId, startRba, numBlks, startVsa, wbIndex, stripeAddr);
+    logHandler.SetSeqNum(11);
+
+    // When
+    BlockWriteDoneLog decoded;
+    bool result = CompactBlockWriteDoneLogHandler::Decode(logHandler.GetData(), logHandler.GetSize(), decoded);
+
+    // Then
+    EXPECT_TRUE(result);
+    BlockWriteDoneLogHandler expected(volId, startRba, numBlks, startVsa, wbIndex, stripeAddr);
+    BlockWriteDoneLogHandler actual(decoded);
+    EXPECT_TRUE(actual == expected);
+    EXPECT_EQ(actual.GetType(), LogType::BLOCK_WRITE_DONE);
+    EXPECT_EQ(actual.GetSeqNum(), 11);
+}
+
+TEST(CompactBlockWriteDoneLogHandler, Decode_testIfUnmappedAddressesAreRestored)
+{
+    // Given
+    StripeAddr stripeAddr = {
+        .stripeLoc = IN_USER_AREA,
+        .stripeId = UNMAP_STRIPE};
+    CompactBlockWriteDoneLogHandler logHandler(0, 0, 1, UNMAP_VSA, 0, stripeAddr);
+
+    // When
+    BlockWriteDoneLog decoded;
+    bool result = CompactBlockWriteDoneLogHandler::Decode(logHandler.GetData(), logHandler.GetSize(), decoded);
+
+    // Then
+    EXPECT_TRUE(result);
+    EXPECT_EQ(decoded.startVsa, UNMAP_VSA);
+    EXPECT_EQ(decoded.writeBufferStripeAddress, stripeAddr);
+}
+
+TEST(CompactBlockWriteDoneLogHandler, Decode_testIfTruncatedLogIsRejected)
+{
+    // Given
+    VirtualBlkAddr startVsa = {
+        .stripeId = 1,
+        .offset = 1};
+    CompactBlockWriteDoneLogHandler logHandler(0, 100, 1, startVsa, 0, StripeAddr{IN_WRITE_BUFFER_AREA, 1});
+
+    // When
+    BlockWriteDoneLog decoded;
+    bool result = CompactBlockWriteDoneLogHandler::Decode(logHandler.GetData(), sizeof(CompactBlockWriteDoneLog), decoded);
+
+    // Then
+    EXPECT_FALSE(result);
+}
+} // namespace pos
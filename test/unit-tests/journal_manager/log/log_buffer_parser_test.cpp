@@ -6,6 +6,8 @@
 #include <sys/types.h>
 
 #include "src/include/pos_event_id.h"
+#include "src/journal_manager/log/block_write_done_log_handler.h"
+#include "src/journal_manager/log/compact_block_write_done_log_handler.h"
 #include "src/journal_manager/log/gc_map_update_list.h"
 #include "test/unit-tests/journal_manager/log/log_list_mock.h"
 #include "src/journal_manager/replay/replay_log_list.h"
@@ -26,6 +28,17 @@ MATCHER_P(SoftEqLog, expected, "Equality matcher for log")
     return (expectedLog->type == arg->GetType() && expectedLog->seqNum == arg->GetSeqNum());
 }
 
+MATCHER_P(EqBlockWriteDoneLog, expected, "Equality matcher for block write done log")
+{
+    BlockWriteDoneLogHandler expectedLog = expected;
+    BlockWriteDoneLogHandler* log = dynamic_cast<BlockWriteDoneLogHandler*>(arg);
+    return (log != nullptr) && (*log == expectedLog) && (log->GetSeqNum() == expectedLog.GetSeqNum());
+}
+
+MATCHER_P2(OrderedLog, expected, order, "Matcher for log and its order")
+{
+    return (memcmp(expected, arg->GetData(), arg->GetSize()) == 0) && (arg->GetOrder() == static_cast<uint64_t>(order));
+}
 
 TEST(LogBufferParser, LogBufferParser_testIfConstructedSuccessfully)
 {
@@ -67,6 +80,71 @@ TEST(LogBufferParser, GetLogs_testIfBlockWriteDoneLogIsParsed)
     free(buffer);
 }
 
+TEST(LogBufferParser, GetLogs_testIfCompactBlockWriteDoneLogIsParsed)
+{
+    // Given
+    VirtualBlkAddr startVsa = {
+        .stripeId = 300,
+        .offset = 7};
+    StripeAddr wbAddr = {
+        .stripeLoc = IN_WRITE_BUFFER_AREA,
+        .stripeId = 12};
+    CompactBlockWriteDoneLogHandler compactLog(1, 123456789, 8, startVsa, 1, wbAddr);
+    compactLog.SetSeqNum(3);
+
+    BlockWriteDoneLogHandler expectedLog(1, 123456789, 8, startVsa, 1, wbAddr);
+    expectedLog.SetSeqNum(3);
+
+    uint64_t bufferSize = compactLog.GetSize();
+    void* buffer = malloc(bufferSize);
+    memcpy(buffer, compactLog.GetData(), bufferSize);
+
+    NiceMock<MockLogList> logList;
+
+    // Then: Compact log should be decoded to the fixed size block write done log
+    EXPECT_CALL(logList, AddLog(EqBlockWriteDoneLog(expectedLog)));
+
+    // When
+    LogBufferParser parser;
+    EXPECT_EQ(parser.GetLogs(buffer, bufferSize, logList), 0);
+
+    free(buffer);
+}
+
+TEST(LogBufferParser, GetLogs_testIfOrderedLogIsParsedOnceWithItsOrder)
+{
+    // Given: a stripe map updated log behind its order header, and a log without it
+    StripeMapUpdatedLog log;
+    log.type = LogType::STRIPE_MAP_UPDATED;
+    log.vsid = 100;
+    log.oldMap = {
+        .stripeLoc = IN_WRITE_BUFFER_AREA,
+        .stripeId = 0};
+    log.newMap = {
+        .stripeLoc = IN_USER_AREA,
+        .stripeId = 100};
+    LogOrderHeader orderHeader;
+    orderHeader.order = 7;
+
+    uint64_t bufferSize = sizeof(orderHeader) + 2 * sizeof(log);
+    char* buffer = (char*)malloc(bufferSize);
+    memcpy(buffer, &orderHeader, sizeof(orderHeader));
+    memcpy(buffer + sizeof(orderHeader), &log, sizeof(log));
+    memcpy(buffer + sizeof(orderHeader) + sizeof(log), &log, sizeof(log));
+
+    NiceMock<MockLogList> logList;
+
+    // Then: the ordered log is added once with its order, the other one without an order
+    EXPECT_CALL(logList, AddLog(OrderedLog(buffer + sizeof(orderHeader), 7))).Times(1);
+    EXPECT_CALL(logList, AddLog(OrderedLog(buffer + sizeof(orderHeader), 0))).Times(1);
+
+    // When
+    LogBufferParser parser;
+    EXPECT_EQ(parser.GetLogs(buffer, bufferSize, logList), 0);
+
+    free(buffer);
+}
+
 TEST(LogBufferParser, GetLogs_testIfStripeMapUpdatedLogIsParsed)
 {
     // Given
@@ -16,6 +16,8 @@ public:
     MOCK_METHOD(StripeId, GetVsid, (), (override));
     MOCK_METHOD(uint32_t, GetSeqNum, (), (override));
     MOCK_METHOD(void, SetSeqNum, (uint32_t num), (override));
+    MOCK_METHOD(uint64_t, GetOrder, (), (override));
+    MOCK_METHOD(void, SetOrder, (uint64_t order), (override));
 };
 
 } // namespace pos
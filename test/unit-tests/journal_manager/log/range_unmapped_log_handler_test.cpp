@@ -0,0 +1,47 @@
+#include "src/journal_manager/log/range_unmapped_log_handler.h"
+
+#include <gtest/gtest.h>
+
+namespace pos
+{
+TEST(RangeUnmappedLogHandler, GetType_testIfCorrectTypeIsReturned)
+{
+    RangeUnmappedLogHandler log(0, 0, 1);
+    EXPECT_EQ(log.GetType(), LogType::RANGE_UNMAPPED);
+}
+
+TEST(RangeUnmappedLogHandler, GetSize_testIfCorrectSizeIsReturned)
+{
+    RangeUnmappedLogHandler log(0, 0, 1);
+    EXPECT_EQ(log.GetSize(), sizeof(RangeUnmappedLog));
+}
+
+TEST(RangeUnmappedLogHandler, GetData_testIfTheWholeRangeIsRecorded)
+{
+    RangeUnmappedLogHandler logHandler(3, 1024, 1ULL << 32);
+
+    RangeUnmappedLog actual = *reinterpret_cast<RangeUnmappedLog*>(logHandler.GetData());
+    EXPECT_EQ(actual.type, LogType::RANGE_UNMAPPED);
+    EXPECT_EQ(actual.volId, 3);
+    EXPECT_EQ(actual.startRba, 1024);
+    EXPECT_EQ(actual.numBlks, 1ULL << 32);
+
+    RangeUnmappedLogHandler parsed(actual);
+    EXPECT_TRUE(parsed == logHandler);
+}
+
+TEST(RangeUnmappedLogHandler, GetVsid_testIfUnmapIsReturned)
+{
+    RangeUnmappedLogHandler log(0, 0, 1);
+    EXPECT_EQ(log.GetVsid(), UNMAP_STRIPE);
+}
+
+TEST(RangeUnmappedLogHandler, SetSeqNum_testIfSequenceNumberIsUpdated)
+{
+    RangeUnmappedLogHandler logHandler(2, 0, 8);
+
+    logHandler.SetSeqNum(321);
+    EXPECT_EQ(logHandler.GetSeqNum(), 321);
+}
+
+} // namespace pos
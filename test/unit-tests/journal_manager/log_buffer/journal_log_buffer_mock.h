@@ -16,7 +16,9 @@ public:
     MOCK_METHOD(int, Create, (uint64_t logBufferSize), (override));
     MOCK_METHOD(int, Open, (uint64_t& logBufferSize), (override));
     MOCK_METHOD(int, ReadLogBuffer, (int groupId, void* buffer), (override));
+    MOCK_METHOD(int, ReadLogBufferChunk, (int groupId, uint64_t offset, uint64_t size, void* buffer, FnCompleteMetaFileIo func), (override));
     MOCK_METHOD(int, WriteLog, (LogWriteContext * context, uint64_t offset, FnCompleteMetaFileIo func), (override));
+    MOCK_METHOD(int, WriteLogs, (std::vector<LogWriteContext*>& contexts, uint64_t offset, FnCompleteMetaFileIo func), (override));
     MOCK_METHOD(int, SyncResetAll, (), (override));
     MOCK_METHOD(int, AsyncReset, (int id, EventSmartPtr callbackEvent), (override));
     MOCK_METHOD(int, WriteLogGroupFooter, (uint64_t offset, LogGroupFooter footer, int logGroupId, EventSmartPtr callback), (override));
@@ -293,6 +293,116 @@ TEST(JournalLogBuffer, WriteLog_testIfWriteFailed)
     EXPECT_EQ(retCode, result);
 }
 
+TEST(JournalLogBuffer, WriteLog_testIfLogIsCopiedToNvramDirectly)
+{
+    // Given: direct nvram write is enabled and the log buffer is byte addressable
+    NiceMock<MockMetaFileIntf>* metaFile = new NiceMock<MockMetaFileIntf>;
+    NiceMock<MockJournalConfiguration> journalConfig;
+    NiceMock<MockLogBufferIoContextFactory> ioContextFactory;
+
+    char nvram[128];
+    memset(nvram, 0xFF, sizeof(nvram));
+    ON_CALL(journalConfig, IsDirectNvramWriteEnabled).WillByDefault(Return(true));
+    ON_CALL(*metaFile, DoesFileExist).WillByDefault(Return(true));
+    ON_CALL(*metaFile, GetDirectAccessAddress).WillByDefault([&](uint64_t fileOffset)
+        {
+            return nvram + fileOffset;
+        });
+
+    JournalLogBuffer journalLogBuffer(metaFile);
+    journalLogBuffer.Init(&journalConfig, &ioContextFactory, 0, nullptr);
+    uint64_t logBufferSize = 0;
+    journalLogBuffer.Open(logBufferSize);
+
+    char log[16];
+    memset(log, 0xAB, sizeof(log));
+    NiceMock<MockLogWriteContext>* context = new NiceMock<MockLogWriteContext>;
+    ON_CALL(*context, GetLogSize).WillByDefault(Return(sizeof(log)));
+    ON_CALL(*context, GetBuffer).WillByDefault(Return(log));
+
+    MapUpdateLogWriteContext* ioContext = new MapUpdateLogWriteContext(context, nullptr, nullptr);
+    EXPECT_CALL(ioContextFactory, CreateMapUpdateLogWriteIoContext).WillOnce(Return(ioContext));
+
+    // When
+    uint64_t offset = 32;
+    bool completed = false;
+    auto callback = [&](AsyncMetaFileIoCtx* ctx)
+    {
+        completed = true;
+        EXPECT_EQ(0, ctx->GetError());
+        delete ctx;
+    };
+    EXPECT_CALL(*metaFile, AsyncIO).Times(0);
+    int result = journalLogBuffer.WriteLog(context, offset, callback);
+
+    // Then: the log is stored at its offset and completed without metafs
+    EXPECT_EQ(0, result);
+    EXPECT_TRUE(completed);
+    EXPECT_EQ(0, memcmp(nvram + offset, log, sizeof(log)));
+    EXPECT_EQ((char)0xFF, nvram[offset - 1]);
+    EXPECT_EQ((char)0xFF, nvram[offset + sizeof(log)]);
+
+    delete context;
+}
+
+TEST(JournalLogBuffer, WriteLogs_testIfLogsAreCopiedToNvramDirectly)
+{
+    // Given: direct nvram write is enabled and the log buffer is byte addressable
+    NiceMock<MockMetaFileIntf>* metaFile = new NiceMock<MockMetaFileIntf>;
+    NiceMock<MockJournalConfiguration> journalConfig;
+    NiceMock<MockLogBufferIoContextFactory> ioContextFactory;
+
+    char nvram[128];
+    memset(nvram, 0xFF, sizeof(nvram));
+    ON_CALL(journalConfig, IsDirectNvramWriteEnabled).WillByDefault(Return(true));
+    ON_CALL(*metaFile, DoesFileExist).WillByDefault(Return(false));
+    ON_CALL(*metaFile, GetDirectAccessAddress).WillByDefault([&](uint64_t fileOffset)
+        {
+            return nvram + fileOffset;
+        });
+
+    JournalLogBuffer journalLogBuffer(metaFile);
+    journalLogBuffer.Init(&journalConfig, &ioContextFactory, 0, nullptr);
+    journalLogBuffer.Create(sizeof(nvram));
+
+    const int numLogs = 3;
+    char logs[numLogs][8];
+    std::vector<LogWriteContext*> contexts;
+    for (int index = 0; index < numLogs; index++)
+    {
+        memset(logs[index], index, sizeof(logs[index]));
+        NiceMock<MockLogWriteContext>* context = new NiceMock<MockLogWriteContext>;
+        ON_CALL(*context, GetLogSize).WillByDefault(Return(sizeof(logs[index])));
+        ON_CALL(*context, GetBuffer).WillByDefault(Return(logs[index]));
+        contexts.push_back(context);
+    }
+    EXPECT_CALL(ioContextFactory, CreateMapUpdateLogWriteIoContext).WillRepeatedly([](LogWriteContext* context)
+        {
+            return new MapUpdateLogWriteContext(context, nullptr, nullptr);
+        });
+
+    // When
+    uint64_t offset = 8;
+    int numCompleted = 0;
+    auto callback = [&](AsyncMetaFileIoCtx* ctx)
+    {
+        numCompleted++;
+        delete ctx;
+    };
+    EXPECT_CALL(*metaFile, AsyncIO).Times(0);
+    int result = journalLogBuffer.WriteLogs(contexts, offset, callback);
+
+    // Then: every log is stored back to back and completed
+    EXPECT_EQ(0, result);
+    EXPECT_EQ(numLogs, numCompleted);
+    EXPECT_EQ(0, memcmp(nvram + offset, logs, sizeof(logs)));
+
+    for (auto context : contexts)
+    {
+        delete context;
+    }
+}
+
 TEST(JournalLogBuffer, SyncResetAll_testIfExecutedSuccessfully)
 {
     // Given
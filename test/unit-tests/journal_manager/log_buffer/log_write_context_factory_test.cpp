@@ -3,6 +3,8 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "src/allocator/include/allocator_const.h"
+#include "src/cpu_affinity/affinity_manager.h"
 #include "src/include/memory.h"
 #include "src/journal_manager/log/block_write_done_log_handler.h"
 #include "src/journal_manager/log/gc_stripe_flushed_log_handler.h"
@@ -73,6 +75,76 @@ TEST(LogWriteContextFactory, CreateBlockMapLogWriteContext_testIfExecutedSuccess
     EXPECT_EQ(callbackEvent, logWriteContext->GetCallback());
 }
 
+TEST(LogWriteContextFactory, CreateBlockMapLogWriteContext_testIfWbIndexFollowsOriginCore)
+{
+    // Given
+    NiceMock<MockJournalConfiguration> config;
+    LogWriteContextFactory logWriteContextFactory;
+    logWriteContextFactory.Init(&config);
+
+    EventSmartPtr callbackEvent;
+    NiceMock<MockVolumeIo>* volumeIo = new NiceMock<MockVolumeIo>;
+    uint32_t volumeId = 1;
+    uint32_t originCore = 2;
+    VirtualBlkAddr startVsa = {
+        .stripeId = 0,
+        .offset = 10};
+    StripeAddr wbAddr = {
+        .stripeLoc = IN_WRITE_BUFFER_AREA,
+        .stripeId = 100};
+    ON_CALL(*volumeIo, GetVolumeId).WillByDefault(Return(volumeId));
+    ON_CALL(*volumeIo, GetOriginCore).WillByDefault(Return(originCore));
+    ON_CALL(*volumeIo, GetSectorRba).WillByDefault(Return(100));
+    ON_CALL(*volumeIo, GetSize).WillByDefault(Return(1024));
+    ON_CALL(*volumeIo, GetVsa).WillByDefault(ReturnRef(startVsa));
+    ON_CALL(*volumeIo, GetLsidEntry).WillByDefault(ReturnRef(wbAddr));
+
+    // When
+    LogWriteContext* logWriteContext = logWriteContextFactory.CreateBlockMapLogWriteContext(VolumeIoSmartPtr(volumeIo), callbackEvent);
+
+    // Then
+    BlockWriteDoneLogHandler* actualLog = dynamic_cast<BlockWriteDoneLogHandler*>(logWriteContext->GetLog());
+    ASSERT_TRUE(actualLog != nullptr);
+    AffinityManager* affinityManager = AffinityManagerSingleton::Instance();
+    int expectedWbIndex = static_cast<int>(GetActiveStripeTailIndex(volumeId, originCore,
+        affinityManager->GetNumaIdFromCoreId(originCore), affinityManager->GetNumaCount()));
+    EXPECT_EQ(expectedWbIndex, reinterpret_cast<BlockWriteDoneLog*>(actualLog->GetData())->wbIndex);
+
+    delete logWriteContext;
+}
+
+TEST(LogWriteContextFactory, CreateBlockMapLogWriteContext_testIfCompactLogIsCreatedWhenEnabled)
+{
+    // Given
+    NiceMock<MockJournalConfiguration> config;
+    ON_CALL(config, IsCompactLogEnabled).WillByDefault(Return(true));
+    LogWriteContextFactory logWriteContextFactory;
+    logWriteContextFactory.Init(&config);
+
+    EventSmartPtr callbackEvent;
+    NiceMock<MockVolumeIo>* volumeIo = new NiceMock<MockVolumeIo>;
+    VirtualBlkAddr startVsa = {
+        .stripeId = 0,
+        .offset = 10};
+    StripeAddr wbAddr = {
+        .stripeLoc = IN_WRITE_BUFFER_AREA,
+        .stripeId = 100};
+    ON_CALL(*volumeIo, GetVolumeId).WillByDefault(Return(1));
+    ON_CALL(*volumeIo, GetSectorRba).WillByDefault(Return(100));
+    ON_CALL(*volumeIo, GetSize).WillByDefault(Return(1024));
+    ON_CALL(*volumeIo, GetVsa).WillByDefault(ReturnRef(startVsa));
+    ON_CALL(*volumeIo, GetLsidEntry).WillByDefault(ReturnRef(wbAddr));
+
+    // When
+    LogWriteContext* logWriteContext = logWriteContextFactory.CreateBlockMapLogWriteContext(VolumeIoSmartPtr(volumeIo), callbackEvent);
+
+    // Then
+    EXPECT_EQ(logWriteContext->GetLog()->GetType(), LogType::BLOCK_WRITE_DONE_COMPACT);
+    EXPECT_LT(logWriteContext->GetLogSize(), sizeof(BlockWriteDoneLog));
+
+    delete logWriteContext;
+}
+
 TEST(LogWriteContextFactory, CreateStripeMapLogWriteContext_testIfExecutedSuccessfully)
 {
     // Given
@@ -10,7 +10,8 @@ class MockLogWriteContext : public LogWriteContext
 {
 public:
     using LogWriteContext::LogWriteContext;
-    MOCK_METHOD(void, SetLogAllocated, (int logGroupId, uint64_t sequenceNumber), (override));
+    MOCK_METHOD(void, SetLogOrdered, (), (override));
+    MOCK_METHOD(void, SetLogAllocated, (int logGroupId, uint64_t sequenceNumber, uint64_t order), (override));
     MOCK_METHOD(const MapList&, GetDirtyMapList, (), (override));
     MOCK_METHOD(int, GetLogGroupId, (), (override));
     MOCK_METHOD(uint64_t, GetLogSize, (), (override));
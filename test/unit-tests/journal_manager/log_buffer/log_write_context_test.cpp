@@ -63,4 +63,30 @@ TEST(LogWriteContext, SetBufferAllocated_testIfExecutedSuccessfully)
     // Then
     EXPECT_EQ(logGroupId, logWriteContext.GetLogGroupId());
 }
+
+TEST(LogWriteContext, SetLogAllocated_testIfOrderedLogIsWrittenBehindItsOrder)
+{
+    // Given
+    NiceMock<MockLogHandlerInterface>* log = new NiceMock<MockLogHandlerInterface>;
+    MapList dirtyList;
+    LogWriteContext logWriteContext(log, dirtyList, nullptr);
+
+    char data[16];
+    memset(data, 0xAB, sizeof(data));
+    ON_CALL(*log, GetSize).WillByDefault(Return(sizeof(data)));
+    ON_CALL(*log, GetData).WillByDefault(Return(data));
+
+    // When
+    logWriteContext.SetLogOrdered();
+    uint64_t sizeToAllocate = logWriteContext.GetLogSize();
+    logWriteContext.SetLogAllocated(1, 1, 7);
+
+    // Then: the log follows its order header
+    EXPECT_EQ(sizeof(LogOrderHeader) + sizeof(data), sizeToAllocate);
+    EXPECT_EQ(sizeToAllocate, logWriteContext.GetLogSize());
+    LogOrderHeader* header = reinterpret_cast<LogOrderHeader*>(logWriteContext.GetBuffer());
+    EXPECT_EQ(LOG_ORDER_VALID_MARK, (uint32_t)header->mark);
+    EXPECT_EQ(7U, header->order);
+    EXPECT_EQ(0, memcmp(data, logWriteContext.GetBuffer() + sizeof(LogOrderHeader), sizeof(data)));
+}
 } // namespace pos
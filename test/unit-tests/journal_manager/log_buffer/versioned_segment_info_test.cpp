@@ -35,6 +35,9 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <thread>
+#include <vector>
+
 using testing::_;
 using testing::NiceMock;
 using testing::Return;
@@ -104,4 +107,55 @@ TEST(VersionedSegmentInfo, IncreaseOccupiedStripeCount_testIfOccupiedStripeCount
     EXPECT_EQ(true, versionedSegInfo.GetChangedOccupiedStripeCount().empty());
 }
 
+TEST(VersionedSegmentInfo, IncreaseValidBlockCount_testIfChangesFromManyThreadsAreMerged)
+{
+    // Given
+    VersionedSegmentInfo versionedSegInfo;
+    const int numThreads = 8;
+    const int numUpdates = 1000;
+
+    // When
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < numThreads; thread++)
+    {
+        threads.emplace_back([&versionedSegInfo, numUpdates](void)
+        {
+            for (int update = 0; update < numUpdates; update++)
+            {
+                versionedSegInfo.IncreaseValidBlockCount(7, 2);
+                versionedSegInfo.DecreaseValidBlockCount(7, 1);
+                versionedSegInfo.IncreaseOccupiedStripeCount(7);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Then
+    EXPECT_EQ(numThreads * numUpdates, versionedSegInfo.GetChangedValidBlockCount()[7]);
+    EXPECT_EQ((uint32_t)(numThreads * numUpdates), versionedSegInfo.GetChangedOccupiedStripeCount()[7]);
+}
+
+TEST(VersionedSegmentInfo, ResetValidBlockCount_testIfOnlyTheResetSegmentIsDropped)
+{
+    // Given
+    VersionedSegmentInfo versionedSegInfo;
+    versionedSegInfo.IncreaseValidBlockCount(1, 4);
+    versionedSegInfo.IncreaseValidBlockCount(2, 5);
+    versionedSegInfo.IncreaseOccupiedStripeCount(2);
+
+    // When
+    versionedSegInfo.ResetValidBlockCount(1);
+    versionedSegInfo.ResetValidBlockCount(2);
+
+    // Then
+    auto changedValidCount = versionedSegInfo.GetChangedValidBlockCount();
+    auto changedOccupiedCount = versionedSegInfo.GetChangedOccupiedStripeCount();
+    EXPECT_EQ(true, changedValidCount.empty());
+    EXPECT_EQ(1U, changedOccupiedCount.size());
+    EXPECT_EQ(1U, changedOccupiedCount[2]);
+}
+
 } // namespace pos
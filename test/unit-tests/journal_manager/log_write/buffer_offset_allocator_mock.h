@@ -14,10 +14,13 @@ public:
     using BufferOffsetAllocator::BufferOffsetAllocator;
     MOCK_METHOD(void, Init, (LogGroupReleaser * releaser, JournalConfiguration* journalConfiguration), (override));
     MOCK_METHOD(void, Dispose, (), (override));
-    MOCK_METHOD(int, AllocateBuffer, (uint32_t logSize, uint64_t& allocatedOffset), (override));
+    MOCK_METHOD(int, AllocateBuffer, (uint32_t logSize, uint64_t& allocatedOffset, int stream, uint64_t* order), (override));
+    MOCK_METHOD(int, GetLogStream, (int volumeId), (override));
     MOCK_METHOD(void, LogWriteCanceled, (int logGroupId), (override));
+    MOCK_METHOD(bool, SealActiveLogGroup, (), (override));
     MOCK_METHOD(void, LogFilled, (int logGroupId, const MapList& dirty), (override));
     MOCK_METHOD(void, LogBufferReseted, (int logGroupId), (override));
+    MOCK_METHOD(uint64_t, GetNumLogsAdded, (), (override));
     MOCK_METHOD(LogGroupStatus, GetBufferStatus, (int logGroupId), (override));
     MOCK_METHOD(uint32_t, GetSequenceNumber, (int logGroupId), (override));
     MOCK_METHOD(int, GetLogGroupId, (uint64_t fileOffset), (override));
@@ -8,6 +8,7 @@
 #include "test/unit-tests/journal_manager/config/journal_configuration_mock.h"
 #include "test/unit-tests/journal_manager/log_write/log_group_buffer_status_mock.h"
 
+using testing::_;
 using testing::NiceMock;
 using ::testing::Return;
 
@@ -156,6 +157,181 @@ TEST(BufferOffsetAllocator, Allocate_AllocateBufferWithCheckpoint)
     delete allocator;
 }
 
+TEST(BufferOffsetAllocator, SealActiveLogGroup_testIfActiveGroupIsMarkedFullBeforeFilledUp)
+{
+    // Given
+    NiceMock<MockLogGroupReleaser> releaser;
+    NiceMock<MockJournalConfiguration> config;
+    BufferOffsetAllocator allocator;
+
+    ON_CALL(config, GetNumLogGroups).WillByDefault(Return(numLogGroups));
+    ON_CALL(config, GetLogBufferSize).WillByDefault(Return(logBufferSize));
+    ON_CALL(config, GetLogGroupSize).WillByDefault(Return(logBufferSize / numLogGroups));
+    ON_CALL(config, GetMetaPageSize).WillByDefault(Return(metaPageSize));
+
+    uint64_t startOffset = 0;
+    for (int groupId = 0; groupId < numLogGroups; groupId++)
+    {
+        LogGroupLayout groupLayout;
+        groupLayout.startOffset = startOffset;
+        groupLayout.maxOffset = startOffset + (logBufferSize / numLogGroups);
+        groupLayout.footerStartOffset = groupLayout.maxOffset;
+        ON_CALL(config, GetLogBufferLayout(groupId)).WillByDefault(Return(groupLayout));
+        startOffset = groupLayout.maxOffset;
+    }
+    allocator.Init(&releaser, &config);
+
+    // Then: Empty log group should not be sealed
+    EXPECT_FALSE(allocator.SealActiveLogGroup());
+
+    uint64_t offset = 0;
+    EXPECT_EQ(allocator.AllocateBuffer(64, offset), 0);
+    EXPECT_EQ(allocator.GetLogGroupId(offset), 0);
+
+    // When: The active log group is sealed after its only log is filled
+    MapList dirty;
+    allocator.LogFilled(0, dirty);
+    EXPECT_CALL(releaser, MarkLogGroupFull(0, _)).Times(1);
+    EXPECT_TRUE(allocator.SealActiveLogGroup());
+
+    // Then: Next log should be allocated from the next log group
+    EXPECT_EQ(allocator.AllocateBuffer(64, offset), 0);
+    EXPECT_EQ(allocator.GetLogGroupId(offset), 1);
+
+    // Then: Log group should not be sealed while the next one is not released
+    EXPECT_FALSE(allocator.SealActiveLogGroup());
+}
+
+TEST(BufferOffsetAllocator, AllocateBuffer_testIfLogStreamsSwitchLogGroupsInRows)
+{
+    // Given: Two log streams share four log groups
+    NiceMock<MockLogGroupReleaser> releaser;
+    NiceMock<MockJournalConfiguration> config;
+    BufferOffsetAllocator allocator;
+
+    int numGroups = 4;
+    uint64_t groupSize = 2 * metaPageSize;
+    ON_CALL(config, GetNumLogGroups).WillByDefault(Return(numGroups));
+    ON_CALL(config, GetNumLogStreams).WillByDefault(Return(2));
+    ON_CALL(config, GetLogBufferSize).WillByDefault(Return(groupSize * numGroups));
+    ON_CALL(config, GetLogGroupSize).WillByDefault(Return(groupSize));
+    ON_CALL(config, GetMetaPageSize).WillByDefault(Return(metaPageSize));
+    for (int groupId = 0; groupId < numGroups; groupId++)
+    {
+        LogGroupLayout groupLayout;
+        groupLayout.startOffset = groupId * groupSize;
+        groupLayout.maxOffset = groupLayout.startOffset + groupSize;
+        groupLayout.footerStartOffset = groupLayout.maxOffset;
+        ON_CALL(config, GetLogBufferLayout(groupId)).WillByDefault(Return(groupLayout));
+    }
+    allocator.Init(&releaser, &config);
+
+    // When: Each stream allocates a log
+    uint64_t offset = 0;
+    int stream = allocator.GetLogStream(3);
+    EXPECT_EQ(allocator.AllocateBuffer(64, offset, stream), 0);
+    EXPECT_EQ(allocator.GetLogGroupId(offset), 1);
+    EXPECT_EQ(allocator.AllocateBuffer(64, offset, 0), 0);
+    EXPECT_EQ(allocator.GetLogGroupId(offset), 0);
+
+    // Then: The groups of the row are ordered by id
+    EXPECT_EQ(allocator.GetSequenceNumber(0), 0U);
+    EXPECT_EQ(allocator.GetSequenceNumber(1), 1U);
+
+    // When: The row is sealed
+    MapList dirty;
+    allocator.LogFilled(0, dirty);
+    allocator.LogFilled(1, dirty);
+    EXPECT_CALL(releaser, MarkLogGroupFull(0, 0)).Times(1);
+    EXPECT_CALL(releaser, MarkLogGroupFull(1, 1)).Times(1);
+    EXPECT_TRUE(allocator.SealActiveLogGroup());
+
+    // Then: Both streams move to the next row
+    EXPECT_EQ(allocator.AllocateBuffer(64, offset, 1), 0);
+    EXPECT_EQ(allocator.GetLogGroupId(offset), 3);
+    EXPECT_EQ(allocator.GetSequenceNumber(3), 3U);
+}
+
+TEST(BufferOffsetAllocator, AllocateBuffer_testIfLogSpillsToIdleGroupOfRow)
+{
+    // Given: Two log streams share four log groups of a single meta page
+    NiceMock<MockLogGroupReleaser> releaser;
+    NiceMock<MockJournalConfiguration> config;
+    BufferOffsetAllocator allocator;
+
+    int numGroups = 4;
+    uint64_t groupSize = metaPageSize;
+    ON_CALL(config, GetNumLogGroups).WillByDefault(Return(numGroups));
+    ON_CALL(config, GetNumLogStreams).WillByDefault(Return(2));
+    ON_CALL(config, GetLogBufferSize).WillByDefault(Return(groupSize * numGroups));
+    ON_CALL(config, GetLogGroupSize).WillByDefault(Return(groupSize));
+    ON_CALL(config, GetMetaPageSize).WillByDefault(Return(metaPageSize));
+    for (int groupId = 0; groupId < numGroups; groupId++)
+    {
+        LogGroupLayout groupLayout;
+        groupLayout.startOffset = groupId * groupSize;
+        groupLayout.maxOffset = groupLayout.startOffset + groupSize;
+        groupLayout.footerStartOffset = groupLayout.maxOffset;
+        ON_CALL(config, GetLogBufferLayout(groupId)).WillByDefault(Return(groupLayout));
+    }
+    allocator.Init(&releaser, &config);
+
+    // When: Stream 0 fills its group while stream 1 stays idle
+    uint64_t offset = 0;
+    EXPECT_EQ(allocator.AllocateBuffer(metaPageSize, offset, 0), 0);
+    EXPECT_EQ(allocator.GetLogGroupId(offset), 0);
+    EXPECT_EQ(allocator.AllocateBuffer(64, offset, 0), 0);
+
+    // Then: The next log of stream 0 takes the idle group instead of sealing the row
+    EXPECT_EQ(allocator.GetLogGroupId(offset), 1);
+    EXPECT_EQ(allocator.GetSequenceNumber(1), 1U);
+
+    // When: Every group of the row is full
+    EXPECT_EQ(allocator.AllocateBuffer(metaPageSize, offset, 0), 0);
+
+    // Then: The row is switched
+    EXPECT_EQ(allocator.GetLogGroupId(offset), 2);
+    EXPECT_EQ(allocator.GetSequenceNumber(2), 2U);
+}
+
+TEST(BufferOffsetAllocator, AllocateBuffer_testIfOrderIncreasesAcrossRows)
+{
+    // Given: Two log streams share four log groups of a single meta page
+    NiceMock<MockLogGroupReleaser> releaser;
+    NiceMock<MockJournalConfiguration> config;
+    BufferOffsetAllocator allocator;
+
+    int numGroups = 4;
+    uint64_t groupSize = metaPageSize;
+    ON_CALL(config, GetNumLogGroups).WillByDefault(Return(numGroups));
+    ON_CALL(config, GetNumLogStreams).WillByDefault(Return(2));
+    ON_CALL(config, GetLogBufferSize).WillByDefault(Return(groupSize * numGroups));
+    ON_CALL(config, GetLogGroupSize).WillByDefault(Return(groupSize));
+    ON_CALL(config, GetMetaPageSize).WillByDefault(Return(metaPageSize));
+    for (int groupId = 0; groupId < numGroups; groupId++)
+    {
+        LogGroupLayout groupLayout;
+        groupLayout.startOffset = groupId * groupSize;
+        groupLayout.maxOffset = groupLayout.startOffset + groupSize;
+        groupLayout.footerStartOffset = groupLayout.maxOffset;
+        ON_CALL(config, GetLogBufferLayout(groupId)).WillByDefault(Return(groupLayout));
+    }
+    allocator.Init(&releaser, &config);
+
+    // When: Both streams fill the first row, and stream 1 allocates from the next one
+    uint64_t offset = 0;
+    uint64_t order[3] = {0, };
+    EXPECT_EQ(allocator.AllocateBuffer(metaPageSize, offset, 0, &order[0]), 0);
+    EXPECT_EQ(allocator.AllocateBuffer(metaPageSize, offset, 1, &order[1]), 0);
+    EXPECT_EQ(allocator.AllocateBuffer(64, offset, 1, &order[2]), 0);
+
+    // Then: Every log takes an order, which does not decrease with the row
+    EXPECT_EQ(allocator.GetLogGroupId(offset), 3);
+    EXPECT_NE(order[0], 0U);
+    EXPECT_LE(order[0], order[1]);
+    EXPECT_LE(order[1], order[2]);
+}
+
 TEST(BufferOffsetAllocator, LogWriteCanceled_testWithAllocatedBuffer)
 {
     // Given
@@ -12,6 +12,7 @@ class MockLogGroupBufferStatus : public LogGroupBufferStatus
 {
 public:
     using LogGroupBufferStatus::LogGroupBufferStatus;
+    MOCK_METHOD(void, Seal, (), (override));
     MOCK_METHOD(bool, TryToSetFull, (), (override));
     MOCK_METHOD(void, LogFilled, (), (override));
 };
@@ -2,6 +2,11 @@
 
 #include <gtest/gtest.h>
 
+#include <map>
+#include <set>
+#include <thread>
+#include <vector>
+
 #include "src/include/pos_event_id.h"
 
 namespace pos
@@ -224,4 +229,116 @@ TEST(LogGroupBufferStatus, TryToSetFull_testIfSetFullFailWhenNotWaitingToBeFille
     // Then: TryToSetFull should be succeed
     EXPECT_EQ(status.TryToSetFull(), true);
 }
+
+TEST(LogGroupBufferStatus, Seal_testIfAllocFailsAndSetFullSucceedsAfterSealed)
+{
+    // Given: Log group with one filled log
+    uint64_t maxOffset = 1024 * 1024;
+    LogGroupBufferStatus status(0, maxOffset, META_PAGE_SIZE);
+    status.SetActive(0);
+
+    uint64_t offset = 0;
+    EXPECT_EQ(status.TryToAllocate(64, offset), 0);
+    status.LogFilled();
+
+    // When: Log group is sealed before it is full
+    status.Seal();
+
+    // Then: Allocation should fail, and the log group can be set full
+    EXPECT_TRUE(status.IsSealed());
+    EXPECT_EQ(status.TryToAllocate(64, offset), EID(JOURNAL_LOG_GROUP_FULL));
+    EXPECT_EQ(status.GetNextOffset(), 64);
+    EXPECT_TRUE(status.TryToSetFull());
+    EXPECT_EQ(status.GetStatus(), LogGroupStatus::FULL);
+}
+
+TEST(LogGroupBufferStatus, TryToAllocate_testIfConcurrentAllocationsDoNotOverlap)
+{
+    // Given: Initialized buffer status which can hold 4 meta pages
+    uint64_t startOffset = 0;
+    uint64_t maxOffset = META_PAGE_SIZE * 4;
+    LogGroupBufferStatus status(startOffset, maxOffset, META_PAGE_SIZE);
+
+    uint32_t logSize = 52;
+    uint64_t numLogsPerMetaPage = META_PAGE_SIZE / logSize;
+
+    // When: Several threads allocate logs until the group is full
+    int numThreads = 4;
+    std::vector<std::vector<uint64_t>> allocated(numThreads);
+    std::vector<std::thread> threads;
+    for (int threadId = 0; threadId < numThreads; threadId++)
+    {
+        threads.push_back(std::thread([&, threadId]() {
+            uint64_t offset = 0;
+            while (status.TryToAllocate(logSize, offset) == 0)
+            {
+                allocated[threadId].push_back(offset);
+            }
+        }));
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    // Then: Every log should get its own offset within a single meta page
+    std::set<uint64_t> offsets;
+    for (auto& list : allocated)
+    {
+        for (auto offset : list)
+        {
+            EXPECT_EQ(offset / META_PAGE_SIZE, (offset + logSize - 1) / META_PAGE_SIZE);
+            EXPECT_TRUE(offsets.insert(offset).second);
+        }
+    }
+    EXPECT_EQ(offsets.size(), numLogsPerMetaPage * 4);
+    EXPECT_EQ(status.GetNumLogsAdded(), numLogsPerMetaPage * 4);
+    EXPECT_TRUE(status.IsSealed());
+}
+
+TEST(LogGroupBufferStatus, TryToAllocate_testIfOrderDoesNotDecreaseWithOffset)
+{
+    // Given: Initialized buffer status which can hold 4 meta pages
+    uint64_t maxOffset = META_PAGE_SIZE * 4;
+    LogGroupBufferStatus status(0, maxOffset, META_PAGE_SIZE);
+
+    uint32_t logSize = 52;
+
+    // When: Several threads allocate logs with their orders until the group is full
+    int numThreads = 4;
+    std::vector<std::vector<std::pair<uint64_t, uint64_t>>> allocated(numThreads);
+    std::vector<std::thread> threads;
+    for (int threadId = 0; threadId < numThreads; threadId++)
+    {
+        threads.push_back(std::thread([&, threadId]() {
+            uint64_t offset = 0;
+            uint64_t order = 0;
+            while (status.TryToAllocate(logSize, offset, &order) == 0)
+            {
+                allocated[threadId].push_back({offset, order});
+            }
+        }));
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    // Then: A log placed behind another one never has a smaller order
+    std::map<uint64_t, uint64_t> orderOfOffset;
+    for (auto& list : allocated)
+    {
+        for (auto& log : list)
+        {
+            EXPECT_NE(log.second, 0U);
+            orderOfOffset[log.first] = log.second;
+        }
+    }
+    uint64_t lastOrder = 0;
+    for (auto& it : orderOfOffset)
+    {
+        EXPECT_LE(lastOrder, it.second);
+        lastOrder = it.second;
+    }
+}
 } // namespace pos
@@ -24,10 +24,16 @@
 #include "test/unit-tests/mapper/i_stripemap_mock.h"
 #include "test/unit-tests/mapper/i_vsamap_mock.h"
 
+using testing::_;
+using testing::DoAll;
 using testing::InSequence;
+using testing::IsNull;
 using testing::NiceMock;
+using testing::NotNull;
 using testing::Return;
 using testing::ReturnRef;
+using testing::SaveArg;
+using testing::SetArgReferee;
 
 namespace pos
 {
@@ -175,6 +181,42 @@ TEST_F(LogWriteHandlerTestFixture, AddLog_testIfLogWritten)
     delete context;
 }
 
+TEST_F(LogWriteHandlerTestFixture, AddLog_testIfLogIsNotOrderedWithSingleLogStream)
+{
+    // Given: Log write handler is initialized with a single log stream
+    ON_CALL(*config, GetNumLogStreams).WillByDefault(Return(1));
+    logWriteHandler->Init(bufferAllocator, logBuffer, config, nullptr, 0);
+    EXPECT_CALL(*logBuffer, WriteLog).WillOnce(Return(0));
+
+    // Then: Log should be written without its order
+    EXPECT_CALL(*bufferAllocator, AllocateBuffer(_, _, _, IsNull())).WillOnce(Return(0));
+    NiceMock<MockLogWriteContext>* context = new NiceMock<MockLogWriteContext>;
+    EXPECT_CALL(*context, SetLogOrdered).Times(0);
+
+    // When: Log is added
+    EXPECT_TRUE(logWriteHandler->AddLog(context) == 0);
+
+    delete context;
+}
+
+TEST_F(LogWriteHandlerTestFixture, AddLog_testIfLogIsOrderedWithSeveralLogStreams)
+{
+    // Given: Log write handler is initialized with two log streams
+    ON_CALL(*config, GetNumLogStreams).WillByDefault(Return(2));
+    logWriteHandler->Init(bufferAllocator, logBuffer, config, nullptr, 0);
+    EXPECT_CALL(*logBuffer, WriteLog).WillOnce(Return(0));
+
+    // Then: Log should be written with the order taken with its offset
+    EXPECT_CALL(*bufferAllocator, AllocateBuffer(_, _, _, NotNull())).WillOnce(Return(0));
+    NiceMock<MockLogWriteContext>* context = new NiceMock<MockLogWriteContext>;
+    EXPECT_CALL(*context, SetLogOrdered).Times(1);
+
+    // When: Log is added
+    EXPECT_TRUE(logWriteHandler->AddLog(context) == 0);
+
+    delete context;
+}
+
 TEST_F(LogWriteHandlerTestFixture, AddLog_testBufferAllocFailedWithPositiveReturn)
 {
     // Given: Log write handler is initialized
@@ -322,4 +364,38 @@ TEST_F(LogWriteHandlerTestFixture, LogBufferReseted_testIfWaitingListIsRestarted
 
     delete waitingContext;
 }
+TEST_F(LogWriteHandlerTestFixture, AddLog_testIfLogsArrivingDuringWriteAreGroupCommitted)
+{
+    // Given: Group commit is enabled
+    ON_CALL(*config, GetGroupCommitMaxBatchSize).WillByDefault(Return(4096));
+    ON_CALL(*config, GetGroupCommitWindowInUsec).WillByDefault(Return(1000000));
+    logWriteHandler->Init(bufferAllocator, logBuffer, config, nullptr, 0);
+
+    NiceMock<MockLogWriteContext> contexts[3];
+    for (auto& context : contexts)
+    {
+        ON_CALL(context, GetLogSize).WillByDefault(Return(64));
+    }
+    EXPECT_CALL(*bufferAllocator, AllocateBuffer)
+        .WillOnce(DoAll(SetArgReferee<1>(0), Return(0)))
+        .WillOnce(DoAll(SetArgReferee<1>(64), Return(0)))
+        .WillOnce(DoAll(SetArgReferee<1>(128), Return(0)));
+
+    // When: The first log is added while nothing is in flight
+    FnCompleteMetaFileIo firstLogWritten;
+    EXPECT_CALL(*logBuffer, WriteLogs(_, 0, _))
+        .WillOnce(DoAll(SaveArg<2>(&firstLogWritten), Return(0)));
+    EXPECT_EQ(0, logWriteHandler->AddLog(&contexts[0]));
+
+    // Then: The next logs wait for that write, and go out together when it completes
+    EXPECT_CALL(*logBuffer, WriteLogs(_, 64, _))
+        .WillOnce([](std::vector<LogWriteContext*>& logs, uint64_t offset, FnCompleteMetaFileIo func) {
+            EXPECT_EQ(2, logs.size());
+            return 0;
+        });
+    EXPECT_EQ(0, logWriteHandler->AddLog(&contexts[1]));
+    EXPECT_EQ(0, logWriteHandler->AddLog(&contexts[2]));
+
+    firstLogWritten(new NiceMock<MockLogWriteIoContext>);
+}
 } // namespace pos
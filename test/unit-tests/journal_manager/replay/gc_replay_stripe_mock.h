@@ -14,6 +14,7 @@ public:
     using GcReplayStripe::GcReplayStripe;
     MOCK_METHOD(void, AddLog, (ReplayLog replayLog), (override));
     MOCK_METHOD(int, Replay, (), (override));
+    MOCK_METHOD(bool, IsReplayable, (), (override));
 };
 
 } // namespace pos
@@ -8,11 +8,19 @@
 #include "test/unit-tests/journal_manager/replay/replay_log_list_mock.h"
 #include "test/unit-tests/journal_manager/replay/replay_progress_reporter_mock.h"
 
+using ::testing::_;
 using ::testing::NiceMock;
 using ::testing::Return;
 
 namespace pos
 {
+static int
+CompleteChunkRead(int groupId, uint64_t offset, uint64_t size, void* buffer, FnCompleteMetaFileIo func)
+{
+    func(new AsyncMetaFileIoCtx());
+    return 0;
+}
+
 TEST(ReadLogBuffer, Start_testIfReadSuccessWhenLogIsReadFromAllLogGroups)
 {
     // Given
@@ -27,8 +35,9 @@ TEST(ReadLogBuffer, Start_testIfReadSuccessWhenLogIsReadFromAllLogGroups)
     // When
     ON_CALL(config, GetNumLogGroups).WillByDefault(Return(2));
     ON_CALL(config, GetLogGroupSize).WillByDefault(Return(16 * 1024));
+    ON_CALL(config, GetMetaPageSize).WillByDefault(Return(4032));
 
-    EXPECT_CALL(logBuffer, ReadLogBuffer).WillRepeatedly(Return(0));
+    EXPECT_CALL(logBuffer, ReadLogBufferChunk).WillRepeatedly(CompleteChunkRead);
     EXPECT_CALL(*parser, GetLogs).WillRepeatedly(Return(0));
 
     EXPECT_CALL(replayLogList, IsEmpty).WillOnce(Return(false));
@@ -53,9 +62,10 @@ TEST(ReadLogBuffer, Start_testIfReadSuccessWhenLogBufferReadFails)
     // When
     ON_CALL(config, GetNumLogGroups).WillByDefault(Return(2));
     ON_CALL(config, GetLogGroupSize).WillByDefault(Return(16 * 1024));
+    ON_CALL(config, GetMetaPageSize).WillByDefault(Return(4032));
 
     int retCode = -1000;
-    EXPECT_CALL(logBuffer, ReadLogBuffer).WillOnce(Return(0)).WillOnce(Return(retCode));
+    EXPECT_CALL(logBuffer, ReadLogBufferChunk).WillOnce(CompleteChunkRead).WillOnce(Return(retCode));
     EXPECT_CALL(*parser, GetLogs).WillRepeatedly(Return(0));
 
     int result = readLogBufferTask.Start();
@@ -78,9 +88,10 @@ TEST(ReadLogBuffer, Start_testIfReadSuccessWhenLogBufferParseFails)
     // When
     ON_CALL(config, GetNumLogGroups).WillByDefault(Return(2));
     ON_CALL(config, GetLogGroupSize).WillByDefault(Return(16 * 1024));
+    ON_CALL(config, GetMetaPageSize).WillByDefault(Return(4032));
 
     int retCode = -3000;
-    EXPECT_CALL(logBuffer, ReadLogBuffer).WillRepeatedly(Return(0));
+    EXPECT_CALL(logBuffer, ReadLogBufferChunk).WillRepeatedly(CompleteChunkRead);
     EXPECT_CALL(*parser, GetLogs).WillOnce(Return(0)).WillOnce(Return(retCode));
 
     int result = readLogBufferTask.Start();
@@ -103,8 +114,9 @@ TEST(ReadLogBuffer, Start_testIfReadSuccessWhenParsedLogListIsEmpty)
     // When
     ON_CALL(config, GetNumLogGroups).WillByDefault(Return(2));
     ON_CALL(config, GetLogGroupSize).WillByDefault(Return(16 * 1024));
+    ON_CALL(config, GetMetaPageSize).WillByDefault(Return(4032));
 
-    EXPECT_CALL(logBuffer, ReadLogBuffer).WillRepeatedly(Return(0));
+    EXPECT_CALL(logBuffer, ReadLogBufferChunk).WillRepeatedly(CompleteChunkRead);
     EXPECT_CALL(*parser, GetLogs).WillRepeatedly(Return(0));
 
     EXPECT_CALL(replayLogList, IsEmpty).WillOnce(Return(true));
@@ -115,6 +127,74 @@ TEST(ReadLogBuffer, Start_testIfReadSuccessWhenParsedLogListIsEmpty)
     EXPECT_TRUE(result > 0);
 }
 
+TEST(ReadLogBuffer, Start_testIfLogGroupIsReadAndParsedByChunks)
+{
+    // Given
+    NiceMock<MockJournalConfiguration> config;
+    NiceMock<MockJournalLogBuffer> logBuffer;
+    NiceMock<MockReplayLogList> replayLogList;
+    NiceMock<MockReplayProgressReporter> progressReporter;
+    NiceMock<MockLogBufferParser>* parser = new NiceMock<MockLogBufferParser>;
+
+    ReadLogBuffer readLogBufferTask(&config, &logBuffer, replayLogList, &progressReporter, parser);
+
+    // When: a chunk is 64 meta pages, so a log group of 160 pages is read by three chunks
+    uint64_t metaPageSize = 128;
+    uint64_t groupSize = 160 * metaPageSize;
+    uint64_t chunkSize = 64 * metaPageSize;
+    ON_CALL(config, GetNumLogGroups).WillByDefault(Return(2));
+    ON_CALL(config, GetLogGroupSize).WillByDefault(Return(groupSize));
+    ON_CALL(config, GetMetaPageSize).WillByDefault(Return(metaPageSize));
+
+    for (int groupId = 0; groupId < 2; groupId++)
+    {
+        EXPECT_CALL(logBuffer, ReadLogBufferChunk(groupId, 0, chunkSize, _, _)).WillOnce(CompleteChunkRead);
+        EXPECT_CALL(logBuffer, ReadLogBufferChunk(groupId, chunkSize, chunkSize, _, _)).WillOnce(CompleteChunkRead);
+        EXPECT_CALL(logBuffer, ReadLogBufferChunk(groupId, 2 * chunkSize, groupSize - 2 * chunkSize, _, _)).WillOnce(CompleteChunkRead);
+    }
+    EXPECT_CALL(*parser, GetLogs(_, chunkSize, _)).Times(4).WillRepeatedly(Return(0));
+    EXPECT_CALL(*parser, GetLogs(_, groupSize - 2 * chunkSize, _)).Times(2).WillRepeatedly(Return(0));
+    EXPECT_CALL(replayLogList, IsEmpty).WillOnce(Return(false));
+
+    int result = readLogBufferTask.Start();
+
+    // Then
+    EXPECT_EQ(result, 0);
+}
+
+TEST(ReadLogBuffer, Start_testIfReadFailsWhenChunkReadIsCompletedWithError)
+{
+    // Given
+    NiceMock<MockJournalConfiguration> config;
+    NiceMock<MockJournalLogBuffer> logBuffer;
+    NiceMock<MockReplayLogList> replayLogList;
+    NiceMock<MockReplayProgressReporter> progressReporter;
+    NiceMock<MockLogBufferParser>* parser = new NiceMock<MockLogBufferParser>;
+
+    ReadLogBuffer readLogBufferTask(&config, &logBuffer, replayLogList, &progressReporter, parser);
+
+    // When
+    ON_CALL(config, GetNumLogGroups).WillByDefault(Return(2));
+    ON_CALL(config, GetLogGroupSize).WillByDefault(Return(16 * 1024));
+    ON_CALL(config, GetMetaPageSize).WillByDefault(Return(4032));
+
+    int error = 1234;
+    EXPECT_CALL(logBuffer, ReadLogBufferChunk).WillRepeatedly(
+        [&](int groupId, uint64_t offset, uint64_t size, void* buffer, FnCompleteMetaFileIo func)
+        {
+            AsyncMetaFileIoCtx* ctx = new AsyncMetaFileIoCtx();
+            ctx->error = error;
+            func(ctx);
+            return 0;
+        });
+    EXPECT_CALL(*parser, GetLogs).Times(0);
+
+    int result = readLogBufferTask.Start();
+
+    // Then
+    EXPECT_EQ(result, -1 * error);
+}
+
 TEST(ReadLogBuffer, GetId_testIfExecutedSuccessfully)
 {
     // Given
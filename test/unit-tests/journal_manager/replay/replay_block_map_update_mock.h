@@ -13,6 +13,7 @@ class MockReplayBlockMapUpdate : public ReplayBlockMapUpdate
 public:
     using ReplayBlockMapUpdate::ReplayBlockMapUpdate;
     MOCK_METHOD(int, Replay, (), (override));
+    MOCK_METHOD(int, ReplayMap, (), (override));
 };
 
 } // namespace pos
@@ -215,6 +215,49 @@ TEST(ReplayBlockMapUpdate, Replay_testIfOldBlockIsNotInvalidatedWhenOldVsaIsUnma
     EXPECT_EQ(result, 0);
 }
 
+TEST(ReplayBlockMapUpdate, Replay_testIfSegmentInfoIsReplayedAfterMapIsReplayedSeparately)
+{
+    // Given
+    NiceMock<MockIVSAMap> vsaMap;
+    NiceMock<MockISegmentCtx> segmentCtx;
+    NiceMock<MockStripeReplayStatus> stripeReplayStatus;
+    PendingStripeList list;
+    NiceMock<MockActiveWBStripeReplayer> wbStripeReplayer(list);
+
+    int volId = 2;
+    BlkAddr startRba = 100;
+    VirtualBlkAddr startVsa = {
+        .stripeId = 20,
+        .offset = 20};
+    uint32_t numBlks = 10;
+    bool replaySegmentInfo = true;
+
+    ReplayBlockMapUpdate blockMapUpdateEvent(&vsaMap, &segmentCtx,
+        &stripeReplayStatus, &wbStripeReplayer,
+        volId, startRba, startVsa, numBlks, replaySegmentInfo);
+
+    VirtualBlkAddr oldVsa = {
+        .stripeId = 200,
+        .offset = 0};
+    ON_CALL(vsaMap, GetVSAWithSyncOpen).WillByDefault(Return(oldVsa));
+
+    // When: Only block map is replayed
+    // Then: Map should be updated without touching segment info
+    EXPECT_CALL(vsaMap, SetVSAsWithSyncOpen).Times(numBlks);
+    EXPECT_CALL(segmentCtx, InvalidateBlks).Times(0);
+    EXPECT_CALL(segmentCtx, ValidateBlks).Times(0);
+    EXPECT_EQ(blockMapUpdateEvent.ReplayMap(), 0);
+
+    // When: The event is replayed after that
+    // Then: Segment info should be updated without replaying block map again
+    EXPECT_CALL(vsaMap, GetVSAWithSyncOpen).Times(0);
+    EXPECT_CALL(vsaMap, SetVSAsWithSyncOpen).Times(0);
+    EXPECT_CALL(segmentCtx, InvalidateBlks).Times(numBlks);
+    EXPECT_CALL(segmentCtx, ValidateBlks).Times(numBlks);
+    EXPECT_CALL(stripeReplayStatus, BlockWritten).Times(numBlks);
+    EXPECT_EQ(blockMapUpdateEvent.Replay(), 0);
+}
+
 TEST(ReplayBlockMapUpdate, GetType_testIfReturnTypeCorrectly)
 {
     ReplayBlockMapUpdate blockMapUpdateEvent(nullptr, nullptr, nullptr, nullptr,
@@ -15,6 +15,7 @@ public:
     MOCK_METHOD(void, SetLogGroupFooter, (uint32_t seqNum, LogGroupFooter footer), (override));
     MOCK_METHOD(void, EraseReplayLogGroup, (uint32_t seqNum), (override));
     MOCK_METHOD(ReplayLogGroup, PopReplayLogGroup, (), (override));
+    MOCK_METHOD(bool, ApplyLogOrder, (), (override));
 };
 
 } // namespace pos
@@ -167,6 +167,52 @@ TEST(ReplayLogList, IsEmpty_testIfReturnFalseWhenLogsAreAdded)
     EXPECT_TRUE(logList.IsEmpty() == false);
 }
 
+TEST(ReplayLogList, ApplyLogOrder_testIfLogOrderIsUsedAsTime)
+{
+    // Given: Two logs of different log groups, written in the reverse order of the groups
+    NiceMock<MockLogHandlerInterface> log[2];
+    ON_CALL(log[0], GetSeqNum).WillByDefault(Return(0));
+    ON_CALL(log[0], GetOrder).WillByDefault(Return(20));
+    ON_CALL(log[1], GetSeqNum).WillByDefault(Return(1));
+    ON_CALL(log[1], GetOrder).WillByDefault(Return(10));
+
+    ReplayLogList logList;
+    logList.AddLog(&log[0]);
+    logList.AddLog(&log[1]);
+
+    // When
+    EXPECT_TRUE(logList.ApplyLogOrder());
+
+    // Then: The time of each log is its order, not the order it is parsed
+    ReplayLogGroup logGroup0 = logList.PopReplayLogGroup();
+    EXPECT_EQ(logGroup0.logs.front().time, 20);
+    ReplayLogGroup logGroup1 = logList.PopReplayLogGroup();
+    EXPECT_EQ(logGroup1.logs.front().time, 10);
+}
+
+TEST(ReplayLogList, ApplyLogOrder_testIfParseOrderIsKeptWhenAnyLogHasNoOrder)
+{
+    // Given: A log with its order, and a log without it
+    NiceMock<MockLogHandlerInterface> log[2];
+    ON_CALL(log[0], GetSeqNum).WillByDefault(Return(0));
+    ON_CALL(log[0], GetOrder).WillByDefault(Return(20));
+    ON_CALL(log[1], GetSeqNum).WillByDefault(Return(1));
+    ON_CALL(log[1], GetOrder).WillByDefault(Return(0));
+
+    ReplayLogList logList;
+    logList.AddLog(&log[0]);
+    logList.AddLog(&log[1]);
+
+    // When
+    EXPECT_FALSE(logList.ApplyLogOrder());
+
+    // Then: Every log keeps the time it is parsed at
+    ReplayLogGroup logGroup0 = logList.PopReplayLogGroup();
+    EXPECT_EQ(logGroup0.logs.front().time, 0);
+    ReplayLogGroup logGroup1 = logList.PopReplayLogGroup();
+    EXPECT_EQ(logGroup1.logs.front().time, 1);
+}
+
 TEST(ReplayLogList, SetLogGroupFooter_testIfFooterUpdatedCorrectly)
 {
     // Given
@@ -14,6 +14,7 @@ public:
     using ReplayStripe::ReplayStripe;
     MOCK_METHOD(void, AddLog, (ReplayLog replayLog), (override));
     MOCK_METHOD(int, Replay, (), (override));
+    MOCK_METHOD(bool, IsReplayable, (), (override));
 };
 
 } // namespace pos
@@ -73,4 +73,22 @@ TEST(TaskProgress, GetWeight_testIfCorrectWeightIsReturned)
     TaskProgress progress(45);
     EXPECT_EQ(progress.GetWeight(), 45);
 }
+
+TEST(TaskProgress, ItemsProcessed_testIfProcessedItemsAreAccumulated)
+{
+    TaskProgress progress(100);
+    progress.Start(1);
+
+    progress.ItemsProcessed(10);
+    progress.ItemsProcessed(20);
+
+    EXPECT_EQ(progress.GetNumItemsProcessed(), 30);
+    EXPECT_GE(progress.GetThroughput(), 30);
+
+    // When: Task is started again
+    progress.Start(1);
+
+    // Then: Processed items should be cleared
+    EXPECT_EQ(progress.GetNumItemsProcessed(), 0);
+}
 } // namespace pos
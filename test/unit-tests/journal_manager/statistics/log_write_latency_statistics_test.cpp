@@ -0,0 +1,58 @@
+#include "src/journal_manager/statistics/log_write_latency_statistics.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "src/telemetry/telemetry_id.h"
+#include "test/unit-tests/telemetry/telemetry_client/easy_telemetry_publisher_mock.h"
+
+using ::testing::_;
+using ::testing::NiceMock;
+
+namespace pos
+{
+TEST(LogWriteLatencyStatistics, Publish_testIfOnlyStagesWithLatenciesArePublished)
+{
+    // Given
+    LogWriteLatencyStatistics statistics;
+    NiceMock<MockEasyTelemetryPublisher> publisher;
+
+    statistics.Record(LogWriteLatencyStage::BufferWrite, 100);
+    statistics.Record(LogWriteLatencyStage::BufferWrite, 200);
+
+    // Then: four percentiles of buffer write stage are published
+    VectorLabels labels = {{"stage", "buffer_write"}, {"array_id", "1"}};
+    EXPECT_CALL(publisher, UpdateGauge(TEL36009_JRN_LOG_WRITE_LATENCY_P50, _, labels)).Times(1);
+    EXPECT_CALL(publisher, UpdateGauge(TEL36010_JRN_LOG_WRITE_LATENCY_P99, _, labels)).Times(1);
+    EXPECT_CALL(publisher, UpdateGauge(TEL36011_JRN_LOG_WRITE_LATENCY_P999, _, labels)).Times(1);
+    EXPECT_CALL(publisher, UpdateGauge(TEL36012_JRN_LOG_WRITE_LATENCY_MAX, _, labels)).Times(1);
+
+    // When
+    statistics.Publish(&publisher, 1);
+}
+
+TEST(LogWriteLatencyStatistics, Publish_testIfNothingIsPublishedWithoutNewLatencies)
+{
+    // Given
+    LogWriteLatencyStatistics statistics;
+    NiceMock<MockEasyTelemetryPublisher> publisher;
+
+    statistics.Record(LogWriteLatencyStage::Allocation, 10);
+    statistics.Publish(&publisher, 0);
+
+    // Then
+    EXPECT_CALL(publisher, UpdateGauge(_, _, _)).Times(0);
+
+    // When
+    statistics.Publish(&publisher, 0);
+}
+
+TEST(LogWriteLatencyStatistics, GetStageName_testIfEveryStageHasName)
+{
+    for (int stage = 0; stage < (int)LogWriteLatencyStage::Count; stage++)
+    {
+        EXPECT_NE("unknown", LogWriteLatencyStatistics::GetStageName((LogWriteLatencyStage)stage));
+    }
+}
+
+} // namespace pos
@@ -0,0 +1,26 @@
+#include <gmock/gmock.h>
+
+#include <list>
+#include <string>
+#include <vector>
+
+#include "src/lib/atomic_bitmap.h"
+
+namespace pos
+{
+class MockAtomicBitMap : public AtomicBitMap
+{
+public:
+    using AtomicBitMap::AtomicBitMap;
+    MOCK_METHOD(uint64_t, GetNumBits, (), (override));
+    MOCK_METHOD(uint64_t, GetNumBitsSet, (), (override));
+    MOCK_METHOD(bool, SetBit, (uint64_t bitOffset), (override));
+    MOCK_METHOD(bool, ClearBit, (uint64_t bitOffset), (override));
+    MOCK_METHOD(bool, IsSetBit, (uint64_t bitOffset), (override));
+    MOCK_METHOD(bool, IsValidBit, (uint64_t bitOffset), (override));
+    MOCK_METHOD(void, ResetBitmap, (), (override));
+    MOCK_METHOD(uint64_t, MoveSetBitsTo, (BitMap & dest), (override));
+    MOCK_METHOD(uint64_t, SetFirstZeroBit, (uint64_t begin, uint64_t end), (override));
+};
+
+} // namespace pos
@@ -0,0 +1,177 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/lib/atomic_bitmap.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+namespace pos
+{
+TEST(AtomicBitMap, SetBit_testIfBitsAreCountedOnce)
+{
+    // Given
+    AtomicBitMap bitmap(100);
+
+    // When
+    EXPECT_TRUE(bitmap.SetBit(3));
+    EXPECT_TRUE(bitmap.SetBit(3));
+    EXPECT_TRUE(bitmap.SetBit(99));
+    EXPECT_FALSE(bitmap.SetBit(100));
+
+    // Then
+    EXPECT_TRUE(bitmap.IsSetBit(3));
+    EXPECT_TRUE(bitmap.IsSetBit(99));
+    EXPECT_FALSE(bitmap.IsSetBit(4));
+    EXPECT_EQ(2, bitmap.GetNumBitsSet());
+
+    bitmap.ClearBit(3);
+    bitmap.ClearBit(3);
+    EXPECT_EQ(1, bitmap.GetNumBitsSet());
+}
+
+TEST(AtomicBitMap, MoveSetBitsTo_testIfSetBitsAreMovedAndCleared)
+{
+    // Given
+    AtomicBitMap bitmap(200);
+    BitMap dest(200);
+    dest.ResetBitmap();
+    bitmap.SetBit(0);
+    bitmap.SetBit(63);
+    bitmap.SetBit(64);
+    bitmap.SetBit(199);
+
+    // When
+    uint64_t numMoved = bitmap.MoveSetBitsTo(dest);
+
+    // Then
+    EXPECT_EQ(4, numMoved);
+    EXPECT_EQ(0, bitmap.GetNumBitsSet());
+    EXPECT_FALSE(bitmap.IsSetBit(63));
+    EXPECT_EQ(4, dest.GetNumBitsSet());
+    EXPECT_TRUE(dest.IsSetBit(0));
+    EXPECT_TRUE(dest.IsSetBit(63));
+    EXPECT_TRUE(dest.IsSetBit(64));
+    EXPECT_TRUE(dest.IsSetBit(199));
+}
+
+TEST(AtomicBitMap, SetBit_testIfConcurrentWritersDoNotLoseBits)
+{
+    // Given
+    const uint64_t numThreads = 4;
+    const uint64_t bitsPerThread = 1000;
+    AtomicBitMap bitmap(numThreads * bitsPerThread);
+    std::vector<std::thread> writers;
+
+    // When: every writer sets interleaved bits that share the same words
+    for (uint64_t id = 0; id < numThreads; id++)
+    {
+        writers.emplace_back([&bitmap, id, numThreads, bitsPerThread]()
+        {
+            for (uint64_t idx = 0; idx < bitsPerThread; idx++)
+            {
+                bitmap.SetBit(idx * numThreads + id);
+            }
+        });
+    }
+    for (auto& writer : writers)
+    {
+        writer.join();
+    }
+
+    // Then
+    EXPECT_EQ(numThreads * bitsPerThread, bitmap.GetNumBitsSet());
+    BitMap dest(numThreads * bitsPerThread);
+    dest.ResetBitmap();
+    EXPECT_EQ(numThreads * bitsPerThread, bitmap.MoveSetBitsTo(dest));
+}
+
+TEST(AtomicBitMap, SetFirstZeroBit_testIfConcurrentCallersGetDistinctBits)
+{
+    // Given
+    const uint64_t numThreads = 4;
+    const uint64_t bitsPerThread = 1000;
+    AtomicBitMap bitmap(numThreads * bitsPerThread);
+    std::vector<std::vector<uint64_t>> claimed(numThreads);
+    std::vector<std::thread> allocators;
+
+    // When
+    for (uint64_t id = 0; id < numThreads; id++)
+    {
+        allocators.emplace_back([&bitmap, &claimed, id, numThreads, bitsPerThread]()
+        {
+            for (uint64_t idx = 0; idx < bitsPerThread; idx++)
+            {
+                claimed[id].push_back(bitmap.SetFirstZeroBit(0, numThreads * bitsPerThread - 1));
+            }
+        });
+    }
+    for (auto& allocator : allocators)
+    {
+        allocator.join();
+    }
+
+    // Then: every bit is handed out exactly once
+    BitMap seen(numThreads * bitsPerThread);
+    for (auto& bits : claimed)
+    {
+        for (uint64_t bit : bits)
+        {
+            ASSERT_LT(bit, numThreads * bitsPerThread);
+            EXPECT_FALSE(seen.IsSetBit(bit));
+            seen.SetBit(bit);
+        }
+    }
+    EXPECT_EQ(numThreads * bitsPerThread, bitmap.GetNumBitsSet());
+    EXPECT_EQ(numThreads * bitsPerThread, bitmap.SetFirstZeroBit(0, numThreads * bitsPerThread - 1));
+}
+
+TEST(AtomicBitMap, SetFirstZeroBit_testIfClearedBitOfFullWordIsFound)
+{
+    // Given
+    AtomicBitMap bitmap(BITMAP_ENTRY_BITS * 3);
+    for (uint64_t bit = 0; bit < BITMAP_ENTRY_BITS * 3; bit++)
+    {
+        bitmap.SetBit(bit);
+    }
+
+    // When
+    bitmap.ClearBit(BITMAP_ENTRY_BITS + 5);
+
+    // Then
+    EXPECT_EQ(BITMAP_ENTRY_BITS + 5, bitmap.SetFirstZeroBit(0, BITMAP_ENTRY_BITS * 3 - 1));
+    EXPECT_TRUE(bitmap.IsSetBit(BITMAP_ENTRY_BITS + 5));
+}
+
+} // namespace pos
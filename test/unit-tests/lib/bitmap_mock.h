@@ -38,6 +38,7 @@ public:
     MOCK_METHOD(uint64_t, SetFirstZeroBit, (uint64_t begin), (override));
     MOCK_METHOD(uint64_t, SetNextZeroBit, (), (override));
     MOCK_METHOD(bool, SetBit, (uint64_t bit), (override));
+    MOCK_METHOD(bool, TrySetBit, (uint64_t bit), (override));
     MOCK_METHOD(bool, ClearBit, (uint64_t bit), (override));
     MOCK_METHOD(bool, ClearBits, (uint64_t begin, uint64_t end), (override));
     MOCK_METHOD(void, ResetBitmap, (), (override));
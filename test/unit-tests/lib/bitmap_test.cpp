@@ -78,6 +78,44 @@ TEST(BitMap, FindFirstZero_)
     EXPECT_EQ(bit, 7);
 }
 
+TEST(BitMap, FindFirstZero_testIfFullEntriesAreSkippedThroughSummary)
+{
+    // Given: more entries than a single summary word covers, all set
+    uint64_t numBits = BITMAP_ENTRY_BITS * BITMAP_ENTRY_BITS * 3;
+    BitMap bitMapSUT(numBits);
+    for (uint64_t i = 0; i < numBits; ++i)
+    {
+        bitMapSUT.SetBit(i);
+    }
+    EXPECT_EQ(bitMapSUT.FindFirstZero(), numBits);
+
+    // When
+    bitMapSUT.ClearBit(numBits - 10);
+
+    // Then
+    EXPECT_EQ(bitMapSUT.FindFirstZero(), numBits - 10);
+    EXPECT_EQ(bitMapSUT.FindFirstZero(100), numBits - 10);
+    EXPECT_EQ(bitMapSUT.FindFirstZero(100, numBits - 11), numBits);
+}
+
+TEST(BitMap, FindFirstZero_testIfMapWrittenThroughAddressIsSearched)
+{
+    // Given
+    uint64_t numBits = BITMAP_ENTRY_BITS * 4;
+    BitMap bitMapSUT(numBits);
+    for (uint64_t i = 0; i < numBits; ++i)
+    {
+        bitMapSUT.SetBit(i);
+    }
+
+    // When: the map is loaded directly, as the meta loaders do
+    bitMapSUT.GetMapAddr()[2] = 0xFFFFFFFFFFFFFFFEULL;
+    bitMapSUT.SetNumBitsSet(numBits - 1);
+
+    // Then
+    EXPECT_EQ(bitMapSUT.FindFirstZero(), BITMAP_ENTRY_BITS * 2);
+}
+
 TEST(BitMap, FindNextZero_CheckFirstCall)
 {
     // Given
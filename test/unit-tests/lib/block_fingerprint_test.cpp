@@ -0,0 +1,65 @@
+#include "src/lib/block_fingerprint.h"
+
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+#include <random>
+
+namespace pos
+{
+TEST(BlockFingerprint, Compute_testIfSameContentGivesSameFingerprint)
+{
+    // Given
+    char first[4096];
+    char second[4096];
+    std::mt19937 generator(11);
+    for (uint32_t index = 0; index < sizeof(first); index++)
+    {
+        first[index] = static_cast<char>(generator());
+    }
+    memcpy(second, first, sizeof(first));
+
+    // When
+    BlockFingerprint firstFingerprint = BlockFingerprint::Compute(first, sizeof(first));
+    BlockFingerprint secondFingerprint = BlockFingerprint::Compute(second, sizeof(second));
+
+    // Then
+    EXPECT_TRUE(firstFingerprint == secondFingerprint);
+}
+
+TEST(BlockFingerprint, Compute_testIfAnyFlippedBitChangesBothHalves)
+{
+    char buffer[4096 + 5];
+    memset(buffer, 0, sizeof(buffer));
+    BlockFingerprint original = BlockFingerprint::Compute(buffer, sizeof(buffer));
+    for (uint32_t position : {0U, 31U, 32U, 2049U, 4095U, 4100U})
+    {
+        // Given
+        buffer[position] ^= 0x10;
+
+        // When
+        BlockFingerprint changed = BlockFingerprint::Compute(buffer, sizeof(buffer));
+
+        // Then
+        EXPECT_NE(original.low, changed.low);
+        EXPECT_NE(original.high, changed.high);
+        buffer[position] ^= 0x10;
+    }
+}
+
+TEST(BlockFingerprint, Compute_testIfSizeIsPartOfFingerprint)
+{
+    // Given
+    char buffer[64];
+    memset(buffer, 0, sizeof(buffer));
+
+    // When
+    BlockFingerprint shorter = BlockFingerprint::Compute(buffer, 32);
+    BlockFingerprint longer = BlockFingerprint::Compute(buffer, 64);
+
+    // Then
+    EXPECT_FALSE(shorter == longer);
+}
+
+} // namespace pos
@@ -0,0 +1,140 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/lib/mpsc_ring.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+namespace pos
+{
+TEST(MpscRing, MpscRing_testIfCapacityIsRoundedUpToPowerOfTwo)
+{
+    // Given
+    MpscRing<uint32_t> ring(100);
+
+    // When
+    uint32_t capacity = ring.GetCapacity();
+
+    // Then
+    EXPECT_EQ(128, capacity);
+}
+
+TEST(MpscRing, Push_testIfRingRejectsItemsWhenFull)
+{
+    // Given
+    MpscRing<uint32_t> ring(4);
+    for (uint32_t value = 0; value < 4; value++)
+    {
+        ASSERT_TRUE(ring.Push(value));
+    }
+
+    // When
+    bool ret = ring.Push(4);
+
+    // Then
+    EXPECT_FALSE(ret);
+    EXPECT_EQ(4, ring.GetSize());
+}
+
+TEST(MpscRing, Pop_testIfItemsComeOutInOrderAcrossWrapAround)
+{
+    // Given
+    MpscRing<uint32_t> ring(4);
+    uint32_t item = 0;
+
+    // When
+    for (uint32_t value = 0; value < 10; value++)
+    {
+        ASSERT_TRUE(ring.Push(value));
+        ASSERT_TRUE(ring.Pop(item));
+
+        // Then
+        EXPECT_EQ(value, item);
+    }
+    EXPECT_FALSE(ring.Pop(item));
+    EXPECT_EQ(0, ring.GetSize());
+}
+
+TEST(MpscRing, Push_testIfConcurrentProducersLoseNothing)
+{
+    // Given
+    const uint32_t PRODUCER_COUNT = 4;
+    const uint32_t ITEMS_PER_PRODUCER = 10000;
+    MpscRing<uint32_t> ring(64);
+    std::vector<std::thread> producers;
+    for (uint32_t producer = 0; producer < PRODUCER_COUNT; producer++)
+    {
+        producers.emplace_back([&ring, producer, ITEMS_PER_PRODUCER]()
+        {
+            for (uint32_t seq = 0; seq < ITEMS_PER_PRODUCER; seq++)
+            {
+                while (false == ring.Push(producer * ITEMS_PER_PRODUCER + seq))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // When
+    std::vector<uint32_t> lastSeq(PRODUCER_COUNT, 0);
+    uint32_t popped = 0;
+    uint32_t item = 0;
+    while (popped < PRODUCER_COUNT * ITEMS_PER_PRODUCER)
+    {
+        if (ring.Pop(item))
+        {
+            uint32_t producer = item / ITEMS_PER_PRODUCER;
+            uint32_t seq = item % ITEMS_PER_PRODUCER;
+            // Then: items of one producer keep their order
+            EXPECT_EQ(lastSeq[producer], seq);
+            lastSeq[producer] = seq + 1;
+            popped++;
+        }
+    }
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    // Then
+    for (uint32_t producer = 0; producer < PRODUCER_COUNT; producer++)
+    {
+        EXPECT_EQ(ITEMS_PER_PRODUCER, lastSeq[producer]);
+    }
+    EXPECT_FALSE(ring.Pop(item));
+}
+
+} // namespace pos
@@ -0,0 +1,100 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "src/lib/per_thread_shards.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+namespace pos
+{
+struct CountShard
+{
+    std::atomic<uint64_t> count;
+};
+
+static uint64_t
+SumCount(const PerThreadShards<CountShard>& shards)
+{
+    uint64_t sum = 0;
+    shards.ForEach([&sum](const CountShard& shard) { sum += shard.count.load(); });
+    return sum;
+}
+
+TEST(PerThreadShards, Get_testIfThreadKeepsItsShard)
+{
+    // Given
+    PerThreadShards<CountShard> shards;
+
+    // When
+    CountShard* first = shards.Get();
+    CountShard* second = shards.Get();
+
+    // Then
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(0, first->count.load());
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(first) % PerThreadShards<CountShard>::CACHE_LINE_SIZE);
+}
+
+TEST(PerThreadShards, Add_testIfNoCountIsLostBeyondMaxWriters)
+{
+    // Given: more threads than shards, so some of them share one
+    PerThreadShards<CountShard> shards;
+    const uint32_t numThreads = PerThreadShards<CountShard>::MAX_WRITERS + 8;
+    const uint64_t countPerThread = 1000;
+
+    // When
+    std::vector<std::thread> threads;
+    for (uint32_t index = 0; index < numThreads; index++)
+    {
+        threads.emplace_back([&shards, countPerThread]
+        {
+            for (uint64_t count = 0; count < countPerThread; count++)
+            {
+                CountShard* shard = shards.Get();
+                shards.Add(shard, shard->count, static_cast<uint64_t>(1));
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Then
+    EXPECT_EQ(numThreads * countPerThread, SumCount(shards));
+}
+
+} // namespace pos
@@ -0,0 +1,148 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/lib/work_stealing_deque.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace pos
+{
+TEST(WorkStealingDeque, Push_testIfDequeRejectsItemsWhenFull)
+{
+    // Given
+    WorkStealingDeque<uint32_t> deque(4);
+    uint32_t items[5] = {0, 1, 2, 3, 4};
+    for (uint32_t index = 0; index < 4; index++)
+    {
+        ASSERT_TRUE(deque.Push(&items[index]));
+    }
+
+    // When
+    bool ret = deque.Push(&items[4]);
+
+    // Then
+    EXPECT_FALSE(ret);
+    EXPECT_EQ(4, deque.GetSize());
+}
+
+TEST(WorkStealingDeque, Pop_testIfOwnerTakesNewestAndThiefTakesOldest)
+{
+    // Given
+    WorkStealingDeque<uint32_t> deque(8);
+    uint32_t items[3] = {0, 1, 2};
+    for (uint32_t index = 0; index < 3; index++)
+    {
+        deque.Push(&items[index]);
+    }
+
+    // When
+    uint32_t* popped = deque.Pop();
+    uint32_t* stolen = deque.Steal();
+
+    // Then
+    EXPECT_EQ(&items[2], popped);
+    EXPECT_EQ(&items[0], stolen);
+    EXPECT_EQ(&items[1], deque.Pop());
+    EXPECT_EQ(nullptr, deque.Pop());
+    EXPECT_EQ(nullptr, deque.Steal());
+}
+
+TEST(WorkStealingDeque, Steal_testIfEveryItemIsTakenExactlyOnce)
+{
+    // Given
+    const uint32_t ITEM_COUNT = 20000;
+    const uint32_t THIEF_COUNT = 3;
+    WorkStealingDeque<uint32_t> deque(64);
+    std::vector<uint32_t> items(ITEM_COUNT);
+    std::vector<std::atomic<uint32_t>> taken(ITEM_COUNT);
+    for (uint32_t index = 0; index < ITEM_COUNT; index++)
+    {
+        items[index] = index;
+        taken[index] = 0;
+    }
+    std::atomic<bool> done(false);
+    std::vector<std::thread> thieves;
+    for (uint32_t thief = 0; thief < THIEF_COUNT; thief++)
+    {
+        thieves.emplace_back([&]()
+        {
+            while (false == done || deque.GetSize() > 0)
+            {
+                uint32_t* item = deque.Steal();
+                if (nullptr != item)
+                {
+                    taken[*item]++;
+                }
+            }
+        });
+    }
+
+    // When
+    uint32_t pushed = 0;
+    while (pushed < ITEM_COUNT)
+    {
+        if (deque.Push(&items[pushed]))
+        {
+            pushed++;
+        }
+        if (pushed % 3 == 0)
+        {
+            uint32_t* item = deque.Pop();
+            if (nullptr != item)
+            {
+                taken[*item]++;
+            }
+        }
+    }
+    uint32_t* item = nullptr;
+    while (nullptr != (item = deque.Pop()))
+    {
+        taken[*item]++;
+    }
+    done = true;
+    for (auto& thief : thieves)
+    {
+        thief.join();
+    }
+
+    // Then
+    for (uint32_t index = 0; index < ITEM_COUNT; index++)
+    {
+        EXPECT_EQ(1, taken[index]);
+    }
+}
+
+} // namespace pos
@@ -0,0 +1,50 @@
+#include "src/lib/zero_block_detector.h"
+
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+namespace pos
+{
+TEST(ZeroBlockDetector, IsZero_testIfZeroBlockIsDetected)
+{
+    // Given
+    char buffer[4096];
+    memset(buffer, 0, sizeof(buffer));
+
+    // When
+    bool isZero = ZeroBlockDetector::IsZero(buffer, sizeof(buffer));
+
+    // Then
+    EXPECT_TRUE(isZero);
+}
+
+TEST(ZeroBlockDetector, IsZero_testIfAnyNonZeroByteIsFound)
+{
+    char buffer[4096 + 3];
+    for (uint32_t position : {0U, 7U, 64U, 2049U, 4095U, 4097U})
+    {
+        // Given
+        memset(buffer, 0, sizeof(buffer));
+        buffer[position] = 1;
+
+        // When
+        bool isZero = ZeroBlockDetector::IsZero(buffer, sizeof(buffer));
+
+        // Then
+        EXPECT_FALSE(isZero);
+    }
+}
+
+TEST(ZeroBlockDetector, IsZero_testIfBufferShorterThanWordIsChecked)
+{
+    // Given
+    char buffer[3] = {0, 0, 0};
+
+    // When, Then
+    EXPECT_TRUE(ZeroBlockDetector::IsZero(buffer, sizeof(buffer)));
+    buffer[2] = 1;
+    EXPECT_FALSE(ZeroBlockDetector::IsZero(buffer, sizeof(buffer)));
+}
+
+} // namespace pos
@@ -0,0 +1,123 @@
+#include "src/logger/async_log_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace pos_logger
+{
+static AsyncLogRecord*
+MakeRecord(int eventId, const std::string& name, int value)
+{
+    return new AsyncLogRecordWithArgs<std::string, int>(spdlog::source_loc{}, spdlog::level::info,
+        eventId, "name:{}, value:{}", name, value);
+}
+
+TEST(AsyncLogQueue, Drain_testIfRecordsAreHandedOverInPushOrder)
+{
+    // Given
+    std::vector<std::string> msgs;
+    AsyncLogQueue queue;
+    queue.Start([&](AsyncLogRecord* record) { msgs.push_back(record->Format()); });
+
+    // When
+    bool ret1 = queue.Push(MakeRecord(1, "a", 1));
+    bool ret2 = queue.Push(MakeRecord(2, "b", 2));
+    bool ret3 = queue.Push(MakeRecord(3, "c", 3));
+    queue.Stop();
+
+    // Then
+    EXPECT_TRUE(ret1);
+    EXPECT_TRUE(ret2);
+    EXPECT_TRUE(ret3);
+    ASSERT_EQ(3, msgs.size());
+    EXPECT_EQ("name:a, value:1", msgs[0]);
+    EXPECT_EQ("name:b, value:2", msgs[1]);
+    EXPECT_EQ("name:c, value:3", msgs[2]);
+}
+
+TEST(AsyncLogQueue, Push_testIfPushFailsWhenTheQueueIsNotRunning)
+{
+    // Given
+    AsyncLogQueue queue;
+    AsyncLogRecord* record = MakeRecord(1, "a", 1);
+
+    // When
+    bool ret = queue.Push(record);
+
+    // Then
+    EXPECT_FALSE(ret);
+    delete record;
+}
+
+TEST(AsyncLogRecordWithArgs, Format_testIfArgumentsAreCapturedByValue)
+{
+    // Given
+    char name[16] = "volume0";
+    std::atomic<int> count(7);
+    AsyncLogRecord* record = new AsyncLogRecordWithArgs<char[16], std::atomic<int>>(
+        spdlog::source_loc{}, spdlog::level::debug, 100, "{} count:{}", name, count);
+
+    // When: the caller changes its variables before the record is formatted
+    name[6] = '9';
+    count = 8;
+    std::string msg = record->Format();
+
+    // Then
+    EXPECT_EQ("volume0 count:7", msg);
+    EXPECT_EQ(100, record->eventId);
+    delete record;
+}
+
+TEST(AsyncLogRing, Push_testIfPushFailsWhenTheRingIsFull)
+{
+    // Given
+    AsyncLogRing ring;
+    std::vector<AsyncLogRecord*> records;
+    for (uint32_t i = 0; i < AsyncLogRing::CAPACITY; i++)
+    {
+        records.push_back(MakeRecord(i, "a", i));
+        ASSERT_TRUE(ring.Push(records.back()));
+    }
+    AsyncLogRecord* extra = MakeRecord(0, "extra", 0);
+
+    // When
+    bool ret = ring.Push(extra);
+
+    // Then
+    EXPECT_FALSE(ret);
+    AsyncLogRecord* popped = nullptr;
+    uint32_t count = 0;
+    while ((popped = ring.Pop()) != nullptr)
+    {
+        EXPECT_EQ(records[count], popped);
+        delete popped;
+        count++;
+    }
+    EXPECT_EQ(AsyncLogRing::CAPACITY, count);
+    delete extra;
+}
+
+TEST(AsyncLogQueue, Drain_testIfTheRingOfAnExitedThreadIsRemovedAfterDrained)
+{
+    // Given
+    std::atomic<uint32_t> consumed(0);
+    AsyncLogQueue queue;
+    queue.Start([&](AsyncLogRecord* record) { consumed++; });
+
+    // When
+    std::thread producer([&]() {
+        queue.Push(MakeRecord(1, "a", 1));
+        queue.Push(MakeRecord(2, "b", 2));
+    });
+    producer.join();
+    queue.Stop();
+
+    // Then
+    EXPECT_EQ(2, consumed);
+    EXPECT_EQ(0, queue.GetRingCount());
+}
+} // namespace pos_logger
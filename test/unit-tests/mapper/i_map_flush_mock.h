@@ -14,7 +14,9 @@ public:
     using IMapFlush::IMapFlush;
     MOCK_METHOD(int, FlushDirtyMpages, (int mapId, EventSmartPtr callback), (override));
     MOCK_METHOD(int, FlushDirtyMpagesGiven, (int mapId, EventSmartPtr callback, MpageList dirtyPages), (override));
+    MOCK_METHOD(int, FlushDirtyMaps, (const MapList& mapIds, EventSmartPtr callback), (override));
     MOCK_METHOD(int, StoreAll, (), (override));
+    MOCK_METHOD(uint64_t, GetNumDirtyMpages, (), (override));
 };
 
 } // namespace pos
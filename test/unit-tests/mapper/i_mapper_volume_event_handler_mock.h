@@ -15,11 +15,16 @@ public:
     MOCK_METHOD(int, VolumeCreated, (int volId, uint64_t volSizeByte), (override));
     MOCK_METHOD(int, VolumeMounted, (int volId, uint64_t volSizeByte), (override));
     MOCK_METHOD(int, VolumeLoaded, (int volId, uint64_t volSizeByte), (override));
+    MOCK_METHOD(int, VolumeResized, (int volId, uint64_t volSizeByte), (override));
     MOCK_METHOD(int, VolumeUnmounted, (int volId, bool flushMapRequired), (override));
     MOCK_METHOD(int, VolumeDetached, (std::vector<int> volList), (override));
     MOCK_METHOD(int, PrepareVolumeDelete, (int volId), (override));
     MOCK_METHOD(int, InvalidateAllBlocksTo, (int volId, ISegmentCtx* segmentCtx), (override));
     MOCK_METHOD(int, DeleteVolumeMap, (int volId), (override));
+    MOCK_METHOD(int, DetachVolumeMap, (int volId), (override));
+    MOCK_METHOD(bool, CollectDetachedBlocks, (int volId, uint64_t& mpageId, uint32_t numMpages, std::vector<VirtualBlks>& validBlks), (override));
+    MOCK_METHOD(int, DeleteDetachedMap, (int volId), (override));
+    MOCK_METHOD(std::vector<int>, GetDetachedVolumes, (), (override));
 };
 
 } // namespace pos
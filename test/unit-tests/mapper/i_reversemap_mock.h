@@ -16,6 +16,7 @@ public:
     MOCK_METHOD(int, Flush, (ReverseMapPack * rev, EventSmartPtr cb), (override));
     MOCK_METHOD(ReverseMapPack*, AllocReverseMapPack, (StripeId vsid, StripeId wblsid), (override));
     MOCK_METHOD(int, ReconstructReverseMap, (uint32_t volumeId, uint64_t totalRba, uint32_t wblsid, uint32_t vsid, uint64_t blockCount, (std::map<uint64_t, BlkAddr> revMapInfos), ReverseMapPack* revMapPack), (override));
+    MOCK_METHOD(bool, GetBlockChecksum, (StripeId vsid, uint64_t offset, uint32_t& checksum), (override));
 };
 
 } // namespace pos
@@ -13,11 +13,14 @@ class MockIVSAMap : public IVSAMap
 public:
     using IVSAMap::IVSAMap;
     MOCK_METHOD(int, GetVSAs, (int volumeId, BlkAddr startRba, uint32_t numBlks, VsaArray& vsaArray), (override));
+    MOCK_METHOD(int, GetVsaExtents, (int volumeId, BlkAddr startRba, uint32_t numBlks, VsaExtentArray& extents, uint32_t& numExtents), (override));
     MOCK_METHOD(int, SetVSAs, (int volumeId, BlkAddr startRba, VirtualBlks& virtualBlks), (override));
     MOCK_METHOD(VirtualBlkAddr, GetVSAInternal, (int volumeId, BlkAddr rba, int& caller), (override));
     MOCK_METHOD(int, SetVSAsInternal, (int volumeId, BlkAddr startRba, VirtualBlks& virtualBlks), (override));
     MOCK_METHOD(VirtualBlkAddr, GetVSAWithSyncOpen, (int volumeId, BlkAddr rba), (override));
     MOCK_METHOD(int, SetVSAsWithSyncOpen, (int volumeId, BlkAddr startRba, VirtualBlks& virtualBlks), (override));
+    MOCK_METHOD(int, UnmapVSAs, (int volumeId, BlkAddr startRba, uint64_t numBlks, std::vector<VirtualBlks>& oldBlks), (override));
+    MOCK_METHOD(int, UnmapVSAsWithSyncOpen, (int volumeId, BlkAddr startRba, uint64_t numBlks, std::vector<VirtualBlks>& oldBlks), (override));
     MOCK_METHOD(VirtualBlkAddr, GetRandomVSA, (BlkAddr rba), (override));
     MOCK_METHOD(MpageList, GetDirtyVsaMapPages, (int volumeId, BlkAddr startRba, uint64_t numBlks), (override));
     MOCK_METHOD(int64_t, GetNumUsedBlks, (int volId), (override));
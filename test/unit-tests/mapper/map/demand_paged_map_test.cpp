@@ -0,0 +1,163 @@
+#include "src/mapper/map/demand_paged_map.h"
+
+#include <gtest/gtest.h>
+
+#include "src/mapper/map/mpage_cache.h"
+#include "src/mapper/vsamap/vsa_extent_codec.h"
+
+namespace pos
+{
+static const uint64_t TEST_MPAGE_SIZE = 4032;
+
+TEST(DemandPagedMap, AllocateMpage_testIfPageIsServedFromCache)
+{
+    MpageCache cache(TEST_MPAGE_SIZE, 2);
+    DemandPagedMap map(5, TEST_MPAGE_SIZE, &cache);
+
+    EXPECT_EQ(nullptr, map.GetMpage(1));
+    char* mpage = map.AllocateMpage(1);
+    ASSERT_NE(nullptr, mpage);
+    EXPECT_EQ((char)0xFF, mpage[0]);
+    EXPECT_EQ((char)0xFF, mpage[TEST_MPAGE_SIZE - 1]);
+    EXPECT_EQ(mpage, map.GetMpage(1));
+    EXPECT_EQ(nullptr, map.AllocateMpage(1));
+    EXPECT_EQ(1, cache.GetNumUsedFrames());
+    EXPECT_TRUE(map.IsDemandPaged());
+}
+
+TEST(DemandPagedMap, TryEvict_testIfReferencedPageGetsSecondChance)
+{
+    MpageCache cache(TEST_MPAGE_SIZE, 2);
+    DemandPagedMap map(5, TEST_MPAGE_SIZE, &cache);
+    map.AllocateMpage(0);
+
+    EXPECT_FALSE(map.TryEvict(0));
+    EXPECT_TRUE(map.TryEvict(0));
+    EXPECT_EQ(nullptr, map.GetMpage(0));
+}
+
+TEST(DemandPagedMap, TryEvict_testIfEvictionInvalidatesOptimisticReaders)
+{
+    MpageCache cache(TEST_MPAGE_SIZE, 2);
+    DemandPagedMap map(5, TEST_MPAGE_SIZE, &cache);
+    map.AllocateMpage(0);
+    map.TryEvict(0);
+
+    uint32_t seq = map.GetMpageSeq(0);
+    EXPECT_EQ(0, seq % 2);
+    EXPECT_FALSE(map.IsMpageSeqChanged(0, seq));
+    EXPECT_TRUE(map.TryEvict(0));
+    EXPECT_TRUE(map.IsMpageSeqChanged(0, seq));
+    EXPECT_EQ(0, map.GetMpageSeq(0) % 2);
+}
+
+TEST(DemandPagedMap, TryEvict_testIfDirtyPageIsPinnedUntilFlushCompletes)
+{
+    MpageCache cache(TEST_MPAGE_SIZE, 2);
+    DemandPagedMap map(5, TEST_MPAGE_SIZE, &cache);
+    map.AllocateMpage(0);
+    map.MarkMpageDirty(0);
+
+    EXPECT_FALSE(map.TryEvict(0));
+    EXPECT_FALSE(map.TryEvict(0));
+
+    map.StartMpageFlush(0);
+    EXPECT_FALSE(map.TryEvict(0));
+
+    map.EndMpageFlush(0);
+    EXPECT_TRUE(map.TryEvict(0));
+}
+
+TEST(DemandPagedMap, TryEvict_testIfLockedPageIsNotEvicted)
+{
+    MpageCache cache(TEST_MPAGE_SIZE, 2);
+    DemandPagedMap map(5, TEST_MPAGE_SIZE, &cache);
+    map.AllocateMpage(0);
+    map.TryEvict(0);
+
+    map.GetMpageLock(0);
+    EXPECT_FALSE(map.TryEvict(0));
+    map.ReleaseMpageLock(0);
+    EXPECT_TRUE(map.TryEvict(0));
+}
+
+TEST(DemandPagedMap, AllocateMpage_testIfCleanPageIsReclaimedWhenBudgetIsFull)
+{
+    MpageCache cache(TEST_MPAGE_SIZE, 1);
+    DemandPagedMap map(5, TEST_MPAGE_SIZE, &cache);
+    char* first = map.AllocateMpage(0);
+
+    char* second = map.AllocateMpage(1);
+
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(nullptr, map.GetMpage(0));
+    EXPECT_EQ(second, map.GetMpage(1));
+    EXPECT_EQ(1, cache.GetNumFrames());
+}
+
+TEST(DemandPagedMap, AllocateMpage_testIfBudgetIsExceededWhenAllPagesAreDirty)
+{
+    MpageCache cache(TEST_MPAGE_SIZE, 1);
+    DemandPagedMap map(5, TEST_MPAGE_SIZE, &cache);
+    map.AllocateMpage(0);
+    map.MarkMpageDirty(0);
+
+    EXPECT_NE(nullptr, map.AllocateMpage(1));
+
+    EXPECT_NE(nullptr, map.GetMpage(0));
+    EXPECT_EQ(2, cache.GetNumFrames());
+}
+
+TEST(DemandPagedMap, DropMpage_testIfFrameIsReturnedToCache)
+{
+    MpageCache cache(TEST_MPAGE_SIZE, 2);
+    DemandPagedMap map(5, TEST_MPAGE_SIZE, &cache);
+    map.AllocateMpage(3);
+    map.MarkMpageDirty(3);
+
+    map.DropMpage(3);
+
+    EXPECT_EQ(nullptr, map.GetMpage(3));
+    EXPECT_EQ(0, cache.GetNumUsedFrames());
+}
+
+TEST(DemandPagedMap, RestoreMpage_testIfEvictedPageIsRestoredFromEncodedCopy)
+{
+    MpageCache cache(TEST_MPAGE_SIZE, 2, TEST_MPAGE_SIZE);
+    VsaExtentCodec codec;
+    DemandPagedMap map(5, TEST_MPAGE_SIZE, &cache);
+    map.SetCodec(&codec);
+    VirtualBlkAddr* entries = (VirtualBlkAddr*)map.AllocateMpage(0);
+    entries[0] = {.stripeId = 3, .offset = 7};
+
+    map.TryEvict(0);
+    EXPECT_TRUE(map.TryEvict(0));
+    EXPECT_EQ(nullptr, map.GetMpage(0));
+    EXPECT_EQ(1, cache.GetCodecStats().numEncodedPages);
+
+    entries = (VirtualBlkAddr*)map.RestoreMpage(0);
+    ASSERT_NE(nullptr, entries);
+    EXPECT_EQ(3, entries[0].stripeId);
+    EXPECT_EQ(7, entries[0].offset);
+    EXPECT_TRUE(IsUnMapVsa(entries[1]));
+    EXPECT_EQ(0, cache.GetCodecStats().numEncodedPages);
+    EXPECT_EQ(1, cache.GetCodecStats().numDecodes);
+    EXPECT_EQ(nullptr, map.RestoreMpage(0));
+}
+
+TEST(DemandPagedMap, RestoreMpage_testIfPageIsNotKeptBeyondEncodedBudget)
+{
+    MpageCache cache(TEST_MPAGE_SIZE, 2, sizeof(VirtualBlks));
+    VsaExtentCodec codec;
+    DemandPagedMap map(5, TEST_MPAGE_SIZE, &cache);
+    map.SetCodec(&codec);
+    VirtualBlkAddr* entries = (VirtualBlkAddr*)map.AllocateMpage(0);
+    entries[0] = {.stripeId = 3, .offset = 7};
+
+    map.TryEvict(0);
+    EXPECT_TRUE(map.TryEvict(0));
+    EXPECT_EQ(0, cache.GetCodecStats().numEncodedPages);
+    EXPECT_EQ(nullptr, map.RestoreMpage(0));
+}
+
+} // namespace pos
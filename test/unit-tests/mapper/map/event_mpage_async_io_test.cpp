@@ -2,14 +2,143 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
+#include "src/mapper/map/map_io_handler.h"
+#include "test/unit-tests/mapper/map/map_header_mock.h"
+#include "test/unit-tests/mapper/map/map_mock.h"
+#include "test/unit-tests/meta_file_intf/meta_file_intf_mock.h"
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
 namespace pos
 {
-TEST(EventMpageAsyncIo, EventMpageAsyncIo_)
+static const uint64_t TEST_MPAGE_SIZE = 64;
+
+class EventMpageAsyncIoTestFixture : public ::testing::Test
+{
+protected:
+    void
+    SetUp(void) override
+    {
+        header = new NiceMock<MockMapHeader>(0);
+        map = new NiceMock<MockMap>(0, TEST_MPAGE_SIZE);
+        file = new NiceMock<MockMetaFileIntf>("s", 1, MetaFileType::Map);
+        validPages = new BitMap(16);
+        memPool = new char[TEST_MPAGE_SIZE * 16];
+
+        ON_CALL(*header, GetMpageMap).WillByDefault(Return(validPages));
+        ON_CALL(*header, GetSize).WillByDefault(Return(0));
+        ON_CALL(*map, GetSize).WillByDefault(Return(TEST_MPAGE_SIZE));
+        ON_CALL(*map, GetMpage).WillByDefault(Return(nullptr));
+        ON_CALL(*map, AllocateMpage).WillByDefault(Invoke([&](uint64_t pageNr) {
+            return memPool + pageNr * TEST_MPAGE_SIZE;
+        }));
+        ON_CALL(*file, AsyncIO).WillByDefault(Invoke([&](AsyncMetaFileIoCtx* ctx) {
+            requests.push_back(static_cast<MapFlushIoContext*>(ctx));
+            return 0;
+        }));
+    }
+
+    void
+    TearDown(void) override
+    {
+        for (auto request : requests)
+        {
+            delete request;
+        }
+        delete[] memPool;
+        delete validPages;
+        delete file;
+        delete map;
+        delete header;
+    }
+
+    NiceMock<MockMapHeader>* header;
+    NiceMock<MockMap>* map;
+    NiceMock<MockMetaFileIntf>* file;
+    BitMap* validPages;
+    char* memPool;
+    std::vector<MapFlushIoContext*> requests;
+};
+
+TEST_F(EventMpageAsyncIoTestFixture, Execute_testIfSequentialMpagesAreLoadedWithOneRequest)
 {
+    validPages->SetBit(0);
+    validPages->SetBit(1);
+    validPages->SetBit(2);
+    validPages->SetBit(5);
+    EventMpageAsyncIo event(header, map, file, nullptr);
+
+    EXPECT_TRUE(event.Execute());
+
+    ASSERT_EQ(2, requests.size());
+    EXPECT_EQ(0, requests[0]->GetStartMpage());
+    EXPECT_EQ(3, requests[0]->GetNumMpages());
+    EXPECT_EQ(TEST_MPAGE_SIZE * 3, requests[0]->GetLength());
+    EXPECT_EQ(5, requests[1]->GetStartMpage());
+    EXPECT_EQ(1, requests[1]->GetNumMpages());
+    EXPECT_EQ(TEST_MPAGE_SIZE * 5, requests[1]->GetFileOffset());
 }
 
-TEST(EventMpageAsyncIo, Execute_)
+TEST_F(EventMpageAsyncIoTestFixture, Execute_testIfMpagesNotContiguousInMemoryAreSplit)
 {
+    char otherPage[TEST_MPAGE_SIZE];
+    validPages->SetBit(0);
+    validPages->SetBit(1);
+    validPages->SetBit(2);
+    EXPECT_CALL(*map, AllocateMpage(1)).WillOnce(Return(otherPage));
+    EventMpageAsyncIo event(header, map, file, nullptr);
+
+    EXPECT_TRUE(event.Execute());
+
+    ASSERT_EQ(3, requests.size());
+    EXPECT_EQ(1, requests[0]->GetNumMpages());
+    EXPECT_EQ(1, requests[1]->GetStartMpage());
+    EXPECT_EQ(otherPage, requests[1]->GetBuffer());
+    EXPECT_EQ(2, requests[2]->GetStartMpage());
+}
+
+TEST_F(EventMpageAsyncIoTestFixture, Execute_testIfQueueDepthLimitsLoadsInFlight)
+{
+    std::atomic<int> numLoadsInFlight(0);
+    validPages->SetBit(0);
+    validPages->SetBit(5);
+    EventMpageAsyncIo event(header, map, file, nullptr, &numLoadsInFlight, 1);
+
+    EXPECT_FALSE(event.Execute());
+    EXPECT_EQ(1, requests.size());
+    EXPECT_EQ(1, numLoadsInFlight);
+
+    numLoadsInFlight--;
+    EXPECT_TRUE(event.Execute());
+    EXPECT_EQ(2, requests.size());
+}
+
+TEST_F(EventMpageAsyncIoTestFixture, Execute_testIfFailedLoadIsRetriedFromSameMpage)
+{
+    std::atomic<int> numLoadsInFlight(0);
+    validPages->SetBit(3);
+    EventMpageAsyncIo event(header, map, file, nullptr, &numLoadsInFlight, 4);
+
+    EXPECT_CALL(*file, AsyncIO).WillOnce(Invoke([&](AsyncMetaFileIoCtx* ctx) {
+        delete ctx;
+        return -1;
+    })).WillOnce(Invoke([&](AsyncMetaFileIoCtx* ctx) {
+        requests.push_back(static_cast<MapFlushIoContext*>(ctx));
+        return 0;
+    }));
+    EXPECT_FALSE(event.Execute());
+    EXPECT_EQ(0, numLoadsInFlight);
+
+    EXPECT_CALL(*map, GetMpage(3)).WillOnce(Return(memPool + 3 * TEST_MPAGE_SIZE));
+    EXPECT_CALL(*map, AllocateMpage).Times(0);
+    EXPECT_TRUE(event.Execute());
+    ASSERT_EQ(1, requests.size());
+    EXPECT_EQ(3, requests[0]->GetStartMpage());
 }
 
 } // namespace pos
@@ -25,6 +25,7 @@ public:
     MOCK_METHOD(int, Dump, (std::string fileName), (override));
     MOCK_METHOD(int, DumpLoad, (std::string fileName), (override));
     MOCK_METHOD(uint64_t, GetEntriesPerPage, (), (override));
+    MOCK_METHOD(uint64_t, GetNumDirtyPages, (), (override));
 };
 
 } // namespace pos
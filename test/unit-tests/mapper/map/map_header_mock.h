@@ -26,8 +26,12 @@ public:
     MOCK_METHOD(uint64_t, GetNumValidMpages, (), (override));
     MOCK_METHOD(BitMap*, GetMpageMap, (), (override));
     MOCK_METHOD(void, SetMapAllocated, (int pageNr), (override));
-    MOCK_METHOD(BitMap*, GetTouchedMpages, (), (override));
+    MOCK_METHOD(void, SetMapUnallocated, (int pageNr), (override));
+    MOCK_METHOD(void, ClearMapAllocatedInBuffer, (char* buffer, int pageNr), (override));
+    MOCK_METHOD(AtomicBitMap*, GetTouchedMpages, (), (override));
     MOCK_METHOD(void, UpdateNumUsedBlks, (VirtualBlkAddr vsa), (override));
+    MOCK_METHOD(void, ReleaseNumUsedBlks, (VirtualBlkAddr vsa), (override));
+    MOCK_METHOD(void, DecreaseNumUsedBlks, (uint64_t numBlks), (override));
     MOCK_METHOD(uint64_t, GetNumUsedBlks, (), (override));
     MOCK_METHOD(int, GetMapId, (), (override));
     MOCK_METHOD(uint32_t, GetNumTouchedMpagesSet, (), (override));
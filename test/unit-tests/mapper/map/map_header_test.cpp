@@ -1,4 +1,5 @@
 #include "src/mapper/map/map_header.h"
+#include "test/unit-tests/lib/atomic_bitmap_mock.h"
 #include "test/unit-tests/lib/bitmap_mock.h"
 #include <gtest/gtest.h>
 
@@ -12,7 +13,7 @@ namespace pos
 TEST(MapHeader, TestSimpleGetter)
 {
     NiceMock<MockBitMap>* bm = new NiceMock<MockBitMap>(5);
-    NiceMock<MockBitMap>* tm = new NiceMock<MockBitMap>(5);
+    NiceMock<MockAtomicBitMap>* tm = new NiceMock<MockAtomicBitMap>(5);
     MapHeader header(bm, tm, 0);
     int ret = header.GetMapId();
     EXPECT_EQ(0, ret);
@@ -24,4 +25,37 @@ TEST(MapHeader, TestSimpleGetter)
     ret = header.GetNumTotalTouchedMpages();
 }
 
+TEST(MapHeader, ClearMapAllocatedInBuffer_testIfMpageIsClearedFromHeaderImage)
+{
+    MapHeader header(0);
+    header.Init(100, 4032);
+    header.SetMapAllocated(3);
+    header.SetMapAllocated(70);
+
+    char* buffer = new char[header.GetSize()];
+    header.CopyToBuffer(buffer);
+    header.ClearMapAllocatedInBuffer(buffer, 70);
+    header.ClearMapAllocatedInBuffer(buffer, 71);
+
+    BitMap* image = header.GetBitmapFromTempBuffer(buffer);
+    EXPECT_EQ(1, image->GetNumBitsSet());
+    EXPECT_TRUE(image->IsSetBit(3));
+    EXPECT_FALSE(image->IsSetBit(70));
+
+    delete image;
+    delete[] buffer;
+}
+
+TEST(MapHeader, SetMapUnallocated_testIfMpageBitIsCleared)
+{
+    MapHeader header(0);
+    header.Init(100, 4032);
+    header.SetMapAllocated(5);
+    EXPECT_EQ(1, header.GetNumValidMpages());
+
+    header.SetMapUnallocated(5);
+    EXPECT_EQ(0, header.GetNumValidMpages());
+    EXPECT_FALSE(header.GetMpageMap()->IsSetBit(5));
+}
+
 } // namespace pos
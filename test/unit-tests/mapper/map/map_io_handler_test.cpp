@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include "src/mapper/address/mapper_address_info.h"
+#include "src/mapper/map/map.h"
 #include "test/unit-tests/allocator/block_manager/block_manager_mock.h"
 #include "test/unit-tests/io/frontend_io/flush_command_manager_mock.h"
 #include "test/unit-tests/mapper/address/mapper_address_info_mock.h"
@@ -13,6 +14,7 @@
 
 using ::testing::_;
 using ::testing::AtLeast;
+using ::testing::Invoke;
 using testing::NiceMock;
 using ::testing::Return;
 using ::testing::ReturnRef;
@@ -123,4 +125,39 @@ TEST(MapIoHandler, CreateFlushEvents_testIfTheEventCanCreateThreeEvents)
 
     mio.CreateFlushEvents(std::move(finder));
 }
+TEST(MapIoHandler, FlushTouchedPages_testIfUnmappedMpageIsElided)
+{
+    NiceMock<MockMetaFileIntf>* file = new NiceMock<MockMetaFileIntf>("s", 1, MetaFileType::Map);
+    NiceMock<MockEventScheduler> scheduler;
+    Map map(4, 64);
+    MapHeader header(0);
+    header.Init(4, 64);
+    MapIoHandler mio(file, &map, &header, 0, nullptr, &scheduler);
+
+    map.AllocateMpage(0)[0] = 0;
+    header.SetMapAllocated(0);
+    header.SetTouchedMpageBit(0);
+    map.AllocateMpage(1);
+    header.SetMapAllocated(1);
+    header.SetTouchedMpageBit(1);
+
+    MapFlushIoContext* request = nullptr;
+    EXPECT_CALL(*file, AsyncIO).WillOnce(Invoke([&](AsyncMetaFileIoCtx* ctx) {
+        request = static_cast<MapFlushIoContext*>(ctx);
+        return 0;
+    }));
+    mio.FlushTouchedPages(nullptr);
+
+    ASSERT_NE(nullptr, request);
+    EXPECT_EQ(0, request->GetStartMpage());
+    EXPECT_EQ(1, request->GetNumMpages());
+    EXPECT_EQ(nullptr, map.GetMpage(1));
+    EXPECT_FALSE(header.GetMpageMap()->IsSetBit(1));
+    EXPECT_FALSE(header.GetTouchedMpages()->IsSetBit(1));
+    EXPECT_TRUE(header.GetMpageMap()->IsSetBit(0));
+
+    delete[] request->GetBuffer();
+    delete request;
+}
+
 } // namespace pos
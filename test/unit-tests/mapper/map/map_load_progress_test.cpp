@@ -0,0 +1,46 @@
+#include "src/mapper/map/map_load_progress.h"
+
+#include <gtest/gtest.h>
+
+namespace pos
+{
+TEST(MapLoadProgress, PagesLoaded_testIfProgressIsAccumulated)
+{
+    MapLoadProgress progress;
+    progress.Start(0, 200, 4096);
+    EXPECT_EQ(0, progress.GetProgress());
+
+    progress.PagesLoaded(50);
+    EXPECT_EQ(25, progress.GetProgress());
+
+    progress.PagesLoaded(150);
+    EXPECT_EQ(100, progress.GetProgress());
+    progress.Complete();
+}
+
+TEST(MapLoadProgress, Start_testIfProgressIsResetForNextLoad)
+{
+    MapLoadProgress progress;
+    progress.Start(0, 10, 4096);
+    progress.PagesLoaded(10);
+
+    progress.Start(0, 10, 4096);
+    EXPECT_EQ(0, progress.GetProgress());
+}
+
+TEST(MapLoadProgress, GetProgress_testIfEmptyMapIsReportedAsLoaded)
+{
+    MapLoadProgress progress;
+    progress.Start(0, 0, 4096);
+    EXPECT_EQ(100, progress.GetProgress());
+}
+
+TEST(MapLoadProgress, GetThroughputInMBps_testIfLoadFinishedWithinAMillisecondIsHandled)
+{
+    MapLoadProgress progress;
+    progress.Start(0, 256, 4096);
+    progress.PagesLoaded(256);
+    EXPECT_GE(1000u, progress.GetThroughputInMBps());
+}
+
+} // namespace pos
@@ -25,6 +25,18 @@ public:
     MOCK_METHOD(char*, AllocateMpage, (uint64_t pageNr), (override));
     MOCK_METHOD(void, GetMpageLock, (uint64_t pageNr), (override));
     MOCK_METHOD(void, ReleaseMpageLock, (uint64_t pageNr), (override));
+    MOCK_METHOD(uint32_t, GetMpageSeq, (uint64_t pageNr), (override));
+    MOCK_METHOD(bool, IsMpageSeqChanged, (uint64_t pageNr, uint32_t seq), (override));
+    MOCK_METHOD(void, BeginMpageUpdate, (uint64_t pageNr), (override));
+    MOCK_METHOD(void, EndMpageUpdate, (uint64_t pageNr), (override));
+    MOCK_METHOD(void, FreezeMpage, (uint64_t pageNr, char* dest), (override));
+    MOCK_METHOD(void, CopyFrozenMpage, (uint64_t pageNr), (override));
+    MOCK_METHOD(bool, IsDemandPaged, (), (override));
+    MOCK_METHOD(void, MarkMpageDirty, (uint64_t pageNr), (override));
+    MOCK_METHOD(void, StartMpageFlush, (uint64_t pageNr), (override));
+    MOCK_METHOD(void, EndMpageFlush, (uint64_t pageNr), (override));
+    MOCK_METHOD(void, DropMpage, (uint64_t pageNr), (override));
+    MOCK_METHOD(char*, RestoreMpage, (uint64_t pageNr), (override));
 };
 
 } // namespace pos
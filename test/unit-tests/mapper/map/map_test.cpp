@@ -27,4 +27,75 @@ TEST(Map, AllocateMpage_)
     EXPECT_EQ(nullptr, ret);
 }
 
+TEST(Map, DropMpage_testIfDroppedMpageCanBeAllocatedAgain)
+{
+    Map map(5, 4032);
+    char* mpage = map.AllocateMpage(1);
+    mpage[0] = 0;
+
+    map.DropMpage(1);
+    EXPECT_EQ(nullptr, map.GetMpage(1));
+
+    EXPECT_EQ(mpage, map.AllocateMpage(1));
+    EXPECT_EQ((char)0xFF, mpage[0]);
+}
+
+TEST(Map, BeginMpageUpdate_testIfSeqIsOddWhileUpdating)
+{
+    Map map(5, 4032);
+    uint32_t seq = map.GetMpageSeq(2);
+
+    map.BeginMpageUpdate(2);
+    EXPECT_EQ(1, map.GetMpageSeq(2) % 2);
+    map.EndMpageUpdate(2);
+
+    EXPECT_EQ(0, map.GetMpageSeq(2) % 2);
+    EXPECT_TRUE(map.IsMpageSeqChanged(2, seq));
+    EXPECT_FALSE(map.IsMpageSeqChanged(3, map.GetMpageSeq(3)));
+}
+
+TEST(Map, CopyFrozenMpage_testIfFrozenImageIsCopied)
+{
+    // Given
+    Map map(2, 4032);
+    char* mpage = map.AllocateMpage(1);
+    mpage[0] = 1;
+    char dest[4032];
+
+    // When
+    map.GetMpageLock(1);
+    map.FreezeMpage(1, dest);
+    map.ReleaseMpageLock(1);
+    map.CopyFrozenMpage(1);
+
+    // Then
+    EXPECT_EQ(1, dest[0]);
+    EXPECT_EQ(MPAGE_COW_NONE, map.mPageArr[1].cowState);
+}
+
+TEST(Map, BeginMpageUpdate_testIfWriterCopiesFrozenPageFirst)
+{
+    // Given: a page frozen for a flush
+    Map map(2, 4032);
+    char* mpage = map.AllocateMpage(1);
+    mpage[0] = 1;
+    char dest[4032];
+    map.GetMpageLock(1);
+    map.FreezeMpage(1, dest);
+    map.ReleaseMpageLock(1);
+
+    // When: a writer updates the page before the flush copies it
+    map.GetMpageLock(1);
+    map.BeginMpageUpdate(1);
+    mpage[0] = 2;
+    map.EndMpageUpdate(1);
+    map.ReleaseMpageLock(1);
+    map.CopyFrozenMpage(1);
+
+    // Then: the flush still gets the frozen image
+    EXPECT_EQ(1, dest[0]);
+    EXPECT_EQ(2, mpage[0]);
+    EXPECT_EQ(MPAGE_COW_NONE, map.mPageArr[1].cowState);
+}
+
 } // namespace pos
@@ -0,0 +1,74 @@
+#include "src/mapper/map/mpage_cache.h"
+
+#include <gtest/gtest.h>
+
+#include "src/mapper/map/demand_paged_map.h"
+
+namespace pos
+{
+static const uint64_t TEST_MPAGE_SIZE = 4032;
+
+TEST(MpageCache, Allocate_testIfFramesAreCreatedUpToBudget)
+{
+    MpageCache cache(TEST_MPAGE_SIZE, 3);
+    DemandPagedMap map(10, TEST_MPAGE_SIZE, &cache);
+
+    for (uint64_t pageNr = 0; pageNr < 3; pageNr++)
+    {
+        EXPECT_NE(nullptr, map.AllocateMpage(pageNr));
+    }
+    EXPECT_EQ(3, cache.GetNumFrames());
+    EXPECT_EQ(3, cache.GetNumUsedFrames());
+    EXPECT_EQ(3, cache.GetBudget());
+
+    EXPECT_NE(nullptr, map.AllocateMpage(3));
+    EXPECT_EQ(3, cache.GetNumFrames());
+}
+
+TEST(MpageCache, Free_testIfFreedFrameIsReused)
+{
+    MpageCache cache(TEST_MPAGE_SIZE, 3);
+    DemandPagedMap map(10, TEST_MPAGE_SIZE, &cache);
+    char* frame = map.AllocateMpage(0);
+    map.AllocateMpage(1);
+
+    map.DropMpage(0);
+    EXPECT_EQ(1, cache.GetNumUsedFrames());
+
+    EXPECT_EQ(frame, map.AllocateMpage(5));
+    EXPECT_EQ(2, cache.GetNumFrames());
+}
+
+TEST(MpageCache, FreeAll_testIfFramesOfDeletedMapAreReleased)
+{
+    MpageCache cache(TEST_MPAGE_SIZE, 4);
+    DemandPagedMap* map = new DemandPagedMap(10, TEST_MPAGE_SIZE, &cache);
+    DemandPagedMap other(10, TEST_MPAGE_SIZE, &cache);
+    map->AllocateMpage(0);
+    map->AllocateMpage(1);
+    other.AllocateMpage(0);
+
+    delete map;
+
+    EXPECT_EQ(1, cache.GetNumUsedFrames());
+    EXPECT_NE(nullptr, other.GetMpage(0));
+}
+
+TEST(MpageCache, ReserveEncoded_testIfEncodedBudgetIsEnforced)
+{
+    MpageCache noEncoding(TEST_MPAGE_SIZE, 2);
+    EXPECT_FALSE(noEncoding.IsEncodingEnabled());
+
+    MpageCache cache(TEST_MPAGE_SIZE, 2, 100);
+    EXPECT_TRUE(cache.IsEncodingEnabled());
+    EXPECT_TRUE(cache.ReserveEncoded(60));
+    EXPECT_FALSE(cache.ReserveEncoded(41));
+    EXPECT_TRUE(cache.ReserveEncoded(40));
+
+    cache.ReleaseEncoded(60);
+    MpageCodecStats stats = cache.GetCodecStats();
+    EXPECT_EQ(1, stats.numEncodedPages);
+    EXPECT_EQ(40, stats.encodedBytes);
+}
+
+} // namespace pos
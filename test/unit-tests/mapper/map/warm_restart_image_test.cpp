@@ -0,0 +1,114 @@
+#include "src/mapper/map/warm_restart_image.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+
+#include "src/meta_file_intf/mock_file_intf.h"
+#include "test/unit-tests/mapper/address/mapper_address_info_mock.h"
+
+using ::testing::NiceMock;
+
+namespace pos
+{
+static const char* IMAGE_FILE_NAME = "WarmRestartImageTest";
+static const uint64_t NUM_MPAGES = 8;
+static const uint64_t MPAGE_SIZE = 4096;
+
+static void
+FillMpage(Map& map, MapHeader& header, uint64_t pageNr, char pattern)
+{
+    header.SetMapAllocated(pageNr);
+    memset(map.AllocateMpage(pageNr), pattern, MPAGE_SIZE);
+}
+
+TEST(WarmRestartImage, Restore_testIfMapIsRestoredWhenMapFileIsUnchanged)
+{
+    // Given: the header is flushed before the image is stored, as StoreAll() does
+    NiceMock<MockMapperAddressInfo> addrInfo;
+    Map map(NUM_MPAGES, MPAGE_SIZE);
+    MapHeader header(0);
+    header.Init(NUM_MPAGES, MPAGE_SIZE);
+    FillMpage(map, header, 1, 0x11);
+    FillMpage(map, header, 5, 0x55);
+    char* headerOnFile = new char[header.GetSize()]();
+    header.CopyToBuffer(headerOnFile);
+
+    WarmRestartImage* image = new WarmRestartImage(&addrInfo, new MockFileIntf(IMAGE_FILE_NAME, 0, MetaFileType::Map));
+    image->AddMap(0, &header, &map);
+    EXPECT_EQ(0, image->Store());
+    delete image;
+
+    // When
+    WarmRestartImage loader(&addrInfo, new MockFileIntf(IMAGE_FILE_NAME, 0, MetaFileType::Map));
+    EXPECT_EQ(0, loader.Load());
+    EXPECT_EQ(1, loader.GetNumLoadedMaps());
+    Map restoredMap(NUM_MPAGES, MPAGE_SIZE);
+    MapHeader restoredHeader(0);
+    restoredHeader.Init(NUM_MPAGES, MPAGE_SIZE);
+    restoredHeader.ApplyHeader(headerOnFile);
+    bool ret = loader.Restore(0, &restoredHeader, &restoredMap);
+
+    // Then
+    EXPECT_TRUE(ret);
+    EXPECT_EQ(0, memcmp(map.GetMpage(1), restoredMap.GetMpage(1), MPAGE_SIZE));
+    EXPECT_EQ(0, memcmp(map.GetMpage(5), restoredMap.GetMpage(5), MPAGE_SIZE));
+    EXPECT_EQ(0, loader.GetNumLoadedMaps());
+
+    delete[] headerOnFile;
+    remove(IMAGE_FILE_NAME);
+}
+
+TEST(WarmRestartImage, Restore_testIfMapWrittenAfterImageIsNotRestored)
+{
+    // Given: the map is flushed again after the image is stored
+    NiceMock<MockMapperAddressInfo> addrInfo;
+    Map map(NUM_MPAGES, MPAGE_SIZE);
+    MapHeader header(0);
+    header.Init(NUM_MPAGES, MPAGE_SIZE);
+    FillMpage(map, header, 2, 0x22);
+
+    WarmRestartImage* image = new WarmRestartImage(&addrInfo, new MockFileIntf(IMAGE_FILE_NAME, 0, MetaFileType::Map));
+    image->AddMap(0, &header, &map);
+    EXPECT_EQ(0, image->Store());
+    delete image;
+    char* headerOnFile = new char[header.GetSize()]();
+    header.CopyToBuffer(headerOnFile);
+
+    // When
+    WarmRestartImage loader(&addrInfo, new MockFileIntf(IMAGE_FILE_NAME, 0, MetaFileType::Map));
+    EXPECT_EQ(0, loader.Load());
+    Map restoredMap(NUM_MPAGES, MPAGE_SIZE);
+    MapHeader restoredHeader(0);
+    restoredHeader.Init(NUM_MPAGES, MPAGE_SIZE);
+    restoredHeader.ApplyHeader(headerOnFile);
+    bool ret = loader.Restore(0, &restoredHeader, &restoredMap);
+
+    // Then
+    EXPECT_FALSE(ret);
+    EXPECT_EQ(0, loader.GetNumLoadedMaps());
+
+    delete[] headerOnFile;
+    remove(IMAGE_FILE_NAME);
+}
+
+TEST(WarmRestartImage, Load_testIfImageWithoutHeaderIsIgnored)
+{
+    // Given: an image whose header was never written
+    NiceMock<MockMapperAddressInfo> addrInfo;
+    MockFileIntf* file = new MockFileIntf(IMAGE_FILE_NAME, 0, MetaFileType::Map);
+    file->Create(WarmRestartImage::HEADER_SIZE * 2);
+    WarmRestartImage loader(&addrInfo, file);
+
+    // When
+    int ret = loader.Load();
+
+    // Then
+    EXPECT_NE(0, ret);
+    EXPECT_EQ(0, loader.GetNumLoadedMaps());
+
+    remove(IMAGE_FILE_NAME);
+}
+
+} // namespace pos
@@ -0,0 +1,47 @@
+#include "src/mapper/map_flush_batch.h"
+
+#include <gtest/gtest.h>
+
+#include "test/unit-tests/event_scheduler/event_mock.h"
+#include "test/unit-tests/event_scheduler/event_scheduler_mock.h"
+
+using ::testing::_;
+using testing::NiceMock;
+
+namespace pos
+{
+TEST(MapFlushBatch, MapFlushed_testIfCallbackIsEnqueuedOnceAfterLastMap)
+{
+    // given
+    NiceMock<MockEventScheduler> eventScheduler;
+    EventSmartPtr callback = std::make_shared<NiceMock<MockEvent>>();
+    std::shared_ptr<MapFlushBatch> batch = std::make_shared<MapFlushBatch>(3, callback, &eventScheduler);
+    MapBatchFlushedEvent first(batch);
+    MapBatchFlushedEvent second(batch);
+
+    // when
+    EXPECT_CALL(eventScheduler, EnqueueEvent(callback)).Times(1);
+    EXPECT_TRUE(first.Execute());
+    EXPECT_TRUE(second.Execute());
+    EXPECT_EQ(1, batch->GetNumMapsRemaining());
+    batch->MapFlushed();
+
+    // then
+    EXPECT_EQ(0, batch->GetNumMapsRemaining());
+}
+
+TEST(MapFlushBatch, MapFlushed_testIfNullCallbackIsNotEnqueued)
+{
+    // given
+    NiceMock<MockEventScheduler> eventScheduler;
+    MapFlushBatch batch(1, nullptr, &eventScheduler);
+
+    // when
+    EXPECT_CALL(eventScheduler, EnqueueEvent).Times(0);
+    batch.MapFlushed();
+
+    // then
+    EXPECT_EQ(0, batch.GetNumMapsRemaining());
+}
+
+} // namespace pos
@@ -34,11 +34,17 @@ public:
     MOCK_METHOD(int, VolumeCreated, (int volId, uint64_t volSizeByte), (override));
     MOCK_METHOD(int, VolumeMounted, (int volId, uint64_t volSizeByte), (override));
     MOCK_METHOD(int, VolumeLoaded, (int volId, uint64_t volSizeByte), (override));
+    MOCK_METHOD(int, VolumeResized, (int volId, uint64_t volSizeByte), (override));
     MOCK_METHOD(int, VolumeUnmounted, (int volId, bool flushMapRequired), (override));
     MOCK_METHOD(int, PrepareVolumeDelete, (int volId), (override));
     MOCK_METHOD(int, DeleteVolumeMap, (int volumeId), (override));
+    MOCK_METHOD(int, DetachVolumeMap, (int volId), (override));
+    MOCK_METHOD(bool, CollectDetachedBlocks, (int volId, uint64_t& mpageId, uint32_t numMpages, std::vector<VirtualBlks>& validBlks), (override));
+    MOCK_METHOD(int, DeleteDetachedMap, (int volId), (override));
+    MOCK_METHOD(std::vector<int>, GetDetachedVolumes, (), (override));
     MOCK_METHOD(int, VolumeDetached, (vector<int> volList), (override));
     MOCK_METHOD(int, GetVSAs, (int volId, BlkAddr startRba, uint32_t numBlks, VsaArray& vsaArray), (override));
+    MOCK_METHOD(int, GetVsaExtents, (int volId, BlkAddr startRba, uint32_t numBlks, VsaExtentArray& extents, uint32_t& numExtents), (override));
     MOCK_METHOD(int, SetVSAs, (int volId, BlkAddr startRba, VirtualBlks& virtualBlks), (override));
     MOCK_METHOD(VirtualBlkAddr, GetRandomVSA, (BlkAddr rba), (override));
     MOCK_METHOD(int64_t, GetNumUsedBlks, (int volId), (override));
@@ -46,11 +52,15 @@ public:
     MOCK_METHOD(int, SetVSAsInternal, (int volId, BlkAddr startRba, VirtualBlks& virtualBlks), (override));
     MOCK_METHOD(VirtualBlkAddr, GetVSAWithSyncOpen, (int volId, BlkAddr rba), (override));
     MOCK_METHOD(int, SetVSAsWithSyncOpen, (int volId, BlkAddr startRba, VirtualBlks& virtualBlks), (override));
+    MOCK_METHOD(int, UnmapVSAs, (int volId, BlkAddr startRba, uint64_t numBlks, std::vector<VirtualBlks>& oldBlks), (override));
+    MOCK_METHOD(int, UnmapVSAsWithSyncOpen, (int volId, BlkAddr startRba, uint64_t numBlks, std::vector<VirtualBlks>& oldBlks), (override));
     MOCK_METHOD(MpageList, GetDirtyVsaMapPages, (int volId, BlkAddr startRba, uint64_t numBlks), (override));
     MOCK_METHOD(int, EnableInternalAccess, (int volId), (override));
     MOCK_METHOD(int, FlushDirtyMpages, (int mapId, EventSmartPtr callback), (override));
     MOCK_METHOD(int, FlushDirtyMpagesGiven, (int mapId, EventSmartPtr callback, MpageList dirtyPages), (override));
+    MOCK_METHOD(int, FlushDirtyMaps, (const MapList& mapIds, EventSmartPtr callback), (override));
     MOCK_METHOD(int, StoreAll, (), (override));
+    MOCK_METHOD(uint64_t, GetNumDirtyMpages, (), (override));
     MOCK_METHOD(void, SetVolumeState, (int volId, VolState state, uint64_t size), (override));
 };
 
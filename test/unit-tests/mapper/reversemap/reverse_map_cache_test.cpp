@@ -0,0 +1,112 @@
+#include "src/mapper/reversemap/reverse_map_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <tuple>
+
+namespace pos
+{
+static const uint32_t TEST_BLKS_PER_STRIPE = 128;
+static const uint64_t TEST_BYTES_PER_STRIPE = DEFAULT_REVMAP_PAGE_SIZE;
+
+static void
+FillPack(ReverseMapPack& pack)
+{
+    // two runs of consecutive rbas in different volumes, and an unwritten tail
+    for (uint64_t offset = 0; offset < 64; offset++)
+    {
+        pack.SetReverseMapEntry(offset, 1000 + offset, 1);
+    }
+    for (uint64_t offset = 64; offset < 100; offset++)
+    {
+        pack.SetReverseMapEntry(offset, 20 + offset, 2);
+    }
+}
+
+TEST(ReverseMapCache, Restore_testIfFlushedPackIsRestoredAsIs)
+{
+    // Given
+    ReverseMapCache cache(4, TEST_BLKS_PER_STRIPE, TEST_BYTES_PER_STRIPE);
+    ReverseMapPack flushed(7, 3, DEFAULT_REVMAP_PAGE_SIZE, 1);
+    FillPack(flushed);
+    cache.Store(&flushed);
+
+    // When
+    ReverseMapPack loaded(7, 0, DEFAULT_REVMAP_PAGE_SIZE, 1);
+    bool restored = cache.Restore(&loaded);
+
+    // Then
+    EXPECT_TRUE(restored);
+    EXPECT_EQ(0, memcmp(flushed.GetReverseMapPages()[0].buffer, loaded.GetReverseMapPages()[0].buffer, DEFAULT_REVMAP_PAGE_SIZE));
+    EXPECT_EQ(0, loaded.HeaderLoaded());
+
+    ReverseMapCacheStats stats = cache.GetStats();
+    EXPECT_EQ(1, stats.numHits);
+    EXPECT_EQ(TEST_BYTES_PER_STRIPE, stats.savedBytes);
+    EXPECT_EQ(REVMAP_SECTOR_SIZE + 3 * sizeof(RevMapRun), stats.encodedBytes);
+}
+
+TEST(ReverseMapCache, Store_testIfLeastRecentlyUsedPackIsEvicted)
+{
+    // Given
+    ReverseMapCache cache(2, TEST_BLKS_PER_STRIPE, TEST_BYTES_PER_STRIPE);
+    ReverseMapPack pack0(0, 0, DEFAULT_REVMAP_PAGE_SIZE, 1);
+    ReverseMapPack pack1(1, 1, DEFAULT_REVMAP_PAGE_SIZE, 1);
+    ReverseMapPack pack2(2, 2, DEFAULT_REVMAP_PAGE_SIZE, 1);
+    cache.Store(&pack0);
+    cache.Store(&pack1);
+
+    // When: pack0 is used again before pack2 is stored
+    EXPECT_TRUE(cache.Restore(&pack0));
+    cache.Store(&pack2);
+
+    // Then: pack1 is evicted
+    EXPECT_TRUE(cache.Restore(&pack0));
+    EXPECT_FALSE(cache.Restore(&pack1));
+    EXPECT_TRUE(cache.Restore(&pack2));
+    EXPECT_EQ(2, cache.GetStats().numCachedPacks);
+}
+
+TEST(ReverseMapCache, GetChecksum_testIfBlockChecksumsAreKeptWithPack)
+{
+    // Given
+    ReverseMapCache cache(4, TEST_BLKS_PER_STRIPE, TEST_BYTES_PER_STRIPE);
+    ReverseMapPack flushed(9, 4, DEFAULT_REVMAP_PAGE_SIZE, 1);
+    FillPack(flushed);
+    flushed.SetReverseMapChecksum(3, 0x12345);
+    flushed.SetReverseMapChecksum(70, 0);
+    cache.Store(&flushed);
+
+    // When
+    ReverseMapPack loaded(9, 0, DEFAULT_REVMAP_PAGE_SIZE, 1);
+    EXPECT_TRUE(cache.Restore(&loaded));
+
+    // Then
+    uint32_t checksum = 0;
+    EXPECT_TRUE(cache.GetChecksum(9, 3, checksum));
+    EXPECT_EQ(0x12345, checksum);
+    EXPECT_TRUE(cache.GetChecksum(9, 70, checksum));
+    EXPECT_EQ(0, checksum);
+    EXPECT_FALSE(cache.GetChecksum(9, 4, checksum));
+    EXPECT_FALSE(cache.GetChecksum(8, 3, checksum));
+    EXPECT_EQ(0, memcmp(flushed.GetReverseMapPages()[0].buffer, loaded.GetReverseMapPages()[0].buffer, DEFAULT_REVMAP_PAGE_SIZE));
+    EXPECT_EQ(std::make_tuple(1003, 1), loaded.GetReverseMapEntry(3));
+}
+
+TEST(ReverseMapCache, Invalidate_testIfInvalidatedPackIsNotRestored)
+{
+    // Given
+    ReverseMapCache cache(4, TEST_BLKS_PER_STRIPE, TEST_BYTES_PER_STRIPE);
+    ReverseMapPack pack(5, 5, DEFAULT_REVMAP_PAGE_SIZE, 1);
+    cache.Store(&pack);
+
+    // When
+    cache.Invalidate(5);
+
+    // Then
+    EXPECT_FALSE(cache.Restore(&pack));
+    EXPECT_EQ(1, cache.GetStats().numMisses);
+    EXPECT_EQ(0, cache.GetStats().encodedBytes);
+}
+
+} // namespace pos
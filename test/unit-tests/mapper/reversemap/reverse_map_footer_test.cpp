@@ -0,0 +1,145 @@
+#include "src/mapper/reversemap/reverse_map_footer.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "src/include/memory.h"
+#include "src/include/pos_event_id.h"
+#include "test/unit-tests/event_scheduler/event_scheduler_mock.h"
+#include "test/unit-tests/master_context/config_manager_mock.h"
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+class FooterLoadCallback : public Callback
+{
+public:
+    FooterLoadCallback(void)
+    : Callback(false)
+    {
+    }
+    uint32_t
+    GetErrorCount(void)
+    {
+        return _GetErrorCount();
+    }
+
+private:
+    bool
+    _DoSpecificJob(void) override
+    {
+        return true;
+    }
+};
+
+TEST(ReverseMapFooter, GetNumMpages_testIfFirstPageKeepsRoomForHeader)
+{
+    // Given: 315 entries fit the first page, 336 each of the others
+
+    // When, Then
+    EXPECT_EQ(1, ReverseMapFooter::GetNumMpages(315, DEFAULT_REVMAP_PAGE_SIZE));
+    EXPECT_EQ(2, ReverseMapFooter::GetNumMpages(316, DEFAULT_REVMAP_PAGE_SIZE));
+    EXPECT_EQ(2, ReverseMapFooter::GetNumMpages(315 + 336, DEFAULT_REVMAP_PAGE_SIZE));
+    EXPECT_EQ(3, ReverseMapFooter::GetNumMpages(315 + 336 + 1, DEFAULT_REVMAP_PAGE_SIZE));
+}
+
+TEST(ReverseMapFooter, LoadConfig_testIfFooterIsDisabledByDefault)
+{
+    // Given
+    NiceMock<MockConfigManager> configManager;
+    ON_CALL(configManager, GetValue).WillByDefault(Return(EID(CONFIG_REQUEST_KEY_ERROR)));
+
+    // When, Then
+    EXPECT_FALSE(ReverseMapFooter::LoadConfig(&configManager));
+}
+
+TEST(ReverseMapFooter, LoadConfig_testIfFooterIsEnabledByConfig)
+{
+    // Given
+    NiceMock<MockConfigManager> configManager;
+    ON_CALL(configManager, GetValue).WillByDefault(Invoke(
+        [](string module, string key, void* value, ConfigType type)
+        {
+            *static_cast<bool*>(value) = true;
+            return EID(SUCCESS);
+        }));
+
+    // When, Then
+    EXPECT_TRUE(ReverseMapFooter::LoadConfig(&configManager));
+}
+
+TEST(ReverseMapFooter, Store_testIfPackIsRestoredFromLastBlocksOfStripe)
+{
+    // Given: a stripe of 1024 blocks keeps its pack in the last 4 blocks
+    const uint32_t blksPerStripe = 1024;
+    uint32_t numMpages = ReverseMapFooter::GetNumMpages(blksPerStripe, DEFAULT_REVMAP_PAGE_SIZE);
+    ReverseMapPack stored(10, 20, DEFAULT_REVMAP_PAGE_SIZE, numMpages);
+    for (uint32_t offset = 0; offset < blksPerStripe - numMpages; offset++)
+    {
+        stored.SetReverseMapEntry(offset, offset * 3, 5);
+    }
+    std::vector<char> stripe(blksPerStripe * BLOCK_SIZE, 0);
+
+    // When
+    ReverseMapFooter::Store(&stored, blksPerStripe,
+        [&stripe](uint32_t offset) { return stripe.data() + offset * BLOCK_SIZE; });
+    ReverseMapPack loaded(10, UINT32_MAX, DEFAULT_REVMAP_PAGE_SIZE, numMpages);
+    ReverseMapFooter::Restore(&loaded, stripe.data() + (blksPerStripe - numMpages) * BLOCK_SIZE);
+
+    // Then
+    EXPECT_EQ(4, numMpages);
+    EXPECT_EQ(0, stripe[0]);
+    EXPECT_EQ(EID(SUCCESS), loaded.HeaderLoaded());
+    for (uint32_t offset = 0; offset < blksPerStripe - numMpages; offset++)
+    {
+        EXPECT_EQ(std::make_tuple(static_cast<BlkAddr>(offset * 3), 5u), loaded.GetReverseMapEntry(offset));
+    }
+}
+
+TEST(ReverseMapFooterLoadCompletion, Execute_testIfReadErrorIsPassedToCallback)
+{
+    // Given: the read of the footer has failed
+    NiceMock<MockEventScheduler> eventScheduler;
+    ReverseMapPack pack(10, 20, DEFAULT_REVMAP_PAGE_SIZE, 1);
+    auto callback = std::make_shared<FooterLoadCallback>();
+    bool loadDone = false;
+    ReverseMapFooterLoadCompletion completion(&pack, Memory<BLOCK_SIZE>::Alloc(1), callback,
+        [&loadDone](void) { loadDone = true; }, &eventScheduler);
+    completion.InformError(IOErrorType::DEVICE_ERROR);
+
+    // When
+    EXPECT_CALL(eventScheduler, EnqueueEvent(EventSmartPtr(callback))).Times(1);
+    EXPECT_TRUE(completion.Execute());
+
+    // Then: the callback is still invoked, with the error
+    EXPECT_TRUE(loadDone);
+    EXPECT_EQ(1, callback->GetErrorCount());
+}
+
+TEST(ReverseMapFooterLoadCompletion, Execute_testIfBrokenFooterIsPassedToCallback)
+{
+    // Given: the footer read has no reverse map header
+    NiceMock<MockEventScheduler> eventScheduler;
+    ReverseMapPack pack(10, 20, DEFAULT_REVMAP_PAGE_SIZE, 1);
+    auto callback = std::make_shared<FooterLoadCallback>();
+    void* buffer = Memory<BLOCK_SIZE>::Alloc(1);
+    memset(buffer, 0, BLOCK_SIZE);
+    ReverseMapFooterLoadCompletion completion(&pack, buffer, callback, nullptr, &eventScheduler);
+
+    // When
+    EXPECT_CALL(eventScheduler, EnqueueEvent(EventSmartPtr(callback))).Times(1);
+    EXPECT_TRUE(completion.Execute());
+
+    // Then
+    EXPECT_EQ(1, callback->GetErrorCount());
+}
+
+} // namespace pos
@@ -38,6 +38,8 @@ public:
     using ReverseMapPack::ReverseMapPack;
     MOCK_METHOD(int, SetReverseMapEntry, (uint64_t offset, BlkAddr rba, uint32_t volumeId), (override));
     MOCK_METHOD((std::tuple<BlkAddr, uint32_t>), GetReverseMapEntry, (uint64_t offset), (override));
+    MOCK_METHOD(void, SetReverseMapChecksum, (uint64_t offset, uint32_t checksum), (override));
+    MOCK_METHOD(uint32_t, GetReverseMapChecksum, (uint64_t offset), (override));
     MOCK_METHOD(std::vector<ReverseMapPage>, GetReverseMapPages, (), (override));
     MOCK_METHOD(int, HeaderLoaded, (), (override));
     MOCK_METHOD(char*, GetRevMapPtrForWBT, (), (override));
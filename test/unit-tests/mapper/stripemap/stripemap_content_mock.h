@@ -16,6 +16,7 @@ public:
     MOCK_METHOD(MpageList, GetDirtyPages, (uint64_t start, uint64_t numEntries), (override));
     MOCK_METHOD(StripeAddr, GetEntry, (StripeId vsid), (override));
     MOCK_METHOD(int, SetEntry, (StripeId vsid, StripeAddr entry), (override));
+    MOCK_METHOD(void, RebuildLookupTable, (), (override));
 
     MOCK_METHOD(int, Init, (uint64_t numEntries, uint64_t entrySize, uint64_t mpageSize), (override));
     MOCK_METHOD(void, Dispose, (), (override));
@@ -29,6 +30,7 @@ public:
     MOCK_METHOD(int, Dump, (std::string fileName), (override));
     MOCK_METHOD(int, DumpLoad, (std::string fileName), (override));
     MOCK_METHOD(uint64_t, GetEntriesPerPage, (), (override));
+    MOCK_METHOD(uint64_t, GetNumDirtyPages, (), (override));
 };
 
 } // namespace pos
@@ -36,4 +36,51 @@ TEST(StripeMapContent, SetEntry_TestFail)
     EXPECT_EQ(ERRID(STRIPEMAP_SET_FAILURE), ret);
 }
 
+TEST(StripeMapContent, GetEntry_testIfEntryIsReadFromLookupTable)
+{
+    // Given
+    MapperAddressInfo info;
+    NiceMock<MockMap>* map = new NiceMock<MockMap>();
+    info.SetIsUT(true);
+    StripeMapContent scon(map, 0, &info);
+    scon.InMemoryInit(100, 4032);
+    uint32_t buf[1008];
+
+    // When
+    EXPECT_CALL(*map, AllocateMpage).WillOnce(Return((char*)buf));
+    StripeAddr sa = {.stripeLoc = IN_USER_AREA, .stripeId = 77};
+    int ret = scon.SetEntry(5, sa);
+
+    // Then
+    EXPECT_EQ(0, ret);
+    EXPECT_CALL(*map, GetMpage).Times(0);
+    StripeAddr unmapped = scon.GetEntry(4);
+    EXPECT_EQ(IN_WRITE_BUFFER_AREA, unmapped.stripeLoc);
+    EXPECT_EQ(UNMAP_STRIPE, unmapped.stripeId);
+    StripeAddr stored = scon.GetEntry(5);
+    EXPECT_EQ(IN_USER_AREA, stored.stripeLoc);
+    EXPECT_EQ(77U, stored.stripeId);
+}
+
+TEST(StripeMapContent, RebuildLookupTable_testIfLoadedEntriesAreVisible)
+{
+    // Given
+    MapperAddressInfo info;
+    NiceMock<MockMap>* map = new NiceMock<MockMap>();
+    info.SetIsUT(true);
+    StripeMapContent scon(map, 0, &info);
+    scon.InMemoryInit(100, 4032);
+    StripeAddr buf[1008];
+    buf[10] = {.stripeLoc = IN_WRITE_BUFFER_AREA, .stripeId = 3};
+
+    // When
+    EXPECT_CALL(*map, GetMpage(0)).WillRepeatedly(Return((char*)buf));
+    scon.RebuildLookupTable();
+
+    // Then
+    StripeAddr loaded = scon.GetEntry(10);
+    EXPECT_EQ(IN_WRITE_BUFFER_AREA, loaded.stripeLoc);
+    EXPECT_EQ(3U, loaded.stripeId);
+}
+
 } // namespace pos
@@ -117,6 +117,27 @@ TEST(StripeMapManager, FlushTouchedPages_TestFailCase1)
     EXPECT_EQ(-1, ret);
 }
 
+TEST(StripeMapManager, GetLSAandReferLsid_testIfUserAreaStripeIsNotReferred)
+{
+    // Given
+    NiceMock<MockMapperAddressInfo> addrInfo;
+    NiceMock<MockStripeMapContent>* con = new NiceMock<MockStripeMapContent>();
+    NiceMock<MockEventScheduler> eventScheduler;
+    StripeMapManager smap(nullptr, con, &eventScheduler, &addrInfo);
+    StripeAddr entry = {.stripeLoc = IN_USER_AREA, .stripeId = 7};
+    EXPECT_CALL(*con, GetEntry(3)).WillOnce(Return(entry));
+
+    // When
+    StripeAddr lsa;
+    bool referenced;
+    std::tie(lsa, referenced) = smap.GetLSAandReferLsid(3);
+
+    // Then
+    EXPECT_EQ(IN_USER_AREA, lsa.stripeLoc);
+    EXPECT_EQ(7U, lsa.stripeId);
+    EXPECT_EQ(false, referenced);
+}
+
 TEST(StripeMapManager, WaitWritePendingIoDone_TestSimpleCaller)
 {
     MapperAddressInfo addrInfo;
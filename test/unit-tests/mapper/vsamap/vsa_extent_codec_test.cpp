@@ -0,0 +1,67 @@
+#include "src/mapper/vsamap/vsa_extent_codec.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+namespace pos
+{
+static const uint64_t TEST_MPAGE_SIZE = 4032;
+static const uint64_t TEST_NUM_ENTRIES = TEST_MPAGE_SIZE / sizeof(VirtualBlkAddr);
+
+TEST(VsaExtentCodec, Encode_testIfSequentialMpageIsEncodedIntoFewExtents)
+{
+    VsaExtentCodec codec;
+    VirtualBlkAddr entries[TEST_NUM_ENTRIES];
+    for (uint32_t idx = 0; idx < TEST_NUM_ENTRIES; ++idx)
+    {
+        entries[idx] = {.stripeId = 10 + idx / 128, .offset = idx % 128};
+    }
+    entries[TEST_NUM_ENTRIES - 1] = UNMAP_VSA;
+    entries[TEST_NUM_ENTRIES - 2] = UNMAP_VSA;
+
+    std::vector<uint8_t> encoded;
+    EXPECT_TRUE(codec.Encode((char*)entries, TEST_MPAGE_SIZE, encoded));
+    EXPECT_EQ(5 * sizeof(VirtualBlks), encoded.size());
+
+    VirtualBlkAddr decoded[TEST_NUM_ENTRIES];
+    codec.Decode(encoded, (char*)decoded, TEST_MPAGE_SIZE);
+    for (uint32_t idx = 0; idx < TEST_NUM_ENTRIES; ++idx)
+    {
+        EXPECT_EQ(entries[idx], decoded[idx]);
+    }
+}
+
+TEST(VsaExtentCodec, Encode_testIfUnmappedMpageIsEncodedIntoOneExtent)
+{
+    VsaExtentCodec codec;
+    char mpage[TEST_MPAGE_SIZE];
+    memset(mpage, 0xFF, TEST_MPAGE_SIZE);
+
+    std::vector<uint8_t> encoded;
+    EXPECT_TRUE(codec.Encode(mpage, TEST_MPAGE_SIZE, encoded));
+    EXPECT_EQ(sizeof(VirtualBlks), encoded.size());
+
+    VirtualBlkAddr decoded[TEST_NUM_ENTRIES];
+    memset(decoded, 0, TEST_MPAGE_SIZE);
+    codec.Decode(encoded, (char*)decoded, TEST_MPAGE_SIZE);
+    for (uint32_t idx = 0; idx < TEST_NUM_ENTRIES; ++idx)
+    {
+        EXPECT_TRUE(IsUnMapVsa(decoded[idx]));
+    }
+}
+
+TEST(VsaExtentCodec, Encode_testIfRandomlyWrittenMpageIsNotEncoded)
+{
+    VsaExtentCodec codec;
+    VirtualBlkAddr entries[TEST_NUM_ENTRIES];
+    for (uint32_t idx = 0; idx < TEST_NUM_ENTRIES; ++idx)
+    {
+        entries[idx] = {.stripeId = idx, .offset = 0};
+    }
+
+    std::vector<uint8_t> encoded;
+    EXPECT_FALSE(codec.Encode((char*)entries, TEST_MPAGE_SIZE, encoded));
+}
+
+} // namespace pos
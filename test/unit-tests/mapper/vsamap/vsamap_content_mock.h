@@ -16,9 +16,14 @@ public:
     MOCK_METHOD(int, InMemoryInit, (uint64_t volId, uint64_t numEntries, uint64_t mpageSize), (override));
     MOCK_METHOD(VirtualBlkAddr, GetEntry, (BlkAddr rba), (override));
     MOCK_METHOD(int, SetEntry, (BlkAddr rba, VirtualBlkAddr vsa), (override));
+    MOCK_METHOD(void, GetEntries, (BlkAddr startRba, uint32_t numBlks, VirtualBlkAddr* vsas), (override));
+    MOCK_METHOD(int, SetEntries, (BlkAddr startRba, VirtualBlks& vsas), (override));
+    MOCK_METHOD(int, UnmapEntries, (BlkAddr startRba, uint64_t numBlks, std::vector<VirtualBlks>& oldBlks), (override));
     MOCK_METHOD(int64_t, GetNumUsedBlks, (), (override));
+    MOCK_METHOD(uint64_t, GetNumEntries, (), (override));
     MOCK_METHOD(void, SetCallback, (EventSmartPtr cb), (override));
     MOCK_METHOD(EventSmartPtr, GetCallback, (), (override));
+    MOCK_METHOD(void, SetMpageCache, (MpageCache* cache), (override));
 
     MOCK_METHOD(int, Init, (uint64_t numEntries, uint64_t entrySize, uint64_t mpageSize), (override));
     MOCK_METHOD(void, Dispose, (), (override));
@@ -32,6 +37,7 @@ public:
     MOCK_METHOD(int, Dump, (std::string fileName), (override));
     MOCK_METHOD(int, DumpLoad, (std::string fileName), (override));
     MOCK_METHOD(uint64_t, GetEntriesPerPage, (), (override));
+    MOCK_METHOD(uint64_t, GetNumDirtyPages, (), (override));
 };
 
 } // namespace pos
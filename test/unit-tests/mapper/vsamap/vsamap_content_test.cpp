@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 
+#include "src/lib/bitmap.h"
 #include "src/mapper/address/mapper_address_info.h"
 #include "test/unit-tests/io/frontend_io/flush_command_manager_mock.h"
 #include "test/unit-tests/mapper/address/mapper_address_info_mock.h"
@@ -67,4 +68,192 @@ TEST(VSAMapContent, SetEntry_Success)
     delete fl;
 }
 
+TEST(VSAMapContent, GetEntry_testIfDemandPagedEntryIsReadWithoutMpageLock)
+{
+    NiceMock<MockMapperAddressInfo> info;
+    NiceMock<MockFlushCmdManager>* fl = new NiceMock<MockFlushCmdManager>();
+    NiceMock<MockMapHeader>* header = new NiceMock<MockMapHeader>(0);
+    NiceMock<MockMap>* map = new NiceMock<MockMap>(0, 4032);
+    VSAMapContent vsacon(0, &info, fl, map, header);
+    vsacon.Init(5, sizeof(VirtualBlkAddr), 4032);
+
+    VirtualBlkAddr buf[4032 / sizeof(VirtualBlkAddr)];
+    buf[3] = {.stripeId = 10, .offset = 20};
+    EXPECT_CALL(*map, IsDemandPaged).WillRepeatedly(Return(true));
+    EXPECT_CALL(*map, GetNumMpages).WillRepeatedly(Return(1));
+    EXPECT_CALL(*map, GetMpageSeq(0)).WillOnce(Return(2));
+    EXPECT_CALL(*map, GetMpage(0)).WillOnce(Return((char*)buf));
+    EXPECT_CALL(*map, IsMpageSeqChanged(0, 2)).WillOnce(Return(false));
+    EXPECT_CALL(*map, GetMpageLock).Times(0);
+
+    VirtualBlkAddr vsa = vsacon.GetEntry(3);
+    EXPECT_EQ(10, vsa.stripeId);
+    EXPECT_EQ(20, vsa.offset);
+
+    delete fl;
+}
+
+TEST(VSAMapContent, GetEntry_testIfDemandPagedEntryIsReadUnderMpageLockWhenRacingWithWriter)
+{
+    NiceMock<MockMapperAddressInfo> info;
+    NiceMock<MockFlushCmdManager>* fl = new NiceMock<MockFlushCmdManager>();
+    NiceMock<MockMapHeader>* header = new NiceMock<MockMapHeader>(0);
+    NiceMock<MockMap>* map = new NiceMock<MockMap>(0, 4032);
+    VSAMapContent vsacon(0, &info, fl, map, header);
+    vsacon.Init(5, sizeof(VirtualBlkAddr), 4032);
+
+    VirtualBlkAddr buf[4032 / sizeof(VirtualBlkAddr)];
+    buf[3] = {.stripeId = 10, .offset = 20};
+    EXPECT_CALL(*map, IsDemandPaged).WillRepeatedly(Return(true));
+    EXPECT_CALL(*map, GetNumMpages).WillRepeatedly(Return(1));
+    EXPECT_CALL(*map, GetMpageSeq(0)).WillOnce(Return(3));
+    EXPECT_CALL(*map, GetMpageLock(0)).Times(1);
+    EXPECT_CALL(*map, GetMpage(0)).WillOnce(Return((char*)buf));
+    EXPECT_CALL(*map, ReleaseMpageLock(0)).Times(1);
+
+    VirtualBlkAddr vsa = vsacon.GetEntry(3);
+    EXPECT_EQ(10, vsa.stripeId);
+    EXPECT_EQ(20, vsa.offset);
+
+    delete fl;
+}
+
+TEST(VSAMapContent, GetEntries_testIfEntriesAreReadAcrossMpages)
+{
+    NiceMock<MockMapperAddressInfo> info;
+    NiceMock<MockFlushCmdManager>* fl = new NiceMock<MockFlushCmdManager>();
+    NiceMock<MockMapHeader>* header = new NiceMock<MockMapHeader>(0);
+    NiceMock<MockMap>* map = new NiceMock<MockMap>(0, 64);
+    VSAMapContent vsacon(0, &info, fl, map, header);
+    vsacon.Init(16, sizeof(VirtualBlkAddr), 64);
+
+    VirtualBlkAddr buf[8];
+    for (uint32_t idx = 0; idx < 8; ++idx)
+    {
+        buf[idx] = {.stripeId = 1, .offset = idx};
+    }
+    EXPECT_CALL(*map, IsDemandPaged).WillRepeatedly(Return(false));
+    EXPECT_CALL(*map, GetMpage(0)).WillOnce(Return((char*)buf));
+    EXPECT_CALL(*map, GetMpage(1)).WillOnce(Return(nullptr));
+
+    VirtualBlkAddr vsas[4];
+    vsacon.GetEntries(6, 4, vsas);
+    EXPECT_EQ(6, vsas[0].offset);
+    EXPECT_EQ(7, vsas[1].offset);
+    EXPECT_EQ(UNMAP_VSA, vsas[2]);
+    EXPECT_EQ(UNMAP_VSA, vsas[3]);
+
+    delete fl;
+}
+
+TEST(VSAMapContent, SetEntries_testIfMpageLockIsTakenOncePerMpage)
+{
+    NiceMock<MockMapperAddressInfo> info;
+    NiceMock<MockFlushCmdManager>* fl = new NiceMock<MockFlushCmdManager>();
+    NiceMock<MockMapHeader>* header = new NiceMock<MockMapHeader>(0);
+    NiceMock<MockMap>* map = new NiceMock<MockMap>(0, 64);
+    EXPECT_CALL(*fl, IsInternalFlushEnabled).WillOnce(Return(false));
+    VSAMapContent vsacon(0, &info, fl, map, header);
+    vsacon.Init(16, sizeof(VirtualBlkAddr), 64);
+
+    VirtualBlkAddr buf0[8];
+    VirtualBlkAddr buf1[8];
+    EXPECT_CALL(*map, GetMpage(0)).WillOnce(Return((char*)buf0));
+    EXPECT_CALL(*map, GetMpage(1)).WillOnce(Return((char*)buf1));
+    EXPECT_CALL(*map, GetMpageLock).Times(2);
+    EXPECT_CALL(*map, ReleaseMpageLock).Times(2);
+    EXPECT_CALL(*map, BeginMpageUpdate).Times(2);
+    EXPECT_CALL(*map, EndMpageUpdate).Times(2);
+    EXPECT_CALL(*header, UpdateNumUsedBlks).Times(10);
+    EXPECT_CALL(*header, SetTouchedMpageBit).Times(2);
+
+    VirtualBlks vsas = {.startVsa = {.stripeId = 3, .offset = 0}, .numBlks = 10};
+    int ret = vsacon.SetEntries(4, vsas);
+    EXPECT_EQ(0, ret);
+    EXPECT_EQ(3, buf0[4].stripeId);
+    EXPECT_EQ(0, buf0[4].offset);
+    EXPECT_EQ(3, buf0[7].offset);
+    EXPECT_EQ(4, buf1[0].offset);
+    EXPECT_EQ(9, buf1[5].offset);
+
+    delete fl;
+}
+
+TEST(VSAMapContent, SetEntries_testIfUnmapRangeUnmapsEveryEntry)
+{
+    NiceMock<MockMapperAddressInfo> info;
+    NiceMock<MockFlushCmdManager>* fl = new NiceMock<MockFlushCmdManager>();
+    NiceMock<MockMapHeader>* header = new NiceMock<MockMapHeader>(0);
+    NiceMock<MockMap>* map = new NiceMock<MockMap>(0, 64);
+    EXPECT_CALL(*fl, IsInternalFlushEnabled).WillOnce(Return(false));
+    VSAMapContent vsacon(0, &info, fl, map, header);
+    vsacon.Init(16, sizeof(VirtualBlkAddr), 64);
+
+    VirtualBlkAddr buf[8];
+    for (uint32_t idx = 0; idx < 8; ++idx)
+    {
+        buf[idx] = {.stripeId = 1, .offset = idx};
+    }
+    EXPECT_CALL(*map, GetMpage(0)).WillOnce(Return((char*)buf));
+    EXPECT_CALL(*header, ReleaseNumUsedBlks).Times(3);
+    EXPECT_CALL(*header, UpdateNumUsedBlks).Times(0);
+
+    VirtualBlks vsas = {.startVsa = UNMAP_VSA, .numBlks = 3};
+    int ret = vsacon.SetEntries(2, vsas);
+    EXPECT_EQ(0, ret);
+    EXPECT_EQ(1, buf[1].stripeId);
+    EXPECT_EQ(UNMAP_VSA, buf[2]);
+    EXPECT_EQ(UNMAP_VSA, buf[4]);
+    EXPECT_EQ(5, buf[5].offset);
+
+    delete fl;
+}
+
+TEST(VSAMapContent, CollectValidBlks_testIfUnwrittenMpagesAreSkippedAndContiguousVsasAreMerged)
+{
+    NiceMock<MockMapperAddressInfo> info;
+    NiceMock<MockFlushCmdManager>* fl = new NiceMock<MockFlushCmdManager>();
+    NiceMock<MockMapHeader>* header = new NiceMock<MockMapHeader>(0);
+    NiceMock<MockMap>* map = new NiceMock<MockMap>(0, 64);
+    VSAMapContent vsacon(0, &info, fl, map, header);
+    vsacon.Init(32, sizeof(VirtualBlkAddr), 64);
+
+    BitMap mpageMap(4);
+    mpageMap.SetBit(1);
+    mpageMap.SetBit(3);
+    ON_CALL(*header, GetMpageMap).WillByDefault(Return(&mpageMap));
+
+    VirtualBlkAddr buf1[8];
+    VirtualBlkAddr buf3[8];
+    for (uint32_t idx = 0; idx < 8; ++idx)
+    {
+        buf1[idx] = {.stripeId = 5, .offset = idx};
+        buf3[idx] = UNMAP_VSA;
+    }
+    buf1[4] = UNMAP_VSA;
+    buf3[7] = {.stripeId = 9, .offset = 2};
+    EXPECT_CALL(*map, GetMpage(0)).Times(0);
+    EXPECT_CALL(*map, GetMpage(2)).Times(0);
+    EXPECT_CALL(*map, GetMpage(1)).WillOnce(Return((char*)buf1));
+    EXPECT_CALL(*map, GetMpage(3)).WillOnce(Return((char*)buf3));
+
+    // When: one mpage per call
+    std::vector<VirtualBlks> validBlks;
+    uint64_t next = vsacon.CollectValidBlks(0, 1, validBlks);
+    EXPECT_EQ(2, next);
+    next = vsacon.CollectValidBlks(next, 1, validBlks);
+    EXPECT_EQ(4, next);
+    next = vsacon.CollectValidBlks(next, 1, validBlks);
+
+    // Then
+    EXPECT_EQ(4, next);
+    EXPECT_EQ(4, vsacon.GetNumMpages());
+    ASSERT_EQ(3, validBlks.size());
+    EXPECT_EQ((VirtualBlks{.startVsa = {.stripeId = 5, .offset = 0}, .numBlks = 4}), validBlks[0]);
+    EXPECT_EQ((VirtualBlks{.startVsa = {.stripeId = 5, .offset = 5}, .numBlks = 3}), validBlks[1]);
+    EXPECT_EQ((VirtualBlks{.startVsa = {.stripeId = 9, .offset = 2}, .numBlks = 1}), validBlks[2]);
+
+    delete fl;
+}
+
 } // namespace pos
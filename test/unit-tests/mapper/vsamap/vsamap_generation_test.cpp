@@ -0,0 +1,139 @@
+#include "src/mapper/vsamap/vsamap_generation.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+#include "test/unit-tests/meta_file_intf/meta_file_intf_mock.h"
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+static NiceMock<MockMetaFileIntf>*
+CreateNewFile(void)
+{
+    NiceMock<MockMetaFileIntf>* file = new NiceMock<MockMetaFileIntf>("VSAMapGeneration.bin", 0, MetaFileType::General);
+    ON_CALL(*file, DoesFileExist).WillByDefault(Return(false));
+    ON_CALL(*file, Create).WillByDefault(Return(0));
+    ON_CALL(*file, Open).WillByDefault(Return(0));
+    ON_CALL(*file, IssueIO).WillByDefault(Return(0));
+    return file;
+}
+
+TEST(VSAMapGeneration, Init_testIfEmptyTableIsStoredWhenTheFileIsCreated)
+{
+    // Given
+    NiceMock<MockMetaFileIntf>* file = CreateNewFile();
+    VSAMapGeneration generation(0, file);
+
+    // Then
+    EXPECT_CALL(*file, Create).Times(1);
+    EXPECT_CALL(*file, IssueIO(MetaFsIoOpcode::Write, 0, _, _)).Times(1);
+
+    // When
+    int ret = generation.Init();
+
+    // Then
+    EXPECT_EQ(0, ret);
+    EXPECT_EQ(0, generation.GetMapCapacity(3));
+    EXPECT_EQ(0, generation.GetRetiredVolumes().size());
+}
+
+TEST(VSAMapGeneration, Retire_testIfRetiredVolumeIsListedUntilItIsReclaimed)
+{
+    // Given
+    VSAMapGeneration generation(0, CreateNewFile());
+    generation.Init();
+
+    // When
+    int ret = generation.Retire(1, 200);
+    std::vector<std::pair<int, uint64_t>> retired = generation.GetRetiredVolumes();
+    generation.Reclaimed(1);
+
+    // Then
+    EXPECT_EQ(0, ret);
+    ASSERT_EQ(1, retired.size());
+    EXPECT_EQ(1, retired[0].first);
+    EXPECT_EQ(200, retired[0].second);
+    EXPECT_EQ(0, generation.GetRetiredVolumes().size());
+}
+
+TEST(VSAMapGeneration, Retire_testIfTheTableIsRestoredWhenItFailsToBeStored)
+{
+    // Given
+    NiceMock<MockMetaFileIntf>* file = CreateNewFile();
+    VSAMapGeneration generation(0, file);
+    generation.Init();
+    ON_CALL(*file, IssueIO).WillByDefault(Return(-1));
+
+    // When
+    int ret = generation.Retire(1, 200);
+
+    // Then
+    EXPECT_EQ(-1, ret);
+    EXPECT_EQ(0, generation.GetRetiredVolumes().size());
+}
+
+TEST(VSAMapGeneration, SetMapCapacity_testIfCapacityIsKeptUntilTheVolumeIsReclaimed)
+{
+    // Given
+    VSAMapGeneration generation(0, CreateNewFile());
+    generation.Init();
+
+    // When
+    int ret = generation.SetMapCapacity(1, 64);
+    uint32_t capacity = generation.GetMapCapacity(1);
+    generation.Retire(1, 100);
+    uint32_t capacityOfRetired = generation.GetMapCapacity(1);
+    generation.Reclaimed(1);
+
+    // Then
+    EXPECT_EQ(0, ret);
+    EXPECT_EQ(64, capacity);
+    EXPECT_EQ(64, capacityOfRetired);
+    EXPECT_EQ(0, generation.GetMapCapacity(1));
+    EXPECT_EQ(0, generation.GetMapCapacity(2));
+}
+
+TEST(VSAMapGeneration, Init_testIfTheStoredTableIsLoaded)
+{
+    // Given
+    std::vector<char> stored;
+    NiceMock<MockMetaFileIntf>* file = CreateNewFile();
+    ON_CALL(*file, IssueIO(MetaFsIoOpcode::Write, _, _, _)).WillByDefault(Invoke([&](MetaFsIoOpcode opType, uint64_t offset, uint64_t length, char* buffer) {
+        stored.assign(buffer, buffer + length);
+        return 0;
+    }));
+    {
+        VSAMapGeneration generation(0, file);
+        generation.Init();
+        generation.SetMapCapacity(1, 64);
+        generation.Retire(2, 100);
+    }
+
+    NiceMock<MockMetaFileIntf>* existingFile = CreateNewFile();
+    ON_CALL(*existingFile, DoesFileExist).WillByDefault(Return(true));
+    ON_CALL(*existingFile, IssueIO(MetaFsIoOpcode::Read, _, _, _)).WillByDefault(Invoke([&](MetaFsIoOpcode opType, uint64_t offset, uint64_t length, char* buffer) {
+        memcpy(buffer, stored.data(), length);
+        return 0;
+    }));
+    VSAMapGeneration loaded(0, existingFile);
+
+    // When
+    int ret = loaded.Init();
+
+    // Then
+    EXPECT_EQ(0, ret);
+    EXPECT_EQ(64, loaded.GetMapCapacity(1));
+    std::vector<std::pair<int, uint64_t>> retired = loaded.GetRetiredVolumes();
+    ASSERT_EQ(1, retired.size());
+    EXPECT_EQ(2, retired[0].first);
+    EXPECT_EQ(100, retired[0].second);
+}
+} // namespace pos
@@ -15,6 +15,8 @@ public:
     MOCK_METHOD(int, Init, (), (override));
     MOCK_METHOD(void, Dispose, (), (override));
     MOCK_METHOD(int, CreateVsaMapContent, (VSAMapContent * vsaMap, int volId, uint64_t volSizeByte, bool delVol), (override));
+    MOCK_METHOD(int, ReserveMapCapacity, (int volId, uint64_t volSizeByte), (override));
+    MOCK_METHOD(int, GrowVSAMap, (int volId, uint64_t curSizeByte, uint64_t newSizeByte), (override));
     MOCK_METHOD(int, LoadVSAMapFile, (int volId), (override));
     MOCK_METHOD(int, FlushDirtyPagesGiven, (int volId, MpageList list, EventSmartPtr cb), (override));
     MOCK_METHOD(int, FlushTouchedPages, (int volId, EventSmartPtr cb), (override));
@@ -26,11 +28,14 @@ public:
     MOCK_METHOD(bool, IsVolumeLoaded, (int volId), (override));
     MOCK_METHOD(void, MapFlushDone, (int mapId), (override));
     MOCK_METHOD(int, GetVSAs, (int volumeId, BlkAddr startRba, uint32_t numBlks, VsaArray& vsaArray), (override));
+    MOCK_METHOD(int, GetVsaExtents, (int volumeId, BlkAddr startRba, uint32_t numBlks, VsaExtentArray& extents, uint32_t& numExtents), (override));
     MOCK_METHOD(int, SetVSAs, (int volumeId, BlkAddr startRba, VirtualBlks& virtualBlks), (override));
+    MOCK_METHOD(int, UnmapVSAs, (int volumeId, BlkAddr startRba, uint64_t numBlks, std::vector<VirtualBlks>& oldBlks), (override));
     MOCK_METHOD(VirtualBlkAddr, GetRandomVSA, (BlkAddr rba), (override));
     MOCK_METHOD(int64_t, GetNumUsedBlks, (int volId), (override));
     MOCK_METHOD(VirtualBlkAddr, GetVSAWoCond, (int volumeId, BlkAddr rba), (override));
     MOCK_METHOD(int, SetVSAsWoCond, (int volumeId, BlkAddr startfRba, VirtualBlks& virtualBlks), (override));
+    MOCK_METHOD(int, UnmapVSAsWoCond, (int volumeId, BlkAddr startRba, uint64_t numBlks, std::vector<VirtualBlks>& oldBlks), (override));
     MOCK_METHOD(MpageList, GetDirtyVsaMapPages, (int volId, BlkAddr startRba, uint64_t numBlks), (override));
     MOCK_METHOD(VSAMapContent*, GetVSAMapContent, (int volId), (override));
     MOCK_METHOD(void, SetVSAMapContent, (int volId, VSAMapContent* content), (override));
@@ -45,6 +50,7 @@ public:
     MOCK_METHOD(void, DisableVsaMapInternalAccess, (int volId), (override));
     MOCK_METHOD(int, Dump, (int volId, std::string fileName), (override));
     MOCK_METHOD(int, DumpLoad, (int volId, std::string fileName), (override));
+    MOCK_METHOD(MpageCache*, GetMpageCache, (), (override));
 };
 
 } // namespace pos
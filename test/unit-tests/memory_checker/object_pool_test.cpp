@@ -0,0 +1,100 @@
+#include "src/memory_checker/object_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace pos
+{
+TEST(ObjectPool, New_testIfObjectIsAllocatedWhenPoolIsDisabled)
+{
+    // Given
+    ObjectPool::Enable(false);
+
+    // When
+    void* ptr = ObjectPool::New(100);
+
+    // Then
+    EXPECT_NE(nullptr, ptr);
+    ObjectPool::Delete(ptr);
+}
+
+TEST(ObjectPool, New_testIfFreedObjectIsReusedOnSameThread)
+{
+    // Given
+    ObjectPool::Enable(true);
+    void* first = ObjectPool::New(100);
+    ObjectPool::Delete(first);
+
+    // When
+    void* second = ObjectPool::New(100);
+
+    // Then
+    EXPECT_EQ(first, second);
+    ObjectPool::Delete(second);
+    ObjectPool::Enable(false);
+}
+
+TEST(ObjectPool, Delete_testIfObjectFreedOnAnotherThreadReturnsToOwner)
+{
+    // Given
+    ObjectPool::Enable(true);
+    void* drain = ObjectPool::New(150);
+    void* first = ObjectPool::New(150);
+    ObjectPool::Delete(drain);
+    void* reused = ObjectPool::New(150);
+    ASSERT_EQ(drain, reused);
+
+    // When
+    std::thread remote([first]() { ObjectPool::Delete(first); });
+    remote.join();
+    void* second = ObjectPool::New(150);
+
+    // Then
+    EXPECT_EQ(first, second);
+    ObjectPool::Delete(second);
+    ObjectPool::Delete(reused);
+    ObjectPool::Enable(false);
+}
+
+TEST(ObjectPool, New_testIfObjectLargerThanSizeClassIsNotPooled)
+{
+    // Given
+    ObjectPool::Enable(true);
+    void* first = ObjectPool::New(ObjectPool::SIZE_CLASS_BYTES * ObjectPool::SIZE_CLASS_COUNT);
+    ObjectPool::Delete(first);
+
+    // When
+    void* second = ObjectPool::New(100);
+
+    // Then
+    EXPECT_NE(nullptr, second);
+    ObjectPool::Delete(second);
+    ObjectPool::Enable(false);
+}
+
+TEST(ObjectPool, GetTag_testIfTagIsClearedOnReuse)
+{
+    // Given
+    ObjectPool::Enable(true);
+    void* first = ObjectPool::New(100);
+    ObjectPool::SetTag(first, 1);
+    EXPECT_EQ(1U, ObjectPool::GetTag(first));
+    ObjectPool::Delete(first);
+
+    // When
+    void* second = ObjectPool::New(100);
+
+    // Then
+    EXPECT_EQ(0U, ObjectPool::GetTag(second));
+    ObjectPool::Delete(second);
+    ObjectPool::Enable(false);
+}
+
+TEST(ObjectPool, Delete_testIfNullptrIsIgnored)
+{
+    // When, Then
+    ObjectPool::Delete(nullptr);
+}
+
+} // namespace pos
@@ -24,6 +24,7 @@ public:
     MOCK_METHOD(std::string, GetFileName, (), (override));
     MOCK_METHOD(MetaFileType, GetFileType, (), (override));
     MOCK_METHOD(MetaVolumeType, GetVolumeType, (), (override));
+    MOCK_METHOD(char*, GetDirectAccessAddress, (uint64_t fileOffset), (override));
     MOCK_METHOD(int, IssueIO, (MetaFsIoOpcode opType, uint64_t fileOffset, uint64_t length, char* buffer), (override));
     MOCK_METHOD(int, AppendIO, (MetaFsIoOpcode opType, uint64_t& offset, uint64_t length, char* buffer), (override));
     MOCK_METHOD(int, _Read, (int fd, uint64_t fileOffset, uint64_t length, char* buffer), (override));
@@ -9,6 +9,7 @@
 #include "test/unit-tests/io/general_io/vsa_range_maker_mock.h"
 #include "test/unit-tests/mapper/i_vsamap_mock.h"
 
+using ::testing::_;
 using ::testing::NiceMock;
 using ::testing::Return;
 using ::testing::ReturnRef;
@@ -192,4 +193,77 @@ TEST(BlockMapUpdate, DoSpecificJob_testIfMetaIsUpdatedSuccessfullyWhenOldVsasAre
     bool actual = blockMapUpdate.Execute();
     EXPECT_EQ(actual, true);
 }
+
+TEST(BlockMapUpdate, DoSpecificJob_testIfOldVsasInTheSameSegmentAreInvalidatedAtOnce)
+{
+    NiceMock<MockVolumeIo>* mockVolumeIo(new NiceMock<MockVolumeIo>(nullptr, 0, 0));
+    VolumeIoSmartPtr mockVolumeIoPtr(mockVolumeIo);
+    NiceMock<MockIVSAMap> vsaMap;
+    NiceMock<MockISegmentCtx> segmentCtx;
+    NiceMock<MockIWBStripeAllocator> wbStripeAllocator;
+    NiceMock<MockStripe>* stripe = new NiceMock<MockStripe>();
+    NiceMock<MockVsaRangeMaker>* vsaRangeMaker = new NiceMock<MockVsaRangeMaker>(0, 0, 0, &vsaMap);
+
+    uint32_t stripesPerSegment = 64;
+    int volumeId = 10;
+    BlkAddr rba = 1203;
+    VirtualBlks newVsas = {
+        .startVsa = {
+            .stripeId = 102,
+            .offset = 1},
+        .numBlks = 12};
+
+    // Given: first and third ranges are in segment 0, the second one is in segment 2
+    int numOldVsaRange = 3;
+    VirtualBlks oldVsas[numOldVsaRange];
+    oldVsas[0] = {
+        .startVsa = {
+            .stripeId = 1,
+            .offset = 0},
+        .numBlks = 1};
+    oldVsas[1] = {
+        .startVsa = {
+            .stripeId = 130,
+            .offset = 100},
+        .numBlks = 10};
+    oldVsas[2] = {
+        .startVsa = {
+            .stripeId = 40,
+            .offset = 3},
+        .numBlks = 1};
+
+    StripeAddr lsid = {
+        .stripeLoc = IN_WRITE_BUFFER_AREA,
+        .stripeId = 102};
+
+    ON_CALL(*mockVolumeIo, GetVolumeId).WillByDefault(Return(volumeId));
+    ON_CALL(*mockVolumeIo, GetSectorRba).WillByDefault(Return(ChangeBlockToSector(rba)));
+    ON_CALL(*mockVolumeIo, GetSize).WillByDefault(Return(ChangeBlockToByte(newVsas.numBlks)));
+    ON_CALL(*mockVolumeIo, GetVsa).WillByDefault(ReturnRef(newVsas.startVsa));
+    ON_CALL(*mockVolumeIo, GetLsidEntry).WillByDefault(ReturnRef(lsid));
+
+    ON_CALL(*vsaRangeMaker, GetCount).WillByDefault(Return(numOldVsaRange));
+    EXPECT_CALL(*vsaRangeMaker, GetVsaRange).Times(numOldVsaRange).WillOnce(ReturnRef(oldVsas[0])).WillOnce(ReturnRef(oldVsas[1])).WillOnce(ReturnRef(oldVsas[2]));
+
+    ON_CALL(wbStripeAllocator, GetStripe(lsid.stripeId)).WillByDefault(Return(StripeSmartPtr(stripe)));
+
+    // Then: each segment is invalidated once with the summed block count
+    VirtualBlks expectedSeg0 = {
+        .startVsa = {
+            .stripeId = 0,
+            .offset = 0},
+        .numBlks = 2};
+    VirtualBlks expectedSeg2 = {
+        .startVsa = {
+            .stripeId = 2 * stripesPerSegment,
+            .offset = 0},
+        .numBlks = 10};
+    EXPECT_CALL(segmentCtx, InvalidateBlocksWithGroupId(expectedSeg0, false, _)).Times(1);
+    EXPECT_CALL(segmentCtx, InvalidateBlocksWithGroupId(expectedSeg2, false, _)).Times(1);
+
+    BlockMapUpdate blockMapUpdate(mockVolumeIoPtr, &vsaMap, &segmentCtx,
+        &wbStripeAllocator, vsaRangeMaker, stripesPerSegment);
+    bool actual = blockMapUpdate.Execute();
+    EXPECT_EQ(actual, true);
+}
 } // namespace pos
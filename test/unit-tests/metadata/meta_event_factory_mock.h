@@ -14,6 +14,7 @@ public:
     MOCK_METHOD(CallbackSmartPtr, CreateBlockMapUpdateEvent, (VolumeIoSmartPtr volumeIo), (override));
     MOCK_METHOD(CallbackSmartPtr, CreateStripeMapUpdateEvent, (StripeSmartPtr stripe), (override));
     MOCK_METHOD(CallbackSmartPtr, CreateGcMapUpdateEvent, (StripeSmartPtr stripe, GcStripeMapUpdateList mapUpdateInfoList, (std::map<SegmentId, uint32_t> invalidSegCnt)), (override));
+    MOCK_METHOD(CallbackSmartPtr, CreateRangeUnmapEvent, (int volId, BlkAddr startRba, uint64_t numBlks), (override));
 };
 
 } // namespace pos
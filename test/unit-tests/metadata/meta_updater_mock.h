@@ -13,6 +13,7 @@ public:
     MOCK_METHOD(int, UpdateBlockMap, (VolumeIoSmartPtr volumeIo, CallbackSmartPtr callback), (override));
     MOCK_METHOD(int, UpdateStripeMap, (Stripe * stripe, CallbackSmartPtr callback), (override));
     MOCK_METHOD(int, UpdateGcMap, (Stripe * stripe, GcStripeMapUpdateList mapUpdateInfoList, (std::map<SegmentId, uint32_t> invalidSegCnt), CallbackSmartPtr callback), (override));
+    MOCK_METHOD(int, UnmapBlockRange, (int volId, BlkAddr startRba, uint64_t numBlks, CallbackSmartPtr callback), (override));
 };
 
 } // namespace pos
@@ -8,6 +8,7 @@
 #include "test/unit-tests/array_models/interface/i_array_info_mock.h"
 #include "test/unit-tests/journal_manager/log_write/i_journal_volume_event_handler_mock.h"
 #include "test/unit-tests/mapper/i_mapper_volume_event_handler_mock.h"
+#include "test/unit-tests/metadata/volume_map_reclaimer_mock.h"
 
 using ::testing::_;
 using ::testing::InSequence;
@@ -448,6 +449,62 @@ TEST(MetaVolumeEventHandler, VolumeDeleted_testIfVolumeDeleteFailsWhenDeleteVolu
     EXPECT_EQ(result, expected);
 }
 
+TEST(MetaVolumeEventHandler, VolumeDeleted_testIfBlocksAreLeftToTheReclaimerWhenItIsGiven)
+{
+    NiceMock<MockIArrayInfo> info;
+    NiceMock<MockIMapperVolumeEventHandler> mapper;
+    NiceMock<MockAllocator> allocator;
+    NiceMock<MockIJournalVolumeEventHandler> journal;
+    NiceMock<MockVolumeMapReclaimer> reclaimer(0, &mapper, nullptr, &journal, nullptr);
+    MetaVolumeEventHandler handler(&info, &mapper, &allocator, &journal, &reclaimer);
+
+    VolumeEventBase volumeEvent = {
+        .volId = 2,
+        .volSizeByte = 100,
+        .volName = "testVolume",
+        .uuid = "",
+        .subnqn = ""};
+
+    {
+        InSequence s;
+        EXPECT_CALL(mapper, PrepareVolumeDelete(volumeEvent.volId)).WillOnce(Return(0));
+        EXPECT_CALL(reclaimer, Delete(volumeEvent.volId)).WillOnce(Return(0));
+    }
+    EXPECT_CALL(mapper, InvalidateAllBlocksTo).Times(0);
+    EXPECT_CALL(mapper, DeleteVolumeMap).Times(0);
+
+    int result = handler.VolumeDeleted(&volumeEvent, nullptr);
+    int expected = EID(VOL_EVENT_OK);
+    EXPECT_EQ(result, expected);
+}
+
+TEST(MetaVolumeEventHandler, VolumeCreated_testIfReusedVolumeIdWaitsForTheReclaim)
+{
+    NiceMock<MockIArrayInfo> info;
+    NiceMock<MockIMapperVolumeEventHandler> mapper;
+    NiceMock<MockAllocator> allocator;
+    NiceMock<MockIJournalVolumeEventHandler> journal;
+    NiceMock<MockVolumeMapReclaimer> reclaimer(0, &mapper, nullptr, &journal, nullptr);
+    MetaVolumeEventHandler handler(&info, &mapper, &allocator, &journal, &reclaimer);
+
+    VolumeEventBase volumeEvent = {
+        .volId = 2,
+        .volSizeByte = 100,
+        .volName = "testVolume",
+        .uuid = "",
+        .subnqn = ""};
+
+    {
+        InSequence s;
+        EXPECT_CALL(reclaimer, WaitForVolume(volumeEvent.volId)).Times(1);
+        EXPECT_CALL(mapper, VolumeCreated(volumeEvent.volId, volumeEvent.volSizeByte)).WillOnce(Return(EID(VOL_EVENT_OK)));
+    }
+
+    int result = handler.VolumeCreated(&volumeEvent, nullptr, nullptr);
+    int expected = EID(VOL_EVENT_OK);
+    EXPECT_EQ(result, expected);
+}
+
 TEST(MetaVolumeEventHandler, VolumeDetached_testIfMapDetachedSuccessfully)
 {
     NiceMock<MockIArrayInfo> info;
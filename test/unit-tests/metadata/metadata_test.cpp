@@ -97,6 +97,7 @@ TEST(Metadata, Init_testIfEverySequenceIsInitialized)
     ON_CALL(arrayInfo, GetName).WillByDefault(Return("POSArray"));
     ON_CALL(arrayInfo, GetIndex).WillByDefault(Return(0));
     ON_CALL(*allocator, GetIContextManager).WillByDefault(Return(&contextManager));
+    ON_CALL(*mapper, GetVolumeEventHandler).WillByDefault(Return(mapper));
 
     Metadata meta(&arrayInfo, mapper, allocator, journal, &metaFsCtrl, &metaService);
 
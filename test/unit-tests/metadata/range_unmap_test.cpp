@@ -0,0 +1,101 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/metadata/range_unmap.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "test/unit-tests/allocator/i_segment_ctx_mock.h"
+#include "test/unit-tests/mapper/i_vsamap_mock.h"
+
+using ::testing::_;
+using ::testing::DoAll;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::SetArgReferee;
+
+namespace pos
+{
+TEST(RangeUnmap, _DoSpecificJob_testIfOldBlocksAreInvalidatedOncePerSegment)
+{
+    int volId = 1;
+    BlkAddr startRba = 0;
+    uint64_t numBlks = 1024;
+    uint32_t stripesPerSegment = 64;
+
+    NiceMock<MockIVSAMap> vsaMap;
+    NiceMock<MockISegmentCtx> segmentCtx;
+
+    std::vector<VirtualBlks> oldBlks = {
+        {.startVsa = {.stripeId = 0, .offset = 0}, .numBlks = 100},
+        {.startVsa = {.stripeId = 10, .offset = 4}, .numBlks = 20},
+        {.startVsa = {.stripeId = 130, .offset = 0}, .numBlks = 8}};
+    EXPECT_CALL(vsaMap, UnmapVSAs(volId, startRba, numBlks, _))
+        .WillOnce(DoAll(SetArgReferee<3>(oldBlks), Return(0)));
+
+    VirtualBlks firstSegment = {.startVsa = {.stripeId = 0, .offset = 0}, .numBlks = 120};
+    VirtualBlks thirdSegment = {.startVsa = {.stripeId = 128, .offset = 0}, .numBlks = 8};
+    EXPECT_CALL(segmentCtx, InvalidateBlocksWithGroupId(firstSegment, false, _)).Times(1);
+    EXPECT_CALL(segmentCtx, InvalidateBlocksWithGroupId(thirdSegment, false, _)).Times(1);
+
+    RangeUnmap rangeUnmap(volId, startRba, numBlks, &vsaMap, &segmentCtx, stripesPerSegment);
+    EXPECT_TRUE(rangeUnmap.Execute());
+}
+
+TEST(RangeUnmap, _DoSpecificJob_testIfNothingIsInvalidatedWhenRangeWasNotMapped)
+{
+    NiceMock<MockIVSAMap> vsaMap;
+    NiceMock<MockISegmentCtx> segmentCtx;
+
+    EXPECT_CALL(vsaMap, UnmapVSAs).WillOnce(Return(0));
+    EXPECT_CALL(segmentCtx, InvalidateBlocksWithGroupId).Times(0);
+
+    RangeUnmap rangeUnmap(1, 0, 1024, &vsaMap, &segmentCtx, 64);
+    EXPECT_TRUE(rangeUnmap.Execute());
+}
+
+TEST(RangeUnmap, _DoSpecificJob_testIfCompletedEvenWhenMapIsNotUnmapped)
+{
+    NiceMock<MockIVSAMap> vsaMap;
+    NiceMock<MockISegmentCtx> segmentCtx;
+
+    EXPECT_CALL(vsaMap, UnmapVSAs).WillOnce(Return(-1));
+    EXPECT_CALL(segmentCtx, InvalidateBlocksWithGroupId).Times(0);
+
+    RangeUnmap rangeUnmap(1, 0, 1024, &vsaMap, &segmentCtx, 64);
+    EXPECT_TRUE(rangeUnmap.Execute());
+}
+
+} // namespace pos
@@ -0,0 +1,18 @@
+#include <gmock/gmock.h>
+#include <string>
+#include <list>
+#include <vector>
+#include "src/metadata/stripe_scrubber.h"
+
+namespace pos
+{
+class MockStripeScrubber : public StripeScrubber
+{
+public:
+    using StripeScrubber::StripeScrubber;
+    MOCK_METHOD(void, Start, (), (override));
+    MOCK_METHOD(void, Stop, (), (override));
+    MOCK_METHOD(ScrubResult, ScrubStripe, (StripeId stripeId), (override));
+};
+
+} // namespace pos
@@ -0,0 +1,197 @@
+#include "src/metadata/stripe_scrubber.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "src/array_models/dto/partition_logical_size.h"
+#include "src/include/array_config.h"
+#include "test/unit-tests/allocator/context_manager/segment_ctx/segment_ctx_mock.h"
+#include "test/unit-tests/array/service/io_recover/i_io_recover_mock.h"
+#include "test/unit-tests/device/i_io_dispatcher_mock.h"
+#include "test/unit-tests/include/i_array_device_mock.h"
+
+using ::testing::_;
+using ::testing::DoAll;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::SetArgReferee;
+
+namespace pos
+{
+static const uint32_t CHUNK_BYTES = ArrayConfig::BLOCK_SIZE_BYTE;
+
+// Three devices in a stripe of two data chunks and one parity, backed by memory
+class StripeScrubberFixture : public ::testing::Test
+{
+protected:
+    void
+    SetUp(void) override
+    {
+        sizeInfo.blksPerChunk = 1;
+        sizeInfo.chunksPerStripe = 3;
+        sizeInfo.stripesPerSegment = 4;
+        sizeInfo.totalStripes = 16;
+        sizeInfo.totalSegments = 4;
+        for (int i = 0; i < 3; i++)
+        {
+            ON_CALL(devs[i], GetState).WillByDefault(Return(ArrayDeviceState::NORMAL));
+            ON_CALL(devs[i], GetName).WillByDefault(Return("unvme-ns-" + std::to_string(i)));
+            disk[&devs[i]] = std::vector<uint8_t>(CHUNK_BYTES, 0x11 * (i + 1));
+        }
+        // parity = data0 ^ data1
+        disk[&devs[2]] = std::vector<uint8_t>(CHUNK_BYTES, 0x11 ^ 0x22);
+
+        ON_CALL(segmentCtx, GetSegmentState).WillByDefault(Return(SegmentState::SSD));
+        ON_CALL(ioDispatcher, Submit).WillByDefault(Invoke(this, &StripeScrubberFixture::_Submit));
+        ON_CALL(recover, GetParityRecoverMethod).WillByDefault(
+            DoAll(SetArgReferee<3>(_ParityMethod()), Return(0)));
+    }
+
+    int
+    _Submit(UbioSmartPtr ubio, bool sync, bool ioRecoveryNeeded)
+    {
+        IArrayDevice* dev = ubio->GetArrayDev();
+        if (ubio->dir == UbioDir::Write)
+        {
+            uint8_t* buffer = static_cast<uint8_t*>(ubio->GetBuffer());
+            disk[dev].assign(buffer, buffer + CHUNK_BYTES);
+            writes.insert(dev);
+        }
+        else if (unreadable.count(dev) > 0)
+        {
+            ubio->SetError(IOErrorType::DEVICE_ERROR);
+        }
+        else
+        {
+            memcpy(ubio->GetBuffer(), disk[dev].data(), CHUNK_BYTES);
+        }
+        return 0;
+    }
+
+    static void
+    _Xor(void* dst, void* src, uint32_t size)
+    {
+        uint8_t* out = static_cast<uint8_t*>(dst);
+        uint8_t* in = static_cast<uint8_t*>(src);
+        for (uint32_t i = 0; i < size; i++)
+        {
+            out[i] = in[i] ^ in[size + i];
+        }
+    }
+
+    RecoverMethod
+    _ParityMethod(void)
+    {
+        RecoverMethod method;
+        method.srcAddr = {{.lba = 0, .arrayDev = &devs[0]}, {.lba = 0, .arrayDev = &devs[1]}};
+        method.dstAddr = {{.lba = 0, .arrayDev = &devs[2]}};
+        method.recoverFunc = _Xor;
+        return method;
+    }
+
+    NiceMock<MockIArrayDevice> devs[3];
+    NiceMock<MockSegmentCtx> segmentCtx;
+    NiceMock<MockIIORecover> recover;
+    NiceMock<MockIIODispatcher> ioDispatcher;
+    PartitionLogicalSize sizeInfo;
+    std::map<IArrayDevice*, std::vector<uint8_t>> disk;
+    std::set<IArrayDevice*> unreadable;
+    std::set<IArrayDevice*> writes;
+};
+
+TEST_F(StripeScrubberFixture, ScrubStripe_testIfConsistentStripeIsLeftAsItIs)
+{
+    // Given
+    StripeScrubber scrubber(0, "", &segmentCtx, &sizeInfo, &recover, &ioDispatcher, 0);
+
+    // When
+    ScrubResult result = scrubber.ScrubStripe(5);
+
+    // Then
+    EXPECT_EQ(ScrubResult::CLEAN, result);
+    EXPECT_TRUE(writes.empty());
+}
+
+TEST_F(StripeScrubberFixture, ScrubStripe_testIfMismatchedParityIsRewritten)
+{
+    // Given
+    StripeScrubber scrubber(0, "", &segmentCtx, &sizeInfo, &recover, &ioDispatcher, 0);
+    disk[&devs[2]][100] = 0xFF;
+
+    // When
+    ScrubResult result = scrubber.ScrubStripe(5);
+
+    // Then
+    EXPECT_EQ(ScrubResult::PARITY_REPAIRED, result);
+    EXPECT_EQ(std::set<IArrayDevice*>{&devs[2]}, writes);
+    EXPECT_EQ(std::vector<uint8_t>(CHUNK_BYTES, 0x11 ^ 0x22), disk[&devs[2]]);
+}
+
+TEST_F(StripeScrubberFixture, ScrubStripe_testIfUnreadableChunkIsRebuiltFromTheOthers)
+{
+    // Given
+    StripeScrubber scrubber(0, "", &segmentCtx, &sizeInfo, &recover, &ioDispatcher, 0);
+    unreadable.insert(&devs[1]);
+    RecoverMethod chunkMethod;
+    chunkMethod.srcAddr = {{.lba = 0, .arrayDev = &devs[0]}, {.lba = 0, .arrayDev = &devs[2]}};
+    chunkMethod.recoverFunc = _Xor;
+    EXPECT_CALL(recover, GetRecoverMethod).WillOnce(DoAll(SetArgReferee<2>(chunkMethod), Return(0)));
+
+    // When
+    ScrubResult result = scrubber.ScrubStripe(5);
+
+    // Then
+    EXPECT_EQ(ScrubResult::CHUNK_REPAIRED, result);
+    EXPECT_EQ(std::set<IArrayDevice*>{&devs[1]}, writes);
+    EXPECT_EQ(std::vector<uint8_t>(CHUNK_BYTES, 0x22), disk[&devs[1]]);
+}
+
+TEST_F(StripeScrubberFixture, ScrubStripe_testIfTwoUnreadableChunksAreReportedUnrecoverable)
+{
+    // Given
+    StripeScrubber scrubber(0, "", &segmentCtx, &sizeInfo, &recover, &ioDispatcher, 0);
+    unreadable.insert(&devs[0]);
+    unreadable.insert(&devs[1]);
+
+    // When
+    ScrubResult result = scrubber.ScrubStripe(5);
+
+    // Then
+    EXPECT_EQ(ScrubResult::UNRECOVERABLE, result);
+    EXPECT_TRUE(writes.empty());
+}
+
+TEST_F(StripeScrubberFixture, ScrubStripe_testIfStripeOfDegradedArrayIsSkipped)
+{
+    // Given
+    StripeScrubber scrubber(0, "", &segmentCtx, &sizeInfo, &recover, &ioDispatcher, 0);
+    ON_CALL(devs[1], GetState).WillByDefault(Return(ArrayDeviceState::REBUILD));
+    EXPECT_CALL(ioDispatcher, Submit).Times(0);
+
+    // When
+    ScrubResult result = scrubber.ScrubStripe(5);
+
+    // Then
+    EXPECT_EQ(ScrubResult::SKIPPED, result);
+}
+
+TEST_F(StripeScrubberFixture, ScrubStripe_testIfRepairIsDroppedWhenSegmentIsReclaimedMeanwhile)
+{
+    // Given
+    StripeScrubber scrubber(0, "", &segmentCtx, &sizeInfo, &recover, &ioDispatcher, 0);
+    disk[&devs[2]][0] = 0xFF;
+    EXPECT_CALL(segmentCtx, GetSegmentState(1)).WillOnce(Return(SegmentState::FREE));
+
+    // When
+    ScrubResult result = scrubber.ScrubStripe(5);
+
+    // Then
+    EXPECT_EQ(ScrubResult::SKIPPED, result);
+    EXPECT_TRUE(writes.empty());
+}
+} // namespace pos
@@ -0,0 +1,20 @@
+#include <gmock/gmock.h>
+#include <string>
+#include <list>
+#include <vector>
+#include "src/metadata/volume_map_reclaimer.h"
+
+namespace pos
+{
+class MockVolumeMapReclaimer : public VolumeMapReclaimer
+{
+public:
+    using VolumeMapReclaimer::VolumeMapReclaimer;
+    MOCK_METHOD(void, Start, (), (override));
+    MOCK_METHOD(void, Stop, (), (override));
+    MOCK_METHOD(int, Delete, (int volId), (override));
+    MOCK_METHOD(void, WaitForVolume, (int volId), (override));
+    MOCK_METHOD(bool, IsReclaiming, (int volId), (override));
+};
+
+} // namespace pos
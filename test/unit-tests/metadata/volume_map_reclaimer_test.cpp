@@ -0,0 +1,135 @@
+#include "src/metadata/volume_map_reclaimer.h"
+
+#include <gtest/gtest.h>
+
+#include "src/array_models/dto/partition_logical_size.h"
+#include "test/unit-tests/allocator/i_segment_ctx_mock.h"
+#include "test/unit-tests/journal_manager/log_write/i_journal_volume_event_handler_mock.h"
+#include "test/unit-tests/mapper/i_mapper_volume_event_handler_mock.h"
+
+using ::testing::_;
+using ::testing::InSequence;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+static bool
+CollectTwoBatches(int volId, uint64_t& mpageId, uint32_t numMpages, std::vector<VirtualBlks>& validBlks)
+{
+    if (mpageId == 0)
+    {
+        validBlks.push_back({.startVsa = {.stripeId = 1, .offset = 0}, .numBlks = 3});
+        validBlks.push_back({.startVsa = {.stripeId = 6, .offset = 4}, .numBlks = 2});
+        mpageId = numMpages;
+        return true;
+    }
+    validBlks.push_back({.startVsa = {.stripeId = 2, .offset = 7}, .numBlks = 1});
+    mpageId += numMpages;
+    return false;
+}
+
+TEST(VolumeMapReclaimer, Delete_testIfTheMapIsDetachedAfterTheDeletionIsJournaled)
+{
+    // Given
+    NiceMock<MockIMapperVolumeEventHandler> mapper;
+    NiceMock<MockISegmentCtx> segmentCtx;
+    NiceMock<MockIJournalVolumeEventHandler> journal;
+    PartitionLogicalSize sizeInfo;
+    VolumeMapReclaimer reclaimer(0, &mapper, &segmentCtx, &journal, &sizeInfo);
+
+    {
+        InSequence s;
+        EXPECT_CALL(journal, WriteVolumeDeletedLog(2)).WillOnce(Return(0));
+        EXPECT_CALL(journal, TriggerMetadataFlush).WillOnce(Return(0));
+        EXPECT_CALL(mapper, DetachVolumeMap(2)).WillOnce(Return(0));
+    }
+    EXPECT_CALL(segmentCtx, InvalidateBlks).Times(0);
+
+    // When
+    int ret = reclaimer.Delete(2);
+
+    // Then: nothing is invalidated until the reclaimer is started
+    EXPECT_EQ(0, ret);
+    EXPECT_TRUE(reclaimer.IsReclaiming(2));
+}
+
+TEST(VolumeMapReclaimer, Delete_testIfTheMapIsKeptWhenJournalingFails)
+{
+    // Given
+    NiceMock<MockIMapperVolumeEventHandler> mapper;
+    NiceMock<MockISegmentCtx> segmentCtx;
+    NiceMock<MockIJournalVolumeEventHandler> journal;
+    PartitionLogicalSize sizeInfo;
+    VolumeMapReclaimer reclaimer(0, &mapper, &segmentCtx, &journal, &sizeInfo);
+
+    EXPECT_CALL(journal, WriteVolumeDeletedLog(2)).WillOnce(Return(-1));
+    EXPECT_CALL(mapper, DetachVolumeMap).Times(0);
+
+    // When
+    int ret = reclaimer.Delete(2);
+
+    // Then
+    EXPECT_EQ(-1, ret);
+    EXPECT_FALSE(reclaimer.IsReclaiming(2));
+}
+
+TEST(VolumeMapReclaimer, Start_testIfBlocksOfDetachedMapAreInvalidatedPerSegmentAfterTheMapIsDeleted)
+{
+    // Given
+    NiceMock<MockIMapperVolumeEventHandler> mapper;
+    NiceMock<MockISegmentCtx> segmentCtx;
+    NiceMock<MockIJournalVolumeEventHandler> journal;
+    PartitionLogicalSize sizeInfo;
+    sizeInfo.stripesPerSegment = 4;
+    sizeInfo.totalSegments = 4;
+    VolumeMapReclaimer reclaimer(0, &mapper, &segmentCtx, &journal, &sizeInfo, 8, 0);
+
+    ON_CALL(mapper, GetDetachedVolumes).WillByDefault(Return(std::vector<int>{3}));
+    EXPECT_CALL(mapper, CollectDetachedBlocks(3, _, 8, _)).Times(2).WillRepeatedly(Invoke(CollectTwoBatches));
+    {
+        InSequence s;
+        EXPECT_CALL(journal, WriteVolumeDeletedLog(3)).WillOnce(Return(0));
+        EXPECT_CALL(mapper, DeleteDetachedMap(3)).WillOnce(Return(0));
+        EXPECT_CALL(segmentCtx, InvalidateBlks(VirtualBlks{.startVsa = {.stripeId = 0, .offset = 0}, .numBlks = 4}, true)).WillOnce(Return(false));
+        EXPECT_CALL(segmentCtx, InvalidateBlks(VirtualBlks{.startVsa = {.stripeId = 4, .offset = 0}, .numBlks = 2}, true)).WillOnce(Return(false));
+        EXPECT_CALL(journal, TriggerMetadataFlush).WillOnce(Return(0));
+    }
+
+    // When
+    reclaimer.Start();
+    reclaimer.WaitForVolume(3);
+    reclaimer.Stop();
+
+    // Then
+    EXPECT_FALSE(reclaimer.IsReclaiming(3));
+}
+
+TEST(VolumeMapReclaimer, Start_testIfSegmentContextIsUntouchedWhenTheMapCannotBeDeleted)
+{
+    // Given
+    NiceMock<MockIMapperVolumeEventHandler> mapper;
+    NiceMock<MockISegmentCtx> segmentCtx;
+    NiceMock<MockIJournalVolumeEventHandler> journal;
+    PartitionLogicalSize sizeInfo;
+    sizeInfo.stripesPerSegment = 4;
+    sizeInfo.totalSegments = 4;
+    VolumeMapReclaimer reclaimer(0, &mapper, &segmentCtx, &journal, &sizeInfo, 8, 0);
+
+    ON_CALL(mapper, GetDetachedVolumes).WillByDefault(Return(std::vector<int>{3}));
+    ON_CALL(mapper, CollectDetachedBlocks).WillByDefault(Invoke(CollectTwoBatches));
+    EXPECT_CALL(mapper, DeleteDetachedMap(3)).WillOnce(Return(-1));
+    EXPECT_CALL(segmentCtx, InvalidateBlks).Times(0);
+    // The checkpoint blocked by the log is resumed anyway
+    EXPECT_CALL(journal, TriggerMetadataFlush).WillOnce(Return(0));
+
+    // When
+    reclaimer.Start();
+    reclaimer.WaitForVolume(3);
+    reclaimer.Stop();
+
+    // Then
+    EXPECT_FALSE(reclaimer.IsReclaiming(3));
+}
+} // namespace pos
@@ -0,0 +1,113 @@
+#include "src/metafs/common/two_queue_cache.h"
+
+#include <gtest/gtest.h>
+
+namespace pos
+{
+class TwoQueueCacheFixture : public ::testing::Test
+{
+public:
+    TwoQueueCacheFixture(void)
+    : cache(CAPACITY)
+    {
+    }
+
+protected:
+    static const size_t CAPACITY = 8;
+    TwoQueueCache<int, uint64_t, int*> cache;
+    int values[CAPACITY * 2] = {
+        0,
+    };
+};
+
+TEST_F(TwoQueueCacheFixture, Push_testIfVictimIsReturnedOnlyWhenFull)
+{
+    for (uint64_t lpn = 0; lpn < CAPACITY; lpn++)
+    {
+        EXPECT_EQ(cache.Push({0, lpn}, &values[lpn]), nullptr);
+    }
+    EXPECT_TRUE(cache.IsFull());
+
+    // the first page has never been reused, so it goes first
+    uint64_t newLpn = CAPACITY;
+    EXPECT_EQ(cache.Push({0, newLpn}, &values[newLpn]), &values[0]);
+    EXPECT_EQ(cache.GetSize(), cache.GetCapacity());
+    EXPECT_EQ(cache.Find({0, 0}), nullptr);
+}
+
+TEST_F(TwoQueueCacheFixture, Push_testIfPageEvictedOnceComesBackAsHot)
+{
+    for (uint64_t lpn = 0; lpn < CAPACITY; lpn++)
+    {
+        cache.Push({0, lpn}, &values[lpn]);
+    }
+    EXPECT_EQ(cache.PopVictim(), &values[0]);
+
+    // When : the evicted page is written again
+    cache.Push({0, 0}, &values[0]);
+
+    // Then
+    EXPECT_TRUE(cache.IsHot({0, 0}));
+    EXPECT_FALSE(cache.IsHot({0, 1}));
+}
+
+TEST_F(TwoQueueCacheFixture, PopVictim_testIfHotPagesOutliveOneTimePages)
+{
+    // Given : page 0 is hot, the rest were written only once
+    for (uint64_t lpn = 0; lpn < CAPACITY; lpn++)
+    {
+        cache.Push({0, lpn}, &values[lpn]);
+    }
+    cache.PopVictim();
+    cache.Push({0, 0}, &values[0]);
+
+    // When : a stream of new pages goes through the cache
+    for (uint64_t lpn = CAPACITY; lpn < CAPACITY * 2; lpn++)
+    {
+        EXPECT_NE(cache.Push({0, lpn}, &values[lpn]), &values[0]);
+    }
+
+    // Then
+    EXPECT_EQ(cache.Find({0, 0}), &values[0]);
+}
+
+TEST_F(TwoQueueCacheFixture, PopVictim_testIfLeastRecentlyUsedHotPageGoesFirst)
+{
+    // Given : pages 0 and 1 are hot, 0 was used last
+    cache.Push({0, 0}, &values[0]);
+    cache.Push({0, 1}, &values[1]);
+    cache.PopVictim();
+    cache.PopVictim();
+    cache.Push({0, 1}, &values[1]);
+    cache.Push({0, 0}, &values[0]);
+    cache.Find({0, 1});
+    cache.Find({0, 0});
+
+    // When, Then
+    EXPECT_EQ(cache.PopVictim(), &values[1]);
+    EXPECT_EQ(cache.PopVictim(), &values[0]);
+    EXPECT_EQ(cache.PopVictim(), nullptr);
+}
+
+TEST_F(TwoQueueCacheFixture, Remove_testIfEntryIsRemovedFromEitherQueue)
+{
+    cache.Push({0, 0}, &values[0]);
+    cache.PopVictim();
+    cache.Push({0, 0}, &values[0]);
+    cache.Push({1, 0}, &values[1]);
+
+    EXPECT_EQ(cache.Remove({0, 0}), &values[0]);
+    EXPECT_EQ(cache.Remove({1, 0}), &values[1]);
+    EXPECT_EQ(cache.Remove({1, 0}), nullptr);
+    EXPECT_TRUE(cache.IsEmpty());
+}
+
+TEST_F(TwoQueueCacheFixture, Push_testIfDuplicatedKeyIsRejected)
+{
+    cache.Push({0, 0}, &values[0]);
+
+    EXPECT_EQ(cache.Push({0, 0}, &values[1]), nullptr);
+    EXPECT_EQ(cache.Find({0, 0}), &values[0]);
+    EXPECT_EQ(cache.GetSize(), 1U);
+}
+} // namespace pos
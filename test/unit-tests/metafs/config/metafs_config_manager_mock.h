@@ -56,12 +56,20 @@ public:
     MOCK_METHOD(size_t, GetWrrCountMap, (), (const));
     MOCK_METHOD(size_t, GetWrrCountGeneral, (), (const));
     MOCK_METHOD(std::vector<int>, GetWrrWeight, (), (const));
+    MOCK_METHOD(std::vector<uint64_t>, GetDeadlineInUs, (), (const));
     MOCK_METHOD(bool, IsRocksdbEnabled, (), (const));
     MOCK_METHOD(bool, IsSupportingNumaDedicatedScheduling, (), (const));
+    MOCK_METHOD(uint32_t, GetSchedulerCountPerNuma, (), (const));
     MOCK_METHOD(void, SetNumberOfScheduler, (const int count));
     MOCK_METHOD(int, GetNumberOfScheduler, (), (const));
     MOCK_METHOD(void, SetIgnoreNumaDedicatedScheduling, (const bool ignore));
     MOCK_METHOD(bool, NeedToIgnoreNumaDedicatedScheduling, (), (const));
     MOCK_METHOD(bool, IsSupportCheckingCrcWhenReading, (), (const));
+    MOCK_METHOD(std::string, GetFileStorePath, (), (const));
+    MOCK_METHOD(bool, IsPlacementAdvisorEnabled, (), (const));
+    MOCK_METHOD(bool, IsAutoPlacementEnabled, (), (const));
+    MOCK_METHOD(uint64_t, GetNvramPlacementBudgetInMb, (), (const));
+    MOCK_METHOD(uint64_t, GetHotFileMaxSizeInKb, (), (const));
+    MOCK_METHOD(uint64_t, GetHotFileMinIops, (), (const));
 };
 } // namespace pos
@@ -244,4 +244,26 @@ TEST_F(MetaFsServiceFixture, Initialize_testIfOneSchedulerCanBeCreatedEachNumaWh
     EXPECT_NE(schedulers.find(0), schedulers.end());
     EXPECT_NE(schedulers.find(1), schedulers.end());
 }
+
+TEST_F(MetaFsServiceFixture, Initialize_testIfTwoSchedulersCanBeCreatedInTheSameNumaWhenTheCountPerNumaIsTwo)
+{
+    EXPECT_CALL(*schedulerFactory, CreateMetaFsIoScheduler).WillOnce(Return(scheduler[0]))
+        .WillOnce(Return(scheduler[1]));
+    ON_CALL(*config, IsSupportingNumaDedicatedScheduling).WillByDefault(Return(false));
+    ON_CALL(*config, GetSchedulerCountPerNuma).WillByDefault(Return(2));
+
+    CPU_SET(1, &schedSet);
+    CPU_SET(2, &schedSet);
+
+    SetNumaId(0);
+    SetNumaId(0);
+
+    service->Initialize(totalCoreCount, schedSet, mioSet, tp);
+
+    size_t countOfSchedulerExpected = 2;
+    SchedulerMap schedulers = service->GetScheduler();
+    EXPECT_EQ(schedulers.size(), countOfSchedulerExpected);
+    EXPECT_NE(schedulers.find(0), schedulers.end());
+    EXPECT_NE(schedulers.find(1), schedulers.end());
+}
 } // namespace pos
@@ -0,0 +1,163 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "src/metafs/meta_file_placement.h"
+
+#include <gtest/gtest.h>
+
+namespace pos
+{
+class MetaFilePlacementFixture : public ::testing::Test
+{
+protected:
+    MetaFilePlacement* _CreatePlacement(bool autoPlacement, uint64_t budget)
+    {
+        return new MetaFilePlacement(autoPlacement, budget, HOT_FILE_MAX_BYTES, HOT_FILE_MIN_IOPS,
+            [this](void) { return nowInUs; });
+    }
+
+    const uint64_t HOT_FILE_MAX_BYTES = 1024 * 1024;
+    const uint64_t HOT_FILE_MIN_IOPS = 10;
+    const uint64_t US_PER_SEC = 1000000;
+    uint64_t nowInUs = 0;
+};
+
+TEST_F(MetaFilePlacementFixture, GetTargetVolume_testIfHotSmallFileIsPlacedOnNvram)
+{
+    // Given
+    MetaFilePlacement* placement = _CreatePlacement(true, 1024 * 1024);
+    auto stat = placement->Track("SegmentContext", MetaVolumeType::SsdVolume, MetaVolumeType::SsdVolume, 4096);
+
+    // When: 20 async I/Os per second
+    for (int i = 0; i < 200; i++)
+    {
+        stat->Record(false, 4096);
+    }
+    nowInUs = 10 * US_PER_SEC;
+
+    // Then
+    EXPECT_EQ(placement->GetTargetVolume("SegmentContext"), MetaVolumeType::NvRamVolume);
+    delete placement;
+}
+
+TEST_F(MetaFilePlacementFixture, GetTargetVolume_testIfSyncIoWeighsMoreThanAsyncIo)
+{
+    // Given
+    MetaFilePlacement* placement = _CreatePlacement(true, 1024 * 1024);
+    auto syncStat = placement->Track("AllocatorContexts", MetaVolumeType::SsdVolume, MetaVolumeType::SsdVolume, 4096);
+    auto asyncStat = placement->Track("RebuildContext", MetaVolumeType::SsdVolume, MetaVolumeType::SsdVolume, 4096);
+
+    // When: 5 I/Os per second each
+    for (int i = 0; i < 50; i++)
+    {
+        syncStat->Record(true, 4096);
+        asyncStat->Record(false, 4096);
+    }
+    nowInUs = 10 * US_PER_SEC;
+
+    // Then
+    EXPECT_EQ(placement->GetTargetVolume("AllocatorContexts"), MetaVolumeType::NvRamVolume);
+    EXPECT_EQ(placement->GetTargetVolume("RebuildContext"), MetaVolumeType::SsdVolume);
+    delete placement;
+}
+
+TEST_F(MetaFilePlacementFixture, GetTargetVolume_testIfLargeOrPinnedFileStaysWhereItIsAsked)
+{
+    // Given
+    MetaFilePlacement* placement = _CreatePlacement(true, 64 * 1024 * 1024);
+    auto large = placement->Track("VSAMap.0.bin", MetaVolumeType::SsdVolume, MetaVolumeType::SsdVolume, HOT_FILE_MAX_BYTES + 1);
+    auto journal = placement->Track("JournalLogBuffer", MetaVolumeType::NvRamVolume, MetaVolumeType::NvRamVolume, 4096);
+
+    // When
+    for (int i = 0; i < 1000; i++)
+    {
+        large->Record(true, 4096);
+        journal->Record(false, 4096);
+    }
+    nowInUs = US_PER_SEC;
+
+    // Then
+    EXPECT_EQ(placement->GetTargetVolume("VSAMap.0.bin"), MetaVolumeType::SsdVolume);
+    EXPECT_EQ(placement->GetTargetVolume("JournalLogBuffer"), MetaVolumeType::NvRamVolume);
+    EXPECT_EQ(placement->GetTargetVolume("UnknownFile"), MetaVolumeType::Invalid);
+    delete placement;
+}
+
+TEST_F(MetaFilePlacementFixture, GetAdvice_testIfTheBudgetGoesToTheDensestFilesAndTheAdviceCoversAll)
+{
+    // Given: budget for one of the two hot files
+    MetaFilePlacement* placement = _CreatePlacement(true, 8192);
+    auto dense = placement->Track("SegmentContext", MetaVolumeType::SsdVolume, MetaVolumeType::SsdVolume, 8192);
+    auto sparse = placement->Track("StripeMap", MetaVolumeType::SsdVolume, MetaVolumeType::SsdVolume, 8192);
+    placement->Track("JournalLogBuffer", MetaVolumeType::NvRamVolume, MetaVolumeType::NvRamVolume, 1024 * 1024);
+
+    // When
+    for (int i = 0; i < 100; i++)
+    {
+        dense->Record(false, 4096);
+        dense->Record(false, 4096);
+        sparse->Record(false, 4096);
+    }
+    nowInUs = US_PER_SEC;
+    MetaFilePlacementAdvice advice = placement->GetAdvice();
+
+    // Then
+    EXPECT_EQ(placement->GetTargetVolume("SegmentContext"), MetaVolumeType::NvRamVolume);
+    EXPECT_EQ(placement->GetTargetVolume("StripeMap"), MetaVolumeType::SsdVolume);
+    EXPECT_EQ(advice.hotFiles.size(), 2UL);
+    EXPECT_EQ(advice.pinnedNvramBytes, 1024UL * 1024);
+    EXPECT_EQ(advice.hotFileBytes, 16384UL);
+    EXPECT_EQ(advice.placedBytes, 8192UL);
+    EXPECT_EQ(advice.recommendedNvramBytes, 2UL * 1024 * 1024);
+    delete placement;
+}
+
+TEST_F(MetaFilePlacementFixture, GetTargetVolume_testIfNothingMovesWithoutAutoPlacement)
+{
+    // Given
+    MetaFilePlacement* placement = _CreatePlacement(false, 1024 * 1024);
+    auto stat = placement->Track("SegmentContext", MetaVolumeType::SsdVolume, MetaVolumeType::NvRamVolume, 4096);
+
+    // When
+    for (int i = 0; i < 1000; i++)
+    {
+        stat->Record(true, 4096);
+    }
+    nowInUs = US_PER_SEC;
+
+    // Then: the advice is given, but the file goes back to where it is asked
+    EXPECT_EQ(placement->GetAdvice().placedBytes, 4096UL);
+    EXPECT_EQ(placement->GetTargetVolume("SegmentContext"), MetaVolumeType::SsdVolume);
+    delete placement;
+}
+} // namespace pos
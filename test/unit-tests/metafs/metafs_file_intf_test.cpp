@@ -34,6 +34,7 @@
 
 #include <gtest/gtest.h>
 
+#include <cstring>
 #include <string>
 
 #include "test/unit-tests/array_models/interface/i_array_info_mock.h"
@@ -78,6 +79,24 @@ public:
     }
 };
 
+class MetaFsNvramFileIntfTester : public MetaFsFileIntf
+{
+public:
+    MetaFsNvramFileIntfTester(string fname, int arrayId, MetaFs* metaFs, MetaFsConfigManager* configManager, char* base)
+    : MetaFsFileIntf(fname, arrayId, metaFs, configManager, MetaFileType::General, MetaVolumeType::NvRamVolume),
+      base(base)
+    {
+    }
+
+    char* GetDirectAccessAddress(uint64_t fileOffset) override
+    {
+        return base + fileOffset;
+    }
+
+private:
+    char* base;
+};
+
 class MetaFsFileIntfFixture : public ::testing::Test
 {
 public:
@@ -217,4 +236,69 @@ TEST_F(MetaFsFileIntfFixture, WriteMetaFile)
 
     EXPECT_EQ(metaFile->Write(0, 0, 0, nullptr), 0);
 }
+TEST_F(MetaFsFileIntfFixture, AsyncIO_testIfSubPageNvramWriteIsCompletedOnTheCallerThread)
+{
+    char nvram[64] = {0};
+    char data[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    bool completed = false;
+    ON_CALL(*config, IsDirectAccessEnabled).WillByDefault(Return(true));
+    MetaFsNvramFileIntfTester file(fileName, arrayId, metaFs, config, nvram);
+
+    EXPECT_CALL(*io, SubmitIO).Times(0);
+
+    AsyncMetaFileIoCtx ctx;
+    ctx.SetIoInfo(MetaFsIoOpcode::Write, 16, sizeof(data), data);
+    ctx.SetFileInfo(0, nullptr);
+    ctx.SetCallback([&](AsyncMetaFileIoCtx* ctx) { completed = true; });
+
+    EXPECT_EQ(file.AsyncIO(&ctx), 0);
+    EXPECT_TRUE(completed);
+    EXPECT_EQ(memcmp(nvram + 16, data, sizeof(data)), 0);
+}
+
+TEST_F(MetaFsFileIntfFixture, AsyncIO_testIfTheWriteCrossingThePageGoesThroughMetaFs)
+{
+    char nvram[64] = {0};
+    char data[8] = {0};
+    ON_CALL(*config, IsDirectAccessEnabled).WillByDefault(Return(true));
+    MetaFsNvramFileIntfTester file(fileName, arrayId, metaFs, config, nvram);
+
+    EXPECT_CALL(*io, SubmitIO).WillOnce(Return(EID(SUCCESS)));
+
+    AsyncMetaFileIoCtx ctx;
+    ctx.SetIoInfo(MetaFsIoOpcode::Write, MetaFsIoConfig::DEFAULT_META_PAGE_DATA_CHUNK_SIZE - 4, sizeof(data), data);
+    ctx.SetFileInfo(0, nullptr);
+    ctx.SetCallback([](AsyncMetaFileIoCtx* ctx) {});
+
+    EXPECT_EQ(file.AsyncIO(&ctx), 0);
+}
+
+TEST_F(MetaFsFileIntfFixture, DoesFileExist_testIfTheFileMovedToNvramIsFound)
+{
+    EXPECT_CALL(*ctrl, CheckFileExist(_, MetaVolumeType::SsdVolume)).WillOnce(Return(EID(MFS_FILE_NOT_FOUND)));
+    EXPECT_CALL(*ctrl, CheckFileExist(_, MetaVolumeType::NvRamVolume)).WillOnce(Return(EID(SUCCESS)));
+
+    EXPECT_TRUE(metaFile->DoesFileExist());
+    EXPECT_EQ(metaFile->GetVolumeType(), MetaVolumeType::NvRamVolume);
+}
+
+TEST_F(MetaFsFileIntfFixture, Close_testIfTheFileOnNvramIsMovedBackWithoutAutoPlacement)
+{
+    ON_CALL(*ctrl, CheckFileExist(_, MetaVolumeType::SsdVolume)).WillByDefault(Return(EID(MFS_FILE_NOT_FOUND)));
+    ON_CALL(*ctrl, CheckFileExist(_, MetaVolumeType::NvRamVolume)).WillByDefault(Return(EID(SUCCESS)));
+    ON_CALL(*ctrl, Open).WillByDefault(Return(EID(SUCCESS)));
+    ON_CALL(*ctrl, Close).WillByDefault(Return(EID(SUCCESS)));
+    ON_CALL(*ctrl, GetFileSize).WillByDefault(Return(fileSize));
+    ON_CALL(*ctrl, GetAvailableSpace).WillByDefault(Return(fileSize));
+    ON_CALL(*mgmt, IsValidVolume).WillByDefault(Return(true));
+    ON_CALL(*io, Read(_, _, _, _, _)).WillByDefault(Return(EID(SUCCESS)));
+    ON_CALL(*io, Write(_, _, _, _, _)).WillByDefault(Return(EID(SUCCESS)));
+    ASSERT_TRUE(metaFile->DoesFileExist());
+
+    EXPECT_CALL(*ctrl, Create(_, fileSize, _, MetaVolumeType::SsdVolume)).WillOnce(Return(EID(SUCCESS)));
+    EXPECT_CALL(*ctrl, Delete(_, MetaVolumeType::NvRamVolume)).WillOnce(Return(EID(SUCCESS)));
+
+    EXPECT_EQ(metaFile->Close(), 0);
+    EXPECT_EQ(metaFile->GetVolumeType(), MetaVolumeType::SsdVolume);
+}
 } // namespace pos
@@ -34,4 +34,37 @@ TEST(MDPageBufPool, MDPageBufPool_Normal)
     delete pool;
 }
 
+TEST(MDPageBufPool, PopNewBuf_testIfNullIsReturnedWhenPoolIsEmpty)
+{
+    MDPageBufPool* pool = new MDPageBufPool(1);
+    pool->Init();
+
+    void* buf = pool->PopNewBuf();
+    EXPECT_NE(buf, nullptr);
+    EXPECT_EQ(pool->PopNewBuf(), nullptr);
+
+    pool->FreeBuf(buf);
+    EXPECT_EQ(pool->PopNewBuf(), buf);
+    pool->FreeBuf(buf);
+
+    delete pool;
+}
+
+TEST(MDPageBufPool, PopNewBuf_testIfEachBufferCoversTheGivenNumberOfPages)
+{
+    const uint32_t COUNT = 2;
+    const uint32_t PAGES = 4;
+    MDPageBufPool* pool = new MDPageBufPool(COUNT, MDPageBufPool::ANY_NUMA, PAGES);
+    pool->Init();
+
+    uint8_t* first = (uint8_t*)pool->PopNewBuf();
+    uint8_t* second = (uint8_t*)pool->PopNewBuf();
+    uint64_t distance = (first > second) ? (first - second) : (second - first);
+    EXPECT_EQ(distance, PAGES * MetaFsIoConfig::META_PAGE_SIZE_IN_BYTES);
+
+    pool->FreeBuf(first);
+    pool->FreeBuf(second);
+
+    delete pool;
+}
 } // namespace pos
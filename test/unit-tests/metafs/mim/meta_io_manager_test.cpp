@@ -178,4 +178,48 @@ TEST(MetaIoManager, CheckArray)
     delete scheduler;
 }
 
+TEST(MetaIoManager, ProcessNewReq_testIfTheRequestsOfAFileAreIssuedToTheSameScheduler)
+{
+    const int arrayId = 0;
+    cpu_set_t cpuSet;
+    const std::string threadName = "testThread";
+    const std::vector<int> weight = {1, 1, 1, 1};
+    NiceMock<MockMetaFsIoScheduler>* scheduler[2];
+    SchedulerMap schedulerList;
+    for (uint32_t idx = 0; idx < 2; ++idx)
+    {
+        scheduler[idx] = new NiceMock<MockMetaFsIoScheduler>(0, 0, 0, threadName, cpuSet, nullptr, nullptr, nullptr, weight, false);
+        schedulerList.insert({idx, scheduler[idx]});
+    }
+
+    // fd 0 and fd 1 are sharded to different schedulers
+    EXPECT_CALL(*scheduler[0], EnqueueNewReq).Times(2);
+    EXPECT_CALL(*scheduler[1], EnqueueNewReq).Times(1);
+
+    NiceMock<MockMetaStorageSubsystem>* storage = new NiceMock<MockMetaStorageSubsystem>(arrayId);
+    MetaIoManager* mgr = new MetaIoManager(false, schedulerList, storage, 2);
+    mgr->Init();
+
+    std::vector<FileDescriptorType> fds = {0, 1, 0};
+    std::vector<MockMetaFsIoRequest*> reqs;
+    for (auto fd : fds)
+    {
+        MockMetaFsIoRequest* req = new MockMetaFsIoRequest();
+        req->ioMode = MetaIoMode::Async;
+        req->reqType = MetaIoRequestType::Read;
+        req->arrayId = arrayId;
+        req->fd = fd;
+        EXPECT_CALL(*req, IsSyncIO).WillRepeatedly(Return(false));
+        EXPECT_EQ(mgr->ProcessNewReq(*req), EID(SUCCESS));
+        reqs.push_back(req);
+    }
+
+    delete mgr;
+    for (auto req : reqs)
+    {
+        delete req;
+    }
+    delete scheduler[0];
+    delete scheduler[1];
+}
 } // namespace pos
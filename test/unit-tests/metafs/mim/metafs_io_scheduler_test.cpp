@@ -303,6 +303,43 @@ TEST_F(MetaFsIoSchedulerTexture, IssueRequest_testIfABigAlignedRequestCreatesMan
     EXPECT_EQ(metaIoWorker.GetRequestedSize(), 4032 * 1048);
 }
 
+TEST_F(MetaFsIoSchedulerTexture, IssueRequest_testIfContiguousLpnsOfReadFromSsdAreCoalesced)
+{
+    // given
+    MetaFileExtent extents[2];
+    extents[0].SetStartLpn(100);
+    extents[0].SetCount(40);
+    extents[1].SetStartLpn(200);
+    extents[1].SetCount(40);
+    MetaFileContext fileCtx;
+    fileCtx.chunkSize = 4032;
+    fileCtx.fileBaseLpn = 100;
+    fileCtx.extentsCount = 2;
+    fileCtx.CopyExtentsFrom(extents, fileCtx.extentsCount);
+    MetaFsIoRequest originReq;
+    MetaFsIoRequest* req;
+
+    // when
+    req = new MetaFsIoRequest;
+    req->fileCtx = &fileCtx;
+    req->extents = req->fileCtx->extents;
+    req->extentsCount = req->fileCtx->extentsCount;
+    req->originalMsg = &originReq;
+    req->reqType = MetaIoRequestType::Read;
+    req->byteOffsetInFile = 4032 * 4;
+    req->arrayId = 0;
+    req->byteSize = 4032 * 46; // lpn 104...135, 136...139, 200...209
+    req->targetMediaType = MetaStorageType::SSD;
+
+    // then
+    scheduler->IssueRequestAndDelete(req);
+    EXPECT_EQ(originReq.requestCount, 3);
+    EXPECT_EQ(metaIoWorker.GetRequestedCount(), 3);
+    EXPECT_EQ(metaIoWorker.GetTheFirstLpn(), 104);
+    EXPECT_EQ(metaIoWorker.GetTheLastLpn(), 200);
+    EXPECT_EQ(metaIoWorker.GetRequestedSize(), 4032 * 46);
+}
+
 TEST_F(MetaFsIoSchedulerTexture, IssueRequest_testForProcessingRequestsForFilesWithMultiExtentSimple)
 {
     // given
@@ -33,6 +33,7 @@
 #include "src/metafs/mim/metafs_io_wrr_q.h"
 
 #include <gtest/gtest.h>
+#include <unistd.h>
 
 #include <vector>
 
@@ -211,4 +212,40 @@ TEST_F(MetaFsIoWrrQFixture, WeightVerification_testIfDequeueSequenceMatchesWithE
 
     Empty();
 }
+TEST_F(MetaFsIoWrrQFixture, Deadline_testIfTheOverdueTypeIsDequeuedPrior)
+{
+    std::vector<MetaFileType> expectedSequence{
+        MetaFileType::Journal, MetaFileType::Journal, MetaFileType::Journal, MetaFileType::Journal};
+
+    // precondition
+    multiQ.SetWeight({4, 4, 4, 4});
+    multiQ.SetStartIndex((int)MetaFileType::General);
+    multiQ.SetDeadline({0, 1, 0, 0});
+
+    Fill();
+    usleep(100);
+
+    // check sequence
+    CheckResult(expectedSequence);
+
+    Empty();
+}
+
+TEST_F(MetaFsIoWrrQFixture, Deadline_testIfTheWeightIsKeptBeforeTheDeadline)
+{
+    std::vector<MetaFileType> expectedSequence{
+        MetaFileType::General, MetaFileType::General, MetaFileType::SpecialPurposeMap, MetaFileType::SpecialPurposeMap};
+
+    // precondition
+    multiQ.SetWeight({2, 2, 2, 2});
+    multiQ.SetStartIndex((int)MetaFileType::General);
+    multiQ.SetDeadline({0, 10000000, 0, 0});
+
+    Fill();
+
+    // check sequence
+    CheckResult(expectedSequence);
+
+    Empty();
+}
 } // namespace pos
@@ -16,7 +16,9 @@ public:
     MOCK_METHOD(bool, IsRangeOverlapConflicted, (MetaFsIoRequest* newReq));
     MOCK_METHOD(void, FreeLockContext, (uint64_t startLpn, bool isRead));
     MOCK_METHOD(void, PushReqToRangeLockMap, (MetaFsIoRequest* newReq));
-    MOCK_METHOD(BitMap*, GetOutstandingMioMap, ());
+    MOCK_METHOD(bool, TryLockRange, (const MetaLpnType startLpn, const MetaLpnType count));
+    MOCK_METHOD(void, UnlockRange, (const MetaLpnType startLpn, const MetaLpnType count));
+    MOCK_METHOD(bool, IsLocked, (const MetaLpnType lpn), (const));
     MOCK_METHOD(uint64_t, GetOutstandingMioCount, ());
 };
 
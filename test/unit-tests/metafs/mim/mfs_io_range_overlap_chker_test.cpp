@@ -1,10 +1,7 @@
-#include "test/unit-tests/lib/bitmap_mock.h"
 #include "src/metafs/mim/mfs_io_range_overlap_chker.h"
 #include "src/metafs/mim/metafs_io_request.h"
 #include <gtest/gtest.h>
 
-using ::testing::Return;
-
 namespace pos
 {
 TEST(MetaFsIoRangeOverlapChker, MetaFsIoRangeOverlapChker_NormalRead)
@@ -16,9 +13,6 @@ TEST(MetaFsIoRangeOverlapChker, MetaFsIoRangeOverlapChker_NormalRead)
 
     checker->Init(maxLpn);
 
-    BitMap* bitmap = checker->GetOutstandingMioMap();
-    EXPECT_NE(bitmap, nullptr);
-
     MetaFsIoRequest req;
     req.fd = 8;
     req.ioMode = MetaIoMode::Async;
@@ -54,9 +48,6 @@ TEST(MetaFsIoRangeOverlapChker, MetaFsIoRangeOverlapChker_NormalWrite)
 
     checker->Init(maxLpn);
 
-    BitMap* bitmap = checker->GetOutstandingMioMap();
-    EXPECT_NE(bitmap, nullptr);
-
     MetaFsIoRequest req;
     req.fd = 8;
     req.ioMode = MetaIoMode::Async;
@@ -86,20 +77,71 @@ TEST(MetaFsIoRangeOverlapChker, MetaFsIoRangeOverlapChker_NormalWrite)
 TEST(MetaFsIoRangeOverlapChker, OutstandingCount_Positive)
 {
     const MetaLpnType maxLpn = 100;
+    MetaFsIoRangeOverlapChker* checker = new MetaFsIoRangeOverlapChker();
+    checker->Init(maxLpn);
+
+    EXPECT_EQ(checker->GetOutstandingMioCount(), 0U);
+
+    EXPECT_TRUE(checker->TryLockRange(10, 1));
+    EXPECT_EQ(checker->GetOutstandingMioCount(), 1U);
+
+    EXPECT_TRUE(checker->TryLockRange(20, 1));
+    EXPECT_EQ(checker->GetOutstandingMioCount(), 2U);
+
+    checker->UnlockRange(10, 1);
+    checker->UnlockRange(20, 1);
+    EXPECT_EQ(checker->GetOutstandingMioCount(), 0U);
+
+    delete checker;
+}
+
+TEST(MetaFsIoRangeOverlapChker, TryLockRange_testIfAnOverlappedRangeIsRejectedWithoutLeavingAnyLock)
+{
+    const MetaLpnType maxLpn = 100;
+    MetaFsIoRangeOverlapChker* checker = new MetaFsIoRangeOverlapChker();
+    checker->Init(maxLpn);
+
+    EXPECT_TRUE(checker->TryLockRange(50, 4));
+    EXPECT_FALSE(checker->TryLockRange(46, 6));
 
-    MockBitMap* bitmap = new MockBitMap(maxLpn);
-    MetaFsIoRangeOverlapChker* checker = new MetaFsIoRangeOverlapChker(bitmap);
+    // only the first range is locked
+    EXPECT_FALSE(checker->IsLocked(46));
+    EXPECT_FALSE(checker->IsLocked(49));
+    EXPECT_TRUE(checker->IsLocked(50));
+    EXPECT_TRUE(checker->IsLocked(53));
+    EXPECT_FALSE(checker->IsLocked(54));
+    EXPECT_EQ(checker->GetOutstandingMioCount(), 4U);
+
+    delete checker;
+}
 
-    EXPECT_CALL(*bitmap, GetNumBitsSet).WillOnce(Return(0));
-    EXPECT_EQ(checker->GetOutstandingMioCount(), 0);
+TEST(MetaFsIoRangeOverlapChker, TryLockRange_testIfTheRangeCanCrossTheShardBoundary)
+{
+    const MetaLpnType boundary = MetaFsIoRangeOverlapChker::LPN_COUNT_PER_SHARD;
+    const MetaLpnType maxLpn = boundary * 2;
+    MetaFsIoRangeOverlapChker* checker = new MetaFsIoRangeOverlapChker();
+    checker->Init(maxLpn);
 
-    EXPECT_CALL(*bitmap, GetNumBitsSet).WillOnce(Return(1));
-    EXPECT_EQ(checker->GetOutstandingMioCount(), 1);
+    EXPECT_TRUE(checker->TryLockRange(boundary - 2, 4));
+    EXPECT_TRUE(checker->IsLocked(boundary - 1));
+    EXPECT_TRUE(checker->IsLocked(boundary));
 
-    EXPECT_CALL(*bitmap, GetNumBitsSet).WillOnce(Return(2));
-    EXPECT_EQ(checker->GetOutstandingMioCount(), 2);
+    checker->UnlockRange(boundary - 2, 4);
+    EXPECT_FALSE(checker->IsLocked(boundary));
+    EXPECT_EQ(checker->GetOutstandingMioCount(), 0U);
 
     delete checker;
 }
 
+TEST(MetaFsIoRangeOverlapChker, TryLockRange_testIfTheLpnOutOfRangeCannotBeLocked)
+{
+    const MetaLpnType maxLpn = 100;
+    MetaFsIoRangeOverlapChker* checker = new MetaFsIoRangeOverlapChker();
+    checker->Init(maxLpn);
+
+    EXPECT_FALSE(checker->TryLockRange(maxLpn, 2));
+    EXPECT_FALSE(checker->IsLocked(maxLpn));
+
+    delete checker;
+}
 } // namespace pos
@@ -238,6 +238,60 @@ TEST_F(MioHandlerTestFixture, Normal_PushToRetryQueue)
     delete msg;
 }
 
+TEST_F(MioHandlerTestFixture, TophalfMioProcessing_testIfRequestIsRequeuedWhenMpioIsExhausted)
+{
+    MockMetaFsIoRangeOverlapChker* checker = new MockMetaFsIoRangeOverlapChker();
+
+    MockMetaFsIoRequest* msg = new MockMetaFsIoRequest();
+    msg->reqType = MetaIoRequestType::Write;
+    msg->arrayId = 0;
+    msg->targetMediaType = MetaStorageType::SSD;
+
+    ON_CALL(*checker, IsRangeOverlapConflicted).WillByDefault(Return(false));
+    ON_CALL(*mioPool, GetFreeCount).WillByDefault(Return(1));
+    EXPECT_CALL(*ioSQ, Dequeue).WillOnce(Return(msg));
+    EXPECT_CALL(*mpioAllocator, IsEmpty(MpioType::Write)).WillOnce(Return(true));
+
+    // the request goes back to the queue without taking a mio
+    EXPECT_CALL(*ioSQ, Enqueue).Times(1);
+    EXPECT_CALL(*mioPool, TryAlloc).Times(0);
+
+    handler->BindPartialMpioHandler(bottomhalfHandler);
+    EXPECT_TRUE(handler->AddArrayInfo(arrayInfo->GetIndex(), MetaStorageType::SSD, checker));
+
+    handler->TophalfMioProcessing();
+
+    delete msg;
+}
+
+TEST_F(MioHandlerTestFixture, TophalfMioProcessing_testIfMultiPageReadIsRequeuedWhenMultiPageMpioIsExhausted)
+{
+    MockMetaFsIoRangeOverlapChker* checker = new MockMetaFsIoRangeOverlapChker();
+
+    MockMetaFsIoRequest* msg = new MockMetaFsIoRequest();
+    msg->reqType = MetaIoRequestType::Read;
+    msg->arrayId = 0;
+    msg->targetMediaType = MetaStorageType::SSD;
+
+    ON_CALL(*checker, IsRangeOverlapConflicted).WillByDefault(Return(false));
+    ON_CALL(*mioPool, GetFreeCount).WillByDefault(Return(1));
+    ON_CALL(*msg, GetRequestLpnCount).WillByDefault(Return(4));
+    EXPECT_CALL(*ioSQ, Dequeue).WillOnce(Return(msg));
+    EXPECT_CALL(*mpioAllocator, IsMultiPageReadEmpty).WillOnce(Return(true));
+    EXPECT_CALL(*mpioAllocator, IsEmpty).Times(0);
+
+    // the request goes back to the queue without taking a mio
+    EXPECT_CALL(*ioSQ, Enqueue).Times(1);
+    EXPECT_CALL(*mioPool, TryAlloc).Times(0);
+
+    handler->BindPartialMpioHandler(bottomhalfHandler);
+    EXPECT_TRUE(handler->AddArrayInfo(arrayInfo->GetIndex(), MetaStorageType::SSD, checker));
+
+    handler->TophalfMioProcessing();
+
+    delete msg;
+}
+
 TEST_F(MioHandlerTestFixture, Repeat_AddAndRemoveArray)
 {
     const int MAX_COUNT = 200;
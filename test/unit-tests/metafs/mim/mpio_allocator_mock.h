@@ -52,6 +52,9 @@ public:
     MOCK_METHOD(void, ReleaseAllCache, (), (override));
     MOCK_METHOD(size_t, GetCacheSize, (), (const));
     MOCK_METHOD(bool, IsCacheFull, (), (const));
+    MOCK_METHOD(bool, IsEmpty, (const MpioType type), (const, override));
+    MOCK_METHOD(Mpio*, TryAllocMultiPageRead, (), (override));
+    MOCK_METHOD(bool, IsMultiPageReadEmpty, (), (const, override));
 };
 
 } // namespace pos
@@ -37,7 +37,7 @@
 #include <unordered_set>
 
 #include "test/unit-tests/metafs/config/metafs_config_manager_mock.h"
-#include "test/unit-tests/metafs/common/fifo_cache_mock.h"
+#include "test/unit-tests/metafs/common/two_queue_cache_mock.h"
 
 using ::testing::NiceMock;
 using ::testing::Return;
@@ -239,7 +239,7 @@ public:
         EXPECT_CALL(*config, GetWriteMpioCacheCapacity).WillRepeatedly(Return(COUNT));
         EXPECT_CALL(*config, IsDirectAccessEnabled).WillRepeatedly(Return(false));
 
-        writeCache = std::make_shared<NiceMock<MockFifoCache<int, MetaLpnType, Mpio*>>>(COUNT);
+        writeCache = std::make_shared<NiceMock<MockTwoQueueCache<int, MetaLpnType, Mpio*>>>(COUNT);
 
         allocator = new MpioAllocator(config, writeCache);
     }
@@ -269,7 +269,7 @@ public:
 protected:
     NiceMock<MockMetaFsConfigManager>* config;
     MpioAllocator* allocator;
-    std::shared_ptr<NiceMock<MockFifoCache<int, MetaLpnType, Mpio*>>> writeCache;
+    std::shared_ptr<NiceMock<MockTwoQueueCache<int, MetaLpnType, Mpio*>>> writeCache;
 
     const uint32_t COUNT = 10;
     const int arrayId = 0;
@@ -0,0 +1,127 @@
+#include "src/metafs/mim/multi_page_read_mpio.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "test/unit-tests/metafs/storage/mss_mock.h"
+
+using ::testing::NiceMock;
+
+namespace pos
+{
+class MultiPageReadMpioTester : public MultiPageReadMpio
+{
+public:
+    MultiPageReadMpioTester(void* mdPageBuf, const uint32_t maxPageCount)
+    : MultiPageReadMpio(mdPageBuf, maxPageCount, false, false)
+    {
+        mss = new NiceMock<MockMetaStorageSubsystem>(0);
+    }
+    ~MultiPageReadMpioTester(void)
+    {
+        delete mss;
+    }
+    void Setup(MpioIoInfo& mpioIoInfo)
+    {
+        MultiPageReadMpio::Setup(mpioIoInfo, false, false, mss);
+    }
+    bool CopyToUserBuf(void)
+    {
+        return _CopyToUserBuf();
+    }
+
+private:
+    NiceMock<MockMetaStorageSubsystem>* mss;
+};
+
+class MultiPageReadMpioFixture : public ::testing::Test
+{
+public:
+    virtual void SetUp(void) override
+    {
+        buf = (uint8_t*)malloc(PAGE_SIZE * PAGE_COUNT);
+        memset(buf, 0, PAGE_SIZE * PAGE_COUNT);
+        for (uint32_t idx = 0; idx < PAGE_COUNT; ++idx)
+        {
+            memset(buf + (idx * PAGE_SIZE), 'a' + idx, CHUNK_SIZE);
+        }
+        mpio = new MultiPageReadMpioTester(buf, PAGE_COUNT);
+    }
+    virtual void TearDown(void) override
+    {
+        delete mpio;
+        free(buf);
+    }
+
+protected:
+    const uint32_t PAGE_COUNT = 4;
+    const size_t PAGE_SIZE = MetaFsIoConfig::META_PAGE_SIZE_IN_BYTES;
+    const size_t CHUNK_SIZE = MetaFsIoConfig::DEFAULT_META_PAGE_DATA_CHUNK_SIZE;
+    uint8_t* buf;
+    MultiPageReadMpioTester* mpio;
+};
+
+TEST_F(MultiPageReadMpioFixture, IsMultiPage_testIfTheMpioIsDistinguishedFromTheSinglePageOne)
+{
+    EXPECT_TRUE(mpio->IsMultiPage());
+    EXPECT_EQ(mpio->GetType(), MpioType::Read);
+    EXPECT_EQ(mpio->GetMaxPageCount(), PAGE_COUNT);
+}
+
+TEST_F(MultiPageReadMpioFixture, CopyToUserBuf_testIfTheControlInfoOfEachPageIsSkipped)
+{
+    const size_t HEAD_OFFSET = 100;
+    const size_t SIZE = (CHUNK_SIZE * 3) - HEAD_OFFSET - 50;
+    std::vector<uint8_t> userBuf(SIZE, 0);
+
+    MpioIoInfo ioInfo;
+    ioInfo.pageCnt = 3;
+    ioInfo.startByteOffset = HEAD_OFFSET;
+    ioInfo.byteSize = SIZE;
+    ioInfo.userBuf = userBuf.data();
+    mpio->Setup(ioInfo);
+
+    EXPECT_TRUE(mpio->CopyToUserBuf());
+
+    EXPECT_EQ(userBuf[0], 'a');
+    EXPECT_EQ(userBuf[CHUNK_SIZE - HEAD_OFFSET - 1], 'a');
+    EXPECT_EQ(userBuf[CHUNK_SIZE - HEAD_OFFSET], 'b');
+    EXPECT_EQ(userBuf[(CHUNK_SIZE * 2) - HEAD_OFFSET], 'c');
+    EXPECT_EQ(userBuf[SIZE - 1], 'c');
+}
+
+TEST_F(MultiPageReadMpioFixture, DoE2ECheck_testIfOnlyThePagesWithoutValidSignatureAreCleared)
+{
+    const uint64_t SIGNATURE = 0x1234;
+    const FileDescriptorType FD = 3;
+    const MetaLpnType LPN = 10;
+
+    // only the second page has been written before
+    MDPage written(buf + PAGE_SIZE);
+    written.AttachControlInfo();
+    written.BuildControlInfo(LPN + 1, FD, 0, SIGNATURE);
+
+    MpioIoInfo ioInfo;
+    ioInfo.pageCnt = 2;
+    ioInfo.metaLpn = LPN;
+    ioInfo.targetFD = FD;
+    ioInfo.signature = SIGNATURE;
+    ioInfo.targetMediaType = MetaStorageType::SSD;
+    mpio->Setup(ioInfo);
+
+    EXPECT_TRUE(mpio->DoE2ECheck(MpAioState::Complete));
+    EXPECT_EQ(mpio->GetNextState(), MpAioState::Complete);
+
+    EXPECT_EQ(buf[0], 0);
+    EXPECT_EQ(buf[CHUNK_SIZE - 1], 0);
+    EXPECT_EQ(buf[PAGE_SIZE], 'b');
+}
+
+TEST_F(MultiPageReadMpioFixture, Setup_testIfTheAssertionIsWorkingWhenThePageCountIsTooLarge)
+{
+    MpioIoInfo ioInfo;
+    ioInfo.pageCnt = PAGE_COUNT + 1;
+
+    EXPECT_DEATH(mpio->Setup(ioInfo), "");
+}
+} // namespace pos
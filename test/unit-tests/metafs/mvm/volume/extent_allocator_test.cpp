@@ -326,51 +326,89 @@ TEST(ExtentAllocator, Range3)
     EXPECT_EQ(freeList.size(), 3);
     EXPECT_EQ(extentMgr.GetAvailableLpnCount(), 44);
 
-    // available: 4
+    // available: 20, the only free extent which can hold 24 lpns is used
     map = extentMgr.AllocExtents(17);
 
-    EXPECT_EQ(map.size(), 3);
-    if (map.size() == 3)
+    EXPECT_EQ(map.size(), 1);
+    if (map.size() == 1)
     {
-        EXPECT_EQ(map[0].GetStartLpn(), 16);
-        EXPECT_EQ(map[0].GetCount(), 8);
-        EXPECT_EQ(map[1].GetStartLpn(), 32);
-        EXPECT_EQ(map[1].GetCount(), 8);
-        EXPECT_EQ(map[2].GetStartLpn(), 72);
-        EXPECT_EQ(map[2].GetCount(), 8);
+        EXPECT_EQ(map[0].GetStartLpn(), 72);
+        EXPECT_EQ(map[0].GetCount(), 24);
 
         extentMgr.PrintFreeExtentList();
         EXPECT_EQ(extentMgr.GetAvailableLpnCount(), 20);
 
         extentMgr.AddToFreeList(map[0].GetStartLpn(), map[0].GetCount());
-        extentMgr.AddToFreeList(map[1].GetStartLpn(), map[1].GetCount());
-        extentMgr.AddToFreeList(map[2].GetStartLpn(), map[2].GetCount());
 
         extentMgr.PrintFreeExtentList();
+        EXPECT_EQ(freeList.size(), 3);
         EXPECT_EQ(extentMgr.GetAvailableLpnCount(), 44);
     }
 
     map = extentMgr.AllocExtents(16);
 
-    EXPECT_EQ(map.size(), 2);
-    if (map.size() == 2)
+    EXPECT_EQ(map.size(), 1);
+    if (map.size() == 1)
     {
-        EXPECT_EQ(map[0].GetStartLpn(), 16);
-        EXPECT_EQ(map[0].GetCount(), 8);
-        EXPECT_EQ(map[1].GetStartLpn(), 32);
-        EXPECT_EQ(map[1].GetCount(), 8);
+        EXPECT_EQ(map[0].GetStartLpn(), 72);
+        EXPECT_EQ(map[0].GetCount(), 16);
 
         extentMgr.PrintFreeExtentList();
         EXPECT_EQ(extentMgr.GetAvailableLpnCount(), 28);
 
         extentMgr.AddToFreeList(map[0].GetStartLpn(), map[0].GetCount());
-        extentMgr.AddToFreeList(map[1].GetStartLpn(), map[1].GetCount());
 
         extentMgr.PrintFreeExtentList();
         EXPECT_EQ(extentMgr.GetAvailableLpnCount(), 44);
     }
 }
 
+TEST(ExtentAllocator, AllocExtents_testIfTheSmallestFreeExtentWhichCanHoldTheFileIsUsed)
+{
+    ExtentAllocatorTester extentMgr;
+    extentMgr.Init(0, 103);
+
+    // free: {0, 16}, {24, 32}, {64, 24}
+    std::vector<MetaFileExtent> map = extentMgr.AllocExtents(104);
+    extentMgr.AddToFreeList(0, 16);
+    extentMgr.AddToFreeList(24, 32);
+    extentMgr.AddToFreeList(64, 24);
+
+    map = extentMgr.AllocExtents(20);
+
+    ASSERT_EQ(map.size(), 1);
+    EXPECT_EQ(map[0].GetStartLpn(), 64);
+    EXPECT_EQ(map[0].GetCount(), 24);
+    EXPECT_EQ(extentMgr.GetAvailableLpnCount(), 48);
+}
+
+TEST(ExtentAllocator, AllocExtents_testIfTheLargestFreeExtentsAreUsedFirstWhenNoExtentCanHoldTheFile)
+{
+    ExtentAllocatorTester extentMgr;
+    extentMgr.Init(0, 103);
+
+    // free: {0, 8}, {16, 24}, {48, 8}, {64, 16}
+    std::deque<MetaFileExtent>& freeList = extentMgr.GetFreeList();
+    std::vector<MetaFileExtent> map = extentMgr.AllocExtents(104);
+    extentMgr.AddToFreeList(0, 8);
+    extentMgr.AddToFreeList(16, 24);
+    extentMgr.AddToFreeList(48, 8);
+    extentMgr.AddToFreeList(64, 16);
+
+    map = extentMgr.AllocExtents(48);
+
+    ASSERT_EQ(map.size(), 3);
+    EXPECT_EQ(map[0].GetStartLpn(), 16);
+    EXPECT_EQ(map[0].GetCount(), 24);
+    EXPECT_EQ(map[1].GetStartLpn(), 64);
+    EXPECT_EQ(map[1].GetCount(), 16);
+    EXPECT_EQ(map[2].GetStartLpn(), 0);
+    EXPECT_EQ(map[2].GetCount(), 8);
+    ASSERT_EQ(freeList.size(), 1);
+    EXPECT_EQ(freeList[0].GetStartLpn(), 48);
+    EXPECT_EQ(extentMgr.GetAvailableLpnCount(), 8);
+}
+
 TEST(ExtentAllocator, Range4)
 {
     // Given
@@ -0,0 +1,159 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2021 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "src/metafs/storage/mss_on_file.h"
+
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstring>
+#include <string>
+
+#include "src/metafs/config/metafs_config.h"
+
+namespace pos
+{
+class MssOnFileFixture : public ::testing::Test
+{
+public:
+    virtual void SetUp(void) override
+    {
+        char dirName[] = "/tmp/mss_on_file_XXXXXX";
+        ASSERT_NE(mkdtemp(dirName), nullptr);
+        path = dirName;
+        mss = new MssOnFile(0, path);
+
+        ASSERT_EQ(posix_memalign(&writeBuf, TEST_PAGE_SIZE, TEST_PAGE_SIZE * TEST_PAGE_COUNT), 0);
+        ASSERT_EQ(posix_memalign(&readBuf, TEST_PAGE_SIZE, TEST_PAGE_SIZE * TEST_PAGE_COUNT), 0);
+        memset(writeBuf, 0xA5, TEST_PAGE_SIZE * TEST_PAGE_COUNT);
+        memset(readBuf, 0, TEST_PAGE_SIZE * TEST_PAGE_COUNT);
+    }
+    virtual void TearDown(void) override
+    {
+        std::string file = mss->GetFilePath(MetaStorageType::SSD);
+        delete mss;
+        unlink(file.c_str());
+        rmdir(path.c_str());
+        free(writeBuf);
+        free(readBuf);
+    }
+
+protected:
+    static const uint64_t TEST_PAGE_SIZE = MetaFsIoConfig::META_PAGE_SIZE_IN_BYTES;
+    static const uint64_t TEST_PAGE_COUNT = 8;
+    static const uint64_t TEST_CAPACITY = TEST_PAGE_SIZE * 64;
+
+    std::string path;
+    MssOnFile* mss;
+    void* writeBuf;
+    void* readBuf;
+};
+
+TEST_F(MssOnFileFixture, CreateMetaStore_testIfTheCapacityIsNotAligned)
+{
+    EXPECT_EQ(mss->CreateMetaStore(0, MetaStorageType::SSD, 100), EID(MFS_INVALID_PARAMETER));
+}
+
+TEST_F(MssOnFileFixture, CreateMetaStore_testIfTheCapacityCanBeRetrieved)
+{
+    uint64_t capacity = TEST_CAPACITY;
+    EXPECT_EQ(mss->CreateMetaStore(0, MetaStorageType::SSD, capacity), EID(SUCCESS));
+    EXPECT_EQ(mss->GetCapacity(MetaStorageType::SSD), capacity);
+    EXPECT_EQ(mss->TranslateAddress(MetaStorageType::SSD, 3).offset, 3U);
+}
+
+TEST_F(MssOnFileFixture, WritePage_testIfTheWrittenPagesCanBeReadSynchronously)
+{
+    uint64_t pageCount = TEST_PAGE_COUNT;
+    ASSERT_EQ(mss->CreateMetaStore(0, MetaStorageType::SSD, TEST_CAPACITY), EID(SUCCESS));
+
+    EXPECT_EQ(mss->WritePage(MetaStorageType::SSD, 2, writeBuf, pageCount), EID(SUCCESS));
+    EXPECT_EQ(mss->ReadPage(MetaStorageType::SSD, 2, readBuf, pageCount), EID(SUCCESS));
+    EXPECT_EQ(memcmp(writeBuf, readBuf, TEST_PAGE_SIZE * pageCount), 0);
+}
+
+TEST_F(MssOnFileFixture, ReadPage_testIfTheOutOfBoundaryRequestIsRejected)
+{
+    ASSERT_EQ(mss->CreateMetaStore(0, MetaStorageType::SSD, TEST_CAPACITY), EID(SUCCESS));
+
+    EXPECT_EQ(mss->ReadPage(MetaStorageType::SSD, 60, readBuf, TEST_PAGE_COUNT), EID(MFS_INVALID_PARAMETER));
+    EXPECT_EQ(mss->ReadPage(MetaStorageType::NVRAM, 0, readBuf, 1), EID(MFS_INVALID_PARAMETER));
+}
+
+TEST_F(MssOnFileFixture, TrimFileData_testIfTheTrimmedPagesAreZeroed)
+{
+    ASSERT_EQ(mss->CreateMetaStore(0, MetaStorageType::SSD, TEST_CAPACITY), EID(SUCCESS));
+    ASSERT_EQ(mss->WritePage(MetaStorageType::SSD, 0, writeBuf, TEST_PAGE_COUNT), EID(SUCCESS));
+
+    EXPECT_EQ(mss->TrimFileData(MetaStorageType::SSD, 0, nullptr, TEST_PAGE_COUNT), EID(SUCCESS));
+    memset(readBuf, 0xFF, TEST_PAGE_SIZE * TEST_PAGE_COUNT);
+    EXPECT_EQ(mss->ReadPage(MetaStorageType::SSD, 0, readBuf, TEST_PAGE_COUNT), EID(SUCCESS));
+
+    for (uint64_t idx = 0; idx < TEST_PAGE_SIZE * TEST_PAGE_COUNT; ++idx)
+    {
+        ASSERT_EQ(((uint8_t*)readBuf)[idx], 0);
+    }
+}
+
+TEST_F(MssOnFileFixture, WritePageAsync_testIfTheCallbackIsInvokedAfterTheWrittenPagesAreStored)
+{
+    ASSERT_EQ(mss->CreateMetaStore(0, MetaStorageType::SSD, TEST_CAPACITY), EID(SUCCESS));
+
+    std::atomic<int> completed(0);
+    AsyncCallback callback = [&](void* data) { completed++; };
+
+    MssAioData writeData;
+    writeData.Init(0, MetaStorageType::SSD, 4, TEST_PAGE_COUNT, writeBuf, 0, 0, 0);
+    MssAioCbCxt writeCtx;
+    writeCtx.Init(&writeData, callback);
+    ASSERT_EQ(mss->WritePageAsync(&writeCtx), EID(SUCCESS));
+    while (completed != 1)
+    {
+        usleep(1);
+    }
+    EXPECT_EQ(writeData.GetError(), 0);
+
+    MssAioData readData;
+    readData.Init(0, MetaStorageType::SSD, 4, TEST_PAGE_COUNT, readBuf, 0, 0, 0);
+    MssAioCbCxt readCtx;
+    readCtx.Init(&readData, callback);
+    ASSERT_EQ(mss->ReadPageAsync(&readCtx), EID(SUCCESS));
+    while (completed != 2)
+    {
+        usleep(1);
+    }
+    EXPECT_EQ(readData.GetError(), 0);
+    EXPECT_EQ(memcmp(writeBuf, readBuf, TEST_PAGE_SIZE * TEST_PAGE_COUNT), 0);
+}
+} // namespace pos
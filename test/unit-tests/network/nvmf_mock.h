@@ -55,6 +55,7 @@ public:
     MOCK_METHOD(bool, VolumeLoaded, (VolumeEventBase * volEventBase, VolumeEventPerf* volEventPerf, VolumeArrayInfo* volArrayInfo), (override));
     MOCK_METHOD(bool, VolumeUpdated, (VolumeEventBase * volEventBase, VolumeEventPerf* volEventPerf, VolumeArrayInfo* volArrayInfo), (override));
     MOCK_METHOD(void, VolumeDetached, (vector<int> volList, VolumeArrayInfo* volArrayInfo), (override));
+    MOCK_METHOD(int, VolumeResized, (VolumeEventBase * volEventBase, VolumeArrayInfo* volArrayInfo), (override));
 };
 
 } // namespace pos
@@ -0,0 +1,118 @@
+#include "src/network/nvmf_namespace_batcher.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+#include "spdk/nvme_spec.h"
+#include "test/unit-tests/spdk_wrapper/caller/spdk_nvmf_caller_mock.h"
+#include "test/unit-tests/spdk_wrapper/event_framework_api_mock.h"
+
+using ::testing::_;
+using ::testing::Matcher;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+static struct EventContext*
+MakeDetachContext(uint32_t nsid)
+{
+    struct EventContext* ctx = AllocEventContext(nullptr, nullptr);
+    ctx->eventArg1 = spdk_sprintf_alloc("%u", nsid);
+    return ctx;
+}
+
+static struct EventContext*
+MakeAttachContext(const char* bdevName)
+{
+    struct EventContext* ctx = AllocEventContext(nullptr, nullptr);
+    ctx->eventArg1 = strdup(bdevName);
+    ctx->eventArg2 = spdk_sprintf_alloc("%u", 0);
+    return ctx;
+}
+
+TEST(NvmfNamespaceBatcher, Submit_testIfOperationsSubmittedWhilePausingShareOnePause)
+{
+    // Given
+    NvmfNamespaceBatcher batcher;
+    struct spdk_nvmf_subsystem* subsystem = reinterpret_cast<struct spdk_nvmf_subsystem*>(0x1000);
+    NiceMock<MockSpdkNvmfCaller> spdkNvmfCaller;
+    struct EventContext* first = MakeAttachContext("bdev_0_array");
+    struct EventContext* second = MakeAttachContext("bdev_1_array");
+
+    // Then: only the first submit pauses the subsystem, and no namespace is drained
+    EXPECT_CALL(spdkNvmfCaller, SpdkNvmfSubsystemPause(subsystem, 0U, _, &batcher)).WillOnce(Return(0));
+
+    // When
+    batcher.Submit(subsystem, NamespaceOperationType::ATTACH, first, &spdkNvmfCaller);
+    batcher.Submit(subsystem, NamespaceOperationType::ATTACH, second, &spdkNvmfCaller);
+    EXPECT_EQ(2U, batcher.GetQueuedCount(subsystem));
+
+    FreeEventContext(first);
+    FreeEventContext(second);
+}
+
+TEST(NvmfNamespaceBatcher, Submit_testIfEachSubsystemIsPausedOnItsOwn)
+{
+    // Given
+    NvmfNamespaceBatcher batcher;
+    struct spdk_nvmf_subsystem* subsystem1 = reinterpret_cast<struct spdk_nvmf_subsystem*>(0x1000);
+    struct spdk_nvmf_subsystem* subsystem2 = reinterpret_cast<struct spdk_nvmf_subsystem*>(0x2000);
+    NiceMock<MockSpdkNvmfCaller> spdkNvmfCaller;
+    struct EventContext* first = MakeDetachContext(3);
+    struct EventContext* second = MakeDetachContext(3);
+
+    // Then: a single detach pauses only its own namespace
+    EXPECT_CALL(spdkNvmfCaller, SpdkNvmfSubsystemPause(subsystem1, 3U, _, _)).WillOnce(Return(0));
+    EXPECT_CALL(spdkNvmfCaller, SpdkNvmfSubsystemPause(subsystem2, 3U, _, _)).WillOnce(Return(0));
+
+    // When
+    batcher.Submit(subsystem1, NamespaceOperationType::DETACH, first, &spdkNvmfCaller);
+    batcher.Submit(subsystem2, NamespaceOperationType::DETACH, second, &spdkNvmfCaller);
+    EXPECT_EQ(1U, batcher.GetQueuedCount(subsystem1));
+    EXPECT_EQ(1U, batcher.GetQueuedCount(subsystem2));
+
+    FreeEventContext(first);
+    FreeEventContext(second);
+}
+
+TEST(NvmfNamespaceBatcher, SelectPauseNsid_testIfOnlyTheNamespacesToDetachArePaused)
+{
+    // Given
+    struct EventContext* attach = MakeAttachContext("bdev_0_array");
+    struct EventContext* detach1 = MakeDetachContext(1);
+    struct EventContext* detach2 = MakeDetachContext(2);
+    std::vector<NamespaceOperation> attachOnly = {{NamespaceOperationType::ATTACH, attach}};
+    std::vector<NamespaceOperation> singleDetach = {
+        {NamespaceOperationType::ATTACH, attach}, {NamespaceOperationType::DETACH, detach1}};
+    std::vector<NamespaceOperation> twoDetaches = {
+        {NamespaceOperationType::DETACH, detach1}, {NamespaceOperationType::DETACH, detach2}};
+
+    // When, Then
+    EXPECT_EQ(0U, NvmfNamespaceBatcher::SelectPauseNsid(attachOnly));
+    EXPECT_EQ(1U, NvmfNamespaceBatcher::SelectPauseNsid(singleDetach));
+    EXPECT_EQ(SPDK_NVME_GLOBAL_NS_TAG, NvmfNamespaceBatcher::SelectPauseNsid(twoDetaches));
+
+    FreeEventContext(attach);
+    FreeEventContext(detach1);
+    FreeEventContext(detach2);
+}
+
+TEST(NvmfNamespaceBatcher, PauseBatch_testIfPauseIsRetriedWhenTheSubsystemIsBusy)
+{
+    // Given
+    NiceMock<MockSpdkNvmfCaller>* spdkNvmfCaller = new NiceMock<MockSpdkNvmfCaller>;
+    NiceMock<MockEventFrameworkApi> eventFrameworkApi;
+    ON_CALL(*spdkNvmfCaller, SpdkNvmfSubsystemPause(_, _, _, _)).WillByDefault(Return(-EBUSY));
+
+    // Then
+    EXPECT_CALL(eventFrameworkApi, SendSpdkEvent(_, Matcher<EventFuncFourParams>(_), _, _)).Times(1);
+
+    // When
+    NvmfNamespaceBatcher::PauseBatch(nullptr, nullptr, &eventFrameworkApi, spdkNvmfCaller);
+    delete spdkNvmfCaller;
+}
+
+} // namespace pos
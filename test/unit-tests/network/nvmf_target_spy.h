@@ -63,20 +63,6 @@ public:
         nvmfCallbacks.detachNamespaceAllPauseDone(subsystem, arg, status);
     }
 
-    void
-    AttachNamespaceWithPause(void* arg1, void* arg2,
-        EventFrameworkApi* eventFrameworkApi, SpdkNvmfCaller* spdkNvmfCaller)
-    {
-        _AttachNamespaceWithPause(arg1, arg2, eventFrameworkApi, spdkNvmfCaller);
-    }
-
-    void
-    DetachNamespaceWithPause(void* arg1, void* arg2,
-        EventFrameworkApi* eventFrameworkApi, SpdkNvmfCaller* spdkNvmfCaller)
-    {
-        _DetachNamespaceWithPause(arg1, arg2, eventFrameworkApi, spdkNvmfCaller);
-    }
-
     void
     DetachNamespaceAllWithPause(void* arg1, void* arg2,
         EventFrameworkApi* eventFrameworkApi, SpdkNvmfCaller* spdkNvmfCaller)
@@ -1100,34 +1100,6 @@ TEST(NvmfTargetSpdk, NvmfTargetSpdk_DetachNamespaceAllPauseDone)
     nvmfTarget.DetachNamespaceAllPauseDone(nullptr, nullptr, NvmfCallbackStatus::FAILED);
 }
 
-TEST(NvmfTarget, AttachNamespaceWithPause_Success)
-{
-    NiceMock<MockSpdkNvmfCaller>* mockSpdkNvmfCaller = new NiceMock<MockSpdkNvmfCaller>;
-    NiceMock<MockEventFrameworkApi>* mockEventFrameworkApi = new NiceMock<MockEventFrameworkApi>;
-    void* arg1 = nullptr;
-    void* arg2 = nullptr;
-    NvmfTargetSpy nvmfTarget(nullptr, false, nullptr);
-    EXPECT_CALL(*mockSpdkNvmfCaller, SpdkNvmfSubsystemPause(_, _, _, _)).WillOnce(Return(1));
-    EXPECT_CALL(*mockEventFrameworkApi, SendSpdkEvent(_, Matcher<EventFuncFourParams>(_), _, _)).Times(1);
-
-    nvmfTarget.AttachNamespaceWithPause(arg1, arg2, mockEventFrameworkApi, mockSpdkNvmfCaller);
-    delete mockEventFrameworkApi;
-}
-
-TEST(NvmfTarget, DetachNamespaceWithPause_Success)
-{
-    NiceMock<MockSpdkNvmfCaller>* mockSpdkNvmfCaller = new NiceMock<MockSpdkNvmfCaller>;
-    NiceMock<MockEventFrameworkApi>* mockEventFrameworkApi = new NiceMock<MockEventFrameworkApi>;
-    void* arg1 = nullptr;
-    void* arg2 = nullptr;
-    NvmfTargetSpy nvmfTarget(nullptr, false, nullptr);
-    EXPECT_CALL(*mockSpdkNvmfCaller, SpdkNvmfSubsystemPause(_, _, _, _)).WillOnce(Return(1));
-    EXPECT_CALL(*mockEventFrameworkApi, SendSpdkEvent(_, Matcher<EventFuncFourParams>(_), _, _)).Times(1);
-
-    nvmfTarget.DetachNamespaceWithPause(arg1, arg2, mockEventFrameworkApi, mockSpdkNvmfCaller);
-    delete mockEventFrameworkApi;
-}
-
 TEST(NvmfTarget, DetachNamespaceAllWithPause_Success)
 {
     NiceMock<MockSpdkNvmfCaller>* mockSpdkNvmfCaller = new NiceMock<MockSpdkNvmfCaller>;
@@ -24,6 +24,7 @@ public:
     MOCK_METHOD(void, VolumeMounted, (struct pos_volume_info * info), (override));
     MOCK_METHOD(bool, VolumeUnmounted, (struct pos_volume_info * info, uint64_t time), (override));
     MOCK_METHOD(void, VolumeUpdated, (struct pos_volume_info * info), (override));
+    MOCK_METHOD(void, VolumeResized, (struct pos_volume_info * info), (override));
     MOCK_METHOD(bool, VolumeDetached, (vector<int> & volList, string arrayName, uint64_t time), (override));
 };
 
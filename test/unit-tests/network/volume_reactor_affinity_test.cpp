@@ -0,0 +1,172 @@
+#include "src/network/volume_reactor_affinity.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "src/include/pos_event_id.h"
+#include "test/unit-tests/cpu_affinity/affinity_manager_mock.h"
+#include "test/unit-tests/master_context/config_manager_mock.h"
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+static const uint32_t TEST_CORE_COUNT = 8;
+
+// reactors 0-3 on numa 0, reactors 4-7 on numa 1
+static CpuSetArray
+MakeCpuSetArray(void)
+{
+    CpuSetArray cpuSetArray;
+    for (auto& cpuSet : cpuSetArray)
+    {
+        CPU_ZERO(&cpuSet);
+    }
+    for (uint32_t core = 0; core < TEST_CORE_COUNT; core++)
+    {
+        CPU_SET(core, &cpuSetArray[static_cast<uint32_t>(CoreType::REACTOR)]);
+    }
+    return cpuSetArray;
+}
+
+static void
+SetConfig(MockConfigManager& configManager, bool enable, uint32_t homeReactorCount)
+{
+    ON_CALL(configManager, GetValue).WillByDefault(Invoke(
+        [enable, homeReactorCount](string module, string key, void* value, ConfigType type)
+        {
+            if (key == "volume_reactor_affinity_enable")
+            {
+                *static_cast<bool*>(value) = enable;
+            }
+            else if (key == "volume_home_reactor_count")
+            {
+                *static_cast<uint32_t*>(value) = homeReactorCount;
+            }
+            return EID(SUCCESS);
+        }));
+}
+
+class VolumeReactorAffinityFixture : public ::testing::Test
+{
+public:
+    VolumeReactorAffinityFixture(void)
+    : cpuSetArray(MakeCpuSetArray()),
+      affinityManager(TEST_CORE_COUNT, cpuSetArray)
+    {
+        ON_CALL(affinityManager, GetNumaIdFromCoreId).WillByDefault(Invoke(
+            [](uint32_t coreId) { return coreId / 4; }));
+    }
+
+protected:
+    CpuSetArray cpuSetArray;
+    NiceMock<MockAffinityManager> affinityManager;
+    NiceMock<MockConfigManager> configManager;
+};
+
+TEST_F(VolumeReactorAffinityFixture, VolumeReactorAffinity_testIfDisabledWhenConfigIsMissing)
+{
+    // Given
+    ON_CALL(configManager, GetValue).WillByDefault(Return(-1));
+
+    // When
+    VolumeReactorAffinity affinity(&affinityManager, &configManager);
+
+    // Then
+    EXPECT_FALSE(affinity.IsEnabled());
+}
+
+TEST_F(VolumeReactorAffinityFixture, Assign_testIfHomeReactorsAreOnTheNumaAndBalanced)
+{
+    // Given
+    SetConfig(configManager, true, 2);
+    VolumeReactorAffinity affinity(&affinityManager, &configManager);
+
+    // When
+    cpu_set_t first = affinity.Assign("POSArray", 0, "nqn1", 1);
+    cpu_set_t second = affinity.Assign("POSArray", 1, "nqn2", 1);
+
+    // Then: the second volume gets the reactors the first one did not take
+    EXPECT_TRUE(affinity.IsEnabled());
+    EXPECT_EQ(2, CPU_COUNT(&first));
+    EXPECT_TRUE(CPU_ISSET(4, &first));
+    EXPECT_TRUE(CPU_ISSET(5, &first));
+    EXPECT_EQ(2, CPU_COUNT(&second));
+    EXPECT_TRUE(CPU_ISSET(6, &second));
+    EXPECT_TRUE(CPU_ISSET(7, &second));
+    EXPECT_EQ(0, affinity.GetVolumeCount(0));
+}
+
+TEST_F(VolumeReactorAffinityFixture, Assign_testIfEveryReactorOfTheNumaIsHomeWhenCountIsZero)
+{
+    // Given
+    SetConfig(configManager, true, 0);
+    VolumeReactorAffinity affinity(&affinityManager, &configManager);
+
+    // When
+    cpu_set_t home = affinity.Assign("POSArray", 0, "nqn1", 0);
+
+    // Then
+    EXPECT_EQ(4, CPU_COUNT(&home));
+    for (uint32_t core = 0; core < 4; core++)
+    {
+        EXPECT_TRUE(CPU_ISSET(core, &home));
+    }
+}
+
+TEST_F(VolumeReactorAffinityFixture, Assign_testIfEveryReactorIsCandidateWhenNumaIsUnknown)
+{
+    // Given
+    SetConfig(configManager, true, 0);
+    VolumeReactorAffinity affinity(&affinityManager, &configManager);
+
+    // When
+    cpu_set_t home = affinity.Assign("POSArray", 0, "nqn1", -1);
+
+    // Then
+    EXPECT_EQ(TEST_CORE_COUNT, CPU_COUNT(&home));
+}
+
+TEST_F(VolumeReactorAffinityFixture, Release_testIfTheReactorsOfAReleasedVolumeAreReused)
+{
+    // Given
+    SetConfig(configManager, true, 2);
+    VolumeReactorAffinity affinity(&affinityManager, &configManager);
+    affinity.Assign("POSArray", 0, "nqn1", 0);
+    affinity.Assign("POSArray", 1, "nqn1", 0);
+
+    // When
+    affinity.Release("POSArray", 0);
+    cpu_set_t home = affinity.Assign("POSArray", 2, "nqn2", 0);
+
+    // Then
+    EXPECT_TRUE(CPU_ISSET(0, &home));
+    EXPECT_TRUE(CPU_ISSET(1, &home));
+    EXPECT_EQ(1, affinity.GetVolumeCount(0));
+    EXPECT_EQ(1, affinity.GetVolumeCount(2));
+}
+
+TEST_F(VolumeReactorAffinityFixture, GetSubsystemHomeReactors_testIfTheHomesOfItsVolumesAreMerged)
+{
+    // Given
+    SetConfig(configManager, true, 1);
+    VolumeReactorAffinity affinity(&affinityManager, &configManager);
+    affinity.Assign("POSArray", 0, "nqn1", 0);
+    affinity.Assign("POSArray", 1, "nqn2", 0);
+    affinity.Assign("POSArray", 2, "nqn1", 0);
+
+    // When
+    cpu_set_t reactors = affinity.GetSubsystemHomeReactors("nqn1");
+    cpu_set_t none = affinity.GetSubsystemHomeReactors("nqn3");
+
+    // Then
+    EXPECT_EQ(2, CPU_COUNT(&reactors));
+    EXPECT_TRUE(CPU_ISSET(0, &reactors));
+    EXPECT_TRUE(CPU_ISSET(2, &reactors));
+    EXPECT_EQ(0, CPU_COUNT(&none));
+}
+} // namespace pos
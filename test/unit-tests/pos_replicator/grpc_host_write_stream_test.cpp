@@ -0,0 +1,89 @@
+#include "src/pos_replicator/grpc_host_write_stream.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "src/include/array_config.h"
+
+namespace pos
+{
+static std::string
+Flatten(const grpc::ByteBuffer& buffer, std::vector<grpc::Slice>& slices)
+{
+    buffer.Dump(&slices);
+    std::string message;
+    for (auto& slice : slices)
+    {
+        message.append(reinterpret_cast<const char*>(slice.begin()), slice.size());
+    }
+    return message;
+}
+
+TEST(GrpcHostWriteStream, EncodeBatch_testIfWriteDataIsReferencedInsteadOfCopied)
+{
+    // Given
+    const uint32_t numBlocks = 8;
+    char* data = new char[numBlocks * ArrayConfig::SECTOR_SIZE_BYTE];
+    memset(data, 0xA5, numBlocks * ArrayConfig::SECTOR_SIZE_BYTE);
+    VolumeIoSmartPtr volumeIo(new VolumeIo(data, numBlocks, 0));
+    std::vector<HostWriteStreamEntry> writes{{"a", "v", 16, numBlocks, volumeIo}};
+
+    // When
+    grpc::ByteBuffer buffer;
+    GrpcHostWriteStream::EncodeBatch(7, writes, buffer);
+
+    // Then: batch_id(1) = 7, writes(2) = { array_name, volume_name, rba, num_blocks, data }
+    std::vector<grpc::Slice> slices;
+    std::string message = Flatten(buffer, slices);
+    ASSERT_EQ(2, slices.size());
+    EXPECT_EQ(static_cast<const void*>(data), static_cast<const void*>(slices[1].begin()));
+    std::string header("\x08\x07\x12\x8d\x20\x0a\x01"
+                       "a"
+                       "\x12\x01"
+                       "v"
+                       "\x18\x10\x20\x08\x2a\x80\x20",
+        18);
+    EXPECT_EQ(header, message.substr(0, header.size()));
+    EXPECT_EQ(header.size() + numBlocks * ArrayConfig::SECTOR_SIZE_BYTE, message.size());
+
+    slices.clear();
+    buffer.Clear();
+    volumeIo = nullptr;
+    writes.clear();
+    delete[] data;
+}
+
+TEST(GrpcHostWriteStream, DecodeAck_testIfCumulativeAckIsParsed)
+{
+    // Given: successful = true, batch_id = 3, last_lsn = 300, reason = "ok"
+    std::string message("\x08\x01\x10\x03\x18\xac\x02\x22\x02ok", 11);
+    grpc::Slice slice(message);
+    grpc::ByteBuffer buffer(&slice, 1);
+
+    // When
+    HostWriteAck ack;
+    bool ret = GrpcHostWriteStream::DecodeAck(buffer, ack);
+
+    // Then
+    EXPECT_TRUE(ret);
+    EXPECT_TRUE(ack.successful);
+    EXPECT_EQ(3, ack.batchId);
+    EXPECT_EQ(300, ack.lastLsn);
+}
+
+TEST(GrpcHostWriteStream, DecodeAck_testIfTruncatedMessageIsRejected)
+{
+    // Given: last_lsn varint is cut in the middle
+    std::string message("\x10\x03\x18\xac", 4);
+    grpc::Slice slice(message);
+    grpc::ByteBuffer buffer(&slice, 1);
+
+    // When
+    HostWriteAck ack;
+    bool ret = GrpcHostWriteStream::DecodeAck(buffer, ack);
+
+    // Then
+    EXPECT_FALSE(ret);
+}
+} // namespace pos
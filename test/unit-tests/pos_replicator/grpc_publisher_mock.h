@@ -12,6 +12,8 @@ class MockGrpcPublisher : public GrpcPublisher
 {
 public:
     using GrpcPublisher::GrpcPublisher;
+    MOCK_METHOD(int, CompleteWrite, (std::string arrayName, std::string volumeName, uint64_t rba, uint64_t numBlocks, uint64_t lsn), (override));
+    MOCK_METHOD(int, CompleteRead, (std::string arrayName, std::string volumeName, uint64_t rba, uint64_t numBlocks, uint64_t lsn, void* buffer), (override));
 };
 
 } // namespace pos
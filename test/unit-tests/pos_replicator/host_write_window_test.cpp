@@ -0,0 +1,114 @@
+#include "src/pos_replicator/host_write_window.h"
+
+#include <gtest/gtest.h>
+
+namespace pos
+{
+static HostWriteStreamEntry
+MakeEntry(uint64_t rba)
+{
+    return HostWriteStreamEntry{"array", "volume", rba, 8, nullptr};
+}
+
+TEST(HostWriteWindow, PopBatch_testIfBatchIsCutByMaxBatchCount)
+{
+    // Given
+    HostWriteWindow window(16, 2);
+    for (uint64_t rba = 0; rba < 3; rba++)
+    {
+        window.Enqueue(MakeEntry(rba));
+    }
+
+    // When
+    uint64_t firstId = 0, secondId = 0, thirdId = 0;
+    std::vector<HostWriteStreamEntry> first, second, third;
+    bool ret1 = window.PopBatch(firstId, first);
+    bool ret2 = window.PopBatch(secondId, second);
+    bool ret3 = window.PopBatch(thirdId, third);
+
+    // Then
+    EXPECT_TRUE(ret1);
+    EXPECT_TRUE(ret2);
+    EXPECT_FALSE(ret3);
+    EXPECT_EQ(1, firstId);
+    EXPECT_EQ(2, secondId);
+    ASSERT_EQ(2, first.size());
+    ASSERT_EQ(1, second.size());
+    EXPECT_EQ(2, second[0].rba);
+    EXPECT_EQ(3, window.GetInflightCount());
+}
+
+TEST(HostWriteWindow, PopBatch_testIfNoBatchIsCutWhenTheWindowIsFull)
+{
+    // Given
+    HostWriteWindow window(2, 8);
+    for (uint64_t rba = 0; rba < 3; rba++)
+    {
+        window.Enqueue(MakeEntry(rba));
+    }
+    uint64_t batchId = 0;
+    std::vector<HostWriteStreamEntry> writes;
+    ASSERT_TRUE(window.PopBatch(batchId, writes));
+
+    // When
+    std::vector<HostWriteStreamEntry> more;
+    bool ret = window.PopBatch(batchId, more);
+
+    // Then
+    EXPECT_FALSE(ret);
+    EXPECT_EQ(2, writes.size());
+    EXPECT_EQ(2, window.GetInflightCount());
+    EXPECT_EQ(1, window.GetQueuedCount());
+}
+
+TEST(HostWriteWindow, Acknowledge_testIfEveryBatchUpToTheAckedOneGetsConsecutiveLsns)
+{
+    // Given
+    HostWriteWindow window(16, 2);
+    for (uint64_t rba = 0; rba < 5; rba++)
+    {
+        window.Enqueue(MakeEntry(rba));
+    }
+    uint64_t batchId = 0;
+    std::vector<HostWriteStreamEntry> writes;
+    while (window.PopBatch(batchId, writes))
+    {
+    }
+
+    // When: batch 2 is acked, its last write got lsn 103
+    std::vector<AckedHostWrite> acked;
+    uint32_t count = window.Acknowledge(2, 103, acked);
+
+    // Then
+    EXPECT_EQ(4, count);
+    ASSERT_EQ(4, acked.size());
+    for (uint32_t index = 0; index < acked.size(); index++)
+    {
+        EXPECT_EQ(100 + index, acked[index].first);
+        EXPECT_EQ(index, acked[index].second.rba);
+    }
+    EXPECT_EQ(1, window.GetInflightCount());
+}
+
+TEST(HostWriteWindow, Drain_testIfInflightWritesComeBeforeQueuedOnes)
+{
+    // Given
+    HostWriteWindow window(1, 1);
+    window.Enqueue(MakeEntry(0));
+    window.Enqueue(MakeEntry(1));
+    uint64_t batchId = 0;
+    std::vector<HostWriteStreamEntry> writes;
+    ASSERT_TRUE(window.PopBatch(batchId, writes));
+
+    // When
+    std::vector<HostWriteStreamEntry> remaining;
+    window.Drain(remaining);
+
+    // Then
+    ASSERT_EQ(2, remaining.size());
+    EXPECT_EQ(0, remaining[0].rba);
+    EXPECT_EQ(1, remaining[1].rba);
+    EXPECT_EQ(0, window.GetInflightCount());
+    EXPECT_EQ(0, window.GetQueuedCount());
+}
+} // namespace pos
@@ -35,8 +35,10 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <future>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "mock_grpc/mock_replicator_client.h"
 #include "mock_grpc/mock_replicator_server.h"
@@ -67,6 +69,7 @@ class PosReplicatorManagerTestFixture : public ::testing::Test
 protected:
     void SetUp(void) override;
     void TearDown(void) override;
+    int _SubmitReplicatedIo(IO_TYPE ioType);
 
     NiceMock<MockAIO>* aio;
     NiceMock<MockConfigManager>* configManager;
@@ -74,6 +77,7 @@ protected:
     NiceMock<MockGrpcPublisher>* grpcPublisher;
     NiceMock<MockGrpcSubscriber>* grpcSubscriber;
     NiceMock<MockTelemetryPublisher> tp;
+    std::vector<VolumeIoSmartPtr> submittedIos;
 };
 
 void
@@ -89,6 +93,25 @@ PosReplicatorManagerTestFixture::SetUp(void)
     grpcPublisher = new NiceMock<MockGrpcPublisher>(nullptr, configManager);
     grpcSubscriber = new NiceMock<MockGrpcSubscriber>(posReplicatorManager, configManager);
     posReplicatorManager->Init(grpcPublisher, grpcSubscriber, configManager);
+
+    ON_CALL(*aio, CreatePosReplicatorVolumeIo).WillByDefault([&](pos_io& posIo, uint64_t lsn)
+    {
+        VolumeIoSmartPtr volumeIo(new NiceMock<MockVolumeIo>(nullptr, 8, posIo.array_id));
+        volumeIo->dir = (posIo.ioType == IO_TYPE::WRITE) ? UbioDir::Write : UbioDir::Read;
+        submittedIos.push_back(volumeIo);
+        return volumeIo;
+    });
+}
+
+int
+PosReplicatorManagerTestFixture::_SubmitReplicatedIo(IO_TYPE ioType)
+{
+    int arrayId = 0;
+    int volumeId = 0;
+    uint64_t rba = 0;
+    uint64_t numChunks = 0;
+    uint64_t lsn = 0;
+    return posReplicatorManager->HAIOSubmission(ioType, arrayId, volumeId, rba, numChunks, nullptr, lsn);
 }
 
 void
@@ -98,6 +121,7 @@ PosReplicatorManagerTestFixture::TearDown(void)
     delete configManager;
     delete grpcPublisher;
     delete grpcSubscriber;
+    submittedIos.clear();
     posReplicatorManager->Dispose();
     delete posReplicatorManager;
 }
@@ -216,4 +240,73 @@ TEST_F(PosReplicatorManagerTestFixture, DISABLED_ConvertNameToId_)
     // Then
     EXPECT_NE(EID(SUCCESS), ret);
 }
+TEST_F(PosReplicatorManagerTestFixture, Promote_testIfPromotionDoesNotWaitForReplicatedReads)
+{
+    // Given: a secondary with a replicated read in flight
+    posReplicatorManager->SetVolumeCopyStatus(ReplicatorStatus::VOLUMECOPY_SecondaryLiveReplication);
+    EXPECT_EQ(EID(SUCCESS), _SubmitReplicatedIo(IO_TYPE::READ));
+
+    // When
+    int ret = posReplicatorManager->Promote(0);
+
+    // Then
+    EXPECT_EQ(EID(SUCCESS), ret);
+}
+
+TEST_F(PosReplicatorManagerTestFixture, Promote_testIfPromotionTimesOutAndLiftsFenceWhenReplicatedWriteIsStuck)
+{
+    // Given: a secondary with a replicated write that does not complete
+    posReplicatorManager->SetVolumeCopyStatus(ReplicatorStatus::VOLUMECOPY_SecondaryLiveReplication);
+    EXPECT_EQ(EID(SUCCESS), _SubmitReplicatedIo(IO_TYPE::WRITE));
+
+    // When
+    int ret = posReplicatorManager->Promote(0);
+
+    // Then: the node stays a secondary and keeps accepting replicated writes
+    EXPECT_EQ(EID(HA_PROMOTION_TIMEOUT), ret);
+    EXPECT_EQ(EID(SUCCESS), _SubmitReplicatedIo(IO_TYPE::WRITE));
+}
+
+TEST_F(PosReplicatorManagerTestFixture, Promote_testIfNewReplicatedWritesAreFencedWhileDraining)
+{
+    // Given: a secondary with a replicated write in flight
+    posReplicatorManager->SetVolumeCopyStatus(ReplicatorStatus::VOLUMECOPY_SecondaryLiveReplication);
+    EXPECT_EQ(EID(SUCCESS), _SubmitReplicatedIo(IO_TYPE::WRITE));
+
+    // When: the promotion starts, new replicated writes are refused from then on
+    std::future<int> promotion = std::async(std::launch::async, [&] { return posReplicatorManager->Promote(); });
+    int ret = EID(SUCCESS);
+    while (ret == EID(SUCCESS))
+    {
+        ret = _SubmitReplicatedIo(IO_TYPE::WRITE);
+    }
+    EXPECT_EQ(EID(HA_REPLICATED_WRITE_FENCED), ret);
+    EXPECT_EQ(EID(SUCCESS), _SubmitReplicatedIo(IO_TYPE::READ));
+
+    // Then: the promotion ends once the writes accepted before the fence complete
+    EXPECT_CALL(*grpcPublisher, CompleteWrite).Times(AtLeast(1));
+    EXPECT_CALL(*grpcPublisher, CompleteRead).Times(0);
+    for (auto& volumeIo : submittedIos)
+    {
+        if (volumeIo->dir == UbioDir::Write)
+        {
+            posReplicatorManager->HAIOCompletion(0, volumeIo, 0, 0);
+        }
+    }
+    EXPECT_EQ(EID(SUCCESS), promotion.get());
+}
+
+TEST_F(PosReplicatorManagerTestFixture, SetVolumeCopyStatus_testIfFenceIsLiftedWhenNodeBecomesSecondaryAgain)
+{
+    // Given: a promoted node that refuses replicated writes
+    posReplicatorManager->SetVolumeCopyStatus(ReplicatorStatus::VOLUMECOPY_SecondaryLiveReplication);
+    EXPECT_EQ(EID(SUCCESS), posReplicatorManager->Promote(0));
+    EXPECT_EQ(EID(HA_REPLICATED_WRITE_FENCED), _SubmitReplicatedIo(IO_TYPE::WRITE));
+
+    // When
+    posReplicatorManager->SetVolumeCopyStatus(ReplicatorStatus::VOLUMECOPY_SecondaryVolumeCopy);
+
+    // Then
+    EXPECT_EQ(EID(SUCCESS), _SubmitReplicatedIo(IO_TYPE::WRITE));
+}
 } // namespace pos
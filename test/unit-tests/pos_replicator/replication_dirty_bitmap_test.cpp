@@ -0,0 +1,158 @@
+#include "src/pos_replicator/replication_dirty_bitmap.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "test/unit-tests/meta_file_intf/meta_file_intf_mock.h"
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+static const uint64_t GB = 1024ULL * 1024 * 1024;
+static const uint64_t SECTORS_PER_MB = 2048;
+
+TEST(ReplicationDirtyBitmap, SetVolumeSize_testIfRegionSizeKeepsTheRegionCountWithinTheLimit)
+{
+    // Given
+    ReplicationDirtyBitmap bitmap(0, nullptr, 100);
+
+    // When
+    bitmap.SetVolumeSize(0, 10 * GB);
+    bitmap.SetVolumeSize(1, 64 * GB);
+    bitmap.SetVolumeSize(2, 64 * GB + 1);
+
+    // Then
+    EXPECT_EQ(1024 * 1024, bitmap.GetRegionSize(0));
+    EXPECT_EQ(1024 * 1024, bitmap.GetRegionSize(1));
+    EXPECT_EQ(2 * 1024 * 1024, bitmap.GetRegionSize(2));
+}
+
+TEST(ReplicationDirtyBitmap, Acknowledge_testIfRegionIsCleanOnlyWhenEveryPendingWriteIsAcknowledged)
+{
+    // Given
+    ReplicationDirtyBitmap bitmap(0, nullptr, 100);
+    bitmap.SetVolumeSize(0, GB);
+    bitmap.MarkDirty(0, 0, 8, true);
+    bitmap.MarkDirty(0, 8, 8, true);
+
+    // When
+    bitmap.Acknowledge(0, 0, 8);
+    uint32_t countAfterFirstAck = bitmap.GetDirtyRegionCount(0);
+    bitmap.Acknowledge(0, 8, 8);
+
+    // Then
+    EXPECT_EQ(1, countAfterFirstAck);
+    EXPECT_EQ(0, bitmap.GetDirtyRegionCount(0));
+}
+
+TEST(ReplicationDirtyBitmap, Acknowledge_testIfWriteWithoutReplicationKeepsTheRegionDirty)
+{
+    // Given
+    ReplicationDirtyBitmap bitmap(0, nullptr, 100);
+    bitmap.SetVolumeSize(0, GB);
+    bitmap.MarkDirty(0, 0, 8, false);
+    bitmap.MarkDirty(0, 16, 8, true);
+
+    // When
+    bitmap.Acknowledge(0, 16, 8);
+    uint32_t countBeforeClear = bitmap.GetDirtyRegionCount(0);
+    bitmap.ClearVolume(0);
+
+    // Then
+    EXPECT_EQ(1, countBeforeClear);
+    EXPECT_EQ(0, bitmap.GetDirtyRegionCount(0));
+}
+
+TEST(ReplicationDirtyBitmap, GetDirtyExtents_testIfAdjacentRegionsAreMergedAndClampedToTheVolumeSize)
+{
+    // Given: a 3.5MB volume, so its last region is only half used
+    ReplicationDirtyBitmap bitmap(0, nullptr, 100);
+    uint64_t volumeSize = 3 * 1024 * 1024 + 512 * 1024;
+    bitmap.SetVolumeSize(0, volumeSize);
+    bitmap.MarkDirty(0, 0, 8, false);
+    bitmap.MarkDirty(0, SECTORS_PER_MB - 8, 16, false);
+    bitmap.MarkDirty(0, 3 * SECTORS_PER_MB, 8, false);
+
+    // When
+    std::vector<DirtyExtent> extents;
+    bitmap.GetDirtyExtents(0, extents);
+
+    // Then
+    ASSERT_EQ(2, extents.size());
+    EXPECT_EQ(0, extents[0].first);
+    EXPECT_EQ(2 * SECTORS_PER_MB, extents[0].second);
+    EXPECT_EQ(3 * SECTORS_PER_MB, extents[1].first);
+    EXPECT_EQ(SECTORS_PER_MB / 2, extents[1].second);
+}
+
+TEST(ReplicationDirtyBitmap, SetVolumeSize_testIfDirtyRegionsSurviveTheVolumeGrowth)
+{
+    // Given
+    ReplicationDirtyBitmap bitmap(0, nullptr, 100);
+    bitmap.SetVolumeSize(0, GB);
+    bitmap.MarkDirty(0, 2 * SECTORS_PER_MB, 8, false);
+    bitmap.MarkDirty(0, 3 * SECTORS_PER_MB, 8, false);
+
+    // When
+    bitmap.SetVolumeSize(0, 128 * GB);
+
+    // Then: 2MB and 3MB fall into the same 2MB region
+    std::vector<DirtyExtent> extents;
+    bitmap.GetDirtyExtents(0, extents);
+    ASSERT_EQ(1, extents.size());
+    EXPECT_EQ(2 * SECTORS_PER_MB, extents[0].first);
+    EXPECT_EQ(2 * SECTORS_PER_MB, extents[0].second);
+}
+
+static NiceMock<MockMetaFileIntf>*
+MakeFile(std::vector<char>& stored)
+{
+    NiceMock<MockMetaFileIntf>* file = new NiceMock<MockMetaFileIntf>("ReplicationDirtyBitmap.bin", 0, MetaFileType::General);
+    ON_CALL(*file, DoesFileExist).WillByDefault(Return(true));
+    ON_CALL(*file, Open).WillByDefault(Return(0));
+    ON_CALL(*file, IsOpened).WillByDefault(Return(true));
+    ON_CALL(*file, IssueIO).WillByDefault([&stored](MetaFsIoOpcode opType, uint64_t fileOffset, uint64_t length, char* buffer) {
+        if (opType == MetaFsIoOpcode::Read)
+        {
+            memcpy(buffer, stored.data() + fileOffset, length);
+        }
+        else
+        {
+            memcpy(stored.data() + fileOffset, buffer, length);
+        }
+        return 0;
+    });
+    return file;
+}
+
+TEST(ReplicationDirtyBitmap, Init_testIfStoredRegionsAreLoadedAsDirty)
+{
+    // Given: volume 3 is stored with two dirty regions
+    std::vector<char> stored(ReplicationDirtyBitmap::HEADER_SIZE + 256 * ReplicationDirtyBitmap::SLOT_SIZE, 0);
+    {
+        ReplicationDirtyBitmap writer(0, MakeFile(stored), 60000);
+        ASSERT_EQ(0, writer.Init());
+        writer.SetVolumeSize(3, GB);
+        writer.MarkDirty(3, 5 * SECTORS_PER_MB, 8, true);
+        writer.MarkDirty(3, 7 * SECTORS_PER_MB, 8, false);
+        writer.Dispose();
+    }
+    ReplicationDirtyBitmap bitmap(0, MakeFile(stored), 60000);
+
+    // When: the ack of a write before the reload does not clean the region
+    int ret = bitmap.Init();
+    bitmap.MarkDirty(3, 5 * SECTORS_PER_MB, 8, true);
+    bitmap.Acknowledge(3, 5 * SECTORS_PER_MB, 8);
+
+    // Then
+    EXPECT_EQ(0, ret);
+    EXPECT_EQ(2, bitmap.GetDirtyRegionCount(3));
+    EXPECT_EQ(0, bitmap.GetDirtyRegionCount(0));
+    bitmap.Dispose();
+}
+} // namespace pos
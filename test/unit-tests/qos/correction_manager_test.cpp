@@ -5,10 +5,13 @@
 
 #include "test/unit-tests/qos/qos_context_mock.h"
 #include "test/unit-tests/qos/qos_manager_mock.h"
+#include "test/unit-tests/telemetry/telemetry_client/telemetry_publisher_mock.h"
 
 using namespace std;
 using ::testing::_;
+using ::testing::Invoke;
 using ::testing::NiceMock;
+using ::testing::Return;
 using ::testing::ReturnRef;
 
 namespace pos
@@ -233,4 +236,33 @@ TEST(QosCorrectionManager, ResetTest)
     qosCorrectionManager.Reset();
 }
 
+TEST(QosCorrectionManager, Execute_testIfCycleIsPublishedOnlyWhileTelemetryIsRunning)
+{
+    NiceMock<MockQosContext> mockQoscontext;
+    NiceMock<MockQosManager> mockQosManager;
+    QosUserPolicy userPolicy;
+    ON_CALL(mockQoscontext, GetQosUserPolicy()).WillByDefault(ReturnRef(userPolicy));
+    QosParameters parameters;
+    ON_CALL(mockQoscontext, GetQosParameters()).WillByDefault(ReturnRef(parameters));
+    // Owned and deleted by the correction manager
+    NiceMock<MockTelemetryPublisher>* publisher = new NiceMock<MockTelemetryPublisher>;
+    QosCorrectionManager qosCorrectionManager(&mockQoscontext, &mockQosManager, nullptr, publisher);
+
+    EXPECT_CALL(*publisher, IsRunning).WillOnce(Return(false)).WillOnce(Return(true));
+    size_t publishedCount = 0;
+    EXPECT_CALL(*publisher, PublishMetricList).WillOnce(Invoke(
+        [&publishedCount](POSMetricVector* metricList)
+        {
+            publishedCount = metricList->size();
+            delete metricList;
+            return 0;
+        }));
+
+    qosCorrectionManager.Execute();
+    qosCorrectionManager.Execute();
+
+    // Then : without mounted volumes, a weight and a correction for each backend event
+    EXPECT_EQ(static_cast<size_t>(2 * BackendEvent_Count), publishedCount);
+}
+
 } // namespace pos
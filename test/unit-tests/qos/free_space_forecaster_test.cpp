@@ -0,0 +1,53 @@
+#include "src/qos/free_space_forecaster.h"
+
+#include <gtest/gtest.h>
+
+namespace pos
+{
+TEST(FreeSpaceForecaster, Evaluate_testIfBoostRisesStepByStepAsFreeSpaceRunsOut)
+{
+    // given: 10s horizon, one sample per second
+    FreeSpaceForecaster forecaster(10000);
+    forecaster.Update(0, 100, 5, 1000);
+    EXPECT_EQ(forecaster.GetTimeToUrgentMs(0), static_cast<uint64_t>(FreeSpaceForecaster::NEVER));
+    EXPECT_EQ(forecaster.Evaluate(), 0u);
+
+    // when: a steady consumption with the urgent threshold close
+    uint32_t level = 0;
+    for (uint32_t free = 99; free > 10; free--)
+    {
+        forecaster.Update(0, free, 5, 1000);
+        uint32_t prevLevel = level;
+        level = forecaster.Evaluate();
+        // then: the level never jumps by more than one step
+        EXPECT_LE(level, prevLevel + 1);
+    }
+    EXPECT_GT(level, 0u);
+    EXPECT_LT(forecaster.GetTimeToUrgentMs(0), 10000u);
+}
+
+TEST(FreeSpaceForecaster, Evaluate_testIfBoostDropsOnceGcReclaims)
+{
+    // given: the array is at its urgent threshold
+    FreeSpaceForecaster forecaster(10000);
+    forecaster.Update(1, 6, 5, 1000);
+    forecaster.Update(1, 5, 5, 1000);
+    EXPECT_EQ(forecaster.GetTimeToUrgentMs(1), 0u);
+    for (uint32_t count = 0; count < FreeSpaceForecaster::MAX_BOOST_LEVEL; count++)
+    {
+        forecaster.Evaluate();
+    }
+    EXPECT_EQ(forecaster.GetBoostLevel(), static_cast<uint32_t>(FreeSpaceForecaster::MAX_BOOST_LEVEL));
+
+    // when: gc reclaims faster than the array consumes
+    forecaster.Update(1, 50, 5, 1000);
+    for (uint32_t count = 0; count < FreeSpaceForecaster::MAX_BOOST_LEVEL; count++)
+    {
+        forecaster.Evaluate();
+    }
+
+    // then
+    EXPECT_EQ(forecaster.GetTimeToUrgentMs(1), static_cast<uint64_t>(FreeSpaceForecaster::NEVER));
+    EXPECT_EQ(forecaster.GetBoostLevel(), 0u);
+}
+} // namespace pos
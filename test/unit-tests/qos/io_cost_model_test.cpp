@@ -0,0 +1,53 @@
+#include "src/qos/io_cost_model.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "test/unit-tests/master_context/config_manager_mock.h"
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+TEST(IoCostModel, GetCost_testIfEveryIoCostsOneWhenDisabled)
+{
+    // given
+    NiceMock<MockConfigManager> configManager;
+    ON_CALL(configManager, GetValue(_, _, _, _)).WillByDefault(Return(-1));
+    IoCostModel model(&configManager);
+
+    // then
+    EXPECT_FALSE(model.IsEnabled());
+    EXPECT_EQ(model.GetCost(0, UbioDir::Write, 1, 512), 1u);
+    EXPECT_EQ(model.GetCost(0, UbioDir::Read, 0, 128 * 1024), 1u);
+}
+
+TEST(IoCostModel, GetCost_testIfCostFollowsTypeSizeAndAlignment)
+{
+    // given: enabled with default costs
+    NiceMock<MockConfigManager> configManager;
+    ON_CALL(configManager, GetValue(_, _, _, _)).WillByDefault([](string module, string key, void* value, ConfigType type) {
+        if (key == "io_cost_model_enable")
+        {
+            *static_cast<bool*>(value) = true;
+            return 0;
+        }
+        return -1;
+    });
+    IoCostModel model(&configManager);
+    EXPECT_TRUE(model.IsEnabled());
+
+    // when, then: random 4KB write pays the random write cost
+    EXPECT_EQ(model.GetCost(1, UbioDir::Write, 800, 4096), IoCostModel::DEFAULT_RANDOM_WRITE_COST);
+    // the next 4KB write continues the stream
+    EXPECT_EQ(model.GetCost(1, UbioDir::Write, 808, 4096), IoCostModel::DEFAULT_SEQUENTIAL_WRITE_COST);
+    // 512B random write also pays the read modify write
+    EXPECT_EQ(model.GetCost(1, UbioDir::Write, 3, 512),
+        IoCostModel::DEFAULT_RANDOM_WRITE_COST + IoCostModel::DEFAULT_UNALIGNED_WRITE_COST);
+    // 16KB random read: first block random, following blocks sequential
+    EXPECT_EQ(model.GetCost(1, UbioDir::Read, 8000, 16384),
+        IoCostModel::DEFAULT_RANDOM_READ_COST + 3 * IoCostModel::DEFAULT_SEQUENTIAL_READ_COST);
+}
+} // namespace pos
@@ -0,0 +1,51 @@
+#include "src/qos/latency_slo_controller.h"
+
+#include <gtest/gtest.h>
+
+namespace pos
+{
+TEST(LatencySloController, Evaluate_testIfLevelIsRaisedOnlyWhileTargetIsMissed)
+{
+    // given
+    LatencySloController controller;
+    controller.SetTarget(0, 1, 500);
+
+    // when: p99 is far above the target
+    for (uint32_t count = 0; count < 100; count++)
+    {
+        controller.Record(0, 1, 2000);
+    }
+    uint32_t level = controller.Evaluate();
+
+    // then
+    EXPECT_EQ(1u, level);
+
+    // when: p99 is back below the target
+    for (uint32_t count = 0; count < 100; count++)
+    {
+        controller.Record(0, 1, 100);
+    }
+    level = controller.Evaluate();
+
+    // then
+    EXPECT_EQ(0u, level);
+}
+
+TEST(LatencySloController, Evaluate_testIfVolumesWithoutTargetOrSamplesAreIgnored)
+{
+    // given
+    LatencySloController controller;
+    controller.SetTarget(0, 1, 500);
+
+    // when: a volume without target is slow and the target volume has too few reads
+    for (uint32_t count = 0; count < 100; count++)
+    {
+        controller.Record(0, 2, 5000);
+    }
+    controller.Record(0, 1, 5000);
+
+    // then
+    EXPECT_EQ(0u, controller.Evaluate());
+    EXPECT_EQ(0u, controller.GetTarget(0, 2));
+}
+} // namespace pos
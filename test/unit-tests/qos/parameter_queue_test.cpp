@@ -2,6 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <thread>
+
 #include "src/qos/qos_common.h"
 
 namespace pos
@@ -36,6 +39,86 @@ TEST(ParameterQueue, Check_Enqueue_Dequeue_Params)
         ASSERT_EQ(param.pad[i], enqueued.pad[i]);
 }
 
+TEST(ParameterQueue, DequeueParameter_NonBlockingDefersEntriesOfBusyQueue)
+{
+    // Given: a producer enqueueing while the reactor-polled control loop dequeues
+    uint32_t id1 = 0;
+    uint32_t id2 = 1;
+    const uint64_t entryCount = 10000;
+    ParameterQueue parameterQueue;
+    std::thread producer([&] {
+        for (uint64_t entry = 0; entry < entryCount; entry++)
+        {
+            bw_iops_parameter param;
+            param.currentBW = entry;
+            param.currentIOs = 1;
+            param.valid = 1;
+            parameterQueue.EnqueueParameter(id1, id2, param);
+        }
+    });
+
+    // When: it dequeues without waiting for the queue lock
+    uint64_t received = 0;
+    while (received < entryCount)
+    {
+        bw_iops_parameter dequeued = parameterQueue.DequeueParameter(id1, id2, true);
+        if (M_INVALID_ENTRY == dequeued.valid)
+        {
+            continue;
+        }
+        // Then: a busy queue is only read later, no entry is lost or reordered
+        ASSERT_EQ(received, dequeued.currentBW);
+        received++;
+    }
+    producer.join();
+    ASSERT_EQ(M_INVALID_ENTRY, parameterQueue.DequeueParameter(id1, id2, true).valid);
+}
+
+TEST(ParameterQueue, DequeueParameter_BlockingNeverSkipsBusyQueue)
+{
+    // Given: queued parameters and a producer that keeps the queue lock busy
+    uint32_t id1 = 0;
+    uint32_t id2 = 1;
+    const uint32_t queuedCount = 10000;
+    bw_iops_parameter param;
+    param.currentBW = 1;
+    param.currentIOs = 1;
+    param.valid = 1;
+    ParameterQueue parameterQueue;
+    for (uint32_t entry = 0; entry < queuedCount; entry++)
+    {
+        parameterQueue.EnqueueParameter(id1, id2, param);
+    }
+    std::atomic<bool> started(false);
+    std::atomic<bool> stop(false);
+    std::thread producer([&] {
+        bw_iops_parameter busy = param;
+        while (false == stop)
+        {
+            parameterQueue.EnqueueParameter(id1, id2, busy);
+            started = true;
+        }
+    });
+    while (false == started)
+    {
+    }
+
+    // When: the dedicated qos thread dequeues
+    uint32_t invalidCount = 0;
+    for (uint32_t entry = 0; entry < queuedCount; entry++)
+    {
+        if (M_INVALID_ENTRY == parameterQueue.DequeueParameter(id1, id2).valid)
+        {
+            invalidCount++;
+        }
+    }
+    stop = true;
+    producer.join();
+
+    // Then: it waits for the lock, so every dequeue of a non-empty queue returns an entry
+    ASSERT_EQ(0, invalidCount);
+}
+
 TEST(ParameterQueue, ClearParameters_Test)
 {
     ParameterQueue parameterQueue;
@@ -13,8 +13,10 @@ class MockQosManager : public QosManager
 public:
     using QosManager::QosManager;
     MOCK_METHOD(int64_t, GetEventWeightWRR, (BackendEvent event), (override));
+    MOCK_METHOD(int64_t, GetDefaultEventWeightWRR, (BackendEvent event), (override));
     MOCK_METHOD(int64_t, GetNoContentionCycles, (), ());
     MOCK_METHOD(bool, IsFeQosEnabled, (), (override));
+    MOCK_METHOD(qos_backend_policy, GetBackendPolicy, (BackendEvent event), (override));
     MOCK_METHOD(void, _Finalize, (), (override));
     MOCK_METHOD(void, DecreasePendingBackendEvents, (BackendEvent event), (override));
     MOCK_METHOD(void, IncreasePendingBackendEvents, (BackendEvent event), (override));
@@ -24,5 +26,8 @@ public:
         SubmissionNotifier* submissionNotifier, uint32_t id, UbioSmartPtr ubio), (override));
     MOCK_METHOD(bw_iops_parameter, DequeueEventParams, (uint32_t workerId, BackendEvent eventId), (override));
     MOCK_METHOD(bool, IsMinimumPolicyInEffectInSystem, (), (override));
+    MOCK_METHOD(void, RecordHostLatency, (uint64_t latencyUs), (override));
+    MOCK_METHOD(void, RecordVolumeReadLatency, (uint32_t arrayId, uint32_t volId, uint64_t latencyUs), (override));
+    MOCK_METHOD(std::vector<uint64_t>, CollectHostLatency, (), (override));
 };
 } // namespace pos
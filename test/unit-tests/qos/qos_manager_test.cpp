@@ -11,7 +11,9 @@
 #include <unistd.h>
 
 using ::testing::_;
+using ::testing::Matcher;
 using ::testing::NiceMock;
+using ::testing::Return;
 namespace pos
 {
 ACTION_P(SetArg2ToBoolAndReturn0, boolValue)
@@ -341,4 +343,65 @@ TEST(QosManager, SetMinimumVolume)
     delete mockConfigManager;
 }
 
+TEST(QosManager, IsControlInPoller_DefaultsToQosThread)
+{
+    // Given: a config without fe_qos.control_in_poller
+    NiceMock<MockConfigManager>* mockConfigManager = CreateQosMockConfigManager(true);
+    NiceMock<MockSpdkPosNvmfCaller>* mockSpdkPosNvmfCaller =
+        new NiceMock<MockSpdkPosNvmfCaller>;
+    NiceMock<MockSpdkEnvCaller>* mockSpdkEnvCaller =
+        new NiceMock<MockSpdkEnvCaller>();
+    NiceMock<MockEventFrameworkApi> mockEventFrameworkApi;
+
+    // When
+    QosManager qosManager(mockSpdkEnvCaller, mockSpdkPosNvmfCaller, mockConfigManager, &mockEventFrameworkApi);
+
+    // Then: the control loop stays on the dedicated qos thread
+    ASSERT_FALSE(qosManager.IsControlInPoller());
+    delete mockConfigManager;
+}
+
+TEST(QosManager, Initialize_ControlInPoller_RegistersControlPoller)
+{
+    // Given: fe_qos with the control loop in a reactor poller
+    NiceMock<MockConfigManager>* mockConfigManager = CreateQosMockConfigManager(true);
+    ON_CALL(*mockConfigManager, GetValue("fe_qos", "control_in_poller", _, _)).WillByDefault(SetArg2ToBoolAndReturn0(true));
+    NiceMock<MockSpdkPosNvmfCaller>* mockSpdkPosNvmfCaller =
+        new NiceMock<MockSpdkPosNvmfCaller>;
+    NiceMock<MockSpdkEnvCaller>* mockSpdkEnvCaller =
+        new NiceMock<MockSpdkEnvCaller>();
+    NiceMock<MockEventFrameworkApi> mockEventFrameworkApi;
+    QosManager qosManager(mockSpdkEnvCaller, mockSpdkPosNvmfCaller, mockConfigManager, &mockEventFrameworkApi);
+    qosManager.InitializeSpdkManager();
+    ASSERT_TRUE(qosManager.IsControlInPoller());
+
+    // Then: the control poller is sent to a reactor instead of starting the qos thread
+    EXPECT_CALL(mockEventFrameworkApi, SendSpdkEvent(_, Matcher<EventFuncTwoParams>(QosSpdkManager::ControlPollerRegister), _, _))
+        .WillOnce(Return(false));
+
+    // When
+    qosManager.Initialize();
+    delete mockConfigManager;
+}
+
+TEST(QosManager, DequeueEventParams_ControlInPoller_ReturnsWithoutEntry)
+{
+    // Given: the control loop in a reactor poller and no parameter from the event workers
+    NiceMock<MockConfigManager>* mockConfigManager = CreateQosMockConfigManager(false);
+    ON_CALL(*mockConfigManager, GetValue("fe_qos", "control_in_poller", _, _)).WillByDefault(SetArg2ToBoolAndReturn0(true));
+    NiceMock<MockSpdkPosNvmfCaller>* mockSpdkPosNvmfCaller =
+        new NiceMock<MockSpdkPosNvmfCaller>;
+    NiceMock<MockSpdkEnvCaller>* mockSpdkEnvCaller =
+        new NiceMock<MockSpdkEnvCaller>();
+    NiceMock<MockEventFrameworkApi> mockEventFrameworkApi;
+    QosManager qosManager(mockSpdkEnvCaller, mockSpdkPosNvmfCaller, mockConfigManager, &mockEventFrameworkApi);
+
+    // When
+    bw_iops_parameter params = qosManager.DequeueEventParams(1, BackendEvent_GC);
+
+    // Then
+    ASSERT_EQ(M_INVALID_ENTRY, params.valid);
+    delete mockConfigManager;
+}
+
 } // namespace pos
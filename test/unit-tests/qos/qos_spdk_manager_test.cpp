@@ -9,7 +9,9 @@
 
 using namespace std;
 using ::testing::_;
+using ::testing::Matcher;
 using ::testing::NiceMock;
+using ::testing::Return;
 
 namespace pos
 {
@@ -128,4 +130,58 @@ TEST(QosSpdkManager, IsFeQosEnabled_Test)
     bool recdFeQos = qosSpdkManager.IsFeQosEnabled();
     ASSERT_EQ(feQos, recdFeQos);
 }
+
+TEST(QosSpdkManager, RegisterControlPoller_SendFailed)
+{
+    // Given
+    NiceMock<MockQosContext> mockQoscontext;
+    NiceMock<MockEventFrameworkApi> mockEventFrameworkApi;
+    bool feQos = true;
+    QosSpdkManager qosSpdkManager(&mockQoscontext, feQos, &mockEventFrameworkApi);
+    uint32_t firstReactor = 3;
+    ON_CALL(mockEventFrameworkApi, GetFirstReactor()).WillByDefault(Return(firstReactor));
+
+    // Then: the registration goes to the first reactor, and a refused event is not waited for
+    EXPECT_CALL(mockEventFrameworkApi, SendSpdkEvent(firstReactor, Matcher<EventFuncTwoParams>(QosSpdkManager::ControlPollerRegister), &qosSpdkManager, _))
+        .WillOnce(Return(false));
+
+    // When
+    qosSpdkManager.RegisterControlPoller(1000);
+}
+
+TEST(QosSpdkManager, RegisterControlPoller_WaitsForReactor)
+{
+    // Given: a reactor that completes the registration
+    NiceMock<MockQosContext> mockQoscontext;
+    NiceMock<MockEventFrameworkApi> mockEventFrameworkApi;
+    bool feQos = true;
+    QosSpdkManager qosSpdkManager(&mockQoscontext, feQos, &mockEventFrameworkApi);
+    EXPECT_CALL(mockEventFrameworkApi, SendSpdkEvent(_, Matcher<EventFuncTwoParams>(QosSpdkManager::ControlPollerRegister), _, _))
+        .WillOnce([](uint32_t core, EventFuncTwoParams func, void* arg1, void* arg2)
+        {
+            QosSpdkManager::controlPollerDone = true;
+            return true;
+        });
+
+    // When
+    qosSpdkManager.RegisterControlPoller(1000);
+
+    // Then
+    ASSERT_TRUE(QosSpdkManager::controlPollerDone.load());
+}
+
+TEST(QosSpdkManager, UnregisterControlPoller_NotRegistered)
+{
+    // Given: the control loop runs on the qos thread, so no control poller exists
+    NiceMock<MockQosContext> mockQoscontext;
+    NiceMock<MockEventFrameworkApi> mockEventFrameworkApi;
+    bool feQos = true;
+    QosSpdkManager qosSpdkManager(&mockQoscontext, feQos, &mockEventFrameworkApi);
+
+    // Then: no reactor is asked to unregister it
+    EXPECT_CALL(mockEventFrameworkApi, SendSpdkEvent(_, Matcher<EventFuncTwoParams>(_), _, _)).Times(0);
+
+    // When
+    qosSpdkManager.UnregisterControlPoller();
+}
 } // namespace pos
@@ -62,5 +62,15 @@ class QosVolumeManagerSpy : public QosVolumeManager
     {
         QosVolumeManager::_VolumeDetachHandler(arg1, arg2);
     }
+    bool
+    RateLimit(int volId)
+    {
+        return QosVolumeManager::_RateLimit(volId);
+    }
+    static int64_t
+    RefillBucket(std::atomic<int64_t>& bucket, int64_t refill)
+    {
+        return QosVolumeManager::_RefillBucket(bucket, refill);
+    }
 };
 } // namespace pos
@@ -3,6 +3,9 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <thread>
+
 #include "spdk/pos.h"
 #include "src/include/pos_event_id.h"
 #include "src/io/frontend_io/aio_submission_adapter.h"
@@ -498,4 +501,136 @@ TEST(QosVolumeManager, SubmitAio)
     }
 }
 
+TEST(QosVolumeManager, ResetVolumeThrottling_AccumulateBurstCreditWhileIdle)
+{
+    NiceMock<MockQosContext> mockQoscontext;
+    NiceMock<MockQosManager> mockQosManager;
+    NiceMock<MockEventFrameworkApi> mockEventFrameworkApi;
+    uint32_t arrayIndex = 0;
+    bool feQosEnabled = true;
+    NiceMock<MockQosArrayManager> mockQosArrayManager(arrayIndex, &mockQoscontext, feQosEnabled, &mockEventFrameworkApi, &mockQosManager);
+    QosVolumeManager qosVolumeManager(&mockQoscontext, feQosEnabled, arrayIndex, &mockQosArrayManager, &mockEventFrameworkApi, &mockQosManager);
+    uint32_t volId = 1;
+    int64_t limit = 1000;
+    qosVolumeManager.SetVolumeLimit(volId, limit, false);
+
+    qosVolumeManager.ResetVolumeThrottling(volId, arrayIndex);
+    EXPECT_EQ(qosVolumeManager.GetVolumeBurstCredit(volId, false), 0);
+
+    // 200% burst for 1 sec, the unused refill of each slice is saved
+    qosVolumeManager.SetVolumeBurst(volId, 200, 1);
+    qosVolumeManager.ResetVolumeThrottling(volId, arrayIndex);
+    EXPECT_EQ(qosVolumeManager.GetVolumeBurstCredit(volId, false), static_cast<int64_t>(limit * MAX_THROTTLING_RATE));
+
+    // up to one extra limit per slice for the duration
+    for (uint32_t slice = 0; slice < 2 * PARAMETER_COLLECTION_INTERVAL; slice++)
+    {
+        qosVolumeManager.ResetVolumeThrottling(volId, arrayIndex);
+    }
+    EXPECT_EQ(qosVolumeManager.GetVolumeBurstCredit(volId, false), static_cast<int64_t>(limit * PARAMETER_COLLECTION_INTERVAL));
+    EXPECT_EQ(qosVolumeManager.GetVolumeBurstPercent(volId), 200u);
+    EXPECT_EQ(qosVolumeManager.GetVolumeBurstDuration(volId), 1u);
+}
+
+TEST(QosVolumeManager, ResetVolumeThrottling_testIfTokensLeftInReactorCachesEarnBurstCredit)
+{
+    // Given: a reactor borrowed tokens of the slice and did not spend them
+    NiceMock<MockQosContext> mockQoscontext;
+    NiceMock<MockQosManager> mockQosManager;
+    NiceMock<MockEventFrameworkApi> mockEventFrameworkApi;
+    uint32_t arrayIndex = 0;
+    bool feQosEnabled = true;
+    NiceMock<MockQosArrayManager> mockQosArrayManager(arrayIndex, &mockQoscontext, feQosEnabled, &mockEventFrameworkApi, &mockQosManager);
+    QosVolumeManagerSpy qosVolumeManager(&mockQoscontext, feQosEnabled, arrayIndex, &mockQosArrayManager, &mockEventFrameworkApi, &mockQosManager);
+    ON_CALL(mockEventFrameworkApi, GetCurrentReactor()).WillByDefault(Return(1));
+    uint32_t volId = 1;
+    int64_t limit = 1000;
+    qosVolumeManager.SetVolumeLimit(volId, limit, false);
+    qosVolumeManager.ResetVolumeThrottling(volId, arrayIndex);
+    qosVolumeManager.SetVolumeBurst(volId, 200, 60);
+    EXPECT_FALSE(qosVolumeManager.RateLimit(volId));
+
+    // When
+    qosVolumeManager.ResetVolumeThrottling(volId, arrayIndex);
+
+    // Then: the whole refill of the last slice is saved as credit
+    EXPECT_EQ(qosVolumeManager.GetVolumeBurstCredit(volId, false), static_cast<int64_t>(limit * MAX_THROTTLING_RATE));
+}
+
+TEST(QosVolumeManager, RefillBucket_testIfLeftoverExpiresAndDeficitIsCarriedOver)
+{
+    // Given
+    std::atomic<int64_t> bucket(500);
+
+    // When: tokens are left
+    QosVolumeManagerSpy::RefillBucket(bucket, 1000);
+
+    // Then
+    EXPECT_EQ(bucket.load(), 1000);
+
+    // When: the slice was overused
+    bucket = -200;
+    QosVolumeManagerSpy::RefillBucket(bucket, 1000);
+
+    // Then
+    EXPECT_EQ(bucket.load(), 800);
+}
+
+TEST(QosVolumeManager, RefillBucket_testIfOveruseChargedDuringRefillIsNotLost)
+{
+    // Given: a reactor charges its overuse while the bucket is refilled
+    int64_t initialDeficit = -1000000000;
+    int64_t refill = 10;
+    int numCharges = 100000;
+    int numRefills = 1000;
+    std::atomic<int64_t> bucket(initialDeficit);
+    std::thread reactor([&]
+    {
+        for (int count = 0; count < numCharges; count++)
+        {
+            bucket.fetch_add(-1);
+        }
+    });
+
+    // When
+    for (int count = 0; count < numRefills; count++)
+    {
+        QosVolumeManagerSpy::RefillBucket(bucket, refill);
+    }
+    reactor.join();
+
+    // Then
+    EXPECT_EQ(bucket.load(), initialDeficit - numCharges + numRefills * refill);
+}
+
+TEST(QosVolumeManager, CreateQosGroup_testIfVolumeJoinsOnlyOneGroup)
+{
+    NiceMock<MockQosContext> mockQoscontext;
+    NiceMock<MockQosManager> mockQosManager;
+    NiceMock<MockEventFrameworkApi> mockEventFrameworkApi;
+    uint32_t arrayIndex = 0;
+    bool feQosEnabled = true;
+    NiceMock<MockQosArrayManager> mockQosArrayManager(arrayIndex, &mockQoscontext, feQosEnabled, &mockEventFrameworkApi, &mockQosManager);
+    QosVolumeManager qosVolumeManager(&mockQoscontext, feQosEnabled, arrayIndex, &mockQosArrayManager, &mockEventFrameworkApi, &mockQosManager);
+    std::vector<uint32_t> nqnIds;
+    uint64_t maxBw = 100 * PARAMETER_COLLECTION_INTERVAL;
+
+    EXPECT_EQ(qosVolumeManager.CreateQosGroup("tenant1", {1, 2}, nqnIds, maxBw, 0), EID(SUCCESS));
+    EXPECT_EQ(qosVolumeManager.CreateQosGroup("tenant2", {2}, nqnIds, maxBw, 0), EID(QOS_GROUP_CREATION_FAILED));
+    // the same name replaces the members of the group
+    EXPECT_EQ(qosVolumeManager.CreateQosGroup("tenant1", {1}, nqnIds, maxBw, 0), EID(SUCCESS));
+    EXPECT_EQ(qosVolumeManager.CreateQosGroup("tenant2", {2}, nqnIds, maxBw, 0), EID(SUCCESS));
+
+    std::vector<qos_group_usage> groupUsage;
+    qosVolumeManager.ResetGroupThrottling();
+    qosVolumeManager.GetQosGroupUsage(groupUsage);
+    ASSERT_EQ(groupUsage.size(), 2u);
+    EXPECT_EQ(groupUsage[0].name, "tenant1");
+    ASSERT_EQ(groupUsage[0].volumes.size(), 1u);
+    EXPECT_EQ(groupUsage[0].volumes[0], 1u);
+    EXPECT_EQ(groupUsage[0].maxBw, maxBw);
+    EXPECT_EQ(groupUsage[0].maxIops, 0u);
+    EXPECT_EQ(groupUsage[0].usedBw, 0u);
+}
+
 } // namespace pos
@@ -78,6 +78,39 @@ TEST(ArrayRebuilder, ResumeRebuild_testIfNeedToResumeRebuild)
     ASSERT_EQ(1, targetPartitions.size());
 }
 
+TEST(ArrayRebuilder, ResumeRebuild_testIfEveryNonResumablePartitionIsRemoved)
+{
+    // Given
+    string arrayName = "POSArray";
+    MockIRebuildNotification mockRebuildNoti;
+    bool resume_input = true;
+    EXPECT_CALL(mockRebuildNoti, PrepareRebuild).WillOnce([resume_input](string arrayName, bool& resume)
+    {
+        resume = resume_input;
+        return 0;
+    });
+    ArrayRebuilder* rebuilder = new ArrayRebuilder(&mockRebuildNoti);
+    shared_ptr<MockUBlockDevice> mockDev = make_shared<MockUBlockDevice>("unvme-ns-0", 0, nullptr);
+    MockArrayDevice arrayDev(mockDev);
+    MockRebuildTarget metaPart(false);
+    MockRebuildTarget journalPart(false);
+    MockRebuildTarget dataPart(true);
+    EXPECT_CALL(metaPart, GetRebuildCtx).WillRepeatedly(Return(ByMove(nullptr)));
+    EXPECT_CALL(journalPart, GetRebuildCtx).WillRepeatedly(Return(ByMove(nullptr)));
+    EXPECT_CALL(dataPart, GetRebuildCtx).WillRepeatedly(Return(ByMove(nullptr)));
+    list<RebuildTarget*> targetPartitions;
+    targetPartitions.push_back(&metaPart);
+    targetPartitions.push_back(&dataPart);
+    targetPartitions.push_back(&journalPart);
+
+    // When
+    rebuilder->Rebuild(arrayName, 0, vector<IArrayDevice*>{&arrayDev}, nullptr, targetPartitions);
+
+    // Then : only the data partition is resumed
+    ASSERT_EQ(1, targetPartitions.size());
+    EXPECT_EQ(&dataPart, targetPartitions.front());
+}
+
 TEST(ArrayRebuilder, Discard_testErrorOccuredDuringPrepareRebuild)
 {
     // Given
@@ -0,0 +1,46 @@
+#include "src/rebuild/rebuild_scheduler.h"
+
+#include <gtest/gtest.h>
+
+namespace pos
+{
+TEST(RebuildScheduler, GetQueueDepth_testIfArrayWithFewerFaultsLeftGetsLargerShare)
+{
+    // Given: RAID6 array with two failed devices and one with a single failed device
+    RebuildScheduler scheduler;
+    scheduler.Register("POSArray1", 0);
+    scheduler.Register("POSArray2", 1);
+
+    // When, Then: The node queue depth is shared 2:1
+    EXPECT_EQ(128U, scheduler.GetQueueDepth("POSArray1", 192));
+    EXPECT_EQ(64U, scheduler.GetQueueDepth("POSArray2", 192));
+}
+
+TEST(RebuildScheduler, GetQueueDepth_testIfShareIsRedistributedWhenRebuildIsDone)
+{
+    // Given: Two arrays are rebuilding at once
+    RebuildScheduler scheduler;
+    scheduler.Register("POSArray1", 1);
+    scheduler.Register("POSArray2", 1);
+    EXPECT_EQ(32U, scheduler.GetQueueDepth("POSArray2", 64));
+
+    // When: The rebuild of one array is done
+    scheduler.Unregister("POSArray1");
+
+    // Then: The other array takes the whole queue depth
+    EXPECT_EQ(64U, scheduler.GetQueueDepth("POSArray2", 64));
+}
+
+TEST(RebuildScheduler, GetQueueDepth_testIfShareIsAtLeastOne)
+{
+    // Given
+    RebuildScheduler scheduler;
+    scheduler.Register("POSArray1", 0);
+    scheduler.Register("POSArray2", 2);
+
+    // When, Then
+    EXPECT_EQ(1U, scheduler.GetQueueDepth("POSArray2", 1));
+    EXPECT_EQ(16U, scheduler.GetQueueDepth("POSArray3", 16));
+}
+
+} // namespace pos
@@ -1,27 +1,225 @@
 #include "src/rebuild/segment_based_rebuild.h"
 
+#include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <vector>
+
+#include "src/array_models/dto/partition_physical_size.h"
+#include "test/unit-tests/allocator/i_context_manager_mock.h"
+#include "test/unit-tests/event_scheduler/event_scheduler_mock.h"
+#include "test/unit-tests/master_context/config_manager_mock.h"
+#include "test/unit-tests/qos/qos_manager_mock.h"
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
 namespace pos
 {
-TEST(SegmentBasedRebuild, SegmentBasedRebuild_)
+static const uint32_t STRIPES_PER_SEGMENT = 1024;
+static const uint32_t TOTAL_SEGMENTS = 16;
+static const SegmentId SEGMENT_ID = 3;
+static const uint32_t STRIPE_COUNT = 10;
+static const uint32_t QUEUE_DEPTH = 4;
+
+ACTION_P(SetArg2ToUint32AndReturn0, value)
 {
+    *static_cast<uint32_t*>(arg2) = value;
+    return 0;
 }
 
-TEST(SegmentBasedRebuild, Read_)
+// Keeps the callbacks of the issued stripes, so that the test completes them
+class FakeRebuildMethod : public RebuildMethod
+{
+public:
+    FakeRebuildMethod(void)
+    : RebuildMethod(1, 1, nullptr)
+    {
+    }
+    int
+    Recover(int arrayIndex, StripeId stripeId, const PartitionPhysicalSize* pSize, StripeRebuildDoneCallback callback) override
+    {
+        issuedStripes.push_back(stripeId);
+        if (recoverResult == 0)
+        {
+            inFlight.push_back(callback);
+        }
+        return recoverResult;
+    }
+    bool
+    CompleteOne(int result = 0)
+    {
+        if (inFlight.empty())
+        {
+            return false;
+        }
+        StripeRebuildDoneCallback callback = inFlight.front();
+        inFlight.erase(inFlight.begin());
+        callback(result);
+        return true;
+    }
+    vector<StripeId> issuedStripes;
+    vector<StripeRebuildDoneCallback> inFlight;
+    int recoverResult = 0;
+};
+
+class SegmentBasedRebuildSpy : public SegmentBasedRebuild
+{
+public:
+    using SegmentBasedRebuild::SegmentBasedRebuild;
+    void
+    SkipInit(void)
+    {
+        // the buffers of the rebuild methods are not needed by the fake
+        isInitialized = true;
+    }
+};
+
+class SegmentBasedRebuildTestFixture : public ::testing::Test
 {
+protected:
+    void
+    SetUp(void) override
+    {
+        size.stripesPerSegment = STRIPES_PER_SEGMENT;
+        size.totalSegments = TOTAL_SEGMENTS;
+        ON_CALL(allocatorSvc, AllocateRebuildTargetSegment()).WillByDefault(Return(SEGMENT_ID));
+        ON_CALL(allocatorSvc, GetRebuildTargetStripeCount(SEGMENT_ID)).WillByDefault(Return(STRIPE_COUNT));
+        ON_CALL(configManager, GetValue("rebuild", "stripe_queue_depth", _, _)).WillByDefault(SetArg2ToUint32AndReturn0(QUEUE_DEPTH));
+        qos_backend_policy policy;
+        policy.priorityImpact = PRIORITY_HIGH;
+        ON_CALL(qosManager, GetBackendPolicy(BackendEvent_UserdataRebuild)).WillByDefault(Return(policy));
+    }
+
+    void
+    TearDown(void) override
+    {
+        delete rebuild;
+        delete logger;
+        delete progress;
+    }
+
+    void
+    CreateRebuild(void)
+    {
+        unique_ptr<RebuildContext> ctx(new RebuildContext());
+        ctx->array = "POSArray";
+        ctx->size = &size;
+        logger = new RebuildLogger("POSArray", "test");
+        progress = new RebuildProgress("POSArray");
+        ctx->logger = logger;
+        ctx->prog = progress;
+        rm = new FakeRebuildMethod();
+        ctx->rm.push_back(rm);
+        rebuild = new SegmentBasedRebuildSpy(move(ctx), &allocatorSvc, &configManager, &qosManager, &rebuildScheduler, &eventScheduler);
+        rebuild->SkipInit();
+    }
+
+    PartitionPhysicalSize size;
+    NiceMock<MockIContextManager> allocatorSvc;
+    NiceMock<MockConfigManager> configManager;
+    NiceMock<MockQosManager> qosManager;
+    RebuildScheduler rebuildScheduler;
+    NiceMock<MockEventScheduler> eventScheduler;
+    RebuildLogger* logger = nullptr;
+    RebuildProgress* progress = nullptr;
+    FakeRebuildMethod* rm = nullptr;
+    SegmentBasedRebuildSpy* rebuild = nullptr;
+};
+
+TEST_F(SegmentBasedRebuildTestFixture, Rebuild_testIfOnlyQueueDepthStripesAreInFlight)
+{
+    // Given
+    CreateRebuild();
+
+    // When
+    bool ret = rebuild->Rebuild();
+
+    // Then: the first stripes of the segment are issued up to the queue depth
+    EXPECT_TRUE(ret);
+    ASSERT_EQ(QUEUE_DEPTH, rm->issuedStripes.size());
+    EXPECT_EQ(SEGMENT_ID * STRIPES_PER_SEGMENT, rm->issuedStripes.front());
+    EXPECT_EQ(QUEUE_DEPTH, rm->inFlight.size());
 }
 
-TEST(SegmentBasedRebuild, Write_)
+TEST_F(SegmentBasedRebuildTestFixture, Rebuild_testIfCompletionIssuesNextStripeAndLastCompletionReleasesSegment)
 {
+    // Given
+    CreateRebuild();
+    rebuild->Rebuild();
+
+    // When: a stripe completes
+    rm->CompleteOne();
+
+    // Then: the next stripe takes its place in the queue
+    ASSERT_EQ(QUEUE_DEPTH + 1, rm->issuedStripes.size());
+    EXPECT_EQ(SEGMENT_ID * STRIPES_PER_SEGMENT + QUEUE_DEPTH, rm->issuedStripes.back());
+    EXPECT_EQ(QUEUE_DEPTH, rm->inFlight.size());
+
+    // Then: the segment is released and the next one scheduled only after every stripe
+    EXPECT_CALL(allocatorSvc, ReleaseRebuildSegment(SEGMENT_ID)).Times(1);
+    EXPECT_CALL(eventScheduler, EnqueueEvent(_)).Times(1);
+    while (rm->CompleteOne())
+    {
+        EXPECT_LE(rm->inFlight.size(), QUEUE_DEPTH);
+    }
+    EXPECT_EQ(STRIPE_COUNT, rm->issuedStripes.size());
+    EXPECT_EQ(0U, rebuild->GetContext()->taskCnt.load());
+}
+
+TEST_F(SegmentBasedRebuildTestFixture, Rebuild_testIfQueueDepthFollowsPerfImpact)
+{
+    // Given: the rebuild perf impact is low
+    qos_backend_policy policy;
+    policy.priorityImpact = PRIORITY_LOW;
+    ON_CALL(qosManager, GetBackendPolicy(BackendEvent_UserdataRebuild)).WillByDefault(Return(policy));
+    CreateRebuild();
+
+    // When
+    rebuild->Rebuild();
+
+    // Then: a quarter of the queue depth is issued
+    EXPECT_EQ(QUEUE_DEPTH / 4, rm->issuedStripes.size());
 }
 
-TEST(SegmentBasedRebuild, Complete_)
+TEST_F(SegmentBasedRebuildTestFixture, Rebuild_testIfFailedIssueSkipsRemainingStripesAndReleasesSegment)
 {
+    // Given: the rebuild method fails to issue
+    CreateRebuild();
+    rm->recoverResult = -1;
+
+    // Then: the segment completes once, without issuing the other stripes
+    EXPECT_CALL(allocatorSvc, ReleaseRebuildSegment(SEGMENT_ID)).Times(1);
+    EXPECT_CALL(eventScheduler, EnqueueEvent(_)).Times(1);
+
+    // When
+    rebuild->Rebuild();
+
+    EXPECT_EQ(1U, rm->issuedStripes.size());
+    EXPECT_EQ(RebuildState::FAIL, rebuild->GetContext()->GetResult());
 }
 
-TEST(SegmentBasedRebuild, _NextSegment_)
+TEST_F(SegmentBasedRebuildTestFixture, Rebuild_testIfStopWaitsForStripesInFlight)
 {
+    // Given: stripes in flight
+    CreateRebuild();
+    rebuild->Rebuild();
+
+    // When: the rebuild is stopped
+    rebuild->GetContext()->SetResult(RebuildState::CANCELLED);
+
+    // Then: no more stripe is issued, and the segment completes when the last one in flight does
+    EXPECT_CALL(allocatorSvc, ReleaseRebuildSegment(SEGMENT_ID)).Times(0);
+    rm->CompleteOne();
+    EXPECT_EQ(QUEUE_DEPTH, rm->issuedStripes.size());
+
+    EXPECT_CALL(allocatorSvc, ReleaseRebuildSegment(SEGMENT_ID)).Times(1);
+    EXPECT_CALL(eventScheduler, EnqueueEvent(_)).Times(1);
+    while (rm->CompleteOne())
+    {
+    }
+    EXPECT_EQ(QUEUE_DEPTH, rm->issuedStripes.size());
 }
 
 } // namespace pos
@@ -0,0 +1,126 @@
+#include "src/resource_checker/smart_sampler.h"
+
+#include <gtest/gtest.h>
+
+#include "spdk/nvme.h"
+#include "src/include/pos_event_id.h"
+#include "test/unit-tests/master_context/config_manager_mock.h"
+
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+static void
+SetSamplerConfig(NiceMock<MockConfigManager>& configManager, uint32_t intervalInSec)
+{
+    ON_CALL(configManager, GetValue).WillByDefault(Invoke(
+        [intervalInSec](string module, string key, void* value, ConfigType type)
+        {
+            if (key == "smart_sampler_enable")
+            {
+                *static_cast<bool*>(value) = true;
+            }
+            else if (key == "smart_sample_interval_in_sec")
+            {
+                *static_cast<uint32_t*>(value) = intervalInSec;
+            }
+            return EID(SUCCESS);
+        }));
+}
+
+TEST(SmartSampler, SmartSampler_testIfDisabledWithoutConfig)
+{
+    // Given
+    NiceMock<MockConfigManager> configManager;
+    ON_CALL(configManager, GetValue).WillByDefault(Return(EID(CONFIG_REQUEST_KEY_ERROR)));
+
+    // When
+    SmartSampler sampler(&configManager, [] { return std::vector<std::string>(); },
+        [](const std::string&, uint8_t, void*, uint32_t) { return true; });
+
+    // Then
+    EXPECT_FALSE(sampler.IsEnabled());
+}
+
+TEST(SmartSampler, SampleNext_testIfDevicesAreSampledOneByOneOverTheInterval)
+{
+    // Given
+    NiceMock<MockConfigManager> configManager;
+    SetSamplerConfig(configManager, 60);
+    std::vector<std::string> readDevices;
+    SmartSampler sampler(&configManager,
+        [] { return std::vector<std::string>{"unvme-ns-0", "unvme-ns-1"}; },
+        [&readDevices](const std::string& deviceName, uint8_t lid, void* payload, uint32_t size)
+        {
+            if (lid == SPDK_NVME_LOG_HEALTH_INFORMATION)
+            {
+                readDevices.push_back(deviceName);
+                static_cast<spdk_nvme_health_information_page*>(payload)->temperature = 300;
+            }
+            return true;
+        });
+
+    // When
+    uint32_t waitInMs = sampler.SampleNext();
+
+    // Then
+    EXPECT_TRUE(sampler.IsEnabled());
+    EXPECT_EQ(30000U, waitInMs);
+    ASSERT_EQ(1U, readDevices.size());
+    spdk_nvme_health_information_page page;
+    EXPECT_TRUE(sampler.GetHealthPage("unvme-ns-0", page));
+    EXPECT_EQ(300U, page.temperature);
+    EXPECT_FALSE(sampler.GetHealthPage("unvme-ns-1", page));
+
+    // When
+    sampler.SampleNext();
+
+    // Then
+    EXPECT_EQ(2U, readDevices.size());
+    EXPECT_TRUE(sampler.GetHealthPage("unvme-ns-1", page));
+}
+
+TEST(SmartSampler, SampleNext_testIfFailedReadLeavesNoSnapshot)
+{
+    // Given
+    NiceMock<MockConfigManager> configManager;
+    SetSamplerConfig(configManager, 60);
+    SmartSampler sampler(&configManager,
+        [] { return std::vector<std::string>{"unvme-ns-0"}; },
+        [](const std::string&, uint8_t, void*, uint32_t) { return false; });
+
+    // When
+    sampler.SampleNext();
+
+    // Then
+    spdk_nvme_health_information_page page;
+    EXPECT_FALSE(sampler.GetHealthPage("unvme-ns-0", page));
+    EXPECT_TRUE(sampler.GetSampledDevices().empty());
+}
+
+TEST(SmartSampler, SampleNext_testIfRemovedDeviceIsDroppedOnNextRound)
+{
+    // Given
+    NiceMock<MockConfigManager> configManager;
+    SetSamplerConfig(configManager, 60);
+    std::vector<std::string> attached{"unvme-ns-0", "unvme-ns-1"};
+    SmartSampler sampler(&configManager,
+        [&attached] { return attached; },
+        [](const std::string&, uint8_t, void*, uint32_t) { return true; });
+    sampler.SampleNext();
+    sampler.SampleNext();
+    ASSERT_EQ(2U, sampler.GetSampledDevices().size());
+
+    // When
+    attached = {"unvme-ns-1"};
+    sampler.SampleNext();
+
+    // Then
+    std::vector<std::string> sampled = sampler.GetSampledDevices();
+    ASSERT_EQ(1U, sampled.size());
+    EXPECT_EQ("unvme-ns-1", sampled[0]);
+}
+
+} // namespace pos
@@ -46,6 +46,7 @@ public:
     MOCK_METHOD(void*, TryGetBuffer, (), (override));
     MOCK_METHOD(bool, TryGetBuffers, (uint32_t count, std::vector<void*>* retBuffers, uint32_t minCount), (override));
     MOCK_METHOD(void, ReturnBuffer, (void*), (override));
+    MOCK_METHOD(BufferPoolStat, GetStat, (), (override));
 };
 
 } // namespace pos
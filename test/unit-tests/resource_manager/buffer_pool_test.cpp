@@ -34,6 +34,9 @@
 
 #include <gtest/gtest.h>
 
+#include <thread>
+#include <vector>
+
 #include "test/unit-tests/dpdk_wrapper/hugepage_allocator_mock.h"
 
 using ::testing::Return;
@@ -108,4 +111,137 @@ TEST(BufferPool, ReturnBuffer_testRepeatedlyGetandReturnBufferWhenBufferSizeIsTw
     delete mockHugepageAllocator;
 }
 
+TEST(BufferPool, TryGetBuffers_testIfBuffersCachedInOtherMagazinesAreCounted)
+{
+    // Given
+    const uint32_t PAGE_SIZE = 2097152; // 2MB
+    std::vector<char*> pages;
+    BufferInfo info;
+    info.owner = "test";
+    info.size = 4096; // 4KB
+    info.count = 4096;
+    uint32_t socket = 0;
+    MockHugepageAllocator* mockHugepageAllocator = new MockHugepageAllocator();
+    EXPECT_CALL(*mockHugepageAllocator, AllocFromSocket).WillRepeatedly(
+        [&pages, PAGE_SIZE](const uint32_t size, const uint32_t count, const uint32_t socket) {
+            pages.push_back(new char[PAGE_SIZE]);
+            return pages.back();
+        });
+    EXPECT_CALL(*mockHugepageAllocator, GetDefaultPageSize).WillRepeatedly(
+        Return(PAGE_SIZE));
+    EXPECT_CALL(*mockHugepageAllocator, Free).WillRepeatedly([](void* addr) {
+            delete[] static_cast<char*>(addr);
+    });
+    BufferPool* pool = new BufferPool(info, socket, mockHugepageAllocator);
+    ASSERT_GT(pool->GetMagazineSize(), 0);
+    std::vector<void*> buffers;
+    ASSERT_TRUE(pool->TryGetBuffers(info.count, &buffers, info.count));
+    std::thread returner([pool, &buffers]() {
+        pool->ReturnBuffers(&buffers);
+    });
+    returner.join();
+
+    // When
+    std::vector<void*> again;
+    bool ret = pool->TryGetBuffers(info.count, &again, info.count);
+
+    // Then
+    EXPECT_TRUE(ret);
+    EXPECT_EQ(info.count, again.size());
+    EXPECT_EQ(0, pool->GetStat().freeCount);
+
+    // Teardown
+    pool->ReturnBuffers(&again);
+    delete pool;
+    delete mockHugepageAllocator;
+}
+
+TEST(BufferPool, GetStat_testIfFreeCountAndRefillMissAreReported)
+{
+    // Given
+    const uint32_t PAGE_SIZE = 2097152; // 2MB
+    std::vector<char*> pages;
+    BufferInfo info;
+    info.owner = "test";
+    info.size = 4096; // 4KB
+    info.count = 4096;
+    uint32_t socket = 0;
+    MockHugepageAllocator* mockHugepageAllocator = new MockHugepageAllocator();
+    EXPECT_CALL(*mockHugepageAllocator, AllocFromSocket).WillRepeatedly(
+        [&pages, PAGE_SIZE](const uint32_t size, const uint32_t count, const uint32_t socket) {
+            pages.push_back(new char[PAGE_SIZE]);
+            return pages.back();
+        });
+    EXPECT_CALL(*mockHugepageAllocator, GetDefaultPageSize).WillRepeatedly(
+        Return(PAGE_SIZE));
+    EXPECT_CALL(*mockHugepageAllocator, Free).WillRepeatedly([](void* addr) {
+            delete[] static_cast<char*>(addr);
+    });
+    BufferPool* pool = new BufferPool(info, socket, mockHugepageAllocator);
+
+    // When
+    void* buffer = pool->TryGetBuffer();
+    BufferPoolStat statInUse = pool->GetStat();
+    pool->ReturnBuffer(buffer);
+    BufferPoolStat statReturned = pool->GetStat();
+
+    // Then
+    EXPECT_EQ("test", statInUse.owner);
+    EXPECT_EQ(info.count, statInUse.totalCount);
+    EXPECT_EQ(info.count - 1, statInUse.freeCount);
+    EXPECT_EQ(info.count, statReturned.freeCount);
+    EXPECT_EQ(1, statReturned.getCount);
+    EXPECT_EQ(1, statReturned.refillMissCount);
+
+    // Teardown
+    delete pool;
+    delete mockHugepageAllocator;
+}
+
+TEST(BufferPool, TryGetBuffers_testIfLazyPoolGrowsOnDemand)
+{
+    // Given
+    const uint32_t PAGE_SIZE = 2097152; // 2MB
+    std::vector<char*> pages;
+    BufferInfo info;
+    info.owner = "test";
+    info.size = 4096; // 4KB
+    info.count = 2048; // 4 pages
+    info.lazy = true;
+    uint32_t socket = 0;
+    MockHugepageAllocator* mockHugepageAllocator = new MockHugepageAllocator();
+    EXPECT_CALL(*mockHugepageAllocator, AllocFromSocket).WillRepeatedly(
+        [&pages, PAGE_SIZE](const uint32_t size, const uint32_t count, const uint32_t socket) {
+            pages.push_back(new char[PAGE_SIZE]);
+            return pages.back();
+        });
+    EXPECT_CALL(*mockHugepageAllocator, GetDefaultPageSize).WillRepeatedly(
+        Return(PAGE_SIZE));
+    EXPECT_CALL(*mockHugepageAllocator, Free).WillRepeatedly([](void* addr) {
+            delete[] static_cast<char*>(addr);
+    });
+    BufferPool* pool = new BufferPool(info, socket, mockHugepageAllocator);
+    BufferPoolStat statInit = pool->GetStat();
+    size_t pagesAtInit = pages.size();
+
+    // When
+    std::vector<void*> buffers;
+    bool ret = pool->TryGetBuffers(info.count, &buffers, info.count);
+
+    // Then
+    EXPECT_EQ(1, pagesAtInit);
+    EXPECT_EQ(4, pages.size());
+    EXPECT_EQ(512, statInit.populatedCount);
+    EXPECT_EQ(info.count, statInit.freeCount);
+    EXPECT_TRUE(ret);
+    EXPECT_EQ(info.count, buffers.size());
+    EXPECT_EQ(info.count, pool->GetStat().populatedCount);
+    EXPECT_EQ(0, pool->GetStat().freeCount);
+
+    // Teardown
+    pool->ReturnBuffers(&buffers);
+    delete pool;
+    delete mockHugepageAllocator;
+}
+
 } // namespace pos
@@ -45,6 +45,7 @@ public:
     using MemoryManager::MemoryManager;
     MOCK_METHOD(BufferPool*, CreateBufferPool, (BufferInfo & info, uint32_t socket), (override));
     MOCK_METHOD(bool, DeleteBufferPool, (BufferPool * pool), (override));
+    MOCK_METHOD(std::vector<BufferPoolStat>, GetBufferPoolStats, (), (override));
 };
 
 } // namespace pos
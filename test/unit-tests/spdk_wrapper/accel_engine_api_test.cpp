@@ -54,6 +54,17 @@ TEST(AccelEngineApi, GetReactorByIndex_InvalidReactor)
     int actual = AccelEngineApi::GetReactorByIndex(3);
 }
 
+TEST(AccelEngineApi, IsIoatReactorNow_testIfFalseWithoutChannel)
+{
+    // Given: the current thread has never got an accel channel
+
+    // When
+    bool actual = AccelEngineApi::IsIoatReactorNow();
+
+    // Then
+    EXPECT_FALSE(actual);
+}
+
 TEST(AccelEngineApi, GetIoatReactorCount_Success)
 {
     uint32_t expected = 0;
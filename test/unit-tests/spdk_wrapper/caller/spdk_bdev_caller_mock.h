@@ -48,6 +48,8 @@ public:
     MOCK_METHOD(void, SpdkBdevClose, (struct spdk_bdev_desc* desc));
     MOCK_METHOD(int, SpdkBdevRead, (struct spdk_bdev_desc *desc, struct spdk_io_channel *ch, void *buf, uint64_t offset, uint64_t nbytes, spdk_bdev_io_completion_cb cb, void *cb_arg));
     MOCK_METHOD(int, SpdkBdevWrite, (struct spdk_bdev_desc *desc, struct spdk_io_channel *ch, void *buf, uint64_t offset, uint64_t nbytes, spdk_bdev_io_completion_cb cb, void *cb_arg));
+    MOCK_METHOD(int, SpdkBdevReadv, (struct spdk_bdev_desc *desc, struct spdk_io_channel *ch, struct iovec *iov, int iovcnt, uint64_t offset, uint64_t nbytes, spdk_bdev_io_completion_cb cb, void *cb_arg));
+    MOCK_METHOD(int, SpdkBdevWritev, (struct spdk_bdev_desc *desc, struct spdk_io_channel *ch, struct iovec *iov, int iovcnt, uint64_t offset, uint64_t nbytes, spdk_bdev_io_completion_cb cb, void *cb_arg));
 };
 
 } // namespace pos
@@ -56,6 +56,7 @@ public:
     MOCK_METHOD(void, SpdkBdevDeletePosDisk, (struct spdk_bdev * bdev, pos_bdev_delete_callback cbFunc, void* cbArg), (override));
     MOCK_METHOD(struct spdk_bdev*, SpdkBdevGetByName, (const char* bdevName), (override));
     MOCK_METHOD(const char*, SpdkBdevGetName, (const struct spdk_bdev* bdev), (override));
+    MOCK_METHOD(int, SpdkBdevNotifyBlockcntChange, (struct spdk_bdev* bdev, uint64_t size), (override));
     MOCK_METHOD(void, SpdkBdevSetQosRateLimits, (struct spdk_bdev * bdev, uint64_t* limits, void (*cbFunc)(void* cbArg, int status), void* cbArg), (override));
     MOCK_METHOD(const char*, SpdkGetAttachedSubsystemNqn, (const char* bdevName), (override));
     MOCK_METHOD(const struct spdk_uuid*, SpdkBdevGetUuid, (const struct spdk_bdev* bdev), (override));
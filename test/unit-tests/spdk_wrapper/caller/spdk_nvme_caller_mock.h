@@ -44,6 +44,8 @@ public:
     MOCK_METHOD(int, SpdkNvmeNsCmdDatasetManagement, (struct spdk_nvme_ns * ns, struct spdk_nvme_qpair* qpair, uint32_t type, const struct spdk_nvme_dsm_range* range, uint16_t num_ranges, spdk_nvme_cmd_cb cb_fn, void* cb_arg), (override));
     MOCK_METHOD(int, SpdkNvmeNsCmdRead, (struct spdk_nvme_ns * ns, struct spdk_nvme_qpair* qpair, void* buffer, uint64_t lba, uint32_t lba_count, spdk_nvme_cmd_cb cb_fn, void* cb_arg, uint32_t io_flags), (override));
     MOCK_METHOD(int, SpdkNvmeNsCmdWrite, (struct spdk_nvme_ns * ns, struct spdk_nvme_qpair* qpair, void* buffer, uint64_t lba, uint32_t lba_count, spdk_nvme_cmd_cb cb_fn, void* cb_arg, uint32_t io_flags), (override));
+    MOCK_METHOD(int, SpdkNvmeNsCmdReadv, (struct spdk_nvme_ns * ns, struct spdk_nvme_qpair* qpair, uint64_t lba, uint32_t lba_count, spdk_nvme_cmd_cb cb_fn, void* cb_arg, uint32_t io_flags, spdk_nvme_req_reset_sgl_cb reset_sgl_fn, spdk_nvme_req_next_sge_cb next_sge_fn), (override));
+    MOCK_METHOD(int, SpdkNvmeNsCmdWritev, (struct spdk_nvme_ns * ns, struct spdk_nvme_qpair* qpair, uint64_t lba, uint32_t lba_count, spdk_nvme_cmd_cb cb_fn, void* cb_arg, uint32_t io_flags, spdk_nvme_req_reset_sgl_cb reset_sgl_fn, spdk_nvme_req_next_sge_cb next_sge_fn), (override));
     MOCK_METHOD(int, SpdkNvmeCtrlrCmdAbort, (struct spdk_nvme_ctrlr * ctrlr, struct spdk_nvme_qpair* qpair, uint16_t cid, spdk_nvme_cmd_cb cb_fn, void* cb_arg), (override));
     MOCK_METHOD(int, SpdkNvmeCtrlrCmdIoRaw, (struct spdk_nvme_ctrlr * ctrlr, struct spdk_nvme_qpair* qpair, struct spdk_nvme_cmd* cmd, void* buf, uint32_t len, spdk_nvme_cmd_cb cb_fn, void* cb_arg), (override));
     MOCK_METHOD(int, SpdkNvmeCtrlrCmdAdminRaw, (struct spdk_nvme_ctrlr * ctrlr, struct spdk_nvme_cmd* cmd, void* buf, uint32_t len, spdk_nvme_cmd_cb cb_fn, void* cb_arg), (override));
@@ -53,9 +55,15 @@ public:
     MOCK_METHOD(int32_t, SpdkNvmeQpairProcessCompletions, (struct spdk_nvme_qpair * qpair, uint32_t max_completions), (override));
     MOCK_METHOD(uint64_t, SpdkNvmeNsGetSize, (struct spdk_nvme_ns * ns), (override));
     MOCK_METHOD(struct spdk_nvme_qpair*, SpdkNvmeCtrlrAllocIoQpair, (struct spdk_nvme_ctrlr *ctrlr, const struct spdk_nvme_io_qpair_opts *user_opts, size_t opts_size), (override));
+    MOCK_METHOD(void, SpdkNvmeCtrlrGetDefaultIoQpairOpts, (struct spdk_nvme_ctrlr* ctrlr, struct spdk_nvme_io_qpair_opts* opts, size_t opts_size), (override));
     MOCK_METHOD(int, SpdkNvmeCtrlrFreeIoQpair, (struct spdk_nvme_qpair* qpair), (override));
     MOCK_METHOD(uint32_t, SpdkNvmeNsGetSectorSize, (struct spdk_nvme_ns* ns), (override));
+    MOCK_METHOD(uint32_t, SpdkNvmeNsGetMaxIoXferSize, (struct spdk_nvme_ns* ns), (override));
     MOCK_METHOD(const struct spdk_nvme_ctrlr_data*, SpdkNvmeCtrlrGetData, (struct spdk_nvme_ctrlr* ctrlr), (override));
+    MOCK_METHOD(enum spdk_nvme_csi, SpdkNvmeNsGetCsi, (struct spdk_nvme_ns* ns), (override));
+    MOCK_METHOD(uint64_t, SpdkNvmeZnsNsGetZoneSize, (struct spdk_nvme_ns* ns), (override));
+    MOCK_METHOD(uint64_t, SpdkNvmeZnsNsGetNumZones, (struct spdk_nvme_ns* ns), (override));
+    MOCK_METHOD(const struct spdk_nvme_ns_data*, SpdkNvmeNsGetData, (struct spdk_nvme_ns* ns), (override));
 };
 
 } // namespace pos
@@ -25,6 +25,11 @@ public:
     MOCK_METHOD(struct spdk_bdev*, SpdkNvmfNsGetBdev, (struct spdk_nvmf_ns * ns), (override));
     MOCK_METHOD(uint32_t, SpdkNvmfNsGetId, (const struct spdk_nvmf_ns* ns), (override));
     MOCK_METHOD(void, SpdkNvmfInitializeNumaAwarePollGroup, (), (override));
+    MOCK_METHOD(struct spdk_nvmf_subsystem_listener*, SpdkNvmfSubsystemGetFirstListener, (struct spdk_nvmf_subsystem * subsystem), (override));
+    MOCK_METHOD(struct spdk_nvmf_subsystem_listener*, SpdkNvmfSubsystemGetNextListener, (struct spdk_nvmf_subsystem * subsystem, struct spdk_nvmf_subsystem_listener* prevListener), (override));
+    MOCK_METHOD(const struct spdk_nvme_transport_id*, SpdkNvmfSubsystemListenerGetTrid, (struct spdk_nvmf_subsystem_listener * listener), (override));
+    MOCK_METHOD(void, SpdkNvmfSetListenerPollGroupHint, (const char* trsvcid, const cpu_set_t* cores), (override));
+    MOCK_METHOD(void, SpdkNvmfClearListenerPollGroupHint, (const char* trsvcid), (override));
 };
 
 } // namespace pos
@@ -0,0 +1,74 @@
+#include "src/spdk_wrapper/reactor_cycle_accounting.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "test/unit-tests/spdk_wrapper/caller/spdk_env_caller_mock.h"
+#include "test/unit-tests/telemetry/telemetry_client/easy_telemetry_publisher_mock.h"
+
+using ::testing::_;
+using ::testing::NiceMock;
+
+namespace pos
+{
+TEST(ReactorCycleAccounting, GetBreakdown_testIfOnlyReactorsWithCyclesAreReturned)
+{
+    ReactorCycleAccounting accounting(new NiceMock<MockSpdkEnvCaller>);
+
+    accounting.Add(3, ReactorCycleType::IoCompletion, 100);
+    accounting.Add(3, ReactorCycleType::IoCompletion, 50);
+    accounting.Add(3, ReactorCycleType::Idle, 10);
+    accounting.Add(ReactorCycleAccounting::MAX_REACTOR_COUNT, ReactorCycleType::Idle, 10);
+
+    std::vector<ReactorCycleBreakdown> breakdown = accounting.GetBreakdown();
+    ASSERT_EQ(1u, breakdown.size());
+    EXPECT_EQ(3u, breakdown[0].reactor);
+    EXPECT_EQ(150u, breakdown[0].cycles[(int)ReactorCycleType::IoCompletion]);
+    EXPECT_EQ(10u, breakdown[0].cycles[(int)ReactorCycleType::Idle]);
+    EXPECT_EQ(160u, breakdown[0].GetTotal());
+}
+
+TEST(ReactorCycleAccounting, EnterPoller_testIfTheCyclesOutsideThePollerExceptSubmissionsAreNvmfPolling)
+{
+    ReactorCycleAccounting accounting(new NiceMock<MockSpdkEnvCaller>);
+
+    // the first run has no previous exit to measure from
+    accounting.EnterPoller(1, 1000);
+    accounting.ExitPoller(1, 1100);
+    accounting.AddNested(1, ReactorCycleType::HostSubmission, 300);
+    accounting.EnterPoller(1, 2100);
+    accounting.ExitPoller(1, 2200);
+    accounting.EnterPoller(1, 2300);
+
+    std::vector<ReactorCycleBreakdown> breakdown = accounting.GetBreakdown();
+    ASSERT_EQ(1u, breakdown.size());
+    EXPECT_EQ(300u, breakdown[0].cycles[(int)ReactorCycleType::HostSubmission]);
+    EXPECT_EQ(700u + 100u, breakdown[0].cycles[(int)ReactorCycleType::NvmfPoll]);
+}
+
+TEST(ReactorCycleAccounting, Flush_testIfTheCyclesOfTheIntervalArePublished)
+{
+    NiceMock<MockEasyTelemetryPublisher> tp(nullptr);
+    ReactorCycleAccounting accounting(new NiceMock<MockSpdkEnvCaller>);
+    accounting.Initialize(&tp);
+    accounting.Dispose();
+
+    accounting.Add(0, ReactorCycleType::ReactorEvent, 300);
+    accounting.Add(0, ReactorCycleType::Idle, 100);
+    EXPECT_CALL(tp, UpdateGauge(_, _, _)).Times((int)ReactorCycleType::Count + 1);
+    accounting.Flush();
+
+    std::vector<ReactorCycleBreakdown> interval = accounting.GetIntervalBreakdown();
+    ASSERT_EQ(1u, interval.size());
+    EXPECT_EQ(300u, interval[0].cycles[(int)ReactorCycleType::ReactorEvent]);
+
+    accounting.Add(0, ReactorCycleType::Idle, 100);
+    EXPECT_CALL(tp, UpdateGauge(_, _, _)).Times((int)ReactorCycleType::Count + 1);
+    accounting.Flush();
+
+    interval = accounting.GetIntervalBreakdown();
+    ASSERT_EQ(1u, interval.size());
+    EXPECT_EQ(0u, interval[0].cycles[(int)ReactorCycleType::ReactorEvent]);
+    EXPECT_EQ(100u, interval[0].cycles[(int)ReactorCycleType::Idle]);
+}
+} // namespace pos
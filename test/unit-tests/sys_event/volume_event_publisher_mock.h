@@ -19,6 +19,7 @@ public:
     MOCK_METHOD(bool, NotifyVolumeUnmounted, (VolumeEventBase* volEventBase, VolumeArrayInfo* volArrayInfo), (override));
     MOCK_METHOD(bool, NotifyVolumeLoaded, (VolumeEventBase* volEventBase, VolumeEventPerf* volEventPerf, VolumeArrayInfo* volArrayInfo), (override));
     MOCK_METHOD(void, NotifyVolumeDetached, (vector<int> volList, VolumeArrayInfo* volArrayInfo), (override));
+    MOCK_METHOD(bool, NotifyVolumeResized, (VolumeEventBase* volEventBase, VolumeArrayInfo* volArrayInfo), (override));
 };
 
 } // namespace pos
@@ -0,0 +1,196 @@
+#include "src/telemetry/telemetry_client/per_core_histogram.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+namespace pos
+{
+TEST(PerCoreHistogram, GetBucketIndex_testIfValueIsWithinBucketBound)
+{
+    // Given
+    std::vector<uint64_t> values = {0, 1, 7, 8, 15, 16, 17, 100, 1000, 123456, (1ULL << 39) + 1};
+
+    for (auto value : values)
+    {
+        // When
+        uint32_t index = PerCoreHistogram::GetBucketIndex(value);
+
+        // Then: the value is within the bucket, and the bucket is at most 12.5% wide
+        uint64_t upperBound = PerCoreHistogram::GetBucketUpperBound(index);
+        EXPECT_LE(value, upperBound);
+        if (index > 0)
+        {
+            uint64_t lowerBound = PerCoreHistogram::GetBucketUpperBound(index - 1) + 1;
+            EXPECT_GE(value, lowerBound);
+            EXPECT_LE(upperBound - lowerBound, lowerBound / 8);
+        }
+    }
+}
+
+TEST(PerCoreHistogram, GetBucketIndex_testIfTooLargeValueIsInLastBucket)
+{
+    // When
+    uint32_t index = PerCoreHistogram::GetBucketIndex(UINT64_MAX);
+
+    // Then
+    EXPECT_EQ(PerCoreHistogram::NUM_BUCKETS - 1, index);
+}
+
+TEST(PerCoreHistogram, CollectInterval_testIfOnlyValuesSincePreviousCollectionAreReturned)
+{
+    // Given
+    PerCoreHistogram histogram;
+    for (uint64_t value = 1; value <= 100; value++)
+    {
+        histogram.Record(value);
+    }
+
+    // When
+    std::vector<uint64_t> first = histogram.CollectInterval();
+    histogram.Record(5000);
+    std::vector<uint64_t> second = histogram.CollectInterval();
+
+    // Then
+    EXPECT_EQ(100, PerCoreHistogram::GetTotalCount(first));
+    EXPECT_EQ(1, PerCoreHistogram::GetTotalCount(second));
+    EXPECT_EQ(PerCoreHistogram::GetBucketUpperBound(PerCoreHistogram::GetBucketIndex(5000)),
+        PerCoreHistogram::GetMax(second));
+}
+
+TEST(PerCoreHistogram, GetPercentile_testIfPercentilesAreFound)
+{
+    // Given: 990 fast values and 10 slow ones
+    PerCoreHistogram histogram;
+    for (int count = 0; count < 990; count++)
+    {
+        histogram.Record(10);
+    }
+    for (int count = 0; count < 10; count++)
+    {
+        histogram.Record(2000);
+    }
+
+    // When
+    std::vector<uint64_t> counts = histogram.CollectInterval();
+
+    // Then
+    EXPECT_EQ(PerCoreHistogram::GetBucketUpperBound(PerCoreHistogram::GetBucketIndex(10)),
+        PerCoreHistogram::GetPercentile(counts, 0.5));
+    EXPECT_EQ(PerCoreHistogram::GetBucketUpperBound(PerCoreHistogram::GetBucketIndex(10)),
+        PerCoreHistogram::GetPercentile(counts, 0.99));
+    EXPECT_EQ(PerCoreHistogram::GetBucketUpperBound(PerCoreHistogram::GetBucketIndex(2000)),
+        PerCoreHistogram::GetPercentile(counts, 0.999));
+}
+
+TEST(PerCoreHistogram, GetPercentile_testIfZeroIsReturnedWithoutValues)
+{
+    // Given
+    PerCoreHistogram histogram;
+
+    // When
+    std::vector<uint64_t> counts = histogram.CollectInterval();
+
+    // Then
+    EXPECT_EQ(0, PerCoreHistogram::GetPercentile(counts, 0.99));
+    EXPECT_EQ(0, PerCoreHistogram::GetMax(counts));
+}
+
+TEST(PerCoreHistogram, Record_testIfValuesFromSeveralThreadsAreCounted)
+{
+    // Given
+    PerCoreHistogram histogram;
+    const int numThreads = 8;
+    const int numValuesPerThread = 10000;
+
+    // When
+    std::vector<std::thread> threads;
+    for (int index = 0; index < numThreads; index++)
+    {
+        threads.push_back(std::thread([&]()
+        {
+            for (int count = 0; count < numValuesPerThread; count++)
+            {
+                histogram.Record(count);
+            }
+        }));
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Then
+    std::vector<uint64_t> counts = histogram.CollectInterval();
+    EXPECT_EQ(numThreads * numValuesPerThread, PerCoreHistogram::GetTotalCount(counts));
+}
+
+TEST(PerCoreHistogram, Record_testIfValuesOfMoreThreadsThanWritersAreCounted)
+{
+    // Given
+    PerCoreHistogram histogram;
+    const uint32_t numThreads = PerCoreHistogram::MAX_WRITERS + 8;
+
+    // When: the last threads share one shard
+    std::vector<std::thread> threads;
+    for (uint32_t index = 0; index < numThreads; index++)
+    {
+        threads.push_back(std::thread([&]()
+        {
+            for (int count = 0; count < 100; count++)
+            {
+                histogram.Record(count);
+            }
+        }));
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Then
+    EXPECT_EQ(numThreads * 100, PerCoreHistogram::GetTotalCount(histogram.Collect()));
+}
+
+TEST(PerCoreHistogram, Merge_testIfCountsOfTwoHistogramsAreAdded)
+{
+    // Given
+    PerCoreHistogram first;
+    PerCoreHistogram second;
+    first.Record(10);
+    second.Record(10);
+    second.Record(3000);
+
+    // When
+    std::vector<uint64_t> counts = first.Collect();
+    PerCoreHistogram::Merge(counts, second.Collect());
+
+    // Then
+    EXPECT_EQ(3, PerCoreHistogram::GetTotalCount(counts));
+    EXPECT_EQ(2, counts[PerCoreHistogram::GetBucketIndex(10)]);
+    EXPECT_EQ(PerCoreHistogram::GetBucketUpperBound(PerCoreHistogram::GetBucketIndex(3000)),
+        PerCoreHistogram::GetMax(counts));
+}
+
+TEST(PerCoreHistogram, GetInterval_testIfOnlyValuesBetweenTwoCollectionsAreCounted)
+{
+    // Given: two readers of one histogram, one of them without a previous collection
+    PerCoreHistogram histogram;
+    histogram.Record(5000);
+    std::vector<uint64_t> windowStart = histogram.Collect();
+    histogram.Record(10);
+    histogram.Record(10);
+
+    // When
+    std::vector<uint64_t> now = histogram.Collect();
+    std::vector<uint64_t> window = PerCoreHistogram::GetInterval(windowStart, now);
+    std::vector<uint64_t> all = PerCoreHistogram::GetInterval(std::vector<uint64_t>(), now);
+
+    // Then
+    EXPECT_EQ(2, PerCoreHistogram::GetTotalCount(window));
+    EXPECT_EQ(2, window[PerCoreHistogram::GetBucketIndex(10)]);
+    EXPECT_EQ(3, PerCoreHistogram::GetTotalCount(all));
+}
+
+} // namespace pos
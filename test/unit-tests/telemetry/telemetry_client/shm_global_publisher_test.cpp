@@ -0,0 +1,127 @@
+#include "src/telemetry/telemetry_client/shm_global_publisher.h"
+
+#include <fcntl.h>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <string>
+
+#include "test/unit-tests/telemetry/telemetry_client/i_global_publisher_mock.h"
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+static const char* TEST_SHM_PATH = "/tmp/pos_telemetry_shm_test";
+
+static ShmMetricSlot*
+FindSlot(ShmMetricTableHeader* header, std::string key)
+{
+    ShmMetricSlot* slots = reinterpret_cast<ShmMetricSlot*>(header + 1);
+    uint32_t used = header->usedSlotCount.load();
+    for (uint32_t idx = 0; idx < used; idx++)
+    {
+        if (std::string(slots[idx].key, slots[idx].keyLength) == key)
+        {
+            return &slots[idx];
+        }
+    }
+    return nullptr;
+}
+
+TEST(ShmGlobalPublisher, PublishToServer_testIfCountersAccumulateAndGaugesAreOverwritten)
+{
+    ShmGlobalPublisher publisher(TEST_SHM_PATH, 16);
+    ASSERT_TRUE(publisher.IsMapped());
+    MetricLabelMap defaultLabels{{"array_name", "POSArray"}};
+
+    for (int round = 0; round < 2; round++)
+    {
+        POSMetricVector metrics;
+        POSMetric counter("test_counter", MT_COUNT);
+        counter.SetCountValue(3 + round);
+        POSMetric gauge("test_gauge", MT_GAUGE);
+        gauge.SetGaugeValue(round == 0 ? 5 : -2);
+        metrics.push_back(counter);
+        metrics.push_back(gauge);
+        EXPECT_EQ(0, publisher.PublishToServer(&defaultLabels, &metrics));
+    }
+
+    // map the table the way pos-exporter does
+    size_t size = sizeof(ShmMetricTableHeader) + sizeof(ShmMetricSlot) * 16;
+    int fd = open(TEST_SHM_PATH, O_RDONLY);
+    ASSERT_GE(fd, 0);
+    void* addr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    ASSERT_NE(MAP_FAILED, addr);
+    ShmMetricTableHeader* header = static_cast<ShmMetricTableHeader*>(addr);
+
+    EXPECT_EQ(SHM_METRIC_TABLE_MAGIC, header->magic);
+    EXPECT_EQ(16u, header->slotCount);
+    EXPECT_EQ(2u, header->usedSlotCount.load());
+    ShmMetricSlot* counterSlot = FindSlot(header, "test_counter\narray_name=POSArray");
+    ShmMetricSlot* gaugeSlot = FindSlot(header, "test_gauge\narray_name=POSArray");
+    ASSERT_NE(nullptr, counterSlot);
+    ASSERT_NE(nullptr, gaugeSlot);
+    EXPECT_EQ(7u, counterSlot->value.load());
+    EXPECT_EQ(-2, static_cast<int64_t>(gaugeSlot->value.load()));
+    EXPECT_EQ(4u, counterSlot->sequence.load());
+
+    munmap(addr, size);
+    close(fd);
+    unlink(TEST_SHM_PATH);
+}
+
+TEST(ShmGlobalPublisher, PublishToServer_testIfHistogramIsHandedToFallback)
+{
+    NiceMock<MockIGlobalPublisher>* fallback = new NiceMock<MockIGlobalPublisher>;
+    ShmGlobalPublisher publisher(TEST_SHM_PATH, 16, fallback);
+    POSHistogramValue histogram({10, 100});
+    POSMetricVector metrics;
+    POSMetric gauge("test_gauge", MT_GAUGE);
+    POSMetric hist("test_histogram", MT_HISTOGRAM);
+    hist.SetHistogramValue(&histogram);
+    metrics.push_back(gauge);
+    metrics.push_back(hist);
+
+    EXPECT_CALL(*fallback, PublishToServer(_, _))
+        .WillOnce([](MetricLabelMap* defaultLabelList, POSMetricVector* metricList)
+        {
+            EXPECT_EQ(1u, metricList->size());
+            EXPECT_EQ(MT_HISTOGRAM, metricList->front().GetType());
+            return 0;
+        });
+
+    EXPECT_EQ(0, publisher.PublishToServer(nullptr, &metrics));
+    EXPECT_EQ(1u, publisher.GetUsedSlotCount());
+    unlink(TEST_SHM_PATH);
+}
+
+TEST(ShmGlobalPublisher, PublishToServer_testIfMetricIsDroppedWhenTableIsFull)
+{
+    ShmGlobalPublisher publisher(TEST_SHM_PATH, 1);
+    POSMetricVector metrics;
+    metrics.push_back(POSMetric("first", MT_GAUGE));
+    metrics.push_back(POSMetric("second", MT_GAUGE));
+    metrics.push_back(POSMetric(std::string(SHM_METRIC_KEY_CAPACITY + 1, 'a'), MT_GAUGE));
+
+    publisher.PublishToServer(nullptr, &metrics);
+
+    EXPECT_EQ(1u, publisher.GetUsedSlotCount());
+    EXPECT_EQ(2u, publisher.GetDroppedCount());
+    unlink(TEST_SHM_PATH);
+}
+
+TEST(ShmGlobalPublisher, BuildKey_testIfLabelsAreSortedAndOverrideDefaults)
+{
+    MetricLabelMap defaultLabels{{"publisher_name", "io"}, {"array_name", "POSArray"}};
+    MetricLabelMap labels{{"volume_id", "3"}, {"array_name", "other"}};
+
+    EXPECT_EQ("metric\narray_name=other\npublisher_name=io\nvolume_id=3",
+        ShmGlobalPublisher::BuildKey("metric", &defaultLabels, &labels));
+    EXPECT_EQ("metric", ShmGlobalPublisher::BuildKey("metric", nullptr, nullptr));
+}
+} // namespace pos
@@ -0,0 +1,24 @@
+#include <gmock/gmock.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "src/telemetry/telemetry_client/telemetry_metric_registry.h"
+
+namespace pos
+{
+class MockTelemetryMetricRegistry : public TelemetryMetricRegistry
+{
+public:
+    using TelemetryMetricRegistry::TelemetryMetricRegistry;
+    MOCK_METHOD(void, Initialize, (ConfigManager* config, const cpu_set_t& generalCpuSet), (override));
+    MOCK_METHOD(MetricHandle, RegisterCounter, (const std::string& id), (override));
+    MOCK_METHOD(MetricHandle, RegisterCounter, (const std::string& id, const MetricLabels& labels), (override));
+    MOCK_METHOD(MetricHandle, RegisterGauge, (const std::string& id), (override));
+    MOCK_METHOD(MetricHandle, RegisterGauge, (const std::string& id, const MetricLabels& labels), (override));
+    MOCK_METHOD(POSMetricVector*, Collect, (), (override));
+    MOCK_METHOD(void, PublishAll, (), (override));
+};
+
+} // namespace pos
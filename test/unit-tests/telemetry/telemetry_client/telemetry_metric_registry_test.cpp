@@ -0,0 +1,127 @@
+#include "src/telemetry/telemetry_client/telemetry_metric_registry.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "test/unit-tests/telemetry/telemetry_client/telemetry_publisher_mock.h"
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+TEST(TelemetryMetricRegistry, Register_testIfTheSameMetricIsInternedToTheSameHandle)
+{
+    NiceMock<MockTelemetryPublisher> tp;
+    ON_CALL(tp, IsToPublish).WillByDefault(Return(true));
+    TelemetryMetricRegistry registry(&tp);
+
+    MetricHandle counter = registry.RegisterCounter("test_counter");
+    MetricHandle labeled = registry.RegisterCounter("test_counter", MetricLabels{{"array", "0"}});
+    MetricHandle gauge = registry.RegisterGauge("test_gauge");
+
+    EXPECT_NE(counter, labeled);
+    EXPECT_NE(counter, gauge);
+    EXPECT_EQ(counter, registry.RegisterCounter("test_counter"));
+    EXPECT_EQ(labeled, registry.RegisterCounter("test_counter", MetricLabels{{"array", "0"}}));
+    EXPECT_EQ(3u, registry.GetRegisteredCount());
+}
+
+TEST(TelemetryMetricRegistry, Register_testIfInvalidHandleIsReturnedForTypeMismatch)
+{
+    NiceMock<MockTelemetryPublisher> tp;
+    TelemetryMetricRegistry registry(&tp);
+
+    registry.RegisterCounter("test");
+
+    EXPECT_EQ(static_cast<MetricHandle>(TelemetryMetricRegistry::INVALID_METRIC_HANDLE),
+        registry.RegisterGauge("test"));
+}
+
+TEST(TelemetryMetricRegistry, Add_testIfCountersOfAllThreadsAreSummedUp)
+{
+    NiceMock<MockTelemetryPublisher> tp;
+    TelemetryMetricRegistry registry(&tp);
+    MetricHandle handle = registry.RegisterCounter("test");
+    const uint32_t THREAD_CNT = 4;
+    const uint32_t ADD_CNT = 1000;
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < THREAD_CNT; i++)
+    {
+        threads.emplace_back([&registry, handle]() {
+            for (uint32_t j = 0; j < ADD_CNT; j++)
+            {
+                registry.Add(handle);
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    EXPECT_EQ(THREAD_CNT * ADD_CNT, registry.GetCounterValue(handle));
+}
+
+TEST(TelemetryMetricRegistry, Add_testIfInvalidHandleIsIgnored)
+{
+    NiceMock<MockTelemetryPublisher> tp;
+    TelemetryMetricRegistry registry(&tp);
+
+    registry.Add(TelemetryMetricRegistry::INVALID_METRIC_HANDLE, 10);
+    registry.Set(TelemetryMetricRegistry::INVALID_METRIC_HANDLE, 10);
+
+    EXPECT_EQ(0u, registry.GetCounterValue(TelemetryMetricRegistry::INVALID_METRIC_HANDLE));
+}
+
+TEST(TelemetryMetricRegistry, Collect_testIfOnlyChangedMetricsToPublishAreCollected)
+{
+    NiceMock<MockTelemetryPublisher> tp;
+    ON_CALL(tp, IsToPublish("counter")).WillByDefault(Return(true));
+    ON_CALL(tp, IsToPublish("gauge")).WillByDefault(Return(true));
+    ON_CALL(tp, IsToPublish("filtered")).WillByDefault(Return(false));
+    TelemetryMetricRegistry registry(&tp);
+    MetricHandle counter = registry.RegisterCounter("counter");
+    MetricHandle gauge = registry.RegisterGauge("gauge");
+    MetricHandle filtered = registry.RegisterCounter("filtered");
+
+    registry.Add(counter, 3);
+    registry.Set(gauge, -5);
+    registry.Add(filtered, 1);
+    POSMetricVector* first = registry.Collect();
+    ASSERT_EQ(2u, first->size());
+    EXPECT_EQ("counter", (*first)[0].GetName());
+    EXPECT_EQ(3u, (*first)[0].GetCountValue());
+    EXPECT_EQ(-5, (*first)[1].GetGaugeValue());
+    delete first;
+
+    registry.Add(counter, 2);
+    POSMetricVector* second = registry.Collect();
+    ASSERT_EQ(1u, second->size());
+    EXPECT_EQ(5u, (*second)[0].GetCountValue());
+    delete second;
+}
+
+TEST(TelemetryMetricRegistry, PublishAll_testIfTheMetricsArePublishedInOneList)
+{
+    NiceMock<MockTelemetryPublisher> tp;
+    ON_CALL(tp, IsToPublish).WillByDefault(Return(true));
+    TelemetryMetricRegistry registry(&tp);
+    registry.Add(registry.RegisterCounter("a"));
+    registry.Add(registry.RegisterCounter("b"));
+
+    EXPECT_CALL(tp, PublishMetricList).WillOnce([](POSMetricVector* metricList) {
+        EXPECT_EQ(2u, metricList->size());
+        delete metricList;
+        return 0;
+    });
+    registry.PublishAll();
+
+    EXPECT_CALL(tp, PublishMetricList).Times(0);
+    registry.PublishAll();
+}
+} // namespace pos
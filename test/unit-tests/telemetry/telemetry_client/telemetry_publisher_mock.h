@@ -21,7 +21,9 @@ public:
     MOCK_METHOD(int, PublishData, (std::string id_, POSMetricValue value_, POSMetricTypes type_), (override));
     MOCK_METHOD(int, PublishMetric, (POSMetric metric), (override));
     MOCK_METHOD(int, PublishMetricList, (POSMetricVector* metricList), (override));
+    MOCK_METHOD(int, PublishHistogram, (std::string id, PerCoreHistogram* histogram, const MetricLabelMap& labels), (override));
     MOCK_METHOD(void, SetGlobalPublisher, (IGlobalPublisher * gp), (override));
+    MOCK_METHOD(bool, IsToPublish, (std::string metricId), (override));
 };
 
 } // namespace pos
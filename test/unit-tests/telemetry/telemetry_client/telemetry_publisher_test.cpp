@@ -175,4 +175,44 @@ TEST(TelemetryPublisher, PublishData_TestHistogramValue)
     delete igp;
 }
 
+TEST(TelemetryPublisher, PublishHistogram_TestQuantilesArePublishedAsGauges)
+{
+    // given
+    TelemetryPublisher tp("hist");
+    NiceMock<MockIGlobalPublisher>* igp = new NiceMock<MockIGlobalPublisher>();
+    tp.SetGlobalPublisher(igp);
+    tp.StartPublishing();
+    PerCoreHistogram histogram;
+    for (int i = 0; i < 100; i++)
+    {
+        histogram.Record(10);
+    }
+
+    // then
+    EXPECT_CALL(*igp, PublishToServer).WillOnce([](MetricLabelMap* defaultLabelList, POSMetricVector* metricList)
+    {
+        EXPECT_EQ(4, metricList->size());
+        for (auto& metric : *metricList)
+        {
+            EXPECT_EQ("latency", metric.GetName());
+            EXPECT_EQ(MT_GAUGE, metric.GetType());
+            EXPECT_EQ(1, metric.GetLabelList()->count("quantile"));
+            EXPECT_EQ("0", (*metric.GetLabelList())["array_id"]);
+        }
+        EXPECT_EQ(PerCoreHistogram::GetBucketUpperBound(PerCoreHistogram::GetBucketIndex(10)),
+            (*metricList)[0].GetGaugeValue());
+        return 0;
+    });
+
+    // when
+    MetricLabelMap labels = {{"array_id", "0"}};
+    int ret = tp.PublishHistogram("latency", &histogram, labels);
+    EXPECT_EQ(0, ret);
+
+    // nothing is recorded since then
+    ret = tp.PublishHistogram("latency", &histogram, labels);
+    EXPECT_EQ(-1, ret);
+    delete igp;
+}
+
 } // namespace pos
@@ -0,0 +1,90 @@
+#include "src/trace/flight_recorder.h"
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <vector>
+
+namespace pos
+{
+static const char* TEST_DUMP_PATH = "/tmp/flight_recorder_test.bin";
+
+static std::vector<FlightEvent>
+ReadDump(const char* path, FlightRecorderDumpHeader& header)
+{
+    std::vector<FlightEvent> events;
+    FILE* file = fopen(path, "rb");
+    EXPECT_NE(nullptr, file);
+    EXPECT_EQ(1u, fread(&header, sizeof(header), 1, file));
+    for (uint32_t ring = 0; ring < header.ringCount; ring++)
+    {
+        uint32_t ringHeader[2];
+        EXPECT_EQ(1u, fread(ringHeader, sizeof(ringHeader), 1, file));
+        EXPECT_EQ(ring, ringHeader[0]);
+        for (uint32_t index = 0; index < ringHeader[1]; index++)
+        {
+            FlightEvent event;
+            EXPECT_EQ(1u, fread(&event, sizeof(event), 1, file));
+            events.push_back(event);
+        }
+    }
+    fclose(file);
+    return events;
+}
+
+TEST(FlightRecorder, FlightRecorder_testIfEventsPerRingIsRoundedUpToPowerOfTwo)
+{
+    FlightRecorder recorder(2, 1000);
+
+    EXPECT_EQ(2u, recorder.GetRingCount());
+    EXPECT_EQ(1024u, recorder.GetEventsPerRing());
+}
+
+TEST(FlightRecorder, Dump_testIfOnlyTheMostRecentEventsAreDumpedOldestFirst)
+{
+    // a single ring so that the events of this thread land in it
+    FlightRecorder recorder(1, 4);
+    for (uint32_t index = 0; index < 6; index++)
+    {
+        recorder.Record(FlightEventType::IoComplete, 1, index, 100 + index, 10 * index, 1);
+    }
+
+    EXPECT_EQ(4, recorder.Dump(TEST_DUMP_PATH));
+
+    FlightRecorderDumpHeader header;
+    std::vector<FlightEvent> events = ReadDump(TEST_DUMP_PATH, header);
+    EXPECT_EQ(static_cast<uint64_t>(FlightRecorder::DUMP_MAGIC), header.magic);
+    EXPECT_EQ(sizeof(FlightEvent), header.eventSize);
+    ASSERT_EQ(4u, events.size());
+    for (uint32_t index = 0; index < 4; index++)
+    {
+        EXPECT_EQ(static_cast<uint8_t>(FlightEventType::IoComplete), events[index].type);
+        EXPECT_EQ(1, events[index].arrayId);
+        EXPECT_EQ(1, events[index].direction);
+        EXPECT_EQ(index + 2, events[index].arg0);
+        EXPECT_EQ(102u + index, events[index].arg1);
+        EXPECT_EQ(10u * (index + 2), events[index].arg2);
+    }
+    EXPECT_LE(events[0].timestampNs, events[3].timestampNs);
+    unlink(TEST_DUMP_PATH);
+}
+
+TEST(FlightRecorder, Record_testIfNothingIsRecordedWhenDisabled)
+{
+    FlightRecorder recorder(1, 4);
+    recorder.SetEnabled(false);
+
+    recorder.Record(FlightEventType::CheckpointStart, 0, 3);
+
+    EXPECT_EQ(0, recorder.Dump(TEST_DUMP_PATH));
+    unlink(TEST_DUMP_PATH);
+}
+
+TEST(FlightRecorder, Dump_testIfFailureIsReturnedForInvalidPath)
+{
+    FlightRecorder recorder(1, 4);
+
+    EXPECT_EQ(-1, recorder.Dump("/nonexistent_dir/flight_recorder.bin"));
+}
+} // namespace pos
@@ -0,0 +1,110 @@
+#include "src/trace/io_stage_tracer.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "test/unit-tests/master_context/config_manager_mock.h"
+#include "test/unit-tests/telemetry/telemetry_client/easy_telemetry_publisher_mock.h"
+#include "test/unit-tests/trace/trace_exporter_mock.h"
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace pos
+{
+TEST(IoStageTracer, Sample_testIfNothingIsSampledByDefault)
+{
+    IoStageTracer tracer;
+
+    for (int i = 0; i < 10; i++)
+    {
+        EXPECT_EQ(nullptr, tracer.Sample(0, 0, 0, 4096));
+    }
+}
+
+TEST(IoStageTracer, Sample_testIfOneOfEveryNIosIsSampled)
+{
+    IoStageTracer tracer;
+    tracer.SetSampleRate(4);
+
+    int sampled = 0;
+    for (int i = 0; i < 16; i++)
+    {
+        IoStageTraceSmartPtr trace = tracer.Sample(0, 1, 8, 4096);
+        if (trace != nullptr)
+        {
+            sampled++;
+            EXPECT_NE(0u, trace->GetTimestamp(IoStage::Submitted));
+            EXPECT_EQ(0u, trace->GetTimestamp(IoStage::Completed));
+            EXPECT_EQ(1u, trace->volumeId);
+        }
+    }
+
+    EXPECT_EQ(4, sampled);
+}
+
+TEST(IoStageTracer, Init_testIfSamplingIsDisabledWhenTheRateIsNotConfigured)
+{
+    NiceMock<MockConfigManager> config;
+    ON_CALL(config, GetValue).WillByDefault(Return(-1));
+    IoStageTracer tracer;
+
+    tracer.Init(&config, nullptr, nullptr);
+
+    EXPECT_EQ(0u, tracer.GetSampleRate());
+}
+
+TEST(IoStageTracer, Flush_testIfTheStageLatenciesArePublished)
+{
+    NiceMock<MockConfigManager> config;
+    NiceMock<MockEasyTelemetryPublisher> tp(nullptr);
+    ON_CALL(config, GetValue).WillByDefault(Return(-1));
+    IoStageTracer tracer;
+    tracer.Init(&config, nullptr, &tp);
+    tracer.SetSampleRate(1);
+
+    IoStageTraceSmartPtr trace = tracer.Sample(0, 0, 0, 4096);
+    ASSERT_NE(nullptr, trace);
+    trace->Mark(IoStage::RbaLocked);
+    trace->Mark(IoStage::BufferAllocated);
+    tracer.Finish(trace);
+
+    // rba_lock, write_buffer_allocation and completion, with 4 percentiles each
+    EXPECT_CALL(tp, UpdateGauge(_, _, _)).Times(12);
+    tracer.Flush();
+
+    EXPECT_CALL(tp, UpdateGauge(_, _, _)).Times(0);
+    tracer.Flush();
+}
+
+TEST(IoStageTracer, Flush_testIfTheSampledIoIsExportedAsASpanPerStage)
+{
+    NiceMock<MockConfigManager> config;
+    NiceMock<MockTraceExporter> exporter(nullptr);
+    ON_CALL(config, GetValue).WillByDefault(Return(-1));
+    ON_CALL(exporter, IsEnabled).WillByDefault(Return(true));
+    IoStageTracer tracer;
+    tracer.Init(&config, &exporter, nullptr);
+    tracer.SetSampleRate(1);
+
+    IoStageTraceSmartPtr trace = tracer.Sample(0, 2, 16, 8192);
+    trace->Mark(IoStage::UramWritten);
+    trace->Mark(IoStage::JournalWritten);
+    tracer.Finish(trace);
+
+    EXPECT_CALL(exporter, ExportStagedSpan("write", trace->GetTimestamp(IoStage::Submitted),
+        trace->GetTimestamp(IoStage::Completed), _, _))
+        .WillOnce([](std::string name, uint64_t startNs, uint64_t endNs,
+                      const std::vector<TraceStage>& stages, const TraceAttributes& attributes) {
+            ASSERT_EQ(3u, stages.size());
+            EXPECT_EQ("uram_write", stages[0].name);
+            EXPECT_EQ(startNs, stages[0].startNs);
+            EXPECT_EQ("journal_write", stages[1].name);
+            EXPECT_EQ(stages[0].endNs, stages[1].startNs);
+            EXPECT_EQ("completion", stages[2].name);
+            EXPECT_EQ(endNs, stages[2].endNs);
+        });
+    tracer.Flush();
+}
+} // namespace pos
@@ -11,6 +11,8 @@ public:
     using TraceExporter::TraceExporter;
     MOCK_METHOD(void, Init, (std::string serviceName, std::string serviceVersion, std::string endPoint), (override));
     MOCK_METHOD(bool, IsEnabled, (), (override));
+    MOCK_METHOD(void, ExportStagedSpan, (std::string name, uint64_t startNs, uint64_t endNs,
+        const std::vector<TraceStage>& stages, const TraceAttributes& attributes), (override));
 
 };
 
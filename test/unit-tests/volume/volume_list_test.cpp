@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include "src/volume/volume.h"
+
 namespace pos
 {
 TEST(VolumeList, VolumeList_)
@@ -44,4 +46,21 @@ TEST(VolumeList, _NewID_)
 {
 }
 
+TEST(VolumeList, GetIdSnapshot_testIfTakenSnapshotIsKeptWhileListChanges)
+{
+    // Given
+    VolumeList volumes;
+    volumes.Add(new Volume(0, "array", DataAttribute::UserData, "vol0", 1024, 0xFFFF));
+    volumes.Add(new Volume(0, "array", DataAttribute::UserData, "vol1", 1024, 0xFFFF));
+    std::shared_ptr<const std::vector<int>> before = volumes.GetIdSnapshot();
+
+    // When
+    volumes.Remove(0);
+    volumes.Add(new Volume(0, "array", DataAttribute::UserData, "vol2", 1024, 0xFFFF), 5);
+
+    // Then
+    EXPECT_EQ((std::vector<int>{0, 1}), *before);
+    EXPECT_EQ((std::vector<int>{1, 5}), *volumes.GetIdSnapshot());
+}
+
 } // namespace pos
@@ -24,6 +24,7 @@ public:
     MOCK_METHOD(int, UpdateReplicationState, (std::string name, ReplicationState state), (override));
     MOCK_METHOD(int, UpdateReplicationRole, (std::string name, ReplicationRole nodeProperty), (override));
     MOCK_METHOD(int, Rename, (std::string oldname, std::string newname), (override));
+    MOCK_METHOD(int, Resize, (std::string name, uint64_t newSize), (override));
     MOCK_METHOD(void, DetachVolumes, (), (override));
     MOCK_METHOD(int, GetVolumeName, (int volId, std::string& volName), (override));
     MOCK_METHOD(int, GetVolumeID, (std::string volName), (override));
@@ -0,0 +1,92 @@
+#include "src/volume/volume_meta_writer.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+#include <vector>
+
+#include "src/include/pos_event_id.h"
+
+namespace pos
+{
+TEST(VolumeMetaWriter, Save_testIfContentsAreWrittenWithoutStart)
+{
+    // Given
+    std::vector<std::string> written;
+    VolumeMetaWriter writer("array", 0,
+        [&](const std::string& contents)
+        {
+            written.push_back(contents);
+            return (int)EID(SUCCESS);
+        });
+
+    // When
+    int ret = writer.Save("vol1");
+
+    // Then
+    EXPECT_EQ(EID(SUCCESS), ret);
+    ASSERT_EQ(1, written.size());
+    EXPECT_EQ("vol1", written[0]);
+}
+
+TEST(VolumeMetaWriter, Wait_testIfSavesDuringWriteAreCoalesced)
+{
+    // Given: the first write is held until the others are submitted
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::promise<void> firstWriteStarted;
+    std::atomic<int> numCalls(0);
+    std::vector<std::string> written;
+    VolumeMetaWriter writer("array", 0,
+        [&](const std::string& contents)
+        {
+            if (numCalls++ == 0)
+            {
+                firstWriteStarted.set_value();
+                released.wait();
+            }
+            written.push_back(contents);
+            return (int)EID(SUCCESS);
+        });
+    writer.Start();
+    uint64_t first = writer.Submit("v1");
+    firstWriteStarted.get_future().wait();
+
+    // When
+    uint64_t second = writer.Submit("v2");
+    uint64_t third = writer.Submit("v3");
+    release.set_value();
+
+    // Then
+    EXPECT_EQ(EID(SUCCESS), writer.Wait(first));
+    EXPECT_EQ(EID(SUCCESS), writer.Wait(second));
+    EXPECT_EQ(EID(SUCCESS), writer.Wait(third));
+    writer.Stop();
+    ASSERT_EQ(2, written.size());
+    EXPECT_EQ("v3", written[1]);
+    EXPECT_EQ(2, writer.GetNumWrites());
+}
+
+TEST(VolumeMetaWriter, Wait_testIfFailedSaveIsCoveredByLaterSuccess)
+{
+    // Given
+    int numCalls = 0;
+    VolumeMetaWriter writer("array", 0,
+        [&](const std::string& contents)
+        {
+            return (numCalls++ == 0) ? (int)EID(VOL_UNABLE_TO_SAVE_WRITE_FAILED) : (int)EID(SUCCESS);
+        });
+
+    // When
+    uint64_t first = writer.Submit("v1");
+    int firstRet = writer.Wait(first);
+    uint64_t second = writer.Submit("v2");
+
+    // Then
+    EXPECT_EQ(EID(VOL_UNABLE_TO_SAVE_WRITE_FAILED), firstRet);
+    EXPECT_EQ(EID(SUCCESS), writer.Wait(second));
+    EXPECT_EQ(EID(SUCCESS), writer.Wait(first));
+}
+
+} // namespace pos
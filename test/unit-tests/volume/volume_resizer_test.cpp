@@ -0,0 +1,87 @@
+#include "src/volume/volume_resizer.h"
+
+#include "src/include/pos_event_id.h"
+#include "src/volume/volume.h"
+#include "src/volume/volume_base.h"
+#include "src/volume/volume_list.h"
+#include "test/unit-tests/sys_event/volume_event_publisher_mock.h"
+
+#include <gtest/gtest.h>
+
+using ::testing::_;
+using ::testing::NiceMock;
+
+namespace pos
+{
+TEST(VolumeResizer, Do_nullvol)
+{
+    // Given
+    std::string arrayName = "";
+    int arrayID = 0;
+    std::string name = "volumetest";
+    uint64_t newSize = 2 * 1024 * 1024;
+
+    VolumeList volumes;
+    NiceMock<MockVolumeEventPublisher> volumeEventPublisher;
+
+    int expected = EID(RESIZE_VOL_NAME_DOES_NOT_EXIST);
+
+    // When
+    VolumeResizer volumeResizer(volumes, arrayName, arrayID, &volumeEventPublisher);
+    int actual = volumeResizer.Do(name, newSize);
+
+    // Then
+    ASSERT_EQ(actual, expected);
+}
+
+TEST(VolumeResizer, Do_sizeNotLarger)
+{
+    // Given
+    std::string arrayName = "";
+    int arrayID = 0;
+    std::string name = "volumetest";
+    uint64_t size = 2 * 1024 * 1024;
+
+    VolumeList volumes;
+    VolumeBase* vol = new Volume(arrayID, arrayName, DataAttribute::UserData, name, size, 0xFFFF);
+    volumes.Add(vol);
+    NiceMock<MockVolumeEventPublisher> volumeEventPublisher;
+
+    int expected = EID(RESIZE_VOL_SIZE_NOT_LARGER);
+
+    // When
+    VolumeResizer volumeResizer(volumes, arrayName, arrayID, &volumeEventPublisher);
+    EXPECT_CALL(volumeEventPublisher, NotifyVolumeResized(_, _)).Times(0);
+    int actual = volumeResizer.Do(name, size);
+
+    // Then
+    ASSERT_EQ(actual, expected);
+    ASSERT_EQ(vol->GetTotalSize(), size);
+}
+
+TEST(VolumeResizer, Do_sizeNotAligned)
+{
+    // Given
+    std::string arrayName = "";
+    int arrayID = 0;
+    std::string name = "volumetest";
+    uint64_t size = 2 * 1024 * 1024;
+
+    VolumeList volumes;
+    VolumeBase* vol = new Volume(arrayID, arrayName, DataAttribute::UserData, name, size, 0xFFFF);
+    volumes.Add(vol);
+    NiceMock<MockVolumeEventPublisher> volumeEventPublisher;
+
+    int expected = EID(CREATE_VOL_SIZE_NOT_ALIGNED);
+
+    // When
+    VolumeResizer volumeResizer(volumes, arrayName, arrayID, &volumeEventPublisher);
+    EXPECT_CALL(volumeEventPublisher, NotifyVolumeResized(_, _)).Times(0);
+    int actual = volumeResizer.Do(name, size + 4096);
+
+    // Then
+    ASSERT_EQ(actual, expected);
+    ASSERT_EQ(vol->GetTotalSize(), size);
+}
+
+} // namespace pos
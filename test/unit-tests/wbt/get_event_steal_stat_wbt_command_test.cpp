@@ -0,0 +1,15 @@
+#include "src/wbt/get_event_steal_stat_wbt_command.h"
+
+#include <gtest/gtest.h>
+
+namespace pos
+{
+TEST(GetEventStealStatWbtCommand, GetEventStealStatWbtCommand_)
+{
+}
+
+TEST(GetEventStealStatWbtCommand, Execute_)
+{
+}
+
+} // namespace pos
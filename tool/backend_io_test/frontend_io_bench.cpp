@@ -0,0 +1,461 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "tool/library_unit_test/library_unit_test.h"
+pos::LibraryUnitTest libraryUnitTest;
+
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "spdk/pos.h"
+#include "src/array_mgmt/array_manager.h"
+#include "src/include/memory.h"
+#include "src/io/frontend_io/unvmf_io_handler.h"
+#include "src/spdk_wrapper/accel_engine_api.h"
+#include "src/spdk_wrapper/event_framework_api.h"
+#include "src/spdk_wrapper/reactor_cycle_accounting.h"
+#include "src/telemetry/telemetry_client/per_core_histogram.h"
+
+// Submits pos_io straight to the host I/O handler of every reactor, as the
+// NVMe-oF target does, so that the storage engine is measured without the
+// network and initiator hosts.
+//
+// usage : ./frontend_io [workload options] <options of setup_ibofos_nvmf_volume.sh>
+//   --pattern=rand|seq   (default rand)
+//   --bs=<bytes>         (default 4096)
+//   --qd=<count>         outstanding I/Os per reactor (default 32)
+//   --read=<percent>     share of reads (default 100)
+//   --volumes=<count>    (default 1)
+//   --volume_size=<bytes> (default 2147483648)
+//   --time=<seconds>     (default 30)
+namespace pos
+{
+struct FrontendIoWorkload
+{
+    bool sequential = false;
+    uint32_t blockSize = 4096;
+    uint32_t queueDepth = 32;
+    uint32_t readPercent = 100;
+    uint32_t volumeCount = 1;
+    uint64_t volumeSize = 2147483648ULL;
+    uint32_t timeInSeconds = 30;
+};
+
+class FrontendIoBench;
+struct FrontendIoReactor;
+
+struct FrontendIoSlot
+{
+    pos_io posIo;
+    struct iovec iov;
+    uint64_t submitTick;
+    FrontendIoReactor* reactor;
+};
+
+// Everything but the counters read by the main thread is touched by its reactor only
+struct FrontendIoReactor
+{
+    FrontendIoBench* bench;
+    uint32_t core;
+    uint32_t index;
+    void* mem;
+    std::vector<FrontendIoSlot> slots;
+    std::vector<FrontendIoSlot*> freeSlots;
+    std::atomic<bool> kicked;
+    uint64_t nextOffset;
+    uint64_t regionStart;
+    uint64_t regionSize;
+    uint64_t random;
+    std::atomic<uint32_t> pending;
+    std::atomic<uint64_t> reads;
+    std::atomic<uint64_t> writes;
+    std::atomic<uint64_t> failed;
+    std::atomic<uint64_t> retried;
+};
+
+class FrontendIoBench
+{
+public:
+    explicit FrontendIoBench(const FrontendIoWorkload& workload)
+    : workload(workload),
+      running(false),
+      arrayId(0),
+      cycleAccounting(ReactorCycleAccountingSingleton::Instance())
+    {
+        arrayId = ArrayMgr()->GetInfo(arrayName)->arrayInfo->GetIndex();
+        uint32_t reactorCount = AccelEngineApi::GetReactorCount();
+        reactors.resize(reactorCount);
+        for (uint32_t index = 0; index < reactorCount; index++)
+        {
+            FrontendIoReactor& reactor = reactors[index];
+            reactor.bench = this;
+            reactor.core = static_cast<uint32_t>(AccelEngineApi::GetReactorByIndex(index));
+            reactor.index = index;
+            reactor.mem = pos::Memory<>::Alloc(workload.queueDepth * _BlocksPerIo());
+            reactor.slots.resize(workload.queueDepth);
+            reactor.kicked = false;
+            // sequential streams of the reactors do not overlap
+            reactor.regionSize = (workload.volumeSize / reactorCount) / workload.blockSize * workload.blockSize;
+            reactor.regionStart = reactor.regionSize * index;
+            reactor.nextOffset = 0;
+            reactor.random = 0x9E3779B97F4A7C15ULL * (index + 1);
+            reactor.pending = 0;
+            reactor.reads = 0;
+            reactor.writes = 0;
+            reactor.failed = 0;
+            reactor.retried = 0;
+            for (uint32_t slotIndex = 0; slotIndex < workload.queueDepth; slotIndex++)
+            {
+                FrontendIoSlot& slot = reactor.slots[slotIndex];
+                memset(&slot.posIo, 0, sizeof(slot.posIo));
+                slot.iov.iov_base = static_cast<char*>(reactor.mem) + slotIndex * _BlocksPerIo() * BLOCK_SIZE;
+                slot.iov.iov_len = workload.blockSize;
+                slot.posIo.volume_id = slotIndex % workload.volumeCount;
+                slot.posIo.array_id = arrayId;
+                slot.posIo.iov = &slot.iov;
+                slot.posIo.iovcnt = 1;
+                slot.posIo.length = workload.blockSize;
+                slot.posIo.context = &slot;
+                slot.posIo.arrayName = arrayName;
+                slot.posIo.complete_cb = _Complete;
+                slot.reactor = &reactor;
+                reactor.freeSlots.push_back(&slot);
+            }
+        }
+    }
+
+    ~FrontendIoBench(void)
+    {
+        for (FrontendIoReactor& reactor : reactors)
+        {
+            pos::Memory<>::Free(reactor.mem);
+        }
+    }
+
+    void
+    Run(void)
+    {
+        std::vector<ReactorCycleBreakdown> startCycles = cycleAccounting->GetBreakdown();
+        uint64_t startTick = cycleAccounting->GetTicks();
+        running = true;
+        for (FrontendIoReactor& reactor : reactors)
+        {
+            _Kick(reactor);
+        }
+        sleep(workload.timeInSeconds);
+        running = false;
+        for (FrontendIoReactor& reactor : reactors)
+        {
+            while (reactor.pending > 0 || reactor.kicked)
+            {
+                usleep(1000);
+            }
+        }
+        elapsedTicks = cycleAccounting->GetTicks() - startTick;
+        busyCycles = _GetBusyCycles(cycleAccounting->GetBreakdown()) - _GetBusyCycles(startCycles);
+    }
+
+    void
+    Report(void)
+    {
+        uint64_t hz = cycleAccounting->GetTicksHz();
+        double seconds = static_cast<double>(elapsedTicks) / hz;
+        uint64_t reads = 0, writes = 0, failed = 0, retried = 0;
+
+        printf("%-10s %12s %12s\n", "reactor", "read_iops", "write_iops");
+        for (FrontendIoReactor& reactor : reactors)
+        {
+            printf("%-10u %12.0f %12.0f\n", reactor.core, reactor.reads / seconds, reactor.writes / seconds);
+            reads += reactor.reads;
+            writes += reactor.writes;
+            failed += reactor.failed;
+            retried += reactor.retried;
+        }
+
+        uint64_t ios = reads + writes;
+        printf("pattern:%s bs:%u qd/reactor:%u read:%u%% volumes:%u reactors:%zu time:%.1fs\n",
+            workload.sequential ? "seq" : "rand", workload.blockSize, workload.queueDepth,
+            workload.readPercent, workload.volumeCount, reactors.size(), seconds);
+        printf("iops:%.0f (read:%.0f write:%.0f) bw:%.1fMiB/s failed:%lu retried:%lu\n",
+            ios / seconds, reads / seconds, writes / seconds,
+            ios * workload.blockSize / seconds / (1024 * 1024), failed, retried);
+        _ReportLatency("read", readLatency, hz);
+        _ReportLatency("write", writeLatency, hz);
+        // cycles which the reactors spent on the I/O path, polling excluded
+        if (ios > 0)
+        {
+            printf("cpu per io:%.2fus (reactor busy:%.1f%%)\n",
+                static_cast<double>(busyCycles) * 1000000 / hz / ios,
+                static_cast<double>(busyCycles) * 100 / (elapsedTicks * reactors.size()));
+        }
+    }
+
+private:
+    uint64_t
+    _BlocksPerIo(void)
+    {
+        return (workload.blockSize + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    }
+
+    static uint64_t
+    _GetBusyCycles(const std::vector<ReactorCycleBreakdown>& breakdown)
+    {
+        uint64_t cycles = 0;
+        for (const ReactorCycleBreakdown& reactor : breakdown)
+        {
+            cycles += reactor.cycles[(int)ReactorCycleType::HostSubmission];
+            cycles += reactor.cycles[(int)ReactorCycleType::IoCompletion];
+            cycles += reactor.cycles[(int)ReactorCycleType::ReactorEvent];
+            cycles += reactor.cycles[(int)ReactorCycleType::SharedEvent];
+        }
+        return cycles;
+    }
+
+    static void
+    _ReportLatency(const char* name, PerCoreHistogram& histogram, uint64_t hz)
+    {
+        std::vector<uint64_t> counts = histogram.Collect();
+        if (PerCoreHistogram::GetTotalCount(counts) == 0)
+        {
+            return;
+        }
+        double usPerTick = 1000000.0 / hz;
+        printf("%s latency(us) p50:%.1f p99:%.1f p99.9:%.1f p99.99:%.1f max:%.1f\n", name,
+            PerCoreHistogram::GetPercentile(counts, 0.5) * usPerTick,
+            PerCoreHistogram::GetPercentile(counts, 0.99) * usPerTick,
+            PerCoreHistogram::GetPercentile(counts, 0.999) * usPerTick,
+            PerCoreHistogram::GetPercentile(counts, 0.9999) * usPerTick,
+            PerCoreHistogram::GetMax(counts) * usPerTick);
+    }
+
+    // Completions only return their slots, the submission is deferred to an
+    // event so that a new I/O is not submitted within the completion of another
+    void
+    _Kick(FrontendIoReactor& reactor)
+    {
+        if (reactor.kicked == false)
+        {
+            reactor.kicked = true;
+            EventFrameworkApiSingleton::Instance()->SendSpdkEvent(reactor.core, _SubmitAll, &reactor, nullptr);
+        }
+    }
+
+    static void
+    _SubmitAll(void* arg1, void* arg2)
+    {
+        FrontendIoReactor* reactor = static_cast<FrontendIoReactor*>(arg1);
+        FrontendIoBench* bench = reactor->bench;
+        // slots retried within the submission wait for the next event
+        size_t count = reactor->freeSlots.size();
+        for (size_t submitted = 0; bench->running && submitted < count; submitted++)
+        {
+            FrontendIoSlot* slot = reactor->freeSlots.back();
+            reactor->freeSlots.pop_back();
+            bench->_Submit(*reactor, *slot);
+        }
+        reactor->kicked = false;
+        if (bench->running && reactor->freeSlots.empty() == false)
+        {
+            bench->_Kick(*reactor);
+        }
+    }
+
+    void
+    _Submit(FrontendIoReactor& reactor, FrontendIoSlot& slot)
+    {
+        uint64_t offset;
+        if (workload.sequential)
+        {
+            offset = reactor.regionStart + reactor.nextOffset;
+            reactor.nextOffset = (reactor.nextOffset + workload.blockSize) % reactor.regionSize;
+        }
+        else
+        {
+            offset = (_NextRandom(reactor) % (workload.volumeSize / workload.blockSize)) * workload.blockSize;
+        }
+        bool isRead = (_NextRandom(reactor) % 100) < workload.readPercent;
+        slot.posIo.ioType = isRead ? IO_TYPE::READ : IO_TYPE::WRITE;
+        slot.posIo.offset = offset;
+        slot.submitTick = cycleAccounting->GetTicks();
+        reactor.pending++;
+        UNVMfSubmitHandler(&slot.posIo);
+    }
+
+    static uint64_t
+    _NextRandom(FrontendIoReactor& reactor)
+    {
+        reactor.random ^= reactor.random << 13;
+        reactor.random ^= reactor.random >> 7;
+        reactor.random ^= reactor.random << 17;
+        return reactor.random;
+    }
+
+    static void
+    _Complete(struct pos_io* posIo, int status)
+    {
+        FrontendIoSlot* slot = static_cast<FrontendIoSlot*>(posIo->context);
+        FrontendIoReactor& reactor = *slot->reactor;
+        FrontendIoBench* bench = reactor.bench;
+        if (status == POS_IO_STATUS_RETRY)
+        {
+            reactor.retried++;
+        }
+        else if (status != POS_IO_STATUS_SUCCESS)
+        {
+            reactor.failed++;
+        }
+        else
+        {
+            uint64_t latency = bench->cycleAccounting->GetTicks() - slot->submitTick;
+            if (posIo->ioType == IO_TYPE::READ)
+            {
+                bench->readLatency.Record(latency);
+                reactor.reads++;
+            }
+            else
+            {
+                bench->writeLatency.Record(latency);
+                reactor.writes++;
+            }
+        }
+        reactor.freeSlots.push_back(slot);
+        reactor.pending--;
+        if (bench->running)
+        {
+            bench->_Kick(reactor);
+        }
+    }
+
+    char arrayName[32] = "POSArray";
+
+    FrontendIoWorkload workload;
+    std::atomic<bool> running;
+    uint32_t arrayId;
+    std::vector<FrontendIoReactor> reactors;
+    ReactorCycleAccounting* cycleAccounting;
+    PerCoreHistogram readLatency;
+    PerCoreHistogram writeLatency;
+    uint64_t elapsedTicks = 0;
+    uint64_t busyCycles = 0;
+};
+
+static bool
+ParseOption(const char* arg, const char* name, std::string& value)
+{
+    size_t length = strlen(name);
+    if (strncmp(arg, name, length) != 0 || arg[length] != '=')
+    {
+        return false;
+    }
+    value = std::string(arg + length + 1);
+    return true;
+}
+
+// Consumes the workload options and leaves the rest for the setup script
+static void
+ParseWorkload(int argc, char* argv[], FrontendIoWorkload& workload, std::vector<std::string>& setupArgs)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        std::string value;
+        if (ParseOption(argv[i], "--pattern", value))
+        {
+            workload.sequential = (value == "seq");
+        }
+        else if (ParseOption(argv[i], "--bs", value))
+        {
+            workload.blockSize = std::stoul(value);
+        }
+        else if (ParseOption(argv[i], "--qd", value))
+        {
+            workload.queueDepth = std::stoul(value);
+        }
+        else if (ParseOption(argv[i], "--read", value))
+        {
+            workload.readPercent = std::stoul(value);
+        }
+        else if (ParseOption(argv[i], "--volumes", value))
+        {
+            workload.volumeCount = std::stoul(value);
+        }
+        else if (ParseOption(argv[i], "--volume_size", value))
+        {
+            workload.volumeSize = std::stoull(value);
+        }
+        else if (ParseOption(argv[i], "--time", value))
+        {
+            workload.timeInSeconds = std::stoul(value);
+        }
+        else
+        {
+            setupArgs.push_back(argv[i]);
+        }
+    }
+    // a volume per subsystem, as in the setup script
+    setupArgs.push_back("-v");
+    setupArgs.push_back(std::to_string(workload.volumeCount));
+    setupArgs.push_back("-s");
+    setupArgs.push_back(std::to_string(workload.volumeCount));
+    setupArgs.push_back("-S");
+    setupArgs.push_back(std::to_string(workload.volumeSize) + "B");
+}
+} // namespace pos
+
+int
+main(int argc, char* argv[])
+{
+    pos::FrontendIoWorkload workload;
+    std::vector<std::string> setupArgs;
+    pos::ParseWorkload(argc, argv, workload, setupArgs);
+
+    std::vector<char*> setupArgv;
+    setupArgv.push_back(argv[0]);
+    for (std::string& arg : setupArgs)
+    {
+        setupArgv.push_back(&arg[0]);
+    }
+    libraryUnitTest.Initialize(setupArgv.size(), setupArgv.data(), "../../");
+
+    pos::FrontendIoBench bench(workload);
+    libraryUnitTest.TestStart(4);
+    bench.Run();
+    bench.Report();
+    libraryUnitTest.TestResult(4, true);
+    libraryUnitTest.SuccessAndExit();
+    return 0;
+}
@@ -0,0 +1,148 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Reports the cost of the per-block checksum (performance.block_checksum_enable)
+// on 4KB blocks, as GB/s and ns per block, for
+//  - memcpy   : copying the block once, for scale
+//  - software : table driven CRC32C
+//  - isa-l    : crc32_iscsi, which BlockChecksum uses (SSE4.2 crc32 / pclmul)
+// usage: ./checksum_benchmark [block_count] [iterations]
+
+#include <isa-l.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+
+static const uint32_t BLOCK_SIZE = 4096;
+static uint32_t crcTable[256];
+static volatile uint32_t sink;
+
+static void
+BuildTable(void)
+{
+    const uint32_t POLY = 0x82F63B78; // CRC32C, reflected
+    for (uint32_t i = 0; i < 256; i++)
+    {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 1) ? (crc >> 1) ^ POLY : (crc >> 1);
+        }
+        crcTable[i] = crc;
+    }
+}
+
+static uint32_t
+Crc32cSoftware(const uint8_t* buf, uint32_t size, uint32_t crc)
+{
+    for (uint32_t i = 0; i < size; i++)
+    {
+        crc = crcTable[(crc ^ buf[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+using BlockFunc = std::function<uint32_t(uint8_t*, uint8_t*)>;
+
+static double
+Measure(BlockFunc func, uint8_t* src, uint8_t* dst, uint32_t blockCount, uint32_t iterations)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        for (uint32_t block = 0; block < blockCount; block++)
+        {
+            sink ^= func(src + block * BLOCK_SIZE, dst + block * BLOCK_SIZE);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t blockCount = 256;
+    uint32_t iterations = 2000;
+    if (argc > 1)
+    {
+        blockCount = strtoul(argv[1], nullptr, 0);
+    }
+    if (argc > 2)
+    {
+        iterations = strtoul(argv[2], nullptr, 0);
+    }
+
+    BuildTable();
+    uint8_t* src = static_cast<uint8_t*>(aligned_alloc(4096, blockCount * BLOCK_SIZE));
+    uint8_t* dst = static_cast<uint8_t*>(aligned_alloc(4096, blockCount * BLOCK_SIZE));
+    for (uint64_t i = 0; i < static_cast<uint64_t>(blockCount) * BLOCK_SIZE; i++)
+    {
+        src[i] = static_cast<uint8_t>(rand());
+    }
+
+    uint8_t probe[] = "123456789";
+    uint32_t expected = 0xE3069283; // CRC32C check value
+    if ((Crc32cSoftware(probe, 9, 0xFFFFFFFF) ^ 0xFFFFFFFF) != expected ||
+        (crc32_iscsi(probe, 9, 0xFFFFFFFF) ^ 0xFFFFFFFF) != expected)
+    {
+        printf("crc32c self check failed\n");
+        return 1;
+    }
+
+    BlockFunc copy = [](uint8_t* s, uint8_t* d) { memcpy(d, s, BLOCK_SIZE); return d[0]; };
+    BlockFunc software = [](uint8_t* s, uint8_t*) { return Crc32cSoftware(s, BLOCK_SIZE, 0xFFFFFFFF); };
+    BlockFunc isal = [](uint8_t* s, uint8_t*) { return crc32_iscsi(s, BLOCK_SIZE, 0xFFFFFFFF); };
+    struct
+    {
+        const char* name;
+        BlockFunc func;
+    } kernels[] = {{"memcpy", copy}, {"software", software}, {"isa-l", isal}};
+
+    printf("block size: %u bytes, blocks: %u, iterations: %u\n", BLOCK_SIZE, blockCount, iterations);
+    printf("%-10s %12s %12s\n", "kernel", "throughput", "per block");
+    for (auto& kernel : kernels)
+    {
+        double sec = Measure(kernel.func, src, dst, blockCount, iterations);
+        double blocks = static_cast<double>(blockCount) * iterations;
+        printf("%-10s %8.2fGB/s %9.1fns\n", kernel.name,
+            blocks * BLOCK_SIZE / sec / 1e9, sec / blocks * 1e9);
+    }
+
+    free(src);
+    free(dst);
+    return 0;
+}
@@ -16,7 +16,7 @@ var ArrayCmd = &cobra.Command{
 	Long: `Array command for PoseidonOS. Use this command to create, delete, and control arrays.
 
 Syntax: 
-  poseidonos-cli array [create|delete|mount|unmount|list|addspare|rmspare|autocreate] [flags]
+  poseidonos-cli array [create|delete|mount|unmount|list|addspare|rmspare|autocreate|nvram-advice] [flags]
 
 Example (to create an array):
   poseidonos-cli array create --array-name array0 --buffer uram0 --data-devs nvme0,nvme1,nvme2,nvme3 --spare nvme4
@@ -39,6 +39,7 @@ func init() {
 	ArrayCmd.AddCommand(ReplaceArrayDeviceCmd)
 	ArrayCmd.AddCommand(AutocreateArrayCmd)
 	ArrayCmd.AddCommand(RebuildArrayCmd)
+	ArrayCmd.AddCommand(NvramAdviceCmd)
 }
 
 func isRAIDConstMet(numOfDataDevs int, raid string) bool {
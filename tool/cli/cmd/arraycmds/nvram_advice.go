@@ -0,0 +1,60 @@
+package arraycmds
+
+import (
+	"cli/cmd/displaymgr"
+	"cli/cmd/globals"
+	"cli/cmd/messages"
+	"cli/cmd/socketmgr"
+	"encoding/json"
+
+	"github.com/labstack/gommon/log"
+	"github.com/spf13/cobra"
+)
+
+var NvramAdviceCmd = &cobra.Command{
+	Use:   "nvram-advice",
+	Short: "Display the meta files worth keeping on NVRAM and the recommended NVRAM size.",
+	Long: `
+Display the meta files of an array that are small and accessed often enough
+to be kept on the NVRAM meta volume, and the NVRAM size that would hold them
+together with the files always kept on NVRAM. The I/Os of the meta files are
+counted only when metafs.placement_advisor_enable or
+metafs.auto_placement_enable is set.
+
+Syntax:
+	poseidonos-cli array nvram-advice (--array-name | -a) ArrayName
+
+Example:
+	poseidonos-cli array nvram-advice --array-name Array0
+          `,
+	Run: func(cmd *cobra.Command, args []string) {
+
+		var command = "METAFILEPLACEMENT"
+		uuid := globals.GenerateUUID()
+
+		param := messages.MetaFilePlacementParam{ARRAYNAME: nvram_advice_arrayName}
+		req := messages.BuildReqWithParam(command, uuid, param)
+		reqJson, err := json.Marshal(req)
+		if err != nil {
+			log.Fatalf("failed to marshal the request: %v", err)
+		}
+
+		displaymgr.PrintRequest(string(reqJson))
+
+		// Do not send request to server and print response when testing request build.
+		if !(globals.IsTestingReqBld) {
+			// This command is served by the socket server only
+			resJson := socketmgr.SendReqAndReceiveRes(string(reqJson))
+			displaymgr.PrintResponse(command, resJson, globals.IsDebug, globals.IsJSONRes, globals.DisplayUnit)
+		}
+	},
+}
+
+var nvram_advice_arrayName = ""
+
+func init() {
+	NvramAdviceCmd.Flags().StringVarP(&nvram_advice_arrayName,
+		"array-name", "a", "",
+		"The name of the array to display the NVRAM advice")
+	NvramAdviceCmd.MarkFlagRequired("array-name")
+}
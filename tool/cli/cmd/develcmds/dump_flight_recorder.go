@@ -0,0 +1,60 @@
+package develcmds
+
+import (
+	"cli/cmd/displaymgr"
+	"cli/cmd/globals"
+	"cli/cmd/messages"
+	"cli/cmd/socketmgr"
+	"encoding/json"
+
+	"github.com/labstack/gommon/log"
+	"github.com/spf13/cobra"
+)
+
+var DumpFlightRecorderCmd = &cobra.Command{
+	Use:   "dump-flight-recorder",
+	Short: "Dump the recent events recorded by the flight recorder of PoseidonOS.",
+	Long: `
+Dump the most recent events of every core recorded by the flight recorder of
+PoseidonOS: I/O submissions and completions with latency, GC victim copies,
+checkpoints, log group switches and flow control blocks. Use this command
+right after a latency outlier, then decode the file with
+tool/dump/flight_recorder_decoder.py. Without --path, the file is written
+to /var/log/pos/.
+
+Syntax:
+	poseidonos-cli devel dump-flight-recorder [--path FilePath]
+
+Example:
+	poseidonos-cli devel dump-flight-recorder --path /tmp/flight_recorder.bin
+          `,
+	Run: func(cmd *cobra.Command, args []string) {
+
+		var command = "DUMPFLIGHTRECORDER"
+		uuid := globals.GenerateUUID()
+
+		param := messages.DumpFlightRecorderParam{PATH: dump_flight_recorder_filePath}
+		req := messages.BuildReqWithParam(command, uuid, param)
+		reqJson, err := json.Marshal(req)
+		if err != nil {
+			log.Fatalf("failed to marshal the request: %v", err)
+		}
+
+		displaymgr.PrintRequest(string(reqJson))
+
+		// Do not send request to server and print response when testing request build.
+		if !(globals.IsTestingReqBld) {
+			// This command is served by the socket server only
+			resJson := socketmgr.SendReqAndReceiveRes(string(reqJson))
+			displaymgr.PrintResponse(command, resJson, globals.IsDebug, globals.IsJSONRes, globals.DisplayUnit)
+		}
+	},
+}
+
+var dump_flight_recorder_filePath = ""
+
+func init() {
+	DumpFlightRecorderCmd.Flags().StringVarP(&dump_flight_recorder_filePath,
+		"path", "", "",
+		"The path of the dump file")
+}
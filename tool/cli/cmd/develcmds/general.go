@@ -13,7 +13,7 @@ the system seriously. Therefore, this command category must be carefully used
 by developers. 
 
 Syntax: 
-  poseidonos-cli devel [resetmbr|reset-event-wrr|stop-rebuilding|update-event-wrr|dump-memory-snapshot]
+  poseidonos-cli devel [resetmbr|reset-event-wrr|stop-rebuilding|update-event-wrr|dump-memory-snapshot|dump-flight-recorder]
 
 	  `,
 	Args: cobra.MinimumNArgs(1),
@@ -27,4 +27,5 @@ func init() {
 	DevelCmd.AddCommand(UpdateEventWrrCmd)
 	DevelCmd.AddCommand(ResetEventWrrCmd)
 	DevelCmd.AddCommand(DumpMemorySnapshotCmd)
+	DevelCmd.AddCommand(DumpFlightRecorderCmd)
 }
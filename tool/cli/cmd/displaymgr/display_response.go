@@ -758,6 +758,153 @@ func printResToHumanReadable(command string, resJson string, displayUnit bool) {
 		fmt.Fprintln(w, "RebuildPerfImpact\t: "+res.RESULT.DATA.REBUILDPOLICY)
 
 		w.Flush()
+	case "ACCESSHEATMAP":
+		res := messages.AccessHeatmapResponse{}
+		json.Unmarshal([]byte(resJson), &res)
+
+		if res.RESULT.STATUS.CODE != globals.CliServerSuccessCode {
+			printEventInfo(res.RESULT.STATUS.CODE, res.RESULT.STATUS.EVENTNAME,
+				res.RESULT.STATUS.DESCRIPTION, res.RESULT.STATUS.CAUSE, res.RESULT.STATUS.SOLUTION)
+			return
+		}
+
+		w := tabwriter.NewWriter(os.Stdout, 0, 0, 2, ' ', 0)
+
+		fmt.Fprintln(w, "BucketSize(MB)\t: "+res.RESULT.DATA.BUCKETSIZEINMB)
+		fmt.Fprintln(w, "")
+
+		// Header
+		fmt.Fprintln(w,
+			"Volume\t"+
+				"Offset(MB)\t"+
+				"Reads\t"+
+				"Writes")
+
+		// Horizontal line
+		fmt.Fprintln(w,
+			"---------\t"+
+				"----------\t"+
+				"---------\t"+
+				"---------")
+
+		// Data
+		for _, volume := range res.RESULT.DATA.VOLUMELIST {
+			for _, bucket := range volume.BUCKETLIST {
+				fmt.Fprintln(w,
+					volume.NAME+"\t"+
+						bucket.OFFSETINMB+"\t"+
+						bucket.READ+"\t"+
+						bucket.WRITE)
+			}
+		}
+		w.Flush()
+
+	case "DUMPFLIGHTRECORDER":
+		res := messages.DumpFlightRecorderResponse{}
+		json.Unmarshal([]byte(resJson), &res)
+
+		if res.RESULT.STATUS.CODE != globals.CliServerSuccessCode {
+			printEventInfo(res.RESULT.STATUS.CODE, res.RESULT.STATUS.EVENTNAME,
+				res.RESULT.STATUS.DESCRIPTION, res.RESULT.STATUS.CAUSE, res.RESULT.STATUS.SOLUTION)
+			return
+		}
+
+		w := tabwriter.NewWriter(os.Stdout, 0, 0, 2, ' ', 0)
+		fmt.Fprintln(w, "Path\t: "+res.RESULT.DATA.PATH)
+		fmt.Fprintln(w, "Recording\t: "+strconv.FormatBool(res.RESULT.DATA.ENABLED))
+		w.Flush()
+
+	case "METAFILEPLACEMENT":
+		res := messages.MetaFilePlacementResponse{}
+		json.Unmarshal([]byte(resJson), &res)
+
+		if res.RESULT.STATUS.CODE != globals.CliServerSuccessCode {
+			printEventInfo(res.RESULT.STATUS.CODE, res.RESULT.STATUS.EVENTNAME,
+				res.RESULT.STATUS.DESCRIPTION, res.RESULT.STATUS.CAUSE, res.RESULT.STATUS.SOLUTION)
+			return
+		}
+
+		w := tabwriter.NewWriter(os.Stdout, 0, 0, 2, ' ', 0)
+
+		fmt.Fprintln(w, "AutoPlacement\t: "+res.RESULT.DATA.AUTOPLACEMENT)
+		fmt.Fprintln(w, "Budget(KB)\t: "+res.RESULT.DATA.BUDGETINKB)
+		fmt.Fprintln(w, "PinnedNvram(KB)\t: "+res.RESULT.DATA.PINNEDNVRAMINKB)
+		fmt.Fprintln(w, "HotFiles(KB)\t: "+res.RESULT.DATA.HOTFILEINKB)
+		fmt.Fprintln(w, "Placed(KB)\t: "+res.RESULT.DATA.PLACEDINKB)
+		fmt.Fprintln(w, "RecommendedNvram(MB)\t: "+res.RESULT.DATA.RECOMMENDEDNVRAMINMB)
+		fmt.Fprintln(w, "")
+
+		// Header
+		fmt.Fprintln(w,
+			"Name\t"+
+				"Size(KB)\t"+
+				"IOPS\t"+
+				"Volume\t"+
+				"Placed")
+
+		// Horizontal line
+		fmt.Fprintln(w,
+			"--------------------\t"+
+				"---------\t"+
+				"---------\t"+
+				"------\t"+
+				"------")
+
+		// Data
+		for _, file := range res.RESULT.DATA.FILELIST {
+			fmt.Fprintln(w,
+				file.NAME+"\t"+
+					file.SIZEINKB+"\t"+
+					file.IOPS+"\t"+
+					file.VOLUME+"\t"+
+					file.PLACED)
+		}
+		w.Flush()
+
+	case "REACTORUTILIZATION":
+		res := messages.ReactorUtilizationResponse{}
+		json.Unmarshal([]byte(resJson), &res)
+
+		if res.RESULT.STATUS.CODE != globals.CliServerSuccessCode {
+			printEventInfo(res.RESULT.STATUS.CODE, res.RESULT.STATUS.EVENTNAME,
+				res.RESULT.STATUS.DESCRIPTION, res.RESULT.STATUS.CAUSE, res.RESULT.STATUS.SOLUTION)
+			return
+		}
+
+		cycleTypes := []string{"nvmf_poll", "host_submission", "io_completion",
+			"reactor_event", "shared_event", "idle"}
+
+		w := tabwriter.NewWriter(os.Stdout, 0, 0, 2, ' ', 0)
+
+		// Header
+		fmt.Fprint(w, "Reactor\tRole\tBusy(%)")
+		for _, cycleType := range cycleTypes {
+			fmt.Fprint(w, "\t"+cycleType+"(%)")
+		}
+		fmt.Fprintln(w, "")
+
+		// Data
+		for _, reactor := range res.RESULT.DATA.REACTORLIST {
+			var total uint64 = 0
+			cycles := make(map[string]uint64)
+			for _, cycleType := range cycleTypes {
+				cycles[cycleType], _ = strconv.ParseUint(reactor.INTERVALCYCLES[cycleType], 10, 64)
+				total += cycles[cycleType]
+			}
+
+			fmt.Fprint(w, strconv.Itoa(reactor.REACTOR)+"\t"+reactor.ROLE+"\t"+
+				strconv.Itoa(reactor.BUSYPERCENT))
+			for _, cycleType := range cycleTypes {
+				share := "0"
+				if total != 0 {
+					share = strconv.FormatFloat(float64(cycles[cycleType])*100/float64(total), 'f', 1, 64)
+				}
+				fmt.Fprint(w, "\t"+share)
+			}
+			fmt.Fprintln(w, "")
+		}
+		w.Flush()
+
 	case "GETTELEMETRYPROPERTY":
 		res := &pb.GetTelemetryPropertyResponse{}
 		protojson.Unmarshal([]byte(resJson), res)
@@ -125,6 +125,18 @@ type VolumeInfoParam struct {
 	VOLUMENAME string `json:"name"`
 }
 
+type AccessHeatmapParam struct {
+	ARRAYNAME string `json:"array"`
+}
+
+type MetaFilePlacementParam struct {
+	ARRAYNAME string `json:"array"`
+}
+
+type DumpFlightRecorderParam struct {
+	PATH string `json:"path,omitempty"`
+}
+
 type MountVolumeParam struct {
 	VOLUMENAME string `json:"name"`
 	SUBNQN     string `json:"subnqn,omitempty"`
@@ -59,6 +59,113 @@ type POSPropertyData struct {
 	REBUILDPOLICY string `json:"rebuildPolicy"`
 }
 
+// Response for ACCESSHEATMAP command
+type AccessHeatmapResponse struct {
+	RID     string              `json:"rid"`
+	COMMAND string              `json:"command"`
+	RESULT  AccessHeatmapResult `json:"result,omitempty"`
+	INFO    Info                `json:"info"`
+}
+
+type AccessHeatmapResult struct {
+	STATUS Status            `json:"status,omitempty"`
+	DATA   AccessHeatmapData `json:"data,omitempty"`
+}
+
+type AccessHeatmapData struct {
+	ARRAYNAME      string                `json:"array"`
+	BUCKETSIZEINMB string                `json:"bucketSizeInMb"`
+	VOLUMELIST     []VolumeAccessHeatmap `json:"volumeList"`
+}
+
+type VolumeAccessHeatmap struct {
+	ID         int                   `json:"id"`
+	NAME       string                `json:"name"`
+	BUCKETLIST []AccessHeatmapBucket `json:"bucketList"`
+}
+
+type AccessHeatmapBucket struct {
+	OFFSETINMB string `json:"offsetInMb"`
+	READ       string `json:"read"`
+	WRITE      string `json:"write"`
+}
+
+// Response for DUMPFLIGHTRECORDER command
+type DumpFlightRecorderResponse struct {
+	RID     string                   `json:"rid"`
+	COMMAND string                   `json:"command"`
+	RESULT  DumpFlightRecorderResult `json:"result,omitempty"`
+	INFO    Info                     `json:"info"`
+}
+
+type DumpFlightRecorderResult struct {
+	STATUS Status                 `json:"status,omitempty"`
+	DATA   DumpFlightRecorderData `json:"data,omitempty"`
+}
+
+type DumpFlightRecorderData struct {
+	PATH    string `json:"path"`
+	ENABLED bool   `json:"enabled"`
+}
+
+// Response for METAFILEPLACEMENT command
+type MetaFilePlacementResponse struct {
+	RID     string                  `json:"rid"`
+	COMMAND string                  `json:"command"`
+	RESULT  MetaFilePlacementResult `json:"result,omitempty"`
+	INFO    Info                    `json:"info"`
+}
+
+type MetaFilePlacementResult struct {
+	STATUS Status                `json:"status,omitempty"`
+	DATA   MetaFilePlacementData `json:"data,omitempty"`
+}
+
+type MetaFilePlacementData struct {
+	ARRAYNAME            string        `json:"array"`
+	AUTOPLACEMENT        string        `json:"autoPlacement"`
+	BUDGETINKB           string        `json:"budgetInKb"`
+	PINNEDNVRAMINKB      string        `json:"pinnedNvramInKb"`
+	HOTFILEINKB          string        `json:"hotFileInKb"`
+	PLACEDINKB           string        `json:"placedInKb"`
+	RECOMMENDEDNVRAMINMB string        `json:"recommendedNvramInMb"`
+	FILELIST             []HotMetaFile `json:"fileList"`
+}
+
+type HotMetaFile struct {
+	NAME     string `json:"name"`
+	SIZEINKB string `json:"sizeInKb"`
+	IOPS     string `json:"iops"`
+	VOLUME   string `json:"volume"`
+	PLACED   string `json:"placed"`
+}
+
+// Response for REACTORUTILIZATION command
+type ReactorUtilizationResponse struct {
+	RID     string                   `json:"rid"`
+	COMMAND string                   `json:"command"`
+	RESULT  ReactorUtilizationResult `json:"result,omitempty"`
+	INFO    Info                     `json:"info"`
+}
+
+type ReactorUtilizationResult struct {
+	STATUS Status                 `json:"status,omitempty"`
+	DATA   ReactorUtilizationData `json:"data,omitempty"`
+}
+
+type ReactorUtilizationData struct {
+	TICKSHZ     string               `json:"ticksHz"`
+	REACTORLIST []ReactorUtilization `json:"reactorList"`
+}
+
+type ReactorUtilization struct {
+	REACTOR        int               `json:"reactor"`
+	ROLE           string            `json:"role"`
+	BUSYPERCENT    int               `json:"busyPercent"`
+	INTERVALCYCLES map[string]string `json:"intervalCycles"`
+	TOTALCYCLES    map[string]string `json:"totalCycles"`
+}
+
 // Response for LISTARRAY & ARRAYINFO commands
 type ListArrayResponse struct {
 	RID     string          `json:"rid"`
@@ -12,7 +12,7 @@ System commands for PoseidonOS. Use this command category to start/stop
 PoseidonOS or get the information of PoseidonOS.
 
 Syntax: 
-  poseidonos-cli system [start|stop|info|set-property|get-property] [flags]
+  poseidonos-cli system [start|stop|info|set-property|get-property|reactor-utilization] [flags]
 
 Example (to start PoseidonOS):
   poseidonos-cli system start
@@ -28,4 +28,5 @@ func init() {
 	SystemCmd.AddCommand(SystemInfoCmd)
 	SystemCmd.AddCommand(SetSystemPropCmd)
 	SystemCmd.AddCommand(GetSystemPropCmd)
+	SystemCmd.AddCommand(ReactorUtilizationCmd)
 }
@@ -0,0 +1,51 @@
+package systemcmds
+
+import (
+	"cli/cmd/displaymgr"
+	"cli/cmd/globals"
+	"cli/cmd/messages"
+	"cli/cmd/socketmgr"
+	"encoding/json"
+
+	"github.com/labstack/gommon/log"
+	"github.com/spf13/cobra"
+)
+
+var ReactorUtilizationCmd = &cobra.Command{
+	Use:   "reactor-utilization",
+	Short: "Display how each reactor of PoseidonOS spends its cycles.",
+	Long: `
+Display the share of cycles each reactor of PoseidonOS spent in the last
+second on NVMe-oF polling, host I/O submission, I/O completion, events and
+idle polling. Use this command to size the reactor and event reactor masks.
+
+Syntax:
+	poseidonos-cli system reactor-utilization
+
+Example:
+	poseidonos-cli system reactor-utilization
+          `,
+	Run: func(cmd *cobra.Command, args []string) {
+
+		var command = "REACTORUTILIZATION"
+		uuid := globals.GenerateUUID()
+
+		req := messages.BuildReq(command, uuid)
+		reqJson, err := json.Marshal(req)
+		if err != nil {
+			log.Fatalf("failed to marshal the request: %v", err)
+		}
+
+		displaymgr.PrintRequest(string(reqJson))
+
+		// Do not send request to server and print response when testing request build.
+		if !(globals.IsTestingReqBld) {
+			// This command is served by the socket server only
+			resJson := socketmgr.SendReqAndReceiveRes(string(reqJson))
+			displaymgr.PrintResponse(command, resJson, globals.IsDebug, globals.IsJSONRes, globals.DisplayUnit)
+		}
+	},
+}
+
+func init() {
+}
@@ -12,7 +12,7 @@ var VolumeCmd = &cobra.Command{
 	or display the information of the volumes. 
 
 Syntax: 
-  poseidonos-cli volume [create|delete|mount|unmount|list|rename|mount-with-subsystem] [flags]
+  poseidonos-cli volume [create|delete|mount|unmount|list|rename|mount-with-subsystem|heatmap] [flags]
 
 Example (to create a volume):
   poseidonos-cli volume create --volume-name Volume0 --array-name Array0 
@@ -32,4 +32,5 @@ func init() {
 	VolumeCmd.AddCommand(RenameVolumeCmd)
 	VolumeCmd.AddCommand(MountVolumeWithSubsystemCmd)
 	VolumeCmd.AddCommand(SetVolumePropertyCmd)
+	VolumeCmd.AddCommand(VolumeHeatmapCmd)
 }
@@ -0,0 +1,58 @@
+package volumecmds
+
+import (
+	"cli/cmd/displaymgr"
+	"cli/cmd/globals"
+	"cli/cmd/messages"
+	"cli/cmd/socketmgr"
+	"encoding/json"
+
+	"github.com/labstack/gommon/log"
+	"github.com/spf13/cobra"
+)
+
+var VolumeHeatmapCmd = &cobra.Command{
+	Use:   "heatmap",
+	Short: "Display the hottest address ranges of the volumes in an array.",
+	Long: `
+Display the address ranges of each volume in an array that are read and
+written most often, with the estimated number of reads and writes. The
+heatmap is collected only when performance.access_heatmap_enable is set.
+
+Syntax:
+	poseidonos-cli volume heatmap (--array-name | -a) ArrayName
+
+Example:
+	poseidonos-cli volume heatmap --array-name Array0
+          `,
+	Run: func(cmd *cobra.Command, args []string) {
+
+		var command = "ACCESSHEATMAP"
+		uuid := globals.GenerateUUID()
+
+		param := messages.AccessHeatmapParam{ARRAYNAME: volume_heatmap_arrayName}
+		req := messages.BuildReqWithParam(command, uuid, param)
+		reqJson, err := json.Marshal(req)
+		if err != nil {
+			log.Fatalf("failed to marshal the request: %v", err)
+		}
+
+		displaymgr.PrintRequest(string(reqJson))
+
+		// Do not send request to server and print response when testing request build.
+		if !(globals.IsTestingReqBld) {
+			// This command is served by the socket server only
+			resJson := socketmgr.SendReqAndReceiveRes(string(reqJson))
+			displaymgr.PrintResponse(command, resJson, globals.IsDebug, globals.IsJSONRes, globals.DisplayUnit)
+		}
+	},
+}
+
+var volume_heatmap_arrayName = ""
+
+func init() {
+	VolumeHeatmapCmd.Flags().StringVarP(&volume_heatmap_arrayName,
+		"array-name", "a", "",
+		"The name of the array of volumes to display the heatmap")
+	VolumeHeatmapCmd.MarkFlagRequired("array-name")
+}
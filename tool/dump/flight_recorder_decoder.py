@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+
+# Decodes a dump of the flight recorder (src/trace/flight_recorder.h) taken by
+# "poseidonos-cli devel dump-flight-recorder" or on an I/O timeout.
+#
+# ./flight_recorder_decoder.py /var/log/pos/flight_recorder_cli_20221012_101010.bin
+# ./flight_recorder_decoder.py dump.bin --min-latency-us 1000 --context-us 5000
+
+import argparse
+import datetime
+import struct
+import sys
+
+DUMP_MAGIC = 0x435254464c534f50
+DUMP_VERSION = 1
+HEADER_FORMAT = "<QIIIIQQ"
+RING_HEADER_FORMAT = "<II"
+EVENT_FORMAT = "<QBBBBIQQ"
+NO_ARRAY = 0xff
+
+EVENT_TYPES = ["io_submit", "io_complete", "gc_victim_start", "gc_victim_end",
+               "checkpoint_start", "checkpoint_end", "log_group_switch", "flow_control_block"]
+DIRECTIONS = ["read", "write"]  # UbioDir
+
+
+class Event:
+    def __init__(self, core, fields):
+        (self.timestamp, self.type, self.array, self.direction, _,
+         self.arg0, self.arg1, self.arg2) = fields
+        self.core = core
+
+    def type_name(self):
+        if self.type < len(EVENT_TYPES):
+            return EVENT_TYPES[self.type]
+        return "unknown(%d)" % self.type
+
+    def describe(self):
+        name = self.type_name()
+        if name == "io_submit":
+            return "%s vol=%d rba=%d size=%d" % (self._dir(), self.arg0, self.arg1, self.arg2)
+        if name == "io_complete":
+            return "%s vol=%d rba=%d latency_us=%d" % (self._dir(), self.arg0, self.arg1, self.arg2)
+        if name == "gc_victim_start":
+            return "segment=%d free_segments=%d" % (self.arg0, self.arg1)
+        if name == "gc_victim_end":
+            return "segment=%d copied_blocks=%d" % (self.arg0, self.arg1)
+        if name in ("checkpoint_start", "checkpoint_end"):
+            return "log_group=%d" % self.arg0
+        if name == "log_group_switch":
+            return "log_group=%d seq=%d" % (self.arg0, self.arg1)
+        if name == "flow_control_block":
+            return "type=%d token=%d free_segments=%d" % (self.arg0, self.arg1, self.arg2)
+        return "arg0=%d arg1=%d arg2=%d" % (self.arg0, self.arg1, self.arg2)
+
+    def _dir(self):
+        if self.direction < len(DIRECTIONS):
+            return DIRECTIONS[self.direction]
+        return "dir(%d)" % self.direction
+
+
+def load(path):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    header_size = struct.calcsize(HEADER_FORMAT)
+    (magic, version, event_size, ring_count, _, steady_ns, wall_ns) = \
+        struct.unpack_from(HEADER_FORMAT, data, 0)
+    if magic != DUMP_MAGIC or version != DUMP_VERSION:
+        sys.exit("%s is not a flight recorder dump of version %d" % (path, DUMP_VERSION))
+    if event_size != struct.calcsize(EVENT_FORMAT):
+        sys.exit("unexpected event size %d" % event_size)
+
+    events = []
+    offset = header_size
+    for _ in range(ring_count):
+        core, count = struct.unpack_from(RING_HEADER_FORMAT, data, offset)
+        offset += struct.calcsize(RING_HEADER_FORMAT)
+        for _ in range(count):
+            event = Event(core, struct.unpack_from(EVENT_FORMAT, data, offset))
+            offset += event_size
+            if event.timestamp != 0:
+                events.append(event)
+    events.sort(key=lambda e: e.timestamp)
+    return events, steady_ns, wall_ns
+
+
+def select_outliers(events, min_latency_us, context_us):
+    # keep the slow completions and everything recorded while they were in flight
+    windows = []
+    for event in events:
+        if event.type_name() == "io_complete" and event.arg2 >= min_latency_us:
+            windows.append((event.timestamp - (event.arg2 + context_us) * 1000, event.timestamp))
+    return [e for e in events if any(begin <= e.timestamp <= end for begin, end in windows)]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode a flight recorder dump of PoseidonOS")
+    parser.add_argument("path", help="dump file")
+    parser.add_argument("--min-latency-us", type=int, default=0,
+                        help="show only the events around completions slower than this")
+    parser.add_argument("--context-us", type=int, default=1000,
+                        help="time before the submission of a slow I/O to show")
+    parser.add_argument("--type", action="append", choices=EVENT_TYPES,
+                        help="show only the events of this type (repeatable)")
+    args = parser.parse_args()
+
+    events, steady_ns, wall_ns = load(args.path)
+    if args.min_latency_us > 0:
+        events = select_outliers(events, args.min_latency_us, args.context_us)
+    if args.type:
+        events = [e for e in events if e.type_name() in args.type]
+
+    for event in events:
+        wall = datetime.datetime.fromtimestamp((wall_ns - (steady_ns - event.timestamp)) / 1e9)
+        array = "-" if event.array == NO_ARRAY else str(event.array)
+        print("%s core=%-3d array=%-2s %-18s %s" % (wall.strftime("%H:%M:%S.%f"), event.core,
+              array, event.type_name(), event.describe()))
+    print("%d events" % len(events), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,47 @@
+import gdb
+import sys
+import os
+
+current_path = os.path.dirname(os.path.realpath(__file__))
+sys.path.insert(1, current_path)
+sys.path.insert(1, current_path + "/../")
+
+import gdb_lib
+
+# ObjectPool::MAX_CACHE_COUNT
+MAX_CACHE_COUNT = 256
+
+
+def _get_int(expression):
+    return int(gdb.parse_and_eval(expression))
+
+
+def object_pool():
+    enabled = gdb.parse_and_eval("pos::ObjectPool::enable._M_base._M_i")
+    count = _get_int("pos::ObjectPool::cacheCount._M_i")
+    count = min(count, MAX_CACHE_COUNT)
+    print("object pool enabled : %s, caches : %d" % (enabled, count))
+    total_hit = 0
+    total_miss = 0
+    for index in range(count):
+        cache = "pos::ObjectPool::caches[%d]" % index
+        if (_get_int(cache) == 0):
+            continue
+        hit = _get_int("%s->stats.hit" % cache)
+        miss = _get_int("%s->stats.miss" % cache)
+        local_return = _get_int("%s->stats.localReturn" % cache)
+        remote_return = _get_int("%s->stats.remoteReturn._M_i" % cache)
+        overflow = _get_int("%s->stats.overflow._M_i" % cache)
+        retired = gdb.parse_and_eval("%s->retired._M_base._M_i" % cache)
+        hit_rate = 0.0
+        if (hit + miss != 0):
+            hit_rate = 100.0 * hit / (hit + miss)
+        print("cache %d (retired : %s) hit : %d, miss : %d, hit rate : %.2f%%, "
+              "local return : %d, remote return : %d, overflow : %d"
+              % (index, retired, hit, miss, hit_rate,
+                 local_return, remote_return, overflow))
+        total_hit = total_hit + hit
+        total_miss = total_miss + miss
+    if (total_hit + total_miss != 0):
+        print("total hit rate : %.2f%%"
+              % (100.0 * total_hit / (total_hit + total_miss)))
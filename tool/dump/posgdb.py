@@ -15,6 +15,7 @@ import gdb
 import dump_buffer
 import gdb_lib
 import log_memory
+import object_pool
 import pending_object
 import pending_callback
 import pending_io
@@ -109,6 +110,9 @@ class PosGdbCmd(gdb.Command):
         elif ('make report' in args):
             report.make_report()
 
+        elif ('object pool' == args):
+            object_pool.object_pool()
+
         else:
             print("Help : ")
             help_f = open(current_path + '/README_POS_GDB')
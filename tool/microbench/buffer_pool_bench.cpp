@@ -0,0 +1,132 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Buffer get and return from a shared pool, as the io path takes ubio and
+// parity buffers on many reactors at once.
+// range(0): buffer size in bytes, range(1): buffers held at once by a thread
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "src/resource_manager/buffer_pool.h"
+#include "tool/microbench/microbench_env.h"
+
+namespace pos
+{
+static const uint64_t BUFFER_POOL_BENCH_MAX_COUNT = 16 * 1024;
+static const uint64_t BUFFER_POOL_BENCH_MAX_BYTES = 256 * 1024 * 1024;
+
+static BufferPool* bufferPoolBenchPool = nullptr;
+
+static void
+CreateBufferPool(std::string owner, uint64_t size)
+{
+    BufferInfo info = {
+        .owner = owner + "_" + std::to_string(size),
+        .size = size,
+        .count = std::min(BUFFER_POOL_BENCH_MAX_COUNT, BUFFER_POOL_BENCH_MAX_BYTES / size)};
+    bufferPoolBenchPool = new BufferPool(info, 0, MicrobenchEnvSingleton::Instance()->GetHugepageAllocator());
+}
+
+static void
+BM_BufferPoolGetReturn(benchmark::State& state)
+{
+    uint32_t holdCnt = state.range(1);
+    if (state.thread_index() == 0)
+    {
+        CreateBufferPool("microbench", state.range(0));
+    }
+
+    std::vector<void*> held(holdCnt, nullptr);
+    uint64_t missed = 0;
+    for (auto _ : state)
+    {
+        for (uint32_t i = 0; i < holdCnt; i++)
+        {
+            held[i] = bufferPoolBenchPool->TryGetBuffer();
+        }
+        for (uint32_t i = 0; i < holdCnt; i++)
+        {
+            if (held[i] == nullptr)
+            {
+                missed++;
+                continue;
+            }
+            bufferPoolBenchPool->ReturnBuffer(held[i]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * holdCnt);
+    state.counters["missed"] = benchmark::Counter(missed, benchmark::Counter::kAvgThreads);
+
+    if (state.thread_index() == 0)
+    {
+        delete bufferPoolBenchPool;
+        bufferPoolBenchPool = nullptr;
+    }
+}
+BENCHMARK(BM_BufferPoolGetReturn)
+    ->Args({4096, 1})
+    ->Args({4096, 32})
+    ->Args({256 * 1024, 1})
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
+static void
+BM_BufferPoolGetReturnBatch(benchmark::State& state)
+{
+    uint32_t batchCnt = state.range(1);
+    if (state.thread_index() == 0)
+    {
+        CreateBufferPool("microbench_batch", state.range(0));
+    }
+
+    std::vector<void*> buffers;
+    buffers.reserve(batchCnt);
+    for (auto _ : state)
+    {
+        bufferPoolBenchPool->TryGetBuffers(batchCnt, &buffers, batchCnt);
+        bufferPoolBenchPool->ReturnBuffers(&buffers);
+        buffers.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * batchCnt);
+
+    if (state.thread_index() == 0)
+    {
+        delete bufferPoolBenchPool;
+        bufferPoolBenchPool = nullptr;
+    }
+}
+BENCHMARK(BM_BufferPoolGetReturnBatch)->Args({4096, 32})->ThreadRange(1, 16)->UseRealTime();
+} // namespace pos
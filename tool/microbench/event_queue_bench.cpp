@@ -0,0 +1,108 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Enqueue and dequeue of events through one queue shared by the threads,
+// as the event workers of a numa node do. The events are front-end ones,
+// so that QosManager is left out of the loop.
+
+#include <benchmark/benchmark.h>
+
+#include <gmock/gmock.h>
+
+#include <memory>
+#include <vector>
+
+#include "src/event_scheduler/event.h"
+#include "src/event_scheduler/event_queue.h"
+#include "test/unit-tests/qos/qos_manager_mock.h"
+#include "tool/microbench/microbench_env.h"
+
+namespace pos
+{
+class MicrobenchEvent : public Event
+{
+public:
+    explicit MicrobenchEvent(AffinityManager* affinityManager)
+    : Event(true, BackendEvent_Unknown, affinityManager)
+    {
+    }
+    bool
+    Execute(void) override
+    {
+        return true;
+    }
+};
+
+static EventQueue* eventQueueBenchQueue = nullptr;
+static ::testing::NiceMock<MockQosManager>* eventQueueBenchQos = nullptr;
+
+// range(0): events a thread enqueues before dequeuing them
+static void
+BM_EventQueueEnqueueDequeue(benchmark::State& state)
+{
+    uint32_t burst = state.range(0);
+    if (state.thread_index() == 0)
+    {
+        eventQueueBenchQos = new ::testing::NiceMock<MockQosManager>();
+        eventQueueBenchQueue = new EventQueue(eventQueueBenchQos);
+    }
+
+    std::vector<EventSmartPtr> events;
+    for (uint32_t i = 0; i < burst; i++)
+    {
+        events.push_back(std::make_shared<MicrobenchEvent>(MicrobenchEnvSingleton::Instance()->GetAffinityManager()));
+    }
+
+    for (auto _ : state)
+    {
+        for (EventSmartPtr& event : events)
+        {
+            eventQueueBenchQueue->EnqueueEvent(event);
+        }
+        for (uint32_t i = 0; i < burst; i++)
+        {
+            EventSmartPtr event = eventQueueBenchQueue->DequeueEvent();
+            benchmark::DoNotOptimize(event);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * burst);
+
+    if (state.thread_index() == 0)
+    {
+        delete eventQueueBenchQueue;
+        delete eventQueueBenchQos;
+        eventQueueBenchQueue = nullptr;
+        eventQueueBenchQos = nullptr;
+    }
+}
+BENCHMARK(BM_EventQueueEnqueueDequeue)->Arg(1)->Arg(32)->ThreadRange(1, 16)->UseRealTime();
+} // namespace pos
@@ -0,0 +1,235 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Address translation and merging of a host read, as ReadSubmission does.
+// The map and the array translation are fakes with plain overrides, so the
+// numbers cover Translator and Merger themselves.
+// range(0): blocks per read, range(1): blocks per contiguous run on the ssd
+
+#include <benchmark/benchmark.h>
+
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <list>
+
+#include "src/bio/volume_io.h"
+#include "src/event_scheduler/callback.h"
+#include "src/include/address_type.h"
+#include "src/include/array_config.h"
+#include "src/include/memory.h"
+#include "src/io/frontend_io/read_completion_factory.h"
+#include "src/io/general_io/merger.h"
+#include "src/io/general_io/translator.h"
+#include "test/unit-tests/allocator/i_wbstripe_allocator_mock.h"
+#include "test/unit-tests/array/service/io_translator/i_io_translator_mock.h"
+#include "test/unit-tests/mapper/i_stripemap_mock.h"
+#include "test/unit-tests/mapper/i_vsamap_mock.h"
+#include "test/unit-tests/volume/i_volume_info_manager_mock.h"
+#include "tool/microbench/microbench_env.h"
+
+namespace pos
+{
+static const int IO_PATH_BENCH_ARRAY_ID = 0;
+static const uint32_t IO_PATH_BENCH_VOLUME_ID = 0;
+
+// Maps the read to extents of runLength blocks, each in its own stripe
+class MicrobenchVsaMap : public MockIVSAMap
+{
+public:
+    uint32_t runLength = 1;
+
+    int
+    GetVsaExtents(int volumeId, BlkAddr startRba, uint32_t numBlks, VsaExtentArray& extents, uint32_t& numExtents) override
+    {
+        numExtents = 0;
+        for (uint32_t blkIdx = 0; blkIdx < numBlks; blkIdx += runLength)
+        {
+            extents[numExtents].startVsa = {.stripeId = static_cast<StripeId>(startRba + blkIdx), .offset = 0};
+            extents[numExtents].numBlks = std::min(runLength, numBlks - blkIdx);
+            numExtents++;
+        }
+        return 0;
+    }
+};
+
+class MicrobenchStripeMap : public MockIStripeMap
+{
+public:
+    StripeAddr
+    GetLSA(StripeId vsid) override
+    {
+        return {.stripeLoc = IN_USER_AREA, .stripeId = vsid};
+    }
+    LsidRefResult
+    GetLSAandReferLsid(StripeId vsid) override
+    {
+        return std::make_tuple(GetLSA(vsid), false);
+    }
+};
+
+class MicrobenchWBStripeAllocator : public MockIWBStripeAllocator
+{
+public:
+    bool
+    ReferLsidCnt(StripeAddr& lsa) override
+    {
+        return false;
+    }
+};
+
+// Every stripe starts at its own lba so that runs never merge across stripes
+class MicrobenchIOTranslator : public MockIIOTranslator
+{
+public:
+    int
+    Translate(unsigned int arrayIndex, PartitionType part, list<PhysicalEntry>& pel, const LogicalEntry& le) override
+    {
+        uint64_t lba = ChangeBlockToSector(le.addr.stripeId * ArrayConfig::BLOCKS_PER_CHUNK + le.addr.offset);
+        pel.push_back({.addr = {.lba = lba, .arrayDev = nullptr}, .blkCnt = le.blkCnt});
+        return 0;
+    }
+    int
+    TranslateForRead(unsigned int arrayIndex, PartitionType part, list<PhysicalEntry>& pel, const LogicalEntry& le) override
+    {
+        return Translate(arrayIndex, part, pel, le);
+    }
+};
+
+// Stands for the host completion that the split reads report to
+class MicrobenchCallback : public Callback
+{
+public:
+    MicrobenchCallback(void)
+    : Callback(true)
+    {
+    }
+
+private:
+    bool
+    _DoSpecificJob(void) override
+    {
+        return true;
+    }
+};
+
+class IoPathBench
+{
+public:
+    MicrobenchVsaMap vsaMap;
+    MicrobenchStripeMap stripeMap;
+    MicrobenchWBStripeAllocator wbStripeAllocator;
+    MicrobenchIOTranslator ioTranslator;
+    ::testing::NiceMock<MockIVolumeInfoManager> volumeManager;
+
+    Translator*
+    CreateTranslator(BlkAddr startRba, uint32_t blockCount)
+    {
+        return new Translator(IO_PATH_BENCH_VOLUME_ID, startRba, blockCount, IO_PATH_BENCH_ARRAY_ID,
+            true, &vsaMap, &stripeMap, &wbStripeAllocator, &ioTranslator, &volumeManager);
+    }
+};
+
+static void
+BM_TranslatorRead(benchmark::State& state)
+{
+    IoPathBench bench;
+    uint32_t blockCount = state.range(0);
+    bench.vsaMap.runLength = state.range(1);
+    BlkAddr rba = 0;
+    for (auto _ : state)
+    {
+        Translator* translator = bench.CreateTranslator(rba, blockCount);
+        uint32_t blockIndex = 0;
+        for (uint32_t extentIndex = 0; extentIndex < translator->GetVsaExtentCount(); extentIndex++)
+        {
+            VirtualBlks extent = translator->GetVsaExtent(extentIndex);
+            if (extent.numBlks > 1)
+            {
+                list<PhysicalEntry> entries = translator->GetPhysicalEntriesOfBlocks(blockIndex, extent.numBlks);
+                benchmark::DoNotOptimize(entries);
+            }
+            else
+            {
+                PhysicalBlkAddr pba = translator->GetPba(blockIndex);
+                benchmark::DoNotOptimize(pba);
+            }
+            blockIndex += extent.numBlks;
+        }
+        delete translator;
+        rba += blockCount;
+    }
+    state.SetItemsProcessed(state.iterations() * blockCount);
+}
+BENCHMARK(BM_TranslatorRead)
+    ->Args({1, 1})
+    ->Args({32, 1})
+    ->Args({32, 8})
+    ->Args({32, 32});
+
+static void
+BM_MergerRead(benchmark::State& state)
+{
+    MicrobenchEnvSingleton::Instance();
+    ::testing::NiceMock<MockIVolumeInfoManager> volumeManager;
+    ReadCompletionFactory readCompletionFactory;
+    uint32_t blockCount = state.range(0);
+    uint32_t runLength = state.range(1);
+    void* buffer = MicrobenchEnv::AllocBuffer(blockCount * BLOCK_SIZE);
+    CallbackSmartPtr hostCallback(new MicrobenchCallback());
+
+    for (auto _ : state)
+    {
+        VolumeIoSmartPtr volumeIo(new VolumeIo(buffer, ChangeBlockToSector(blockCount), IO_PATH_BENCH_ARRAY_ID, &volumeManager));
+        volumeIo->SetCallback(hostCallback);
+        Merger merger(volumeIo, &readCompletionFactory);
+        for (uint32_t blockIndex = 0; blockIndex < blockCount; blockIndex++)
+        {
+            uint32_t run = blockIndex / runLength;
+            PhysicalBlkAddr pba = {.lba = ChangeBlockToSector(run * ArrayConfig::BLOCKS_PER_CHUNK + blockIndex % runLength),
+                .arrayDev = nullptr};
+            VirtualBlkAddr vsa = {.stripeId = run, .offset = blockIndex % runLength};
+            StripeAddr lsidEntry = {.stripeLoc = IN_USER_AREA, .stripeId = run};
+            merger.Add(pba, vsa, lsidEntry, BLOCK_SIZE);
+        }
+        merger.Cut();
+        benchmark::DoNotOptimize(merger.GetSplitCount());
+    }
+    state.SetItemsProcessed(state.iterations() * blockCount);
+    free(buffer);
+}
+BENCHMARK(BM_MergerRead)
+    ->Args({1, 1})
+    ->Args({32, 1})
+    ->Args({32, 8})
+    ->Args({32, 32});
+} // namespace pos
@@ -0,0 +1,206 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Journal hot spots: log buffer space allocation on the write path, and
+// log parsing on replay.
+
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+#include "src/include/pos_event_id.h"
+#include "src/journal_manager/log/block_write_done_log_handler.h"
+#include "src/journal_manager/log/compact_block_write_done_log_handler.h"
+#include "src/journal_manager/log/log_buffer_parser.h"
+#include "src/journal_manager/log/log_list.h"
+#include "src/journal_manager/log_write/buffer_offset_allocator.h"
+#include "test/unit-tests/journal_manager/checkpoint/log_group_releaser_mock.h"
+#include "test/unit-tests/journal_manager/config/journal_configuration_mock.h"
+
+namespace pos
+{
+static const int JOURNAL_BENCH_NUM_LOG_GROUPS = 2;
+static const uint64_t JOURNAL_BENCH_META_PAGE_SIZE = 4032;
+static const uint64_t JOURNAL_BENCH_LOG_GROUP_SIZE = 1024 * JOURNAL_BENCH_META_PAGE_SIZE;
+
+class MicrobenchJournalConfiguration : public MockJournalConfiguration
+{
+public:
+    int
+    GetNumLogGroups(void) override
+    {
+        return JOURNAL_BENCH_NUM_LOG_GROUPS;
+    }
+    uint64_t
+    GetLogGroupSize(void) override
+    {
+        return JOURNAL_BENCH_LOG_GROUP_SIZE;
+    }
+    uint64_t
+    GetMetaPageSize(void) override
+    {
+        return JOURNAL_BENCH_META_PAGE_SIZE;
+    }
+    LogGroupLayout
+    GetLogBufferLayout(int groupId) override
+    {
+        LogGroupLayout layout;
+        layout.startOffset = groupId * JOURNAL_BENCH_LOG_GROUP_SIZE;
+        layout.maxOffset = layout.startOffset + JOURNAL_BENCH_LOG_GROUP_SIZE;
+        layout.footerStartOffset = layout.maxOffset;
+        return layout;
+    }
+};
+
+// Checkpoints complete immediately, so that the log groups never run out
+class MicrobenchLogGroupReleaser : public MockLogGroupReleaser
+{
+public:
+    BufferOffsetAllocator* allocator = nullptr;
+
+    void
+    MarkLogGroupFull(int logGroupId, uint32_t sequenceNumber) override
+    {
+        allocator->LogBufferReseted(logGroupId);
+    }
+};
+
+static BufferOffsetAllocator* journalBenchAllocator = nullptr;
+static MicrobenchJournalConfiguration* journalBenchConfig = nullptr;
+static MicrobenchLogGroupReleaser* journalBenchReleaser = nullptr;
+
+// range(0): log size in bytes
+static void
+BM_BufferOffsetAllocatorAllocate(benchmark::State& state)
+{
+    uint32_t logSize = state.range(0);
+    if (state.thread_index() == 0)
+    {
+        journalBenchConfig = new MicrobenchJournalConfiguration();
+        journalBenchReleaser = new MicrobenchLogGroupReleaser();
+        journalBenchAllocator = new BufferOffsetAllocator();
+        journalBenchReleaser->allocator = journalBenchAllocator;
+        journalBenchAllocator->Init(journalBenchReleaser, journalBenchConfig);
+    }
+
+    MapList dirty;
+    uint64_t retried = 0;
+    for (auto _ : state)
+    {
+        uint64_t offset = 0;
+        if (journalBenchAllocator->AllocateBuffer(logSize, offset) == 0)
+        {
+            journalBenchAllocator->LogFilled(journalBenchAllocator->GetLogGroupId(offset), dirty);
+        }
+        else
+        {
+            retried++;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["retried"] = benchmark::Counter(retried, benchmark::Counter::kAvgThreads);
+
+    if (state.thread_index() == 0)
+    {
+        journalBenchAllocator->Dispose();
+        delete journalBenchAllocator;
+        delete journalBenchReleaser;
+        delete journalBenchConfig;
+        journalBenchAllocator = nullptr;
+    }
+}
+BENCHMARK(BM_BufferOffsetAllocatorAllocate)
+    ->Arg(sizeof(BlockWriteDoneLog))
+    ->Arg(sizeof(StripeMapUpdatedLog))
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
+// Fills one log group with block write done logs of 8 blocks each, laid out
+// like the writer does: a log never crosses a meta page
+static void*
+BuildLogGroup(bool compact, uint64_t& numLogs)
+{
+    char* buffer = static_cast<char*>(calloc(1, JOURNAL_BENCH_LOG_GROUP_SIZE));
+    uint64_t offset = 0;
+    numLogs = 0;
+    while (true)
+    {
+        VirtualBlkAddr startVsa = {.stripeId = static_cast<StripeId>(numLogs / 8), .offset = (numLogs % 8) * 8};
+        StripeAddr wbAddr = {.stripeLoc = IN_WRITE_BUFFER_AREA, .stripeId = static_cast<StripeId>(numLogs / 8)};
+        std::unique_ptr<LogHandlerInterface> log;
+        if (compact == true)
+        {
+            log.reset(new CompactBlockWriteDoneLogHandler(1, numLogs * 8, 8, startVsa, 0, wbAddr));
+        }
+        else
+        {
+            log.reset(new BlockWriteDoneLogHandler(1, numLogs * 8, 8, startVsa, 0, wbAddr));
+        }
+        log->SetSeqNum(1);
+
+        uint64_t size = log->GetSize();
+        if (offset / JOURNAL_BENCH_META_PAGE_SIZE != (offset + size - 1) / JOURNAL_BENCH_META_PAGE_SIZE)
+        {
+            offset = (offset / JOURNAL_BENCH_META_PAGE_SIZE + 1) * JOURNAL_BENCH_META_PAGE_SIZE;
+        }
+        if (offset + size > JOURNAL_BENCH_LOG_GROUP_SIZE)
+        {
+            break;
+        }
+        memcpy(buffer + offset, log->GetData(), size);
+        offset += size;
+        numLogs++;
+    }
+    return buffer;
+}
+
+// range(0): 1 for the compact log format
+static void
+BM_LogBufferParserGetLogs(benchmark::State& state)
+{
+    uint64_t numLogs = 0;
+    void* buffer = BuildLogGroup(state.range(0) == 1, numLogs);
+    LogBufferParser parser;
+    LogList logs;
+    for (auto _ : state)
+    {
+        parser.GetLogs(buffer, JOURNAL_BENCH_LOG_GROUP_SIZE, logs);
+        logs.Reset();
+    }
+    state.SetItemsProcessed(state.iterations() * numLogs);
+    state.SetBytesProcessed(state.iterations() * JOURNAL_BENCH_LOG_GROUP_SIZE);
+    free(buffer);
+}
+BENCHMARK(BM_LogBufferParserGetLogs)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+} // namespace pos
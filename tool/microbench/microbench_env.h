@@ -0,0 +1,180 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <numa.h>
+#include <sched.h>
+
+#include <cstdlib>
+#include <cstring>
+
+#include "src/cpu_affinity/affinity_manager.h"
+#include "src/dpdk_wrapper/hugepage_allocator.h"
+#include "src/include/memory.h"
+#include "src/lib/singleton.h"
+#include "src/resource_manager/buffer_pool.h"
+#include "src/resource_manager/buffer_pool_factory.h"
+#include "src/resource_manager/memory_manager.h"
+
+namespace pos
+{
+// Serves BufferPool allocations from the heap, so that the components
+// run without DPDK hugepages
+class HeapHugepageAllocator : public HugepageAllocator
+{
+public:
+    void*
+    AllocFromSocket(const uint32_t size, const uint32_t count, const uint32_t socket) override
+    {
+        void* mem = nullptr;
+        if (posix_memalign(&mem, size, static_cast<size_t>(size) * count) != 0)
+        {
+            return nullptr;
+        }
+        return mem;
+    }
+    void
+    Free(void* addr) override
+    {
+        free(addr);
+    }
+    uint32_t
+    GetDefaultPageSize(void) override
+    {
+        return 2 * SZ_1MB;
+    }
+};
+
+class HeapBufferPoolFactory : public BufferPoolFactory
+{
+public:
+    explicit HeapBufferPoolFactory(HugepageAllocator* allocator)
+    : allocator(allocator)
+    {
+    }
+    BufferPool*
+    Create(BufferInfo& info, uint32_t socket) override
+    {
+        BufferPool* pool = new BufferPool(info, socket, allocator);
+        if (pool->IsAllocated() == false)
+        {
+            delete pool;
+            return nullptr;
+        }
+        return pool;
+    }
+
+private:
+    HugepageAllocator* allocator;
+};
+
+// Affinity and memory managers shared by the benchmarks. The affinity
+// manager is installed as the singleton before anything else takes it, so
+// that Event and Callback work without the configuration of a running POS.
+class MicrobenchEnv
+{
+public:
+    MicrobenchEnv(void)
+    {
+        CpuSetArray cpuSets = _BuildCpuSets();
+        affinityManager = AffinityManagerSingleton::Instance<uint32_t, CpuSetArray&>(
+            numa_num_configured_cpus(), cpuSets);
+        // the memory manager owns the factory
+        memoryManager = new MemoryManager(new HeapBufferPoolFactory(&hugepageAllocator), affinityManager);
+    }
+    ~MicrobenchEnv(void)
+    {
+        delete memoryManager;
+    }
+
+    AffinityManager*
+    GetAffinityManager(void)
+    {
+        return affinityManager;
+    }
+    MemoryManager*
+    GetMemoryManager(void)
+    {
+        return memoryManager;
+    }
+    HugepageAllocator*
+    GetHugepageAllocator(void)
+    {
+        return &hugepageAllocator;
+    }
+
+    // Buffers filled with a fixed pseudo random pattern, aligned as the hugepage ones
+    static void*
+    AllocBuffer(size_t size)
+    {
+        void* mem = nullptr;
+        if (posix_memalign(&mem, BUFFER_ALIGN, size) != 0)
+        {
+            return nullptr;
+        }
+        uint32_t seed = static_cast<uint32_t>(size);
+        uint8_t* ptr = static_cast<uint8_t*>(mem);
+        for (size_t i = 0; i < size; i++)
+        {
+            seed = seed * 1103515245 + 12345;
+            ptr[i] = static_cast<uint8_t>(seed >> 16);
+        }
+        return mem;
+    }
+
+private:
+    static CpuSetArray
+    _BuildCpuSets(void)
+    {
+        CpuSetArray sets;
+        for (cpu_set_t& set : sets)
+        {
+            CPU_ZERO(&set);
+            for (int cpu = 0; cpu < numa_num_configured_cpus(); cpu++)
+            {
+                CPU_SET(cpu, &set);
+            }
+        }
+        return sets;
+    }
+
+    static const size_t BUFFER_ALIGN = 4096;
+
+    HeapHugepageAllocator hugepageAllocator;
+    AffinityManager* affinityManager = nullptr;
+    MemoryManager* memoryManager = nullptr;
+};
+
+using MicrobenchEnvSingleton = Singleton<MicrobenchEnv>;
+
+} // namespace pos
@@ -0,0 +1,147 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// MakeParity of a full stripe, with the source chunks already in memory.
+// range(0): data chunks per stripe
+
+#include <benchmark/benchmark.h>
+
+#include <list>
+#include <vector>
+
+#include "src/array/ft/buffer_entry.h"
+#include "src/array/ft/raid5.h"
+#include "src/array/ft/raid6.h"
+#include "src/array_models/dto/partition_physical_size.h"
+#include "src/include/array_config.h"
+#include "tool/microbench/microbench_env.h"
+
+namespace pos
+{
+static const uint64_t PARITY_BUFFER_CNT_PER_NUMA = 64;
+
+static PartitionPhysicalSize
+BuildPhysicalSize(uint32_t chunksPerStripe)
+{
+    PartitionPhysicalSize size;
+    size.blksPerChunk = ArrayConfig::BLOCKS_PER_CHUNK;
+    size.chunksPerStripe = chunksPerStripe;
+    size.stripesPerSegment = ArrayConfig::STRIPES_PER_SEGMENT;
+    size.totalSegments = 1;
+    return size;
+}
+
+class StripeSources
+{
+public:
+    explicit StripeSources(uint32_t dataChunks)
+    {
+        for (uint32_t i = 0; i < dataChunks; i++)
+        {
+            void* mem = MicrobenchEnv::AllocBuffer(CHUNK_SIZE);
+            chunks.push_back(mem);
+            buffers.push_back(BufferEntry(mem, ArrayConfig::BLOCKS_PER_CHUNK));
+        }
+        entry.addr = {.stripeId = 0, .offset = 0};
+        entry.blkCnt = dataChunks * ArrayConfig::BLOCKS_PER_CHUNK;
+        entry.buffers = &buffers;
+    }
+    ~StripeSources(void)
+    {
+        for (void* mem : chunks)
+        {
+            free(mem);
+        }
+    }
+
+    static const uint64_t CHUNK_SIZE = ArrayConfig::BLOCKS_PER_CHUNK * ArrayConfig::BLOCK_SIZE_BYTE;
+    LogicalWriteEntry entry;
+
+private:
+    std::vector<void*> chunks;
+    std::list<BufferEntry> buffers;
+};
+
+static void
+ReturnParities(std::list<FtWriteEntry>& ftl)
+{
+    for (FtWriteEntry& fwe : ftl)
+    {
+        for (BufferEntry& parity : fwe.buffers)
+        {
+            parity.ReturnBuffer();
+        }
+    }
+}
+
+static void
+BM_Raid5MakeParity(benchmark::State& state)
+{
+    MicrobenchEnv* env = MicrobenchEnvSingleton::Instance();
+    uint32_t dataChunks = state.range(0);
+    PartitionPhysicalSize size = BuildPhysicalSize(dataChunks + 1);
+    Raid5 raid5(&size, 0);
+    raid5.AllocParityPools(PARITY_BUFFER_CNT_PER_NUMA, env->GetAffinityManager(), env->GetMemoryManager());
+    StripeSources sources(dataChunks);
+
+    for (auto _ : state)
+    {
+        std::list<FtWriteEntry> ftl;
+        raid5.MakeParity(ftl, sources.entry);
+        ReturnParities(ftl);
+    }
+    state.SetBytesProcessed(state.iterations() * dataChunks * StripeSources::CHUNK_SIZE);
+    raid5.ClearParityPools();
+}
+BENCHMARK(BM_Raid5MakeParity)->Arg(3)->Arg(7)->Arg(15)->Arg(31);
+
+static void
+BM_Raid6MakeParity(benchmark::State& state)
+{
+    MicrobenchEnv* env = MicrobenchEnvSingleton::Instance();
+    uint32_t dataChunks = state.range(0);
+    PartitionPhysicalSize size = BuildPhysicalSize(dataChunks + 2);
+    Raid6 raid6(&size, 0);
+    raid6.AllocParityPools(PARITY_BUFFER_CNT_PER_NUMA, env->GetAffinityManager(), env->GetMemoryManager());
+    StripeSources sources(dataChunks);
+
+    for (auto _ : state)
+    {
+        std::list<FtWriteEntry> ftl;
+        raid6.MakeParity(ftl, sources.entry);
+        ReturnParities(ftl);
+    }
+    state.SetBytesProcessed(state.iterations() * dataChunks * StripeSources::CHUNK_SIZE);
+    raid6.ClearParityPools();
+}
+BENCHMARK(BM_Raid6MakeParity)->Arg(2)->Arg(6)->Arg(14)->Arg(30);
+} // namespace pos
@@ -0,0 +1,103 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Ownership of host write ranges, acquired and released as the write path does.
+// range(0): blocks per acquisition
+
+#include <benchmark/benchmark.h>
+
+#include "src/include/array_config.h"
+#include "src/io/general_io/rba_state_manager.h"
+
+namespace pos
+{
+static const uint32_t RBA_BENCH_VOLUME_ID = 0;
+static const uint64_t RBA_BENCH_TOTAL_RBA = 16ULL * 1024 * 1024 * 1024 / ArrayConfig::BLOCK_SIZE_BYTE;
+// small enough that threads keep meeting each other in the contended case
+static const uint64_t RBA_BENCH_HOT_RBA = 1024;
+
+static RBAStateManager*
+GetRbaStateManager(void)
+{
+    static RBAStateManager* manager = []()
+    {
+        RBAStateManager* rbaStateManager = new RBAStateManager("microbench", 0);
+        rbaStateManager->CreateRBAState(RBA_BENCH_VOLUME_ID, RBA_BENCH_TOTAL_RBA);
+        return rbaStateManager;
+    }();
+    return manager;
+}
+
+// Every thread writes its own region, as volumes on disjoint host reactors do
+static void
+BM_RbaStateAcquireRelease(benchmark::State& state)
+{
+    RBAStateManager* manager = GetRbaStateManager();
+    uint32_t count = state.range(0);
+    uint64_t regionSize = RBA_BENCH_TOTAL_RBA / state.threads();
+    BlkAddr regionStart = regionSize * state.thread_index();
+    BlkAddr rba = 0;
+    for (auto _ : state)
+    {
+        BlkAddr startRba = regionStart + rba;
+        if (manager->BulkAcquireOwnership(RBA_BENCH_VOLUME_ID, startRba, count) == true)
+        {
+            manager->BulkReleaseOwnership(RBA_BENCH_VOLUME_ID, startRba, count);
+        }
+        rba = (rba + count) % (regionSize - count);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RbaStateAcquireRelease)->Arg(1)->Arg(8)->Arg(32)->ThreadRange(1, 16)->UseRealTime();
+
+// Every thread rewrites the same few blocks; a failed acquisition is retried
+static void
+BM_RbaStateAcquireReleaseContended(benchmark::State& state)
+{
+    RBAStateManager* manager = GetRbaStateManager();
+    uint32_t count = state.range(0);
+    BlkAddr rba = (state.thread_index() * count) % (RBA_BENCH_HOT_RBA - count);
+    uint64_t retried = 0;
+    for (auto _ : state)
+    {
+        while (manager->BulkAcquireOwnership(RBA_BENCH_VOLUME_ID, rba, count) == false)
+        {
+            retried++;
+        }
+        manager->BulkReleaseOwnership(RBA_BENCH_VOLUME_ID, rba, count);
+        rba = (rba + count) % (RBA_BENCH_HOT_RBA - count);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["retried"] = benchmark::Counter(retried, benchmark::Counter::kAvgThreads);
+}
+BENCHMARK(BM_RbaStateAcquireReleaseContended)->Arg(1)->Arg(32)->ThreadRange(2, 16)->UseRealTime();
+} // namespace pos
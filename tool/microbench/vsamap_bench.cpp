@@ -0,0 +1,160 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Block map lookups and updates of one volume held in memory.
+// The map covers 16 GiB of 4 KiB blocks and is fully populated up front, so
+// that the benchmarks measure the mpage access rather than the allocation.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "src/include/array_config.h"
+#include "src/include/memory.h"
+#include "src/mapper/address/mapper_address_info.h"
+#include "src/mapper/vsamap/vsamap_content.h"
+
+namespace pos
+{
+static const uint64_t VSAMAP_NUM_BLKS = 16ULL * 1024 * 1024 * 1024 / ArrayConfig::BLOCK_SIZE_BYTE;
+static const uint64_t VSAMAP_MPAGE_SIZE = 4032;
+static const uint32_t VSAMAP_RANDOM_RBA_CNT = 64 * 1024;
+static const uint32_t VSAMAP_BATCH_BLKS = 32;
+
+class VsaMapBench
+{
+public:
+    VsaMapBench(void)
+    : content(0, &addrInfo)
+    {
+        content.InMemoryInit(0, VSAMAP_NUM_BLKS, VSAMAP_MPAGE_SIZE);
+        for (BlkAddr rba = 0; rba < VSAMAP_NUM_BLKS; rba++)
+        {
+            content.SetEntry(rba, VsaOf(rba));
+        }
+
+        std::mt19937_64 gen(VSAMAP_NUM_BLKS);
+        std::uniform_int_distribution<BlkAddr> dist(0, VSAMAP_NUM_BLKS - VSAMAP_BATCH_BLKS);
+        for (uint32_t i = 0; i < VSAMAP_RANDOM_RBA_CNT; i++)
+        {
+            randomRbas.push_back(dist(gen));
+        }
+    }
+
+    static VirtualBlkAddr
+    VsaOf(BlkAddr rba)
+    {
+        return {.stripeId = static_cast<StripeId>(rba / ArrayConfig::BLOCKS_PER_CHUNK),
+            .offset = rba % ArrayConfig::BLOCKS_PER_CHUNK};
+    }
+
+    BlkAddr
+    GetRandomRba(uint64_t index)
+    {
+        return randomRbas[index % VSAMAP_RANDOM_RBA_CNT];
+    }
+
+    MapperAddressInfo addrInfo;
+    VSAMapContent content;
+
+private:
+    std::vector<BlkAddr> randomRbas;
+};
+
+static VsaMapBench*
+GetVsaMapBench(void)
+{
+    // built once and kept for every benchmark of this file; populating takes a while
+    static VsaMapBench* bench = new VsaMapBench();
+    return bench;
+}
+
+static void
+BM_VsaMapGetEntry(benchmark::State& state)
+{
+    VsaMapBench* bench = GetVsaMapBench();
+    uint64_t index = state.thread_index() * VSAMAP_RANDOM_RBA_CNT / state.threads();
+    for (auto _ : state)
+    {
+        VirtualBlkAddr vsa = bench->content.GetEntry(bench->GetRandomRba(index++));
+        benchmark::DoNotOptimize(vsa);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_VsaMapGetEntry)->ThreadRange(1, 16)->UseRealTime();
+
+static void
+BM_VsaMapSetEntry(benchmark::State& state)
+{
+    VsaMapBench* bench = GetVsaMapBench();
+    uint64_t index = state.thread_index() * VSAMAP_RANDOM_RBA_CNT / state.threads();
+    for (auto _ : state)
+    {
+        BlkAddr rba = bench->GetRandomRba(index++);
+        bench->content.SetEntry(rba, VsaMapBench::VsaOf(rba));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_VsaMapSetEntry)->ThreadRange(1, 16)->UseRealTime();
+
+// A 128 KiB host I/O worth of entries at once
+static void
+BM_VsaMapGetEntries(benchmark::State& state)
+{
+    VsaMapBench* bench = GetVsaMapBench();
+    uint64_t index = state.thread_index() * VSAMAP_RANDOM_RBA_CNT / state.threads();
+    VirtualBlkAddr vsas[VSAMAP_BATCH_BLKS];
+    for (auto _ : state)
+    {
+        bench->content.GetEntries(bench->GetRandomRba(index++), VSAMAP_BATCH_BLKS, vsas);
+        benchmark::DoNotOptimize(vsas);
+    }
+    state.SetItemsProcessed(state.iterations() * VSAMAP_BATCH_BLKS);
+}
+BENCHMARK(BM_VsaMapGetEntries)->ThreadRange(1, 16)->UseRealTime();
+
+static void
+BM_VsaMapSetEntries(benchmark::State& state)
+{
+    VsaMapBench* bench = GetVsaMapBench();
+    uint64_t index = state.thread_index() * VSAMAP_RANDOM_RBA_CNT / state.threads();
+    for (auto _ : state)
+    {
+        BlkAddr rba = bench->GetRandomRba(index++);
+        VirtualBlks vsas = {.startVsa = VsaMapBench::VsaOf(rba), .numBlks = VSAMAP_BATCH_BLKS};
+        bench->content.SetEntries(rba, vsas);
+    }
+    state.SetItemsProcessed(state.iterations() * VSAMAP_BATCH_BLKS);
+}
+BENCHMARK(BM_VsaMapSetEntries)->ThreadRange(1, 16)->UseRealTime();
+} // namespace pos
@@ -0,0 +1,402 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "tool/library_unit_test/library_unit_test.h"
+pos::LibraryUnitTest libraryUnitTest;
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "spdk/pos.h"
+#include "src/array_components/mount_phase_recorder.h"
+#include "src/array_mgmt/array_manager.h"
+#include "src/include/address_type.h"
+#include "src/include/memory.h"
+#include "src/include/partition_type.h"
+#include "src/io/frontend_io/unvmf_io_handler.h"
+#include "src/mapper/i_map_flush.h"
+#include "src/mapper/i_vsamap.h"
+#include "src/mapper_service/mapper_service.h"
+#include "src/spdk_wrapper/accel_engine_api.h"
+#include "src/spdk_wrapper/event_framework_api.h"
+
+// Measures how long an array takes to mount with large metadata, phase by phase.
+//
+// Run it twice on the same devices:
+//   ./mount_bench --phase=prepare [options] <options of setup_ibofos_nvmf_volume.sh>
+//     creates the array and the volumes, fills the vsa maps of all volumes but
+//     the last one with synthetic entries and stores them, writes to the last
+//     volume to fill the journal log groups, then kills the process so that
+//     the logs are left for replay.
+//   ./mount_bench --phase=mount [options] <options of setup_ibofos_nvmf_volume.sh>
+//     brings the array up without a clean bringup and prints the time of each
+//     mount phase (the mount sequences, map load, allocator load and journal
+//     replay), as recorded by MountPhaseRecorder.
+//
+//   --volumes=<count>        (default 8, same value in both phases)
+//   --volume_size=<bytes>    (default 2147483648, same value in both phases)
+//   --journal_writes=<count> 4KB writes to the last volume (default 262144)
+//
+// The journal is replayed only if it is enabled and its log buffer survives the
+// process, i.e. the write buffer is on pmem ("-m" of the setup script). The data
+// pointed to by the synthetic vsa entries is garbage; the array is for
+// measurement only.
+namespace pos
+{
+struct MountBenchOptions
+{
+    bool prepare = true;
+    uint32_t volumeCount = 8;
+    uint64_t volumeSize = 2147483648ULL;
+    uint64_t journalWrites = 262144;
+};
+
+static const uint32_t JOURNAL_FILL_QUEUE_DEPTH = 32;
+
+class JournalFiller;
+
+struct JournalFillSlot
+{
+    pos_io posIo;
+    struct iovec iov;
+    JournalFiller* filler;
+};
+
+// Random 4KB writes from a single reactor, so that every write leaves a block
+// map update in the journal
+class JournalFiller
+{
+public:
+    JournalFiller(const char* arrayName, uint32_t arrayId, uint32_t volumeId, uint64_t volumeSize)
+    : core(static_cast<uint32_t>(AccelEngineApi::GetReactorByIndex(0))),
+      blockCount(volumeSize / BLOCK_SIZE),
+      random(0x9E3779B97F4A7C15ULL),
+      submitted(0),
+      total(0),
+      completed(0),
+      failed(0),
+      kicked(false)
+    {
+        mem = pos::Memory<>::Alloc(JOURNAL_FILL_QUEUE_DEPTH);
+        slots.resize(JOURNAL_FILL_QUEUE_DEPTH);
+        for (uint32_t index = 0; index < JOURNAL_FILL_QUEUE_DEPTH; index++)
+        {
+            JournalFillSlot& slot = slots[index];
+            memset(&slot.posIo, 0, sizeof(slot.posIo));
+            slot.iov.iov_base = static_cast<char*>(mem) + index * BLOCK_SIZE;
+            slot.iov.iov_len = BLOCK_SIZE;
+            slot.posIo.ioType = IO_TYPE::WRITE;
+            slot.posIo.volume_id = volumeId;
+            slot.posIo.array_id = arrayId;
+            slot.posIo.iov = &slot.iov;
+            slot.posIo.iovcnt = 1;
+            slot.posIo.length = BLOCK_SIZE;
+            slot.posIo.context = &slot;
+            slot.posIo.arrayName = const_cast<char*>(arrayName);
+            slot.posIo.complete_cb = _Complete;
+            slot.filler = this;
+            freeSlots.push_back(&slot);
+        }
+    }
+
+    ~JournalFiller(void)
+    {
+        pos::Memory<>::Free(mem);
+    }
+
+    uint64_t
+    Run(uint64_t writeCount)
+    {
+        total = writeCount;
+        _Kick();
+        while (completed + failed < total)
+        {
+            usleep(1000);
+        }
+        while (kicked)
+        {
+            usleep(1000);
+        }
+        return failed;
+    }
+
+private:
+    // completions only return their slots, the submission is deferred to an event
+    void
+    _Kick(void)
+    {
+        if (kicked == false)
+        {
+            kicked = true;
+            EventFrameworkApiSingleton::Instance()->SendSpdkEvent(core, _SubmitAll, this, nullptr);
+        }
+    }
+
+    static void
+    _SubmitAll(void* arg1, void* arg2)
+    {
+        JournalFiller* filler = static_cast<JournalFiller*>(arg1);
+        size_t count = filler->freeSlots.size();
+        for (size_t index = 0; index < count && filler->submitted < filler->total; index++)
+        {
+            JournalFillSlot* slot = filler->freeSlots.back();
+            filler->freeSlots.pop_back();
+            filler->random ^= filler->random << 13;
+            filler->random ^= filler->random >> 7;
+            filler->random ^= filler->random << 17;
+            slot->posIo.offset = (filler->random % filler->blockCount) * BLOCK_SIZE;
+            filler->submitted++;
+            UNVMfSubmitHandler(&slot->posIo);
+        }
+        filler->kicked = false;
+        if (filler->submitted < filler->total && filler->freeSlots.empty() == false)
+        {
+            filler->_Kick();
+        }
+    }
+
+    static void
+    _Complete(struct pos_io* posIo, int status)
+    {
+        JournalFillSlot* slot = static_cast<JournalFillSlot*>(posIo->context);
+        JournalFiller* filler = slot->filler;
+        if (status == POS_IO_STATUS_RETRY)
+        {
+            // written again with the next kick
+            filler->submitted--;
+        }
+        else if (status != POS_IO_STATUS_SUCCESS)
+        {
+            filler->failed++;
+        }
+        else
+        {
+            filler->completed++;
+        }
+        filler->freeSlots.push_back(slot);
+        if (filler->submitted < filler->total)
+        {
+            filler->_Kick();
+        }
+    }
+
+    uint32_t core;
+    uint64_t blockCount;
+    void* mem;
+    std::vector<JournalFillSlot> slots;
+    std::vector<JournalFillSlot*> freeSlots;
+    uint64_t random;
+    uint64_t submitted;
+    uint64_t total;
+    std::atomic<uint64_t> completed;
+    std::atomic<uint64_t> failed;
+    std::atomic<bool> kicked;
+};
+
+class MountBench
+{
+public:
+    explicit MountBench(const MountBenchOptions& options)
+    : options(options)
+    {
+    }
+
+    int
+    Prepare(void)
+    {
+        IArrayInfo* arrayInfo = ArrayMgr()->GetInfo(arrayName)->arrayInfo;
+        const PartitionLogicalSize* userSize = arrayInfo->GetSizeInfo(PartitionType::USER_DATA);
+        IVSAMap* vsaMap = MapperServiceSingleton::Instance()->GetIVSAMap(arrayName);
+        IMapFlush* mapFlush = MapperServiceSingleton::Instance()->GetIMapFlush(arrayName);
+
+        auto start = std::chrono::steady_clock::now();
+        uint64_t blockCount = options.volumeSize / BLOCK_SIZE;
+        uint64_t stripeIndex = 0;
+        for (uint32_t volumeId = 0; volumeId + 1 < options.volumeCount; volumeId++)
+        {
+            for (BlkAddr rba = 0; rba < blockCount; rba += userSize->blksPerStripe)
+            {
+                VirtualBlks blks;
+                blks.startVsa.stripeId = stripeIndex % userSize->totalStripes;
+                blks.startVsa.offset = 0;
+                blks.numBlks = std::min<uint64_t>(userSize->blksPerStripe, blockCount - rba);
+                stripeIndex++;
+                int ret = vsaMap->SetVSAs(volumeId, rba, blks);
+                if (ret != 0)
+                {
+                    printf("failed to set vsa, volume:%u rba:%lu ret:%d\n", volumeId, rba, ret);
+                    return ret;
+                }
+            }
+        }
+        int ret = mapFlush->StoreAll();
+        if (ret != 0)
+        {
+            printf("failed to store the maps, ret:%d\n", ret);
+            return ret;
+        }
+        printf("vsa maps of %u volumes filled and stored in %.1fs\n", options.volumeCount - 1,
+            _SecondsSince(start));
+
+        start = std::chrono::steady_clock::now();
+        JournalFiller filler(arrayName, arrayInfo->GetIndex(), options.volumeCount - 1, options.volumeSize);
+        uint64_t failed = filler.Run(options.journalWrites);
+        printf("%lu writes to volume %u done in %.1fs, failed:%lu\n", options.journalWrites,
+            options.volumeCount - 1, _SecondsSince(start), failed);
+        return 0;
+    }
+
+    void
+    Report(void)
+    {
+        MountPhaseList phases = MountPhaseRecorderSingleton::Instance()->GetPhases(arrayName);
+        if (phases.empty())
+        {
+            printf("no mount phase recorded for %s\n", arrayName);
+            return;
+        }
+        printf("%-40s %14s\n", "phase", "elapsed_ms");
+        uint64_t totalUs = 0;
+        for (auto& phase : phases)
+        {
+            printf("%-40s %14.1f\n", phase.first.c_str(), phase.second / 1000.0);
+            // sub-phases are part of the sequence they run in
+            if (phase.first.find('.') == std::string::npos)
+            {
+                totalUs += phase.second;
+            }
+        }
+        printf("%-40s %14.1f\n", "total", totalUs / 1000.0);
+    }
+
+private:
+    static double
+    _SecondsSince(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    char arrayName[32] = "POSArray";
+    MountBenchOptions options;
+};
+
+static bool
+ParseOption(const char* arg, const char* name, std::string& value)
+{
+    size_t length = strlen(name);
+    if (strncmp(arg, name, length) != 0 || arg[length] != '=')
+    {
+        return false;
+    }
+    value = std::string(arg + length + 1);
+    return true;
+}
+
+// Consumes the benchmark options and leaves the rest for the setup script
+static void
+ParseOptions(int argc, char* argv[], MountBenchOptions& options, std::vector<std::string>& setupArgs)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        std::string value;
+        if (ParseOption(argv[i], "--phase", value))
+        {
+            options.prepare = (value != "mount");
+        }
+        else if (ParseOption(argv[i], "--volumes", value))
+        {
+            options.volumeCount = std::stoul(value);
+        }
+        else if (ParseOption(argv[i], "--volume_size", value))
+        {
+            options.volumeSize = std::stoull(value);
+        }
+        else if (ParseOption(argv[i], "--journal_writes", value))
+        {
+            options.journalWrites = std::stoull(value);
+        }
+        else
+        {
+            setupArgs.push_back(argv[i]);
+        }
+    }
+    setupArgs.push_back("-c");
+    setupArgs.push_back(options.prepare ? "1" : "0");
+    setupArgs.push_back("-v");
+    setupArgs.push_back(std::to_string(options.volumeCount));
+    setupArgs.push_back("-s");
+    setupArgs.push_back(std::to_string(options.volumeCount));
+    setupArgs.push_back("-S");
+    setupArgs.push_back(std::to_string(options.volumeSize) + "B");
+}
+} // namespace pos
+
+int
+main(int argc, char* argv[])
+{
+    pos::MountBenchOptions options;
+    std::vector<std::string> setupArgs;
+    pos::ParseOptions(argc, argv, options, setupArgs);
+
+    std::vector<char*> setupArgv;
+    setupArgv.push_back(argv[0]);
+    for (std::string& arg : setupArgs)
+    {
+        setupArgv.push_back(&arg[0]);
+    }
+    // the array is mounted by the setup script
+    libraryUnitTest.Initialize(setupArgv.size(), setupArgv.data(), "../../");
+
+    pos::MountBench bench(options);
+    libraryUnitTest.TestStart(1);
+    if (options.prepare)
+    {
+        int ret = bench.Prepare();
+        libraryUnitTest.TestResult(1, ret == 0);
+    }
+    else
+    {
+        bench.Report();
+        libraryUnitTest.TestResult(1, true);
+    }
+    // exits without unmount, leaving the journal for replay
+    libraryUnitTest.SuccessAndExit();
+    return 0;
+}
@@ -8,13 +8,14 @@ var (
 
 func Run() {
 	var wait sync.WaitGroup
-	wait.Add(3)
+	wait.Add(4)
 	
 	parseCustomLabel()
 
 	go runSubscriber()
 	go runProvider()
 	go runExpiryManager()
+	go runShmReader()
 
 	wait.Wait()
 }
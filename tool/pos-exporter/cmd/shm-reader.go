@@ -0,0 +1,173 @@
+package cmd
+
+import (
+	"encoding/binary"
+	"log"
+	"os"
+	"strings"
+	"sync/atomic"
+	"syscall"
+	"time"
+	"unsafe"
+)
+
+// Reader of the shared memory metric table written by POS
+// (src/telemetry/telemetry_client/shm_global_publisher.h).
+// The layout below has to match ShmMetricTableHeader and ShmMetricSlot.
+const (
+	shmPath            = "/dev/shm/pos_telemetry"
+	shmMagic           = uint64(0x4d4c4554534f50)
+	shmVersion         = uint32(1)
+	shmHeaderSize      = 64
+	shmSlotSize        = 256
+	shmKeyOffset       = 26
+	shmPollInterval    = 100 * time.Millisecond
+	shmRetryInterval   = 1 * time.Second
+	shmMaxReadAttempts = 16
+
+	shmTypeCounter = uint32(0)
+	shmTypeGauge   = uint32(1)
+)
+
+type shmSeries struct {
+	name      string
+	labels    *map[string]string
+	lastValue uint64
+}
+
+type shmReader struct {
+	data       []byte
+	generation uint64
+	series     []*shmSeries
+}
+
+func runShmReader() {
+	for {
+		reader := openShmReader(shmPath)
+		if reader == nil {
+			time.Sleep(shmRetryInterval)
+			continue
+		}
+		log.Printf("reading metrics from %s", shmPath)
+		for reader.poll() {
+			time.Sleep(shmPollInterval)
+		}
+		reader.close()
+	}
+}
+
+func openShmReader(path string) *shmReader {
+	file, err := os.Open(path)
+	if err != nil {
+		return nil
+	}
+	defer file.Close()
+
+	info, err := file.Stat()
+	if err != nil || info.Size() < shmHeaderSize {
+		return nil
+	}
+	data, err := syscall.Mmap(int(file.Fd()), 0, int(info.Size()), syscall.PROT_READ, syscall.MAP_SHARED)
+	if err != nil {
+		return nil
+	}
+	return &shmReader{data: data}
+}
+
+func (r *shmReader) close() {
+	syscall.Munmap(r.data)
+}
+
+func (r *shmReader) uint32At(offset int) uint32 {
+	return atomic.LoadUint32((*uint32)(unsafe.Pointer(&r.data[offset])))
+}
+
+func (r *shmReader) uint64At(offset int) uint64 {
+	return atomic.LoadUint64((*uint64)(unsafe.Pointer(&r.data[offset])))
+}
+
+// returns false when the table no longer matches the mapping and has to be reopened
+func (r *shmReader) poll() bool {
+	if r.uint64At(0) != shmMagic {
+		// POS is (re)initializing the table
+		return true
+	}
+	slotCount := int(r.uint32At(16))
+	if r.uint32At(8) != shmVersion || r.uint32At(12) != shmSlotSize ||
+		shmHeaderSize+slotCount*shmSlotSize > len(r.data) {
+		return false
+	}
+	generation := r.uint64At(24)
+	if generation != r.generation {
+		r.generation = generation
+		r.series = nil
+	}
+
+	used := int(r.uint32At(20))
+	if used > slotCount {
+		used = slotCount
+	}
+
+	mutex.Lock()
+	defer mutex.Unlock()
+	for idx := 0; idx < used; idx++ {
+		offset := shmHeaderSize + idx*shmSlotSize
+		if idx == len(r.series) {
+			r.series = append(r.series, r.parseSeries(offset))
+		}
+		value, ok := r.readValue(offset)
+		if !ok {
+			continue
+		}
+		series := r.series[idx]
+		switch r.uint32At(offset + 4) {
+		case shmTypeCounter:
+			delta := value
+			if value >= series.lastValue {
+				delta = value - series.lastValue
+			}
+			series.lastValue = value
+			if delta != 0 {
+				addCounter(&CounterMetric{series.name, series.labels, delta})
+			}
+		case shmTypeGauge:
+			addGauge(&GaugeMetric{series.name, series.labels, int64(value)})
+		}
+	}
+	return true
+}
+
+// seqlock read: retry while a writer holds the slot or has updated it meanwhile
+func (r *shmReader) readValue(offset int) (uint64, bool) {
+	for attempt := 0; attempt < shmMaxReadAttempts; attempt++ {
+		begin := r.uint32At(offset)
+		if begin&1 != 0 {
+			continue
+		}
+		value := r.uint64At(offset + 8)
+		if r.uint32At(offset) == begin {
+			return value, true
+		}
+	}
+	return 0, false
+}
+
+// the key is "name\nkey=value\nkey=value..." and never changes once the slot is used
+func (r *shmReader) parseSeries(offset int) *shmSeries {
+	keyLength := int(binary.LittleEndian.Uint16(r.data[offset+24:]))
+	key := string(r.data[offset+shmKeyOffset : offset+shmKeyOffset+keyLength])
+	fields := strings.Split(key, "\n")
+
+	labelMap := map[string]string{}
+	for _, field := range fields[1:] {
+		kv := strings.SplitN(field, kv_mapper, 2)
+		if len(kv) == 2 {
+			labelMap[kv[0]] = kv[1]
+		}
+	}
+	if isValidCustomLabel() {
+		k, v := getCustomLabel()
+		labelMap[k] = v
+	}
+	return &shmSeries{name: fields[0], labels: &labelMap}
+}
@@ -0,0 +1,126 @@
+/*
+ *   BSD LICENSE
+ *   Copyright (c) 2022 Samsung Electronics Corporation
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Samsung Electronics Corporation nor the names of
+ *       its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Reports XOR parity throughput (GB/s of source data) per stripe width for
+//  - pairwise : the former RAID5 kernel, which re-reads dst for every source
+//  - scalar   : single pass over all sources with the portable loop
+//  - engine   : XorEngine::Compute (ISA-L xor_gen when accelerable)
+// usage: ./xor_benchmark [chunk_size_byte] [iterations]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+#include "src/array/ft/xor_engine.h"
+
+using namespace pos;
+
+static void
+XorPairwise(void* dst, void* const* srcs, uint32_t srcCnt, uint32_t size)
+{
+    uint64_t* d = static_cast<uint64_t*>(dst);
+    uint32_t elementCnt = size / sizeof(uint64_t);
+    memcpy(dst, srcs[0], size);
+    for (uint32_t s = 1; s < srcCnt; s++)
+    {
+        const uint64_t* src = static_cast<const uint64_t*>(srcs[s]);
+        for (uint32_t i = 0; i < elementCnt; i++)
+        {
+            d[i] ^= src[i];
+        }
+    }
+}
+
+using XorFunc = std::function<void(void*, void* const*, uint32_t, uint32_t)>;
+
+static double
+Measure(XorFunc func, void* dst, std::vector<void*>& srcs, uint32_t size, uint32_t iterations)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        func(dst, srcs.data(), srcs.size(), size);
+    }
+    auto end = std::chrono::steady_clock::now();
+    double sec = std::chrono::duration<double>(end - start).count();
+    double bytes = static_cast<double>(size) * srcs.size() * iterations;
+    return bytes / sec / 1e9;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t chunkSize = 256 * 1024;
+    uint32_t iterations = 2000;
+    if (argc > 1)
+    {
+        chunkSize = strtoul(argv[1], nullptr, 0);
+    }
+    if (argc > 2)
+    {
+        iterations = strtoul(argv[2], nullptr, 0);
+    }
+
+    const uint32_t MIN_STRIPE_WIDTH = 3;
+    const uint32_t MAX_STRIPE_WIDTH = 32;
+
+    printf("chunk size: %u bytes, iterations: %u\n", chunkSize, iterations);
+    printf("%-8s %-8s %12s %12s %12s\n", "width", "sources", "pairwise", "scalar", "engine");
+
+    for (uint32_t width = MIN_STRIPE_WIDTH; width <= MAX_STRIPE_WIDTH; width++)
+    {
+        uint32_t srcCnt = width - 1;
+        std::vector<void*> srcs;
+        for (uint32_t i = 0; i < srcCnt; i++)
+        {
+            void* buf = aligned_alloc(4096, chunkSize);
+            memset(buf, i + 1, chunkSize);
+            srcs.push_back(buf);
+        }
+        void* dst = aligned_alloc(4096, chunkSize);
+
+        double pairwise = Measure(XorPairwise, dst, srcs, chunkSize, iterations);
+        double scalar = Measure(XorEngine::ComputeScalar, dst, srcs, chunkSize, iterations);
+        double engine = Measure(XorEngine::Compute, dst, srcs, chunkSize, iterations);
+        printf("%-8u %-8u %9.2fGB/s %9.2fGB/s %9.2fGB/s\n", width, srcCnt, pairwise, scalar, engine);
+
+        for (void* buf : srcs)
+        {
+            free(buf);
+        }
+        free(dst);
+    }
+    return 0;
+}